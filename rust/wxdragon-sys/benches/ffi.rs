@@ -0,0 +1,247 @@
+//! Microbenchmarks of the raw C API as seen from Rust, run with `cargo bench -p wxdragon-sys`.
+//!
+//! This is the Rust-side companion of the `wxdragon_bench` CMake target: same fixed sizes,
+//! same sampling (one warm-up, then `WXD_BENCH_REPEAT` samples, default 7) and the same JSON
+//! result schema, so the two can be compared to separate wxWidgets cost from FFI crossing
+//! cost. Set `WXD_BENCH_FILTER` to run a subset and `WXD_BENCH_JSON` to write the results to
+//! a file instead of stdout.
+
+use std::ffi::{CString, c_char, c_void};
+use std::hint::black_box;
+use std::time::Instant;
+use wxdragon_sys as ffi;
+
+// libwxdragon calls back into these; the real definitions live in the wxdragon crate.
+#[unsafe(no_mangle)]
+pub extern "C" fn process_rust_callbacks() -> i32 {
+    0
+}
+#[unsafe(no_mangle)]
+pub extern "C" fn drop_rust_event_closure_box(_ptr: *mut c_void) {}
+#[unsafe(no_mangle)]
+pub extern "C" fn drop_rust_event_closure_boxes(_ptrs: *const *mut c_void, _count: usize) {}
+#[unsafe(no_mangle)]
+pub extern "C" fn drop_rust_custom_renderer_callbacks(_ptr: *mut c_void) {}
+#[unsafe(no_mangle)]
+pub extern "C" fn wxd_Drop_Rust_DataViewTreeModelCallbacks(_ptr: *mut ffi::wxd_DataViewTreeModel_Callbacks) {}
+#[unsafe(no_mangle)]
+pub extern "C" fn wxd_Drop_Rust_CustomModelCallbacks(_ptr: *mut c_void) {}
+
+struct Sample {
+    name: String,
+    ops: u64,
+    min_ns: f64,
+    median_ns: f64,
+    max_ns: f64,
+}
+
+struct Runner {
+    filter: Option<String>,
+    repeat: usize,
+    results: Vec<Sample>,
+}
+
+impl Runner {
+    fn from_env() -> Self {
+        Self {
+            filter: std::env::var("WXD_BENCH_FILTER").ok(),
+            repeat: std::env::var("WXD_BENCH_REPEAT")
+                .ok()
+                .and_then(|v| v.parse().ok())
+                .unwrap_or(7usize)
+                .max(1),
+            results: Vec::new(),
+        }
+    }
+
+    fn bench(&mut self, name: &str, ops: u64, mut body: impl FnMut(u64)) {
+        if self.filter.as_deref().is_some_and(|f| !name.contains(f)) {
+            return;
+        }
+        body(ops);
+        let mut samples: Vec<f64> = (0..self.repeat)
+            .map(|_| {
+                let start = Instant::now();
+                body(ops);
+                start.elapsed().as_nanos() as f64 / ops as f64
+            })
+            .collect();
+        samples.sort_by(|a, b| a.total_cmp(b));
+        let sample = Sample {
+            name: name.to_string(),
+            ops,
+            min_ns: samples[0],
+            median_ns: samples[samples.len() / 2],
+            max_ns: samples[samples.len() - 1],
+        };
+        eprintln!(
+            "{:<40} {:>12.1} ns/op (min {:.1}, max {:.1})",
+            name, sample.median_ns, sample.min_ns, sample.max_ns
+        );
+        self.results.push(sample);
+    }
+
+    fn to_json(&self) -> String {
+        let mut out = String::from("{\n  \"schema\": 1,\n  \"suite\": \"wxdragon-sys/ffi\",\n");
+        out.push_str(&format!("  \"platform\": \"{}\",\n  \"results\": [\n", std::env::consts::OS));
+        for (i, r) in self.results.iter().enumerate() {
+            out.push_str(&format!(
+                "    {{\"name\": \"{}\", \"ops_per_sample\": {}, \"min_ns\": {:.3}, \"median_ns\": {:.3}, \"max_ns\": {:.3}}}{}\n",
+                r.name,
+                r.ops,
+                r.min_ns,
+                r.median_ns,
+                r.max_ns,
+                if i + 1 < self.results.len() { "," } else { "" }
+            ));
+        }
+        out.push_str("  ]\n}\n");
+        out
+    }
+}
+
+fn point(x: i32, y: i32) -> ffi::wxd_Point {
+    ffi::wxd_Point { x, y }
+}
+
+fn size(width: i32, height: i32) -> ffi::wxd_Size {
+    ffi::wxd_Size { width, height }
+}
+
+unsafe fn bench_strings(runner: &mut Runner, frame: *mut ffi::wxd_Window_t) {
+    let label = CString::new("wxdragon bench").unwrap();
+    let mut buffer = [0 as c_char; 64];
+    runner.bench("string/window_label_roundtrip", 100_000, |ops| {
+        for _ in 0..ops {
+            unsafe {
+                ffi::wxd_Window_SetLabel(frame, label.as_ptr());
+                black_box(ffi::wxd_Window_GetLabel(frame, buffer.as_mut_ptr(), buffer.len()));
+            }
+        }
+    });
+}
+
+unsafe fn bench_grid(runner: &mut Runner, frame: *mut ffi::wxd_Window_t) {
+    const ROWS: i32 = 1000;
+    const COLS: i32 = 20;
+    let grid = unsafe { ffi::wxd_Grid_Create(frame, ffi::WXD_ID_ANY as i32, point(0, 0), size(400, 300), 0) };
+    unsafe { ffi::wxd_Grid_CreateGrid(grid, ROWS, COLS, 0) };
+    let values: Vec<CString> = (0..ROWS * COLS).map(|i| CString::new(format!("cell {i}")).unwrap()).collect();
+    runner.bench("grid/set_cell_value_1000x20", 1, |ops| {
+        for _ in 0..ops {
+            for r in 0..ROWS {
+                for c in 0..COLS {
+                    let value = &values[(r * COLS + c) as usize];
+                    unsafe { ffi::wxd_Grid_SetCellValue(grid, r, c, value.as_ptr()) };
+                }
+            }
+        }
+    });
+    unsafe { ffi::wxd_Window_Destroy(grid as *mut ffi::wxd_Window_t) };
+}
+
+unsafe fn bench_dc(runner: &mut Runner) {
+    let rgba = vec![255u8; 512 * 512 * 4];
+    let bitmap = unsafe { ffi::wxd_Bitmap_CreateFromRGBA(rgba.as_ptr(), 512, 512) };
+    let memory = unsafe { ffi::wxd_MemoryDC_Create() };
+    unsafe { ffi::wxd_MemoryDC_SelectObject(memory, bitmap) };
+    let dc = memory as *mut ffi::wxd_DC_t;
+    let pen = ffi::wxd_Colour_t {
+        r: 20,
+        g: 40,
+        b: 200,
+        a: 255,
+    };
+    let brush = ffi::wxd_Colour_t {
+        r: 200,
+        g: 40,
+        b: 20,
+        a: 255,
+    };
+    unsafe {
+        ffi::wxd_DC_SetPen(dc, pen, 1, ffi::WXD_PENSTYLE_SOLID as i32);
+        ffi::wxd_DC_SetBrush(dc, brush, ffi::WXD_BRUSHSTYLE_SOLID as i32);
+    }
+    runner.bench("dc/draw_line", 100_000, |ops| {
+        for i in 0..ops {
+            let k = (i % 500) as i32;
+            unsafe { ffi::wxd_DC_DrawLine(dc, k, 0, 511 - k, 511) };
+        }
+    });
+    runner.bench("dc/draw_rectangle_32", 100_000, |ops| {
+        for i in 0..ops {
+            let k = (i % 480) as i32;
+            unsafe { ffi::wxd_DC_DrawRectangle(dc, k, k, 32, 32) };
+        }
+    });
+    let text = CString::new("wxDragon 123").unwrap();
+    runner.bench("dc/draw_text_short", 20_000, |ops| {
+        for i in 0..ops {
+            unsafe { ffi::wxd_DC_DrawText(dc, text.as_ptr(), (i % 400) as i32, 10) };
+        }
+    });
+    unsafe {
+        ffi::wxd_MemoryDC_SelectObject(memory, std::ptr::null());
+        ffi::wxd_MemoryDC_Destroy(memory);
+        ffi::wxd_Bitmap_Destroy(bitmap);
+    }
+}
+
+unsafe fn bench_bitmaps(runner: &mut Runner) {
+    const SIDE: i32 = 256;
+    let rgba: Vec<u8> = (0..(SIDE * SIDE * 4) as usize).map(|i| (i * 31) as u8).collect();
+    runner.bench("bitmap/rgba_to_bitmap_256", 200, |ops| {
+        for _ in 0..ops {
+            unsafe { ffi::wxd_Bitmap_Destroy(ffi::wxd_Bitmap_CreateFromRGBA(rgba.as_ptr(), SIDE, SIDE)) };
+        }
+    });
+    let bitmap = unsafe { ffi::wxd_Bitmap_CreateFromRGBA(rgba.as_ptr(), SIDE, SIDE) };
+    runner.bench("bitmap/bitmap_to_rgba_256", 200, |ops| {
+        for _ in 0..ops {
+            let (mut width, mut height) = (0usize, 0usize);
+            unsafe {
+                let data = ffi::wxd_Bitmap_GetRGBAData(bitmap, &mut width, &mut height);
+                black_box(data);
+                ffi::wxd_Bitmap_FreeRGBAData(data);
+            }
+        }
+    });
+    unsafe { ffi::wxd_Bitmap_Destroy(bitmap) };
+}
+
+unsafe extern "C" fn run_all(user_data: *mut c_void) -> bool {
+    let runner = unsafe { &mut *(user_data as *mut Runner) };
+    let title = CString::new("wxdragon-sys bench").unwrap();
+    unsafe {
+        let frame = ffi::wxd_Frame_Create(
+            std::ptr::null_mut(),
+            ffi::WXD_ID_ANY as i32,
+            title.as_ptr(),
+            point(0, 0),
+            size(900, 700),
+            ffi::WXD_DEFAULT_FRAME_STYLE,
+        ) as *mut ffi::wxd_Window_t;
+        bench_strings(runner, frame);
+        bench_grid(runner, frame);
+        bench_dc(runner);
+        bench_bitmaps(runner);
+        ffi::wxd_Window_Destroy(frame);
+    }
+    // Returning false ends wxd_Main without entering the event loop.
+    false
+}
+
+fn main() {
+    // `cargo bench` passes libtest flags such as `--bench`; wx must not see them.
+    let mut runner = Runner::from_env();
+    let program = CString::new("wxdragon-sys-bench").unwrap();
+    let mut argv = [program.as_ptr() as *mut c_char, std::ptr::null_mut()];
+    unsafe {
+        ffi::wxd_Main(1, argv.as_mut_ptr(), Some(run_all), &mut runner as *mut Runner as *mut c_void);
+    }
+    let json = runner.to_json();
+    match std::env::var("WXD_BENCH_JSON") {
+        Ok(path) => std::fs::write(&path, json).expect("failed to write WXD_BENCH_JSON"),
+        Err(_) => print!("{json}"),
+    }
+}
@@ -33,7 +33,8 @@ fn main() -> Result<(), Box<dyn std::error::Error + Send + Sync + 'static>> {
         .clang_arg(format!(
             "-DwxdUSE_RICHTEXT={}",
             if cfg!(feature = "richtext") { 1 } else { 0 }
-        ));
+        ))
+        .clang_arg(format!("-DwxdUSE_OPENGL={}", if cfg!(feature = "opengl") { 1 } else { 0 }));
 
     // Skip library setup for docs.rs and rust-analyzer
     if std::env::var("DOCS_RS").is_ok() || std::env::var("RUST_ANALYZER") == Ok("true".to_string()) {
@@ -276,7 +277,23 @@ fn build_wxdragon_wrapper(
     cmake_config
         .define("wxdUSE_STC", if cfg!(feature = "stc") { "1" } else { "0" })
         .define("wxdUSE_XRC", if cfg!(feature = "xrc") { "1" } else { "0" })
-        .define("wxdUSE_RICHTEXT", if cfg!(feature = "richtext") { "1" } else { "0" });
+        .define("wxdUSE_RICHTEXT", if cfg!(feature = "richtext") { "1" } else { "0" })
+        .define("wxdUSE_OPENGL", if cfg!(feature = "opengl") { "1" } else { "0" });
+    // Strip Debug/Trace logging from the C++ code entirely.
+    cmake_config.define(
+        "wxdLOG_MAX_LEVEL",
+        if cfg!(feature = "log-strip-verbose") { "3" } else { "5" },
+    );
+    // Instrument the C API for wxdragon::profile.
+    cmake_config.define(
+        "wxdENABLE_FFI_PROFILE",
+        if cfg!(feature = "ffi-profile") { "ON" } else { "OFF" },
+    );
+    // Live object counters for wxdragon::profile::object_stats.
+    cmake_config.define(
+        "wxdENABLE_OBJECT_STATS",
+        if cfg!(feature = "object-stats") { "ON" } else { "OFF" },
+    );
 
     let profile = std::env::var("PROFILE").unwrap_or_else(|_| "debug".to_string());
 
@@ -718,6 +735,7 @@ fn build_wxdragon_wrapper(
         println!("cargo:rustc-link-lib=framework=Cocoa");
         println!("cargo:rustc-link-lib=framework=IOKit");
         println!("cargo:rustc-link-lib=framework=QuartzCore");
+        println!("cargo:rustc-link-lib=framework=CoreVideo");
         println!("cargo:rustc-link-lib=framework=AppKit");
         println!("cargo:rustc-link-lib=framework=CoreGraphics");
         println!("cargo:rustc-link-lib=framework=Foundation");
@@ -733,6 +751,9 @@ fn build_wxdragon_wrapper(
         if cfg!(feature = "webview") {
             println!("cargo:rustc-link-lib=framework=WebKit");
         }
+        if cfg!(feature = "opengl") {
+            println!("cargo:rustc-link-lib=framework=OpenGL");
+        }
 
         fix_isPlatformVersionAtLeast()?;
     } else if target_os == "windows" {
@@ -901,6 +922,9 @@ fn build_wxdragon_wrapper(
         println!("cargo:rustc-link-lib=oleacc");
         println!("cargo:rustc-link-lib=uxtheme");
         println!("cargo:rustc-link-lib=imm32"); // Add IME library for Scintilla support
+        if cfg!(feature = "opengl") {
+            println!("cargo:rustc-link-lib=opengl32");
+        }
     } else {
         // For Linux and other Unix-like systems
         println!("cargo:rustc-link-lib=xkbcommon");
@@ -975,6 +999,22 @@ fn build_wxdragon_wrapper(
         if cfg!(feature = "media-ctrl") {
             println!("cargo:rustc-link-lib=static=wx_gtk3u_media-3.3");
         }
+        if cfg!(feature = "opengl") {
+            // wxGLCanvas uses EGL (Wayland and X11) when available, GLX otherwise.
+            for name in ["egl", "wayland-egl", "gl"] {
+                match pkg_config::Config::new().probe(name) {
+                    Ok(lib) => {
+                        for lib in lib.libs {
+                            println!("cargo:rustc-link-lib={lib}");
+                        }
+                    }
+                    Err(_) if name == "gl" => {
+                        println!("cargo:warning=libGL not found; install the OpenGL development package (e.g. libgl-dev).");
+                    }
+                    Err(_) => {}
+                }
+            }
+        }
         if cfg!(feature = "stc") {
             println!("cargo:rustc-link-lib=static=wx_gtk3u_stc-3.3");
             println!("cargo:rustc-link-lib=static=wxscintilla-3.3");
@@ -0,0 +1,559 @@
+// wxdragon_bench: reproducible microbenchmarks of the C wrapper layer.
+//
+// Build with -DwxdBUILD_BENCH=ON and run `wxdragon_bench [--filter TEXT] [--repeat N]
+// [--json FILE]`. Every benchmark uses fixed sizes and data, runs one warm-up sample and then
+// N timed samples, and reports min/median/max nanoseconds per operation. Results go to stdout
+// as JSON (schema 1, same as `cargo bench -p wxdragon-sys`) so runs can be diffed across
+// releases; progress lines go to stderr.
+
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "../src/wxd_pixels.h"
+#include "../src/wxd_utils.h"
+#include <wx/grid.h>
+#include <wx/platinfo.h>
+#include <wx/utils.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// The library calls back into these Rust-side functions; the bench owns no Rust objects.
+extern "C" {
+int
+process_rust_callbacks()
+{
+    return 0;
+}
+void
+drop_rust_event_closure_box(void*)
+{
+}
+void
+drop_rust_event_closure_boxes(void* const*, size_t)
+{
+}
+void
+drop_rust_custom_renderer_callbacks(void*)
+{
+}
+void
+wxd_Drop_Rust_DataViewTreeModelCallbacks(wxd_DataViewTreeModel_Callbacks*)
+{
+}
+void
+wxd_Drop_Rust_CustomModelCallbacks(void*)
+{
+}
+}
+
+namespace {
+
+struct Options {
+    std::string filter;
+    std::string json_path;
+    int repeat = 7;
+};
+
+struct Result {
+    std::string name;
+    uint64_t ops_per_sample;
+    double min_ns;
+    double median_ns;
+    double max_ns;
+};
+
+Options g_options;
+std::vector<Result> g_results;
+// Defeats dead-code elimination of benchmark bodies.
+volatile uint64_t g_sink = 0;
+
+// Runs `body(ops)` once to warm up, then g_options.repeat timed samples.
+template <typename Body>
+void
+bench(const std::string& name, uint64_t ops, Body&& body)
+{
+    if (!g_options.filter.empty() && name.find(g_options.filter) == std::string::npos)
+        return;
+    using Clock = std::chrono::steady_clock;
+    body(ops);
+    std::vector<double> samples;
+    for (int i = 0; i < g_options.repeat; ++i) {
+        const Clock::time_point start = Clock::now();
+        body(ops);
+        const double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        samples.push_back(ns / static_cast<double>(ops));
+    }
+    std::sort(samples.begin(), samples.end());
+    Result result{ name, ops, samples.front(), samples[samples.size() / 2], samples.back() };
+    fprintf(stderr, "%-40s %12.1f ns/op (min %.1f, max %.1f)\n", name.c_str(), result.median_ns,
+            result.min_ns, result.max_ns);
+    g_results.push_back(result);
+}
+
+// Prints the result of `name`, if it ran, as bytes per second; for benchmarks whose op is one
+// byte.
+void
+report_throughput(const std::string& name)
+{
+    if (g_results.empty() || g_results.back().name != name || g_results.back().median_ns <= 0)
+        return;
+    const Result& r = g_results.back();
+    fprintf(stderr, "%-40s %12.1f MB/s\n", r.name.c_str(), 1000.0 / r.median_ns);
+}
+
+std::string
+json_escape(const std::string& text)
+{
+    std::string out;
+    for (char c : text) {
+        if (c == '"' || c == '\\')
+            out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+void
+write_results()
+{
+    FILE* out = g_options.json_path.empty() ? stdout : fopen(g_options.json_path.c_str(), "w");
+    if (!out) {
+        fprintf(stderr, "cannot write %s\n", g_options.json_path.c_str());
+        return;
+    }
+    const std::string platform = wxPlatformInfo::Get().GetPortIdShortName().ToStdString();
+    const std::string version = wxVERSION_NUM_DOT_STRING;
+    fprintf(out, "{\n  \"schema\": 1,\n  \"suite\": \"wxdragon_bench\",\n");
+    fprintf(out, "  \"platform\": \"%s\",\n  \"wx_version\": \"%s\",\n  \"results\": [\n",
+            json_escape(platform).c_str(), json_escape(version).c_str());
+    for (size_t i = 0; i < g_results.size(); ++i) {
+        const Result& r = g_results[i];
+        fprintf(out,
+                "    {\"name\": \"%s\", \"ops_per_sample\": %llu, \"min_ns\": %.3f, "
+                "\"median_ns\": %.3f, \"max_ns\": %.3f}%s\n",
+                json_escape(r.name).c_str(), static_cast<unsigned long long>(r.ops_per_sample),
+                r.min_ns, r.median_ns, r.max_ns, i + 1 < g_results.size() ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+    if (out != stdout)
+        fclose(out);
+}
+
+// Lets the frame get mapped and painted once, so paint benchmarks measure steady state.
+void
+settle(wxWindow* window)
+{
+    const wxLongLong deadline = wxGetLocalTimeMillis() + 2000;
+    while (!window->IsShownOnScreen() && wxGetLocalTimeMillis() < deadline)
+        wxTheApp->Yield(true);
+    window->Update();
+}
+
+// --- Event dispatch ---
+
+void
+count_event(void* closure, void*)
+{
+    ++*static_cast<uint64_t*>(closure);
+}
+
+void
+bench_events(wxd_Window_t* frame)
+{
+    static uint64_t handled = 0;
+    wxWindow* panel = reinterpret_cast<wxWindow*>(
+        wxd_Panel_Create(frame, wxID_ANY, wxd_Point{ 0, 0 }, wxd_Size{ 10, 10 }, 0));
+    wxd_EvtHandler_t* handler = reinterpret_cast<wxd_EvtHandler_t*>(panel);
+    wxd_EvtHandler_Bind(handler, WXD_EVENT_TYPE_COMMAND_BUTTON_CLICKED,
+                        reinterpret_cast<void*>(&count_event), &handled, 1);
+
+    bench("event/dispatch_bound", 200000, [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; ++i) {
+            wxCommandEvent event(wxEVT_BUTTON, panel->GetId());
+            event.SetEventObject(panel);
+            panel->ProcessWindowEvent(event);
+        }
+        g_sink = handled;
+    });
+    bench("event/dispatch_unbound_type", 200000, [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; ++i) {
+            wxCommandEvent event(wxEVT_CHECKBOX, panel->GetId());
+            event.SetEventObject(panel);
+            panel->ProcessWindowEvent(event);
+        }
+    });
+    // Ten closures on one event type, as with many listeners on a shared command.
+    for (size_t token = 2; token <= 10; ++token)
+        wxd_EvtHandler_Bind(handler, WXD_EVENT_TYPE_COMMAND_BUTTON_CLICKED,
+                            reinterpret_cast<void*>(&count_event), &handled, token);
+    bench("event/dispatch_10_closures", 100000, [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; ++i) {
+            wxCommandEvent event(wxEVT_BUTTON, panel->GetId());
+            event.SetEventObject(panel);
+            panel->ProcessWindowEvent(event);
+        }
+        g_sink = handled;
+    });
+    panel->Destroy();
+}
+
+// --- Dispatch table lookup ---
+// The slot lookup of one dispatch in isolation: the flat table sorted by packed (type, id) key
+// that WxdEventHandler uses now, against the per-handler hash map keyed by (type, id) pairs it
+// replaced. A dispatch looks up the event's id and wxID_ANY; most events reaching a handler
+// have no binding at all, so the probe mix is mostly misses.
+
+struct LookupPairHash {
+    size_t
+    operator()(const std::pair<int, int>& p) const
+    {
+        return std::hash<int>{}(p.first) ^ (std::hash<int>{}(p.second) << 1);
+    }
+};
+
+struct LookupSlot {
+    uint64_t key;
+    std::vector<void*> closures;
+};
+
+uint64_t
+lookup_key(int type, int id)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(type)) << 32) |
+           static_cast<uint64_t>(static_cast<uint32_t>(id));
+}
+
+void
+bench_dispatch_lookup()
+{
+    // A typical custom widget: a dozen event types bound for any id, a few for specific ids.
+    std::vector<std::pair<int, int>> bound;
+    for (int type = 0; type < 12; ++type)
+        bound.emplace_back(10000 + type * 7, wxID_ANY);
+    for (int id = 0; id < 4; ++id)
+        bound.emplace_back(10000, 5000 + id);
+
+    std::unordered_map<std::pair<int, int>, std::vector<void*>, LookupPairHash> map;
+    std::vector<LookupSlot> table;
+    for (const auto& key : bound) {
+        map[key].push_back(nullptr);
+        table.push_back(LookupSlot{ lookup_key(key.first, key.second), { nullptr } });
+    }
+    std::sort(table.begin(), table.end(),
+              [](const LookupSlot& a, const LookupSlot& b) { return a.key < b.key; });
+
+    // One hit in four.
+    std::vector<std::pair<int, int>> probes;
+    for (int i = 0; i < 1024; ++i) {
+        const int type = i % 4 == 0 ? 10000 + (i % 12) * 7 : 20000 + i;
+        probes.emplace_back(type, 5000 + i % 8);
+    }
+
+    bench("event/lookup_hash_map_16", 1000000, [&](uint64_t ops) {
+        uint64_t found = 0;
+        for (uint64_t i = 0; i < ops; ++i) {
+            const auto& probe = probes[i & 1023];
+            found += map.count(probe);
+            found += map.count(std::make_pair(probe.first, static_cast<int>(wxID_ANY)));
+        }
+        g_sink = found;
+    });
+    bench("event/lookup_sorted_table_16", 1000000, [&](uint64_t ops) {
+        uint64_t found = 0;
+        const auto find = [&](uint64_t key) {
+            auto it = std::lower_bound(
+                table.begin(), table.end(), key,
+                [](const LookupSlot& slot, uint64_t k) { return slot.key < k; });
+            return it != table.end() && it->key == key;
+        };
+        for (uint64_t i = 0; i < ops; ++i) {
+            const auto& probe = probes[i & 1023];
+            found += find(lookup_key(probe.first, probe.second));
+            found += find(lookup_key(probe.first, wxID_ANY));
+        }
+        g_sink = found;
+    });
+}
+
+// --- Strings ---
+
+void
+bench_strings(wxd_Window_t* frame)
+{
+    const wxString short_text = wxString::FromUTF8("Label \xC3\xA9t\xC3\xA9 16");
+    const wxString long_text(wxUniChar(0x4E2D), 4096);
+    std::vector<char> buffer(4096 * 4 + 1);
+
+    bench("string/copy_to_buffer_16", 500000, [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; ++i)
+            g_sink = wxd_cpp_utils::copy_wxstring_to_buffer(short_text, buffer.data(),
+                                                            buffer.size());
+    });
+    bench("string/copy_to_buffer_4k_cjk", 20000, [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; ++i)
+            g_sink = wxd_cpp_utils::copy_wxstring_to_buffer(long_text, buffer.data(),
+                                                            buffer.size());
+    });
+    bench("string/window_label_roundtrip", 100000, [&](uint64_t ops) {
+        char label[64];
+        for (uint64_t i = 0; i < ops; ++i) {
+            wxd_Window_SetLabel(frame, "wxdragon bench");
+            g_sink = wxd_Window_GetLabel(frame, label, sizeof(label));
+        }
+    });
+}
+
+// --- Grid ---
+
+void
+bench_grid(wxd_Window_t* frame)
+{
+    constexpr int kRows = 1000;
+    constexpr int kCols = 20;
+    wxd_Grid_t* grid =
+        wxd_Grid_Create(frame, wxID_ANY, wxd_Point{ 0, 0 }, wxd_Size{ 400, 300 }, 0);
+    wxd_Grid_CreateGrid(grid, kRows, kCols, 0);
+    std::vector<std::string> values;
+    for (int i = 0; i < kRows * kCols; ++i)
+        values.push_back("cell " + std::to_string(i));
+
+    bench("grid/set_cell_value_1000x20", 1, [&](uint64_t ops) {
+        for (uint64_t n = 0; n < ops; ++n)
+            for (int r = 0; r < kRows; ++r)
+                for (int c = 0; c < kCols; ++c)
+                    wxd_Grid_SetCellValue(grid, r, c, values[r * kCols + c].c_str());
+    });
+    wxd_Window_Destroy(reinterpret_cast<wxd_Window_t*>(grid));
+
+    // One million cell sets, through the thread-local scratch conversion and through the
+    // temporary wxString::FromUTF8() the setter used before it.
+    constexpr int kBigRows = 50000;
+    wxd_Grid_t* big = wxd_Grid_Create(frame, wxID_ANY, wxd_Point{ 0, 0 }, wxd_Size{ 400, 300 }, 0);
+    wxd_Grid_CreateGrid(big, kBigRows, kCols, 0);
+    wxGrid* big_grid = reinterpret_cast<wxGrid*>(big);
+    const uint64_t cells = static_cast<uint64_t>(kBigRows) * kCols;
+    bench("grid/set_cell_value_1M_scratch", cells, [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; ++i) {
+            const int r = static_cast<int>(i / kCols % kBigRows);
+            const int c = static_cast<int>(i % kCols);
+            wxd_Grid_SetCellValue(big, r, c, values[i % values.size()].c_str());
+        }
+    });
+    bench("grid/set_cell_value_1M_from_utf8", cells, [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; ++i) {
+            const int r = static_cast<int>(i / kCols % kBigRows);
+            const int c = static_cast<int>(i % kCols);
+            big_grid->SetCellValue(r, c, wxString::FromUTF8(values[i % values.size()].c_str()));
+        }
+    });
+    // The conversion alone, without the grid.
+    bench("string/scratch_wxstring_1M", 1000000, [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; ++i) {
+            wxd_cpp_utils::ScratchWxString text(values[i % values.size()].c_str());
+            g_sink = text.str().length();
+        }
+    });
+    bench("string/from_utf8_1M", 1000000, [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; ++i)
+            g_sink = wxString::FromUTF8(values[i % values.size()].c_str()).length();
+    });
+    wxd_Window_Destroy(reinterpret_cast<wxd_Window_t*>(big));
+}
+
+// --- Virtual DataView paint ---
+
+bool
+dataview_value(void*, uint64_t row, uint64_t col, wxd_Variant_t* out)
+{
+    char text[48];
+    const int len = snprintf(text, sizeof(text), "r%llu c%llu", static_cast<unsigned long long>(row),
+                             static_cast<unsigned long long>(col));
+    wxd_Variant_SetString_Utf8(out, text, len);
+    return true;
+}
+
+void
+bench_dataview(wxd_Window_t* frame)
+{
+    for (int columns : { 4, 16, 64 }) {
+        const wxd_Point pos{ 0, 0 };
+        const wxd_Size size{ 800, 600 };
+        wxd_Window_t* ctrl = wxd_DataViewCtrl_Create(frame, wxID_ANY, &pos, &size, 0);
+        wxd_DataViewModel_t* model = wxd_DataViewVirtualListModel_CreateWithCallbacks(
+            100000, nullptr, dataview_value, nullptr, nullptr, nullptr);
+        for (int c = 0; c < columns; ++c) {
+            wxd_DataViewRenderer_t* renderer = wxd_DataViewTextRenderer_Create("string", 0, 0);
+            const std::string title = "Col " + std::to_string(c);
+            wxd_DataViewCtrl_AppendColumn(
+                ctrl, wxd_DataViewColumn_Create(title.c_str(), renderer, c, 80, 0, 0));
+        }
+        wxd_DataViewCtrl_AssociateModel(ctrl, model);
+        wxd_DataViewModel_Release(model);
+        wxWindow* window = reinterpret_cast<wxWindow*>(ctrl);
+        settle(window);
+
+        bench("dataview/virtual_paint_" + std::to_string(columns) + "_cols", 20,
+              [&](uint64_t ops) {
+                  for (uint64_t i = 0; i < ops; ++i) {
+                      window->Refresh(false);
+                      window->Update();
+                  }
+              });
+        wxd_Window_Destroy(ctrl);
+    }
+}
+
+// --- DC primitives ---
+
+void
+bench_dc()
+{
+    std::vector<unsigned char> rgba(512 * 512 * 4, 255);
+    wxd_Bitmap_t* bitmap = wxd_Bitmap_CreateFromRGBA(rgba.data(), 512, 512);
+    wxd_MemoryDC_t* memory = wxd_MemoryDC_Create();
+    wxd_MemoryDC_SelectObject(memory, bitmap);
+    wxd_DC_t* dc = reinterpret_cast<wxd_DC_t*>(memory);
+    wxd_DC_SetPen(dc, wxd_Colour_t{ 20, 40, 200, 255 }, 1, 100 /* wxPENSTYLE_SOLID */);
+    wxd_DC_SetBrush(dc, wxd_Colour_t{ 200, 40, 20, 255 }, 100 /* wxBRUSHSTYLE_SOLID */);
+
+    bench("dc/draw_line", 100000, [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; ++i) {
+            const int k = static_cast<int>(i % 500);
+            wxd_DC_DrawLine(dc, k, 0, 511 - k, 511);
+        }
+    });
+    bench("dc/draw_rectangle_32", 100000, [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; ++i) {
+            const int k = static_cast<int>(i % 480);
+            wxd_DC_DrawRectangle(dc, k, k, 32, 32);
+        }
+    });
+    bench("dc/draw_text_short", 20000, [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; ++i)
+            wxd_DC_DrawText(dc, "wxDragon 123", static_cast<int>(i % 400), 10);
+    });
+
+    wxd_MemoryDC_SelectObject(memory, nullptr);
+    wxd_MemoryDC_Destroy(memory);
+    wxd_Bitmap_Destroy(bitmap);
+}
+
+// --- RGBA bitmap conversion ---
+
+void
+bench_bitmaps()
+{
+    constexpr int kSide = 256;
+    std::vector<unsigned char> rgba(kSide * kSide * 4);
+    for (size_t i = 0; i < rgba.size(); ++i)
+        rgba[i] = static_cast<unsigned char>(i * 31);
+
+    bench("bitmap/rgba_to_bitmap_256", 200, [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; ++i)
+            wxd_Bitmap_Destroy(wxd_Bitmap_CreateFromRGBA(rgba.data(), kSide, kSide));
+    });
+    wxd_Bitmap_t* bitmap = wxd_Bitmap_CreateFromRGBA(rgba.data(), kSide, kSide);
+    bench("bitmap/bitmap_to_rgba_256", 200, [&](uint64_t ops) {
+        for (uint64_t i = 0; i < ops; ++i) {
+            size_t width = 0, height = 0;
+            unsigned char* data = wxd_Bitmap_GetRGBAData(bitmap, &width, &height);
+            g_sink = data ? data[width * height * 2] : 0;
+            wxd_Bitmap_FreeRGBAData(data);
+        }
+    });
+    wxd_Bitmap_Destroy(bitmap);
+
+    // RGBA <-> wxImage plane conversion of a 4K frame: wxd_pixels against the per-pixel loops
+    // bitmap.cpp used before. One op is one RGBA byte, so the MB/s line is 1000 / ns per op.
+    constexpr size_t kPixels = 3840 * 2160;
+    std::vector<uint8_t> frame_rgba(kPixels * 4);
+    for (size_t i = 0; i < frame_rgba.size(); ++i)
+        frame_rgba[i] = static_cast<uint8_t>(i * 31);
+    std::vector<uint8_t> rgb(kPixels * 3);
+    std::vector<uint8_t> alpha(kPixels);
+    const uint64_t bytes = kPixels * 4;
+
+    bench("bitmap/split_rgba_4k", bytes, [&](uint64_t) {
+        wxd_pixels::split_rgba(frame_rgba.data(), rgb.data(), alpha.data(), kPixels);
+        g_sink = rgb[kPixels];
+    });
+    report_throughput("bitmap/split_rgba_4k");
+    bench("bitmap/split_rgba_4k_scalar", bytes, [&](uint64_t) {
+        for (size_t i = 0; i < kPixels; ++i) {
+            rgb[i * 3] = frame_rgba[i * 4];
+            rgb[i * 3 + 1] = frame_rgba[i * 4 + 1];
+            rgb[i * 3 + 2] = frame_rgba[i * 4 + 2];
+            alpha[i] = frame_rgba[i * 4 + 3];
+        }
+        g_sink = rgb[kPixels];
+    });
+    report_throughput("bitmap/split_rgba_4k_scalar");
+    bench("bitmap/merge_rgba_4k", bytes, [&](uint64_t) {
+        wxd_pixels::merge_rgba(rgb.data(), alpha.data(), frame_rgba.data(), kPixels);
+        g_sink = frame_rgba[kPixels];
+    });
+    report_throughput("bitmap/merge_rgba_4k");
+    bench("bitmap/merge_rgba_4k_scalar", bytes, [&](uint64_t) {
+        for (size_t i = 0; i < kPixels; ++i) {
+            frame_rgba[i * 4] = rgb[i * 3];
+            frame_rgba[i * 4 + 1] = rgb[i * 3 + 1];
+            frame_rgba[i * 4 + 2] = rgb[i * 3 + 2];
+            frame_rgba[i * 4 + 3] = alpha[i];
+        }
+        g_sink = frame_rgba[kPixels];
+    });
+    report_throughput("bitmap/merge_rgba_4k_scalar");
+}
+
+bool
+run_all(void*)
+{
+    wxd_Window_t* frame =
+        reinterpret_cast<wxd_Window_t*>(wxd_Frame_Create(nullptr, wxID_ANY, "wxdragon_bench",
+                                                         wxd_Point{ 0, 0 }, wxd_Size{ 900, 700 },
+                                                         wxDEFAULT_FRAME_STYLE));
+    wxd_Window_Show(frame, true);
+    settle(reinterpret_cast<wxWindow*>(frame));
+
+    bench_events(frame);
+    bench_dispatch_lookup();
+    bench_strings(frame);
+    bench_grid(frame);
+    bench_dataview(frame);
+    bench_dc();
+    bench_bitmaps();
+
+    write_results();
+    wxd_Window_Destroy(frame);
+    // Returning false ends wxd_Main without entering the event loop.
+    return false;
+}
+
+} // namespace
+
+int
+main(int argc, char** argv)
+{
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--filter" && i + 1 < argc)
+            g_options.filter = argv[++i];
+        else if (arg == "--json" && i + 1 < argc)
+            g_options.json_path = argv[++i];
+        else if (arg == "--repeat" && i + 1 < argc)
+            g_options.repeat = std::max(1, atoi(argv[++i]));
+        else {
+            fprintf(stderr, "usage: %s [--filter TEXT] [--repeat N] [--json FILE]\n", argv[0]);
+            return 2;
+        }
+    }
+    wxd_Main(argc > 0 ? 1 : 0, argv, run_all, nullptr);
+    return g_results.empty() ? 1 : 0;
+}
@@ -42,6 +42,25 @@ wxd_ArrayString_Add(wxd_ArrayString_t* self, const char* str);
 WXD_EXPORTED void
 wxd_ArrayString_Clear(wxd_ArrayString_t* self);
 
+/**
+ * Export every string in one call.
+ * Returns all strings concatenated as UTF-8 (no separators) in an owned wxd_String_t, to be
+ * freed with wxd_String_Free. `offsets` must hold GetCount() + 1 entries; string i occupies
+ * bytes [offsets[i], offsets[i + 1]) of the data. Returns NULL on error or if offsets is too short.
+ */
+WXD_EXPORTED wxd_String_t*
+wxd_ArrayString_ExportPacked(const wxd_ArrayString_t* array, size_t* offsets,
+                             size_t offsets_len);
+
+/**
+ * Append `count` strings in one call, using the layout produced by ExportPacked:
+ * `offsets` holds count + 1 entries and string i is data[offsets[i], offsets[i + 1]).
+ * Returns false, appending nothing, if any range is inverted.
+ */
+WXD_EXPORTED bool
+wxd_ArrayString_ImportPacked(wxd_ArrayString_t* self, const char* data, const size_t* offsets,
+                             size_t count);
+
 #ifdef __cplusplus
 }
 #endif
@@ -187,6 +187,51 @@ wxd_Accessible_Destroy(wxd_Accessible_t* self);
 WXD_EXPORTED void
 wxd_Accessible_NotifyEvent(uint32_t eventType, wxd_Window_t* window, int objectType, int objectId);
 
+// --- Cached Accessible Nodes ---
+//
+// Properties published ahead of time for an accessible made by wxd_Accessible_Create, so the
+// frequent polling of screen readers is answered natively instead of calling back into Rust
+// for every query. Nodes are keyed by child id (0 is the object itself); a virtual control can
+// publish only the rows in view. Anything not published still goes to the callbacks.
+
+typedef enum {
+    WXD_ACC_NODE_NAME = 1 << 0,
+    WXD_ACC_NODE_DESCRIPTION = 1 << 1,
+    WXD_ACC_NODE_VALUE = 1 << 2,
+    WXD_ACC_NODE_ROLE = 1 << 3,
+    WXD_ACC_NODE_STATE = 1 << 4,
+    WXD_ACC_NODE_LOCATION = 1 << 5,
+    WXD_ACC_NODE_DEFAULT_ACTION = 1 << 6,
+} wxd_AccNodeFields;
+
+typedef struct {
+    int child_id;
+    uint32_t fields; // wxd_AccNodeFields that are set
+    wxd_AccRole role;
+    long state;
+    const char* name;
+    const char* description;
+    const char* value;
+    const char* default_action;
+    wxd_Rect rect; // In the window's client coordinates, so moving the window keeps it valid.
+} wxd_AccNode;
+
+// Replaces the cached nodes with these child ids. With `notify`, changes to a node that was
+// already cached are announced to assistive technology (name, description, value, state and
+// location change events).
+WXD_EXPORTED void
+wxd_Accessible_PublishNodes(wxd_Accessible_t* self, const wxd_AccNode* nodes, int count,
+                            bool notify);
+
+// Answers GetChildCount from `count`; a negative count goes back to the callback.
+WXD_EXPORTED void
+wxd_Accessible_SetCachedChildCount(wxd_Accessible_t* self, int count);
+
+// Drops the cached nodes with child ids first_child_id .. first_child_id + count - 1, or all of
+// them (the child count included) for a negative count.
+WXD_EXPORTED void
+wxd_Accessible_InvalidateNodes(wxd_Accessible_t* self, int first_child_id, int count);
+
 // --- Window Accessibility Functions ---
 
 /**
@@ -45,6 +45,37 @@ wxd_App_GetVendorDisplayName(const wxd_App_t* app, char* out, size_t out_len);
 WXD_EXPORTED void
 wxd_App_ProcessCallbacks();
 
+// Schedule one drain of the callback queue on the main thread. Thread-safe; wakes the event
+// loop immediately instead of waiting for the next idle event.
+WXD_EXPORTED void
+wxd_App_PostCallbacksWakeup();
+
+// Time budget for one drain of the callback queue. Callbacks run until this much time has
+// elapsed (at least one runs per drain), then the rest wait for the next idle iteration.
+// Defaults to 4000 microseconds.
+WXD_EXPORTED void
+wxd_App_SetCallbackBudgetMicros(uint32_t micros);
+WXD_EXPORTED uint32_t
+wxd_App_GetCallbackBudgetMicros();
+
+// Number of queued callbacks not yet run. The Rust queue adjusts it on every enqueue and pop so
+// the idle handler can skip the drain without entering Rust. Thread-safe; returns the new count.
+WXD_EXPORTED uint32_t
+wxd_App_AdjustPendingCallbacks(int32_t delta);
+WXD_EXPORTED uint32_t
+wxd_App_GetPendingCallbacks();
+
+// Whether the idle handler stays bound (default) or is only bound while callbacks are pending.
+WXD_EXPORTED void
+wxd_App_SetIdleMode(wxd_IdleMode mode);
+WXD_EXPORTED wxd_IdleMode
+wxd_App_GetIdleMode();
+
+// True if the active event loop has native events (input, paint, timers...) waiting.
+// Used to hold back background-priority callbacks.
+WXD_EXPORTED bool
+wxd_App_HasPendingEvents();
+
 // New function to free an array of integers allocated by C++
 WXD_EXPORTED void
 wxd_free_int_array(int* ptr);
@@ -83,6 +114,112 @@ wxd_SystemAppearance_Destroy(wxd_SystemAppearance_t* appearance);
 
 // --- End of Appearance Support ---
 
+// --- Worker Pool ---
+
+// Creates a pool of `thread_count` wxThreads (0 = number of CPUs). Must be called on the main
+// thread after wxd_Main has started.
+WXD_EXPORTED wxd_WorkerPool_t*
+wxd_WorkerPool_Create(int thread_count);
+
+// Queues `job`: `run(job)` executes on a worker thread, then `done(job, target_alive)` runs on
+// the main thread. Results finishing close together are delivered in one batch. If `target` is
+// non-null and gets destroyed first, `done` receives target_alive = false. Main thread only.
+WXD_EXPORTED bool
+wxd_WorkerPool_Submit(wxd_WorkerPool_t* pool, wxd_EvtHandler_t* target, wxd_WorkerRunFn run,
+                      wxd_WorkerDoneFn done, void* job);
+
+// Number of submitted jobs whose `done` has not run yet.
+WXD_EXPORTED int
+wxd_WorkerPool_GetPendingCount(wxd_WorkerPool_t* pool);
+
+// Stops and joins the workers (jobs already running finish first). Every job whose `done` has
+// not run yet gets `done` before this returns, with target_alive reporting only whether its
+// target still exists; results handed back here should be treated as cancelled. Main thread
+// only.
+WXD_EXPORTED void
+wxd_WorkerPool_Destroy(wxd_WorkerPool_t* pool);
+
+// --- Stall Watchdog ---
+
+// Sets how long (ms) a single event dispatch or idle callback drain may run before a warning
+// naming the event type, handler class and Rust trampoline is logged. 0 (the default) disables
+// the watchdog. Set before wxd_Main to watch from startup; may be changed from any thread.
+WXD_EXPORTED void
+wxd_Watchdog_SetThreshold(uint32_t threshold_ms);
+
+// Current threshold in ms (0 = disabled).
+WXD_EXPORTED uint32_t
+wxd_Watchdog_GetThreshold();
+
+// --- Memory Pressure ---
+
+// Shrinks the wrapper's caches (text extents, SVG rasters, pens and brushes, interned fonts and
+// cursors, DataView cell renders) and returns the bytes released. Main thread only.
+WXD_EXPORTED size_t
+wxd_App_TrimMemory(wxd_TrimLevel level);
+
+// Approximate bytes held by all wrapper caches. Main thread only.
+WXD_EXPORTED size_t
+wxd_App_GetCacheBytes(void);
+
+// Fills up to `capacity` entries of `out` with per-cache usage; returns the number of caches.
+// Main thread only.
+WXD_EXPORTED size_t
+wxd_App_GetCacheUsage(wxd_CacheUsage* out, size_t capacity);
+
+// Watches the OS low-memory signal (a memory resource notification on Windows, a dispatch
+// memory pressure source on macOS, a PSI trigger on /proc/pressure/memory on Linux) and on each
+// signal trims the caches on the main thread, then calls `callback` (may be NULL) so the
+// application can drop its own. Replaces a previous watch; `free_user_data`, if set, gets
+// `user_data` once it is replaced or removed. Returns false, leaving `user_data` with the
+// caller, if the platform offers no signal. Main thread only.
+WXD_EXPORTED bool
+wxd_App_WatchMemoryPressure(wxd_MemoryPressureCallback callback, void* user_data,
+                            void (*free_user_data)(void*));
+
+// Stops watching. Main thread only.
+WXD_EXPORTED void
+wxd_App_UnwatchMemoryPressure(void);
+
+// --- Single Instance Handoff ---
+
+// Makes wxd_Main, before initializing wxWidgets, check whether an instance registered under
+// `name` is already running for this user. If so the working directory and arguments are sent
+// to it over a local socket (a named pipe on Windows) and wxd_Main returns 0 without creating
+// the application; otherwise this process becomes the running instance and `on_args` receives
+// what later instances send. Call before wxd_Main. `free_user_data`, if set, gets `user_data`
+// when wxd_Main returns. Returns false if `name` or `on_args` is NULL or wxd_Main is running.
+WXD_EXPORTED bool
+wxd_App_SetSingleInstance(const char* name, wxd_InstanceArgsCallback on_args, void* user_data,
+                          void (*free_user_data)(void*));
+
+// True if the last wxd_Main handed its arguments to a running instance instead of starting.
+WXD_EXPORTED bool
+wxd_App_WasHandedOff();
+
+// --- Process-wide Event Filters ---
+
+// Installs a filter that sees every event the application processes, before any handler. The
+// event's class is looked up natively and `callback` only runs for classes in `class_mask`
+// (wxd_EventFilterClass bits), so unrelated events never leave C++. Filters run in reverse order
+// of installation. `free_user_data`, if set, gets `user_data` once the filter is removed. Main
+// thread only; returns NULL if `callback` is NULL.
+WXD_EXPORTED wxd_EventFilter_t*
+wxd_App_AddEventFilter(wxd_EventFilterCallback callback, uint32_t class_mask, void* user_data,
+                       void (*free_user_data)(void*));
+
+// Uninstalls the filter and frees its user data. Safe to call from inside a filter callback.
+WXD_EXPORTED void
+wxd_App_RemoveEventFilter(wxd_EventFilter_t* filter);
+
+// Replaces the filter's class mask; 0 keeps it installed but never calls it.
+WXD_EXPORTED void
+wxd_EventFilter_SetClassMask(wxd_EventFilter_t* filter, uint32_t class_mask);
+
+// wxd_EventFilterClass bit the event belongs to.
+WXD_EXPORTED uint32_t
+wxd_Event_GetFilterClass(wxd_Event_t* event);
+
 // --- macOS-specific App Event Handlers ---
 
 // Register handlers for macOS application events (supports multiple handlers per event)
@@ -19,6 +19,11 @@ wxd_AppProgressIndicator_IsAvailable(wxd_AppProgressIndicator_t* self);
 WXD_EXPORTED void
 wxd_AppProgressIndicator_SetValue(wxd_AppProgressIndicator_t* self, int value);
 
+// Frame-paced variant: keeps only the newest value and applies it at most once per display
+// frame, and only when the shown percentage changes.
+WXD_EXPORTED void
+wxd_AppProgressIndicator_SetValueDeferred(wxd_AppProgressIndicator_t* self, int value);
+
 // Set the progress range in taskbar button of parent window.
 WXD_EXPORTED void
 wxd_AppProgressIndicator_SetRange(wxd_AppProgressIndicator_t* self, int range);
@@ -40,4 +40,35 @@ wxd_Clipboard_SetText(wxd_Clipboard_t* clipboard, const char* text);
 WXD_EXPORTED int
 wxd_Clipboard_GetText(const wxd_Clipboard_t* clipboard, char* buffer, size_t buffer_len);
 
+// --- Background Reads ---
+
+// Formats for wxd_Clipboard_RequestAsync, each delivered in one canonical encoding
+typedef enum {
+    WXD_CLIPBOARD_FORMAT_TEXT = 0,   // UTF-8 text
+    WXD_CLIPBOARD_FORMAT_HTML = 1,   // UTF-8 HTML
+    WXD_CLIPBOARD_FORMAT_PNG = 2,    // Image, encoded as PNG
+    WXD_CLIPBOARD_FORMAT_FILES = 3,  // Local paths, UTF-8, separated by '\n'
+    WXD_CLIPBOARD_FORMAT_CUSTOM = 4  // Raw bytes of the format named by custom_ids[i]
+} wxd_ClipboardFormat;
+
+// Receives the first available format: its index in the request and its data as an
+// owned buffer the callback must release with wxd_String_Free. format_index is -1,
+// and data NULL, when none of the formats could be read.
+typedef void (*wxd_Clipboard_ReadCallback)(void* user_data, int format_index, wxd_String_t* data);
+typedef void (*wxd_Clipboard_FreeUserData)(void* user_data);
+
+/**
+ * Reads the clipboard (or the primary selection, if in use) without blocking the event
+ * loop where the backend allows it: on GTK (X11 and Wayland) the data is requested
+ * asynchronously from the owner; elsewhere it is read on the next event loop pass.
+ * formats are tried in order; custom_ids (may be NULL) names WXD_CLIPBOARD_FORMAT_CUSTOM
+ * entries. The callback runs once on the GUI thread, never before this returns, and
+ * free_user_data after it. Returns false, freeing user_data, if the request is invalid.
+ */
+WXD_EXPORTED bool
+wxd_Clipboard_RequestAsync(wxd_Clipboard_t* clipboard, const wxd_ClipboardFormat* formats,
+                           const char* const* custom_ids, size_t format_count,
+                           wxd_Clipboard_ReadCallback callback, void* user_data,
+                           wxd_Clipboard_FreeUserData free_user_data);
+
 #endif // WXD_CLIPBOARD_H
\ No newline at end of file
@@ -86,6 +86,18 @@ wxd_Config_ReadString(const wxd_ConfigBase_t* config,
                       size_t buffer_len,
                       const char* default_val);
 
+/**
+ * Reads a string value in a single call.
+ * @param config Pointer to the config object.
+ * @param key The key to read.
+ * @param default_val Default value if key not found.
+ * @return Owned string to release with wxd_String_Free, or NULL on error.
+ */
+WXD_EXPORTED wxd_String_t*
+wxd_Config_ReadStringOwned(const wxd_ConfigBase_t* config,
+                           const char* key,
+                           const char* default_val);
+
 /**
  * Reads a long integer value.
  * @param config Pointer to the config object.
@@ -349,10 +361,47 @@ wxd_Config_RenameGroup(wxd_ConfigBase_t* config,
                        const char* old_name,
                        const char* new_name);
 
+// --- Bulk Operations ---
+
+/*
+ * Snapshots and write batches use one little-endian layout: u32 count, then per
+ * entry a key (u32 length + UTF-8), a u8 wxd_ConfigEntryType and the value: a
+ * string for WXD_CONFIG_TYPE_STRING, u8 for BOOLEAN, i64 for INTEGER or f64 bits
+ * for FLOAT.
+ */
+
+/**
+ * Reads every entry of a group in one call.
+ * Keys are relative to the group, with subgroup entries as "sub/key" when
+ * recursive. The current path is left unchanged.
+ * @param config Pointer to the config object.
+ * @param path Group to read, absolute or relative to the current path (NULL or
+ *             empty for the current group).
+ * @param recursive If true, also includes the entries of all subgroups.
+ * @return Owned snapshot bytes (free with wxd_String_Free), or NULL if the group
+ *         does not exist.
+ */
+WXD_EXPORTED wxd_String_t*
+wxd_Config_ReadGroupSnapshot(const wxd_ConfigBase_t* config, const char* path, bool recursive);
+
+/**
+ * Applies many writes in one call.
+ * Keys may be absolute or relative to the current path. The whole batch is
+ * validated before anything is written.
+ * @param config Pointer to the config object.
+ * @param batch Entries in the snapshot layout.
+ * @param len Length of batch in bytes.
+ * @param flush If true, flushes once after the writes.
+ * @return Number of entries written, or -1 if the batch is malformed.
+ */
+WXD_EXPORTED int
+wxd_Config_WriteBatch(wxd_ConfigBase_t* config, const uint8_t* batch, size_t len, bool flush);
+
 // --- Miscellaneous ---
 
 /**
  * Flushes all changes to storage.
+ * In write-behind mode this only schedules the flush; see wxd_Config_FlushPending.
  * @param config Pointer to the config object.
  * @param current_only If true, only flush current group.
  * @return true on success, false on failure.
@@ -360,6 +409,43 @@ wxd_Config_RenameGroup(wxd_ConfigBase_t* config,
 WXD_EXPORTED bool
 wxd_Config_Flush(wxd_ConfigBase_t* config, bool current_only);
 
+/**
+ * Enables write-behind mode, or changes its debounce delay.
+ * Writes always update the in-memory config immediately. In write-behind mode
+ * each change, and each wxd_Config_Flush, (re)arms a one-shot timer so that a
+ * burst of changes is persisted by a single flush once writes pause for
+ * delay_ms (or after at most five delays of continuous writes). Pending
+ * changes are flushed when the config is destroyed and when the app exits.
+ * Creating the config with WXD_CONFIG_WRITE_BEHIND enables a 1000 ms delay.
+ * @param config Pointer to the config object.
+ * @param delay_ms Debounce delay; 0 or less flushes pending changes and
+ *                 returns to flushing synchronously.
+ */
+WXD_EXPORTED void
+wxd_Config_SetWriteBehind(wxd_ConfigBase_t* config, int delay_ms);
+
+/**
+ * Checks whether a write-behind flush is scheduled.
+ * @param config Pointer to the config object.
+ * @return true if changes are waiting for the debounce timer.
+ */
+WXD_EXPORTED bool
+wxd_Config_IsFlushPending(const wxd_ConfigBase_t* config);
+
+/**
+ * Flushes immediately, cancelling any scheduled write-behind flush.
+ * @param config Pointer to the config object.
+ * @return true on success (or if nothing was pending), false on failure.
+ */
+WXD_EXPORTED bool
+wxd_Config_FlushPending(wxd_ConfigBase_t* config);
+
+/**
+ * Flushes every write-behind config with pending changes. Called on app exit.
+ */
+WXD_EXPORTED void
+wxd_Config_FlushAllPending(void);
+
 /**
  * Gets the application name.
  * @param config Pointer to the config object.
@@ -26,6 +26,21 @@ wxd_Cursor_CreateFromData(const unsigned char* bits, int width, int height, int
 WXD_EXPORTED wxd_Cursor_t*
 wxd_Cursor_CreateFromImage(const wxd_Bitmap_t* image);
 
+/// Like wxd_Cursor_CreateFromData, but returns a handle sharing the native cursor of an interned
+/// instance with identical bits, mask, size and hotspot
+WXD_EXPORTED wxd_Cursor_t*
+wxd_Cursor_CreateFromDataCached(const unsigned char* bits, int width, int height, int hotspot_x,
+                                int hotspot_y, const unsigned char* mask_bits);
+
+/// Like wxd_Cursor_CreateFromImage, but returns a handle sharing the native cursor of an
+/// interned instance with identical pixels and hotspot
+WXD_EXPORTED wxd_Cursor_t*
+wxd_Cursor_CreateFromImageCached(const wxd_Bitmap_t* image);
+
+/// Drops interned fonts and cursors no handle uses any more; returns the number released
+WXD_EXPORTED size_t
+wxd_ObjectCache_Purge(void);
+
 /// Creates a copy of a cursor
 WXD_EXPORTED wxd_Cursor_t*
 wxd_Cursor_Copy(wxd_Cursor_t* cursor);
@@ -47,4 +47,40 @@ wxd_BitmapDataObject_Create(const wxd_Bitmap_t* bitmap);
 WXD_EXPORTED wxd_Bitmap_t*
 wxd_BitmapDataObject_GetBitmap(wxd_BitmapDataObject_t* data_object);
 
+// --- LazyDataObject Functions ---
+
+// Formats a lazy data object can offer
+typedef enum {
+    WXD_LAZY_FORMAT_TEXT = 0,   // Plain text, rendered as UTF-8
+    WXD_LAZY_FORMAT_HTML = 1,   // HTML fragment, rendered as UTF-8
+    WXD_LAZY_FORMAT_CUSTOM = 2  // Private binary format named by custom_id
+} wxd_LazyDataFormat;
+
+// Renders the format added at format_index. Returns the bytes and sets out_size;
+// the data only has to stay valid until the next call. NULL renders empty data.
+typedef const void* (*wxd_LazyData_Render_Callback)(void* user_data, int format_index,
+                                                    size_t* out_size);
+typedef void (*wxd_LazyData_FreeUserData_Callback)(void* user_data);
+
+/**
+ * Creates a data object whose payload is rendered on demand: render is called
+ * on the GUI thread only when a consumer first reads a format (a paste, a drop),
+ * at most once per format. user_data is freed when the data object is destroyed,
+ * which happens through the clipboard once it has taken the object.
+ * Usable with wxd_Clipboard_AddData/SetData and wxd_DropSource_SetData.
+ */
+WXD_EXPORTED wxd_DataObject_t*
+wxd_LazyDataObject_Create(void* user_data, wxd_LazyData_Render_Callback render,
+                          wxd_LazyData_FreeUserData_Callback free_user_data);
+
+/**
+ * Offers another format, before the object is handed to the clipboard or a drop
+ * source. custom_id names WXD_LAZY_FORMAT_CUSTOM formats and is ignored otherwise.
+ * Returns the format index passed to the render callback, which counts every
+ * earlier call, or -1 on failure.
+ */
+WXD_EXPORTED int
+wxd_LazyDataObject_AddFormat(wxd_DataObject_t* data_object, wxd_LazyDataFormat format,
+                             const char* custom_id, bool preferred);
+
 #endif // WXD_DATAOBJECT_H
\ No newline at end of file
@@ -0,0 +1,45 @@
+#ifndef WXD_DIR_LISTING_H
+#define WXD_DIR_LISTING_H
+
+#include "../wxd_types.h"
+
+// --- Asynchronous directory listing ---
+// A directory enumerated on a worker thread and delivered to the main thread in batches, so
+// huge folders and slow network shares never block the event loop. Entries carry only what the
+// enumeration returns for free (name and type); size, dates and icons are left for the caller
+// to look up for the rows it actually shows.
+
+typedef struct wxd_DirListing_t wxd_DirListing_t;
+
+typedef enum {
+    WXD_DIR_ENTRY_DIR = 1 << 0,
+    WXD_DIR_ENTRY_HIDDEN = 1 << 1,
+    WXD_DIR_ENTRY_LINK = 1 << 2,
+} wxd_DirEntryFlags;
+
+typedef enum {
+    WXD_DIR_LISTING_MORE = 0,   // A batch; more follow.
+    WXD_DIR_LISTING_DONE = 1,   // The last batch, possibly empty.
+    WXD_DIR_LISTING_FAILED = 2, // The directory could not be opened; no entries.
+} wxd_DirListingStatus;
+
+// Called on the main thread. `names` are UTF-8 where the file system allows, without "." and
+// "..", in the order the file system returns them; `flags` holds wxd_DirEntryFlags per name.
+typedef void (*wxd_DirEntriesCallback)(void* userdata, const char* const* names,
+                                       const uint8_t* flags, int count, int status);
+
+// Starts listing `dir`; batches hold up to `batch_size` entries (0 for a default) and are also
+// sent every few tens of milliseconds while a slow listing is still filling one.
+WXD_EXPORTED wxd_DirListing_t*
+wxd_DirListing_Start(const char* dir, int batch_size, wxd_DirEntriesCallback callback,
+                     void* userdata, void (*free_userdata)(void*));
+
+// Cancels the listing if it is still running and frees the userdata; no callback runs after
+// this returns. Must be called from the main thread, also for finished listings.
+WXD_EXPORTED void
+wxd_DirListing_Destroy(wxd_DirListing_t* listing);
+
+WXD_EXPORTED bool
+wxd_DirListing_IsDone(const wxd_DirListing_t* listing);
+
+#endif // WXD_DIR_LISTING_H
@@ -0,0 +1,42 @@
+#ifndef WXD_FSWATCHER_H
+#define WXD_FSWATCHER_H
+
+#include "../wxd_types.h"
+
+// --- Coalescing file system watcher ---
+// Wraps wxFileSystemWatcher. Native notifications are merged per path over a batch window that
+// starts with the first change; when it ends, the target handler receives one
+// WXD_EVENT_TYPE_FS_CHANGES event listing every changed path once with all its change kinds, so
+// bursts (saves, checkouts, builds) arrive as a single event on the GUI thread. Create and use
+// on the main thread once the event loop is running.
+
+// Returns NULL if file system watching is not available in this build.
+WXD_EXPORTED wxd_FileSystemWatcher_t*
+wxd_FileSystemWatcher_Create(wxd_EvtHandler_t* target, int batch_ms);
+
+// Stops watching; a pending batch is dropped.
+WXD_EXPORTED void
+wxd_FileSystemWatcher_Destroy(wxd_FileSystemWatcher_t* self);
+
+// Length of the batch window in milliseconds (0 delivers each change on the next event loop
+// iteration, still merged with changes that arrived in the same iteration).
+WXD_EXPORTED void
+wxd_FileSystemWatcher_SetBatchInterval(wxd_FileSystemWatcher_t* self, int batch_ms);
+
+// Watches `path`, a file or directory; with `recursive`, the whole tree below a directory.
+// `filespec` (e.g. "*.txt", NULL or "" for all) filters the files of a recursive watch.
+WXD_EXPORTED bool
+wxd_FileSystemWatcher_Add(wxd_FileSystemWatcher_t* self, const char* path, bool recursive,
+                          const char* filespec);
+
+WXD_EXPORTED bool
+wxd_FileSystemWatcher_Remove(wxd_FileSystemWatcher_t* self, const char* path, bool recursive);
+
+WXD_EXPORTED void
+wxd_FileSystemWatcher_RemoveAll(wxd_FileSystemWatcher_t* self);
+
+// Delivers the pending batch now, if any.
+WXD_EXPORTED void
+wxd_FileSystemWatcher_Flush(wxd_FileSystemWatcher_t* self);
+
+#endif // WXD_FSWATCHER_H
@@ -0,0 +1,54 @@
+#ifndef WXD_HOTKEYS_H
+#define WXD_HOTKEYS_H
+
+#include "../wxd_types.h"
+
+// --- Native hotkey table ---
+//
+// A hash table of (key code, WXD_MOD_* modifiers) -> command id. Attached to a window it is
+// consulted from wxEVT_CHAR_HOOK: a registered combination sends one wxEVT_MENU command event
+// with the id to the window and consumes the key, anything else continues as a normal key
+// event, so ordinary typing never reaches Rust through the shortcut path. Letter keys are
+// matched case-insensitively. GUI thread only; one table can serve several windows and may be
+// changed while attached.
+
+WXD_EXPORTED wxd_HotkeyTable_t*
+wxd_HotkeyTable_Create(void);
+
+// Releases the caller's reference; windows the table is attached to keep using it.
+WXD_EXPORTED void
+wxd_HotkeyTable_Destroy(wxd_HotkeyTable_t* table);
+
+// Maps the combination to `command_id`, replacing any previous mapping.
+WXD_EXPORTED void
+wxd_HotkeyTable_Set(wxd_HotkeyTable_t* table, int modifiers, int key_code, int command_id);
+
+// Adds `count` (modifiers, key code, command id) triples from `entries`.
+WXD_EXPORTED void
+wxd_HotkeyTable_SetMany(wxd_HotkeyTable_t* table, const int32_t* entries, size_t count);
+
+WXD_EXPORTED bool
+wxd_HotkeyTable_Remove(wxd_HotkeyTable_t* table, int modifiers, int key_code);
+
+WXD_EXPORTED void
+wxd_HotkeyTable_Clear(wxd_HotkeyTable_t* table);
+
+WXD_EXPORTED size_t
+wxd_HotkeyTable_GetCount(const wxd_HotkeyTable_t* table);
+
+// The command id for the combination, or wxID_NONE (-3) if there is none.
+WXD_EXPORTED int
+wxd_HotkeyTable_Lookup(const wxd_HotkeyTable_t* table, int modifiers, int key_code);
+
+// Dispatches the window's key presses through `table`, replacing a table attached before;
+// NULL detaches.
+WXD_EXPORTED void
+wxd_Window_SetHotkeyTable(wxd_Window_t* window, wxd_HotkeyTable_t* table);
+
+// Installs the current entries as the window's wxAcceleratorTable instead, so the platform's
+// own accelerator handling sends the command events. Combinations using WXD_MOD_META have no
+// accelerator equivalent and are left out. Returns the number of accelerators installed.
+WXD_EXPORTED size_t
+wxd_HotkeyTable_InstallAccelerators(const wxd_HotkeyTable_t* table, wxd_Window_t* window);
+
+#endif // WXD_HOTKEYS_H
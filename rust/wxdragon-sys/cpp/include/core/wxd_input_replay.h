@@ -0,0 +1,69 @@
+#ifndef WXD_INPUT_REPLAY_H
+#define WXD_INPUT_REPLAY_H
+
+#include "../wxd_types.h"
+
+// --- Input Recording and Replay ---
+// The recorder is an event filter that logs mouse and keyboard events with their time and the
+// path of the target window, so a reported slowdown can be reproduced with the same input. A
+// recording is a compact little-endian blob: the magic "WXDINP01", then records, each a tag byte
+// followed by LEB128 varints. Tag 1 defines the next window path (length, UTF-8 bytes); tag 2 is
+// an event (kind, microseconds since the previous event, path index, x, y as zigzag, modifier
+// and button state, two kind-specific values as zigzag: key code and Unicode character, or
+// wheel rotation and delta). A path lists the names of the window and its ancestors up to the
+// top-level window, each with its index among same-named siblings ("frame#0/panel#0/ok#1").
+// Main thread only.
+
+typedef enum {
+    WXD_INPUT_REPLAY_DIRECT = 0,   // Events are built and sent to the target's handler
+    WXD_INPUT_REPLAY_SIMULATED = 1 // Native input through wxUIActionSimulator (wheel stays direct)
+} wxd_InputReplayMode;
+
+typedef struct {
+    uint32_t events;     // events replayed
+    uint32_t skipped;    // events whose window no longer resolves, or malformed records
+    int64_t elapsed_us;  // from the start of the replay to the last event
+    int64_t max_lag_us;  // worst delay between an event's due time and its injection
+    int64_t total_lag_us;
+    bool cancelled;
+} wxd_InputReplayStats;
+
+typedef void (*wxd_InputReplayDoneCallback)(void* user_data, const wxd_InputReplayStats* stats);
+
+// Starts recording into an in-memory buffer, discarding any previous recording.
+WXD_EXPORTED void
+wxd_InputRecorder_Start(void);
+
+WXD_EXPORTED void
+wxd_InputRecorder_Stop(void);
+
+WXD_EXPORTED bool
+wxd_InputRecorder_IsRecording(void);
+
+// Copies the recording into `buffer` if it fits and returns its full size. Call with
+// buffer = NULL to size it.
+WXD_EXPORTED size_t
+wxd_InputRecorder_GetData(uint8_t* buffer, size_t buffer_len);
+
+// Replays a recording (copied, so `data` may be freed afterwards). `speed` scales the original
+// timing (2.0 is twice as fast); 0 or less injects each event as soon as the previous one has
+// been handled and the loop has run once. With `collect_timings`, the event-loop trace and the
+// window paint/size timings are reset and recorded for the duration of the replay. `done` runs
+// on the main thread after the last event was injected or the replay was cancelled, and
+// `free_user_data`, if set, gets `user_data` afterwards. Replaces a running replay, which
+// completes as cancelled. The recorder ignores input while a replay runs. Returns false, leaving
+// `user_data` with the caller, if the blob has no valid header or the simulated mode is
+// unavailable.
+WXD_EXPORTED bool
+wxd_InputReplay_Start(const uint8_t* data, size_t len, wxd_InputReplayMode mode, double speed,
+                      bool collect_timings, wxd_InputReplayDoneCallback done, void* user_data,
+                      void (*free_user_data)(void*));
+
+// Stops a running replay; its `done` callback still runs with what was replayed so far.
+WXD_EXPORTED void
+wxd_InputReplay_Cancel(void);
+
+WXD_EXPORTED bool
+wxd_InputReplay_IsRunning(void);
+
+#endif // WXD_INPUT_REPLAY_H
@@ -22,6 +22,17 @@ typedef enum {
     WXD_IPC_PRIVATE = 20        // Private/binary data
 } wxd_IPCFormat;
 
+// --- Transport ---
+
+// How a service name maps to an endpoint
+typedef enum {
+    // Windows: DDE. Unix: a TCP port, or a Unix domain socket if the name contains '/'.
+    WXD_IPC_TRANSPORT_DEFAULT = 0,
+    // Same-machine only. Unix: a Unix domain socket; a name without '/' becomes a
+    // socket in the user's runtime directory. Windows: DDE, which is already local.
+    WXD_IPC_TRANSPORT_LOCAL = 1
+} wxd_IPCTransport;
+
 // --- Connection Callbacks (Server-side: called when client sends data) ---
 
 // Called when client executes a command via Execute()
@@ -85,6 +96,23 @@ typedef bool (*wxd_IPC_OnAdvise_Callback)(
     wxd_IPCFormat format
 );
 
+// One update of a batched Advise frame; pointers are valid only during the callback
+typedef struct {
+    const char* item;
+    const void* data;
+    size_t size;
+    wxd_IPCFormat format;
+} wxd_IPCAdviseSlice;
+
+// Called once per batched Advise frame with all of its updates, in send order
+// Return true if handled successfully
+typedef bool (*wxd_IPC_OnAdviseBatch_Callback)(
+    void* user_data,
+    const char* topic,
+    const wxd_IPCAdviseSlice* slices,
+    size_t count
+);
+
 // --- Connection Callbacks (Both sides) ---
 
 // Called when connection is terminated
@@ -104,6 +132,35 @@ typedef wxd_IPCConnection_t* (*wxd_IPC_OnAcceptConnection_Callback)(
     const char* topic
 );
 
+// --- Asynchronous Operations ---
+
+// How an asynchronous connect or request ended
+typedef enum {
+    WXD_IPC_ASYNC_OK = 0,
+    WXD_IPC_ASYNC_FAILED = 1,      // Unreachable server, rejected topic, lost connection, ...
+    WXD_IPC_ASYNC_TIMEOUT = 2,
+    WXD_IPC_ASYNC_CANCELLED = 3
+} wxd_IPCAsyncStatus;
+
+// Called on the GUI thread when an asynchronous connect ends.
+// conn is non-NULL only with WXD_IPC_ASYNC_OK and is owned as with MakeConnection.
+typedef void (*wxd_IPC_OnConnectComplete_Callback)(
+    void* user_data,
+    uint64_t op_id,
+    wxd_IPCAsyncStatus status,
+    wxd_IPCConnection_t* conn
+);
+
+// Called on the GUI thread when an asynchronous request ends.
+// data is valid only during the call and is NULL unless status is WXD_IPC_ASYNC_OK.
+typedef void (*wxd_IPC_OnRequestComplete_Callback)(
+    void* user_data,
+    uint64_t op_id,
+    wxd_IPCAsyncStatus status,
+    const void* data,
+    size_t size
+);
+
 // --- Connection Functions ---
 
 // Create a new connection with callbacks (typically called from OnAcceptConnection or OnMakeConnection)
@@ -197,6 +254,66 @@ wxd_IPCConnection_GetTopic(wxd_IPCConnection_t* conn, char* buffer, size_t buffe
 WXD_EXPORTED bool
 wxd_IPCConnection_IsConnected(wxd_IPCConnection_t* conn);
 
+// Request data without waiting for the reply, which the peer's OnRequest
+// callback produces on its next idle pass. on_complete runs exactly once on the
+// GUI thread; a timeout_ms of 0 waits indefinitely. Both ends must be wxDragon
+// connections. Returns the operation id, or 0 if the request could not be sent
+// (on_complete is then not called; user_data is freed).
+WXD_EXPORTED uint64_t
+wxd_IPCConnection_RequestAsync(
+    wxd_IPCConnection_t* conn,
+    const char* item,
+    wxd_IPCFormat format,
+    unsigned int timeout_ms,
+    wxd_IPC_OnRequestComplete_Callback on_complete,
+    void* user_data,
+    wxd_IPC_FreeUserData_Callback free_user_data
+);
+
+// --- Advise batching ---
+
+// Set the callback that receives batched Advise frames (client-side). Without
+// one, each update of a frame is passed to OnAdvise in turn.
+WXD_EXPORTED void
+wxd_IPCConnection_SetOnAdviseBatch(
+    wxd_IPCConnection_t* conn,
+    wxd_IPC_OnAdviseBatch_Callback on_advise_batch
+);
+
+// Server: queue Advise updates and send them as one frame every interval_ms,
+// or sooner once a frame reaches max_bytes (0 for the 64 KiB default). Only
+// applies once the client has asked for batches. An interval of 0 disables
+// batching and sends anything queued.
+// Client: ask the server for batched frames (an interval of 0 stops asking).
+WXD_EXPORTED bool
+wxd_IPCConnection_SetAdviseBatching(
+    wxd_IPCConnection_t* conn,
+    unsigned int interval_ms,
+    size_t max_bytes
+);
+
+// Send any queued Advise updates now (server-side)
+WXD_EXPORTED bool
+wxd_IPCConnection_FlushAdvise(wxd_IPCConnection_t* conn);
+
+// --- Shared-memory side channel ---
+
+// Accept large payloads through shared memory and, once the peer accepts them
+// too, send Execute/Poke (client) or Advise (server) payloads of at least
+// threshold bytes as a named shared-memory segment, with only a small
+// descriptor passing through the connection. Receivers get the mapped segment
+// as the callback's data pointer, valid only during the callback. Request
+// replies always use the connection. A threshold of 0 disables the channel.
+// A server enables it on the connection it returns from OnAcceptConnection;
+// a client enables it after connecting, which negotiates with the server.
+// Returns true if the peer has accepted shared memory.
+WXD_EXPORTED bool
+wxd_IPCConnection_EnableSharedMemory(wxd_IPCConnection_t* conn, size_t threshold);
+
+// Check whether large payloads on this connection go through shared memory
+WXD_EXPORTED bool
+wxd_IPCConnection_UsesSharedMemory(wxd_IPCConnection_t* conn);
+
 // --- Server Functions ---
 
 // Create a new IPC server
@@ -211,6 +328,16 @@ wxd_IPCServer_Create(
 WXD_EXPORTED bool
 wxd_IPCServer_Create_Service(wxd_IPCServer_t* server, const char* service);
 
+// Start the server listening on the given service over a chosen transport. With
+// WXD_IPC_TRANSPORT_LOCAL, fails if another server already listens on the socket
+// (a stale socket file is replaced).
+WXD_EXPORTED bool
+wxd_IPCServer_Create_ServiceEx(
+    wxd_IPCServer_t* server,
+    const char* service,
+    wxd_IPCTransport transport
+);
+
 // Destroy the server
 WXD_EXPORTED void
 wxd_IPCServer_Destroy(wxd_IPCServer_t* server);
@@ -221,6 +348,21 @@ wxd_IPCServer_Destroy(wxd_IPCServer_t* server);
 WXD_EXPORTED wxd_IPCClient_t*
 wxd_IPCClient_Create(void);
 
+// Set how later connects map their service name (WXD_IPC_TRANSPORT_DEFAULT initially).
+// Must match the transport the server was created with.
+WXD_EXPORTED void
+wxd_IPCClient_SetTransport(wxd_IPCClient_t* client, wxd_IPCTransport transport);
+
+// Write the endpoint a service name maps to under a transport (NUL-terminated,
+// truncated to buffer_size). Returns the full length, excluding the NUL.
+WXD_EXPORTED size_t
+wxd_IPC_ResolveService(
+    const char* service,
+    wxd_IPCTransport transport,
+    char* buffer,
+    size_t buffer_size
+);
+
 // Connect to a server and return the connection
 // Returns NULL if connection failed
 WXD_EXPORTED wxd_IPCConnection_t*
@@ -240,6 +382,40 @@ wxd_IPCClient_MakeConnection(
     wxd_IPC_FreeUserData_Callback free_user_data
 );
 
+// Connect to a server without blocking the GUI thread. On socket transports
+// a worker thread first waits for the endpoint to accept connections; the
+// connection itself is then made on the GUI thread. on_complete runs exactly
+// once on the GUI thread; a timeout_ms of 0 waits indefinitely. The connection
+// callbacks are used as with MakeConnection and user_data is freed if no
+// connection takes it. Returns the operation id, or 0 if nothing was started
+// (on_complete is then not called; both user data blocks are freed).
+WXD_EXPORTED uint64_t
+wxd_IPCClient_MakeConnectionAsync(
+    wxd_IPCClient_t* client,
+    const char* host,
+    const char* service,
+    const char* topic,
+    unsigned int timeout_ms,
+    void* user_data,
+    wxd_IPC_OnExecute_Callback on_execute,
+    wxd_IPC_OnRequest_Callback on_request,
+    wxd_IPC_OnPoke_Callback on_poke,
+    wxd_IPC_OnStartAdvise_Callback on_start_advise,
+    wxd_IPC_OnStopAdvise_Callback on_stop_advise,
+    wxd_IPC_OnAdvise_Callback on_advise,
+    wxd_IPC_OnDisconnect_Callback on_disconnect,
+    wxd_IPC_FreeUserData_Callback free_user_data,
+    wxd_IPC_OnConnectComplete_Callback on_complete,
+    void* complete_data,
+    wxd_IPC_FreeUserData_Callback free_complete_data
+);
+
+// Cancel a pending asynchronous connect or request. Its completion callback
+// runs immediately with WXD_IPC_ASYNC_CANCELLED. Returns false if the operation
+// has already completed. Call on the GUI thread.
+WXD_EXPORTED bool
+wxd_IPC_CancelAsync(uint64_t op_id);
+
 // Destroy the client
 WXD_EXPORTED void
 wxd_IPCClient_Destroy(wxd_IPCClient_t* client);
@@ -40,6 +40,49 @@ WXD_EXPORTED void wxd_Printout_GetPageSizeMM(wxd_Printout_t* self, int* w, int*
 WXD_EXPORTED void wxd_Printout_GetPPIScreen(wxd_Printout_t* self, int* x, int* y);
 WXD_EXPORTED void wxd_Printout_GetPPIPrinter(wxd_Printout_t* self, int* x, int* y);
 WXD_EXPORTED bool wxd_Printout_IsPreview(wxd_Printout_t* self);
+// Makes the printout own `userData`: `freeUserData` runs when wxWidgets deletes the printout
+// (as a print preview does). Not needed for printouts destroyed with wxd_Printout_Destroy.
+WXD_EXPORTED void wxd_Printout_SetFreeUserData(wxd_Printout_t* self, wxd_Printout_FreeUserData_Callback freeUserData);
+
+// Preview page cache: in a preview, pages are kept as bitmaps at the current zoom, up to
+// `maxPages` (least recently shown evicted first), so paging back and forth does not call
+// OnPrintPage again. 0 disables. Only applies where the preview renders through a memory DC.
+WXD_EXPORTED void wxd_Printout_SetPreviewCacheSize(wxd_Printout_t* self, size_t maxPages);
+// Drops cached preview pages, e.g. after the document changed.
+WXD_EXPORTED void wxd_Printout_InvalidatePreviewCache(wxd_Printout_t* self);
+
+// Headless export: runs the printout's whole print sequence without a printer, preview or
+// dialog. Return the number of pages exported, or -1 if the export could not start.
+//
+// Writes a PostScript file at `path`, with paper and orientation from `data` (nullable).
+// Returns -1 where wxWidgets was built without PostScript support (wxMSW by default).
+WXD_EXPORTED int wxd_Printout_ExportPostScript(wxd_Printout_t* self, wxd_PrintData_t* data, const char* path);
+// Renders each page on white at `dpi` (0 selects 150) onto a page of the given size in mm
+// (0 selects A4) and hands it to `onPage` as RGBA. The buffer is reused for the next page.
+WXD_EXPORTED int wxd_Printout_ExportBitmaps(wxd_Printout_t* self, int dpi, int pageWidthMM, int pageHeightMM,
+                                            wxd_Printout_ExportPage_Callback onPage, void* userData);
+
+// --- PrintPagination ---
+// Page count published by a paginator that may run on any thread. Once attached to a
+// printout, HasPage and GetPageInfo are answered natively from it: pages up to the published
+// count exist, and once the count is final GetPageInfo reports it without calling back.
+// Reference counted; Create and Clone each return a reference released with Release.
+WXD_EXPORTED wxd_PrintPagination_t* wxd_PrintPagination_Create();
+WXD_EXPORTED wxd_PrintPagination_t* wxd_PrintPagination_Clone(wxd_PrintPagination_t* self);
+WXD_EXPORTED void wxd_PrintPagination_Release(wxd_PrintPagination_t* self);
+// Publishes `pageCount` laid-out pages; `isFinal` marks the document complete.
+WXD_EXPORTED void wxd_PrintPagination_SetPageCount(wxd_PrintPagination_t* self, int pageCount, bool isFinal);
+// Published page count, or -1 if none yet.
+WXD_EXPORTED int wxd_PrintPagination_GetPageCount(const wxd_PrintPagination_t* self);
+WXD_EXPORTED bool wxd_PrintPagination_IsFinal(const wxd_PrintPagination_t* self);
+// Attaches `pagination` (taking a reference) or detaches with NULL.
+WXD_EXPORTED void wxd_Printout_SetPagination(wxd_Printout_t* self, wxd_PrintPagination_t* pagination);
+
+// --- PrintPreview ---
+// Opens a preview frame for `preview`, with `print` (nullable) used by its Print button. Both
+// printouts are owned by the preview from here on, even on failure; give them a free callback.
+WXD_EXPORTED bool wxd_PrintPreview_Show(wxd_Printout_t* preview, wxd_Printout_t* print, wxd_PrintDialogData_t* data,
+                                        wxd_Window_t* parent, const char* title, int width, int height);
 
 // --- Printer ---
 WXD_EXPORTED wxd_Printer_t* wxd_Printer_Create(wxd_PrintDialogData_t* data);
@@ -0,0 +1,53 @@
+#ifndef WXD_PROCESS_H
+#define WXD_PROCESS_H
+
+#include "../wxd_types.h"
+
+// --- Asynchronous child process ---
+// Wraps wxExecute(wxEXEC_ASYNC) with a redirected wxProcess. The pipes are polled by a timer on
+// the GUI thread, and output reaches the target handler as WXD_EVENT_TYPE_PROCESS_OUTPUT events
+// holding whole lines: each poll reads at most a byte budget per stream and sends what it read
+// up to the last newline as one event, so a chatty child costs one event per stream and poll
+// rather than one per line. When the child exits the rest of its output is drained and a
+// WXD_EVENT_TYPE_PROCESS_EXIT event carries the exit code. Events are queued, never processed
+// re-entrantly, and carry the pid to tell several children apart. Main thread only.
+
+// Launches argv[0] with arguments argv[1..argc) (UTF-8), in `cwd` if not NULL or empty.
+// `flags` is a combination of wxd_ProcessFlags; `poll_ms` <= 0 selects 50 ms. Returns NULL if
+// the process could not be started.
+WXD_EXPORTED wxd_ChildProcess_t*
+wxd_ChildProcess_Spawn(wxd_EvtHandler_t* target, const char* const* argv, size_t argc,
+                       const char* cwd, int flags, int poll_ms);
+
+// Releases the handle. A running child is not killed: its events keep arriving until it exits,
+// after which the native object frees itself.
+WXD_EXPORTED void
+wxd_ChildProcess_Destroy(wxd_ChildProcess_t* self);
+
+WXD_EXPORTED int64_t
+wxd_ChildProcess_GetPid(const wxd_ChildProcess_t* self);
+
+// False once the exit event has been queued.
+WXD_EXPORTED bool
+wxd_ChildProcess_IsRunning(const wxd_ChildProcess_t* self);
+
+// Poll interval (<= 0 keeps the current one) and bytes read per stream and poll (0 for the
+// default of 1 MiB). A line longer than 64 KiB is delivered in pieces.
+WXD_EXPORTED void
+wxd_ChildProcess_SetRateLimit(wxd_ChildProcess_t* self, int poll_ms, size_t max_bytes_per_poll);
+
+// Writes to the child's stdin; blocks if the pipe is full. Returns false if stdin is closed or
+// not everything was written.
+WXD_EXPORTED bool
+wxd_ChildProcess_Write(wxd_ChildProcess_t* self, const uint8_t* data, size_t len);
+
+// Closes the child's stdin so it sees end of file.
+WXD_EXPORTED void
+wxd_ChildProcess_CloseInput(wxd_ChildProcess_t* self);
+
+// Sends SIGTERM (SIGKILL if `force`) to the child, and to its process group if it was started
+// with WXD_PROCESS_GROUP_LEADER and `children` is set.
+WXD_EXPORTED bool
+wxd_ChildProcess_Kill(wxd_ChildProcess_t* self, bool force, bool children);
+
+#endif // WXD_PROCESS_H
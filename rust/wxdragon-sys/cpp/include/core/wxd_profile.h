@@ -0,0 +1,95 @@
+#ifndef WXD_PROFILE_H
+#define WXD_PROFILE_H
+
+#include "../wxd_types.h"
+
+// --- FFI Call Profiler ---
+// Only records data when libwxdragon was configured with wxdENABLE_FFI_PROFILE (GCC/Clang);
+// otherwise IsEnabled returns false and Snapshot returns 0.
+
+// Whether this build of the library was instrumented.
+WXD_EXPORTED bool
+wxd_Profile_IsEnabled(void);
+
+// Copies up to `max_entries` per-function totals (merged across threads) into `entries` and
+// returns the number available. Call with entries = NULL to size the array. Entry names are
+// resolved where the platform allows it (NULL otherwise); named non-wxd_ functions are omitted.
+WXD_EXPORTED size_t
+wxd_Profile_Snapshot(wxd_ProfileEntry* entries, size_t max_entries);
+
+// Zeroes all counters.
+WXD_EXPORTED void
+wxd_Profile_Reset(void);
+
+// --- Live Object Accounting ---
+// Only records data when libwxdragon was configured with wxdENABLE_OBJECT_STATS; otherwise
+// IsObjectAccountingEnabled returns false and GetObjectStats returns 0.
+
+WXD_EXPORTED bool
+wxd_Debug_IsObjectAccountingEnabled(void);
+
+// Copies up to `max_entries` rows, one per wxd_ObjectKind in enum order, and returns
+// WXD_OBJECT_KIND_COUNT. Call with stats = NULL to size the array. Callable from any thread.
+WXD_EXPORTED size_t
+wxd_Debug_GetObjectStats(wxd_ObjectStats* stats, size_t max_entries);
+
+// Lowers every high-water mark to the current live value, e.g. at the start of a session.
+WXD_EXPORTED void
+wxd_Debug_ResetObjectHighWater(void);
+
+// --- Window Paint / Layout Timing ---
+// Opt-in at runtime; while disabled the hooks cost one relaxed atomic load per paint, size or
+// layout. Main-thread measurements; the table may be read from any thread.
+
+WXD_EXPORTED void
+wxd_Debug_EnableWindowTimings(bool enable);
+
+// Logs a warning for every single measurement longer than budget_us; 0 turns the log off.
+// Measurements over budget are also counted per row either way.
+WXD_EXPORTED void
+wxd_Debug_SetWindowTimingBudget(uint32_t budget_us);
+
+// Copies up to `max_entries` rows (sorted by total time, descending) and returns the number
+// available. Call with entries = NULL to size the array. With reset = true the table is cleared
+// after copying, so polling at a fixed interval yields a rolling window.
+WXD_EXPORTED size_t
+wxd_Debug_GetWindowTimings(wxd_WindowTiming* entries, size_t max_entries, bool reset);
+
+// --- Startup Phases ---
+// Always recorded; each milestone is stored once, the first time it is reached.
+
+// Microseconds from wxd_Main entry to `phase` (a wxd_StartupPhase), or -1 if not reached yet.
+WXD_EXPORTED int64_t
+wxd_Debug_GetStartupPhaseMicros(int phase);
+
+// --- Event Loop Trace ---
+// Records a timeline of event dispatch, idle callback drains, paints and timer fires into a
+// fixed-size ring (oldest spans are overwritten) for viewing in chrome://tracing or Perfetto.
+
+// Clears the ring and starts recording. `capacity` is the number of spans kept, rounded up to a
+// power of two; 0 selects 65536.
+WXD_EXPORTED void
+wxd_Trace_Start(uint32_t capacity);
+
+// Stops recording; the ring is kept for export.
+WXD_EXPORTED void
+wxd_Trace_Stop(void);
+
+WXD_EXPORTED bool
+wxd_Trace_IsRecording(void);
+
+// Current time on the trace clock, in nanoseconds since wxd_Trace_Start.
+WXD_EXPORTED uint64_t
+wxd_Trace_Now(void);
+
+// Adds a span from the calling thread, with times from wxd_Trace_Now. Used to merge Rust-side
+// spans into the same timeline. Ignored while not recording.
+WXD_EXPORTED void
+wxd_Trace_RecordSpan(const char* name, uint64_t start_ns, uint64_t end_ns);
+
+// Writes the ring as Chrome trace_event JSON (UTF-8, NUL-terminated, truncated to fit) and
+// returns the full length excluding the terminator. Call with buffer = NULL to size it.
+WXD_EXPORTED size_t
+wxd_Trace_GetChromeJson(char* buffer, size_t buffer_len);
+
+#endif // WXD_PROFILE_H
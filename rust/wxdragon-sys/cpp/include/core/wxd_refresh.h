@@ -0,0 +1,79 @@
+#ifndef WXD_REFRESH_H
+#define WXD_REFRESH_H
+
+#include "../wxd_types.h"
+
+// --- Frame-paced refresh ---
+// Each top-level window has a scheduler that merges refresh requests from it and its children
+// and invalidates them at most once per display frame, however often data callbacks ask.
+// Frames are timer-driven at the display's refresh rate (60 Hz when unknown).
+
+typedef void (*wxd_FrameBeginCallback)(void* user_data);
+typedef void (*wxd_FrameBeginFreeUserData)(void* user_data);
+
+// Queues `rect` (client coordinates; null for the whole window) of `window` for the next frame.
+WXD_EXPORTED void
+wxd_Window_ScheduleRefresh(wxd_Window_t* window, const wxd_Rect* rect);
+
+// Calls `callback` at the start of every frame that has refreshes queued, before anything is
+// invalidated, so pending model changes can be applied right before painting. Refreshes queued
+// from the callback join the same frame. Applies to `window`'s top-level window and replaces
+// any previous hook; `free_user_data` runs when it is replaced or the window destroyed. A null
+// `callback` removes the hook.
+WXD_EXPORTED void
+wxd_Window_SetFrameBeginCallback(wxd_Window_t* window, wxd_FrameBeginCallback callback,
+                                 void* user_data, wxd_FrameBeginFreeUserData free_user_data);
+
+// Overrides the frame interval of `window`'s top-level window; 0 restores the display rate.
+WXD_EXPORTED void
+wxd_Window_SetFrameInterval(wxd_Window_t* window, int milliseconds);
+
+// Applies all refreshes queued for `window`'s top-level window now.
+WXD_EXPORTED void
+wxd_Window_FlushScheduledRefresh(wxd_Window_t* window);
+
+// Applies all pending deferred status texts, gauge values and app progress values now
+// (wxd_StatusBar_SetStatusTextDeferred, wxd_Gauge_SetValueDeferred,
+// wxd_AppProgressIndicator_SetValueDeferred), e.g. when a job finishes.
+WXD_EXPORTED void
+wxd_Progress_FlushDeferred(void);
+
+// --- Animation frame clock ---
+// Delivers one callback per display frame, paced by the display where the platform exposes it
+// (CVDisplayLink on macOS, the GdkFrameClock of the window on GTK) and by a drift-free timer
+// otherwise, with the system timer resolution raised to 1 ms on MSW while running. After each
+// callback the refreshes scheduled for the window's top-level window are flushed, so anything an
+// animation schedules is painted in the same frame.
+
+typedef struct {
+    int64_t timestamp_us; // frame time, monotonic, arbitrary origin
+    int64_t interval_us;  // current refresh interval
+    uint64_t frame;       // frames delivered so far, starting at 0
+    uint32_t dropped;     // frames missed since the previous callback
+} wxd_FrameInfo;
+
+typedef void (*wxd_FrameClockCallback)(void* user_data, const wxd_FrameInfo* info);
+typedef void (*wxd_FrameClockFreeUserData)(void* user_data);
+
+// The clock stops by itself when `window` is destroyed; it must still be destroyed.
+WXD_EXPORTED wxd_FrameClock_t*
+wxd_FrameClock_Create(wxd_Window_t* window, wxd_FrameClockCallback callback, void* user_data,
+                      wxd_FrameClockFreeUserData free_user_data);
+
+WXD_EXPORTED void
+wxd_FrameClock_Destroy(wxd_FrameClock_t* clock);
+
+WXD_EXPORTED bool
+wxd_FrameClock_Start(wxd_FrameClock_t* clock);
+
+WXD_EXPORTED void
+wxd_FrameClock_Stop(wxd_FrameClock_t* clock);
+
+WXD_EXPORTED bool
+wxd_FrameClock_IsRunning(const wxd_FrameClock_t* clock);
+
+// Refresh interval of the display showing the window, in microseconds.
+WXD_EXPORTED int64_t
+wxd_FrameClock_GetRefreshInterval(const wxd_FrameClock_t* clock);
+
+#endif // WXD_REFRESH_H
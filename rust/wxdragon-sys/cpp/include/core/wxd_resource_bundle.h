@@ -0,0 +1,51 @@
+#ifndef WXD_RESOURCE_BUNDLE_H
+#define WXD_RESOURCE_BUNDLE_H
+
+#include "../wxd_types.h"
+
+// --- Memory-mapped resource bundles ---
+// A resource bundle is one archive file holding many named assets (icons, XRC, .mo catalogs,
+// web content). It is memory-mapped with a single call and parsed in place, so loading an asset
+// is a binary search and a pointer into the mapping instead of an open/read per file.
+//
+// Format (little-endian): the magic "WXDPACK1", uint32 entry count, uint32 size of the name
+// table, then per entry {uint64 data offset, uint64 data size, uint32 name offset, uint32 name
+// size} sorted by name bytes, the name table (UTF-8, '/'-separated, no terminators) and the data.
+// Offsets are from the start of the file. The Rust ResourceBundleWriter produces it.
+//
+// While open, a bundle is mounted as "wxdres:<mount>/<name>" on wxFileSystem, so XRC (including
+// wildcards such as "wxdres:ui/*.xrc"), wxHTML and other wxFileSystem users read from it as
+// memory streams over the mapping.
+
+// Maps and validates the archive at `path` and mounts it under `mount` (letters, digits, '_',
+// '-' and '.'), replacing a bundle mounted under the same name. Returns NULL on error.
+WXD_EXPORTED wxd_ResourceBundle_t*
+wxd_ResourceBundle_Open(const char* path, const char* mount);
+
+// Unmounts the bundle and releases the handle. The mapping stays alive while streams or
+// translation loaders opened from it still use it.
+WXD_EXPORTED void
+wxd_ResourceBundle_Close(wxd_ResourceBundle_t* self);
+
+WXD_EXPORTED size_t
+wxd_ResourceBundle_GetCount(const wxd_ResourceBundle_t* self);
+
+// Fills `out` with the entry names in sorted order and returns their number.
+WXD_EXPORTED size_t
+wxd_ResourceBundle_GetNames(const wxd_ResourceBundle_t* self, wxd_ArrayString_t* out);
+
+// Points `data`/`len` at the bytes of entry `name` inside the mapping, valid until the bundle
+// is closed. Returns false if there is no such entry.
+WXD_EXPORTED bool
+wxd_ResourceBundle_Find(const wxd_ResourceBundle_t* self, const char* name, const uint8_t** data,
+                        size_t* len);
+
+// Installs a translations loader reading catalogs from the bundle, replacing any existing
+// loader. Catalogs are looked up as "<prefix>/<lang>/<domain>.mo" or
+// "<prefix>/<lang>/LC_MESSAGES/<domain>.mo" (`prefix` may be NULL or empty for the root) and
+// parsed straight from the mapping.
+WXD_EXPORTED void
+wxd_Translations_SetResourceLoader(wxd_Translations_t* translations,
+                                   const wxd_ResourceBundle_t* bundle, const char* prefix);
+
+#endif // WXD_RESOURCE_BUNDLE_H
@@ -0,0 +1,62 @@
+#ifndef WXD_SOCKET_H
+#define WXD_SOCKET_H
+
+#include "../wxd_types.h"
+
+// --- Event-driven non-blocking sockets ---
+// Thin wrappers over wxSocketClient and wxSocketServer in wxSOCKET_NOWAIT mode. The GUI event
+// loop watches the descriptors, and readiness reaches the target handler as
+// WXD_EVENT_TYPE_SOCKET events carrying the id given here and a wxd_SocketNotify kind. Reads and
+// writes never block: they move what the kernel can take right now, directly between the
+// caller's buffer and the socket. Main thread only.
+
+// Starts connecting to host:port (IPv4). A host name is resolved synchronously, so pass an
+// address when that could stall. The outcome arrives as WXD_SOCKET_CONNECTION or
+// WXD_SOCKET_LOST. Returns NULL if the address is invalid.
+WXD_EXPORTED wxd_Socket_t*
+wxd_Socket_Connect(wxd_EvtHandler_t* target, int id, const char* host, uint16_t port);
+
+// Listens on host:port (NULL or empty host for all interfaces, port 0 for any free port).
+// Each pending connection raises WXD_SOCKET_CONNECTION; take it with wxd_SocketServer_Accept.
+// Returns NULL if the port cannot be bound.
+WXD_EXPORTED wxd_Socket_t*
+wxd_SocketServer_Create(wxd_EvtHandler_t* target, int id, const char* host, uint16_t port);
+
+// Takes a pending connection without waiting; its events go to `target` with `id`. Returns
+// NULL if none is pending.
+WXD_EXPORTED wxd_Socket_t*
+wxd_SocketServer_Accept(wxd_Socket_t* server, wxd_EvtHandler_t* target, int id);
+
+// Closes the socket and frees it once queued events for it have been handled. Works for
+// servers and connections alike.
+WXD_EXPORTED void
+wxd_Socket_Destroy(wxd_Socket_t* self);
+
+// Reads up to `capacity` bytes into `buffer`. Returns the number read, 0 if nothing is
+// available yet, or -1 once the connection is closed or failed.
+WXD_EXPORTED int64_t
+wxd_Socket_Read(wxd_Socket_t* self, uint8_t* buffer, size_t capacity);
+
+// Writes as much of `data` as the socket accepts now. Returns the number written (a short
+// count is followed by WXD_SOCKET_OUTPUT once there is room again), or -1 on failure.
+WXD_EXPORTED int64_t
+wxd_Socket_Write(wxd_Socket_t* self, const uint8_t* data, size_t len);
+
+// Shuts the connection down; no further events arrive.
+WXD_EXPORTED void
+wxd_Socket_Close(wxd_Socket_t* self);
+
+WXD_EXPORTED bool
+wxd_Socket_IsConnected(const wxd_Socket_t* self);
+
+// Disables Nagle's algorithm so small writes go out at once.
+WXD_EXPORTED bool
+wxd_Socket_SetNoDelay(wxd_Socket_t* self, bool no_delay);
+
+// Copies the peer (or, with `local`, the bound) address as UTF-8 and sets its port. Returns the
+// address length; 0 if unknown.
+WXD_EXPORTED size_t
+wxd_Socket_GetAddress(const wxd_Socket_t* self, bool local, char* buffer, size_t buffer_size,
+                      uint16_t* port);
+
+#endif // WXD_SOCKET_H
@@ -34,6 +34,49 @@ wxd_Sound_PlayFile(const char* filename, unsigned int flags);
 WXD_EXPORTED void
 wxd_Sound_Stop(void);
 
+// Creates a sound from WAV data in memory; the bytes are copied. NULL if they do not decode.
+WXD_EXPORTED wxd_Sound_t*
+wxd_Sound_CreateFromMemory(const void* data, size_t len);
+
+// Reads and decodes a WAV file once, so playing it never touches the disk again (wxSound on
+// Windows otherwise rereads the file on every Play). NULL if it cannot be read or decoded.
+WXD_EXPORTED wxd_Sound_t*
+wxd_Sound_CreatePreloaded(const char* fileName);
+
+// --- Sound Pool ---
+// Named sounds decoded ahead of time for instant UI feedback. Files are read on a background
+// thread and decoded on the main thread when the event loop next runs; playing a sound that
+// has not finished loading does nothing. Main thread only, except where noted.
+
+typedef struct wxd_SoundPool_t wxd_SoundPool_t;
+
+WXD_EXPORTED wxd_SoundPool_t*
+wxd_SoundPool_Create(void);
+
+// Sounds still loading are discarded when they arrive.
+WXD_EXPORTED void
+wxd_SoundPool_Destroy(wxd_SoundPool_t* pool);
+
+// Starts loading `fileName` under `key`, replacing any sound with that key once loaded.
+WXD_EXPORTED void
+wxd_SoundPool_LoadFileAsync(wxd_SoundPool_t* pool, const char* key, const char* fileName);
+
+// Adds WAV data under `key` right away. Returns false if it does not decode.
+WXD_EXPORTED bool
+wxd_SoundPool_AddFromMemory(wxd_SoundPool_t* pool, const char* key, const void* data,
+                            size_t len);
+
+WXD_EXPORTED bool
+wxd_SoundPool_IsLoaded(wxd_SoundPool_t* pool, const char* key);
+
+// Plays the sound under `key` asynchronously (WXD_SOUND_ASYNC is implied, WXD_SOUND_LOOP is
+// honoured). Returns false if there is no such loaded sound.
+WXD_EXPORTED bool
+wxd_SoundPool_Play(wxd_SoundPool_t* pool, const char* key, unsigned int flags);
+
+WXD_EXPORTED void
+wxd_SoundPool_Remove(wxd_SoundPool_t* pool, const char* key);
+
 #ifdef __cplusplus
 }
 #endif
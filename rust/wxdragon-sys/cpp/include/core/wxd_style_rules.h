@@ -0,0 +1,34 @@
+#ifndef WXD_STYLE_RULES_H
+#define WXD_STYLE_RULES_H
+
+#include "../wxd_types.h"
+
+// --- Batched style application ---
+// Colours and fonts applied to a whole window tree in one native pass, so switching themes
+// repaints once instead of once per control.
+
+typedef enum {
+    WXD_STYLE_RULE_BACKGROUND = 1 << 0,
+    WXD_STYLE_RULE_FOREGROUND = 1 << 1,
+    WXD_STYLE_RULE_FONT = 1 << 2,
+} wxd_StyleRuleFields;
+
+// Matches windows of `class_name` or a class derived from it (e.g. "wxTextCtrl"; NULL for any
+// class) whose name is `name` (NULL for any name), and sets the fields flagged in `set`.
+typedef struct {
+    const char* class_name;
+    const char* name;
+    uint32_t set; // wxd_StyleRuleFields
+    wxd_Colour_t background;
+    wxd_Colour_t foreground;
+    const wxd_Font_t* font;
+} wxd_StyleRule;
+
+// Applies `rules` to `root` and its descendants, not descending into child top-level windows.
+// Where several rules match a window, later rules win field by field. Only values that differ
+// are set; the top-level window is frozen meanwhile, laid out again if a font changed, and
+// refreshed once at the end. Returns the number of windows changed.
+WXD_EXPORTED int
+wxd_Window_ApplyStyleRecursive(wxd_Window_t* root, const wxd_StyleRule* rules, size_t count);
+
+#endif // WXD_STYLE_RULES_H
@@ -47,6 +47,38 @@ wxd_Timer_GetInterval(wxd_Timer_t* self);
 WXD_EXPORTED void
 wxd_Timer_SetInterval(wxd_Timer_t* self, int milliseconds);
 
+// --- Timer wheel ---
+//
+// Multiplexes many logical timers on one native timer. Timers are kept in a hierarchical wheel
+// of 4 levels x 64 slots, so scheduling and cancelling are O(1); the native timer only runs
+// while something is scheduled. All timers that come due in the same tick are reported through a
+// single callback call. Timer ids are never reused, so cancelling a fired id is a harmless no-op.
+
+// Receives the ids of the timers that fired since the previous call. Periodic timers are already
+// rescheduled; the callback may schedule and cancel timers.
+typedef void (*wxd_timer_wheel_callback)(void* userdata, const uint64_t* ids, size_t count);
+typedef void (*wxd_timer_wheel_free_userdata_callback)(void* userdata);
+
+// `tickMs` is the wheel resolution (at least 1); delays are rounded up to whole ticks.
+WXD_EXPORTED wxd_TimerWheel_t*
+wxd_TimerWheel_Create(int tickMs, void* userdata, wxd_timer_wheel_callback callback,
+                      wxd_timer_wheel_free_userdata_callback free_userdata);
+
+WXD_EXPORTED void
+wxd_TimerWheel_Destroy(wxd_TimerWheel_t* self);
+
+// Schedules a timer firing after `delayMs`, then every `periodMs` if > 0. Returns its id, 0 on
+// failure.
+WXD_EXPORTED uint64_t
+wxd_TimerWheel_Schedule(wxd_TimerWheel_t* self, int delayMs, int periodMs);
+
+// False if `id` is unknown, already fired (one-shot) or cancelled.
+WXD_EXPORTED bool
+wxd_TimerWheel_Cancel(wxd_TimerWheel_t* self, uint64_t id);
+
+WXD_EXPORTED size_t
+wxd_TimerWheel_GetPendingCount(const wxd_TimerWheel_t* self);
+
 #ifdef __cplusplus
 }
 #endif
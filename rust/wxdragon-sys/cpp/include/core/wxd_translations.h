@@ -69,6 +69,46 @@ wxd_Translations_GetTranslatedPluralString(wxd_Translations_t* translations,
                                            char* buffer,
                                            size_t buffer_len);
 
+// --- Interned message ids ---
+
+// Intern a msgid (and optional domain, null or "" for the default) and return
+// a stable integer id for it, or -1 on invalid input. Interning the same pair
+// again returns the same id. Ids are process-wide and never released.
+WXD_EXPORTED int
+wxd_Translations_InternMsgId(const char* msgid, const char* domain);
+
+// Intern a singular/plural msgid pair for use with
+// wxd_Translations_GetTranslatedPluralStringById.
+WXD_EXPORTED int
+wxd_Translations_InternPluralMsgId(const char* singular,
+                                   const char* plural,
+                                   const char* domain);
+
+// Get the original UTF-8 text of an interned id (the plural form if `plural`
+// is true and the id was interned as a pair). Returns null for unknown ids.
+// The pointer stays valid for the lifetime of the process.
+WXD_EXPORTED const char*
+wxd_Translations_GetMsgIdString(int id, bool plural, size_t* out_len);
+
+// Look up the translation of an interned id. Translations are kept per
+// instance as pre-converted UTF-8 in a flat table indexed by id, refilled on
+// SetLanguage / AddCatalog, so this is an array index in the common case.
+// Returns null if there is no translation. The returned bytes are not
+// null-terminated and stay valid only until the next call on `translations`.
+WXD_EXPORTED const char*
+wxd_Translations_GetTranslatedStringById(wxd_Translations_t* translations,
+                                         int id,
+                                         size_t* out_len);
+
+// Plural variant of wxd_Translations_GetTranslatedStringById for ids from
+// wxd_Translations_InternPluralMsgId. Returns null if there is no translation;
+// the caller falls back to the original singular or plural text.
+WXD_EXPORTED const char*
+wxd_Translations_GetTranslatedPluralStringById(wxd_Translations_t* translations,
+                                               int id,
+                                               unsigned int n,
+                                               size_t* out_len);
+
 // Get a header value from a catalog (e.g., "Content-Type", "Plural-Forms")
 // Returns the length of the result (not including null terminator), or -1 if not found
 WXD_EXPORTED int
@@ -141,6 +181,28 @@ wxd_Translations_SetRustLoader(wxd_Translations_t* translations,
                                const wxd_RustTranslationsLoader_vtable* vtable,
                                void* user_data);
 
+// --- Memory-mapped catalogs ---
+
+// Add a UTF-8 .mo catalog for `domain` that stays memory-mapped instead of being
+// parsed by wxWidgets. Only its header is read up front; lookups go through the
+// catalog's hash table and copy the requested message straight from the
+// mapping. Mapped catalogs are searched before those added with AddCatalog,
+// most recently added first, by the lookup functions of this header (not by
+// wxWidgets' own _() calls). Returns false if the file is missing, malformed or
+// not UTF-8, so callers can fall back to AddCatalog.
+WXD_EXPORTED bool
+wxd_Translations_AddMappedCatalog(wxd_Translations_t* translations,
+                                  const char* domain,
+                                  const char* path);
+
+// Same, for the catalog stored as entry `name` of a resource bundle; it stays
+// usable after the bundle is closed.
+WXD_EXPORTED bool
+wxd_Translations_AddMappedCatalogFromResource(wxd_Translations_t* translations,
+                                              const char* domain,
+                                              const wxd_ResourceBundle_t* bundle,
+                                              const char* name);
+
 // --- FileTranslationsLoader Functions ---
 
 // Add a catalog lookup path prefix (static method)
@@ -132,4 +132,86 @@ wxd_UIActionSimulator_Text(wxd_UIActionSimulator_t* sim, const char* text);
 WXD_EXPORTED bool
 wxd_UIActionSimulator_Select(wxd_UIActionSimulator_t* sim, const char* text);
 
+// --- Input Latency Probe ---
+
+/**
+ * Percentiles of one latency series, in microseconds. All fields are 0 when count is 0.
+ */
+typedef struct {
+    uint32_t count;
+    int64_t p50_us;
+    int64_t p90_us;
+    int64_t p99_us;
+    int64_t max_us;
+    int64_t mean_us;
+} wxd_LatencyDistribution;
+
+/**
+ * Summary of a probe's samples. to_handler measures from injection until the input event
+ * reached the target window (before any handler ran); to_paint measures until the first paint
+ * of the target or one of its children finished after that. timeouts counts measurements that
+ * saw no such paint in time.
+ */
+typedef struct {
+    wxd_LatencyDistribution to_handler;
+    wxd_LatencyDistribution to_paint;
+    uint32_t timeouts;
+} wxd_LatencyStats;
+
+/**
+ * Creates a probe measuring input latency for target (and its descendants). The probe installs
+ * a global event filter for its lifetime. Main thread only.
+ */
+WXD_EXPORTED wxd_LatencyProbe_t*
+wxd_LatencyProbe_Create(wxd_Window_t* target);
+
+WXD_EXPORTED void
+wxd_LatencyProbe_Destroy(wxd_LatencyProbe_t* probe);
+
+/**
+ * Starts a measurement: the current time becomes the input timestamp. Inject the input right
+ * after, with any wxd_UIActionSimulator_* call, then call wxd_LatencyProbe_Wait.
+ */
+WXD_EXPORTED void
+wxd_LatencyProbe_Begin(wxd_LatencyProbe_t* probe);
+
+/**
+ * Runs the event loop until the measurement started by Begin has seen its paint or timeout_ms
+ * has elapsed, and records the sample. Returns true if a paint was observed. Must not be
+ * called from inside a paint handler.
+ */
+WXD_EXPORTED bool
+wxd_LatencyProbe_Wait(wxd_LatencyProbe_t* probe, int timeout_ms);
+
+/**
+ * Begin + wxd_UIActionSimulator_Char + Wait: one keystroke as a typing or keyboard-scrolling
+ * sample. The target should have keyboard focus. Returns false if the input could not be
+ * injected or no paint followed in time.
+ */
+WXD_EXPORTED bool
+wxd_LatencyProbe_MeasureChar(wxd_LatencyProbe_t* probe, wxd_UIActionSimulator_t* sim,
+                             int keycode, int modifiers, int timeout_ms);
+
+/**
+ * Moves the pointer to (x, y) in screen coordinates outside the measurement, then measures a
+ * click of button there.
+ */
+WXD_EXPORTED bool
+wxd_LatencyProbe_MeasureClick(wxd_LatencyProbe_t* probe, wxd_UIActionSimulator_t* sim,
+                              long x, long y, int button, int timeout_ms);
+
+WXD_EXPORTED void
+wxd_LatencyProbe_GetStats(const wxd_LatencyProbe_t* probe, wxd_LatencyStats* out);
+
+/**
+ * Copies up to capacity raw samples in recording order. Either output array may be NULL;
+ * entries are -1 where the stage was not observed. Returns the total number of samples.
+ */
+WXD_EXPORTED size_t
+wxd_LatencyProbe_GetSamples(const wxd_LatencyProbe_t* probe, int64_t* to_handler_us,
+                            int64_t* to_paint_us, size_t capacity);
+
+WXD_EXPORTED void
+wxd_LatencyProbe_Reset(wxd_LatencyProbe_t* probe);
+
 #endif // WXD_UIACTIONSIMULATOR_H
@@ -0,0 +1,36 @@
+#ifndef WXD_VISIBILITY_H
+#define WXD_VISIBILITY_H
+
+#include "../wxd_types.h"
+
+// --- Top-level window visibility ---
+// Tracks per top-level window whether the user can see it at all: shown, not minimized and, where
+// the platform reports it, not fully covered (NSWindow occlusion state on macOS) or cloaked (DWM
+// on MSW, e.g. on another virtual desktop). GTK reports only shown and minimized. Tracking starts
+// on the first call naming a window inside that top-level window; from then on the top-level
+// window receives WXD_EVENT_TYPE_VISIBILITY_CHANGED whenever the state flips.
+
+// True if `window` is shown on screen and its top-level window is not hidden for any reason.
+WXD_EXPORTED bool
+wxd_Window_IsEffectivelyVisible(wxd_Window_t* window);
+
+// wxd_HiddenReason bits of `window`'s top-level window; 0 when it is visible.
+WXD_EXPORTED uint32_t
+wxd_Window_GetHiddenReasons(wxd_Window_t* window);
+
+// Starts tracking `window`'s top-level window, so it gets visibility change events.
+WXD_EXPORTED void
+wxd_Window_TrackVisibility(wxd_Window_t* window);
+
+// While `window`'s top-level window is hidden, wxd_Window_Refresh and scheduled refreshes for it
+// and its children are dropped or held; one full refresh (and any held frame) follows as soon as
+// it is visible again.
+WXD_EXPORTED void
+wxd_Window_SetPauseRefreshWhenHidden(wxd_Window_t* window, bool pause);
+
+// Runs the periodic `timer` every `hidden_ms` instead of its own interval while `window`'s
+// top-level window is hidden (only if that is slower). 0 removes the override.
+WXD_EXPORTED void
+wxd_Timer_SetHiddenInterval(wxd_Timer_t* timer, wxd_Window_t* window, int hidden_ms);
+
+#endif // WXD_VISIBILITY_H
@@ -0,0 +1,35 @@
+#ifndef WXD_WIDGET_TREE_H
+#define WXD_WIDGET_TREE_H
+
+#include "../wxd_types.h"
+
+// --- Bulk widget tree construction ---
+// A widget tree is a little-endian blob holding one root node. Each node is, in order:
+//   u8 kind, i32 id, i64 style, i32 width, i32 height (DIP; -1 -1 for the default size),
+//   i32 proportion, i32 sizer_flags, i32 border (the node's item in its parent sizer),
+//   u32 label_len, label (UTF-8), u32 tooltip_len, tooltip (UTF-8), u32 child_count,
+// followed by its children. A window node may have one child, a sizer that becomes its sizer.
+// A sizer node's children are windows, sizers or spacers added to it in order; its windows are
+// created on the nearest window ancestor (a static box sizer's own box). A root sizer replaces
+// the parent's sizer; a root window is created as a child of the parent.
+
+typedef enum {
+    WXD_WIDGET_TREE_PANEL = 1,
+    WXD_WIDGET_TREE_STATIC_TEXT = 2,
+    WXD_WIDGET_TREE_BUTTON = 3,
+    WXD_WIDGET_TREE_CHECK_BOX = 4,
+    WXD_WIDGET_TREE_TEXT_CTRL = 5, // label is the initial value
+    WXD_WIDGET_TREE_BOX_SIZER = 16, // style is the orientation
+    WXD_WIDGET_TREE_STATIC_BOX_SIZER = 17, // style is the orientation, label the box label
+    WXD_WIDGET_TREE_SPACER = 18, // width x height, or a stretch spacer if proportion > 0
+} wxd_WidgetTreeKind;
+
+// Builds the tree in `blob` under `parent` while it is frozen, then lays out `parent` once.
+// The created objects are written to `out_handles` in node order (wxd_Window_t* for windows,
+// wxd_Sizer_t* for sizers, null for spacers), up to `out_capacity` entries. Returns the number
+// of nodes, or -1 if the blob is malformed, in which case nothing is created.
+WXD_EXPORTED int
+wxd_BuildWidgetTree(wxd_Window_t* parent, const uint8_t* blob, size_t len, void** out_handles,
+                    size_t out_capacity);
+
+#endif // WXD_WIDGET_TREE_H
@@ -16,8 +16,26 @@ WXD_EXPORTED void
 wxd_Window_Fit(wxd_Window_t* window);
 WXD_EXPORTED void
 wxd_Window_Layout(wxd_Window_t* window);
+// Layout batching for bulk UI construction. From Begin to the matching End on a window, its
+// top-level parent stays frozen and wxd_Window_Layout, wxd_Window_Fit and
+// wxd_Window_SetSizerAndFit only record the window. End then runs each recorded operation once
+// per window (fits innermost first, layouts outermost first) and thaws. Batches nest per
+// top-level window; only the outermost End commits.
+WXD_EXPORTED void
+wxd_Window_BeginLayoutBatch(wxd_Window_t* window);
+WXD_EXPORTED void
+wxd_Window_EndLayoutBatch(wxd_Window_t* window);
 WXD_EXPORTED wxd_Size
 wxd_Window_GetBestSize(wxd_Window_t* window);
+// Writes the best size of each of `count` windows to `out` ({-1, -1} for null entries). Best
+// sizes of leaf controls are remembered per window and reused while their label, font, DPI
+// scale and item count are unchanged; other changes need wxd_Window_InvalidateBestSize.
+WXD_EXPORTED void
+wxd_Window_GetBestSizes(wxd_Window_t* const* windows, size_t count, wxd_Size* out);
+// Drops the remembered and wx's cached best size, for controls whose size depends on other
+// state.
+WXD_EXPORTED void
+wxd_Window_InvalidateBestSize(wxd_Window_t* window);
 WXD_EXPORTED void
 wxd_Window_Destroy(wxd_Window_t* window); // Generic destroy
 WXD_EXPORTED void
@@ -149,6 +167,14 @@ WXD_EXPORTED wxd_Window_t*
 wxd_Window_FindWindowByName(wxd_Window_t* window, const char* name);
 WXD_EXPORTED wxd_Window_t*
 wxd_Window_FindWindowById(wxd_Window_t* window, int id);
+// Keeps an id and a name index of `window`'s descendants so wxd_Window_FindWindowById/ByName/
+// ByXRCName on it or any descendant answer without walking the tree. Results are the same as
+// without it; the first miss after new children were created rebuilds the index, other misses
+// walk the tree. Meant for large forms and XRC setup; the index goes away with the window.
+WXD_EXPORTED void
+wxd_Window_SetLookupIndexEnabled(wxd_Window_t* window, bool enable);
+WXD_EXPORTED bool
+wxd_Window_IsLookupIndexEnabled(wxd_Window_t* window);
 
 // --- Cursor Management Functions ---
 WXD_EXPORTED void
@@ -186,6 +212,11 @@ wxd_Window_GetTextExtent(wxd_Window_t* window, const char* text);
 WXD_EXPORTED void
 wxd_Window_GetFullTextExtent(wxd_Window_t* window, const char* text, wxd_Size* size, int* descent,
                              int* external_leading, wxd_Font_t* font);
+// Measures n strings in the window font in one call: string i is the UTF-8 bytes
+// packed[offsets[i]..offsets[i + 1]) (`offsets` has n + 1 entries). Either output may be null.
+WXD_EXPORTED void
+wxd_Window_GetTextExtents(wxd_Window_t* window, const char* packed, const uint32_t* offsets,
+                          size_t n, int32_t* widths, int32_t* heights);
 WXD_EXPORTED int
 wxd_Window_GetCharHeight(wxd_Window_t* window);
 WXD_EXPORTED int
@@ -0,0 +1,64 @@
+#ifndef WXD_WINDOW_SNAPSHOT_H
+#define WXD_WINDOW_SNAPSHOT_H
+
+#include "../wxd_types.h"
+
+// --- Window hierarchy snapshot ---
+// The state of a whole window tree captured in one native traversal, for inspectors,
+// accessibility and automation tools that would otherwise make several calls per window.
+
+typedef struct wxd_WindowSnapshot_t wxd_WindowSnapshot_t;
+
+typedef enum {
+    // Skip the subtrees of hidden windows.
+    WXD_WINDOW_SNAPSHOT_SHOWN_ONLY = 1 << 0,
+    // Do not descend into child top-level windows (dialogs and frames owned by a window).
+    WXD_WINDOW_SNAPSHOT_SKIP_TOP_LEVEL = 1 << 1,
+    // Fill screen_rect; costs a coordinate conversion per window.
+    WXD_WINDOW_SNAPSHOT_SCREEN_RECTS = 1 << 2,
+} wxd_WindowSnapshotFlags;
+
+typedef enum {
+    WXD_WINDOW_NODE_SHOWN = 1 << 0,           // IsShown()
+    WXD_WINDOW_NODE_SHOWN_ON_SCREEN = 1 << 1, // IsShownOnScreen()
+    WXD_WINDOW_NODE_ENABLED = 1 << 2,         // IsEnabled(), parents included
+    WXD_WINDOW_NODE_TOP_LEVEL = 1 << 3,
+    WXD_WINDOW_NODE_FOCUSED = 1 << 4,
+} wxd_WindowNodeFlags;
+
+// One window, in pre-order. Strings are ranges of wxd_WindowSnapshot_GetStrings (UTF-8, not
+// NUL-terminated); class names are stored once per class.
+typedef struct {
+    wxd_Window_t* window;
+    int32_t parent; // node index, -1 for the root
+    int32_t depth;
+    int32_t id;
+    uint32_t flags; // wxd_WindowNodeFlags
+    uint32_t class_offset;
+    uint32_t class_len;
+    uint32_t name_offset;
+    uint32_t name_len;
+    wxd_Rect rect;        // position and size in the parent's client area
+    wxd_Rect client_rect; // client area in the window's own coordinates
+    wxd_Rect screen_rect; // with WXD_WINDOW_SNAPSHOT_SCREEN_RECTS, else all zero
+} wxd_WindowSnapshotNode;
+
+// Captures `root` and its descendants. NULL if `root` is NULL. Free with
+// wxd_WindowSnapshot_Destroy.
+WXD_EXPORTED wxd_WindowSnapshot_t*
+wxd_Window_SnapshotTree(wxd_Window_t* root, uint32_t flags);
+
+WXD_EXPORTED size_t
+wxd_WindowSnapshot_GetCount(const wxd_WindowSnapshot_t* snapshot);
+
+// `count` nodes, valid until the snapshot is destroyed.
+WXD_EXPORTED const wxd_WindowSnapshotNode*
+wxd_WindowSnapshot_GetNodes(const wxd_WindowSnapshot_t* snapshot);
+
+WXD_EXPORTED const char*
+wxd_WindowSnapshot_GetStrings(const wxd_WindowSnapshot_t* snapshot, size_t* len);
+
+WXD_EXPORTED void
+wxd_WindowSnapshot_Destroy(wxd_WindowSnapshot_t* snapshot);
+
+#endif // WXD_WINDOW_SNAPSHOT_H
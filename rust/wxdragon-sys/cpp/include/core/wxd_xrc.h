@@ -23,6 +23,17 @@ wxd_XmlResource_LoadFromFile(wxd_XmlResource_t* self, const char* filemask);
 WXD_EXPORTED bool
 wxd_XmlResource_LoadFromString(wxd_XmlResource_t* self, const char* xrc_data);
 
+// Parse XRC data (`len` bytes of UTF-8 XML) and return its compiled binary form, or null if it
+// is not well-formed. The result only depends on the input, so it can be cached by content.
+WXD_EXPORTED wxd_String_t*
+wxd_XmlResource_CompileString(const char* xrc_data, size_t len);
+
+// Load XRC compiled by wxd_XmlResource_CompileString without parsing XML. `name` (may be null)
+// identifies the document. Returns false for data from another format version.
+WXD_EXPORTED bool
+wxd_XmlResource_LoadCompiled(wxd_XmlResource_t* self, const uint8_t* data, size_t len,
+                             const char* name);
+
 // Load a dialog from XRC
 WXD_EXPORTED wxd_Dialog_t*
 wxd_XmlResource_LoadDialog(wxd_XmlResource_t* self, wxd_Window_t* parent, const char* name);
@@ -40,6 +40,39 @@ wxd_Dialog_SetReturnCode(wxd_Dialog_t* self, int retCode);
 WXD_EXPORTED int
 wxd_Dialog_GetReturnCode(wxd_Dialog_t* self);
 
+// --- Dialog Pool ---
+// Dialogs that are opened often can be parked hidden under a key instead of being destroyed and
+// taken back later, skipping native creation and layout. The dialog keeps its children and
+// event bindings while pooled. Dialogs from wxd_Dialog_Create do not keep the application
+// running while pooled; others should have a parent. GUI thread only.
+
+// Builds a dialog when the pool has none for the key.
+typedef wxd_Dialog_t* (*wxd_dialog_factory_fn)(void* userdata);
+
+// Ends the modal loop if running, hides the dialog, resets its return code and parks it under
+// `key`, destroying the oldest pooled dialogs beyond the limits. Returns false if the dialog
+// was destroyed instead (limits of 0).
+WXD_EXPORTED bool
+wxd_Dialog_Release(wxd_Dialog_t* self, const char* key);
+
+// Takes the most recently released dialog of `key` out of the pool, or calls `factory`.
+// `reused` (optional) tells which happened.
+WXD_EXPORTED wxd_Dialog_t*
+wxd_Dialog_Acquire(const char* key, wxd_dialog_factory_fn factory, void* userdata,
+                   bool* reused);
+
+// Caps pooled dialogs per key and in total (defaults 4 and 16), destroying the oldest
+// beyond them.
+WXD_EXPORTED void
+wxd_Dialog_SetPoolLimits(size_t per_key, size_t total);
+
+// Destroys the pooled dialogs of `key`, or all of them for NULL.
+WXD_EXPORTED void
+wxd_Dialog_ClearPool(const char* key);
+
+WXD_EXPORTED size_t
+wxd_Dialog_GetPooledCount(const char* key);
+
 // --- MessageDialog ---
 WXD_EXPORTED wxd_MessageDialog_t*
 wxd_MessageDialog_Create(wxd_Window_t* parent, const char* message, const char* caption,
@@ -163,6 +196,13 @@ WXD_EXPORTED wxd_Font_t*
 wxd_Font_CreateEx(int point_size, int family, int style, int weight, bool underlined,
                   const char* face_name);
 
+// Like wxd_Font_CreateEx, but returns a handle sharing the native font of an interned instance
+// with the same description, creating it on first use. The handle is released with
+// wxd_Font_Destroy; modifying it detaches a private copy.
+WXD_EXPORTED wxd_Font_t*
+wxd_Font_CreateCached(int point_size, int family, int style, int weight, bool underlined,
+                      const char* face_name);
+
 WXD_EXPORTED bool
 wxd_Font_AddPrivateFont(const char* font_file_path);
 
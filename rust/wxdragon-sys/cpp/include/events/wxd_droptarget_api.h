@@ -11,6 +11,29 @@ extern "C" {
 typedef bool (*wxd_OnDropText_Callback)(const char* text, int x, int y, void* userData);
 typedef bool (*wxd_OnDropFiles_Callback)(const wxd_ArrayString_t* filenames, int x, int y,
                                          void* userData);
+// Dropped paths packed into one UTF-8 blob: path i spans blob[offsets[i]] up to a NUL at
+// blob[offsets[i + 1] - 1]. `offsets` holds count + 1 entries.
+typedef bool (*wxd_OnDropFilesPacked_Callback)(const char* blob, const uint32_t* offsets,
+                                               int count, int x, int y, void* userData);
+
+typedef enum {
+    WXD_DROPPED_FILE_EXISTS = 1 << 0,
+    WXD_DROPPED_FILE_DIR = 1 << 1,
+    WXD_DROPPED_FILE_LINK = 1 << 2,
+} wxd_DroppedFileFlags;
+
+typedef struct {
+    uint64_t size;
+    int64_t modified; // Seconds since the Unix epoch.
+    uint32_t flags;   // wxd_DroppedFileFlags
+} wxd_DroppedFileInfo;
+
+// A batch of a streamed drop on the main thread, packed as for wxd_OnDropFilesPacked_Callback
+// with one info per path; `done` on the last batch.
+typedef void (*wxd_OnDroppedFileInfo_Callback)(const char* blob, const uint32_t* offsets,
+                                               const wxd_DroppedFileInfo* infos, int count,
+                                               bool done, void* userData);
+
 // Cleanup callback to free userData allocated on the Rust side
 typedef void (*wxd_FreeUserData_Callback)(void* userData);
 
@@ -40,6 +63,20 @@ wxd_FileDropTarget_CreateFull(wxd_Window_t* window, wxd_OnEnter_Callback onEnter
                               wxd_OnDropFiles_Callback onDropFiles, void* userData,
                               wxd_FreeUserData_Callback freeUserData);
 
+// Delivers drops to `onDropFilesPacked` instead of the wxd_ArrayString_t callback, with the
+// userData the target was created with. This and the next setter apply to targets made with
+// wxd_FileDropTarget_CreateFull.
+WXD_EXPORTED void
+wxd_FileDropTarget_SetOnDropFilesPacked(wxd_FileDropTarget_t* dropTarget,
+                                        wxd_OnDropFilesPacked_Callback onDropFilesPacked);
+
+// Streaming mode: a drop is accepted at once, and the paths with their size, modification time
+// and type are collected on a worker thread and delivered to `onFileInfo` in batches. Neither
+// drop-files callback runs then. NULL returns to immediate delivery.
+WXD_EXPORTED void
+wxd_FileDropTarget_SetOnDroppedFileInfo(wxd_FileDropTarget_t* dropTarget,
+                                        wxd_OnDroppedFileInfo_Callback onFileInfo);
+
 // Create text drop target (simplified version)
 WXD_EXPORTED wxd_TextDropTarget_t*
 wxd_TextDropTarget_Create(wxd_Window_t* window, void* onDropTextCallback, void* userData);
@@ -19,6 +19,52 @@ WXD_EXPORTED void
 wxd_EvtHandler_BindWithId(wxd_EvtHandler_t* handler, WXDEventTypeCEnum event_type, int id,
                           void* rust_trampoline_fn, void* rust_closure_ptr, size_t token);
 
+// Bind a coalesced handler for a high-frequency event (motion, size, wheel or scroll).
+// Events of the same type and id are merged and only the newest is delivered, once per
+// event-loop iteration; wheel rotation is summed. Such handlers cannot consume or veto the event.
+// Other event types fall back to a normal binding.
+WXD_EXPORTED void
+wxd_EvtHandler_BindCoalesced(wxd_EvtHandler_t* handler, WXDEventTypeCEnum event_type,
+                             void* rust_trampoline_fn, void* rust_closure_ptr, size_t token);
+
+// Bind a rate-limited handler, typically for wxEVT_TEXT on search and filter inputs. Only the
+// newest event is delivered: after `interval_ms` without further events (debounce), or at most
+// once per `interval_ms` with the held-back event delivered when the interval ends (throttle).
+// One timer per handler drives all such bindings. For text events the delivered event's string
+// is the control's value at delivery. Such handlers cannot consume or veto the event. An
+// interval of 0 binds normally.
+WXD_EXPORTED void
+wxd_EvtHandler_BindRateLimited(wxd_EvtHandler_t* handler, WXDEventTypeCEnum event_type,
+                               wxd_RateLimitMode mode, uint32_t interval_ms,
+                               void* rust_trampoline_fn, void* rust_closure_ptr, size_t token);
+
+// What a paint binding gets besides the event: the window's paint DC and its update region as
+// rectangles, in client coordinates. Valid only during the call.
+typedef struct {
+    wxd_DC_t* dc;
+    const wxd_Rect* rects; // NULL if rect_count is 0
+    size_t rect_count;
+    wxd_Rect bounds; // Bounding box of the update region
+} wxd_PaintContext;
+
+typedef void (*wxd_PaintCallback)(void* closure, wxd_Event_t* event,
+                                  const wxd_PaintContext* context);
+
+// Bind a wxEVT_PAINT handler of a window that is called with a prebuilt paint DC: a wxPaintDC,
+// or a wxAutoBufferedPaintDC if `buffered` (which also sets the wxBG_STYLE_PAINT background
+// style). All paint bindings of one event share the DC the first of them asked for; the window
+// must not also have paint handlers creating their own wxPaintDC. The closure is freed through
+// drop_rust_event_closure_box; returns false, with the closure already dropped, if `handler` is
+// not a window.
+WXD_EXPORTED bool
+wxd_EvtHandler_BindPaint(wxd_EvtHandler_t* handler, bool buffered, wxd_PaintCallback trampoline,
+                         void* rust_closure_ptr, size_t token);
+
+// Number of events merged into `event` when delivered to a coalesced or rate-limited handler,
+// 1 otherwise.
+WXD_EXPORTED int
+wxd_Event_GetCoalescedCount(wxd_Event_t* event);
+
 // Unbind event handler by token
 // Returns true if handler was found and removed, false otherwise
 WXD_EXPORTED bool
@@ -29,6 +75,25 @@ wxd_EvtHandler_Unbind(wxd_EvtHandler_t* handler, size_t token);
 WXD_EXPORTED size_t
 wxd_EvtHandler_UnbindAll(wxd_EvtHandler_t* handler);
 
+// Thread messages: typed payloads queued to a handler from any thread and delivered on the GUI
+// thread as WXD_EVENT_TYPE_THREAD_MESSAGE through the handler's normal bindings. Each handler
+// has its own pending queue, processed in full on every event loop pass.
+//
+// Registers `handler` as a message target; call on the GUI thread. Returns false for a window
+// being deleted.
+WXD_EXPORTED bool
+wxd_EvtHandler_EnableThreadEvents(wxd_EvtHandler_t* handler);
+// Queues `payload` with the user-chosen `kind` to a handler registered with
+// EnableThreadEvents. Thread-safe. `drop_fn` releases the payload if it is never taken: on
+// failure (returning false, when the handler was not registered or has been destroyed), when
+// the handler is destroyed with the message pending, or after delivery.
+WXD_EXPORTED bool
+wxd_EvtHandler_QueueThreadEvent(wxd_EvtHandler_t* handler, int32_t kind, void* payload,
+                                void (*drop_fn)(void*));
+// Whether `handler` is registered and still alive. Thread-safe.
+WXD_EXPORTED bool
+wxd_EvtHandler_AcceptsThreadEvents(wxd_EvtHandler_t* handler);
+
 WXD_EXPORTED int
 wxd_Event_GetId(wxd_Event_t* event);
 WXD_EXPORTED wxd_Window_t*
@@ -38,6 +103,11 @@ wxd_Event_Skip(wxd_Event_t* event, bool skip);
 WXD_EXPORTED WXDEventTypeCEnum
 wxd_Event_GetEventType(wxd_Event_t* event);
 
+// Fills `out` with the id, type, mouse, keyboard and command fields of `event` in one call.
+// Returns false (leaving `out` zeroed with position {-1, -1}) if either pointer is null.
+WXD_EXPORTED bool
+wxd_Event_GetSnapshot(wxd_Event_t* event, wxd_EventSnapshot* out);
+
 /**
  * Get string from wxCommandEvent.
  * Returns the length of the string (excluding null terminator), if any error, -1 returned.
@@ -51,6 +121,12 @@ WXD_EXPORTED bool
 wxd_CommandEvent_IsChecked(wxd_Event_t* event);
 WXD_EXPORTED wxd_Point
 wxd_MouseEvent_GetPosition(wxd_Event_t* event);
+// Copies up to `capacity` samples making up a motion event, oldest first, and returns how many
+// there are: the positions the platform merged into it (Windows only), then the event's own
+// position. For a coalesced motion binding this covers every event merged into the delivery.
+// Returns 0 for other events.
+WXD_EXPORTED size_t
+wxd_MouseEvent_GetPointerHistory(wxd_Event_t* event, wxd_PointerSample* out, size_t capacity);
 WXD_EXPORTED int
 wxd_KeyEvent_GetKeyCode(wxd_Event_t* event);
 WXD_EXPORTED int
@@ -96,6 +172,12 @@ wxd_TreeEvent_GetLabel(wxd_Event_t* event, char* buffer, size_t buffer_len);
 WXD_EXPORTED wxd_TreeItemId_t*
 wxd_TreeEvent_GetOldItem(wxd_Event_t* event);
 
+// Allocation-free forms of GetItem / GetOldItem; 0 if the event has no such item.
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeEvent_GetItemHandle(wxd_Event_t* event);
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeEvent_GetOldItemHandle(wxd_Event_t* event);
+
 WXD_EXPORTED int
 wxd_TreeEvent_IsEditCancelled(wxd_Event_t* event); // Returns bool as int (0 or 1)
 
@@ -156,6 +238,10 @@ wxd_TreeListEvent_GetOldCheckedState(wxd_Event_t* event);
 void
 drop_rust_event_closure_box(void* ptr);
 
+// Same for `count` closures at once; used when a handler's bindings are dropped together.
+void
+drop_rust_event_closure_boxes(void* const* ptrs, size_t count);
+
 // Rust callback for cleanup notifier
 WXD_EXPORTED void
 notify_rust_of_cleanup(wxd_Window_t* win_ptr);
@@ -244,6 +330,57 @@ wxd_CollapsiblePaneEvent_GetCollapsed(wxd_Event_t* event);
 WXD_EXPORTED bool
 wxd_ActivateEvent_IsActive(wxd_Event_t* event);
 
+// SpatialHoverEvent specific accessors. Return false when nothing is (was) hovered.
+WXD_EXPORTED bool
+wxd_SpatialHoverEvent_GetItem(wxd_Event_t* event, int64_t* id);
+WXD_EXPORTED bool
+wxd_SpatialHoverEvent_GetPreviousItem(wxd_Event_t* event, int64_t* id);
+
+// FileSystemChangesEvent specific accessors. GetPaths fills `out` with the changed paths in
+// order of first change; GetChanges writes their wxd_FileSystemChange bits to `kinds` (up to
+// `capacity`) and returns the number of paths.
+WXD_EXPORTED size_t
+wxd_FileSystemChangesEvent_GetPaths(wxd_Event_t* event, wxd_ArrayString_t* out);
+WXD_EXPORTED size_t
+wxd_FileSystemChangesEvent_GetChanges(wxd_Event_t* event, int32_t* kinds, size_t capacity);
+// True if the native watcher reported lost events (e.g. a queue overflow) during the batch, in
+// which case the watched trees should be rescanned.
+WXD_EXPORTED bool
+wxd_FileSystemChangesEvent_HasOverflowed(wxd_Event_t* event);
+
+// ChildProcessEvent specific accessors, for WXD_EVENT_TYPE_PROCESS_OUTPUT / _EXIT. GetData
+// copies up to `capacity` output bytes and returns the full length; the exit code is -1 for
+// output events.
+WXD_EXPORTED int64_t
+wxd_ChildProcessEvent_GetPid(wxd_Event_t* event);
+WXD_EXPORTED bool
+wxd_ChildProcessEvent_IsStderr(wxd_Event_t* event);
+WXD_EXPORTED size_t
+wxd_ChildProcessEvent_GetData(wxd_Event_t* event, uint8_t* buffer, size_t capacity);
+WXD_EXPORTED int
+wxd_ChildProcessEvent_GetExitCode(wxd_Event_t* event);
+
+// ThreadMessageEvent specific accessors, for WXD_EVENT_TYPE_THREAD_MESSAGE. GetPayload borrows
+// the payload; TakePayload transfers it to the caller, so the drop function no longer runs.
+WXD_EXPORTED int32_t
+wxd_ThreadMessageEvent_GetKind(wxd_Event_t* event);
+WXD_EXPORTED void*
+wxd_ThreadMessageEvent_GetPayload(wxd_Event_t* event);
+WXD_EXPORTED void*
+wxd_ThreadMessageEvent_TakePayload(wxd_Event_t* event);
+
+// VisibilityEvent accessor, for WXD_EVENT_TYPE_VISIBILITY_CHANGED: the wxd_HiddenReason bits of
+// the new state, 0 once the top-level window is visible again.
+WXD_EXPORTED uint32_t
+wxd_VisibilityEvent_GetHiddenReasons(wxd_Event_t* event);
+
+// SocketEvent accessors, for WXD_EVENT_TYPE_SOCKET: the wxd_SocketNotify kind (-1 for other
+// events) and the socket it concerns.
+WXD_EXPORTED int
+wxd_SocketEvent_GetNotify(wxd_Event_t* event);
+WXD_EXPORTED wxd_Socket_t*
+wxd_SocketEvent_GetSocket(wxd_Event_t* event);
+
 #ifdef __cplusplus
 }
 #endif
@@ -27,6 +27,15 @@ wxd_BitmapBundle_Destroy(wxd_BitmapBundle_t* bundle);
 WXD_EXPORTED wxd_BitmapBundle_t*
 wxd_BitmapBundle_FromBitmaps(const wxd_Bitmap_t* const* bitmaps, size_t count);
 
+// Creates `count` bundles from RGBA atlases holding the same icons at different resolutions on
+// the same grid: icon i is tile i (row-major) of every sheet, and sheet s is sheet_sizes[s]
+// pixels with tiles of tile_sizes[s]. Each sheet is converted to a native bitmap once. Writes
+// the bundles to `out` and returns how many were created (0 on invalid input).
+WXD_EXPORTED size_t
+wxd_BitmapBundle_FromAtlases(const unsigned char* const* sheets, const wxd_Size* sheet_sizes,
+                             const wxd_Size* tile_sizes, size_t sheet_count, size_t count,
+                             wxd_BitmapBundle_t** out);
+
 // SVG-related functions
 WXD_EXPORTED wxd_BitmapBundle_t*
 wxd_BitmapBundle_FromSVGFile(const char* path, wxd_Size size);
@@ -57,6 +66,23 @@ wxd_BitmapBundle_GetPreferredBitmapSizeFor(const wxd_BitmapBundle_t* bundle, wxd
 WXD_EXPORTED bool
 wxd_BitmapBundle_IsOk(const wxd_BitmapBundle_t* bundle);
 
+// --- SVG rasterization cache ---
+// Bundles created from SVG share a process-wide cache of rasterized bitmaps keyed by the SVG
+// content and pixel size, so identical icons are rasterized once per size across all bundles
+// and windows. Main thread only.
+
+// Sets the number of cached bitmaps (default 256; 0 disables) and empties the cache.
+WXD_EXPORTED void
+wxd_BitmapBundle_SetSVGCacheCapacity(size_t entries);
+
+WXD_EXPORTED void
+wxd_BitmapBundle_ClearSVGCache(void);
+
+// Also keeps rasterized bitmaps as PNG files in `dir` (created if missing) to speed up later
+// runs; nullptr or "" turns the disk cache off. Returns false if the directory is unusable.
+WXD_EXPORTED bool
+wxd_BitmapBundle_SetSVGDiskCacheDir(const char* dir);
+
 #ifdef __cplusplus
 }
 #endif
@@ -15,6 +15,8 @@ typedef struct wxd_PaintDC_t wxd_PaintDC_t;
 typedef struct wxd_MemoryDC_t wxd_MemoryDC_t;
 typedef struct wxd_ScreenDC_t wxd_ScreenDC_t;
 typedef struct wxd_AutoBufferedPaintDC_t wxd_AutoBufferedPaintDC_t;
+typedef struct wxd_Pen_t wxd_Pen_t;
+typedef struct wxd_Brush_t wxd_Brush_t;
 
 // DC Creation/Destruction
 WXD_EXPORTED wxd_WindowDC_t*
@@ -81,6 +83,21 @@ wxd_DC_SetPen(wxd_DC_t* dc, wxd_Colour_t colour, int width, int style);
 WXD_EXPORTED void
 wxd_DC_SetBrush(wxd_DC_t* dc, wxd_Colour_t colour, int style);
 
+// SetPen / SetBrush reuse pens and brushes from a small cache keyed by their arguments. For hot
+// paths, create the objects once and select them; selecting shares the native object.
+WXD_EXPORTED wxd_Pen_t*
+wxd_Pen_Create(wxd_Colour_t colour, int width, int style);
+WXD_EXPORTED void
+wxd_Pen_Destroy(wxd_Pen_t* pen);
+WXD_EXPORTED wxd_Brush_t*
+wxd_Brush_Create(wxd_Colour_t colour, int style);
+WXD_EXPORTED void
+wxd_Brush_Destroy(wxd_Brush_t* brush);
+WXD_EXPORTED void
+wxd_DC_SelectPen(wxd_DC_t* dc, const wxd_Pen_t* pen);
+WXD_EXPORTED void
+wxd_DC_SelectBrush(wxd_DC_t* dc, const wxd_Brush_t* brush);
+
 // Basic drawing operations
 WXD_EXPORTED void
 wxd_DC_DrawPoint(wxd_DC_t* dc, int x, int y);
@@ -208,6 +225,23 @@ wxd_DC_GetSizeMM(wxd_DC_t* dc);
 WXD_EXPORTED void
 wxd_DC_GetTextExtent(wxd_DC_t* dc, const char* string, int* w, int* h);
 
+// Measures n strings in the DC font in one call, see wxd_Window_GetTextExtents.
+WXD_EXPORTED void
+wxd_DC_GetTextExtents(wxd_DC_t* dc, const char* packed, const uint32_t* offsets, size_t n,
+                      int32_t* widths, int32_t* heights);
+
+/**
+ * Enables a cache of measured text extents used by the DC and window extent functions (not the
+ * multi-line ones), holding up to `entries` strings and evicting the least recently used. It is
+ * keyed by the UTF-8 text, the font and the DPI and user scale, so a changed font or scale
+ * misses rather than reading stale sizes. Changing the capacity clears it; 0 disables it.
+ */
+WXD_EXPORTED void
+wxd_TextExtentCache_SetCapacity(size_t entries);
+
+WXD_EXPORTED void
+wxd_TextExtentCache_Clear(void);
+
 WXD_EXPORTED void
 wxd_DC_GetFullTextExtent(wxd_DC_t* dc, const char* string, int* w, int* h, int* descent,
                          int* externalLeading, const wxd_Font_t* font);
@@ -269,6 +303,94 @@ wxd_MemoryDC_SelectObject(wxd_MemoryDC_t* dc, const wxd_Bitmap_t* bitmap);
 WXD_EXPORTED void
 wxd_MemoryDC_SelectObjectAsSource(wxd_MemoryDC_t* dc, const wxd_Bitmap_t* bitmap);
 
+// --- Batched primitives ---
+//
+// Draw many items in one call, like wxPython's DrawPointList and friends. `style` (nullable)
+// selects a pen and / or brush per item by index into its palettes. Without an index array the
+// DC's current pen or brush is used; an index past the palette leaves it unchanged.
+typedef struct {
+    const wxd_Pen_t* const* pens;
+    size_t pen_count;
+    const uint32_t* pen_indices; // one per item, nullable
+    const wxd_Brush_t* const* brushes;
+    size_t brush_count;
+    const uint32_t* brush_indices; // one per item, nullable
+} wxd_DrawListStyle;
+
+WXD_EXPORTED void
+wxd_DC_DrawPointList(wxd_DC_t* dc, const wxd_Point* points, size_t n,
+                     const wxd_DrawListStyle* style);
+
+// Segment i runs from points[2 * i] to points[2 * i + 1].
+WXD_EXPORTED void
+wxd_DC_DrawLineList(wxd_DC_t* dc, const wxd_Point* points, size_t n,
+                    const wxd_DrawListStyle* style);
+
+WXD_EXPORTED void
+wxd_DC_DrawRectangleList(wxd_DC_t* dc, const wxd_Rect* rects, size_t n,
+                         const wxd_DrawListStyle* style);
+
+WXD_EXPORTED void
+wxd_DC_DrawEllipseList(wxd_DC_t* dc, const wxd_Rect* rects, size_t n,
+                       const wxd_DrawListStyle* style);
+
+// Circles around `centres`, with per-item `radii` or, if that is null, `radius` for all.
+WXD_EXPORTED void
+wxd_DC_DrawCircleList(wxd_DC_t* dc, const wxd_Point* centres, const int32_t* radii, int radius,
+                      size_t n, const wxd_DrawListStyle* style);
+
+/**
+ * Draws text i, the UTF-8 bytes packed[offsets[i]..offsets[i + 1]) (`offsets` has n + 1
+ * entries), at positions[i]. `foregrounds` (nullable) gives a text colour per item.
+ */
+WXD_EXPORTED void
+wxd_DC_DrawTextList(wxd_DC_t* dc, const char* packed, const uint32_t* offsets,
+                    const wxd_Point* positions, size_t n, const wxd_Colour_t* foregrounds);
+
+// --- Recorded drawing commands ---
+//
+// A command stream is a sequence of 32-bit words: an opcode followed by its operands. Colours
+// are packed 0xRRGGBBAA, `f32` operands are stored as their bit pattern, and text is a byte
+// length followed by the UTF-8 bytes padded to a whole word. Pens and brushes come from the same
+// cache as wxd_DC_SetPen / wxd_DC_SetBrush.
+typedef enum {
+    WXD_DRAW_OP_SET_PEN = 1,             // colour, width, style
+    WXD_DRAW_OP_SET_BRUSH = 2,           // colour, style
+    WXD_DRAW_OP_SET_TEXT_FOREGROUND = 3, // colour
+    WXD_DRAW_OP_SET_TEXT_BACKGROUND = 4, // colour
+    WXD_DRAW_OP_POINT = 5,               // x, y
+    WXD_DRAW_OP_LINE = 6,                // x1, y1, x2, y2
+    WXD_DRAW_OP_RECTANGLE = 7,           // x, y, width, height
+    WXD_DRAW_OP_ROUNDED_RECTANGLE = 8,   // x, y, width, height, f32 radius
+    WXD_DRAW_OP_CIRCLE = 9,              // x, y, radius
+    WXD_DRAW_OP_ELLIPSE = 10,            // x, y, width, height
+    WXD_DRAW_OP_ARC = 11,                // x1, y1, x2, y2, xc, yc
+    WXD_DRAW_OP_TEXT = 12,               // x, y, byte length, bytes
+    WXD_DRAW_OP_LINES = 13,              // n, n x (x, y)
+    WXD_DRAW_OP_POLYGON = 14,            // n, fill style, n x (x, y)
+    WXD_DRAW_OP_SET_CLIP = 15,           // x, y, width, height
+    WXD_DRAW_OP_RESET_CLIP = 16,         // no operands
+} wxd_DrawOp;
+
+// Offset (device units) and scale applied on top of the DC's own for one replay.
+typedef struct {
+    int32_t dx;
+    int32_t dy;
+    double sx;
+    double sy;
+} wxd_DrawTransform;
+
+/**
+ * Replays `count` words of recorded commands on `dc`, with `transform` (nullable) applied for
+ * the duration of the call; the DC's origin and scale are restored afterwards. Clip commands
+ * work within the DC's clipping box at the start of the call: SET_CLIP intersects with it,
+ * RESET_CLIP and the end of the stream return to it. Stops at the first unknown or truncated
+ * command. Returns the number of commands executed.
+ */
+WXD_EXPORTED size_t
+wxd_DC_ExecuteCommands(wxd_DC_t* dc, const uint32_t* words, size_t count,
+                       const wxd_DrawTransform* transform);
+
 // Type casting functions (for safely using base DC functions with derived types)
 WXD_EXPORTED wxd_DC_t*
 wxd_WindowDC_AsDC(wxd_WindowDC_t* dc);
@@ -0,0 +1,171 @@
+#ifndef WXD_GRAPHICS_H
+#define WXD_GRAPHICS_H
+
+#include "../wxd_types.h"
+#include "wxd_dc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --- wxGraphicsContext ---
+//
+// Anti-aliased drawing through the platform renderer (Direct2D or GDI+ on MSW, CoreGraphics on
+// macOS, Cairo on GTK). Coordinates are doubles; point arrays are passed whole so a polyline or
+// path of any length costs one call.
+
+typedef struct wxd_GraphicsContext_t wxd_GraphicsContext_t;
+typedef struct wxd_GraphicsPath_t wxd_GraphicsPath_t;
+
+// Layout-compatible with wxPoint2DDouble.
+typedef struct {
+    double x;
+    double y;
+} wxd_Point2D;
+
+typedef enum {
+    WXD_GRAPHICS_RENDERER_DEFAULT = 0,
+    WXD_GRAPHICS_RENDERER_DIRECT2D = 1, // MSW only
+    WXD_GRAPHICS_RENDERER_GDIPLUS = 2,  // MSW only
+    WXD_GRAPHICS_RENDERER_CAIRO = 3,
+} wxd_GraphicsRendererKind;
+
+/**
+ * Creates a context drawing on `dc`, which must be a window, paint, client, memory or buffered
+ * paint DC and outlive the context. A renderer that is not available in this build falls back
+ * to the default one. Returns nullptr if the DC type is not supported.
+ */
+WXD_EXPORTED wxd_GraphicsContext_t*
+wxd_GraphicsContext_CreateFromDC(wxd_DC_t* dc, int renderer);
+
+/**
+ * Creates a context drawing into `bitmap` through an internal memory DC. The bitmap must not be
+ * used elsewhere until the context is destroyed, which flushes the drawing into it.
+ */
+WXD_EXPORTED wxd_GraphicsContext_t*
+wxd_GraphicsContext_CreateFromBitmap(wxd_Bitmap_t* bitmap, int renderer);
+
+WXD_EXPORTED void
+wxd_GraphicsContext_Destroy(wxd_GraphicsContext_t* gc);
+
+WXD_EXPORTED void
+wxd_GraphicsContext_Flush(wxd_GraphicsContext_t* gc);
+
+// State
+WXD_EXPORTED void
+wxd_GraphicsContext_SetPen(wxd_GraphicsContext_t* gc, wxd_Colour_t colour, double width,
+                           int style);
+WXD_EXPORTED void
+wxd_GraphicsContext_SetBrush(wxd_GraphicsContext_t* gc, wxd_Colour_t colour, int style);
+WXD_EXPORTED void
+wxd_GraphicsContext_SetFont(wxd_GraphicsContext_t* gc, const wxd_Font_t* font, wxd_Colour_t colour);
+WXD_EXPORTED bool
+wxd_GraphicsContext_SetAntialias(wxd_GraphicsContext_t* gc, bool enable);
+WXD_EXPORTED void
+wxd_GraphicsContext_PushState(wxd_GraphicsContext_t* gc);
+WXD_EXPORTED void
+wxd_GraphicsContext_PopState(wxd_GraphicsContext_t* gc);
+WXD_EXPORTED void
+wxd_GraphicsContext_Translate(wxd_GraphicsContext_t* gc, double dx, double dy);
+WXD_EXPORTED void
+wxd_GraphicsContext_Scale(wxd_GraphicsContext_t* gc, double sx, double sy);
+WXD_EXPORTED void
+wxd_GraphicsContext_Rotate(wxd_GraphicsContext_t* gc, double radians);
+WXD_EXPORTED void
+wxd_GraphicsContext_Clip(wxd_GraphicsContext_t* gc, double x, double y, double w, double h);
+WXD_EXPORTED void
+wxd_GraphicsContext_ResetClip(wxd_GraphicsContext_t* gc);
+
+// Batched primitives
+WXD_EXPORTED void
+wxd_GraphicsContext_StrokeLine(wxd_GraphicsContext_t* gc, double x1, double y1, double x2,
+                               double y2);
+// Connected polyline through `n` points.
+WXD_EXPORTED void
+wxd_GraphicsContext_StrokeLines(wxd_GraphicsContext_t* gc, const wxd_Point2D* points, size_t n);
+// `n` independent segments from begin[i] to end[i].
+WXD_EXPORTED void
+wxd_GraphicsContext_StrokeLineSegments(wxd_GraphicsContext_t* gc, const wxd_Point2D* begin,
+                                       const wxd_Point2D* end, size_t n);
+// Filled and stroked polygon through `n` points.
+WXD_EXPORTED void
+wxd_GraphicsContext_DrawLines(wxd_GraphicsContext_t* gc, const wxd_Point2D* points, size_t n,
+                              int fill_style);
+WXD_EXPORTED void
+wxd_GraphicsContext_DrawRectangle(wxd_GraphicsContext_t* gc, double x, double y, double w,
+                                  double h);
+WXD_EXPORTED void
+wxd_GraphicsContext_DrawRoundedRectangle(wxd_GraphicsContext_t* gc, double x, double y, double w,
+                                         double h, double radius);
+WXD_EXPORTED void
+wxd_GraphicsContext_DrawEllipse(wxd_GraphicsContext_t* gc, double x, double y, double w, double h);
+WXD_EXPORTED void
+wxd_GraphicsContext_DrawText(wxd_GraphicsContext_t* gc, const char* utf8, size_t len, double x,
+                             double y);
+WXD_EXPORTED void
+wxd_GraphicsContext_GetTextExtent(wxd_GraphicsContext_t* gc, const char* utf8, size_t len,
+                                  double* width, double* height);
+WXD_EXPORTED void
+wxd_GraphicsContext_DrawBitmap(wxd_GraphicsContext_t* gc, const wxd_Bitmap_t* bitmap, double x,
+                               double y, double w, double h);
+
+// --- wxGraphicsPath ---
+
+// An empty path usable with `gc` (and other contexts of the same renderer).
+WXD_EXPORTED wxd_GraphicsPath_t*
+wxd_GraphicsPath_Create(wxd_GraphicsContext_t* gc);
+WXD_EXPORTED void
+wxd_GraphicsPath_Destroy(wxd_GraphicsPath_t* path);
+
+WXD_EXPORTED void
+wxd_GraphicsPath_MoveToPoint(wxd_GraphicsPath_t* path, double x, double y);
+WXD_EXPORTED void
+wxd_GraphicsPath_AddLineToPoint(wxd_GraphicsPath_t* path, double x, double y);
+/**
+ * Starts a new subpath at points[0] and adds lines through the rest; `close` closes it.
+ * `n` < 1 is a no-op.
+ */
+WXD_EXPORTED void
+wxd_GraphicsPath_AddLines(wxd_GraphicsPath_t* path, const wxd_Point2D* points, size_t n,
+                          bool close);
+/**
+ * Adds `subpaths` polylines in one call: subpath i is points[offsets[i]..offsets[i + 1]), so
+ * `offsets` holds `subpaths + 1` entries. Out-of-range subpaths are skipped.
+ */
+WXD_EXPORTED void
+wxd_GraphicsPath_AddPolylines(wxd_GraphicsPath_t* path, const wxd_Point2D* points,
+                              size_t point_count, const uint32_t* offsets, size_t subpaths,
+                              bool close);
+WXD_EXPORTED void
+wxd_GraphicsPath_AddRectangle(wxd_GraphicsPath_t* path, double x, double y, double w, double h);
+WXD_EXPORTED void
+wxd_GraphicsPath_AddRoundedRectangle(wxd_GraphicsPath_t* path, double x, double y, double w,
+                                     double h, double radius);
+WXD_EXPORTED void
+wxd_GraphicsPath_AddCircle(wxd_GraphicsPath_t* path, double x, double y, double r);
+WXD_EXPORTED void
+wxd_GraphicsPath_AddEllipse(wxd_GraphicsPath_t* path, double x, double y, double w, double h);
+WXD_EXPORTED void
+wxd_GraphicsPath_AddArc(wxd_GraphicsPath_t* path, double x, double y, double r, double start,
+                        double end, bool clockwise);
+WXD_EXPORTED void
+wxd_GraphicsPath_AddCurveToPoint(wxd_GraphicsPath_t* path, double cx1, double cy1, double cx2,
+                                 double cy2, double x, double y);
+WXD_EXPORTED void
+wxd_GraphicsPath_CloseSubpath(wxd_GraphicsPath_t* path);
+
+WXD_EXPORTED void
+wxd_GraphicsContext_StrokePath(wxd_GraphicsContext_t* gc, const wxd_GraphicsPath_t* path);
+WXD_EXPORTED void
+wxd_GraphicsContext_FillPath(wxd_GraphicsContext_t* gc, const wxd_GraphicsPath_t* path,
+                             int fill_style);
+// Fills, then strokes.
+WXD_EXPORTED void
+wxd_GraphicsContext_DrawPath(wxd_GraphicsContext_t* gc, const wxd_GraphicsPath_t* path,
+                             int fill_style);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // WXD_GRAPHICS_H
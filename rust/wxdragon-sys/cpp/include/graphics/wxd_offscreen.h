@@ -0,0 +1,41 @@
+#ifndef WXD_OFFSCREEN_H
+#define WXD_OFFSCREEN_H
+
+#include "../wxd_types.h"
+
+// --- Offscreen rendering ---
+// An opaque bitmap with a memory DC kept selected, for thumbnails, exports and golden images.
+// Pixels are read straight from the native backing store into the caller's RGBA buffer in one
+// pass, without going through wxImage.
+
+typedef struct wxd_OffscreenSurface_t wxd_OffscreenSurface_t;
+
+// `width` x `height` logical pixels at `scale` (1.0 for plain pixels), initially white.
+WXD_EXPORTED wxd_OffscreenSurface_t*
+wxd_OffscreenSurface_Create(int width, int height, double scale);
+
+WXD_EXPORTED void
+wxd_OffscreenSurface_Destroy(wxd_OffscreenSurface_t* surface);
+
+// The DC drawing into the surface; owned by it.
+WXD_EXPORTED wxd_DC_t*
+wxd_OffscreenSurface_GetDC(wxd_OffscreenSurface_t* surface);
+
+// Size of the pixel data, i.e. the logical size times the scale.
+WXD_EXPORTED wxd_Size
+wxd_OffscreenSurface_GetPixelSize(const wxd_OffscreenSurface_t* surface);
+
+// Copies the pixels as opaque RGBA rows of `stride` bytes (0 for tightly packed) into `dst`,
+// which must hold `stride * height` bytes.
+WXD_EXPORTED bool
+wxd_OffscreenSurface_ReadRGBA(wxd_OffscreenSurface_t* surface, unsigned char* dst, size_t stride);
+
+// Grabs the on-screen content of the window's client area as opaque, tightly packed RGBA.
+// `size` receives the captured size; if `dst_len` is smaller than `size.width * size.height * 4`
+// nothing is copied and false is returned, so callers can size the buffer and retry. Relies on
+// blitting from a wxClientDC, which recent macOS versions do not support.
+WXD_EXPORTED bool
+wxd_Window_CaptureToBuffer(wxd_Window_t* window, unsigned char* dst, size_t dst_len,
+                           wxd_Size* size);
+
+#endif // WXD_OFFSCREEN_H
@@ -0,0 +1,63 @@
+#ifndef WXD_SPATIALINDEX_API_H
+#define WXD_SPATIALINDEX_API_H
+
+#include "../wxd_types.h"
+
+// --- Spatial index ---
+// Bounding boxes with 64-bit ids in a uniform grid, for hit-testing custom-drawn content.
+// Point and rect queries visit only the grid cells they touch. Items inserted later are on top;
+// query results are ordered topmost first. Coordinates are whatever the caller draws in; when
+// attached to a scrolled window, mouse positions are converted to unscrolled coordinates.
+
+typedef struct wxd_SpatialIndex_t wxd_SpatialIndex_t;
+
+// `cell_size` is the grid pitch in pixels (<= 0 for the default of 64); pick about the size of
+// a typical item.
+WXD_EXPORTED wxd_SpatialIndex_t*
+wxd_SpatialIndex_Create(int cell_size);
+
+// Releases the caller's reference; an attached window keeps the index alive until detached.
+WXD_EXPORTED void
+wxd_SpatialIndex_Destroy(wxd_SpatialIndex_t* index);
+
+// Adds `id` on top of all items, or moves an existing `id` to `bounds` and to the top.
+WXD_EXPORTED void
+wxd_SpatialIndex_Insert(wxd_SpatialIndex_t* index, int64_t id, wxd_Rect bounds);
+
+// Moves `id` to `bounds`, keeping its stacking order. Returns false if it is not present.
+WXD_EXPORTED bool
+wxd_SpatialIndex_Update(wxd_SpatialIndex_t* index, int64_t id, wxd_Rect bounds);
+
+WXD_EXPORTED bool
+wxd_SpatialIndex_Remove(wxd_SpatialIndex_t* index, int64_t id);
+
+WXD_EXPORTED void
+wxd_SpatialIndex_Clear(wxd_SpatialIndex_t* index);
+
+WXD_EXPORTED size_t
+wxd_SpatialIndex_GetCount(const wxd_SpatialIndex_t* index);
+
+// The topmost item containing `pt`.
+WXD_EXPORTED bool
+wxd_SpatialIndex_HitTest(const wxd_SpatialIndex_t* index, wxd_Point pt, int64_t* id);
+
+// Items containing `pt` / intersecting `area`, topmost first. Writes at most `capacity` ids to
+// `ids` (which may be null) and returns the total number of matches.
+WXD_EXPORTED size_t
+wxd_SpatialIndex_QueryPoint(const wxd_SpatialIndex_t* index, wxd_Point pt, int64_t* ids,
+                            size_t capacity);
+
+WXD_EXPORTED size_t
+wxd_SpatialIndex_QueryRect(const wxd_SpatialIndex_t* index, wxd_Rect area, int64_t* ids,
+                           size_t capacity);
+
+// Tracks the mouse over `window` and sends WXD_EVENT_TYPE_SPATIAL_HOVER_CHANGED to it whenever
+// the topmost item under the pointer changes, without a callback per motion event. Replaces any
+// index previously attached to the window.
+WXD_EXPORTED void
+wxd_SpatialIndex_AttachToWindow(wxd_SpatialIndex_t* index, wxd_Window_t* window);
+
+WXD_EXPORTED void
+wxd_SpatialIndex_DetachFromWindow(wxd_Window_t* window);
+
+#endif // WXD_SPATIALINDEX_API_H
@@ -18,4 +18,22 @@ wxd_AnimationCtrl_LoadFile(wxd_AnimationCtrl_t* self, const char* animation_file
 WXD_EXPORTED bool
 wxd_AnimationCtrl_LoadFromBytes(wxd_AnimationCtrl_t* self, const unsigned char* data, size_t len);
 
+// --- Shared animations ---
+// Decoded once and shown by any number of controls, all advanced by one timer. Controls keep
+// their own reference, so the handle may be destroyed while they still show it.
+WXD_EXPORTED wxd_Animation_t*
+wxd_Animation_CreateFromBytes(const unsigned char* data, size_t len);
+WXD_EXPORTED wxd_Animation_t*
+wxd_Animation_CreateFromFile(const char* path);
+WXD_EXPORTED void
+wxd_Animation_Destroy(wxd_Animation_t* animation);
+WXD_EXPORTED int
+wxd_Animation_GetFrameCount(const wxd_Animation_t* animation);
+WXD_EXPORTED wxd_Size
+wxd_Animation_GetSize(const wxd_Animation_t* animation);
+// Shows `animation` in the control; Play and Stop then join or leave the shared playback.
+// NULL detaches it again. LoadFile and LoadFromBytes also detach.
+WXD_EXPORTED void
+wxd_AnimationCtrl_SetSharedAnimation(wxd_AnimationCtrl_t* self, const wxd_Animation_t* animation);
+
 #endif // WXD_ANIMATIONCTRL_H
\ No newline at end of file
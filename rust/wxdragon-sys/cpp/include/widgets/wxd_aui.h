@@ -51,6 +51,70 @@ wxd_AuiManager_LoadPerspective(wxd_AuiManager_t* self, const char* perspective,
 WXD_EXPORTED bool
 wxd_AuiManager_DetachPane(wxd_AuiManager_t* self, wxd_Window_t* window);
 
+// --- Batched pane changes ---
+
+// Fields of wxd_AuiPaneChange to apply; others are ignored.
+#define WXD_AUI_PANE_CHANGE_SHOW      (1u << 0) // show
+#define WXD_AUI_PANE_CHANGE_DIRECTION (1u << 1) // direction (WXD_AUI_DOCK_* as in AddPane)
+#define WXD_AUI_PANE_CHANGE_LAYER     (1u << 2) // layer
+#define WXD_AUI_PANE_CHANGE_ROW       (1u << 3) // row
+#define WXD_AUI_PANE_CHANGE_POSITION  (1u << 4) // position
+#define WXD_AUI_PANE_CHANGE_BEST_SIZE (1u << 5) // width / height
+#define WXD_AUI_PANE_CHANGE_FLOAT     (1u << 6) // float_x / float_y (float_width / float_height if > 0)
+#define WXD_AUI_PANE_CHANGE_DOCK      (1u << 7) // dock a floating pane back
+#define WXD_AUI_PANE_CHANGE_CAPTION   (1u << 8) // caption
+
+// One pane mutation. The pane is looked up by `window` if set, otherwise by `name`.
+typedef struct {
+    wxd_Window_t* window;
+    const char* name;
+    uint32_t fields;
+    bool show;
+    int direction;
+    int layer;
+    int row;
+    int position;
+    int width;
+    int height;
+    int float_x;
+    int float_y;
+    int float_width;
+    int float_height;
+    const char* caption;
+} wxd_AuiPaneChange;
+
+/**
+ * Applies `count` pane changes and, if `update` is true and any pane actually changed, lays out
+ * and repaints once with the managed window frozen. Changes that leave a pane as it was cost no
+ * layout. Returns the number of panes whose info changed, or -1 on invalid arguments.
+ */
+WXD_EXPORTED int
+wxd_AuiManager_ApplyPaneChanges(wxd_AuiManager_t* self, const wxd_AuiPaneChange* changes,
+                                size_t count, bool update);
+
+/**
+ * Like wxd_AuiManager_LoadPerspective, but parsed perspectives are cached per manager, so
+ * switching among a few saved layouts parses each string once. Panes whose info and dock sizes
+ * already match the perspective are left untouched, and if nothing differs no layout happens
+ * at all; otherwise a single frozen Update is done when `update` is true.
+ */
+WXD_EXPORTED bool
+wxd_AuiManager_LoadPerspectiveCached(wxd_AuiManager_t* self, const char* perspective,
+                                     bool update);
+
+WXD_EXPORTED void
+wxd_AuiManager_ClearPerspectiveCache(wxd_AuiManager_t* self);
+
+/**
+ * Sets how dock sash drags update the layout (wxd_LiveResizeMode). THROTTLED turns on live
+ * resize but lays out at most once per `interval_ms` (0 = 16), always ending on the final
+ * position. SNAPSHOT turns live resize off, so the drag only moves the sash hint and the layout
+ * is done once on release. NATIVE drops the throttle and leaves the manager flags as they are.
+ * Requires a managed window.
+ */
+WXD_EXPORTED bool
+wxd_AuiManager_SetLiveResizeMode(wxd_AuiManager_t* self, int mode, uint32_t interval_ms);
+
 // --- wxAuiPaneInfo ---
 WXD_EXPORTED wxd_AuiPaneInfo_t*
 wxd_AuiPaneInfo_Create();
@@ -156,6 +220,23 @@ WXD_EXPORTED wxd_AuiMDIChildFrame_t*
 wxd_AuiMDIChildFrame_Create(wxd_AuiMDIParentFrame_t* parent, int id, const char* title,
                             wxd_Point pos, wxd_Size size, int64_t style, const char* name);
 
+// Shared menubars: one menubar per document type, built once and owned by the parent frame.
+// A child using a type gets no menubar of its own; activating it swaps the type's menubar onto
+// the frame, and with no such child active the frame's own menubar is back. Menu commands still
+// reach the active child first. State that differs per document (checks, enabling) belongs in
+// update-UI handlers, as the items are shared. Children with a menubar of their own should not be
+// mixed with shared ones in one frame.
+// Takes ownership of `menubar`; one registered earlier under `key` is deleted.
+WXD_EXPORTED bool
+wxd_AuiMDIParentFrame_RegisterMenuBar(wxd_AuiMDIParentFrame_t* self, const char* key,
+                                      wxd_MenuBar_t* menubar);
+// The menubar registered under `key`, or NULL; owned by the frame.
+WXD_EXPORTED wxd_MenuBar_t*
+wxd_AuiMDIParentFrame_GetSharedMenuBar(wxd_AuiMDIParentFrame_t* self, const char* key);
+// Makes the child use the menubar of `key`, which may be registered later.
+WXD_EXPORTED bool
+wxd_AuiMDIChildFrame_UseSharedMenuBar(wxd_AuiMDIChildFrame_t* self, const char* key);
+
 // Potentially other wxAuiMDIChildFrame specific functions will be added here.
 
 // --- wxAuiNotebook ---
@@ -200,6 +281,58 @@ wxd_AuiNotebook_GetPageText(wxd_AuiNotebook_t* self, size_t page_idx, char* buff
 WXD_EXPORTED bool
 wxd_AuiNotebook_SetPageText(wxd_AuiNotebook_t* self, size_t page_idx, const char* text);
 
+// --- Virtual tabs ---
+//
+// For notebooks holding hundreds of documents. Each virtual tab is a lazy page (see
+// wxd_bookctrl.h, lazy pages must be enabled first) identified by a key; its label and icon are
+// asked from a callback only once the tab scrolls into a visible part of a tab strip, and its
+// content is only built when selected.
+
+// Label of a virtual tab, filled in by the callback. `text` (UTF-8, `text_len` bytes) and
+// `bitmap` are copied right after the callback returns and only need to stay valid until its
+// next call; `bitmap` may be NULL.
+typedef struct {
+    const char* text;
+    size_t text_len;
+    const wxd_Bitmap_t* bitmap;
+} wxd_AuiVirtualTabLabel;
+
+// Returns false to leave the tab label empty.
+typedef bool (*wxd_auinotebook_tab_label_callback)(void* userdata, int64_t key,
+                                                    wxd_AuiVirtualTabLabel* label);
+typedef void (*wxd_auinotebook_free_userdata_callback)(void* userdata);
+
+// Replaces any previous label callback; `free_userdata` runs when replaced, disabled or the
+// notebook is destroyed.
+WXD_EXPORTED bool
+wxd_AuiNotebook_EnableVirtualTabs(wxd_AuiNotebook_t* self, void* userdata,
+                                  wxd_auinotebook_tab_label_callback callback,
+                                  wxd_auinotebook_free_userdata_callback free_userdata);
+// Tabs keep the labels they already resolved.
+WXD_EXPORTED void
+wxd_AuiNotebook_DisableVirtualTabs(wxd_AuiNotebook_t* self);
+
+// Appends one placeholder tab per key, skipping keys already present, with a single layout at
+// the end. Returns the number of tabs added.
+WXD_EXPORTED size_t
+wxd_AuiNotebook_AppendVirtualTabs(wxd_AuiNotebook_t* self, const int64_t* keys, size_t count);
+
+// Page window of the virtual tab `key` (constant time), or NULL.
+WXD_EXPORTED wxd_Window_t*
+wxd_AuiNotebook_GetVirtualTabPage(wxd_AuiNotebook_t* self, int64_t key);
+
+// Index of the virtual tab `key`, or -1.
+WXD_EXPORTED int
+wxd_AuiNotebook_FindVirtualTab(wxd_AuiNotebook_t* self, int64_t key);
+
+// Selects the virtual tab `key`, building its content. False if there is no such tab.
+WXD_EXPORTED bool
+wxd_AuiNotebook_SelectVirtualTab(wxd_AuiNotebook_t* self, int64_t key);
+
+// Asks the callback again for the label of `key` next time it is visible.
+WXD_EXPORTED void
+wxd_AuiNotebook_InvalidateVirtualTab(wxd_AuiNotebook_t* self, int64_t key);
+
 
 // --- wxAuiToolBar ---
 WXD_EXPORTED wxd_AuiToolBar_t*
@@ -268,6 +401,19 @@ wxd_AuiToolBar_ClearTools(wxd_AuiToolBar_t* self);
 WXD_EXPORTED bool
 wxd_AuiToolBar_DeleteTool(wxd_AuiToolBar_t* self, int tool_id);
 
+// Adds `count` tools (see wxd_ToolDesc) and realizes the toolbar once. Returns the number added.
+WXD_EXPORTED size_t
+wxd_AuiToolBar_AddTools(wxd_AuiToolBar_t* self, const wxd_ToolDesc* tools, size_t count);
+
+// Shows or hides tools like wxd_ToolBar_SetToolsVisible: only changed tools move, a shown tool
+// returns to its place, and the toolbar is realized once. Returns the number of tools changed.
+WXD_EXPORTED size_t
+wxd_AuiToolBar_SetToolsVisible(wxd_AuiToolBar_t* self, const int* ids, const bool* visible,
+                               size_t count);
+
+WXD_EXPORTED bool
+wxd_AuiToolBar_IsToolVisible(wxd_AuiToolBar_t* self, int tool_id);
+
 #ifdef __cplusplus
 }
 #endif
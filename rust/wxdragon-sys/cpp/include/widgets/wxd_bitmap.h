@@ -29,6 +29,122 @@ wxd_Bitmap_GetRGBAData(const wxd_Bitmap_t* bitmap, size_t* width, size_t* height
 WXD_EXPORTED void
 wxd_Bitmap_FreeRGBAData(unsigned char* data);
 
+// --- In-place pixel access ---
+
+typedef struct wxd_BitmapPixels_t wxd_BitmapPixels_t;
+
+// The native backing store of a locked bitmap. Row y starts at `pixels + y * stride`; the
+// stride may be negative (bottom-up DIBs on MSW). `red` .. `alpha` are byte offsets within a
+// pixel, `alpha` is -1 without an alpha channel. With `premultiplied`, colour bytes must be
+// stored multiplied by alpha.
+typedef struct {
+    uint8_t* pixels;
+    int32_t width;
+    int32_t height;
+    int32_t stride;
+    int32_t bytes_per_pixel;
+    int32_t red;
+    int32_t green;
+    int32_t blue;
+    int32_t alpha;
+    bool premultiplied;
+} wxd_BitmapPixelLayout;
+
+/**
+ * Locks the pixels of `bitmap` for direct writing, through wxAlphaPixelData if `withAlpha` (the
+ * bitmap must be 32 bpp) or wxNativePixelData otherwise, and fills `layout`. Returns nullptr if
+ * the bitmap cannot be accessed that way. Changes are visible after wxd_Bitmap_UnlockPixels;
+ * the bitmap must not be drawn or destroyed while locked. Clones share the pixels.
+ */
+WXD_EXPORTED wxd_BitmapPixels_t*
+wxd_Bitmap_LockPixels(wxd_Bitmap_t* bitmap, bool withAlpha, wxd_BitmapPixelLayout* layout);
+
+WXD_EXPORTED void
+wxd_Bitmap_UnlockPixels(wxd_BitmapPixels_t* pixels);
+
+/**
+ * Overwrites the pixels of `bitmap` with straight (not premultiplied) RGBA rows of the same
+ * size, `stride` bytes apart (0 for tightly packed), converting to the native format row by
+ * row without reallocating the bitmap. The alpha byte is ignored for bitmaps without alpha.
+ * Returns false if the bitmap's pixels cannot be accessed.
+ */
+WXD_EXPORTED bool
+wxd_Bitmap_UpdateFromRGBA(wxd_Bitmap_t* bitmap, const unsigned char* data, size_t stride);
+
+// Byte order of a 32-bit pixel in memory. The premultiplied variants store colour multiplied
+// by alpha, as Direct2D / GDI DIBs, CoreGraphics and tiny-skia do.
+typedef enum {
+    WXD_PIXEL_FORMAT_RGBA = 0,
+    WXD_PIXEL_FORMAT_BGRA = 1,
+    WXD_PIXEL_FORMAT_ARGB = 2,
+    WXD_PIXEL_FORMAT_RGBA_PREMULTIPLIED = 3,
+    WXD_PIXEL_FORMAT_BGRA_PREMULTIPLIED = 4,
+    WXD_PIXEL_FORMAT_ARGB_PREMULTIPLIED = 5
+} wxd_PixelFormat;
+
+// The format of this platform's 32 bpp bitmaps; data in it is copied without conversion.
+WXD_EXPORTED wxd_PixelFormat
+wxd_Bitmap_GetNativePixelFormat(void);
+
+/**
+ * Creates a 32 bpp bitmap with alpha from `height` rows of `width` pixels in `format`,
+ * `stride` bytes apart (0 for tightly packed). Rows already in the native format are copied
+ * straight into the bitmap's backing store, skipping the wxImage round trip of
+ * wxd_Bitmap_CreateFromRGBA; other formats are converted once. Returns nullptr on failure.
+ */
+WXD_EXPORTED wxd_Bitmap_t*
+wxd_Bitmap_CreateFromNative(const unsigned char* data, int width, int height, size_t stride,
+                            wxd_PixelFormat format);
+
+// --- Resampling ---
+
+typedef enum {
+    WXD_RESIZE_NEAREST = 0,
+    WXD_RESIZE_BOX = 1,      // Area average; the cheapest filter that does not alias when shrinking
+    WXD_RESIZE_BILINEAR = 2,
+    WXD_RESIZE_BICUBIC = 3   // Catmull-Rom; sharpest
+} wxd_ResizeQuality;
+
+/**
+ * Resizes tightly packed straight RGBA `src` into `dst` (dst_width * dst_height * 4 bytes).
+ * Filtering is done on premultiplied colour, so transparent pixels do not bleed dark fringes,
+ * and uses SSE2 / NEON where available. Touches no GUI state and may run on any thread. Returns
+ * false if a size is not positive.
+ */
+WXD_EXPORTED bool
+wxd_Image_ResizeRGBA(const unsigned char* src, int src_width, int src_height, unsigned char* dst,
+                     int dst_width, int dst_height, wxd_ResizeQuality quality);
+
+// --- Off-thread decoding ---
+
+// A decoded, not yet converted image. Holds no GUI resources, so it may be created, moved and
+// destroyed on any thread.
+typedef struct wxd_DecodedImage_t wxd_DecodedImage_t;
+
+/**
+ * Decodes PNG, JPEG, GIF, ... `bytes` with the registered wxImage handlers and, when `max_size`
+ * has a positive width and height, downscales the result to fit inside it keeping the aspect
+ * ratio. Safe to call on worker threads (e.g. from a wxd_WorkerPool job). Returns nullptr if
+ * the data cannot be decoded.
+ */
+WXD_EXPORTED wxd_DecodedImage_t*
+wxd_DecodedImage_Decode(const unsigned char* bytes, size_t len, wxd_Size max_size);
+
+// As wxd_DecodedImage_Decode, downscaling with the given filter (Decode uses bicubic).
+WXD_EXPORTED wxd_DecodedImage_t*
+wxd_DecodedImage_DecodeScaled(const unsigned char* bytes, size_t len, wxd_Size max_size,
+                              wxd_ResizeQuality quality);
+
+WXD_EXPORTED wxd_Size
+wxd_DecodedImage_GetSize(const wxd_DecodedImage_t* image);
+
+// Converts to a bitmap (with alpha if the image has any). Main thread only.
+WXD_EXPORTED wxd_Bitmap_t*
+wxd_DecodedImage_ToBitmap(const wxd_DecodedImage_t* image);
+
+WXD_EXPORTED void
+wxd_DecodedImage_Destroy(wxd_DecodedImage_t* image);
+
 // Get a pointer to wxNullBitmap
 WXD_EXPORTED const wxd_Bitmap_t*
 wxd_Bitmap_GetNull(void);
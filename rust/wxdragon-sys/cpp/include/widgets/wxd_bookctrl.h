@@ -0,0 +1,58 @@
+#ifndef WXD_BOOKCTRL_H
+#define WXD_BOOKCTRL_H
+
+#include "../wxd_types.h"
+
+// --- Lazily built pages ---
+//
+// Works on any book control (Notebook, AuiNotebook, Treebook, Simplebook). A lazy page is an
+// empty placeholder panel carrying a Rust key; its content is built by a callback the first
+// time the page is about to be shown (page-changing event, or when it is already the current
+// page on insertion), so startup only pays for the pages actually visited.
+
+// Builds the content of page `key` as children of `placeholder`. If the callback leaves the
+// placeholder without a sizer and creates exactly one child, that child is stretched to fill it.
+typedef void (*wxd_bookctrl_lazy_page_callback)(void* userdata, int64_t key,
+                                                wxd_Window_t* placeholder);
+typedef void (*wxd_bookctrl_free_userdata_callback)(void* userdata);
+
+/**
+ * Turns on lazy pages for `book`. With `maxRealizedPages` > 0, once more than that many lazy
+ * pages hold content, the least recently viewed ones that have not been shown for at least
+ * `minIdleMs` are emptied again (their children destroyed) and rebuilt when next selected.
+ * The current page is never emptied. `free_userdata` runs when replaced, disabled or the book
+ * is destroyed.
+ */
+WXD_EXPORTED bool
+wxd_BookCtrl_EnableLazyPages(wxd_Window_t* book, void* userdata,
+                             wxd_bookctrl_lazy_page_callback callback,
+                             wxd_bookctrl_free_userdata_callback free_userdata,
+                             size_t maxRealizedPages, int minIdleMs);
+// Lazy pages already added stay placeholders until realized explicitly.
+WXD_EXPORTED void
+wxd_BookCtrl_DisableLazyPages(wxd_Window_t* book);
+
+// Inserts a lazy page at `index` (appends when index >= page count) and returns its
+// placeholder, or NULL if lazy pages are not enabled. `imageId` -1 means no image.
+WXD_EXPORTED wxd_Window_t*
+wxd_BookCtrl_InsertLazyPage(wxd_Window_t* book, size_t index, const char* text, bool select,
+                            int imageId, int64_t key);
+
+// Builds the content of the lazy page at `index` now, e.g. before ChangeSelection, which sends
+// no page-changing event. False if the page is not lazy; true if it already had content.
+WXD_EXPORTED bool
+wxd_BookCtrl_RealizeLazyPage(wxd_Window_t* book, size_t index);
+
+// Empties the lazy page at `index` so it is rebuilt the next time it is shown.
+WXD_EXPORTED bool
+wxd_BookCtrl_UnloadLazyPage(wxd_Window_t* book, size_t index);
+
+// 1 if the lazy page at `index` has content, 0 if it is still a placeholder, -1 if not lazy.
+WXD_EXPORTED int
+wxd_BookCtrl_GetLazyPageState(wxd_Window_t* book, size_t index);
+
+// False if the page at `index` is not lazy.
+WXD_EXPORTED bool
+wxd_BookCtrl_GetLazyPageKey(wxd_Window_t* book, size_t index, int64_t* key);
+
+#endif // WXD_BOOKCTRL_H
@@ -7,6 +7,32 @@
 extern "C" {
 #endif
 
+// Border drawn around a day.
+typedef enum {
+    WXD_CAL_BORDER_NONE = 0,
+    WXD_CAL_BORDER_SQUARE = 1,
+    WXD_CAL_BORDER_ROUND = 2,
+} wxd_CalendarDateBorder;
+
+// Look of one day. A zeroed attribute is the default look. Native controls may only show some
+// of it (typically holiday and bold); the generic control shows all of it.
+typedef struct {
+    bool has_text_colour;
+    wxd_Colour_t text_colour;
+    bool has_bg_colour;
+    wxd_Colour_t bg_colour;
+    bool has_border_colour;
+    wxd_Colour_t border_colour;
+    int32_t border; // wxd_CalendarDateBorder
+    bool holiday;
+    bool bold;
+} wxd_CalendarDayAttr;
+
+// Fills `attrs` (31 zeroed entries, day 1 first) for `month` (1-12) of `year` and returns true,
+// or returns false to leave the month's days at the default look.
+typedef bool (*wxd_CalendarMonthAttrsCallback)(void* user_data, int32_t year, int32_t month,
+                                               wxd_CalendarDayAttr* attrs);
+
 WXD_EXPORTED wxd_CalendarCtrl_t*
 wxd_CalendarCtrl_Create(wxd_Window_t* parent, wxd_Id id, const wxd_DateTime_t* date, wxd_Point pos,
                         wxd_Size size, wxd_Style_t style);
@@ -19,6 +45,31 @@ wxd_CalendarCtrl_GetDate(
     wxd_CalendarCtrl_t*
         self); // Changed return to wxd_DateTime_t* to match C++ impl style (heap allocated)
 
+/**
+ * Store the day attributes of `month` (1-12) of `year`: `attrs` holds 31 entries, day 1 first,
+ * and entries past the month's last day are ignored. NULL forgets the month. Whenever the
+ * control's date moves to a stored month, all its days are set in one frozen pass; if the month
+ * is the one shown, that happens now. Returns false for an invalid month.
+ */
+WXD_EXPORTED bool
+wxd_CalendarCtrl_SetMonthAttrs(wxd_CalendarCtrl_t* self, int32_t year, int32_t month,
+                               const wxd_CalendarDayAttr* attrs);
+
+/**
+ * Ask `provider` for the day attributes of each month without stored attributes, when that
+ * month comes up, and for the month shown now. NULL removes the provider. The control owns
+ * `user_data` and passes it to `free_user_data`, if set, when the provider is replaced or the
+ * control is destroyed.
+ */
+WXD_EXPORTED bool
+wxd_CalendarCtrl_SetMonthAttrsProvider(wxd_CalendarCtrl_t* self,
+                                       wxd_CalendarMonthAttrsCallback provider, void* user_data,
+                                       void (*free_user_data)(void*));
+
+/** Apply the shown month's attributes again, asking the provider anew. */
+WXD_EXPORTED void
+wxd_CalendarCtrl_RefreshMonthAttrs(wxd_CalendarCtrl_t* self);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,39 @@
+#ifndef WXD_CANVAS_H
+#define WXD_CANVAS_H
+
+#include "../wxd_types.h"
+
+// --- Retained canvas ---
+// A window that keeps its content in a backing bitmap. Only invalidated areas are redrawn: the
+// renderer draws into the backing store with clipping set to the dirty region, and every paint
+// blits the backing store, so repaint cost is proportional to what changed.
+
+typedef struct wxd_Canvas wxd_Canvas_t;
+
+// `dc` draws into the backing store, clipped to the dirty region (already filled with the
+// background colour); `dirty` is its bounding box in client coordinates.
+typedef void (*wxd_Canvas_RenderCallback)(void* user_data, wxd_DC_t* dc, wxd_Rect dirty);
+typedef void (*wxd_Canvas_FreeUserData)(void* user_data);
+
+WXD_EXPORTED wxd_Canvas_t*
+wxd_Canvas_Create(wxd_Window_t* parent, int id, int x, int y, int w, int h, int64_t style);
+
+// Sets the renderer, freeing the previous user data; `free_user_data` also runs when the canvas
+// is destroyed. Invalidates the whole canvas.
+WXD_EXPORTED void
+wxd_Canvas_SetRenderer(wxd_Canvas_t* self, wxd_Canvas_RenderCallback render, void* user_data,
+                       wxd_Canvas_FreeUserData free_user_data);
+
+// Marks `rect` (client coordinates) for redrawing at the next paint.
+WXD_EXPORTED void
+wxd_Canvas_Invalidate(wxd_Canvas_t* self, wxd_Rect rect);
+
+WXD_EXPORTED void
+wxd_Canvas_InvalidateAll(wxd_Canvas_t* self);
+
+// Moves the retained content by (dx, dy) and invalidates only the uncovered strips, e.g. when
+// the view scrolls.
+WXD_EXPORTED void
+wxd_Canvas_ScrollBuffer(wxd_Canvas_t* self, int dx, int dy);
+
+#endif // WXD_CANVAS_H
@@ -11,6 +11,15 @@ WXD_EXPORTED void
 wxd_CheckListBox_Append(wxd_CheckListBox_t* clbox, const char* item);
 WXD_EXPORTED void
 wxd_CheckListBox_Insert(wxd_CheckListBox_t* clbox, const char* item, unsigned int pos);
+// Replaces / extends the items with `count` packed UTF-8 strings in one native call: string i
+// is packed[offsets[i]..offsets[i + 1]), so `offsets` holds count + 1 entries. Returns false on
+// malformed offsets.
+WXD_EXPORTED bool
+wxd_CheckListBox_SetItems(wxd_CheckListBox_t* clbox, const char* packed, const uint32_t* offsets,
+                          size_t count);
+WXD_EXPORTED bool
+wxd_CheckListBox_AppendItems(wxd_CheckListBox_t* clbox, const char* packed, const uint32_t* offsets,
+                             size_t count);
 WXD_EXPORTED void
 wxd_CheckListBox_Clear(wxd_CheckListBox_t* clbox);
 WXD_EXPORTED int
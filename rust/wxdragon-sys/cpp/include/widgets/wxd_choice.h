@@ -10,6 +10,15 @@ WXD_EXPORTED void
 wxd_Choice_Append(wxd_Choice_t* self, const char* item);
 WXD_EXPORTED void
 wxd_Choice_Insert(wxd_Choice_t* self, const char* item, unsigned int pos);
+// Replaces / extends the items with `count` packed UTF-8 strings in one native call: string i
+// is packed[offsets[i]..offsets[i + 1]), so `offsets` holds count + 1 entries. Returns false on
+// malformed offsets.
+WXD_EXPORTED bool
+wxd_Choice_SetItems(wxd_Choice_t* choice, const char* packed, const uint32_t* offsets,
+                    size_t count);
+WXD_EXPORTED bool
+wxd_Choice_AppendItems(wxd_Choice_t* choice, const char* packed, const uint32_t* offsets,
+                       size_t count);
 WXD_EXPORTED void
 wxd_Choice_Clear(wxd_Choice_t* choice);
 WXD_EXPORTED int
@@ -11,6 +11,15 @@ WXD_EXPORTED void
 wxd_ComboBox_Append(wxd_ComboBox_t* combo, const char* item);
 WXD_EXPORTED void
 wxd_ComboBox_Insert(wxd_ComboBox_t* combo, const char* item, unsigned int pos);
+// Replaces / extends the items with `count` packed UTF-8 strings in one native call: string i
+// is packed[offsets[i]..offsets[i + 1]), so `offsets` holds count + 1 entries. Returns false on
+// malformed offsets.
+WXD_EXPORTED bool
+wxd_ComboBox_SetItems(wxd_ComboBox_t* combo, const char* packed, const uint32_t* offsets,
+                      size_t count);
+WXD_EXPORTED bool
+wxd_ComboBox_AppendItems(wxd_ComboBox_t* combo, const char* packed, const uint32_t* offsets,
+                         size_t count);
 WXD_EXPORTED void
 wxd_ComboBox_Clear(wxd_ComboBox_t* combo);
 WXD_EXPORTED int
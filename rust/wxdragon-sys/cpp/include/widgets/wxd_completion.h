@@ -0,0 +1,62 @@
+#ifndef WXD_COMPLETION_H
+#define WXD_COMPLETION_H
+
+#include "../wxd_types.h"
+
+// --- Indexed autocompletion for text entries ---
+//
+// A sorted prefix index of strings that drives the native autocompletion popup of a TextCtrl,
+// ComboBox or SearchCtrl. Rust loads it once in bulk and patches it incrementally; every
+// keystroke is answered natively with the first `max_results` matches in sorted order, without
+// calling back into Rust. One index can serve several controls and may be updated while
+// attached. Entries are UTF-8 and passed packed: string i is packed[offsets[i]..offsets[i + 1]),
+// so `offsets` holds count + 1 entries.
+
+// `max_results` of 0 selects 100.
+WXD_EXPORTED wxd_CompletionIndex_t*
+wxd_CompletionIndex_Create(bool case_sensitive, uint32_t max_results);
+
+// Releases the caller's reference; controls the index is attached to keep using it.
+WXD_EXPORTED void
+wxd_CompletionIndex_Destroy(wxd_CompletionIndex_t* index);
+
+// Replaces all entries. Duplicates are stored once. Returns false on malformed offsets.
+WXD_EXPORTED bool
+wxd_CompletionIndex_SetEntries(wxd_CompletionIndex_t* index, const char* packed,
+                               const uint32_t* offsets, size_t count);
+
+// Adds entries not already present, merging them into the sorted order.
+WXD_EXPORTED bool
+wxd_CompletionIndex_AddEntries(wxd_CompletionIndex_t* index, const char* packed,
+                               const uint32_t* offsets, size_t count);
+
+// Removes the given entries (exact matches) if present.
+WXD_EXPORTED bool
+wxd_CompletionIndex_RemoveEntries(wxd_CompletionIndex_t* index, const char* packed,
+                                  const uint32_t* offsets, size_t count);
+
+WXD_EXPORTED void
+wxd_CompletionIndex_Clear(wxd_CompletionIndex_t* index);
+
+WXD_EXPORTED size_t
+wxd_CompletionIndex_GetCount(const wxd_CompletionIndex_t* index);
+
+WXD_EXPORTED void
+wxd_CompletionIndex_SetMaxResults(wxd_CompletionIndex_t* index, uint32_t max_results);
+
+// Writes the matches for `prefix` into `out` (cleared first) and returns their number; the same
+// query the controls run per keystroke.
+WXD_EXPORTED size_t
+wxd_CompletionIndex_Query(const wxd_CompletionIndex_t* index, const char* prefix,
+                          wxd_ArrayString_t* out);
+
+// Attaches `index` as the control's completer, replacing any previous one; NULL turns
+// autocompletion off. Returns false if the control does not support completion.
+WXD_EXPORTED bool
+wxd_TextCtrl_SetCompletionIndex(wxd_TextCtrl_t* ctrl, wxd_CompletionIndex_t* index);
+WXD_EXPORTED bool
+wxd_ComboBox_SetCompletionIndex(wxd_ComboBox_t* ctrl, wxd_CompletionIndex_t* index);
+WXD_EXPORTED bool
+wxd_SearchCtrl_SetCompletionIndex(wxd_SearchCtrl_t* ctrl, wxd_CompletionIndex_t* index);
+
+#endif // WXD_COMPLETION_H
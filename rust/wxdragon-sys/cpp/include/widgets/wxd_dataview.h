@@ -117,6 +117,49 @@ wxd_DataViewCtrl_GetNthChild(wxd_Window_t* self, const wxd_DataViewItem_t* paren
                              unsigned int pos);
 WXD_EXPORTED void
 wxd_DataViewCtrl_Expand(wxd_Window_t* self, const wxd_DataViewItem_t* item);
+// Expands all `items` under one freeze, ancestors before descendants, so restoring a saved
+// expansion state lays the control out once. Invalid and already expanded items are skipped.
+WXD_EXPORTED void
+wxd_DataViewCtrl_ExpandItems(wxd_Window_t* self, const wxd_DataViewItem_t* const* items,
+                             size_t count);
+// Writes up to `capacity` ids of expanded items (parents before children) to `ids` and
+// returns how many there are. 0 for list models.
+WXD_EXPORTED size_t
+wxd_DataViewCtrl_GetExpandedItems(wxd_Window_t* self, void** ids, size_t capacity);
+
+// --- Sampled Auto-Sizing ---
+// Measures only the selected displayed rows (for tree models: rows reachable through expanded
+// nodes) instead of every row, plus the column title. Returns the width applied, or -1.
+WXD_EXPORTED int
+wxd_DataViewCtrl_AutoSizeColumnSampled(wxd_Window_t* self, wxd_DataViewColumn_t* column,
+                                       const wxd_DataViewAutoSizeSample* sample);
+// All shown columns, from one sample of rows and under one freeze.
+WXD_EXPORTED void
+wxd_DataViewCtrl_AutoSizeColumnsSampled(wxd_Window_t* self,
+                                        const wxd_DataViewAutoSizeSample* sample);
+
+// --- Column Projection ---
+// Keeps the projection of the control's custom virtual list model at the columns in view: the
+// shown columns of nonzero width, and with the generic control only those inside the
+// horizontally scrolled area. Follows resizing, scrolling and column reordering; call Update
+// after changing column widths or visibility. Disabling projects every column again.
+WXD_EXPORTED bool
+wxd_DataViewCtrl_EnableColumnProjection(wxd_Window_t* self, bool enable);
+WXD_EXPORTED void
+wxd_DataViewCtrl_UpdateColumnProjection(wxd_Window_t* self);
+
+// --- Export ---
+// Formats the displayed rows (or only the selected ones) of the shown columns as delimited
+// text, values as their string form and the header from the column titles. Returns NULL on
+// error; free with wxd_String_Free.
+WXD_EXPORTED wxd_String_t*
+wxd_DataViewCtrl_ExportRows(wxd_Window_t* self, bool selected_only,
+                            const wxd_TableExportFormat* format);
+// Same, handing the text to `write` in chunks; false on error or if `write` returned false.
+WXD_EXPORTED bool
+wxd_DataViewCtrl_ExportRowsTo(wxd_Window_t* self, bool selected_only,
+                              const wxd_TableExportFormat* format,
+                              wxd_table_export_write_fn write, void* userdata);
 WXD_EXPORTED void
 wxd_DataViewCtrl_EnsureVisible(wxd_Window_t* self, const wxd_DataViewItem_t* item);
 
@@ -187,6 +230,30 @@ WXD_EXPORTED bool
 wxd_DataViewListModel_SetValue(wxd_DataViewModel_t* self, size_t row, size_t col,
                                const wxd_Variant_t* variant);
 
+/**
+ * One column of a packed row batch: `data` points to `rows` values of `kind` (bool, int64_t or
+ * double), or for WXD_VARIANT_VALUE_STRING to UTF-8 bytes split by `offsets` (rows + 1 byte
+ * offsets). A WXD_VARIANT_VALUE_NULL column leaves its cells empty.
+ */
+typedef struct {
+    wxd_VariantValueKind kind;
+    const void* data;
+    const uint32_t* offsets;
+} wxd_DataViewPackedColumn;
+
+/**
+ * Bulk appends: `values` holds rows * cols variant pointers in row-major order (NULL entries
+ * stay empty). The control is notified once, by a model reset, so the selection is cleared and
+ * items held from before are renumbered. Returns false on malformed input, with nothing added.
+ */
+WXD_EXPORTED bool
+wxd_DataViewListModel_AppendRows(wxd_DataViewModel_t* self, const wxd_Variant_t* const* values,
+                                 size_t rows, uint32_t cols);
+WXD_EXPORTED bool
+wxd_DataViewListModel_AppendRowsPacked(wxd_DataViewModel_t* self,
+                                       const wxd_DataViewPackedColumn* columns, uint32_t cols,
+                                       size_t rows);
+
 // Selection management
 WXD_EXPORTED bool
 wxd_DataViewCtrl_SelectRow(wxd_Window_t* self, int64_t row);
@@ -215,6 +282,18 @@ wxd_DataViewVirtualListModel_RowValueChanged(wxd_DataViewModel_t* model, uint64_
                                              uint64_t col);
 WXD_EXPORTED void
 wxd_DataViewVirtualListModel_Reset(wxd_DataViewModel_t* model, uint64_t new_size);
+// Range notifications, one call per batch; selection and scroll position are kept.
+// RowsInserted still notifies the views once per inserted row.
+// Rows [first..last] are clamped to the model.
+WXD_EXPORTED void
+wxd_DataViewVirtualListModel_RowsChanged(wxd_DataViewModel_t* model, uint64_t first, uint64_t last);
+WXD_EXPORTED void
+wxd_DataViewVirtualListModel_RowsInserted(wxd_DataViewModel_t* model, uint64_t before,
+                                          uint64_t count);
+// Bit i of col_mask stands for column i (columns 0..63).
+WXD_EXPORTED void
+wxd_DataViewVirtualListModel_RowValuesChanged(wxd_DataViewModel_t* model, uint64_t first,
+                                              uint64_t last, uint64_t col_mask);
 WXD_EXPORTED void*
 wxd_DataViewVirtualListModel_GetItem(wxd_DataViewModel_t* model, uint64_t row);
 WXD_EXPORTED uint64_t
@@ -238,8 +317,10 @@ typedef struct {
     bool italic;
 } wxd_DataViewItemAttr_t;
 
-typedef wxd_Variant_t* (*wxd_dataview_model_get_value_callback)(void* userdata, uint64_t row,
-                                                                uint64_t col);
+// Value callbacks write into the caller's variant through the wxd_Variant_Set* API and return
+// false to leave the cell empty.
+typedef bool (*wxd_dataview_model_get_value_callback)(void* userdata, uint64_t row, uint64_t col,
+                                                      wxd_Variant_t* out);
 typedef bool (*wxd_dataview_model_set_value_callback)(void* userdata, const wxd_Variant_t* variant,
                                                       uint64_t row, uint64_t col);
 typedef bool (*wxd_dataview_model_get_attr_callback)(void* userdata, uint64_t row, uint64_t col,
@@ -257,6 +338,122 @@ wxd_DataViewVirtualListModel_CreateWithCallbacks(
     wxd_dataview_model_get_attr_callback get_attr_callback,
     wxd_dataview_model_is_enabled_callback is_enabled_callback);
 
+/**
+ * Optional bulk value provider: fills rows [first_row, first_row + row_count) for columns
+ * [0, num_cols) in one call. `values` holds row_count * num_cols variants owned by the model,
+ * row-major, to be set in place; `attrs` is laid out the same way and zero-initialised, and a
+ * cell counts as styled when any of its flags ends up set.
+ */
+typedef void (*wxd_dataview_model_get_values_for_rows_callback)(void* userdata, uint64_t first_row,
+                                                                uint64_t row_count,
+                                                                uint32_t num_cols,
+                                                                wxd_Variant_t* const* values,
+                                                                wxd_DataViewItemAttr_t* attrs);
+
+/**
+ * @brief Returns the userdata a model made by wxd_DataViewVirtualListModel_CreateWithCallbacks
+ * was created with, or NULL for any other model.
+ */
+WXD_EXPORTED void*
+wxd_DataViewVirtualListModel_GetCallbackUserdata(wxd_DataViewModel_t* model);
+
+/**
+ * @brief Installs (or, with NULL, removes) the bulk value provider on a callback model. Cells are
+ * then fetched a window of rows at a time and served from a cache that lives until control
+ * returns to the event loop or a row notification arrives; columns at or past num_cols still go
+ * through the per-cell callbacks. Returns false if the model is not a callback model.
+ */
+WXD_EXPORTED bool
+wxd_DataViewVirtualListModel_SetValuesForRowsCallback(
+    wxd_DataViewModel_t* model, wxd_dataview_model_get_values_for_rows_callback callback,
+    uint32_t num_cols);
+
+// Optional per-row attribute provider: one attr for every column of the row.
+typedef bool (*wxd_dataview_model_get_row_attr_callback)(void* userdata, uint64_t row,
+                                                         wxd_DataViewItemAttr_t* attr);
+
+/**
+ * @brief Installs (or, with NULL, removes) the per-row attribute provider on a callback model.
+ * It replaces the per-cell attribute callback; results are kept in a bounded LRU keyed by row
+ * that RowChanged/RowValueChanged drop for their row and row inserts, deletes and Reset clear.
+ * Attributes set through the bulk value provider still win for their cells. Returns false if
+ * the model is not a callback model.
+ */
+WXD_EXPORTED bool
+wxd_DataViewVirtualListModel_SetRowAttrCallback(wxd_DataViewModel_t* model,
+                                                wxd_dataview_model_get_row_attr_callback callback);
+
+/**
+ * @brief Installs a sort/filter order on a callback model: view row i shows source row
+ * rows[i], and every callback receives source rows. `sourceCount` is the number of source rows;
+ * rows appended after the call are shown at the end. The control is reset to `viewCount` rows
+ * once. NULL `rows` (with viewCount 0) restores source order. Row notifications keep using
+ * view rows. Returns false if the model is not a callback model or an entry is out of range.
+ */
+WXD_EXPORTED bool
+wxd_DataViewVirtualListModel_SetRowMapping(wxd_DataViewModel_t* model, const uint32_t* rows,
+                                           uint64_t viewCount, uint64_t sourceCount);
+// Source row shown at `viewRow`, or -1 if out of range.
+WXD_EXPORTED int64_t
+wxd_DataViewVirtualListModel_GetSourceRow(wxd_DataViewModel_t* model, uint64_t viewRow);
+// View row showing `sourceRow`, or -1 if it is filtered out or out of range.
+WXD_EXPORTED int64_t
+wxd_DataViewVirtualListModel_GetViewRow(wxd_DataViewModel_t* model, uint64_t sourceRow);
+
+// Column projection. Columns outside the projection read as null without calling the value or
+// attribute callbacks, and the bulk callback gets NULL slots for them; auto-sizing and export
+// still read every column. The projection belongs to the model, so project a model shown in
+// one control only. Sets the projected model columns (NULL projects every column again).
+WXD_EXPORTED bool
+wxd_DataViewVirtualListModel_SetProjectedColumns(wxd_DataViewModel_t* model,
+                                                 const uint32_t* columns, size_t count);
+// True for every column of a model without a projection, and of a non-custom model.
+WXD_EXPORTED bool
+wxd_DataViewVirtualListModel_IsColumnProjected(wxd_DataViewModel_t* model, uint32_t column);
+
+/**
+ * Immutable snapshots. A snapshot is a table of `rows` cells per column, copied from packed
+ * columns and safe to build, publish and free on any thread. A publisher hands snapshots to one
+ * model: the latest published snapshot replaces the model's data at the next event loop
+ * iteration (older undelivered ones are dropped), and the control is told only which rows were
+ * deleted, inserted or changed. Row keys, when both snapshots have them, match rows that moved
+ * position because of inserts or deletes; a reordering of surviving rows resets the control.
+ */
+WXD_EXPORTED wxd_DataViewSnapshot_t*
+wxd_DataViewSnapshot_Create(const wxd_DataViewPackedColumn* columns, uint32_t cols, size_t rows);
+// Unique row identities, `count` == rows. Required (and non-zero) for tree models.
+WXD_EXPORTED bool
+wxd_DataViewSnapshot_SetKeys(wxd_DataViewSnapshot_t* snapshot, const uint64_t* keys,
+                             size_t count);
+// Tree models: key of each row's parent, 0 for top-level rows. Children keep row order.
+WXD_EXPORTED bool
+wxd_DataViewSnapshot_SetParents(wxd_DataViewSnapshot_t* snapshot, const uint64_t* parents,
+                                size_t count);
+// Optional styling per row, applied to every column.
+WXD_EXPORTED bool
+wxd_DataViewSnapshot_SetRowAttrs(wxd_DataViewSnapshot_t* snapshot,
+                                 const wxd_DataViewItemAttr_t* attrs, size_t count);
+// Frees a snapshot that was not published.
+WXD_EXPORTED void
+wxd_DataViewSnapshot_Destroy(wxd_DataViewSnapshot_t* snapshot);
+
+/**
+ * @brief Creates a publisher for a callback virtual list model or a snapshot tree model; NULL
+ * for any other model. GUI thread. Once a snapshot is applied, a callback list model serves the
+ * snapshot's columns (and row attributes, if it has any) without calling back; columns past
+ * the snapshot and edits still use the callbacks.
+ */
+WXD_EXPORTED wxd_DataViewSnapshotPublisher_t*
+wxd_DataViewModel_CreateSnapshotPublisher(wxd_DataViewModel_t* model);
+// Takes ownership of `snapshot` (also on failure). Any thread. False if it is not valid for
+// the model (tree snapshots without unique non-zero keys).
+WXD_EXPORTED bool
+wxd_DataViewSnapshotPublisher_Publish(wxd_DataViewSnapshotPublisher_t* publisher,
+                                      wxd_DataViewSnapshot_t* snapshot);
+// Any thread; the model may outlive its publishers and vice versa.
+WXD_EXPORTED void
+wxd_DataViewSnapshotPublisher_Destroy(wxd_DataViewSnapshotPublisher_t* publisher);
+
 // Custom tree model with callbacks: create a wxDataViewModel subclass that
 // forwards GetParent/IsContainer/GetChildren/GetValue/SetValue/IsEnabled/Compare
 // to C callbacks supplied in a struct allocated by the caller.
@@ -267,6 +464,13 @@ typedef bool (*wxd_dataview_tree_model_is_container_fn)(void* userdata, void* it
 typedef void (*wxd_dataview_tree_model_get_children_fn)(void* userdata, void* item,
                                                         void*** out_items, int* out_count);
 typedef void (*wxd_dataview_tree_model_free_children_fn)(void** items, int count);
+// Buffer-filling child enumeration: writes up to `capacity` children of `item` into `out` and
+// returns the total number of children. When the total exceeds `capacity` the model grows its
+// buffer and calls again, so the callee may keep its result between the two calls.
+typedef size_t (*wxd_dataview_tree_model_fill_children_fn)(void* userdata, void* item, void** out,
+                                                           size_t capacity);
+// Optional count query used to size the buffer before fill_children.
+typedef size_t (*wxd_dataview_tree_model_get_child_count_fn)(void* userdata, void* item);
 // Use the C-compatible wxd_Variant_t bridge (same as virtual list helper)
 typedef wxd_Variant_t* (*wxd_dataview_tree_model_get_value_fn)(void* userdata, void* item,
                                                                unsigned int col);
@@ -292,6 +496,11 @@ typedef struct wxd_DataViewTreeModel_Callbacks {
     wxd_dataview_tree_model_set_value_fn set_value;
     wxd_dataview_tree_model_is_enabled_fn is_enabled;
     wxd_dataview_tree_model_compare_fn compare;
+    // Optional. When fill_children is set it replaces get_children/free_children, and the model
+    // caches each node's children and IsContainer answer until an item notification for that
+    // node (ItemAdded/Deleted/Changed and their batch forms) or Cleared.
+    wxd_dataview_tree_model_fill_children_fn fill_children;
+    wxd_dataview_tree_model_get_child_count_fn get_child_count;
 } wxd_DataViewTreeModel_Callbacks;
 
 /**
@@ -301,6 +510,14 @@ typedef struct wxd_DataViewTreeModel_Callbacks {
 WXD_EXPORTED wxd_DataViewModel_t*
 wxd_DataViewTreeModel_CreateWithCallbacks(const wxd_DataViewTreeModel_Callbacks* callbacks);
 
+/**
+ * @brief Creates a read-only tree model fed by snapshots (see
+ * wxd_DataViewModel_CreateSnapshotPublisher), ref count 1. Item ids are the row keys, so items
+ * keep selection and expansion across snapshots. Empty until the first snapshot arrives.
+ */
+WXD_EXPORTED wxd_DataViewModel_t*
+wxd_DataViewTreeModel_CreateSnapshot();
+
 // Notifications and helpers for custom tree models
 WXD_EXPORTED void
 wxd_DataViewTreeModel_ItemValueChanged(wxd_DataViewModel_t* model, void* item, unsigned int col);
@@ -368,13 +585,13 @@ typedef wxd_Size_t (*wxd_CustomRenderer_GetSizeCallback)(void* user_data);
 typedef bool (*wxd_CustomRenderer_RenderCallback)(void* user_data, wxd_Rect_t cell, void* dc,
                                                   int state);
 typedef bool (*wxd_CustomRenderer_SetValueCallback)(void* user_data, const wxd_Variant_t* value);
-typedef wxd_Variant_t* (*wxd_CustomRenderer_GetValueCallback)(void* user_data);
+typedef bool (*wxd_CustomRenderer_GetValueCallback)(void* user_data, wxd_Variant_t* out);
 typedef bool (*wxd_CustomRenderer_HasEditorCtrlCallback)(void* user_data);
 typedef void* (*wxd_CustomRenderer_CreateEditorCtrlCallback)(void* user_data, void* parent,
                                                              wxd_Rect_t label_rect,
                                                              const wxd_Variant_t* value);
-typedef wxd_Variant_t* (*wxd_CustomRenderer_GetValueFromEditorCtrlCallback)(void* user_data,
-                                                                            void* editor);
+typedef bool (*wxd_CustomRenderer_GetValueFromEditorCtrlCallback)(void* user_data, void* editor,
+                                                                  wxd_Variant_t* out);
 typedef bool (*wxd_CustomRenderer_ActivateCellCallback)(void* user_data, wxd_Rect_t cell,
                                                         void* model, void* item, unsigned int col,
                                                         void* mouse_event);
@@ -392,6 +609,19 @@ wxd_DataViewCustomRenderer_Create(
     wxd_CustomRenderer_GetValueFromEditorCtrlCallback get_value_from_editor_callback,
     wxd_CustomRenderer_ActivateCellCallback activate_cell_callback);
 
+/**
+ * Opt-in render cache: cells are drawn once into a bitmap and blitted on later paints with the
+ * same item, column, value, size and state, evicting least recently used bitmaps beyond
+ * `budgetBytes` (4 bytes per pixel). 0 disables the cache and frees it.
+ */
+WXD_EXPORTED void
+wxd_DataViewCustomRenderer_EnableRenderCache(wxd_DataViewRenderer_t* renderer,
+                                             size_t budgetBytes);
+// Drops the cached bitmaps of the item with id `itemId`, or all of them when NULL.
+WXD_EXPORTED void
+wxd_DataViewCustomRenderer_InvalidateRenderCache(wxd_DataViewRenderer_t* renderer,
+                                                 const void* itemId);
+
 // Function to release callbacks by renderer ID
 WXD_EXPORTED void
 wxd_DataViewCustomRenderer_ReleaseCallbacksByKey(int32_t renderer_id);
@@ -440,6 +670,13 @@ wxd_DataViewListModel_GetValue(wxd_DataViewModel_t* self, size_t row, size_t col
 WXD_EXPORTED bool
 wxd_DataViewListCtrl_AppendItem(wxd_Window_t* self, const wxd_Variant_t* const* values,
                                 uint32_t count, uintptr_t data);
+// Bulk forms of AppendItem; see wxd_DataViewListModel_AppendRows.
+WXD_EXPORTED bool
+wxd_DataViewListCtrl_AppendItems(wxd_Window_t* self, const wxd_Variant_t* const* values,
+                                 size_t rows, uint32_t cols);
+WXD_EXPORTED bool
+wxd_DataViewListCtrl_AppendItemsPacked(wxd_Window_t* self, const wxd_DataViewPackedColumn* columns,
+                                       uint32_t cols, size_t rows);
 WXD_EXPORTED bool
 wxd_DataViewListCtrl_PrependItem(wxd_Window_t* self, const wxd_Variant_t* const* values,
                                  uint32_t count, uintptr_t data);
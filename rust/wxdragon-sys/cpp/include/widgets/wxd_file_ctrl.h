@@ -16,12 +16,24 @@ wxd_FileCtrl_Create(wxd_Window_t* parent, int id, const char* default_directory,
 WXD_EXPORTED size_t
 wxd_FileCtrl_GetPath(const wxd_FileCtrl_t* self, char* buffer, size_t buffer_len);
 
+WXD_EXPORTED size_t
+wxd_FileCtrl_GetDirectory(const wxd_FileCtrl_t* self, char* buffer, size_t buffer_len);
+
+// Both cancel a pending wxd_FileCtrl_SetDirectoryAsync.
+WXD_EXPORTED bool
+wxd_FileCtrl_SetDirectory(wxd_FileCtrl_t* self, const char* directory);
+WXD_EXPORTED bool
+wxd_FileCtrl_SetPath(wxd_FileCtrl_t* self, const char* path);
+
+// Lists `directory` on a worker thread and switches the control to it once that is done, so an
+// unreachable share or a huge folder does not block the GUI. A newer call, or a synchronous
+// SetDirectory/SetPath, cancels it. Returns false if the listing could not be started.
+WXD_EXPORTED bool
+wxd_FileCtrl_SetDirectoryAsync(wxd_FileCtrl_t* self, const char* directory);
+
 // Placeholder for other wxFileCtrl specific functions:
-// void wxd_FileCtrl_SetPath(wxd_FileCtrl_t* self, const char* path);
 // const char* wxd_FileCtrl_GetFilename(wxd_FileCtrl_t* self);
 // void wxd_FileCtrl_SetFilename(wxd_FileCtrl_t* self, const char* filename);
-// const char* wxd_FileCtrl_GetDirectory(wxd_FileCtrl_t* self);
-// void wxd_FileCtrl_SetDirectory(wxd_FileCtrl_t* self, const char* directory);
 // const char* wxd_FileCtrl_GetWildcard(wxd_FileCtrl_t* self);
 // void wxd_FileCtrl_SetWildcard(wxd_FileCtrl_t* self, const char* wildcard);
 // int wxd_FileCtrl_GetFilterIndex(wxd_FileCtrl_t* self);
@@ -11,6 +11,10 @@ WXD_EXPORTED void
 wxd_Gauge_SetRange(wxd_Gauge_t* self, int range);
 WXD_EXPORTED void
 wxd_Gauge_SetValue(wxd_Gauge_t* self, int value);
+// Frame-paced variant: keeps only the newest value and applies it at most once per display
+// frame, skipping it when the bar would not move by a pixel (0 and the range always apply).
+WXD_EXPORTED void
+wxd_Gauge_SetValueDeferred(wxd_Gauge_t* self, int value);
 WXD_EXPORTED int
 wxd_Gauge_GetValue(const wxd_Gauge_t* self);
 
@@ -0,0 +1,77 @@
+#ifndef WXD_GLCANVAS_H
+#define WXD_GLCANVAS_H
+
+#include "../wxd_types.h"
+
+// --- OpenGL canvas (wxGLCanvas / wxGLContext) ---
+
+typedef struct wxd_GLCanvas wxd_GLCanvas_t;
+typedef struct wxd_GLContext wxd_GLContext_t;
+
+// Pixel format and context attributes. A zero field means "platform default" (for versions:
+// a legacy, compatibility context).
+typedef struct {
+    int32_t major_version;
+    int32_t minor_version;
+    bool core_profile;          // implies forward compatible
+    bool debug_context;
+    bool double_buffer;
+    int32_t depth_bits;
+    int32_t stencil_bits;
+    int32_t samples;            // MSAA samples per pixel, 0 or 1 for none
+    bool srgb;
+} wxd_GLAttributes;
+
+typedef enum {
+    WXD_NATIVE_WINDOW_NONE = 0,
+    WXD_NATIVE_WINDOW_WIN32 = 1,  // window: HWND, display: HINSTANCE
+    WXD_NATIVE_WINDOW_APPKIT = 2, // window: NSView*
+    WXD_NATIVE_WINDOW_GTK = 3     // window: GtkWidget*; X11 / Wayland surfaces come from GDK
+} wxd_NativeWindowKind;
+
+typedef struct {
+    wxd_NativeWindowKind kind;
+    void* window;
+    void* display;
+} wxd_NativeWindowHandle;
+
+// True if the display can provide a pixel format matching `attrs` (nullptr for defaults).
+WXD_EXPORTED bool
+wxd_GLCanvas_IsDisplaySupported(const wxd_GLAttributes* attrs);
+
+// Returns nullptr if no matching pixel format exists. The canvas always repaints fully on
+// resize.
+WXD_EXPORTED wxd_GLCanvas_t*
+wxd_GLCanvas_Create(wxd_Window_t* parent, int id, int x, int y, int w, int h, int64_t style,
+                    const wxd_GLAttributes* attrs);
+
+// Makes `context` current on the canvas' window. The window must be shown.
+WXD_EXPORTED bool
+wxd_GLCanvas_SetCurrent(wxd_GLCanvas_t* self, const wxd_GLContext_t* context);
+
+WXD_EXPORTED bool
+wxd_GLCanvas_SwapBuffers(wxd_GLCanvas_t* self);
+
+// 0 disables vsync, 1 syncs every frame, -1 requests adaptive vsync. Returns false if the
+// platform or driver does not support changing it.
+WXD_EXPORTED bool
+wxd_GLCanvas_SetSwapInterval(wxd_GLCanvas_t* self, int interval);
+
+// The native window of the canvas, for renderers that create their own surface.
+WXD_EXPORTED wxd_NativeWindowHandle
+wxd_GLCanvas_GetNativeHandle(wxd_GLCanvas_t* self);
+
+// Creates a context for windows compatible with `canvas`, sharing display lists and textures
+// with `share` if given. Returns nullptr if the requested version or profile is unavailable.
+WXD_EXPORTED wxd_GLContext_t*
+wxd_GLContext_Create(wxd_GLCanvas_t* canvas, const wxd_GLAttributes* attrs,
+                     const wxd_GLContext_t* share);
+
+WXD_EXPORTED void
+wxd_GLContext_Destroy(wxd_GLContext_t* self);
+
+// Looks up an OpenGL entry point for loaders such as glow or glad. A context should be current.
+WXD_EXPORTED const void*
+wxd_GLContext_GetProcAddress(const char* name);
+
+#endif // WXD_GLCANVAS_H
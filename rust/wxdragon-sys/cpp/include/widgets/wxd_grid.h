@@ -73,9 +73,46 @@ wxd_Grid_DeleteCols(wxd_Grid_t* self, int pos, int numCols, bool updateLabels);
 WXD_EXPORTED int
 wxd_Grid_GetCellValue(wxd_Grid_t* self, int row, int col, char* buffer, int buffer_len);
 
+// Single-call variant; free the result with wxd_String_Free. Returns NULL if self is NULL.
+WXD_EXPORTED wxd_String_t*
+wxd_Grid_GetCellValueOwned(wxd_Grid_t* self, int row, int col);
+
 WXD_EXPORTED void
 wxd_Grid_SetCellValue(wxd_Grid_t* self, int row, int col, const char* value);
 
+// Same as wxd_Grid_SetCellValue for `len` bytes of UTF-8; `value` need not be NUL-terminated.
+WXD_EXPORTED void
+wxd_Grid_SetCellValueLen(wxd_Grid_t* self, int row, int col, const char* value, size_t len);
+
+// Sets a rows x cols block starting at (top, left) in one call. Values are row-major in
+// `packed_utf8`; cell i is bytes [offsets[i], offsets[i + 1]), so `offsets` holds
+// rows * cols + 1 entries. Cells outside the grid are skipped and the block is repainted once.
+// Returns the number of cells written.
+WXD_EXPORTED int
+wxd_Grid_SetCellValuesBlock(wxd_Grid_t* self, int top, int left, int rows, int cols,
+                            const char* packed_utf8, const uint32_t* offsets);
+
+// Reads a rows x cols block in the same layout. `offsets` must hold rows * cols + 1 entries.
+// Returns the packed text (free with wxd_String_Free), or NULL on error. Cells outside the grid
+// read as empty strings.
+WXD_EXPORTED wxd_String_t*
+wxd_Grid_GetCellValuesBlock(wxd_Grid_t* self, int top, int left, int rows, int cols,
+                            uint32_t* offsets, size_t offsets_len);
+
+// --- Export ---
+// Formats the union of `blocks` as delimited text: the rows and columns any block covers, in
+// order, with cells outside every block left empty. Values are read from the table without
+// rendering. Returns NULL on error; free with wxd_String_Free.
+WXD_EXPORTED wxd_String_t*
+wxd_Grid_ExportRange(wxd_Grid_t* self, const wxd_GridBlockCoords* blocks, size_t count,
+                     const wxd_TableExportFormat* format);
+// Same, handing the text to `write` in chunks of about 256KB instead of building one string.
+// Returns false on error or if `write` returned false.
+WXD_EXPORTED bool
+wxd_Grid_ExportRangeTo(wxd_Grid_t* self, const wxd_GridBlockCoords* blocks, size_t count,
+                       const wxd_TableExportFormat* format, wxd_table_export_write_fn write,
+                       void* userdata);
+
 // --- Label Functions ---
 WXD_EXPORTED int
 wxd_Grid_GetRowLabelValue(wxd_Grid_t* self, int row, char* buffer, int buffer_len);
@@ -153,6 +190,33 @@ wxd_Grid_AutoSizeRowLabelSize(wxd_Grid_t* self, int row);
 WXD_EXPORTED void
 wxd_Grid_AutoSizeColLabelSize(wxd_Grid_t* self, int col);
 
+// --- Sampled Auto-Sizing ---
+// AutoSizeColumn(s) measure every row; these measure only the selected rows, so the cost is
+// O(sample) regardless of grid size. The column label is always included.
+typedef struct wxd_GridAutoSizeSample {
+    bool visible_rows;       // rows currently scrolled into view
+    int head_rows;           // first N rows
+    int tail_rows;           // last N rows
+    int stride_rows;         // N rows spread evenly over the whole grid
+    // Reuse the measured width of earlier single-line strings with the same font and length
+    // instead of measuring each one. Faster, but only an estimate for proportional fonts.
+    bool estimate_by_length;
+} wxd_GridAutoSizeSample;
+
+// Returns the width applied to `col`, or -1 on error.
+WXD_EXPORTED int
+wxd_Grid_AutoSizeColumnSampled(wxd_Grid_t* self, int col, const wxd_GridAutoSizeSample* sample,
+                               bool setAsMin);
+
+WXD_EXPORTED void
+wxd_Grid_AutoSizeColumnsSampled(wxd_Grid_t* self, const wxd_GridAutoSizeSample* sample,
+                                bool setAsMin);
+
+// When enabled, rows are measured as they scroll into view and columns are widened (never
+// shrunk) to fit them.
+WXD_EXPORTED void
+wxd_Grid_EnableAutoGrowColumns(wxd_Grid_t* self, bool enable, bool estimateByLength);
+
 // --- Cell Formatting ---
 WXD_EXPORTED wxd_Colour_t
 wxd_Grid_GetCellBackgroundColour(wxd_Grid_t* self, int row, int col);
@@ -253,6 +317,12 @@ wxd_Grid_GetSelectedRowBlocks(wxd_Grid_t* self, wxd_GridBlockCoords* buffer, int
 WXD_EXPORTED int
 wxd_Grid_GetSelectedColBlocks(wxd_Grid_t* self, wxd_GridBlockCoords* buffer, int buffer_len);
 
+// Get the whole selection (cells, rows, columns and blocks) as a normalized list of
+// non-overlapping rectangles, ordered top to bottom then left to right; whole rows/columns
+// span the full grid width/height. Returns the total count and fills up to buffer_len entries.
+WXD_EXPORTED int
+wxd_Grid_GetSelectionRanges(wxd_Grid_t* self, wxd_GridBlockCoords* buffer, int buffer_len);
+
 // --- Grid Cursor ---
 WXD_EXPORTED int
 wxd_Grid_GetGridCursorRow(wxd_Grid_t* self);
@@ -328,6 +398,24 @@ wxd_Grid_GetBatchCount(wxd_Grid_t* self);
 WXD_EXPORTED void
 wxd_Grid_ForceRefresh(wxd_Grid_t* self);
 
+// --- Update Sessions ---
+// Alternative to Begin/EndBatch for scattered updates. While a session is open, the wxd
+// cell setters (values, colours, fonts, alignment, styles, block and columnar updates) only
+// record the cells they touch. Ending the outermost session unions them into device rects and
+// refreshes just those, skipping anything scrolled out of view. Sessions nest.
+WXD_EXPORTED void
+wxd_Grid_BeginUpdateSession(wxd_Grid_t* self);
+
+// Records a block changed by other means (pass all columns/rows for whole rows/columns).
+// Outside a session the block is refreshed immediately.
+WXD_EXPORTED void
+wxd_Grid_MarkDirtyBlock(wxd_Grid_t* self, int topRow, int leftCol, int numRows, int numCols);
+
+// Closes a session. Returns the number of pixels invalidated, 0 for an inner session. With
+// frozen rows or columns, blocks are counted whole rather than clipped to the visible area.
+WXD_EXPORTED uint64_t
+wxd_Grid_EndUpdateSession(wxd_Grid_t* self);
+
 // --- Clear Grid ---
 WXD_EXPORTED void
 wxd_Grid_ClearGrid(wxd_Grid_t* self);
@@ -508,6 +596,102 @@ wxd_Grid_SetColFormatDate(wxd_Grid_t* self, int col, const char* format);
 WXD_EXPORTED void
 wxd_Grid_SetColFormatCustom(wxd_Grid_t* self, int col, const char* typeName);
 
+// --- Custom Cell Renderers ---
+// Renderers whose drawing is done by the caller. Cell backgrounds (selection, attribute colour)
+// are painted natively before the callbacks run.
+
+// Visible cells of one column handed to draw_batch; `selected` is non-zero for selected cells.
+typedef struct {
+    int col;
+    size_t count;
+    const int32_t* rows;
+    const wxd_Rect* rects;
+    const uint8_t* selected;
+} wxd_GridRenderBatch;
+
+typedef void (*wxd_grid_renderer_draw_fn)(void* userdata, wxd_DC_t* dc, int row, int col,
+                                          wxd_Rect rect, bool selected);
+typedef void (*wxd_grid_renderer_draw_batch_fn)(void* userdata, wxd_DC_t* dc,
+                                                const wxd_GridRenderBatch* batch);
+// Returns the cell's best size; a negative width or height keeps the current cell size.
+typedef wxd_Size (*wxd_grid_renderer_best_size_fn)(void* userdata, wxd_DC_t* dc, int row,
+                                                   int col);
+
+// At least one of draw and draw_batch is required. With draw_batch, painting a grid window
+// makes one call per column with every visible cell of it that uses the renderer, instead of
+// one per cell; draw, if also set, serves drawing outside a window paint.
+typedef struct wxd_GridCellRenderer_Callbacks {
+    void* userdata;
+    void (*userdata_free)(void* userdata);
+    wxd_grid_renderer_draw_fn draw;
+    wxd_grid_renderer_draw_batch_fn draw_batch;
+    wxd_grid_renderer_best_size_fn get_best_size;
+} wxd_GridCellRenderer_Callbacks;
+
+// Creates a renderer holding one reference for the caller; userdata_free(userdata) runs when
+// the last reference (the caller's, a grid's or a clone's) is gone. On failure userdata_free is
+// called before returning NULL.
+WXD_EXPORTED wxd_GridCellRenderer_t*
+wxd_GridCellRenderer_Create(const wxd_GridCellRenderer_Callbacks* callbacks);
+
+WXD_EXPORTED void
+wxd_GridCellRenderer_DecRef(wxd_GridCellRenderer_t* renderer);
+
+// The grid takes its own reference in each of these.
+WXD_EXPORTED void
+wxd_Grid_SetColRenderer(wxd_Grid_t* self, int col, wxd_GridCellRenderer_t* renderer);
+
+WXD_EXPORTED void
+wxd_Grid_SetCellRenderer(wxd_Grid_t* self, int row, int col, wxd_GridCellRenderer_t* renderer);
+
+// Registers `typeName` with the renderer and a text editor, for wxd_Grid_SetColFormatCustom and
+// tables reporting that type.
+WXD_EXPORTED void
+wxd_Grid_RegisterRendererType(wxd_Grid_t* self, const char* typeName,
+                              wxd_GridCellRenderer_t* renderer);
+
+// --- Custom Editors ---
+// Called once the editor's text control holds the cell value and has focus; `control` is the
+// wxTextCtrl, reused for every edit with this editor.
+typedef void (*wxd_grid_editor_begin_fn)(void* userdata, int row, int col,
+                                         wxd_Window_t* control);
+// Called when editing ends with a changed value; false rejects it and keeps the old value.
+typedef bool (*wxd_grid_editor_end_fn)(void* userdata, int row, int col, const char* old_value,
+                                       const char* new_value);
+// Stores an accepted value; false leaves it to the grid table's SetValue.
+typedef bool (*wxd_grid_editor_apply_fn)(void* userdata, int row, int col, const char* value);
+
+// All callbacks are optional; without any the editor behaves as the standard text editor.
+typedef struct wxd_GridCellEditor_Callbacks {
+    void* userdata;
+    void (*userdata_free)(void* userdata);
+    wxd_grid_editor_begin_fn begin_edit;
+    wxd_grid_editor_end_fn end_edit;
+    wxd_grid_editor_apply_fn apply_edit;
+} wxd_GridCellEditor_Callbacks;
+
+// Creates a text editor holding one reference for the caller, with the same lifetime rules as
+// wxd_GridCellRenderer_Create. The grid creates its control on first use and keeps it for
+// later edits; assign one editor object to several columns or a type to share the control.
+WXD_EXPORTED wxd_GridCellEditor_t*
+wxd_GridCellEditor_Create(const wxd_GridCellEditor_Callbacks* callbacks);
+
+WXD_EXPORTED void
+wxd_GridCellEditor_DecRef(wxd_GridCellEditor_t* editor);
+
+// The grid takes its own reference in each of these.
+WXD_EXPORTED void
+wxd_Grid_SetColEditor(wxd_Grid_t* self, int col, wxd_GridCellEditor_t* editor);
+
+WXD_EXPORTED void
+wxd_Grid_SetCellEditor(wxd_Grid_t* self, int row, int col, wxd_GridCellEditor_t* editor);
+
+// Registers `typeName` with a renderer and an editor; NULL selects the standard string renderer
+// or text editor.
+WXD_EXPORTED void
+wxd_Grid_RegisterDataType(wxd_Grid_t* self, const char* typeName,
+                          wxd_GridCellRenderer_t* renderer, wxd_GridCellEditor_t* editor);
+
 // --- Sorting ---
 WXD_EXPORTED int
 wxd_Grid_GetSortingColumn(wxd_Grid_t* self);
@@ -742,6 +926,16 @@ wxd_Grid_SetRowPos(wxd_Grid_t* self, int idx, int pos);
 WXD_EXPORTED void
 wxd_Grid_ResetRowPos(wxd_Grid_t* self);
 
+// Installs a complete display order in one call: `order[pos]` is the row shown at `pos`. `n`
+// must equal the number of rows and `order` must be a permutation of 0..n-1.
+WXD_EXPORTED bool
+wxd_Grid_ApplyRowPermutation(wxd_Grid_t* self, const int* order, int n);
+
+// Copies column `col` of rows 0..n-1 as numbers into `out` for sorting. Returns false (and
+// writes nothing) unless every row's cell can be read as a number or float.
+WXD_EXPORTED bool
+wxd_Grid_GetColumnNumbers(wxd_Grid_t* self, int col, double* out, int n);
+
 // --- Margins ---
 WXD_EXPORTED void
 wxd_Grid_SetMargins(wxd_Grid_t* self, int extraWidth, int extraHeight);
@@ -778,4 +972,173 @@ wxd_GridEvent_AltDown(wxd_Event_t* event);
 WXD_EXPORTED bool
 wxd_GridEvent_MetaDown(wxd_Event_t* event);
 
+// --- Virtual Grid Table ---
+// A wxGridTableBase whose storage lives on the caller's side: the grid asks for the values of
+// visible cells only, so memory stays proportional to what is on screen.
+
+// Cell value types reported by get_type; they select the default renderer and editor.
+#define WXD_GRID_VALUE_STRING 0
+#define WXD_GRID_VALUE_BOOL 1
+#define WXD_GRID_VALUE_NUMBER 2
+#define WXD_GRID_VALUE_FLOAT 3
+
+// Optional per-cell attributes returned by get_attr.
+typedef struct {
+    bool has_text_colour;
+    wxd_Colour_t text_colour;
+    bool has_bg_colour;
+    wxd_Colour_t bg_colour;
+    bool has_alignment;
+    int horiz_align;
+    int vert_align;
+    bool read_only;
+} wxd_GridCellAttrDesc;
+
+typedef int (*wxd_grid_table_get_count_fn)(void* userdata);
+// Returns `len` bytes of UTF-8 (need not be NUL-terminated). The memory is borrowed and only
+// has to stay valid until the next callback on this table.
+typedef const char* (*wxd_grid_table_get_value_fn)(void* userdata, int row, int col,
+                                                   size_t* out_len);
+typedef void (*wxd_grid_table_set_value_fn)(void* userdata, int row, int col, const char* value,
+                                            size_t len);
+typedef int (*wxd_grid_table_get_type_fn)(void* userdata, int row, int col);
+typedef int64_t (*wxd_grid_table_get_long_fn)(void* userdata, int row, int col);
+typedef double (*wxd_grid_table_get_double_fn)(void* userdata, int row, int col);
+typedef bool (*wxd_grid_table_get_bool_fn)(void* userdata, int row, int col);
+typedef bool (*wxd_grid_table_get_attr_fn)(void* userdata, int row, int col,
+                                           wxd_GridCellAttrDesc* out_attr);
+typedef void (*wxd_grid_table_userdata_free_fn)(void* userdata);
+
+// Callbacks for wxd_Grid_SetTable. get_number_rows, get_number_cols and get_value are
+// required; NULL optional callbacks fall back to string cells with no attributes.
+typedef struct wxd_GridTable_Callbacks {
+    void* userdata;
+    wxd_grid_table_userdata_free_fn userdata_free;
+    wxd_grid_table_get_count_fn get_number_rows;
+    wxd_grid_table_get_count_fn get_number_cols;
+    wxd_grid_table_get_value_fn get_value;
+    wxd_grid_table_set_value_fn set_value;
+    wxd_grid_table_get_type_fn get_type;
+    wxd_grid_table_get_long_fn get_value_as_long;
+    wxd_grid_table_get_double_fn get_value_as_double;
+    wxd_grid_table_get_bool_fn get_value_as_bool;
+    wxd_grid_table_get_attr_fn get_attr;
+} wxd_GridTable_Callbacks;
+
+// Installs a callback-driven table instead of calling wxd_Grid_CreateGrid. The grid owns the
+// table; userdata_free(userdata) runs when the grid is destroyed or the table replaced.
+// On failure userdata_free is called before returning false.
+WXD_EXPORTED bool
+wxd_Grid_SetTable(wxd_Grid_t* self, const wxd_GridTable_Callbacks* callbacks, int selectionMode);
+
+// Tell the grid that the table's row/column count changed. Call after the callbacks already
+// report the new size.
+WXD_EXPORTED void
+wxd_Grid_NotifyTableRowsInserted(wxd_Grid_t* self, int pos, int numRows);
+
+WXD_EXPORTED void
+wxd_Grid_NotifyTableRowsAppended(wxd_Grid_t* self, int numRows);
+
+WXD_EXPORTED void
+wxd_Grid_NotifyTableRowsDeleted(wxd_Grid_t* self, int pos, int numRows);
+
+WXD_EXPORTED void
+wxd_Grid_NotifyTableColsInserted(wxd_Grid_t* self, int pos, int numCols);
+
+WXD_EXPORTED void
+wxd_Grid_NotifyTableColsAppended(wxd_Grid_t* self, int numCols);
+
+WXD_EXPORTED void
+wxd_Grid_NotifyTableColsDeleted(wxd_Grid_t* self, int pos, int numCols);
+
+// --- Columnar Grid Table ---
+// Native table storing each column as one contiguous typed array (WXD_GRID_VALUE_* per column).
+// Number, float and bool columns are read by their renderers directly, so values are only
+// formatted for visible cells at paint time. String columns behave like wxd_Grid_CreateGrid.
+// Number cells hold 64 bits; where `long` is 32 bits (Windows) typed renderers and editors see
+// them clamped to the `long` range, while the cell text keeps the full value.
+
+// Installs a columnar table with `numRows` rows and one column per entry of `colTypes`.
+WXD_EXPORTED bool
+wxd_Grid_CreateColumnarTable(wxd_Grid_t* self, int numRows, const int* colTypes, int numCols,
+                             int selectionMode);
+
+// Resizes every column (new cells are zero/empty) and updates the grid.
+WXD_EXPORTED bool
+wxd_Grid_ColumnarSetRowCount(wxd_Grid_t* self, int numRows);
+
+// Copies `count` values into column `col` starting at `firstRow` and repaints only that row
+// range. The column must have the matching type. Returns false (and changes nothing) on a type
+// or range mismatch.
+WXD_EXPORTED bool
+wxd_Grid_ColumnarUpdateInt64(wxd_Grid_t* self, int col, int firstRow, const int64_t* values,
+                             size_t count);
+
+WXD_EXPORTED bool
+wxd_Grid_ColumnarUpdateDouble(wxd_Grid_t* self, int col, int firstRow, const double* values,
+                              size_t count);
+
+WXD_EXPORTED bool
+wxd_Grid_ColumnarUpdateBool(wxd_Grid_t* self, int col, int firstRow, const bool* values,
+                            size_t count);
+
+// --- Style Palette ---
+// Shared cell styles for large styled areas (heat maps, banding). A style is registered once and
+// cells reference it by index, so N styles cost N wxGridCellAttr objects no matter how many cells
+// use them. Assignments are stored as per-row runs. Attributes set through wxd_Grid_SetCell*
+// still apply and take precedence over the palette. The palette belongs to the current table
+// and is installed as its attribute provider; a table that already has one (for instance because
+// per-cell attributes were set first) keeps it and wxd_Grid_AddStyle fails, so register styles
+// before setting per-cell attributes. Style index -1 means "no style".
+
+// Registers a style and returns its index, or -1 on failure.
+WXD_EXPORTED int
+wxd_Grid_AddStyle(wxd_Grid_t* self, const wxd_GridCellAttrDesc* style);
+
+// Sets the font of a registered style.
+WXD_EXPORTED bool
+wxd_Grid_SetStyleFont(wxd_Grid_t* self, int style, const wxd_Font_t* font);
+
+// Assigns `count` style indices to consecutive cells of `row` starting at `firstCol`. Runs of
+// equal indices are coalesced.
+WXD_EXPORTED bool
+wxd_Grid_SetCellStyles(wxd_Grid_t* self, int row, int firstCol, const int32_t* styles,
+                       size_t count);
+
+// Assigns one style to a block of cells (pass all columns to style whole rows).
+WXD_EXPORTED bool
+wxd_Grid_SetBlockStyle(wxd_Grid_t* self, int topRow, int leftCol, int numRows, int numCols,
+                       int style);
+
+// Removes every style assignment and empties the palette.
+WXD_EXPORTED void
+wxd_Grid_ClearStyles(wxd_Grid_t* self);
+
+// --- Streaming Row Ingest ---
+// Producer threads push packed rows into a bounded buffer; the GUI thread appends them at most
+// once per `flushIntervalMs` with a single AppendRows() and a batched fill. The grid's table
+// must support AppendRows (e.g. wxd_Grid_CreateGrid).
+
+// Creates an ingest channel for `grid` (main thread). `capacityRows` bounds the buffer,
+// `maxRows` > 0 caps the grid by deleting the oldest rows, and `autoScroll` keeps the last
+// row in view after each flush.
+WXD_EXPORTED wxd_GridIngest_t*
+wxd_GridIngest_Create(wxd_Grid_t* grid, size_t capacityRows, int maxRows, bool autoScroll,
+                      int flushIntervalMs);
+
+// Thread-safe. Queues one row of `cols` cells: cell i is packed_utf8[offsets[i]..offsets[i+1]].
+// Returns false if the buffer is full or the channel is closed; the row is then not queued.
+WXD_EXPORTED bool
+wxd_GridIngest_PushRow(wxd_GridIngest_t* ingest, const char* packed_utf8,
+                       const uint32_t* offsets, int cols);
+
+// Thread-safe. Rows queued but not yet appended to the grid.
+WXD_EXPORTED size_t
+wxd_GridIngest_GetPendingCount(wxd_GridIngest_t* ingest);
+
+// Thread-safe. Closes the channel and releases the handle; rows already queued are still
+// flushed. The grid may already have been destroyed.
+WXD_EXPORTED void
+wxd_GridIngest_Destroy(wxd_GridIngest_t* ingest);
+
 #endif // WXD_GRID_H
@@ -0,0 +1,78 @@
+#ifndef WXD_HVSCROLLEDWINDOW_H
+#define WXD_HVSCROLLEDWINDOW_H
+
+#include "../wxd_types.h"
+
+// --- Logically scrolled window (wxHVScrolledWindow) ---
+// A window that scrolls by rows and columns instead of pixels. Only the sizes of the rows and
+// columns near the visible area are requested, through the callbacks, so a custom control can
+// cover billions of rows without computing a pixel height for all of them or overflowing
+// 32-bit coordinates. The owner paints with a paint DC where (0, 0) is the top-left corner of
+// the first visible row and column.
+
+typedef struct wxd_HVScrolledWindow wxd_HVScrolledWindow_t;
+
+// Height of `row` / width of `column` in pixels.
+typedef int (*wxd_HVScrolledWindow_UnitSize)(void* user_data, size_t index);
+typedef void (*wxd_HVScrolledWindow_FreeUserData)(void* user_data);
+
+WXD_EXPORTED wxd_HVScrolledWindow_t*
+wxd_HVScrolledWindow_Create(wxd_Window_t* parent, int id, int x, int y, int w, int h,
+                            int64_t style);
+
+// Sets the size callbacks, freeing the previous user data; `free_user_data` also runs when the
+// window is destroyed. A NULL callback gives every row or column the default size.
+WXD_EXPORTED void
+wxd_HVScrolledWindow_SetCallbacks(wxd_HVScrolledWindow_t* self,
+                                  wxd_HVScrolledWindow_UnitSize row_height,
+                                  wxd_HVScrolledWindow_UnitSize column_width, void* user_data,
+                                  wxd_HVScrolledWindow_FreeUserData free_user_data);
+
+// Sizes used without callbacks (20 and 80 by default).
+WXD_EXPORTED void
+wxd_HVScrolledWindow_SetDefaultSizes(wxd_HVScrolledWindow_t* self, int row_height,
+                                     int column_width);
+
+WXD_EXPORTED void
+wxd_HVScrolledWindow_SetRowColumnCount(wxd_HVScrolledWindow_t* self, size_t rows,
+                                       size_t columns);
+
+WXD_EXPORTED size_t
+wxd_HVScrolledWindow_GetRowCount(const wxd_HVScrolledWindow_t* self);
+
+WXD_EXPORTED size_t
+wxd_HVScrolledWindow_GetColumnCount(const wxd_HVScrolledWindow_t* self);
+
+// Re-queries all sizes and repaints; call after sizes changed.
+WXD_EXPORTED void
+wxd_HVScrolledWindow_RefreshAll(wxd_HVScrolledWindow_t* self);
+
+// Repaints rows [from, to] / columns [from, to] if visible.
+WXD_EXPORTED void
+wxd_HVScrolledWindow_RefreshRows(wxd_HVScrolledWindow_t* self, size_t from, size_t to);
+
+WXD_EXPORTED void
+wxd_HVScrolledWindow_RefreshColumns(wxd_HVScrolledWindow_t* self, size_t from, size_t to);
+
+// Makes `row` / `column` the first visible one.
+WXD_EXPORTED bool
+wxd_HVScrolledWindow_ScrollToRow(wxd_HVScrolledWindow_t* self, size_t row);
+
+WXD_EXPORTED bool
+wxd_HVScrolledWindow_ScrollToColumn(wxd_HVScrolledWindow_t* self, size_t column);
+
+// First visible row / column and one past the last (possibly partially) visible one.
+WXD_EXPORTED void
+wxd_HVScrolledWindow_GetVisibleRows(const wxd_HVScrolledWindow_t* self, size_t* begin,
+                                    size_t* end);
+
+WXD_EXPORTED void
+wxd_HVScrolledWindow_GetVisibleColumns(const wxd_HVScrolledWindow_t* self, size_t* begin,
+                                       size_t* end);
+
+// Row and column under the client point (x, y); false if it is past the last row or column.
+WXD_EXPORTED bool
+wxd_HVScrolledWindow_HitTest(const wxd_HVScrolledWindow_t* self, int x, int y, size_t* row,
+                             size_t* column);
+
+#endif // WXD_HVSCROLLEDWINDOW_H
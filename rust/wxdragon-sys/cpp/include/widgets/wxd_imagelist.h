@@ -29,6 +29,14 @@ WXD_EXPORTED int
 wxd_ImageList_AddWithMask(wxd_ImageList_t* self, const wxd_Bitmap_t* bitmap,
                           const wxd_Bitmap_t* mask);
 
+// Adds the first `count` tiles (row-major) of an RGBA atlas `atlas_width` x `atlas_height`
+// pixels; tiles must have the list's image size. The sheet is converted to a native bitmap once
+// and sliced, instead of one bitmap per icon. Returns the index of the first added image, or -1
+// if nothing was added.
+WXD_EXPORTED int
+wxd_ImageList_AddFromAtlas(wxd_ImageList_t* self, const unsigned char* rgba, int atlas_width,
+                           int atlas_height, int tile_width, int tile_height, int count);
+
 // Returns the number of images in the list.
 WXD_EXPORTED int
 wxd_ImageList_GetImageCount(wxd_ImageList_t* self);
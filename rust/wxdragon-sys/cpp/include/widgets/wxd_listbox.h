@@ -11,6 +11,15 @@ WXD_EXPORTED void
 wxd_ListBox_Append(wxd_ListBox_t* self, const char* item);
 WXD_EXPORTED void
 wxd_ListBox_Insert(wxd_ListBox_t* self, const char* item, unsigned int pos);
+// Replaces / extends the items with `count` packed UTF-8 strings in one native call: string i
+// is packed[offsets[i]..offsets[i + 1]), so `offsets` holds count + 1 entries. Returns false on
+// malformed offsets.
+WXD_EXPORTED bool
+wxd_ListBox_SetItems(wxd_ListBox_t* listbox, const char* packed, const uint32_t* offsets,
+                     size_t count);
+WXD_EXPORTED bool
+wxd_ListBox_AppendItems(wxd_ListBox_t* listbox, const char* packed, const uint32_t* offsets,
+                        size_t count);
 WXD_EXPORTED void
 wxd_ListBox_Clear(wxd_ListBox_t* listbox);
 WXD_EXPORTED int
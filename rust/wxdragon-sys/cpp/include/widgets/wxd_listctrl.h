@@ -6,6 +6,31 @@
 typedef char* (*wxd_listctrl_virtual_text_callback)(void* userdata, int64_t item, int32_t col);
 typedef void (*wxd_listctrl_free_string_callback)(char* text);
 typedef void (*wxd_listctrl_free_userdata_callback)(void* userdata);
+// Allocation-free text: points `*text` at `*len` UTF-8 bytes owned by the callee, valid until
+// its next call. Returns false for an empty cell.
+typedef bool (*wxd_listctrl_virtual_text_source_callback)(void* userdata, int64_t item,
+                                                          int32_t col, const char** text,
+                                                          size_t* len);
+// Rows [from..to] are about to be painted.
+typedef void (*wxd_listctrl_virtual_prefetch_callback)(void* userdata, int64_t from, int64_t to);
+
+// Row style returned by the virtual attribute callback.
+typedef struct {
+    bool has_text_colour;
+    wxd_Colour_t text_colour;
+    bool has_bg_colour;
+    wxd_Colour_t bg_colour;
+    bool bold;
+    bool italic;
+} wxd_ListItemAttr;
+
+// Fills `attr` and returns true to style `item`; false keeps the default look.
+typedef bool (*wxd_listctrl_virtual_attr_callback)(void* userdata, int64_t item,
+                                                   wxd_ListItemAttr* attr);
+// Image list index for the cell, or -1 for none.
+typedef int32_t (*wxd_listctrl_virtual_image_callback)(void* userdata, int64_t item,
+                                                       int32_t col);
+typedef bool (*wxd_listctrl_virtual_checked_callback)(void* userdata, int64_t item);
 
 // --- ListCtrl Functions ---
 WXD_EXPORTED wxd_ListCtrl_t*
@@ -22,6 +47,15 @@ WXD_EXPORTED int
 wxd_ListCtrl_GetColumnCount(wxd_ListCtrl_t* self);
 WXD_EXPORTED int32_t
 wxd_ListCtrl_InsertItem_Simple(wxd_ListCtrl_t* self, int64_t index, const char* label);
+/**
+ * Inserts `rows` items at `start` (clamped to the item count) in one frozen pass. Cell text is
+ * row-major UTF-8 in `utf8`, with `offsets` holding rows * cols + 1 entries; column 0 is the
+ * item label. `images` (optional) holds one image index per row. Returns the number of items
+ * inserted; not for virtual lists.
+ */
+WXD_EXPORTED int64_t
+wxd_ListCtrl_InsertItemsPacked(wxd_ListCtrl_t* self, int64_t start, int64_t rows, int cols,
+                               const char* utf8, const uint32_t* offsets, const int32_t* images);
 WXD_EXPORTED void
 wxd_ListCtrl_SetItemText(wxd_ListCtrl_t* self, int64_t index, const char* text);
 WXD_EXPORTED bool
@@ -96,12 +130,62 @@ wxd_ListCtrl_SetVirtualTextCallback(wxd_ListCtrl_t* self, void* userdata,
                                     wxd_listctrl_virtual_text_callback callback,
                                     wxd_listctrl_free_string_callback free_string,
                                     wxd_listctrl_free_userdata_callback free_userdata);
+/**
+ * Like SetVirtualTextCallback, but the text is borrowed from the callee instead of allocated
+ * and freed per cell. `prefetch` (optional) is called with the row band the control is about
+ * to paint (wxEVT_LIST_CACHE_HINT), before the per-cell calls for it. Replaces, and is
+ * replaced by, SetVirtualTextCallback; ClearVirtualTextCallback clears either.
+ */
+WXD_EXPORTED bool
+wxd_ListCtrl_SetVirtualTextSource(wxd_ListCtrl_t* self, void* userdata,
+                                  wxd_listctrl_virtual_text_source_callback source,
+                                  wxd_listctrl_virtual_prefetch_callback prefetch,
+                                  wxd_listctrl_free_userdata_callback free_userdata);
 WXD_EXPORTED void
 wxd_ListCtrl_ClearVirtualTextCallback(wxd_ListCtrl_t* self);
+/**
+ * Per-row style, per-cell image and checkbox state for a virtual list, each optional (NULL).
+ * Replaces callbacks set before; `free_userdata` runs when they are replaced, cleared or the
+ * control is destroyed. Styles are interned: rows with the same style share one wxItemAttr
+ * from a small pool, so memory stays proportional to the distinct styles on screen.
+ */
+WXD_EXPORTED bool
+wxd_ListCtrl_SetVirtualItemCallbacks(wxd_ListCtrl_t* self, void* userdata,
+                                     wxd_listctrl_virtual_attr_callback attr,
+                                     wxd_listctrl_virtual_image_callback image,
+                                     wxd_listctrl_virtual_checked_callback checked,
+                                     wxd_listctrl_free_userdata_callback free_userdata);
+WXD_EXPORTED void
+wxd_ListCtrl_ClearVirtualItemCallbacks(wxd_ListCtrl_t* self);
 
 // Sorting
 WXD_EXPORTED bool
 wxd_ListCtrl_SortItems(wxd_ListCtrl_t* self, int (*cmpFunc)(void*, void*, void*), void* data);
+
+typedef enum {
+    WXD_LIST_SORT_KEY_INT64 = 0,
+    WXD_LIST_SORT_KEY_DOUBLE = 1, // NaN sorts last in both directions
+    WXD_LIST_SORT_KEY_UTF8 = 2,   // compared bytewise; collate before packing
+} wxd_ListSortKeyKind;
+
+// One key per row, in current row order. Only the array matching `kind` is read; UTF-8 keys are
+// packed into `text` with `text_offsets` holding count + 1 entries.
+typedef struct {
+    int kind; // wxd_ListSortKeyKind
+    const int64_t* int_keys;
+    const double* double_keys;
+    const char* text;
+    const uint32_t* text_offsets;
+} wxd_ListSortKeys;
+
+/**
+ * Sorts a non-virtual list by precomputed keys without calling back for comparisons. `count`
+ * must equal the item count. The sort is stable; item data and per-item state move with their
+ * rows.
+ */
+WXD_EXPORTED bool
+wxd_ListCtrl_SortItemsByKeys(wxd_ListCtrl_t* self, const wxd_ListSortKeys* keys, int64_t count,
+                             bool ascending);
 WXD_EXPORTED void
 wxd_ListCtrl_ShowSortIndicator(wxd_ListCtrl_t* self, int col, bool ascending);
 
@@ -216,6 +216,33 @@ wxd_Menu_UpdateUI(wxd_Menu_t* menu, wxd_EvtHandler_t* source);
 WXD_EXPORTED void
 wxd_Menu_Break(wxd_Menu_t* menu);
 
+/**
+ * @brief Append `count` items in one call.
+ * Item i has id `ids[i]` and kind `kinds[i]` (a WXD_ITEM_* value; NULL appends normal items).
+ * Its UTF-8 label is text[offsets[2i]..offsets[2i + 1]) and its help string
+ * text[offsets[2i + 1]..offsets[2i + 2]), so `offsets` has 2 * count + 1 entries. Separators
+ * ignore their id and text. Returns the number of items appended.
+ */
+WXD_EXPORTED size_t
+wxd_Menu_AppendItems(wxd_Menu_t* menu, const wxd_Id* ids, const int32_t* kinds, const char* text,
+                     const uint32_t* offsets, size_t count);
+
+// Fills a lazy submenu; `submenu` is empty when this is called.
+typedef void (*wxd_MenuPopulateCallback)(void* user_data, wxd_Menu_t* submenu);
+
+/**
+ * @brief Append a submenu whose items are created by `populate` when it first opens.
+ * Until then the submenu holds a disabled placeholder item, which also stands in when
+ * `populate` adds nothing. With `refill`, the submenu is cleared and populated again each time
+ * it opens (for lists that change, like recent files). The submenu owns `user_data` and passes
+ * it to `free_user_data`, if set, when it is deleted. Returns NULL, leaving `user_data` with the
+ * caller, if `menu` or `populate` is NULL.
+ */
+WXD_EXPORTED const wxd_MenuItem_t*
+wxd_Menu_AppendLazySubMenu(wxd_Menu_t* menu, const char* title, const char* helpString,
+                           bool refill, wxd_MenuPopulateCallback populate, void* user_data,
+                           void (*free_user_data)(void*));
+
 // --- MenuBar Extended Functions ---
 
 /**
@@ -320,4 +347,48 @@ wxd_MenuItem_SetBitmap(wxd_MenuItem_t* item, const wxd_Bitmap_t* bitmap);
 WXD_EXPORTED wxd_Bitmap_t*
 wxd_MenuItem_GetBitmap(const wxd_MenuItem_t* item);
 
+// --- Batched UpdateUI ---
+// Instead of one wxEVT_UPDATE_UI per item and idle pass, registered command ids are polled
+// together once per interval: the callback fills two packed bitsets (bit i for ids[i]) and
+// only items whose state changed are updated in the window's menubar, its frame toolbar and
+// any toolbar added with wxd_UpdateUIAggregator_AddToolBar. Polling pauses while the window
+// is not shown on screen. Main thread only.
+
+// Receives the registered ids in ascending order; both bitsets arrive zeroed, (count + 7) / 8
+// bytes long. checked bits are ignored for ids registered as not checkable.
+typedef void (*wxd_UpdateUIAggregator_Callback)(void* user_data, const int* ids, size_t count,
+                                                uint8_t* enabled_bits, uint8_t* checked_bits);
+typedef void (*wxd_UpdateUIAggregator_FreeUserData)(void* user_data);
+
+// Creates an aggregator for `window` (usually a frame). user_data is released with
+// free_user_data when the window is destroyed or the aggregator is, whichever comes first;
+// it is also released if creation fails.
+WXD_EXPORTED wxd_UpdateUIAggregator_t*
+wxd_UpdateUIAggregator_Create(wxd_Window_t* window, int interval_ms,
+                              wxd_UpdateUIAggregator_Callback callback, void* user_data,
+                              wxd_UpdateUIAggregator_FreeUserData free_user_data);
+
+// Stops polling and frees the handle. The window may already have been destroyed.
+WXD_EXPORTED void
+wxd_UpdateUIAggregator_Destroy(wxd_UpdateUIAggregator_t* aggregator);
+
+// Adds `id` to the polled set (or updates whether its check state is managed).
+WXD_EXPORTED void
+wxd_UpdateUIAggregator_Register(wxd_UpdateUIAggregator_t* aggregator, wxd_Id id, bool checkable);
+
+WXD_EXPORTED void
+wxd_UpdateUIAggregator_Unregister(wxd_UpdateUIAggregator_t* aggregator, wxd_Id id);
+
+// Also applies state to `toolbar`, e.g. one that is not the frame's own toolbar.
+WXD_EXPORTED void
+wxd_UpdateUIAggregator_AddToolBar(wxd_UpdateUIAggregator_t* aggregator, wxd_ToolBar_t* toolbar);
+
+WXD_EXPORTED void
+wxd_UpdateUIAggregator_SetInterval(wxd_UpdateUIAggregator_t* aggregator, int interval_ms);
+
+// Runs a collection pass immediately. With `force`, every item is re-applied, not just the
+// ones whose state changed.
+WXD_EXPORTED void
+wxd_UpdateUIAggregator_UpdateNow(wxd_UpdateUIAggregator_t* aggregator, bool force);
+
 #endif // WXD_MENU_H
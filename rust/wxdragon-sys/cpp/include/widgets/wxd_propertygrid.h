@@ -21,6 +21,28 @@
 extern "C" {
 #endif
 
+/**
+ * Handle of a property appended through this API. Handles stay valid for the
+ * property's lifetime and are never reused: once the property is deleted (directly,
+ * through its parent, Clear, or the grid's destruction) every call given its handle
+ * fails as if the property did not exist. 0 is never a valid handle.
+ */
+typedef uint64_t wxd_PGPropertyHandle;
+
+/** Property kinds in a wxd_PropertyGrid_AppendProperties schema. */
+typedef enum {
+    WXD_PG_KIND_CATEGORY = 0,
+    WXD_PG_KIND_STRING = 1,
+    WXD_PG_KIND_INT = 2,
+    WXD_PG_KIND_UINT = 3,
+    WXD_PG_KIND_FLOAT = 4,
+    WXD_PG_KIND_BOOL = 5,
+    WXD_PG_KIND_ENUM = 6,
+    WXD_PG_KIND_FLAGS = 7,
+    WXD_PG_KIND_FILE = 8,
+    WXD_PG_KIND_DIR = 9,
+} wxd_PGPropertyKind;
+
 /** Create a wxPropertyGrid owned by parent. */
 WXD_EXPORTED wxd_PropertyGrid_t*
 wxd_PropertyGrid_Create(wxd_Window_t* parent, wxd_Id id, wxd_Point pos, wxd_Size size,
@@ -35,29 +57,30 @@ wxd_PropertyGrid_Contains(wxd_PropertyGrid_t* self, const char* name);
  *
  * parent_name may be NULL or empty to append at the root. name may be NULL or
  * empty, in which case wxWidgets derives the property name from label. The grid
- * takes ownership of every successfully appended property.
+ * takes ownership of every successfully appended property. Each function returns
+ * the new property's handle, or 0 on failure.
  */
-WXD_EXPORTED bool
+WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendCategory(wxd_PropertyGrid_t* self, const char* parent_name,
                                 const char* label, const char* name);
 
-WXD_EXPORTED bool
+WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendString(wxd_PropertyGrid_t* self, const char* parent_name,
                               const char* label, const char* name, const char* value);
 
-WXD_EXPORTED bool
+WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendInt(wxd_PropertyGrid_t* self, const char* parent_name,
                            const char* label, const char* name, int64_t value);
 
-WXD_EXPORTED bool
+WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendUInt(wxd_PropertyGrid_t* self, const char* parent_name,
                             const char* label, const char* name, uint64_t value);
 
-WXD_EXPORTED bool
+WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendFloat(wxd_PropertyGrid_t* self, const char* parent_name,
                              const char* label, const char* name, double value);
 
-WXD_EXPORTED bool
+WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendBool(wxd_PropertyGrid_t* self, const char* parent_name,
                             const char* label, const char* name, bool value);
 
@@ -65,7 +88,7 @@ wxd_PropertyGrid_AppendBool(wxd_PropertyGrid_t* self, const char* parent_name,
  * Append an enum property. values may be NULL to use 0..choice_count-1.
  * Each labels entry must be a valid UTF-8 string.
  */
-WXD_EXPORTED bool
+WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendEnum(wxd_PropertyGrid_t* self, const char* parent_name,
                             const char* label, const char* name,
                             const char* const* labels, const int32_t* values,
@@ -75,20 +98,45 @@ wxd_PropertyGrid_AppendEnum(wxd_PropertyGrid_t* self, const char* parent_name,
  * Append a bit-flags property. wxFlagsProperty uses a 32-bit-compatible value
  * set on Windows, so flag values and the combined value are explicitly int32_t.
  */
-WXD_EXPORTED bool
+WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendFlags(wxd_PropertyGrid_t* self, const char* parent_name,
                              const char* label, const char* name,
                              const char* const* labels, const int32_t* values,
                              size_t choice_count, int32_t value);
 
-WXD_EXPORTED bool
+WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendFile(wxd_PropertyGrid_t* self, const char* parent_name,
                             const char* label, const char* name, const char* value);
 
-WXD_EXPORTED bool
+WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendDir(wxd_PropertyGrid_t* self, const char* parent_name,
                            const char* label, const char* name, const char* value);
 
+/** Creates the children of a lazy category; `category` is its handle. */
+typedef void (*wxd_PGPopulateCallback)(void* user_data, wxd_PGPropertyHandle category);
+
+/**
+ * Append a collapsed category whose children are appended by `populate` when it is first
+ * expanded, by the user or through Expand/ExpandAll, so only browsed categories cost anything.
+ * Until then a disabled placeholder child keeps it expandable. With release_when_collapsed, the
+ * children are deleted again on collapse (retiring their handles) and recreated on the next
+ * expand. `populate` must not delete the category. The category owns `user_data` and passes it
+ * to `free_user_data`, if set, when it is deleted. Returns 0, leaving `user_data` with the
+ * caller, on failure or if `populate` is NULL.
+ */
+WXD_EXPORTED wxd_PGPropertyHandle
+wxd_PropertyGrid_AppendLazyCategory(wxd_PropertyGrid_t* self, const char* parent_name,
+                                    const char* label, const char* name,
+                                    wxd_PGPopulateCallback populate, void* user_data,
+                                    void (*free_user_data)(void*), bool release_when_collapsed);
+
+/**
+ * Populate a lazy category now if it is still pending, without expanding it (e.g. before
+ * searching or with categories hidden). Returns false if the property is not a lazy category.
+ */
+WXD_EXPORTED bool
+wxd_PropertyGrid_PopulateLazyCategory(wxd_PropertyGrid_t* self, const char* name);
+
 /* Value access. Returned variants are owned by the caller. */
 WXD_EXPORTED wxd_Variant_t*
 wxd_PropertyGrid_GetValue(const wxd_PropertyGrid_t* self, const char* name);
@@ -203,6 +251,124 @@ wxd_PropertyGrid_CenterSplitter(wxd_PropertyGrid_t* self, bool enable_auto_resiz
 WXD_EXPORTED void
 wxd_PropertyGrid_Refresh(wxd_PropertyGrid_t* self);
 
+/*
+ * Handle-based access. Each function behaves like its name-based counterpart
+ * above but resolves the property without a name lookup or string conversion.
+ */
+WXD_EXPORTED bool
+wxd_PropertyGrid_ContainsHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle);
+
+/** Return the handle of a property appended through this API, or 0. */
+WXD_EXPORTED wxd_PGPropertyHandle
+wxd_PropertyGrid_GetPropertyHandle(wxd_PropertyGrid_t* self, const char* name);
+
+WXD_EXPORTED wxd_Variant_t*
+wxd_PropertyGrid_GetValueByHandle(const wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle);
+
+WXD_EXPORTED bool
+wxd_PropertyGrid_SetValueByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                  const wxd_Variant_t* value);
+
+WXD_EXPORTED bool
+wxd_PropertyGrid_ChangeValueByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                     const wxd_Variant_t* value);
+
+WXD_EXPORTED bool
+wxd_PropertyGrid_ClearValueByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle);
+
+WXD_EXPORTED int
+wxd_PropertyGrid_GetValueAsStringByHandle(const wxd_PropertyGrid_t* self,
+                                          wxd_PGPropertyHandle handle, char* out, size_t out_len);
+
+WXD_EXPORTED int
+wxd_PropertyGrid_GetLabelByHandle(const wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                  char* out, size_t out_len);
+
+WXD_EXPORTED bool
+wxd_PropertyGrid_SetLabelByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                  const char* label);
+
+WXD_EXPORTED int
+wxd_PropertyGrid_GetHelpStringByHandle(const wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                       char* out, size_t out_len);
+
+WXD_EXPORTED bool
+wxd_PropertyGrid_SetHelpStringByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                       const char* help_string);
+
+WXD_EXPORTED bool
+wxd_PropertyGrid_SetAttributeByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                      const char* attribute_name, const wxd_Variant_t* value);
+
+WXD_EXPORTED bool
+wxd_PropertyGrid_EnablePropertyByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                        bool enable);
+
+WXD_EXPORTED bool
+wxd_PropertyGrid_HidePropertyByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                      bool hide);
+
+WXD_EXPORTED bool
+wxd_PropertyGrid_SetPropertyReadOnlyByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                             bool read_only);
+
+WXD_EXPORTED bool
+wxd_PropertyGrid_IsPropertyEnabledByHandle(const wxd_PropertyGrid_t* self,
+                                           wxd_PGPropertyHandle handle);
+
+WXD_EXPORTED bool
+wxd_PropertyGrid_IsPropertyHiddenByHandle(const wxd_PropertyGrid_t* self,
+                                          wxd_PGPropertyHandle handle);
+
+WXD_EXPORTED bool
+wxd_PropertyGrid_IsPropertyExpandedByHandle(const wxd_PropertyGrid_t* self,
+                                            wxd_PGPropertyHandle handle);
+
+WXD_EXPORTED bool
+wxd_PropertyGrid_IsPropertyCategoryByHandle(const wxd_PropertyGrid_t* self,
+                                            wxd_PGPropertyHandle handle);
+
+WXD_EXPORTED bool
+wxd_PropertyGrid_IsPropertyModifiedByHandle(const wxd_PropertyGrid_t* self,
+                                            wxd_PGPropertyHandle handle);
+
+WXD_EXPORTED bool
+wxd_PropertyGrid_ExpandByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle);
+
+WXD_EXPORTED bool
+wxd_PropertyGrid_CollapseByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle);
+
+WXD_EXPORTED bool
+wxd_PropertyGrid_SelectPropertyByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                        bool focus);
+
+WXD_EXPORTED bool
+wxd_PropertyGrid_PopulateLazyCategoryByHandle(wxd_PropertyGrid_t* self,
+                                              wxd_PGPropertyHandle handle);
+
+WXD_EXPORTED bool
+wxd_PropertyGrid_DeletePropertyByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle);
+
+/*
+ * Bulk population. The schema is little-endian: u32 count, then per property
+ * u8 kind (wxd_PGPropertyKind), i32 parent_index (an earlier entry of the same
+ * schema, or -1), parent_name, label, name (strings are u32 length + UTF-8; an
+ * empty parent_name with parent_index -1 means the root) and the kind's value:
+ * a string for STRING/FILE/DIR, i64 INT, u64 UINT, f64 FLOAT, u8 BOOL, or for
+ * ENUM/FLAGS u32 choice count, (label, i32 value) per choice, and i32 value.
+ * Properties are appended in order while the grid is frozen. out_handles (may
+ * be NULL) receives one handle per entry, 0 for entries that were rejected.
+ * Returns the number appended, or -1 if the schema is malformed.
+ */
+WXD_EXPORTED int
+wxd_PropertyGrid_AppendProperties(wxd_PropertyGrid_t* self, const uint8_t* schema, size_t len,
+                                  wxd_PGPropertyHandle* out_handles);
+
+/** Set count values without validation or change events, with one repaint. */
+WXD_EXPORTED size_t
+wxd_PropertyGrid_SetValues(wxd_PropertyGrid_t* self, const wxd_PGPropertyHandle* handles,
+                           const wxd_Variant_t* const* values, size_t count);
+
 /* wxPropertyGridEvent accessors. Event values are cloned for the caller. */
 WXD_EXPORTED int
 wxd_PropertyGridEvent_GetPropertyName(wxd_Event_t* event, char* out, size_t out_len);
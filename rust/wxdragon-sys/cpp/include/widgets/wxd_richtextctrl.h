@@ -24,6 +24,28 @@ wxd_RichTextCtrl_Clear(wxd_RichTextCtrl_t* self);
 WXD_EXPORTED int
 wxd_RichTextCtrl_GetLength(wxd_RichTextCtrl_t* self);
 
+// Bulk styled append. Each run's text is written with palette[run.style] (-1 or out of range:
+// the default style). Everything is appended at the end with the control frozen and undo
+// suppressed, so the buffer is laid out once. `text` is UTF-8 and need not be terminated.
+typedef struct {
+    wxd_Colour_t text_colour; // alpha 0 leaves the colour unchanged
+    wxd_Colour_t background_colour; // alpha 0 leaves the background unchanged
+    int font_size; // points; 0 leaves the size unchanged
+    bool bold;
+    bool italic;
+    bool underline;
+} wxd_RichTextRunStyle;
+
+typedef struct {
+    const char* text;
+    size_t len;
+    int style;
+} wxd_RichTextRun;
+
+WXD_EXPORTED bool
+wxd_RichTextCtrl_AppendRuns(wxd_RichTextCtrl_t* self, const wxd_RichTextRunStyle* palette,
+                            size_t palette_len, const wxd_RichTextRun* runs, size_t count);
+
 // Text range operations
 WXD_EXPORTED int
 wxd_RichTextCtrl_GetRange(wxd_RichTextCtrl_t* self, wxd_Long_t from, wxd_Long_t to, char* buffer,
@@ -79,6 +101,18 @@ wxd_RichTextCtrl_LoadFile(wxd_RichTextCtrl_t* self, const char* filename, int ty
 WXD_EXPORTED bool
 wxd_RichTextCtrl_SaveFile(wxd_RichTextCtrl_t* self, const char* filename, int type);
 
+// In-memory serialization. `type` is a wxRICHTEXT_TYPE_* value; the XML and HTML handlers are
+// registered on first use. LoadFromBuffer reads `data` in place and replaces the content; with
+// wxRICHTEXT_TYPE_ANY it picks XML for data starting with "<?xml" and plain text otherwise.
+// HTML can only be saved.
+WXD_EXPORTED bool
+wxd_RichTextCtrl_LoadFromBuffer(wxd_RichTextCtrl_t* self, const uint8_t* data, size_t len,
+                                int type);
+// Returns the serialized content (ANY saves XML) as owned bytes to release with
+// wxd_String_Free, or NULL if no handler can save it.
+WXD_EXPORTED wxd_String_t*
+wxd_RichTextCtrl_SaveToBuffer(wxd_RichTextCtrl_t* self, int type);
+
 // Style operations
 WXD_EXPORTED bool
 wxd_RichTextCtrl_SetStyleRange(wxd_RichTextCtrl_t* self, wxd_Long_t start, wxd_Long_t end,
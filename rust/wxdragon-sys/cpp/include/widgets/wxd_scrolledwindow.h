@@ -30,4 +30,50 @@ wxd_ScrolledWindow_GetVirtualSize(wxd_ScrolledWindow_t* self, int* w, int* h);
 WXD_EXPORTED void
 wxd_ScrolledWindow_GetScrollPixelsPerUnit(wxd_ScrolledWindow_t* self, int* xUnit, int* yUnit);
 
+// --- Tile cache ---
+// Renders the virtual area in fixed-size tiles kept in an LRU under `memory_budget` bytes, and
+// composites them on paint, so scrolling mostly blits cached bitmaps. Replaces the window's own
+// painting while enabled.
+//
+// `render` is called on the GUI thread for each missing visible tile with a DC onto a tile
+// bitmap at the window's content `scale`, already cleared to the background colour; `tile` is in
+// virtual (unscrolled) pixels and the DC draws in virtual coordinates. Returning false defers the
+// tile: it shows the background until wxd_ScrolledWindow_SetTileRGBA supplies its pixels with
+// the same `ticket`, e.g. from a worker thread's result.
+typedef bool (*wxd_ScrolledWindow_TileRenderCallback)(void* user_data, wxd_DC_t* dc,
+                                                      wxd_Rect tile, double scale,
+                                                      uint64_t ticket);
+typedef void (*wxd_ScrolledWindow_FreeUserData)(void* user_data);
+
+// Replaces any previous tile cache. `free_user_data` runs when the cache is disabled, replaced
+// or the window destroyed (or immediately if this fails).
+WXD_EXPORTED bool
+wxd_ScrolledWindow_EnableTileCache(wxd_ScrolledWindow_t* self, int tile_width, int tile_height,
+                                   size_t memory_budget,
+                                   wxd_ScrolledWindow_TileRenderCallback render, void* user_data,
+                                   wxd_ScrolledWindow_FreeUserData free_user_data);
+
+WXD_EXPORTED void
+wxd_ScrolledWindow_DisableTileCache(wxd_ScrolledWindow_t* self);
+
+// Supplies a deferred tile as `width` x `height` straight RGBA pixels (physical pixels, i.e.
+// tile size times scale). Returns false if the tile was invalidated or re-requested since.
+WXD_EXPORTED bool
+wxd_ScrolledWindow_SetTileRGBA(wxd_ScrolledWindow_t* self, int column, int row, uint64_t ticket,
+                               const unsigned char* rgba, int width, int height);
+
+// Drops cached and pending tiles intersecting `area` (virtual pixels) and repaints them.
+WXD_EXPORTED void
+wxd_ScrolledWindow_InvalidateTiles(wxd_ScrolledWindow_t* self, wxd_Rect area);
+
+WXD_EXPORTED void
+wxd_ScrolledWindow_InvalidateAllTiles(wxd_ScrolledWindow_t* self);
+
+WXD_EXPORTED void
+wxd_ScrolledWindow_SetTileCacheBudget(wxd_ScrolledWindow_t* self, size_t memory_budget);
+
+// Bytes of tile bitmaps currently cached.
+WXD_EXPORTED size_t
+wxd_ScrolledWindow_GetTileCacheUsage(wxd_ScrolledWindow_t* self);
+
 #endif // WXD_SCROLLEDWINDOW_H
\ No newline at end of file
@@ -31,4 +31,12 @@ wxd_SplitterWindow_GetSashPosition(wxd_SplitterWindow_t* self);
 WXD_EXPORTED void
 wxd_SplitterWindow_SetMinimumPaneSize(wxd_SplitterWindow_t* self, int paneSize);
 
+// Sets how sash drags update the panes (wxd_LiveResizeMode). THROTTLED turns on live update but
+// lays the panes out at most once per `interval_ms` (0 = 16), always ending on the final
+// position. SNAPSHOT leaves the panes alone during the drag and shows a stretched picture of
+// them instead, captured when the drag starts (plain pane backgrounds where the platform cannot
+// read back window contents); the real layout happens once on release. NATIVE removes either.
+WXD_EXPORTED bool
+wxd_SplitterWindow_SetLiveResizeMode(wxd_SplitterWindow_t* self, int mode, uint32_t interval_ms);
+
 #endif // WXD_SPLITTERWINDOW_H
\ No newline at end of file
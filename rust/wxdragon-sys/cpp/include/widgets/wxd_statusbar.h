@@ -13,6 +13,11 @@ wxd_StatusBar_SetFieldsCount(wxd_StatusBar_t* self, int count);
 WXD_EXPORTED void
 wxd_StatusBar_SetStatusText(wxd_StatusBar_t* self, const char* text, int fieldIndex);
 
+// Frame-paced variant: keeps only the newest text per field and applies it at most once per
+// display frame, skipping the native call if the field already shows it.
+WXD_EXPORTED void
+wxd_StatusBar_SetStatusTextDeferred(wxd_StatusBar_t* self, const char* text, int fieldIndex);
+
 WXD_EXPORTED void
 wxd_StatusBar_SetStatusWidths(wxd_StatusBar_t* self, int count, const int* widths);
 
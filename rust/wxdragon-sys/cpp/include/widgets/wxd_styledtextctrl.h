@@ -15,8 +15,19 @@ WXD_EXPORTED void
 wxd_StyledTextCtrl_SetText(wxd_StyledTextCtrl_t* self, const char* text);
 WXD_EXPORTED int
 wxd_StyledTextCtrl_GetText(wxd_StyledTextCtrl_t* self, char* buffer, int buffer_len);
+// Single-call variant; free the result with wxd_String_Free. Returns NULL if self is NULL.
+WXD_EXPORTED wxd_String_t*
+wxd_StyledTextCtrl_GetTextOwned(wxd_StyledTextCtrl_t* self);
 WXD_EXPORTED void
 wxd_StyledTextCtrl_AppendText(wxd_StyledTextCtrl_t* self, const char* text);
+// Console (tail) mode, as wxd_TextCtrl_SetConsoleMode. Text is added as raw bytes, undo
+// collection is off while enabled, and read-only controls are still appended to.
+WXD_EXPORTED void
+wxd_StyledTextCtrl_SetConsoleMode(wxd_StyledTextCtrl_t* self, bool enable, int max_lines);
+WXD_EXPORTED void
+wxd_StyledTextCtrl_ConsoleAppend(wxd_StyledTextCtrl_t* self, const char* text, size_t len);
+WXD_EXPORTED void
+wxd_StyledTextCtrl_ConsoleFlush(wxd_StyledTextCtrl_t* self);
 WXD_EXPORTED void
 wxd_StyledTextCtrl_InsertText(wxd_StyledTextCtrl_t* self, int pos, const char* text);
 WXD_EXPORTED void
@@ -25,6 +36,87 @@ WXD_EXPORTED void
 wxd_StyledTextCtrl_DeleteRange(wxd_StyledTextCtrl_t* self, int start, int length);
 WXD_EXPORTED int
 wxd_StyledTextCtrl_GetLength(wxd_StyledTextCtrl_t* self);
+
+// Releases the user data passed with a callback.
+typedef void (*wxd_StyledTextCtrl_FreeUserData)(void* user_data);
+
+// Bulk loading. Replaces the document with raw UTF-8 bytes fed to Scintilla in chunks with
+// undo collection and modification notifications off and styling deferred to idle time; the
+// result has no undo history and is marked unmodified. Returns false if self is NULL or the
+// data exceeds the control's 2 GiB position range.
+WXD_EXPORTED bool
+wxd_StyledTextCtrl_LoadFromBytes(wxd_StyledTextCtrl_t* self, const uint8_t* data, size_t len);
+// Called after each chunk of a file load; return false to cancel. `done` is set on the final
+// call, with `loaded < total` if the load was cancelled or a read failed.
+typedef bool (*wxd_StyledTextCtrl_LoadProgressCallback)(void* user_data, uint64_t loaded,
+                                                        uint64_t total, bool done);
+// Loads the file at the UTF-8 `path` like LoadFromBytes, without an intermediate string. With
+// `incremental` the function returns once the file is open and chunks are added in idle time,
+// the control being read-only until the last one; otherwise it loads synchronously. Returns
+// false if the file cannot be opened, in which case `progress` is not called. `free_user_data`
+// runs after the final progress call or when the control is destroyed.
+WXD_EXPORTED bool
+wxd_StyledTextCtrl_LoadFileFast(wxd_StyledTextCtrl_t* self, const char* path, bool incremental,
+                                wxd_StyledTextCtrl_LoadProgressCallback progress,
+                                void* user_data,
+                                wxd_StyledTextCtrl_FreeUserData free_user_data);
+// Stops an incremental load, keeping what has been loaded; the final progress call is made.
+WXD_EXPORTED void
+wxd_StyledTextCtrl_CancelLoad(wxd_StyledTextCtrl_t* self);
+
+// Background find-all. The document is copied and searched on a worker thread for `pattern`
+// (UTF-8) with the wxSTC_FIND_MATCHCASE / WHOLEWORD / REGEXP bits of `search_flags`; regular
+// expressions use ECMAScript syntax and match within a line, and case folding is ASCII only.
+// Previous fills of `indicator` are cleared, then matches are filled with it (and `value`) in
+// batches from the event loop, the lines on screen first. The search is cancelled by the next
+// text insertion or deletion, a new FindAllAsync on the control or CancelFindAll. `callback`
+// gets the number of matches filled and whether the search completed; `free_user_data` runs
+// after it, or when the control is destroyed. Returns false, without a callback, if the
+// pattern is empty or an invalid regular expression.
+typedef void (*wxd_StyledTextCtrl_FindAllCallback)(void* user_data, uint64_t matches,
+                                                   bool completed);
+WXD_EXPORTED bool
+wxd_StyledTextCtrl_FindAllAsync(wxd_StyledTextCtrl_t* self, const char* pattern,
+                                int search_flags, int indicator, int value,
+                                wxd_StyledTextCtrl_FindAllCallback callback, void* user_data,
+                                wxd_StyledTextCtrl_FreeUserData free_user_data);
+WXD_EXPORTED void
+wxd_StyledTextCtrl_CancelFindAll(wxd_StyledTextCtrl_t* self);
+
+// Document sharing. Views showing the same document share one text buffer, one undo history
+// and one styling pass (each view keeps its own selection, scroll position and folding).
+// GetDocument returns a new handle holding a reference to the control's document; release it
+// with wxd_StcDocument_Release once no longer needed, which does not affect controls showing the
+// document. SetDocument makes the control show `document`, letting go of its previous document
+// (freed once nothing else refers to it); it ends a running file load or find-all. Handles stop
+// resolving (IsValid returns false, SetDocument fails) once every control that took part in
+// sharing is destroyed. Returns NULL if self is NULL.
+WXD_EXPORTED wxd_StcDocument_t*
+wxd_StyledTextCtrl_GetDocument(wxd_StyledTextCtrl_t* self);
+WXD_EXPORTED bool
+wxd_StyledTextCtrl_SetDocument(wxd_StyledTextCtrl_t* self, wxd_StcDocument_t* document);
+// Adds a reference to the handle and returns it.
+WXD_EXPORTED wxd_StcDocument_t*
+wxd_StcDocument_AddRef(wxd_StcDocument_t* document);
+WXD_EXPORTED void
+wxd_StcDocument_Release(wxd_StcDocument_t* document);
+WXD_EXPORTED bool
+wxd_StcDocument_IsValid(const wxd_StcDocument_t* document);
+WXD_EXPORTED bool
+wxd_StcDocument_IsShownBy(const wxd_StcDocument_t* document, wxd_StyledTextCtrl_t* self);
+
+// Zero-copy access to Scintilla's UTF-8 buffer. The pointers borrow the document and stay
+// valid only until it is next modified. GetCharacterPointer closes the editing gap (one move)
+// and stores the byte count in `length`; GetRangePointer only closes it if the range spans it.
+WXD_EXPORTED const char*
+wxd_StyledTextCtrl_GetCharacterPointer(wxd_StyledTextCtrl_t* self, size_t* length);
+WXD_EXPORTED const char*
+wxd_StyledTextCtrl_GetRangePointer(wxd_StyledTextCtrl_t* self, int start, int length);
+// Copies the bytes of [start, end) into `buffer` without conversion or terminator. Returns the
+// byte length of the range (copying at most `buffer_len`), or -1 on error.
+WXD_EXPORTED int
+wxd_StyledTextCtrl_GetTextRangeRaw(wxd_StyledTextCtrl_t* self, int start, int end, char* buffer,
+                                   int buffer_len);
 WXD_EXPORTED int
 wxd_StyledTextCtrl_GetLineCount(wxd_StyledTextCtrl_t* self);
 WXD_EXPORTED int
@@ -96,6 +188,11 @@ wxd_StyledTextCtrl_MarkerDefine(wxd_StyledTextCtrl_t* self, int markerNumber, in
                                 wxd_Colour_t foreground, wxd_Colour_t background);
 WXD_EXPORTED int
 wxd_StyledTextCtrl_MarkerAdd(wxd_StyledTextCtrl_t* self, int line, int markerNumber);
+// Adds `markerNumber` to each of the `count` lines in `lines` with repainting suspended once.
+// Returns how many markers were added (invalid lines are skipped).
+WXD_EXPORTED size_t
+wxd_StyledTextCtrl_MarkerAddLines(wxd_StyledTextCtrl_t* self, const int32_t* lines, size_t count,
+                                  int markerNumber);
 WXD_EXPORTED void
 wxd_StyledTextCtrl_MarkerDelete(wxd_StyledTextCtrl_t* self, int line, int markerNumber);
 WXD_EXPORTED void
@@ -134,6 +231,41 @@ WXD_EXPORTED void
 wxd_StyledTextCtrl_StartStyling(wxd_StyledTextCtrl_t* self, int start);
 WXD_EXPORTED void
 wxd_StyledTextCtrl_SetStyling(wxd_StyledTextCtrl_t* self, int length, int style);
+// Styles `length` bytes from `start` with one style byte each, in a single call.
+WXD_EXPORTED void
+wxd_StyledTextCtrl_SetStyleBytes(wxd_StyledTextCtrl_t* self, int start, const uint8_t* styles,
+                                 int length);
+// Position up to which the text is known to be styled.
+WXD_EXPORTED int
+wxd_StyledTextCtrl_GetEndStyled(wxd_StyledTextCtrl_t* self);
+
+// Incremental styling. Switches the control to the container lexer and calls `callback` on
+// every SCN_STYLENEEDED with the range [start, end) still to be styled: `start` is the
+// beginning of the first line past the styled end, `end` the last position about to be shown.
+// The callback styles it, typically with one wxd_StyledTextCtrl_SetStyleBytes call. A null
+// `callback` removes the hook; `free_user_data` runs when it is replaced or the control is
+// destroyed.
+typedef void (*wxd_StyledTextCtrl_StyleNeededCallback)(void* user_data, int start, int end);
+WXD_EXPORTED void
+wxd_StyledTextCtrl_SetStyleNeededCallback(wxd_StyledTextCtrl_t* self,
+                                          wxd_StyledTextCtrl_StyleNeededCallback callback,
+                                          void* user_data,
+                                          wxd_StyledTextCtrl_FreeUserData free_user_data);
+
+// Indicators
+WXD_EXPORTED void
+wxd_StyledTextCtrl_IndicatorSetStyle(wxd_StyledTextCtrl_t* self, int indicator, int style);
+WXD_EXPORTED void
+wxd_StyledTextCtrl_IndicatorSetForeground(wxd_StyledTextCtrl_t* self, int indicator,
+                                          wxd_Colour_t colour);
+// Fills `count` (start, length) pairs from `ranges` with `indicator` (and `value`), in one call
+// with repainting suspended.
+WXD_EXPORTED void
+wxd_StyledTextCtrl_IndicatorFillRanges(wxd_StyledTextCtrl_t* self, int indicator, int value,
+                                       const int32_t* ranges, size_t count);
+WXD_EXPORTED void
+wxd_StyledTextCtrl_IndicatorClearRange(wxd_StyledTextCtrl_t* self, int indicator, int start,
+                                       int length);
 
 // Lexer and language support
 WXD_EXPORTED void
@@ -289,6 +421,11 @@ wxd_StyledTextCtrl_CallTipSetHighlight(wxd_StyledTextCtrl_t* self, int highlight
 // Folding operations
 WXD_EXPORTED void
 wxd_StyledTextCtrl_SetFoldLevel(wxd_StyledTextCtrl_t* self, int line, int level);
+// Sets the fold level of `count` consecutive lines starting at `firstLine` from `levels`, with
+// repainting suspended once. Levels beyond the last line are ignored.
+WXD_EXPORTED void
+wxd_StyledTextCtrl_SetFoldLevels(wxd_StyledTextCtrl_t* self, int firstLine, const int32_t* levels,
+                                 size_t count);
 WXD_EXPORTED int
 wxd_StyledTextCtrl_GetFoldLevel(wxd_StyledTextCtrl_t* self, int line);
 WXD_EXPORTED void
@@ -34,6 +34,12 @@ bool
 wxd_TaskBarIcon_SetIconBundle(wxd_TaskBarIcon_t* taskbar, const wxd_BitmapBundle_t* iconBundle,
                               const char* tooltip);
 
+// Converts `count` frames to icons once and cycles them every `interval_ms` under the current
+// tooltip. A count of 0 stops the animation; SetIcon, SetIconBundle and RemoveIcon stop it too.
+bool
+wxd_TaskBarIcon_SetAnimationFrames(wxd_TaskBarIcon_t* taskbar, const wxd_Bitmap_t* const* bitmaps,
+                                   int count, int interval_ms);
+
 bool
 wxd_TaskBarIcon_RemoveIcon(wxd_TaskBarIcon_t* taskbar);
 
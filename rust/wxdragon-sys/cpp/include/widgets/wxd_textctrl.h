@@ -11,8 +11,23 @@ WXD_EXPORTED void
 wxd_TextCtrl_SetValue(wxd_TextCtrl_t* textCtrl, const char* value);
 WXD_EXPORTED int
 wxd_TextCtrl_GetValue(wxd_TextCtrl_t* textCtrl, char* buffer, int buffer_len);
+// Single-call variant; free the result with wxd_String_Free. Returns NULL if textCtrl is NULL.
+WXD_EXPORTED wxd_String_t*
+wxd_TextCtrl_GetValueOwned(wxd_TextCtrl_t* textCtrl);
 WXD_EXPORTED void
 wxd_TextCtrl_AppendText(wxd_TextCtrl_t* textCtrl, const char* text);
+// Console (tail) mode for high-rate logs. While enabled, ConsoleAppend buffers text and writes
+// it once per frame inside Freeze/Thaw, the oldest lines are trimmed beyond `max_lines` (0 keeps
+// everything) and the view follows new text only while the insertion point is at the end.
+// Enabling again only changes `max_lines`; disabling flushes pending text first.
+WXD_EXPORTED void
+wxd_TextCtrl_SetConsoleMode(wxd_TextCtrl_t* textCtrl, bool enable, int max_lines);
+// Appends `len` bytes of UTF-8. Buffered in console mode, immediate otherwise.
+WXD_EXPORTED void
+wxd_TextCtrl_ConsoleAppend(wxd_TextCtrl_t* textCtrl, const char* text, size_t len);
+// Writes buffered console text now.
+WXD_EXPORTED void
+wxd_TextCtrl_ConsoleFlush(wxd_TextCtrl_t* textCtrl);
 WXD_EXPORTED void
 wxd_TextCtrl_Clear(wxd_TextCtrl_t* textCtrl);
 WXD_EXPORTED void
@@ -146,6 +161,13 @@ WXD_EXPORTED int wxd_TextAttr_GetBulletStyle(wxd_TextAttr_t* attr);
 WXD_EXPORTED void
 wxd_TextCtrl_SetStyle(wxd_TextCtrl_t* textCtrl, wxd_Long_t start, wxd_Long_t end, const wxd_TextAttr_t* style);
 
+// Applies `count` runs, each styled with an entry of the `palette_len` attributes in `palette`,
+// under one Freeze/Thaw. Selection, insertion point and scroll position are restored. Runs with
+// an out-of-range palette index are skipped. Returns the number of runs applied.
+WXD_EXPORTED size_t
+wxd_TextCtrl_SetStyleRuns(wxd_TextCtrl_t* textCtrl, const wxd_TextStyleRun* runs, size_t count,
+                          const wxd_TextAttr_t* const* palette, size_t palette_len);
+
 WXD_EXPORTED wxd_TextAttr_t*
 wxd_TextCtrl_GetDefaultStyle(wxd_TextCtrl_t* textCtrl);
 
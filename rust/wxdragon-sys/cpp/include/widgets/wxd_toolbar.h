@@ -47,4 +47,34 @@ wxd_ToolBar_AddToolWithBundles(wxd_ToolBar_t* toolbar, wxd_Id id, const char* la
                                wxd_BitmapBundle_t* bitmap, wxd_BitmapBundle_t* bitmapDisabled,
                                const char* shortHelp, const char* longHelp);
 
+// One tool for wxd_ToolBar_AddTools and wxd_AuiToolBar_AddTools. Strings are UTF-8 and may be
+// NULL. A bundle takes precedence over a bitmap; tools naming the same bundle, or bitmaps that
+// share their data, share one bundle. WXD_ITEM_SEPARATOR adds a separator and ignores the rest.
+typedef struct {
+    wxd_Id id;
+    int kind; // WXDItemKindCEnum
+    const char* label;
+    const char* short_help;
+    const char* long_help;
+    const wxd_BitmapBundle_t* bundle;
+    const wxd_BitmapBundle_t* bundle_disabled;
+    const wxd_Bitmap_t* bitmap;
+    const wxd_Bitmap_t* bitmap_disabled;
+} wxd_ToolDesc;
+
+// Adds `count` tools and realizes the toolbar once. Returns the number of tools added.
+WXD_EXPORTED size_t
+wxd_ToolBar_AddTools(wxd_ToolBar_t* toolbar, const wxd_ToolDesc* tools, size_t count);
+
+// Shows or hides each tool `ids[i]` as `visible[i]` says. Only tools whose visibility changes
+// are touched, a shown tool returns to its original place, and the toolbar is realized once if
+// anything changed. Returns the number of tools changed.
+WXD_EXPORTED size_t
+wxd_ToolBar_SetToolsVisible(wxd_ToolBar_t* toolbar, const wxd_Id* ids, const bool* visible,
+                            size_t count);
+
+// False for a tool hidden by wxd_ToolBar_SetToolsVisible or not on the toolbar.
+WXD_EXPORTED bool
+wxd_ToolBar_IsToolVisible(wxd_ToolBar_t* toolbar, wxd_Id toolId);
+
 #endif // WXD_TOOLBAR_H
\ No newline at end of file
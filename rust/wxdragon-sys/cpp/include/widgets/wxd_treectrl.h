@@ -160,6 +160,16 @@ wxd_TreeCtrl_SelectAll(wxd_TreeCtrl_t* self);
 WXD_EXPORTED size_t
 wxd_TreeCtrl_GetSelections(wxd_TreeCtrl_t* self, wxd_TreeItemId_t** items, size_t max_items);
 
+/**
+ * Selects `items` (handles; invalid ones are skipped), after clearing the selection if
+ * `replace`. Single-selection trees take the first valid item. The per-item selection events
+ * are suppressed and one wxEVT_TREE_SEL_CHANGED for the last selected item (invalid if none)
+ * is sent at the end.
+ */
+WXD_EXPORTED void
+wxd_TreeCtrl_SelectItems(wxd_TreeCtrl_t* self, const wxd_TreeItemHandle* items, size_t count,
+                         bool replace);
+
 // --- Navigation functions ---
 
 // Gets the parent of the given item
@@ -271,6 +281,19 @@ wxd_TreeCtrl_ScrollTo(wxd_TreeCtrl_t* self, wxd_TreeItemId_t* itemId);
 WXD_EXPORTED void
 wxd_TreeCtrl_SortChildren(wxd_TreeCtrl_t* self, wxd_TreeItemId_t* itemId);
 
+/**
+ * Sorts the children of `parent` by precomputed keys, comparing no labels and calling back into
+ * no user code. `keys` holds one key per child in current child order, key i being the bytes
+ * [offsets[i], offsets[i + 1]) (count + 1 offsets); keys compare bytewise, a prefix before the
+ * longer key, and equal keys keep their order. With `recursive`, the keys cover all
+ * descendants in pre-order and every level is sorted. Returns false (leaving the order as it
+ * was) if `count` does not match or the tree was not created by wxd_TreeCtrl_Create.
+ */
+WXD_EXPORTED bool
+wxd_TreeCtrl_SortChildrenByKeys(wxd_TreeCtrl_t* self, wxd_TreeItemHandle parent,
+                                const uint8_t* keys, size_t keys_len, const uint32_t* offsets,
+                                size_t count, bool recursive);
+
 // Hit test - returns the item at the given point
 // flags receives information about the hit test result
 WXD_EXPORTED wxd_TreeItemId_t*
@@ -301,6 +324,147 @@ wxd_TreeCtrl_GetItemState(wxd_TreeCtrl_t* self, wxd_TreeItemId_t* itemId);
 WXD_EXPORTED void
 wxd_TreeCtrl_SetItemHasChildren(wxd_TreeCtrl_t* self, wxd_TreeItemId_t* itemId, bool has);
 
+// --- Value handles ---
+//
+// Traversal over wxd_TreeItemHandle values instead of heap-allocated wxd_TreeItemId_t, so
+// walking a large tree does not touch the allocator. 0 means "no item" in and out.
+
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeItemId_GetHandle(const wxd_TreeItemId_t* item_id);
+// A heap id for the APIs that take one; free with wxd_TreeItemId_Free. Null for 0.
+WXD_EXPORTED wxd_TreeItemId_t*
+wxd_TreeItemId_FromHandle(wxd_TreeItemHandle handle);
+
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeCtrl_GetRootItemHandle(wxd_TreeCtrl_t* self);
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeCtrl_GetSelectionHandle(wxd_TreeCtrl_t* self);
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeCtrl_GetFocusedItemHandle(wxd_TreeCtrl_t* self);
+// `cookie` is written by GetFirstChildHandle and advanced by GetNextChildHandle; it holds no
+// allocation and needs no cleanup.
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeCtrl_GetFirstChildHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item, void** cookie);
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeCtrl_GetNextChildHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item, void** cookie);
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeCtrl_GetLastChildHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item);
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeCtrl_GetNextSiblingHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item);
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeCtrl_GetPrevSiblingHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item);
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeCtrl_GetItemParentHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item);
+WXD_EXPORTED int
+wxd_TreeCtrl_GetItemTextByHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item, char* buffer,
+                                 size_t buffer_len);
+WXD_EXPORTED int64_t
+wxd_TreeCtrl_GetItemDataByHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item);
+WXD_EXPORTED bool
+wxd_TreeCtrl_ItemHasChildrenByHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item);
+WXD_EXPORTED bool
+wxd_TreeCtrl_IsExpandedByHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item);
+
+// --- Whole subtrees in one call ---
+
+// Flags of wxd_TreeNode::state.
+typedef enum {
+    WXD_TREE_NODE_EXPANDED = 0x01,
+    WXD_TREE_NODE_SELECTED = 0x02,
+    WXD_TREE_NODE_HAS_CHILDREN = 0x04,
+    WXD_TREE_NODE_BOLD = 0x08,         // TreeCtrl only
+    WXD_TREE_NODE_CHECKED = 0x10,      // TreeListCtrl only
+    WXD_TREE_NODE_UNDETERMINED = 0x20, // TreeListCtrl only, 3-state checkboxes
+} wxd_TreeNodeState;
+
+// One node of a flattened subtree; parents always come before their children.
+typedef struct {
+    uint64_t item;         // wxd_TreeItemHandle, or a TreeListCtrl item; ignored on insert
+    int32_t parent;        // index of the parent node, -1 for the node under the anchor
+    int32_t image;         // -1 for none
+    uint32_t label_offset; // label bytes in the accompanying UTF-8 text
+    uint32_t label_len;
+    uint32_t state; // wxd_TreeNodeState flags
+} wxd_TreeNode;
+
+typedef struct wxd_TreeSubtree_t wxd_TreeSubtree_t;
+
+/**
+ * Flattens `item` and its descendants down to `depth` levels below it (negative: all) into
+ * pre-order nodes; `item` itself is node 0. Free with wxd_TreeSubtree_Free.
+ */
+WXD_EXPORTED wxd_TreeSubtree_t*
+wxd_TreeCtrl_GetSubtree(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item, int32_t depth);
+WXD_EXPORTED const wxd_TreeNode*
+wxd_TreeSubtree_GetNodes(const wxd_TreeSubtree_t* subtree, size_t* count);
+WXD_EXPORTED const char*
+wxd_TreeSubtree_GetText(const wxd_TreeSubtree_t* subtree, size_t* len);
+WXD_EXPORTED void
+wxd_TreeSubtree_Free(wxd_TreeSubtree_t* subtree);
+
+/**
+ * Builds `count` nodes under `parent` inside one Freeze/Thaw; nodes with parent -1 go directly
+ * under it. With `parent` 0 on an empty tree, the first such node becomes the root. Expanded
+ * flags are applied once all nodes exist. Writes the new items to `out_items` (optional, count
+ * entries) and returns the number inserted; 0 if the nodes are malformed.
+ */
+WXD_EXPORTED size_t
+wxd_TreeCtrl_InsertSubtree(wxd_TreeCtrl_t* self, wxd_TreeItemHandle parent,
+                           const wxd_TreeNode* nodes, size_t count, const char* text,
+                           size_t text_len, wxd_TreeItemHandle* out_items);
+
+// --- Lazily populated children ---
+//
+// Lazy nodes carry a Rust key and get their children from a callback the first time they
+// expand, so only the visited part of a large hierarchy exists in the control.
+
+// One level of children, filled in by the callback. `offsets` holds count + 1 entries into the
+// UTF-8 `text`; `images`, `has_children` and `keys` are optional (-1 / false / 0). The arrays
+// stay owned by the callee and need only be valid until the callback returns.
+typedef struct {
+    size_t count;
+    const char* text;
+    const uint32_t* offsets;
+    const int32_t* images;
+    const bool* has_children;
+    const int64_t* keys;
+} wxd_TreeLazyChildren;
+
+// Fills `out` with the children of the node `parent_key`. Returning false or no children
+// removes the node's expand button.
+typedef bool (*wxd_treectrl_lazy_children_callback)(void* userdata, int64_t parent_key,
+                                                    const wxd_TreeItemId_t* parent,
+                                                    wxd_TreeLazyChildren* out);
+typedef void (*wxd_treectrl_free_userdata_callback)(void* userdata);
+
+/**
+ * Turns on lazy population for the tree's lazy nodes. With `releaseBudget` > 0, collapsed lazy
+ * nodes keep their children only while the children of all collapsed nodes add up to at most
+ * that many items; beyond it the least recently collapsed are CollapseAndReset and refilled on
+ * their next expansion. `free_userdata` runs when replaced, disabled or the tree is destroyed.
+ */
+WXD_EXPORTED bool
+wxd_TreeCtrl_EnableLazyChildren(wxd_TreeCtrl_t* self, void* userdata,
+                                wxd_treectrl_lazy_children_callback callback,
+                                wxd_treectrl_free_userdata_callback free_userdata,
+                                size_t releaseBudget);
+WXD_EXPORTED void
+wxd_TreeCtrl_DisableLazyChildren(wxd_TreeCtrl_t* self);
+
+// Makes an existing item (e.g. the root) a lazy node; a value set with SetItemData is kept.
+WXD_EXPORTED bool
+wxd_TreeCtrl_SetLazyItem(wxd_TreeCtrl_t* self, wxd_TreeItemId_t* itemId, int64_t key,
+                         bool hasChildren);
+WXD_EXPORTED wxd_TreeItemId_t*
+wxd_TreeCtrl_AppendLazyItem(wxd_TreeCtrl_t* self, wxd_TreeItemId_t* parent_id, const char* text,
+                            int image, int selImage, int64_t key, bool hasChildren);
+// False if the item is not a lazy node.
+WXD_EXPORTED bool
+wxd_TreeCtrl_GetLazyItemKey(wxd_TreeCtrl_t* self, wxd_TreeItemId_t* itemId, int64_t* key);
+// Drops the children of a lazy node so the next expansion asks for them again.
+WXD_EXPORTED void
+wxd_TreeCtrl_ResetLazyItem(wxd_TreeCtrl_t* self, wxd_TreeItemId_t* itemId);
+
 // Enables or disables an item (grays it out when disabled)
 WXD_EXPORTED void
 wxd_TreeCtrl_EnableItem(wxd_TreeCtrl_t* self, wxd_TreeItemId_t* itemId, bool enable);
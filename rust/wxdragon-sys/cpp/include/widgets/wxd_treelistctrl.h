@@ -86,6 +86,12 @@ WXD_EXPORTED bool
 wxd_TreeListCtrl_IsSelected(wxd_TreeListCtrl_t* self, wxd_Long_t item);
 WXD_EXPORTED void
 wxd_TreeListCtrl_SelectAll(wxd_TreeListCtrl_t* self);
+// Selects `items` (0 entries are skipped), after clearing the selection if `replace`, inside
+// one freeze; single-selection controls take the first item. Sends one
+// wxEVT_TREELIST_SELECTION_CHANGED (without an item) at the end.
+WXD_EXPORTED void
+wxd_TreeListCtrl_SelectItems(wxd_TreeListCtrl_t* self, const wxd_Long_t* items, size_t count,
+                             bool replace);
 
 // Visibility
 WXD_EXPORTED void
@@ -104,6 +110,13 @@ WXD_EXPORTED void
 wxd_TreeListCtrl_UncheckItem(wxd_TreeListCtrl_t* self, wxd_Long_t item);
 WXD_EXPORTED bool
 wxd_TreeListCtrl_AreAllChildrenInState(wxd_TreeListCtrl_t* self, wxd_Long_t item, int state);
+// Sets the check state (as CheckItem) of each of `items` inside one freeze, to their
+// descendants too if `recursive`. With `update_parents`, the parents' 3-state boxes are updated
+// once per distinct parent afterwards. Sends no events, like CheckItem.
+WXD_EXPORTED void
+wxd_TreeListCtrl_SetCheckedStates(wxd_TreeListCtrl_t* self, const wxd_Long_t* items,
+                                  const int* states, size_t count, bool recursive,
+                                  bool update_parents);
 
 // Sorting
 WXD_EXPORTED void
@@ -111,4 +124,13 @@ wxd_TreeListCtrl_SetSortColumn(wxd_TreeListCtrl_t* self, unsigned col, bool asce
 WXD_EXPORTED bool
 wxd_TreeListCtrl_GetSortColumn(wxd_TreeListCtrl_t* self, unsigned* col, bool* ascending);
 
+// Whole subtrees in one call, as wxd_TreeCtrl_GetSubtree / InsertSubtree; labels are column 0.
+// `parent` 0 means the (hidden) root.
+WXD_EXPORTED wxd_TreeSubtree_t*
+wxd_TreeListCtrl_GetSubtree(wxd_TreeListCtrl_t* self, wxd_Long_t item, int32_t depth);
+WXD_EXPORTED size_t
+wxd_TreeListCtrl_InsertSubtree(wxd_TreeListCtrl_t* self, wxd_Long_t parent,
+                               const wxd_TreeNode* nodes, size_t count, const char* text,
+                               size_t text_len, wxd_Long_t* out_items);
+
 #endif // WXD_TREELISTCTRL_H
\ No newline at end of file
@@ -0,0 +1,41 @@
+#ifndef WXD_TYPEAHEAD_H
+#define WXD_TYPEAHEAD_H
+
+#include "../wxd_types.h"
+
+// --- Type-ahead search over list content ---
+//
+// An index over the text of one column of a DataViewCtrl list model (index or virtual) or a
+// ListCtrl (plain or virtual). It is built lazily through the control's own value / OnGetItemText
+// path on the first query, then kept up to date by the model's row notifications (DataView) or
+// by RefreshItem / RefreshItems / SetItemText (ListCtrl); a changed row count rebuilds it. Text
+// is compared case-insensitively.
+
+typedef enum {
+    WXD_TYPEAHEAD_PREFIX = 0,    // rows whose text starts with the query
+    WXD_TYPEAHEAD_SUBSTRING = 1, // rows whose text contains the query
+} wxd_TypeAheadMode;
+
+/**
+ * Attaches an index over `column` and handles typing on the control: printable keys extend the
+ * search text (reset after a second without typing) and select, focus and scroll to the next
+ * matching row. Replaces an index attached before. Returns false if the control has no list
+ * model or `column` is negative.
+ */
+WXD_EXPORTED bool
+wxd_DataViewCtrl_EnableTypeAhead(wxd_Window_t* self, int32_t column, int mode);
+WXD_EXPORTED bool
+wxd_ListCtrl_EnableTypeAhead(wxd_ListCtrl_t* self, int32_t column, int mode);
+
+// Detaches the index of `ctrl`, if any.
+WXD_EXPORTED void
+wxd_TypeAhead_Disable(wxd_Window_t* ctrl);
+
+/**
+ * First row at or after `startRow` (wrapping around) whose text matches the UTF-8 `text` in
+ * `mode`, or -1. Needs an index attached to `ctrl`; does not change the selection.
+ */
+WXD_EXPORTED int64_t
+wxd_TypeAhead_Find(wxd_Window_t* ctrl, const char* text, int64_t startRow, int mode);
+
+#endif // WXD_TYPEAHEAD_H
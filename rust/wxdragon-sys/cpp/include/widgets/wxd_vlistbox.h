@@ -0,0 +1,72 @@
+#ifndef WXD_VLISTBOX_H
+#define WXD_VLISTBOX_H
+
+#include "../wxd_types.h"
+
+// --- Owner-drawn virtual list box (wxVListBox) ---
+// A list box that stores no items: it only knows the row count and asks the callbacks to
+// measure and draw the rows that become visible, so cost is proportional to what is on screen
+// however many rows there are. Measured row heights are cached until the row is refreshed or
+// the cache is invalidated. Emits wxEVT_LISTBOX and wxEVT_LISTBOX_DCLICK like wxListBox.
+
+typedef struct wxd_VListBox wxd_VListBox_t;
+
+// Draws `row` into `rect`; the selection background is already painted when `selected`.
+typedef void (*wxd_VListBox_DrawItem)(void* user_data, wxd_DC_t* dc, wxd_Rect rect, size_t row,
+                                      bool selected);
+// Returns the height of `row` in pixels.
+typedef int (*wxd_VListBox_MeasureItem)(void* user_data, size_t row);
+typedef void (*wxd_VListBox_FreeUserData)(void* user_data);
+
+WXD_EXPORTED wxd_VListBox_t*
+wxd_VListBox_Create(wxd_Window_t* parent, int id, int x, int y, int w, int h, int64_t style);
+
+// Sets the callbacks, freeing the previous user data; `free_user_data` also runs when the list
+// is destroyed. A NULL `measure` gives every row the default height. Clears the height cache.
+WXD_EXPORTED void
+wxd_VListBox_SetCallbacks(wxd_VListBox_t* self, wxd_VListBox_DrawItem draw,
+                          wxd_VListBox_MeasureItem measure, void* user_data,
+                          wxd_VListBox_FreeUserData free_user_data);
+
+// Row height used without a measure callback (default 20).
+WXD_EXPORTED void
+wxd_VListBox_SetDefaultRowHeight(wxd_VListBox_t* self, int height);
+
+// Changes the row count. Cached heights of rows that still exist are kept, so appending rows
+// to a log or chat view only measures the new ones.
+WXD_EXPORTED void
+wxd_VListBox_SetItemCount(wxd_VListBox_t* self, size_t count);
+
+WXD_EXPORTED size_t
+wxd_VListBox_GetItemCount(const wxd_VListBox_t* self);
+
+// Redraws `row`, measuring it again; the layout is only recomputed if its height changed.
+WXD_EXPORTED void
+wxd_VListBox_RefreshRow(wxd_VListBox_t* self, size_t row);
+
+// Forgets all cached heights and redraws everything.
+WXD_EXPORTED void
+wxd_VListBox_InvalidateHeights(wxd_VListBox_t* self);
+
+// -1 when nothing is selected. For wxLB_MULTIPLE lists use IsSelected/Select.
+WXD_EXPORTED int64_t
+wxd_VListBox_GetSelection(const wxd_VListBox_t* self);
+
+WXD_EXPORTED void
+wxd_VListBox_SetSelection(wxd_VListBox_t* self, int64_t row);
+
+WXD_EXPORTED bool
+wxd_VListBox_IsSelected(const wxd_VListBox_t* self, size_t row);
+
+WXD_EXPORTED void
+wxd_VListBox_Select(wxd_VListBox_t* self, size_t row, bool select);
+
+// Scrolls so that `row` is the first visible one.
+WXD_EXPORTED void
+wxd_VListBox_ScrollToRow(wxd_VListBox_t* self, size_t row);
+
+// First visible row and one past the last.
+WXD_EXPORTED void
+wxd_VListBox_GetVisibleRows(const wxd_VListBox_t* self, size_t* begin, size_t* end);
+
+#endif // WXD_VLISTBOX_H
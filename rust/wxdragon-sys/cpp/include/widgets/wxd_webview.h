@@ -15,6 +15,23 @@ WXD_EXPORTED wxd_WebView_t* wxd_WebView_Create(wxd_Window_t* parent, wxd_Id id,
                                                wxd_Point pos, wxd_Size size, long style,
                                                const char* name, const char* backend);
 
+// Starts the engine of `backend` (NULL or "" for the default) in a hidden webview so the first
+// visible one opens without the startup stall (hundreds of ms for Edge/WebView2). With wx 3.3+,
+// later wxd_WebView_Create calls for that backend share the prewarmed configuration, including
+// `user_data_dir` (NULL: the backend's default), and so attach to the running engine.
+// `callback` runs once on the GUI thread when the engine is ready or failed, then
+// `free_user_data`. Call from the GUI thread after the app has started. Returns false, after
+// freeing the user data, if the backend is unavailable or a prewarm was already started.
+typedef void (*wxd_WebView_PrewarmCallback)(void* user_data, bool success);
+WXD_EXPORTED bool wxd_WebView_PrewarmAsync(const char* backend, const char* user_data_dir,
+                                           wxd_WebView_PrewarmCallback callback, void* user_data,
+                                           void (*free_user_data)(void* user_data));
+// True once prewarming finished successfully and the hidden webview is still alive.
+WXD_EXPORTED bool wxd_WebView_IsPrewarmed(void);
+// Destroys the hidden webview, e.g. once a visible one exists. Later webviews keep using the
+// prewarmed configuration.
+WXD_EXPORTED void wxd_WebView_ReleasePrewarm(void);
+
 // Navigation
 WXD_EXPORTED void wxd_WebView_LoadURL(wxd_WebView_t* self, const char* url);
 WXD_EXPORTED void wxd_WebView_Reload(wxd_WebView_t* self, int flags);
@@ -30,6 +47,8 @@ WXD_EXPORTED bool wxd_WebView_IsBusy(wxd_WebView_t* self);
 WXD_EXPORTED int wxd_WebView_GetCurrentURL(wxd_WebView_t* self, char* buffer, int len);
 WXD_EXPORTED int wxd_WebView_GetCurrentTitle(wxd_WebView_t* self, char* buffer, int len);
 WXD_EXPORTED int wxd_WebView_GetPageSource(wxd_WebView_t* self, char* buffer, int len);
+// Single-call variant; free the result with wxd_String_Free.
+WXD_EXPORTED wxd_String_t* wxd_WebView_GetPageSourceOwned(wxd_WebView_t* self);
 WXD_EXPORTED int wxd_WebView_GetPageText(wxd_WebView_t* self, char* buffer, int len);
 
 // Zoom
@@ -41,6 +60,15 @@ WXD_EXPORTED void wxd_WebView_SetZoomType(wxd_WebView_t* self, int zoomType);
 
 // Scripting
 WXD_EXPORTED int wxd_WebView_RunScript(wxd_WebView_t* self, const char* javascript, char* output, int output_len);
+// Runs `javascript` without a nested event loop. `callback` receives the result (or the error
+// message when `success` is false) as an owned string it must release with wxd_String_Free;
+// `free_user_data` runs after it, or when the webview is destroyed with the call still pending.
+// Before wx 3.3 the script runs synchronously from the next event loop iteration instead.
+typedef void (*wxd_WebView_ScriptCallback)(void* user_data, bool success, wxd_String_t* result);
+typedef void (*wxd_WebView_FreeUserData)(void* user_data);
+WXD_EXPORTED bool wxd_WebView_RunScriptAsync(wxd_WebView_t* self, const char* javascript,
+                                             wxd_WebView_ScriptCallback callback, void* user_data,
+                                             wxd_WebView_FreeUserData free_user_data);
 
 // Clipboard
 WXD_EXPORTED bool wxd_WebView_CanCut(wxd_WebView_t* self);
@@ -100,6 +128,40 @@ WXD_EXPORTED bool wxd_WebView_RemoveScriptMessageHandler(wxd_WebView_t* self, co
 WXD_EXPORTED bool wxd_WebView_AddUserScript(wxd_WebView_t* self, const char* javascript, int injectionTime);
 WXD_EXPORTED void wxd_WebView_RemoveAllUserScripts(wxd_WebView_t* self);
 
+// Batched message channel. Creating one installs `window.wxdChannels[name]` in the page (now and
+// on every later load) with `post(topic, data)`, where data is a string, ArrayBuffer or typed
+// array, `addListener((topic, data) => ...)` and `flush()`. Messages posted on either side are
+// queued and sent as one script message / one script call per frame (about 16 ms). The string
+// script bridge is the only transport, so binary payloads travel as base64 and arrive in the
+// page as Uint8Array. The channel may outlive the webview; it goes inert with it.
+typedef struct wxd_WebViewChannel wxd_WebViewChannel_t;
+
+// A message of a received batch. The views are valid only during the callback.
+typedef struct {
+    const char* topic;
+    size_t topic_len;
+    const unsigned char* data;
+    size_t data_len;
+    bool binary;
+} wxd_WebViewChannelMessage;
+
+typedef void (*wxd_WebViewChannel_Callback)(void* user_data,
+                                            const wxd_WebViewChannelMessage* messages,
+                                            size_t count);
+
+// Returns NULL if the script message handler cannot be added. `free_user_data` runs on destroy.
+WXD_EXPORTED wxd_WebViewChannel_t*
+wxd_WebViewChannel_Create(wxd_WebView_t* webview, const char* name,
+                          wxd_WebViewChannel_Callback callback, void* user_data,
+                          wxd_WebView_FreeUserData free_user_data);
+WXD_EXPORTED void wxd_WebViewChannel_Destroy(wxd_WebViewChannel_t* channel);
+// Queues a message for the page; `data` is UTF-8 text, or bytes if `binary`.
+WXD_EXPORTED void wxd_WebViewChannel_Post(wxd_WebViewChannel_t* channel, const char* topic,
+                                          size_t topic_len, const unsigned char* data,
+                                          size_t data_len, bool binary);
+// Sends queued messages now instead of at the next frame.
+WXD_EXPORTED void wxd_WebViewChannel_Flush(wxd_WebViewChannel_t* channel);
+
 // Custom Scheme Handler
 // Invoked when the webview requests a resource served by a registered handler.
 // `uri` is the full requested URI. On success, return true and set:
@@ -122,6 +184,22 @@ WXD_EXPORTED void wxd_WebView_RegisterHandler(wxd_WebView_t* self, const char* s
                                               wxd_WebViewHandler_DropUserdata drop_userdata,
                                               void* userdata);
 
+// Memory-backed scheme handler: serves borrowed bytes without copying them into a stream.
+// `resolve` gets the full URI and returns true with a view of the resource in `*out_data` /
+// `*out_len`, an optional MIME type in `*out_mime` (null to infer it from the URI) and a
+// `*out_token` keeping both alive. The engine reads the bytes in place; `release(token)` runs
+// once it is done, which may be after the handler is gone and on another thread.
+typedef bool (*wxd_WebViewMemoryHandler_Resolve)(void* userdata, const char* uri,
+                                                 const unsigned char** out_data, size_t* out_len,
+                                                 const char** out_mime, void** out_token);
+typedef void (*wxd_WebViewMemoryHandler_Release)(void* token);
+
+WXD_EXPORTED void wxd_WebView_RegisterMemoryHandler(wxd_WebView_t* self, const char* scheme,
+                                                    wxd_WebViewMemoryHandler_Resolve resolve,
+                                                    wxd_WebViewMemoryHandler_Release release,
+                                                    wxd_WebViewHandler_DropUserdata drop_userdata,
+                                                    void* userdata);
+
 // Native Backend
 WXD_EXPORTED void* wxd_WebView_GetNativeBackend(wxd_WebView_t* self);
 WXD_EXPORTED int wxd_WebView_GetBackend(wxd_WebView_t* self, char* buffer, int len);
@@ -2,6 +2,9 @@
 #define WXD_LOGGING_H
 
 #include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -27,24 +30,61 @@ wxd_log_printf(int level, const char* fmt, ...);
 void
 wxd_log_vprintf(int level, const char* fmt, va_list ap);
 
+// Sets / gets the highest level (0=Off .. 5=Trace) that is formatted and forwarded to Rust.
+// The value is cached in an atomic so the macros below can test it before evaluating any
+// argument. It starts at Trace and is only changed by an explicit push of `log::max_level()`
+// from Rust (set_log_max_level), never by a log call.
+void
+wxd_log_set_max_level(int level);
+int
+wxd_log_get_max_level(void);
+
+// Switches wxd_log_printf/wxd_log_vprintf to asynchronous delivery: records are formatted into
+// a preallocated ring of `capacity` slots (rounded up to a power of two) without locking or,
+// for messages under 240 bytes, allocating, and a background thread hands them to
+// wxd_rust_log in order per logging thread. When the ring is full new records are dropped and
+// counted. `capacity` 0 switches back to synchronous delivery after handing over every queued
+// record. Returns false if the thread or ring could not be created.
+bool
+wxd_log_set_async(size_t capacity);
+
+// Records dropped because the ring was full, since the process started.
+uint64_t
+wxd_log_get_dropped(void);
+
+// Highest level compiled in at all; calls above it become no-ops with unevaluated arguments.
+// Set through the `wxdLOG_MAX_LEVEL` CMake cache entry (e.g. 3 strips Debug and Trace).
+#ifndef WXD_LOG_COMPILE_MAX_LEVEL
+#define WXD_LOG_COMPILE_MAX_LEVEL 5
+#endif
+
+#define WXD_LOG_ENABLED(level)                                                                     \
+    ((level) <= WXD_LOG_COMPILE_MAX_LEVEL && (level) <= wxd_log_get_max_level())
+
+#define WXD_LOG_AT(level, ...)                                                                     \
+    do {                                                                                           \
+        if (WXD_LOG_ENABLED(level))                                                                \
+            wxd_log_printf((level), __VA_ARGS__);                                                  \
+    } while (0)
+
 // Convenience macros: Only Error and Warn include [file:line].
 // 1=Error, 2=Warn, 3=Info, 4=Debug, 5=Trace
 
 // Error/Warn: include file:line
-#define WXD_LOG_ERROR(msg) wxd_log_printf(1, "[%s:%d] %s", __FILE__, __LINE__, (msg))
-#define WXD_LOG_WARN(msg)  wxd_log_printf(2, "[%s:%d] %s", __FILE__, __LINE__, (msg))
+#define WXD_LOG_ERROR(msg) WXD_LOG_AT(1, "[%s:%d] %s", __FILE__, __LINE__, (msg))
+#define WXD_LOG_WARN(msg)  WXD_LOG_AT(2, "[%s:%d] %s", __FILE__, __LINE__, (msg))
 
-#define WXD_LOG_ERRORF(fmt, ...) wxd_log_printf(1, "[%s:%d] " fmt, __FILE__, __LINE__, __VA_ARGS__)
-#define WXD_LOG_WARNF(fmt, ...)  wxd_log_printf(2, "[%s:%d] " fmt, __FILE__, __LINE__, __VA_ARGS__)
+#define WXD_LOG_ERRORF(fmt, ...) WXD_LOG_AT(1, "[%s:%d] " fmt, __FILE__, __LINE__, __VA_ARGS__)
+#define WXD_LOG_WARNF(fmt, ...)  WXD_LOG_AT(2, "[%s:%d] " fmt, __FILE__, __LINE__, __VA_ARGS__)
 
 // Info/Debug/Trace: plain messages (no file:line)
-#define WXD_LOG_INFO(msg)  wxd_log_printf(3, "%s", (msg))
-#define WXD_LOG_DEBUG(msg) wxd_log_printf(4, "%s", (msg))
-#define WXD_LOG_TRACE(msg) wxd_log_printf(5, "%s", (msg))
+#define WXD_LOG_INFO(msg)  WXD_LOG_AT(3, "%s", (msg))
+#define WXD_LOG_DEBUG(msg) WXD_LOG_AT(4, "%s", (msg))
+#define WXD_LOG_TRACE(msg) WXD_LOG_AT(5, "%s", (msg))
 
-#define WXD_LOG_INFOF(fmt, ...)  wxd_log_printf(3, (fmt), __VA_ARGS__)
-#define WXD_LOG_DEBUGF(fmt, ...) wxd_log_printf(4, (fmt), __VA_ARGS__)
-#define WXD_LOG_TRACEF(fmt, ...) wxd_log_printf(5, (fmt), __VA_ARGS__)
+#define WXD_LOG_INFOF(fmt, ...)  WXD_LOG_AT(3, (fmt), __VA_ARGS__)
+#define WXD_LOG_DEBUGF(fmt, ...) WXD_LOG_AT(4, (fmt), __VA_ARGS__)
+#define WXD_LOG_TRACEF(fmt, ...) WXD_LOG_AT(5, (fmt), __VA_ARGS__)
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,29 @@
+#ifndef WXD_STRING_H
+#define WXD_STRING_H
+
+#include "wxd_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Owned UTF-8 string returned by single-call getters (e.g. wxd_TextCtrl_GetValueOwned).
+// The text is converted once on the C++ side; the caller reads it in place through
+// GetData/GetLength and must release it with wxd_String_Free. Data is always NUL-terminated,
+// but may contain embedded NULs, so use GetLength rather than strlen.
+
+WXD_EXPORTED const char*
+wxd_String_GetData(const wxd_String_t* self);
+
+// Length in bytes, excluding the terminating NUL.
+WXD_EXPORTED size_t
+wxd_String_GetLength(const wxd_String_t* self);
+
+WXD_EXPORTED void
+wxd_String_Free(wxd_String_t* self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // WXD_STRING_H
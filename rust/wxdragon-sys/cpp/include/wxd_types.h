@@ -363,9 +363,198 @@ typedef enum {
     WXD_EVENT_TYPE_PG_COL_DRAGGING = 402,      // wxEVT_PG_COL_DRAGGING
     WXD_EVENT_TYPE_PG_COL_END_DRAG = 403,      // wxEVT_PG_COL_END_DRAG
 
+    // Spatial index hover tracking (wxdragon-defined)
+    WXD_EVENT_TYPE_SPATIAL_HOVER_CHANGED = 404, // wxdEVT_SPATIAL_HOVER_CHANGED
+
+    // Coalesced file system changes (wxdragon-defined)
+    WXD_EVENT_TYPE_FS_CHANGES = 405, // wxdEVT_FS_CHANGES
+
+    // Asynchronous child process output and exit (wxdragon-defined)
+    WXD_EVENT_TYPE_PROCESS_OUTPUT = 406, // wxdEVT_PROCESS_OUTPUT
+    WXD_EVENT_TYPE_PROCESS_EXIT = 407,   // wxdEVT_PROCESS_EXIT
+
+    // Typed message queued from a worker thread (wxdragon-defined)
+    WXD_EVENT_TYPE_THREAD_MESSAGE = 408, // wxdEVT_THREAD_MESSAGE
+
+    // Top-level window became visible or hidden (wxdragon-defined)
+    WXD_EVENT_TYPE_VISIBILITY_CHANGED = 409, // wxdEVT_VISIBILITY_CHANGED
+
+    // Readiness of a non-blocking socket
+    WXD_EVENT_TYPE_SOCKET = 410, // wxEVT_SOCKET
+
     WXD_EVENT_TYPE_MAX // Keep this last for count if needed, or remove if not used for iteration
 } WXDEventTypeCEnum;
 
+// Bits of wxd_EventSnapshot::kinds telling which groups of fields were filled in
+#define WXD_EVENT_SNAPSHOT_COMMAND  0x0001 // command_int / checked (wxCommandEvent)
+#define WXD_EVENT_SNAPSHOT_MOUSE    0x0002 // position / buttons / wheel_* (wxMouseEvent)
+#define WXD_EVENT_SNAPSHOT_KEY      0x0004 // position / key_code / unicode_key (wxKeyEvent)
+#define WXD_EVENT_SNAPSHOT_KEYSTATE 0x0008 // *_down modifier flags (wxKeyboardState)
+
+// Bits of wxd_EventSnapshot::buttons (buttons held down when the event was generated)
+#define WXD_MOUSE_BUTTON_LEFT   0x0001
+#define WXD_MOUSE_BUTTON_MIDDLE 0x0002
+#define WXD_MOUSE_BUTTON_RIGHT  0x0004
+#define WXD_MOUSE_BUTTON_AUX1   0x0008
+#define WXD_MOUSE_BUTTON_AUX2   0x0010
+
+/// @brief Flat copy of the commonly used event fields, filled by wxd_Event_GetSnapshot()
+/// so input handlers can read everything with a single call.
+typedef struct {
+    uint32_t kinds; // WXD_EVENT_SNAPSHOT_* bits
+    WXDEventTypeCEnum event_type;
+    int id;
+    wxd_Point position; // {-1, -1} unless MOUSE or KEY is set
+    uint32_t buttons;   // WXD_MOUSE_BUTTON_* bits
+    bool control_down;
+    bool shift_down;
+    bool alt_down;
+    bool meta_down;
+    bool cmd_down;
+    int key_code;
+    int unicode_key;
+    int wheel_rotation;
+    int wheel_delta;
+    int wheel_axis; // 0 = vertical, 1 = horizontal
+    int command_int;
+    bool checked;
+} wxd_EventSnapshot;
+
+// One row of wxd_Profile_Snapshot(): totals for a single instrumented function.
+typedef struct {
+    const void* function;  // Code address
+    const char* name;      // Symbol name, or NULL if it could not be resolved
+    uint64_t calls;
+    uint64_t total_nanos;  // Inclusive wall time
+} wxd_ProfileEntry;
+
+// Object kinds counted by wxd_Debug_GetObjectStats().
+typedef enum {
+    WXD_OBJECT_KIND_BITMAP = 0,        // wxd_Bitmap_t handed to the caller
+    WXD_OBJECT_KIND_TREE_ITEM_ID = 1,  // wxd_TreeItemId_t
+    WXD_OBJECT_KIND_VARIANT = 2,       // wxd_Variant_t
+    WXD_OBJECT_KIND_EVENT_HANDLER = 3, // Per-wxEvtHandler dispatch table of bound closures
+    WXD_OBJECT_KIND_EVENT_CLOSURE = 4, // Rust closure box bound to an event
+    WXD_OBJECT_KIND_COUNT = 5
+} wxd_ObjectKind;
+
+// One row of wxd_Debug_GetObjectStats(). Byte counts are approximate: pixel memory for
+// bitmaps, the native bookkeeping size for everything else.
+typedef struct {
+    int32_t kind;             // wxd_ObjectKind
+    const char* name;         // Static string, e.g. "Bitmap"
+    uint64_t live;
+    uint64_t high_water;      // Highest live count since start or the last reset
+    uint64_t created;         // Total ever created
+    uint64_t live_bytes;
+    uint64_t high_water_bytes;
+} wxd_ObjectStats;
+
+// What a wxd_WindowTiming row measures.
+typedef enum {
+    WXD_WINDOW_TIMING_PAINT = 0,  // wxEVT_PAINT handlers bound through the wrapper
+    WXD_WINDOW_TIMING_SIZE = 1,   // wxEVT_SIZE handlers bound through the wrapper
+    WXD_WINDOW_TIMING_LAYOUT = 2, // Layout() run by the wrapper (wxd_Window_Layout, batches, ...)
+    WXD_WINDOW_TIMING_KIND_COUNT = 3
+} wxd_WindowTimingKind;
+
+// One row of wxd_Debug_GetWindowTimings(): totals for one (window class, window name, kind).
+// Names are truncated to fit and always NUL-terminated.
+typedef struct {
+    char class_name[48];
+    char window_name[64];
+    int32_t kind;             // wxd_WindowTimingKind
+    uint64_t count;
+    uint64_t total_nanos;
+    uint64_t max_nanos;
+    uint64_t over_budget;     // Measurements above the budget set with SetWindowTimingBudget
+} wxd_WindowTiming;
+
+// Startup milestones reported by wxd_Debug_GetStartupPhaseMicros(), in the order they are
+// normally reached.
+typedef enum {
+    WXD_STARTUP_MAIN_ENTRY = 0,       // wxd_Main entered; the origin of all other times
+    WXD_STARTUP_ENTRY_START_DONE = 1, // wxWidgets initialized (wxEntryStart returned)
+    WXD_STARTUP_ONINIT_BEGIN = 2,     // WxdApp::OnInit entered
+    WXD_STARTUP_RUST_INIT_BEGIN = 3,  // The Rust on-init callback called
+    WXD_STARTUP_RUST_INIT_END = 4,    // The Rust on-init callback returned
+    WXD_STARTUP_FIRST_PAINT = 5,      // First paint event of any window
+    WXD_STARTUP_FIRST_IDLE = 6,       // First idle event, the event loop is running
+    WXD_STARTUP_IMAGE_HANDLERS = 7,   // Image handlers registered, on first use or after paint
+    WXD_STARTUP_PHASE_COUNT = 8
+} wxd_StartupPhase;
+
+// One pointer position of wxd_MouseEvent_GetPointerHistory().
+typedef struct {
+    int32_t x, y;         // Client coordinates of the event's window
+    int64_t timestamp_ms; // Same clock as the events' timestamps
+    float pressure;       // 0..1, or -1 if not reported
+} wxd_PointerSample;
+
+// Delivery policy of wxd_EvtHandler_BindRateLimited().
+typedef enum {
+    WXD_RATE_LIMIT_DEBOUNCE = 0, // Deliver once no event has arrived for the interval
+    WXD_RATE_LIMIT_THROTTLE = 1  // Deliver at most once per interval, the first one immediately
+} wxd_RateLimitMode;
+
+// How a splitter or AUI sash drag updates the panes while the button is held.
+typedef enum {
+    WXD_LIVE_RESIZE_NATIVE = 0,    // Whatever the window's own style/flags ask for
+    WXD_LIVE_RESIZE_THROTTLED = 1, // Live layout, at most once per frame interval
+    WXD_LIVE_RESIZE_SNAPSHOT = 2   // No layout during the drag; one full layout on release
+} wxd_LiveResizeMode;
+
+// When the app's idle handler is bound; see wxd_App_SetIdleMode().
+typedef enum {
+    WXD_IDLE_MODE_ALWAYS = 0,   // Bound for the lifetime of the app (default)
+    WXD_IDLE_MODE_ON_DEMAND = 1 // Bound only while callbacks are pending
+} wxd_IdleMode;
+
+// How far wxd_App_TrimMemory shrinks the wrapper's caches.
+typedef enum {
+    WXD_TRIM_MODERATE = 1, // Drop the less recently used half of each cache
+    WXD_TRIM_CRITICAL = 2  // Empty every cache
+} wxd_TrimLevel;
+
+// Memory usage of one wrapper cache; see wxd_App_GetCacheUsage().
+typedef struct {
+    const char* name; // static string, e.g. "text_extent"
+    size_t bytes;     // approximate
+    size_t entries;
+} wxd_CacheUsage;
+
+// Called on the main thread after the caches were trimmed for an OS low-memory signal.
+typedef void (*wxd_MemoryPressureCallback)(wxd_TrimLevel level, void* user_data);
+
+// Why a top-level window cannot be seen; see wxd_Window_GetHiddenReasons().
+typedef enum {
+    WXD_HIDDEN_NOT_SHOWN = 0x1, // Hidden with Show(false) or not shown yet
+    WXD_HIDDEN_ICONIZED = 0x2,  // Minimized
+    WXD_HIDDEN_OCCLUDED = 0x4   // Fully covered (macOS) or cloaked, e.g. on another desktop (MSW)
+} wxd_HiddenReason;
+
+// Event classes a wxd_App_AddEventFilter() filter can ask for; combine into its mask.
+typedef enum {
+    WXD_EVENT_FILTER_KEY = 0x001,          // Key down/up, char, char hook
+    WXD_EVENT_FILTER_MOUSE_BUTTON = 0x002, // Button down/up/double-click
+    WXD_EVENT_FILTER_MOUSE_MOTION = 0x004, // Motion, enter and leave window
+    WXD_EVENT_FILTER_MOUSE_WHEEL = 0x008,
+    WXD_EVENT_FILTER_FOCUS = 0x010,        // Set/kill focus, activate
+    WXD_EVENT_FILTER_COMMAND = 0x020,      // Any command event (menu, button, text, ...)
+    WXD_EVENT_FILTER_PAINT = 0x040,        // Paint and erase background
+    WXD_EVENT_FILTER_LAYOUT = 0x080,       // Size and move
+    WXD_EVENT_FILTER_TIMER = 0x100,
+    WXD_EVENT_FILTER_OTHER = 0x200,        // Everything not covered above
+    WXD_EVENT_FILTER_ALL = 0x3FF
+} wxd_EventFilterClass;
+
+// What a filter callback decided; the first filter not returning SKIP wins.
+typedef enum {
+    WXD_EVENT_FILTER_RESULT_SKIP = -1,     // Let the event be processed normally
+    WXD_EVENT_FILTER_RESULT_IGNORE = 0,    // Drop the event
+    WXD_EVENT_FILTER_RESULT_PROCESSED = 1  // Treat the event as handled
+} wxd_EventFilterResult;
+
 typedef int64_t wxd_Style_t;
 typedef int wxd_Direction_t;
 typedef int wxd_Orientation_t;
@@ -373,6 +562,7 @@ typedef int wxd_SizerFlags_t;
 
 // --- Opaque Struct Typedefs ---
 typedef struct wxd_App_t wxd_App_t;
+typedef struct wxd_WorkerPool_t wxd_WorkerPool_t;
 typedef struct wxd_Window_t wxd_Window_t;
 typedef struct wxd_Event_t wxd_Event_t;
 typedef struct wxd_EvtHandler_t wxd_EvtHandler_t;
@@ -411,6 +601,7 @@ typedef struct wxd_StatusBar_t wxd_StatusBar_t;
 typedef struct wxd_ToolBar_t wxd_ToolBar_t;
 typedef struct wxd_MenuBar_t wxd_MenuBar_t;
 typedef struct wxd_Menu_t wxd_Menu_t;
+typedef struct wxd_UpdateUIAggregator_t wxd_UpdateUIAggregator_t;
 typedef struct wxd_MenuItem_t wxd_MenuItem_t;
 typedef struct wxd_ListCtrl_t wxd_ListCtrl_t;
 typedef struct wxd_ColourPickerCtrl_t wxd_ColourPickerCtrl_t;
@@ -436,6 +627,7 @@ typedef struct wxd_CommandLinkButton_t wxd_CommandLinkButton_t;
 typedef struct wxd_Dialog wxd_Dialog_t;
 typedef struct wxd_MessageDialog wxd_MessageDialog_t;
 typedef struct wxd_ArrayString_t wxd_ArrayString_t;
+typedef struct wxd_String_t wxd_String_t;
 typedef struct wxd_FileDialog wxd_FileDialog_t;
 typedef struct wxd_ColourData wxd_ColourData_t;
 typedef struct wxd_ColourDialog wxd_ColourDialog_t;
@@ -449,6 +641,7 @@ typedef struct wxd_SingleChoiceDialog wxd_SingleChoiceDialog_t;
 typedef struct wxd_MultiChoiceDialog wxd_MultiChoiceDialog_t;
 typedef struct wxd_DirDialog wxd_DirDialog_t;
 typedef struct wxd_AnimationCtrl wxd_AnimationCtrl_t;
+typedef struct wxd_Animation wxd_Animation_t;
 typedef struct wxd_FilePickerCtrl_t wxd_FilePickerCtrl_t;
 typedef struct wxd_DirPickerCtrl_t wxd_DirPickerCtrl_t;
 typedef struct wxd_FontPickerCtrl_t wxd_FontPickerCtrl_t;
@@ -471,6 +664,54 @@ typedef struct wxd_SingleInstanceChecker_t wxd_SingleInstanceChecker_t;
 // UIActionSimulator opaque type
 typedef struct wxd_UIActionSimulator_t wxd_UIActionSimulator_t;
 
+// Input-to-paint latency probe opaque type
+typedef struct wxd_LatencyProbe_t wxd_LatencyProbe_t;
+
+// Prefix index feeding native text autocompletion
+typedef struct wxd_CompletionIndex_t wxd_CompletionIndex_t;
+
+// Native (key code, modifiers) -> command id table for keyboard shortcuts
+typedef struct wxd_HotkeyTable_t wxd_HotkeyTable_t;
+
+// Process-wide event filter registered with wxd_App_AddEventFilter
+typedef struct wxd_EventFilter_t wxd_EventFilter_t;
+
+// Coalescing wrapper around wxFileSystemWatcher
+typedef struct wxd_FileSystemWatcher_t wxd_FileSystemWatcher_t;
+
+// Kinds of file system change, combined per path in a coalesced batch (wxFSW_EVENT_* values).
+typedef enum {
+    WXD_FS_CHANGE_CREATE = 0x01,
+    WXD_FS_CHANGE_DELETE = 0x02,
+    WXD_FS_CHANGE_RENAME = 0x04,
+    WXD_FS_CHANGE_MODIFY = 0x08,
+    WXD_FS_CHANGE_ACCESS = 0x10,
+    WXD_FS_CHANGE_ATTRIB = 0x20
+} wxd_FileSystemChange;
+
+// Asynchronous child process with redirected, natively buffered output
+typedef struct wxd_ChildProcess_t wxd_ChildProcess_t;
+
+// Launch flags for wxd_ChildProcess_Spawn.
+typedef enum {
+    WXD_PROCESS_HIDE_CONSOLE = 0x01, // wxEXEC_HIDE_CONSOLE
+    WXD_PROCESS_GROUP_LEADER = 0x02  // wxEXEC_MAKE_GROUP_LEADER
+} wxd_ProcessFlags;
+
+// Non-blocking wxSocketClient / wxSocketServer (or an accepted connection)
+typedef struct wxd_Socket_t wxd_Socket_t;
+
+// What a WXD_EVENT_TYPE_SOCKET event reports (values match wxSocketNotify).
+typedef enum {
+    WXD_SOCKET_INPUT = 0,      // Data can be read
+    WXD_SOCKET_OUTPUT = 1,     // Writing can resume after a short write
+    WXD_SOCKET_CONNECTION = 2, // Client connected, or a server has a connection to accept
+    WXD_SOCKET_LOST = 3        // Closed by the peer, or a connect failed
+} wxd_SocketNotify;
+
+// Memory-mapped archive of application resources
+typedef struct wxd_ResourceBundle_t wxd_ResourceBundle_t;
+
 // --- Mouse Button Constants (for UIActionSimulator) ---
 typedef enum {
     WXD_MOUSE_BTN_ANY = -1,
@@ -503,7 +744,9 @@ typedef enum {
     WXD_CONFIG_USE_GLOBAL_FILE = 2,
     WXD_CONFIG_USE_RELATIVE_PATH = 4,
     WXD_CONFIG_USE_NO_ESCAPE_CHARACTERS = 8,
-    WXD_CONFIG_USE_SUBDIR = 16
+    WXD_CONFIG_USE_SUBDIR = 16,
+    // wxDragon-only: defer flushes to a debounce timer (see wxd_Config_SetWriteBehind)
+    WXD_CONFIG_WRITE_BEHIND = 1 << 16
 } wxd_ConfigStyle;
 
 // Config entry type
@@ -561,6 +804,13 @@ typedef enum {
 // --- Function Pointer Typedefs ---
 typedef bool (*wxd_OnInitCallback)(void* userData);
 typedef void (*wxd_ClosureCallback)(void* closure_ptr, wxd_Event_t* event);
+// Returns a wxd_EventFilterResult; `event_class` is the event's single wxd_EventFilterClass bit.
+typedef int (*wxd_EventFilterCallback)(void* userData, wxd_Event_t* event, uint32_t event_class);
+
+// Arguments a later instance handed over: its working directory and its argv without the
+// program name. Runs on the main thread of the running instance.
+typedef void (*wxd_InstanceArgsCallback)(void* userData, const char* cwd, const char** args,
+                                         int count);
 
 // macOS-specific event callbacks
 typedef void (*wxd_MacOpenFilesCallback)(void* userData, const char** files, int count);
@@ -569,6 +819,11 @@ typedef void (*wxd_MacNewFileCallback)(void* userData);
 typedef void (*wxd_MacReopenAppCallback)(void* userData);
 typedef void (*wxd_MacPrintFilesCallback)(void* userData, const char** files, int count);
 
+// Worker pool callbacks: `run` executes on a worker thread, `done` on the main thread with
+// `target_alive` false when the job's target was destroyed first.
+typedef void (*wxd_WorkerRunFn)(void* job);
+typedef void (*wxd_WorkerDoneFn)(void* job, bool target_alive);
+
 // wxDragResult C Enum (for drag and drop operations)
 typedef enum {
     WXD_DRAG_NONE = 0,   // wxDragNone - No drag operation
@@ -582,6 +837,13 @@ typedef enum {
 // Define a long integer type for positions, lengths, etc.
 typedef long long wxd_Long_t;
 
+// One range of wxd_TextCtrl_SetStyleRuns(): [start, end) styled with palette[attr].
+typedef struct {
+    wxd_Long_t start;
+    wxd_Long_t end;
+    uint32_t attr;
+} wxd_TextStyleRun;
+
 // ListCtrl constants
 #define WXD_LIST_MASK_STATE  0x0001
 #define WXD_LIST_MASK_TEXT   0x0002
@@ -597,8 +859,31 @@ typedef struct {
 
 // DataView types
 typedef struct wxd_DataViewModel_t wxd_DataViewModel_t;
+typedef struct wxd_DataViewSnapshot_t wxd_DataViewSnapshot_t;
+typedef struct wxd_DataViewSnapshotPublisher_t wxd_DataViewSnapshotPublisher_t;
+
+// Rows measured by wxd_DataViewCtrl_AutoSizeColumnSampled(), in display order.
+typedef struct wxd_DataViewAutoSizeSample {
+    bool visible_rows; // rows currently scrolled into view
+    int head_rows;     // first N rows
+    int tail_rows;     // last N rows
+    int stride_rows;   // N rows spread evenly over all rows
+} wxd_DataViewAutoSizeSample;
 typedef void wxd_DataViewColumn_t;
 
+// Text layout for wxd_Grid_ExportRange() and wxd_DataViewCtrl_ExportRows().
+typedef struct wxd_TableExportFormat {
+    char delimiter;  // between fields, e.g. '\t' or ','
+    char quote;      // encloses fields with the delimiter, quotes or line breaks (doubling
+                     // quotes inside); 0 replaces those characters with spaces instead
+    bool header;     // first line holds the column labels
+    bool row_labels; // grid only: each line starts with the row label
+    bool crlf;       // lines end with "\r\n" instead of "\n"
+} wxd_TableExportFormat;
+
+// Receives exported text in chunks; returning false aborts the export.
+typedef bool (*wxd_table_export_write_fn)(void* userdata, const char* data, size_t len);
+
 // DataViewCell mode enum (for cell renderers)
 typedef enum {
     WXD_DATAVIEW_CELL_INERT,
@@ -665,6 +950,9 @@ typedef enum {
 
 // For wxd_TreeItemId_t, wxTreeItemId internally holds a void* m_pItem.
 typedef struct wxd_TreeItemId_t wxd_TreeItemId_t; // Define as opaque struct for bindgen
+// The same item by value: the m_pItem pointer itself, 0 for none. Needs no freeing, but is only
+// meaningful while the item exists.
+typedef uintptr_t wxd_TreeItemHandle;
 
 // Define wxd_DropResult enum (ensure this is defined if used)
 // ... existing code ...
@@ -685,12 +973,15 @@ typedef struct wxd_Window_t wxd_Window_t;
 
 /// Opaque pointer to wxTimer
 typedef struct wxd_Timer_t wxd_Timer_t;
+typedef struct wxd_TimerWheel_t wxd_TimerWheel_t;
+typedef struct wxd_FrameClock_t wxd_FrameClock_t;
 
 /// Window ID type (must match wxWidgets window ID type)
 typedef int wxd_Id;
 
 // StyledTextCtrl type
 typedef struct wxd_StyledTextCtrl_t wxd_StyledTextCtrl_t;
+typedef struct wxd_StcDocument_t wxd_StcDocument_t;
 
 // AppProgressIndicator type
 typedef struct wxd_AppProgressIndicator_t wxd_AppProgressIndicator_t;
@@ -723,6 +1014,9 @@ typedef struct wxd_TreeListCtrl_t wxd_TreeListCtrl_t;
 
 // Grid types
 typedef struct wxd_Grid_t wxd_Grid_t;
+typedef struct wxd_GridIngest_t wxd_GridIngest_t;
+typedef struct wxd_GridCellRenderer_t wxd_GridCellRenderer_t;
+typedef struct wxd_GridCellEditor_t wxd_GridCellEditor_t;
 typedef struct wxd_PropertyGrid_t wxd_PropertyGrid_t;
 
 // AboutDialogInfo type
@@ -741,6 +1035,7 @@ typedef struct wxd_PrintDialogData_t wxd_PrintDialogData_t;
 typedef struct wxd_PrintDialog_t wxd_PrintDialog_t;
 typedef struct wxd_PageSetupDialogData_t wxd_PageSetupDialogData_t;
 typedef struct wxd_PageSetupDialog_t wxd_PageSetupDialog_t;
+typedef struct wxd_PrintPagination_t wxd_PrintPagination_t;
 
 // Printing callback typedefs
 typedef void (*wxd_Printout_OnPreparePrinting_Callback)(void* userData);
@@ -751,5 +1046,8 @@ typedef void (*wxd_Printout_OnEndDocument_Callback)(void* userData);
 typedef bool (*wxd_Printout_OnPrintPage_Callback)(void* userData, int pageNum);
 typedef bool (*wxd_Printout_HasPage_Callback)(void* userData, int pageNum);
 typedef void (*wxd_Printout_GetPageInfo_Callback)(void* userData, int* minPage, int* maxPage, int* pageFrom, int* pageTo);
+typedef void (*wxd_Printout_FreeUserData_Callback)(void* userData);
+// Receives one exported page as tightly packed RGBA; return false to stop the export.
+typedef bool (*wxd_Printout_ExportPage_Callback)(void* userData, int pageNum, const uint8_t* rgba, int width, int height);
 
 #endif // WXD_TYPES_H
@@ -6,6 +6,33 @@
 // C-compatible variant type, it represents wxVariant in C
 typedef struct wxd_Variant_t wxd_Variant_t;
 
+// Plain-data cell value, passed by value and turned into a wxVariant only where one is needed.
+// Strings are borrowed UTF-8 spans (not NUL-terminated) valid for the duration of the call.
+typedef enum : int32_t {
+    WXD_VARIANT_VALUE_NULL = 0,
+    WXD_VARIANT_VALUE_BOOL,
+    WXD_VARIANT_VALUE_INT64,
+    WXD_VARIANT_VALUE_DOUBLE,
+    WXD_VARIANT_VALUE_STRING
+} wxd_VariantValueKind;
+
+typedef struct {
+    const char* ptr;
+    size_t len;
+} wxd_VariantValueStr;
+
+typedef union {
+    bool b;
+    int64_t i;
+    double d;
+    wxd_VariantValueStr text;
+} wxd_VariantValueData;
+
+typedef struct {
+    wxd_VariantValueKind kind;
+    wxd_VariantValueData data;
+} wxd_VariantValue;
+
 // clang-format off
 #ifdef __cplusplus
 extern "C" {
@@ -71,6 +98,14 @@ wxd_Variant_SetDateTime(wxd_Variant_t* variant, const wxd_DateTime_t* value);
 WXD_EXPORTED void
 wxd_Variant_SetBitmap(wxd_Variant_t* variant, const wxd_Bitmap_t* bmp);
 
+/**
+ * Set from a plain-data value. Bool, int64 and double reuse the variant's data when it already
+ * holds that type and is not shared, so refilling the same cell does not allocate; only strings
+ * build a wxString. A null value or NULL pointer makes the variant null.
+ */
+WXD_EXPORTED void
+wxd_Variant_SetValue(wxd_Variant_t* variant, const wxd_VariantValue* value);
+
 // Getters (return false if cannot convert)
 WXD_EXPORTED bool
 wxd_Variant_GetBool(const wxd_Variant_t* variant, bool* out_value);
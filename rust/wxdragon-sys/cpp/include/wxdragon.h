@@ -4,6 +4,7 @@
 // Include all fundamental types first
 #include "wxd_types.h"     // Contains all basic C types and opaque struct typedefs
 #include "array_string.h"  // ArrayString helper functions
+#include "wxd_string.h"    // Owned string returned by single-call getters
 #include "core/wxd_item.h" // Added for wxd_DataViewItem_t and its functions
 #include "wxd_sysopt.h"
 #include "wxd_logging.h" // Logging functions
@@ -23,7 +24,14 @@ extern "C" {
 
 // Include API categories
 #include "core/wxd_app.h"
+#include "core/wxd_profile.h"
 #include "core/wxd_window_base.h"
+#include "core/wxd_refresh.h"
+#include "core/wxd_visibility.h"
+#include "core/wxd_widget_tree.h"
+#include "core/wxd_window_snapshot.h"
+#include "core/wxd_style_rules.h"
+#include "core/wxd_dir_listing.h"
 #include "core/wxd_accessible.h"
 #include "core/wxd_cursor.h"
 #if wxdUSE_XRC
@@ -60,11 +68,18 @@ extern "C" {
 #include "widgets/wxd_staticline.h"
 #include "widgets/wxd_scrollbar.h"
 #include "widgets/wxd_bitmapbutton.h"
+#include "widgets/wxd_canvas.h"
+#include "widgets/wxd_vlistbox.h"
+#include "widgets/wxd_hvscrolledwindow.h"
 
 #if wxdUSE_WEBVIEW
 #include "widgets/wxd_webview.h"
 #endif
 
+#if wxdUSE_OPENGL
+#include "widgets/wxd_glcanvas.h"
+#endif
+
 // List and choice widgets
 #include "widgets/wxd_listbox.h"
 #include "widgets/wxd_choice.h"
@@ -78,6 +93,8 @@ extern "C" {
 #include "widgets/wxd_grid.h"
 #include "widgets/wxd_propertygrid.h"
 #include "widgets/wxd_dataview.h"
+#include "widgets/wxd_typeahead.h"
+#include "widgets/wxd_completion.h"
 
 // Include ImageList FFI
 #include "widgets/wxd_imagelist.h"
@@ -91,6 +108,7 @@ extern "C" {
 #include "widgets/wxd_treebook.h"
 #include "widgets/wxd_notebook.h"
 #include "widgets/wxd_simplebook.h"
+#include "widgets/wxd_bookctrl.h"
 
 // Window and UI elements
 #include "widgets/wxd_frame.h"
@@ -121,6 +139,11 @@ extern "C" {
 
 // IPC (Inter-Process Communication)
 #include "core/wxd_ipc.h"
+#include "core/wxd_fswatcher.h"
+#include "core/wxd_process.h"
+#include "core/wxd_socket.h"
+#include "core/wxd_resource_bundle.h"
+#include "core/wxd_hotkeys.h"
 
 // Printing
 #include "core/wxd_print.h"
@@ -134,6 +157,9 @@ extern "C" {
 #include "dialogs/wxd_about.h"
 #include "dnd/wxd_dnd.h"     // Drag and drop functionality
 #include "graphics/wxd_dc.h" // Device context functionality
+#include "graphics/wxd_graphics.h" // wxGraphicsContext and paths
+#include "graphics/wxd_offscreen.h" // Offscreen surfaces and window capture
+#include "graphics/wxd_spatialindex.h" // Hit-testing index for custom-drawn content
 
 // DataView related includes.
 // wxd_dataview.h provides main FFI for DataViewCtrl, ListCtrl, TreeCtrl (creation),
@@ -157,6 +183,7 @@ extern "C" {
 #include "core/wxd_translations.h"
 #include "core/wxd_singleinstancechecker.h"
 #include "core/wxd_uiactionsimulator.h"
+#include "core/wxd_input_replay.h"
 #include "core/wxd_config.h"
 #include "core/wxd_misc.h"
 
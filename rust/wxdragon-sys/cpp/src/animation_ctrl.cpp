@@ -2,7 +2,297 @@
 #include <wx/wx.h>
 #include <wx/animate.h>
 #include <wx/mstream.h>
+#include <wx/wfstream.h>
+#include <wx/timer.h>
+#include <wx/animdecod.h>
+#if wxUSE_GIF
+#include <wx/gifdecod.h>
+#endif
+#if wxUSE_ICO_CUR
+#include <wx/anidecod.h>
+#endif
 #include "wxdragon.h"
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// --- Shared animations ---
+
+namespace {
+
+// An animation decoded once into full-canvas frames, shown by any number of wxAnimationCtrls.
+// A single timer advances the frame for all of them; each tick hands every playing control the
+// same bitmap as its static image, which the controls share by reference instead of keeping
+// their own decoder and backing store.
+class SharedAnimation : public std::enable_shared_from_this<SharedAnimation> {
+public:
+    struct Frame {
+        wxBitmapBundle bitmap;
+        long delay;
+    };
+
+    SharedAnimation(std::vector<Frame> frames, const wxSize& size)
+        : m_frames(std::move(frames)), m_size(size)
+    {
+        m_timer.Bind(wxEVT_TIMER, [this](wxTimerEvent&) { Advance(); });
+    }
+
+    ~SharedAnimation()
+    {
+        m_timer.Stop();
+    }
+
+    size_t
+    FrameCount() const
+    {
+        return m_frames.size();
+    }
+
+    const wxSize&
+    Size() const
+    {
+        return m_size;
+    }
+
+    void
+    Attach(wxAnimationCtrl* ctrl)
+    {
+        m_controls.push_back({ ctrl, false });
+        Show(ctrl, 0);
+    }
+
+    void
+    Detach(wxAnimationCtrl* ctrl)
+    {
+        m_controls.erase(std::remove_if(m_controls.begin(), m_controls.end(),
+                                        [ctrl](const Control& c) { return c.ctrl == ctrl; }),
+                         m_controls.end());
+        UpdateTimer();
+    }
+
+    void
+    SetPlaying(wxAnimationCtrl* ctrl, bool playing)
+    {
+        for (Control& c : m_controls) {
+            if (c.ctrl != ctrl)
+                continue;
+            c.playing = playing;
+            // Playing controls join the shared frame; stopped ones rest on the first.
+            Show(ctrl, playing ? m_current : 0);
+        }
+        UpdateTimer();
+    }
+
+    bool
+    IsPlaying(wxAnimationCtrl* ctrl) const
+    {
+        for (const Control& c : m_controls) {
+            if (c.ctrl == ctrl)
+                return c.playing;
+        }
+        return false;
+    }
+
+private:
+    struct Control {
+        wxAnimationCtrl* ctrl;
+        bool playing;
+    };
+
+    void
+    Show(wxAnimationCtrl* ctrl, size_t frame)
+    {
+        if (frame < m_frames.size())
+            ctrl->SetInactiveBitmap(m_frames[frame].bitmap);
+    }
+
+    void
+    UpdateTimer()
+    {
+        const bool any = m_frames.size() > 1 &&
+                         std::any_of(m_controls.begin(), m_controls.end(),
+                                     [](const Control& c) { return c.playing; });
+        if (!any) {
+            m_timer.Stop();
+            m_current = 0;
+        }
+        else if (!m_timer.IsRunning()) {
+            m_timer.StartOnce(Delay(m_current));
+        }
+    }
+
+    int
+    Delay(size_t frame) const
+    {
+        // Browsers treat very short GIF delays as 100ms; do the same rather than spin.
+        const long delay = m_frames[frame].delay;
+        return delay > 10 ? static_cast<int>(delay) : 100;
+    }
+
+    void
+    Advance()
+    {
+        m_current = (m_current + 1) % m_frames.size();
+        // Keep a reference: a control could drop the last one from a paint it triggers.
+        std::shared_ptr<SharedAnimation> self = shared_from_this();
+        for (const Control& c : m_controls) {
+            if (c.playing && c.ctrl->IsShownOnScreen())
+                Show(c.ctrl, m_current);
+        }
+        UpdateTimer();
+    }
+
+    std::vector<Frame> m_frames;
+    wxSize m_size;
+    std::vector<Control> m_controls;
+    size_t m_current = 0;
+    wxTimer m_timer;
+};
+
+struct AnimationHandle {
+    std::shared_ptr<SharedAnimation> animation;
+};
+
+std::unordered_map<wxWindow*, std::shared_ptr<SharedAnimation>>&
+attached()
+{
+    static std::unordered_map<wxWindow*, std::shared_ptr<SharedAnimation>> map;
+    return map;
+}
+
+std::shared_ptr<SharedAnimation>
+attached_to(wxAnimationCtrl* ctrl)
+{
+    auto it = attached().find(ctrl);
+    return it == attached().end() ? nullptr : it->second;
+}
+
+void
+detach(wxAnimationCtrl* ctrl)
+{
+    auto it = attached().find(ctrl);
+    if (it == attached().end())
+        return;
+    std::shared_ptr<SharedAnimation> animation = std::move(it->second);
+    attached().erase(it);
+    animation->Detach(ctrl);
+}
+
+void
+on_shared_ctrl_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    if (event.GetEventObject() == event.GetWindow())
+        detach(static_cast<wxAnimationCtrl*>(event.GetWindow()));
+}
+
+// Draws `frame` over `canvas` with straight alpha.
+void
+composite(wxImage& canvas, const wxImage& frame, const wxPoint& pos)
+{
+    const int cw = canvas.GetWidth(), ch = canvas.GetHeight();
+    unsigned char* dst = canvas.GetData();
+    unsigned char* dst_alpha = canvas.GetAlpha();
+    const unsigned char* src = frame.GetData();
+    const unsigned char* src_alpha = frame.GetAlpha();
+    for (int y = 0; y < frame.GetHeight(); ++y) {
+        const int cy = pos.y + y;
+        if (cy < 0 || cy >= ch)
+            continue;
+        for (int x = 0; x < frame.GetWidth(); ++x) {
+            const int cx = pos.x + x;
+            if (cx < 0 || cx >= cw)
+                continue;
+            const size_t s = static_cast<size_t>(y) * frame.GetWidth() + x;
+            const size_t d = static_cast<size_t>(cy) * cw + cx;
+            const unsigned a = src_alpha ? src_alpha[s] : 255;
+            if (a == 0)
+                continue;
+            const unsigned da = dst_alpha[d] * (255 - a) / 255;
+            const unsigned out = a + da;
+            for (int c = 0; c < 3; ++c)
+                dst[d * 3 + c] =
+                    static_cast<unsigned char>((src[s * 3 + c] * a + dst[d * 3 + c] * da) / out);
+            dst_alpha[d] = static_cast<unsigned char>(out);
+        }
+    }
+}
+
+void
+clear_rect(wxImage& canvas, const wxRect& rect)
+{
+    const wxRect r = rect.Intersect(wxRect(canvas.GetSize()));
+    unsigned char* alpha = canvas.GetAlpha();
+    for (int y = r.y; y < r.GetBottom() + 1; ++y)
+        std::fill_n(alpha + static_cast<size_t>(y) * canvas.GetWidth() + r.x, r.width, 0);
+}
+
+wxAnimationDecoder*
+decoder_for(wxInputStream& stream)
+{
+#if wxUSE_GIF
+    {
+        wxGIFDecoder* gif = new wxGIFDecoder;
+        if (gif->CanRead(stream))
+            return gif;
+        gif->DecRef();
+    }
+#endif
+#if wxUSE_ICO_CUR
+    {
+        wxANIDecoder* ani = new wxANIDecoder;
+        if (ani->CanRead(stream))
+            return ani;
+        ani->DecRef();
+    }
+#endif
+    return nullptr;
+}
+
+// Decodes every frame and applies the disposal methods, so playback only swaps bitmaps.
+wxd_Animation_t*
+decode_shared(wxInputStream& stream)
+{
+    wxObjectDataPtr<wxAnimationDecoder> decoder(decoder_for(stream));
+    if (!decoder || !decoder->Load(stream) || decoder->GetFrameCount() == 0)
+        return nullptr;
+
+    const wxSize size = decoder->GetAnimationSize();
+    if (size.x <= 0 || size.y <= 0)
+        return nullptr;
+    wxImage canvas(size);
+    canvas.InitAlpha();
+    std::fill_n(canvas.GetAlpha(), static_cast<size_t>(size.x) * size.y, 0);
+
+    std::vector<SharedAnimation::Frame> frames;
+    frames.reserve(decoder->GetFrameCount());
+    for (unsigned int i = 0; i < decoder->GetFrameCount(); ++i) {
+        wxImage image;
+        if (!decoder->ConvertToImage(i, &image))
+            continue;
+        if (!image.HasAlpha())
+            image.InitAlpha(); // Turns the transparent colour's mask into alpha.
+        const wxPoint pos = decoder->GetFramePosition(i);
+        const wxAnimationDisposal disposal = decoder->GetDisposalMethod(i);
+        const wxImage previous = disposal == wxANIM_TOPREVIOUS ? canvas.Copy() : wxImage();
+
+        composite(canvas, image, pos);
+        frames.push_back({ wxBitmapBundle(wxBitmap(canvas)), decoder->GetDelay(i) });
+
+        if (disposal == wxANIM_TOBACKGROUND)
+            clear_rect(canvas, wxRect(pos, decoder->GetFrameSize(i)));
+        else if (disposal == wxANIM_TOPREVIOUS)
+            canvas = previous;
+    }
+    if (frames.empty())
+        return nullptr;
+    auto* handle = new AnimationHandle;
+    handle->animation = std::make_shared<SharedAnimation>(std::move(frames), size);
+    return reinterpret_cast<wxd_Animation_t*>(handle);
+}
+
+} // namespace
 
 // --- wxAnimationCtrl ---
 
@@ -45,6 +335,10 @@ wxd_AnimationCtrl_Play(wxd_AnimationCtrl_t* self)
 {
     if (!self)
         return false;
+    if (auto shared = attached_to((wxAnimationCtrl*)self)) {
+        shared->SetPlaying((wxAnimationCtrl*)self, true);
+        return true;
+    }
     return ((wxAnimationCtrl*)self)->Play();
 }
 
@@ -53,6 +347,10 @@ wxd_AnimationCtrl_Stop(wxd_AnimationCtrl_t* self)
 {
     if (!self)
         return;
+    if (auto shared = attached_to((wxAnimationCtrl*)self)) {
+        shared->SetPlaying((wxAnimationCtrl*)self, false);
+        return;
+    }
     ((wxAnimationCtrl*)self)->Stop();
 }
 
@@ -61,6 +359,8 @@ wxd_AnimationCtrl_IsPlaying(wxd_AnimationCtrl_t* self)
 {
     if (!self)
         return false;
+    if (auto shared = attached_to((wxAnimationCtrl*)self))
+        return shared->IsPlaying((wxAnimationCtrl*)self);
     return ((wxAnimationCtrl*)self)->IsPlaying();
 }
 
@@ -73,6 +373,7 @@ wxd_AnimationCtrl_LoadFile(wxd_AnimationCtrl_t* self, const char* animation_file
     if (wx_animation_file.IsEmpty())
         return false; // Cannot load an empty file path
 
+    detach((wxAnimationCtrl*)self);
     // wxAnimationCtrl::LoadFile returns bool
     return ((wxAnimationCtrl*)self)->LoadFile(wx_animation_file);
 }
@@ -91,6 +392,7 @@ wxd_AnimationCtrl_LoadFromBytes(wxd_AnimationCtrl_t* self, const unsigned char*
 
     wxAnimation animation;
     if (animation.Load(stream)) {
+        detach(ctrl);
         ctrl->SetAnimation(animation); // SetAnimation returns void
         return true;                   // Return true if Load and SetAnimation were called
     }
@@ -98,4 +400,75 @@ wxd_AnimationCtrl_LoadFromBytes(wxd_AnimationCtrl_t* self, const unsigned char*
         // wxAnimation::Load failed
         return false;
     }
-}
\ No newline at end of file
+}
+
+WXD_EXPORTED wxd_Animation_t*
+wxd_Animation_CreateFromBytes(const unsigned char* data, size_t len)
+{
+    if (!data || len == 0)
+        return nullptr;
+    wxMemoryInputStream stream(data, len);
+    return stream.IsOk() ? decode_shared(stream) : nullptr;
+}
+
+WXD_EXPORTED wxd_Animation_t*
+wxd_Animation_CreateFromFile(const char* path)
+{
+    if (!path)
+        return nullptr;
+    wxFileInputStream stream(wxString::FromUTF8(path));
+    return stream.IsOk() ? decode_shared(stream) : nullptr;
+}
+
+WXD_EXPORTED void
+wxd_Animation_Destroy(wxd_Animation_t* animation)
+{
+    delete reinterpret_cast<AnimationHandle*>(animation);
+}
+
+WXD_EXPORTED int
+wxd_Animation_GetFrameCount(const wxd_Animation_t* animation)
+{
+    if (!animation)
+        return 0;
+    return static_cast<int>(
+        reinterpret_cast<const AnimationHandle*>(animation)->animation->FrameCount());
+}
+
+WXD_EXPORTED wxd_Size
+wxd_Animation_GetSize(const wxd_Animation_t* animation)
+{
+    wxd_Size size = { 0, 0 };
+    if (animation) {
+        const wxSize& s = reinterpret_cast<const AnimationHandle*>(animation)->animation->Size();
+        size.width = s.x;
+        size.height = s.y;
+    }
+    return size;
+}
+
+WXD_EXPORTED void
+wxd_AnimationCtrl_SetSharedAnimation(wxd_AnimationCtrl_t* self, const wxd_Animation_t* animation)
+{
+    if (!self)
+        return;
+    wxAnimationCtrl* ctrl = (wxAnimationCtrl*)self;
+    const bool was_attached = attached_to(ctrl) != nullptr;
+    detach(ctrl);
+    if (!animation) {
+        if (was_attached) {
+            ctrl->SetInactiveBitmap(wxBitmapBundle());
+            ctrl->Unbind(wxEVT_DESTROY, on_shared_ctrl_destroy);
+        }
+        return;
+    }
+    // Drop the control's own decoded frames and timer; the shared animation replaces them.
+    ctrl->Stop();
+    ctrl->SetAnimation(wxNullAnimation);
+    std::shared_ptr<SharedAnimation> shared =
+        reinterpret_cast<const AnimationHandle*>(animation)->animation;
+    attached()[ctrl] = shared;
+    if (!was_attached)
+        ctrl->Bind(wxEVT_DESTROY, on_shared_ctrl_destroy);
+    shared->Attach(ctrl);
+}
@@ -4,11 +4,21 @@
 #include "../include/wxdragon.h"
 #include <wx/app.h>
 #include <wx/image.h>
+#include <wx/evtloop.h>
 #include <cstdlib>
 #include <wx/private/safecall.h>
 #include <wx/scopeguard.h>
 #include <vector>
 #include <utility>
+#include <atomic>
+#include <memory>
+#include <wx/thread.h>
+#include <wx/msgqueue.h>
+#include <wx/weakref.h>
+#include "wxd_single_instance.h"
+#include "wxd_startup.h"
+#include "wxd_watchdog.h"
+#include "wxd_trace.h"
 
 // --- Globals ---
 // Store the C callback and user data provided to wxd_Main
@@ -19,6 +29,15 @@ static void* g_OnInitUserData = nullptr;
 extern "C" int
 process_rust_callbacks();
 
+// Per-drain time budget read by process_rust_callbacks(); set from any thread
+static std::atomic<uint32_t> g_CallbackBudgetMicros{ 4000 };
+
+// Callbacks queued on the Rust side and not yet run. Kept here so the idle handler can skip the
+// drain (and the queue locks) without calling into Rust when nothing was posted.
+static std::atomic<uint32_t> g_PendingCallbacks{ 0 };
+
+static std::atomic<int> g_IdleMode{ WXD_IDLE_MODE_ALWAYS };
+
 // --- Internal C++ App Class ---
 
 class WxdApp : public wxApp {
@@ -38,6 +57,10 @@ public:
     void
     OnIdle(wxIdleEvent& event);
 
+    // Binds or unbinds OnIdle to match the idle mode and the pending count. GUI thread only.
+    void
+    SyncIdleBinding();
+
     // Override OnExit to clean up IPC/DDE objects before module cleanup
     virtual int OnExit() override;
 
@@ -63,12 +86,17 @@ public:
         std::vector<std::pair<wxd_MacPrintFilesCallback, void*>> printFiles;
     } m_macCallbacks;
 #endif
+
+private:
+    bool m_idleBound = false;
 };
 
 // Implementation of OnInit - this is where we call the C callback
 bool
 WxdApp::OnInit()
 {
+    wxd_startup::mark(WXD_STARTUP_ONINIT_BEGIN);
+
     // Call base class OnInit (important)
     if (!wxApp::OnInit()) {
         return false;
@@ -79,17 +107,21 @@ WxdApp::OnInit()
     SetUseBestVisual(true);
 #endif
 
-    // Initialize all stock items (standard icons, etc.)
-    wxInitializeStockLists();
+    // wxAppBase::Initialize already created the stock lists (colour database, pen, brush and
+    // font lists); creating them again here would only leak the first set.
+    if (!wxTheColourDatabase)
+        wxInitializeStockLists();
 
-    // Bind idle event to process callbacks
-    Bind(wxEVT_IDLE, &WxdApp::OnIdle, this);
+    // Bind idle event to process callbacks (in on-demand mode only while callbacks are pending)
+    SyncIdleBinding();
 
     // Call the stored C callback function
     if (g_OnInitCallback) {
         // The callback is responsible for creating the main window
         // and calling wxd_App_SetTopWindow.
+        wxd_startup::mark(WXD_STARTUP_RUST_INIT_BEGIN);
         bool success = g_OnInitCallback(g_OnInitUserData);
+        wxd_startup::mark(WXD_STARTUP_RUST_INIT_END);
         return success;
     }
     else {
@@ -103,23 +135,54 @@ WxdApp::OnInit()
 void
 WxdApp::OnIdle(wxIdleEvent& event)
 {
+    // Nothing queued: skip the call into Rust entirely. Apps that keep idle events coming for
+    // animations would otherwise pay for a drain attempt on every iteration.
+    if (g_PendingCallbacks.load(std::memory_order_acquire) == 0) {
+        SyncIdleBinding();
+        return;
+    }
+
     // Process any pending Rust callbacks
-    int callbacks_processed = process_rust_callbacks();
+    int callbacks_processed;
+    {
+        wxd_watchdog::Scope watch(wxEVT_IDLE, this);
+        wxd_trace::Span trace_span(wxd_trace::CATEGORY_IDLE, "Rust callback drain");
+        callbacks_processed = process_rust_callbacks();
+    }
 
-    // Only request more idle events if there were callbacks to process
-    // This prevents unnecessary CPU usage when the app is idle
+    // Only request more idle events if there were callbacks to process (the budget may have
+    // run out with work left). This prevents unnecessary CPU usage when the app is idle
     if (callbacks_processed > 0) {
         event.RequestMore();
     }
+    else {
+        SyncIdleBinding();
+    }
+}
+
+void
+WxdApp::SyncIdleBinding()
+{
+    const bool want = g_IdleMode.load(std::memory_order_relaxed) == WXD_IDLE_MODE_ALWAYS ||
+                      g_PendingCallbacks.load(std::memory_order_acquire) > 0;
+    if (want == m_idleBound)
+        return;
+    if (want)
+        Bind(wxEVT_IDLE, &WxdApp::OnIdle, this);
+    else
+        Unbind(wxEVT_IDLE, &WxdApp::OnIdle, this);
+    m_idleBound = want;
 }
 
 // Clean up IPC/DDE objects before wxWidgets module cleanup.
 // On Windows, wxDDECleanUp() asserts all DDE objects are gone.
 // Rust-side Drop impls may not run until after that point, so
 // we proactively destroy any remaining IPC objects here.
+// Write-behind configs are flushed while their timers can still be stopped.
 int
 WxdApp::OnExit()
 {
+    wxd_Config_FlushAllPending();
     wxd_IPC_CleanupAll();
     return wxApp::OnExit();
 }
@@ -175,17 +238,29 @@ wxd_Main(int argc, char** argv, wxd_OnInitCallback on_init_cb, void* userData)
         return 1;
     }
 
+    wxd_startup::mark(WXD_STARTUP_MAIN_ENTRY);
+
+    // A later instance hands its arguments over and exits before paying for wx initialization.
+    if (wxd_single_instance::hand_off(argc, argv)) {
+        wxd_single_instance::shutdown();
+        return 0;
+    }
+
     g_OnInitCallback = on_init_cb;
     g_OnInitUserData = userData;
 
     if (!wxEntryStart(argc, argv)) {
         fprintf(stderr, "wxDragon Error: Failed to initialize wxWidgets (wxEntryStart failed).\n");
+        wxd_single_instance::shutdown();
         return 1;
     }
 
-    // Initialize all available image handlers (PNG, JPEG, etc.)
-    // This must be done after wxEntryStart and before any image loading (e.g., in app OnInit).
-    wxInitAllImageHandlers();
+    wxd_startup::mark(WXD_STARTUP_ENTRY_START_DONE);
+    // Image handlers (PNG, JPEG, TIFF, ...) are registered on first use by the entry points that
+    // decode or encode images, or after the first paint at the latest; see wxd_startup.h.
+
+    // No-op unless a stall threshold was configured with wxd_Watchdog_SetThreshold().
+    wxd_watchdog::start();
 
     int result = wxSafeCall<int>(
         []() {
@@ -203,6 +278,10 @@ wxd_Main(int argc, char** argv, wxd_OnInitCallback on_init_cb, void* userData)
             // ensure that OnExit() is called if OnInit() had succeeded
             wxON_BLOCK_EXIT_OBJ0(*wxTheApp, wxApp::OnExit);
 
+            // Arguments from later instances reach the app from the event loop on.
+            wxd_single_instance::app_started();
+            wxd_startup::app_started();
+
             // Rust initialization was successful (returned true),
             // then app execution, start the main event loop
             return wxTheApp->OnRun();
@@ -212,6 +291,9 @@ wxd_Main(int argc, char** argv, wxd_OnInitCallback on_init_cb, void* userData)
             return wxApp::GetFatalErrorExitCode();
         });
 
+    wxd_watchdog::stop();
+    wxd_single_instance::shutdown();
+    wxd_startup::shutdown();
     wxEntryCleanup();
     g_OnInitCallback = nullptr;
     g_OnInitUserData = nullptr;
@@ -364,6 +446,72 @@ void
 wxd_App_ProcessCallbacks()
 {
     process_rust_callbacks();
+    if (wxTheApp)
+        wxGetApp().SyncIdleBinding();
+}
+
+// Called from worker threads: CallAfter() queues a thread-safe event on the app and wakes the
+// loop, so the queue is drained on the next iteration rather than the next idle event.
+void
+wxd_App_PostCallbacksWakeup()
+{
+    wxApp* app = wxDynamicCast(wxTheApp, wxApp);
+    if (!app) {
+        return; // Not running yet; OnIdle drains the queue once the loop starts
+    }
+    // Background callbacks left over by the drain are picked up by the idle handler, which in
+    // on-demand mode is bound here for as long as they are pending.
+    app->CallAfter([]() {
+        process_rust_callbacks();
+        wxGetApp().SyncIdleBinding();
+    });
+}
+
+uint32_t
+wxd_App_AdjustPendingCallbacks(int32_t delta)
+{
+    return g_PendingCallbacks.fetch_add(static_cast<uint32_t>(delta), std::memory_order_acq_rel) +
+           static_cast<uint32_t>(delta);
+}
+
+uint32_t
+wxd_App_GetPendingCallbacks()
+{
+    return g_PendingCallbacks.load(std::memory_order_acquire);
+}
+
+void
+wxd_App_SetIdleMode(wxd_IdleMode mode)
+{
+    g_IdleMode.store(mode, std::memory_order_relaxed);
+    // Before OnInit the binding is made there; later calls must come from the GUI thread.
+    if (wxTheApp && wxThread::IsMain())
+        wxGetApp().SyncIdleBinding();
+}
+
+wxd_IdleMode
+wxd_App_GetIdleMode()
+{
+    return static_cast<wxd_IdleMode>(g_IdleMode.load(std::memory_order_relaxed));
+}
+
+void
+wxd_App_SetCallbackBudgetMicros(uint32_t micros)
+{
+    g_CallbackBudgetMicros.store(micros, std::memory_order_relaxed);
+}
+
+uint32_t
+wxd_App_GetCallbackBudgetMicros()
+{
+    return g_CallbackBudgetMicros.load(std::memory_order_relaxed);
+}
+
+bool
+wxd_App_HasPendingEvents()
+{
+    wxEventLoopBase* loop = wxEventLoopBase::GetActive();
+    return loop && loop->Pending();
 }
 
 // Implementation for wxd_free_int_array
@@ -499,6 +647,208 @@ wxd_SystemAppearance_Destroy(wxd_SystemAppearance_t* appearance)
 
 // --- End of Appearance Support Implementation ---
 
+// --- Worker Pool Implementation ---
+
+namespace {
+
+struct WxdWorkerJob {
+    wxd_WorkerRunFn run = nullptr;
+    wxd_WorkerDoneFn done = nullptr;
+    void* data = nullptr;
+    bool has_target = false;
+    // Only read and destroyed on the main thread; workers never touch it.
+    wxWeakRef<wxEvtHandler> target;
+};
+
+bool
+wxd_worker_job_target_alive(const WxdWorkerJob* job)
+{
+    return !job->has_target || job->target.get() != nullptr;
+}
+
+// Shared between the pool, its workers and queued deliveries, so a delivery that runs after
+// wxd_WorkerPool_Destroy finds an empty batch instead of a dangling pool.
+struct WxdWorkerPoolState {
+    wxMessageQueue<WxdWorkerJob*> jobs; // nullptr tells a worker to exit
+    wxMutex finishedMutex;
+    std::vector<WxdWorkerJob*> finished;
+    bool deliveryQueued = false;
+    std::atomic<int> pending{ 0 };
+
+    // Main thread: hands finished jobs back to their owner.
+    void
+    DeliverFinished()
+    {
+        std::vector<WxdWorkerJob*> batch;
+        {
+            wxMutexLocker lock(finishedMutex);
+            batch.swap(finished);
+            deliveryQueued = false;
+        }
+        for (WxdWorkerJob* job : batch) {
+            job->done(job->data, wxd_worker_job_target_alive(job));
+            pending.fetch_sub(1, std::memory_order_relaxed);
+            delete job;
+        }
+    }
+};
+
+class WxdWorkerThread : public wxThread {
+public:
+    explicit WxdWorkerThread(std::shared_ptr<WxdWorkerPoolState> state)
+        : wxThread(wxTHREAD_JOINABLE), m_state(std::move(state))
+    {
+    }
+
+protected:
+    virtual ExitCode
+    Entry() override
+    {
+        for (;;) {
+            WxdWorkerJob* job = nullptr;
+            if (m_state->jobs.Receive(job) != wxMSGQUEUE_NO_ERROR || !job) {
+                break;
+            }
+            job->run(job->data);
+
+            // Coalesce: one main-thread delivery per burst of finished jobs.
+            bool post = false;
+            {
+                wxMutexLocker lock(m_state->finishedMutex);
+                m_state->finished.push_back(job);
+                post = !m_state->deliveryQueued;
+                m_state->deliveryQueued = true;
+            }
+            if (post && wxTheApp) {
+                std::shared_ptr<WxdWorkerPoolState> state = m_state;
+                wxTheApp->CallAfter([state]() { state->DeliverFinished(); });
+            }
+        }
+        return static_cast<ExitCode>(0);
+    }
+
+private:
+    std::shared_ptr<WxdWorkerPoolState> m_state;
+};
+
+struct WxdWorkerPool {
+    std::shared_ptr<WxdWorkerPoolState> state;
+    std::vector<WxdWorkerThread*> threads;
+};
+
+} // namespace
+
+wxd_WorkerPool_t*
+wxd_WorkerPool_Create(int thread_count)
+{
+    if (thread_count <= 0) {
+        thread_count = wxThread::GetCPUCount();
+        if (thread_count <= 0) {
+            thread_count = 2;
+        }
+    }
+
+    WxdWorkerPool* pool = new WxdWorkerPool();
+    pool->state = std::make_shared<WxdWorkerPoolState>();
+    for (int i = 0; i < thread_count; ++i) {
+        WxdWorkerThread* thread = new WxdWorkerThread(pool->state);
+        if (thread->Run() != wxTHREAD_NO_ERROR) {
+            WXD_LOG_WARNF("wxd_WorkerPool_Create: failed to start worker %d", i);
+            delete thread;
+            continue;
+        }
+        pool->threads.push_back(thread);
+    }
+    if (pool->threads.empty()) {
+        WXD_LOG_ERROR("wxd_WorkerPool_Create: no worker thread could be started");
+        delete pool;
+        return nullptr;
+    }
+    return reinterpret_cast<wxd_WorkerPool_t*>(pool);
+}
+
+bool
+wxd_WorkerPool_Submit(wxd_WorkerPool_t* pool, wxd_EvtHandler_t* target, wxd_WorkerRunFn run,
+                      wxd_WorkerDoneFn done, void* job)
+{
+    WxdWorkerPool* wx_pool = reinterpret_cast<WxdWorkerPool*>(pool);
+    if (!wx_pool || !run || !done) {
+        return false;
+    }
+
+    WxdWorkerJob* item = new WxdWorkerJob();
+    item->run = run;
+    item->done = done;
+    item->data = job;
+    if (target) {
+        item->has_target = true;
+        item->target = reinterpret_cast<wxEvtHandler*>(target);
+    }
+
+    wx_pool->state->pending.fetch_add(1, std::memory_order_relaxed);
+    if (wx_pool->state->jobs.Post(item) != wxMSGQUEUE_NO_ERROR) {
+        wx_pool->state->pending.fetch_sub(1, std::memory_order_relaxed);
+        delete item;
+        return false;
+    }
+    return true;
+}
+
+int
+wxd_WorkerPool_GetPendingCount(wxd_WorkerPool_t* pool)
+{
+    WxdWorkerPool* wx_pool = reinterpret_cast<WxdWorkerPool*>(pool);
+    if (!wx_pool) {
+        return 0;
+    }
+    return wx_pool->state->pending.load(std::memory_order_relaxed);
+}
+
+void
+wxd_WorkerPool_Destroy(wxd_WorkerPool_t* pool)
+{
+    WxdWorkerPool* wx_pool = reinterpret_cast<WxdWorkerPool*>(pool);
+    if (!wx_pool) {
+        return;
+    }
+    std::shared_ptr<WxdWorkerPoolState> state = wx_pool->state;
+
+    // Jobs that never started are returned to their owner unrun. target_alive still reports the
+    // target itself, so the owner can release what it attached to a live target.
+    WxdWorkerJob* job = nullptr;
+    while (state->jobs.ReceiveTimeout(0, job) == wxMSGQUEUE_NO_ERROR) {
+        if (job) {
+            job->done(job->data, wxd_worker_job_target_alive(job));
+            state->pending.fetch_sub(1, std::memory_order_relaxed);
+            delete job;
+        }
+    }
+
+    for (size_t i = 0; i < wx_pool->threads.size(); ++i) {
+        state->jobs.Post(nullptr);
+    }
+    for (WxdWorkerThread* thread : wx_pool->threads) {
+        thread->Wait();
+        delete thread;
+    }
+
+    // Finished jobs not yet delivered are handed back the same way.
+    std::vector<WxdWorkerJob*> batch;
+    {
+        wxMutexLocker lock(state->finishedMutex);
+        batch.swap(state->finished);
+    }
+    for (WxdWorkerJob* finished : batch) {
+        finished->done(finished->data, wxd_worker_job_target_alive(finished));
+        state->pending.fetch_sub(1, std::memory_order_relaxed);
+        delete finished;
+    }
+
+    delete wx_pool;
+}
+
+// --- End of Worker Pool Implementation ---
+
 // --- macOS-specific App Event Handlers Implementation ---
 
 #ifdef __WXOSX__
@@ -3,6 +3,7 @@
 #include "../include/wxdragon.h"
 #include "../include/core/wxd_appprogress.h"
 #include <wx/appprogress.h>
+#include "wxd_progress_coalescer.h"
 
 extern "C" {
 
@@ -22,6 +23,7 @@ wxd_AppProgressIndicator_Destroy(wxd_AppProgressIndicator_t* self)
     if (!self)
         return;
     wxAppProgressIndicator* appprogress = reinterpret_cast<wxAppProgressIndicator*>(self);
+    wxd_progress_coalescer::forget_app_progress(appprogress);
     delete appprogress;
 }
 
@@ -42,6 +44,7 @@ wxd_AppProgressIndicator_SetValue(wxd_AppProgressIndicator_t* self, int value)
     if (!self)
         return;
     wxAppProgressIndicator* appprogress = reinterpret_cast<wxAppProgressIndicator*>(self);
+    wxd_progress_coalescer::cancel(appprogress);
     appprogress->SetValue(value);
 }
 
@@ -52,6 +55,7 @@ wxd_AppProgressIndicator_SetRange(wxd_AppProgressIndicator_t* self, int range)
     if (!self)
         return;
     wxAppProgressIndicator* appprogress = reinterpret_cast<wxAppProgressIndicator*>(self);
+    wxd_progress_coalescer::set_app_progress_range(appprogress, range);
     appprogress->SetRange(range);
 }
 
@@ -2,6 +2,8 @@
 #include <wx/wx.h>
 #include "../include/wxdragon.h"
 #include <wx/arrstr.h>
+#include <cstring>
+#include <vector>
 
 // ArrayString helper functions
 WXD_EXPORTED wxd_ArrayString_t*
@@ -79,6 +81,56 @@ wxd_ArrayString_Clear(wxd_ArrayString_t* self)
     wx_arr_str->Clear();
 }
 
+WXD_EXPORTED wxd_String_t*
+wxd_ArrayString_ExportPacked(const wxd_ArrayString_t* array, size_t* offsets, size_t offsets_len)
+{
+    if (!array || !offsets)
+        return nullptr;
+    const wxArrayString* wx_array = reinterpret_cast<const wxArrayString*>(array);
+    const size_t count = wx_array->GetCount();
+    if (offsets_len < count + 1)
+        return nullptr;
+
+    // Convert each string once, then lay them out back to back.
+    std::vector<wxScopedCharBuffer> utf8;
+    utf8.reserve(count);
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        utf8.push_back(wx_array->Item(i).utf8_str());
+        offsets[i] = total;
+        total += utf8.back().length();
+    }
+    offsets[count] = total;
+
+    wxCharBuffer packed(total);
+    if (total > 0 && !packed.data())
+        return nullptr;
+    for (size_t i = 0; i < count; ++i) {
+        memcpy(packed.data() + offsets[i], utf8[i].data(), utf8[i].length());
+    }
+    return wxd_cpp_utils::make_owned_string(packed);
+}
+
+WXD_EXPORTED bool
+wxd_ArrayString_ImportPacked(wxd_ArrayString_t* self, const char* data, const size_t* offsets,
+                             size_t count)
+{
+    if (!self || !offsets || (count > 0 && !data))
+        return false;
+    // Check every range before appending so a bad one leaves the array unchanged.
+    for (size_t i = 0; i < count; ++i) {
+        if (offsets[i + 1] < offsets[i]) {
+            return false;
+        }
+    }
+    wxArrayString* wx_arr_str = reinterpret_cast<wxArrayString*>(self);
+    wx_arr_str->Alloc(wx_arr_str->GetCount() + count);
+    for (size_t i = 0; i < count; ++i) {
+        wx_arr_str->Add(wxString::FromUTF8(data + offsets[i], offsets[i + 1] - offsets[i]));
+    }
+    return true;
+}
+
 // Helper function to populate a wxd_ArrayString_t from a wxArrayString
 // Exported for use by other components like file_dialog.cpp
 WXD_EXPORTED void
@@ -1,6 +1,7 @@
 #include <wx/wxprec.h>
 #include <wx/wx.h>
 #include "../include/wxdragon.h"
+#include "wxd_objstats.h"
 #include <wx/artprov.h>
 #include <wx/bitmap.h>
 #include <wx/bmpbndl.h>
@@ -33,7 +34,7 @@ wxd_ArtProvider_GetBitmap(const char* id, const char* client, wxd_Size size_req)
 
     // The returned bitmap from wxArtProvider is a new copy or a ref-counted shared instance.
     // We need to return a heap-allocated wxBitmap for consistency with other Create functions.
-    wxBitmap* new_bitmap = new wxBitmap(bitmap);
+    wxBitmap* new_bitmap = wxd_objstats::track(new wxBitmap(bitmap));
     return reinterpret_cast<wxd_Bitmap_t*>(new_bitmap);
 }
 
@@ -5,6 +5,13 @@
 
 #include <wx/aui/framemanager.h>
 #include <wx/aui/auibook.h>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 // Direction constants for AddPane function (matching wxAUI constants)
 #define WXD_AUI_DOCK_LEFT   (0)
@@ -13,9 +20,245 @@
 #define WXD_AUI_DOCK_BOTTOM (3)
 #define WXD_AUI_DOCK_CENTER (4)
 
+namespace {
+
+// A perspective string split into pane infos and dock sizes, as LoadPerspective would parse it.
+struct ParsedPerspective {
+    std::vector<wxAuiPaneInfo> panes;
+    std::vector<wxAuiDockInfo> docks;
+};
+
+// Only the fields a perspective stores; window, frame and buttons are never compared.
+bool
+same_layout(const wxAuiPaneInfo& a, const wxAuiPaneInfo& b)
+{
+    return a.state == b.state && a.caption == b.caption && a.dock_direction == b.dock_direction &&
+           a.dock_layer == b.dock_layer && a.dock_row == b.dock_row && a.dock_pos == b.dock_pos &&
+           a.dock_proportion == b.dock_proportion && a.best_size == b.best_size &&
+           a.min_size == b.min_size && a.max_size == b.max_size &&
+           a.floating_pos == b.floating_pos && a.floating_size == b.floating_size;
+}
+
+bool
+same_docks(const wxAuiDockInfoArray& current, const std::vector<wxAuiDockInfo>& target)
+{
+    if (current.GetCount() != target.size())
+        return false;
+    for (const wxAuiDockInfo& want : target) {
+        bool found = false;
+        for (size_t i = 0; i < current.GetCount() && !found; ++i) {
+            const wxAuiDockInfo& have = current.Item(i);
+            found = have.dock_direction == want.dock_direction &&
+                    have.dock_layer == want.dock_layer && have.dock_row == want.dock_row &&
+                    have.size == want.size;
+        }
+        if (!found)
+            return false;
+    }
+    return true;
+}
+
+// Replays the last mouse motion a throttled sash drag held back.
+class MotionReplayTimer : public wxTimer {
+public:
+    explicit MotionReplayTimer(std::function<void()> fire) : m_fire(std::move(fire)) {}
+
+    void
+    Notify() override
+    {
+        m_fire();
+    }
+
+private:
+    std::function<void()> m_fire;
+};
+
+// Subclass only to reach the protected pane and dock arrays for incremental perspective loads,
+// and the resize action state and motion handler for throttled live resize.
+class WxdAuiManager : public wxAuiManager {
+public:
+    WxdAuiManager() : m_replay([this] { ReplayMotion(); }) {}
+
+    ~WxdAuiManager() override
+    {
+        m_replay.Stop();
+    }
+
+    // With a non-zero interval, motion during a live sash drag reaches wxAuiManager::OnMotion
+    // (which lays out the whole frame) at most once per interval. The last motion held back is
+    // replayed when the interval ends, so the sash still follows the pointer to where it stops.
+    void
+    SetResizeThrottle(uint32_t interval_ms)
+    {
+        m_replay.Stop();
+        m_hasPending = false;
+        if (interval_ms == 0) {
+            if (m_throttled)
+                Unbind(wxEVT_MOTION, &WxdAuiManager::OnThrottledMotion, this);
+            m_throttled = false;
+            return;
+        }
+        m_interval = std::chrono::milliseconds(interval_ms);
+        if (!m_throttled)
+            Bind(wxEVT_MOTION, &WxdAuiManager::OnThrottledMotion, this);
+        m_throttled = true;
+    }
+
+    // Mirrors wxAuiManager::LoadPerspective's parser; returns false for unknown formats.
+    bool
+    Parse(const wxString& layout, ParsedPerspective& out)
+    {
+        wxString input = layout;
+        wxString part = input.BeforeFirst(wxT('|'));
+        input = input.AfterFirst(wxT('|'));
+        part.Trim(true);
+        part.Trim(false);
+        if (part != wxT("layout2"))
+            return false;
+
+        // Escaped separators inside names and captions, undone per pane below.
+        input.Replace(wxT("\\|"), wxT("\a"));
+        input.Replace(wxT("\\;"), wxT("\b"));
+
+        while (true) {
+            wxString pane_part = input.BeforeFirst(wxT('|'));
+            input = input.AfterFirst(wxT('|'));
+            pane_part.Trim(true);
+            if (pane_part.empty())
+                break;
+
+            if (pane_part.Left(9) == wxT("dock_size")) {
+                wxString piece = pane_part.BeforeFirst(wxT('=')).AfterFirst(wxT('('));
+                const wxString value = pane_part.AfterFirst(wxT('='));
+                piece = piece.BeforeLast(wxT(')'));
+                long dir = 0, layer = 0, row = 0, size = 0;
+                piece.BeforeFirst(wxT(',')).ToLong(&dir);
+                piece = piece.AfterFirst(wxT(','));
+                piece.BeforeFirst(wxT(',')).ToLong(&layer);
+                piece.AfterFirst(wxT(',')).ToLong(&row);
+                value.ToLong(&size);
+                wxAuiDockInfo dock;
+                dock.dock_direction = dir;
+                dock.dock_layer = layer;
+                dock.dock_row = row;
+                dock.size = size;
+                out.docks.push_back(dock);
+                continue;
+            }
+
+            pane_part.Replace(wxT("\a"), wxT("|"));
+            wxAuiPaneInfo pane;
+            LoadPaneInfo(pane_part, pane);
+            out.panes.push_back(pane);
+        }
+        return true;
+    }
+
+    // Same result as LoadPerspective, but only panes whose info differs are touched and the
+    // dock sizes are reset only if they differ. Returns whether anything changed.
+    bool
+    Apply(const ParsedPerspective& perspective)
+    {
+        bool changed = false;
+        bool has_maximized = false;
+        for (size_t i = 0; i < m_panes.GetCount(); ++i) {
+            wxAuiPaneInfo& pane = m_panes.Item(i);
+            // LoadPerspective hides every pane and docks the dockable ones before applying.
+            wxAuiPaneInfo target = pane;
+            if (target.IsDockable())
+                target.Dock();
+            target.Hide();
+            for (const wxAuiPaneInfo& saved : perspective.panes) {
+                if (saved.name == pane.name) {
+                    target.SafeSet(saved);
+                    break;
+                }
+            }
+            if (target.IsMaximized())
+                has_maximized = true;
+            if (!same_layout(pane, target)) {
+                pane.SafeSet(target);
+                changed = true;
+            }
+        }
+        m_hasMaximized = has_maximized;
+
+        if (!same_docks(m_docks, perspective.docks)) {
+            m_docks.Empty();
+            for (const wxAuiDockInfo& dock : perspective.docks)
+                m_docks.Add(dock);
+            changed = true;
+        }
+        return changed;
+    }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    void
+    OnThrottledMotion(wxMouseEvent& event)
+    {
+        if (m_action != actionResize) {
+            event.Skip();
+            return;
+        }
+        const Clock::time_point now = Clock::now();
+        const auto elapsed = now - m_lastResize;
+        if (elapsed >= m_interval) {
+            m_lastResize = now;
+            m_hasPending = false;
+            m_replay.Stop();
+            event.Skip();
+            return;
+        }
+        m_pendingMotion = event;
+        m_hasPending = true;
+        if (!m_replay.IsRunning()) {
+            const auto wait =
+                std::chrono::duration_cast<std::chrono::milliseconds>(m_interval - elapsed);
+            m_replay.StartOnce(std::max(1, static_cast<int>(wait.count())));
+        }
+    }
+
+    void
+    ReplayMotion()
+    {
+        if (!m_hasPending || m_action != actionResize)
+            return;
+        m_hasPending = false;
+        m_lastResize = Clock::now();
+        OnMotion(m_pendingMotion);
+    }
+
+    MotionReplayTimer m_replay;
+    bool m_throttled = false;
+    bool m_hasPending = false;
+    Clock::duration m_interval{};
+    Clock::time_point m_lastResize;
+    wxMouseEvent m_pendingMotion;
+};
+
+// Lays out once, with the managed window frozen so the whole change repaints in one go.
+void
+frozen_update(wxAuiManager* manager)
+{
+    wxWindow* managed = manager->GetManagedWindow();
+    if (managed)
+        managed->Freeze();
+    manager->Update();
+    if (managed)
+        managed->Thaw();
+}
+
+const size_t kPerspectiveCacheLimit = 16;
+
+} // namespace
+
 // Wrap wxAuiManager as wxd_AuiManager_t
 struct wxd_AuiManager_t {
     wxAuiManager* manager;
+    // Parsed perspectives by string, for LoadPerspectiveCached.
+    std::unordered_map<std::string, std::shared_ptr<ParsedPerspective>> perspectives;
 
     wxd_AuiManager_t(wxAuiManager* mgr) : manager(mgr)
     {
@@ -44,7 +287,7 @@ extern "C" {
 wxd_AuiManager_t*
 wxd_AuiManager_Create()
 {
-    wxAuiManager* manager = new wxAuiManager();
+    wxAuiManager* manager = new WxdAuiManager();
     return new wxd_AuiManager_t(manager);
 }
 
@@ -186,6 +429,136 @@ wxd_AuiManager_DetachPane(wxd_AuiManager_t* self, wxd_Window_t* window)
     return self->manager->DetachPane(wx_window);
 }
 
+int
+wxd_AuiManager_ApplyPaneChanges(wxd_AuiManager_t* self, const wxd_AuiPaneChange* changes,
+                                size_t count, bool update)
+{
+    if (!self || !self->manager || (!changes && count > 0))
+        return -1;
+
+    int changed = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const wxd_AuiPaneChange& change = changes[i];
+        wxAuiPaneInfo* pane = nullptr;
+        if (change.window)
+            pane = &self->manager->GetPane(reinterpret_cast<wxWindow*>(change.window));
+        else if (change.name)
+            pane = &self->manager->GetPane(wxString::FromUTF8(change.name));
+        if (!pane || !pane->IsOk())
+            continue;
+
+        wxAuiPaneInfo target = *pane;
+        if (change.fields & WXD_AUI_PANE_CHANGE_DIRECTION) {
+            switch (change.direction) {
+            case WXD_AUI_DOCK_LEFT:
+                target.Left();
+                break;
+            case WXD_AUI_DOCK_RIGHT:
+                target.Right();
+                break;
+            case WXD_AUI_DOCK_TOP:
+                target.Top();
+                break;
+            case WXD_AUI_DOCK_BOTTOM:
+                target.Bottom();
+                break;
+            default:
+                target.Center();
+                break;
+            }
+        }
+        if (change.fields & WXD_AUI_PANE_CHANGE_LAYER)
+            target.Layer(change.layer);
+        if (change.fields & WXD_AUI_PANE_CHANGE_ROW)
+            target.Row(change.row);
+        if (change.fields & WXD_AUI_PANE_CHANGE_POSITION)
+            target.Position(change.position);
+        if (change.fields & WXD_AUI_PANE_CHANGE_BEST_SIZE)
+            target.BestSize(change.width, change.height);
+        if (change.fields & WXD_AUI_PANE_CHANGE_FLOAT) {
+            target.Float().FloatingPosition(change.float_x, change.float_y);
+            if (change.float_width > 0 && change.float_height > 0)
+                target.FloatingSize(change.float_width, change.float_height);
+        }
+        if (change.fields & WXD_AUI_PANE_CHANGE_DOCK)
+            target.Dock();
+        if (change.fields & WXD_AUI_PANE_CHANGE_CAPTION)
+            target.Caption(wxString::FromUTF8(change.caption ? change.caption : ""));
+        if (change.fields & WXD_AUI_PANE_CHANGE_SHOW)
+            target.Show(change.show);
+
+        if (!same_layout(*pane, target)) {
+            pane->SafeSet(target);
+            ++changed;
+        }
+    }
+
+    if (update && changed > 0)
+        frozen_update(self->manager);
+    return changed;
+}
+
+bool
+wxd_AuiManager_LoadPerspectiveCached(wxd_AuiManager_t* self, const char* perspective,
+                                     bool update)
+{
+    if (!self || !self->manager || !perspective)
+        return false;
+
+    WxdAuiManager* manager = dynamic_cast<WxdAuiManager*>(self->manager);
+    if (!manager)
+        return wxd_AuiManager_LoadPerspective(self, perspective, update);
+
+    std::shared_ptr<ParsedPerspective> parsed;
+    auto it = self->perspectives.find(perspective);
+    if (it != self->perspectives.end()) {
+        parsed = it->second;
+    }
+    else {
+        parsed = std::make_shared<ParsedPerspective>();
+        if (!manager->Parse(wxString::FromUTF8(perspective), *parsed))
+            return false;
+        // A handful of saved layouts is the expected use; drop everything if that is exceeded.
+        if (self->perspectives.size() >= kPerspectiveCacheLimit)
+            self->perspectives.clear();
+        self->perspectives.emplace(perspective, parsed);
+    }
+
+    if (manager->Apply(*parsed) && update)
+        frozen_update(manager);
+    return true;
+}
+
+void
+wxd_AuiManager_ClearPerspectiveCache(wxd_AuiManager_t* self)
+{
+    if (self)
+        self->perspectives.clear();
+}
+
+bool
+wxd_AuiManager_SetLiveResizeMode(wxd_AuiManager_t* self, int mode, uint32_t interval_ms)
+{
+    if (!self || !self->manager || !self->manager->GetManagedWindow())
+        return false;
+    WxdAuiManager* manager = static_cast<WxdAuiManager*>(self->manager);
+    switch (mode) {
+    case WXD_LIVE_RESIZE_NATIVE:
+        manager->SetResizeThrottle(0);
+        return true;
+    case WXD_LIVE_RESIZE_THROTTLED:
+        manager->SetFlags(manager->GetFlags() | wxAUI_MGR_LIVE_RESIZE);
+        manager->SetResizeThrottle(interval_ms ? interval_ms : 16);
+        return true;
+    case WXD_LIVE_RESIZE_SNAPSHOT:
+        manager->SetResizeThrottle(0);
+        manager->SetFlags(manager->GetFlags() & ~wxAUI_MGR_LIVE_RESIZE);
+        return true;
+    default:
+        return false;
+    }
+}
+
 // --- wxAuiPaneInfo implementation ---
 
 wxd_AuiPaneInfo_t*
@@ -4,11 +4,205 @@
 #include <wx/aui/framemanager.h>
 #include <wx/aui/auibook.h>
 #include <wx/aui/aui.h>
+#include <memory>
+#include <string>
+#include <unordered_map>
 
 // Helper macro for string conversion, WXD_STR_TO_WX_STRING_UTF8_NULL_OK is available via wxd_utils.h in wxdragon.h
 // but can be defined locally if preferred or for standalone testing.
 // #define WXD_STR_TO_WX_STRING_UTF8_NULL_OK(str) (str ? wxString::FromUTF8(str) : wxString())
 
+namespace {
+
+// Shared menubars of an AUI MDI parent frame. Each document type registers one menubar, which
+// the frame owns; children name the type they use, and activating a child swaps the type's
+// menubar onto the frame instead of each child building and owning its own copy.
+class SharedMenuBars {
+public:
+    explicit SharedMenuBars(wxAuiMDIParentFrame* frame) : m_frame(frame) {}
+
+    // A menubar that is attached to the frame when it dies belongs to the frame (which may
+    // already have deleted it); the detached ones are ours.
+    ~SharedMenuBars()
+    {
+        wxMenuBar* attached = m_frame->GetMenuBar();
+        const bool ours_attached = m_shown && (attached == m_shown || !attached);
+        for (auto& entry : m_bars) {
+            if (!(ours_attached && entry.second == m_shown))
+                delete entry.second;
+        }
+        if (m_shown && m_base_saved && m_base != attached)
+            delete m_base;
+    }
+
+    void
+    Register(const std::string& key, wxMenuBar* bar)
+    {
+        wxMenuBar*& slot = m_bars[key];
+        wxMenuBar* old = slot;
+        slot = bar;
+        // The active child may be of this type; its old menubar is detached before deletion.
+        SyncToSelection();
+        delete old;
+    }
+
+    wxMenuBar*
+    Find(const std::string& key) const
+    {
+        auto it = m_bars.find(key);
+        return it == m_bars.end() ? nullptr : it->second;
+    }
+
+    void
+    Assign(wxAuiMDIChildFrame* child, const std::string& key)
+    {
+        if (m_children.find(child) == m_children.end())
+            child->Bind(wxEVT_DESTROY, &SharedMenuBars::OnChildDestroy);
+        m_children[child] = key;
+        if (m_frame->GetActiveChild() == child)
+            Sync(child);
+    }
+
+    // Shows the menubar of `child`'s type, or the frame's own menubar for a child without one
+    // and when no child is active.
+    void
+    Sync(wxWindow* child)
+    {
+        wxMenuBar* bar = nullptr;
+        auto it = m_children.find(wxDynamicCast(child, wxAuiMDIChildFrame));
+        if (child && it != m_children.end())
+            bar = Find(it->second);
+        if (bar)
+            Show(bar);
+        else
+            ShowBase();
+    }
+
+    void
+    SyncToSelection()
+    {
+        wxAuiMDIClientWindow* client = m_frame->GetClientWindow();
+        const int selection = client ? client->GetSelection() : wxNOT_FOUND;
+        Sync(selection == wxNOT_FOUND ? nullptr : client->GetPage(selection));
+    }
+
+    void
+    Forget(wxAuiMDIChildFrame* child)
+    {
+        m_children.erase(child);
+    }
+
+private:
+    void
+    Show(wxMenuBar* bar)
+    {
+        if (!m_base_saved) {
+            m_base = m_frame->GetMenuBar();
+            m_base_saved = true;
+        }
+        // A detach and an attach of prebuilt native menus; nothing is rebuilt.
+        if (m_frame->GetMenuBar() != bar)
+            m_frame->SetMenuBar(bar);
+        m_shown = bar;
+    }
+
+    void
+    ShowBase()
+    {
+        if (!m_base_saved)
+            return;
+        if (m_frame->GetMenuBar() != m_base)
+            m_frame->SetMenuBar(m_base);
+        m_base = nullptr;
+        m_base_saved = false;
+        m_shown = nullptr;
+    }
+
+    static void
+    OnChildDestroy(wxWindowDestroyEvent& event);
+
+    wxAuiMDIParentFrame* m_frame;
+    std::unordered_map<std::string, wxMenuBar*> m_bars;
+    std::unordered_map<wxAuiMDIChildFrame*, std::string> m_children;
+    wxMenuBar* m_base = nullptr; // the frame's own menubar while a shared one is shown
+    bool m_base_saved = false;
+    wxMenuBar* m_shown = nullptr;
+};
+
+std::unordered_map<wxAuiMDIParentFrame*, std::unique_ptr<SharedMenuBars>>&
+shared_menubars()
+{
+    static std::unordered_map<wxAuiMDIParentFrame*, std::unique_ptr<SharedMenuBars>> map;
+    return map;
+}
+
+SharedMenuBars*
+find_shared_menubars(wxAuiMDIParentFrame* frame)
+{
+    auto& map = shared_menubars();
+    auto it = map.find(frame);
+    return it == map.end() ? nullptr : it->second.get();
+}
+
+// Plain function handlers look the state up, so it can go away without unbinding.
+void
+on_menubar_frame_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    if (auto* frame = wxDynamicCast(event.GetEventObject(), wxAuiMDIParentFrame))
+        shared_menubars().erase(frame);
+}
+
+// The client window's own handler activates the child after this one ran, so the menubar is
+// already in place when the child's activation code runs.
+void
+on_menubar_page_changed(wxAuiNotebookEvent& event)
+{
+    event.Skip();
+    wxAuiMDIClientWindow* client = wxDynamicCast(event.GetEventObject(), wxAuiMDIClientWindow);
+    if (!client)
+        return;
+    auto* frame = wxDynamicCast(client->GetParent(), wxAuiMDIParentFrame);
+    if (SharedMenuBars* bars = frame ? find_shared_menubars(frame) : nullptr) {
+        const int page = event.GetSelection();
+        bars->Sync(page == wxNOT_FOUND ? nullptr : client->GetPage(page));
+    }
+}
+
+void
+SharedMenuBars::OnChildDestroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    auto* child = wxDynamicCast(event.GetEventObject(), wxAuiMDIChildFrame);
+    wxAuiMDIParentFrame* frame = child ? child->GetMDIParentFrame() : nullptr;
+    SharedMenuBars* bars = frame ? find_shared_menubars(frame) : nullptr;
+    if (!bars)
+        return;
+    bars->Forget(child);
+    // Closing the last child selects no page, so look again once the page is gone.
+    frame->CallAfter([frame]() {
+        if (SharedMenuBars* later = find_shared_menubars(frame))
+            later->SyncToSelection();
+    });
+}
+
+SharedMenuBars*
+ensure_shared_menubars(wxAuiMDIParentFrame* frame)
+{
+    if (SharedMenuBars* bars = find_shared_menubars(frame))
+        return bars;
+    wxAuiMDIClientWindow* client = frame->GetClientWindow();
+    if (!client)
+        return nullptr;
+    frame->Bind(wxEVT_DESTROY, on_menubar_frame_destroy);
+    client->Bind(wxEVT_AUINOTEBOOK_PAGE_CHANGED, on_menubar_page_changed);
+    return shared_menubars()
+        .emplace(frame, std::make_unique<SharedMenuBars>(frame))
+        .first->second.get();
+}
+
+} // namespace
+
 extern "C" {
 
 wxd_AuiMDIParentFrame_t*
@@ -27,5 +221,42 @@ wxd_AuiMDIParentFrame_Create(wxd_Window_t* parent, int id, const char* title, wx
     return (wxd_AuiMDIParentFrame_t*)frame;
 }
 
+WXD_EXPORTED bool
+wxd_AuiMDIParentFrame_RegisterMenuBar(wxd_AuiMDIParentFrame_t* self, const char* key,
+                                      wxd_MenuBar_t* menubar)
+{
+    wxAuiMDIParentFrame* frame = reinterpret_cast<wxAuiMDIParentFrame*>(self);
+    wxMenuBar* bar = reinterpret_cast<wxMenuBar*>(menubar);
+    if (!frame || !key || !bar)
+        return false;
+    SharedMenuBars* bars = ensure_shared_menubars(frame);
+    if (!bars)
+        return false;
+    bars->Register(key, bar);
+    return true;
+}
+
+WXD_EXPORTED wxd_MenuBar_t*
+wxd_AuiMDIParentFrame_GetSharedMenuBar(wxd_AuiMDIParentFrame_t* self, const char* key)
+{
+    wxAuiMDIParentFrame* frame = reinterpret_cast<wxAuiMDIParentFrame*>(self);
+    SharedMenuBars* bars = frame && key ? find_shared_menubars(frame) : nullptr;
+    return bars ? reinterpret_cast<wxd_MenuBar_t*>(bars->Find(key)) : nullptr;
+}
+
+WXD_EXPORTED bool
+wxd_AuiMDIChildFrame_UseSharedMenuBar(wxd_AuiMDIChildFrame_t* self, const char* key)
+{
+    wxAuiMDIChildFrame* child = reinterpret_cast<wxAuiMDIChildFrame*>(self);
+    wxAuiMDIParentFrame* frame = child ? child->GetMDIParentFrame() : nullptr;
+    if (!frame || !key)
+        return false;
+    SharedMenuBars* bars = ensure_shared_menubars(frame);
+    if (!bars)
+        return false;
+    bars->Assign(child, key);
+    return true;
+}
+
 // Implementations for other wxAuiMDIParentFrame specific functions will go here.
 }
\ No newline at end of file
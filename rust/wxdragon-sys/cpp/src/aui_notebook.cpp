@@ -4,10 +4,241 @@
 #include <wx/aui/auibook.h> // For wxAuiNotebook
 #include "wxd_utils.h"
 
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 // Ensure this is part of wx/aui/auibook.h or wx/aui/aui.h
 // If wxAuiNotebook is in wx/aui/aui.h, this might need adjustment,
 // but typically dedicated controls are in their own headers like auibook.h
 
+namespace {
+
+// Narrowest tab we expect; bounds how many tabs of a strip can be visible at once.
+constexpr int kMinVisibleTabWidth = 24;
+
+class VirtualTabState;
+
+std::unordered_map<wxAuiNotebook*, std::unique_ptr<VirtualTabState>>&
+virtual_tab_notebooks()
+{
+    static std::unordered_map<wxAuiNotebook*, std::unique_ptr<VirtualTabState>> map;
+    return map;
+}
+
+VirtualTabState*
+find_virtual_tabs(wxAuiNotebook* notebook)
+{
+    auto& map = virtual_tab_notebooks();
+    auto it = map.find(notebook);
+    return it == map.end() ? nullptr : it->second.get();
+}
+
+// Per-notebook virtual tab bookkeeping. Labels are resolved from the paint handler of each tab
+// strip, only for the tabs between the strip's scroll offset and its right edge.
+class VirtualTabState {
+public:
+    explicit VirtualTabState(wxAuiNotebook* notebook) : m_notebook(notebook) {}
+
+    ~VirtualTabState()
+    {
+        if (m_free_userdata && m_userdata)
+            m_free_userdata(m_userdata);
+    }
+
+    void Configure(void* userdata, wxd_auinotebook_tab_label_callback callback,
+                   wxd_auinotebook_free_userdata_callback free_userdata)
+    {
+        if (m_free_userdata && m_userdata)
+            m_free_userdata(m_userdata);
+        m_userdata = userdata;
+        m_callback = callback;
+        m_free_userdata = free_userdata;
+        for (auto& entry : m_pages)
+            entry.second.resolved = false;
+        RefreshTabStrips();
+    }
+
+    bool Add(int64_t key, wxWindow* page)
+    {
+        if (!m_keys.emplace(key, page).second)
+            return false;
+        m_pages[page] = Entry{ key, false, wxString(), wxBitmapBundle() };
+        page->Bind(wxEVT_DESTROY, &VirtualTabState::OnPageDestroy);
+        return true;
+    }
+
+    bool Contains(int64_t key) const { return m_keys.count(key) != 0; }
+
+    wxWindow* Page(int64_t key) const
+    {
+        auto it = m_keys.find(key);
+        return it == m_keys.end() ? nullptr : it->second;
+    }
+
+    void Invalidate(int64_t key)
+    {
+        auto it = m_pages.find(Page(key));
+        if (it == m_pages.end())
+            return;
+        it->second.resolved = false;
+        RefreshTabStrips();
+    }
+
+    // Tab strips come and go as the user splits the notebook; hook the new ones.
+    void HookTabStrips()
+    {
+        for (wxWindow* child : m_notebook->GetChildren()) {
+            wxAuiTabCtrl* strip = dynamic_cast<wxAuiTabCtrl*>(child);
+            if (!strip || !m_strips.insert(strip).second)
+                continue;
+            strip->Bind(wxEVT_PAINT, &VirtualTabState::OnStripPaint);
+            strip->Bind(wxEVT_DESTROY, &VirtualTabState::OnStripDestroy);
+        }
+    }
+
+    void RefreshTabStrips()
+    {
+        for (wxAuiTabCtrl* strip : m_strips)
+            strip->Refresh(false);
+    }
+
+private:
+    struct Entry {
+        int64_t key;
+        bool resolved;
+        wxString caption;
+        wxBitmapBundle bitmap;
+    };
+
+    // Plain function handlers look the state up, so it can go away without unbinding.
+    static void OnStripPaint(wxPaintEvent& event)
+    {
+        event.Skip();
+        wxAuiTabCtrl* strip = dynamic_cast<wxAuiTabCtrl*>(event.GetEventObject());
+        wxAuiNotebook* notebook = strip ? dynamic_cast<wxAuiNotebook*>(strip->GetParent()) : nullptr;
+        VirtualTabState* state = notebook ? find_virtual_tabs(notebook) : nullptr;
+        if (state)
+            state->ResolveVisible(strip);
+    }
+
+    static void OnStripDestroy(wxWindowDestroyEvent& event)
+    {
+        event.Skip();
+        wxAuiTabCtrl* strip = dynamic_cast<wxAuiTabCtrl*>(event.GetEventObject());
+        wxAuiNotebook* notebook = strip ? dynamic_cast<wxAuiNotebook*>(strip->GetParent()) : nullptr;
+        if (VirtualTabState* state = notebook ? find_virtual_tabs(notebook) : nullptr)
+            state->m_strips.erase(strip);
+    }
+
+    static void OnPageDestroy(wxWindowDestroyEvent& event)
+    {
+        event.Skip();
+        wxWindow* page = wxDynamicCast(event.GetEventObject(), wxWindow);
+        wxAuiNotebook* notebook = page ? dynamic_cast<wxAuiNotebook*>(page->GetParent()) : nullptr;
+        VirtualTabState* state = notebook ? find_virtual_tabs(notebook) : nullptr;
+        if (!state)
+            return;
+        auto it = state->m_pages.find(page);
+        if (it == state->m_pages.end())
+            return;
+        state->m_keys.erase(it->second.key);
+        state->m_pages.erase(it);
+    }
+
+    void ResolveVisible(wxAuiTabCtrl* strip)
+    {
+        if (!m_callback)
+            return;
+        const size_t count = strip->GetPageCount();
+        const size_t first = std::min(strip->GetTabOffset(), count);
+        const size_t span =
+            static_cast<size_t>(std::max(strip->GetClientSize().x, 0) / kMinVisibleTabWidth) + 1;
+        const size_t last = std::min(count, first + span);
+
+        bool changed = false;
+        for (size_t i = first; i < last; ++i) {
+            wxAuiNotebookPage& tab = strip->GetPage(i);
+            auto it = m_pages.find(tab.window);
+            if (it == m_pages.end() || it->second.resolved)
+                continue;
+            it->second.resolved = true;
+
+            wxd_AuiVirtualTabLabel label = { nullptr, 0, nullptr };
+            if (!m_callback(m_userdata, it->second.key, &label))
+                continue;
+            Entry& entry = it->second;
+            entry.caption = label.text ? wxString::FromUTF8(label.text, label.text_len) : wxString();
+            entry.bitmap = label.bitmap
+                               ? wxBitmapBundle(*reinterpret_cast<const wxBitmap*>(label.bitmap))
+                               : wxBitmapBundle();
+            // The strip's own copy is what this paint draws; the notebook's copy is synced later.
+            tab.caption = entry.caption;
+            tab.bitmap = entry.bitmap;
+            m_pending.push_back(tab.window);
+            changed = true;
+        }
+        if (changed && !m_sync_queued) {
+            m_sync_queued = true;
+            wxAuiNotebook* notebook = m_notebook;
+            notebook->CallAfter([notebook]() {
+                if (VirtualTabState* state = find_virtual_tabs(notebook))
+                    state->SyncPending();
+            });
+        }
+    }
+
+    // Copies freshly resolved labels into the notebook so they survive tab strip rebuilds.
+    void SyncPending()
+    {
+        m_sync_queued = false;
+        std::vector<wxWindow*> pending;
+        pending.swap(m_pending);
+        for (wxWindow* page : pending) {
+            auto it = m_pages.find(page);
+            if (it == m_pages.end())
+                continue;
+            const int index = m_notebook->GetPageIndex(page);
+            if (index == wxNOT_FOUND)
+                continue;
+            m_notebook->SetPageText(index, it->second.caption);
+            m_notebook->SetPageBitmap(index, it->second.bitmap);
+        }
+    }
+
+    wxAuiNotebook* m_notebook;
+    void* m_userdata = nullptr;
+    wxd_auinotebook_tab_label_callback m_callback = nullptr;
+    wxd_auinotebook_free_userdata_callback m_free_userdata = nullptr;
+    std::unordered_map<int64_t, wxWindow*> m_keys;
+    std::unordered_map<wxWindow*, Entry> m_pages;
+    std::unordered_set<wxAuiTabCtrl*> m_strips;
+    std::vector<wxWindow*> m_pending;
+    bool m_sync_queued = false;
+};
+
+void
+on_virtual_tab_notebook_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    if (wxAuiNotebook* notebook = wxDynamicCast(event.GetEventObject(), wxAuiNotebook))
+        virtual_tab_notebooks().erase(notebook);
+}
+
+// Splitting the notebook by dragging a tab creates new tab strips.
+void
+on_virtual_tab_notebook_layout(wxAuiNotebookEvent& event)
+{
+    event.Skip();
+    wxAuiNotebook* notebook = wxDynamicCast(event.GetEventObject(), wxAuiNotebook);
+    if (VirtualTabState* state = notebook ? find_virtual_tabs(notebook) : nullptr)
+        state->HookTabStrips();
+}
+
+} // namespace
+
 extern "C" {
 
 WXD_EXPORTED wxd_AuiNotebook_t*
@@ -160,4 +391,98 @@ wxd_AuiNotebook_SetPageText(wxd_AuiNotebook_t* self, size_t page_idx, const char
     return notebook->SetPageText(page_idx, wxText);
 }
 
-} // extern "C"
\ No newline at end of file
+// --- Virtual tabs ---
+
+WXD_EXPORTED bool
+wxd_AuiNotebook_EnableVirtualTabs(wxd_AuiNotebook_t* self, void* userdata,
+                                  wxd_auinotebook_tab_label_callback callback,
+                                  wxd_auinotebook_free_userdata_callback free_userdata)
+{
+    wxAuiNotebook* notebook = (wxAuiNotebook*)self;
+    if (!notebook || !callback) return false;
+    auto& map = virtual_tab_notebooks();
+    auto it = map.find(notebook);
+    if (it == map.end()) {
+        notebook->Bind(wxEVT_DESTROY, on_virtual_tab_notebook_destroy);
+        notebook->Bind(wxEVT_AUINOTEBOOK_END_DRAG, on_virtual_tab_notebook_layout);
+        notebook->Bind(wxEVT_AUINOTEBOOK_PAGE_CHANGED, on_virtual_tab_notebook_layout);
+        it = map.emplace(notebook, std::make_unique<VirtualTabState>(notebook)).first;
+    }
+    it->second->HookTabStrips();
+    it->second->Configure(userdata, callback, free_userdata);
+    return true;
+}
+
+WXD_EXPORTED void
+wxd_AuiNotebook_DisableVirtualTabs(wxd_AuiNotebook_t* self)
+{
+    wxAuiNotebook* notebook = (wxAuiNotebook*)self;
+    if (!notebook) return;
+    if (!virtual_tab_notebooks().erase(notebook)) return;
+    notebook->Unbind(wxEVT_DESTROY, on_virtual_tab_notebook_destroy);
+    notebook->Unbind(wxEVT_AUINOTEBOOK_END_DRAG, on_virtual_tab_notebook_layout);
+    notebook->Unbind(wxEVT_AUINOTEBOOK_PAGE_CHANGED, on_virtual_tab_notebook_layout);
+}
+
+WXD_EXPORTED size_t
+wxd_AuiNotebook_AppendVirtualTabs(wxd_AuiNotebook_t* self, const int64_t* keys, size_t count)
+{
+    wxAuiNotebook* notebook = (wxAuiNotebook*)self;
+    VirtualTabState* state = notebook ? find_virtual_tabs(notebook) : nullptr;
+    if (!state || !keys || count == 0) return 0;
+
+    size_t added = 0;
+    notebook->Freeze();
+    for (size_t i = 0; i < count; ++i) {
+        if (state->Contains(keys[i]))
+            continue;
+        wxd_Window_t* page = wxd_BookCtrl_InsertLazyPage((wxd_Window_t*)notebook,
+                                                         notebook->GetPageCount(), "", false, -1,
+                                                         keys[i]);
+        if (!page)
+            break; // Lazy pages are not enabled on this notebook.
+        state->Add(keys[i], (wxWindow*)page);
+        ++added;
+    }
+    notebook->Thaw();
+    state->HookTabStrips();
+    state->RefreshTabStrips();
+    return added;
+}
+
+WXD_EXPORTED wxd_Window_t*
+wxd_AuiNotebook_GetVirtualTabPage(wxd_AuiNotebook_t* self, int64_t key)
+{
+    wxAuiNotebook* notebook = (wxAuiNotebook*)self;
+    VirtualTabState* state = notebook ? find_virtual_tabs(notebook) : nullptr;
+    return state ? (wxd_Window_t*)state->Page(key) : nullptr;
+}
+
+WXD_EXPORTED int
+wxd_AuiNotebook_FindVirtualTab(wxd_AuiNotebook_t* self, int64_t key)
+{
+    wxAuiNotebook* notebook = (wxAuiNotebook*)self;
+    VirtualTabState* state = notebook ? find_virtual_tabs(notebook) : nullptr;
+    wxWindow* page = state ? state->Page(key) : nullptr;
+    return page ? notebook->GetPageIndex(page) : -1;
+}
+
+WXD_EXPORTED bool
+wxd_AuiNotebook_SelectVirtualTab(wxd_AuiNotebook_t* self, int64_t key)
+{
+    const int index = wxd_AuiNotebook_FindVirtualTab(self, key);
+    if (index < 0) return false;
+    // SetSelection sends the page-changing event that builds lazy page content.
+    ((wxAuiNotebook*)self)->SetSelection((size_t)index);
+    return true;
+}
+
+WXD_EXPORTED void
+wxd_AuiNotebook_InvalidateVirtualTab(wxd_AuiNotebook_t* self, int64_t key)
+{
+    wxAuiNotebook* notebook = (wxAuiNotebook*)self;
+    if (VirtualTabState* state = notebook ? find_virtual_tabs(notebook) : nullptr)
+        state->Invalidate(key);
+}
+
+} // extern "C"
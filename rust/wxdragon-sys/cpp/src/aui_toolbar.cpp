@@ -7,9 +7,99 @@
 #include <wx/string.h>           // For wxString
 #include <wx/gdicmn.h>           // For wxPoint, wxSize, wxID_ANY, etc.
 #include "wxd_utils.h"           // For WXD_STR_TO_WX_STRING_UTF8_NULL_OK, etc.
+#include "wxd_toolbar_bulk.h"
+#include <memory>
+#include <unordered_map>
 
 // --- wxAuiToolBar ---
 
+namespace {
+
+// wxAuiToolBar has no insert; its item array is reached through a pointer to the protected
+// member, named via a derived class.
+struct AuiToolBarItems : wxAuiToolBar {
+    static wxAuiToolBarItemArray&
+    Of(wxAuiToolBar* toolbar)
+    {
+        return toolbar->*(&AuiToolBarItems::m_items);
+    }
+};
+
+struct AuiToolBarOps {
+    using Item = wxAuiToolBarItem;
+
+    wxAuiToolBar* toolbar;
+
+    size_t
+    Count() const
+    {
+        return toolbar->GetToolCount();
+    }
+    Item
+    At(size_t pos) const
+    {
+        return *toolbar->FindToolByIndex(static_cast<int>(pos));
+    }
+    bool
+    Same(const Item& a, const Item& b) const
+    {
+        return a.GetId() == b.GetId() && a.GetKind() == b.GetKind() &&
+               a.GetWindow() == b.GetWindow();
+    }
+    int
+    Id(const Item& item) const
+    {
+        return item.GetId();
+    }
+    Item
+    Remove(size_t pos)
+    {
+        wxAuiToolBarItemArray& items = AuiToolBarItems::Of(toolbar);
+        Item item = items[pos];
+        if (wxWindow* window = item.GetWindow())
+            window->Hide();
+        items.RemoveAt(pos);
+        return item;
+    }
+    void
+    Insert(size_t pos, const Item& item)
+    {
+        AuiToolBarItems::Of(toolbar).Insert(item, pos);
+        if (wxWindow* window = item.GetWindow())
+            window->Show();
+    }
+    void
+    Realize()
+    {
+        toolbar->Realize();
+        toolbar->Refresh(false);
+    }
+    // Controls of hidden items are still children of the toolbar and go with it.
+    void
+    Discard(Item&)
+    {
+    }
+};
+
+using HiddenAuiTools = wxd_toolbar_bulk::HiddenTools<AuiToolBarOps>;
+
+std::unordered_map<wxAuiToolBar*, std::unique_ptr<HiddenAuiTools>>&
+hidden_aui_tools()
+{
+    static std::unordered_map<wxAuiToolBar*, std::unique_ptr<HiddenAuiTools>> map;
+    return map;
+}
+
+void
+on_aui_toolbar_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    if (wxAuiToolBar* toolbar = wxDynamicCast(event.GetEventObject(), wxAuiToolBar))
+        hidden_aui_tools().erase(toolbar);
+}
+
+} // namespace
+
 extern "C" {
 
 WXD_EXPORTED wxd_AuiToolBar_t*
@@ -238,4 +328,62 @@ wxd_AuiToolBar_DeleteTool(wxd_AuiToolBar_t* self, int tool_id)
     return toolbar->DeleteTool(tool_id);
 }
 
+WXD_EXPORTED size_t
+wxd_AuiToolBar_AddTools(wxd_AuiToolBar_t* self, const wxd_ToolDesc* tools, size_t count)
+{
+    wxAuiToolBar* toolbar = (wxAuiToolBar*)self;
+    if (!toolbar || !tools)
+        return 0;
+    wxd_toolbar_bulk::BundleCache bundles;
+    size_t added = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const wxd_ToolDesc& desc = tools[i];
+        wxAuiToolBarItem* item = nullptr;
+        if (desc.kind == WXD_ITEM_SEPARATOR) {
+            item = toolbar->AddSeparator();
+        }
+        else {
+            item = toolbar->AddTool(desc.id, wxd_toolbar_bulk::utf8(desc.label),
+                                    bundles.Get(desc.bundle, desc.bitmap),
+                                    bundles.Get(desc.bundle_disabled, desc.bitmap_disabled),
+                                    wxd_toolbar_bulk::item_kind(desc.kind),
+                                    wxd_toolbar_bulk::utf8(desc.short_help),
+                                    wxd_toolbar_bulk::utf8(desc.long_help), nullptr);
+        }
+        if (item)
+            ++added;
+    }
+    toolbar->Realize();
+    return added;
+}
+
+WXD_EXPORTED size_t
+wxd_AuiToolBar_SetToolsVisible(wxd_AuiToolBar_t* self, const int* ids, const bool* visible,
+                               size_t count)
+{
+    wxAuiToolBar* toolbar = (wxAuiToolBar*)self;
+    if (!toolbar || !ids || !visible)
+        return 0;
+    auto& map = hidden_aui_tools();
+    auto it = map.find(toolbar);
+    if (it == map.end()) {
+        toolbar->Bind(wxEVT_DESTROY, on_aui_toolbar_destroy);
+        it = map.emplace(toolbar, std::make_unique<HiddenAuiTools>(AuiToolBarOps{ toolbar }))
+                 .first;
+    }
+    return it->second->Apply(ids, visible, count);
+}
+
+WXD_EXPORTED bool
+wxd_AuiToolBar_IsToolVisible(wxd_AuiToolBar_t* self, int tool_id)
+{
+    wxAuiToolBar* toolbar = (wxAuiToolBar*)self;
+    if (!toolbar)
+        return false;
+    auto it = hidden_aui_tools().find(toolbar);
+    if (it != hidden_aui_tools().end() && it->second->IsHidden(tool_id))
+        return false;
+    return toolbar->FindTool(tool_id) != nullptr;
+}
+
 } // extern "C"
\ No newline at end of file
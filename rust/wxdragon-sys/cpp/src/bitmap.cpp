@@ -1,10 +1,55 @@
 #include <wx/wxprec.h>
 #include <wx/wx.h>
 #include "../include/wxdragon.h"
+#include "wxd_objstats.h"
+#include "wxd_startup.h"
 #include <wx/image.h>  // For wxImage
 #include <wx/bitmap.h> // For wxBitmap
+#include <wx/rawbmp.h> // For wxAlphaPixelData, wxNativePixelData
+#include <wx/mstream.h> // For wxMemoryInputStream
 #include <cstdlib>     // For malloc, free
 #include <cstring>     // For memcpy
+#include "wxd_pixels.h"
+#include "wxd_resize.h"
+#include "wxd_atlas.h"
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace wxd_atlas {
+
+int
+tile_count(int sheet_w, int sheet_h, int tile_w, int tile_h)
+{
+    if (sheet_w <= 0 || sheet_h <= 0 || tile_w <= 0 || tile_h <= 0)
+        return 0;
+    return (sheet_w / tile_w) * (sheet_h / tile_h);
+}
+
+wxRect
+tile_rect(int sheet_w, int tile_w, int tile_h, int index)
+{
+    const int columns = sheet_w / tile_w;
+    return wxRect((index % columns) * tile_w, (index / columns) * tile_h, tile_w, tile_h);
+}
+
+wxBitmap
+sheet_bitmap(const unsigned char* rgba, int w, int h)
+{
+    const size_t num_pixels = static_cast<size_t>(w) * static_cast<size_t>(h);
+    unsigned char* rgb_data = static_cast<unsigned char*>(malloc(num_pixels * 3));
+    unsigned char* alpha_data = static_cast<unsigned char*>(malloc(num_pixels));
+    if (!rgb_data || !alpha_data) {
+        free(rgb_data);
+        free(alpha_data);
+        return wxBitmap();
+    }
+    wxd_pixels::split_rgba(rgba, rgb_data, alpha_data, num_pixels);
+    wxImage image(w, h, rgb_data, alpha_data);
+    return image.IsOk() ? wxBitmap(image, 32) : wxBitmap();
+}
+
+} // namespace wxd_atlas
 
 // Implementation for wxd_Bitmap_CreateFromRGBA
 WXD_EXPORTED wxd_Bitmap_t*
@@ -34,12 +79,7 @@ wxd_Bitmap_CreateFromRGBA(const unsigned char* data, int width, int height)
     }
 
     // Copy data from input RGBA buffer to separate RGB and Alpha buffers
-    for (size_t i = 0; i < num_pixels; ++i) {
-        rgb_data[i * 3 + 0] = data[i * 4 + 0]; // R
-        rgb_data[i * 3 + 1] = data[i * 4 + 1]; // G
-        rgb_data[i * 3 + 2] = data[i * 4 + 2]; // B
-        alpha_data[i] = data[i * 4 + 3];       // A
-    }
+    wxd_pixels::split_rgba(data, rgb_data, alpha_data, num_pixels);
 
     // Create wxImage. It takes ownership of rgb_data AND alpha_data.
     wxImage image(width, height, rgb_data, alpha_data); // Pass both buffers
@@ -63,7 +103,7 @@ wxd_Bitmap_CreateFromRGBA(const unsigned char* data, int width, int height)
         return nullptr;
     }
 
-    return reinterpret_cast<wxd_Bitmap_t*>(bitmap);
+    return reinterpret_cast<wxd_Bitmap_t*>(wxd_objstats::track(bitmap));
 }
 
 // Implementation for wxd_Bitmap_Destroy
@@ -76,6 +116,7 @@ wxd_Bitmap_Destroy(wxd_Bitmap_t* bitmap)
     // Never delete the global wxNullBitmap.
     if (bmp == &wxNullBitmap)
         return;
+    wxd_objstats::untrack(bmp);
     delete bmp;
 }
 
@@ -125,7 +166,7 @@ wxd_Bitmap_Clone(const wxd_Bitmap_t* bitmap)
         delete cloned_bmp; // Safe to call delete on nullptr
         return nullptr;
     }
-    return reinterpret_cast<wxd_Bitmap_t*>(cloned_bmp);
+    return reinterpret_cast<wxd_Bitmap_t*>(wxd_objstats::track(cloned_bmp));
 }
 
 // Extract RGBA data from bitmap
@@ -170,20 +211,8 @@ wxd_Bitmap_GetRGBAData(const wxd_Bitmap_t* bitmap, size_t* width, size_t* height
     unsigned char* rgb_data = image.GetData();
     unsigned char* alpha_data = image.GetAlpha();
 
-    // Combine RGB and alpha into RGBA format
-    for (size_t i = 0; i < num_pixels; ++i) {
-        rgba_data[i * 4 + 0] = rgb_data[i * 3 + 0]; // R
-        rgba_data[i * 4 + 1] = rgb_data[i * 3 + 1]; // G
-        rgba_data[i * 4 + 2] = rgb_data[i * 3 + 2]; // B
-
-        // Set alpha channel (255 if no alpha data available)
-        if (alpha_data) {
-            rgba_data[i * 4 + 3] = alpha_data[i]; // A
-        }
-        else {
-            rgba_data[i * 4 + 3] = 255; // Fully opaque
-        }
-    }
+    // Combine RGB and alpha into RGBA format (opaque if the image has no alpha)
+    wxd_pixels::merge_rgba(rgb_data, alpha_data, rgba_data, num_pixels);
 
     return rgba_data;
 }
@@ -197,6 +226,370 @@ wxd_Bitmap_FreeRGBAData(unsigned char* data)
     }
 }
 
+// --- In-place pixel access ---
+
+struct wxd_BitmapPixels_t {
+    std::unique_ptr<wxAlphaPixelData> alpha;
+    std::unique_ptr<wxNativePixelData> native;
+};
+
+namespace {
+
+// MSW DIBs and CoreGraphics images store colour multiplied by alpha; GTK pixbufs do not.
+#if defined(__WXMSW__) || defined(__WXOSX__)
+constexpr bool kPremultipliedAlpha = true;
+#else
+constexpr bool kPremultipliedAlpha = false;
+#endif
+
+template <typename Data>
+void
+fill_layout(Data& data, wxd_BitmapPixelLayout* layout)
+{
+    using Format = typename Data::PixelFormat;
+    typename Data::Iterator it(data);
+    layout->pixels = reinterpret_cast<uint8_t*>(it.m_ptr);
+    layout->width = data.GetWidth();
+    layout->height = data.GetHeight();
+    layout->stride = data.GetRowStride();
+    layout->bytes_per_pixel = Format::SizePixel;
+    layout->red = Format::RED;
+    layout->green = Format::GREEN;
+    layout->blue = Format::BLUE;
+    layout->alpha = Format::ALPHA;
+    layout->premultiplied = Format::ALPHA >= 0 && kPremultipliedAlpha;
+}
+
+// Writes straight RGBA `rows` into locked pixels described by `layout`.
+void
+write_rgba_rows(const wxd_BitmapPixelLayout& layout, const unsigned char* rows, size_t stride)
+{
+    const size_t width = static_cast<size_t>(layout.width);
+    if (layout.bytes_per_pixel == 4) {
+        // Without alpha the fourth byte is padding; it receives the (ignored) source alpha.
+        const int order[4] = { layout.red, layout.green, layout.blue,
+                               layout.alpha >= 0 ? layout.alpha
+                                                 : 6 - layout.red - layout.green - layout.blue };
+        for (int y = 0; y < layout.height; ++y) {
+            wxd_pixels::convert_rgba(rows + y * stride,
+                                     layout.pixels + static_cast<ptrdiff_t>(y) * layout.stride,
+                                     width, order, layout.premultiplied);
+        }
+        return;
+    }
+    for (int y = 0; y < layout.height; ++y) {
+        const unsigned char* src = rows + y * stride;
+        uint8_t* dst = layout.pixels + static_cast<ptrdiff_t>(y) * layout.stride;
+        for (size_t x = 0; x < width; ++x, src += 4, dst += layout.bytes_per_pixel) {
+            dst[layout.red] = src[0];
+            dst[layout.green] = src[1];
+            dst[layout.blue] = src[2];
+        }
+    }
+}
+
+} // namespace
+
+WXD_EXPORTED wxd_BitmapPixels_t*
+wxd_Bitmap_LockPixels(wxd_Bitmap_t* bitmap, bool withAlpha, wxd_BitmapPixelLayout* layout)
+{
+    wxBitmap* bmp = reinterpret_cast<wxBitmap*>(bitmap);
+    if (!bmp || !bmp->IsOk() || !layout)
+        return nullptr;
+    auto pixels = std::make_unique<wxd_BitmapPixels_t>();
+    if (withAlpha) {
+        pixels->alpha = std::make_unique<wxAlphaPixelData>(*bmp);
+        if (!*pixels->alpha)
+            return nullptr;
+        fill_layout(*pixels->alpha, layout);
+    }
+    else {
+        pixels->native = std::make_unique<wxNativePixelData>(*bmp);
+        if (!*pixels->native)
+            return nullptr;
+        fill_layout(*pixels->native, layout);
+    }
+    return pixels.release();
+}
+
+WXD_EXPORTED void
+wxd_Bitmap_UnlockPixels(wxd_BitmapPixels_t* pixels)
+{
+    // Destroying the pixel data releases the raw access and publishes the changes.
+    delete pixels;
+}
+
+WXD_EXPORTED bool
+wxd_Bitmap_UpdateFromRGBA(wxd_Bitmap_t* bitmap, const unsigned char* data, size_t stride)
+{
+    wxBitmap* bmp = reinterpret_cast<wxBitmap*>(bitmap);
+    if (!bmp || !bmp->IsOk() || !data)
+        return false;
+    const size_t row_bytes = static_cast<size_t>(bmp->GetWidth()) * 4;
+    if (stride == 0)
+        stride = row_bytes;
+    if (stride < row_bytes)
+        return false;
+
+    wxd_BitmapPixelLayout layout{};
+    std::unique_ptr<wxd_BitmapPixels_t> pixels(
+        wxd_Bitmap_LockPixels(bitmap, bmp->HasAlpha(), &layout));
+    if (!pixels)
+        return false;
+    write_rgba_rows(layout, data, stride);
+    return true;
+}
+
+// --- Native-format creation ---
+
+namespace {
+
+struct SourceFormat {
+    int red, green, blue, alpha; // byte offsets within the source pixel
+    bool premultiplied;
+};
+
+bool
+source_format(wxd_PixelFormat format, SourceFormat* out)
+{
+    const bool premultiplied = format >= WXD_PIXEL_FORMAT_RGBA_PREMULTIPLIED;
+    switch (premultiplied ? format - WXD_PIXEL_FORMAT_RGBA_PREMULTIPLIED : format) {
+    case WXD_PIXEL_FORMAT_RGBA:
+        *out = { 0, 1, 2, 3, premultiplied };
+        return true;
+    case WXD_PIXEL_FORMAT_BGRA:
+        *out = { 2, 1, 0, 3, premultiplied };
+        return true;
+    case WXD_PIXEL_FORMAT_ARGB:
+        *out = { 1, 2, 3, 0, premultiplied };
+        return true;
+    default:
+        return false;
+    }
+}
+
+uint8_t
+scale_channel(uint8_t c, uint8_t a, bool premultiply)
+{
+    if (premultiply)
+        return static_cast<uint8_t>((c * a + 127) / 255);
+    return a == 0 ? 0 : static_cast<uint8_t>(std::min(255, (c * 255 + a / 2) / a));
+}
+
+// Copies `width` pixels of `src` into the 4-byte pixels of `layout`, reordering channels and
+// adding or removing premultiplication as needed.
+void
+write_native_row(const uint8_t* src, uint8_t* dst, size_t width, const SourceFormat& from,
+                 const wxd_BitmapPixelLayout& layout)
+{
+    const bool reorder = from.red != layout.red || from.green != layout.green ||
+                         from.blue != layout.blue || from.alpha != layout.alpha;
+    if (!reorder && from.premultiplied == layout.premultiplied) {
+        std::memcpy(dst, src, width * 4);
+        return;
+    }
+    if (from.alpha == 3 && !from.premultiplied) {
+        // Straight source with trailing alpha: convert_rgba's swizzle and premultiply apply
+        // once its first three bytes are mapped to their destination channels.
+        int order[4];
+        order[from.red] = layout.red;
+        order[from.green] = layout.green;
+        order[from.blue] = layout.blue;
+        order[3] = layout.alpha;
+        wxd_pixels::convert_rgba(src, dst, width, order, layout.premultiplied);
+        return;
+    }
+    const bool rescale = from.premultiplied != layout.premultiplied;
+    for (size_t x = 0; x < width; ++x, src += 4, dst += 4) {
+        const uint8_t a = src[from.alpha];
+        const uint8_t r = src[from.red], g = src[from.green], b = src[from.blue];
+        dst[layout.red] = rescale ? scale_channel(r, a, layout.premultiplied) : r;
+        dst[layout.green] = rescale ? scale_channel(g, a, layout.premultiplied) : g;
+        dst[layout.blue] = rescale ? scale_channel(b, a, layout.premultiplied) : b;
+        dst[layout.alpha] = a;
+    }
+}
+
+} // namespace
+
+WXD_EXPORTED wxd_PixelFormat
+wxd_Bitmap_GetNativePixelFormat(void)
+{
+    using Format = wxAlphaPixelFormat;
+    const int base = Format::ALPHA == 0 ? WXD_PIXEL_FORMAT_ARGB
+                     : Format::RED == 0 ? WXD_PIXEL_FORMAT_RGBA
+                                        : WXD_PIXEL_FORMAT_BGRA;
+    return static_cast<wxd_PixelFormat>(
+        kPremultipliedAlpha ? base + WXD_PIXEL_FORMAT_RGBA_PREMULTIPLIED : base);
+}
+
+WXD_EXPORTED wxd_Bitmap_t*
+wxd_Bitmap_CreateFromNative(const unsigned char* data, int width, int height, size_t stride,
+                            wxd_PixelFormat format)
+{
+    SourceFormat from;
+    if (!data || width <= 0 || height <= 0 || !source_format(format, &from))
+        return nullptr;
+    const size_t row_bytes = static_cast<size_t>(width) * 4;
+    if (stride == 0)
+        stride = row_bytes;
+    if (stride < row_bytes)
+        return nullptr;
+
+    auto bitmap = std::make_unique<wxBitmap>(width, height, 32);
+    if (!bitmap->IsOk())
+        return nullptr;
+    bitmap->UseAlpha();
+    {
+        wxAlphaPixelData pixels(*bitmap);
+        if (!pixels)
+            return nullptr;
+        wxd_BitmapPixelLayout layout{};
+        fill_layout(pixels, &layout);
+        for (int y = 0; y < height; ++y) {
+            write_native_row(data + y * stride,
+                             layout.pixels + static_cast<ptrdiff_t>(y) * layout.stride,
+                             static_cast<size_t>(width), from, layout);
+        }
+    }
+    return reinterpret_cast<wxd_Bitmap_t*>(wxd_objstats::track(bitmap.release()));
+}
+
+// --- Off-thread decoding ---
+
+struct wxd_DecodedImage_t {
+    wxImage image;
+};
+
+// --- Resampling ---
+
+static wxd_resize::Filter
+resize_filter(wxd_ResizeQuality quality)
+{
+    switch (quality) {
+    case WXD_RESIZE_NEAREST:
+        return wxd_resize::Filter::Nearest;
+    case WXD_RESIZE_BOX:
+        return wxd_resize::Filter::Box;
+    case WXD_RESIZE_BILINEAR:
+        return wxd_resize::Filter::Bilinear;
+    case WXD_RESIZE_BICUBIC:
+        break;
+    }
+    return wxd_resize::Filter::Bicubic;
+}
+
+WXD_EXPORTED bool
+wxd_Image_ResizeRGBA(const unsigned char* src, int src_width, int src_height, unsigned char* dst,
+                     int dst_width, int dst_height, wxd_ResizeQuality quality)
+{
+    return wxd_resize::resize_rgba(src, src_width, src_height, 0, dst, dst_width, dst_height, 0,
+                                   resize_filter(quality));
+}
+
+// Replaces `image` by a resized copy. wxImage::Rescale filters colour and alpha separately
+// in double precision; this goes through the premultiplied fixed-point kernels instead.
+static bool
+resize_image(wxImage& image, int width, int height, wxd_ResizeQuality quality)
+{
+    if (image.HasMask() && !image.HasAlpha())
+        image.InitAlpha();
+    const bool has_alpha = image.HasAlpha();
+    const size_t src_pixels = static_cast<size_t>(image.GetWidth()) * image.GetHeight();
+    const size_t dst_pixels = static_cast<size_t>(width) * height;
+    std::vector<uint8_t> src, dst;
+    try {
+        src.resize(src_pixels * 4);
+        dst.resize(dst_pixels * 4);
+    }
+    catch (const std::bad_alloc&) {
+        return false;
+    }
+    wxd_pixels::merge_rgba(image.GetData(), has_alpha ? image.GetAlpha() : nullptr, src.data(),
+                           src_pixels);
+    if (!wxd_resize::resize_rgba(src.data(), image.GetWidth(), image.GetHeight(), 0, dst.data(),
+                                 width, height, 0, resize_filter(quality)))
+        return false;
+    unsigned char* rgb = static_cast<unsigned char*>(malloc(dst_pixels * 3));
+    unsigned char* alpha = static_cast<unsigned char*>(malloc(dst_pixels));
+    if (!rgb || !alpha) {
+        free(rgb);
+        free(alpha);
+        return false;
+    }
+    wxd_pixels::split_rgba(dst.data(), rgb, alpha, dst_pixels);
+    if (!has_alpha) {
+        free(alpha);
+        alpha = nullptr;
+    }
+    // The new image owns both malloc'ed planes.
+    image = wxImage(width, height, rgb, alpha);
+    return image.IsOk();
+}
+
+WXD_EXPORTED wxd_DecodedImage_t*
+wxd_DecodedImage_DecodeScaled(const unsigned char* bytes, size_t len, wxd_Size max_size,
+                              wxd_ResizeQuality quality)
+{
+    if (!bytes || len == 0)
+        return nullptr;
+    auto decoded = std::make_unique<wxd_DecodedImage_t>();
+    {
+        // Undecodable data is reported through the return value; wxLogNull is per thread.
+        wxLogNull no_log;
+        wxd_startup::ensure_image_handlers();
+        wxMemoryInputStream stream(bytes, len);
+        if (!decoded->image.LoadFile(stream, wxBITMAP_TYPE_ANY) || !decoded->image.IsOk())
+            return nullptr;
+    }
+
+    const int width = decoded->image.GetWidth();
+    const int height = decoded->image.GetHeight();
+    if (max_size.width > 0 && max_size.height > 0 &&
+        (width > max_size.width || height > max_size.height)) {
+        const double scale = std::min(static_cast<double>(max_size.width) / width,
+                                      static_cast<double>(max_size.height) / height);
+        const int new_width = std::max(1, static_cast<int>(width * scale + 0.5));
+        const int new_height = std::max(1, static_cast<int>(height * scale + 0.5));
+        if (!resize_image(decoded->image, new_width, new_height, quality))
+            decoded->image.Rescale(new_width, new_height, wxIMAGE_QUALITY_HIGH);
+    }
+    return decoded.release();
+}
+
+WXD_EXPORTED wxd_DecodedImage_t*
+wxd_DecodedImage_Decode(const unsigned char* bytes, size_t len, wxd_Size max_size)
+{
+    return wxd_DecodedImage_DecodeScaled(bytes, len, max_size, WXD_RESIZE_BICUBIC);
+}
+
+WXD_EXPORTED wxd_Size
+wxd_DecodedImage_GetSize(const wxd_DecodedImage_t* image)
+{
+    if (!image)
+        return wxd_Size{ 0, 0 };
+    return wxd_Size{ image->image.GetWidth(), image->image.GetHeight() };
+}
+
+WXD_EXPORTED wxd_Bitmap_t*
+wxd_DecodedImage_ToBitmap(const wxd_DecodedImage_t* image)
+{
+    if (!image || !image->image.IsOk())
+        return nullptr;
+    wxBitmap* bitmap = new (std::nothrow) wxBitmap(image->image, -1);
+    if (!bitmap || !bitmap->IsOk()) {
+        delete bitmap;
+        return nullptr;
+    }
+    return reinterpret_cast<wxd_Bitmap_t*>(wxd_objstats::track(bitmap));
+}
+
+WXD_EXPORTED void
+wxd_DecodedImage_Destroy(wxd_DecodedImage_t* image)
+{
+    delete image;
+}
+
 // Get a pointer to wxNullBitmap
 WXD_EXPORTED const wxd_Bitmap_t*
 wxd_Bitmap_GetNull(void)
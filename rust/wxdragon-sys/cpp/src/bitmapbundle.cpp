@@ -1,11 +1,225 @@
 #include <wx/wxprec.h>
 #include <wx/wx.h>
 #include "../include/wxdragon.h"
+#include "wxd_objstats.h"
+#include "wxd_startup.h"
+#include "wxd_atlas.h"
+#include "wxd_cache_registry.h"
 #include <wx/bmpbndl.h>
 #include <wx/bitmap.h>
 #include <wx/mstream.h>
+#include <wx/ffile.h>
+#include <wx/filename.h>
+#include <cstring>
+#include <list>
+#include <unordered_map>
 #include <vector>
 
+namespace {
+
+// --- SVG rasterization cache ---
+
+struct SvgKey {
+    uint64_t hash;
+    size_t len;
+    int width;
+    int height;
+
+    bool
+    operator==(const SvgKey& other) const
+    {
+        return hash == other.hash && len == other.len && width == other.width &&
+               height == other.height;
+    }
+};
+
+struct SvgKeyHash {
+    size_t
+    operator()(const SvgKey& key) const
+    {
+        return static_cast<size_t>(key.hash ^ (static_cast<uint64_t>(key.width) << 32) ^
+                                   static_cast<uint64_t>(key.height) ^ key.len);
+    }
+};
+
+// Rasterized SVG bitmaps shared by every bundle with the same content, least recently used at
+// the back. Main thread only.
+class SvgRasterCache : public wxd_cache_registry::Cache {
+public:
+    size_t capacity = 256;
+    wxString disk_dir;
+
+    SvgRasterCache() : Cache("svg_raster") {}
+
+    bool
+    Lookup(const SvgKey& key, wxBitmap* out)
+    {
+        auto it = m_index.find(key);
+        if (it == m_index.end())
+            return false;
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        *out = it->second->second;
+        return true;
+    }
+
+    void
+    Store(const SvgKey& key, const wxBitmap& bitmap)
+    {
+        if (capacity == 0 || m_index.count(key))
+            return;
+        while (m_entries.size() >= capacity)
+            PopBack();
+        m_entries.emplace_front(key, bitmap);
+        m_index.emplace(key, m_entries.begin());
+        m_bytes += Cost(key);
+    }
+
+    void
+    Clear()
+    {
+        m_index.clear();
+        m_entries.clear();
+        m_bytes = 0;
+    }
+
+    size_t
+    CacheBytes() const override
+    {
+        return m_bytes;
+    }
+
+    size_t
+    CacheEntries() const override
+    {
+        return m_entries.size();
+    }
+
+    void
+    Trim(wxd_TrimLevel level) override
+    {
+        const size_t keep = level == WXD_TRIM_MODERATE ? m_entries.size() / 2 : 0;
+        while (m_entries.size() > keep)
+            PopBack();
+    }
+
+private:
+    static size_t
+    Cost(const SvgKey& key)
+    {
+        return static_cast<size_t>(key.width) * static_cast<size_t>(key.height) * 4;
+    }
+
+    void
+    PopBack()
+    {
+        m_bytes -= Cost(m_entries.back().first);
+        m_index.erase(m_entries.back().first);
+        m_entries.pop_back();
+    }
+
+    std::list<std::pair<SvgKey, wxBitmap>> m_entries;
+    std::unordered_map<SvgKey, std::list<std::pair<SvgKey, wxBitmap>>::iterator, SvgKeyHash>
+        m_index;
+    size_t m_bytes = 0;
+};
+
+SvgRasterCache&
+svg_cache()
+{
+    // Deliberately leaked: cached bitmaps must not be destroyed after the toolkit shuts down.
+    static SvgRasterCache* instance = new SvgRasterCache();
+    return *instance;
+}
+
+uint64_t
+svg_hash(const unsigned char* data, size_t len)
+{
+    uint64_t hash = 0xcbf29ce484222325ull; // FNV-1a, stable across runs for the disk cache
+    for (size_t i = 0; i < len; ++i) {
+        hash = (hash ^ data[i]) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+wxString
+svg_disk_path(const wxString& dir, const SvgKey& key)
+{
+    const wxString name =
+        wxString::Format("svg-%016llx-%llu-%dx%d.png", static_cast<unsigned long long>(key.hash),
+                         static_cast<unsigned long long>(key.len), key.width, key.height);
+    return wxFileName(dir, name).GetFullPath();
+}
+
+// Wraps wxWidgets' SVG bundle, which only keeps the last size it rasterized, and consults the
+// process-wide cache (and, if configured, the PNG disk cache) before rasterizing.
+class CachedSvgBundleImpl : public wxBitmapBundleImpl {
+public:
+    CachedSvgBundleImpl(const wxBitmapBundle& svg, uint64_t hash, size_t len)
+        : m_svg(svg), m_hash(hash), m_len(len)
+    {
+    }
+
+    wxSize
+    GetDefaultSize() const override
+    {
+        return m_svg.GetDefaultSize();
+    }
+
+    wxSize
+    GetPreferredBitmapSizeAtScale(double scale) const override
+    {
+        return m_svg.GetPreferredBitmapSizeAtScale(scale);
+    }
+
+    wxBitmap
+    GetBitmap(const wxSize& size) override
+    {
+        const SvgKey key{ m_hash, m_len, size.x, size.y };
+        SvgRasterCache& cache = svg_cache();
+        wxBitmap bitmap;
+        if (cache.Lookup(key, &bitmap))
+            return bitmap;
+
+        const wxString path =
+            cache.disk_dir.empty() ? wxString() : svg_disk_path(cache.disk_dir, key);
+        if (!path.empty())
+            wxd_startup::ensure_image_handlers(); // PNG files of the disk cache
+        if (!path.empty() && wxFileExists(path)) {
+            wxLogNull no_log; // a stale or truncated file just means rasterizing again
+            wxImage image;
+            if (image.LoadFile(path, wxBITMAP_TYPE_PNG) && image.GetSize() == size)
+                bitmap = wxBitmap(image);
+        }
+        if (!bitmap.IsOk()) {
+            bitmap = m_svg.GetBitmap(size);
+            if (bitmap.IsOk() && !path.empty()) {
+                wxLogNull no_log;
+                bitmap.ConvertToImage().SaveFile(path, wxBITMAP_TYPE_PNG);
+            }
+        }
+        if (bitmap.IsOk())
+            cache.Store(key, bitmap);
+        return bitmap;
+    }
+
+private:
+    wxBitmapBundle m_svg;
+    uint64_t m_hash;
+    size_t m_len;
+};
+
+wxBitmapBundle*
+new_cached_svg_bundle(const unsigned char* data, size_t len, const wxSize& size)
+{
+    wxBitmapBundle svg = wxBitmapBundle::FromSVG(data, len, size);
+    if (!svg.IsOk())
+        return new wxBitmapBundle(svg);
+    return new wxBitmapBundle(
+        wxBitmapBundle::FromImpl(new CachedSvgBundleImpl(svg, svg_hash(data, len), len)));
+}
+
+} // namespace
+
 // Create an empty bitmap bundle
 WXD_EXPORTED wxd_BitmapBundle_t*
 wxd_BitmapBundle_Create()
@@ -53,6 +267,43 @@ wxd_BitmapBundle_FromBitmaps(const wxd_Bitmap_t* const* bitmaps, size_t count)
     return reinterpret_cast<wxd_BitmapBundle_t*>(bundle);
 }
 
+WXD_EXPORTED size_t
+wxd_BitmapBundle_FromAtlases(const unsigned char* const* sheets, const wxd_Size* sheet_sizes,
+                             const wxd_Size* tile_sizes, size_t sheet_count, size_t count,
+                             wxd_BitmapBundle_t** out)
+{
+    if (!sheets || !sheet_sizes || !tile_sizes || !out || sheet_count == 0 || count == 0) {
+        return 0;
+    }
+
+    wxVector<wxBitmap> converted;
+    converted.reserve(sheet_count);
+    for (size_t s = 0; s < sheet_count; ++s) {
+        const wxd_Size sheet = sheet_sizes[s];
+        const wxd_Size tile = tile_sizes[s];
+        if (!sheets[s] ||
+            static_cast<size_t>(wxd_atlas::tile_count(sheet.width, sheet.height, tile.width,
+                                                      tile.height)) < count) {
+            return 0;
+        }
+        converted.push_back(wxd_atlas::sheet_bitmap(sheets[s], sheet.width, sheet.height));
+        if (!converted.back().IsOk()) {
+            return 0;
+        }
+    }
+
+    wxVector<wxBitmap> sizes(sheet_count);
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t s = 0; s < sheet_count; ++s) {
+            sizes[s] = converted[s].GetSubBitmap(wxd_atlas::tile_rect(
+                sheet_sizes[s].width, tile_sizes[s].width, tile_sizes[s].height, static_cast<int>(i)));
+        }
+        out[i] = reinterpret_cast<wxd_BitmapBundle_t*>(
+            new wxBitmapBundle(wxBitmapBundle::FromBitmaps(sizes)));
+    }
+    return count;
+}
+
 // Clone a bitmap bundle
 WXD_EXPORTED wxd_BitmapBundle_t*
 wxd_BitmapBundle_Clone(const wxd_BitmapBundle_t* bundle)
@@ -86,6 +337,17 @@ wxd_BitmapBundle_FromSVGFile(const char* path, wxd_Size size)
 
     wxString wx_path = wxString::FromUTF8(path);
     wxSize wx_size(size.width, size.height);
+    // Read the file ourselves so the content hash can key the rasterization cache.
+    std::vector<unsigned char> data;
+    wxFFile file(wx_path, "rb");
+    const wxFileOffset file_len = file.IsOpened() ? file.Length() : wxInvalidOffset;
+    if (file_len > 0) {
+        data.resize(static_cast<size_t>(file_len));
+        if (file.Read(data.data(), data.size()) == data.size()) {
+            return reinterpret_cast<wxd_BitmapBundle_t*>(
+                new_cached_svg_bundle(data.data(), data.size(), wx_size));
+        }
+    }
     wxBitmapBundle* bundle = new wxBitmapBundle(wxBitmapBundle::FromSVGFile(wx_path, wx_size));
     return reinterpret_cast<wxd_BitmapBundle_t*>(bundle);
 }
@@ -98,9 +360,9 @@ wxd_BitmapBundle_FromSVGText(const char* svg_text, wxd_Size size)
         return wxd_BitmapBundle_Create();
     }
 
-    wxString wx_svg = wxString::FromUTF8(svg_text);
     wxSize wx_size(size.width, size.height);
-    wxBitmapBundle* bundle = new wxBitmapBundle(wxBitmapBundle::FromSVG(wx_svg, wx_size));
+    wxBitmapBundle* bundle = new_cached_svg_bundle(
+        reinterpret_cast<const unsigned char*>(svg_text), std::strlen(svg_text), wx_size);
     return reinterpret_cast<wxd_BitmapBundle_t*>(bundle);
 }
 
@@ -113,7 +375,7 @@ wxd_BitmapBundle_FromSVGData(const unsigned char* data, size_t len, wxd_Size siz
     }
 
     wxSize wx_size(size.width, size.height);
-    wxBitmapBundle* bundle = new wxBitmapBundle(wxBitmapBundle::FromSVG(data, len, wx_size));
+    wxBitmapBundle* bundle = new_cached_svg_bundle(data, len, wx_size);
     return reinterpret_cast<wxd_BitmapBundle_t*>(bundle);
 }
 
@@ -133,7 +395,7 @@ wxd_BitmapBundle_GetBitmap(const wxd_BitmapBundle_t* bundle, wxd_Size size)
         return nullptr;
     }
 
-    wxBitmap* new_bitmap = new wxBitmap(bitmap);
+    wxBitmap* new_bitmap = wxd_objstats::track(new wxBitmap(bitmap));
     return reinterpret_cast<wxd_Bitmap_t*>(new_bitmap);
 }
 
@@ -153,7 +415,7 @@ wxd_BitmapBundle_GetBitmapFor(const wxd_BitmapBundle_t* bundle, wxd_Window_t* wi
         return nullptr;
     }
 
-    wxBitmap* new_bitmap = new wxBitmap(bitmap);
+    wxBitmap* new_bitmap = wxd_objstats::track(new wxBitmap(bitmap));
     return reinterpret_cast<wxd_Bitmap_t*>(new_bitmap);
 }
 
@@ -216,4 +478,36 @@ wxd_BitmapBundle_IsOk(const wxd_BitmapBundle_t* bundle)
 
     const wxBitmapBundle* wx_bundle = reinterpret_cast<const wxBitmapBundle*>(bundle);
     return wx_bundle->IsOk();
-}
\ No newline at end of file
+}
+
+// SVG rasterization cache configuration
+WXD_EXPORTED void
+wxd_BitmapBundle_SetSVGCacheCapacity(size_t entries)
+{
+    SvgRasterCache& cache = svg_cache();
+    cache.capacity = entries;
+    cache.Clear();
+}
+
+WXD_EXPORTED void
+wxd_BitmapBundle_ClearSVGCache(void)
+{
+    svg_cache().Clear();
+}
+
+WXD_EXPORTED bool
+wxd_BitmapBundle_SetSVGDiskCacheDir(const char* dir)
+{
+    SvgRasterCache& cache = svg_cache();
+    if (!dir || !*dir) {
+        cache.disk_dir.clear();
+        return true;
+    }
+    const wxString wx_dir = wxString::FromUTF8(dir);
+    if (!wxFileName::DirExists(wx_dir) &&
+        !wxFileName::Mkdir(wx_dir, wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL)) {
+        return false;
+    }
+    cache.disk_dir = wx_dir;
+    return true;
+}
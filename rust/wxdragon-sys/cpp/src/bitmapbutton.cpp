@@ -1,6 +1,7 @@
 #include <wx/wxprec.h>
 #include <wx/wx.h>
 #include "../include/wxdragon.h"
+#include "wxd_objstats.h"
 #include <wx/bmpbuttn.h> // For wxBitmapButton
 #include <wx/bitmap.h>   // For wxBitmap
 
@@ -68,7 +69,7 @@ wxd_BitmapButton_GetBitmapLabel(wxd_BitmapButton_t* self)
     const wxBitmap& bmp = btn->GetBitmapLabel();
     if (!bmp.IsOk())
         return nullptr;
-    return (wxd_Bitmap_t*)new wxBitmap(bmp); // Return a heap-allocated copy
+    return (wxd_Bitmap_t*)wxd_objstats::track(new wxBitmap(bmp)); // Return a heap-allocated copy
 }
 
 WXD_EXPORTED wxd_Bitmap_t*
@@ -80,7 +81,7 @@ wxd_BitmapButton_GetBitmapDisabled(wxd_BitmapButton_t* self)
     const wxBitmap& bmp = btn->GetBitmapDisabled();
     if (!bmp.IsOk())
         return nullptr;
-    return (wxd_Bitmap_t*)new wxBitmap(bmp); // Return a heap-allocated copy
+    return (wxd_Bitmap_t*)wxd_objstats::track(new wxBitmap(bmp)); // Return a heap-allocated copy
 }
 
 WXD_EXPORTED wxd_Bitmap_t*
@@ -92,7 +93,7 @@ wxd_BitmapButton_GetBitmapFocus(wxd_BitmapButton_t* self)
     const wxBitmap& bmp = btn->GetBitmapFocus();
     if (!bmp.IsOk())
         return nullptr;
-    return (wxd_Bitmap_t*)new wxBitmap(bmp); // Return a heap-allocated copy
+    return (wxd_Bitmap_t*)wxd_objstats::track(new wxBitmap(bmp)); // Return a heap-allocated copy
 }
 
 WXD_EXPORTED wxd_Bitmap_t*
@@ -104,7 +105,7 @@ wxd_BitmapButton_GetBitmapHover(wxd_BitmapButton_t* self)
     const wxBitmap& bmp = btn->GetBitmapCurrent(); // wxWidgets uses GetBitmapCurrent for hover
     if (!bmp.IsOk())
         return nullptr;
-    return (wxd_Bitmap_t*)new wxBitmap(bmp); // Return a heap-allocated copy
+    return (wxd_Bitmap_t*)wxd_objstats::track(new wxBitmap(bmp)); // Return a heap-allocated copy
 }
 
 } // extern "C"
\ No newline at end of file
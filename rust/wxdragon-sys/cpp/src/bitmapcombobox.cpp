@@ -1,6 +1,7 @@
 #include <wx/wxprec.h>
 #include <wx/wx.h>
 #include "../include/wxdragon.h"
+#include "wxd_objstats.h"
 #include "wxd_utils.h"
 #include <wx/bmpcbox.h> // Include header for wxBitmapComboBox
 #include <wx/bitmap.h>  // For wxBitmap
@@ -19,8 +20,8 @@ wxd_BitmapComboBox_Create(wxd_Window_t* parent, wxd_Id id, const char* value, wx
     wxString wxValue = wxString::FromUTF8(value ? value : "");
     // wxBitmapComboBox needs an empty wxArrayString initially.
     wxBitmapComboBox* combo = new wxBitmapComboBox(parentWin, id, wxValue,
-                                                   wxd_cpp_utils::to_wx(pos),
-                                                   wxd_cpp_utils::to_wx(size),
+                                                   wxd_cpp_utils::to_wx(pos, parentWin),
+                                                   wxd_cpp_utils::to_wx(size, parentWin),
                                                    wxArrayString(), // Empty choices initially
                                                    style);
     return (wxd_BitmapComboBox_t*)combo;
@@ -141,7 +142,7 @@ wxd_BitmapComboBox_GetItemBitmap(wxd_BitmapComboBox_t* self, unsigned int n)
     if (!bmp.IsOk())
         return nullptr;
     // Create a new wxBitmap on the heap to return a stable pointer
-    return (wxd_Bitmap_t*)new (std::nothrow) wxBitmap(bmp);
+    return (wxd_Bitmap_t*)wxd_objstats::track(new (std::nothrow) wxBitmap(bmp));
 }
 
 WXD_EXPORTED void
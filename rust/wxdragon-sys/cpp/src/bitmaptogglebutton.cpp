@@ -1,6 +1,7 @@
 #include <wx/wxprec.h>
 #include <wx/wx.h>
 #include "../include/wxdragon.h"
+#include "wxd_objstats.h"
 #include <wx/tglbtn.h> // For wxBitmapToggleButton
 #include <wx/bitmap.h>
 
@@ -157,7 +158,7 @@ wxd_BitmapToggleButton_GetBitmapLabel(wxd_BitmapToggleButton_t* self)
     const wxBitmap& bmp = btn->GetBitmapLabel();
     if (!bmp.IsOk())
         return nullptr;
-    return (wxd_Bitmap_t*)new wxBitmap(bmp);
+    return (wxd_Bitmap_t*)wxd_objstats::track(new wxBitmap(bmp));
 }
 
 WXD_EXPORTED wxd_Bitmap_t*
@@ -169,7 +170,7 @@ wxd_BitmapToggleButton_GetBitmapDisabled(wxd_BitmapToggleButton_t* self)
     const wxBitmap& bmp = btn->GetBitmapDisabled();
     if (!bmp.IsOk())
         return nullptr;
-    return (wxd_Bitmap_t*)new wxBitmap(bmp);
+    return (wxd_Bitmap_t*)wxd_objstats::track(new wxBitmap(bmp));
 }
 
 WXD_EXPORTED wxd_Bitmap_t*
@@ -181,7 +182,7 @@ wxd_BitmapToggleButton_GetBitmapFocus(wxd_BitmapToggleButton_t* self)
     const wxBitmap& bmp = btn->GetBitmapFocus();
     if (!bmp.IsOk())
         return nullptr;
-    return (wxd_Bitmap_t*)new wxBitmap(bmp);
+    return (wxd_Bitmap_t*)wxd_objstats::track(new wxBitmap(bmp));
 }
 
 WXD_EXPORTED wxd_Bitmap_t*
@@ -193,7 +194,7 @@ wxd_BitmapToggleButton_GetBitmapPressed(wxd_BitmapToggleButton_t* self)
     const wxBitmap& bmp = btn->GetBitmapPressed();
     if (!bmp.IsOk())
         return nullptr;
-    return (wxd_Bitmap_t*)new wxBitmap(bmp);
+    return (wxd_Bitmap_t*)wxd_objstats::track(new wxBitmap(bmp));
 }
 
 } // extern "C"
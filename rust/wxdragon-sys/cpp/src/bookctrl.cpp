@@ -0,0 +1,329 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include <wx/bookctrl.h>
+#include <wx/notebook.h>
+#include <wx/treebook.h>
+#include "../include/wxdragon.h"
+#include "wxd_window_timing.h"
+#if wxdUSE_AUI
+#include <wx/aui/auibook.h>
+#endif
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// Placeholder page: stays empty until its content is built by the lazy page callback.
+class LazyPagePanel : public wxPanel {
+public:
+    LazyPagePanel(wxWindow* parent, int64_t key) : wxPanel(parent, wxID_ANY), key(key)
+    {
+    }
+
+    int64_t key;
+    bool realized = false;
+    wxLongLong last_shown = 0;
+};
+
+LazyPagePanel*
+lazy_page(wxBookCtrlBase* book, size_t index)
+{
+    if (index >= book->GetPageCount())
+        return nullptr;
+    return dynamic_cast<LazyPagePanel*>(book->GetPage(index));
+}
+
+class LazyBookState;
+
+std::unordered_map<wxBookCtrlBase*, std::unique_ptr<LazyBookState>>&
+lazy_books()
+{
+    static std::unordered_map<wxBookCtrlBase*, std::unique_ptr<LazyBookState>> map;
+    return map;
+}
+
+// Per-book lazy-pages mode: builds a page's content from the Rust callback before it is first
+// shown and, with a budget, empties the least recently viewed pages again.
+class LazyBookState {
+public:
+    explicit LazyBookState(wxBookCtrlBase* book) : m_book(book)
+    {
+        // Simplebook and other generic books send the notebook event types.
+        m_book->Bind(wxEVT_NOTEBOOK_PAGE_CHANGING, &LazyBookState::OnChanging, this);
+        m_book->Bind(wxEVT_NOTEBOOK_PAGE_CHANGED, &LazyBookState::OnChanged, this);
+        m_book->Bind(wxEVT_TREEBOOK_PAGE_CHANGING, &LazyBookState::OnChanging, this);
+        m_book->Bind(wxEVT_TREEBOOK_PAGE_CHANGED, &LazyBookState::OnChanged, this);
+#if wxdUSE_AUI
+        m_book->Bind(wxEVT_AUINOTEBOOK_PAGE_CHANGING, &LazyBookState::OnChanging, this);
+        m_book->Bind(wxEVT_AUINOTEBOOK_PAGE_CHANGED, &LazyBookState::OnChanged, this);
+#endif
+    }
+
+    ~LazyBookState()
+    {
+        m_book->Unbind(wxEVT_NOTEBOOK_PAGE_CHANGING, &LazyBookState::OnChanging, this);
+        m_book->Unbind(wxEVT_NOTEBOOK_PAGE_CHANGED, &LazyBookState::OnChanged, this);
+        m_book->Unbind(wxEVT_TREEBOOK_PAGE_CHANGING, &LazyBookState::OnChanging, this);
+        m_book->Unbind(wxEVT_TREEBOOK_PAGE_CHANGED, &LazyBookState::OnChanged, this);
+#if wxdUSE_AUI
+        m_book->Unbind(wxEVT_AUINOTEBOOK_PAGE_CHANGING, &LazyBookState::OnChanging, this);
+        m_book->Unbind(wxEVT_AUINOTEBOOK_PAGE_CHANGED, &LazyBookState::OnChanged, this);
+#endif
+        if (m_userdata && m_free_userdata)
+            m_free_userdata(m_userdata);
+    }
+
+    void
+    Configure(void* userdata, wxd_bookctrl_lazy_page_callback callback,
+              wxd_bookctrl_free_userdata_callback free_userdata, size_t max_realized,
+              int min_idle_ms)
+    {
+        if (m_userdata && m_free_userdata)
+            m_free_userdata(m_userdata);
+        m_userdata = userdata;
+        m_callback = callback;
+        m_free_userdata = free_userdata;
+        m_max_realized = max_realized;
+        m_min_idle_ms = std::max(min_idle_ms, 0);
+    }
+
+    void
+    Realize(LazyPagePanel* page)
+    {
+        page->last_shown = wxGetLocalTimeMillis();
+        if (page->realized || !m_callback)
+            return;
+        page->realized = true;
+        page->Freeze();
+        m_callback(m_userdata, page->key, reinterpret_cast<wxd_Window_t*>(page));
+        const wxWindowList& children = page->GetChildren();
+        if (!page->GetSizer() && children.GetCount() == 1) {
+            wxBoxSizer* sizer = new wxBoxSizer(wxVERTICAL);
+            sizer->Add(children.GetFirst()->GetData(), 1, wxEXPAND);
+            page->SetSizer(sizer);
+        }
+        {
+            wxd_window_timing::Scope timing(WXD_WINDOW_TIMING_LAYOUT, page);
+            page->Layout();
+        }
+        page->Thaw();
+        ScheduleTrim();
+    }
+
+    static void
+    Unload(LazyPagePanel* page)
+    {
+        if (!page->realized)
+            return;
+        page->realized = false;
+        page->SetSizer(nullptr);
+        page->DestroyChildren();
+    }
+
+private:
+    void
+    OnChanging(wxBookCtrlEvent& event)
+    {
+        event.Skip();
+        const int selection = event.GetSelection();
+        if (selection == wxNOT_FOUND)
+            return;
+        if (LazyPagePanel* page = lazy_page(m_book, static_cast<size_t>(selection)))
+            Realize(page);
+    }
+
+    // Also covers selection changes that skipped the changing event.
+    void
+    OnChanged(wxBookCtrlEvent& event)
+    {
+        event.Skip();
+        const wxLongLong now = wxGetLocalTimeMillis();
+        const int old_selection = event.GetOldSelection();
+        if (old_selection != wxNOT_FOUND) {
+            if (LazyPagePanel* page = lazy_page(m_book, static_cast<size_t>(old_selection)))
+                page->last_shown = now;
+        }
+        const int selection = event.GetSelection();
+        if (selection != wxNOT_FOUND) {
+            if (LazyPagePanel* page = lazy_page(m_book, static_cast<size_t>(selection)))
+                Realize(page);
+        }
+        ScheduleTrim();
+    }
+
+    void
+    ScheduleTrim()
+    {
+        if (m_max_realized == 0 || m_trim_pending)
+            return;
+        // Destroying page content from inside a selection notification is not safe on every port.
+        m_trim_pending = true;
+        wxBookCtrlBase* book = m_book;
+        book->CallAfter([book]() {
+            auto it = lazy_books().find(book);
+            if (it != lazy_books().end())
+                it->second->Trim();
+        });
+    }
+
+    void
+    Trim()
+    {
+        m_trim_pending = false;
+        const int selection = m_book->GetSelection();
+        wxWindow* current = selection != wxNOT_FOUND ? m_book->GetPage(selection) : nullptr;
+        std::vector<LazyPagePanel*> realized;
+        for (size_t i = 0; i < m_book->GetPageCount(); ++i) {
+            LazyPagePanel* page = lazy_page(m_book, i);
+            if (page && page->realized)
+                realized.push_back(page);
+        }
+        if (realized.size() <= m_max_realized)
+            return;
+        std::sort(realized.begin(), realized.end(),
+                  [](const LazyPagePanel* a, const LazyPagePanel* b) {
+                      return a->last_shown < b->last_shown;
+                  });
+        const wxLongLong now = wxGetLocalTimeMillis();
+        size_t excess = realized.size() - m_max_realized;
+        for (LazyPagePanel* page : realized) {
+            if (excess == 0 || now - page->last_shown < m_min_idle_ms)
+                break;
+            if (page == current)
+                continue;
+            Unload(page);
+            --excess;
+        }
+    }
+
+    wxBookCtrlBase* m_book;
+    void* m_userdata = nullptr;
+    wxd_bookctrl_lazy_page_callback m_callback = nullptr;
+    wxd_bookctrl_free_userdata_callback m_free_userdata = nullptr;
+    size_t m_max_realized = 0;
+    int m_min_idle_ms = 0;
+    bool m_trim_pending = false;
+};
+
+void
+on_lazy_book_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    if (wxBookCtrlBase* book = wxDynamicCast(event.GetEventObject(), wxBookCtrlBase))
+        lazy_books().erase(book);
+}
+
+wxBookCtrlBase*
+unwrap_book(wxd_Window_t* book)
+{
+    return wxDynamicCast(reinterpret_cast<wxWindow*>(book), wxBookCtrlBase);
+}
+
+} // namespace
+
+extern "C" {
+
+WXD_EXPORTED bool
+wxd_BookCtrl_EnableLazyPages(wxd_Window_t* book, void* userdata,
+                             wxd_bookctrl_lazy_page_callback callback,
+                             wxd_bookctrl_free_userdata_callback free_userdata,
+                             size_t maxRealizedPages, int minIdleMs)
+{
+    wxBookCtrlBase* bookCtrl = unwrap_book(book);
+    if (!bookCtrl || !callback)
+        return false;
+    auto& map = lazy_books();
+    auto it = map.find(bookCtrl);
+    if (it == map.end()) {
+        bookCtrl->Bind(wxEVT_DESTROY, on_lazy_book_destroy);
+        it = map.emplace(bookCtrl, std::make_unique<LazyBookState>(bookCtrl)).first;
+    }
+    it->second->Configure(userdata, callback, free_userdata, maxRealizedPages, minIdleMs);
+    return true;
+}
+
+WXD_EXPORTED void
+wxd_BookCtrl_DisableLazyPages(wxd_Window_t* book)
+{
+    wxBookCtrlBase* bookCtrl = unwrap_book(book);
+    if (!bookCtrl)
+        return;
+    if (lazy_books().erase(bookCtrl))
+        bookCtrl->Unbind(wxEVT_DESTROY, on_lazy_book_destroy);
+}
+
+WXD_EXPORTED wxd_Window_t*
+wxd_BookCtrl_InsertLazyPage(wxd_Window_t* book, size_t index, const char* text, bool select,
+                            int imageId, int64_t key)
+{
+    wxBookCtrlBase* bookCtrl = unwrap_book(book);
+    if (!bookCtrl)
+        return nullptr;
+    auto it = lazy_books().find(bookCtrl);
+    if (it == lazy_books().end())
+        return nullptr;
+
+    LazyPagePanel* page = new LazyPagePanel(bookCtrl, key);
+    const size_t count = bookCtrl->GetPageCount();
+    // Selecting from here sends the page-changing event, which realizes the page.
+    if (!bookCtrl->InsertPage(std::min(index, count), page, wxString::FromUTF8(text ? text : ""),
+                              select, imageId)) {
+        page->Destroy();
+        return nullptr;
+    }
+    // The first page of an empty book becomes current without any event.
+    const int selection = bookCtrl->GetSelection();
+    if (selection != wxNOT_FOUND && bookCtrl->GetPage(selection) == page)
+        it->second->Realize(page);
+    return reinterpret_cast<wxd_Window_t*>(page);
+}
+
+WXD_EXPORTED bool
+wxd_BookCtrl_RealizeLazyPage(wxd_Window_t* book, size_t index)
+{
+    wxBookCtrlBase* bookCtrl = unwrap_book(book);
+    if (!bookCtrl)
+        return false;
+    LazyPagePanel* page = lazy_page(bookCtrl, index);
+    auto it = lazy_books().find(bookCtrl);
+    if (!page || it == lazy_books().end())
+        return false;
+    it->second->Realize(page);
+    return true;
+}
+
+WXD_EXPORTED bool
+wxd_BookCtrl_UnloadLazyPage(wxd_Window_t* book, size_t index)
+{
+    wxBookCtrlBase* bookCtrl = unwrap_book(book);
+    LazyPagePanel* page = bookCtrl ? lazy_page(bookCtrl, index) : nullptr;
+    if (!page)
+        return false;
+    LazyBookState::Unload(page);
+    return true;
+}
+
+WXD_EXPORTED int
+wxd_BookCtrl_GetLazyPageState(wxd_Window_t* book, size_t index)
+{
+    wxBookCtrlBase* bookCtrl = unwrap_book(book);
+    LazyPagePanel* page = bookCtrl ? lazy_page(bookCtrl, index) : nullptr;
+    if (!page)
+        return -1;
+    return page->realized ? 1 : 0;
+}
+
+WXD_EXPORTED bool
+wxd_BookCtrl_GetLazyPageKey(wxd_Window_t* book, size_t index, int64_t* key)
+{
+    wxBookCtrlBase* bookCtrl = unwrap_book(book);
+    LazyPagePanel* page = bookCtrl ? lazy_page(bookCtrl, index) : nullptr;
+    if (!page || !key)
+        return false;
+    *key = page->key;
+    return true;
+}
+
+} // extern "C"
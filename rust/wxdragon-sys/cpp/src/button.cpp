@@ -15,7 +15,8 @@ wxd_Button_Create(wxd_Window_t* parent, wxd_Id id, const char* label, wxd_Point
     wxWindow* wx_parent = reinterpret_cast<wxWindow*>(parent);
 
     wxButton* wx_button = new wxButton(wx_parent, id, wxString::FromUTF8(label ? label : ""),
-                                       wxd_cpp_utils::to_wx(pos), wxd_cpp_utils::to_wx(size),
+                                       wxd_cpp_utils::to_wx(pos, wx_parent),
+                                       wxd_cpp_utils::to_wx(size, wx_parent),
                                        style);
 
     return reinterpret_cast<wxd_Button_t*>(wx_button);
@@ -3,6 +3,11 @@
 #include "wxdragon.h"
 #include <wx/calctrl.h>
 #include <wx/datetime.h> // For wxDateTime
+#include <wx/wupdlock.h>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <unordered_map>
 
 // Helper to convert wxd_DateTime_t* (opaque) to wxDateTime
 static wxDateTime
@@ -21,6 +26,195 @@ wxd_to_wx_datetime(const wxd_DateTime_t* wxd_dt)
     return *dt;
 }
 
+namespace {
+
+wxColour
+to_colour(const wxd_Colour_t& colour)
+{
+    return wxColour(colour.r, colour.g, colour.b, colour.a);
+}
+
+bool
+is_default_attr(const wxd_CalendarDayAttr& attr)
+{
+    return !attr.has_text_colour && !attr.has_bg_colour && !attr.has_border_colour &&
+           attr.border == WXD_CAL_BORDER_NONE && !attr.holiday && !attr.bold;
+}
+
+wxCalendarDateAttr*
+make_attr(const wxd_CalendarDayAttr& day, const wxFont& base_font)
+{
+    auto* attr = new wxCalendarDateAttr();
+    if (day.has_text_colour)
+        attr->SetTextColour(to_colour(day.text_colour));
+    if (day.has_bg_colour)
+        attr->SetBackgroundColour(to_colour(day.bg_colour));
+    if (day.has_border_colour)
+        attr->SetBorderColour(to_colour(day.border_colour));
+    switch (day.border) {
+    case WXD_CAL_BORDER_SQUARE:
+        attr->SetBorder(wxCAL_BORDER_SQUARE);
+        break;
+    case WXD_CAL_BORDER_ROUND:
+        attr->SetBorder(wxCAL_BORDER_ROUND);
+        break;
+    default:
+        break;
+    }
+    attr->SetHoliday(day.holiday);
+    if (day.bold)
+        attr->SetFont(base_font.Bold());
+    return attr;
+}
+
+using MonthAttrs = std::array<wxd_CalendarDayAttr, 31>;
+
+// Day attributes by month for one control. wxCalendarCtrl keys its attributes by day number
+// only, so whenever another month comes up every day is set again, in one frozen pass, from the
+// month's stored attributes or else from the provider.
+class CalendarMonthAttrs {
+public:
+    explicit CalendarMonthAttrs(wxCalendarCtrl* ctrl) : m_ctrl(ctrl)
+    {
+        m_ctrl->Bind(wxEVT_CALENDAR_PAGE_CHANGED, &CalendarMonthAttrs::OnDateChanged, this);
+        m_ctrl->Bind(wxEVT_CALENDAR_SEL_CHANGED, &CalendarMonthAttrs::OnDateChanged, this);
+    }
+
+    ~CalendarMonthAttrs()
+    {
+        if (m_free_user_data)
+            m_free_user_data(m_user_data);
+    }
+
+    CalendarMonthAttrs(const CalendarMonthAttrs&) = delete;
+    CalendarMonthAttrs& operator=(const CalendarMonthAttrs&) = delete;
+
+    void
+    Store(int year, int month, const wxd_CalendarDayAttr* attrs)
+    {
+        if (attrs)
+            std::copy(attrs, attrs + 31, m_months[Key(year, month)].begin());
+        else
+            m_months.erase(Key(year, month));
+        if (Key(year, month) == m_shown)
+            Apply();
+    }
+
+    void
+    SetProvider(wxd_CalendarMonthAttrsCallback provider, void* user_data,
+                void (*free_user_data)(void*))
+    {
+        if (m_free_user_data)
+            m_free_user_data(m_user_data);
+        m_provider = provider;
+        m_user_data = user_data;
+        m_free_user_data = free_user_data;
+        Apply();
+    }
+
+    // Applies the shown month's attributes if the control moved to another month.
+    void
+    Sync()
+    {
+        if (ShownKey() != m_shown)
+            Apply();
+    }
+
+    void
+    Apply()
+    {
+        const wxDateTime date = m_ctrl->GetDate();
+        if (!date.IsValid())
+            return;
+        m_shown = ShownKey();
+        const int year = date.GetYear();
+        const int month = static_cast<int>(date.GetMonth()) + 1;
+
+        const wxd_CalendarDayAttr* attrs = nullptr;
+        MonthAttrs provided{};
+        auto stored = m_months.find(m_shown);
+        if (stored != m_months.end())
+            attrs = stored->second.data();
+        else if (m_provider && m_provider(m_user_data, year, month, provided.data()))
+            attrs = provided.data();
+
+        const unsigned short days = wxDateTime::GetNumberOfDays(date.GetMonth(), year);
+        const wxFont font = m_ctrl->GetFont();
+        wxWindowUpdateLocker freeze(m_ctrl);
+        for (unsigned short day = 1; day <= 31; ++day) {
+            if (attrs && day <= days && !is_default_attr(attrs[day - 1]))
+                m_ctrl->SetAttr(day, make_attr(attrs[day - 1], font));
+            else if (m_ctrl->GetAttr(day))
+                m_ctrl->ResetAttr(day);
+        }
+        m_ctrl->Refresh();
+    }
+
+private:
+    static int
+    Key(int year, int month)
+    {
+        return year * 12 + (month - 1);
+    }
+
+    int
+    ShownKey() const
+    {
+        const wxDateTime date = m_ctrl->GetDate();
+        return date.IsValid() ? Key(date.GetYear(), static_cast<int>(date.GetMonth()) + 1) : -1;
+    }
+
+    void
+    OnDateChanged(wxCalendarEvent& event)
+    {
+        event.Skip();
+        Sync();
+    }
+
+    wxCalendarCtrl* m_ctrl;
+    std::unordered_map<int, MonthAttrs> m_months;
+    wxd_CalendarMonthAttrsCallback m_provider = nullptr;
+    void* m_user_data = nullptr;
+    void (*m_free_user_data)(void*) = nullptr;
+    int m_shown = -1;
+};
+
+std::unordered_map<wxCalendarCtrl*, std::unique_ptr<CalendarMonthAttrs>>&
+month_attrs()
+{
+    static std::unordered_map<wxCalendarCtrl*, std::unique_ptr<CalendarMonthAttrs>> map;
+    return map;
+}
+
+void
+on_month_attrs_calendar_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    if (wxCalendarCtrl* ctrl = wxDynamicCast(event.GetEventObject(), wxCalendarCtrl))
+        month_attrs().erase(ctrl);
+}
+
+CalendarMonthAttrs*
+find_month_attrs(wxCalendarCtrl* ctrl)
+{
+    auto it = month_attrs().find(ctrl);
+    return it != month_attrs().end() ? it->second.get() : nullptr;
+}
+
+CalendarMonthAttrs&
+ensure_month_attrs(wxCalendarCtrl* ctrl)
+{
+    auto& map = month_attrs();
+    auto it = map.find(ctrl);
+    if (it == map.end()) {
+        ctrl->Bind(wxEVT_DESTROY, on_month_attrs_calendar_destroy);
+        it = map.emplace(ctrl, std::make_unique<CalendarMonthAttrs>(ctrl)).first;
+    }
+    return *it->second;
+}
+
+} // namespace
+
 extern "C" {
 
 WXD_EXPORTED wxd_CalendarCtrl_t*
@@ -54,7 +248,12 @@ wxd_CalendarCtrl_SetDate(wxd_CalendarCtrl_t* self, const wxd_DateTime_t* date)
     if (!self || !date)
         return false; // Ensure valid pointers
     wxCalendarCtrl* ctrl = (wxCalendarCtrl*)self;
-    return ctrl->SetDate(wxd_to_wx_datetime(date));
+    if (!ctrl->SetDate(wxd_to_wx_datetime(date)))
+        return false;
+    // Setting the date programmatically sends no event.
+    if (CalendarMonthAttrs* attrs = find_month_attrs(ctrl))
+        attrs->Sync();
+    return true;
 }
 
 WXD_EXPORTED wxd_DateTime_t*
@@ -73,6 +272,38 @@ wxd_CalendarCtrl_GetDate(wxd_CalendarCtrl_t* self)
     return reinterpret_cast<wxd_DateTime_t*>(new (std::nothrow) wxDateTime(dt));
 }
 
+WXD_EXPORTED bool
+wxd_CalendarCtrl_SetMonthAttrs(wxd_CalendarCtrl_t* self, int32_t year, int32_t month,
+                               const wxd_CalendarDayAttr* attrs)
+{
+    if (!self || month < 1 || month > 12)
+        return false;
+    wxCalendarCtrl* ctrl = (wxCalendarCtrl*)self;
+    ensure_month_attrs(ctrl).Store(year, month, attrs);
+    return true;
+}
+
+WXD_EXPORTED bool
+wxd_CalendarCtrl_SetMonthAttrsProvider(wxd_CalendarCtrl_t* self,
+                                       wxd_CalendarMonthAttrsCallback provider, void* user_data,
+                                       void (*free_user_data)(void*))
+{
+    if (!self)
+        return false;
+    wxCalendarCtrl* ctrl = (wxCalendarCtrl*)self;
+    ensure_month_attrs(ctrl).SetProvider(provider, user_data, free_user_data);
+    return true;
+}
+
+WXD_EXPORTED void
+wxd_CalendarCtrl_RefreshMonthAttrs(wxd_CalendarCtrl_t* self)
+{
+    if (!self)
+        return;
+    if (CalendarMonthAttrs* attrs = find_month_attrs((wxCalendarCtrl*)self))
+        attrs->Apply();
+}
+
 // Get the date from a calendar event
 WXD_EXPORTED wxd_DateTime_t*
 wxd_CalendarEvent_GetDate(wxd_Event_t* event)
@@ -0,0 +1,232 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include <wx/dcclient.h>
+#include <wx/dcmemory.h>
+#include <wx/region.h>
+#include <algorithm>
+#include <cstdlib>
+#include <utility>
+
+struct wxd_Canvas : public wxWindow {
+    wxd_Canvas(wxWindow* parent, wxWindowID id, const wxPoint& pos, const wxSize& size,
+               long style)
+        : wxWindow(parent, id, pos, size, style)
+    {
+        // Everything on screen comes from the backing store; no erase, no flicker.
+        SetBackgroundStyle(wxBG_STYLE_PAINT);
+        Bind(wxEVT_PAINT, &wxd_Canvas::OnPaint, this);
+        Bind(wxEVT_SIZE, &wxd_Canvas::OnSize, this);
+        Bind(wxEVT_DPI_CHANGED, &wxd_Canvas::OnDPIChanged, this);
+    }
+
+    ~wxd_Canvas()
+    {
+        if (m_free)
+            m_free(m_user_data);
+    }
+
+    void
+    SetRenderer(wxd_Canvas_RenderCallback render, void* user_data, wxd_Canvas_FreeUserData free)
+    {
+        if (m_free)
+            m_free(m_user_data);
+        m_render = render;
+        m_user_data = user_data;
+        m_free = free;
+        InvalidateAll();
+    }
+
+    void
+    Invalidate(const wxRect& rect)
+    {
+        const wxRect clipped = rect.Intersect(wxRect(GetClientSize()));
+        if (clipped.IsEmpty())
+            return;
+        m_dirty.Union(clipped);
+        RefreshRect(clipped, false);
+    }
+
+    void
+    InvalidateAll()
+    {
+        m_dirty = wxRegion(wxRect(GetClientSize()));
+        Refresh(false);
+    }
+
+    void
+    ScrollBuffer(int dx, int dy)
+    {
+        const wxSize size = GetClientSize();
+        if ((dx == 0 && dy == 0) || !EnsureBacking())
+            return;
+        if (std::abs(dx) >= size.x || std::abs(dy) >= size.y) {
+            InvalidateAll();
+            return;
+        }
+
+        // Copy through a second bitmap: overlapping blits within one DC are not portable.
+        if (!m_scratch.IsOk() || m_scratch.GetLogicalSize() != size ||
+            m_scratch.GetScaleFactor() != m_backing.GetScaleFactor()) {
+            m_scratch.CreateWithLogicalSize(size, m_backing.GetScaleFactor());
+        }
+        {
+            wxMemoryDC src(m_backing);
+            wxMemoryDC dst(m_scratch);
+            dst.Blit(dx, dy, size.x, size.y, &src, 0, 0);
+        }
+        std::swap(m_backing, m_scratch);
+
+        // Pending damage moves with the content; the uncovered strips become dirty.
+        m_dirty.Offset(dx, dy);
+        m_dirty.Intersect(wxRect(size));
+        if (dx > 0)
+            m_dirty.Union(wxRect(0, 0, dx, size.y));
+        else if (dx < 0)
+            m_dirty.Union(wxRect(size.x + dx, 0, -dx, size.y));
+        if (dy > 0)
+            m_dirty.Union(wxRect(0, 0, size.x, dy));
+        else if (dy < 0)
+            m_dirty.Union(wxRect(0, size.y + dy, size.x, -dy));
+        Refresh(false);
+    }
+
+private:
+    // Allocates the backing store for the current client size and DPI. Existing content is
+    // kept where it still fits; newly exposed areas are marked dirty.
+    bool
+    EnsureBacking()
+    {
+        const wxSize size = GetClientSize();
+        if (size.x <= 0 || size.y <= 0)
+            return false;
+        const double scale = GetContentScaleFactor();
+        if (m_backing.IsOk() && m_backing.GetLogicalSize() == size &&
+            m_backing.GetScaleFactor() == scale) {
+            return true;
+        }
+
+        wxBitmap resized;
+        if (!resized.CreateWithLogicalSize(size, scale))
+            return false;
+        if (m_backing.IsOk() && m_backing.GetScaleFactor() == scale) {
+            wxMemoryDC src(m_backing);
+            wxMemoryDC dst(resized);
+            const wxSize old = m_backing.GetLogicalSize();
+            dst.Blit(0, 0, std::min(old.x, size.x), std::min(old.y, size.y), &src, 0, 0);
+            m_dirty.Intersect(wxRect(size));
+            if (size.x > old.x)
+                m_dirty.Union(wxRect(old.x, 0, size.x - old.x, size.y));
+            if (size.y > old.y)
+                m_dirty.Union(wxRect(0, old.y, size.x, size.y - old.y));
+        }
+        else {
+            m_dirty = wxRegion(wxRect(size));
+        }
+        m_backing = resized;
+        m_scratch = wxBitmap();
+        return true;
+    }
+
+    void
+    Render()
+    {
+        wxMemoryDC dc(m_backing);
+        dc.SetDeviceClippingRegion(m_dirty);
+        dc.SetPen(*wxTRANSPARENT_PEN);
+        dc.SetBrush(wxBrush(GetBackgroundColour()));
+        for (wxRegionIterator it(m_dirty); it; ++it) {
+            dc.DrawRectangle(it.GetRect());
+        }
+        dc.SetBrush(wxNullBrush);
+        dc.SetPen(wxNullPen);
+
+        const wxRect box = m_dirty.GetBox();
+        // Cleared first so invalidations made by the renderer itself schedule another pass.
+        m_dirty.Clear();
+        if (m_render)
+            m_render(m_user_data, reinterpret_cast<wxd_DC_t*>(static_cast<wxDC*>(&dc)),
+                     wxd_Rect{ box.x, box.y, box.width, box.height });
+    }
+
+    void
+    OnPaint(wxPaintEvent&)
+    {
+        wxPaintDC paint(this);
+        if (!EnsureBacking())
+            return;
+        if (!m_dirty.IsEmpty())
+            Render();
+
+        wxMemoryDC backing(m_backing);
+        for (wxRegionIterator it(GetUpdateRegion()); it; ++it) {
+            const wxRect rect = it.GetRect();
+            paint.Blit(rect.x, rect.y, rect.width, rect.height, &backing, rect.x, rect.y);
+        }
+    }
+
+    void
+    OnSize(wxSizeEvent& event)
+    {
+        EnsureBacking();
+        event.Skip();
+    }
+
+    void
+    OnDPIChanged(wxDPIChangedEvent& event)
+    {
+        InvalidateAll();
+        event.Skip();
+    }
+
+    wxBitmap m_backing;
+    wxBitmap m_scratch;
+    wxRegion m_dirty;
+    wxd_Canvas_RenderCallback m_render = nullptr;
+    void* m_user_data = nullptr;
+    wxd_Canvas_FreeUserData m_free = nullptr;
+};
+
+WXD_EXPORTED wxd_Canvas_t*
+wxd_Canvas_Create(wxd_Window_t* parent, int id, int x, int y, int w, int h, int64_t style)
+{
+    wxWindow* p = reinterpret_cast<wxWindow*>(parent);
+    if (!p)
+        return nullptr;
+    wxPoint pos = (x == -1 && y == -1) ? wxDefaultPosition : wxPoint(x, y);
+    wxSize size = (w == -1 && h == -1) ? wxDefaultSize : wxSize(w, h);
+    return new wxd_Canvas(p, id, pos, size, static_cast<long>(style));
+}
+
+WXD_EXPORTED void
+wxd_Canvas_SetRenderer(wxd_Canvas_t* self, wxd_Canvas_RenderCallback render, void* user_data,
+                       wxd_Canvas_FreeUserData free_user_data)
+{
+    if (!self) {
+        if (free_user_data)
+            free_user_data(user_data);
+        return;
+    }
+    self->SetRenderer(render, user_data, free_user_data);
+}
+
+WXD_EXPORTED void
+wxd_Canvas_Invalidate(wxd_Canvas_t* self, wxd_Rect rect)
+{
+    if (self)
+        self->Invalidate(wxRect(rect.x, rect.y, rect.width, rect.height));
+}
+
+WXD_EXPORTED void
+wxd_Canvas_InvalidateAll(wxd_Canvas_t* self)
+{
+    if (self)
+        self->InvalidateAll();
+}
+
+WXD_EXPORTED void
+wxd_Canvas_ScrollBuffer(wxd_Canvas_t* self, int dx, int dy)
+{
+    if (self)
+        self->ScrollBuffer(dx, dy);
+}
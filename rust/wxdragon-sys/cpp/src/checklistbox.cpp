@@ -5,6 +5,7 @@
 #include <wx/window.h>
 #include <wx/defs.h>   // For wxID_ANY, wxNOT_FOUND, wxDefaultPosition, wxDefaultSize
 #include "wxd_utils.h" // For wxd_cpp_utils::copy_wxstring_to_buffer
+#include <wx/wupdlock.h>
 
 // Helper function (already defined in event.cpp, consider moving to a common utils file later)
 // REMOVED: static int copy_wxstring_to_buffer(...) - Now using wxd_cpp_utils version
@@ -48,6 +49,34 @@ wxd_CheckListBox_Insert(wxd_CheckListBox_t* clbox, const char* item, unsigned in
     }
 }
 
+WXD_EXPORTED bool
+wxd_CheckListBox_SetItems(wxd_CheckListBox_t* clbox, const char* packed, const uint32_t* offsets,
+                          size_t count)
+{
+    wxCheckListBox* lb = (wxCheckListBox*)clbox;
+    wxArrayString items;
+    if (!lb || !wxd_cpp_utils::unpack_utf8_array(packed, offsets, count, items))
+        return false;
+    wxWindowUpdateLocker freeze(lb);
+    lb->Set(items);
+    return true;
+}
+
+WXD_EXPORTED bool
+wxd_CheckListBox_AppendItems(wxd_CheckListBox_t* clbox, const char* packed, const uint32_t* offsets,
+                             size_t count)
+{
+    wxCheckListBox* lb = (wxCheckListBox*)clbox;
+    wxArrayString items;
+    if (!lb || !wxd_cpp_utils::unpack_utf8_array(packed, offsets, count, items))
+        return false;
+    if (items.empty())
+        return true;
+    wxWindowUpdateLocker freeze(lb);
+    lb->Append(items);
+    return true;
+}
+
 WXD_EXPORTED void
 wxd_CheckListBox_Clear(wxd_CheckListBox_t* clbox)
 {
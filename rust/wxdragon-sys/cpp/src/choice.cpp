@@ -7,6 +7,7 @@
 #include "wx/defs.h" // For wxNOT_FOUND
 #include "../include/wxdragon.h"
 #include "wxd_utils.h"
+#include <wx/wupdlock.h>
 
 extern "C" {
 
@@ -17,8 +18,8 @@ wxd_Choice_Create(wxd_Window_t* parent, wxd_Id id, wxd_Point pos, wxd_Size size,
     if (!parentWin)
         return nullptr;
 
-    wxChoice* choice = new wxChoice(parentWin, id, wxd_cpp_utils::to_wx(pos),
-                                    wxd_cpp_utils::to_wx(size), 0, nullptr, style);
+    wxChoice* choice = new wxChoice(parentWin, id, wxd_cpp_utils::to_wx(pos, parentWin),
+                                    wxd_cpp_utils::to_wx(size, parentWin), 0, nullptr, style);
     return (wxd_Choice_t*)choice;
 }
 
@@ -40,6 +41,34 @@ wxd_Choice_Insert(wxd_Choice_t* self, const char* item, unsigned int pos)
     }
 }
 
+WXD_EXPORTED bool
+wxd_Choice_SetItems(wxd_Choice_t* choice, const char* packed, const uint32_t* offsets,
+                    size_t count)
+{
+    wxChoice* ch = (wxChoice*)choice;
+    wxArrayString items;
+    if (!ch || !wxd_cpp_utils::unpack_utf8_array(packed, offsets, count, items))
+        return false;
+    wxWindowUpdateLocker freeze(ch);
+    ch->Set(items);
+    return true;
+}
+
+WXD_EXPORTED bool
+wxd_Choice_AppendItems(wxd_Choice_t* choice, const char* packed, const uint32_t* offsets,
+                       size_t count)
+{
+    wxChoice* ch = (wxChoice*)choice;
+    wxArrayString items;
+    if (!ch || !wxd_cpp_utils::unpack_utf8_array(packed, offsets, count, items))
+        return false;
+    if (items.empty())
+        return true;
+    wxWindowUpdateLocker freeze(ch);
+    ch->Append(items);
+    return true;
+}
+
 WXD_EXPORTED void
 wxd_Choice_Clear(wxd_Choice_t* choice)
 {
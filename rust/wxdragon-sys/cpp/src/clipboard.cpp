@@ -3,6 +3,267 @@
 #include "../include/wxdragon.h"
 #include <wx/clipbrd.h>
 #include <wx/dataobj.h>
+#include <wx/filename.h>
+#include <wx/imagpng.h>
+#include <wx/mstream.h>
+#include <wx/tokenzr.h>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+#ifdef __WXGTK__
+#include <dlfcn.h>
+#endif
+
+// --- Background clipboard reads ---
+//
+// wxClipboard::GetData() waits for the clipboard owner to hand over the data,
+// which a slow X11/Wayland owner can stretch to seconds. On GTK the request is
+// made with gtk_clipboard_request_contents() instead, whose reply arrives from
+// the main loop while events keep flowing; GTK is resolved at run time from the
+// already-loaded toolkit, so no extra headers or link flags are needed. Other
+// backends read synchronously on the next event loop pass. Either way the data
+// reaches the callback as one owned buffer, in a per-format canonical encoding.
+
+namespace {
+
+struct ClipboardRequest {
+    std::vector<std::pair<wxd_ClipboardFormat, std::string>> formats;
+    size_t next = 0;
+    bool primary = false;
+    wxd_Clipboard_ReadCallback callback = nullptr;
+    void* user_data = nullptr;
+    wxd_Clipboard_FreeUserData free_user_data = nullptr;
+
+    ~ClipboardRequest() {
+        if (user_data && free_user_data)
+            free_user_data(user_data);
+    }
+};
+
+wxCharBuffer
+to_buffer(const std::string& bytes)
+{
+    wxCharBuffer buffer(bytes.size());
+    if (!bytes.empty())
+        std::memcpy(buffer.data(), bytes.data(), bytes.size());
+    return buffer;
+}
+
+// Hands the result over on a later pass, so the callback never runs inside
+// RequestAsync() or a toolkit callback. format_index is -1 when nothing matched.
+void
+finish_request(ClipboardRequest* request, int format_index, const std::string& bytes)
+{
+    wxCharBuffer buffer = to_buffer(bytes);
+    wxTheApp->CallAfter([request, format_index, buffer]() {
+        request->callback(request->user_data, format_index,
+                          format_index < 0 ? nullptr : wxd_cpp_utils::make_owned_string(buffer));
+        delete request;
+    });
+}
+
+std::string
+utf8_of(const wxString& text)
+{
+    return text.utf8_string();
+}
+
+// text/uri-list to newline-separated local paths.
+std::string
+paths_from_uri_list(const std::string& list)
+{
+    std::string out;
+    wxStringTokenizer lines(wxString::FromUTF8(list), "\r\n", wxTOKEN_STRTOK);
+    while (lines.HasMoreTokens()) {
+        const wxString line = lines.GetNextToken();
+        if (line.StartsWith("#"))
+            continue;
+        if (!out.empty())
+            out += '\n';
+        out += utf8_of(wxFileName::URLToFileName(line).GetFullPath());
+    }
+    return out;
+}
+
+// Synchronous read of one format through wxClipboard (opened by the caller).
+bool
+read_format(wxClipboard* clipboard, wxd_ClipboardFormat format, const std::string& id,
+            std::string& out)
+{
+    switch (format) {
+    case WXD_CLIPBOARD_FORMAT_TEXT: {
+        wxTextDataObject data;
+        if (!clipboard->IsSupported(data.GetFormat()) || !clipboard->GetData(data))
+            return false;
+        out = utf8_of(data.GetText());
+        return true;
+    }
+    case WXD_CLIPBOARD_FORMAT_HTML: {
+        wxHTMLDataObject data;
+        if (!clipboard->IsSupported(data.GetFormat()) || !clipboard->GetData(data))
+            return false;
+        out = utf8_of(data.GetHTML());
+        return true;
+    }
+    case WXD_CLIPBOARD_FORMAT_PNG: {
+        wxBitmapDataObject data;
+        if (!clipboard->IsSupported(wxDF_BITMAP) || !clipboard->GetData(data))
+            return false;
+        if (!wxImage::FindHandler(wxBITMAP_TYPE_PNG))
+            wxImage::AddHandler(new wxPNGHandler);
+        wxMemoryOutputStream stream;
+        if (!data.GetBitmap().ConvertToImage().SaveFile(stream, wxBITMAP_TYPE_PNG))
+            return false;
+        out.resize(stream.GetLength());
+        stream.CopyTo(&out[0], out.size());
+        return true;
+    }
+    case WXD_CLIPBOARD_FORMAT_FILES: {
+        wxFileDataObject data;
+        if (!clipboard->IsSupported(wxDF_FILENAME) || !clipboard->GetData(data))
+            return false;
+        for (const wxString& file : data.GetFilenames()) {
+            if (!out.empty())
+                out += '\n';
+            out += utf8_of(file);
+        }
+        return true;
+    }
+    case WXD_CLIPBOARD_FORMAT_CUSTOM: {
+        wxCustomDataObject data(wxDataFormat(wxString::FromUTF8(id)));
+        if (id.empty() || !clipboard->IsSupported(data.GetFormat()) || !clipboard->GetData(data))
+            return false;
+        out.assign(static_cast<const char*>(data.GetData()), data.GetSize());
+        return true;
+    }
+    }
+    return false;
+}
+
+void
+read_synchronously(ClipboardRequest* request)
+{
+    wxClipboard* clipboard = wxClipboard::Get();
+    const bool was_primary = clipboard->IsUsingPrimarySelection();
+    clipboard->UsePrimarySelection(request->primary);
+    std::string bytes;
+    int found = -1;
+    if (clipboard->Open()) {
+        for (size_t i = 0; i < request->formats.size() && found < 0; ++i) {
+            if (read_format(clipboard, request->formats[i].first, request->formats[i].second,
+                            bytes))
+                found = static_cast<int>(i);
+        }
+        clipboard->Close();
+    }
+    clipboard->UsePrimarySelection(was_primary);
+    finish_request(request, found, bytes);
+}
+
+#ifdef __WXGTK__
+// The few GTK/GDK entry points used, with opaque pointer types.
+struct GtkApi {
+    typedef void (*ReceivedFunc)(void* clipboard, void* selection_data, void* data);
+    void* (*atom_intern)(const char* name, int only_if_exists) = nullptr;
+    void* (*clipboard_get)(void* selection) = nullptr;
+    void (*request_contents)(void* clipboard, void* target, ReceivedFunc callback,
+                             void* data) = nullptr;
+    const unsigned char* (*selection_get_data)(const void* selection_data) = nullptr;
+    int (*selection_get_length)(const void* selection_data) = nullptr;
+
+    bool Ok() const {
+        return atom_intern && clipboard_get && request_contents && selection_get_data &&
+               selection_get_length;
+    }
+
+    static const GtkApi& Get() {
+        static const GtkApi api = [] {
+            GtkApi a;
+            a.atom_intern = reinterpret_cast<decltype(a.atom_intern)>(
+                dlsym(RTLD_DEFAULT, "gdk_atom_intern"));
+            a.clipboard_get = reinterpret_cast<decltype(a.clipboard_get)>(
+                dlsym(RTLD_DEFAULT, "gtk_clipboard_get"));
+            a.request_contents = reinterpret_cast<decltype(a.request_contents)>(
+                dlsym(RTLD_DEFAULT, "gtk_clipboard_request_contents"));
+            a.selection_get_data = reinterpret_cast<decltype(a.selection_get_data)>(
+                dlsym(RTLD_DEFAULT, "gtk_selection_data_get_data"));
+            a.selection_get_length = reinterpret_cast<decltype(a.selection_get_length)>(
+                dlsym(RTLD_DEFAULT, "gtk_selection_data_get_length"));
+            return a;
+        }();
+        return api;
+    }
+};
+
+const char*
+gtk_target(wxd_ClipboardFormat format, const std::string& id)
+{
+    switch (format) {
+    case WXD_CLIPBOARD_FORMAT_TEXT:
+        return "UTF8_STRING";
+    case WXD_CLIPBOARD_FORMAT_HTML:
+        return "text/html";
+    case WXD_CLIPBOARD_FORMAT_PNG:
+        return "image/png";
+    case WXD_CLIPBOARD_FORMAT_FILES:
+        return "text/uri-list";
+    case WXD_CLIPBOARD_FORMAT_CUSTOM:
+        return id.empty() ? nullptr : id.c_str();
+    }
+    return nullptr;
+}
+
+void request_next_gtk(ClipboardRequest* request);
+
+void
+on_gtk_contents(void*, void* selection_data, void* data)
+{
+    ClipboardRequest* request = static_cast<ClipboardRequest*>(data);
+    const GtkApi& gtk = GtkApi::Get();
+    const int length = selection_data ? gtk.selection_get_length(selection_data) : -1;
+    const unsigned char* bytes = length >= 0 ? gtk.selection_get_data(selection_data) : nullptr;
+    if (!bytes) {
+        request_next_gtk(request);
+        return;
+    }
+    const size_t index = request->next - 1;
+    std::string out(reinterpret_cast<const char*>(bytes), static_cast<size_t>(length));
+    switch (request->formats[index].first) {
+    case WXD_CLIPBOARD_FORMAT_HTML:
+        // Some browsers offer text/html as UTF-16 with a byte order mark.
+        if (out.size() >= 2 && static_cast<unsigned char>(out[0]) == 0xff &&
+            static_cast<unsigned char>(out[1]) == 0xfe)
+            out = utf8_of(wxString(out.data() + 2, wxMBConvUTF16LE(), out.size() - 2));
+        break;
+    case WXD_CLIPBOARD_FORMAT_FILES:
+        out = paths_from_uri_list(out);
+        break;
+    default:
+        break;
+    }
+    finish_request(request, static_cast<int>(index), out);
+}
+
+void
+request_next_gtk(ClipboardRequest* request)
+{
+    const GtkApi& gtk = GtkApi::Get();
+    while (request->next < request->formats.size()) {
+        const auto& format = request->formats[request->next++];
+        const char* target = gtk_target(format.first, format.second);
+        if (!target)
+            continue;
+        void* clipboard = gtk.clipboard_get(
+            gtk.atom_intern(request->primary ? "PRIMARY" : "CLIPBOARD", 0));
+        gtk.request_contents(clipboard, gtk.atom_intern(target, 0), on_gtk_contents, request);
+        return;
+    }
+    finish_request(request, -1, std::string());
+}
+#endif
+
+} // namespace
 
 extern "C" {
 
@@ -167,4 +428,34 @@ wxd_Clipboard_GetText(const wxd_Clipboard_t* clipboard, char* buffer, size_t buf
     return len;
 }
 
-} // extern "C"
\ No newline at end of file
+WXD_EXPORTED bool
+wxd_Clipboard_RequestAsync(wxd_Clipboard_t* clipboard, const wxd_ClipboardFormat* formats,
+                           const char* const* custom_ids, size_t format_count,
+                           wxd_Clipboard_ReadCallback callback, void* user_data,
+                           wxd_Clipboard_FreeUserData free_user_data)
+{
+    ClipboardRequest* request = new ClipboardRequest;
+    request->user_data = user_data;
+    request->free_user_data = free_user_data;
+    if (!clipboard || !formats || !format_count || !callback || !wxTheApp) {
+        delete request;
+        return false;
+    }
+    request->callback = callback;
+    for (size_t i = 0; i < format_count; ++i) {
+        const char* id = custom_ids && custom_ids[i] ? custom_ids[i] : "";
+        request->formats.emplace_back(formats[i], id);
+    }
+    request->primary = reinterpret_cast<wxClipboard*>(clipboard)->IsUsingPrimarySelection();
+
+#ifdef __WXGTK__
+    if (GtkApi::Get().Ok()) {
+        request_next_gtk(request);
+        return true;
+    }
+#endif
+    wxTheApp->CallAfter([request]() { read_synchronously(request); });
+    return true;
+}
+
+} // extern "C"
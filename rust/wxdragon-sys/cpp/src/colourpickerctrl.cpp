@@ -37,8 +37,8 @@ wxd_ColourPickerCtrl_Create(wxd_Window_t* parent, wxd_Id id, wxd_Colour_t initia
     // Let's assume parent is valid as per typical wx usage.
 
     wxColourPickerCtrl* ctrl = new wxColourPickerCtrl(parentWin, id, to_wx(initial_colour),
-                                                      wxd_cpp_utils::to_wx(pos),
-                                                      wxd_cpp_utils::to_wx(size), style);
+                                                      wxd_cpp_utils::to_wx(pos, parentWin),
+                                                      wxd_cpp_utils::to_wx(size, parentWin), style);
     return (wxd_ColourPickerCtrl_t*)ctrl;
 }
 
@@ -7,6 +7,7 @@
 #include "wx/defs.h" // For wxNOT_FOUND
 #include "../include/wxdragon.h"
 #include "wxd_utils.h"
+#include <wx/wupdlock.h>
 
 extern "C" {
 
@@ -20,8 +21,8 @@ wxd_ComboBox_Create(wxd_Window_t* parent, wxd_Id id,
         return nullptr;
 
     wxString wxValue = wxString::FromUTF8(value ? value : "");
-    wxComboBox* combo = new wxComboBox(parentWin, id, wxValue, wxd_cpp_utils::to_wx(pos),
-                                       wxd_cpp_utils::to_wx(size), 0, nullptr, style);
+    wxComboBox* combo = new wxComboBox(parentWin, id, wxValue, wxd_cpp_utils::to_wx(pos, parentWin),
+                                       wxd_cpp_utils::to_wx(size, parentWin), 0, nullptr, style);
     return (wxd_ComboBox_t*)combo;
 }
 
@@ -43,6 +44,34 @@ wxd_ComboBox_Insert(wxd_ComboBox_t* combo, const char* item, unsigned int pos)
     }
 }
 
+WXD_EXPORTED bool
+wxd_ComboBox_SetItems(wxd_ComboBox_t* combo, const char* packed, const uint32_t* offsets,
+                      size_t count)
+{
+    wxComboBox* cb = (wxComboBox*)combo;
+    wxArrayString items;
+    if (!cb || !wxd_cpp_utils::unpack_utf8_array(packed, offsets, count, items))
+        return false;
+    wxWindowUpdateLocker freeze(cb);
+    cb->Set(items);
+    return true;
+}
+
+WXD_EXPORTED bool
+wxd_ComboBox_AppendItems(wxd_ComboBox_t* combo, const char* packed, const uint32_t* offsets,
+                         size_t count)
+{
+    wxComboBox* cb = (wxComboBox*)combo;
+    wxArrayString items;
+    if (!cb || !wxd_cpp_utils::unpack_utf8_array(packed, offsets, count, items))
+        return false;
+    if (items.empty())
+        return true;
+    wxWindowUpdateLocker freeze(cb);
+    cb->Append(items);
+    return true;
+}
+
 WXD_EXPORTED void
 wxd_ComboBox_Clear(wxd_ComboBox_t* combo)
 {
@@ -0,0 +1,307 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include <wx/combobox.h>
+#include <wx/srchctrl.h>
+#include <wx/textcompleter.h>
+#include "../include/wxdragon.h"
+#include "wxd_utils.h"
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr uint32_t kDefaultMaxResults = 100;
+
+struct Entry {
+    std::string key; // UTF-8, lower-cased unless the index is case-sensitive
+    wxString text;
+
+    bool
+    operator<(const Entry& other) const
+    {
+        if (key != other.key)
+            return key < other.key;
+        return text < other.text;
+    }
+    bool
+    operator==(const Entry& other) const
+    {
+        return key == other.key && text == other.text;
+    }
+};
+
+// Entries sorted by folded key, so the matches for a prefix are one contiguous run found by a
+// binary search. Locked because some ports query completers from a worker thread.
+class CompletionIndex {
+public:
+    CompletionIndex(bool case_sensitive, uint32_t max_results)
+        : m_caseSensitive(case_sensitive), m_maxResults(max_results ? max_results : kDefaultMaxResults)
+    {
+    }
+
+    void
+    Set(std::vector<Entry> entries)
+    {
+        Normalize(entries);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.swap(entries);
+    }
+
+    void
+    Add(std::vector<Entry> entries)
+    {
+        Normalize(entries);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::vector<Entry> merged;
+        merged.reserve(m_entries.size() + entries.size());
+        std::set_union(std::make_move_iterator(m_entries.begin()),
+                       std::make_move_iterator(m_entries.end()),
+                       std::make_move_iterator(entries.begin()),
+                       std::make_move_iterator(entries.end()), std::back_inserter(merged));
+        m_entries.swap(merged);
+    }
+
+    void
+    Remove(std::vector<Entry> entries)
+    {
+        Normalize(entries);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(),
+                                       [&entries](const Entry& e) {
+                                           return std::binary_search(entries.begin(),
+                                                                     entries.end(), e);
+                                       }),
+                        m_entries.end());
+    }
+
+    void
+    Clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.clear();
+    }
+
+    size_t
+    Count() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_entries.size();
+    }
+
+    void
+    SetMaxResults(uint32_t max_results)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_maxResults = max_results ? max_results : kDefaultMaxResults;
+    }
+
+    void
+    Query(const wxString& prefix, wxArrayString& out) const
+    {
+        out.clear();
+        const std::string key = Fold(prefix);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = std::lower_bound(m_entries.begin(), m_entries.end(), key,
+                                   [](const Entry& e, const std::string& k) { return e.key < k; });
+        for (; it != m_entries.end() && out.size() < m_maxResults; ++it) {
+            if (it->key.compare(0, key.size(), key) != 0)
+                break;
+            out.push_back(it->text);
+        }
+    }
+
+    Entry
+    MakeEntry(const char* utf8, size_t len) const
+    {
+        Entry entry;
+        entry.text = wxString::FromUTF8(utf8, len);
+        entry.key = Fold(entry.text);
+        return entry;
+    }
+
+private:
+    std::string
+    Fold(const wxString& text) const
+    {
+        return (m_caseSensitive ? text : text.Lower()).utf8_string();
+    }
+
+    static void
+    Normalize(std::vector<Entry>& entries)
+    {
+        std::sort(entries.begin(), entries.end());
+        entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+    }
+
+    const bool m_caseSensitive;
+    uint32_t m_maxResults;
+    mutable std::mutex m_mutex;
+    std::vector<Entry> m_entries;
+};
+
+// Owned by the text entry; shares the index with Rust and other controls.
+class IndexCompleter : public wxTextCompleter {
+public:
+    explicit IndexCompleter(std::shared_ptr<CompletionIndex> index) : m_index(std::move(index)) {}
+
+    bool
+    Start(const wxString& prefix) override
+    {
+        m_index->Query(prefix, m_matches);
+        m_next = 0;
+        return !m_matches.empty();
+    }
+
+    wxString
+    GetNext() override
+    {
+        return m_next < m_matches.size() ? m_matches[m_next++] : wxString();
+    }
+
+private:
+    std::shared_ptr<CompletionIndex> m_index;
+    wxArrayString m_matches;
+    size_t m_next = 0;
+};
+
+bool
+ParseEntries(const CompletionIndex& index, const char* packed, const uint32_t* offsets,
+             size_t count, std::vector<Entry>& out)
+{
+    if (count == 0)
+        return true;
+    if (!packed || !offsets)
+        return false;
+    out.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        if (offsets[i + 1] < offsets[i])
+            return false;
+        out.push_back(index.MakeEntry(packed + offsets[i], offsets[i + 1] - offsets[i]));
+    }
+    return true;
+}
+
+} // namespace
+
+struct wxd_CompletionIndex_t {
+    std::shared_ptr<CompletionIndex> index;
+};
+
+namespace {
+
+// wxTextEntry takes ownership of the completer; the index outlives it through the shared_ptr.
+bool
+Attach(wxTextEntry* entry, wxd_CompletionIndex_t* index)
+{
+    if (!entry)
+        return false;
+    if (!index)
+        return entry->AutoComplete(static_cast<wxTextCompleter*>(nullptr));
+    return entry->AutoComplete(new IndexCompleter(index->index));
+}
+
+} // namespace
+
+extern "C" {
+
+WXD_EXPORTED wxd_CompletionIndex_t*
+wxd_CompletionIndex_Create(bool case_sensitive, uint32_t max_results)
+{
+    return new wxd_CompletionIndex_t{ std::make_shared<CompletionIndex>(case_sensitive,
+                                                                        max_results) };
+}
+
+WXD_EXPORTED void
+wxd_CompletionIndex_Destroy(wxd_CompletionIndex_t* index)
+{
+    delete index;
+}
+
+WXD_EXPORTED bool
+wxd_CompletionIndex_SetEntries(wxd_CompletionIndex_t* index, const char* packed,
+                               const uint32_t* offsets, size_t count)
+{
+    std::vector<Entry> entries;
+    if (!index || !ParseEntries(*index->index, packed, offsets, count, entries))
+        return false;
+    index->index->Set(std::move(entries));
+    return true;
+}
+
+WXD_EXPORTED bool
+wxd_CompletionIndex_AddEntries(wxd_CompletionIndex_t* index, const char* packed,
+                               const uint32_t* offsets, size_t count)
+{
+    std::vector<Entry> entries;
+    if (!index || !ParseEntries(*index->index, packed, offsets, count, entries))
+        return false;
+    if (!entries.empty())
+        index->index->Add(std::move(entries));
+    return true;
+}
+
+WXD_EXPORTED bool
+wxd_CompletionIndex_RemoveEntries(wxd_CompletionIndex_t* index, const char* packed,
+                                  const uint32_t* offsets, size_t count)
+{
+    std::vector<Entry> entries;
+    if (!index || !ParseEntries(*index->index, packed, offsets, count, entries))
+        return false;
+    if (!entries.empty())
+        index->index->Remove(std::move(entries));
+    return true;
+}
+
+WXD_EXPORTED void
+wxd_CompletionIndex_Clear(wxd_CompletionIndex_t* index)
+{
+    if (index)
+        index->index->Clear();
+}
+
+WXD_EXPORTED size_t
+wxd_CompletionIndex_GetCount(const wxd_CompletionIndex_t* index)
+{
+    return index ? index->index->Count() : 0;
+}
+
+WXD_EXPORTED void
+wxd_CompletionIndex_SetMaxResults(wxd_CompletionIndex_t* index, uint32_t max_results)
+{
+    if (index)
+        index->index->SetMaxResults(max_results);
+}
+
+WXD_EXPORTED size_t
+wxd_CompletionIndex_Query(const wxd_CompletionIndex_t* index, const char* prefix,
+                          wxd_ArrayString_t* out)
+{
+    if (!index || !out)
+        return 0;
+    wxArrayString* matches = reinterpret_cast<wxArrayString*>(out);
+    index->index->Query(wxString::FromUTF8(prefix ? prefix : ""), *matches);
+    return matches->size();
+}
+
+WXD_EXPORTED bool
+wxd_TextCtrl_SetCompletionIndex(wxd_TextCtrl_t* ctrl, wxd_CompletionIndex_t* index)
+{
+    return Attach(reinterpret_cast<wxTextCtrl*>(ctrl), index);
+}
+
+WXD_EXPORTED bool
+wxd_ComboBox_SetCompletionIndex(wxd_ComboBox_t* ctrl, wxd_CompletionIndex_t* index)
+{
+    return Attach(reinterpret_cast<wxComboBox*>(ctrl), index);
+}
+
+WXD_EXPORTED bool
+wxd_SearchCtrl_SetCompletionIndex(wxd_SearchCtrl_t* ctrl, wxd_CompletionIndex_t* index)
+{
+    return Attach(reinterpret_cast<wxSearchCtrl*>(ctrl), index);
+}
+
+} // extern "C"
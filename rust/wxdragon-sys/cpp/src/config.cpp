@@ -3,6 +3,273 @@
 #include "../include/wxdragon.h"
 #include <wx/config.h>
 #include <wx/fileconf.h>
+#include <wx/timer.h>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// --- Write-behind ---
+
+constexpr int kDefaultWriteBehindDelayMs = 1000;
+// A steady stream of writes postpones the flush by at most this many delays.
+constexpr int kMaxWriteBehindDeferrals = 5;
+
+class WriteBehindTimer : public wxTimer {
+public:
+    explicit WriteBehindTimer(wxConfigBase* config) : m_config(config) {}
+
+    void
+    Notify() override
+    {
+        m_config->Flush();
+    }
+
+private:
+    wxConfigBase* m_config;
+};
+
+struct WriteBehind {
+    int delay_ms = kDefaultWriteBehindDelayMs;
+    wxLongLong first_pending = 0;
+    // Created on first use so configs made before the app exists never own a timer.
+    std::unique_ptr<WriteBehindTimer> timer;
+};
+
+std::unordered_map<wxConfigBase*, WriteBehind> s_write_behind;
+
+WriteBehind*
+find_write_behind(wxConfigBase* cfg)
+{
+    auto it = s_write_behind.find(cfg);
+    return it == s_write_behind.end() ? nullptr : &it->second;
+}
+
+// Restarts the debounce timer after a change; returns false if cfg writes through.
+bool
+schedule_flush(wxConfigBase* cfg)
+{
+    WriteBehind* state = find_write_behind(cfg);
+    if (!state)
+        return false;
+    if (!state->timer)
+        state->timer = std::make_unique<WriteBehindTimer>(cfg);
+    const wxLongLong now = wxGetLocalTimeMillis();
+    if (!state->timer->IsRunning())
+        state->first_pending = now;
+    else if (now - state->first_pending >= state->delay_ms * kMaxWriteBehindDeferrals)
+        return true;
+    state->timer->StartOnce(state->delay_ms);
+    return true;
+}
+
+bool
+flush_pending(wxConfigBase* cfg, WriteBehind& state)
+{
+    if (!state.timer || !state.timer->IsRunning())
+        return true;
+    state.timer->Stop();
+    return cfg->Flush();
+}
+
+// Marks a successful mutation; passes the result through for tail calls.
+bool
+note_change(wxConfigBase* cfg, bool changed)
+{
+    if (changed)
+        schedule_flush(cfg);
+    return changed;
+}
+
+// Group snapshots and write batches share the layout documented in wxd_config.h.
+
+void
+put_u32(std::string& out, uint32_t value)
+{
+    for (int i = 0; i < 4; ++i)
+        out += static_cast<char>((value >> (8 * i)) & 0xff);
+}
+
+void
+put_u64(std::string& out, uint64_t value)
+{
+    for (int i = 0; i < 8; ++i)
+        out += static_cast<char>((value >> (8 * i)) & 0xff);
+}
+
+void
+put_text(std::string& out, const wxString& text)
+{
+    const wxScopedCharBuffer utf8 = text.utf8_str();
+    put_u32(out, static_cast<uint32_t>(utf8.length()));
+    out.append(utf8.data(), utf8.length());
+}
+
+void
+put_entry(std::string& out, const wxConfigBase* cfg, const wxString& name, const wxString& key)
+{
+    put_text(out, key);
+    switch (cfg->GetEntryType(name)) {
+    case wxConfigBase::Type_Boolean: {
+        bool value = false;
+        cfg->Read(name, &value);
+        out += static_cast<char>(WXD_CONFIG_TYPE_BOOLEAN);
+        out += static_cast<char>(value ? 1 : 0);
+        break;
+    }
+    case wxConfigBase::Type_Integer: {
+        long value = 0;
+        cfg->Read(name, &value);
+        out += static_cast<char>(WXD_CONFIG_TYPE_INTEGER);
+        put_u64(out, static_cast<uint64_t>(static_cast<int64_t>(value)));
+        break;
+    }
+    case wxConfigBase::Type_Float: {
+        double value = 0.0;
+        cfg->Read(name, &value);
+        uint64_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        out += static_cast<char>(WXD_CONFIG_TYPE_FLOAT);
+        put_u64(out, bits);
+        break;
+    }
+    default:
+        // wxFileConfig reports every entry as a string; typed reads parse on the Rust side.
+        out += static_cast<char>(WXD_CONFIG_TYPE_STRING);
+        put_text(out, cfg->Read(name, wxString()));
+        break;
+    }
+}
+
+// Appends the entries of the current group (and its subgroups) with keys relative to the
+// group the snapshot started from.
+uint32_t
+snapshot_group(std::string& out, wxConfigBase* cfg, const wxString& prefix, bool recursive)
+{
+    uint32_t count = 0;
+    wxString name;
+    long cookie = 0;
+    for (bool more = cfg->GetFirstEntry(name, cookie); more;
+         more = cfg->GetNextEntry(name, cookie)) {
+        put_entry(out, cfg, name, prefix + name);
+        ++count;
+    }
+    if (!recursive)
+        return count;
+
+    // Collect first: changing the path invalidates the enumeration cookie.
+    std::vector<wxString> groups;
+    cookie = 0;
+    for (bool more = cfg->GetFirstGroup(name, cookie); more; more = cfg->GetNextGroup(name, cookie))
+        groups.push_back(name);
+    for (const wxString& group : groups) {
+        cfg->SetPath(group);
+        count += snapshot_group(out, cfg, prefix + group + "/", true);
+        cfg->SetPath("..");
+    }
+    return count;
+}
+
+struct BatchEntry {
+    wxString key;
+    uint8_t type = 0;
+    wxString text;
+    int64_t integer = 0;
+    double real = 0.0;
+};
+
+class BatchReader {
+public:
+    BatchReader(const uint8_t* data, size_t len) : m_data(data), m_len(len) {}
+
+    // Parses the whole batch before anything is written, so a malformed one changes nothing.
+    bool
+    Read(std::vector<BatchEntry>& entries)
+    {
+        uint32_t count = 0;
+        if (!U32(count))
+            return false;
+        // Every entry needs at least a key length and a type byte.
+        if (count > (m_len - m_pos) / 5)
+            return false;
+        entries.resize(count);
+        for (BatchEntry& entry : entries) {
+            if (!Text(entry.key) || entry.key.empty() || m_pos >= m_len)
+                return false;
+            entry.type = m_data[m_pos++];
+            uint64_t bits = 0;
+            switch (entry.type) {
+            case WXD_CONFIG_TYPE_STRING:
+                if (!Text(entry.text))
+                    return false;
+                break;
+            case WXD_CONFIG_TYPE_BOOLEAN:
+                if (m_pos >= m_len)
+                    return false;
+                entry.integer = m_data[m_pos++] != 0;
+                break;
+            case WXD_CONFIG_TYPE_INTEGER:
+                if (!U64(bits))
+                    return false;
+                entry.integer = static_cast<int64_t>(bits);
+                break;
+            case WXD_CONFIG_TYPE_FLOAT:
+                if (!U64(bits))
+                    return false;
+                std::memcpy(&entry.real, &bits, sizeof(bits));
+                break;
+            default:
+                return false;
+            }
+        }
+        return m_pos == m_len;
+    }
+
+private:
+    bool
+    U32(uint32_t& out)
+    {
+        if (m_len - m_pos < 4)
+            return false;
+        out = 0;
+        for (int i = 0; i < 4; ++i)
+            out |= uint32_t(m_data[m_pos + i]) << (8 * i);
+        m_pos += 4;
+        return true;
+    }
+
+    bool
+    U64(uint64_t& out)
+    {
+        if (m_len - m_pos < 8)
+            return false;
+        out = 0;
+        for (int i = 0; i < 8; ++i)
+            out |= uint64_t(m_data[m_pos + i]) << (8 * i);
+        m_pos += 8;
+        return true;
+    }
+
+    bool
+    Text(wxString& out)
+    {
+        uint32_t len = 0;
+        if (!U32(len) || m_len - m_pos < len)
+            return false;
+        out = wxString::FromUTF8(reinterpret_cast<const char*>(m_data + m_pos), len);
+        m_pos += len;
+        return true;
+    }
+
+    const uint8_t* m_data;
+    size_t m_len;
+    size_t m_pos = 0;
+};
+
+} // namespace
 
 extern "C" {
 
@@ -37,7 +304,11 @@ wxd_Config_Create(const char* app_name,
     if (global_filename) globalFilename = wxString::FromUTF8(global_filename);
 
     // Use wxFileConfig for cross-platform consistency
-    wxConfigBase* config = new wxFileConfig(appName, vendorName, localFilename, globalFilename, style);
+    const long wx_style = style & ~static_cast<long>(WXD_CONFIG_WRITE_BEHIND);
+    wxConfigBase* config =
+        new wxFileConfig(appName, vendorName, localFilename, globalFilename, wx_style);
+    if (style & WXD_CONFIG_WRITE_BEHIND)
+        s_write_behind.emplace(config, WriteBehind());
     return reinterpret_cast<wxd_ConfigBase_t*>(config);
 }
 
@@ -50,6 +321,8 @@ wxd_Config_Destroy(wxd_ConfigBase_t* config)
         if (wxConfigBase::Get(false) == cfg) {
             wxConfigBase::Set(nullptr);
         }
+        // wxFileConfig flushes any pending changes itself when destroyed.
+        s_write_behind.erase(cfg);
         delete cfg;
     }
 }
@@ -108,6 +381,19 @@ wxd_Config_ReadString(const wxd_ConfigBase_t* config,
     return wxd_cpp_utils::copy_wxstring_to_buffer(value, buffer, buffer_len);
 }
 
+wxd_String_t*
+wxd_Config_ReadStringOwned(const wxd_ConfigBase_t* config,
+                           const char* key,
+                           const char* default_val)
+{
+    if (!config || !key)
+        return nullptr;
+    const wxConfigBase* cfg = get_config_const(config);
+    wxString defVal;
+    if (default_val) defVal = wxString::FromUTF8(default_val);
+    return wxd_cpp_utils::make_owned_string(cfg->Read(wxString::FromUTF8(key), defVal));
+}
+
 bool
 wxd_Config_ReadLong(const wxd_ConfigBase_t* config,
                     const char* key,
@@ -156,7 +442,7 @@ wxd_Config_WriteString(wxd_ConfigBase_t* config,
     wxConfigBase* cfg = get_config(config);
     wxString val;
     if (value) val = wxString::FromUTF8(value);
-    return cfg->Write(wxString::FromUTF8(key), val);
+    return note_change(cfg, cfg->Write(wxString::FromUTF8(key), val));
 }
 
 bool
@@ -167,7 +453,7 @@ wxd_Config_WriteLong(wxd_ConfigBase_t* config,
     if (!config || !key)
         return false;
     wxConfigBase* cfg = get_config(config);
-    return cfg->Write(wxString::FromUTF8(key), value);
+    return note_change(cfg, cfg->Write(wxString::FromUTF8(key), value));
 }
 
 bool
@@ -178,7 +464,7 @@ wxd_Config_WriteDouble(wxd_ConfigBase_t* config,
     if (!config || !key)
         return false;
     wxConfigBase* cfg = get_config(config);
-    return cfg->Write(wxString::FromUTF8(key), value);
+    return note_change(cfg, cfg->Write(wxString::FromUTF8(key), value));
 }
 
 bool
@@ -189,7 +475,7 @@ wxd_Config_WriteBool(wxd_ConfigBase_t* config,
     if (!config || !key)
         return false;
     wxConfigBase* cfg = get_config(config);
-    return cfg->Write(wxString::FromUTF8(key), value);
+    return note_change(cfg, cfg->Write(wxString::FromUTF8(key), value));
 }
 
 // --- Existence Tests ---
@@ -252,7 +538,7 @@ wxd_Config_DeleteEntry(wxd_ConfigBase_t* config,
     if (!config || !key)
         return false;
     wxConfigBase* cfg = get_config(config);
-    return cfg->DeleteEntry(wxString::FromUTF8(key), delete_group_if_empty);
+    return note_change(cfg, cfg->DeleteEntry(wxString::FromUTF8(key), delete_group_if_empty));
 }
 
 bool
@@ -261,7 +547,7 @@ wxd_Config_DeleteGroup(wxd_ConfigBase_t* config, const char* key)
     if (!config || !key)
         return false;
     wxConfigBase* cfg = get_config(config);
-    return cfg->DeleteGroup(wxString::FromUTF8(key));
+    return note_change(cfg, cfg->DeleteGroup(wxString::FromUTF8(key)));
 }
 
 bool
@@ -372,7 +658,8 @@ wxd_Config_RenameEntry(wxd_ConfigBase_t* config,
     if (!config || !old_name || !new_name)
         return false;
     wxConfigBase* cfg = get_config(config);
-    return cfg->RenameEntry(wxString::FromUTF8(old_name), wxString::FromUTF8(new_name));
+    return note_change(
+        cfg, cfg->RenameEntry(wxString::FromUTF8(old_name), wxString::FromUTF8(new_name)));
 }
 
 bool
@@ -383,7 +670,74 @@ wxd_Config_RenameGroup(wxd_ConfigBase_t* config,
     if (!config || !old_name || !new_name)
         return false;
     wxConfigBase* cfg = get_config(config);
-    return cfg->RenameGroup(wxString::FromUTF8(old_name), wxString::FromUTF8(new_name));
+    return note_change(
+        cfg, cfg->RenameGroup(wxString::FromUTF8(old_name), wxString::FromUTF8(new_name)));
+}
+
+// --- Bulk Operations ---
+
+wxd_String_t*
+wxd_Config_ReadGroupSnapshot(const wxd_ConfigBase_t* config, const char* path, bool recursive)
+{
+    if (!config)
+        return nullptr;
+    // Enumeration and SetPath change internal state; the caller's path is restored below.
+    wxConfigBase* cfg = const_cast<wxConfigBase*>(get_config_const(config));
+    const wxString old_path = cfg->GetPath();
+    if (path && *path) {
+        const wxString group = wxString::FromUTF8(path);
+        if (!cfg->HasGroup(group))
+            return nullptr;
+        cfg->SetPath(group);
+    }
+
+    std::string body;
+    const uint32_t count = snapshot_group(body, cfg, wxString(), recursive);
+    cfg->SetPath(old_path);
+
+    std::string out;
+    out.reserve(4 + body.size());
+    put_u32(out, count);
+    out += body;
+    wxCharBuffer buffer(out.size());
+    memcpy(buffer.data(), out.data(), out.size());
+    return wxd_cpp_utils::make_owned_string(buffer);
+}
+
+int
+wxd_Config_WriteBatch(wxd_ConfigBase_t* config, const uint8_t* batch, size_t len, bool flush)
+{
+    if (!config || !batch)
+        return -1;
+    std::vector<BatchEntry> entries;
+    if (!BatchReader(batch, len).Read(entries))
+        return -1;
+
+    wxConfigBase* cfg = get_config(config);
+    int written = 0;
+    for (const BatchEntry& entry : entries) {
+        bool ok = false;
+        switch (entry.type) {
+        case WXD_CONFIG_TYPE_STRING:
+            ok = cfg->Write(entry.key, entry.text);
+            break;
+        case WXD_CONFIG_TYPE_BOOLEAN:
+            ok = cfg->Write(entry.key, entry.integer != 0);
+            break;
+        case WXD_CONFIG_TYPE_INTEGER:
+            ok = cfg->Write(entry.key, static_cast<long>(entry.integer));
+            break;
+        case WXD_CONFIG_TYPE_FLOAT:
+            ok = cfg->Write(entry.key, entry.real);
+            break;
+        }
+        if (ok)
+            ++written;
+    }
+    // Write-behind configs persist the batch on their own timer.
+    if (written && !schedule_flush(cfg) && flush)
+        cfg->Flush();
+    return written;
 }
 
 // --- Miscellaneous ---
@@ -394,9 +748,54 @@ wxd_Config_Flush(wxd_ConfigBase_t* config, bool current_only)
     if (!config)
         return false;
     wxConfigBase* cfg = get_config(config);
+    // In write-behind mode an explicit flush only (re)arms the debounce timer.
+    if (schedule_flush(cfg))
+        return true;
     return cfg->Flush(current_only);
 }
 
+void
+wxd_Config_SetWriteBehind(wxd_ConfigBase_t* config, int delay_ms)
+{
+    if (!config)
+        return;
+    wxConfigBase* cfg = get_config(config);
+    if (delay_ms <= 0) {
+        if (WriteBehind* state = find_write_behind(cfg)) {
+            flush_pending(cfg, *state);
+            s_write_behind.erase(cfg);
+        }
+        return;
+    }
+    s_write_behind[cfg].delay_ms = delay_ms;
+}
+
+bool
+wxd_Config_IsFlushPending(const wxd_ConfigBase_t* config)
+{
+    if (!config)
+        return false;
+    WriteBehind* state = find_write_behind(const_cast<wxConfigBase*>(get_config_const(config)));
+    return state && state->timer && state->timer->IsRunning();
+}
+
+bool
+wxd_Config_FlushPending(wxd_ConfigBase_t* config)
+{
+    if (!config)
+        return false;
+    wxConfigBase* cfg = get_config(config);
+    WriteBehind* state = find_write_behind(cfg);
+    return state ? flush_pending(cfg, *state) : cfg->Flush();
+}
+
+void
+wxd_Config_FlushAllPending(void)
+{
+    for (auto& [cfg, state] : s_write_behind)
+        flush_pending(cfg, state);
+}
+
 int
 wxd_Config_GetAppName(const wxd_ConfigBase_t* config, char* buffer, size_t buffer_len)
 {
@@ -4,6 +4,16 @@
 
 #if wxUSE_ACCESSIBILITY
 #include <wx/access.h>
+#include <unordered_map>
+
+// Node properties published from Rust; see wxd_Accessible_PublishNodes.
+struct WxdAccNode {
+    uint32_t fields = 0;
+    wxAccRole role = wxROLE_NONE;
+    long state = 0;
+    wxString name, description, value, defaultAction;
+    wxRect rect;
+};
 
 class WxdCustomAccessible : public wxAccessible {
 public:
@@ -11,7 +21,50 @@ public:
         : wxAccessible(win), m_callbacks(callbacks), m_userData(userData)
     {}
 
+    void Publish(const wxd_AccNode& node, bool notify) {
+        WxdAccNode cached;
+        cached.fields = node.fields;
+        cached.role = static_cast<wxAccRole>(node.role);
+        cached.state = node.state;
+        cached.name = WXD_STR_TO_WX_STRING_UTF8_NULL_OK(node.name);
+        cached.description = WXD_STR_TO_WX_STRING_UTF8_NULL_OK(node.description);
+        cached.value = WXD_STR_TO_WX_STRING_UTF8_NULL_OK(node.value);
+        cached.defaultAction = WXD_STR_TO_WX_STRING_UTF8_NULL_OK(node.default_action);
+        cached.rect = wxRect(node.rect.x, node.rect.y, node.rect.width, node.rect.height);
+
+        auto it = m_nodes.find(node.child_id);
+        if (notify && it != m_nodes.end() && GetWindow())
+            NotifyChanges(node.child_id, it->second, cached);
+        m_nodes[node.child_id] = std::move(cached);
+    }
+
+    void SetCachedChildCount(int count) { m_childCount = count; }
+
+    void Invalidate(int first, int count) {
+        if (count < 0) {
+            m_nodes.clear();
+            m_childCount = -1;
+            return;
+        }
+        // A few visible rows are usually cached, so walk whichever side is smaller.
+        if (static_cast<size_t>(count) > m_nodes.size()) {
+            for (auto it = m_nodes.begin(); it != m_nodes.end();) {
+                if (it->first >= first && it->first - first < count)
+                    it = m_nodes.erase(it);
+                else
+                    ++it;
+            }
+        } else {
+            for (int i = 0; i < count; ++i)
+                m_nodes.erase(first + i);
+        }
+    }
+
     wxAccStatus GetChildCount(int* childCount) override {
+        if (m_childCount >= 0) {
+            *childCount = m_childCount;
+            return wxACC_OK;
+        }
         if (m_callbacks.GetChildCount) {
             return (wxAccStatus)m_callbacks.GetChildCount(m_userData, childCount);
         }
@@ -33,6 +86,10 @@ public:
     }
 
     wxAccStatus GetRole(int childId, wxAccRole* role) override {
+        if (const WxdAccNode* node = Cached(childId, WXD_ACC_NODE_ROLE)) {
+            *role = node->role;
+            return wxACC_OK;
+        }
         if (m_callbacks.GetRole) {
             return (wxAccStatus)m_callbacks.GetRole(m_userData, childId, reinterpret_cast<wxd_AccRole*>(role));
         }
@@ -40,6 +97,10 @@ public:
     }
 
     wxAccStatus GetState(int childId, long* state) override {
+        if (const WxdAccNode* node = Cached(childId, WXD_ACC_NODE_STATE)) {
+            *state = node->state;
+            return wxACC_OK;
+        }
         if (m_callbacks.GetState) {
             return (wxAccStatus)m_callbacks.GetState(m_userData, childId, state);
         }
@@ -47,6 +108,10 @@ public:
     }
 
     wxAccStatus GetName(int childId, wxString* name) override {
+        if (const WxdAccNode* node = Cached(childId, WXD_ACC_NODE_NAME)) {
+            *name = node->name;
+            return wxACC_OK;
+        }
         if (m_callbacks.GetName) {
             char buf[1024];
             wxd_AccStatus status = m_callbacks.GetName(m_userData, childId, buf, sizeof(buf));
@@ -59,6 +124,10 @@ public:
     }
 
     wxAccStatus GetDescription(int childId, wxString* description) override {
+        if (const WxdAccNode* node = Cached(childId, WXD_ACC_NODE_DESCRIPTION)) {
+            *description = node->description;
+            return wxACC_OK;
+        }
         if (m_callbacks.GetDescription) {
             char buf[1024];
             wxd_AccStatus status = m_callbacks.GetDescription(m_userData, childId, buf, sizeof(buf));
@@ -95,6 +164,10 @@ public:
     }
 
     wxAccStatus GetDefaultAction(int childId, wxString* actionName) override {
+        if (const WxdAccNode* node = Cached(childId, WXD_ACC_NODE_DEFAULT_ACTION)) {
+            *actionName = node->defaultAction;
+            return wxACC_OK;
+        }
         if (m_callbacks.GetDefaultAction) {
             char buf[1024];
             wxd_AccStatus status = m_callbacks.GetDefaultAction(m_userData, childId, buf, sizeof(buf));
@@ -107,6 +180,10 @@ public:
     }
 
     wxAccStatus GetValue(int childId, wxString* value) override {
+        if (const WxdAccNode* node = Cached(childId, WXD_ACC_NODE_VALUE)) {
+            *value = node->value;
+            return wxACC_OK;
+        }
         if (m_callbacks.GetValue) {
             char buf[1024];
             wxd_AccStatus status = m_callbacks.GetValue(m_userData, childId, buf, sizeof(buf));
@@ -147,6 +224,10 @@ public:
     }
 
     wxAccStatus GetLocation(wxRect& rect, int childId) override {
+        if (const WxdAccNode* node = Cached(childId, WXD_ACC_NODE_LOCATION)) {
+            rect = ToScreen(node->rect);
+            return wxACC_OK;
+        }
         if (m_callbacks.GetLocation) {
             wxd_Rect r;
             wxd_AccStatus status = m_callbacks.GetLocation(m_userData, childId, &r);
@@ -174,8 +255,39 @@ public:
     }
 
 private:
+    const WxdAccNode* Cached(int childId, uint32_t field) const {
+        auto it = m_nodes.find(childId);
+        return it != m_nodes.end() && (it->second.fields & field) ? &it->second : nullptr;
+    }
+
+    wxRect ToScreen(const wxRect& rect) const {
+        wxWindow* window = GetWindow();
+        return window ? wxRect(window->ClientToScreen(rect.GetPosition()), rect.GetSize()) : rect;
+    }
+
+    void NotifyChanges(int childId, const WxdAccNode& before, const WxdAccNode& after) {
+        const auto changed = [&](uint32_t field, bool differs) {
+            return (after.fields & field) && (!(before.fields & field) || differs);
+        };
+        const auto notify = [&](wxAccEvent event) {
+            wxAccessible::NotifyEvent(event, GetWindow(), wxOBJID_CLIENT, childId);
+        };
+        if (changed(WXD_ACC_NODE_NAME, before.name != after.name))
+            notify(wxACC_EVENT_OBJECT_NAMECHANGE);
+        if (changed(WXD_ACC_NODE_DESCRIPTION, before.description != after.description))
+            notify(wxACC_EVENT_OBJECT_DESCRIPTIONCHANGE);
+        if (changed(WXD_ACC_NODE_VALUE, before.value != after.value))
+            notify(wxACC_EVENT_OBJECT_VALUECHANGE);
+        if (changed(WXD_ACC_NODE_STATE, before.state != after.state))
+            notify(wxACC_EVENT_OBJECT_STATECHANGE);
+        if (changed(WXD_ACC_NODE_LOCATION, before.rect != after.rect))
+            notify(wxACC_EVENT_OBJECT_LOCATIONCHANGE);
+    }
+
     wxd_AccessibleCallbacks m_callbacks;
     void* m_userData;
+    std::unordered_map<int, WxdAccNode> m_nodes;
+    int m_childCount = -1;
 };
 
 // The wxAccessible child id that refers to the object (window) itself, as opposed
@@ -266,6 +378,42 @@ wxd_Accessible_NotifyEvent(uint32_t eventType, wxd_Window_t* window, int objectT
 #endif
 }
 
+void
+wxd_Accessible_PublishNodes(wxd_Accessible_t* self, const wxd_AccNode* nodes, int count, bool notify)
+{
+#if wxUSE_ACCESSIBILITY
+    WxdCustomAccessible* acc = dynamic_cast<WxdCustomAccessible*>(reinterpret_cast<wxAccessible*>(self));
+    if (!acc || !nodes)
+        return;
+    for (int i = 0; i < count; ++i)
+        acc->Publish(nodes[i], notify);
+#else
+    (void)self; (void)nodes; (void)count; (void)notify;
+#endif
+}
+
+void
+wxd_Accessible_SetCachedChildCount(wxd_Accessible_t* self, int count)
+{
+#if wxUSE_ACCESSIBILITY
+    if (WxdCustomAccessible* acc = dynamic_cast<WxdCustomAccessible*>(reinterpret_cast<wxAccessible*>(self)))
+        acc->SetCachedChildCount(count);
+#else
+    (void)self; (void)count;
+#endif
+}
+
+void
+wxd_Accessible_InvalidateNodes(wxd_Accessible_t* self, int first_child_id, int count)
+{
+#if wxUSE_ACCESSIBILITY
+    if (WxdCustomAccessible* acc = dynamic_cast<WxdCustomAccessible*>(reinterpret_cast<wxAccessible*>(self)))
+        acc->Invalidate(first_child_id, count);
+#else
+    (void)self; (void)first_child_id; (void)count;
+#endif
+}
+
 void
 wxd_Window_SetAccessible(wxd_Window_t* self, wxd_Accessible_t* accessible)
 {
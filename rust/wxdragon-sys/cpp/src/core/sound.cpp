@@ -1,6 +1,58 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
 #include <wx/sound.h>
-#include "../../include/core/wxd_sound.h"
+#include <wx/ffile.h>
+#include "../../include/wxdragon.h"
 #include "../wxd_utils.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// A sound decoded from bytes it owns, so the backend may keep pointing into them.
+class WxdMemorySound : public wxSound {
+public:
+    explicit WxdMemorySound(std::vector<unsigned char> bytes) : m_bytes(std::move(bytes)) {
+        if (!m_bytes.empty())
+            Create(m_bytes.size(), m_bytes.data());
+    }
+
+private:
+    std::vector<unsigned char> m_bytes;
+};
+
+std::unique_ptr<wxSound>
+make_memory_sound(std::vector<unsigned char> bytes) {
+    auto sound = std::make_unique<WxdMemorySound>(std::move(bytes));
+    if (!sound->IsOk())
+        return nullptr;
+    return sound;
+}
+
+bool
+read_file(const char* fileName, std::vector<unsigned char>& out) {
+    wxLogNull no_log; // A missing file is reported through the result
+    wxFFile file(wxString::FromUTF8(fileName), "rb");
+    if (!file.IsOpened())
+        return false;
+    const wxFileOffset len = file.Length();
+    if (len <= 0)
+        return false;
+    out.resize(static_cast<size_t>(len));
+    return file.Read(out.data(), out.size()) == out.size();
+}
+
+} // namespace
+
+struct wxd_SoundPool_t {
+    std::unordered_map<std::string, std::unique_ptr<wxSound>> sounds;
+    // Cleared on destruction; loads finishing afterwards are dropped. Main thread only.
+    std::shared_ptr<bool> alive = std::make_shared<bool>(true);
+};
 
 extern "C" {
 
@@ -43,4 +95,94 @@ wxd_Sound_Stop(void) {
     wxSound::Stop();
 }
 
+wxd_Sound_t*
+wxd_Sound_CreateFromMemory(const void* data, size_t len) {
+    if (!data || len == 0)
+        return nullptr;
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    return reinterpret_cast<wxd_Sound_t*>(
+        make_memory_sound(std::vector<unsigned char>(bytes, bytes + len)).release());
+}
+
+wxd_Sound_t*
+wxd_Sound_CreatePreloaded(const char* fileName) {
+    std::vector<unsigned char> bytes;
+    if (!fileName || !read_file(fileName, bytes))
+        return nullptr;
+    return reinterpret_cast<wxd_Sound_t*>(make_memory_sound(std::move(bytes)).release());
+}
+
+wxd_SoundPool_t*
+wxd_SoundPool_Create(void) {
+    return new wxd_SoundPool_t();
+}
+
+void
+wxd_SoundPool_Destroy(wxd_SoundPool_t* pool) {
+    if (!pool)
+        return;
+    *pool->alive = false;
+    delete pool;
+}
+
+void
+wxd_SoundPool_LoadFileAsync(wxd_SoundPool_t* pool, const char* key, const char* fileName) {
+    if (!pool || !key || !fileName || !wxTheApp)
+        return;
+    std::shared_ptr<bool> alive = pool->alive;
+    std::string name(key);
+    std::string path(fileName);
+    std::thread([pool, alive, name, path]() {
+        auto bytes = std::make_shared<std::vector<unsigned char>>();
+        if (!read_file(path.c_str(), *bytes)) {
+            WXD_LOG_WARNF("SoundPool: cannot read %s", path.c_str());
+            return;
+        }
+        wxApp* app = wxTheApp;
+        if (!app)
+            return;
+        app->CallAfter([pool, alive, name, bytes]() {
+            if (!*alive)
+                return;
+            if (std::unique_ptr<wxSound> sound = make_memory_sound(std::move(*bytes)))
+                pool->sounds[name] = std::move(sound);
+        });
+    }).detach();
+}
+
+bool
+wxd_SoundPool_AddFromMemory(wxd_SoundPool_t* pool, const char* key, const void* data,
+                            size_t len) {
+    if (!pool || !key || !data || len == 0)
+        return false;
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    std::unique_ptr<wxSound> sound =
+        make_memory_sound(std::vector<unsigned char>(bytes, bytes + len));
+    if (!sound)
+        return false;
+    pool->sounds[key] = std::move(sound);
+    return true;
+}
+
+bool
+wxd_SoundPool_IsLoaded(wxd_SoundPool_t* pool, const char* key) {
+    return pool && key && pool->sounds.count(key) > 0;
+}
+
+bool
+wxd_SoundPool_Play(wxd_SoundPool_t* pool, const char* key, unsigned int flags) {
+    if (!pool || !key)
+        return false;
+    auto it = pool->sounds.find(key);
+    if (it == pool->sounds.end())
+        return false;
+    return it->second->Play((flags & WXD_SOUND_LOOP) | WXD_SOUND_ASYNC);
+}
+
+void
+wxd_SoundPool_Remove(wxd_SoundPool_t* pool, const char* key) {
+    if (pool && key)
+        pool->sounds.erase(key);
+}
+
 } // extern "C"
@@ -2,6 +2,7 @@
 #include <wx/wx.h>
 #include "../../include/wxdragon.h"
 #include "../../include/core/wxd_timer.h"
+#include "../wxd_visibility.h"
 #include <wx/timer.h>
 
 extern "C" {
@@ -28,6 +29,7 @@ wxd_Timer_Destroy(wxd_Timer_t* self)
     if (timer->IsRunning()) {
         timer->Stop();
     }
+    wxd_visibility::forget_timer(timer);
     delete timer;
 }
 
@@ -0,0 +1,277 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../../include/wxdragon.h"
+#include "../../include/core/wxd_timer.h"
+#include "../wxd_trace.h"
+#include <wx/timer.h>
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+constexpr int kLevels = 4;
+constexpr int kSlotBits = 6;
+constexpr uint32_t kSlots = 1u << kSlotBits;
+constexpr uint32_t kSlotMask = kSlots - 1;
+constexpr uint32_t kNone = UINT32_MAX;
+// Delays beyond the span of the top level are parked there and re-cascaded until due.
+constexpr uint64_t kMaxSpan = (uint64_t(1) << (kSlotBits * kLevels)) - 1;
+
+} // namespace
+
+struct wxd_TimerWheel_t : public wxTimer {
+    using Clock = std::chrono::steady_clock;
+
+    wxd_TimerWheel_t(int tickMs, void* userdata, wxd_timer_wheel_callback callback,
+                     wxd_timer_wheel_free_userdata_callback free_userdata)
+        : m_tick(std::chrono::milliseconds(tickMs)),
+          m_tickMs(tickMs),
+          m_userdata(userdata),
+          m_callback(callback),
+          m_free_userdata(free_userdata)
+    {
+        m_heads.assign(kLevels * kSlots, kNone);
+    }
+
+    ~wxd_TimerWheel_t() override
+    {
+        Stop();
+        if (m_free_userdata && m_userdata)
+            m_free_userdata(m_userdata);
+    }
+
+    uint64_t Schedule(int delayMs, int periodMs)
+    {
+        uint32_t index;
+        if (!m_free.empty()) {
+            index = m_free.back();
+            m_free.pop_back();
+        }
+        else {
+            index = static_cast<uint32_t>(m_timers.size());
+            m_timers.emplace_back();
+        }
+        WheelTimer& timer = m_timers[index];
+        timer.period = periodMs > 0 ? static_cast<uint32_t>(TicksFor(periodMs)) : 0;
+        if (m_pending == 0 && !IsRunning()) {
+            // The wheel was idle: restart its clock so the idle time is not replayed.
+            m_last = Clock::now();
+        }
+        // m_current is the next tick to run, so a one-tick delay fires on the next notification.
+        timer.expires = m_current + TicksFor(delayMs) - 1;
+        Link(index);
+        ++m_pending;
+        if (!IsRunning())
+            Start(m_tickMs);
+        return (uint64_t(timer.generation) << 32) | (uint64_t(index) + 1);
+    }
+
+    bool Cancel(uint64_t id)
+    {
+        const uint32_t low = static_cast<uint32_t>(id & 0xffffffffu);
+        if (low == 0 || low > m_timers.size())
+            return false;
+        const uint32_t index = low - 1;
+        WheelTimer& timer = m_timers[index];
+        if (timer.generation != static_cast<uint32_t>(id >> 32) || timer.slot == kNone)
+            return false;
+        Unlink(index);
+        Release(index);
+        --m_pending;
+        if (m_pending == 0)
+            Stop();
+        return true;
+    }
+
+    size_t Pending() const { return m_pending; }
+
+    void Notify() override
+    {
+        const Clock::time_point now = Clock::now();
+        const uint64_t elapsed = static_cast<uint64_t>((now - m_last) / m_tick);
+        if (elapsed == 0)
+            return;
+        m_last += m_tick * elapsed;
+
+        m_fired.clear();
+        for (uint64_t i = 0; i < elapsed && m_pending > 0; ++i)
+            Advance();
+        if (m_pending == 0)
+            Stop();
+        // Coalesced: one call for everything that fired, including ticks caught up on.
+        if (!m_fired.empty() && m_callback) {
+            wxd_trace::Span trace_span(wxd_trace::CATEGORY_TIMER, "TimerWheel fire");
+            m_callback(m_userdata, m_fired.data(), m_fired.size());
+        }
+    }
+
+private:
+    struct WheelTimer {
+        uint64_t expires = 0;
+        uint32_t period = 0; // in ticks, 0 for one-shot
+        uint32_t generation = 0;
+        uint32_t prev = kNone;
+        uint32_t next = kNone;
+        uint32_t slot = kNone; // level * kSlots + index while scheduled
+    };
+
+    uint64_t TicksFor(int ms) const
+    {
+        if (ms <= 0)
+            return 1;
+        return (static_cast<uint64_t>(ms) + m_tickMs - 1) / m_tickMs;
+    }
+
+    // Same slot selection as the classic Linux timer wheel, relative to the next tick to run.
+    void Link(uint32_t index)
+    {
+        WheelTimer& timer = m_timers[index];
+        uint64_t delta = timer.expires > m_current ? timer.expires - m_current : 0;
+        if (delta > kMaxSpan)
+            delta = kMaxSpan;
+        const uint64_t due = m_current + delta;
+        int level = 0;
+        while (level < kLevels - 1 && delta >= (uint64_t(1) << (kSlotBits * (level + 1))))
+            ++level;
+        const uint32_t slot =
+            level * kSlots + static_cast<uint32_t>((due >> (kSlotBits * level)) & kSlotMask);
+        timer.slot = slot;
+        timer.prev = kNone;
+        timer.next = m_heads[slot];
+        if (timer.next != kNone)
+            m_timers[timer.next].prev = index;
+        m_heads[slot] = index;
+    }
+
+    void Unlink(uint32_t index)
+    {
+        WheelTimer& timer = m_timers[index];
+        if (timer.prev != kNone)
+            m_timers[timer.prev].next = timer.next;
+        else
+            m_heads[timer.slot] = timer.next;
+        if (timer.next != kNone)
+            m_timers[timer.next].prev = timer.prev;
+        timer.prev = timer.next = timer.slot = kNone;
+    }
+
+    void Release(uint32_t index)
+    {
+        ++m_timers[index].generation;
+        m_free.push_back(index);
+    }
+
+    // Detaches a whole slot and returns its first timer.
+    uint32_t TakeSlot(uint32_t slot)
+    {
+        const uint32_t head = m_heads[slot];
+        m_heads[slot] = kNone;
+        return head;
+    }
+
+    // Moves the timers of one higher-level slot down; returns the slot index.
+    uint32_t Cascade(int level)
+    {
+        const uint32_t index = static_cast<uint32_t>((m_current >> (kSlotBits * level)) & kSlotMask);
+        uint32_t cur = TakeSlot(level * kSlots + index);
+        while (cur != kNone) {
+            const uint32_t next = m_timers[cur].next;
+            Link(cur);
+            cur = next;
+        }
+        return index;
+    }
+
+    // Runs tick m_current.
+    void Advance()
+    {
+        const uint32_t index = static_cast<uint32_t>(m_current & kSlotMask);
+        if (index == 0) {
+            for (int level = 1; level < kLevels; ++level) {
+                if (Cascade(level) != 0)
+                    break;
+            }
+        }
+        const uint64_t tick = m_current++;
+
+        uint32_t cur = TakeSlot(index);
+        while (cur != kNone) {
+            WheelTimer& timer = m_timers[cur];
+            const uint32_t next = timer.next;
+            timer.prev = timer.next = timer.slot = kNone;
+            if (timer.expires > tick) {
+                // Parked beyond the wheel span; not due yet.
+                Link(cur);
+                cur = next;
+                continue;
+            }
+            m_fired.push_back((uint64_t(timer.generation) << 32) | (uint64_t(cur) + 1));
+            if (timer.period > 0) {
+                timer.expires = tick + timer.period;
+                Link(cur);
+            }
+            else {
+                Release(cur);
+                --m_pending;
+            }
+            cur = next;
+        }
+    }
+
+    Clock::duration m_tick;
+    uint64_t m_tickMs;
+    void* m_userdata;
+    wxd_timer_wheel_callback m_callback;
+    wxd_timer_wheel_free_userdata_callback m_free_userdata;
+
+    std::vector<WheelTimer> m_timers;
+    std::vector<uint32_t> m_free;
+    std::vector<uint32_t> m_heads;
+    std::vector<uint64_t> m_fired;
+    uint64_t m_current = 0; // next tick to run
+    size_t m_pending = 0;
+    Clock::time_point m_last = Clock::now();
+};
+
+extern "C" {
+
+WXD_EXPORTED wxd_TimerWheel_t*
+wxd_TimerWheel_Create(int tickMs, void* userdata, wxd_timer_wheel_callback callback,
+                      wxd_timer_wheel_free_userdata_callback free_userdata)
+{
+    if (!callback)
+        return nullptr;
+    return new wxd_TimerWheel_t(tickMs < 1 ? 1 : tickMs, userdata, callback, free_userdata);
+}
+
+WXD_EXPORTED void
+wxd_TimerWheel_Destroy(wxd_TimerWheel_t* self)
+{
+    delete self;
+}
+
+WXD_EXPORTED uint64_t
+wxd_TimerWheel_Schedule(wxd_TimerWheel_t* self, int delayMs, int periodMs)
+{
+    if (!self)
+        return 0;
+    return self->Schedule(delayMs, periodMs);
+}
+
+WXD_EXPORTED bool
+wxd_TimerWheel_Cancel(wxd_TimerWheel_t* self, uint64_t id)
+{
+    if (!self)
+        return false;
+    return self->Cancel(id);
+}
+
+WXD_EXPORTED size_t
+wxd_TimerWheel_GetPendingCount(const wxd_TimerWheel_t* self)
+{
+    return self ? self->Pending() : 0;
+}
+
+} // extern "C"
@@ -4,6 +4,7 @@
 #include <wx/cursor.h>
 #include <wx/bitmap.h>
 #include <wx/utils.h>
+#include "wxd_startup.h"
 #include <cstring>
 
 extern "C" {
@@ -132,6 +133,7 @@ wxd_Cursor_CreateFromFile(const char* filename, wxd_BitmapType type, int hotspot
     try {
         wxString wx_filename = wxString::FromUTF8(filename);
         wxBitmapType wx_type = map_bitmap_type(type);
+        wxd_startup::ensure_image_handlers(); // Cursor files are read through wxImage
         wxCursor* cursor = new wxCursor(wx_filename, wx_type, hotspot_x, hotspot_y);
 
         if (cursor && cursor->IsOk()) {
@@ -1,9 +1,154 @@
 #include <wx/wxprec.h>
 #include <wx/wx.h>
 #include "../include/wxdragon.h"
+#include "wxd_objstats.h"
 #include <wx/clipbrd.h>
 #include <wx/dataobj.h>
 #include <wx/bitmap.h>
+#include <cstring>
+#include <memory>
+#include <string>
+
+// --- Lazy (delayed-rendering) data objects ---
+//
+// A composite of simple data objects, one per offered format, whose payload is
+// produced by the render callback only when a consumer first asks for it (a
+// paste, or a drop target reading the data). Each format renders at most once;
+// later requests reuse its cached bytes.
+
+namespace {
+
+class LazySource {
+public:
+    LazySource(void* user_data, wxd_LazyData_Render_Callback render,
+               wxd_LazyData_FreeUserData_Callback free_user_data)
+        : m_userData(user_data), m_render(render), m_freeUserData(free_user_data) {}
+    LazySource(const LazySource&) = delete;
+    LazySource& operator=(const LazySource&) = delete;
+    ~LazySource() {
+        if (m_userData && m_freeUserData)
+            m_freeUserData(m_userData);
+    }
+
+    std::string Render(int format_index) const {
+        size_t size = 0;
+        const void* data = m_render ? m_render(m_userData, format_index, &size) : nullptr;
+        return data ? std::string(static_cast<const char*>(data), size) : std::string();
+    }
+
+private:
+    void* m_userData;
+    wxd_LazyData_Render_Callback m_render;
+    wxd_LazyData_FreeUserData_Callback m_freeUserData;
+};
+
+// Renders one format on first use and keeps the bytes for later requests.
+class LazyPayload {
+public:
+    LazyPayload(std::shared_ptr<LazySource> source, int index)
+        : m_source(std::move(source)), m_index(index) {}
+
+    const std::string& Bytes() const {
+        if (!m_rendered) {
+            m_bytes = m_source->Render(m_index);
+            m_rendered = true;
+        }
+        return m_bytes;
+    }
+
+    void Set(std::string bytes) {
+        m_bytes = std::move(bytes);
+        m_rendered = true;
+    }
+
+private:
+    std::shared_ptr<LazySource> m_source;
+    int m_index;
+    mutable bool m_rendered = false;
+    mutable std::string m_bytes;
+};
+
+class LazyTextDataObject : public wxTextDataObject {
+public:
+    explicit LazyTextDataObject(LazyPayload payload) : m_payload(std::move(payload)) {}
+
+    size_t GetTextLength() const override { return GetText().length() + 1; }
+    wxString GetText() const override { return wxString::FromUTF8(m_payload.Bytes()); }
+    void SetText(const wxString& text) override { m_payload.Set(text.utf8_string()); }
+
+private:
+    LazyPayload m_payload;
+};
+
+class LazyHTMLDataObject : public wxHTMLDataObject {
+public:
+    explicit LazyHTMLDataObject(LazyPayload payload) : m_payload(std::move(payload)) {}
+
+    wxString GetHTML() const override { return wxString::FromUTF8(m_payload.Bytes()); }
+    void SetHTML(const wxString& html) override { m_payload.Set(html.utf8_string()); }
+
+private:
+    LazyPayload m_payload;
+};
+
+class LazyCustomDataObject : public wxDataObjectSimple {
+public:
+    LazyCustomDataObject(const wxDataFormat& format, LazyPayload payload)
+        : wxDataObjectSimple(format), m_payload(std::move(payload)) {}
+
+    size_t GetDataSize() const override { return m_payload.Bytes().size(); }
+
+    bool GetDataHere(void* buf) const override {
+        const std::string& bytes = m_payload.Bytes();
+        if (!bytes.empty())
+            std::memcpy(buf, bytes.data(), bytes.size());
+        return true;
+    }
+
+    bool SetData(size_t len, const void* buf) override {
+        m_payload.Set(std::string(static_cast<const char*>(buf), len));
+        return true;
+    }
+
+private:
+    LazyPayload m_payload;
+};
+
+class LazyDataObject : public wxDataObjectComposite {
+public:
+    explicit LazyDataObject(std::shared_ptr<LazySource> source) : m_source(std::move(source)) {}
+
+    int AddFormat(wxd_LazyDataFormat kind, const char* custom_id, bool preferred) {
+        // Indices follow call order, so a rejected format still uses one up.
+        const int index = m_count++;
+        LazyPayload payload(m_source, index);
+        wxDataObjectSimple* child = nullptr;
+        switch (kind) {
+        case WXD_LAZY_FORMAT_TEXT:
+            child = new LazyTextDataObject(std::move(payload));
+            break;
+        case WXD_LAZY_FORMAT_HTML:
+            child = new LazyHTMLDataObject(std::move(payload));
+            break;
+        case WXD_LAZY_FORMAT_CUSTOM:
+            if (!custom_id || !*custom_id)
+                return -1;
+            child = new LazyCustomDataObject(wxDataFormat(wxString::FromUTF8(custom_id)),
+                                             std::move(payload));
+            break;
+        }
+        if (!child)
+            return -1;
+        Add(child, preferred);
+        return index;
+    }
+
+private:
+    std::shared_ptr<LazySource> m_source;
+    int m_count = 0;
+};
+
+} // namespace
 
 extern "C" {
 
@@ -151,8 +296,29 @@ wxd_BitmapDataObject_GetBitmap(wxd_BitmapDataObject_t* data_object)
     }
 
     // Create a new bitmap that's a copy of the original
-    wxBitmap* new_bitmap = new wxBitmap(original);
+    wxBitmap* new_bitmap = wxd_objstats::track(new wxBitmap(original));
     return reinterpret_cast<wxd_Bitmap_t*>(new_bitmap);
 }
 
-} // extern "C"
\ No newline at end of file
+// --- LazyDataObject Functions ---
+
+WXD_EXPORTED wxd_DataObject_t*
+wxd_LazyDataObject_Create(void* user_data, wxd_LazyData_Render_Callback render,
+                          wxd_LazyData_FreeUserData_Callback free_user_data)
+{
+    auto source = std::make_shared<LazySource>(user_data, render, free_user_data);
+    return reinterpret_cast<wxd_DataObject_t*>(new LazyDataObject(std::move(source)));
+}
+
+WXD_EXPORTED int
+wxd_LazyDataObject_AddFormat(wxd_DataObject_t* data_object, wxd_LazyDataFormat format,
+                             const char* custom_id, bool preferred)
+{
+    if (!data_object)
+        return -1;
+    LazyDataObject* lazy = dynamic_cast<LazyDataObject*>(
+        reinterpret_cast<wxDataObject*>(data_object));
+    return lazy ? lazy->AddFormat(format, custom_id, preferred) : -1;
+}
+
+} // extern "C"
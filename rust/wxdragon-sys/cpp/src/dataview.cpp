@@ -1,14 +1,25 @@
 #include <wx/wxprec.h>
 #include <wx/wx.h>
 #include "../include/wxdragon.h"
+#include "wxd_objstats.h"
 #include "../src/wxd_utils.h"
+#include "../src/wxd_cache_registry.h"
 #include <wx/dataview.h>
 #include <wx/string.h>   // For wxString methods
 #include <wx/tokenzr.h>  // For wxStringTokenizer
 #include <wx/bitmap.h>   // For wxBitmap
 #include <wx/datetime.h> // For wxDateTime
 #include <wx/variant.h>
+#include <wx/dcgraph.h>
+#include <wx/dcmemory.h>
+#include <wx/hashmap.h>
+#include <wx/image.h>
+#include <algorithm>
 #include <cstring>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <utility>
 
 // Forward declarations, this function is implemented in rust side.
 extern "C" void
@@ -43,6 +54,218 @@ struct RendererKeyHash {
 static std::unordered_map<RendererKey, CustomRendererCallbacks, RendererKeyHash>
     g_custom_renderer_callbacks;
 
+// Opt-in bitmap cache of rendered custom cells, LRU by a pixel memory budget.
+namespace {
+
+struct RenderCacheKey {
+    void* item;
+    unsigned int column;
+    size_t value_hash;
+    int width;
+    int height;
+    int state;
+
+    bool
+    operator==(const RenderCacheKey& other) const
+    {
+        return item == other.item && column == other.column && value_hash == other.value_hash &&
+               width == other.width && height == other.height && state == other.state;
+    }
+};
+
+struct RenderCacheKeyHash {
+    size_t
+    operator()(const RenderCacheKey& key) const
+    {
+        size_t h = std::hash<void*>()(key.item);
+        for (size_t part : { static_cast<size_t>(key.column), key.value_hash,
+                             static_cast<size_t>(key.width), static_cast<size_t>(key.height),
+                             static_cast<size_t>(key.state) }) {
+            h ^= part + 0x9e3779b9 + (h << 6) + (h >> 2);
+        }
+        return h;
+    }
+};
+
+class RenderCache : public wxd_cache_registry::Cache {
+public:
+    explicit RenderCache(size_t budget_bytes) : Cache("dataview_render"), m_budget(budget_bytes)
+    {
+    }
+
+    const wxBitmap*
+    Find(const RenderCacheKey& key)
+    {
+        auto it = m_index.find(key);
+        if (it == m_index.end())
+            return nullptr;
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return &m_entries.front().second;
+    }
+
+    void
+    Store(const RenderCacheKey& key, const wxBitmap& bitmap)
+    {
+        const size_t cost = Cost(key);
+        if (cost > m_budget || m_index.count(key))
+            return;
+        while (m_used + cost > m_budget && !m_entries.empty()) {
+            Erase(std::prev(m_entries.end()));
+        }
+        m_entries.emplace_front(key, bitmap);
+        m_index.emplace(key, m_entries.begin());
+        m_used += cost;
+    }
+
+    // Drops every entry of `item`, or everything when `item` is null.
+    void
+    Invalidate(void* item)
+    {
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            auto next = std::next(it);
+            if (!item || it->first.item == item)
+                Erase(it);
+            it = next;
+        }
+    }
+
+    size_t
+    CacheBytes() const override
+    {
+        return m_used;
+    }
+
+    size_t
+    CacheEntries() const override
+    {
+        return m_entries.size();
+    }
+
+    void
+    Trim(wxd_TrimLevel level) override
+    {
+        const size_t keep = level == WXD_TRIM_MODERATE ? m_used / 2 : 0;
+        while (m_used > keep && !m_entries.empty())
+            Erase(std::prev(m_entries.end()));
+    }
+
+private:
+    using Entry = std::pair<RenderCacheKey, wxBitmap>;
+
+    static size_t
+    Cost(const RenderCacheKey& key)
+    {
+        return static_cast<size_t>(key.width) * static_cast<size_t>(key.height) * 4;
+    }
+
+    void
+    Erase(std::list<Entry>::iterator it)
+    {
+        m_used -= Cost(it->first);
+        m_index.erase(it->first);
+        m_entries.erase(it);
+    }
+
+    size_t m_budget;
+    size_t m_used = 0;
+    std::list<Entry> m_entries; // most recently used first
+    std::unordered_map<RenderCacheKey, std::list<Entry>::iterator, RenderCacheKeyHash> m_index;
+};
+
+// Cheap identity for a cell value. Types without a string form hash alike; items showing them
+// are refreshed through wxd_DataViewCustomRenderer_InvalidateRenderCache.
+size_t
+hash_variant(const wxVariant& value)
+{
+    if (value.IsNull())
+        return 0;
+    return wxStringHash()(value.GetType() + wxS(':') + value.MakeString());
+}
+
+// Builds `rows` store lines of `width` cells from `cols` typed packed columns, or from
+// row-major variants when `columns` is null. Returns false, with nothing built, on malformed
+// input.
+bool
+build_lines(size_t rows, uint32_t cols, unsigned int width,
+            const wxd_DataViewPackedColumn* columns, const wxd_Variant_t* const* values,
+            wxVector<wxDataViewListStoreLine*>& lines)
+{
+    if (columns) {
+        for (uint32_t col = 0; col < cols; ++col) {
+            const wxd_DataViewPackedColumn& column = columns[col];
+            if (rows > 0 && !column.data && column.kind != WXD_VARIANT_VALUE_NULL)
+                return false;
+            if (column.kind == WXD_VARIANT_VALUE_STRING && rows > 0 && !column.offsets)
+                return false;
+        }
+    }
+    lines.reserve(lines.size() + rows);
+    for (size_t row = 0; row < rows; ++row) {
+        auto* line = new wxDataViewListStoreLine();
+        // Cells past `cols` stay null rather than leaving the row short of the store's columns.
+        line->m_values.resize(std::max<unsigned int>(cols, width));
+        for (uint32_t col = 0; col < cols; ++col) {
+            wxVariant& cell = line->m_values[col];
+            if (!columns) {
+                if (const wxd_Variant_t* value = values[row * cols + col])
+                    cell = *reinterpret_cast<const wxVariant*>(value);
+                continue;
+            }
+            const wxd_DataViewPackedColumn& column = columns[col];
+            switch (column.kind) {
+            case WXD_VARIANT_VALUE_BOOL:
+                cell = static_cast<const bool*>(column.data)[row];
+                break;
+            case WXD_VARIANT_VALUE_INT64:
+                cell = wxLongLong(static_cast<const int64_t*>(column.data)[row]);
+                break;
+            case WXD_VARIANT_VALUE_DOUBLE:
+                cell = static_cast<const double*>(column.data)[row];
+                break;
+            case WXD_VARIANT_VALUE_STRING: {
+                const uint32_t begin = column.offsets[row];
+                const uint32_t end = std::max(column.offsets[row + 1], begin);
+                cell = wxString::FromUTF8(static_cast<const char*>(column.data) + begin,
+                                          end - begin);
+                break;
+            }
+            default:
+                break;
+            }
+        }
+        lines.push_back(line);
+    }
+    return true;
+}
+
+// Appends the lines to the store with a single notification: the index model has no ranged
+// add, so the store is reset, which costs one control rebuild instead of one per row.
+void
+append_lines(wxDataViewListStore* store, const wxVector<wxDataViewListStoreLine*>& lines)
+{
+    if (lines.empty())
+        return;
+    for (wxDataViewListStoreLine* line : lines) {
+        store->m_data.push_back(line);
+    }
+    store->Reset(static_cast<unsigned int>(store->m_data.size()));
+}
+
+bool
+append_rows(wxDataViewListStore* store, size_t rows, uint32_t cols,
+            const wxd_DataViewPackedColumn* columns, const wxd_Variant_t* const* values)
+{
+    if (!store || (!columns && !values && rows > 0))
+        return false;
+    wxVector<wxDataViewListStoreLine*> lines;
+    if (!build_lines(rows, cols, store->GetColumnCount(), columns, values, lines))
+        return false;
+    append_lines(store, lines);
+    return true;
+}
+
+} // namespace
+
 extern "C" {
 
 // Function to clean up all callbacks for a specific dataview ID
@@ -329,11 +552,12 @@ public:
     typedef wxd_Size_t (*GetSizeCallback)(void* user_data);
     typedef bool (*RenderCallback)(void* user_data, wxd_Rect_t cell, void* dc, int state);
     typedef bool (*SetValueCallback)(void* user_data, const wxd_Variant_t* value);
-    typedef wxd_Variant_t* (*GetValueCallback)(void* user_data);
+    typedef bool (*GetValueCallback)(void* user_data, wxd_Variant_t* out);
     typedef bool (*HasEditorCtrlCallback)(void* user_data);
     typedef void* (*CreateEditorCtrlCallback)(void* user_data, void* parent, wxd_Rect_t label_rect,
                                               const wxd_Variant_t* value);
-    typedef wxd_Variant_t* (*GetValueFromEditorCtrlCallback)(void* user_data, void* editor);
+    typedef bool (*GetValueFromEditorCtrlCallback)(void* user_data, void* editor,
+                                                   wxd_Variant_t* out);
     typedef bool (*ActivateCellCallback)(void* user_data, wxd_Rect_t cell, void* model, void* item,
                                          unsigned int col, void* mouse_event);
 
@@ -374,9 +598,39 @@ public:
         return wxSize(80, 20); // Default size
     }
 
+    virtual bool
+    PrepareForItem(const wxDataViewModel* model, const wxDataViewItem& item,
+                   unsigned column) override
+    {
+        m_item_id = item.GetID();
+        m_column = column;
+        return wxDataViewCustomRenderer::PrepareForItem(model, item, column);
+    }
+
+    void
+    EnableRenderCache(size_t budget_bytes)
+    {
+        if (budget_bytes == 0)
+            m_render_cache.reset();
+        else
+            m_render_cache = std::make_unique<RenderCache>(budget_bytes);
+    }
+
+    void
+    InvalidateRenderCache(void* item)
+    {
+        if (m_render_cache)
+            m_render_cache->Invalidate(item);
+    }
+
     virtual bool
     Render(wxRect cell, wxDC* dc, int state) override
     {
+#if wxUSE_GRAPHICS_CONTEXT
+        if (m_render_cache && m_render_callback && m_user_data && cell.width > 0 &&
+            cell.height > 0)
+            return RenderCached(cell, dc, state);
+#endif
         if (m_render_callback && m_user_data) {
             wxd_Rect_t cell_rect = { cell.x, cell.y, cell.width, cell.height };
             bool result = m_render_callback(m_user_data, cell_rect, dc, state);
@@ -388,6 +642,8 @@ public:
     virtual bool
     SetValue(const wxVariant& value) override
     {
+        if (m_render_cache)
+            m_value_hash = hash_variant(value);
         if (m_set_value_callback && m_user_data) {
             const wxd_Variant_t* var_data = reinterpret_cast<const wxd_Variant_t*>(&value);
             return m_set_value_callback(m_user_data, var_data);
@@ -399,13 +655,8 @@ public:
     GetValue(wxVariant& value) const override
     {
         if (m_get_value_callback && m_user_data) {
-            wxd_Variant_t* var_data = m_get_value_callback(m_user_data);
-            if (!var_data)
-                return false;
-
-            value = *reinterpret_cast<wxVariant*>(var_data);
-            delete reinterpret_cast<wxVariant*>(var_data);
-            return true;
+            // Filled in place, no intermediate variant
+            return m_get_value_callback(m_user_data, reinterpret_cast<wxd_Variant_t*>(&value));
         }
         // No callback available, return an empty string variant
         value = wxString();
@@ -441,12 +692,8 @@ public:
     GetValueFromEditorCtrl(wxWindow* editor, wxVariant& value) override
     {
         if (m_get_value_from_editor_callback && m_user_data && editor) {
-            wxd_Variant_t* var_data = m_get_value_from_editor_callback(m_user_data, editor);
-            if (var_data) {
-                value = *reinterpret_cast<wxVariant*>(var_data);
-                delete reinterpret_cast<wxVariant*>(var_data);
-                return true;
-            }
+            return m_get_value_from_editor_callback(m_user_data, editor,
+                                                    reinterpret_cast<wxd_Variant_t*>(&value));
         }
         return false;
     }
@@ -465,6 +712,45 @@ public:
     }
 
 private:
+#if wxUSE_GRAPHICS_CONTEXT
+    // Draws the cell into a transparent bitmap once and blits it on later paints of the same
+    // (item, column, value, size, state).
+    bool
+    RenderCached(const wxRect& cell, wxDC* dc, int state)
+    {
+        const RenderCacheKey key{ m_item_id,   m_column,    m_value_hash,
+                                  cell.width, cell.height, state };
+        if (const wxBitmap* cached = m_render_cache->Find(key)) {
+            dc->DrawBitmap(*cached, cell.x, cell.y, true);
+            return true;
+        }
+
+        wxImage image(cell.width, cell.height);
+        image.InitAlpha();
+        std::memset(image.GetAlpha(), 0, static_cast<size_t>(cell.width) * cell.height);
+        wxBitmap bitmap(image, 32);
+        bool rendered = false;
+        {
+            wxMemoryDC memory(bitmap);
+            wxGCDC gc(memory);
+            // The callback draws in the control's coordinates; shift them onto the bitmap.
+            gc.SetDeviceOrigin(-cell.x, -cell.y);
+            gc.SetFont(dc->GetFont());
+            gc.SetTextForeground(dc->GetTextForeground());
+            gc.SetTextBackground(dc->GetTextBackground());
+            gc.SetPen(dc->GetPen());
+            gc.SetBrush(dc->GetBrush());
+            wxd_Rect_t cell_rect = { cell.x, cell.y, cell.width, cell.height };
+            rendered = m_render_callback(m_user_data, cell_rect, static_cast<wxDC*>(&gc), state);
+        }
+        if (!rendered)
+            return false;
+        dc->DrawBitmap(bitmap, cell.x, cell.y, true);
+        m_render_cache->Store(key, bitmap);
+        return true;
+    }
+#endif
+
     void* m_user_data;
     GetSizeCallback m_get_size_callback;
     RenderCallback m_render_callback;
@@ -474,6 +760,11 @@ private:
     CreateEditorCtrlCallback m_create_editor_callback;
     GetValueFromEditorCtrlCallback m_get_value_from_editor_callback;
     ActivateCellCallback m_activate_cell_callback;
+
+    std::unique_ptr<RenderCache> m_render_cache;
+    void* m_item_id = nullptr;
+    unsigned int m_column = 0;
+    size_t m_value_hash = 0;
 };
 
 // Custom renderer creation
@@ -508,6 +799,26 @@ wxd_DataViewCustomRenderer_Create(
     }
 }
 
+WXD_EXPORTED void
+wxd_DataViewCustomRenderer_EnableRenderCache(wxd_DataViewRenderer_t* renderer,
+                                             size_t budgetBytes)
+{
+    auto* custom = dynamic_cast<WxdDataViewCustomRenderer*>(
+        reinterpret_cast<wxDataViewRenderer*>(renderer));
+    if (custom)
+        custom->EnableRenderCache(budgetBytes);
+}
+
+WXD_EXPORTED void
+wxd_DataViewCustomRenderer_InvalidateRenderCache(wxd_DataViewRenderer_t* renderer,
+                                                 const void* itemId)
+{
+    auto* custom = dynamic_cast<WxdDataViewCustomRenderer*>(
+        reinterpret_cast<wxDataViewRenderer*>(renderer));
+    if (custom)
+        custom->InvalidateRenderCache(const_cast<void*>(itemId));
+}
+
 // Function to release callbacks by renderer ID (no longer needed with direct storage)
 WXD_EXPORTED void
 wxd_DataViewCustomRenderer_ReleaseCallbacksByKey(int32_t renderer_id)
@@ -588,6 +899,7 @@ public:
             return;
         // Convert wxd_Variant_t to wxVariant
         variant = *reinterpret_cast<wxVariant*>(wxd_variant);
+        wxd_objstats::untrack(WXD_OBJECT_KIND_VARIANT, reinterpret_cast<wxVariant*>(wxd_variant));
         delete reinterpret_cast<wxVariant*>(wxd_variant);
     }
 
@@ -823,6 +1135,26 @@ wxd_DataViewListModel_AppendRow(wxd_DataViewModel_t* self)
     return true;
 }
 
+WXD_EXPORTED bool
+wxd_DataViewListModel_AppendRows(wxd_DataViewModel_t* self, const wxd_Variant_t* const* values,
+                                 size_t rows, uint32_t cols)
+{
+    if (!self)
+        return false;
+    return append_rows(reinterpret_cast<WxDDataViewListModel*>(self), rows, cols, nullptr, values);
+}
+
+WXD_EXPORTED bool
+wxd_DataViewListModel_AppendRowsPacked(wxd_DataViewModel_t* self,
+                                       const wxd_DataViewPackedColumn* columns, uint32_t cols,
+                                       size_t rows)
+{
+    if (!self || (!columns && cols > 0))
+        return false;
+    return append_rows(reinterpret_cast<WxDDataViewListModel*>(self), rows, cols, columns,
+                       nullptr);
+}
+
 WXD_EXPORTED bool
 wxd_DataViewListModel_SetValue(wxd_DataViewModel_t* self, size_t row, size_t col,
                                const wxd_Variant_t* variant)
@@ -1312,7 +1644,7 @@ wxd_DataViewListModel_GetValue(wxd_DataViewModel_t* self, size_t row, size_t col
 
     // Allocate a new wxVariant on the heap and return it
     wxVariant* result = new wxVariant(value);
-    return reinterpret_cast<wxd_Variant_t*>(result);
+    return reinterpret_cast<wxd_Variant_t*>(wxd_objstats::track(WXD_OBJECT_KIND_VARIANT, result));
 }
 
 // =============================================================================
@@ -1343,6 +1675,26 @@ wxd_DataViewListCtrl_AppendItem(wxd_Window_t* self, const wxd_Variant_t* const*
     return true;
 }
 
+WXD_EXPORTED bool
+wxd_DataViewListCtrl_AppendItems(wxd_Window_t* self, const wxd_Variant_t* const* values,
+                                 size_t rows, uint32_t cols)
+{
+    if (!self)
+        return false;
+    wxDataViewListCtrl* ctrl = reinterpret_cast<wxDataViewListCtrl*>(self);
+    return append_rows(ctrl->GetStore(), rows, cols, nullptr, values);
+}
+
+WXD_EXPORTED bool
+wxd_DataViewListCtrl_AppendItemsPacked(wxd_Window_t* self, const wxd_DataViewPackedColumn* columns,
+                                       uint32_t cols, size_t rows)
+{
+    if (!self || (!columns && cols > 0))
+        return false;
+    wxDataViewListCtrl* ctrl = reinterpret_cast<wxDataViewListCtrl*>(self);
+    return append_rows(ctrl->GetStore(), rows, cols, columns, nullptr);
+}
+
 WXD_EXPORTED bool
 wxd_DataViewListCtrl_PrependItem(wxd_Window_t* self, const wxd_Variant_t* const* values,
                                  uint32_t count, uintptr_t data)
@@ -1441,7 +1793,7 @@ wxd_DataViewListCtrl_GetValue(wxd_Window_t* self, uint32_t row, uint32_t col)
     ctrl->GetValue(value, row, col);
 
     wxVariant* result = new wxVariant(value);
-    return reinterpret_cast<wxd_Variant_t*>(result);
+    return reinterpret_cast<wxd_Variant_t*>(wxd_objstats::track(WXD_OBJECT_KIND_VARIANT, result));
 }
 
 // Thread-local storage for GetTextValue return string
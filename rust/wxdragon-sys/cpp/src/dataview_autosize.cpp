@@ -0,0 +1,203 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_dataview_row_cache.h"
+#include "wxd_dataview_rows.h"
+#include <wx/dataview.h>
+#include <wx/renderer.h>
+#include <wx/wupdlock.h>
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+using wxd_dataview_rows::DisplayedRows;
+using wxd_dataview_rows::Row;
+
+// Room around the cell content and the header text (which also leaves space for the sort
+// arrow).
+constexpr int kCellMargin = 8;
+constexpr int kHeaderMargin = 24;
+
+std::vector<size_t>
+sample_rows(wxDataViewCtrl* ctrl, const DisplayedRows& rows,
+            const wxd_DataViewAutoSizeSample& sample)
+{
+    const size_t count = rows.Count();
+    std::vector<size_t> picked;
+    if (count == 0)
+        return picked;
+    if (sample.visible_rows) {
+        const size_t top = rows.IndexOf(ctrl->GetTopItem());
+        const size_t per_page = static_cast<size_t>(std::max(ctrl->GetCountPerPage(), 1));
+        if (top < count) {
+            for (size_t i = top; i < std::min(count, top + per_page + 1); ++i)
+                picked.push_back(i);
+        }
+    }
+    for (size_t i = 0; i < std::min<size_t>(std::max(sample.head_rows, 0), count); ++i)
+        picked.push_back(i);
+    const size_t tail = std::min<size_t>(std::max(sample.tail_rows, 0), count);
+    for (size_t i = count - tail; i < count; ++i)
+        picked.push_back(i);
+    if (sample.stride_rows > 0) {
+        const size_t strides = std::min<size_t>(sample.stride_rows, count);
+        for (size_t i = 0; i < strides; ++i)
+            picked.push_back(static_cast<size_t>(static_cast<uint64_t>(i) * count / strides));
+    }
+    std::sort(picked.begin(), picked.end());
+    picked.erase(std::unique(picked.begin(), picked.end()), picked.end());
+    return picked;
+}
+
+int
+measure_cell(wxDataViewCtrl* ctrl, wxDataViewColumn* column, const Row& row)
+{
+    wxDataViewModel* model = ctrl->GetModel();
+    const unsigned int model_col = column->GetModelColumn();
+    if (!model->HasValue(row.item, model_col))
+        return 0;
+    wxDataViewRenderer* renderer = column->GetRenderer();
+    int width = 0;
+    // Custom renderers (and all of the generic port's) report their own size; native ones
+    // are approximated by the text of the value.
+    if (auto* custom = dynamic_cast<wxDataViewCustomRendererBase*>(renderer)) {
+        custom->PrepareForItem(model, row.item, model_col);
+        width = custom->GetSize().GetWidth();
+    }
+    else {
+        wxVariant value;
+        model->GetValue(value, row.item, model_col);
+        if (value.GetType() == wxS("wxDataViewIconText")) {
+            wxDataViewIconText icon_text;
+            icon_text << value;
+            width = ctrl->GetTextExtent(icon_text.GetText()).GetWidth();
+            if (icon_text.GetIcon().IsOk())
+                width += icon_text.GetIcon().GetWidth() + 4;
+        }
+        else if (value.GetType() == wxS("bool")) {
+            width = wxRendererNative::Get().GetCheckBoxSize(ctrl).GetWidth();
+        }
+        else if (!value.IsNull()) {
+            width = ctrl->GetTextExtent(value.MakeString()).GetWidth();
+        }
+    }
+    if (column == ctrl->GetExpanderColumn() && !model->IsListModel()) {
+        width += ctrl->GetIndent() * row.depth +
+                 wxRendererNative::Get().GetExpanderSize(ctrl).GetWidth();
+    }
+    return width;
+}
+
+int
+autosize_column(wxDataViewCtrl* ctrl, wxDataViewColumn* column, const DisplayedRows& rows,
+                const std::vector<size_t>& picked)
+{
+    // A column scrolled out of the projection still has to be measured.
+    wxd_dataview_row_cache::FullColumnsScope full_columns;
+    int width = 0;
+    for (size_t index : picked)
+        width = std::max(width, measure_cell(ctrl, column, rows.At(index)));
+    width += kCellMargin;
+    if (!column->GetTitle().empty())
+        width = std::max(width,
+                         ctrl->GetTextExtent(column->GetTitle()).GetWidth() + kHeaderMargin);
+    width = std::max(width, column->GetMinWidth());
+    column->SetWidth(width);
+    return width;
+}
+
+void
+collect_expanded(wxDataViewCtrl* ctrl, wxDataViewModel* model, const wxDataViewItem& parent,
+                 std::vector<void*>& out)
+{
+    wxDataViewItemArray children;
+    model->GetChildren(parent, children);
+    for (const wxDataViewItem& child : children) {
+        if (model->IsContainer(child) && ctrl->IsExpanded(child)) {
+            out.push_back(child.GetID());
+            collect_expanded(ctrl, model, child, out);
+        }
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+WXD_EXPORTED int
+wxd_DataViewCtrl_AutoSizeColumnSampled(wxd_Window_t* self, wxd_DataViewColumn_t* column,
+                                       const wxd_DataViewAutoSizeSample* sample)
+{
+    wxDataViewCtrl* ctrl = reinterpret_cast<wxDataViewCtrl*>(self);
+    wxDataViewColumn* col = reinterpret_cast<wxDataViewColumn*>(column);
+    if (!ctrl || !col || !sample || !ctrl->GetModel())
+        return -1;
+    DisplayedRows rows(ctrl);
+    return autosize_column(ctrl, col, rows, sample_rows(ctrl, rows, *sample));
+}
+
+WXD_EXPORTED void
+wxd_DataViewCtrl_AutoSizeColumnsSampled(wxd_Window_t* self,
+                                        const wxd_DataViewAutoSizeSample* sample)
+{
+    wxDataViewCtrl* ctrl = reinterpret_cast<wxDataViewCtrl*>(self);
+    if (!ctrl || !sample || !ctrl->GetModel())
+        return;
+    // The rows are walked and sampled once for all columns.
+    DisplayedRows rows(ctrl);
+    const std::vector<size_t> picked = sample_rows(ctrl, rows, *sample);
+    wxWindowUpdateLocker lock(ctrl);
+    for (unsigned int i = 0; i < ctrl->GetColumnCount(); ++i) {
+        wxDataViewColumn* column = ctrl->GetColumn(i);
+        if (column && column->IsShown())
+            autosize_column(ctrl, column, rows, picked);
+    }
+}
+
+WXD_EXPORTED void
+wxd_DataViewCtrl_ExpandItems(wxd_Window_t* self, const wxd_DataViewItem_t* const* items,
+                             size_t count)
+{
+    wxDataViewCtrl* ctrl = reinterpret_cast<wxDataViewCtrl*>(self);
+    if (!ctrl || !items || count == 0 || !ctrl->GetModel())
+        return;
+    wxDataViewModel* model = ctrl->GetModel();
+    // Ancestors first: expanding a child of a collapsed node would expand the chain above it
+    // item by item instead.
+    std::vector<std::pair<int, wxDataViewItem>> ordered;
+    ordered.reserve(count);
+    std::unordered_set<void*> seen;
+    for (size_t i = 0; i < count; ++i) {
+        const wxDataViewItem* item = reinterpret_cast<const wxDataViewItem*>(items[i]);
+        if (!item || !item->IsOk() || !seen.insert(item->GetID()).second)
+            continue;
+        int depth = 0;
+        for (wxDataViewItem p = model->GetParent(*item); p.IsOk(); p = model->GetParent(p))
+            ++depth;
+        ordered.emplace_back(depth, *item);
+    }
+    std::stable_sort(ordered.begin(), ordered.end(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+    wxWindowUpdateLocker lock(ctrl);
+    for (const auto& [depth, item] : ordered) {
+        if (!ctrl->IsExpanded(item))
+            ctrl->Expand(item);
+    }
+}
+
+WXD_EXPORTED size_t
+wxd_DataViewCtrl_GetExpandedItems(wxd_Window_t* self, void** ids, size_t capacity)
+{
+    wxDataViewCtrl* ctrl = reinterpret_cast<wxDataViewCtrl*>(self);
+    if (!ctrl || !ctrl->GetModel() || ctrl->GetModel()->IsListModel())
+        return 0;
+    std::vector<void*> expanded;
+    collect_expanded(ctrl, ctrl->GetModel(), wxDataViewItem(), expanded);
+    if (ids)
+        std::copy_n(expanded.begin(), std::min(capacity, expanded.size()), ids);
+    return expanded.size();
+}
+
+} // extern "C"
@@ -0,0 +1,168 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_dataview_row_cache.h"
+#include <wx/dataview.h>
+#include <algorithm>
+#include <climits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// Column projection: keeps a custom virtual list model's projection at the columns its control
+// shows, so the model's callbacks are not asked for cells nobody can see. With the generic
+// control the projection follows horizontal scrolling; native controls do not report their
+// scroll position, so there it covers every shown column of nonzero width.
+
+namespace {
+
+class ProjectionTracker {
+public:
+    explicit ProjectionTracker(wxDataViewCtrl* ctrl) : m_ctrl(ctrl)
+    {
+        m_ctrl->Bind(wxEVT_SIZE, &ProjectionTracker::OnSize, this);
+        m_ctrl->Bind(wxEVT_DATAVIEW_COLUMN_REORDERED, &ProjectionTracker::OnReordered, this);
+#ifdef wxHAS_GENERIC_DATAVIEWCTRL
+        // Dynamic handlers run before the window's own paint handler, so a column scrolled into
+        // view is projected before it is drawn.
+        if (wxWindow* main = m_ctrl->GetMainWindow())
+            main->Bind(wxEVT_PAINT, &ProjectionTracker::OnPaint, this);
+#endif
+        Update();
+    }
+
+    ~ProjectionTracker()
+    {
+        m_ctrl->Unbind(wxEVT_SIZE, &ProjectionTracker::OnSize, this);
+        m_ctrl->Unbind(wxEVT_DATAVIEW_COLUMN_REORDERED, &ProjectionTracker::OnReordered, this);
+#ifdef wxHAS_GENERIC_DATAVIEWCTRL
+        if (wxWindow* main = m_ctrl->GetMainWindow())
+            main->Unbind(wxEVT_PAINT, &ProjectionTracker::OnPaint, this);
+#endif
+        SetModelProjection({});
+    }
+
+    // Recomputes the projected columns from the current layout.
+    void
+    Update()
+    {
+        std::vector<wxDataViewColumn*> columns;
+        for (unsigned int i = 0; i < m_ctrl->GetColumnCount(); ++i) {
+            wxDataViewColumn* column = m_ctrl->GetColumn(i);
+            if (column && !column->IsHidden() && column->GetWidth() > 0)
+                columns.push_back(column);
+        }
+        std::sort(columns.begin(), columns.end(),
+                  [this](wxDataViewColumn* a, wxDataViewColumn* b) {
+                      return m_ctrl->GetColumnPosition(a) < m_ctrl->GetColumnPosition(b);
+                  });
+
+        int first = 0;
+        int last = INT_MAX;
+#ifdef wxHAS_GENERIC_DATAVIEWCTRL
+        if (wxWindow* main = m_ctrl->GetMainWindow()) {
+            first = m_ctrl->CalcUnscrolledPosition(wxPoint(0, 0)).x;
+            last = first + main->GetClientSize().x;
+        }
+#endif
+        std::vector<uint8_t> visible;
+        int x = 0;
+        for (wxDataViewColumn* column : columns) {
+            const int right = x + column->GetWidth();
+            if (right > first && x < last) {
+                const unsigned int model_column = column->GetModelColumn();
+                if (model_column >= visible.size())
+                    visible.resize(static_cast<size_t>(model_column) + 1, 0);
+                visible[model_column] = 1;
+            }
+            x = right;
+        }
+        // Nothing in view (e.g. no columns yet) still projects out every column.
+        if (visible.empty())
+            visible.push_back(0);
+        SetModelProjection(std::move(visible));
+    }
+
+private:
+    void
+    SetModelProjection(std::vector<uint8_t> visible)
+    {
+        if (auto* model = dynamic_cast<wxDataViewVirtualListModel*>(m_ctrl->GetModel()))
+            wxd_dataview_row_cache::set_projection(model, std::move(visible));
+    }
+
+    void
+    OnSize(wxSizeEvent& event)
+    {
+        event.Skip();
+        Update();
+    }
+
+    void
+    OnReordered(wxDataViewEvent& event)
+    {
+        event.Skip();
+        Update();
+    }
+
+    void
+    OnPaint(wxPaintEvent& event)
+    {
+        event.Skip();
+        Update();
+    }
+
+    wxDataViewCtrl* m_ctrl;
+};
+
+std::unordered_map<wxDataViewCtrl*, std::unique_ptr<ProjectionTracker>>&
+trackers()
+{
+    static std::unordered_map<wxDataViewCtrl*, std::unique_ptr<ProjectionTracker>> map;
+    return map;
+}
+
+void
+on_projected_ctrl_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    if (wxDataViewCtrl* ctrl = wxDynamicCast(event.GetEventObject(), wxDataViewCtrl))
+        trackers().erase(ctrl);
+}
+
+} // namespace
+
+extern "C" {
+
+WXD_EXPORTED bool
+wxd_DataViewCtrl_EnableColumnProjection(wxd_Window_t* self, bool enable)
+{
+    wxDataViewCtrl* ctrl = wxDynamicCast(reinterpret_cast<wxWindow*>(self), wxDataViewCtrl);
+    if (!ctrl)
+        return false;
+    auto& map = trackers();
+    auto it = map.find(ctrl);
+    if (!enable) {
+        if (it != map.end()) {
+            map.erase(it);
+            ctrl->Unbind(wxEVT_DESTROY, on_projected_ctrl_destroy);
+        }
+        return true;
+    }
+    if (it == map.end()) {
+        ctrl->Bind(wxEVT_DESTROY, on_projected_ctrl_destroy);
+        map.emplace(ctrl, std::make_unique<ProjectionTracker>(ctrl));
+    }
+    return true;
+}
+
+WXD_EXPORTED void
+wxd_DataViewCtrl_UpdateColumnProjection(wxd_Window_t* self)
+{
+    auto& map = trackers();
+    auto it = map.find(wxDynamicCast(reinterpret_cast<wxWindow*>(self), wxDataViewCtrl));
+    if (it != map.end())
+        it->second->Update();
+}
+
+} // extern "C"
@@ -0,0 +1,595 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_dataview_snapshot.h"
+#include <wx/dataview.h>
+#include <algorithm>
+#include <cstring>
+#include <unordered_set>
+
+struct wxd_DataViewSnapshotPublisher_t {
+    std::shared_ptr<wxd_dataview_snapshot::Channel> channel;
+};
+
+void
+wxd_DataViewSnapshot_t::Fill(wxVariant& variant, size_t row, unsigned int col) const
+{
+    if (row >= rows || col >= columns.size()) {
+        variant.MakeNull();
+        return;
+    }
+    const Column& column = columns[col];
+    switch (column.kind) {
+    case WXD_VARIANT_VALUE_BOOL:
+        variant = column.ints[row] != 0;
+        break;
+    case WXD_VARIANT_VALUE_INT64:
+        variant = wxLongLong(column.ints[row]);
+        break;
+    case WXD_VARIANT_VALUE_DOUBLE:
+        variant = column.doubles[row];
+        break;
+    case WXD_VARIANT_VALUE_STRING:
+        variant = wxString::FromUTF8(column.text.data() + column.offsets[row],
+                                     column.offsets[row + 1] - column.offsets[row]);
+        break;
+    default:
+        variant.MakeNull();
+        break;
+    }
+}
+
+bool
+wxd_DataViewSnapshot_t::RowEquals(size_t row, const wxd_DataViewSnapshot_t& other,
+                                  size_t other_row) const
+{
+    if (columns.size() != other.columns.size())
+        return false;
+    for (size_t col = 0; col < columns.size(); ++col) {
+        const Column& a = columns[col];
+        const Column& b = other.columns[col];
+        if (a.kind != b.kind)
+            return false;
+        switch (a.kind) {
+        case WXD_VARIANT_VALUE_BOOL:
+        case WXD_VARIANT_VALUE_INT64:
+            if (a.ints[row] != b.ints[other_row])
+                return false;
+            break;
+        case WXD_VARIANT_VALUE_DOUBLE:
+            // Bitwise, so NaN cells do not count as changed on every snapshot.
+            if (std::memcmp(&a.doubles[row], &b.doubles[other_row], sizeof(double)) != 0)
+                return false;
+            break;
+        case WXD_VARIANT_VALUE_STRING: {
+            const uint32_t len = a.offsets[row + 1] - a.offsets[row];
+            if (len != b.offsets[other_row + 1] - b.offsets[other_row] ||
+                std::memcmp(a.text.data() + a.offsets[row], b.text.data() + b.offsets[other_row],
+                            len) != 0)
+                return false;
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    const wxd_DataViewItemAttr_t* attr = Attr(row);
+    const wxd_DataViewItemAttr_t* other_attr = other.Attr(other_row);
+    if (!attr || !other_attr)
+        return !attr == !other_attr;
+    return std::memcmp(attr, other_attr, sizeof(wxd_DataViewItemAttr_t)) == 0;
+}
+
+void
+wxd_DataViewSnapshot_t::BuildTreeIndex()
+{
+    row_of_key.clear();
+    children.clear();
+    row_of_key.reserve(rows);
+    for (size_t row = 0; row < rows; ++row) {
+        row_of_key.emplace(keys[row], row);
+        children[parents[row]].push_back(keys[row]);
+    }
+}
+
+namespace wxd_dataview_snapshot {
+
+namespace {
+
+void
+deliver(const std::shared_ptr<Channel>& channel)
+{
+    std::unique_ptr<Snapshot> snapshot;
+    {
+        std::lock_guard<std::mutex> guard(channel->lock);
+        snapshot = std::move(channel->pending);
+        channel->delivery_posted = false;
+    }
+    if (snapshot && channel->target)
+        channel->target->ApplySnapshot(SnapshotPtr(snapshot.release()));
+}
+
+// Appends `row` to the ascending range list, extending the last range when adjacent.
+void
+add_changed(ListDiff& diff, unsigned int row)
+{
+    if (!diff.changed.empty() && diff.changed.back().second + 1 == row)
+        diff.changed.back().second = row;
+    else
+        diff.changed.emplace_back(row, row);
+}
+
+void
+add_inserted(ListDiff& diff, unsigned int row)
+{
+    if (!diff.inserted.empty() &&
+        diff.inserted.back().first + diff.inserted.back().second == row)
+        ++diff.inserted.back().second;
+    else
+        diff.inserted.emplace_back(row, 1);
+}
+
+} // namespace
+
+void
+publish(const std::shared_ptr<Channel>& channel, std::unique_ptr<Snapshot> snapshot)
+{
+    std::unique_ptr<Snapshot> superseded;
+    bool post = false;
+    {
+        std::lock_guard<std::mutex> guard(channel->lock);
+        superseded = std::move(channel->pending);
+        channel->pending = std::move(snapshot);
+        if (!channel->delivery_posted && wxTheApp) {
+            channel->delivery_posted = true;
+            post = true;
+        }
+    }
+    // The lambda keeps the channel alive; a model destroyed meanwhile has cleared `target`.
+    if (post)
+        wxTheApp->CallAfter([channel]() { deliver(channel); });
+}
+
+Target::~Target()
+{
+    if (m_channel)
+        m_channel->target = nullptr;
+}
+
+std::shared_ptr<Channel>
+Target::GetChannel()
+{
+    if (!m_channel) {
+        m_channel = std::make_shared<Channel>();
+        m_channel->tree = IsTree();
+        m_channel->target = this;
+    }
+    return m_channel;
+}
+
+bool
+apply_attr(const wxd_DataViewItemAttr_t& from, wxDataViewItemAttr& attr)
+{
+    if (from.has_text_colour)
+        attr.SetColour(wxColour(from.text_colour_red, from.text_colour_green,
+                                from.text_colour_blue, from.text_colour_alpha));
+    if (from.has_bg_colour)
+        attr.SetBackgroundColour(wxColour(from.bg_colour_red, from.bg_colour_green,
+                                          from.bg_colour_blue, from.bg_colour_alpha));
+    if (from.bold)
+        attr.SetBold(true);
+    if (from.italic)
+        attr.SetItalic(true);
+    return from.has_text_colour || from.has_bg_colour || from.bold || from.italic;
+}
+
+ListDiff
+diff_rows(const Snapshot& before, const Snapshot& after)
+{
+    ListDiff diff;
+    const size_t old_rows = before.rows;
+    const size_t new_rows = after.rows;
+
+    if (before.keys.empty() || after.keys.empty()) {
+        const size_t common = std::min(old_rows, new_rows);
+        for (size_t row = 0; row < common; ++row) {
+            if (!after.RowEquals(row, before, row))
+                add_changed(diff, static_cast<unsigned int>(row));
+        }
+        for (size_t row = common; row < old_rows; ++row)
+            diff.deleted.push_back(static_cast<unsigned int>(row));
+        if (new_rows > common)
+            diff.inserted.emplace_back(static_cast<unsigned int>(common),
+                                       static_cast<unsigned int>(new_rows - common));
+        return diff;
+    }
+
+    // Matching keys at both ends are paired directly; only the middle needs a lookup.
+    size_t prefix = 0;
+    while (prefix < old_rows && prefix < new_rows && before.keys[prefix] == after.keys[prefix])
+        ++prefix;
+    size_t suffix = 0;
+    while (suffix < old_rows - prefix && suffix < new_rows - prefix &&
+           before.keys[old_rows - 1 - suffix] == after.keys[new_rows - 1 - suffix])
+        ++suffix;
+
+    std::unordered_map<uint64_t, size_t> old_middle;
+    old_middle.reserve(old_rows - prefix - suffix);
+    for (size_t row = prefix; row < old_rows - suffix; ++row)
+        old_middle.emplace(before.keys[row], row);
+
+    std::vector<std::pair<size_t, size_t>> matched; // (old row, new row) in the middle
+    std::vector<bool> kept(old_rows - prefix - suffix, false);
+    for (size_t row = prefix; row < new_rows - suffix; ++row) {
+        auto it = old_middle.find(after.keys[row]);
+        if (it == old_middle.end()) {
+            add_inserted(diff, static_cast<unsigned int>(row));
+            continue;
+        }
+        if (!matched.empty() && it->second < matched.back().first) {
+            diff = ListDiff();
+            diff.reset = true;
+            return diff;
+        }
+        matched.emplace_back(it->second, row);
+        kept[it->second - prefix] = true;
+    }
+    for (size_t row = prefix; row < old_rows - suffix; ++row) {
+        if (!kept[row - prefix])
+            diff.deleted.push_back(static_cast<unsigned int>(row));
+    }
+
+    for (size_t row = 0; row < prefix; ++row) {
+        if (!after.RowEquals(row, before, row))
+            add_changed(diff, static_cast<unsigned int>(row));
+    }
+    for (const auto& [old_row, new_row] : matched) {
+        if (!after.RowEquals(new_row, before, old_row))
+            add_changed(diff, static_cast<unsigned int>(new_row));
+    }
+    for (size_t i = suffix; i-- > 0;) {
+        const size_t new_row = new_rows - 1 - i;
+        if (!after.RowEquals(new_row, before, old_rows - 1 - i))
+            add_changed(diff, static_cast<unsigned int>(new_row));
+    }
+    return diff;
+}
+
+} // namespace wxd_dataview_snapshot
+
+namespace {
+
+using wxd_dataview_snapshot::Snapshot;
+using wxd_dataview_snapshot::SnapshotPtr;
+
+wxDataViewItem
+item_of(uint64_t key)
+{
+    return wxDataViewItem(reinterpret_cast<void*>(static_cast<uintptr_t>(key)));
+}
+
+uint64_t
+key_of(const wxDataViewItem& item)
+{
+    return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(item.GetID()));
+}
+
+// Read-only tree model served entirely from snapshots. Item ids are the row keys, so an item
+// keeps its identity (selection, expansion) across snapshots.
+class WxdSnapshotDataViewTreeModel : public wxDataViewModel,
+                                     public wxd_dataview_snapshot::Target {
+public:
+    WxdSnapshotDataViewTreeModel()
+    {
+        WXD_LOG_TRACEF("WxdSnapshotDataViewTreeModel created with pointer %p", this);
+    }
+
+    unsigned int
+    GetChildren(const wxDataViewItem& parent, wxDataViewItemArray& array) const override
+    {
+        const std::vector<uint64_t>* kids = Children(*m_snapshot, key_of(parent));
+        if (!kids)
+            return 0;
+        array.reserve(array.size() + kids->size());
+        for (uint64_t key : *kids)
+            array.push_back(item_of(key));
+        return static_cast<unsigned int>(kids->size());
+    }
+
+    wxDataViewItem
+    GetParent(const wxDataViewItem& item) const override
+    {
+        auto it = m_snapshot->row_of_key.find(key_of(item));
+        if (it == m_snapshot->row_of_key.end())
+            return wxDataViewItem();
+        return item_of(m_snapshot->parents[it->second]);
+    }
+
+    bool
+    IsContainer(const wxDataViewItem& item) const override
+    {
+        return !item.IsOk() || Children(*m_snapshot, key_of(item)) != nullptr;
+    }
+
+    void
+    GetValue(wxVariant& variant, const wxDataViewItem& item, unsigned int col) const override
+    {
+        auto it = m_snapshot->row_of_key.find(key_of(item));
+        if (it == m_snapshot->row_of_key.end())
+            variant.MakeNull();
+        else
+            m_snapshot->Fill(variant, it->second, col);
+    }
+
+    bool
+    SetValue(const wxVariant&, const wxDataViewItem&, unsigned int) override
+    {
+        return false;
+    }
+
+    bool
+    GetAttr(const wxDataViewItem& item, unsigned int, wxDataViewItemAttr& attr) const override
+    {
+        auto it = m_snapshot->row_of_key.find(key_of(item));
+        if (it == m_snapshot->row_of_key.end())
+            return false;
+        const wxd_DataViewItemAttr_t* rust_attr = m_snapshot->Attr(it->second);
+        if (!rust_attr)
+            return false;
+        return wxd_dataview_snapshot::apply_attr(*rust_attr, attr);
+    }
+
+    // Swaps the snapshot in first (the control queries the model while handling the
+    // notifications), then reports removed subtrees, added items and changed rows per parent.
+    void
+    ApplySnapshot(SnapshotPtr snapshot) override
+    {
+        SnapshotPtr before = std::move(m_snapshot);
+        m_snapshot = std::move(snapshot);
+        if (before->rows == 0 && m_snapshot->rows == 0)
+            return;
+        if (before->rows == 0 || !Diff(*before)) {
+            Cleared();
+        }
+    }
+
+private:
+    static const std::vector<uint64_t>*
+    Children(const Snapshot& snapshot, uint64_t parent)
+    {
+        auto it = snapshot.children.find(parent);
+        return it == snapshot.children.end() ? nullptr : &it->second;
+    }
+
+    // True if `key` has the same parent chain in both snapshots, so the control's node for it
+    // (and its expanded children) stays valid.
+    bool
+    Survives(const Snapshot& before, uint64_t key,
+             std::unordered_map<uint64_t, bool>& memo) const
+    {
+        if (key == 0)
+            return true;
+        auto found = memo.find(key);
+        if (found != memo.end())
+            return found->second;
+        auto old_it = before.row_of_key.find(key);
+        auto new_it = m_snapshot->row_of_key.find(key);
+        bool survives = old_it != before.row_of_key.end() &&
+                        new_it != m_snapshot->row_of_key.end() &&
+                        before.parents[old_it->second] == m_snapshot->parents[new_it->second] &&
+                        Survives(before, before.parents[old_it->second], memo);
+        memo.emplace(key, survives);
+        return survives;
+    }
+
+    // Sends the item notifications turning `before` into the current snapshot; false when
+    // siblings were reordered, which only a full reload can express.
+    bool
+    Diff(const Snapshot& before)
+    {
+        std::unordered_map<uint64_t, bool> memo;
+        std::vector<std::pair<uint64_t, wxDataViewItemArray>> deleted;
+        std::vector<std::pair<uint64_t, wxDataViewItemArray>> added;
+        wxDataViewItemArray changed;
+
+        for (const auto& [parent, old_kids] : before.children) {
+            if (!Survives(before, parent, memo))
+                continue; // Removed with its parent, or never materialised by the control
+            wxDataViewItemArray gone;
+            for (uint64_t key : old_kids) {
+                if (!Survives(before, key, memo))
+                    gone.push_back(item_of(key));
+            }
+            if (!gone.empty())
+                deleted.emplace_back(parent, std::move(gone));
+        }
+
+        for (const auto& [parent, new_kids] : m_snapshot->children) {
+            if (!Survives(before, parent, memo))
+                continue; // New parents are populated when expanded
+            const std::vector<uint64_t>* old_kids = Children(before, parent);
+            size_t next_old = 0;
+            wxDataViewItemArray fresh;
+            for (uint64_t key : new_kids) {
+                if (!Survives(before, key, memo)) {
+                    fresh.push_back(item_of(key));
+                    continue;
+                }
+                // Surviving siblings must keep their relative order.
+                while (old_kids && next_old < old_kids->size() &&
+                       (*old_kids)[next_old] != key)
+                    ++next_old;
+                if (!old_kids || next_old == old_kids->size())
+                    return false;
+                ++next_old;
+                if (!m_snapshot->RowEquals(m_snapshot->row_of_key.at(key), before,
+                                           before.row_of_key.at(key)))
+                    changed.push_back(item_of(key));
+            }
+            if (!fresh.empty())
+                added.emplace_back(parent, std::move(fresh));
+        }
+
+        for (const auto& [parent, items] : deleted)
+            ItemsDeleted(item_of(parent), items);
+        for (const auto& [parent, items] : added)
+            ItemsAdded(item_of(parent), items);
+        if (!changed.empty())
+            ItemsChanged(changed);
+        return true;
+    }
+
+    bool
+    IsTree() const override
+    {
+        return true;
+    }
+
+    SnapshotPtr m_snapshot = std::make_shared<Snapshot>();
+};
+
+} // namespace
+
+extern "C" {
+
+WXD_EXPORTED wxd_DataViewSnapshot_t*
+wxd_DataViewSnapshot_Create(const wxd_DataViewPackedColumn* columns, uint32_t cols, size_t rows)
+{
+    if (!columns && cols > 0)
+        return nullptr;
+    auto snapshot = std::make_unique<Snapshot>();
+    snapshot->rows = rows;
+    snapshot->columns.resize(cols);
+    for (uint32_t col = 0; col < cols; ++col) {
+        const wxd_DataViewPackedColumn& packed = columns[col];
+        Snapshot::Column& column = snapshot->columns[col];
+        column.kind = packed.kind;
+        if (rows > 0 && !packed.data && packed.kind != WXD_VARIANT_VALUE_NULL)
+            return nullptr;
+        switch (packed.kind) {
+        case WXD_VARIANT_VALUE_BOOL: {
+            const bool* values = static_cast<const bool*>(packed.data);
+            column.ints.assign(values, values + rows);
+            break;
+        }
+        case WXD_VARIANT_VALUE_INT64: {
+            const int64_t* values = static_cast<const int64_t*>(packed.data);
+            column.ints.assign(values, values + rows);
+            break;
+        }
+        case WXD_VARIANT_VALUE_DOUBLE: {
+            const double* values = static_cast<const double*>(packed.data);
+            column.doubles.assign(values, values + rows);
+            break;
+        }
+        case WXD_VARIANT_VALUE_STRING: {
+            if (rows > 0 && !packed.offsets)
+                return nullptr;
+            column.offsets.assign(packed.offsets, packed.offsets + rows + 1);
+            const uint32_t base = rows > 0 ? column.offsets.front() : 0;
+            for (uint32_t& offset : column.offsets) {
+                if (offset < base)
+                    return nullptr;
+                offset -= base;
+            }
+            if (!std::is_sorted(column.offsets.begin(), column.offsets.end()))
+                return nullptr;
+            if (rows > 0)
+                column.text.assign(static_cast<const char*>(packed.data) + base,
+                                   column.offsets.back());
+            break;
+        }
+        default:
+            column.kind = WXD_VARIANT_VALUE_NULL;
+            break;
+        }
+    }
+    return snapshot.release();
+}
+
+WXD_EXPORTED bool
+wxd_DataViewSnapshot_SetKeys(wxd_DataViewSnapshot_t* snapshot, const uint64_t* keys,
+                             size_t count)
+{
+    if (!snapshot || count != snapshot->rows || (!keys && count > 0))
+        return false;
+    std::unordered_set<uint64_t> seen;
+    seen.reserve(count);
+    for (size_t row = 0; row < count; ++row) {
+        if (!seen.insert(keys[row]).second)
+            return false;
+    }
+    snapshot->keys.assign(keys, keys + count);
+    return true;
+}
+
+WXD_EXPORTED bool
+wxd_DataViewSnapshot_SetParents(wxd_DataViewSnapshot_t* snapshot, const uint64_t* parents,
+                                size_t count)
+{
+    if (!snapshot || count != snapshot->rows || (!parents && count > 0))
+        return false;
+    snapshot->parents.assign(parents, parents + count);
+    return true;
+}
+
+WXD_EXPORTED bool
+wxd_DataViewSnapshot_SetRowAttrs(wxd_DataViewSnapshot_t* snapshot,
+                                 const wxd_DataViewItemAttr_t* attrs, size_t count)
+{
+    if (!snapshot || count != snapshot->rows || (!attrs && count > 0))
+        return false;
+    snapshot->attrs.assign(attrs, attrs + count);
+    return true;
+}
+
+WXD_EXPORTED void
+wxd_DataViewSnapshot_Destroy(wxd_DataViewSnapshot_t* snapshot)
+{
+    delete snapshot;
+}
+
+WXD_EXPORTED wxd_DataViewSnapshotPublisher_t*
+wxd_DataViewModel_CreateSnapshotPublisher(wxd_DataViewModel_t* model)
+{
+    auto* target =
+        dynamic_cast<wxd_dataview_snapshot::Target*>(reinterpret_cast<wxDataViewModel*>(model));
+    if (!target)
+        return nullptr;
+    return new wxd_DataViewSnapshotPublisher_t{ target->GetChannel() };
+}
+
+WXD_EXPORTED bool
+wxd_DataViewSnapshotPublisher_Publish(wxd_DataViewSnapshotPublisher_t* publisher,
+                                      wxd_DataViewSnapshot_t* snapshot)
+{
+    std::unique_ptr<Snapshot> owned(snapshot);
+    if (!publisher || !owned)
+        return false;
+    if (publisher->channel->tree) {
+        // Tree snapshots need unique non-zero keys; without parents every row is top level.
+        // The index is built here, off the GUI thread.
+        if (owned->keys.size() != owned->rows ||
+            std::find(owned->keys.begin(), owned->keys.end(), 0) != owned->keys.end())
+            return false;
+        if (owned->parents.empty())
+            owned->parents.assign(owned->rows, 0);
+        owned->BuildTreeIndex();
+    }
+    wxd_dataview_snapshot::publish(publisher->channel, std::move(owned));
+    return true;
+}
+
+WXD_EXPORTED void
+wxd_DataViewSnapshotPublisher_Destroy(wxd_DataViewSnapshotPublisher_t* publisher)
+{
+    delete publisher;
+}
+
+WXD_EXPORTED wxd_DataViewModel_t*
+wxd_DataViewTreeModel_CreateSnapshot()
+{
+    return reinterpret_cast<wxd_DataViewModel_t*>(new WxdSnapshotDataViewTreeModel());
+}
+
+} // extern "C"
@@ -40,8 +40,9 @@ wxd_DataViewTreeCtrl_new(
     // The name_str FFI parameter will be ignored for the constructor itself.
 
     wxDataViewTreeCtrl* ctrl =
-        new wxDataViewTreeCtrl(parent, static_cast<wxWindowID>(id), wxd_cpp_utils::to_wx(pos_rust),
-                               wxd_cpp_utils::to_wx(size_rust), static_cast<long>(style),
+        new wxDataViewTreeCtrl(parent, static_cast<wxWindowID>(id),
+                               wxd_cpp_utils::to_wx(pos_rust, parent),
+                               wxd_cpp_utils::to_wx(size_rust, parent), static_cast<long>(style),
                                wxDefaultValidator // Pass default validator for the 6th argument
                                                   // name_str is not passed to this constructor
         );
@@ -1,8 +1,11 @@
 #include <wx/wxprec.h>
 #include <wx/wx.h>
 #include "../include/wxdragon.h"
+#include "wxd_objstats.h"
 
 #include "wx/dataview.h"
+#include <algorithm>
+#include <unordered_map>
 #include <vector>
 
 // Declare the Rust-side drop function that knows how to free Box-allocated
@@ -32,6 +35,14 @@ public:
     unsigned int
     GetChildren(const wxDataViewItem& parent, wxDataViewItemArray& array) const override
     {
+        if (m_cb && m_cb->fill_children) {
+            const std::vector<void*>& children = CachedChildren(parent.GetID());
+            array.reserve(array.size() + children.size());
+            for (void* child : children) {
+                array.push_back(wxDataViewItem(child));
+            }
+            return static_cast<unsigned int>(children.size());
+        }
         if (!m_cb || !m_cb->get_children)
             return 0;
 
@@ -63,7 +74,51 @@ public:
     {
         if (!m_cb || !m_cb->is_container)
             return false;
-        return m_cb->is_container(m_cb->userdata, (void*)item.GetID());
+        if (!m_cb->fill_children)
+            return m_cb->is_container(m_cb->userdata, (void*)item.GetID());
+        auto it = m_containers.find(item.GetID());
+        if (it == m_containers.end()) {
+            const bool container = m_cb->is_container(m_cb->userdata, (void*)item.GetID());
+            it = m_containers.emplace(item.GetID(), container).first;
+        }
+        return it->second;
+    }
+
+    // Cache maintenance, called by the notification wrappers before forwarding.
+    void
+    ForgetChildren(void* parent)
+    {
+        m_children.erase(parent);
+        m_containers.erase(parent);
+    }
+
+    // Drops `item` and every cached descendant; their ids may be reused by new nodes.
+    void
+    ForgetSubtree(void* item)
+    {
+        auto it = m_children.find(item);
+        if (it != m_children.end()) {
+            std::vector<void*> children;
+            children.swap(it->second);
+            m_children.erase(it);
+            for (void* child : children) {
+                ForgetSubtree(child);
+            }
+        }
+        m_containers.erase(item);
+    }
+
+    void
+    ForgetContainer(void* item)
+    {
+        m_containers.erase(item);
+    }
+
+    void
+    ForgetAll()
+    {
+        m_children.clear();
+        m_containers.clear();
     }
 
     void
@@ -79,6 +134,7 @@ public:
             return;
         // Convert wxd_Variant_t to wxVariant
         variant = *reinterpret_cast<wxVariant*>(rust_variant_data);
+        wxd_objstats::untrack(WXD_OBJECT_KIND_VARIANT, reinterpret_cast<wxVariant*>(rust_variant_data));
         delete reinterpret_cast<wxVariant*>(rust_variant_data);
     }
 
@@ -117,7 +173,35 @@ public:
     }
 
 private:
+    const std::vector<void*>&
+    CachedChildren(void* parent) const
+    {
+        auto it = m_children.find(parent);
+        if (it != m_children.end())
+            return it->second;
+
+        size_t capacity = m_scratch.size();
+        if (m_cb->get_child_count)
+            capacity = m_cb->get_child_count(m_cb->userdata, parent);
+        if (m_scratch.size() < capacity)
+            m_scratch.resize(capacity);
+        size_t total =
+            m_cb->fill_children(m_cb->userdata, parent, m_scratch.data(), m_scratch.size());
+        if (total > m_scratch.size()) {
+            m_scratch.resize(total);
+            total = m_cb->fill_children(m_cb->userdata, parent, m_scratch.data(), total);
+            total = std::min(total, m_scratch.size());
+        }
+        return m_children
+            .emplace(parent, std::vector<void*>(m_scratch.begin(), m_scratch.begin() + total))
+            .first->second;
+    }
+
     const wxd_DataViewTreeModel_Callbacks* m_cb;
+    // Used only with fill_children; see wxd_DataViewTreeModel_Callbacks.
+    mutable std::unordered_map<void*, std::vector<void*>> m_children;
+    mutable std::unordered_map<void*, bool> m_containers;
+    mutable std::vector<void*> m_scratch;
 };
 
 extern "C" wxd_DataViewModel_t*
@@ -144,6 +228,7 @@ wxd_DataViewTreeModel_ItemChanged(wxd_DataViewModel_t* model, void* item)
     if (!model)
         return;
     auto* m = reinterpret_cast<Wxd_Callbacks_DataViewTreeModel*>(model);
+    m->ForgetContainer(item);
     m->ItemChanged(wxDataViewItem(item));
 }
 
@@ -153,6 +238,7 @@ wxd_DataViewTreeModel_ItemAdded(wxd_DataViewModel_t* model, void* parent, void*
     if (!model)
         return;
     Wxd_Callbacks_DataViewTreeModel* m = reinterpret_cast<Wxd_Callbacks_DataViewTreeModel*>(model);
+    m->ForgetChildren(parent);
     m->ItemAdded(wxDataViewItem(parent), wxDataViewItem(item));
 }
 
@@ -162,6 +248,8 @@ wxd_DataViewTreeModel_ItemDeleted(wxd_DataViewModel_t* model, void* parent, void
     if (!model)
         return;
     Wxd_Callbacks_DataViewTreeModel* m = reinterpret_cast<Wxd_Callbacks_DataViewTreeModel*>(model);
+    m->ForgetChildren(parent);
+    m->ForgetSubtree(item);
     m->ItemDeleted(wxDataViewItem(parent), wxDataViewItem(item));
 }
 
@@ -177,6 +265,7 @@ wxd_DataViewTreeModel_ItemsAdded(wxd_DataViewModel_t* model, void* parent, const
     for (size_t i = 0; i < count; ++i) {
         array.push_back(wxDataViewItem((void*)items[i]));
     }
+    m->ForgetChildren(parent);
     m->ItemsAdded(wxDataViewItem(parent), array);
 }
 
@@ -192,7 +281,9 @@ wxd_DataViewTreeModel_ItemsDeleted(wxd_DataViewModel_t* model, void* parent,
     wxDataViewItemArray array;
     for (size_t i = 0; i < count; ++i) {
         array.push_back(wxDataViewItem((void*)items[i]));
+        m->ForgetSubtree((void*)items[i]);
     }
+    m->ForgetChildren(parent);
     m->ItemsDeleted(wxDataViewItem(parent), array);
 }
 
@@ -208,6 +299,7 @@ wxd_DataViewTreeModel_ItemsChanged(wxd_DataViewModel_t* model, const void* const
     wxDataViewItemArray array;
     for (size_t i = 0; i < count; ++i) {
         array.push_back(wxDataViewItem((void*)items[i]));
+        m->ForgetContainer((void*)items[i]);
     }
     m->ItemsChanged(array);
 }
@@ -219,5 +311,6 @@ wxd_DataViewTreeModel_Cleared(wxd_DataViewModel_t* model)
     if (!model)
         return;
     Wxd_Callbacks_DataViewTreeModel* m = reinterpret_cast<Wxd_Callbacks_DataViewTreeModel*>(model);
+    m->ForgetAll();
     m->Cleared();
 }
@@ -3,6 +3,8 @@
 #include "../include/wxdragon.h"
 #include <wx/dataview.h>
 #include "wxd_utils.h"
+#include "wxd_dataview_row_cache.h"
+#include <algorithm>
 
 // Define a concrete implementation of wxDataViewVirtualListModel
 class WxdBasicDataViewVirtualListModel : public wxDataViewVirtualListModel {
@@ -33,6 +35,34 @@ public:
     }
 };
 
+namespace {
+
+// Clamps [first..last] to the model; false when nothing is left.
+bool
+clamp_rows(wxDataViewVirtualListModel* vmodel, uint64_t first, uint64_t last, unsigned int* from,
+           unsigned int* to)
+{
+    const unsigned int count = vmodel->GetCount();
+    if (count == 0 || first > last || first >= count)
+        return false;
+    *from = static_cast<unsigned int>(first);
+    *to = static_cast<unsigned int>(std::min<uint64_t>(last, count - 1));
+    return true;
+}
+
+wxDataViewItemArray
+items_for_rows(wxDataViewVirtualListModel* vmodel, unsigned int from, unsigned int to)
+{
+    wxDataViewItemArray items;
+    items.reserve(static_cast<size_t>(to - from) + 1);
+    for (unsigned int row = from; row <= to; ++row) {
+        items.push_back(vmodel->GetItem(row));
+    }
+    return items;
+}
+
+} // namespace
+
 // C-style FFI functions for wxDataViewVirtualListModel
 
 extern "C" {
@@ -52,6 +82,7 @@ wxd_DataViewVirtualListModel_RowPrepended(wxd_DataViewModel_t* model)
 {
     wxDataViewVirtualListModel* vmodel = reinterpret_cast<wxDataViewVirtualListModel*>(model);
     if (vmodel) {
+        wxd_dataview_row_cache::invalidate(vmodel);
         vmodel->RowPrepended();
     }
 }
@@ -61,6 +92,7 @@ wxd_DataViewVirtualListModel_RowInserted(wxd_DataViewModel_t* model, uint64_t be
 {
     wxDataViewVirtualListModel* vmodel = reinterpret_cast<wxDataViewVirtualListModel*>(model);
     if (vmodel) {
+        wxd_dataview_row_cache::invalidate(vmodel);
         vmodel->RowInserted(static_cast<unsigned int>(before));
     }
 }
@@ -70,6 +102,7 @@ wxd_DataViewVirtualListModel_RowAppended(wxd_DataViewModel_t* model)
 {
     wxDataViewVirtualListModel* vmodel = reinterpret_cast<wxDataViewVirtualListModel*>(model);
     if (vmodel) {
+        wxd_dataview_row_cache::invalidate(vmodel);
         vmodel->RowAppended();
     }
 }
@@ -79,6 +112,7 @@ wxd_DataViewVirtualListModel_RowDeleted(wxd_DataViewModel_t* model, uint64_t row
 {
     wxDataViewVirtualListModel* vmodel = reinterpret_cast<wxDataViewVirtualListModel*>(model);
     if (vmodel) {
+        wxd_dataview_row_cache::invalidate(vmodel);
         vmodel->RowDeleted(static_cast<unsigned int>(row));
     }
 }
@@ -92,6 +126,7 @@ wxd_DataViewVirtualListModel_RowsDeleted(wxd_DataViewModel_t* model, int32_t* ro
         for (int32_t i = 0; i < count; i++) {
             rowsArray.Add(rows[i]);
         }
+        wxd_dataview_row_cache::invalidate(vmodel);
         vmodel->RowsDeleted(rowsArray);
     }
 }
@@ -101,6 +136,8 @@ wxd_DataViewVirtualListModel_RowChanged(wxd_DataViewModel_t* model, uint64_t row
 {
     wxDataViewVirtualListModel* vmodel = reinterpret_cast<wxDataViewVirtualListModel*>(model);
     if (vmodel) {
+        wxd_dataview_row_cache::invalidate_rows(vmodel, static_cast<unsigned int>(row),
+                                                static_cast<unsigned int>(row));
         vmodel->RowChanged(static_cast<unsigned int>(row));
     }
 }
@@ -110,6 +147,8 @@ wxd_DataViewVirtualListModel_RowValueChanged(wxd_DataViewModel_t* model, uint64_
 {
     wxDataViewVirtualListModel* vmodel = reinterpret_cast<wxDataViewVirtualListModel*>(model);
     if (vmodel) {
+        wxd_dataview_row_cache::invalidate_rows(vmodel, static_cast<unsigned int>(row),
+                                                static_cast<unsigned int>(row));
         vmodel->RowValueChanged(static_cast<unsigned int>(row), static_cast<unsigned int>(col));
     }
 }
@@ -119,10 +158,68 @@ wxd_DataViewVirtualListModel_Reset(wxd_DataViewModel_t* model, uint64_t new_size
 {
     wxDataViewVirtualListModel* vmodel = reinterpret_cast<wxDataViewVirtualListModel*>(model);
     if (vmodel) {
+        wxd_dataview_row_cache::invalidate(vmodel);
         vmodel->Reset(static_cast<unsigned int>(new_size));
     }
 }
 
+// Range notifications: one call per batch. Changed rows go to the control as a single
+// ItemsChanged, which it turns into row refreshes painted together.
+void
+wxd_DataViewVirtualListModel_RowsChanged(wxd_DataViewModel_t* model, uint64_t first, uint64_t last)
+{
+    wxDataViewVirtualListModel* vmodel = reinterpret_cast<wxDataViewVirtualListModel*>(model);
+    unsigned int from = 0;
+    unsigned int to = 0;
+    if (vmodel && clamp_rows(vmodel, first, last, &from, &to)) {
+        wxd_dataview_row_cache::invalidate_rows(vmodel, from, to);
+        vmodel->ItemsChanged(items_for_rows(vmodel, from, to));
+    }
+}
+
+void
+wxd_DataViewVirtualListModel_RowsInserted(wxd_DataViewModel_t* model, uint64_t before,
+                                          uint64_t count)
+{
+    wxDataViewVirtualListModel* vmodel = reinterpret_cast<wxDataViewVirtualListModel*>(model);
+    if (vmodel && count > 0) {
+        wxd_dataview_row_cache::invalidate(vmodel);
+        // The model's row count can only grow one RowInserted() at a time. Reset() would be a
+        // single notification but drops the selection, current item and scroll position, so
+        // notify per row as ApplySnapshot does; the batch still crosses the FFI once.
+        const unsigned int at =
+            static_cast<unsigned int>(std::min<uint64_t>(before, vmodel->GetCount()));
+        for (uint64_t i = 0; i < count; ++i) {
+            vmodel->RowInserted(at + static_cast<unsigned int>(i));
+        }
+    }
+}
+
+void
+wxd_DataViewVirtualListModel_RowValuesChanged(wxd_DataViewModel_t* model, uint64_t first,
+                                              uint64_t last, uint64_t col_mask)
+{
+    wxDataViewVirtualListModel* vmodel = reinterpret_cast<wxDataViewVirtualListModel*>(model);
+    unsigned int from = 0;
+    unsigned int to = 0;
+    if (!vmodel || col_mask == 0 || !clamp_rows(vmodel, first, last, &from, &to)) {
+        return;
+    }
+    wxd_dataview_row_cache::invalidate_rows(vmodel, from, to);
+    if (from == to && (col_mask & (col_mask - 1)) == 0) {
+        // A single cell: the one notification can name its column.
+        unsigned int col = 0;
+        while (!(col_mask & (uint64_t(1) << col))) {
+            ++col;
+        }
+        vmodel->RowValueChanged(from, col);
+        return;
+    }
+    // Otherwise one notification for the whole range; refreshing whole rows costs less than a
+    // notification per cell.
+    vmodel->ItemsChanged(items_for_rows(vmodel, from, to));
+}
+
 // Conversion between row indices and wxDataViewItem
 void*
 wxd_DataViewVirtualListModel_GetItem(wxd_DataViewModel_t* model, uint64_t row)
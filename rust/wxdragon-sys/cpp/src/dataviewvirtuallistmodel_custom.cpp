@@ -5,13 +5,60 @@
 #include <wx/log.h>
 #include <wx/object.h> // For wxIsKindOf macro
 #include "wxd_utils.h"
+#include "wxd_dataview_row_cache.h"
+#include "wxd_dataview_snapshot.h"
+#include <algorithm>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Rows fetched per bulk call; a little of the window is kept above the row that missed so
+// scrolling up one line does not refetch.
+constexpr unsigned int kPrefetchRows = 64;
+constexpr unsigned int kPrefetchLead = 16;
+// Row attributes kept; a few screens' worth, so scrolling back does not call out again.
+constexpr size_t kRowAttrCacheSize = 512;
+
+bool
+has_any_attr(const wxd_DataViewItemAttr_t& attr)
+{
+    return attr.has_text_colour || attr.has_bg_colour || attr.bold || attr.italic;
+}
+
+void
+apply_attr(const wxd_DataViewItemAttr_t& rust_attr, wxDataViewItemAttr& attr)
+{
+    if (rust_attr.has_text_colour) {
+        attr.SetColour(wxColour(rust_attr.text_colour_red, rust_attr.text_colour_green,
+                                rust_attr.text_colour_blue, rust_attr.text_colour_alpha));
+    }
+
+    if (rust_attr.has_bg_colour) {
+        attr.SetBackgroundColour(wxColour(rust_attr.bg_colour_red, rust_attr.bg_colour_green,
+                                          rust_attr.bg_colour_blue, rust_attr.bg_colour_alpha));
+    }
+
+    if (rust_attr.bold) {
+        attr.SetBold(true);
+    }
+
+    if (rust_attr.italic) {
+        attr.SetItalic(true);
+    }
+}
+
+} // namespace
 
 // Forward declaration for Rust function that properly handles Box::from_raw()
 extern "C" void
 wxd_Drop_Rust_CustomModelCallbacks(void* ptr);
 
 // Define a custom implementation of wxDataViewVirtualListModel that uses callbacks
-class WxdCustomDataViewVirtualListModel : public wxDataViewVirtualListModel {
+class WxdCustomDataViewVirtualListModel : public wxDataViewVirtualListModel,
+                                          public wxd_dataview_snapshot::Target {
 public:
     WxdCustomDataViewVirtualListModel(unsigned int initial_size, void* userdata,
                                       wxd_dataview_model_get_value_callback get_value,
@@ -34,20 +81,200 @@ public:
         }
     }
 
+    void*
+    GetUserdata() const
+    {
+        return m_userdata;
+    }
+
+    void
+    SetValuesForRowsCallback(wxd_dataview_model_get_values_for_rows_callback callback,
+                             unsigned int num_cols)
+    {
+        m_get_values_for_rows = callback;
+        m_range_cols = callback ? num_cols : 0;
+        InvalidateCache();
+    }
+
+    void
+    SetRowAttrCallback(wxd_dataview_model_get_row_attr_callback callback)
+    {
+        m_get_row_attr = callback;
+        m_row_attrs.clear();
+        m_row_attr_index.clear();
+    }
+
+    void
+    InvalidateCache()
+    {
+        m_cache_count = 0;
+    }
+
+    void
+    SetProjection(std::vector<uint8_t> visible)
+    {
+        if (visible == m_projection)
+            return;
+        m_projection = std::move(visible);
+        // Cached windows hold nulls for the columns that were left out.
+        InvalidateCache();
+    }
+
+    bool
+    IsProjected(unsigned int col) const
+    {
+        return m_projection.empty() || (col < m_projection.size() && m_projection[col]);
+    }
+
+    // Rows moved or the model was reset: nothing cached is keyed right any more.
+    void
+    InvalidateAll()
+    {
+        InvalidateCache();
+        m_row_attrs.clear();
+        m_row_attr_index.clear();
+    }
+
+    void
+    InvalidateRows(unsigned int first, unsigned int last)
+    {
+        InvalidateCache();
+        if (static_cast<size_t>(last - first) >= m_row_attrs.size()) {
+            // Cheaper to walk the cache than the range.
+            for (auto it = m_row_attrs.begin(); it != m_row_attrs.end();) {
+                if (it->row >= first && it->row <= last) {
+                    m_row_attr_index.erase(it->row);
+                    it = m_row_attrs.erase(it);
+                }
+                else {
+                    ++it;
+                }
+            }
+            return;
+        }
+        for (unsigned int row = first; row <= last; ++row) {
+            auto it = m_row_attr_index.find(row);
+            if (it != m_row_attr_index.end()) {
+                m_row_attrs.erase(it->second);
+                m_row_attr_index.erase(it);
+            }
+        }
+    }
+
+    // Installs the view -> source row order (`rows` NULL restores source order) and resets the
+    // control to the new row count. False, with nothing changed, if an entry is out of range.
+    bool
+    SetRowMapping(const uint32_t* rows, size_t view_count, size_t source_count)
+    {
+        std::vector<uint32_t> map;
+        std::vector<uint32_t> inverse;
+        if (rows) {
+            map.assign(rows, rows + view_count);
+            inverse.assign(source_count, kNoRow);
+            for (size_t view = 0; view < map.size(); ++view) {
+                if (map[view] >= source_count)
+                    return false;
+                inverse[map[view]] = static_cast<uint32_t>(view);
+            }
+        }
+        m_row_map.swap(map);
+        m_view_of_source.swap(inverse);
+        m_source_count = static_cast<unsigned int>(source_count);
+        InvalidateAll();
+        Reset(static_cast<unsigned int>(rows ? view_count : source_count));
+        return true;
+    }
+
+    // Source row shown at `row`. Rows past the mapping are rows appended to the source since
+    // it was installed and keep their order.
+    unsigned int
+    SourceRow(unsigned int row) const
+    {
+        if (m_row_map.empty() && m_view_of_source.empty())
+            return row;
+        if (row < m_row_map.size())
+            return m_row_map[row];
+        return m_source_count + (row - static_cast<unsigned int>(m_row_map.size()));
+    }
+
+    // View row showing source row `row`, or kNoRow if it is filtered out.
+    unsigned int
+    ViewRow(unsigned int row) const
+    {
+        if (m_row_map.empty() && m_view_of_source.empty())
+            return row;
+        if (row < m_source_count)
+            return m_view_of_source[row];
+        return static_cast<unsigned int>(m_row_map.size()) + (row - m_source_count);
+    }
+
+    // Switches to `snapshot` and tells the control only what differs from the previous one.
+    // A row mapping survives only snapshots with the same row count; otherwise it is dropped
+    // and the control reset, like a mapping installed with SetRowMapping.
+    void
+    ApplySnapshot(wxd_dataview_snapshot::SnapshotPtr snapshot) override
+    {
+        wxd_dataview_snapshot::SnapshotPtr before = std::move(m_snapshot);
+        m_snapshot = std::move(snapshot);
+        InvalidateAll();
+        const bool mapped = !m_row_map.empty() || !m_view_of_source.empty();
+        wxd_dataview_snapshot::ListDiff diff;
+        if (before)
+            diff = wxd_dataview_snapshot::diff_rows(*before, *m_snapshot);
+        if (!before || diff.reset ||
+            (mapped && (!diff.deleted.empty() || !diff.inserted.empty()))) {
+            m_row_map.clear();
+            m_view_of_source.clear();
+            m_source_count = 0;
+            Reset(static_cast<unsigned int>(m_snapshot->rows));
+            return;
+        }
+        if (!diff.deleted.empty()) {
+            wxArrayInt deleted;
+            deleted.reserve(diff.deleted.size());
+            for (unsigned int row : diff.deleted)
+                deleted.push_back(static_cast<int>(row));
+            RowsDeleted(deleted);
+        }
+        for (const auto& [first, count] : diff.inserted) {
+            for (unsigned int i = 0; i < count; ++i)
+                RowInserted(first + i);
+        }
+        wxDataViewItemArray changed;
+        for (const auto& [first, last] : diff.changed) {
+            for (unsigned int row = first; row <= last; ++row) {
+                const unsigned int view = ViewRow(row);
+                if (view != kNoRow)
+                    changed.push_back(GetItem(view));
+            }
+        }
+        if (!changed.empty())
+            ItemsChanged(changed);
+    }
+
     // Implementation of the pure virtual methods
     virtual void
     GetValueByRow(wxVariant& variant, unsigned int row, unsigned int col) const override
     {
+        if (m_snapshot && col < m_snapshot->columns.size()) {
+            m_snapshot->Fill(variant, SourceRow(row), col);
+            return;
+        }
+        const bool projected = IsProjected(col);
+        if (!projected && !wxd_dataview_row_cache::g_full_columns) {
+            variant.MakeNull();
+            return;
+        }
+        // Cached windows have no values for columns outside the projection.
+        if (const size_t index = projected ? CacheIndex(row, col) : kNoIndex; index != kNoIndex) {
+            variant = m_cache_values[index];
+            return;
+        }
+        row = SourceRow(row);
         if (m_get_value) {
-            wxd_Variant_t* rust_variant_data =
-                m_get_value(m_userdata, static_cast<uint64_t>(row), static_cast<uint64_t>(col));
-            if (rust_variant_data) {
-                // Convert wxd_Variant_t to wxVariant
-                variant = *reinterpret_cast<wxVariant*>(rust_variant_data);
-                delete reinterpret_cast<wxVariant*>(rust_variant_data);
-            }
-            else {
-                // Handle null return from Rust
+            // Rust fills the caller's variant directly
+            if (!m_get_value(m_userdata, static_cast<uint64_t>(row), static_cast<uint64_t>(col),
+                             reinterpret_cast<wxd_Variant_t*>(&variant))) {
                 variant.Clear();
             }
         }
@@ -60,6 +287,7 @@ public:
     virtual bool
     SetValueByRow(const wxVariant& variant, unsigned int row, unsigned int col) override
     {
+        row = SourceRow(row);
         if (m_set_value) {
             const wxd_Variant_t* rust_variant = reinterpret_cast<const wxd_Variant_t*>(&variant);
             return m_set_value(m_userdata, rust_variant, static_cast<uint64_t>(row),
@@ -71,32 +299,33 @@ public:
     virtual bool
     GetAttrByRow(unsigned int row, unsigned int col, wxDataViewItemAttr& attr) const override
     {
+        if (m_snapshot && !m_snapshot->attrs.empty()) {
+            const wxd_DataViewItemAttr_t* snapshot_attr = m_snapshot->Attr(SourceRow(row));
+            return snapshot_attr && wxd_dataview_snapshot::apply_attr(*snapshot_attr, attr);
+        }
+        const bool projected = IsProjected(col);
+        if (!projected && !wxd_dataview_row_cache::g_full_columns)
+            return false;
+        const size_t index = projected ? CacheIndex(row, col) : kNoIndex;
+        if (index != kNoIndex && has_any_attr(m_cache_attrs[index])) {
+            apply_attr(m_cache_attrs[index], attr);
+            return true;
+        }
+        if (m_get_row_attr) {
+            const RowAttr& cached = RowAttrFor(row);
+            if (cached.has_attr)
+                attr = cached.attr;
+            return cached.has_attr;
+        }
+        if (index != kNoIndex)
+            return false;
         if (m_get_attr) {
             wxd_DataViewItemAttr_t rust_attr;
-            bool has_attr = m_get_attr(m_userdata, static_cast<uint64_t>(row),
+            bool has_attr = m_get_attr(m_userdata, static_cast<uint64_t>(SourceRow(row)),
                                        static_cast<uint64_t>(col), &rust_attr);
 
             if (has_attr) {
-                if (rust_attr.has_text_colour) {
-                    attr.SetColour(wxColour(rust_attr.text_colour_red, rust_attr.text_colour_green,
-                                            rust_attr.text_colour_blue,
-                                            rust_attr.text_colour_alpha));
-                }
-
-                if (rust_attr.has_bg_colour) {
-                    attr.SetBackgroundColour(
-                        wxColour(rust_attr.bg_colour_red, rust_attr.bg_colour_green,
-                                 rust_attr.bg_colour_blue, rust_attr.bg_colour_alpha));
-                }
-
-                if (rust_attr.bold) {
-                    attr.SetBold(true);
-                }
-
-                if (rust_attr.italic) {
-                    attr.SetItalic(true);
-                }
-
+                apply_attr(rust_attr, attr);
                 return true;
             }
         }
@@ -107,19 +336,174 @@ public:
     IsEnabledByRow(unsigned int row, unsigned int col) const override
     {
         if (m_is_enabled) {
-            return m_is_enabled(m_userdata, static_cast<uint64_t>(row), static_cast<uint64_t>(col));
+            return m_is_enabled(m_userdata, static_cast<uint64_t>(SourceRow(row)),
+                                static_cast<uint64_t>(col));
         }
         return true;
     }
 
+    static constexpr unsigned int kNoRow = static_cast<unsigned int>(-1);
+
 private:
+    static constexpr size_t kNoIndex = static_cast<size_t>(-1);
+
+    // Index of the cell in the cache, filling a window around `row` on a miss; kNoIndex when
+    // the cell is not served by the bulk provider.
+    size_t
+    CacheIndex(unsigned int row, unsigned int col) const
+    {
+        if (!m_get_values_for_rows || col >= m_range_cols || row >= GetCount())
+            return kNoIndex;
+        if (row < m_cache_first || row - m_cache_first >= m_cache_count)
+            FillCache(row);
+        return static_cast<size_t>(row - m_cache_first) * m_range_cols + col;
+    }
+
+    void
+    FillCache(unsigned int row) const
+    {
+        const unsigned int first = row > kPrefetchLead ? row - kPrefetchLead : 0;
+        const unsigned int count = std::min(kPrefetchRows, GetCount() - first);
+        const size_t cells = static_cast<size_t>(count) * m_range_cols;
+
+        // The variants are kept between fills; only their contents change. Columns outside the
+        // projection get a null slot, so the provider skips them.
+        if (m_cache_values.size() < cells) {
+            m_cache_values.resize(cells);
+            m_cache_slots.resize(cells);
+            m_cache_attrs.resize(cells);
+        }
+        for (size_t i = 0; i < cells; ++i) {
+            m_cache_values[i].MakeNull();
+            m_cache_slots[i] = IsProjected(static_cast<unsigned int>(i % m_range_cols))
+                                   ? reinterpret_cast<wxd_Variant_t*>(&m_cache_values[i])
+                                   : nullptr;
+        }
+        std::fill(m_cache_attrs.begin(), m_cache_attrs.begin() + cells,
+                  wxd_DataViewItemAttr_t{});
+
+        // One call per run of view rows that are consecutive in the source, which is the whole
+        // window unless a row mapping is installed.
+        for (unsigned int run = 0; run < count;) {
+            const unsigned int source = SourceRow(first + run);
+            unsigned int length = 1;
+            while (run + length < count && SourceRow(first + run + length) == source + length) {
+                ++length;
+            }
+            const size_t offset = static_cast<size_t>(run) * m_range_cols;
+            m_get_values_for_rows(m_userdata, source, length, m_range_cols,
+                                  m_cache_slots.data() + offset, m_cache_attrs.data() + offset);
+            run += length;
+        }
+        m_cache_first = first;
+        m_cache_count = count;
+        ScheduleExpiry();
+    }
+
+    // The cache only spans one paint: drop it once control is back in the event loop, so data
+    // changed without a notification shows up on the next repaint.
+    void
+    ScheduleExpiry() const
+    {
+        if (m_expiry_pending || !wxTheApp)
+            return;
+        m_expiry_pending = true;
+        auto* self = const_cast<WxdCustomDataViewVirtualListModel*>(this);
+        self->IncRef();
+        wxTheApp->CallAfter([self]() {
+            self->m_expiry_pending = false;
+            self->InvalidateCache();
+            self->DecRef();
+        });
+    }
+
+    struct RowAttr {
+        unsigned int row;
+        bool has_attr;
+        wxDataViewItemAttr attr;
+    };
+
+    // The row's attribute from the LRU, computed through the row callback on a miss.
+    const RowAttr&
+    RowAttrFor(unsigned int row) const
+    {
+        auto it = m_row_attr_index.find(row);
+        if (it != m_row_attr_index.end()) {
+            m_row_attrs.splice(m_row_attrs.begin(), m_row_attrs, it->second);
+            return m_row_attrs.front();
+        }
+        if (m_row_attrs.size() >= kRowAttrCacheSize) {
+            m_row_attr_index.erase(m_row_attrs.back().row);
+            m_row_attrs.pop_back();
+        }
+        wxd_DataViewItemAttr_t rust_attr{};
+        RowAttr entry{ row, m_get_row_attr(m_userdata, SourceRow(row), &rust_attr),
+                       wxDataViewItemAttr() };
+        if (entry.has_attr)
+            apply_attr(rust_attr, entry.attr);
+        m_row_attrs.push_front(std::move(entry));
+        m_row_attr_index.emplace(row, m_row_attrs.begin());
+        return m_row_attrs.front();
+    }
+
     void* m_userdata;
     wxd_dataview_model_get_value_callback m_get_value;
     wxd_dataview_model_set_value_callback m_set_value;
     wxd_dataview_model_get_attr_callback m_get_attr;
     wxd_dataview_model_is_enabled_callback m_is_enabled;
+    wxd_dataview_model_get_values_for_rows_callback m_get_values_for_rows = nullptr;
+    unsigned int m_range_cols = 0;
+    std::vector<uint8_t> m_projection; // by model column; empty projects every column
+
+    mutable unsigned int m_cache_first = 0;
+    mutable unsigned int m_cache_count = 0;
+    mutable std::vector<wxVariant> m_cache_values;
+    mutable std::vector<wxd_Variant_t*> m_cache_slots;
+    mutable std::vector<wxd_DataViewItemAttr_t> m_cache_attrs;
+    mutable bool m_expiry_pending = false;
+
+    wxd_dataview_model_get_row_attr_callback m_get_row_attr = nullptr;
+    mutable std::list<RowAttr> m_row_attrs; // most recently used first
+    mutable std::unordered_map<unsigned int, std::list<RowAttr>::iterator> m_row_attr_index;
+
+    // Latest applied snapshot; serves its columns instead of the value callbacks once set.
+    wxd_dataview_snapshot::SnapshotPtr m_snapshot;
+
+    // Sort/filter indirection; both empty when rows are shown in source order.
+    std::vector<uint32_t> m_row_map;        // view row -> source row
+    std::vector<uint32_t> m_view_of_source; // source row -> view row or kNoRow
+    unsigned int m_source_count = 0;
 };
 
+namespace wxd_dataview_row_cache {
+
+int g_full_columns = 0;
+
+void
+set_projection(wxDataViewVirtualListModel* model, std::vector<uint8_t> visible)
+{
+    if (auto* custom = dynamic_cast<WxdCustomDataViewVirtualListModel*>(model))
+        custom->SetProjection(std::move(visible));
+}
+
+void
+invalidate(wxDataViewVirtualListModel* model)
+{
+    if (auto* custom = dynamic_cast<WxdCustomDataViewVirtualListModel*>(model))
+        custom->InvalidateAll();
+}
+
+void
+invalidate_rows(wxDataViewVirtualListModel* model, unsigned int first, unsigned int last)
+{
+    if (first > last)
+        return;
+    if (auto* custom = dynamic_cast<WxdCustomDataViewVirtualListModel*>(model))
+        custom->InvalidateRows(first, last);
+}
+
+} // namespace wxd_dataview_row_cache
+
 // @brief Creates a new custom virtual list model with callbacks, the returned model has ref count 1,
 // the caller is responsible for releasing it when done with wxd_DataViewModel_Release.
 extern "C" wxd_DataViewModel_t*
@@ -141,3 +525,102 @@ wxd_DataViewVirtualListModel_CreateWithCallbacks(
 
     return reinterpret_cast<wxd_DataViewModel_t*>(model);
 }
+
+extern "C" void*
+wxd_DataViewVirtualListModel_GetCallbackUserdata(wxd_DataViewModel_t* model)
+{
+    auto* custom = dynamic_cast<WxdCustomDataViewVirtualListModel*>(
+        reinterpret_cast<wxDataViewModel*>(model));
+    return custom ? custom->GetUserdata() : nullptr;
+}
+
+extern "C" bool
+wxd_DataViewVirtualListModel_SetValuesForRowsCallback(
+    wxd_DataViewModel_t* model, wxd_dataview_model_get_values_for_rows_callback callback,
+    uint32_t num_cols)
+{
+    auto* custom = dynamic_cast<WxdCustomDataViewVirtualListModel*>(
+        reinterpret_cast<wxDataViewModel*>(model));
+    if (!custom)
+        return false;
+    custom->SetValuesForRowsCallback(callback, num_cols);
+    return true;
+}
+
+extern "C" bool
+wxd_DataViewVirtualListModel_SetRowAttrCallback(wxd_DataViewModel_t* model,
+                                                wxd_dataview_model_get_row_attr_callback callback)
+{
+    auto* custom = dynamic_cast<WxdCustomDataViewVirtualListModel*>(
+        reinterpret_cast<wxDataViewModel*>(model));
+    if (!custom)
+        return false;
+    custom->SetRowAttrCallback(callback);
+    return true;
+}
+
+extern "C" bool
+wxd_DataViewVirtualListModel_SetRowMapping(wxd_DataViewModel_t* model, const uint32_t* rows,
+                                           uint64_t viewCount, uint64_t sourceCount)
+{
+    auto* custom = dynamic_cast<WxdCustomDataViewVirtualListModel*>(
+        reinterpret_cast<wxDataViewModel*>(model));
+    if (!custom || (!rows && viewCount > 0))
+        return false;
+    return custom->SetRowMapping(rows, static_cast<size_t>(viewCount),
+                                 static_cast<size_t>(sourceCount));
+}
+
+extern "C" int64_t
+wxd_DataViewVirtualListModel_GetSourceRow(wxd_DataViewModel_t* model, uint64_t viewRow)
+{
+    auto* custom = dynamic_cast<WxdCustomDataViewVirtualListModel*>(
+        reinterpret_cast<wxDataViewModel*>(model));
+    if (!custom || viewRow >= custom->GetCount())
+        return -1;
+    return custom->SourceRow(static_cast<unsigned int>(viewRow));
+}
+
+extern "C" int64_t
+wxd_DataViewVirtualListModel_GetViewRow(wxd_DataViewModel_t* model, uint64_t sourceRow)
+{
+    auto* custom = dynamic_cast<WxdCustomDataViewVirtualListModel*>(
+        reinterpret_cast<wxDataViewModel*>(model));
+    if (!custom)
+        return -1;
+    const unsigned int view = custom->ViewRow(static_cast<unsigned int>(sourceRow));
+    if (view == WxdCustomDataViewVirtualListModel::kNoRow || view >= custom->GetCount())
+        return -1;
+    return view;
+}
+
+extern "C" bool
+wxd_DataViewVirtualListModel_IsColumnProjected(wxd_DataViewModel_t* model, uint32_t column)
+{
+    auto* custom = dynamic_cast<WxdCustomDataViewVirtualListModel*>(
+        reinterpret_cast<wxDataViewModel*>(model));
+    return !custom || custom->IsProjected(column);
+}
+
+extern "C" bool
+wxd_DataViewVirtualListModel_SetProjectedColumns(wxd_DataViewModel_t* model,
+                                                 const uint32_t* columns, size_t count)
+{
+    auto* custom = dynamic_cast<WxdCustomDataViewVirtualListModel*>(
+        reinterpret_cast<wxDataViewModel*>(model));
+    if (!custom || (!columns && count > 0))
+        return false;
+    std::vector<uint8_t> visible;
+    if (columns) {
+        for (size_t i = 0; i < count; ++i) {
+            if (columns[i] >= visible.size())
+                visible.resize(static_cast<size_t>(columns[i]) + 1, 0);
+            visible[columns[i]] = 1;
+        }
+    }
+    // An explicit empty set still projects out every column.
+    if (columns && visible.empty())
+        visible.push_back(0);
+    custom->SetProjection(std::move(visible));
+    return true;
+}
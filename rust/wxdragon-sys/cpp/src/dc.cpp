@@ -4,6 +4,13 @@
 #include <wx/dcmemory.h>
 #include <wx/dcscreen.h>
 #include <wx/dcbuffer.h>
+#include "../src/wxd_text_extent.h"
+#include "../src/wxd_cache_registry.h"
+#include "../src/wxd_utils.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
 
 // Type aliases for easier reference
 using wxd_DC_t = struct wxd_DC_t;
@@ -25,6 +32,300 @@ using wxd_AutoBufferedPaintDC_t = struct wxd_AutoBufferedPaintDC_t;
 
 // Since wxDC is abstract, we need to ensure we only expose classes that wxWidgets actually provides
 
+namespace {
+
+// Distinct pens / brushes kept; charts rarely use more than a few dozen.
+constexpr size_t kMaxCachedDrawingObjects = 128;
+
+// wxPen / wxBrush by construction arguments. Copies share one ref-counted native object (HPEN,
+// cairo pattern, ...), so handing out a cached one stops SetPen / SetBrush from creating and
+// destroying it per call. Drawing is main-thread only.
+template <typename T>
+class DrawingObjectCache : public wxd_cache_registry::Cache {
+public:
+    explicit DrawingObjectCache(const char* name) : Cache(name) {}
+
+    template <typename Make>
+    const T&
+    Get(uint64_t key, Make make)
+    {
+        auto it = m_objects.find(key);
+        if (it != m_objects.end())
+            return it->second;
+        if (m_objects.size() >= kMaxCachedDrawingObjects)
+            m_objects.clear();
+        return m_objects.emplace(key, make()).first->second;
+    }
+
+    // The native object's size is not exposed; each counts at a nominal size.
+    size_t
+    CacheBytes() const override
+    {
+        return m_objects.size() * (sizeof(T) + sizeof(uint64_t) + kNominalNativeBytes);
+    }
+
+    size_t
+    CacheEntries() const override
+    {
+        return m_objects.size();
+    }
+
+    // Use is not tracked, so either level empties the cache; pens and brushes are cheap to
+    // recreate.
+    void
+    Trim(wxd_TrimLevel) override
+    {
+        m_objects.clear();
+    }
+
+private:
+    static constexpr size_t kNominalNativeBytes = 128;
+
+    std::unordered_map<uint64_t, T> m_objects;
+};
+
+// Never destroyed: native objects must not outlive the toolkit, which is gone by the time
+// static destructors run.
+DrawingObjectCache<wxPen>&
+pen_cache()
+{
+    static auto* cache = new DrawingObjectCache<wxPen>("pens");
+    return *cache;
+}
+
+DrawingObjectCache<wxBrush>&
+brush_cache()
+{
+    static auto* cache = new DrawingObjectCache<wxBrush>("brushes");
+    return *cache;
+}
+
+uint64_t
+drawing_key(wxd_Colour_t colour, uint32_t width, uint32_t style)
+{
+    const uint64_t rgba = static_cast<uint64_t>(colour.r) << 24 | colour.g << 16 |
+                          colour.b << 8 | colour.a;
+    return rgba | static_cast<uint64_t>(width & 0xFFFF) << 32 |
+           static_cast<uint64_t>(style & 0xFFFF) << 48;
+}
+
+void
+apply_pen(wxDC& dc, wxd_Colour_t colour, int width, int style)
+{
+    wxColour wx_color(colour.r, colour.g, colour.b, colour.a);
+    wxPenStyle wx_style = static_cast<wxPenStyle>(style);
+
+    if (width < 0 || width > 0xFFFF || style < 0 || style > 0xFFFF) {
+        dc.SetPen(wxPen(wx_color, width, wx_style));
+        return;
+    }
+    dc.SetPen(pen_cache().Get(drawing_key(colour, width, style),
+                              [&]() { return wxPen(wx_color, width, wx_style); }));
+}
+
+void
+apply_brush(wxDC& dc, wxd_Colour_t colour, int style)
+{
+    wxColour wx_color(colour.r, colour.g, colour.b, colour.a);
+    wxBrushStyle wx_style = static_cast<wxBrushStyle>(style);
+
+    if (style < 0 || style > 0xFFFF) {
+        dc.SetBrush(wxBrush(wx_color, wx_style));
+        return;
+    }
+    dc.SetBrush(brush_cache().Get(drawing_key(colour, 0, style),
+                                  [&]() { return wxBrush(wx_color, wx_style); }));
+}
+
+// Recorded commands pack colours as 0xRRGGBBAA.
+wxd_Colour_t
+unpack_colour(uint32_t rgba)
+{
+    return wxd_Colour_t{ static_cast<unsigned char>(rgba >> 24),
+                         static_cast<unsigned char>(rgba >> 16),
+                         static_cast<unsigned char>(rgba >> 8), static_cast<unsigned char>(rgba) };
+}
+
+wxColour
+to_wx_colour(uint32_t rgba)
+{
+    const wxd_Colour_t c = unpack_colour(rgba);
+    return wxColour(c.r, c.g, c.b, c.a);
+}
+
+constexpr size_t kUnknownOp = SIZE_MAX;
+
+// Operand words an opcode takes before its variable-length tail, if any.
+size_t
+fixed_operands(uint32_t op)
+{
+    switch (op) {
+    case WXD_DRAW_OP_RESET_CLIP:
+        return 0;
+    case WXD_DRAW_OP_SET_TEXT_FOREGROUND:
+    case WXD_DRAW_OP_SET_TEXT_BACKGROUND:
+    case WXD_DRAW_OP_LINES:
+        return 1;
+    case WXD_DRAW_OP_SET_BRUSH:
+    case WXD_DRAW_OP_POINT:
+    case WXD_DRAW_OP_POLYGON:
+        return 2;
+    case WXD_DRAW_OP_SET_PEN:
+    case WXD_DRAW_OP_CIRCLE:
+    case WXD_DRAW_OP_TEXT:
+        return 3;
+    case WXD_DRAW_OP_LINE:
+    case WXD_DRAW_OP_RECTANGLE:
+    case WXD_DRAW_OP_ELLIPSE:
+    case WXD_DRAW_OP_SET_CLIP:
+        return 4;
+    case WXD_DRAW_OP_ROUNDED_RECTANGLE:
+        return 5;
+    case WXD_DRAW_OP_ARC:
+        return 6;
+    default:
+        return kUnknownOp;
+    }
+}
+
+// Measures with `font` (the DC's own if null), through the extent cache when it is enabled.
+wxd_text_extent::Extent
+dc_text_extent(wxDC& dc, const char* utf8, size_t len, const wxFont* font)
+{
+    // Relative logical-to-device mapping covers user scale, logical scale and map mode.
+    const double content = dc.GetContentScaleFactor();
+    const double scale_x = dc.LogicalToDeviceXRel(1 << 16) / 65536.0 * content;
+    const double scale_y = dc.LogicalToDeviceYRel(1 << 16) / 65536.0 * content;
+    return wxd_text_extent::measure(font ? *font : dc.GetFont(), scale_x, scale_y, utf8, len,
+                                    [&](const wxString& text, wxd_text_extent::Extent* out) {
+                                        dc.GetTextExtent(text, &out->width, &out->height,
+                                                         &out->descent, &out->external_leading,
+                                                         font);
+                                    });
+}
+
+// The caller's clipping box, which SET_CLIP narrows and RESET_CLIP goes back to.
+struct OuterClip {
+    wxRect box;
+    bool set = false;
+
+    void
+    Restore(wxDC& dc) const
+    {
+        dc.DestroyClippingRegion();
+        if (set) {
+            dc.SetClippingRegion(box);
+        }
+    }
+};
+
+size_t
+execute_commands(wxDC& dc, const uint32_t* words, size_t count)
+{
+    OuterClip outer;
+    outer.set = dc.GetClippingBox(outer.box);
+    bool clip_changed = false;
+    size_t executed = 0;
+    size_t pos = 0;
+    while (pos < count) {
+        const uint32_t op = words[pos++];
+        const size_t fixed = fixed_operands(op);
+        if (fixed == kUnknownOp || count - pos < fixed)
+            break;
+        const uint32_t* w = words + pos;
+        const int32_t* a = reinterpret_cast<const int32_t*>(w);
+        size_t tail = 0;
+        if (op == WXD_DRAW_OP_TEXT) {
+            tail = (static_cast<size_t>(w[2]) + 3) / 4;
+        } else if (op == WXD_DRAW_OP_LINES || op == WXD_DRAW_OP_POLYGON) {
+            if (a[0] < 0)
+                break;
+            tail = static_cast<size_t>(a[0]) * 2;
+        }
+        if (count - pos - fixed < tail)
+            break;
+
+        switch (op) {
+        case WXD_DRAW_OP_SET_PEN:
+            apply_pen(dc, unpack_colour(w[0]), a[1], a[2]);
+            break;
+        case WXD_DRAW_OP_SET_BRUSH:
+            apply_brush(dc, unpack_colour(w[0]), a[1]);
+            break;
+        case WXD_DRAW_OP_SET_TEXT_FOREGROUND:
+            dc.SetTextForeground(to_wx_colour(w[0]));
+            break;
+        case WXD_DRAW_OP_SET_TEXT_BACKGROUND:
+            dc.SetTextBackground(to_wx_colour(w[0]));
+            break;
+        case WXD_DRAW_OP_POINT:
+            dc.DrawPoint(a[0], a[1]);
+            break;
+        case WXD_DRAW_OP_LINE:
+            dc.DrawLine(a[0], a[1], a[2], a[3]);
+            break;
+        case WXD_DRAW_OP_RECTANGLE:
+            dc.DrawRectangle(a[0], a[1], a[2], a[3]);
+            break;
+        case WXD_DRAW_OP_ROUNDED_RECTANGLE: {
+            float radius = 0;
+            std::memcpy(&radius, &w[4], sizeof(radius));
+            dc.DrawRoundedRectangle(a[0], a[1], a[2], a[3], radius);
+            break;
+        }
+        case WXD_DRAW_OP_CIRCLE:
+            dc.DrawCircle(a[0], a[1], a[2]);
+            break;
+        case WXD_DRAW_OP_ELLIPSE:
+            dc.DrawEllipse(a[0], a[1], a[2], a[3]);
+            break;
+        case WXD_DRAW_OP_ARC:
+            dc.DrawArc(a[0], a[1], a[2], a[3], a[4], a[5]);
+            break;
+        case WXD_DRAW_OP_TEXT:
+            dc.DrawText(wxd_cpp_utils::ScratchWxString(reinterpret_cast<const char*>(w + 3), w[2]),
+                        a[0], a[1]);
+            break;
+        case WXD_DRAW_OP_LINES:
+            // wxPoint is two ints, as laid out in the stream.
+            if (a[0] > 0)
+                dc.DrawLines(a[0], reinterpret_cast<const wxPoint*>(a + 1));
+            break;
+        case WXD_DRAW_OP_POLYGON:
+            if (a[0] > 0)
+                dc.DrawPolygon(a[0], reinterpret_cast<const wxPoint*>(a + 2), 0, 0,
+                               static_cast<wxPolygonFillMode>(a[1]));
+            break;
+        case WXD_DRAW_OP_SET_CLIP:
+            // wxDC intersects with the current region.
+            outer.Restore(dc);
+            dc.SetClippingRegion(a[0], a[1], a[2], a[3]);
+            clip_changed = true;
+            break;
+        case WXD_DRAW_OP_RESET_CLIP:
+            outer.Restore(dc);
+            clip_changed = false;
+            break;
+        }
+        pos += fixed + tail;
+        ++executed;
+    }
+    if (clip_changed) {
+        outer.Restore(dc);
+    }
+    return executed;
+}
+
+} // namespace
+
+struct wxd_Pen_t {
+    wxPen pen;
+};
+
+struct wxd_Brush_t {
+    wxBrush brush;
+};
+
 // DC Creation/Destruction
 void
 wxd_DC_Destroy(wxd_DC_t* dc)
@@ -232,12 +533,7 @@ void
 wxd_DC_SetPen(wxd_DC_t* dc, wxd_Colour_t colour, int width, int style)
 {
     if (dc) {
-        wxDC* wx_dc = reinterpret_cast<wxDC*>(dc);
-        wxColour wx_color(colour.r, colour.g, colour.b, colour.a);
-
-        wxPenStyle wx_style = static_cast<wxPenStyle>(style);
-
-        wx_dc->SetPen(wxPen(wx_color, width, wx_style));
+        apply_pen(*reinterpret_cast<wxDC*>(dc), colour, width, style);
     }
 }
 
@@ -245,12 +541,49 @@ void
 wxd_DC_SetBrush(wxd_DC_t* dc, wxd_Colour_t colour, int style)
 {
     if (dc) {
-        wxDC* wx_dc = reinterpret_cast<wxDC*>(dc);
-        wxColour wx_color(colour.r, colour.g, colour.b, colour.a);
+        apply_brush(*reinterpret_cast<wxDC*>(dc), colour, style);
+    }
+}
+
+wxd_Pen_t*
+wxd_Pen_Create(wxd_Colour_t colour, int width, int style)
+{
+    return new wxd_Pen_t{ wxPen(wxColour(colour.r, colour.g, colour.b, colour.a), width,
+                                static_cast<wxPenStyle>(style)) };
+}
+
+void
+wxd_Pen_Destroy(wxd_Pen_t* pen)
+{
+    delete pen;
+}
 
-        wxBrushStyle wx_style = static_cast<wxBrushStyle>(style);
+wxd_Brush_t*
+wxd_Brush_Create(wxd_Colour_t colour, int style)
+{
+    return new wxd_Brush_t{ wxBrush(wxColour(colour.r, colour.g, colour.b, colour.a),
+                                    static_cast<wxBrushStyle>(style)) };
+}
 
-        wx_dc->SetBrush(wxBrush(wx_color, wx_style));
+void
+wxd_Brush_Destroy(wxd_Brush_t* brush)
+{
+    delete brush;
+}
+
+void
+wxd_DC_SelectPen(wxd_DC_t* dc, const wxd_Pen_t* pen)
+{
+    if (dc && pen) {
+        reinterpret_cast<wxDC*>(dc)->SetPen(pen->pen);
+    }
+}
+
+void
+wxd_DC_SelectBrush(wxd_DC_t* dc, const wxd_Brush_t* brush)
+{
+    if (dc && brush) {
+        reinterpret_cast<wxDC*>(dc)->SetBrush(brush->brush);
     }
 }
 
@@ -553,12 +886,10 @@ void
 wxd_DC_GetTextExtent(wxd_DC_t* dc, const char* string, int* w, int* h)
 {
     if (dc && string && w && h) {
-        wxDC* wx_dc = reinterpret_cast<wxDC*>(dc);
-        wxString wx_text = wxString::FromUTF8(string);
-        int width, height;
-        wx_dc->GetTextExtent(wx_text, &width, &height);
-        *w = width;
-        *h = height;
+        const wxd_text_extent::Extent extent =
+            dc_text_extent(*reinterpret_cast<wxDC*>(dc), string, std::strlen(string), nullptr);
+        *w = extent.width;
+        *h = extent.height;
     }
 }
 
@@ -709,26 +1040,17 @@ wxd_DC_GetFullTextExtent(wxd_DC_t* dc, const char* string, int* w, int* h, int*
                          int* externalLeading, const wxd_Font_t* font)
 {
     if (dc && string) {
-        wxDC* wx_dc = reinterpret_cast<wxDC*>(dc);
-        wxString wx_text = wxString::FromUTF8(string);
-        wxCoord wx_w, wx_h, wx_descent, wx_externalLeading;
-
-        if (font) {
-            wxFont* wx_font = reinterpret_cast<wxFont*>(const_cast<wxd_Font_t*>(font));
-            wx_dc->GetTextExtent(wx_text, &wx_w, &wx_h, &wx_descent, &wx_externalLeading, wx_font);
-        }
-        else {
-            wx_dc->GetTextExtent(wx_text, &wx_w, &wx_h, &wx_descent, &wx_externalLeading);
-        }
-
+        const wxFont* wx_font = reinterpret_cast<const wxFont*>(font);
+        const wxd_text_extent::Extent extent =
+            dc_text_extent(*reinterpret_cast<wxDC*>(dc), string, std::strlen(string), wx_font);
         if (w)
-            *w = wx_w;
+            *w = extent.width;
         if (h)
-            *h = wx_h;
+            *h = extent.height;
         if (descent)
-            *descent = wx_descent;
+            *descent = extent.descent;
         if (externalLeading)
-            *externalLeading = wx_externalLeading;
+            *externalLeading = extent.external_leading;
     }
 }
 
@@ -922,4 +1244,170 @@ wxd_DC_GetLogicalFunction(wxd_DC_t* dc)
         return static_cast<int>(wx_dc->GetLogicalFunction());
     }
     return static_cast<int>(wxCOPY);
-}
\ No newline at end of file
+}
+
+// Recorded drawing commands
+size_t
+wxd_DC_ExecuteCommands(wxd_DC_t* dc, const uint32_t* words, size_t count,
+                       const wxd_DrawTransform* transform)
+{
+    if (!dc || !words)
+        return 0;
+    wxDC* wx_dc = reinterpret_cast<wxDC*>(dc);
+    if (!transform)
+        return execute_commands(*wx_dc, words, count);
+
+    const wxPoint origin = wx_dc->GetDeviceOrigin();
+    double scale_x = 1.0;
+    double scale_y = 1.0;
+    wx_dc->GetUserScale(&scale_x, &scale_y);
+    wx_dc->SetDeviceOrigin(origin.x + transform->dx, origin.y + transform->dy);
+    wx_dc->SetUserScale(scale_x * transform->sx, scale_y * transform->sy);
+    const size_t executed = execute_commands(*wx_dc, words, count);
+    wx_dc->SetUserScale(scale_x, scale_y);
+    wx_dc->SetDeviceOrigin(origin.x, origin.y);
+    return executed;
+}
+
+// Batched primitives
+namespace {
+
+// Selects the palette pen and brush for each item, skipping the call when the index repeats.
+class ListStyler {
+public:
+    ListStyler(wxDC& dc, const wxd_DrawListStyle* style) : m_dc(dc), m_style(style) {}
+
+    void
+    Apply(size_t i)
+    {
+        if (!m_style)
+            return;
+        if (m_style->pens && m_style->pen_indices) {
+            const uint32_t index = m_style->pen_indices[i];
+            if (index != m_pen && index < m_style->pen_count && m_style->pens[index]) {
+                m_dc.SetPen(m_style->pens[index]->pen);
+                m_pen = index;
+            }
+        }
+        if (m_style->brushes && m_style->brush_indices) {
+            const uint32_t index = m_style->brush_indices[i];
+            if (index != m_brush && index < m_style->brush_count && m_style->brushes[index]) {
+                m_dc.SetBrush(m_style->brushes[index]->brush);
+                m_brush = index;
+            }
+        }
+    }
+
+private:
+    wxDC& m_dc;
+    const wxd_DrawListStyle* m_style;
+    uint32_t m_pen = UINT32_MAX;
+    uint32_t m_brush = UINT32_MAX;
+};
+
+template <typename Draw>
+void
+draw_list(wxd_DC_t* dc, size_t n, const wxd_DrawListStyle* style, Draw draw)
+{
+    wxDC& wx_dc = *reinterpret_cast<wxDC*>(dc);
+    ListStyler styler(wx_dc, style);
+    for (size_t i = 0; i < n; ++i) {
+        styler.Apply(i);
+        draw(wx_dc, i);
+    }
+}
+
+} // namespace
+
+void
+wxd_DC_DrawPointList(wxd_DC_t* dc, const wxd_Point* points, size_t n,
+                     const wxd_DrawListStyle* style)
+{
+    if (!dc || !points)
+        return;
+    draw_list(dc, n, style, [points](wxDC& d, size_t i) { d.DrawPoint(points[i].x, points[i].y); });
+}
+
+void
+wxd_DC_DrawLineList(wxd_DC_t* dc, const wxd_Point* points, size_t n,
+                    const wxd_DrawListStyle* style)
+{
+    if (!dc || !points)
+        return;
+    draw_list(dc, n, style, [points](wxDC& d, size_t i) {
+        const wxd_Point& from = points[2 * i];
+        const wxd_Point& to = points[2 * i + 1];
+        d.DrawLine(from.x, from.y, to.x, to.y);
+    });
+}
+
+void
+wxd_DC_DrawRectangleList(wxd_DC_t* dc, const wxd_Rect* rects, size_t n,
+                         const wxd_DrawListStyle* style)
+{
+    if (!dc || !rects)
+        return;
+    draw_list(dc, n, style, [rects](wxDC& d, size_t i) {
+        d.DrawRectangle(rects[i].x, rects[i].y, rects[i].width, rects[i].height);
+    });
+}
+
+void
+wxd_DC_DrawEllipseList(wxd_DC_t* dc, const wxd_Rect* rects, size_t n,
+                       const wxd_DrawListStyle* style)
+{
+    if (!dc || !rects)
+        return;
+    draw_list(dc, n, style, [rects](wxDC& d, size_t i) {
+        d.DrawEllipse(rects[i].x, rects[i].y, rects[i].width, rects[i].height);
+    });
+}
+
+void
+wxd_DC_DrawCircleList(wxd_DC_t* dc, const wxd_Point* centres, const int32_t* radii, int radius,
+                      size_t n, const wxd_DrawListStyle* style)
+{
+    if (!dc || !centres)
+        return;
+    draw_list(dc, n, style, [centres, radii, radius](wxDC& d, size_t i) {
+        d.DrawCircle(centres[i].x, centres[i].y, radii ? radii[i] : radius);
+    });
+}
+
+void
+wxd_DC_DrawTextList(wxd_DC_t* dc, const char* packed, const uint32_t* offsets,
+                    const wxd_Point* positions, size_t n, const wxd_Colour_t* foregrounds)
+{
+    if (!dc || !offsets || !positions || (!packed && n > 0 && offsets[n] > offsets[0]))
+        return;
+    wxDC* wx_dc = reinterpret_cast<wxDC*>(dc);
+    for (size_t i = 0; i < n; ++i) {
+        if (foregrounds) {
+            const wxd_Colour_t& c = foregrounds[i];
+            wx_dc->SetTextForeground(wxColour(c.r, c.g, c.b, c.a));
+        }
+        const uint32_t begin = offsets[i];
+        const uint32_t end = std::max(offsets[i + 1], begin);
+        wx_dc->DrawText(wxd_cpp_utils::ScratchWxString(packed + begin, end - begin),
+                        positions[i].x, positions[i].y);
+    }
+}
+
+void
+wxd_DC_GetTextExtents(wxd_DC_t* dc, const char* packed, const uint32_t* offsets, size_t n,
+                      int32_t* widths, int32_t* heights)
+{
+    if (!dc || !offsets || (!packed && n > 0 && offsets[n] > offsets[0]))
+        return;
+    wxDC* wx_dc = reinterpret_cast<wxDC*>(dc);
+    for (size_t i = 0; i < n; ++i) {
+        const uint32_t begin = offsets[i];
+        const uint32_t end = std::max(offsets[i + 1], begin);
+        const wxd_text_extent::Extent extent =
+            dc_text_extent(*wx_dc, packed ? packed + begin : "", end - begin, nullptr);
+        if (widths)
+            widths[i] = extent.width;
+        if (heights)
+            heights[i] = extent.height;
+    }
+}
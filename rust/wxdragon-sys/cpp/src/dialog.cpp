@@ -2,6 +2,82 @@
 #include <wx/wx.h>
 #include "wxdragon.h"
 #include "wx/dialog.h"
+#include "wx/weakref.h"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Dialog created by wxd_Dialog_Create: while parked in the pool it does not keep the
+// application running, as a hidden plain wxDialog would.
+class WxdDialog : public wxDialog {
+public:
+    bool pooled = false;
+
+    bool
+    ShouldPreventAppExit() const override
+    {
+        return !pooled && wxDialog::ShouldPreventAppExit();
+    }
+};
+
+// Hidden dialogs kept for reuse, oldest first. GUI-thread only.
+struct PooledDialog {
+    std::string key;
+    wxWeakRef<wxDialog> dialog;
+};
+
+struct DialogPool {
+    std::vector<PooledDialog> entries;
+    size_t per_key = 4;
+    size_t total = 16;
+};
+
+DialogPool&
+dialog_pool()
+{
+    static DialogPool pool;
+    return pool;
+}
+
+void
+set_pooled(wxDialog* dialog, bool pooled)
+{
+    if (auto* ours = dynamic_cast<WxdDialog*>(dialog))
+        ours->pooled = pooled;
+}
+
+// Drops entries whose dialog was destroyed meanwhile (with its parent, for instance).
+void
+prune_pool(DialogPool& pool)
+{
+    pool.entries.erase(std::remove_if(pool.entries.begin(), pool.entries.end(),
+                                      [](const PooledDialog& e) { return !e.dialog; }),
+                       pool.entries.end());
+}
+
+// Destroys the oldest entries (of `key` only, if given) until at most `keep` remain.
+void
+evict(DialogPool& pool, size_t keep, const std::string* key)
+{
+    size_t count = 0;
+    for (const PooledDialog& e : pool.entries) {
+        if (!key || e.key == *key)
+            ++count;
+    }
+    for (auto it = pool.entries.begin(); count > keep && it != pool.entries.end();) {
+        if (key && it->key != *key) {
+            ++it;
+            continue;
+        }
+        it->dialog->Destroy();
+        it = pool.entries.erase(it);
+        --count;
+    }
+}
+
+} // namespace
 
 extern "C" {
 
@@ -17,7 +93,7 @@ wxd_Dialog_Create(wxd_Window_t* parent, const char* title, wxd_Style_t style, in
     wxSize size = (width == -1 && height == -1) ? wxDefaultSize : wxSize(width, height);
 
     // Create the dialog with the provided parameters
-    wxDialog* dialog = new wxDialog();
+    wxDialog* dialog = new WxdDialog();
     if (!dialog->Create(wx_parent, wxID_ANY, wx_title, pos, size, style)) {
         delete dialog;
         return nullptr;
@@ -109,6 +185,101 @@ wxd_Dialog_GetReturnCode(wxd_Dialog* self)
     return ((wxDialog*)self)->GetReturnCode();
 }
 
+// --- Dialog Pool ---
+
+bool
+wxd_Dialog_Release(wxd_Dialog_t* self, const char* key)
+{
+    wxDialog* dialog = reinterpret_cast<wxDialog*>(self);
+    if (!dialog || !key)
+        return false;
+    if (dialog->IsModal())
+        dialog->EndModal(wxID_CANCEL);
+    dialog->Hide();
+    dialog->SetReturnCode(0);
+
+    DialogPool& pool = dialog_pool();
+    prune_pool(pool);
+    if (pool.per_key == 0 || pool.total == 0) {
+        dialog->Destroy();
+        return false;
+    }
+    const std::string name(key);
+    for (const PooledDialog& e : pool.entries) {
+        if (e.dialog == dialog)
+            return true;
+    }
+    evict(pool, pool.per_key - 1, &name);
+    evict(pool, pool.total - 1, nullptr);
+    set_pooled(dialog, true);
+    pool.entries.push_back(PooledDialog{ name, dialog });
+    return true;
+}
+
+wxd_Dialog_t*
+wxd_Dialog_Acquire(const char* key, wxd_dialog_factory_fn factory, void* userdata,
+                   bool* reused)
+{
+    if (reused)
+        *reused = false;
+    if (!key)
+        return nullptr;
+    DialogPool& pool = dialog_pool();
+    prune_pool(pool);
+    // Most recently released first: its native resources are the likeliest to be warm.
+    for (auto it = pool.entries.rbegin(); it != pool.entries.rend(); ++it) {
+        if (it->key != key)
+            continue;
+        wxDialog* dialog = it->dialog;
+        pool.entries.erase(std::next(it).base());
+        set_pooled(dialog, false);
+        if (reused)
+            *reused = true;
+        return reinterpret_cast<wxd_Dialog_t*>(dialog);
+    }
+    return factory ? factory(userdata) : nullptr;
+}
+
+void
+wxd_Dialog_SetPoolLimits(size_t per_key, size_t total)
+{
+    DialogPool& pool = dialog_pool();
+    pool.per_key = per_key;
+    pool.total = total;
+    prune_pool(pool);
+    std::vector<std::string> keys;
+    for (const PooledDialog& e : pool.entries)
+        keys.push_back(e.key);
+    for (const std::string& key : keys)
+        evict(pool, per_key, &key);
+    evict(pool, total, nullptr);
+}
+
+void
+wxd_Dialog_ClearPool(const char* key)
+{
+    DialogPool& pool = dialog_pool();
+    prune_pool(pool);
+    if (key) {
+        const std::string name(key);
+        evict(pool, 0, &name);
+    }
+    else {
+        evict(pool, 0, nullptr);
+    }
+}
+
+size_t
+wxd_Dialog_GetPooledCount(const char* key)
+{
+    DialogPool& pool = dialog_pool();
+    prune_pool(pool);
+    if (!key)
+        return pool.entries.size();
+    return std::count_if(pool.entries.begin(), pool.entries.end(),
+                         [key](const PooledDialog& e) { return e.key == key; });
+}
+
 // Note: wxDialog itself is usually not created directly with a simple 'Create' function in this C API.
 // Derived dialogs (like wxMessageDialog) will have their own creation functions that return a wxd_Dialog* or wxd_SpecificDialog* castable to wxd_Dialog*.
 // Destruction is handled by wxd_Window_Destroy, as wxDialog inherits from wxWindow.
@@ -0,0 +1,218 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef __WINDOWS__
+#include <wx/msw/wrapwin.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+namespace {
+
+constexpr int kDefaultBatch = 512;
+// A partly filled batch is sent after this long, so slow shares show entries as they arrive.
+constexpr auto kFlushInterval = std::chrono::milliseconds(50);
+
+struct Batch {
+    std::vector<std::string> names;
+    std::vector<uint8_t> flags;
+};
+
+// The worker only reads `dir` and `batch_size` and checks `cancelled`; the callback and
+// userdata are touched on the main thread alone.
+struct DirListing {
+    std::string dir;
+    size_t batch_size = kDefaultBatch;
+    std::atomic<bool> cancelled{ false };
+    bool done = false;
+    bool in_callback = false;
+    wxd_DirEntriesCallback callback = nullptr;
+    void* userdata = nullptr;
+    void (*free_userdata)(void*) = nullptr;
+};
+
+void
+release_userdata(DirListing& listing)
+{
+    listing.callback = nullptr;
+    if (listing.free_userdata)
+        listing.free_userdata(listing.userdata);
+    listing.free_userdata = nullptr;
+    listing.userdata = nullptr;
+}
+
+void
+deliver(const std::shared_ptr<DirListing>& listing, Batch batch, int status)
+{
+    wxApp* app = wxTheApp;
+    if (!app)
+        return;
+    app->CallAfter([listing, batch = std::move(batch), status]() {
+        if (listing->cancelled.load(std::memory_order_acquire) || !listing->callback)
+            return;
+        std::vector<const char*> names;
+        names.reserve(batch.names.size());
+        for (const std::string& name : batch.names)
+            names.push_back(name.c_str());
+        if (status != WXD_DIR_LISTING_MORE)
+            listing->done = true;
+        listing->in_callback = true;
+        listing->callback(listing->userdata, names.data(), batch.flags.data(),
+                          static_cast<int>(names.size()), status);
+        listing->in_callback = false;
+        // Destroyed from inside the callback: the userdata could not be freed while in use.
+        if (listing->cancelled.load(std::memory_order_relaxed))
+            release_userdata(*listing);
+    });
+}
+
+// Feeds entries to `emit` until it returns false; false if the directory cannot be opened.
+template <typename Emit>
+bool
+enumerate(const std::string& dir, Emit emit)
+{
+#ifdef __WINDOWS__
+    const wxString pattern = wxString::FromUTF8(dir) + wxS("\\*");
+    WIN32_FIND_DATAW data;
+    // Basic info skips the short 8.3 names; large fetch asks servers for bigger chunks.
+    HANDLE find = ::FindFirstFileExW(pattern.wc_str(), FindExInfoBasic, &data,
+                                     FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
+    if (find == INVALID_HANDLE_VALUE)
+        return false;
+    do {
+        const wchar_t* name = data.cFileName;
+        if (name[0] == L'.' && (name[1] == 0 || (name[1] == L'.' && name[2] == 0)))
+            continue;
+        uint8_t flags = 0;
+        if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+            flags |= WXD_DIR_ENTRY_DIR;
+        if (data.dwFileAttributes & FILE_ATTRIBUTE_HIDDEN)
+            flags |= WXD_DIR_ENTRY_HIDDEN;
+        if (data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)
+            flags |= WXD_DIR_ENTRY_LINK;
+        if (!emit(std::string(wxString(name).utf8_str()), flags))
+            break;
+    } while (::FindNextFileW(find, &data));
+    ::FindClose(find);
+    return true;
+#else
+    DIR* handle = ::opendir(dir.c_str());
+    if (!handle)
+        return false;
+    while (struct dirent* entry = ::readdir(handle)) {
+        const char* name = entry->d_name;
+        if (name[0] == '.' && (name[1] == 0 || (name[1] == '.' && name[2] == 0)))
+            continue;
+        uint8_t flags = name[0] == '.' ? WXD_DIR_ENTRY_HIDDEN : 0;
+#ifdef DT_DIR
+        unsigned char type = entry->d_type;
+#else
+        unsigned char type = 0;
+#endif
+#ifdef DT_UNKNOWN
+        if (type == DT_UNKNOWN) {
+            // Some file systems do not fill d_type; only those entries pay for an lstat.
+            struct stat st;
+            const std::string path = dir + "/" + name;
+            if (::lstat(path.c_str(), &st) == 0)
+                type = S_ISDIR(st.st_mode) ? DT_DIR : S_ISLNK(st.st_mode) ? DT_LNK : DT_REG;
+        }
+#endif
+#ifdef DT_DIR
+        if (type == DT_DIR)
+            flags |= WXD_DIR_ENTRY_DIR;
+        if (type == DT_LNK) {
+            flags |= WXD_DIR_ENTRY_LINK;
+            struct stat st;
+            const std::string path = dir + "/" + name;
+            if (::stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode))
+                flags |= WXD_DIR_ENTRY_DIR;
+        }
+#endif
+        if (!emit(std::string(name), flags))
+            break;
+    }
+    ::closedir(handle);
+    return true;
+#endif
+}
+
+void
+run(std::shared_ptr<DirListing> listing)
+{
+    Batch batch;
+    auto flushed = std::chrono::steady_clock::now();
+    const bool opened = enumerate(listing->dir, [&](std::string name, uint8_t flags) {
+        if (listing->cancelled.load(std::memory_order_relaxed))
+            return false;
+        batch.names.push_back(std::move(name));
+        batch.flags.push_back(flags);
+        const auto now = std::chrono::steady_clock::now();
+        if (batch.names.size() >= listing->batch_size || now - flushed >= kFlushInterval) {
+            deliver(listing, std::move(batch), WXD_DIR_LISTING_MORE);
+            batch = Batch();
+            flushed = now;
+        }
+        return true;
+    });
+    if (listing->cancelled.load(std::memory_order_relaxed))
+        return;
+    deliver(listing, std::move(batch), opened ? WXD_DIR_LISTING_DONE : WXD_DIR_LISTING_FAILED);
+}
+
+// The handle given out holds one reference; the worker and queued batches hold the others.
+struct ListingHandle {
+    std::shared_ptr<DirListing> listing;
+};
+
+} // namespace
+
+extern "C" {
+
+WXD_EXPORTED wxd_DirListing_t*
+wxd_DirListing_Start(const char* dir, int batch_size, wxd_DirEntriesCallback callback,
+                     void* userdata, void (*free_userdata)(void*))
+{
+    if (!dir || !callback || !wxTheApp) {
+        if (free_userdata)
+            free_userdata(userdata);
+        return nullptr;
+    }
+    auto listing = std::make_shared<DirListing>();
+    listing->dir = dir;
+    if (batch_size > 0)
+        listing->batch_size = static_cast<size_t>(batch_size);
+    listing->callback = callback;
+    listing->userdata = userdata;
+    listing->free_userdata = free_userdata;
+    std::thread(run, listing).detach();
+    return reinterpret_cast<wxd_DirListing_t*>(new ListingHandle{ listing });
+}
+
+WXD_EXPORTED void
+wxd_DirListing_Destroy(wxd_DirListing_t* handle)
+{
+    if (!handle)
+        return;
+    ListingHandle* owner = reinterpret_cast<ListingHandle*>(handle);
+    DirListing& listing = *owner->listing;
+    listing.cancelled.store(true, std::memory_order_release);
+    if (!listing.in_callback)
+        release_userdata(listing);
+    delete owner;
+}
+
+WXD_EXPORTED bool
+wxd_DirListing_IsDone(const wxd_DirListing_t* handle)
+{
+    return handle && reinterpret_cast<const ListingHandle*>(handle)->listing->done;
+}
+
+} // extern "C"
@@ -3,6 +3,83 @@
 #include "../include/wxdragon.h"
 #include <wx/dnd.h>
 #include <wx/tokenzr.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef __WINDOWS__
+#include <wx/msw/wrapwin.h>
+#else
+#include <sys/stat.h>
+#endif
+
+namespace {
+
+// Dropped paths as one UTF-8 blob with NUL-terminated entries and count + 1 start offsets.
+struct PackedFiles {
+    std::string blob;
+    std::vector<uint32_t> offsets;
+
+    explicit PackedFiles(const wxArrayString& filenames)
+    {
+        offsets.reserve(filenames.size() + 1);
+        for (const wxString& name : filenames) {
+            offsets.push_back(static_cast<uint32_t>(blob.size()));
+            const wxScopedCharBuffer utf8 = name.utf8_str();
+            blob.append(utf8.data(), utf8.length());
+            blob.push_back('\0');
+        }
+        offsets.push_back(static_cast<uint32_t>(blob.size()));
+    }
+
+    size_t
+    count() const
+    {
+        return offsets.size() - 1;
+    }
+};
+
+wxd_DroppedFileInfo
+stat_dropped_file(const char* path)
+{
+    wxd_DroppedFileInfo info = { 0, 0, 0 };
+#ifdef __WINDOWS__
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!::GetFileAttributesExW(wxString::FromUTF8(path).wc_str(), GetFileExInfoStandard, &data))
+        return info;
+    info.flags = WXD_DROPPED_FILE_EXISTS;
+    if (data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+        info.flags |= WXD_DROPPED_FILE_DIR;
+    if (data.dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT)
+        info.flags |= WXD_DROPPED_FILE_LINK;
+    info.size = (static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+    // FILETIME counts 100ns intervals since 1601.
+    const uint64_t ticks = (static_cast<uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) |
+                           data.ftLastWriteTime.dwLowDateTime;
+    info.modified = static_cast<int64_t>(ticks / 10000000ull) - 11644473600ll;
+#else
+    struct stat st;
+    if (::lstat(path, &st) != 0)
+        return info;
+    info.flags = WXD_DROPPED_FILE_EXISTS;
+    if (S_ISLNK(st.st_mode)) {
+        info.flags |= WXD_DROPPED_FILE_LINK;
+        struct stat target;
+        if (::stat(path, &target) == 0)
+            st = target;
+    }
+    if (S_ISDIR(st.st_mode))
+        info.flags |= WXD_DROPPED_FILE_DIR;
+    info.size = static_cast<uint64_t>(st.st_size);
+    info.modified = static_cast<int64_t>(st.st_mtime);
+#endif
+    return info;
+}
+
+constexpr size_t kDroppedInfoBatch = 1024;
+
+} // namespace
 
 // Full-featured text drop target implementation
 class WxdTextDropTargetFull : public wxTextDropTarget {
@@ -187,9 +264,30 @@ public:
         return baseResult;
     }
 
+    void
+    SetOnDropFilesPacked(wxd_OnDropFilesPacked_Callback callback)
+    {
+        m_onDropFilesPacked = callback;
+    }
+
+    void
+    SetOnDroppedFileInfo(wxd_OnDroppedFileInfo_Callback callback)
+    {
+        m_onFileInfo = callback;
+    }
+
     virtual bool
     OnDropFiles(wxCoord x, wxCoord y, const wxArrayString& filenames) override
     {
+        if (m_onFileInfo) {
+            StreamFileInfo(std::make_shared<const PackedFiles>(filenames));
+            return true;
+        }
+        if (m_onDropFilesPacked) {
+            const PackedFiles packed(filenames);
+            return m_onDropFilesPacked(packed.blob.data(), packed.offsets.data(),
+                                       static_cast<int>(packed.count()), x, y, m_userData);
+        }
         if (m_onDropFiles) {
             return m_onDropFiles(reinterpret_cast<const wxd_ArrayString_t*>(&filenames), x, y,
                                  m_userData);
@@ -198,14 +296,50 @@ public:
     }
 
 private:
+    // Stats the dropped paths on a worker thread and hands them to m_onFileInfo in batches on
+    // the main thread. Batches still queued when the target is destroyed are dropped.
+    void
+    StreamFileInfo(std::shared_ptr<const PackedFiles> files)
+    {
+        std::weak_ptr<WxdFileDropTargetFull*> self = m_self;
+        std::thread([files, self]() {
+            const size_t count = files->count();
+            for (size_t begin = 0; begin < count || begin == 0; begin += kDroppedInfoBatch) {
+                const size_t end = std::min(count, begin + kDroppedInfoBatch);
+                auto infos = std::make_shared<std::vector<wxd_DroppedFileInfo>>();
+                infos->reserve(end - begin);
+                for (size_t i = begin; i < end; ++i)
+                    infos->push_back(stat_dropped_file(files->blob.data() + files->offsets[i]));
+                wxApp* app = wxTheApp;
+                if (!app || self.expired())
+                    return;
+                const bool done = end == count;
+                app->CallAfter([files, self, infos, begin, done]() {
+                    std::shared_ptr<WxdFileDropTargetFull*> target = self.lock();
+                    if (!target || !(*target)->m_onFileInfo)
+                        return;
+                    (*target)->m_onFileInfo(files->blob.data(), files->offsets.data() + begin,
+                                            infos->data(), static_cast<int>(infos->size()), done,
+                                            (*target)->m_userData);
+                });
+                if (done)
+                    return;
+            }
+        }).detach();
+    }
+
     wxd_OnEnter_Callback m_onEnter;
     wxd_OnDragOver_Callback m_onDragOver;
     wxd_OnLeave_Callback m_onLeave;
     wxd_OnDrop_Callback m_onDrop;
     wxd_OnData_Callback m_onData;
     wxd_OnDropFiles_Callback m_onDropFiles;
+    wxd_OnDropFilesPacked_Callback m_onDropFilesPacked = nullptr;
+    wxd_OnDroppedFileInfo_Callback m_onFileInfo = nullptr;
     void* m_userData;
     wxd_FreeUserData_Callback m_freeUserData;
+    // Expires with the target; queued batches check it on the main thread.
+    std::shared_ptr<WxdFileDropTargetFull*> m_self = std::make_shared<WxdFileDropTargetFull*>(this);
 };
 
 extern "C" {
@@ -254,4 +388,21 @@ wxd_FileDropTarget_CreateFull(wxd_Window_t* window, wxd_OnEnter_Callback onEnter
     return reinterpret_cast<wxd_FileDropTarget_t*>(drop_target);
 }
 
-} // extern "C"
\ No newline at end of file
+WXD_EXPORTED void
+wxd_FileDropTarget_SetOnDropFilesPacked(wxd_FileDropTarget_t* dropTarget,
+                                        wxd_OnDropFilesPacked_Callback onDropFilesPacked)
+{
+    if (dropTarget)
+        reinterpret_cast<WxdFileDropTargetFull*>(dropTarget)
+            ->SetOnDropFilesPacked(onDropFilesPacked);
+}
+
+WXD_EXPORTED void
+wxd_FileDropTarget_SetOnDroppedFileInfo(wxd_FileDropTarget_t* dropTarget,
+                                        wxd_OnDroppedFileInfo_Callback onFileInfo)
+{
+    if (dropTarget)
+        reinterpret_cast<WxdFileDropTargetFull*>(dropTarget)->SetOnDroppedFileInfo(onFileInfo);
+}
+
+} // extern "C"
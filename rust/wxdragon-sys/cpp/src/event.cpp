@@ -2,13 +2,17 @@
 #include <wx/wx.h>
 #include "../include/wxdragon.h"
 // #include "../include/events/wxd_event_api.h" // No longer needed, wxd_Event_t defined in wxd_types.h (via wxdragon.h)
-#include <unordered_map>
-#include <vector>     // For std::vector used in closureMap
+#include <algorithm>  // For std::lower_bound over the dispatch table
+#include <chrono>     // Rate-limited binding deadlines
+#include <cstring>    // Copying child process output
+#include <unordered_map> // For the wxEventType -> C enum reverse table
+#include <vector>     // For std::vector used in the dispatch table
 #include <memory>     // For std::unique_ptr if we want safer memory management
-#include <tuple>      // For std::pair used in map key
 #include <inttypes.h> // for PRIxPTR to format pointers as 0x...
 #include <wx/event.h>
 #include <wx/app.h>
+#include <wx/timer.h>      // Shared timer of rate-limited bindings
+#include <wx/dcbuffer.h>   // wxAutoBufferedPaintDC of buffered paint bindings
 #include <wx/window.h>     // For wxCloseEvent
 #include <wx/tglbtn.h>     // ADDED for wxEVT_TOGGLEBUTTON
 #include <wx/treectrl.h>   // ADDED: For wxEVT_TREE_* constants
@@ -28,9 +32,22 @@
 #include <wx/filepicker.h> // ADDED: For wxEVT_FILEPICKER_CHANGED and wxEVT_DIRPICKER_CHANGED
 #include <wx/fontpicker.h> // ADDED: For wxEVT_FONTPICKER_CHANGED
 #include <wx/notifmsg.h>   // For wxNotificationMessage events
+#include "wxd_watchdog.h"   // Stall watchdog dispatch markers
+#include "wxd_latency.h"    // Paint-end hook for the input latency probe
+#include "wxd_objstats.h"   // Live object accounting
+#include "wxd_window_timing.h" // Per-window paint/size timing
+#include "wxd_trace.h"          // Event-loop timeline spans
+#include "wxd_pool.h"           // Pooled handler and closure records
+#include "wxd_spatialindex.h" // wxdEVT_SPATIAL_HOVER_CHANGED
+#include "wxd_fswatcher.h"     // wxdEVT_FS_CHANGES
+#include "wxd_process.h"       // wxdEVT_PROCESS_OUTPUT, wxdEVT_PROCESS_EXIT
+#include "wxd_thread_event.h"  // wxdEVT_THREAD_MESSAGE
+#include "wxd_visibility.h"    // wxdEVT_VISIBILITY_CHANGED
+#include "wxd_pointer_history.h" // Motion samples of coalesced MOTION deliveries
 #include <wx/dnd.h>  // ADDED: For drag and drop events (wxEVT_BEGIN_DRAG, wxEVT_DROP_TEXT, etc.)
 #include <wx/menu.h> // NEW: For wxMenuEvent and wxEVT_MENU_* events
 #include <wx/taskbar.h> // Needed for wxEVT_TASKBAR_* constants
+#include <wx/socket.h>  // For wxEVT_SOCKET and wxSocketEvent
 #include <wx/timectrl.h> // ADDED: For wxTimePickerCtrl and wxEVT_TIME_CHANGED
 #if wxdUSE_MEDIACTRL
 #include <wx/mediactrl.h> // ADDED: For MediaCtrl events
@@ -72,24 +89,71 @@ wx_cls(const wxEvtHandler* h)
 
 // --- Internal C++ Structures/Classes (Not exposed in C API) ---
 
-// Define a hash function for std::pair<int, int>
-struct PairHash {
-    template <class T1, class T2>
-    std::size_t
-    operator()(const std::pair<T1, T2>& p) const
-    {
-        auto hash1 = std::hash<T1>{}(p.first);
-        auto hash2 = std::hash<T2>{}(p.second);
-        // Simple combination hash - consider better alternatives if collisions become an issue
-        return hash1 ^ (hash2 << 1);
-    }
+// Events held back by a coalesced binding until the next event-loop iteration, one per id
+// (and per wheel axis, so vertical and horizontal scrolling are summed apart).
+struct CoalescedPending {
+    wxd_Id id = wxID_ANY;
+    int wheel_axis = -1; // wxMouseWheelAxis of wxEVT_MOUSEWHEEL entries, -1 otherwise
+    std::unique_ptr<wxEvent> event; // Clone of the newest event
+    int count = 0;                  // Number of events merged into `event`
+    int wheel_rotation = 0;         // Sum of the merged wxEVT_MOUSEWHEEL rotations
+    std::vector<wxd_PointerSample> samples; // Positions of the merged wxEVT_MOTION events
+};
+
+struct CoalesceState {
+    std::vector<CoalescedPending> pending;
+};
+
+using RateClock = std::chrono::steady_clock;
+
+// Debounce/throttle state of one wxd_EvtHandler_BindRateLimited binding. The deadlines of all
+// such bindings on a handler share that handler's single timer.
+struct RateLimitState {
+    int mode = WXD_RATE_LIMIT_DEBOUNCE; // wxd_RateLimitMode
+    RateClock::duration interval{};
+    std::unique_ptr<wxEvent> pending; // Clone of the newest held-back event
+    int count = 0;                    // Events merged into the next delivery
+    RateClock::time_point due{};      // When `pending` is delivered
+    RateClock::time_point last_delivery{};
+    bool delivered = false;
 };
 
 // Structure to hold the Rust closure information
+enum class PaintBinding : uint8_t { None, Plain, Buffered };
+
 struct RustClosureInfo {
     void* closure_ptr = nullptr;
     wxd_ClosureCallback rust_trampoline = nullptr; // Store the trampoline func ptr
     size_t token = 0;                              // NEW: Unique identifier for unbinding
+    bool removed = false; // Unbound while a dispatch was in flight; purged afterwards
+    // Set for wxd_EvtHandler_BindCoalesced bindings; shared so copies taken during dispatch
+    // see the same pending events.
+    std::shared_ptr<CoalesceState> coalesce;
+    // Set for wxd_EvtHandler_BindRateLimited bindings.
+    std::shared_ptr<RateLimitState> rate_limit;
+    // Set for wxd_EvtHandler_BindPaint bindings, whose trampoline is a wxd_PaintCallback.
+    PaintBinding paint = PaintBinding::None;
+};
+
+// Packs (eventType, widgetId) into one integer so slot lookup is a plain integer compare.
+static inline uint64_t
+make_dispatch_key(wxEventType event_type, wxd_Id id)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(event_type)) << 32) |
+           static_cast<uint64_t>(static_cast<uint32_t>(id));
+}
+
+// Nearly every slot holds a single closure, so that first record comes from a pool.
+using ClosureList = std::vector<RustClosureInfo, wxd_pool::SingleAllocator<RustClosureInfo>>;
+
+// One (eventType, widgetId) binding: the closures to call, in bind order.
+// A slot exists exactly as long as wxWidgets has DispatchEvent bound for that key,
+// so it replaces the old separate "bindings made" bookkeeping.
+struct DispatchSlot {
+    uint64_t key = 0;
+    wxEventType event_type = wxEVT_NULL;
+    wxd_Id id = wxID_ANY;
+    ClosureList closures;
 };
 
 // Forward declarations
@@ -181,6 +245,21 @@ public:
     }
     virtual ~WxdHandlerClientData(); // Defined after WxdEventHandler
 
+    // One per bound window; pooled so building and tearing down large screens stays cheap.
+    static void*
+    operator new(size_t size)
+    {
+        wxASSERT(size == sizeof(WxdHandlerClientData));
+        return wxd_pool::FixedPool<sizeof(WxdHandlerClientData),
+                                   alignof(WxdHandlerClientData)>::allocate();
+    }
+    static void
+    operator delete(void* block)
+    {
+        wxd_pool::FixedPool<sizeof(WxdHandlerClientData),
+                            alignof(WxdHandlerClientData)>::deallocate(block);
+    }
+
     bool
     UnbindClosure(size_t token);
 };
@@ -188,21 +267,14 @@ public:
 // Custom Event Handler class to connect wx events to Rust closures
 class WxdEventHandler : public wxEvtHandler {
 public:
-    // Map (eventType, widgetId) pair to a vector of Rust closure info
-    std::unordered_map<std::pair<wxEventType, wxd_Id>, std::vector<RustClosureInfo>, PairHash>
-        closureMap;
-
-    // NEW: Fast lookup - token -> location of closure
-    // Location = (eventType, widgetId, closure_ptr)
-    // Note: We store closure_ptr instead of index because indices become stale after removals
-    std::unordered_map<size_t, std::tuple<wxEventType, wxd_Id, void*>> tokenMap;
-
-    // Track whether we've already bound DispatchEvent to wxWidgets for each event key
-    std::unordered_map<std::pair<wxEventType, wxd_Id>, bool, PairHash> wx_bindings_made;
+    // All bindings of this handler, kept sorted by DispatchSlot::key so that a dispatch is a
+    // binary search over one contiguous array instead of several hash lookups.
+    std::vector<DispatchSlot> slots;
     wxEvtHandler* ownerHandler = nullptr; // Store the actual wxEvtHandler*
 
     WxdEventHandler(wxEvtHandler* owner) : ownerHandler(owner)
     {
+        wxd_objstats::track(WXD_OBJECT_KIND_EVENT_HANDLER, this);
         WXD_LOG_TRACEF("WxdEventHandler 0x%" PRIxPTR " created for wxEvtHandler 0x%p cls=%s",
                        (uintptr_t)this, ownerHandler, wx_cls(ownerHandler).c_str());
     }
@@ -210,13 +282,24 @@ public:
     // Destructor - Now needs to notify Rust to drop closures via drop_rust_event_closure_box
     ~WxdEventHandler(); // Declaration moved, definition below
 
+    static void*
+    operator new(size_t size);
+    static void
+    operator delete(void* block);
+
     void
     BindClosure(wxEventType wx_event_type, wxd_Id actual_id, void* rust_trampoline_fn,
-                void* rust_closure_ptr, size_t token);
+                void* rust_closure_ptr, size_t token, bool coalesce = false,
+                std::shared_ptr<RateLimitState> rate_limit = nullptr,
+                PaintBinding paint = PaintBinding::None);
     bool
     UnbindClosure(size_t token);
     size_t
     UnbindAll();
+    // Drops every closure after the owner's own wxEVT_DESTROY. The owner's event table goes
+    // away with it, so nothing is disconnected.
+    void
+    ReleaseForOwnerDestroy();
 
     // The new dispatch method that handles multiple closures per event
     void
@@ -225,6 +308,46 @@ public:
     // Special dispatch method for close events with correct signature
     void
     DispatchCloseEvent(wxCloseEvent& event);
+
+private:
+    // Nesting depth of DispatchEvent; closures are only tombstoned while this is non-zero.
+    int m_dispatchDepth = 0;
+    // True when tombstoned closures are waiting for PurgeRemoved().
+    bool m_purgePending = false;
+    // Bumped whenever `slots` may have been reallocated, so a running dispatch re-finds its slot.
+    unsigned m_slotsGeneration = 0;
+    // True while a FlushCoalesced() call is queued with CallAfter().
+    bool m_flushQueued = false;
+    // Set by ReleaseForOwnerDestroy(); slots are then dropped without disconnecting them.
+    bool m_ownerDestroyed = false;
+    // Created with the first rate-limited binding; fires at the earliest pending deadline.
+    wxTimer* m_rateTimer = nullptr;
+
+    DispatchSlot*
+    FindSlot(uint64_t key);
+    void
+    DisconnectSlot(const DispatchSlot& slot);
+    void
+    PurgeRemoved();
+    // Removes all closures with one batched Rust drop; returns how many were live.
+    size_t
+    DropAll();
+    // Calls the live closures of `key` that existed when the call started; returns true if one
+    // consumed the event.
+    bool
+    RunSlot(uint64_t key, wxEvent& event, bool keep_dispatching_after_consume);
+    RustClosureInfo*
+    FindClosure(size_t token);
+    void
+    QueueCoalesced(CoalesceState& state, wxEvent& event);
+    void
+    FlushCoalesced();
+    void
+    QueueRateLimited(RateLimitState& state, const RustClosureInfo& info, wxEvent& event);
+    void
+    ScheduleRateTimer();
+    void
+    OnRateTimer(wxTimerEvent& event);
 };
 
 // Define WxdHandlerClientData destructor (no change needed here, it still just deletes the handler)
@@ -243,112 +366,554 @@ WxdHandlerClientData::UnbindClosure(size_t token)
     return false;
 }
 
+// Out of line: the pool needs the complete class for its block size.
+void*
+WxdEventHandler::operator new(size_t size)
+{
+    wxASSERT(size == sizeof(WxdEventHandler));
+    return wxd_pool::FixedPool<sizeof(WxdEventHandler), alignof(WxdEventHandler)>::allocate();
+}
+
+void
+WxdEventHandler::operator delete(void* block)
+{
+    wxd_pool::FixedPool<sizeof(WxdEventHandler), alignof(WxdEventHandler)>::deallocate(block);
+}
+
 // WxdEventHandler Destructor Implementation
 WxdEventHandler::~WxdEventHandler()
 {
     WXD_LOG_TRACEF("WxdEventHandler 0x%" PRIxPTR " destroying. cls=%s", (uintptr_t)this,
                    wx_cls(ownerHandler).c_str());
-    for (auto const& [key, closure_vector] : closureMap) {
-        for (auto const& info : closure_vector) {
+    // Tell Rust to drop the remaining closures, all in one call
+    std::vector<void*> boxes;
+    for (auto const& slot : slots) {
+        for (auto const& info : slot.closures) {
             if (info.closure_ptr) {
-                // Tell Rust to drop the Box corresponding to this pointer
-                drop_rust_event_closure_box(info.closure_ptr);
+                boxes.push_back(info.closure_ptr);
+                wxd_objstats::untrack(WXD_OBJECT_KIND_EVENT_CLOSURE, &info);
             }
         }
     }
-    // Clear the maps (optional, as the handler is being destroyed)
-    closureMap.clear();
-    wx_bindings_made.clear();
+    // Clear the table (optional, as the handler is being destroyed)
+    slots.clear();
+    delete m_rateTimer;
+    if (!boxes.empty()) {
+        drop_rust_event_closure_boxes(boxes.data(), boxes.size());
+    }
+    wxd_objstats::untrack(WXD_OBJECT_KIND_EVENT_HANDLER, this);
 }
 
-bool
-WxdEventHandler::UnbindClosure(size_t token)
+DispatchSlot*
+WxdEventHandler::FindSlot(uint64_t key)
 {
-    // Look up token in map
-    auto token_it = this->tokenMap.find(token);
-    if (token_it == this->tokenMap.end()) {
-        return false; // Token doesn't exist or already unbound
+    auto it = std::lower_bound(slots.begin(), slots.end(), key,
+                               [](const DispatchSlot& s, uint64_t k) { return s.key < k; });
+    if (it == slots.end() || it->key != key) {
+        return nullptr;
     }
+    return &*it;
+}
 
-    // Extract location info (C++11 compatible)
-    wxEventType event_type = std::get<0>(token_it->second);
-    wxd_Id widget_id = std::get<1>(token_it->second);
-    void* closure_ptr = std::get<2>(token_it->second);
-    std::pair<wxEventType, wxd_Id> map_key = { event_type, widget_id };
+void
+WxdEventHandler::DisconnectSlot(const DispatchSlot& slot)
+{
+    if (m_ownerDestroyed) {
+        return;
+    }
+    // Disconnect from wxWidgets event system
+    if (IsVetableEventType(slot.event_type)) {
+        wxEventFunction event_func;
+        if (slot.event_type == wxEVT_CLOSE_WINDOW) {
+            event_func = wxCloseEventHandler(WxdEventHandler::DispatchCloseEvent);
+        }
+        else {
+            event_func = wxEventHandler(WxdEventHandler::DispatchEvent);
+        }
+        this->ownerHandler->Disconnect(slot.event_type, event_func, nullptr, this);
+    }
+    else {
+        // For Bind-based events, provide ID range for Unbind
+        this->ownerHandler->Unbind(slot.event_type, &WxdEventHandler::DispatchEvent, this, slot.id,
+                                   slot.id);
+    }
+}
 
-    // Find the closure vector
-    auto closure_it = this->closureMap.find(map_key);
-    if (closure_it == this->closureMap.end()) {
-        this->tokenMap.erase(token_it); // Remove stale token mapping (closure vector not found)
-        return false;
+// Erases closures that were unbound during a dispatch and drops slots left empty.
+void
+WxdEventHandler::PurgeRemoved()
+{
+    m_purgePending = false;
+    for (size_t i = 0; i < slots.size();) {
+        auto& closures = slots[i].closures;
+        closures.erase(std::remove_if(closures.begin(), closures.end(),
+                                      [](const RustClosureInfo& c) { return c.removed; }),
+                       closures.end());
+        if (closures.empty()) {
+            DispatchSlot slot = std::move(slots[i]);
+            slots.erase(slots.begin() + i);
+            ++m_slotsGeneration;
+            DisconnectSlot(slot);
+        }
+        else {
+            ++i;
+        }
     }
+}
 
-    auto& closure_vec = closure_it->second;
+bool
+WxdEventHandler::UnbindClosure(size_t token)
+{
+    // Tokens are unique across the handler; bindings per handler are few, so a scan is cheap
+    // and keeps the hot dispatch path free of a second index structure.
+    for (size_t i = 0; i < slots.size(); ++i) {
+        auto& closures = slots[i].closures;
+        for (auto vec_it = closures.begin(); vec_it != closures.end(); ++vec_it) {
+            if (vec_it->token != token || vec_it->removed) {
+                continue;
+            }
 
-    // Search for the closure by token (tokens are unique)
-    bool found = false;
-    for (auto vec_it = closure_vec.begin(); vec_it != closure_vec.end(); ++vec_it) {
-        if (vec_it->token == token) {
             // Found it! Drop the Rust closure
             if (vec_it->closure_ptr) {
                 drop_rust_event_closure_box(vec_it->closure_ptr);
+                vec_it->closure_ptr = nullptr;
+                wxd_objstats::untrack(WXD_OBJECT_KIND_EVENT_CLOSURE, &*vec_it);
             }
 
-            // Remove from vector
-            closure_vec.erase(vec_it);
-            found = true;
-            break;
+            // A dispatch may be iterating this vector; defer the erase until it returns.
+            if (m_dispatchDepth > 0) {
+                vec_it->removed = true;
+                m_purgePending = true;
+                return true;
+            }
+
+            closures.erase(vec_it);
+
+            // If no more closures for this event, unbind from wxWidgets
+            if (closures.empty()) {
+                DispatchSlot slot = std::move(slots[i]);
+                slots.erase(slots.begin() + i);
+                ++m_slotsGeneration;
+                DisconnectSlot(slot);
+            }
+            return true;
         }
     }
 
-    // Remove token from map only if closure was found
-    if (!found) {
-        return false;
+    return false; // Token doesn't exist or already unbound
+}
+
+size_t
+WxdEventHandler::DropAll()
+{
+    std::vector<void*> boxes;
+    size_t removed = 0;
+    for (auto& slot : slots) {
+        for (auto& info : slot.closures) {
+            if (info.removed) {
+                continue;
+            }
+            if (info.closure_ptr) {
+                boxes.push_back(info.closure_ptr);
+                info.closure_ptr = nullptr;
+                wxd_objstats::untrack(WXD_OBJECT_KIND_EVENT_CLOSURE, &info);
+            }
+            info.removed = true;
+            ++removed;
+        }
     }
-    this->tokenMap.erase(token_it);
 
-    // If no more closures for this event, unbind from wxWidgets
-    if (closure_vec.empty()) {
-        this->closureMap.erase(closure_it);
-        this->wx_bindings_made.erase(map_key);
+    if (m_dispatchDepth > 0) {
+        // A dispatch is walking the table; PurgeRemoved() erases the tombstones afterwards.
+        m_purgePending = m_purgePending || removed > 0;
+    }
+    else if (!slots.empty()) {
+        std::vector<DispatchSlot> dropped;
+        dropped.swap(slots);
+        ++m_slotsGeneration;
+        // One disconnect per slot rather than per closure, and none once the owner is dying.
+        for (const auto& slot : dropped) {
+            DisconnectSlot(slot);
+        }
+    }
 
-        // Disconnect from wxWidgets event system
-        if (IsVetableEventType(event_type)) {
-            wxEventFunction event_func;
-            if (event_type == wxEVT_CLOSE_WINDOW) {
-                event_func = wxCloseEventHandler(WxdEventHandler::DispatchCloseEvent);
+    // Rust may run arbitrary drop code, so it goes last, with the table already consistent.
+    if (!boxes.empty()) {
+        drop_rust_event_closure_boxes(boxes.data(), boxes.size());
+    }
+    return removed;
+}
+
+size_t
+WxdEventHandler::UnbindAll()
+{
+    return DropAll();
+}
+
+void
+WxdEventHandler::ReleaseForOwnerDestroy()
+{
+    m_ownerDestroyed = true;
+    (void)DropAll();
+}
+
+// The paint DC and update rects of one wxEVT_PAINT dispatch, created before the first paint
+// binding runs and shared by every paint binding of the event: a window may only create one
+// wxPaintDC per paint event.
+class PaintScope {
+public:
+    PaintScope(wxWindow* window, bool buffered)
+    {
+        if (buffered)
+            m_dc.reset(new wxAutoBufferedPaintDC(window));
+        else
+            m_dc.reset(new wxPaintDC(window));
+
+        const wxRegion& region = window->GetUpdateRegion();
+        for (wxRegionIterator it(region); it; ++it) {
+            const wxRect rect = it.GetRect();
+            m_rects.push_back(wxd_Rect{ rect.x, rect.y, rect.width, rect.height });
+        }
+        const wxRect box = region.GetBox();
+        m_context.dc = reinterpret_cast<wxd_DC_t*>(m_dc.get());
+        m_context.rects = m_rects.empty() ? nullptr : m_rects.data();
+        m_context.rect_count = m_rects.size();
+        m_context.bounds = wxd_Rect{ box.x, box.y, box.width, box.height };
+    }
+
+    PaintScope(const PaintScope&) = delete;
+    PaintScope& operator=(const PaintScope&) = delete;
+
+    const wxd_PaintContext*
+    Context() const
+    {
+        return &m_context;
+    }
+
+private:
+    std::unique_ptr<wxDC> m_dc;
+    std::vector<wxd_Rect> m_rects;
+    wxd_PaintContext m_context = {};
+};
+
+bool
+WxdEventHandler::RunSlot(uint64_t key, wxEvent& event, bool keep_dispatching_after_consume)
+{
+    DispatchSlot* slot = FindSlot(key);
+    if (!slot) {
+        return false;
+    }
+
+    bool event_consumed = false;
+    // Set once a handler consumed the event; later coalesced and rate-limited bindings still
+    // queue it, since they never take part in consuming.
+    bool handlers_done = false;
+    unsigned generation = m_slotsGeneration;
+    std::unique_ptr<PaintScope> paint;
+    // Closures bound by a handler during this call are appended and first run on the next event.
+    const size_t count = slot->closures.size();
+    for (size_t i = 0; i < count; ++i) {
+        if (generation != m_slotsGeneration) {
+            // A handler bound a new key and the table moved; indices inside the slot are stable
+            // while dispatching because removals are only tombstoned.
+            generation = m_slotsGeneration;
+            slot = FindSlot(key);
+            if (!slot) {
+                break;
             }
-            else {
-                event_func = wxEventHandler(WxdEventHandler::DispatchEvent);
+        }
+
+        // Copy out before the call: the handler may grow this vector.
+        const RustClosureInfo info = slot->closures[i];
+        if (info.removed || !info.closure_ptr || !info.rust_trampoline) {
+            continue;
+        }
+
+        if (info.coalesce) {
+            // Delivered later from FlushCoalesced(), so it can neither consume nor veto this event.
+            QueueCoalesced(*info.coalesce, event);
+            continue;
+        }
+        if (info.rate_limit) {
+            // Same contract as coalescing: never consumes, even when delivered immediately.
+            QueueRateLimited(*info.rate_limit, info, event);
+            continue;
+        }
+        if (handlers_done) {
+            continue;
+        }
+
+        // Reset skip to true before each handler call
+        event.Skip(true);
+
+        // Call the Rust trampoline function
+        wxd_watchdog::set_binding(info.token);
+        if (info.paint != PaintBinding::None) {
+            if (!paint) {
+                wxWindow* window = wxDynamicCast(event.GetEventObject(), wxWindow);
+                if (!window) {
+                    continue;
+                }
+                paint.reset(new PaintScope(window, info.paint == PaintBinding::Buffered));
             }
-            this->ownerHandler->Disconnect(event_type, event_func, nullptr, this);
+            reinterpret_cast<wxd_PaintCallback>(info.rust_trampoline)(
+                info.closure_ptr, reinterpret_cast<wxd_Event_t*>(&event), paint->Context());
         }
         else {
-            // For Bind-based events, provide ID range for Unbind
-            this->ownerHandler->Unbind(event_type, &WxdEventHandler::DispatchEvent, this, widget_id,
-                                       widget_id);
+            info.rust_trampoline(info.closure_ptr, reinterpret_cast<wxd_Event_t*>(&event));
+        }
+
+        // Check if this handler consumed the event
+        if (!event.GetSkipped()) {
+            event_consumed = true;
+            if (!keep_dispatching_after_consume) {
+                handlers_done = true; // Stop calling further handlers
+            }
         }
     }
+    return event_consumed;
+}
 
-    return true;
+RustClosureInfo*
+WxdEventHandler::FindClosure(size_t token)
+{
+    for (auto& slot : slots) {
+        for (auto& info : slot.closures) {
+            if (info.token == token && !info.removed) {
+                return &info;
+            }
+        }
+    }
+    return nullptr;
 }
 
-size_t
-WxdEventHandler::UnbindAll()
+// Merges `event` into the pending copy for its id and makes sure a flush is queued.
+void
+WxdEventHandler::QueueCoalesced(CoalesceState& state, wxEvent& event)
+{
+    const wxd_Id id = event.GetId();
+    wxMouseEvent* wheel_event = event.GetEventType() == wxEVT_MOUSEWHEEL
+                                    ? wxDynamicCast(&event, wxMouseEvent)
+                                    : nullptr;
+    const int axis = wheel_event ? static_cast<int>(wheel_event->GetWheelAxis()) : -1;
+    auto it = std::find_if(state.pending.begin(), state.pending.end(),
+                           [id, axis](const CoalescedPending& p) {
+                               return p.id == id && p.wheel_axis == axis;
+                           });
+    if (it == state.pending.end()) {
+        state.pending.emplace_back();
+        it = state.pending.end() - 1;
+        it->id = id;
+        it->wheel_axis = axis;
+    }
+
+    if (wheel_event) {
+        it->wheel_rotation += wheel_event->GetWheelRotation();
+    } else if (event.GetEventType() == wxEVT_MOTION) {
+        wxMouseEvent* mouse_event = wxDynamicCast(&event, wxMouseEvent);
+        if (mouse_event) {
+            wxd_pointer_history::collect(*mouse_event, it->samples);
+        }
+    }
+    it->count++;
+    it->event.reset(event.Clone()); // Only the newest state is delivered
+
+    if (!m_flushQueued) {
+        m_flushQueued = true;
+        CallAfter(&WxdEventHandler::FlushCoalesced);
+    }
+}
+
+// Coalesced event currently being delivered, read by wxd_Event_GetCoalescedCount() and
+// wxd_MouseEvent_GetPointerHistory().
+static const wxEvent* s_coalescedEvent = nullptr;
+static int s_coalescedCount = 1;
+static const std::vector<wxd_PointerSample>* s_coalescedSamples = nullptr;
+
+void
+WxdEventHandler::FlushCoalesced()
 {
-    // Copy tokens to avoid iterator invalidation
+    m_flushQueued = false;
+
+    // Collect the tokens first: delivering may bind, unbind or queue more events.
     std::vector<size_t> tokens;
-    tokens.reserve(this->tokenMap.size());
-    for (const auto& kv : this->tokenMap) {
-        tokens.push_back(kv.first);
+    for (const auto& slot : slots) {
+        for (const auto& info : slot.closures) {
+            if (!info.removed && info.coalesce && !info.coalesce->pending.empty()) {
+                tokens.push_back(info.token);
+            }
+        }
     }
-    size_t removed = 0;
-    for (size_t t : tokens) {
-        if (this->UnbindClosure(t)) {
-            ++removed;
+
+    ++m_dispatchDepth;
+    for (size_t token : tokens) {
+        RustClosureInfo* info = FindClosure(token);
+        if (!info) {
+            continue;
+        }
+        // Events arriving during delivery start a new batch for the next iteration.
+        std::vector<CoalescedPending> batch;
+        batch.swap(info->coalesce->pending);
+
+        for (auto& pending : batch) {
+            // Re-find after each call; the closure may have unbound itself or the table moved.
+            info = FindClosure(token);
+            if (!info || !info->closure_ptr || !info->rust_trampoline) {
+                break;
+            }
+            if (!pending.event) {
+                continue;
+            }
+
+            if (pending.event->GetEventType() == wxEVT_MOUSEWHEEL) {
+                wxMouseEvent* mouse_event = wxDynamicCast(pending.event.get(), wxMouseEvent);
+                if (mouse_event) {
+                    mouse_event->m_wheelRotation = pending.wheel_rotation;
+                }
+            }
+            pending.event->Skip(true);
+
+            s_coalescedEvent = pending.event.get();
+            s_coalescedCount = pending.count;
+            s_coalescedSamples = &pending.samples;
+            wxd_watchdog::Scope watch(pending.event->GetEventType(), ownerHandler);
+            wxd_trace::Span trace_span(pending.event->GetEventType(), ownerHandler);
+            wxd_watchdog::set_binding(info->token);
+            info->rust_trampoline(info->closure_ptr,
+                                  reinterpret_cast<wxd_Event_t*>(pending.event.get()));
+            s_coalescedEvent = nullptr;
+            s_coalescedCount = 1;
+            s_coalescedSamples = nullptr;
         }
     }
-    return removed;
+    --m_dispatchDepth;
+
+    if (m_dispatchDepth == 0 && m_purgePending) {
+        PurgeRemoved();
+    }
+}
+
+// Debounce restarts the deadline on every event; throttle delivers at once when the interval
+// since the last delivery has passed and otherwise holds the newest event until it has.
+void
+WxdEventHandler::QueueRateLimited(RateLimitState& state, const RustClosureInfo& info,
+                                  wxEvent& event)
+{
+    const RateClock::time_point now = RateClock::now();
+    state.count++;
+
+    if (state.mode == WXD_RATE_LIMIT_THROTTLE && !state.pending &&
+        (!state.delivered || now - state.last_delivery >= state.interval)) {
+        state.last_delivery = now;
+        state.delivered = true;
+        s_coalescedEvent = &event;
+        s_coalescedCount = state.count;
+        state.count = 0;
+        // The delivery never consumes: keep whatever an earlier handler decided.
+        const bool skipped = event.GetSkipped();
+        event.Skip(true);
+        wxd_watchdog::set_binding(info.token);
+        info.rust_trampoline(info.closure_ptr, reinterpret_cast<wxd_Event_t*>(&event));
+        s_coalescedEvent = nullptr;
+        s_coalescedCount = 1;
+        event.Skip(skipped);
+        return;
+    }
+
+    const bool was_pending = state.pending != nullptr;
+    state.pending.reset(event.Clone());
+    if (state.mode == WXD_RATE_LIMIT_THROTTLE) {
+        if (!was_pending) {
+            state.due = state.last_delivery + state.interval;
+        }
+    }
+    else {
+        state.due = now + state.interval;
+    }
+    ScheduleRateTimer();
+}
+
+// (Re)arms the shared timer for the earliest pending deadline, or stops it.
+void
+WxdEventHandler::ScheduleRateTimer()
+{
+    bool any = false;
+    RateClock::time_point earliest{};
+    for (const auto& slot : slots) {
+        for (const auto& info : slot.closures) {
+            if (info.removed || !info.rate_limit || !info.rate_limit->pending) {
+                continue;
+            }
+            if (!any || info.rate_limit->due < earliest) {
+                earliest = info.rate_limit->due;
+                any = true;
+            }
+        }
+    }
+
+    if (!any) {
+        if (m_rateTimer) {
+            m_rateTimer->Stop();
+        }
+        return;
+    }
+    if (!m_rateTimer) {
+        m_rateTimer = new wxTimer(this);
+        Bind(wxEVT_TIMER, &WxdEventHandler::OnRateTimer, this, m_rateTimer->GetId());
+    }
+    const auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(
+        earliest - RateClock::now());
+    m_rateTimer->StartOnce(std::max<int>(1, static_cast<int>(wait.count())));
+}
+
+void
+WxdEventHandler::OnRateTimer(wxTimerEvent& WXUNUSED(event))
+{
+    const RateClock::time_point now = RateClock::now();
+
+    std::vector<size_t> tokens;
+    for (const auto& slot : slots) {
+        for (const auto& info : slot.closures) {
+            if (!info.removed && info.rate_limit && info.rate_limit->pending &&
+                info.rate_limit->due <= now) {
+                tokens.push_back(info.token);
+            }
+        }
+    }
+
+    ++m_dispatchDepth;
+    for (size_t token : tokens) {
+        RustClosureInfo* info = FindClosure(token);
+        if (!info || !info->closure_ptr || !info->rust_trampoline || !info->rate_limit) {
+            continue;
+        }
+        // Keep the state alive across the call; the closure may unbind itself.
+        const std::shared_ptr<RateLimitState> state = info->rate_limit;
+        std::unique_ptr<wxEvent> pending = std::move(state->pending);
+        const int count = state->count;
+        state->count = 0;
+        state->last_delivery = now;
+        state->delivered = true;
+        if (!pending) {
+            continue;
+        }
+
+        pending->Skip(true);
+        s_coalescedEvent = pending.get();
+        s_coalescedCount = count;
+        wxd_watchdog::Scope watch(pending->GetEventType(), ownerHandler);
+        wxd_trace::Span trace_span(pending->GetEventType(), ownerHandler);
+        wxd_watchdog::set_binding(info->token);
+        info->rust_trampoline(info->closure_ptr, reinterpret_cast<wxd_Event_t*>(pending.get()));
+        s_coalescedEvent = nullptr;
+        s_coalescedCount = 1;
+    }
+    --m_dispatchDepth;
+
+    if (m_dispatchDepth == 0 && m_purgePending) {
+        PurgeRemoved();
+    }
+    ScheduleRateTimer();
 }
 
 // New DispatchEvent method that handles multiple closures per event
@@ -365,56 +930,27 @@ WxdEventHandler::DispatchEvent(wxEvent& event)
 #endif
 
     // Create keys for specific ID and wxID_ANY
-    std::pair<wxEventType, wxd_Id> key_specific_id = { eventType, id };
-    std::pair<wxEventType, wxd_Id> key_any_id = { eventType, wxID_ANY };
+    const uint64_t key_specific_id = make_dispatch_key(eventType, id);
+    const uint64_t key_any_id = make_dispatch_key(eventType, wxID_ANY);
     const bool specific_key_is_any = key_specific_id == key_any_id;
 
-    bool event_consumed = false;
+    wxd_watchdog::Scope watch(eventType, ownerHandler);
+    wxd_window_timing::Scope timing(wxd_window_timing::kind_for_event(eventType), ownerHandler);
+    wxd_trace::Span trace_span(eventType, ownerHandler);
+    ++m_dispatchDepth;
 
     // Process Specific ID Handlers first
-    auto it_specific = closureMap.find(key_specific_id);
-    if (it_specific != closureMap.end()) {
-        for (auto const& info : it_specific->second) {
-            if (info.closure_ptr && info.rust_trampoline) {
-                // Reset skip to true before each handler call
-                event.Skip(true);
-
-                // Call the Rust trampoline function
-                info.rust_trampoline(info.closure_ptr, reinterpret_cast<wxd_Event_t*>(&event));
-
-                // Check if this handler consumed the event
-                if (!event.GetSkipped()) {
-                    event_consumed = true;
-                    if (!keep_dispatching_after_consume) {
-                        break; // Stop processing further handlers
-                    }
-                }
-            }
-        }
-    }
+    bool event_consumed = RunSlot(key_specific_id, event, keep_dispatching_after_consume);
 
     // Process wxID_ANY handlers only when they are distinct from the specific-ID lookup.
     if (!event_consumed && !specific_key_is_any) {
-        auto it_any = closureMap.find(key_any_id);
-        if (it_any != closureMap.end()) {
-            for (auto const& info : it_any->second) {
-                if (info.closure_ptr && info.rust_trampoline) {
-                    // Reset skip to true before each handler call
-                    event.Skip(true);
-
-                    // Call the Rust trampoline function
-                    info.rust_trampoline(info.closure_ptr, reinterpret_cast<wxd_Event_t*>(&event));
-
-                    // Check if this handler consumed the event
-                    if (!event.GetSkipped()) {
-                        event_consumed = true;
-                        if (!keep_dispatching_after_consume) {
-                            break; // Stop processing further handlers
-                        }
-                    }
-                }
-            }
-        }
+        event_consumed = RunSlot(key_any_id, event, keep_dispatching_after_consume);
+    }
+
+    --m_dispatchDepth;
+
+    if (eventType == wxEVT_PAINT) {
+        wxd_latency::paint_finished(ownerHandler);
     }
 
     // Set final event state
@@ -443,9 +979,19 @@ WxdEventHandler::DispatchEvent(wxEvent& event)
     // If this is the destroy event, perform a final cleanup of all bound closures.
     // This runs after all user destroy handlers have been invoked above.
     if (eventType == wxEVT_DESTROY) {
-        // Intentionally ignore the return value of UnbindAll() as we do not need to know
-        // how many handlers were unbound; this is a final cleanup step.
-        (void)this->UnbindAll();
+        if (event.GetEventObject() == ownerHandler) {
+            // The owner itself is being destroyed: skip the per-slot disconnects.
+            ReleaseForOwnerDestroy();
+        }
+        else {
+            // Intentionally ignore the return value of UnbindAll() as we do not need to know
+            // how many handlers were unbound; this is a final cleanup step.
+            (void)this->UnbindAll();
+        }
+    }
+
+    if (m_dispatchDepth == 0 && m_purgePending) {
+        PurgeRemoved();
     }
 }
 
@@ -578,16 +1124,25 @@ public:
 
 void
 WxdEventHandler::BindClosure(wxEventType wx_event_type, wxd_Id actual_id, void* rust_trampoline_fn,
-                             void* rust_closure_ptr, size_t token)
+                             void* rust_closure_ptr, size_t token, bool coalesce,
+                             std::shared_ptr<RateLimitState> rate_limit, PaintBinding paint)
 {
-    std::pair<wxEventType, wxd_Id> map_key = { wx_event_type, actual_id };
+    const uint64_t key = make_dispatch_key(wx_event_type, actual_id);
 
     // Create closure info with token
     RustClosureInfo new_info = { rust_closure_ptr,
                                  reinterpret_cast<wxd_ClosureCallback>(rust_trampoline_fn), token };
+    if (coalesce) {
+        new_info.coalesce = std::make_shared<CoalesceState>();
+    }
+    new_info.rate_limit = std::move(rate_limit);
+    new_info.paint = paint;
+
+    auto it = std::lower_bound(slots.begin(), slots.end(), key,
+                               [](const DispatchSlot& s, uint64_t k) { return s.key < k; });
 
     // First binding for this event? Connect to wxWidgets
-    if (!this->wx_bindings_made[map_key]) {
+    if (it == slots.end() || it->key != key) {
         if (IsVetableEventType(wx_event_type)) {
             wxEventFunction event_func;
             if (wx_event_type == wxEVT_CLOSE_WINDOW) {
@@ -602,14 +1157,22 @@ WxdEventHandler::BindClosure(wxEventType wx_event_type, wxd_Id actual_id, void*
             this->ownerHandler->Bind(wx_event_type, &WxdEventHandler::DispatchEvent, this,
                                      actual_id, actual_id);
         }
-        this->wx_bindings_made[map_key] = true;
-    }
 
-    // Add closure to vector
-    this->closureMap[map_key].push_back(new_info);
+        if (slots.empty()) {
+            // Typical windows bind a handful of events; size for them up front.
+            slots.reserve(4);
+        }
+        DispatchSlot slot;
+        slot.key = key;
+        slot.event_type = wx_event_type;
+        slot.id = actual_id;
+        it = slots.insert(it, std::move(slot));
+        ++m_slotsGeneration;
+    }
 
-    // Store token mapping for fast lookup
-    this->tokenMap[token] = std::make_tuple(wx_event_type, actual_id, rust_closure_ptr);
+    // Add closure to the slot, keeping bind order
+    it->closures.push_back(new_info);
+    wxd_objstats::track(WXD_OBJECT_KIND_EVENT_CLOSURE, &it->closures.back());
 }
 
 // --- C API Implementation ---
@@ -705,6 +1268,156 @@ wxd_EvtHandler_BindWithId(wxd_EvtHandler_t* handler, WXDEventTypeCEnum eventType
     customHandler->BindClosure(wx_event_type, id, rust_trampoline_fn, rust_closure_ptr, token);
 }
 
+// Event types whose intermediate states can be dropped: only the newest one matters.
+static bool
+IsCoalescableEventType(wxEventType eventType)
+{
+    return eventType == wxEVT_MOTION || eventType == wxEVT_SIZE ||
+           eventType == wxEVT_MOUSEWHEEL || eventType == wxEVT_SCROLL_THUMBTRACK ||
+           eventType == wxEVT_SCROLL_LINEUP || eventType == wxEVT_SCROLL_LINEDOWN ||
+           eventType == wxEVT_SCROLL_PAGEUP || eventType == wxEVT_SCROLL_PAGEDOWN ||
+           eventType == wxEVT_SCROLL_CHANGED || eventType == wxEVT_SCROLLWIN_THUMBTRACK ||
+           eventType == wxEVT_SCROLLWIN_LINEUP || eventType == wxEVT_SCROLLWIN_LINEDOWN ||
+           eventType == wxEVT_SCROLLWIN_PAGEUP || eventType == wxEVT_SCROLLWIN_PAGEDOWN;
+}
+
+// Coalesced binding: events are merged per id and delivered once per event-loop iteration.
+extern "C" void
+wxd_EvtHandler_BindCoalesced(wxd_EvtHandler_t* handler, WXDEventTypeCEnum eventTypeC,
+                             void* rust_trampoline_fn, void* rust_closure_ptr, size_t token)
+{
+    wxEvtHandler* wx_handler = reinterpret_cast<wxEvtHandler*>(handler);
+    if (!wx_handler || !rust_trampoline_fn || !rust_closure_ptr) {
+        WXD_LOG_WARNF("wxd_EvtHandler_BindCoalesced: null handler (%p), trampoline (%p) or "
+                      "closure (%p)",
+                      handler, rust_trampoline_fn, rust_closure_ptr);
+        if (rust_closure_ptr) {
+            drop_rust_event_closure_box(rust_closure_ptr);
+        }
+        return;
+    }
+
+    // Get or create the custom event handler
+    WxdEventHandler* customHandler = GetOrCreateEventHandler(wx_handler);
+    wxEventType wx_event_type = get_wx_event_type_for_c_enum(eventTypeC);
+    if (!customHandler || wx_event_type == wxEVT_NULL) {
+        WXD_LOG_WARNF("wxd_EvtHandler_BindCoalesced: unsupported event type %d", (int)eventTypeC);
+        drop_rust_event_closure_box(rust_closure_ptr);
+        return;
+    }
+
+    const bool coalesce = IsCoalescableEventType(wx_event_type);
+    if (!coalesce) {
+        WXD_LOG_WARNF("wxd_EvtHandler_BindCoalesced: event type %d cannot be coalesced, "
+                      "binding normally",
+                      (int)eventTypeC);
+    }
+    customHandler->BindClosure(wx_event_type, wxID_ANY, rust_trampoline_fn, rust_closure_ptr,
+                               token, coalesce);
+}
+
+// Rate-limited binding: the newest event is delivered after `interval_ms` of quiet (debounce)
+// or at most once per `interval_ms` (throttle), driven by one timer per handler.
+extern "C" void
+wxd_EvtHandler_BindRateLimited(wxd_EvtHandler_t* handler, WXDEventTypeCEnum eventTypeC,
+                               wxd_RateLimitMode mode, uint32_t interval_ms,
+                               void* rust_trampoline_fn, void* rust_closure_ptr, size_t token)
+{
+    wxEvtHandler* wx_handler = reinterpret_cast<wxEvtHandler*>(handler);
+    if (!wx_handler || !rust_trampoline_fn || !rust_closure_ptr) {
+        WXD_LOG_WARNF("wxd_EvtHandler_BindRateLimited: null handler (%p), trampoline (%p) or "
+                      "closure (%p)",
+                      handler, rust_trampoline_fn, rust_closure_ptr);
+        if (rust_closure_ptr) {
+            drop_rust_event_closure_box(rust_closure_ptr);
+        }
+        return;
+    }
+
+    WxdEventHandler* customHandler = GetOrCreateEventHandler(wx_handler);
+    wxEventType wx_event_type = get_wx_event_type_for_c_enum(eventTypeC);
+    if (!customHandler || wx_event_type == wxEVT_NULL) {
+        WXD_LOG_WARNF("wxd_EvtHandler_BindRateLimited: unsupported event type %d",
+                      (int)eventTypeC);
+        drop_rust_event_closure_box(rust_closure_ptr);
+        return;
+    }
+
+    std::shared_ptr<RateLimitState> state;
+    if (interval_ms > 0) {
+        state = std::make_shared<RateLimitState>();
+        state->mode = mode;
+        state->interval = std::chrono::milliseconds(interval_ms);
+    }
+    customHandler->BindClosure(wx_event_type, wxID_ANY, rust_trampoline_fn, rust_closure_ptr,
+                               token, false, std::move(state));
+}
+
+// Paint binding: the dispatcher creates the paint DC and collects the update region before the
+// first paint binding of the event runs, and passes both in one wxd_PaintContext.
+extern "C" bool
+wxd_EvtHandler_BindPaint(wxd_EvtHandler_t* handler, bool buffered, wxd_PaintCallback trampoline,
+                         void* rust_closure_ptr, size_t token)
+{
+    wxWindow* window = wxDynamicCast(reinterpret_cast<wxEvtHandler*>(handler), wxWindow);
+    if (!window || !trampoline || !rust_closure_ptr) {
+        WXD_LOG_WARNF("wxd_EvtHandler_BindPaint: null or non-window handler (%p), trampoline "
+                      "(%p) or closure (%p)",
+                      handler, reinterpret_cast<void*>(trampoline), rust_closure_ptr);
+        if (rust_closure_ptr) {
+            drop_rust_event_closure_box(rust_closure_ptr);
+        }
+        return false;
+    }
+
+    WxdEventHandler* customHandler = GetOrCreateEventHandler(window);
+    if (!customHandler) {
+        drop_rust_event_closure_box(rust_closure_ptr);
+        return false;
+    }
+    if (buffered) {
+        // The buffer covers the whole update region, so erasing the background first would
+        // only flicker.
+        window->SetBackgroundStyle(wxBG_STYLE_PAINT);
+    }
+    customHandler->BindClosure(wxEVT_PAINT, wxID_ANY, reinterpret_cast<void*>(trampoline),
+                               rust_closure_ptr, token, false, nullptr,
+                               buffered ? PaintBinding::Buffered : PaintBinding::Plain);
+    return true;
+}
+
+extern "C" int
+wxd_Event_GetCoalescedCount(wxd_Event_t* event)
+{
+    if (event && reinterpret_cast<const wxEvent*>(event) == s_coalescedEvent) {
+        return s_coalescedCount;
+    }
+    return 1;
+}
+
+extern "C" size_t
+wxd_MouseEvent_GetPointerHistory(wxd_Event_t* event, wxd_PointerSample* out, size_t capacity)
+{
+    if (!event) {
+        return 0;
+    }
+    wxMouseEvent* mouse_event = dynamic_cast<wxMouseEvent*>(reinterpret_cast<wxEvent*>(event));
+    if (!mouse_event || mouse_event->GetEventType() != wxEVT_MOTION) {
+        return 0;
+    }
+    std::vector<wxd_PointerSample> collected;
+    const std::vector<wxd_PointerSample>* samples = &collected;
+    if (reinterpret_cast<const wxEvent*>(event) == s_coalescedEvent && s_coalescedSamples) {
+        samples = s_coalescedSamples;
+    } else {
+        wxd_pointer_history::collect(*mouse_event, collected);
+    }
+    if (out) {
+        std::copy_n(samples->begin(), std::min(capacity, samples->size()), out);
+    }
+    return samples->size();
+}
+
 /**
  * Unbinds (removes) an event handler associated with the given token from the specified wxEvtHandler.
  *
@@ -904,33 +1617,39 @@ wxd_ScrollEvent_GetOrientation(wxd_Event_t* event)
 static wxEventType
 get_wx_event_type_for_c_enum(WXDEventTypeCEnum c_enum_val);
 
+// Reverse of get_wx_event_type_for_c_enum, built on first use. wxEventType values are assigned by
+// wxNewEventType() during static initialisation, so they are all known by the time any event
+// reaches us. The first C enum mapping to a given wxEventType wins, matching the old linear scan.
+static const std::unordered_map<wxEventType, WXDEventTypeCEnum>&
+get_c_enum_reverse_table()
+{
+    static const std::unordered_map<wxEventType, WXDEventTypeCEnum> table = [] {
+        std::unordered_map<wxEventType, WXDEventTypeCEnum> t;
+        t.reserve(WXD_EVENT_TYPE_MAX);
+
+        // Menu types take precedence over any alias sharing their wxEventType
+        t.emplace(wxEVT_CONTEXT_MENU, WXD_EVENT_TYPE_CONTEXT_MENU);
+        t.emplace(wxEVT_MENU_OPEN, WXD_EVENT_TYPE_MENU_OPEN);
+        t.emplace(wxEVT_MENU_CLOSE, WXD_EVENT_TYPE_MENU_CLOSE);
+        t.emplace(wxEVT_MENU_HIGHLIGHT, WXD_EVENT_TYPE_MENU_HIGHLIGHT);
+        t.emplace(wxEVT_MENU, WXD_EVENT_TYPE_MENU);
+
+        for (int i = WXD_EVENT_TYPE_NULL; i < WXD_EVENT_TYPE_MAX; i++) {
+            WXDEventTypeCEnum c_enum = static_cast<WXDEventTypeCEnum>(i);
+            t.emplace(get_wx_event_type_for_c_enum(c_enum), c_enum); // keeps existing entries
+        }
+        return t;
+    }();
+    return table;
+}
+
 static WXDEventTypeCEnum
 get_c_enum_for_wx_event_type(wxEventType wx_event_type)
 {
-    // Direct comparison with wxWidgets constants (more reliable than loop)
-    if (wx_event_type == wxEVT_CONTEXT_MENU) {
-        return WXD_EVENT_TYPE_CONTEXT_MENU;
-    }
-    if (wx_event_type == wxEVT_MENU_OPEN) {
-        return WXD_EVENT_TYPE_MENU_OPEN;
-    }
-    if (wx_event_type == wxEVT_MENU_CLOSE) {
-        return WXD_EVENT_TYPE_MENU_CLOSE;
-    }
-    if (wx_event_type == wxEVT_MENU_HIGHLIGHT) {
-        return WXD_EVENT_TYPE_MENU_HIGHLIGHT;
-    }
-    if (wx_event_type == wxEVT_MENU) {
-        return WXD_EVENT_TYPE_MENU;
-    }
-
-    // Fallback to the original loop for other event types
-    for (int i = WXD_EVENT_TYPE_NULL; i < WXD_EVENT_TYPE_MAX; i++) {
-        WXDEventTypeCEnum c_enum = static_cast<WXDEventTypeCEnum>(i);
-        wxEventType wx_type = get_wx_event_type_for_c_enum(c_enum);
-        if (wx_type == wx_event_type) {
-            return c_enum;
-        }
+    const auto& table = get_c_enum_reverse_table();
+    auto it = table.find(wx_event_type);
+    if (it != table.end()) {
+        return it->second;
     }
 
     // If we can't find a matching C enum, return NULL
@@ -945,33 +1664,73 @@ wxd_Event_GetEventType(wxd_Event_t* event)
         return WXD_EVENT_TYPE_NULL;
     }
     wxEvent* wx_event = (wxEvent*)event;
-    wxEventType eventType = wx_event->GetEventType();
 
-    // PRIORITY: Use dynamic casting for menu events (more reliable than integer comparison)
-    // Try wxContextMenuEvent first
-    wxContextMenuEvent* ctx_event = wxDynamicCast(wx_event, wxContextMenuEvent);
-    if (ctx_event) {
-        return WXD_EVENT_TYPE_CONTEXT_MENU;
-    }
+    // Menu and context-menu types are seeded first in the reverse table, so a single probe
+    // resolves them the same way the former wxDynamicCast checks did.
+    return get_c_enum_for_wx_event_type(wx_event->GetEventType());
+}
 
-    // Try wxMenuEvent
-    wxMenuEvent* menu_event = wxDynamicCast(wx_event, wxMenuEvent);
-    if (menu_event) {
-        // Use direct wxEventType comparison with the actual dynamic constants
-        if (eventType == wxEVT_MENU_OPEN)
-            return WXD_EVENT_TYPE_MENU_OPEN;
-        if (eventType == wxEVT_MENU_CLOSE)
-            return WXD_EVENT_TYPE_MENU_CLOSE;
-        if (eventType == wxEVT_MENU_HIGHLIGHT)
-            return WXD_EVENT_TYPE_MENU_HIGHLIGHT;
-        // Fallback for regular menu events
-        if (eventType == wxEVT_MENU)
-            return WXD_EVENT_TYPE_MENU;
+static void
+fill_snapshot_keyboard_state(const wxKeyboardState& state, wxd_EventSnapshot* out)
+{
+    out->kinds |= WXD_EVENT_SNAPSHOT_KEYSTATE;
+    out->control_down = state.ControlDown();
+    out->shift_down = state.ShiftDown();
+    out->alt_down = state.AltDown();
+    out->meta_down = state.MetaDown();
+    out->cmd_down = state.CmdDown();
+}
+
+WXD_EXPORTED bool
+wxd_Event_GetSnapshot(wxd_Event_t* event, wxd_EventSnapshot* out)
+{
+    if (!out)
+        return false;
+    *out = wxd_EventSnapshot();
+    out->position = { -1, -1 };
+    out->wheel_delta = 120; // Same default as wxd_MouseEvent_GetWheelDelta
+    if (!event)
+        return false;
+
+    wxEvent* wx_event = reinterpret_cast<wxEvent*>(event);
+    out->event_type = get_c_enum_for_wx_event_type(wx_event->GetEventType());
+    out->id = wx_event->GetId();
+
+    // Identify the event class once, then read every field from that pointer.
+    if (wxMouseEvent* mouse_event = dynamic_cast<wxMouseEvent*>(wx_event)) {
+        out->kinds |= WXD_EVENT_SNAPSHOT_MOUSE;
+        wxPoint pos = mouse_event->GetPosition();
+        out->position = { pos.x, pos.y };
+        if (mouse_event->LeftIsDown())
+            out->buttons |= WXD_MOUSE_BUTTON_LEFT;
+        if (mouse_event->MiddleIsDown())
+            out->buttons |= WXD_MOUSE_BUTTON_MIDDLE;
+        if (mouse_event->RightIsDown())
+            out->buttons |= WXD_MOUSE_BUTTON_RIGHT;
+        if (mouse_event->Aux1IsDown())
+            out->buttons |= WXD_MOUSE_BUTTON_AUX1;
+        if (mouse_event->Aux2IsDown())
+            out->buttons |= WXD_MOUSE_BUTTON_AUX2;
+        out->wheel_rotation = mouse_event->GetWheelRotation();
+        out->wheel_delta = mouse_event->GetWheelDelta();
+        out->wheel_axis = static_cast<int>(mouse_event->GetWheelAxis());
+        fill_snapshot_keyboard_state(*mouse_event, out);
+    }
+    else if (wxKeyEvent* key_event = dynamic_cast<wxKeyEvent*>(wx_event)) {
+        out->kinds |= WXD_EVENT_SNAPSHOT_KEY;
+        wxPoint pos = key_event->GetPosition();
+        out->position = { pos.x, pos.y };
+        out->key_code = key_event->GetKeyCode();
+        out->unicode_key = static_cast<int>(key_event->GetUnicodeKey());
+        fill_snapshot_keyboard_state(*key_event, out);
+    }
+    else if (wxCommandEvent* command_event = dynamic_cast<wxCommandEvent*>(wx_event)) {
+        out->kinds |= WXD_EVENT_SNAPSHOT_COMMAND;
+        out->command_int = command_event->GetInt();
+        out->checked = command_event->IsChecked();
     }
 
-    // Standard conversion for all other event types
-    WXDEventTypeCEnum c_enum_val = get_c_enum_for_wx_event_type(eventType);
-    return c_enum_val;
+    return true;
 }
 
 // Implement get_wx_event_type_for_c_enum to handle the mapping
@@ -1577,6 +2336,24 @@ get_wx_event_type_for_c_enum(WXDEventTypeCEnum c_enum_val)
     case WXD_EVENT_TYPE_PG_COL_END_DRAG:
         return wxEVT_PG_COL_END_DRAG;
 
+    // Spatial index hover tracking
+    case WXD_EVENT_TYPE_SPATIAL_HOVER_CHANGED:
+        return wxdEVT_SPATIAL_HOVER_CHANGED;
+
+    // Coalesced file system changes
+    case WXD_EVENT_TYPE_FS_CHANGES:
+        return wxdEVT_FS_CHANGES;
+    case WXD_EVENT_TYPE_PROCESS_OUTPUT:
+        return wxdEVT_PROCESS_OUTPUT;
+    case WXD_EVENT_TYPE_PROCESS_EXIT:
+        return wxdEVT_PROCESS_EXIT;
+    case WXD_EVENT_TYPE_THREAD_MESSAGE:
+        return wxdEVT_THREAD_MESSAGE;
+    case WXD_EVENT_TYPE_VISIBILITY_CHANGED:
+        return wxdEVT_VISIBILITY_CHANGED;
+    case WXD_EVENT_TYPE_SOCKET:
+        return wxEVT_SOCKET;
+
     default:
         return wxEVT_NULL;
     }
@@ -1770,7 +2547,8 @@ wxd_DataViewEvent_GetValue(wxd_Event_t* event)
 
     wxVariant var = dve->GetValue();
 
-    return reinterpret_cast<wxd_Variant_t*>(new (std::nothrow) wxVariant(var));
+    return reinterpret_cast<wxd_Variant_t*>(
+        wxd_objstats::track(WXD_OBJECT_KIND_VARIANT, new (std::nothrow) wxVariant(var)));
 }
 
 // Header: WXD_EXPORTED bool wxd_DataViewEvent_SetValue(wxd_Event_t* event, const wxd_Variant_t* value);
@@ -2261,3 +3039,146 @@ wxd_ActivateEvent_IsActive(wxd_Event_t* event)
         return false;
     return activate_event->GetActive();
 }
+
+// --- SpatialHoverEvent specific ---
+
+extern "C" bool
+wxd_SpatialHoverEvent_GetItem(wxd_Event_t* event, int64_t* id)
+{
+    wxdSpatialHoverEvent* hover = wxEvent_SafeDynamicCast<wxdSpatialHoverEvent>(event);
+    if (!hover || !hover->has_item)
+        return false;
+    if (id)
+        *id = hover->item;
+    return true;
+}
+
+extern "C" bool
+wxd_SpatialHoverEvent_GetPreviousItem(wxd_Event_t* event, int64_t* id)
+{
+    wxdSpatialHoverEvent* hover = wxEvent_SafeDynamicCast<wxdSpatialHoverEvent>(event);
+    if (!hover || !hover->had_previous)
+        return false;
+    if (id)
+        *id = hover->previous;
+    return true;
+}
+
+// --- FileSystemChangesEvent specific ---
+
+extern "C" size_t
+wxd_FileSystemChangesEvent_GetPaths(wxd_Event_t* event, wxd_ArrayString_t* out)
+{
+    wxdFileSystemChangesEvent* changes = wxEvent_SafeDynamicCast<wxdFileSystemChangesEvent>(event);
+    if (!changes)
+        return 0;
+    if (out) {
+        wxArrayString* paths = reinterpret_cast<wxArrayString*>(out);
+        paths->clear();
+        paths->reserve(changes->changes.size());
+        for (const auto& change : changes->changes)
+            paths->push_back(change.path);
+    }
+    return changes->changes.size();
+}
+
+extern "C" size_t
+wxd_FileSystemChangesEvent_GetChanges(wxd_Event_t* event, int32_t* kinds, size_t capacity)
+{
+    wxdFileSystemChangesEvent* changes = wxEvent_SafeDynamicCast<wxdFileSystemChangesEvent>(event);
+    if (!changes)
+        return 0;
+    const size_t n = std::min(capacity, changes->changes.size());
+    for (size_t i = 0; kinds && i < n; ++i)
+        kinds[i] = changes->changes[i].kinds;
+    return changes->changes.size();
+}
+
+extern "C" bool
+wxd_FileSystemChangesEvent_HasOverflowed(wxd_Event_t* event)
+{
+    wxdFileSystemChangesEvent* changes = wxEvent_SafeDynamicCast<wxdFileSystemChangesEvent>(event);
+    return changes && changes->overflowed;
+}
+
+// --- ChildProcessEvent specific ---
+
+extern "C" int64_t
+wxd_ChildProcessEvent_GetPid(wxd_Event_t* event)
+{
+    wxdChildProcessEvent* process = wxEvent_SafeDynamicCast<wxdChildProcessEvent>(event);
+    return process ? process->pid : 0;
+}
+
+extern "C" bool
+wxd_ChildProcessEvent_IsStderr(wxd_Event_t* event)
+{
+    wxdChildProcessEvent* process = wxEvent_SafeDynamicCast<wxdChildProcessEvent>(event);
+    return process && process->is_stderr;
+}
+
+extern "C" size_t
+wxd_ChildProcessEvent_GetData(wxd_Event_t* event, uint8_t* buffer, size_t capacity)
+{
+    wxdChildProcessEvent* process = wxEvent_SafeDynamicCast<wxdChildProcessEvent>(event);
+    if (!process)
+        return 0;
+    if (buffer)
+        memcpy(buffer, process->data.data(), std::min(capacity, process->data.size()));
+    return process->data.size();
+}
+
+extern "C" int
+wxd_ChildProcessEvent_GetExitCode(wxd_Event_t* event)
+{
+    wxdChildProcessEvent* process = wxEvent_SafeDynamicCast<wxdChildProcessEvent>(event);
+    return process ? process->exit_code : -1;
+}
+
+// --- ThreadMessageEvent specific ---
+
+extern "C" int32_t
+wxd_ThreadMessageEvent_GetKind(wxd_Event_t* event)
+{
+    wxdThreadMessageEvent* message = wxEvent_SafeDynamicCast<wxdThreadMessageEvent>(event);
+    return message ? message->kind : 0;
+}
+
+extern "C" void*
+wxd_ThreadMessageEvent_GetPayload(wxd_Event_t* event)
+{
+    wxdThreadMessageEvent* message = wxEvent_SafeDynamicCast<wxdThreadMessageEvent>(event);
+    return message && message->payload ? message->payload->Get() : nullptr;
+}
+
+extern "C" void*
+wxd_ThreadMessageEvent_TakePayload(wxd_Event_t* event)
+{
+    wxdThreadMessageEvent* message = wxEvent_SafeDynamicCast<wxdThreadMessageEvent>(event);
+    return message && message->payload ? message->payload->Take() : nullptr;
+}
+
+// --- VisibilityEvent specific ---
+
+extern "C" uint32_t
+wxd_VisibilityEvent_GetHiddenReasons(wxd_Event_t* event)
+{
+    wxdVisibilityEvent* visibility = wxEvent_SafeDynamicCast<wxdVisibilityEvent>(event);
+    return visibility ? visibility->reasons : 0;
+}
+
+// --- SocketEvent specific ---
+
+extern "C" int
+wxd_SocketEvent_GetNotify(wxd_Event_t* event)
+{
+    wxSocketEvent* socket = wxEvent_SafeDynamicCast<wxSocketEvent>(event);
+    return socket ? static_cast<int>(socket->GetSocketEvent()) : -1;
+}
+
+extern "C" wxd_Socket_t*
+wxd_SocketEvent_GetSocket(wxd_Event_t* event)
+{
+    wxSocketEvent* socket = wxEvent_SafeDynamicCast<wxSocketEvent>(event);
+    return socket ? reinterpret_cast<wxd_Socket_t*>(socket->GetSocket()) : nullptr;
+}
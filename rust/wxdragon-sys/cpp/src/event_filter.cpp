@@ -0,0 +1,218 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include <wx/eventfilter.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+struct wxd_EventFilter_t {
+    wxd_EventFilterCallback callback;
+    uint32_t mask;
+    void* user_data;
+    void (*free_user_data)(void*);
+    bool removed = false;
+};
+
+namespace {
+
+uint32_t
+ClassifyUncached(const wxEvent& event)
+{
+    static const std::unordered_map<wxEventType, uint32_t> known = {
+        { wxEVT_KEY_DOWN, WXD_EVENT_FILTER_KEY },
+        { wxEVT_KEY_UP, WXD_EVENT_FILTER_KEY },
+        { wxEVT_CHAR, WXD_EVENT_FILTER_KEY },
+        { wxEVT_CHAR_HOOK, WXD_EVENT_FILTER_KEY },
+        { wxEVT_LEFT_DOWN, WXD_EVENT_FILTER_MOUSE_BUTTON },
+        { wxEVT_LEFT_UP, WXD_EVENT_FILTER_MOUSE_BUTTON },
+        { wxEVT_LEFT_DCLICK, WXD_EVENT_FILTER_MOUSE_BUTTON },
+        { wxEVT_MIDDLE_DOWN, WXD_EVENT_FILTER_MOUSE_BUTTON },
+        { wxEVT_MIDDLE_UP, WXD_EVENT_FILTER_MOUSE_BUTTON },
+        { wxEVT_MIDDLE_DCLICK, WXD_EVENT_FILTER_MOUSE_BUTTON },
+        { wxEVT_RIGHT_DOWN, WXD_EVENT_FILTER_MOUSE_BUTTON },
+        { wxEVT_RIGHT_UP, WXD_EVENT_FILTER_MOUSE_BUTTON },
+        { wxEVT_RIGHT_DCLICK, WXD_EVENT_FILTER_MOUSE_BUTTON },
+        { wxEVT_AUX1_DOWN, WXD_EVENT_FILTER_MOUSE_BUTTON },
+        { wxEVT_AUX1_UP, WXD_EVENT_FILTER_MOUSE_BUTTON },
+        { wxEVT_AUX1_DCLICK, WXD_EVENT_FILTER_MOUSE_BUTTON },
+        { wxEVT_AUX2_DOWN, WXD_EVENT_FILTER_MOUSE_BUTTON },
+        { wxEVT_AUX2_UP, WXD_EVENT_FILTER_MOUSE_BUTTON },
+        { wxEVT_AUX2_DCLICK, WXD_EVENT_FILTER_MOUSE_BUTTON },
+        { wxEVT_MOTION, WXD_EVENT_FILTER_MOUSE_MOTION },
+        { wxEVT_ENTER_WINDOW, WXD_EVENT_FILTER_MOUSE_MOTION },
+        { wxEVT_LEAVE_WINDOW, WXD_EVENT_FILTER_MOUSE_MOTION },
+        { wxEVT_MOUSEWHEEL, WXD_EVENT_FILTER_MOUSE_WHEEL },
+        { wxEVT_SET_FOCUS, WXD_EVENT_FILTER_FOCUS },
+        { wxEVT_KILL_FOCUS, WXD_EVENT_FILTER_FOCUS },
+        { wxEVT_CHILD_FOCUS, WXD_EVENT_FILTER_FOCUS },
+        { wxEVT_ACTIVATE, WXD_EVENT_FILTER_FOCUS },
+        { wxEVT_ACTIVATE_APP, WXD_EVENT_FILTER_FOCUS },
+        { wxEVT_PAINT, WXD_EVENT_FILTER_PAINT },
+        { wxEVT_ERASE_BACKGROUND, WXD_EVENT_FILTER_PAINT },
+        { wxEVT_SIZE, WXD_EVENT_FILTER_LAYOUT },
+        { wxEVT_MOVE, WXD_EVENT_FILTER_LAYOUT },
+        { wxEVT_TIMER, WXD_EVENT_FILTER_TIMER },
+    };
+    auto it = known.find(event.GetEventType());
+    if (it != known.end())
+        return it->second;
+    return event.IsCommandEvent() ? WXD_EVENT_FILTER_COMMAND : WXD_EVENT_FILTER_OTHER;
+}
+
+// Event types map to one event class, so the answer for a type is computed once. The last type
+// seen is kept separately: runs of motion or paint events then skip the hash lookup.
+uint32_t
+Classify(const wxEvent& event)
+{
+    static std::unordered_map<wxEventType, uint32_t> cache;
+    static wxEventType lastType = wxEVT_NULL;
+    static uint32_t lastClass = 0;
+    const wxEventType type = event.GetEventType();
+    if (type == lastType && lastClass)
+        return lastClass;
+    auto it = cache.find(type);
+    uint32_t cls = it != cache.end() ? it->second : (cache[type] = ClassifyUncached(event));
+    lastType = type;
+    lastClass = cls;
+    return cls;
+}
+
+// One wxEventFilter fans out to all registered filters, newest first. It is installed with the
+// first filter and removed with the last, and rejects events outside the union of the masks
+// before touching the list.
+class FilterDispatcher : public wxEventFilter {
+public:
+    static FilterDispatcher&
+    Get()
+    {
+        // Leaked on purpose: wxEventFilter asserts if destroyed while still installed at exit.
+        static FilterDispatcher* instance = new FilterDispatcher;
+        return *instance;
+    }
+
+    void
+    Add(wxd_EventFilter_t* filter)
+    {
+        m_filters.push_back(filter);
+        if (!m_installed) {
+            wxEvtHandler::AddFilter(this);
+            m_installed = true;
+        }
+        UpdateMask();
+    }
+
+    void
+    Remove(wxd_EventFilter_t* filter)
+    {
+        if (filter->removed)
+            return;
+        filter->removed = true;
+        filter->mask = 0;
+        UpdateMask();
+        // Inside a dispatch the list is being walked; the entry is dropped once it unwinds.
+        if (m_depth == 0)
+            Sweep();
+    }
+
+    void
+    UpdateMask()
+    {
+        m_unionMask = 0;
+        for (const wxd_EventFilter_t* f : m_filters)
+            m_unionMask |= f->mask;
+    }
+
+    int
+    FilterEvent(wxEvent& event) override
+    {
+        const uint32_t cls = Classify(event);
+        if (!(m_unionMask & cls))
+            return Event_Skip;
+
+        int result = Event_Skip;
+        ++m_depth;
+        // Filters added by a callback are not called for the current event.
+        for (size_t i = m_filters.size(); i-- > 0;) {
+            wxd_EventFilter_t* f = m_filters[i];
+            if (!(f->mask & cls))
+                continue;
+            const int r =
+                f->callback(f->user_data, reinterpret_cast<wxd_Event_t*>(&event), cls);
+            if (r != WXD_EVENT_FILTER_RESULT_SKIP) {
+                result = r == WXD_EVENT_FILTER_RESULT_IGNORE ? Event_Ignore : Event_Processed;
+                break;
+            }
+        }
+        if (--m_depth == 0)
+            Sweep();
+        return result;
+    }
+
+private:
+    void
+    Sweep()
+    {
+        std::vector<wxd_EventFilter_t*> dead;
+        auto split = std::stable_partition(m_filters.begin(), m_filters.end(),
+                                           [](const wxd_EventFilter_t* f) { return !f->removed; });
+        dead.assign(split, m_filters.end());
+        m_filters.erase(split, m_filters.end());
+        if (m_filters.empty() && m_installed) {
+            wxEvtHandler::RemoveFilter(this);
+            m_installed = false;
+        }
+        // User data is freed last: its destructor may add or remove filters.
+        for (wxd_EventFilter_t* f : dead) {
+            if (f->free_user_data)
+                f->free_user_data(f->user_data);
+            delete f;
+        }
+    }
+
+    std::vector<wxd_EventFilter_t*> m_filters;
+    uint32_t m_unionMask = 0;
+    int m_depth = 0;
+    bool m_installed = false;
+};
+
+} // namespace
+
+extern "C" {
+
+WXD_EXPORTED wxd_EventFilter_t*
+wxd_App_AddEventFilter(wxd_EventFilterCallback callback, uint32_t class_mask, void* user_data,
+                       void (*free_user_data)(void*))
+{
+    if (!callback)
+        return nullptr;
+    auto* filter = new wxd_EventFilter_t{ callback, class_mask & WXD_EVENT_FILTER_ALL, user_data,
+                                          free_user_data };
+    FilterDispatcher::Get().Add(filter);
+    return filter;
+}
+
+WXD_EXPORTED void
+wxd_App_RemoveEventFilter(wxd_EventFilter_t* filter)
+{
+    if (filter)
+        FilterDispatcher::Get().Remove(filter);
+}
+
+WXD_EXPORTED void
+wxd_EventFilter_SetClassMask(wxd_EventFilter_t* filter, uint32_t class_mask)
+{
+    if (!filter || filter->removed)
+        return;
+    filter->mask = class_mask & WXD_EVENT_FILTER_ALL;
+    FilterDispatcher::Get().UpdateMask();
+}
+
+WXD_EXPORTED uint32_t
+wxd_Event_GetFilterClass(wxd_Event_t* event)
+{
+    return event ? Classify(*reinterpret_cast<wxEvent*>(event)) : 0;
+}
+
+} // extern "C"
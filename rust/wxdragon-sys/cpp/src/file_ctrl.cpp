@@ -2,6 +2,59 @@
 #include <wx/wx.h>
 #include "../include/wxdragon.h"
 #include <wx/filectrl.h> // For wxFileCtrl
+#include <wx/weakref.h>
+#include <unordered_map>
+
+namespace {
+
+// An asynchronous SetDirectory in flight: the directory is listed on a worker thread first, so
+// a slow share or a huge folder is read into the OS caches without blocking the GUI, and only
+// then handed to the control.
+struct PendingDirectory {
+    wxWeakRef<wxFileCtrl> ctrl;
+    wxString dir;
+    wxd_DirListing_t* listing = nullptr;
+};
+
+std::unordered_map<wxFileCtrl*, PendingDirectory*>&
+pending_directories()
+{
+    static std::unordered_map<wxFileCtrl*, PendingDirectory*> map;
+    return map;
+}
+
+void
+cancel_pending_directory(wxFileCtrl* ctrl)
+{
+    auto it = pending_directories().find(ctrl);
+    if (it == pending_directories().end())
+        return;
+    PendingDirectory* pending = it->second;
+    pending_directories().erase(it);
+    wxd_DirListing_Destroy(pending->listing); // Frees `pending`.
+}
+
+void
+on_directory_listed(void* userdata, const char* const*, const uint8_t*, int, int status)
+{
+    if (status == WXD_DIR_LISTING_MORE)
+        return;
+    PendingDirectory* pending = static_cast<PendingDirectory*>(userdata);
+    auto& map = pending_directories();
+    for (auto it = map.begin(); it != map.end(); ++it) {
+        if (it->second == pending) {
+            map.erase(it);
+            break;
+        }
+    }
+    wxFileCtrl* ctrl = pending->ctrl.get();
+    if (ctrl && status == WXD_DIR_LISTING_DONE)
+        ctrl->SetDirectory(pending->dir);
+    // Frees `pending` once this callback returns.
+    wxd_DirListing_Destroy(pending->listing);
+}
+
+} // namespace
 
 extern "C" {
 
@@ -41,15 +94,59 @@ wxd_FileCtrl_GetPath(const wxd_FileCtrl_t* self, char* buffer, size_t buffer_len
     return pathBuf.length();
 }
 
-// Implementations for other wxd_FileCtrl_XXX functions will go here
-// Example:
-/*
+WXD_EXPORTED size_t
+wxd_FileCtrl_GetDirectory(const wxd_FileCtrl_t* self, char* buffer, size_t buffer_len)
+{
+    wxFileCtrl* ctrl = (wxFileCtrl*)self;
+    if (!ctrl)
+        return 0;
+
+    wxScopedCharBuffer dirBuf = ctrl->GetDirectory().ToUTF8();
+    if (buffer && buffer_len > 0) {
+        size_t copyLen = wxMin(static_cast<size_t>(dirBuf.length()), buffer_len - 1);
+        memcpy(buffer, dirBuf.data(), copyLen);
+        buffer[copyLen] = '\0';
+    }
+    return dirBuf.length();
+}
+
+WXD_EXPORTED bool
+wxd_FileCtrl_SetDirectory(wxd_FileCtrl_t* self, const char* directory)
+{
+    wxFileCtrl* ctrl = (wxFileCtrl*)self;
+    if (!ctrl)
+        return false;
+    cancel_pending_directory(ctrl);
+    return ctrl->SetDirectory(WXD_STR_TO_WX_STRING_UTF8_NULL_OK(directory));
+}
+
+WXD_EXPORTED bool
+wxd_FileCtrl_SetPath(wxd_FileCtrl_t* self, const char* path)
+{
+    wxFileCtrl* ctrl = (wxFileCtrl*)self;
+    if (!ctrl)
+        return false;
+    cancel_pending_directory(ctrl);
+    return ctrl->SetPath(WXD_STR_TO_WX_STRING_UTF8_NULL_OK(path));
+}
 
-void wxd_FileCtrl_SetPath(wxd_FileCtrl_t* self, const char* path) {
+WXD_EXPORTED bool
+wxd_FileCtrl_SetDirectoryAsync(wxd_FileCtrl_t* self, const char* directory)
+{
     wxFileCtrl* ctrl = (wxFileCtrl*)self;
-    if (!ctrl) return;
-    ctrl->SetPath(WXD_STR_TO_WX_STRING_UTF8_NULL_OK(path));
+    if (!ctrl || !directory)
+        return false;
+    cancel_pending_directory(ctrl);
+    PendingDirectory* pending = new PendingDirectory;
+    pending->ctrl = ctrl;
+    pending->dir = wxString::FromUTF8(directory);
+    pending->listing = wxd_DirListing_Start(
+        directory, 4096, on_directory_listed, pending,
+        [](void* userdata) { delete static_cast<PendingDirectory*>(userdata); });
+    if (!pending->listing)
+        return false; // Already freed by wxd_DirListing_Start.
+    pending_directories()[ctrl] = pending;
+    return true;
 }
-*/
 
 } // extern "C"
\ No newline at end of file
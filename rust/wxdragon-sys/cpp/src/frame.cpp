@@ -20,7 +20,8 @@ wxd_Frame_Create(wxd_Window_t* parent, wxd_Id id, const char* title, wxd_Point p
     wxFrame* wx_frame =
         new wxFrame(wx_parent, id,
                     wxString::FromUTF8(title ? title : ""), // Ensure non-null string
-                    wxd_cpp_utils::to_wx(pos), wxd_cpp_utils::to_wx(size), style);
+                    wxd_cpp_utils::to_wx(pos, wx_parent), wxd_cpp_utils::to_wx(size, wx_parent),
+                    style);
 
     // Return the opaque handle
     // Note: We are not creating/attaching the WxdEventHandler here.
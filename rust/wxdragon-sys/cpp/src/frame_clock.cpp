@@ -0,0 +1,528 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_trace.h"
+#include <wx/display.h>
+#include <wx/timer.h>
+#include <wx/weakref.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#ifdef __WXMSW__
+#include <wx/msw/wrapwin.h>
+#include <mmsystem.h>
+#endif
+#ifdef __WXGTK__
+#include <dlfcn.h>
+#endif
+#ifdef __WXOSX__
+#include <CoreVideo/CoreVideo.h>
+#endif
+
+// --- Animation frame clock ---
+//
+// Each clock owns one frame source: the display link on macOS, the GdkFrameClock of the window
+// on GTK, and a timer paced against a steady clock elsewhere (or while the native source is not
+// available, e.g. before the GTK window is realized). Sources only report a timestamp and the
+// refresh interval; frame numbering, dropped-frame accounting and the refresh flush are shared.
+// A source lives as long as its clock, so the callback may stop and restart the clock freely.
+
+namespace {
+
+constexpr int64_t kDefaultIntervalUs = 16667;
+
+int64_t
+steady_now_us()
+{
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+int64_t
+display_interval_us(wxWindow* window)
+{
+    const int index = window ? wxDisplay::GetFromWindow(window) : wxNOT_FOUND;
+    if (index == wxNOT_FOUND)
+        return kDefaultIntervalUs;
+    const int hz = wxDisplay(static_cast<unsigned>(index)).GetCurrentMode().GetRefresh();
+    return hz > 0 ? 1000000 / hz : kDefaultIntervalUs;
+}
+
+class FrameSource {
+public:
+    virtual ~FrameSource() = default;
+    virtual bool Start() = 0;
+    virtual void Stop() = 0;
+    // False for the timer fallback, which is replaced by a native source once one is available.
+    virtual bool IsNative() const { return true; }
+    virtual int64_t Interval() const = 0;
+};
+
+std::unique_ptr<FrameSource> make_native_source(wxd_FrameClock_t* clock);
+std::unique_ptr<FrameSource> make_timer_source(wxd_FrameClock_t* clock);
+
+} // namespace
+
+struct wxd_FrameClock_t {
+    wxd_FrameClock_t(wxWindow* window, wxd_FrameClockCallback callback, void* user_data,
+                     wxd_FrameClockFreeUserData free_user_data)
+        : m_window(window),
+          m_callback(callback),
+          m_user_data(user_data),
+          m_free(free_user_data)
+    {
+        window->Bind(wxEVT_DESTROY, &wxd_FrameClock_t::OnWindowDestroy, this);
+    }
+
+    ~wxd_FrameClock_t()
+    {
+        Stop();
+        m_source.reset();
+        if (wxWindow* window = m_window.get())
+            window->Unbind(wxEVT_DESTROY, &wxd_FrameClock_t::OnWindowDestroy, this);
+        if (m_free)
+            m_free(m_user_data);
+    }
+
+    bool
+    Start()
+    {
+        if (m_running)
+            return true;
+        if (!m_window.get())
+            return false;
+        // Never replace the source from its own callback: it is still on the stack.
+        if ((!m_source || !m_source->IsNative()) && !m_delivering) {
+            if (std::unique_ptr<FrameSource> native = make_native_source(this))
+                m_source = std::move(native);
+        }
+        if (!m_source)
+            m_source = make_timer_source(this);
+        m_last_timestamp = -1;
+        m_running = m_source->Start();
+        return m_running;
+    }
+
+    void
+    Stop()
+    {
+        if (!m_running)
+            return;
+        m_running = false;
+        m_source->Stop();
+    }
+
+    bool IsRunning() const { return m_running; }
+
+    int64_t
+    RefreshInterval() const
+    {
+        return m_source ? m_source->Interval() : display_interval_us(m_window.get());
+    }
+
+    wxWindow* Window() const { return m_window.get(); }
+
+    // Called by the sources on the GUI thread.
+    void
+    Deliver(int64_t timestamp_us, int64_t interval_us)
+    {
+        if (!m_running || interval_us <= 0)
+            return;
+        if (m_last_timestamp >= 0 && timestamp_us <= m_last_timestamp)
+            return;
+        wxd_FrameInfo info;
+        info.timestamp_us = timestamp_us;
+        info.interval_us = interval_us;
+        info.frame = m_frame++;
+        info.dropped = 0;
+        if (m_last_timestamp >= 0) {
+            // Round to the nearest frame so jitter is not counted as a drop.
+            const int64_t frames = (timestamp_us - m_last_timestamp + interval_us / 2) / interval_us;
+            if (frames > 1)
+                info.dropped = static_cast<uint32_t>(std::min<int64_t>(frames - 1, UINT32_MAX));
+        }
+        m_last_timestamp = timestamp_us;
+
+        wxd_trace::Span trace_span(wxd_trace::CATEGORY_TIMER, "FrameClock frame");
+        m_delivering = true;
+        m_callback(m_user_data, &info);
+        m_delivering = false;
+        // Paint what the animation scheduled in this same frame.
+        if (wxWindow* window = m_window.get())
+            wxd_Window_FlushScheduledRefresh(reinterpret_cast<wxd_Window_t*>(window));
+    }
+
+private:
+    void
+    OnWindowDestroy(wxWindowDestroyEvent& event)
+    {
+        event.Skip();
+        if (event.GetEventObject() == m_window.get())
+            Stop();
+    }
+
+    wxWeakRef<wxWindow> m_window;
+    wxd_FrameClockCallback m_callback;
+    void* m_user_data;
+    wxd_FrameClockFreeUserData m_free;
+    std::unique_ptr<FrameSource> m_source;
+    bool m_running = false;
+    bool m_delivering = false;
+    uint64_t m_frame = 0;
+    int64_t m_last_timestamp = -1;
+};
+
+namespace {
+
+// Fires at start + n * interval, rescheduling every time, so timer lateness never accumulates.
+class TimerFrameSource : public FrameSource, public wxTimer {
+public:
+    explicit TimerFrameSource(wxd_FrameClock_t* clock) : m_clock(clock) {}
+
+    ~TimerFrameSource() override { Stop(); }
+
+    bool
+    Start() override
+    {
+        m_interval = display_interval_us(m_clock->Window());
+#ifdef __WXMSW__
+        // The default 15.6 ms system tick would make most frames late by up to a whole frame.
+        if (!m_period_raised)
+            m_period_raised = timeBeginPeriod(1) == TIMERR_NOERROR;
+#endif
+        m_start = steady_now_us();
+        m_next = 1;
+        Arm();
+        return true;
+    }
+
+    void
+    Stop() override
+    {
+        wxTimer::Stop();
+#ifdef __WXMSW__
+        if (m_period_raised) {
+            timeEndPeriod(1);
+            m_period_raised = false;
+        }
+#endif
+    }
+
+    bool IsNative() const override { return false; }
+
+    int64_t Interval() const override { return m_interval; }
+
+    void
+    Notify() override
+    {
+        m_armed = false;
+        const int64_t due = (steady_now_us() - m_start) / m_interval;
+        if (due >= m_next) {
+            m_next = due + 1;
+            m_clock->Deliver(m_start + due * m_interval, m_interval);
+            // Stopped from the callback, or stopped and restarted (which re-armed already).
+            if (!m_clock->IsRunning() || m_armed)
+                return;
+        }
+        Arm();
+    }
+
+private:
+    void
+    Arm()
+    {
+        const int64_t wait_us = m_start + m_next * m_interval - steady_now_us();
+        m_armed = true;
+        StartOnce(static_cast<int>(std::max<int64_t>(1, (wait_us + 999) / 1000)));
+    }
+
+    wxd_FrameClock_t* m_clock;
+    int64_t m_interval = kDefaultIntervalUs;
+    int64_t m_start = 0;
+    int64_t m_next = 1;
+    bool m_armed = false;
+#ifdef __WXMSW__
+    bool m_period_raised = false;
+#endif
+};
+
+std::unique_ptr<FrameSource>
+make_timer_source(wxd_FrameClock_t* clock)
+{
+    return std::unique_ptr<FrameSource>(new TimerFrameSource(clock));
+}
+
+#if defined(__WXGTK__)
+
+// GDK is resolved at run time from the already-loaded toolkit, as for the clipboard.
+struct GdkFrameApi {
+    typedef void (*UpdateFunc)(void* frame_clock, void* data);
+    void* (*widget_get_frame_clock)(void* widget) = nullptr;
+    int64_t (*get_frame_time)(void* frame_clock) = nullptr;
+    void (*get_refresh_info)(void* frame_clock, int64_t base_time, int64_t* refresh_interval,
+                             int64_t* presentation_time) = nullptr;
+    void (*begin_updating)(void* frame_clock) = nullptr;
+    void (*end_updating)(void* frame_clock) = nullptr;
+    unsigned long (*signal_connect_data)(void* instance, const char* signal, void (*handler)(),
+                                         void* data, void* destroy_data, int flags) = nullptr;
+    void (*signal_handler_disconnect)(void* instance, unsigned long handler_id) = nullptr;
+    void* (*object_ref)(void* object) = nullptr;
+    void (*object_unref)(void* object) = nullptr;
+
+    bool Ok() const {
+        return widget_get_frame_clock && get_frame_time && get_refresh_info && begin_updating &&
+               end_updating && signal_connect_data && signal_handler_disconnect && object_ref &&
+               object_unref;
+    }
+
+    static const GdkFrameApi& Get() {
+        static const GdkFrameApi api = [] {
+            GdkFrameApi a;
+            a.widget_get_frame_clock = reinterpret_cast<decltype(a.widget_get_frame_clock)>(
+                dlsym(RTLD_DEFAULT, "gtk_widget_get_frame_clock"));
+            a.get_frame_time = reinterpret_cast<decltype(a.get_frame_time)>(
+                dlsym(RTLD_DEFAULT, "gdk_frame_clock_get_frame_time"));
+            a.get_refresh_info = reinterpret_cast<decltype(a.get_refresh_info)>(
+                dlsym(RTLD_DEFAULT, "gdk_frame_clock_get_refresh_info"));
+            a.begin_updating = reinterpret_cast<decltype(a.begin_updating)>(
+                dlsym(RTLD_DEFAULT, "gdk_frame_clock_begin_updating"));
+            a.end_updating = reinterpret_cast<decltype(a.end_updating)>(
+                dlsym(RTLD_DEFAULT, "gdk_frame_clock_end_updating"));
+            a.signal_connect_data = reinterpret_cast<decltype(a.signal_connect_data)>(
+                dlsym(RTLD_DEFAULT, "g_signal_connect_data"));
+            a.signal_handler_disconnect = reinterpret_cast<decltype(a.signal_handler_disconnect)>(
+                dlsym(RTLD_DEFAULT, "g_signal_handler_disconnect"));
+            a.object_ref = reinterpret_cast<decltype(a.object_ref)>(
+                dlsym(RTLD_DEFAULT, "g_object_ref"));
+            a.object_unref = reinterpret_cast<decltype(a.object_unref)>(
+                dlsym(RTLD_DEFAULT, "g_object_unref"));
+            return a;
+        }();
+        return api;
+    }
+};
+
+// Ticks on the "update" phase of the window's GdkFrameClock, i.e. in step with the compositor.
+class GdkFrameSource : public FrameSource {
+public:
+    GdkFrameSource(wxd_FrameClock_t* clock, void* frame_clock)
+        : m_clock(clock), m_frame_clock(GdkFrameApi::Get().object_ref(frame_clock))
+    {
+        m_handler = GdkFrameApi::Get().signal_connect_data(
+            m_frame_clock, "update", reinterpret_cast<void (*)()>(&GdkFrameSource::OnUpdate), this,
+            nullptr, 0);
+    }
+
+    ~GdkFrameSource() override
+    {
+        Stop();
+        const GdkFrameApi& api = GdkFrameApi::Get();
+        api.signal_handler_disconnect(m_frame_clock, m_handler);
+        api.object_unref(m_frame_clock);
+    }
+
+    bool
+    Start() override
+    {
+        if (!m_updating) {
+            GdkFrameApi::Get().begin_updating(m_frame_clock);
+            m_updating = true;
+        }
+        return true;
+    }
+
+    void
+    Stop() override
+    {
+        if (m_updating) {
+            GdkFrameApi::Get().end_updating(m_frame_clock);
+            m_updating = false;
+        }
+    }
+
+    int64_t
+    Interval() const override
+    {
+        int64_t interval = 0;
+        int64_t presentation = 0;
+        const GdkFrameApi& api = GdkFrameApi::Get();
+        api.get_refresh_info(m_frame_clock, api.get_frame_time(m_frame_clock), &interval,
+                             &presentation);
+        return interval > 0 ? interval : kDefaultIntervalUs;
+    }
+
+private:
+    static void
+    OnUpdate(void* frame_clock, void* data)
+    {
+        GdkFrameSource* self = static_cast<GdkFrameSource*>(data);
+        if (!self->m_updating)
+            return;
+        self->m_clock->Deliver(GdkFrameApi::Get().get_frame_time(frame_clock), self->Interval());
+    }
+
+    wxd_FrameClock_t* m_clock;
+    void* m_frame_clock;
+    unsigned long m_handler = 0;
+    bool m_updating = false;
+};
+
+std::unique_ptr<FrameSource>
+make_native_source(wxd_FrameClock_t* clock)
+{
+    const GdkFrameApi& api = GdkFrameApi::Get();
+    wxWindow* window = clock->Window();
+    if (!api.Ok() || !window || !window->GetHandle())
+        return nullptr;
+    // NULL until the widget is realized.
+    void* frame_clock = api.widget_get_frame_clock(window->GetHandle());
+    if (!frame_clock)
+        return nullptr;
+    return std::unique_ptr<FrameSource>(new GdkFrameSource(clock, frame_clock));
+}
+
+#elif defined(__WXOSX__)
+
+// State shared with the display link thread, which only records the latest frame and posts
+// one delivery at a time to the GUI thread.
+struct DisplayLinkShared : public std::enable_shared_from_this<DisplayLinkShared> {
+    wxd_FrameClock_t* clock = nullptr; // GUI thread only; null once the source is gone
+    std::atomic<int64_t> timestamp_us{ 0 };
+    std::atomic<int64_t> interval_us{ kDefaultIntervalUs };
+    std::atomic<bool> queued{ false };
+    std::atomic<bool> active{ false };
+};
+
+class DisplayLinkFrameSource : public FrameSource {
+public:
+    DisplayLinkFrameSource(wxd_FrameClock_t* clock, CVDisplayLinkRef link)
+        : m_link(link), m_shared(std::make_shared<DisplayLinkShared>())
+    {
+        m_shared->clock = clock;
+        // The raw pointer stays valid: m_shared outlives the link, released in the destructor.
+        CVDisplayLinkSetOutputCallback(m_link, &DisplayLinkFrameSource::OnFrame, m_shared.get());
+    }
+
+    ~DisplayLinkFrameSource() override
+    {
+        Stop();
+        CVDisplayLinkRelease(m_link);
+        m_shared->clock = nullptr;
+    }
+
+    bool
+    Start() override
+    {
+        m_shared->active = true;
+        return CVDisplayLinkIsRunning(m_link) || CVDisplayLinkStart(m_link) == kCVReturnSuccess;
+    }
+
+    void
+    Stop() override
+    {
+        m_shared->active = false;
+        if (CVDisplayLinkIsRunning(m_link))
+            CVDisplayLinkStop(m_link);
+    }
+
+    int64_t
+    Interval() const override
+    {
+        const double period = CVDisplayLinkGetActualOutputVideoRefreshPeriod(m_link);
+        return period > 0 ? static_cast<int64_t>(period * 1e6) : m_shared->interval_us.load();
+    }
+
+private:
+    static CVReturn
+    OnFrame(CVDisplayLinkRef, const CVTimeStamp*, const CVTimeStamp* output, CVOptionFlags,
+            CVOptionFlags*, void* context)
+    {
+        DisplayLinkShared* shared = static_cast<DisplayLinkShared*>(context);
+        if (!shared->active)
+            return kCVReturnSuccess;
+        static const double ticks_per_us = CVGetHostClockFrequency() / 1e6;
+        shared->timestamp_us = static_cast<int64_t>(output->hostTime / ticks_per_us);
+        if (output->videoTimeScale > 0 && output->videoRefreshPeriod > 0)
+            shared->interval_us =
+                output->videoRefreshPeriod * 1000000 / output->videoTimeScale;
+        // Frames arriving while the GUI thread is busy merge into one, counted as dropped.
+        if (shared->queued.exchange(true) || !wxTheApp)
+            return kCVReturnSuccess;
+        std::weak_ptr<DisplayLinkShared> weak = shared->weak_from_this();
+        wxTheApp->CallAfter([weak]() {
+            std::shared_ptr<DisplayLinkShared> strong = weak.lock();
+            if (!strong)
+                return;
+            strong->queued = false;
+            if (strong->clock && strong->active)
+                strong->clock->Deliver(strong->timestamp_us, strong->interval_us);
+        });
+        return kCVReturnSuccess;
+    }
+
+    CVDisplayLinkRef m_link;
+    std::shared_ptr<DisplayLinkShared> m_shared;
+};
+
+std::unique_ptr<FrameSource>
+make_native_source(wxd_FrameClock_t* clock)
+{
+    CVDisplayLinkRef link = nullptr;
+    if (CVDisplayLinkCreateWithActiveCGDisplays(&link) != kCVReturnSuccess || !link)
+        return nullptr;
+    return std::unique_ptr<FrameSource>(new DisplayLinkFrameSource(clock, link));
+}
+
+#else
+
+std::unique_ptr<FrameSource>
+make_native_source(wxd_FrameClock_t*)
+{
+    return nullptr;
+}
+
+#endif
+
+} // namespace
+
+WXD_EXPORTED wxd_FrameClock_t*
+wxd_FrameClock_Create(wxd_Window_t* window, wxd_FrameClockCallback callback, void* user_data,
+                      wxd_FrameClockFreeUserData free_user_data)
+{
+    wxWindow* win = reinterpret_cast<wxWindow*>(window);
+    if (!win || !callback)
+        return nullptr;
+    return new wxd_FrameClock_t(win, callback, user_data, free_user_data);
+}
+
+WXD_EXPORTED void
+wxd_FrameClock_Destroy(wxd_FrameClock_t* clock)
+{
+    delete clock;
+}
+
+WXD_EXPORTED bool
+wxd_FrameClock_Start(wxd_FrameClock_t* clock)
+{
+    return clock && clock->Start();
+}
+
+WXD_EXPORTED void
+wxd_FrameClock_Stop(wxd_FrameClock_t* clock)
+{
+    if (clock)
+        clock->Stop();
+}
+
+WXD_EXPORTED bool
+wxd_FrameClock_IsRunning(const wxd_FrameClock_t* clock)
+{
+    return clock && clock->IsRunning();
+}
+
+WXD_EXPORTED int64_t
+wxd_FrameClock_GetRefreshInterval(const wxd_FrameClock_t* clock)
+{
+    return clock ? clock->RefreshInterval() : kDefaultIntervalUs;
+}
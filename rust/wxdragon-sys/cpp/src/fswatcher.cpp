@@ -0,0 +1,219 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_fswatcher.h"
+#include "wxd_utils.h"
+#include <wx/filename.h>
+#include <wx/fswatcher.h>
+#include <wx/weakref.h>
+#include <unordered_map>
+#include <vector>
+
+wxDEFINE_EVENT(wxdEVT_FS_CHANGES, wxdFileSystemChangesEvent);
+
+#if wxUSE_FSWATCHER
+
+namespace {
+
+constexpr int kChangeMask = WXD_FS_CHANGE_CREATE | WXD_FS_CHANGE_DELETE | WXD_FS_CHANGE_RENAME |
+                            WXD_FS_CHANGE_MODIFY | WXD_FS_CHANGE_ACCESS | WXD_FS_CHANGE_ATTRIB;
+
+// Directories must be given as wxFileName::DirName for the watcher to treat them as such.
+wxFileName
+to_file_name(const char* utf8)
+{
+    const wxString path = wxString::FromUTF8(utf8);
+    return wxFileName::DirExists(path) ? wxFileName::DirName(path) : wxFileName(path);
+}
+
+} // namespace
+
+// Receives the native notifications and merges them until the batch timer fires.
+struct wxd_FileSystemWatcher_t : public wxEvtHandler {
+    wxd_FileSystemWatcher_t(wxEvtHandler* target, int batch_ms)
+        : m_target(target), m_batchMs(batch_ms > 0 ? batch_ms : 0), m_timer(this)
+    {
+        m_watcher.SetOwner(this);
+        Bind(wxEVT_FSWATCHER, &wxd_FileSystemWatcher_t::OnChange, this);
+        Bind(wxEVT_TIMER, &wxd_FileSystemWatcher_t::OnTimer, this);
+    }
+
+    ~wxd_FileSystemWatcher_t() override
+    {
+        m_timer.Stop();
+        m_watcher.RemoveAll();
+    }
+
+    void
+    SetBatchInterval(int batch_ms)
+    {
+        m_batchMs = batch_ms > 0 ? batch_ms : 0;
+    }
+
+    wxFileSystemWatcher&
+    Watcher()
+    {
+        return m_watcher;
+    }
+
+    void
+    Flush()
+    {
+        m_timer.Stop();
+        if (m_changes.empty() && !m_overflowed)
+            return;
+        wxdFileSystemChangesEvent batch(wxdEVT_FS_CHANGES);
+        batch.changes.swap(m_changes);
+        batch.overflowed = m_overflowed;
+        m_overflowed = false;
+        m_index.clear();
+        if (m_target)
+            m_target->SafelyProcessEvent(batch);
+    }
+
+private:
+    void
+    OnChange(wxFileSystemWatcherEvent& event)
+    {
+        const int kind = event.GetChangeType();
+        if (kind & (wxFSW_EVENT_WARNING | wxFSW_EVENT_ERROR))
+            m_overflowed = true;
+        if (kind & kChangeMask) {
+            Record(event.GetPath(), kind & kChangeMask);
+            if ((kind & wxFSW_EVENT_RENAME) && event.GetNewPath().IsOk())
+                Record(event.GetNewPath(), kind & kChangeMask);
+        }
+        if (!m_timer.IsRunning())
+            m_timer.StartOnce(m_batchMs > 0 ? m_batchMs : 1);
+    }
+
+    void
+    Record(const wxFileName& name, int kinds)
+    {
+        const wxString path = name.GetFullPath();
+        auto it = m_index.find(path);
+        if (it != m_index.end()) {
+            m_changes[it->second].kinds |= kinds;
+            return;
+        }
+        m_index.emplace(path, m_changes.size());
+        m_changes.push_back({ path, kinds });
+    }
+
+    void
+    OnTimer(wxTimerEvent&)
+    {
+        Flush();
+    }
+
+    wxWeakRef<wxEvtHandler> m_target;
+    int m_batchMs;
+    wxTimer m_timer;
+    wxFileSystemWatcher m_watcher;
+    // Changed paths in order of first change, and each path's position in m_changes.
+    std::vector<wxdFileSystemChangesEvent::Change> m_changes;
+    std::unordered_map<wxString, size_t, wxStringHash, wxStringEqual> m_index;
+    bool m_overflowed = false;
+};
+
+#else
+
+struct wxd_FileSystemWatcher_t {};
+
+#endif // wxUSE_FSWATCHER
+
+extern "C" {
+
+WXD_EXPORTED wxd_FileSystemWatcher_t*
+wxd_FileSystemWatcher_Create(wxd_EvtHandler_t* target, int batch_ms)
+{
+#if wxUSE_FSWATCHER
+    if (!target)
+        return nullptr;
+    return new wxd_FileSystemWatcher_t(reinterpret_cast<wxEvtHandler*>(target), batch_ms);
+#else
+    wxUnusedVar(target);
+    wxUnusedVar(batch_ms);
+    return nullptr;
+#endif
+}
+
+WXD_EXPORTED void
+wxd_FileSystemWatcher_Destroy(wxd_FileSystemWatcher_t* self)
+{
+    delete self;
+}
+
+WXD_EXPORTED void
+wxd_FileSystemWatcher_SetBatchInterval(wxd_FileSystemWatcher_t* self, int batch_ms)
+{
+#if wxUSE_FSWATCHER
+    if (self)
+        self->SetBatchInterval(batch_ms);
+#else
+    wxUnusedVar(self);
+    wxUnusedVar(batch_ms);
+#endif
+}
+
+WXD_EXPORTED bool
+wxd_FileSystemWatcher_Add(wxd_FileSystemWatcher_t* self, const char* path, bool recursive,
+                          const char* filespec)
+{
+#if wxUSE_FSWATCHER
+    if (!self || !path)
+        return false;
+    const wxFileName name = to_file_name(path);
+    if (recursive && name.IsDir())
+        return self->Watcher().AddTree(name, wxFSW_EVENT_ALL,
+                                       WXD_STR_TO_WX_STRING_UTF8_NULL_OK(filespec));
+    return self->Watcher().Add(name);
+#else
+    wxUnusedVar(self);
+    wxUnusedVar(path);
+    wxUnusedVar(recursive);
+    wxUnusedVar(filespec);
+    return false;
+#endif
+}
+
+WXD_EXPORTED bool
+wxd_FileSystemWatcher_Remove(wxd_FileSystemWatcher_t* self, const char* path, bool recursive)
+{
+#if wxUSE_FSWATCHER
+    if (!self || !path)
+        return false;
+    const wxFileName name = to_file_name(path);
+    return recursive && name.IsDir() ? self->Watcher().RemoveTree(name)
+                                     : self->Watcher().Remove(name);
+#else
+    wxUnusedVar(self);
+    wxUnusedVar(path);
+    wxUnusedVar(recursive);
+    return false;
+#endif
+}
+
+WXD_EXPORTED void
+wxd_FileSystemWatcher_RemoveAll(wxd_FileSystemWatcher_t* self)
+{
+#if wxUSE_FSWATCHER
+    if (self)
+        self->Watcher().RemoveAll();
+#else
+    wxUnusedVar(self);
+#endif
+}
+
+WXD_EXPORTED void
+wxd_FileSystemWatcher_Flush(wxd_FileSystemWatcher_t* self)
+{
+#if wxUSE_FSWATCHER
+    if (self)
+        self->Flush();
+#else
+    wxUnusedVar(self);
+#endif
+}
+
+} // extern "C"
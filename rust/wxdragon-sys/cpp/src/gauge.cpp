@@ -6,6 +6,7 @@
 
 #include "wx/gauge.h"
 #include "../include/wxdragon.h"
+#include "wxd_progress_coalescer.h"
 
 extern "C" {
 
@@ -39,6 +40,7 @@ wxd_Gauge_SetValue(wxd_Gauge_t* self, int value)
     wxGauge* gauge = reinterpret_cast<wxGauge*>(self);
     if (!gauge)
         return;
+    wxd_progress_coalescer::cancel(gauge);
     gauge->SetValue(value);
 }
 
@@ -1,6 +1,7 @@
 #include <wx/wxprec.h>
 #include <wx/wx.h>
 #include "../include/wxdragon.h" // Main header
+#include "wxd_objstats.h"
 #include <wx/generic/statbmpg.h> // For wxGenericStaticBitmap
 #include <wx/bitmap.h>           // For wxBitmap
 
@@ -101,7 +102,7 @@ wxd_GenericStaticBitmap_GetBitmap(wxd_GenericStaticBitmap_t* self)
         return nullptr;
 
     // Return a copy, as the internal one might be changed or deleted
-    wxBitmap* newBmp = new (std::nothrow) wxBitmap(currentBmp);
+    wxBitmap* newBmp = wxd_objstats::track(new (std::nothrow) wxBitmap(currentBmp));
     return reinterpret_cast<wxd_Bitmap_t*>(newBmp);
 }
 
@@ -0,0 +1,187 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+
+#if wxdUSE_OPENGL
+
+#include <wx/glcanvas.h>
+
+#if defined(__WXMSW__)
+#include <wx/msw/wrapwin.h>
+#elif defined(__WXOSX__)
+#include <dlfcn.h>
+#elif wxUSE_GLCANVAS_EGL
+#include <EGL/egl.h>
+#else
+#include <GL/glx.h>
+#endif
+
+namespace {
+
+wxGLAttributes
+display_attributes(const wxd_GLAttributes* attrs)
+{
+    wxGLAttributes disp;
+    disp.PlatformDefaults().RGBA();
+    if (!attrs || attrs->double_buffer)
+        disp.DoubleBuffer();
+    disp.Depth(attrs && attrs->depth_bits > 0 ? attrs->depth_bits : 16);
+    if (attrs && attrs->stencil_bits > 0)
+        disp.Stencil(attrs->stencil_bits);
+    if (attrs && attrs->samples > 1)
+        disp.SampleBuffers(1).Samplers(attrs->samples);
+    if (attrs && attrs->srgb)
+        disp.FrameBuffersRGB();
+    disp.EndList();
+    return disp;
+}
+
+wxGLContextAttrs
+context_attributes(const wxd_GLAttributes* attrs)
+{
+    wxGLContextAttrs ctx;
+    ctx.PlatformDefaults();
+    if (attrs && attrs->core_profile)
+        ctx.CoreProfile().ForwardCompatible();
+    if (attrs && attrs->major_version > 0)
+        ctx.OGLVersion(attrs->major_version, attrs->minor_version);
+    if (attrs && attrs->debug_context)
+        ctx.DebugCtx();
+    ctx.EndList();
+    return ctx;
+}
+
+} // namespace
+
+WXD_EXPORTED bool
+wxd_GLCanvas_IsDisplaySupported(const wxd_GLAttributes* attrs)
+{
+    return wxGLCanvas::IsDisplaySupported(display_attributes(attrs));
+}
+
+WXD_EXPORTED wxd_GLCanvas_t*
+wxd_GLCanvas_Create(wxd_Window_t* parent, int id, int x, int y, int w, int h, int64_t style,
+                    const wxd_GLAttributes* attrs)
+{
+    wxWindow* p = reinterpret_cast<wxWindow*>(parent);
+    if (!p)
+        return nullptr;
+    const wxGLAttributes disp = display_attributes(attrs);
+    if (!wxGLCanvas::IsDisplaySupported(disp)) {
+        WXD_LOG_ERROR("wxd_GLCanvas_Create: no pixel format matches the requested attributes");
+        return nullptr;
+    }
+    wxPoint pos = (x == -1 && y == -1) ? wxDefaultPosition : wxPoint(x, y);
+    wxSize size = (w == -1 && h == -1) ? wxDefaultSize : wxSize(w, h);
+    // Partial repaints would leave stale GL content behind after a resize.
+    wxGLCanvas* canvas = new wxGLCanvas(p, disp, id, pos, size,
+                                        static_cast<long>(style) | wxFULL_REPAINT_ON_RESIZE);
+    return reinterpret_cast<wxd_GLCanvas_t*>(canvas);
+}
+
+WXD_EXPORTED bool
+wxd_GLCanvas_SetCurrent(wxd_GLCanvas_t* self, const wxd_GLContext_t* context)
+{
+    wxGLCanvas* canvas = reinterpret_cast<wxGLCanvas*>(self);
+    if (!canvas || !context)
+        return false;
+    return canvas->SetCurrent(*reinterpret_cast<const wxGLContext*>(context));
+}
+
+WXD_EXPORTED bool
+wxd_GLCanvas_SwapBuffers(wxd_GLCanvas_t* self)
+{
+    wxGLCanvas* canvas = reinterpret_cast<wxGLCanvas*>(self);
+    if (!canvas)
+        return false;
+    return canvas->SwapBuffers();
+}
+
+WXD_EXPORTED bool
+wxd_GLCanvas_SetSwapInterval(wxd_GLCanvas_t* self, int interval)
+{
+    wxGLCanvas* canvas = reinterpret_cast<wxGLCanvas*>(self);
+    if (!canvas)
+        return false;
+#if wxCHECK_VERSION(3, 3, 0)
+    return canvas->SetSwapInterval(interval);
+#else
+    wxUnusedVar(interval);
+    return false;
+#endif
+}
+
+WXD_EXPORTED wxd_NativeWindowHandle
+wxd_GLCanvas_GetNativeHandle(wxd_GLCanvas_t* self)
+{
+    wxd_NativeWindowHandle handle = { WXD_NATIVE_WINDOW_NONE, nullptr, nullptr };
+    wxGLCanvas* canvas = reinterpret_cast<wxGLCanvas*>(self);
+    if (!canvas)
+        return handle;
+#if defined(__WXMSW__)
+    handle.kind = WXD_NATIVE_WINDOW_WIN32;
+    handle.window = canvas->GetHWND();
+    handle.display = wxGetInstance();
+#elif defined(__WXOSX__)
+    handle.kind = WXD_NATIVE_WINDOW_APPKIT;
+    handle.window = canvas->GetHandle();
+#elif defined(__WXGTK__)
+    handle.kind = WXD_NATIVE_WINDOW_GTK;
+    handle.window = canvas->GetHandle();
+#endif
+    return handle;
+}
+
+struct wxd_GLContext : public wxGLContext {
+    using wxGLContext::wxGLContext;
+};
+
+WXD_EXPORTED wxd_GLContext_t*
+wxd_GLContext_Create(wxd_GLCanvas_t* canvas, const wxd_GLAttributes* attrs,
+                     const wxd_GLContext_t* share)
+{
+    wxGLCanvas* wx_canvas = reinterpret_cast<wxGLCanvas*>(canvas);
+    if (!wx_canvas)
+        return nullptr;
+    const wxGLContextAttrs ctx = context_attributes(attrs);
+    wxd_GLContext* context = new wxd_GLContext(wx_canvas, share, &ctx);
+    if (!context->IsOK()) {
+        WXD_LOG_ERROR("wxd_GLContext_Create: the requested OpenGL context is not available");
+        delete context;
+        return nullptr;
+    }
+    return context;
+}
+
+WXD_EXPORTED void
+wxd_GLContext_Destroy(wxd_GLContext_t* self)
+{
+    delete self;
+}
+
+WXD_EXPORTED const void*
+wxd_GLContext_GetProcAddress(const char* name)
+{
+    if (!name)
+        return nullptr;
+#if defined(__WXMSW__)
+    // wglGetProcAddress only knows extensions and post-1.1 functions; the rest live in
+    // opengl32.dll. Some drivers return small sentinel values instead of nullptr.
+    PROC proc = wglGetProcAddress(name);
+    const intptr_t value = reinterpret_cast<intptr_t>(proc);
+    if (value == 0 || value == 1 || value == 2 || value == 3 || value == -1) {
+        HMODULE module = ::GetModuleHandleW(L"opengl32.dll");
+        proc = module ? ::GetProcAddress(module, name) : nullptr;
+    }
+    return reinterpret_cast<const void*>(proc);
+#elif defined(__WXOSX__)
+    return dlsym(RTLD_DEFAULT, name);
+#elif wxUSE_GLCANVAS_EGL
+    return reinterpret_cast<const void*>(eglGetProcAddress(name));
+#else
+    return reinterpret_cast<const void*>(
+        glXGetProcAddressARB(reinterpret_cast<const GLubyte*>(name)));
+#endif
+}
+
+#endif // wxdUSE_OPENGL
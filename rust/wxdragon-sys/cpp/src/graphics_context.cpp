@@ -0,0 +1,439 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include <wx/dcmemory.h>
+#include <wx/graphics.h>
+#include "../include/wxdragon.h"
+#include "../src/wxd_utils.h"
+#include <memory>
+
+struct wxd_GraphicsContext_t {
+    // Set when drawing into a bitmap: holds the bitmap selected until the context is gone.
+    std::unique_ptr<wxMemoryDC> owned_dc;
+    std::unique_ptr<wxGraphicsContext> gc;
+};
+
+struct wxd_GraphicsPath_t {
+    wxGraphicsPath path;
+};
+
+namespace {
+
+wxGraphicsRenderer*
+renderer_for(int kind)
+{
+    wxGraphicsRenderer* renderer = nullptr;
+    switch (kind) {
+#if defined(__WXMSW__) && wxUSE_GRAPHICS_DIRECT2D
+    case WXD_GRAPHICS_RENDERER_DIRECT2D:
+        renderer = wxGraphicsRenderer::GetDirect2DRenderer();
+        break;
+#endif
+#if defined(__WXMSW__) && wxUSE_GRAPHICS_GDIPLUS
+    case WXD_GRAPHICS_RENDERER_GDIPLUS:
+        renderer = wxGraphicsRenderer::GetGDIPlusRenderer();
+        break;
+#endif
+#if wxUSE_CAIRO
+    case WXD_GRAPHICS_RENDERER_CAIRO:
+        renderer = wxGraphicsRenderer::GetCairoRenderer();
+        break;
+#endif
+    default:
+        break;
+    }
+    return renderer ? renderer : wxGraphicsRenderer::GetDefaultRenderer();
+}
+
+wxGraphicsContext*
+context_for(wxDC* dc, wxGraphicsRenderer* renderer)
+{
+    // Buffered paint DCs are memory DCs, except where the platform double-buffers natively and
+    // they are paint DCs.
+    if (wxWindowDC* window_dc = dynamic_cast<wxWindowDC*>(dc))
+        return renderer->CreateContext(*window_dc);
+    if (wxMemoryDC* memory_dc = dynamic_cast<wxMemoryDC*>(dc))
+        return renderer->CreateContext(*memory_dc);
+    return nullptr;
+}
+
+const wxPoint2DDouble*
+to_wx_points(const wxd_Point2D* points)
+{
+    static_assert(sizeof(wxd_Point2D) == sizeof(wxPoint2DDouble),
+                  "wxd_Point2D must match wxPoint2DDouble");
+    return reinterpret_cast<const wxPoint2DDouble*>(points);
+}
+
+void
+add_polyline(wxGraphicsPath& path, const wxd_Point2D* points, size_t n, bool close)
+{
+    if (n < 1)
+        return;
+    path.MoveToPoint(points[0].x, points[0].y);
+    for (size_t i = 1; i < n; ++i) {
+        path.AddLineToPoint(points[i].x, points[i].y);
+    }
+    if (close)
+        path.CloseSubpath();
+}
+
+} // namespace
+
+extern "C" {
+
+WXD_EXPORTED wxd_GraphicsContext_t*
+wxd_GraphicsContext_CreateFromDC(wxd_DC_t* dc, int renderer)
+{
+    if (!dc)
+        return nullptr;
+    wxGraphicsContext* gc = context_for(reinterpret_cast<wxDC*>(dc), renderer_for(renderer));
+    if (!gc)
+        return nullptr;
+    auto* self = new wxd_GraphicsContext_t();
+    self->gc.reset(gc);
+    return self;
+}
+
+WXD_EXPORTED wxd_GraphicsContext_t*
+wxd_GraphicsContext_CreateFromBitmap(wxd_Bitmap_t* bitmap, int renderer)
+{
+    if (!bitmap)
+        return nullptr;
+    wxBitmap* bmp = reinterpret_cast<wxBitmap*>(bitmap);
+    if (!bmp->IsOk())
+        return nullptr;
+    auto dc = std::make_unique<wxMemoryDC>(*bmp);
+    wxGraphicsContext* gc = renderer_for(renderer)->CreateContext(*dc);
+    if (!gc) {
+        dc->SelectObject(wxNullBitmap);
+        return nullptr;
+    }
+    auto* self = new wxd_GraphicsContext_t();
+    self->owned_dc = std::move(dc);
+    self->gc.reset(gc);
+    return self;
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_Destroy(wxd_GraphicsContext_t* gc)
+{
+    if (!gc)
+        return;
+    // The context flushes into the DC when destroyed, so it goes before the bitmap is released.
+    gc->gc.reset();
+    if (gc->owned_dc)
+        gc->owned_dc->SelectObject(wxNullBitmap);
+    delete gc;
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_Flush(wxd_GraphicsContext_t* gc)
+{
+    if (gc)
+        gc->gc->Flush();
+}
+
+// State
+
+WXD_EXPORTED void
+wxd_GraphicsContext_SetPen(wxd_GraphicsContext_t* gc, wxd_Colour_t colour, double width,
+                           int style)
+{
+    if (!gc)
+        return;
+    const wxGraphicsPenInfo info(wxColour(colour.r, colour.g, colour.b, colour.a), width,
+                                 static_cast<wxPenStyle>(style));
+    gc->gc->SetPen(gc->gc->CreatePen(info));
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_SetBrush(wxd_GraphicsContext_t* gc, wxd_Colour_t colour, int style)
+{
+    if (!gc)
+        return;
+    gc->gc->SetBrush(wxBrush(wxColour(colour.r, colour.g, colour.b, colour.a),
+                             static_cast<wxBrushStyle>(style)));
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_SetFont(wxd_GraphicsContext_t* gc, const wxd_Font_t* font, wxd_Colour_t colour)
+{
+    if (!gc || !font)
+        return;
+    const wxFont* wx_font = reinterpret_cast<const wxFont*>(font);
+    gc->gc->SetFont(*wx_font, wxColour(colour.r, colour.g, colour.b, colour.a));
+}
+
+WXD_EXPORTED bool
+wxd_GraphicsContext_SetAntialias(wxd_GraphicsContext_t* gc, bool enable)
+{
+    if (!gc)
+        return false;
+    return gc->gc->SetAntialiasMode(enable ? wxANTIALIAS_DEFAULT : wxANTIALIAS_NONE);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_PushState(wxd_GraphicsContext_t* gc)
+{
+    if (gc)
+        gc->gc->PushState();
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_PopState(wxd_GraphicsContext_t* gc)
+{
+    if (gc)
+        gc->gc->PopState();
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_Translate(wxd_GraphicsContext_t* gc, double dx, double dy)
+{
+    if (gc)
+        gc->gc->Translate(dx, dy);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_Scale(wxd_GraphicsContext_t* gc, double sx, double sy)
+{
+    if (gc)
+        gc->gc->Scale(sx, sy);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_Rotate(wxd_GraphicsContext_t* gc, double radians)
+{
+    if (gc)
+        gc->gc->Rotate(radians);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_Clip(wxd_GraphicsContext_t* gc, double x, double y, double w, double h)
+{
+    if (gc)
+        gc->gc->Clip(x, y, w, h);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_ResetClip(wxd_GraphicsContext_t* gc)
+{
+    if (gc)
+        gc->gc->ResetClip();
+}
+
+// Batched primitives
+
+WXD_EXPORTED void
+wxd_GraphicsContext_StrokeLine(wxd_GraphicsContext_t* gc, double x1, double y1, double x2,
+                               double y2)
+{
+    if (gc)
+        gc->gc->StrokeLine(x1, y1, x2, y2);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_StrokeLines(wxd_GraphicsContext_t* gc, const wxd_Point2D* points, size_t n)
+{
+    if (gc && points && n > 1)
+        gc->gc->StrokeLines(n, to_wx_points(points));
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_StrokeLineSegments(wxd_GraphicsContext_t* gc, const wxd_Point2D* begin,
+                                       const wxd_Point2D* end, size_t n)
+{
+    if (gc && begin && end && n > 0)
+        gc->gc->StrokeLines(n, to_wx_points(begin), to_wx_points(end));
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_DrawLines(wxd_GraphicsContext_t* gc, const wxd_Point2D* points, size_t n,
+                              int fill_style)
+{
+    if (gc && points && n > 1)
+        gc->gc->DrawLines(n, to_wx_points(points), static_cast<wxPolygonFillMode>(fill_style));
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_DrawRectangle(wxd_GraphicsContext_t* gc, double x, double y, double w,
+                                  double h)
+{
+    if (gc)
+        gc->gc->DrawRectangle(x, y, w, h);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_DrawRoundedRectangle(wxd_GraphicsContext_t* gc, double x, double y, double w,
+                                         double h, double radius)
+{
+    if (gc)
+        gc->gc->DrawRoundedRectangle(x, y, w, h, radius);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_DrawEllipse(wxd_GraphicsContext_t* gc, double x, double y, double w, double h)
+{
+    if (gc)
+        gc->gc->DrawEllipse(x, y, w, h);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_DrawText(wxd_GraphicsContext_t* gc, const char* utf8, size_t len, double x,
+                             double y)
+{
+    if (gc && (utf8 || len == 0))
+        gc->gc->DrawText(wxd_cpp_utils::ScratchWxString(utf8, len), x, y);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_GetTextExtent(wxd_GraphicsContext_t* gc, const char* utf8, size_t len,
+                                  double* width, double* height)
+{
+    double w = 0;
+    double h = 0;
+    if (gc && (utf8 || len == 0))
+        gc->gc->GetTextExtent(wxd_cpp_utils::ScratchWxString(utf8, len), &w, &h);
+    if (width)
+        *width = w;
+    if (height)
+        *height = h;
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_DrawBitmap(wxd_GraphicsContext_t* gc, const wxd_Bitmap_t* bitmap, double x,
+                               double y, double w, double h)
+{
+    if (gc && bitmap)
+        gc->gc->DrawBitmap(*reinterpret_cast<const wxBitmap*>(bitmap), x, y, w, h);
+}
+
+// --- wxGraphicsPath ---
+
+WXD_EXPORTED wxd_GraphicsPath_t*
+wxd_GraphicsPath_Create(wxd_GraphicsContext_t* gc)
+{
+    if (!gc)
+        return nullptr;
+    return new wxd_GraphicsPath_t{ gc->gc->CreatePath() };
+}
+
+WXD_EXPORTED void
+wxd_GraphicsPath_Destroy(wxd_GraphicsPath_t* path)
+{
+    delete path;
+}
+
+WXD_EXPORTED void
+wxd_GraphicsPath_MoveToPoint(wxd_GraphicsPath_t* path, double x, double y)
+{
+    if (path)
+        path->path.MoveToPoint(x, y);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsPath_AddLineToPoint(wxd_GraphicsPath_t* path, double x, double y)
+{
+    if (path)
+        path->path.AddLineToPoint(x, y);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsPath_AddLines(wxd_GraphicsPath_t* path, const wxd_Point2D* points, size_t n,
+                          bool close)
+{
+    if (path && points)
+        add_polyline(path->path, points, n, close);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsPath_AddPolylines(wxd_GraphicsPath_t* path, const wxd_Point2D* points,
+                              size_t point_count, const uint32_t* offsets, size_t subpaths,
+                              bool close)
+{
+    if (!path || !points || !offsets)
+        return;
+    for (size_t i = 0; i < subpaths; ++i) {
+        const size_t begin = offsets[i];
+        const size_t end = offsets[i + 1];
+        if (begin >= end || end > point_count)
+            continue;
+        add_polyline(path->path, points + begin, end - begin, close);
+    }
+}
+
+WXD_EXPORTED void
+wxd_GraphicsPath_AddRectangle(wxd_GraphicsPath_t* path, double x, double y, double w, double h)
+{
+    if (path)
+        path->path.AddRectangle(x, y, w, h);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsPath_AddRoundedRectangle(wxd_GraphicsPath_t* path, double x, double y, double w,
+                                     double h, double radius)
+{
+    if (path)
+        path->path.AddRoundedRectangle(x, y, w, h, radius);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsPath_AddCircle(wxd_GraphicsPath_t* path, double x, double y, double r)
+{
+    if (path)
+        path->path.AddCircle(x, y, r);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsPath_AddEllipse(wxd_GraphicsPath_t* path, double x, double y, double w, double h)
+{
+    if (path)
+        path->path.AddEllipse(x, y, w, h);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsPath_AddArc(wxd_GraphicsPath_t* path, double x, double y, double r, double start,
+                        double end, bool clockwise)
+{
+    if (path)
+        path->path.AddArc(x, y, r, start, end, clockwise);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsPath_AddCurveToPoint(wxd_GraphicsPath_t* path, double cx1, double cy1, double cx2,
+                                 double cy2, double x, double y)
+{
+    if (path)
+        path->path.AddCurveToPoint(cx1, cy1, cx2, cy2, x, y);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsPath_CloseSubpath(wxd_GraphicsPath_t* path)
+{
+    if (path)
+        path->path.CloseSubpath();
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_StrokePath(wxd_GraphicsContext_t* gc, const wxd_GraphicsPath_t* path)
+{
+    if (gc && path)
+        gc->gc->StrokePath(path->path);
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_FillPath(wxd_GraphicsContext_t* gc, const wxd_GraphicsPath_t* path,
+                             int fill_style)
+{
+    if (gc && path)
+        gc->gc->FillPath(path->path, static_cast<wxPolygonFillMode>(fill_style));
+}
+
+WXD_EXPORTED void
+wxd_GraphicsContext_DrawPath(wxd_GraphicsContext_t* gc, const wxd_GraphicsPath_t* path,
+                             int fill_style)
+{
+    if (gc && path)
+        gc->gc->DrawPath(path->path, static_cast<wxPolygonFillMode>(fill_style));
+}
+
+} // extern "C"
@@ -3,6 +3,44 @@
 #include <wx/grid.h>
 #include "../include/wxdragon.h"
 #include "../src/wxd_utils.h"
+#include "../src/wxd_grid_autosize.h"
+#include "../src/wxd_grid_session.h"
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+// Re-shows an open editor whose cell lies in the block, as SetCellValue() does.
+void
+resync_editor(wxGrid* grid, int top, int left, int bottom, int right)
+{
+    if (!grid->IsCellEditControlShown()) {
+        return;
+    }
+    const int row = grid->GetGridCursorRow();
+    const int col = grid->GetGridCursorCol();
+    if (row >= top && row <= bottom && col >= left && col <= right) {
+        grid->HideCellEditControl();
+        grid->ShowCellEditControl();
+    }
+}
+
+void
+set_cell_value(wxGrid* grid, int row, int col, const wxString& value)
+{
+    wxGridTableBase* table = grid->GetTable();
+    if (!table || row < 0 || row >= grid->GetNumberRows() || col < 0 ||
+        col >= grid->GetNumberCols() || !wxd_grid_session::mark(grid, row, col, row, col)) {
+        grid->SetCellValue(row, col, value);
+        return;
+    }
+    // Inside an update session: skip SetCellValue()'s immediate refresh.
+    table->SetValue(row, col, value);
+    resync_editor(grid, row, col, row, col);
+}
+
+} // namespace
 
 extern "C" {
 
@@ -50,7 +88,12 @@ WXD_EXPORTED bool
 wxd_Grid_InsertRows(wxd_Grid_t* self, int pos, int numRows, bool updateLabels)
 {
     if (!self) return false;
-    return reinterpret_cast<wxGrid*>(self)->InsertRows(pos, numRows, updateLabels);
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    if (!grid->InsertRows(pos, numRows, updateLabels)) {
+        return false;
+    }
+    wxd_grid_autosize::rows_moved(grid, pos, numRows);
+    return true;
 }
 
 WXD_EXPORTED bool
@@ -64,7 +107,12 @@ WXD_EXPORTED bool
 wxd_Grid_DeleteRows(wxd_Grid_t* self, int pos, int numRows, bool updateLabels)
 {
     if (!self) return false;
-    return reinterpret_cast<wxGrid*>(self)->DeleteRows(pos, numRows, updateLabels);
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    if (!grid->DeleteRows(pos, numRows, updateLabels)) {
+        return false;
+    }
+    wxd_grid_autosize::rows_moved(grid, pos, -numRows);
+    return true;
 }
 
 WXD_EXPORTED bool
@@ -98,12 +146,120 @@ wxd_Grid_GetCellValue(wxd_Grid_t* self, int row, int col, char* buffer, int buff
     return static_cast<int>(wxd_cpp_utils::copy_wxstring_to_buffer(value, buffer, buffer_len));
 }
 
+WXD_EXPORTED wxd_String_t*
+wxd_Grid_GetCellValueOwned(wxd_Grid_t* self, int row, int col)
+{
+    if (!self) return nullptr;
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    return wxd_cpp_utils::make_owned_string(grid->GetCellValue(row, col));
+}
+
 WXD_EXPORTED void
 wxd_Grid_SetCellValue(wxd_Grid_t* self, int row, int col, const char* value)
 {
     if (!self) return;
-    reinterpret_cast<wxGrid*>(self)->SetCellValue(row, col,
-                                                   wxString::FromUTF8(value ? value : ""));
+    set_cell_value(reinterpret_cast<wxGrid*>(self), row, col,
+                   wxd_cpp_utils::ScratchWxString(value));
+}
+
+WXD_EXPORTED void
+wxd_Grid_SetCellValueLen(wxd_Grid_t* self, int row, int col, const char* value, size_t len)
+{
+    if (!self) return;
+    set_cell_value(reinterpret_cast<wxGrid*>(self), row, col,
+                   wxd_cpp_utils::ScratchWxString(value, len));
+}
+
+WXD_EXPORTED int
+wxd_Grid_SetCellValuesBlock(wxd_Grid_t* self, int top, int left, int rows, int cols,
+                            const char* packed_utf8, const uint32_t* offsets)
+{
+    if (!self || !offsets || rows <= 0 || cols <= 0) {
+        return 0;
+    }
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    wxGridTableBase* table = grid->GetTable();
+    if (!table) {
+        return 0;
+    }
+
+    // Write straight to the table: SetCellValue() would invalidate every cell separately and
+    // EndBatch() repaints the whole grid, while only this block needs it (or, inside an update
+    // session, gets recorded).
+    const int num_rows = grid->GetNumberRows();
+    const int num_cols = grid->GetNumberCols();
+    int written = 0;
+    for (int r = 0; r < rows; ++r) {
+        const int row = top + r;
+        for (int c = 0; c < cols; ++c) {
+            const int col = left + c;
+            if (row < 0 || row >= num_rows || col < 0 || col >= num_cols) {
+                continue;
+            }
+            const size_t i = static_cast<size_t>(r) * cols + c;
+            const uint32_t begin = offsets[i];
+            const uint32_t end = offsets[i + 1];
+            const size_t len = end > begin ? end - begin : 0;
+            const char* value = packed_utf8 ? packed_utf8 + begin : nullptr;
+            table->SetValue(row, col, wxd_cpp_utils::ScratchWxString(value, len));
+            ++written;
+        }
+    }
+    if (written == 0) {
+        return 0;
+    }
+
+    const int bottom = std::min(top + rows, num_rows) - 1;
+    const int right = std::min(left + cols, num_cols) - 1;
+    wxd_grid_session::refresh_block(grid, std::max(top, 0), std::max(left, 0), bottom, right);
+    resync_editor(grid, top, left, bottom, right);
+    return written;
+}
+
+WXD_EXPORTED wxd_String_t*
+wxd_Grid_GetCellValuesBlock(wxd_Grid_t* self, int top, int left, int rows, int cols,
+                            uint32_t* offsets, size_t offsets_len)
+{
+    if (!self || !offsets || rows < 0 || cols < 0) {
+        return nullptr;
+    }
+    const size_t count = static_cast<size_t>(rows) * cols;
+    if (offsets_len < count + 1) {
+        return nullptr;
+    }
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    wxGridTableBase* table = grid->GetTable();
+
+    // Convert each cell once, then lay them out back to back (as wxd_ArrayString_ExportPacked).
+    const int num_rows = grid->GetNumberRows();
+    const int num_cols = grid->GetNumberCols();
+    std::vector<wxCharBuffer> utf8(count);
+    size_t total = 0;
+    for (int r = 0; r < rows; ++r) {
+        const int row = top + r;
+        for (int c = 0; c < cols; ++c) {
+            const int col = left + c;
+            const size_t i = static_cast<size_t>(r) * cols + c;
+            offsets[i] = static_cast<uint32_t>(total);
+            if (!table || row < 0 || row >= num_rows || col < 0 || col >= num_cols) {
+                continue;
+            }
+            utf8[i] = table->GetValue(row, col).utf8_str();
+            total += utf8[i].length();
+        }
+    }
+    offsets[count] = static_cast<uint32_t>(total);
+
+    wxCharBuffer packed(total);
+    if (total > 0 && !packed.data()) {
+        return nullptr;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        if (utf8[i].length() > 0) {
+            memcpy(packed.data() + offsets[i], utf8[i].data(), utf8[i].length());
+        }
+    }
+    return wxd_cpp_utils::make_owned_string(packed);
 }
 
 // --- Label Functions ---
@@ -308,8 +464,9 @@ WXD_EXPORTED void
 wxd_Grid_SetCellBackgroundColour(wxd_Grid_t* self, int row, int col, wxd_Colour_t colour)
 {
     if (!self) return;
-    reinterpret_cast<wxGrid*>(self)->SetCellBackgroundColour(row, col,
-        wxColour(colour.r, colour.g, colour.b, colour.a));
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    grid->SetCellBackgroundColour(row, col, wxColour(colour.r, colour.g, colour.b, colour.a));
+    wxd_grid_session::mark(grid, row, col, row, col);
 }
 
 WXD_EXPORTED wxd_Colour_t
@@ -329,8 +486,9 @@ WXD_EXPORTED void
 wxd_Grid_SetCellTextColour(wxd_Grid_t* self, int row, int col, wxd_Colour_t colour)
 {
     if (!self) return;
-    reinterpret_cast<wxGrid*>(self)->SetCellTextColour(row, col,
-        wxColour(colour.r, colour.g, colour.b, colour.a));
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    grid->SetCellTextColour(row, col, wxColour(colour.r, colour.g, colour.b, colour.a));
+    wxd_grid_session::mark(grid, row, col, row, col);
 }
 
 WXD_EXPORTED void
@@ -344,7 +502,9 @@ WXD_EXPORTED void
 wxd_Grid_SetCellAlignment(wxd_Grid_t* self, int row, int col, int horiz, int vert)
 {
     if (!self) return;
-    reinterpret_cast<wxGrid*>(self)->SetCellAlignment(row, col, horiz, vert);
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    grid->SetCellAlignment(row, col, horiz, vert);
+    wxd_grid_session::mark(grid, row, col, row, col);
 }
 
 // --- Default Cell Formatting ---
@@ -561,6 +721,70 @@ wxd_Grid_GetSelectedBlocks(wxd_Grid_t* self, wxd_GridBlockCoords* buffer, int bu
     return count;
 }
 
+WXD_EXPORTED int
+wxd_Grid_GetSelectionRanges(wxd_Grid_t* self, wxd_GridBlockCoords* buffer, int buffer_len)
+{
+    if (!self) return 0;
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    // Since wx 3.1.4 every kind of selection is stored as blocks, but they may overlap.
+    wxGridBlocks range = grid->GetSelectedBlocks();
+    std::vector<wxGridBlockCoords> blocks(range.begin(), range.end());
+
+    // Cut the rows into bands at every block edge; within a band the covered columns are a
+    // fixed set of intervals. Consecutive bands with the same intervals become one rectangle.
+    std::vector<int> edges;
+    edges.reserve(blocks.size() * 2);
+    for (const wxGridBlockCoords& block : blocks) {
+        edges.push_back(block.GetTopRow());
+        edges.push_back(block.GetBottomRow() + 1);
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    std::vector<wxd_GridBlockCoords> out;
+    std::vector<std::pair<int, int>> open; // column intervals of the previous band
+    std::vector<size_t> open_index;        // their rectangles in `out`
+    int open_bottom = -2;
+    for (size_t e = 0; e + 1 < edges.size(); ++e) {
+        const int top = edges[e];
+        const int bottom = edges[e + 1] - 1;
+        std::vector<std::pair<int, int>> cols;
+        for (const wxGridBlockCoords& block : blocks) {
+            if (block.GetTopRow() <= top && block.GetBottomRow() >= bottom)
+                cols.emplace_back(block.GetLeftCol(), block.GetRightCol());
+        }
+        std::sort(cols.begin(), cols.end());
+        std::vector<std::pair<int, int>> merged;
+        for (const auto& interval : cols) {
+            if (!merged.empty() && interval.first <= merged.back().second + 1) {
+                merged.back().second = std::max(merged.back().second, interval.second);
+            } else {
+                merged.push_back(interval);
+            }
+        }
+
+        if (!merged.empty() && merged == open && open_bottom + 1 == top) {
+            for (size_t i : open_index) {
+                out[i].bottom_row = bottom;
+            }
+        } else {
+            open_index.clear();
+            for (const auto& interval : merged) {
+                open_index.push_back(out.size());
+                out.push_back(wxd_GridBlockCoords{top, interval.first, bottom, interval.second});
+            }
+            open = merged;
+        }
+        open_bottom = bottom;
+    }
+
+    const int count = static_cast<int>(out.size());
+    if (buffer && buffer_len > 0) {
+        std::copy(out.begin(), out.begin() + std::min(count, buffer_len), buffer);
+    }
+    return count;
+}
+
 WXD_EXPORTED int
 wxd_Grid_GetSelectedRowBlocks(wxd_Grid_t* self, wxd_GridBlockCoords* buffer, int buffer_len)
 {
@@ -993,7 +1217,9 @@ WXD_EXPORTED void
 wxd_Grid_SetCellFont(wxd_Grid_t* self, int row, int col, const wxd_Font_t* font)
 {
     if (!self || !font) return;
-    reinterpret_cast<wxGrid*>(self)->SetCellFont(row, col, *reinterpret_cast<const wxFont*>(font));
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    grid->SetCellFont(row, col, *reinterpret_cast<const wxFont*>(font));
+    wxd_grid_session::mark(grid, row, col, row, col);
 }
 
 WXD_EXPORTED wxd_Font_t*
@@ -1782,6 +2008,49 @@ wxd_Grid_ResetRowPos(wxd_Grid_t* self)
     reinterpret_cast<wxGrid*>(self)->ResetRowPos();
 }
 
+WXD_EXPORTED bool
+wxd_Grid_ApplyRowPermutation(wxd_Grid_t* self, const int* order, int n)
+{
+    if (!self || !order || n < 0) return false;
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    if (n != grid->GetNumberRows()) return false;
+
+    std::vector<char> seen(static_cast<size_t>(n), 0);
+    wxArrayInt rows;
+    rows.reserve(n);
+    for (int i = 0; i < n; ++i) {
+        const int row = order[i];
+        if (row < 0 || row >= n || seen[row]) return false;
+        seen[row] = 1;
+        rows.push_back(row);
+    }
+    grid->SetRowsOrder(rows);
+    return true;
+}
+
+WXD_EXPORTED bool
+wxd_Grid_GetColumnNumbers(wxd_Grid_t* self, int col, double* out, int n)
+{
+    if (!self || !out || n < 0) return false;
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    wxGridTableBase* table = grid->GetTable();
+    if (!table || col < 0 || col >= grid->GetNumberCols() || n > grid->GetNumberRows())
+        return false;
+
+    std::vector<double> values(static_cast<size_t>(n));
+    for (int row = 0; row < n; ++row) {
+        if (table->CanGetValueAs(row, col, wxGRID_VALUE_FLOAT)) {
+            values[row] = table->GetValueAsDouble(row, col);
+        } else if (table->CanGetValueAs(row, col, wxGRID_VALUE_NUMBER)) {
+            values[row] = static_cast<double>(table->GetValueAsLong(row, col));
+        } else {
+            return false;
+        }
+    }
+    std::copy(values.begin(), values.end(), out);
+    return true;
+}
+
 // --- Margins ---
 
 WXD_EXPORTED void
@@ -0,0 +1,332 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include <wx/grid.h>
+#include "../include/wxdragon.h"
+#include "../src/wxd_grid_autosize.h"
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Extra room around the text, as wxGrid::AutoSizeColumn() adds.
+constexpr int kColumnMargin = 10;
+// Bound on cached (font, length) estimates per grid.
+constexpr size_t kMaxCachedWidths = 4096;
+
+// Per-grid measuring state: the width estimate cache and, with auto-grow, which rows have
+// already been measured.
+class GridMeasureState {
+public:
+    explicit GridMeasureState(wxGrid* grid) : m_grid(grid) {}
+
+    int
+    MeasureCell(wxDC& dc, int row, int col, bool estimate)
+    {
+        wxGridCellAttrPtr attr = m_grid->GetCellAttrPtr(row, col);
+        if (estimate && m_grid->GetTable() &&
+            m_grid->GetTable()->GetTypeName(row, col) == wxGRID_VALUE_STRING) {
+            const wxString value = m_grid->GetCellValue(row, col);
+            if (value.find('\n') == wxString::npos) {
+                const Key key = MakeKey(attr->GetFont(), value.length());
+                auto it = m_widths.find(key);
+                if (it != m_widths.end()) {
+                    return it->second;
+                }
+                const int width = Measure(dc, *attr, row, col);
+                if (m_widths.size() >= kMaxCachedWidths) {
+                    m_widths.clear();
+                }
+                m_widths.emplace(key, width);
+                return width;
+            }
+        }
+        return Measure(dc, *attr, row, col);
+    }
+
+    // Shifts `measured` for rows inserted (count > 0) or deleted (count < 0) at `pos`. Rows
+    // past its end were never measured, so appends need nothing.
+    void
+    MoveRows(int pos, int count)
+    {
+        if (pos < 0 || static_cast<size_t>(pos) >= measured.size()) {
+            return;
+        }
+        if (count > 0) {
+            measured.insert(measured.begin() + pos, static_cast<size_t>(count), false);
+        } else if (count < 0) {
+            const size_t erased = std::min(static_cast<size_t>(-count), measured.size() - pos);
+            measured.erase(measured.begin() + pos, measured.begin() + pos + erased);
+        }
+    }
+
+    // Rows measured by auto-grow; sized lazily to the grid.
+    std::vector<bool> measured;
+    bool auto_grow = false;
+    bool auto_grow_estimate = false;
+    bool grow_pending = false;
+
+    void OnPaint(wxPaintEvent& event);
+
+private:
+    // Font properties rather than its ref data, which can be freed and reused by another font.
+    using Key = std::tuple<wxString, double, int, int, int, size_t>;
+
+    static Key
+    MakeKey(const wxFont& font, size_t length)
+    {
+        if (!font.IsOk()) {
+            return Key(wxString(), 0.0, 0, 0, 0, length);
+        }
+        return Key(font.GetFaceName(), font.GetFractionalPointSize(), font.GetNumericWeight(),
+                   font.GetStyle(), font.GetFamily(), length);
+    }
+
+    int
+    Measure(wxDC& dc, wxGridCellAttr& attr, int row, int col)
+    {
+        wxGridCellRendererPtr renderer = attr.GetRendererPtr(m_grid, row, col);
+        if (!renderer)
+            return 0;
+        dc.SetFont(attr.GetFont());
+        return renderer->GetBestSize(*m_grid, attr, dc, row, col).GetWidth();
+    }
+
+    wxGrid* m_grid;
+    std::map<Key, int> m_widths;
+};
+
+std::unordered_map<wxGrid*, std::unique_ptr<GridMeasureState>>&
+states()
+{
+    static std::unordered_map<wxGrid*, std::unique_ptr<GridMeasureState>> map;
+    return map;
+}
+
+void
+on_grid_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    if (wxGrid* grid = wxDynamicCast(event.GetEventObject(), wxGrid)) {
+        states().erase(grid);
+    }
+}
+
+GridMeasureState&
+state_for(wxGrid* grid)
+{
+    auto& map = states();
+    auto it = map.find(grid);
+    if (it != map.end())
+        return *it->second;
+    grid->Bind(wxEVT_DESTROY, on_grid_destroy);
+    return *map.emplace(grid, std::make_unique<GridMeasureState>(grid)).first->second;
+}
+
+// Rows currently inside the grid window, or false if there are none.
+bool
+visible_rows(wxGrid* grid, int* first, int* last)
+{
+    if (grid->GetNumberRows() == 0)
+        return false;
+    int y = 0;
+    grid->CalcUnscrolledPosition(0, 0, nullptr, &y);
+    const int height = grid->GetGridWindow()->GetClientSize().GetHeight();
+    *first = grid->YToRow(y, true);
+    *last = grid->YToRow(y + std::max(height - 1, 0), true);
+    return *first >= 0 && *last >= *first;
+}
+
+std::vector<int>
+sample_rows(wxGrid* grid, const wxd_GridAutoSizeSample& sample)
+{
+    const int num_rows = grid->GetNumberRows();
+    std::vector<int> rows;
+    if (num_rows <= 0)
+        return rows;
+    if (sample.visible_rows) {
+        int first = 0;
+        int last = -1;
+        if (visible_rows(grid, &first, &last)) {
+            for (int row = first; row <= last; ++row) {
+                rows.push_back(row);
+            }
+        }
+    }
+    for (int row = 0; row < std::min(sample.head_rows, num_rows); ++row) {
+        rows.push_back(row);
+    }
+    for (int row = std::max(num_rows - std::max(sample.tail_rows, 0), 0); row < num_rows; ++row) {
+        rows.push_back(row);
+    }
+    if (sample.stride_rows > 0) {
+        const int count = std::min(sample.stride_rows, num_rows);
+        for (int i = 0; i < count; ++i) {
+            rows.push_back(static_cast<int>(static_cast<int64_t>(i) * num_rows / count));
+        }
+    }
+    std::sort(rows.begin(), rows.end());
+    rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+    return rows;
+}
+
+int
+label_width(wxGrid* grid, wxDC& dc, int col)
+{
+    dc.SetFont(grid->GetLabelFont());
+    wxCoord w = 0;
+    wxCoord h = 0;
+    dc.GetMultiLineTextExtent(grid->GetColLabelValue(col), &w, &h);
+    return grid->GetColLabelTextOrientation() == wxVERTICAL ? h : w;
+}
+
+int
+measure_rows(GridMeasureState& state, wxDC& dc, int col, const std::vector<int>& rows,
+             bool estimate)
+{
+    int widest = 0;
+    for (int row : rows) {
+        widest = std::max(widest, state.MeasureCell(dc, row, col, estimate));
+    }
+    return widest;
+}
+
+int
+autosize_column(wxGrid* grid, GridMeasureState& state, wxDC& dc, int col,
+                const std::vector<int>& rows, bool estimate, bool set_as_min)
+{
+    int width = std::max(measure_rows(state, dc, col, rows, estimate), label_width(grid, dc, col));
+    width = width > 0 ? width + kColumnMargin : grid->GetDefaultColSize();
+    width = std::max(width, grid->GetColMinimalWidth(col));
+    grid->SetColSize(col, width);
+    if (set_as_min)
+        grid->SetColMinimalWidth(col, width);
+    return width;
+}
+
+// Measures rows that became visible since the last pass and widens columns that no longer fit.
+void
+grow_visible(wxGrid* grid, GridMeasureState& state)
+{
+    state.grow_pending = false;
+    int first = 0;
+    int last = -1;
+    if (!state.auto_grow || !visible_rows(grid, &first, &last))
+        return;
+    state.measured.resize(grid->GetNumberRows(), false);
+
+    std::vector<int> rows;
+    for (int row = first; row <= last; ++row) {
+        if (!state.measured[row]) {
+            state.measured[row] = true;
+            rows.push_back(row);
+        }
+    }
+    if (rows.empty())
+        return;
+
+    wxClientDC dc(grid->GetGridWindow());
+    std::vector<std::pair<int, int>> grown;
+    for (int col = 0; col < grid->GetNumberCols(); ++col) {
+        const int widest = measure_rows(state, dc, col, rows, state.auto_grow_estimate);
+        if (widest > 0 && widest + kColumnMargin > grid->GetColSize(col))
+            grown.emplace_back(col, widest + kColumnMargin);
+    }
+    if (grown.empty())
+        return;
+    grid->BeginBatch();
+    for (const auto& [col, width] : grown) {
+        grid->SetColSize(col, width);
+    }
+    grid->EndBatch();
+}
+
+void
+GridMeasureState::OnPaint(wxPaintEvent& event)
+{
+    event.Skip();
+    // Resizing while painting would recurse; do it once the paint has finished.
+    if (!auto_grow || grow_pending)
+        return;
+    grow_pending = true;
+    wxGrid* grid = m_grid;
+    grid->CallAfter([grid]() {
+        auto& map = states();
+        auto it = map.find(grid);
+        if (it != map.end())
+            grow_visible(grid, *it->second);
+    });
+}
+
+} // namespace
+
+namespace wxd_grid_autosize {
+
+void
+rows_moved(wxGrid* grid, int pos, int count)
+{
+    auto& map = states();
+    auto it = map.find(grid);
+    if (it != map.end()) {
+        it->second->MoveRows(pos, count);
+    }
+}
+
+} // namespace wxd_grid_autosize
+
+WXD_EXPORTED int
+wxd_Grid_AutoSizeColumnSampled(wxd_Grid_t* self, int col, const wxd_GridAutoSizeSample* sample,
+                               bool setAsMin)
+{
+    if (!self || !sample)
+        return -1;
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    if (col < 0 || col >= grid->GetNumberCols())
+        return -1;
+    GridMeasureState& state = state_for(grid);
+    wxClientDC dc(grid->GetGridWindow());
+    return autosize_column(grid, state, dc, col, sample_rows(grid, *sample),
+                           sample->estimate_by_length, setAsMin);
+}
+
+WXD_EXPORTED void
+wxd_Grid_AutoSizeColumnsSampled(wxd_Grid_t* self, const wxd_GridAutoSizeSample* sample,
+                                bool setAsMin)
+{
+    if (!self || !sample)
+        return;
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    GridMeasureState& state = state_for(grid);
+    const std::vector<int> rows = sample_rows(grid, *sample);
+    wxClientDC dc(grid->GetGridWindow());
+    grid->BeginBatch();
+    for (int col = 0; col < grid->GetNumberCols(); ++col) {
+        autosize_column(grid, state, dc, col, rows, sample->estimate_by_length, setAsMin);
+    }
+    grid->EndBatch();
+}
+
+WXD_EXPORTED void
+wxd_Grid_EnableAutoGrowColumns(wxd_Grid_t* self, bool enable, bool estimateByLength)
+{
+    if (!self)
+        return;
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    GridMeasureState& state = state_for(grid);
+    state.auto_grow_estimate = estimateByLength;
+    if (state.auto_grow == enable)
+        return;
+    state.auto_grow = enable;
+    state.measured.clear();
+    wxWindow* window = grid->GetGridWindow();
+    if (enable) {
+        window->Bind(wxEVT_PAINT, &GridMeasureState::OnPaint, &state);
+        window->Refresh();
+    } else {
+        window->Unbind(wxEVT_PAINT, &GridMeasureState::OnPaint, &state);
+    }
+}
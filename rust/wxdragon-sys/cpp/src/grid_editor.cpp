@@ -0,0 +1,168 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include <wx/grid.h>
+#include "../include/wxdragon.h"
+#include <memory>
+
+namespace {
+
+// Callbacks shared by an editor and its clones; userdata is freed with the last of them.
+struct EditorCallbacks {
+    wxd_GridCellEditor_Callbacks fns;
+
+    ~EditorCallbacks()
+    {
+        if (fns.userdata_free)
+            fns.userdata_free(fns.userdata);
+    }
+};
+
+// Text cell editor whose edits go through Rust callbacks. The grid creates the text control
+// the first time the editor is shown and keeps it hidden between edits, so every column or
+// type sharing this editor object reuses one control; only a changed cell rectangle moves it.
+class WxdCallbackGridCellEditor : public wxGridCellTextEditor {
+public:
+    explicit WxdCallbackGridCellEditor(std::shared_ptr<EditorCallbacks> callbacks)
+        : m_callbacks(std::move(callbacks))
+    {
+    }
+
+    void
+    SetSize(const wxRect& rect) override
+    {
+        // Hidden controls keep their place, so showing the editor again in the same spot
+        // needs no move.
+        if (m_control && m_control == m_sizedControl && rect == m_rect)
+            return;
+        m_rect = rect;
+        m_sizedControl = m_control;
+        wxGridCellTextEditor::SetSize(rect);
+    }
+
+    void
+    BeginEdit(int row, int col, wxGrid* grid) override
+    {
+        wxGridCellTextEditor::BeginEdit(row, col, grid);
+        const wxd_GridCellEditor_Callbacks& fns = m_callbacks->fns;
+        if (fns.begin_edit)
+            fns.begin_edit(fns.userdata, row, col, reinterpret_cast<wxd_Window_t*>(Text()));
+    }
+
+    bool
+    EndEdit(int row, int col, const wxGrid* grid, const wxString& oldval,
+            wxString* newval) override
+    {
+        const wxString value = Text()->GetValue();
+        if (value == oldval)
+            return false;
+        const wxd_GridCellEditor_Callbacks& fns = m_callbacks->fns;
+        if (fns.end_edit &&
+            !fns.end_edit(fns.userdata, row, col, oldval.utf8_str(), value.utf8_str()))
+            return false;
+        m_pending = value;
+        if (newval)
+            *newval = value;
+        return true;
+    }
+
+    void
+    ApplyEdit(int row, int col, wxGrid* grid) override
+    {
+        const wxd_GridCellEditor_Callbacks& fns = m_callbacks->fns;
+        if (!fns.apply_edit || !fns.apply_edit(fns.userdata, row, col, m_pending.utf8_str()))
+            grid->GetTable()->SetValue(row, col, m_pending);
+        m_pending.clear();
+    }
+
+    wxString
+    GetValue() const override
+    {
+        return Text()->GetValue();
+    }
+
+    wxGridCellEditor*
+    Clone() const override
+    {
+        return new WxdCallbackGridCellEditor(m_callbacks);
+    }
+
+private:
+    std::shared_ptr<EditorCallbacks> m_callbacks;
+    wxString m_pending;
+    wxRect m_rect;
+    const wxWindow* m_sizedControl = nullptr;
+};
+
+wxGridCellEditor*
+unwrap(wxd_GridCellEditor_t* editor)
+{
+    return reinterpret_cast<wxGridCellEditor*>(editor);
+}
+
+} // namespace
+
+extern "C" {
+
+WXD_EXPORTED wxd_GridCellEditor_t*
+wxd_GridCellEditor_Create(const wxd_GridCellEditor_Callbacks* callbacks)
+{
+    if (!callbacks)
+        return nullptr;
+    auto shared = std::make_shared<EditorCallbacks>();
+    shared->fns = *callbacks;
+    return reinterpret_cast<wxd_GridCellEditor_t*>(new WxdCallbackGridCellEditor(shared));
+}
+
+WXD_EXPORTED void
+wxd_GridCellEditor_DecRef(wxd_GridCellEditor_t* editor)
+{
+    if (editor)
+        unwrap(editor)->DecRef();
+}
+
+WXD_EXPORTED void
+wxd_Grid_SetColEditor(wxd_Grid_t* self, int col, wxd_GridCellEditor_t* editor)
+{
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    if (!grid || !editor || !grid->GetTable())
+        return;
+    // Like wxd_Grid_SetColRenderer: keep the column's other attributes.
+    wxGridCellAttr* attr = grid->GetTable()->GetAttr(-1, col, wxGridCellAttr::Col);
+    if (!attr)
+        attr = new wxGridCellAttr;
+    unwrap(editor)->IncRef();
+    attr->SetEditor(unwrap(editor));
+    grid->SetColAttr(col, attr);
+}
+
+WXD_EXPORTED void
+wxd_Grid_SetCellEditor(wxd_Grid_t* self, int row, int col, wxd_GridCellEditor_t* editor)
+{
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    if (!grid || !editor)
+        return;
+    unwrap(editor)->IncRef();
+    grid->SetCellEditor(row, col, unwrap(editor));
+}
+
+WXD_EXPORTED void
+wxd_Grid_RegisterDataType(wxd_Grid_t* self, const char* typeName,
+                          wxd_GridCellRenderer_t* renderer, wxd_GridCellEditor_t* editor)
+{
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    if (!grid || !typeName)
+        return;
+    wxGridCellRenderer* native_renderer = reinterpret_cast<wxGridCellRenderer*>(renderer);
+    if (native_renderer)
+        native_renderer->IncRef();
+    else
+        native_renderer = new wxGridCellStringRenderer;
+    wxGridCellEditor* native_editor = unwrap(editor);
+    if (native_editor)
+        native_editor->IncRef();
+    else
+        native_editor = new wxGridCellTextEditor;
+    grid->RegisterDataType(wxString::FromUTF8(typeName), native_renderer, native_editor);
+}
+
+} // extern "C"
@@ -0,0 +1,255 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include <wx/grid.h>
+#include <wx/stopwatch.h>
+#include <wx/timer.h>
+#include "../include/wxdragon.h"
+#include "../src/wxd_utils.h"
+#include "../src/wxd_grid_autosize.h"
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+
+class IngestPump;
+
+struct IngestRow {
+    std::string bytes;
+    std::vector<uint32_t> offsets; // cols + 1 entries, relative to `bytes`
+};
+
+// Shared by producers, the handle and the pump. Holds no wx objects, so the last reference may
+// be dropped on any thread.
+struct IngestState {
+    std::mutex mutex;
+    std::deque<IngestRow> rows;
+    size_t capacity = 0;
+    bool closed = false;
+    // Set by the producer that queues the first row after a flush; cleared by the pump.
+    std::atomic<bool> wake_pending{ false };
+    // Main thread only.
+    IngestPump* pump = nullptr;
+};
+
+// Main-thread side: a one-shot timer that drains the buffer into the grid no more often than
+// the flush interval.
+class IngestPump : public wxTimer {
+public:
+    IngestPump(wxGrid* grid, std::shared_ptr<IngestState> state, int max_rows, bool auto_scroll,
+               int interval_ms)
+        : m_grid(grid), m_state(std::move(state)), m_max_rows(max_rows),
+          m_auto_scroll(auto_scroll), m_interval_ms(std::max(interval_ms, 1))
+    {
+        m_state->pump = this;
+        m_grid->Bind(wxEVT_DESTROY, &IngestPump::OnGridDestroy, this);
+    }
+
+    ~IngestPump()
+    {
+        Stop();
+        if (m_state->pump == this)
+            m_state->pump = nullptr;
+    }
+
+    void
+    Schedule()
+    {
+        if (!m_grid || IsRunning())
+            return;
+        const long elapsed = m_since_flush.Time();
+        StartOnce(static_cast<int>(std::max<long>(m_interval_ms - elapsed, 1)));
+    }
+
+    void
+    Notify() override
+    {
+        m_state->wake_pending.store(false, std::memory_order_relaxed);
+        std::deque<IngestRow> batch;
+        bool closed = false;
+        {
+            std::lock_guard<std::mutex> lock(m_state->mutex);
+            batch.swap(m_state->rows);
+            closed = m_state->closed;
+        }
+        m_since_flush.Start();
+        if (!batch.empty() && m_grid)
+            Append(batch);
+        if (closed)
+            Retire();
+    }
+
+private:
+    void
+    Append(std::deque<IngestRow>& batch)
+    {
+        wxGridTableBase* table = m_grid->GetTable();
+        if (!table)
+            return;
+        if (m_max_rows > 0 && batch.size() > static_cast<size_t>(m_max_rows))
+            batch.erase(batch.begin(), batch.end() - m_max_rows);
+        const int count = static_cast<int>(batch.size());
+
+        // One layout and scrollbar update for the whole flush.
+        m_grid->BeginBatch();
+        if (m_max_rows > 0) {
+            const int overflow = m_grid->GetNumberRows() + count - m_max_rows;
+            if (overflow > 0) {
+                const int deleted = std::min(overflow, m_grid->GetNumberRows());
+                m_grid->DeleteRows(0, deleted);
+                wxd_grid_autosize::rows_moved(m_grid, 0, -deleted);
+            }
+        }
+        const int first = m_grid->GetNumberRows();
+        if (!m_grid->AppendRows(count)) {
+            m_grid->EndBatch();
+            return;
+        }
+        const int num_cols = m_grid->GetNumberCols();
+        for (int i = 0; i < count; ++i) {
+            const IngestRow& row = batch[i];
+            const int cells = std::min(num_cols, static_cast<int>(row.offsets.size()) - 1);
+            for (int col = 0; col < cells; ++col) {
+                const uint32_t begin = row.offsets[col];
+                const uint32_t end = std::max(row.offsets[col + 1], begin);
+                table->SetValue(first + i, col,
+                                wxd_cpp_utils::ScratchWxString(row.bytes.data() + begin,
+                                                               end - begin));
+            }
+        }
+        m_grid->EndBatch();
+
+        if (m_auto_scroll && m_grid->GetNumberRows() > 0) {
+            // Keep the horizontal position: aim at the leftmost visible column.
+            int x = 0;
+            m_grid->CalcUnscrolledPosition(0, 0, &x, nullptr);
+            const int col = std::max(m_grid->XToCol(x, true), 0);
+            m_grid->MakeCellVisible(m_grid->GetNumberRows() - 1, col);
+        }
+    }
+
+    // The channel is closed and drained, or the grid is gone: free the pump once control is
+    // back in the event loop.
+    void
+    Retire()
+    {
+        Stop();
+        {
+            // Later pushes fail instead of filling a buffer nobody drains.
+            std::lock_guard<std::mutex> lock(m_state->mutex);
+            m_state->closed = true;
+        }
+        m_state->pump = nullptr;
+        m_grid = nullptr;
+        if (wxTheApp) {
+            IngestPump* self = this;
+            wxTheApp->CallAfter([self]() { delete self; });
+        }
+    }
+
+    void
+    OnGridDestroy(wxWindowDestroyEvent& event)
+    {
+        event.Skip();
+        if (m_grid && event.GetEventObject() == m_grid)
+            Retire();
+    }
+
+    wxGrid* m_grid;
+    std::shared_ptr<IngestState> m_state;
+    int m_max_rows;
+    bool m_auto_scroll;
+    int m_interval_ms;
+    wxStopWatch m_since_flush;
+};
+
+// Producer side: asks the main thread to schedule a flush, once per burst.
+void
+wake_pump(const std::shared_ptr<IngestState>& state)
+{
+    if (state->wake_pending.exchange(true) || !wxTheApp)
+        return;
+    std::weak_ptr<IngestState> weak = state;
+    wxTheApp->CallAfter([weak]() {
+        if (std::shared_ptr<IngestState> locked = weak.lock()) {
+            if (locked->pump)
+                locked->pump->Schedule();
+        }
+    });
+}
+
+} // namespace
+
+struct wxd_GridIngest_t {
+    std::shared_ptr<IngestState> state;
+};
+
+WXD_EXPORTED wxd_GridIngest_t*
+wxd_GridIngest_Create(wxd_Grid_t* grid, size_t capacityRows, int maxRows, bool autoScroll,
+                      int flushIntervalMs)
+{
+    if (!grid || capacityRows == 0)
+        return nullptr;
+    auto state = std::make_shared<IngestState>();
+    state->capacity = capacityRows;
+    // Owned by itself: it retires when the channel is drained after Destroy, or with the grid.
+    new IngestPump(reinterpret_cast<wxGrid*>(grid), state, maxRows, autoScroll, flushIntervalMs);
+    return new wxd_GridIngest_t{ state };
+}
+
+WXD_EXPORTED bool
+wxd_GridIngest_PushRow(wxd_GridIngest_t* ingest, const char* packed_utf8,
+                       const uint32_t* offsets, int cols)
+{
+    if (!ingest || !offsets || cols < 0)
+        return false;
+    const uint32_t begin = offsets[0];
+    const uint32_t end = offsets[cols];
+    if (end < begin || (end > begin && !packed_utf8))
+        return false;
+
+    IngestRow row;
+    row.bytes.assign(packed_utf8 ? packed_utf8 + begin : "", end - begin);
+    row.offsets.resize(static_cast<size_t>(cols) + 1);
+    for (int i = 0; i <= cols; ++i) {
+        row.offsets[i] = std::min(std::max(offsets[i], begin), end) - begin;
+    }
+
+    IngestState& state = *ingest->state;
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (state.closed || state.rows.size() >= state.capacity)
+            return false;
+        state.rows.push_back(std::move(row));
+    }
+    wake_pump(ingest->state);
+    return true;
+}
+
+WXD_EXPORTED size_t
+wxd_GridIngest_GetPendingCount(wxd_GridIngest_t* ingest)
+{
+    if (!ingest)
+        return 0;
+    std::lock_guard<std::mutex> lock(ingest->state->mutex);
+    return ingest->state->rows.size();
+}
+
+WXD_EXPORTED void
+wxd_GridIngest_Destroy(wxd_GridIngest_t* ingest)
+{
+    if (!ingest)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(ingest->state->mutex);
+        ingest->state->closed = true;
+    }
+    // One more flush drains what is queued and retires the pump.
+    ingest->state->wake_pending.store(false);
+    wake_pump(ingest->state);
+    delete ingest;
+}
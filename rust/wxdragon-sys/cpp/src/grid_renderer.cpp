@@ -0,0 +1,264 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include <wx/grid.h>
+#include "../include/wxdragon.h"
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+// Callbacks shared by a renderer and its clones; userdata is freed with the last of them.
+struct RendererCallbacks {
+    wxd_GridCellRenderer_Callbacks fns;
+
+    ~RendererCallbacks()
+    {
+        if (fns.userdata_free)
+            fns.userdata_free(fns.userdata);
+    }
+};
+
+// Cells a batching renderer already drew during the current paint of one grid window, by
+// column. Cleared at the start of every paint.
+struct WindowBatchState {
+    std::unordered_map<int, std::unordered_set<int>> drawn;
+};
+
+std::unordered_map<wxWindow*, WindowBatchState>&
+batch_states()
+{
+    static std::unordered_map<wxWindow*, WindowBatchState> map;
+    return map;
+}
+
+void
+on_grid_window_paint(wxPaintEvent& event)
+{
+    event.Skip();
+    auto it = batch_states().find(static_cast<wxWindow*>(event.GetEventObject()));
+    if (it != batch_states().end())
+        it->second.drawn.clear();
+}
+
+void
+on_grid_window_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    if (event.GetEventObject() == event.GetWindow())
+        batch_states().erase(event.GetWindow());
+}
+
+// State of the grid window `window`, hooking its paint and destruction on first use.
+WindowBatchState&
+batch_state(wxWindow* window)
+{
+    auto it = batch_states().find(window);
+    if (it != batch_states().end())
+        return it->second;
+    window->Bind(wxEVT_PAINT, on_grid_window_paint);
+    window->Bind(wxEVT_DESTROY, on_grid_window_destroy);
+    return batch_states()[window];
+}
+
+// wxGridCellRenderer drawing through Rust callbacks. With a batch callback, the first cell of a
+// column painted in a grid window draws every visible cell of that column that uses this
+// renderer in one call; the grid's later Draw calls for those cells return at once.
+class WxdCallbackGridCellRenderer : public wxGridCellRenderer {
+public:
+    explicit WxdCallbackGridCellRenderer(std::shared_ptr<RendererCallbacks> callbacks)
+        : m_callbacks(std::move(callbacks))
+    {
+    }
+
+    void
+    Draw(wxGrid& grid, wxGridCellAttr& attr, wxDC& dc, const wxRect& rect, int row, int col,
+         bool isSelected) override
+    {
+        const wxd_GridCellRenderer_Callbacks& fns = m_callbacks->fns;
+        wxWindow* window = dc.GetWindow();
+        if (fns.draw_batch && window) {
+            WindowBatchState& state = batch_state(window);
+            std::unordered_set<int>& drawn = state.drawn[col];
+            if (drawn.erase(row))
+                return;
+            DrawBatch(grid, dc, *window, rect, row, col, drawn);
+            return;
+        }
+        wxGridCellRenderer::Draw(grid, attr, dc, rect, row, col, isSelected);
+        if (fns.draw) {
+            fns.draw(fns.userdata, reinterpret_cast<wxd_DC_t*>(&dc), row, col,
+                     wxd_Rect{ rect.x, rect.y, rect.width, rect.height }, isSelected);
+        }
+        else if (fns.draw_batch) {
+            const int32_t rows[] = { row };
+            const wxd_Rect rects[] = { { rect.x, rect.y, rect.width, rect.height } };
+            const uint8_t selected[] = { isSelected };
+            const wxd_GridRenderBatch batch{ col, 1, rows, rects, selected };
+            fns.draw_batch(fns.userdata, reinterpret_cast<wxd_DC_t*>(&dc), &batch);
+        }
+    }
+
+    wxSize
+    GetBestSize(wxGrid& grid, wxGridCellAttr& attr, wxDC& dc, int row, int col) override
+    {
+        const wxd_GridCellRenderer_Callbacks& fns = m_callbacks->fns;
+        if (fns.get_best_size) {
+            dc.SetFont(attr.GetFont());
+            const wxd_Size size =
+                fns.get_best_size(fns.userdata, reinterpret_cast<wxd_DC_t*>(&dc), row, col);
+            if (size.width >= 0 && size.height >= 0)
+                return wxSize(size.width, size.height);
+        }
+        return wxSize(grid.GetColSize(col), grid.GetRowSize(row));
+    }
+
+    wxGridCellRenderer*
+    Clone() const override
+    {
+        return new WxdCallbackGridCellRenderer(m_callbacks);
+    }
+
+private:
+    bool
+    UsesThisRenderer(wxGrid& grid, int row, int col) const
+    {
+        wxGridCellAttrPtr attr = grid.GetCellAttrPtr(row, col);
+        wxGridCellRendererPtr renderer = attr->GetRendererPtr(&grid, row, col);
+        auto* ours = dynamic_cast<WxdCallbackGridCellRenderer*>(renderer.get());
+        return ours && ours->m_callbacks == m_callbacks;
+    }
+
+    // Draws every visible cell of `col` inside the DC's clipping box that uses this renderer,
+    // backgrounds natively and contents in one callback, and records them in `drawn`.
+    void
+    DrawBatch(wxGrid& grid, wxDC& dc, wxWindow& window, const wxRect& rect, int row, int col,
+              std::unordered_set<int>& drawn)
+    {
+        // `rect` is CellToRect(row, col) in this window's logical coordinates; the difference
+        // maps grid positions into them whatever the scrolling or frozen area.
+        const wxRect anchor = grid.CellToRect(row, col);
+        const int dy = rect.y - anchor.y;
+        wxRect box;
+        dc.GetClippingBox(box);
+        if (box.IsEmpty())
+            box = wxRect(wxPoint(dc.DeviceToLogicalX(0), dc.DeviceToLogicalY(0)),
+                         window.GetClientSize());
+        const int first = grid.YToRow(box.GetTop() - dy, true);
+        const int last = grid.YToRow(box.GetBottom() - dy, true);
+        if (first == wxNOT_FOUND || last == wxNOT_FOUND)
+            return;
+
+        m_rows.clear();
+        m_rects.clear();
+        m_selected.clear();
+        const int last_pos = grid.GetRowPos(last);
+        for (int pos = std::min(grid.GetRowPos(first), last_pos); pos <= last_pos; ++pos) {
+            const int r = grid.GetRowAt(pos);
+            if (grid.GetRowSize(r) <= 0)
+                continue;
+            int row_span = 1;
+            int col_span = 1;
+            if (grid.GetCellSize(r, col, &row_span, &col_span) == wxGrid::CellSpan_Inside)
+                continue;
+            if (r != row && !UsesThisRenderer(grid, r, col))
+                continue;
+            wxRect cell = grid.CellToRect(r, col);
+            cell.x = rect.x;
+            cell.y += dy;
+            const bool selected = grid.IsInSelection(r, col);
+            wxGridCellAttrPtr attr = grid.GetCellAttrPtr(r, col);
+            wxGridCellRenderer::Draw(grid, *attr, dc, cell, r, col, selected);
+            m_rows.push_back(r);
+            m_rects.push_back(wxd_Rect{ cell.x, cell.y, cell.width, cell.height });
+            m_selected.push_back(selected);
+            if (r != row)
+                drawn.insert(r);
+        }
+        if (m_rows.empty())
+            return;
+        const wxd_GridRenderBatch batch{ col, m_rows.size(), m_rows.data(), m_rects.data(),
+                                         m_selected.data() };
+        const wxd_GridCellRenderer_Callbacks& fns = m_callbacks->fns;
+        fns.draw_batch(fns.userdata, reinterpret_cast<wxd_DC_t*>(&dc), &batch);
+    }
+
+    std::shared_ptr<RendererCallbacks> m_callbacks;
+    // Reused between batches.
+    std::vector<int32_t> m_rows;
+    std::vector<wxd_Rect> m_rects;
+    std::vector<uint8_t> m_selected;
+};
+
+wxGridCellRenderer*
+unwrap(wxd_GridCellRenderer_t* renderer)
+{
+    return reinterpret_cast<wxGridCellRenderer*>(renderer);
+}
+
+} // namespace
+
+extern "C" {
+
+WXD_EXPORTED wxd_GridCellRenderer_t*
+wxd_GridCellRenderer_Create(const wxd_GridCellRenderer_Callbacks* callbacks)
+{
+    if (!callbacks)
+        return nullptr;
+    if (!callbacks->draw && !callbacks->draw_batch) {
+        if (callbacks->userdata_free)
+            callbacks->userdata_free(callbacks->userdata);
+        return nullptr;
+    }
+    auto shared = std::make_shared<RendererCallbacks>();
+    shared->fns = *callbacks;
+    return reinterpret_cast<wxd_GridCellRenderer_t*>(new WxdCallbackGridCellRenderer(shared));
+}
+
+WXD_EXPORTED void
+wxd_GridCellRenderer_DecRef(wxd_GridCellRenderer_t* renderer)
+{
+    if (renderer)
+        unwrap(renderer)->DecRef();
+}
+
+WXD_EXPORTED void
+wxd_Grid_SetColRenderer(wxd_Grid_t* self, int col, wxd_GridCellRenderer_t* renderer)
+{
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    if (!grid || !renderer || !grid->GetTable())
+        return;
+    // As wxGrid::SetColFormatCustom: keep the column's other attributes.
+    wxGridCellAttr* attr = grid->GetTable()->GetAttr(-1, col, wxGridCellAttr::Col);
+    if (!attr)
+        attr = new wxGridCellAttr;
+    unwrap(renderer)->IncRef();
+    attr->SetRenderer(unwrap(renderer));
+    grid->SetColAttr(col, attr);
+}
+
+WXD_EXPORTED void
+wxd_Grid_SetCellRenderer(wxd_Grid_t* self, int row, int col, wxd_GridCellRenderer_t* renderer)
+{
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    if (!grid || !renderer)
+        return;
+    unwrap(renderer)->IncRef();
+    grid->SetCellRenderer(row, col, unwrap(renderer));
+}
+
+WXD_EXPORTED void
+wxd_Grid_RegisterRendererType(wxd_Grid_t* self, const char* typeName,
+                              wxd_GridCellRenderer_t* renderer)
+{
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    if (!grid || !typeName || !renderer)
+        return;
+    unwrap(renderer)->IncRef();
+    grid->RegisterDataType(wxString::FromUTF8(typeName), unwrap(renderer),
+                           new wxGridCellTextEditor);
+}
+
+} // extern "C"
@@ -0,0 +1,196 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include <wx/grid.h>
+#include "../include/wxdragon.h"
+#include "wxd_grid_session.h"
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+struct DirtyBlock {
+    int top;
+    int left;
+    int bottom;
+    int right;
+};
+
+struct Session {
+    int depth = 0;
+    std::vector<DirtyBlock> blocks;
+};
+
+// Past this many rects a single bounding rect is cheaper than walking the list.
+constexpr size_t kMaxRects = 256;
+
+// Sessions are only ever touched from the GUI thread.
+std::unordered_map<wxGrid*, Session>&
+sessions()
+{
+    static std::unordered_map<wxGrid*, Session> map;
+    return map;
+}
+
+void
+on_grid_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    if (wxGrid* grid = wxDynamicCast(event.GetEventObject(), wxGrid)) {
+        sessions().erase(grid);
+    }
+}
+
+int64_t
+area(const wxRect& rect)
+{
+    return static_cast<int64_t>(rect.width) * rect.height;
+}
+
+// Merges rects whose bounding box costs no more pixels than painting them separately, which
+// joins adjacent cells in a row and then adjacent row runs of the same width.
+void
+coalesce(std::vector<wxRect>& rects)
+{
+    for (int pass = 0; pass < 2; ++pass) {
+        if (pass == 0) {
+            std::sort(rects.begin(), rects.end(), [](const wxRect& a, const wxRect& b) {
+                return a.y != b.y ? a.y < b.y : a.x < b.x;
+            });
+        } else {
+            std::sort(rects.begin(), rects.end(), [](const wxRect& a, const wxRect& b) {
+                return a.x != b.x ? a.x < b.x : a.y < b.y;
+            });
+        }
+        std::vector<wxRect> out;
+        out.reserve(rects.size());
+        for (const wxRect& rect : rects) {
+            if (!out.empty()) {
+                wxRect joined = out.back();
+                joined.Union(rect);
+                if (area(joined) <= area(out.back()) + area(rect)) {
+                    out.back() = joined;
+                    continue;
+                }
+            }
+            out.push_back(rect);
+        }
+        rects.swap(out);
+    }
+}
+
+uint64_t
+flush(wxGrid* grid, const std::vector<DirtyBlock>& blocks)
+{
+    const int num_rows = grid->GetNumberRows();
+    const int num_cols = grid->GetNumberCols();
+    const bool frozen = grid->GetNumberFrozenRows() > 0 || grid->GetNumberFrozenCols() > 0;
+    wxWindow* window = grid->GetGridWindow();
+    const wxRect visible(window->GetClientSize());
+
+    uint64_t pixels = 0;
+    std::vector<wxRect> rects;
+    rects.reserve(blocks.size());
+    for (const DirtyBlock& block : blocks) {
+        const int top = std::max(block.top, 0);
+        const int left = std::max(block.left, 0);
+        const int bottom = std::min(block.bottom, num_rows - 1);
+        const int right = std::min(block.right, num_cols - 1);
+        if (top > bottom || left > right)
+            continue;
+        const wxGridCellCoords top_left(top, left);
+        const wxGridCellCoords bottom_right(bottom, right);
+        if (frozen) {
+            // Frozen panes are separate windows; let wxGrid pick the right ones. The block is
+            // counted whole, as wxGrid clips it per pane.
+            grid->RefreshBlock(top_left, bottom_right);
+            const wxRect rect = grid->CellToRect(top_left).Union(grid->CellToRect(bottom_right));
+            pixels += static_cast<uint64_t>(area(rect));
+            continue;
+        }
+        const wxRect rect = grid->BlockToDeviceRect(top_left, bottom_right).Intersect(visible);
+        if (!rect.IsEmpty())
+            rects.push_back(rect);
+    }
+
+    coalesce(rects);
+    if (rects.size() > kMaxRects) {
+        wxRect bounds = rects.front();
+        for (const wxRect& rect : rects) {
+            bounds.Union(rect);
+        }
+        rects.assign(1, bounds);
+    }
+
+    for (const wxRect& rect : rects) {
+        window->RefreshRect(rect, false);
+        pixels += static_cast<uint64_t>(area(rect));
+    }
+    return pixels;
+}
+
+} // namespace
+
+namespace wxd_grid_session {
+
+bool
+mark(wxGrid* grid, int top, int left, int bottom, int right)
+{
+    auto& map = sessions();
+    auto it = map.find(grid);
+    if (it == map.end())
+        return false;
+    if (top <= bottom && left <= right)
+        it->second.blocks.push_back(DirtyBlock{top, left, bottom, right});
+    return true;
+}
+
+void
+refresh_block(wxGrid* grid, int top, int left, int bottom, int right)
+{
+    if (mark(grid, top, left, bottom, right) || top > bottom || left > right)
+        return;
+    grid->RefreshBlock(wxGridCellCoords(top, left), wxGridCellCoords(bottom, right));
+}
+
+} // namespace wxd_grid_session
+
+WXD_EXPORTED void
+wxd_Grid_BeginUpdateSession(wxd_Grid_t* self)
+{
+    if (!self)
+        return;
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    Session& session = sessions()[grid];
+    if (session.depth++ == 0)
+        grid->Bind(wxEVT_DESTROY, on_grid_destroy);
+}
+
+WXD_EXPORTED void
+wxd_Grid_MarkDirtyBlock(wxd_Grid_t* self, int topRow, int leftCol, int numRows, int numCols)
+{
+    if (!self || numRows <= 0 || numCols <= 0)
+        return;
+    wxd_grid_session::refresh_block(reinterpret_cast<wxGrid*>(self), topRow, leftCol,
+                                    topRow + numRows - 1, leftCol + numCols - 1);
+}
+
+WXD_EXPORTED uint64_t
+wxd_Grid_EndUpdateSession(wxd_Grid_t* self)
+{
+    if (!self)
+        return 0;
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    auto& map = sessions();
+    auto it = map.find(grid);
+    if (it == map.end())
+        return 0;
+    if (--it->second.depth > 0)
+        return 0;
+
+    std::vector<DirtyBlock> blocks;
+    blocks.swap(it->second.blocks);
+    map.erase(it);
+    grid->Unbind(wxEVT_DESTROY, on_grid_destroy);
+    return flush(grid, blocks);
+}
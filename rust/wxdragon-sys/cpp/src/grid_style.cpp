@@ -0,0 +1,388 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include <wx/grid.h>
+#include "../include/wxdragon.h"
+#include "../src/wxd_utils.h"
+#include "../src/wxd_grid_session.h"
+#include <algorithm>
+#include <vector>
+
+// Attribute provider that adds a palette of shared wxGridCellAttr objects on top of the regular
+// per-cell storage. Each row keeps a sorted list of non-overlapping column runs pointing into
+// the palette, so styling a whole heat map costs one attr per style plus a few runs per row,
+// and lookup during paint is a binary search.
+class WxdPaletteAttrProvider : public wxGridCellAttrProvider {
+public:
+    struct Run {
+        int first;
+        int last;
+        int style;
+    };
+
+    ~WxdPaletteAttrProvider()
+    {
+        ClearPalette();
+    }
+
+    int
+    AddStyle(wxGridCellAttr* attr)
+    {
+        m_palette.push_back(attr);
+        return static_cast<int>(m_palette.size()) - 1;
+    }
+
+    wxGridCellAttr*
+    GetStyle(int style) const
+    {
+        if (style < 0 || style >= static_cast<int>(m_palette.size()))
+            return nullptr;
+        return m_palette[style];
+    }
+
+    bool
+    IsValidStyle(int style) const
+    {
+        return style == -1 || GetStyle(style) != nullptr;
+    }
+
+    void
+    ClearPalette()
+    {
+        for (wxGridCellAttr* attr : m_palette) {
+            attr->DecRef();
+        }
+        m_palette.clear();
+        m_rows.clear();
+    }
+
+    // Replaces the styles of columns [first, last] in `row` with `runs`, which must be sorted,
+    // lie inside that range and not reference style -1.
+    void
+    AssignRuns(int row, int first, int last, const std::vector<Run>& runs)
+    {
+        if (row >= static_cast<int>(m_rows.size())) {
+            if (runs.empty())
+                return;
+            m_rows.resize(row + 1);
+        }
+        std::vector<Run>& existing = m_rows[row];
+        std::vector<Run> out;
+        out.reserve(existing.size() + runs.size() + 1);
+        size_t i = 0;
+        // Runs entirely before the range, and the head of one that crosses its start.
+        for (; i < existing.size() && existing[i].first < first; ++i) {
+            Run head = existing[i];
+            if (head.last >= first) {
+                Run tail = head;
+                head.last = first - 1;
+                if (tail.last > last) {
+                    tail.first = last + 1;
+                    out.push_back(head);
+                    AppendRuns(out, runs);
+                    out.push_back(tail);
+                    out.insert(out.end(), existing.begin() + i + 1, existing.end());
+                    existing.swap(out);
+                    return;
+                }
+            }
+            out.push_back(head);
+        }
+        AppendRuns(out, runs);
+        // Skip runs covered by the range, keeping the tail of one that crosses its end.
+        for (; i < existing.size() && existing[i].first <= last; ++i) {
+            if (existing[i].last > last) {
+                Run tail = existing[i];
+                tail.first = last + 1;
+                Append(out, tail);
+            }
+        }
+        for (; i < existing.size(); ++i) {
+            Append(out, existing[i]);
+        }
+        existing.swap(out);
+    }
+
+    wxGridCellAttr*
+    GetAttr(int row, int col, wxGridCellAttr::wxAttrKind kind) const override
+    {
+        wxGridCellAttr* attr = wxGridCellAttrProvider::GetAttr(row, col, kind);
+        if (kind != wxGridCellAttr::Any && kind != wxGridCellAttr::Cell)
+            return attr;
+
+        wxGridCellAttr* style = Lookup(row, col);
+        if (!style)
+            return attr;
+        if (!attr) {
+            style->IncRef();
+            return style;
+        }
+        // Explicit per-cell attributes win; only the rare cell that has both gets a new attr.
+        wxGridCellAttr* merged = attr->Clone();
+        attr->DecRef();
+        merged->MergeWith(style);
+        return merged;
+    }
+
+    void
+    UpdateAttrRows(size_t pos, int numRows) override
+    {
+        wxGridCellAttrProvider::UpdateAttrRows(pos, numRows);
+        if (pos >= m_rows.size())
+            return;
+        if (numRows > 0) {
+            m_rows.insert(m_rows.begin() + pos, static_cast<size_t>(numRows), std::vector<Run>());
+        } else if (numRows < 0) {
+            const size_t count = std::min(static_cast<size_t>(-numRows), m_rows.size() - pos);
+            m_rows.erase(m_rows.begin() + pos, m_rows.begin() + pos + count);
+        }
+    }
+
+    void
+    UpdateAttrCols(size_t pos, int numCols) override
+    {
+        wxGridCellAttrProvider::UpdateAttrCols(pos, numCols);
+        if (numCols == 0)
+            return;
+        const int at = static_cast<int>(pos);
+        for (std::vector<Run>& runs : m_rows) {
+            if (numCols < 0)
+                EraseCols(runs, at, at - numCols - 1);
+            std::vector<Run> shifted;
+            shifted.reserve(runs.size() + 1);
+            for (Run run : runs) {
+                if (run.last < at) {
+                    shifted.push_back(run);
+                } else if (numCols > 0 && run.first < at) {
+                    // Inserted columns split the run and start out unstyled.
+                    Run tail = run;
+                    run.last = at - 1;
+                    tail.first = at + numCols;
+                    tail.last += numCols;
+                    shifted.push_back(run);
+                    shifted.push_back(tail);
+                } else {
+                    run.first += numCols;
+                    run.last += numCols;
+                    Append(shifted, run);
+                }
+            }
+            runs.swap(shifted);
+        }
+    }
+
+private:
+    static void
+    Append(std::vector<Run>& runs, const Run& run)
+    {
+        if (!runs.empty() && runs.back().style == run.style && runs.back().last + 1 == run.first) {
+            runs.back().last = run.last;
+        } else {
+            runs.push_back(run);
+        }
+    }
+
+    static void
+    AppendRuns(std::vector<Run>& out, const std::vector<Run>& runs)
+    {
+        for (const Run& run : runs) {
+            Append(out, run);
+        }
+    }
+
+    // Drops columns [first, last] from one row's runs.
+    static void
+    EraseCols(std::vector<Run>& runs, int first, int last)
+    {
+        std::vector<Run> out;
+        out.reserve(runs.size() + 1);
+        for (const Run& run : runs) {
+            if (run.last < first || run.first > last) {
+                out.push_back(run);
+                continue;
+            }
+            if (run.first < first)
+                out.push_back(Run{run.first, first - 1, run.style});
+            if (run.last > last)
+                out.push_back(Run{last + 1, run.last, run.style});
+        }
+        runs.swap(out);
+    }
+
+    wxGridCellAttr*
+    Lookup(int row, int col) const
+    {
+        if (row < 0 || row >= static_cast<int>(m_rows.size()))
+            return nullptr;
+        const std::vector<Run>& runs = m_rows[row];
+        auto it = std::upper_bound(runs.begin(), runs.end(), col,
+                                   [](int c, const Run& run) { return c < run.first; });
+        if (it == runs.begin())
+            return nullptr;
+        --it;
+        return col <= it->last ? GetStyle(it->style) : nullptr;
+    }
+
+    std::vector<wxGridCellAttr*> m_palette;
+    std::vector<std::vector<Run>> m_rows;
+};
+
+namespace {
+
+// Returns the palette provider of the grid's table, installing it on first use when `create`.
+// wxGridTableBase deletes the provider it replaces, so a table that already has another provider
+// (the default one appears as soon as a per-cell attribute is set) gets no palette rather than
+// losing the attributes stored there.
+WxdPaletteAttrProvider*
+palette_provider(wxGrid* grid, bool create)
+{
+    wxGridTableBase* table = grid->GetTable();
+    if (!table) {
+        return nullptr;
+    }
+    wxGridCellAttrProvider* current = table->GetAttrProvider();
+    auto* provider = dynamic_cast<WxdPaletteAttrProvider*>(current);
+    if (!provider && create && !current) {
+        provider = new WxdPaletteAttrProvider();
+        table->SetAttrProvider(provider);
+    }
+    return provider;
+}
+
+// wxGrid caches the most recently looked-up attribute. ClearAttrCache is protected, so reach it
+// through a derived class; RefreshAttr would only drop the cache for one known cell.
+struct GridAttrCache : wxGrid {
+    static void
+    Clear(wxGrid* grid)
+    {
+        (grid->*&GridAttrCache::ClearAttrCache)();
+    }
+};
+
+void
+refresh_styled_block(wxGrid* grid, int top, int left, int bottom, int right)
+{
+    GridAttrCache::Clear(grid);
+    wxd_grid_session::refresh_block(grid, top, left, bottom, right);
+}
+
+} // namespace
+
+WXD_EXPORTED int
+wxd_Grid_AddStyle(wxd_Grid_t* self, const wxd_GridCellAttrDesc* style)
+{
+    if (!self || !style)
+        return -1;
+    WxdPaletteAttrProvider* provider = palette_provider(reinterpret_cast<wxGrid*>(self), true);
+    if (!provider)
+        return -1;
+
+    wxGridCellAttr* attr = new wxGridCellAttr();
+    if (style->has_text_colour) {
+        attr->SetTextColour(wxColour(style->text_colour.r, style->text_colour.g,
+                                     style->text_colour.b, style->text_colour.a));
+    }
+    if (style->has_bg_colour) {
+        attr->SetBackgroundColour(wxColour(style->bg_colour.r, style->bg_colour.g,
+                                           style->bg_colour.b, style->bg_colour.a));
+    }
+    if (style->has_alignment) {
+        attr->SetAlignment(style->horiz_align, style->vert_align);
+    }
+    if (style->read_only) {
+        attr->SetReadOnly(true);
+    }
+    return provider->AddStyle(attr);
+}
+
+WXD_EXPORTED bool
+wxd_Grid_SetStyleFont(wxd_Grid_t* self, int style, const wxd_Font_t* font)
+{
+    if (!self || !font)
+        return false;
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    WxdPaletteAttrProvider* provider = palette_provider(grid, false);
+    wxGridCellAttr* attr = provider ? provider->GetStyle(style) : nullptr;
+    if (!attr)
+        return false;
+    attr->SetFont(*reinterpret_cast<const wxFont*>(font));
+    GridAttrCache::Clear(grid);
+    grid->ForceRefresh();
+    return true;
+}
+
+WXD_EXPORTED bool
+wxd_Grid_SetCellStyles(wxd_Grid_t* self, int row, int firstCol, const int32_t* styles,
+                       size_t count)
+{
+    if (!self || (count > 0 && !styles))
+        return false;
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    if (row < 0 || row >= grid->GetNumberRows() || firstCol < 0 ||
+        static_cast<size_t>(firstCol) + count > static_cast<size_t>(grid->GetNumberCols()))
+        return false;
+    if (count == 0)
+        return true;
+    WxdPaletteAttrProvider* provider = palette_provider(grid, true);
+    if (!provider)
+        return false;
+
+    std::vector<WxdPaletteAttrProvider::Run> runs;
+    for (size_t i = 0; i < count; ++i) {
+        if (!provider->IsValidStyle(styles[i]))
+            return false;
+        const int col = firstCol + static_cast<int>(i);
+        if (styles[i] < 0)
+            continue;
+        if (!runs.empty() && runs.back().style == styles[i] && runs.back().last + 1 == col) {
+            runs.back().last = col;
+        } else {
+            runs.push_back({col, col, styles[i]});
+        }
+    }
+    const int lastCol = firstCol + static_cast<int>(count) - 1;
+    provider->AssignRuns(row, firstCol, lastCol, runs);
+    refresh_styled_block(grid, row, firstCol, row, lastCol);
+    return true;
+}
+
+WXD_EXPORTED bool
+wxd_Grid_SetBlockStyle(wxd_Grid_t* self, int topRow, int leftCol, int numRows, int numCols,
+                       int style)
+{
+    if (!self)
+        return false;
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    if (topRow < 0 || leftCol < 0 || numRows < 0 || numCols < 0 ||
+        topRow + numRows > grid->GetNumberRows() || leftCol + numCols > grid->GetNumberCols())
+        return false;
+    WxdPaletteAttrProvider* provider = palette_provider(grid, true);
+    if (!provider || !provider->IsValidStyle(style))
+        return false;
+    if (numRows == 0 || numCols == 0)
+        return true;
+
+    const int bottom = topRow + numRows - 1;
+    const int right = leftCol + numCols - 1;
+    std::vector<WxdPaletteAttrProvider::Run> runs;
+    if (style >= 0)
+        runs.push_back({leftCol, right, style});
+    for (int row = topRow; row <= bottom; ++row) {
+        provider->AssignRuns(row, leftCol, right, runs);
+    }
+    refresh_styled_block(grid, topRow, leftCol, bottom, right);
+    return true;
+}
+
+WXD_EXPORTED void
+wxd_Grid_ClearStyles(wxd_Grid_t* self)
+{
+    if (!self)
+        return;
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    WxdPaletteAttrProvider* provider = palette_provider(grid, false);
+    if (!provider)
+        return;
+    provider->ClearPalette();
+    GridAttrCache::Clear(grid);
+    grid->ForceRefresh();
+}
@@ -0,0 +1,721 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include <wx/grid.h>
+#include "../include/wxdragon.h"
+#include "../src/wxd_utils.h"
+#include "../src/wxd_grid_autosize.h"
+#include "../src/wxd_grid_session.h"
+#include <algorithm>
+#include <climits>
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+// wxGridTableBase reads numbers as long, which is 32 bits on Windows. Values outside its range
+// are clamped rather than wrapped there; the text form from GetValue() keeps all 64 bits.
+long
+clamp_to_long(int64_t value)
+{
+    if (value > LONG_MAX) {
+        return LONG_MAX;
+    }
+    if (value < LONG_MIN) {
+        return LONG_MIN;
+    }
+    return static_cast<long>(value);
+}
+
+} // namespace
+
+// wxGridTableBase subclass that forwards every query to caller-supplied callbacks, so cell data
+// stays on the Rust side and only visible cells are ever converted.
+class WxdGridTable : public wxGridTableBase {
+public:
+    explicit WxdGridTable(const wxd_GridTable_Callbacks& callbacks) : m_cb(callbacks)
+    {
+        WXD_LOG_TRACEF("WxdGridTable created with pointer %p", this);
+    }
+
+    ~WxdGridTable()
+    {
+        WXD_LOG_TRACEF("WxdGridTable destroyed with pointer %p", this);
+        ClearShared();
+        if (m_cb.userdata_free && m_cb.userdata) {
+            m_cb.userdata_free(m_cb.userdata);
+        }
+    }
+
+    int
+    GetNumberRows() override
+    {
+        return m_cb.get_number_rows(m_cb.userdata);
+    }
+
+    int
+    GetNumberCols() override
+    {
+        return m_cb.get_number_cols(m_cb.userdata);
+    }
+
+    wxString
+    GetValue(int row, int col) override
+    {
+        size_t len = 0;
+        const char* value = m_cb.get_value(m_cb.userdata, row, col, &len);
+        return value ? wxString::FromUTF8(value, len) : wxString();
+    }
+
+    void
+    SetValue(int row, int col, const wxString& value) override
+    {
+        if (!m_cb.set_value)
+            return;
+        wxScopedCharBuffer utf8 = value.utf8_str();
+        m_cb.set_value(m_cb.userdata, row, col, utf8.data(), utf8.length());
+    }
+
+    wxString
+    GetTypeName(int row, int col) override
+    {
+        if (!m_cb.get_type)
+            return wxGRID_VALUE_STRING;
+        switch (m_cb.get_type(m_cb.userdata, row, col)) {
+            case WXD_GRID_VALUE_BOOL:
+                return wxGRID_VALUE_BOOL;
+            case WXD_GRID_VALUE_NUMBER:
+                return wxGRID_VALUE_NUMBER;
+            case WXD_GRID_VALUE_FLOAT:
+                return wxGRID_VALUE_FLOAT;
+            default:
+                return wxGRID_VALUE_STRING;
+        }
+    }
+
+    bool
+    CanGetValueAs(int row, int col, const wxString& typeName) override
+    {
+        if (typeName == wxGRID_VALUE_STRING)
+            return true;
+        if (typeName == wxGRID_VALUE_NUMBER && !m_cb.get_value_as_long)
+            return false;
+        if (typeName == wxGRID_VALUE_FLOAT && !m_cb.get_value_as_double)
+            return false;
+        if (typeName == wxGRID_VALUE_BOOL && !m_cb.get_value_as_bool)
+            return false;
+        return typeName == GetTypeName(row, col);
+    }
+
+    bool
+    CanSetValueAs(int WXUNUSED(row), int WXUNUSED(col), const wxString& typeName) override
+    {
+        // Typed editors fall back to SetValue() with the text form.
+        return typeName == wxGRID_VALUE_STRING;
+    }
+
+    long
+    GetValueAsLong(int row, int col) override
+    {
+        if (!m_cb.get_value_as_long)
+            return 0;
+        return clamp_to_long(m_cb.get_value_as_long(m_cb.userdata, row, col));
+    }
+
+    double
+    GetValueAsDouble(int row, int col) override
+    {
+        return m_cb.get_value_as_double ? m_cb.get_value_as_double(m_cb.userdata, row, col) : 0.0;
+    }
+
+    bool
+    GetValueAsBool(int row, int col) override
+    {
+        return m_cb.get_value_as_bool ? m_cb.get_value_as_bool(m_cb.userdata, row, col) : false;
+    }
+
+    wxGridCellAttr*
+    GetAttr(int row, int col, wxGridCellAttr::wxAttrKind kind) override
+    {
+        // Attributes set through the wxd_Grid_SetCell* API still come from the provider. Only
+        // lookups for drawing (Any) see get_attr; wxGrid's setters ask for the Cell attr and
+        // modify it in place.
+        wxGridCellAttr* attr = wxGridTableBase::GetAttr(row, col, kind);
+        if (!m_cb.get_attr || kind != wxGridCellAttr::Any)
+            return attr;
+
+        wxd_GridCellAttrDesc desc = {};
+        if (!m_cb.get_attr(m_cb.userdata, row, col, &desc))
+            return attr;
+
+        if (!attr) {
+            wxGridCellAttr* shared = SharedAttr(desc);
+            shared->IncRef();
+            return shared;
+        }
+        // Never modify the provider's shared instance; only cells that also have provider
+        // attributes pay for a copy.
+        wxGridCellAttr* merged = attr->Clone();
+        attr->DecRef();
+        ApplyDesc(merged, desc);
+        return merged;
+    }
+
+private:
+    // Description fields that are set, with unset ones zeroed.
+    using AttrKey = std::tuple<uint32_t, uint32_t, int, int, uint8_t>;
+
+    static uint32_t
+    PackColour(const wxd_Colour_t& colour)
+    {
+        return static_cast<uint32_t>(colour.r) << 24 | static_cast<uint32_t>(colour.g) << 16 |
+               static_cast<uint32_t>(colour.b) << 8 | colour.a;
+    }
+
+    static void
+    ApplyDesc(wxGridCellAttr* attr, const wxd_GridCellAttrDesc& desc)
+    {
+        if (desc.has_text_colour) {
+            attr->SetTextColour(wxColour(desc.text_colour.r, desc.text_colour.g,
+                                         desc.text_colour.b, desc.text_colour.a));
+        }
+        if (desc.has_bg_colour) {
+            attr->SetBackgroundColour(wxColour(desc.bg_colour.r, desc.bg_colour.g,
+                                               desc.bg_colour.b, desc.bg_colour.a));
+        }
+        if (desc.has_alignment) {
+            attr->SetAlignment(desc.horiz_align, desc.vert_align);
+        }
+        if (desc.read_only) {
+            attr->SetReadOnly(true);
+        }
+    }
+
+    // One attr per distinct description, so cells that look alike share it and painting does
+    // not allocate.
+    wxGridCellAttr*
+    SharedAttr(const wxd_GridCellAttrDesc& desc)
+    {
+        const AttrKey key(desc.has_text_colour ? PackColour(desc.text_colour) : 0,
+                          desc.has_bg_colour ? PackColour(desc.bg_colour) : 0,
+                          desc.has_alignment ? desc.horiz_align : -1,
+                          desc.has_alignment ? desc.vert_align : -1,
+                          static_cast<uint8_t>(desc.has_text_colour | desc.has_bg_colour << 1 |
+                                               desc.read_only << 2));
+        auto it = m_shared.find(key);
+        if (it != m_shared.end()) {
+            return it->second;
+        }
+        if (m_shared.size() >= kMaxSharedAttrs) {
+            ClearShared();
+        }
+        wxGridCellAttr* attr = new wxGridCellAttr();
+        ApplyDesc(attr, desc);
+        m_shared.emplace(key, attr);
+        return attr;
+    }
+
+    void
+    ClearShared()
+    {
+        for (auto& entry : m_shared) {
+            entry.second->DecRef();
+        }
+        m_shared.clear();
+    }
+
+    // Bound on shared attrs, for tables that compute a distinct colour per cell.
+    static constexpr size_t kMaxSharedAttrs = 1024;
+
+    wxd_GridTable_Callbacks m_cb;
+    std::map<AttrKey, wxGridCellAttr*> m_shared;
+};
+
+WXD_EXPORTED bool
+wxd_Grid_SetTable(wxd_Grid_t* self, const wxd_GridTable_Callbacks* callbacks, int selectionMode)
+{
+    if (!callbacks)
+        return false;
+    if (!self || !callbacks->get_number_rows || !callbacks->get_number_cols ||
+        !callbacks->get_value) {
+        if (callbacks->userdata_free && callbacks->userdata) {
+            callbacks->userdata_free(callbacks->userdata);
+        }
+        return false;
+    }
+
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    WxdGridTable* table = new WxdGridTable(*callbacks);
+    if (!grid->SetTable(table, true,
+                        static_cast<wxGrid::wxGridSelectionModes>(selectionMode))) {
+        delete table; // Not adopted by the grid; frees the userdata
+        return false;
+    }
+    return true;
+}
+
+namespace {
+
+void
+send_table_message(wxd_Grid_t* self, int id, int arg1, int arg2)
+{
+    if (!self)
+        return;
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    wxGridTableBase* table = grid->GetTable();
+    if (!table)
+        return;
+    wxGridTableMessage msg(table, id, arg1, arg2);
+    grid->ProcessTableMessage(msg);
+}
+
+} // namespace
+
+WXD_EXPORTED void
+wxd_Grid_NotifyTableRowsInserted(wxd_Grid_t* self, int pos, int numRows)
+{
+    send_table_message(self, wxGRIDTABLE_NOTIFY_ROWS_INSERTED, pos, numRows);
+    if (self) {
+        wxd_grid_autosize::rows_moved(reinterpret_cast<wxGrid*>(self), pos, numRows);
+    }
+}
+
+WXD_EXPORTED void
+wxd_Grid_NotifyTableRowsAppended(wxd_Grid_t* self, int numRows)
+{
+    send_table_message(self, wxGRIDTABLE_NOTIFY_ROWS_APPENDED, numRows, 0);
+}
+
+WXD_EXPORTED void
+wxd_Grid_NotifyTableRowsDeleted(wxd_Grid_t* self, int pos, int numRows)
+{
+    send_table_message(self, wxGRIDTABLE_NOTIFY_ROWS_DELETED, pos, numRows);
+    if (self) {
+        wxd_grid_autosize::rows_moved(reinterpret_cast<wxGrid*>(self), pos, -numRows);
+    }
+}
+
+WXD_EXPORTED void
+wxd_Grid_NotifyTableColsInserted(wxd_Grid_t* self, int pos, int numCols)
+{
+    send_table_message(self, wxGRIDTABLE_NOTIFY_COLS_INSERTED, pos, numCols);
+}
+
+WXD_EXPORTED void
+wxd_Grid_NotifyTableColsAppended(wxd_Grid_t* self, int numCols)
+{
+    send_table_message(self, wxGRIDTABLE_NOTIFY_COLS_APPENDED, numCols, 0);
+}
+
+WXD_EXPORTED void
+wxd_Grid_NotifyTableColsDeleted(wxd_Grid_t* self, int pos, int numCols)
+{
+    send_table_message(self, wxGRIDTABLE_NOTIFY_COLS_DELETED, pos, numCols);
+}
+
+// Columnar table: one contiguous typed array per column. Typed renderers and editors go through
+// GetValueAs*/SetValueAs*, so numbers are never stored as text.
+class WxdColumnarGridTable : public wxGridTableBase {
+public:
+    WxdColumnarGridTable(int rows, const int* types, int cols) : m_rows(0)
+    {
+        m_cols.resize(cols);
+        for (int c = 0; c < cols; ++c) {
+            m_cols[c].type = types[c];
+        }
+        Resize(rows);
+    }
+
+    int
+    GetNumberRows() override
+    {
+        return m_rows;
+    }
+
+    int
+    GetNumberCols() override
+    {
+        return static_cast<int>(m_cols.size());
+    }
+
+    wxString
+    GetValue(int row, int col) override
+    {
+        if (!IsValid(row, col))
+            return wxString();
+        const Column& column = m_cols[col];
+        switch (column.type) {
+            case WXD_GRID_VALUE_NUMBER:
+                return wxString::Format("%" wxLongLongFmtSpec "d",
+                                        static_cast<wxLongLong_t>(column.ints[row]));
+            case WXD_GRID_VALUE_FLOAT:
+                return wxString::FromCDouble(column.doubles[row]);
+            case WXD_GRID_VALUE_BOOL:
+                return column.bools[row] ? wxString("1") : wxString();
+            default:
+                return column.strings[row];
+        }
+    }
+
+    void
+    SetValue(int row, int col, const wxString& value) override
+    {
+        if (!IsValid(row, col))
+            return;
+        Column& column = m_cols[col];
+        switch (column.type) {
+            case WXD_GRID_VALUE_NUMBER: {
+                wxLongLong_t parsed = 0;
+                column.ints[row] = value.ToLongLong(&parsed) ? parsed : 0;
+                break;
+            }
+            case WXD_GRID_VALUE_FLOAT: {
+                double parsed = 0.0;
+                if (!value.ToCDouble(&parsed) && !value.ToDouble(&parsed))
+                    parsed = 0.0;
+                column.doubles[row] = parsed;
+                break;
+            }
+            case WXD_GRID_VALUE_BOOL:
+                column.bools[row] = !value.empty() && value != "0";
+                break;
+            default:
+                column.strings[row] = value;
+                break;
+        }
+    }
+
+    wxString
+    GetTypeName(int WXUNUSED(row), int col) override
+    {
+        if (col < 0 || col >= GetNumberCols())
+            return wxGRID_VALUE_STRING;
+        switch (m_cols[col].type) {
+            case WXD_GRID_VALUE_NUMBER:
+                return wxGRID_VALUE_NUMBER;
+            case WXD_GRID_VALUE_FLOAT:
+                return wxGRID_VALUE_FLOAT;
+            case WXD_GRID_VALUE_BOOL:
+                return wxGRID_VALUE_BOOL;
+            default:
+                return wxGRID_VALUE_STRING;
+        }
+    }
+
+    bool
+    CanGetValueAs(int row, int col, const wxString& typeName) override
+    {
+        return typeName == wxGRID_VALUE_STRING || typeName == GetTypeName(row, col);
+    }
+
+    bool
+    CanSetValueAs(int row, int col, const wxString& typeName) override
+    {
+        return CanGetValueAs(row, col, typeName);
+    }
+
+    long
+    GetValueAsLong(int row, int col) override
+    {
+        if (!IsTyped(row, col, WXD_GRID_VALUE_NUMBER))
+            return 0;
+        return clamp_to_long(m_cols[col].ints[row]);
+    }
+
+    double
+    GetValueAsDouble(int row, int col) override
+    {
+        return IsTyped(row, col, WXD_GRID_VALUE_FLOAT) ? m_cols[col].doubles[row] : 0.0;
+    }
+
+    bool
+    GetValueAsBool(int row, int col) override
+    {
+        return IsTyped(row, col, WXD_GRID_VALUE_BOOL) && m_cols[col].bools[row];
+    }
+
+    void
+    SetValueAsLong(int row, int col, long value) override
+    {
+        if (IsTyped(row, col, WXD_GRID_VALUE_NUMBER))
+            m_cols[col].ints[row] = value;
+    }
+
+    void
+    SetValueAsDouble(int row, int col, double value) override
+    {
+        if (IsTyped(row, col, WXD_GRID_VALUE_FLOAT))
+            m_cols[col].doubles[row] = value;
+    }
+
+    void
+    SetValueAsBool(int row, int col, bool value) override
+    {
+        if (IsTyped(row, col, WXD_GRID_VALUE_BOOL))
+            m_cols[col].bools[row] = value;
+    }
+
+    void
+    Clear() override
+    {
+        const int rows = m_rows;
+        Resize(0);
+        Resize(rows);
+    }
+
+    bool
+    InsertRows(size_t pos, size_t numRows) override
+    {
+        if (pos > static_cast<size_t>(m_rows))
+            return false;
+        for (Column& column : m_cols) {
+            column.Insert(pos, numRows);
+        }
+        m_rows += static_cast<int>(numRows);
+        Notify(wxGRIDTABLE_NOTIFY_ROWS_INSERTED, static_cast<int>(pos), static_cast<int>(numRows));
+        return true;
+    }
+
+    bool
+    AppendRows(size_t numRows) override
+    {
+        Resize(m_rows + static_cast<int>(numRows));
+        Notify(wxGRIDTABLE_NOTIFY_ROWS_APPENDED, static_cast<int>(numRows), 0);
+        return true;
+    }
+
+    bool
+    DeleteRows(size_t pos, size_t numRows) override
+    {
+        if (pos >= static_cast<size_t>(m_rows))
+            return false;
+        numRows = std::min(numRows, static_cast<size_t>(m_rows) - pos);
+        for (Column& column : m_cols) {
+            column.Erase(pos, numRows);
+        }
+        m_rows -= static_cast<int>(numRows);
+        Notify(wxGRIDTABLE_NOTIFY_ROWS_DELETED, static_cast<int>(pos), static_cast<int>(numRows));
+        return true;
+    }
+
+    bool
+    SetRowCount(int rows)
+    {
+        if (rows < 0)
+            return false;
+        if (rows > m_rows)
+            return AppendRows(rows - m_rows);
+        if (rows < m_rows)
+            return DeleteRows(rows, m_rows - rows);
+        return true;
+    }
+
+    bool
+    Update(int col, int first_row, const int64_t* values, size_t count)
+    {
+        return CanUpdate(col, WXD_GRID_VALUE_NUMBER, first_row, values, count) &&
+               CopyInto(m_cols[col].ints, first_row, values, count);
+    }
+
+    bool
+    Update(int col, int first_row, const double* values, size_t count)
+    {
+        return CanUpdate(col, WXD_GRID_VALUE_FLOAT, first_row, values, count) &&
+               CopyInto(m_cols[col].doubles, first_row, values, count);
+    }
+
+    bool
+    Update(int col, int first_row, const bool* values, size_t count)
+    {
+        return CanUpdate(col, WXD_GRID_VALUE_BOOL, first_row, values, count) &&
+               CopyInto(m_cols[col].bools, first_row, values, count);
+    }
+
+private:
+    struct Column {
+        int type = WXD_GRID_VALUE_STRING;
+        // Only the vector matching `type` is used.
+        std::vector<int64_t> ints;
+        std::vector<double> doubles;
+        std::vector<char> bools;
+        std::vector<wxString> strings;
+
+        void
+        Resize(size_t rows)
+        {
+            switch (type) {
+                case WXD_GRID_VALUE_NUMBER:
+                    ints.resize(rows);
+                    break;
+                case WXD_GRID_VALUE_FLOAT:
+                    doubles.resize(rows);
+                    break;
+                case WXD_GRID_VALUE_BOOL:
+                    bools.resize(rows);
+                    break;
+                default:
+                    strings.resize(rows);
+                    break;
+            }
+        }
+
+        void
+        Insert(size_t pos, size_t count)
+        {
+            switch (type) {
+                case WXD_GRID_VALUE_NUMBER:
+                    ints.insert(ints.begin() + pos, count, 0);
+                    break;
+                case WXD_GRID_VALUE_FLOAT:
+                    doubles.insert(doubles.begin() + pos, count, 0.0);
+                    break;
+                case WXD_GRID_VALUE_BOOL:
+                    bools.insert(bools.begin() + pos, count, 0);
+                    break;
+                default:
+                    strings.insert(strings.begin() + pos, count, wxString());
+                    break;
+            }
+        }
+
+        void
+        Erase(size_t pos, size_t count)
+        {
+            switch (type) {
+                case WXD_GRID_VALUE_NUMBER:
+                    ints.erase(ints.begin() + pos, ints.begin() + pos + count);
+                    break;
+                case WXD_GRID_VALUE_FLOAT:
+                    doubles.erase(doubles.begin() + pos, doubles.begin() + pos + count);
+                    break;
+                case WXD_GRID_VALUE_BOOL:
+                    bools.erase(bools.begin() + pos, bools.begin() + pos + count);
+                    break;
+                default:
+                    strings.erase(strings.begin() + pos, strings.begin() + pos + count);
+                    break;
+            }
+        }
+    };
+
+    bool
+    CanUpdate(int col, int type, int first_row, const void* values, size_t count) const
+    {
+        return col >= 0 && col < static_cast<int>(m_cols.size()) && m_cols[col].type == type &&
+               first_row >= 0 &&
+               static_cast<size_t>(first_row) + count <= static_cast<size_t>(m_rows) &&
+               (count == 0 || values);
+    }
+
+    template <typename Dst, typename Src>
+    static bool
+    CopyInto(std::vector<Dst>& dst, int first_row, const Src* values, size_t count)
+    {
+        std::copy(values, values + count, dst.begin() + first_row);
+        return true;
+    }
+
+    bool
+    IsValid(int row, int col) const
+    {
+        return row >= 0 && row < m_rows && col >= 0 && col < static_cast<int>(m_cols.size());
+    }
+
+    bool
+    IsTyped(int row, int col, int type) const
+    {
+        return IsValid(row, col) && m_cols[col].type == type;
+    }
+
+    void
+    Resize(int rows)
+    {
+        for (Column& column : m_cols) {
+            column.Resize(static_cast<size_t>(rows));
+        }
+        m_rows = rows;
+    }
+
+    void
+    Notify(int id, int arg1, int arg2)
+    {
+        if (GetView()) {
+            wxGridTableMessage msg(this, id, arg1, arg2);
+            GetView()->ProcessTableMessage(msg);
+        }
+    }
+
+    int m_rows;
+    std::vector<Column> m_cols;
+};
+
+WXD_EXPORTED bool
+wxd_Grid_CreateColumnarTable(wxd_Grid_t* self, int numRows, const int* colTypes, int numCols,
+                             int selectionMode)
+{
+    if (!self || numRows < 0 || numCols < 0 || (numCols > 0 && !colTypes))
+        return false;
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    WxdColumnarGridTable* table = new WxdColumnarGridTable(numRows, colTypes, numCols);
+    if (!grid->SetTable(table, true,
+                        static_cast<wxGrid::wxGridSelectionModes>(selectionMode))) {
+        delete table;
+        return false;
+    }
+    return true;
+}
+
+namespace {
+
+WxdColumnarGridTable*
+columnar_table(wxd_Grid_t* self)
+{
+    if (!self)
+        return nullptr;
+    return dynamic_cast<WxdColumnarGridTable*>(reinterpret_cast<wxGrid*>(self)->GetTable());
+}
+
+template <typename T>
+bool
+update_column(wxd_Grid_t* self, int col, int first_row, const T* values, size_t count)
+{
+    WxdColumnarGridTable* table = columnar_table(self);
+    if (!table || !table->Update(col, first_row, values, count))
+        return false;
+    if (count > 0) {
+        // Only the dirty range is invalidated; RefreshBlock clips it to what is visible.
+        wxd_grid_session::refresh_block(reinterpret_cast<wxGrid*>(self), first_row, col,
+                                        first_row + static_cast<int>(count) - 1, col);
+    }
+    return true;
+}
+
+} // namespace
+
+WXD_EXPORTED bool
+wxd_Grid_ColumnarSetRowCount(wxd_Grid_t* self, int numRows)
+{
+    WxdColumnarGridTable* table = columnar_table(self);
+    return table && table->SetRowCount(numRows);
+}
+
+WXD_EXPORTED bool
+wxd_Grid_ColumnarUpdateInt64(wxd_Grid_t* self, int col, int firstRow, const int64_t* values,
+                             size_t count)
+{
+    return update_column(self, col, firstRow, values, count);
+}
+
+WXD_EXPORTED bool
+wxd_Grid_ColumnarUpdateDouble(wxd_Grid_t* self, int col, int firstRow, const double* values,
+                              size_t count)
+{
+    return update_column(self, col, firstRow, values, count);
+}
+
+WXD_EXPORTED bool
+wxd_Grid_ColumnarUpdateBool(wxd_Grid_t* self, int col, int firstRow, const bool* values,
+                            size_t count)
+{
+    return update_column(self, col, firstRow, values, count);
+}
@@ -0,0 +1,235 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include <wx/accel.h>
+#include "../include/wxdragon.h"
+#include <cctype>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+constexpr int kModifierMask = wxMOD_ALT | wxMOD_CONTROL | wxMOD_SHIFT | wxMOD_META;
+
+class HotkeyTable {
+public:
+    void
+    Set(int modifiers, int key_code, int command_id)
+    {
+        m_entries[Key(modifiers, key_code)] = command_id;
+    }
+
+    bool
+    Remove(int modifiers, int key_code)
+    {
+        return m_entries.erase(Key(modifiers, key_code)) != 0;
+    }
+
+    void
+    Clear()
+    {
+        m_entries.clear();
+    }
+
+    size_t
+    Count() const
+    {
+        return m_entries.size();
+    }
+
+    int
+    Lookup(int modifiers, int key_code) const
+    {
+        auto found = m_entries.find(Key(modifiers, key_code));
+        return found == m_entries.end() ? wxID_NONE : found->second;
+    }
+
+    std::vector<wxAcceleratorEntry>
+    Accelerators() const
+    {
+        std::vector<wxAcceleratorEntry> accels;
+        accels.reserve(m_entries.size());
+        for (const auto& entry : m_entries) {
+            const int modifiers = static_cast<int>(entry.first >> 32);
+            if (modifiers & wxMOD_META)
+                continue;
+            int flags = wxACCEL_NORMAL;
+            if (modifiers & wxMOD_ALT)
+                flags |= wxACCEL_ALT;
+            if (modifiers & wxMOD_CONTROL)
+                flags |= wxACCEL_CTRL;
+            if (modifiers & wxMOD_SHIFT)
+                flags |= wxACCEL_SHIFT;
+            accels.emplace_back(flags, static_cast<int32_t>(entry.first & 0xffffffffu),
+                                entry.second);
+        }
+        return accels;
+    }
+
+private:
+    static uint64_t
+    Key(int modifiers, int key_code)
+    {
+        // Key events report letters in upper case.
+        if (key_code >= 'a' && key_code <= 'z')
+            key_code = std::toupper(key_code);
+        return (static_cast<uint64_t>(modifiers & kModifierMask) << 32) |
+               static_cast<uint32_t>(key_code);
+    }
+
+    std::unordered_map<uint64_t, int> m_entries;
+};
+
+// Routes the key presses of one window through a table. Owned through s_dispatchers and
+// deleted with the window.
+class HotkeyDispatcher {
+public:
+    HotkeyDispatcher(wxWindow* window, std::shared_ptr<HotkeyTable> table)
+        : m_window(window), m_table(std::move(table))
+    {
+        window->Bind(wxEVT_CHAR_HOOK, &HotkeyDispatcher::OnCharHook, this);
+    }
+
+    void
+    Detach()
+    {
+        m_window->Unbind(wxEVT_CHAR_HOOK, &HotkeyDispatcher::OnCharHook, this);
+    }
+
+    void
+    SetTable(std::shared_ptr<HotkeyTable> table)
+    {
+        m_table = std::move(table);
+    }
+
+private:
+    void
+    OnCharHook(wxKeyEvent& event)
+    {
+        const int id = m_table->Lookup(event.GetModifiers(), event.GetKeyCode());
+        if (id == wxID_NONE) {
+            event.Skip();
+            return;
+        }
+        wxCommandEvent command(wxEVT_MENU, id);
+        command.SetEventObject(m_window);
+        m_window->HandleWindowEvent(command);
+    }
+
+    wxWindow* m_window;
+    std::shared_ptr<HotkeyTable> m_table;
+};
+
+// GUI-thread only.
+std::unordered_map<wxWindow*, HotkeyDispatcher*> s_dispatchers;
+
+void
+on_hotkey_window_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    auto found = s_dispatchers.find(static_cast<wxWindow*>(event.GetEventObject()));
+    if (found == s_dispatchers.end())
+        return;
+    delete found->second;
+    s_dispatchers.erase(found);
+}
+
+} // namespace
+
+struct wxd_HotkeyTable_t {
+    std::shared_ptr<HotkeyTable> table;
+};
+
+extern "C" {
+
+WXD_EXPORTED wxd_HotkeyTable_t*
+wxd_HotkeyTable_Create(void)
+{
+    return new wxd_HotkeyTable_t{ std::make_shared<HotkeyTable>() };
+}
+
+WXD_EXPORTED void
+wxd_HotkeyTable_Destroy(wxd_HotkeyTable_t* table)
+{
+    delete table;
+}
+
+WXD_EXPORTED void
+wxd_HotkeyTable_Set(wxd_HotkeyTable_t* table, int modifiers, int key_code, int command_id)
+{
+    if (table)
+        table->table->Set(modifiers, key_code, command_id);
+}
+
+WXD_EXPORTED void
+wxd_HotkeyTable_SetMany(wxd_HotkeyTable_t* table, const int32_t* entries, size_t count)
+{
+    if (!table || !entries)
+        return;
+    for (size_t i = 0; i < count; ++i)
+        table->table->Set(entries[i * 3], entries[i * 3 + 1], entries[i * 3 + 2]);
+}
+
+WXD_EXPORTED bool
+wxd_HotkeyTable_Remove(wxd_HotkeyTable_t* table, int modifiers, int key_code)
+{
+    return table && table->table->Remove(modifiers, key_code);
+}
+
+WXD_EXPORTED void
+wxd_HotkeyTable_Clear(wxd_HotkeyTable_t* table)
+{
+    if (table)
+        table->table->Clear();
+}
+
+WXD_EXPORTED size_t
+wxd_HotkeyTable_GetCount(const wxd_HotkeyTable_t* table)
+{
+    return table ? table->table->Count() : 0;
+}
+
+WXD_EXPORTED int
+wxd_HotkeyTable_Lookup(const wxd_HotkeyTable_t* table, int modifiers, int key_code)
+{
+    return table ? table->table->Lookup(modifiers, key_code) : wxID_NONE;
+}
+
+WXD_EXPORTED void
+wxd_Window_SetHotkeyTable(wxd_Window_t* window, wxd_HotkeyTable_t* table)
+{
+    wxWindow* win = reinterpret_cast<wxWindow*>(window);
+    if (!win)
+        return;
+    auto found = s_dispatchers.find(win);
+    if (found != s_dispatchers.end()) {
+        if (table) {
+            found->second->SetTable(table->table);
+            return;
+        }
+        found->second->Detach();
+        delete found->second;
+        s_dispatchers.erase(found);
+        win->Unbind(wxEVT_DESTROY, &on_hotkey_window_destroy);
+        return;
+    }
+    if (!table)
+        return;
+    s_dispatchers[win] = new HotkeyDispatcher(win, table->table);
+    win->Bind(wxEVT_DESTROY, &on_hotkey_window_destroy);
+}
+
+WXD_EXPORTED size_t
+wxd_HotkeyTable_InstallAccelerators(const wxd_HotkeyTable_t* table, wxd_Window_t* window)
+{
+    wxWindow* win = reinterpret_cast<wxWindow*>(window);
+    if (!table || !win)
+        return 0;
+    const std::vector<wxAcceleratorEntry> accels = table->table->Accelerators();
+    win->SetAcceleratorTable(accels.empty() ? wxNullAcceleratorTable
+                                            : wxAcceleratorTable(static_cast<int>(accels.size()),
+                                                                 accels.data()));
+    return accels.size();
+}
+
+} // extern "C"
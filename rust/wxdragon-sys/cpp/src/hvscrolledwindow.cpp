@@ -0,0 +1,196 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include <wx/vscroll.h>
+
+struct wxd_HVScrolledWindow : public wxHVScrolledWindow {
+    wxd_HVScrolledWindow(wxWindow* parent, wxWindowID id, const wxPoint& pos, const wxSize& size,
+                         long style)
+        : wxHVScrolledWindow(parent, id, pos, size, style)
+    {
+        // The owner repaints the whole client area from its paint handler.
+        SetBackgroundStyle(wxBG_STYLE_PAINT);
+    }
+
+    ~wxd_HVScrolledWindow()
+    {
+        if (m_free)
+            m_free(m_user_data);
+    }
+
+    void
+    SetCallbacks(wxd_HVScrolledWindow_UnitSize row_height,
+                 wxd_HVScrolledWindow_UnitSize column_width, void* user_data,
+                 wxd_HVScrolledWindow_FreeUserData free)
+    {
+        if (m_free)
+            m_free(m_user_data);
+        m_rowHeight = row_height;
+        m_columnWidth = column_width;
+        m_user_data = user_data;
+        m_free = free;
+        RefreshAll();
+    }
+
+    void
+    SetDefaultSizes(int row_height, int column_width)
+    {
+        m_defaultRowHeight = row_height > 0 ? row_height : 1;
+        m_defaultColumnWidth = column_width > 0 ? column_width : 1;
+        RefreshAll();
+    }
+
+protected:
+    wxCoord
+    OnGetRowHeight(size_t row) const override
+    {
+        if (!m_rowHeight)
+            return m_defaultRowHeight;
+        const int height = m_rowHeight(m_user_data, row);
+        return height > 0 ? height : 1;
+    }
+
+    wxCoord
+    OnGetColumnWidth(size_t column) const override
+    {
+        if (!m_columnWidth)
+            return m_defaultColumnWidth;
+        const int width = m_columnWidth(m_user_data, column);
+        return width > 0 ? width : 1;
+    }
+
+private:
+    int m_defaultRowHeight = 20;
+    int m_defaultColumnWidth = 80;
+    wxd_HVScrolledWindow_UnitSize m_rowHeight = nullptr;
+    wxd_HVScrolledWindow_UnitSize m_columnWidth = nullptr;
+    void* m_user_data = nullptr;
+    wxd_HVScrolledWindow_FreeUserData m_free = nullptr;
+};
+
+WXD_EXPORTED wxd_HVScrolledWindow_t*
+wxd_HVScrolledWindow_Create(wxd_Window_t* parent, int id, int x, int y, int w, int h,
+                            int64_t style)
+{
+    wxWindow* p = reinterpret_cast<wxWindow*>(parent);
+    if (!p)
+        return nullptr;
+    wxPoint pos = (x == -1 && y == -1) ? wxDefaultPosition : wxPoint(x, y);
+    wxSize size = (w == -1 && h == -1) ? wxDefaultSize : wxSize(w, h);
+    return new wxd_HVScrolledWindow(p, id, pos, size, static_cast<long>(style));
+}
+
+WXD_EXPORTED void
+wxd_HVScrolledWindow_SetCallbacks(wxd_HVScrolledWindow_t* self,
+                                  wxd_HVScrolledWindow_UnitSize row_height,
+                                  wxd_HVScrolledWindow_UnitSize column_width, void* user_data,
+                                  wxd_HVScrolledWindow_FreeUserData free_user_data)
+{
+    if (!self) {
+        if (free_user_data)
+            free_user_data(user_data);
+        return;
+    }
+    self->SetCallbacks(row_height, column_width, user_data, free_user_data);
+}
+
+WXD_EXPORTED void
+wxd_HVScrolledWindow_SetDefaultSizes(wxd_HVScrolledWindow_t* self, int row_height,
+                                     int column_width)
+{
+    if (self)
+        self->SetDefaultSizes(row_height, column_width);
+}
+
+WXD_EXPORTED void
+wxd_HVScrolledWindow_SetRowColumnCount(wxd_HVScrolledWindow_t* self, size_t rows,
+                                       size_t columns)
+{
+    if (self)
+        self->SetRowColumnCount(rows, columns);
+}
+
+WXD_EXPORTED size_t
+wxd_HVScrolledWindow_GetRowCount(const wxd_HVScrolledWindow_t* self)
+{
+    return self ? self->GetRowCount() : 0;
+}
+
+WXD_EXPORTED size_t
+wxd_HVScrolledWindow_GetColumnCount(const wxd_HVScrolledWindow_t* self)
+{
+    return self ? self->GetColumnCount() : 0;
+}
+
+WXD_EXPORTED void
+wxd_HVScrolledWindow_RefreshAll(wxd_HVScrolledWindow_t* self)
+{
+    if (self)
+        self->RefreshAll();
+}
+
+WXD_EXPORTED void
+wxd_HVScrolledWindow_RefreshRows(wxd_HVScrolledWindow_t* self, size_t from, size_t to)
+{
+    if (self)
+        self->RefreshRows(from, to);
+}
+
+WXD_EXPORTED void
+wxd_HVScrolledWindow_RefreshColumns(wxd_HVScrolledWindow_t* self, size_t from, size_t to)
+{
+    if (self)
+        self->RefreshColumns(from, to);
+}
+
+WXD_EXPORTED bool
+wxd_HVScrolledWindow_ScrollToRow(wxd_HVScrolledWindow_t* self, size_t row)
+{
+    return self && self->ScrollToRow(row);
+}
+
+WXD_EXPORTED bool
+wxd_HVScrolledWindow_ScrollToColumn(wxd_HVScrolledWindow_t* self, size_t column)
+{
+    return self && self->ScrollToColumn(column);
+}
+
+WXD_EXPORTED void
+wxd_HVScrolledWindow_GetVisibleRows(const wxd_HVScrolledWindow_t* self, size_t* begin,
+                                    size_t* end)
+{
+    const size_t first = self ? self->GetVisibleRowsBegin() : 0;
+    const size_t last = self ? self->GetVisibleRowsEnd() : 0;
+    if (begin)
+        *begin = first;
+    if (end)
+        *end = last;
+}
+
+WXD_EXPORTED void
+wxd_HVScrolledWindow_GetVisibleColumns(const wxd_HVScrolledWindow_t* self, size_t* begin,
+                                       size_t* end)
+{
+    const size_t first = self ? self->GetVisibleColumnsBegin() : 0;
+    const size_t last = self ? self->GetVisibleColumnsEnd() : 0;
+    if (begin)
+        *begin = first;
+    if (end)
+        *end = last;
+}
+
+WXD_EXPORTED bool
+wxd_HVScrolledWindow_HitTest(const wxd_HVScrolledWindow_t* self, int x, int y, size_t* row,
+                             size_t* column)
+{
+    if (!self)
+        return false;
+    const wxPosition pos = self->VirtualHitTest(wxPoint(x, y));
+    if (pos.GetRow() == wxNOT_FOUND || pos.GetColumn() == wxNOT_FOUND)
+        return false;
+    if (row)
+        *row = pos.GetRow();
+    if (column)
+        *column = pos.GetColumn();
+    return true;
+}
@@ -3,6 +3,7 @@
 #include "../include/wxdragon.h"
 #include <wx/imaglist.h>
 #include <wx/bitmap.h>
+#include "wxd_atlas.h"
 
 // Helper to cast to wxImageList*
 static inline wxImageList*
@@ -65,6 +66,29 @@ wxd_ImageList_AddWithMask(wxd_ImageList_t* self, const wxd_Bitmap_t* bitmap_ptr,
     return list->Add(*bitmap, *mask);
 }
 
+WXD_EXPORTED int
+wxd_ImageList_AddFromAtlas(wxd_ImageList_t* self, const unsigned char* rgba, int atlas_width,
+                           int atlas_height, int tile_width, int tile_height, int count)
+{
+    wxImageList* list = ToWxImageList(self);
+    if (!list || !rgba || count <= 0 ||
+        count > wxd_atlas::tile_count(atlas_width, atlas_height, tile_width, tile_height)) {
+        return -1;
+    }
+    if (list->GetSize() != wxSize(tile_width, tile_height)) {
+        return -1;
+    }
+    const wxBitmap sheet = wxd_atlas::sheet_bitmap(rgba, atlas_width, atlas_height);
+    if (!sheet.IsOk()) {
+        return -1;
+    }
+    const int first = list->GetImageCount();
+    for (int i = 0; i < count; ++i) {
+        list->Add(sheet.GetSubBitmap(wxd_atlas::tile_rect(atlas_width, tile_width, tile_height, i)));
+    }
+    return first;
+}
+
 WXD_EXPORTED int
 wxd_ImageList_GetImageCount(wxd_ImageList_t* self)
 {
@@ -0,0 +1,799 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_window_timing.h"
+#include <wx/eventfilter.h>
+#include <wx/timer.h>
+#include <wx/weakref.h>
+#if wxUSE_UIACTIONSIMULATOR
+#include <wx/uiaction.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Input recorder (a wxEventFilter) and replayer (a one-shot wxTimer stepping through the blob).
+// The format is described in wxd_input_replay.h.
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr char kMagic[8] = { 'W', 'X', 'D', 'I', 'N', 'P', '0', '1' };
+constexpr uint8_t kTagPath = 1;
+constexpr uint8_t kTagEvent = 2;
+
+// Stable codes for the recorded event types; wxEventType values differ between builds.
+enum Kind : uint32_t {
+    KIND_NONE = 0,
+    KIND_MOTION,
+    KIND_LEFT_DOWN,
+    KIND_LEFT_UP,
+    KIND_LEFT_DCLICK,
+    KIND_MIDDLE_DOWN,
+    KIND_MIDDLE_UP,
+    KIND_MIDDLE_DCLICK,
+    KIND_RIGHT_DOWN,
+    KIND_RIGHT_UP,
+    KIND_RIGHT_DCLICK,
+    KIND_AUX1_DOWN,
+    KIND_AUX1_UP,
+    KIND_AUX1_DCLICK,
+    KIND_AUX2_DOWN,
+    KIND_AUX2_UP,
+    KIND_AUX2_DCLICK,
+    KIND_WHEEL,
+    KIND_KEY_DOWN,
+    KIND_KEY_UP,
+    KIND_CHAR,
+    KIND_CHAR_HOOK,
+    KIND_COUNT
+};
+
+// Button state bits above the wxMOD_* modifiers.
+constexpr uint32_t kLeftButton = 1u << 8;
+constexpr uint32_t kMiddleButton = 1u << 9;
+constexpr uint32_t kRightButton = 1u << 10;
+constexpr uint32_t kAux1Button = 1u << 11;
+constexpr uint32_t kAux2Button = 1u << 12;
+constexpr uint32_t kHorizontalWheel = 1u << 13;
+
+wxEventType
+event_type(Kind kind)
+{
+    switch (kind) {
+    case KIND_MOTION:
+        return wxEVT_MOTION;
+    case KIND_LEFT_DOWN:
+        return wxEVT_LEFT_DOWN;
+    case KIND_LEFT_UP:
+        return wxEVT_LEFT_UP;
+    case KIND_LEFT_DCLICK:
+        return wxEVT_LEFT_DCLICK;
+    case KIND_MIDDLE_DOWN:
+        return wxEVT_MIDDLE_DOWN;
+    case KIND_MIDDLE_UP:
+        return wxEVT_MIDDLE_UP;
+    case KIND_MIDDLE_DCLICK:
+        return wxEVT_MIDDLE_DCLICK;
+    case KIND_RIGHT_DOWN:
+        return wxEVT_RIGHT_DOWN;
+    case KIND_RIGHT_UP:
+        return wxEVT_RIGHT_UP;
+    case KIND_RIGHT_DCLICK:
+        return wxEVT_RIGHT_DCLICK;
+    case KIND_AUX1_DOWN:
+        return wxEVT_AUX1_DOWN;
+    case KIND_AUX1_UP:
+        return wxEVT_AUX1_UP;
+    case KIND_AUX1_DCLICK:
+        return wxEVT_AUX1_DCLICK;
+    case KIND_AUX2_DOWN:
+        return wxEVT_AUX2_DOWN;
+    case KIND_AUX2_UP:
+        return wxEVT_AUX2_UP;
+    case KIND_AUX2_DCLICK:
+        return wxEVT_AUX2_DCLICK;
+    case KIND_WHEEL:
+        return wxEVT_MOUSEWHEEL;
+    case KIND_KEY_DOWN:
+        return wxEVT_KEY_DOWN;
+    case KIND_KEY_UP:
+        return wxEVT_KEY_UP;
+    case KIND_CHAR:
+        return wxEVT_CHAR;
+    case KIND_CHAR_HOOK:
+        return wxEVT_CHAR_HOOK;
+    default:
+        return wxEVT_NULL;
+    }
+}
+
+// The wxEVT_* constants are initialized at startup, so the reverse map is built on first use.
+Kind
+kind_of(wxEventType type)
+{
+    static const std::unordered_map<wxEventType, Kind> kinds = []() {
+        std::unordered_map<wxEventType, Kind> map;
+        for (uint32_t k = KIND_MOTION; k < KIND_COUNT; ++k)
+            map.emplace(event_type(static_cast<Kind>(k)), static_cast<Kind>(k));
+        return map;
+    }();
+    auto it = kinds.find(type);
+    return it != kinds.end() ? it->second : KIND_NONE;
+}
+
+bool
+is_mouse(Kind kind)
+{
+    return kind >= KIND_MOTION && kind <= KIND_WHEEL;
+}
+
+// wxMOUSE_BTN_* of a button kind, or wxMOUSE_BTN_NONE.
+int
+button_of(Kind kind)
+{
+    if (kind >= KIND_LEFT_DOWN && kind <= KIND_LEFT_DCLICK)
+        return wxMOUSE_BTN_LEFT;
+    if (kind >= KIND_MIDDLE_DOWN && kind <= KIND_MIDDLE_DCLICK)
+        return wxMOUSE_BTN_MIDDLE;
+    if (kind >= KIND_RIGHT_DOWN && kind <= KIND_RIGHT_DCLICK)
+        return wxMOUSE_BTN_RIGHT;
+    if (kind >= KIND_AUX1_DOWN && kind <= KIND_AUX1_DCLICK)
+        return wxMOUSE_BTN_AUX1;
+    if (kind >= KIND_AUX2_DOWN && kind <= KIND_AUX2_DCLICK)
+        return wxMOUSE_BTN_AUX2;
+    return wxMOUSE_BTN_NONE;
+}
+
+// 0 = down, 1 = up, 2 = double click; the kinds of each button are consecutive.
+int
+button_action(Kind kind)
+{
+    return (kind - KIND_LEFT_DOWN) % 3;
+}
+
+void
+put_varint(std::vector<uint8_t>& out, uint64_t value)
+{
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+void
+put_signed(std::vector<uint8_t>& out, int64_t value)
+{
+    put_varint(out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+}
+
+bool
+get_varint(const std::vector<uint8_t>& in, size_t& pos, uint64_t* value)
+{
+    uint64_t result = 0;
+    for (int shift = 0; shift < 64 && pos < in.size(); shift += 7) {
+        const uint8_t byte = in[pos++];
+        result |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            *value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+get_signed(const std::vector<uint8_t>& in, size_t& pos, int64_t* value)
+{
+    uint64_t raw = 0;
+    if (!get_varint(in, pos, &raw))
+        return false;
+    *value = static_cast<int64_t>(raw >> 1) ^ -static_cast<int64_t>(raw & 1);
+    return true;
+}
+
+// --- Window paths ---
+
+// Paths start at a top-level window, so dialogs are numbered among all top-level windows even
+// though they have a parent.
+const wxWindowList&
+siblings_of(const wxWindow* window)
+{
+    if (window->IsTopLevel() || !window->GetParent())
+        return wxTopLevelWindows;
+    return window->GetParent()->GetChildren();
+}
+
+// The separators are escaped so any window name round-trips.
+std::string
+escape_name(const wxString& name)
+{
+    std::string out;
+    for (char c : std::string(name.utf8_str())) {
+        if (c == '/' || c == '#' || c == '%') {
+            static const char hex[] = "0123456789ABCDEF";
+            out += '%';
+            out += hex[(c >> 4) & 0xf];
+            out += hex[c & 0xf];
+        }
+        else {
+            out += c;
+        }
+    }
+    return out;
+}
+
+std::string
+segment(const wxWindow* window)
+{
+    const wxString name = window->GetName();
+    int index = 0;
+    for (const wxWindow* sibling : siblings_of(window)) {
+        if (sibling == window)
+            break;
+        if (sibling->GetName() == name)
+            ++index;
+    }
+    return escape_name(name) + '#' + std::to_string(index);
+}
+
+std::string
+path_of(const wxWindow* window)
+{
+    std::string path = segment(window);
+    for (const wxWindow* w = window; !w->IsTopLevel() && w->GetParent();) {
+        w = w->GetParent();
+        path = segment(w) + '/' + path;
+    }
+    return path;
+}
+
+wxWindow*
+resolve_path(const std::string& path)
+{
+    const wxWindowList* candidates = &wxTopLevelWindows;
+    wxWindow* found = nullptr;
+    size_t start = 0;
+    while (start <= path.size()) {
+        size_t end = path.find('/', start);
+        if (end == std::string::npos)
+            end = path.size();
+        const std::string part = path.substr(start, end - start);
+        const size_t hash = part.rfind('#');
+        if (hash == std::string::npos)
+            return nullptr;
+        const std::string name = part.substr(0, hash);
+        int index = std::atoi(part.c_str() + hash + 1);
+        found = nullptr;
+        for (wxWindow* candidate : *candidates) {
+            if (escape_name(candidate->GetName()) == name && index-- == 0) {
+                found = candidate;
+                break;
+            }
+        }
+        if (!found)
+            return nullptr;
+        candidates = &found->GetChildren();
+        start = end + 1;
+    }
+    return found;
+}
+
+// --- Recorder ---
+
+struct Event {
+    Kind kind = KIND_NONE;
+    uint64_t time_us = 0; // since the first event
+    uint32_t path = 0;
+    int64_t x = 0;
+    int64_t y = 0;
+    uint32_t state = 0;
+    int64_t a = 0; // key code or wheel rotation
+    int64_t b = 0; // Unicode character or wheel delta
+};
+
+uint32_t
+mouse_state(const wxMouseEvent& event)
+{
+    uint32_t state = static_cast<uint32_t>(event.GetModifiers());
+    state |= event.LeftIsDown() ? kLeftButton : 0;
+    state |= event.MiddleIsDown() ? kMiddleButton : 0;
+    state |= event.RightIsDown() ? kRightButton : 0;
+    state |= event.Aux1IsDown() ? kAux1Button : 0;
+    state |= event.Aux2IsDown() ? kAux2Button : 0;
+    state |= event.GetWheelAxis() == wxMOUSE_WHEEL_HORIZONTAL ? kHorizontalWheel : 0;
+    return state;
+}
+
+bool s_replaying = false;
+
+class Recorder : public wxEventFilter {
+public:
+    Recorder()
+    {
+        m_data.assign(kMagic, kMagic + sizeof(kMagic));
+        wxEvtHandler::AddFilter(this);
+    }
+
+    ~Recorder() override { wxEvtHandler::RemoveFilter(this); }
+
+    const std::vector<uint8_t>&
+    Data() const
+    {
+        return m_data;
+    }
+
+    int
+    FilterEvent(wxEvent& event) override
+    {
+        const Kind kind = kind_of(event.GetEventType());
+        if (kind == KIND_NONE || s_replaying)
+            return Event_Skip;
+        wxWindow* window = wxDynamicCast(event.GetEventObject(), wxWindow);
+        if (!window)
+            return Event_Skip;
+
+        Event record;
+        record.kind = kind;
+        record.path = PathIndex(window);
+        if (is_mouse(kind)) {
+            const wxMouseEvent& mouse = static_cast<const wxMouseEvent&>(event);
+            record.x = mouse.GetX();
+            record.y = mouse.GetY();
+            record.state = mouse_state(mouse);
+            record.a = mouse.GetWheelRotation();
+            record.b = mouse.GetWheelDelta();
+        }
+        else {
+            const wxKeyEvent& key = static_cast<const wxKeyEvent&>(event);
+            record.x = key.GetX();
+            record.y = key.GetY();
+            record.state = static_cast<uint32_t>(key.GetModifiers());
+            record.a = key.GetKeyCode();
+            record.b = static_cast<int64_t>(key.GetUnicodeKey());
+        }
+
+        const Clock::time_point now = Clock::now();
+        const uint64_t delta =
+            m_events ? std::chrono::duration_cast<std::chrono::microseconds>(now - m_last).count()
+                     : 0;
+        m_last = now;
+        ++m_events;
+        m_data.push_back(kTagEvent);
+        put_varint(m_data, record.kind);
+        put_varint(m_data, delta);
+        put_varint(m_data, record.path);
+        put_signed(m_data, record.x);
+        put_signed(m_data, record.y);
+        put_varint(m_data, record.state);
+        put_signed(m_data, record.a);
+        put_signed(m_data, record.b);
+        return Event_Skip;
+    }
+
+private:
+    // Motion events arrive in runs on one window, so its path is kept for the next event. The
+    // weak reference resets if the window dies, so a new window at the same address misses.
+    uint32_t
+    PathIndex(wxWindow* window)
+    {
+        if (m_lastWindow.get() == window)
+            return m_lastPath;
+        const std::string path = path_of(window);
+        auto it = m_paths.find(path);
+        if (it == m_paths.end()) {
+            it = m_paths.emplace(path, static_cast<uint32_t>(m_paths.size())).first;
+            m_data.push_back(kTagPath);
+            put_varint(m_data, path.size());
+            m_data.insert(m_data.end(), path.begin(), path.end());
+        }
+        m_lastWindow = window;
+        m_lastPath = it->second;
+        return it->second;
+    }
+
+    std::vector<uint8_t> m_data;
+    std::unordered_map<std::string, uint32_t> m_paths;
+    wxWeakRef<wxWindow> m_lastWindow;
+    uint32_t m_lastPath = 0;
+    uint64_t m_events = 0;
+    Clock::time_point m_last;
+};
+
+std::unique_ptr<Recorder> s_recorder;
+// Kept after Stop() for GetData.
+std::vector<uint8_t> s_recording;
+
+// --- Replayer ---
+
+void
+apply_modifiers(wxKeyboardState& state, uint32_t bits)
+{
+    state.SetControlDown((bits & wxMOD_CONTROL) != 0);
+    state.SetRawControlDown((bits & wxMOD_RAW_CONTROL) != 0);
+    state.SetShiftDown((bits & wxMOD_SHIFT) != 0);
+    state.SetAltDown((bits & wxMOD_ALT) != 0);
+    state.SetMetaDown((bits & wxMOD_META) != 0);
+}
+
+class Replayer : public wxTimer {
+public:
+    Replayer(std::vector<uint8_t> data, wxd_InputReplayMode mode, double speed,
+             bool collect_timings, wxd_InputReplayDoneCallback done, void* user_data,
+             void (*free_user_data)(void*))
+        : m_data(std::move(data)), m_pos(sizeof(kMagic)), m_mode(mode), m_speed(speed),
+          m_collect(collect_timings), m_done(done), m_userData(user_data),
+          m_freeUserData(free_user_data)
+    {
+    }
+
+    ~Replayer() override
+    {
+        Stop();
+        if (m_freeUserData)
+            m_freeUserData(m_userData);
+    }
+
+    void
+    Begin(unsigned generation)
+    {
+#if wxUSE_UIACTIONSIMULATOR
+        if (m_mode == WXD_INPUT_REPLAY_SIMULATED)
+            m_sim = std::make_unique<wxUIActionSimulator>();
+#endif
+        m_generation = generation;
+        if (m_collect) {
+            m_timingsWereOn = wxd_window_timing::g_enabled.load(std::memory_order_relaxed);
+            wxd_Debug_GetWindowTimings(nullptr, 0, true);
+            wxd_Debug_EnableWindowTimings(true);
+            wxd_Trace_Start(0);
+        }
+        m_start = Clock::now();
+        Step();
+    }
+
+    unsigned
+    Generation() const
+    {
+        return m_generation;
+    }
+
+    // Reports to the caller; the replayer is deleted right after.
+    void
+    Finish(bool cancelled)
+    {
+        Stop();
+        if (m_collect) {
+            wxd_Trace_Stop();
+            wxd_Debug_EnableWindowTimings(m_timingsWereOn);
+        }
+        m_stats.cancelled = cancelled;
+        if (m_done)
+            m_done(m_userData, &m_stats);
+    }
+
+    void
+    Notify() override
+    {
+        Step();
+    }
+
+private:
+    void
+    Step();
+
+    bool
+    ReadNext(Event* event);
+
+    void
+    Inject(const Event& event);
+
+    void
+    InjectDirect(wxWindow* window, const Event& event);
+
+    wxWindow*
+    Resolve(uint32_t path);
+
+    std::vector<uint8_t> m_data;
+    size_t m_pos;
+    wxd_InputReplayMode m_mode;
+    double m_speed;
+    bool m_collect;
+    bool m_timingsWereOn = false;
+    wxd_InputReplayDoneCallback m_done;
+    void* m_userData;
+    void (*m_freeUserData)(void*);
+    unsigned m_generation = 0;
+
+    std::vector<std::string> m_paths;
+    std::vector<wxWeakRef<wxWindow>> m_windows;
+    std::vector<bool> m_resolved;
+#if wxUSE_UIACTIONSIMULATOR
+    std::unique_ptr<wxUIActionSimulator> m_sim;
+#endif
+    Kind m_lastKind = KIND_NONE;
+
+    Clock::time_point m_start;
+    uint64_t m_time_us = 0;
+    Event m_next;
+    bool m_hasNext = false;
+    wxd_InputReplayStats m_stats{};
+};
+
+std::unique_ptr<Replayer> s_replayer;
+unsigned s_generation = 0;
+
+// Runs from CallAfter, outside any of the replayer's own methods, since it deletes it.
+void
+finish_replay(unsigned generation, bool cancelled)
+{
+    if (!s_replayer || s_replayer->Generation() != generation)
+        return;
+    std::unique_ptr<Replayer> replayer = std::move(s_replayer);
+    s_replaying = false;
+    replayer->Finish(cancelled);
+}
+
+void
+post_finish(unsigned generation)
+{
+    if (wxTheApp)
+        wxTheApp->CallAfter([generation]() { finish_replay(generation, false); });
+}
+
+bool
+Replayer::ReadNext(Event* event)
+{
+    while (m_pos < m_data.size()) {
+        const uint8_t tag = m_data[m_pos++];
+        uint64_t v = 0;
+        if (tag == kTagPath) {
+            if (!get_varint(m_data, m_pos, &v) || v > m_data.size() - m_pos)
+                return false;
+            m_paths.emplace_back(reinterpret_cast<const char*>(&m_data[m_pos]), v);
+            m_windows.emplace_back();
+            m_resolved.push_back(false);
+            m_pos += v;
+            continue;
+        }
+        if (tag != kTagEvent)
+            return false;
+        uint64_t kind = 0, delta = 0, path = 0, state = 0;
+        if (!get_varint(m_data, m_pos, &kind) || !get_varint(m_data, m_pos, &delta) ||
+            !get_varint(m_data, m_pos, &path) || !get_signed(m_data, m_pos, &event->x) ||
+            !get_signed(m_data, m_pos, &event->y) || !get_varint(m_data, m_pos, &state) ||
+            !get_signed(m_data, m_pos, &event->a) || !get_signed(m_data, m_pos, &event->b))
+            return false;
+        m_time_us += delta;
+        event->kind = kind < KIND_COUNT ? static_cast<Kind>(kind) : KIND_NONE;
+        event->time_us = m_time_us;
+        event->path = static_cast<uint32_t>(path);
+        event->state = static_cast<uint32_t>(state);
+        return true;
+    }
+    return false;
+}
+
+void
+Replayer::Step()
+{
+    for (;;) {
+        if (!m_hasNext) {
+            if (!ReadNext(&m_next)) {
+                post_finish(m_generation);
+                return;
+            }
+            m_hasNext = true;
+        }
+        const Clock::time_point now = Clock::now();
+        int64_t lag = 0;
+        if (m_speed > 0) {
+            const auto due = m_start + std::chrono::microseconds(static_cast<int64_t>(
+                                           static_cast<double>(m_next.time_us) / m_speed));
+            if (now < due) {
+                const auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(due - now);
+                StartOnce(std::max<int>(1, static_cast<int>(wait.count())));
+                return;
+            }
+            lag = std::chrono::duration_cast<std::chrono::microseconds>(now - due).count();
+        }
+        m_hasNext = false;
+        Inject(m_next);
+        m_stats.elapsed_us =
+            std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - m_start).count();
+        m_stats.max_lag_us = std::max(m_stats.max_lag_us, lag);
+        m_stats.total_lag_us += lag;
+        if (m_speed <= 0) {
+            // One event per loop iteration, so paints and idle work run in between.
+            const unsigned generation = m_generation;
+            wxTheApp->CallAfter([generation]() {
+                if (s_replayer && s_replayer->Generation() == generation)
+                    s_replayer->Notify();
+            });
+            return;
+        }
+    }
+}
+
+wxWindow*
+Replayer::Resolve(uint32_t path)
+{
+    if (path >= m_paths.size())
+        return nullptr;
+    // Resolved again if the window was destroyed, e.g. a dialog reopened during the replay.
+    if (!m_resolved[path] || !m_windows[path]) {
+        m_windows[path] = resolve_path(m_paths[path]);
+        m_resolved[path] = true;
+    }
+    return m_windows[path].get();
+}
+
+void
+Replayer::Inject(const Event& event)
+{
+    wxWindow* window = event.kind != KIND_NONE ? Resolve(event.path) : nullptr;
+    if (!window) {
+        ++m_stats.skipped;
+        return;
+    }
+    ++m_stats.events;
+    const Kind previous = m_lastKind;
+    m_lastKind = event.kind;
+#if wxUSE_UIACTIONSIMULATOR
+    if (m_sim && event.kind != KIND_WHEEL) {
+        const wxPoint screen = window->ClientToScreen(
+            wxPoint(static_cast<int>(event.x), static_cast<int>(event.y)));
+        switch (event.kind) {
+        case KIND_MOTION:
+            m_sim->MouseMove(screen);
+            return;
+        case KIND_KEY_DOWN:
+            m_sim->KeyDown(static_cast<int>(event.a), static_cast<int>(event.state & 0xff));
+            return;
+        case KIND_KEY_UP:
+            m_sim->KeyUp(static_cast<int>(event.a), static_cast<int>(event.state & 0xff));
+            return;
+        case KIND_CHAR:
+        case KIND_CHAR_HOOK:
+            return; // generated natively from the key presses
+        default:
+            break;
+        }
+        const int button = button_of(event.kind);
+        const int action = button_action(event.kind);
+        // Some toolkits report down, up, down, dclick, up and others down, up, dclick, up: a
+        // double click right after a press of the same button was that press.
+        if (action == 2 && previous == event.kind - 2)
+            return;
+        m_sim->MouseMove(screen);
+        if (action == 1)
+            m_sim->MouseUp(button);
+        else
+            m_sim->MouseDown(button);
+        return;
+    }
+#endif
+    (void)previous;
+    InjectDirect(window, event);
+}
+
+void
+Replayer::InjectDirect(wxWindow* window, const Event& event)
+{
+    const wxEventType type = event_type(event.kind);
+    if (is_mouse(event.kind)) {
+        wxMouseEvent mouse(type);
+        mouse.SetPosition(wxPoint(static_cast<int>(event.x), static_cast<int>(event.y)));
+        apply_modifiers(mouse, event.state);
+        mouse.SetLeftDown((event.state & kLeftButton) != 0);
+        mouse.SetMiddleDown((event.state & kMiddleButton) != 0);
+        mouse.SetRightDown((event.state & kRightButton) != 0);
+        mouse.SetAux1Down((event.state & kAux1Button) != 0);
+        mouse.SetAux2Down((event.state & kAux2Button) != 0);
+        if (event.kind == KIND_WHEEL) {
+            mouse.m_wheelRotation = static_cast<int>(event.a);
+            mouse.m_wheelDelta = static_cast<int>(event.b);
+            mouse.m_linesPerAction = 3;
+            mouse.m_columnsPerAction = 3;
+            mouse.m_wheelAxis = (event.state & kHorizontalWheel) ? wxMOUSE_WHEEL_HORIZONTAL
+                                                                 : wxMOUSE_WHEEL_VERTICAL;
+        }
+        else if (button_of(event.kind) != wxMOUSE_BTN_NONE) {
+            mouse.m_clickCount = button_action(event.kind) == 2 ? 2 : 1;
+        }
+        mouse.SetEventObject(window);
+        mouse.SetId(window->GetId());
+        window->HandleWindowEvent(mouse);
+        return;
+    }
+    wxKeyEvent key(type);
+    key.m_keyCode = static_cast<int>(event.a);
+#if wxUSE_UNICODE
+    key.m_uniChar = static_cast<wxChar>(event.b);
+#endif
+    key.m_x = static_cast<wxCoord>(event.x);
+    key.m_y = static_cast<wxCoord>(event.y);
+    apply_modifiers(key, event.state);
+    key.SetEventObject(window);
+    key.SetId(window->GetId());
+    window->HandleWindowEvent(key);
+}
+
+} // namespace
+
+extern "C" {
+
+WXD_EXPORTED void
+wxd_InputRecorder_Start(void)
+{
+    s_recorder.reset();
+    s_recording.clear();
+    s_recorder = std::make_unique<Recorder>();
+}
+
+WXD_EXPORTED void
+wxd_InputRecorder_Stop(void)
+{
+    if (!s_recorder)
+        return;
+    s_recording = s_recorder->Data();
+    s_recorder.reset();
+}
+
+WXD_EXPORTED bool
+wxd_InputRecorder_IsRecording(void)
+{
+    return s_recorder != nullptr;
+}
+
+WXD_EXPORTED size_t
+wxd_InputRecorder_GetData(uint8_t* buffer, size_t buffer_len)
+{
+    const std::vector<uint8_t>& data = s_recorder ? s_recorder->Data() : s_recording;
+    if (buffer && buffer_len >= data.size() && !data.empty())
+        std::memcpy(buffer, data.data(), data.size());
+    return data.size();
+}
+
+WXD_EXPORTED bool
+wxd_InputReplay_Start(const uint8_t* data, size_t len, wxd_InputReplayMode mode, double speed,
+                      bool collect_timings, wxd_InputReplayDoneCallback done, void* user_data,
+                      void (*free_user_data)(void*))
+{
+    if (!data || len < sizeof(kMagic) || std::memcmp(data, kMagic, sizeof(kMagic)) != 0 ||
+        !wxTheApp)
+        return false;
+#if !wxUSE_UIACTIONSIMULATOR
+    if (mode == WXD_INPUT_REPLAY_SIMULATED)
+        return false;
+#endif
+    wxd_InputReplay_Cancel();
+    s_replayer = std::make_unique<Replayer>(std::vector<uint8_t>(data, data + len), mode, speed,
+                                            collect_timings, done, user_data, free_user_data);
+    s_replaying = true;
+    s_replayer->Begin(++s_generation);
+    return true;
+}
+
+WXD_EXPORTED void
+wxd_InputReplay_Cancel(void)
+{
+    if (s_replayer)
+        finish_replay(s_replayer->Generation(), true);
+}
+
+WXD_EXPORTED bool
+wxd_InputReplay_IsRunning(void)
+{
+    return s_replayer != nullptr;
+}
+
+} // extern "C"
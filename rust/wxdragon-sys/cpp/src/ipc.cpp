@@ -3,7 +3,31 @@
 #include "../include/wxdragon.h"
 #include "../include/core/wxd_ipc.h"
 #include <wx/ipc.h>
+#include <wx/thread.h>
+#include <wx/timer.h>
+#include <wx/tokenzr.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
+#ifdef __WINDOWS__
+#include <wx/msw/wrapwin.h>
+#else
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
 
 // Global registries of live IPC objects.
 // These are used to ensure all DDE objects are destroyed before wxDDECleanUp()
@@ -11,6 +35,530 @@
 static std::unordered_set<void*> g_liveServers;
 static std::unordered_set<void*> g_liveClients;
 
+// --- Shared-memory side channel ---
+//
+// Payloads at or above a connection's threshold are copied once into a named
+// segment; only a descriptor (operation, segment name, size, format, item)
+// crosses wxConnection. Execute and Poke descriptors travel as a Request, which
+// is synchronous on every transport, so the sender can drop the segment as soon
+// as the reply arrives. Advise is one-way: the client Pokes a release message
+// back once its callback returns, and the server drops any unreleased segments
+// when the connection goes away.
+
+static const char kShmTag[] = "\x01wxd-shm";
+static const char kShmSeparator = '\x1f';
+
+class SharedSegment {
+public:
+    SharedSegment() = default;
+    SharedSegment(const SharedSegment&) = delete;
+    SharedSegment& operator=(const SharedSegment&) = delete;
+    ~SharedSegment() { Close(); }
+
+    // Creates a uniquely named segment holding a copy of data.
+    bool Create(const void* data, size_t size) {
+        static std::atomic<unsigned> s_serial{ 0 };
+        // Short enough for macOS, which limits POSIX shm names to 31 bytes.
+        m_name = wxString::Format("wxd-%lu-%u", wxGetProcessId(), ++s_serial);
+        m_owner = true;
+        m_size = size;
+#ifdef __WINDOWS__
+        const unsigned long long len = size;
+        m_handle = ::CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                        static_cast<DWORD>(len >> 32), static_cast<DWORD>(len),
+                                        SystemName().wc_str());
+        if (!m_handle)
+            return false;
+        void* view = ::MapViewOfFile(m_handle, FILE_MAP_WRITE, 0, 0, size);
+        if (!view) {
+            Close();
+            return false;
+        }
+        std::memcpy(view, data, size);
+        ::UnmapViewOfFile(view);
+        // The handle keeps the mapping alive until the peer is done with it.
+#else
+        const int fd = ::shm_open(SystemName().utf8_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0)
+            return false;
+        m_linked = true;
+        void* view = MAP_FAILED;
+        if (::ftruncate(fd, static_cast<off_t>(size)) == 0)
+            view = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (view == MAP_FAILED) {
+            Close();
+            return false;
+        }
+        std::memcpy(view, data, size);
+        ::munmap(view, size);
+        // The name keeps the memory alive until Close() unlinks it.
+#endif
+        return true;
+    }
+
+    // Maps an existing segment read-only; fails unless it holds at least size bytes.
+    bool Open(const wxString& name, size_t size) {
+        m_name = name;
+        m_size = size;
+#ifdef __WINDOWS__
+        m_handle = ::OpenFileMappingW(FILE_MAP_READ, FALSE, SystemName().wc_str());
+        if (!m_handle)
+            return false;
+        m_view = ::MapViewOfFile(m_handle, FILE_MAP_READ, 0, 0, size);
+#else
+        const int fd = ::shm_open(SystemName().utf8_str(), O_RDONLY, 0);
+        if (fd < 0)
+            return false;
+        struct stat info;
+        if (::fstat(fd, &info) == 0 && static_cast<unsigned long long>(info.st_size) >= size) {
+            void* view = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+            m_view = view == MAP_FAILED ? nullptr : view;
+        }
+        ::close(fd);
+#endif
+        if (!m_view) {
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    void Close() {
+#ifdef __WINDOWS__
+        if (m_view)
+            ::UnmapViewOfFile(m_view);
+        if (m_handle)
+            ::CloseHandle(m_handle);
+        m_handle = nullptr;
+#else
+        if (m_view)
+            ::munmap(m_view, m_size);
+        if (m_owner && m_linked)
+            ::shm_unlink(SystemName().utf8_str());
+        m_linked = false;
+#endif
+        m_view = nullptr;
+    }
+
+    const void* Data() const { return m_view; }
+    const wxString& Name() const { return m_name; }
+
+private:
+    wxString SystemName() const {
+#ifdef __WINDOWS__
+        return "Local\\" + m_name;
+#else
+        return "/" + m_name;
+#endif
+    }
+
+    wxString m_name;
+    size_t m_size = 0;
+    bool m_owner = false;
+    void* m_view = nullptr;
+#ifdef __WINDOWS__
+    HANDLE m_handle = nullptr;
+#else
+    bool m_linked = false;
+#endif
+};
+
+struct ShmDescriptor {
+    wxString op;
+    wxString name;
+    size_t size = 0;
+    wxIPCFormat format = wxIPC_PRIVATE;
+    wxString item;
+};
+
+static wxString
+make_shm_descriptor(const wxString& op, const wxString& name = wxString(), size_t size = 0,
+                    wxIPCFormat format = wxIPC_PRIVATE, const wxString& item = wxString())
+{
+    wxString out = kShmTag;
+    for (const wxString& field :
+         { op, name, wxString::Format("%llu", static_cast<unsigned long long>(size)),
+           wxString::Format("%d", static_cast<int>(format)) }) {
+        out += kShmSeparator;
+        out += field;
+    }
+    // The item goes last, so it may contain anything but is not split.
+    out += kShmSeparator;
+    out += item;
+    return out;
+}
+
+static bool
+parse_shm_descriptor(const wxString& text, ShmDescriptor& out)
+{
+    wxString rest;
+    if (!text.StartsWith(kShmTag, &rest) || rest.empty() || rest[0] != kShmSeparator)
+        return false;
+    wxStringTokenizer fields(rest.Mid(1), wxString(kShmSeparator), wxTOKEN_RET_EMPTY_ALL);
+    unsigned long long size = 0;
+    long format = 0;
+    if (!fields.HasMoreTokens())
+        return false;
+    out.op = fields.GetNextToken();
+    out.name = fields.GetNextToken();
+    if (!fields.GetNextToken().ToULongLong(&size) || !fields.GetNextToken().ToLong(&format))
+        return false;
+    out.size = static_cast<size_t>(size);
+    out.format = static_cast<wxIPCFormat>(format);
+    out.item = fields.GetString();
+    return true;
+}
+
+// --- Asynchronous connect and request ---
+//
+// wxConnection and the sockets behind it belong to the GUI thread, so the
+// asynchronous variants never touch them elsewhere. A connect first probes the
+// endpoint from a worker thread (socket transports only) and performs the real
+// MakeConnection on the GUI thread once the server is known to be listening.
+// A request travels as a Poke that the server answers on a later idle pass
+// with an Advise on a fixed reply item, so neither side waits for the other.
+// Every operation completes exactly once on the GUI thread: with a result, or
+// with a failure, timeout or cancellation.
+
+static const char kAsyncTag[] = "\x01wxd-async";
+
+static wxString
+async_reply_item()
+{
+    return wxString(kAsyncTag) + kShmSeparator + "r";
+}
+
+static wxString
+make_async_request(uint64_t id, wxIPCFormat format, const wxString& item)
+{
+    return wxString(kAsyncTag) + kShmSeparator + "q" + kShmSeparator +
+           wxString::Format("%llu", static_cast<unsigned long long>(id)) + kShmSeparator +
+           wxString::Format("%d", static_cast<int>(format)) + kShmSeparator + item;
+}
+
+static bool
+parse_async_request(const wxString& text, uint64_t& id, wxIPCFormat& format, wxString& item)
+{
+    wxString rest;
+    if (!text.StartsWith(wxString(kAsyncTag) + kShmSeparator + "q" + kShmSeparator, &rest))
+        return false;
+    wxStringTokenizer fields(rest, wxString(kShmSeparator), wxTOKEN_RET_EMPTY_ALL);
+    unsigned long long raw_id = 0;
+    long raw_format = 0;
+    if (!fields.GetNextToken().ToULongLong(&raw_id) || !fields.GetNextToken().ToLong(&raw_format))
+        return false;
+    id = raw_id;
+    format = static_cast<wxIPCFormat>(raw_format);
+    item = fields.GetString();
+    return true;
+}
+
+// Reply layout: u64 id, u8 ok flag, then the payload (little-endian).
+static const size_t kAsyncReplyHeader = 9;
+
+class AsyncOp {
+public:
+    explicit AsyncOp(uint64_t id) : m_id(id) {}
+    AsyncOp(const AsyncOp&) = delete;
+    AsyncOp& operator=(const AsyncOp&) = delete;
+    virtual ~AsyncOp() = default;
+
+    uint64_t Id() const { return m_id; }
+
+    // Completes the operation without a result.
+    virtual void Fail(wxd_IPCAsyncStatus status) = 0;
+
+    void ArmTimeout(unsigned timeout_ms);
+
+private:
+    uint64_t m_id;
+    std::unique_ptr<wxTimer> m_timer;
+};
+
+// Pending operations, touched only on the GUI thread.
+static std::unordered_map<uint64_t, std::shared_ptr<AsyncOp>> g_asyncOps;
+static uint64_t g_lastAsyncId = 0;
+
+static uint64_t
+register_async(std::shared_ptr<AsyncOp> op)
+{
+    const uint64_t id = op->Id();
+    g_asyncOps[id] = std::move(op);
+    return id;
+}
+
+// Removes a pending operation; null once it has completed.
+static std::shared_ptr<AsyncOp>
+take_async(uint64_t id)
+{
+    auto it = g_asyncOps.find(id);
+    if (it == g_asyncOps.end())
+        return nullptr;
+    std::shared_ptr<AsyncOp> op = std::move(it->second);
+    g_asyncOps.erase(it);
+    return op;
+}
+
+static void
+fail_async(uint64_t id, wxd_IPCAsyncStatus status)
+{
+    if (std::shared_ptr<AsyncOp> op = take_async(id))
+        op->Fail(status);
+}
+
+class AsyncTimeout : public wxTimer {
+public:
+    explicit AsyncTimeout(uint64_t id) : m_id(id) {}
+
+    void Notify() override {
+        // Deferred so the timer is not destroyed inside its own Notify().
+        const uint64_t id = m_id;
+        wxTheApp->CallAfter([id]() { fail_async(id, WXD_IPC_ASYNC_TIMEOUT); });
+    }
+
+private:
+    uint64_t m_id;
+};
+
+void AsyncOp::ArmTimeout(unsigned timeout_ms)
+{
+    if (!timeout_ms || !wxTheApp)
+        return;
+    m_timer = std::make_unique<AsyncTimeout>(m_id);
+    m_timer->StartOnce(static_cast<int>(timeout_ms));
+}
+
+class RequestOp : public AsyncOp {
+public:
+    RequestOp(uint64_t id, wxd_IPC_OnRequestComplete_Callback on_complete, void* user_data,
+              wxd_IPC_FreeUserData_Callback free_user_data)
+        : AsyncOp(id), m_onComplete(on_complete), m_userData(user_data),
+          m_freeUserData(free_user_data) {}
+
+    ~RequestOp() override {
+        if (m_userData && m_freeUserData)
+            m_freeUserData(m_userData);
+    }
+
+    void Finish(wxd_IPCAsyncStatus status, const void* data, size_t size) {
+        if (m_onComplete)
+            m_onComplete(m_userData, Id(), status, data, size);
+    }
+
+    void Fail(wxd_IPCAsyncStatus status) override { Finish(status, nullptr, 0); }
+
+private:
+    wxd_IPC_OnRequestComplete_Callback m_onComplete;
+    void* m_userData;
+    wxd_IPC_FreeUserData_Callback m_freeUserData;
+};
+
+class ConnectOp : public AsyncOp {
+public:
+    struct Callbacks {
+        void* user_data;
+        wxd_IPC_OnExecute_Callback on_execute;
+        wxd_IPC_OnRequest_Callback on_request;
+        wxd_IPC_OnPoke_Callback on_poke;
+        wxd_IPC_OnStartAdvise_Callback on_start_advise;
+        wxd_IPC_OnStopAdvise_Callback on_stop_advise;
+        wxd_IPC_OnAdvise_Callback on_advise;
+        wxd_IPC_OnDisconnect_Callback on_disconnect;
+        wxd_IPC_FreeUserData_Callback free_user_data;
+    };
+
+    ConnectOp(uint64_t id, wxd_IPCClient_t* client, const char* host, const char* service,
+              const char* topic, const Callbacks& callbacks,
+              wxd_IPC_OnConnectComplete_Callback on_complete, void* complete_data,
+              wxd_IPC_FreeUserData_Callback free_complete_data)
+        : AsyncOp(id), m_client(client), m_host(host), m_service(service), m_topic(topic),
+          m_callbacks(callbacks), m_onComplete(on_complete), m_completeData(complete_data),
+          m_freeCompleteData(free_complete_data) {}
+
+    ~ConnectOp() override {
+        // The connection callbacks belong to the connection once one was attempted.
+        if (m_callbacks.user_data && m_callbacks.free_user_data)
+            m_callbacks.free_user_data(m_callbacks.user_data);
+        if (m_completeData && m_freeCompleteData)
+            m_freeCompleteData(m_completeData);
+    }
+
+    const std::string& Host() const { return m_host; }
+    const std::string& Service() const { return m_service; }
+
+    void Connect() {
+        wxd_IPCConnection_t* conn = nullptr;
+        if (g_liveClients.count(m_client)) {
+            const Callbacks cb = m_callbacks;
+            m_callbacks.user_data = nullptr;
+            conn = wxd_IPCClient_MakeConnection(m_client, m_host.c_str(), m_service.c_str(),
+                                                m_topic.c_str(), cb.user_data, cb.on_execute,
+                                                cb.on_request, cb.on_poke, cb.on_start_advise,
+                                                cb.on_stop_advise, cb.on_advise,
+                                                cb.on_disconnect, cb.free_user_data);
+        }
+        Finish(conn ? WXD_IPC_ASYNC_OK : WXD_IPC_ASYNC_FAILED, conn);
+    }
+
+    void Fail(wxd_IPCAsyncStatus status) override { Finish(status, nullptr); }
+
+private:
+    void Finish(wxd_IPCAsyncStatus status, wxd_IPCConnection_t* conn) {
+        if (m_onComplete)
+            m_onComplete(m_completeData, Id(), status, conn);
+    }
+
+    wxd_IPCClient_t* m_client;
+    std::string m_host;
+    std::string m_service;
+    std::string m_topic;
+    Callbacks m_callbacks;
+    wxd_IPC_OnConnectComplete_Callback m_onComplete;
+    void* m_completeData;
+    wxd_IPC_FreeUserData_Callback m_freeCompleteData;
+};
+
+static void
+on_probe_done(uint64_t id, bool reachable)
+{
+    std::shared_ptr<ConnectOp> op = std::dynamic_pointer_cast<ConnectOp>(take_async(id));
+    if (!op)
+        return; // Cancelled or timed out meanwhile.
+    if (reachable)
+        op->Connect();
+    else
+        op->Fail(WXD_IPC_ASYNC_FAILED);
+}
+
+#ifndef __WINDOWS__
+// Checks that something accepts connections at the endpoint wxTCPClient would
+// use: a Unix socket when the service contains '/', else host:service over TCP.
+// Waits at most timeout_ms for a TCP handshake (0 leaves it to the system).
+static bool
+probe_endpoint(const std::string& host, const std::string& service, unsigned timeout_ms)
+{
+    if (service.find('/') != std::string::npos) {
+        sockaddr_un addr{};
+        if (service.size() >= sizeof(addr.sun_path))
+            return false;
+        addr.sun_family = AF_UNIX;
+        std::memcpy(addr.sun_path, service.c_str(), service.size() + 1);
+        const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0)
+            return false;
+        const bool ok = ::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0;
+        ::close(fd);
+        return ok;
+    }
+
+    addrinfo hints{};
+    hints.ai_family = AF_INET; // wxTCPClient connects over IPv4.
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* found = nullptr;
+    if (::getaddrinfo(host.c_str(), service.c_str(), &hints, &found) != 0)
+        return false;
+    bool ok = false;
+    for (addrinfo* ai = found; ai && !ok; ai = ai->ai_next) {
+        const int fd = ::socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (fd < 0)
+            continue;
+        ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+        if (::connect(fd, ai->ai_addr, ai->ai_addrlen) == 0) {
+            ok = true;
+        }
+        else if (errno == EINPROGRESS) {
+            pollfd pfd{ fd, POLLOUT, 0 };
+            if (::poll(&pfd, 1, timeout_ms ? static_cast<int>(timeout_ms) : -1) > 0) {
+                int err = 0;
+                socklen_t len = sizeof(err);
+                ok = ::getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &len) == 0 && err == 0;
+            }
+        }
+        ::close(fd);
+    }
+    ::freeaddrinfo(found);
+    return ok;
+}
+
+class ConnectProbe : public wxThread {
+public:
+    ConnectProbe(uint64_t id, const std::string& host, const std::string& service,
+                 unsigned timeout_ms)
+        : wxThread(wxTHREAD_DETACHED), m_id(id), m_host(host), m_service(service),
+          m_timeoutMs(timeout_ms) {}
+
+protected:
+    ExitCode Entry() override {
+        const bool reachable = probe_endpoint(m_host, m_service, m_timeoutMs);
+        const uint64_t id = m_id;
+        if (wxTheApp)
+            wxTheApp->CallAfter([id, reachable]() { on_probe_done(id, reachable); });
+        return nullptr;
+    }
+
+private:
+    uint64_t m_id;
+    std::string m_host;
+    std::string m_service;
+    unsigned m_timeoutMs;
+};
+#endif
+
+// --- Local transport ---
+//
+// wxTCPServer and wxTCPClient already speak Unix domain sockets when the
+// service is a path, which skips the TCP stack (and Nagle's delay on small
+// request/reply pairs) altogether. The local transport only has to turn a bare
+// service name into a private socket path that both ends agree on. On Windows
+// wxServer is DDE, which never leaves the machine, so names pass through.
+
+static wxString
+resolve_service(const wxString& service, wxd_IPCTransport transport)
+{
+#ifdef __WINDOWS__
+    (void)transport;
+    return service;
+#else
+    if (transport != WXD_IPC_TRANSPORT_LOCAL || service.Contains("/"))
+        return service;
+    const wxString file =
+        wxString::Format("wxd-%lu-%s.sock", static_cast<unsigned long>(::getuid()), service);
+    wxString dir;
+    // The runtime directory is private to the user and cleared at logout.
+    if (!wxGetEnv("XDG_RUNTIME_DIR", &dir) || dir.empty() || !wxDirExists(dir))
+        dir = "/tmp";
+    wxString path = dir + "/" + file;
+    if (path.utf8_str().length() >= sizeof(sockaddr_un::sun_path))
+        path = "/tmp/" + file;
+    return path;
+#endif
+}
+
+// --- Advise batching ---
+//
+// A batching server queues Advise updates instead of sending each one and
+// flushes them as a single frame on a fixed item once the interval elapses or
+// the frame grows past its size limit. Frame layout (little-endian): u32 count,
+// then per update a u32-length item, a u32 format and u32-length data. Clients
+// opt in by starting an advise loop on the frame item, which DDE needs anyway.
+
+static const wxString&
+advise_batch_item()
+{
+    static const wxString item = wxString("\x01wxd-batch");
+    return item;
+}
+
+static const size_t kDefaultBatchBytes = 64 * 1024;
+
+static void
+append_u32(std::string& out, size_t value)
+{
+    for (int shift = 0; shift < 32; shift += 8)
+        out.push_back(static_cast<char>((value >> shift) & 0xff));
+}
+
 // --- WxdConnection: Custom connection class that wraps callbacks ---
 
 class WxdConnection : public wxConnection {
@@ -54,6 +602,7 @@ public:
 
     virtual ~WxdConnection() {
         WXD_LOG_TRACE("WxdConnection destroyed");
+        FailAsyncRequests();
         if (m_userData && m_freeUserData) {
             m_freeUserData(m_userData);
             m_userData = nullptr;
@@ -93,6 +642,9 @@ public:
     }
 
     virtual const void* OnRequest(const wxString& topic, const wxString& item, size_t* size, wxIPCFormat format) override {
+        ShmDescriptor shm;
+        if (parse_shm_descriptor(item, shm))
+            return OnSharedRequest(topic, shm, size);
         if (m_onRequest) {
             wxScopedCharBuffer topicUtf8 = topic.utf8_str();
             wxScopedCharBuffer itemUtf8 = item.utf8_str();
@@ -102,6 +654,18 @@ public:
     }
 
     virtual bool OnPoke(const wxString& topic, const wxString& item, const void* data, size_t size, wxIPCFormat format) override {
+        ShmDescriptor shm;
+        if (parse_shm_descriptor(item, shm) && shm.op == "release") {
+            m_adviseSegments.erase(std::string(shm.name.utf8_str()));
+            return true;
+        }
+        uint64_t async_id = 0;
+        wxIPCFormat async_format = wxIPC_PRIVATE;
+        wxString async_item;
+        if (parse_async_request(item, async_id, async_format, async_item)) {
+            QueueAsyncReply(topic, async_id, async_item, async_format);
+            return true;
+        }
         if (m_onPoke) {
             wxScopedCharBuffer topicUtf8 = topic.utf8_str();
             wxScopedCharBuffer itemUtf8 = item.utf8_str();
@@ -111,6 +675,12 @@ public:
     }
 
     virtual bool OnStartAdvise(const wxString& topic, const wxString& item) override {
+        if (item == async_reply_item())
+            return true;
+        if (item == advise_batch_item()) {
+            m_peerBatches = true;
+            return true;
+        }
         if (m_onStartAdvise) {
             wxScopedCharBuffer topicUtf8 = topic.utf8_str();
             wxScopedCharBuffer itemUtf8 = item.utf8_str();
@@ -120,6 +690,13 @@ public:
     }
 
     virtual bool OnStopAdvise(const wxString& topic, const wxString& item) override {
+        if (item == async_reply_item())
+            return true;
+        if (item == advise_batch_item()) {
+            FlushAdvise();
+            m_peerBatches = false;
+            return true;
+        }
         if (m_onStopAdvise) {
             wxScopedCharBuffer topicUtf8 = topic.utf8_str();
             wxScopedCharBuffer itemUtf8 = item.utf8_str();
@@ -130,6 +707,18 @@ public:
 
     // Client-side callback
     virtual bool OnAdvise(const wxString& topic, const wxString& item, const void* data, size_t size, wxIPCFormat format) override {
+        ShmDescriptor shm;
+        if (format == wxIPC_PRIVATE && m_shmThreshold && size < 1024 &&
+            parse_shm_descriptor(wxString::FromUTF8(static_cast<const char*>(data), size), shm) &&
+            shm.op == "a") {
+            return OnSharedAdvise(topic, item, shm);
+        }
+        if (format == wxIPC_PRIVATE && item == async_reply_item()) {
+            DeliverAsyncReply(data, size);
+            return true;
+        }
+        if (format == wxIPC_PRIVATE && item == advise_batch_item())
+            return DeliverAdviseBatch(topic, data, size);
         if (m_onAdvise) {
             wxScopedCharBuffer topicUtf8 = topic.utf8_str();
             wxScopedCharBuffer itemUtf8 = item.utf8_str();
@@ -140,6 +729,7 @@ public:
 
     // Both-side callback
     virtual bool OnDisconnect() override {
+        FailAsyncRequests();
         if (m_onDisconnect) {
             return m_onDisconnect(m_userData);
         }
@@ -147,7 +737,321 @@ public:
         return true;
     }
 
+    // --- Shared-memory side channel ---
+
+    void SetClientSide() { m_clientSide = true; }
+
+    // Accepts shared-memory payloads from the peer and, once the peer accepts them
+    // too, sends payloads of at least threshold bytes that way (0 disables).
+    // Clients ask the server directly; a server learns of its client's hello.
+    bool EnableSharedMemory(size_t threshold) {
+        m_shmThreshold = threshold;
+        if (!threshold) {
+            m_peerShm = false;
+            return true;
+        }
+        if (m_clientSide) {
+            size_t size = 0;
+            const void* reply = Request(make_shm_descriptor("hello"), &size, wxIPC_PRIVATE);
+            m_peerShm = reply && size >= 1 && static_cast<const char*>(reply)[0] == '1';
+        }
+        return m_peerShm;
+    }
+
+    bool UsesSharedMemory() const { return m_shmThreshold && m_peerShm; }
+
+    bool ExecuteData(const void* data, size_t size, wxIPCFormat format) {
+        if (m_clientSide && UsesSharedMemory() && size >= m_shmThreshold) {
+            SharedSegment segment;
+            if (segment.Create(data, size))
+                return SendShared("x", segment, size, format, wxString());
+        }
+        return Execute(data, size, format);
+    }
+
+    bool PokeData(const wxString& item, const void* data, size_t size, wxIPCFormat format) {
+        if (m_clientSide && UsesSharedMemory() && size >= m_shmThreshold) {
+            SharedSegment segment;
+            if (segment.Create(data, size))
+                return SendShared("p", segment, size, format, item);
+        }
+        return Poke(item, data, size, format);
+    }
+
+    bool AdviseData(const wxString& item, const void* data, size_t size, wxIPCFormat format) {
+        if (!m_clientSide && UsesSharedMemory() && size >= m_shmThreshold) {
+            auto segment = std::make_unique<SharedSegment>();
+            if (segment->Create(data, size)) {
+                const wxScopedCharBuffer descriptor =
+                    make_shm_descriptor("a", segment->Name(), size, format).utf8_str();
+                const std::string key(segment->Name().utf8_str());
+                // Kept until the client's release arrives or the connection goes away.
+                m_adviseSegments[key] = std::move(segment);
+                if (Advise(item, descriptor.data(), descriptor.length(), wxIPC_PRIVATE))
+                    return true;
+                m_adviseSegments.erase(key);
+                return false;
+            }
+        }
+        return Advise(item, data, size, format);
+    }
+
+    // --- Advise batching ---
+
+    void SetOnAdviseBatch(wxd_IPC_OnAdviseBatch_Callback on_advise_batch) {
+        m_onAdviseBatch = on_advise_batch;
+    }
+
+    // Server: queue Advise updates and send them every interval_ms as one frame
+    // of at most about max_bytes (0 disables, flushing what is queued).
+    // Client: ask the server for batched frames (interval_ms 0 stops asking).
+    bool SetAdviseBatching(unsigned interval_ms, size_t max_bytes) {
+        if (m_clientSide) {
+            if (interval_ms)
+                return StartAdvise(advise_batch_item());
+            StopAdvise(advise_batch_item());
+            return true;
+        }
+        FlushAdvise();
+        m_batchIntervalMs = interval_ms;
+        m_batchMaxBytes = max_bytes ? max_bytes : kDefaultBatchBytes;
+        return true;
+    }
+
+    bool BatchesAdvise() const { return !m_clientSide && m_batchIntervalMs && m_peerBatches; }
+
+    bool QueueAdvise(const char* item, const void* data, size_t size, wxIPCFormat format) {
+        if (m_batch.empty())
+            m_batch.assign(4, '\0'); // Count, patched in FlushAdvise().
+        const size_t item_len = std::strlen(item);
+        append_u32(m_batch, item_len);
+        m_batch.append(item, item_len);
+        append_u32(m_batch, static_cast<uint32_t>(format));
+        append_u32(m_batch, size);
+        if (size)
+            m_batch.append(static_cast<const char*>(data), size);
+        ++m_batchCount;
+        if (m_batch.size() >= m_batchMaxBytes)
+            return FlushAdvise();
+        if (!m_batchTimer) {
+            m_batchTimer = std::make_unique<wxTimer>();
+            m_batchTimer->Bind(wxEVT_TIMER, [this](wxTimerEvent&) { FlushAdvise(); });
+        }
+        if (!m_batchTimer->IsRunning())
+            m_batchTimer->StartOnce(static_cast<int>(m_batchIntervalMs));
+        return true;
+    }
+
+    // Sends the queued updates now.
+    bool FlushAdvise() {
+        if (m_batchTimer)
+            m_batchTimer->Stop();
+        if (!m_batchCount)
+            return true;
+        std::string frame;
+        frame.swap(m_batch);
+        for (int i = 0; i < 4; ++i)
+            frame[i] = static_cast<char>((m_batchCount >> (8 * i)) & 0xff);
+        m_batchCount = 0;
+        return GetConnected() &&
+               AdviseData(advise_batch_item(), frame.data(), frame.size(), wxIPC_PRIVATE);
+    }
+
+    // --- Asynchronous requests ---
+
+    // Sends an asynchronous request; the reply arrives through DeliverAsyncReply().
+    bool SendAsyncRequest(uint64_t id, const wxString& item, wxIPCFormat format) {
+        static const char kOne = '1';
+        // DDE only delivers Advise data over an established advise loop.
+        if (!m_asyncReplies)
+            m_asyncReplies = StartAdvise(async_reply_item());
+        if (!m_asyncReplies || !Poke(make_async_request(id, format, item), &kOne, 1, wxIPC_PRIVATE))
+            return false;
+        m_asyncRequests.insert(id);
+        return true;
+    }
+
 private:
+    // Sends a descriptor as a synchronous Request; the segment may go once it returns.
+    bool SendShared(const char* op, const SharedSegment& segment, size_t size,
+                    wxIPCFormat format, const wxString& item) {
+        size_t reply_size = 0;
+        const void* reply = Request(make_shm_descriptor(op, segment.Name(), size, format, item),
+                                    &reply_size, wxIPC_PRIVATE);
+        return reply && reply_size >= 1 && static_cast<const char*>(reply)[0] == '1';
+    }
+
+    const void* OnSharedRequest(const wxString& topic, const ShmDescriptor& shm, size_t* size) {
+        static const char kAccepted[] = "1";
+        static const char kRejected[] = "0";
+        bool ok = false;
+        if (shm.op == "hello") {
+            m_peerShm = true;
+            ok = m_shmThreshold != 0;
+        }
+        else if (m_shmThreshold && (shm.op == "x" || shm.op == "p")) {
+            SharedSegment segment;
+            if (segment.Open(shm.name, shm.size)) {
+                const wxScopedCharBuffer topicUtf8 = topic.utf8_str();
+                const wxd_IPCFormat format = static_cast<wxd_IPCFormat>(shm.format);
+                // The mapped view is the borrowed slice; it is unmapped after the callback.
+                if (shm.op == "x" && m_onExecute)
+                    ok = m_onExecute(m_userData, topicUtf8.data(), segment.Data(), shm.size,
+                                     format);
+                else if (shm.op == "p" && m_onPoke)
+                    ok = m_onPoke(m_userData, topicUtf8.data(), shm.item.utf8_str().data(),
+                                  segment.Data(), shm.size, format);
+            }
+        }
+        if (size)
+            *size = 1;
+        return ok ? kAccepted : kRejected;
+    }
+
+    bool OnSharedAdvise(const wxString& topic, const wxString& item, const ShmDescriptor& shm) {
+        bool ok = false;
+        {
+            SharedSegment segment;
+            const bool mapped = segment.Open(shm.name, shm.size);
+            if (mapped && item == advise_batch_item()) {
+                ok = DeliverAdviseBatch(topic, segment.Data(), shm.size);
+            }
+            else if (mapped && m_onAdvise) {
+                const wxScopedCharBuffer topicUtf8 = topic.utf8_str();
+                const wxScopedCharBuffer itemUtf8 = item.utf8_str();
+                ok = m_onAdvise(m_userData, topicUtf8.data(), itemUtf8.data(), segment.Data(),
+                                shm.size, static_cast<wxd_IPCFormat>(shm.format));
+            }
+        }
+        // Released after this handler returns: a transaction cannot start inside it.
+        if (wxTheApp) {
+            std::weak_ptr<bool> alive = m_alive;
+            const wxString release = make_shm_descriptor("release", shm.name);
+            wxTheApp->CallAfter([this, alive, release]() {
+                static const char kOne = '1';
+                if (alive.lock() && GetConnected())
+                    Poke(release, &kOne, 1, wxIPC_PRIVATE);
+            });
+        }
+        return ok;
+    }
+
+    // Answers on a later idle pass, so the client's Poke returns at once.
+    void QueueAsyncReply(const wxString& topic, uint64_t id, const wxString& item,
+                         wxIPCFormat format) {
+        if (!wxTheApp)
+            return;
+        std::weak_ptr<bool> alive = m_alive;
+        wxTheApp->CallAfter([this, alive, topic, id, item, format]() {
+            if (!alive.lock() || !GetConnected())
+                return;
+            size_t size = 0;
+            const void* data = nullptr;
+            if (m_onRequest) {
+                const wxScopedCharBuffer topicUtf8 = topic.utf8_str();
+                const wxScopedCharBuffer itemUtf8 = item.utf8_str();
+                data = m_onRequest(m_userData, topicUtf8.data(), itemUtf8.data(), &size,
+                                   static_cast<wxd_IPCFormat>(format));
+            }
+            std::string reply;
+            reply.reserve(kAsyncReplyHeader + (data ? size : 0));
+            for (int shift = 0; shift < 64; shift += 8)
+                reply.push_back(static_cast<char>((id >> shift) & 0xff));
+            reply.push_back(data ? 1 : 0);
+            if (data)
+                reply.append(static_cast<const char*>(data), size);
+            Advise(async_reply_item(), reply.data(), reply.size(), wxIPC_PRIVATE);
+        });
+    }
+
+    void DeliverAsyncReply(const void* data, size_t size) {
+        if (!data || size < kAsyncReplyHeader)
+            return;
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        uint64_t id = 0;
+        for (int i = 0; i < 8; ++i)
+            id |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+        m_asyncRequests.erase(id);
+        std::shared_ptr<RequestOp> op = std::dynamic_pointer_cast<RequestOp>(take_async(id));
+        if (!op)
+            return; // Cancelled or timed out; the late reply is dropped.
+        if (bytes[8])
+            op->Finish(WXD_IPC_ASYNC_OK, bytes + kAsyncReplyHeader, size - kAsyncReplyHeader);
+        else
+            op->Fail(WXD_IPC_ASYNC_FAILED);
+    }
+
+    bool DeliverAdviseBatch(const wxString& topic, const void* data, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        size_t pos = 0;
+        auto read_u32 = [&](size_t& value) {
+            if (!bytes || size - pos < 4)
+                return false;
+            value = bytes[pos] | (bytes[pos + 1] << 8) | (bytes[pos + 2] << 16) |
+                    (static_cast<size_t>(bytes[pos + 3]) << 24);
+            pos += 4;
+            return true;
+        };
+        size_t count = 0;
+        if (!read_u32(count))
+            return false;
+        // Each update takes at least 12 bytes, which bounds a corrupt count.
+        count = std::min(count, size / 12);
+        std::vector<std::string> items;
+        std::vector<wxd_IPCAdviseSlice> slices;
+        items.reserve(count);
+        slices.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            size_t item_len = 0, format = 0, data_len = 0;
+            if (!read_u32(item_len) || size - pos < item_len)
+                return false;
+            items.emplace_back(reinterpret_cast<const char*>(bytes + pos), item_len);
+            pos += item_len;
+            if (!read_u32(format) || !read_u32(data_len) || size - pos < data_len)
+                return false;
+            slices.push_back({ nullptr, bytes + pos, data_len,
+                               static_cast<wxd_IPCFormat>(format) });
+            pos += data_len;
+        }
+        for (size_t i = 0; i < slices.size(); ++i)
+            slices[i].item = items[i].c_str();
+
+        const wxScopedCharBuffer topicUtf8 = topic.utf8_str();
+        if (m_onAdviseBatch)
+            return m_onAdviseBatch(m_userData, topicUtf8.data(), slices.data(), slices.size());
+        bool ok = true;
+        for (const wxd_IPCAdviseSlice& slice : slices) {
+            if (m_onAdvise)
+                ok = m_onAdvise(m_userData, topicUtf8.data(), slice.item, slice.data, slice.size,
+                                slice.format) && ok;
+        }
+        return ok;
+    }
+
+    // Fails outstanding requests on a later pass; their replies can no longer arrive.
+    void FailAsyncRequests() {
+        if (wxTheApp) {
+            for (uint64_t id : m_asyncRequests)
+                wxTheApp->CallAfter([id]() { fail_async(id, WXD_IPC_ASYNC_FAILED); });
+        }
+        m_asyncRequests.clear();
+    }
+
+    wxd_IPC_OnAdviseBatch_Callback m_onAdviseBatch = nullptr;
+    unsigned m_batchIntervalMs = 0;
+    size_t m_batchMaxBytes = kDefaultBatchBytes;
+    bool m_peerBatches = false;
+    std::string m_batch;
+    size_t m_batchCount = 0;
+    std::unique_ptr<wxTimer> m_batchTimer;
+    bool m_asyncReplies = false;
+    std::unordered_set<uint64_t> m_asyncRequests;
+    bool m_clientSide = false;
+    size_t m_shmThreshold = 0;
+    bool m_peerShm = false;
+    std::unordered_map<std::string, std::unique_ptr<SharedSegment>> m_adviseSegments;
+    std::shared_ptr<bool> m_alive = std::make_shared<bool>(true);
+
     void* m_userData;
     wxd_IPC_OnExecute_Callback m_onExecute;
     wxd_IPC_OnRequest_Callback m_onRequest;
@@ -256,6 +1160,9 @@ public:
     }
 
     // Override OnMakeConnection to return our custom connection type with callbacks
+    void SetTransport(wxd_IPCTransport transport) { m_transport = transport; }
+    wxd_IPCTransport Transport() const { return m_transport; }
+
     virtual wxConnectionBase* OnMakeConnection() override {
         WxdConnection* conn = new WxdConnection(
             m_pendingUserData,
@@ -268,12 +1175,14 @@ public:
             m_pendingOnDisconnect,
             m_pendingFreeUserData
         );
+        conn->SetClientSide();
         // Clear pending callbacks after use (ownership transferred to connection)
         ClearPendingCallbacks();
         return conn;
     }
 
 private:
+    wxd_IPCTransport m_transport = WXD_IPC_TRANSPORT_DEFAULT;
     void* m_pendingUserData;
     wxd_IPC_OnExecute_Callback m_pendingOnExecute;
     wxd_IPC_OnRequest_Callback m_pendingOnRequest;
@@ -334,7 +1243,7 @@ wxd_IPCConnection_Execute(
 {
     if (!conn) return false;
     WxdConnection* wx_conn = reinterpret_cast<WxdConnection*>(conn);
-    return wx_conn->Execute(data, size, static_cast<wxIPCFormat>(format));
+    return wx_conn->ExecuteData(data, size, static_cast<wxIPCFormat>(format));
 }
 
 WXD_EXPORTED bool
@@ -372,7 +1281,7 @@ wxd_IPCConnection_Poke(
     if (!conn || !item) return false;
     WxdConnection* wx_conn = reinterpret_cast<WxdConnection*>(conn);
     wxString itemStr = wxString::FromUTF8(item);
-    return wx_conn->Poke(itemStr, data, size, static_cast<wxIPCFormat>(format));
+    return wx_conn->PokeData(itemStr, data, size, static_cast<wxIPCFormat>(format));
 }
 
 WXD_EXPORTED bool
@@ -403,8 +1312,10 @@ wxd_IPCConnection_Advise(
 {
     if (!conn || !item) return false;
     WxdConnection* wx_conn = reinterpret_cast<WxdConnection*>(conn);
+    if (wx_conn->BatchesAdvise())
+        return wx_conn->QueueAdvise(item, data, size, static_cast<wxIPCFormat>(format));
     wxString itemStr = wxString::FromUTF8(item);
-    return wx_conn->Advise(itemStr, data, size, static_cast<wxIPCFormat>(format));
+    return wx_conn->AdviseData(itemStr, data, size, static_cast<wxIPCFormat>(format));
 }
 
 WXD_EXPORTED bool
@@ -426,6 +1337,75 @@ wxd_IPCConnection_GetTopic(wxd_IPCConnection_t* conn, char* buffer, size_t buffe
     return 0;
 }
 
+WXD_EXPORTED bool
+wxd_IPCConnection_EnableSharedMemory(wxd_IPCConnection_t* conn, size_t threshold)
+{
+    if (!conn) return false;
+    WxdConnection* wx_conn = reinterpret_cast<WxdConnection*>(conn);
+    return wx_conn->EnableSharedMemory(threshold);
+}
+
+WXD_EXPORTED bool
+wxd_IPCConnection_UsesSharedMemory(wxd_IPCConnection_t* conn)
+{
+    if (!conn) return false;
+    WxdConnection* wx_conn = reinterpret_cast<WxdConnection*>(conn);
+    return wx_conn->UsesSharedMemory();
+}
+
+WXD_EXPORTED uint64_t
+wxd_IPCConnection_RequestAsync(
+    wxd_IPCConnection_t* conn,
+    const char* item,
+    wxd_IPCFormat format,
+    unsigned int timeout_ms,
+    wxd_IPC_OnRequestComplete_Callback on_complete,
+    void* user_data,
+    wxd_IPC_FreeUserData_Callback free_user_data)
+{
+    auto op = std::make_shared<RequestOp>(++g_lastAsyncId, on_complete, user_data,
+                                          free_user_data);
+    if (!conn || !item || !wxTheApp) return 0;
+    WxdConnection* wx_conn = reinterpret_cast<WxdConnection*>(conn);
+    const uint64_t id = register_async(op);
+    if (!wx_conn->SendAsyncRequest(id, wxString::FromUTF8(item),
+                                   static_cast<wxIPCFormat>(format))) {
+        take_async(id);
+        return 0;
+    }
+    op->ArmTimeout(timeout_ms);
+    return id;
+}
+
+WXD_EXPORTED void
+wxd_IPCConnection_SetOnAdviseBatch(
+    wxd_IPCConnection_t* conn,
+    wxd_IPC_OnAdviseBatch_Callback on_advise_batch)
+{
+    if (!conn) return;
+    WxdConnection* wx_conn = reinterpret_cast<WxdConnection*>(conn);
+    wx_conn->SetOnAdviseBatch(on_advise_batch);
+}
+
+WXD_EXPORTED bool
+wxd_IPCConnection_SetAdviseBatching(
+    wxd_IPCConnection_t* conn,
+    unsigned int interval_ms,
+    size_t max_bytes)
+{
+    if (!conn) return false;
+    WxdConnection* wx_conn = reinterpret_cast<WxdConnection*>(conn);
+    return wx_conn->SetAdviseBatching(interval_ms, max_bytes);
+}
+
+WXD_EXPORTED bool
+wxd_IPCConnection_FlushAdvise(wxd_IPCConnection_t* conn)
+{
+    if (!conn) return false;
+    WxdConnection* wx_conn = reinterpret_cast<WxdConnection*>(conn);
+    return wx_conn->FlushAdvise();
+}
+
 WXD_EXPORTED bool
 wxd_IPCConnection_IsConnected(wxd_IPCConnection_t* conn)
 {
@@ -456,6 +1436,24 @@ wxd_IPCServer_Create_Service(wxd_IPCServer_t* server, const char* service)
     return wx_server->Create(serviceStr);
 }
 
+WXD_EXPORTED bool
+wxd_IPCServer_Create_ServiceEx(
+    wxd_IPCServer_t* server,
+    const char* service,
+    wxd_IPCTransport transport)
+{
+    if (!server || !service) return false;
+    WxdServer* wx_server = reinterpret_cast<WxdServer*>(server);
+    const wxString endpoint = resolve_service(wxString::FromUTF8(service), transport);
+#ifndef __WINDOWS__
+    // wxTCPServer unlinks whatever is at the path; only do that to a dead socket.
+    if (transport == WXD_IPC_TRANSPORT_LOCAL &&
+        probe_endpoint(std::string(), std::string(endpoint.utf8_str()), 0))
+        return false;
+#endif
+    return wx_server->Create(endpoint);
+}
+
 WXD_EXPORTED void
 wxd_IPCServer_Destroy(wxd_IPCServer_t* server)
 {
@@ -476,6 +1474,32 @@ wxd_IPCClient_Create(void)
     return reinterpret_cast<wxd_IPCClient_t*>(client);
 }
 
+WXD_EXPORTED void
+wxd_IPCClient_SetTransport(wxd_IPCClient_t* client, wxd_IPCTransport transport)
+{
+    if (!client) return;
+    reinterpret_cast<WxdClient*>(client)->SetTransport(transport);
+}
+
+WXD_EXPORTED size_t
+wxd_IPC_ResolveService(
+    const char* service,
+    wxd_IPCTransport transport,
+    char* buffer,
+    size_t buffer_size)
+{
+    if (!service) return 0;
+    const wxScopedCharBuffer endpoint =
+        resolve_service(wxString::FromUTF8(service), transport).utf8_str();
+    const size_t len = endpoint.length();
+    if (buffer && buffer_size) {
+        const size_t copied = std::min(len, buffer_size - 1);
+        std::memcpy(buffer, endpoint.data(), copied);
+        buffer[copied] = '\0';
+    }
+    return len;
+}
+
 WXD_EXPORTED wxd_IPCConnection_t*
 wxd_IPCClient_MakeConnection(
     wxd_IPCClient_t* client,
@@ -511,7 +1535,7 @@ wxd_IPCClient_MakeConnection(
     );
 
     wxString hostStr = wxString::FromUTF8(host);
-    wxString serviceStr = wxString::FromUTF8(service);
+    wxString serviceStr = resolve_service(wxString::FromUTF8(service), wx_client->Transport());
     wxString topicStr = wxString::FromUTF8(topic);
 
     // MakeConnection will call OnMakeConnection() internally,
@@ -533,6 +1557,62 @@ wxd_IPCClient_MakeConnection(
     return reinterpret_cast<wxd_IPCConnection_t*>(conn);
 }
 
+WXD_EXPORTED uint64_t
+wxd_IPCClient_MakeConnectionAsync(
+    wxd_IPCClient_t* client,
+    const char* host,
+    const char* service,
+    const char* topic,
+    unsigned int timeout_ms,
+    void* user_data,
+    wxd_IPC_OnExecute_Callback on_execute,
+    wxd_IPC_OnRequest_Callback on_request,
+    wxd_IPC_OnPoke_Callback on_poke,
+    wxd_IPC_OnStartAdvise_Callback on_start_advise,
+    wxd_IPC_OnStopAdvise_Callback on_stop_advise,
+    wxd_IPC_OnAdvise_Callback on_advise,
+    wxd_IPC_OnDisconnect_Callback on_disconnect,
+    wxd_IPC_FreeUserData_Callback free_user_data,
+    wxd_IPC_OnConnectComplete_Callback on_complete,
+    void* complete_data,
+    wxd_IPC_FreeUserData_Callback free_complete_data)
+{
+    const ConnectOp::Callbacks callbacks = { user_data, on_execute, on_request, on_poke,
+                                             on_start_advise, on_stop_advise, on_advise,
+                                             on_disconnect, free_user_data };
+    if (!client || !host || !service || !topic || !wxTheApp) {
+        // Nothing was started: release both user data blocks right away.
+        ConnectOp(0, client, "", "", "", callbacks, nullptr, complete_data, free_complete_data);
+        return 0;
+    }
+    const wxScopedCharBuffer endpoint =
+        resolve_service(wxString::FromUTF8(service),
+                        reinterpret_cast<WxdClient*>(client)->Transport()).utf8_str();
+    auto op = std::make_shared<ConnectOp>(++g_lastAsyncId, client, host, endpoint.data(), topic,
+                                          callbacks, on_complete, complete_data,
+                                          free_complete_data);
+    const uint64_t id = register_async(op);
+    op->ArmTimeout(timeout_ms);
+#ifndef __WINDOWS__
+    ConnectProbe* probe = new ConnectProbe(id, op->Host(), op->Service(), timeout_ms);
+    if (probe->Run() == wxTHREAD_NO_ERROR)
+        return id;
+    delete probe;
+#endif
+    // DDE has no socket to wait on; connect on the next idle pass instead.
+    wxTheApp->CallAfter([id]() { on_probe_done(id, true); });
+    return id;
+}
+
+WXD_EXPORTED bool
+wxd_IPC_CancelAsync(uint64_t op_id)
+{
+    std::shared_ptr<AsyncOp> op = take_async(op_id);
+    if (!op) return false;
+    op->Fail(WXD_IPC_ASYNC_CANCELLED);
+    return true;
+}
+
 WXD_EXPORTED void
 wxd_IPCClient_Destroy(wxd_IPCClient_t* client)
 {
@@ -549,6 +1629,9 @@ wxd_IPCClient_Destroy(wxd_IPCClient_t* client)
 WXD_EXPORTED void
 wxd_IPC_CleanupAll(void)
 {
+    // Pending asynchronous operations are dropped without completing.
+    g_asyncOps.clear();
+
     // Destroy all live servers
     for (void* ptr : g_liveServers) {
         WxdServer* server = reinterpret_cast<WxdServer*>(ptr);
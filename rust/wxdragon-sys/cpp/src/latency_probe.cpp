@@ -0,0 +1,331 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_latency.h"
+#include <wx/eventfilter.h>
+#include <wx/weakref.h>
+#if wxUSE_UIACTIONSIMULATOR
+#include <wx/uiaction.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace wxd_latency {
+
+std::atomic<int> g_waiting{ 0 };
+
+} // namespace wxd_latency
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+bool
+IsInputEvent(wxEventType type)
+{
+    return type == wxEVT_KEY_DOWN || type == wxEVT_CHAR_HOOK || type == wxEVT_CHAR ||
+           type == wxEVT_LEFT_DOWN || type == wxEVT_RIGHT_DOWN || type == wxEVT_MIDDLE_DOWN ||
+           type == wxEVT_AUX1_DOWN || type == wxEVT_AUX2_DOWN || type == wxEVT_MOUSEWHEEL;
+}
+
+std::vector<wxd_LatencyProbe_t*> s_probes;
+
+} // namespace
+
+struct wxd_LatencyProbe_t : public wxEventFilter {
+    explicit wxd_LatencyProbe_t(wxWindow* target) : m_target(target)
+    {
+        wxEvtHandler::AddFilter(this);
+        s_probes.push_back(this);
+    }
+
+    ~wxd_LatencyProbe_t() override
+    {
+        Disarm();
+        s_probes.erase(std::remove(s_probes.begin(), s_probes.end(), this), s_probes.end());
+        wxEvtHandler::RemoveFilter(this);
+        m_alive.reset();
+    }
+
+    void Begin()
+    {
+        if (!m_armed) {
+            m_armed = true;
+            ++wxd_latency::g_waiting;
+        }
+        m_start = Clock::now();
+        m_handlerUs = -1;
+        m_paintUs = -1;
+        m_paintStarted = false;
+        ++m_sequence;
+    }
+
+    bool Wait(int timeout_ms)
+    {
+        if (!m_armed)
+            return false;
+        const Clock::time_point deadline = m_start + std::chrono::milliseconds(timeout_ms);
+        while (m_paintUs < 0 && m_target && Clock::now() < deadline) {
+            if (!wxTheApp || !wxTheApp->Yield(true))
+                wxMilliSleep(1);
+        }
+        Disarm();
+        m_handler.push_back(m_handlerUs);
+        m_paint.push_back(m_paintUs);
+        if (m_paintUs < 0)
+            ++m_timeouts;
+        return m_paintUs >= 0;
+    }
+
+    // Drops the measurement started by Begin without recording a sample.
+    void Cancel() { Disarm(); }
+
+    int FilterEvent(wxEvent& event) override
+    {
+        if (!m_armed || m_paintUs >= 0)
+            return Event_Skip;
+        const wxEventType type = event.GetEventType();
+        if (m_handlerUs < 0) {
+            if (IsInputEvent(type) && IsTargetOrChild(event.GetEventObject()))
+                m_handlerUs = ElapsedUs();
+            return Event_Skip;
+        }
+        if (type == wxEVT_PAINT && !m_paintStarted && IsTargetOrChild(event.GetEventObject())) {
+            // Native painting runs after every handler; the first pending-event pass after
+            // this paint is its end unless the dispatcher reports an earlier one.
+            m_paintStarted = true;
+            std::weak_ptr<bool> alive = m_alive;
+            const uint64_t sequence = m_sequence;
+            wxTheApp->CallAfter([this, alive, sequence]() {
+                if (!alive.expired() && sequence == m_sequence)
+                    PaintFinished();
+            });
+        }
+        return Event_Skip;
+    }
+
+    void OnPaintDispatched(wxEvtHandler* handler)
+    {
+        if (m_armed && m_paintStarted && IsTargetOrChild(handler))
+            PaintFinished();
+    }
+
+    void Stats(wxd_LatencyStats* out) const
+    {
+        Summarize(m_handler, &out->to_handler);
+        Summarize(m_paint, &out->to_paint);
+        out->timeouts = m_timeouts;
+    }
+
+    size_t Samples(int64_t* to_handler, int64_t* to_paint, size_t capacity) const
+    {
+        const size_t n = std::min(capacity, m_handler.size());
+        if (to_handler)
+            std::copy_n(m_handler.begin(), n, to_handler);
+        if (to_paint)
+            std::copy_n(m_paint.begin(), n, to_paint);
+        return m_handler.size();
+    }
+
+    void Reset()
+    {
+        m_handler.clear();
+        m_paint.clear();
+        m_timeouts = 0;
+    }
+
+private:
+    int64_t ElapsedUs() const
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - m_start)
+            .count();
+    }
+
+    void PaintFinished()
+    {
+        if (m_paintUs < 0)
+            m_paintUs = ElapsedUs();
+    }
+
+    void Disarm()
+    {
+        if (m_armed) {
+            m_armed = false;
+            --wxd_latency::g_waiting;
+        }
+    }
+
+    bool IsTargetOrChild(wxObject* object) const
+    {
+        wxWindow* target = m_target.get();
+        if (!target)
+            return false;
+        for (wxWindow* win = wxDynamicCast(object, wxWindow); win; win = win->GetParent()) {
+            if (win == target)
+                return true;
+            if (win->IsTopLevel())
+                break;
+        }
+        return false;
+    }
+
+    static void Summarize(const std::vector<int64_t>& samples, wxd_LatencyDistribution* out)
+    {
+        std::vector<int64_t> seen;
+        for (int64_t us : samples) {
+            if (us >= 0)
+                seen.push_back(us);
+        }
+        *out = wxd_LatencyDistribution{};
+        if (seen.empty())
+            return;
+        std::sort(seen.begin(), seen.end());
+        // Nearest-rank percentiles, so p99 of fewer than 100 samples is the maximum.
+        auto rank = [&seen](int percent) {
+            const size_t index = (seen.size() * percent + 99) / 100;
+            return seen[index > 0 ? index - 1 : 0];
+        };
+        int64_t total = 0;
+        for (int64_t us : seen)
+            total += us;
+        out->count = static_cast<uint32_t>(seen.size());
+        out->p50_us = rank(50);
+        out->p90_us = rank(90);
+        out->p99_us = rank(99);
+        out->max_us = seen.back();
+        out->mean_us = total / static_cast<int64_t>(seen.size());
+    }
+
+    wxWeakRef<wxWindow> m_target;
+    std::shared_ptr<bool> m_alive = std::make_shared<bool>(true);
+    Clock::time_point m_start;
+    bool m_armed = false;
+    bool m_paintStarted = false;
+    uint64_t m_sequence = 0;
+    int64_t m_handlerUs = -1;
+    int64_t m_paintUs = -1;
+    std::vector<int64_t> m_handler;
+    std::vector<int64_t> m_paint;
+    uint32_t m_timeouts = 0;
+};
+
+void
+wxd_latency::paint_finished_slow(wxEvtHandler* handler)
+{
+    for (wxd_LatencyProbe_t* probe : s_probes)
+        probe->OnPaintDispatched(handler);
+}
+
+extern "C" {
+
+WXD_EXPORTED wxd_LatencyProbe_t*
+wxd_LatencyProbe_Create(wxd_Window_t* target)
+{
+    wxWindow* win = reinterpret_cast<wxWindow*>(target);
+    if (!win)
+        return nullptr;
+    return new wxd_LatencyProbe_t(win);
+}
+
+WXD_EXPORTED void
+wxd_LatencyProbe_Destroy(wxd_LatencyProbe_t* probe)
+{
+    delete probe;
+}
+
+WXD_EXPORTED void
+wxd_LatencyProbe_Begin(wxd_LatencyProbe_t* probe)
+{
+    if (probe)
+        probe->Begin();
+}
+
+WXD_EXPORTED bool
+wxd_LatencyProbe_Wait(wxd_LatencyProbe_t* probe, int timeout_ms)
+{
+    return probe && probe->Wait(timeout_ms);
+}
+
+WXD_EXPORTED bool
+wxd_LatencyProbe_MeasureChar(wxd_LatencyProbe_t* probe, wxd_UIActionSimulator_t* sim,
+                             int keycode, int modifiers, int timeout_ms)
+{
+#if wxUSE_UIACTIONSIMULATOR
+    if (!probe || !sim)
+        return false;
+    probe->Begin();
+    if (!reinterpret_cast<wxUIActionSimulator*>(sim)->Char(keycode, modifiers)) {
+        probe->Cancel();
+        return false;
+    }
+    return probe->Wait(timeout_ms);
+#else
+    wxUnusedVar(probe);
+    wxUnusedVar(sim);
+    wxUnusedVar(keycode);
+    wxUnusedVar(modifiers);
+    wxUnusedVar(timeout_ms);
+    return false;
+#endif
+}
+
+WXD_EXPORTED bool
+wxd_LatencyProbe_MeasureClick(wxd_LatencyProbe_t* probe, wxd_UIActionSimulator_t* sim, long x,
+                              long y, int button, int timeout_ms)
+{
+#if wxUSE_UIACTIONSIMULATOR
+    if (!probe || !sim)
+        return false;
+    wxUIActionSimulator* wx_sim = reinterpret_cast<wxUIActionSimulator*>(sim);
+    if (!wx_sim->MouseMove(x, y))
+        return false;
+    // Let the move and any hover repaint settle so they are not attributed to the click.
+    if (wxTheApp)
+        wxTheApp->Yield(true);
+    probe->Begin();
+    if (!wx_sim->MouseClick(button)) {
+        probe->Cancel();
+        return false;
+    }
+    return probe->Wait(timeout_ms);
+#else
+    wxUnusedVar(probe);
+    wxUnusedVar(sim);
+    wxUnusedVar(x);
+    wxUnusedVar(y);
+    wxUnusedVar(button);
+    wxUnusedVar(timeout_ms);
+    return false;
+#endif
+}
+
+WXD_EXPORTED void
+wxd_LatencyProbe_GetStats(const wxd_LatencyProbe_t* probe, wxd_LatencyStats* out)
+{
+    if (!out)
+        return;
+    if (!probe) {
+        *out = wxd_LatencyStats{};
+        return;
+    }
+    probe->Stats(out);
+}
+
+WXD_EXPORTED size_t
+wxd_LatencyProbe_GetSamples(const wxd_LatencyProbe_t* probe, int64_t* to_handler_us,
+                            int64_t* to_paint_us, size_t capacity)
+{
+    return probe ? probe->Samples(to_handler_us, to_paint_us, capacity) : 0;
+}
+
+WXD_EXPORTED void
+wxd_LatencyProbe_Reset(wxd_LatencyProbe_t* probe)
+{
+    if (probe)
+        probe->Reset();
+}
+
+} // extern "C"
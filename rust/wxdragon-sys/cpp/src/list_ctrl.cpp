@@ -2,9 +2,165 @@
 #include <wx/wx.h>
 #include "../include/wxdragon.h"
 #include "../src/wxd_utils.h"
+#include "wxd_typeahead.h"
 #include <wx/imaglist.h>
 #include <wx/listctrl.h>
 #include <wx/string.h> // For wxString::FromUTF8 / wxString::ToUTF8
+#ifdef __WXMSW__
+#include <wx/msw/wrapcctl.h>
+#endif
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// Distinct row styles kept; a screen rarely shows more than a handful.
+constexpr size_t kMaxPooledAttrs = 256;
+
+// Interns wxItemAttr by style so identical rows share one, whatever the row count. wx only
+// uses the returned pointer while drawing that row, so the pool may be dropped when full.
+class ItemAttrPool {
+public:
+    wxItemAttr*
+    Get(const wxd_ListItemAttr& style, const wxFont& base_font)
+    {
+        const Key key{ style.has_text_colour ? PackColour(style.text_colour) : 0,
+                       style.has_bg_colour ? PackColour(style.bg_colour) : 0,
+                       static_cast<uint8_t>(style.has_text_colour | style.has_bg_colour << 1 |
+                                            style.bold << 2 | style.italic << 3) };
+        auto it = m_attrs.find(key);
+        if (it != m_attrs.end())
+            return &it->second;
+        if (m_attrs.size() >= kMaxPooledAttrs)
+            m_attrs.clear();
+        wxItemAttr& attr = m_attrs[key];
+        if (style.has_text_colour)
+            attr.SetTextColour(ToColour(style.text_colour));
+        if (style.has_bg_colour)
+            attr.SetBackgroundColour(ToColour(style.bg_colour));
+        if (style.bold || style.italic) {
+            wxFont font = base_font;
+            if (style.bold)
+                font.MakeBold();
+            if (style.italic)
+                font.MakeItalic();
+            attr.SetFont(font);
+        }
+        return &attr;
+    }
+
+    void
+    Clear()
+    {
+        m_attrs.clear();
+    }
+
+private:
+    struct Key {
+        uint32_t text;
+        uint32_t bg;
+        uint8_t flags;
+
+        bool
+        operator==(const Key& other) const
+        {
+            return text == other.text && bg == other.bg && flags == other.flags;
+        }
+    };
+
+    struct KeyHash {
+        size_t
+        operator()(const Key& key) const
+        {
+            return std::hash<uint64_t>()((static_cast<uint64_t>(key.text) << 32 | key.bg) ^
+                                         static_cast<uint64_t>(key.flags) << 61);
+        }
+    };
+
+    static uint32_t
+    PackColour(const wxd_Colour_t& colour)
+    {
+        return static_cast<uint32_t>(colour.r) << 24 | static_cast<uint32_t>(colour.g) << 16 |
+               static_cast<uint32_t>(colour.b) << 8 | colour.a;
+    }
+
+    static wxColour
+    ToColour(const wxd_Colour_t& colour)
+    {
+        return wxColour(colour.r, colour.g, colour.b, colour.a);
+    }
+
+    std::unordered_map<Key, wxItemAttr, KeyHash> m_attrs;
+};
+
+// Row order for `count` rows by `keys`, stable, NaN doubles last. Empty if the keys are
+// malformed.
+std::vector<long>
+sorted_rows(const wxd_ListSortKeys& keys, long count, bool ascending)
+{
+    std::vector<long> rows(count);
+    for (long i = 0; i < count; ++i) {
+        rows[i] = i;
+    }
+    auto order = [ascending](auto begin, auto end, auto less) {
+        if (ascending)
+            std::stable_sort(begin, end, less);
+        else
+            std::stable_sort(begin, end, [&less](long a, long b) { return less(b, a); });
+    };
+    switch (keys.kind) {
+    case WXD_LIST_SORT_KEY_INT64:
+        if (!keys.int_keys)
+            return {};
+        order(rows.begin(), rows.end(),
+              [&keys](long a, long b) { return keys.int_keys[a] < keys.int_keys[b]; });
+        break;
+    case WXD_LIST_SORT_KEY_DOUBLE: {
+        if (!keys.double_keys)
+            return {};
+        // NaN stays after every number in both directions.
+        auto numbers_end = std::stable_partition(rows.begin(), rows.end(), [&keys](long r) {
+            return !std::isnan(keys.double_keys[r]);
+        });
+        order(rows.begin(), numbers_end,
+              [&keys](long a, long b) { return keys.double_keys[a] < keys.double_keys[b]; });
+        break;
+    }
+    case WXD_LIST_SORT_KEY_UTF8: {
+        if (!keys.text_offsets || (!keys.text && keys.text_offsets[count] > keys.text_offsets[0]))
+            return {};
+        for (long i = 0; i < count; ++i) {
+            if (keys.text_offsets[i + 1] < keys.text_offsets[i])
+                return {};
+        }
+        // Bytewise: callers collate before packing.
+        order(rows.begin(), rows.end(), [&keys](long a, long b) {
+            const uint32_t a_len = keys.text_offsets[a + 1] - keys.text_offsets[a];
+            const uint32_t b_len = keys.text_offsets[b + 1] - keys.text_offsets[b];
+            const uint32_t common = std::min(a_len, b_len);
+            const int cmp = common == 0 ? 0
+                                        : std::memcmp(keys.text + keys.text_offsets[a],
+                                                      keys.text + keys.text_offsets[b], common);
+            return cmp < 0 || (cmp == 0 && a_len < b_len);
+        });
+        break;
+    }
+    default:
+        return {};
+    }
+    return rows;
+}
+
+int wxCALLBACK
+compare_ranks(wxIntPtr item1, wxIntPtr item2, wxIntPtr)
+{
+    return item1 < item2 ? -1 : (item1 > item2 ? 1 : 0);
+}
+
+} // namespace
 
 // --- wxListCtrl ---
 
@@ -20,6 +176,35 @@ public:
     ~WxdListCtrl() override
     {
         ClearVirtualTextCallback();
+        ClearVirtualItemCallbacks();
+    }
+
+    void
+    SetVirtualItemCallbacks(void* userdata, wxd_listctrl_virtual_attr_callback attr,
+                            wxd_listctrl_virtual_image_callback image,
+                            wxd_listctrl_virtual_checked_callback checked,
+                            wxd_listctrl_free_userdata_callback freeUserdata)
+    {
+        ClearVirtualItemCallbacks();
+        m_itemUserdata = userdata;
+        m_attrCallback = attr;
+        m_imageCallback = image;
+        m_checkedCallback = checked;
+        m_freeItemUserdata = freeUserdata;
+    }
+
+    void
+    ClearVirtualItemCallbacks()
+    {
+        if (m_itemUserdata && m_freeItemUserdata) {
+            m_freeItemUserdata(m_itemUserdata);
+        }
+        m_itemUserdata = nullptr;
+        m_attrCallback = nullptr;
+        m_imageCallback = nullptr;
+        m_checkedCallback = nullptr;
+        m_freeItemUserdata = nullptr;
+        m_attrPool.Clear();
     }
 
     void SetVirtualTextCallback(void* userdata, wxd_listctrl_virtual_text_callback callback,
@@ -42,11 +227,40 @@ public:
         m_textCallback = nullptr;
         m_freeString = nullptr;
         m_freeUserdata = nullptr;
+        m_textSource = nullptr;
+        m_prefetch = nullptr;
+    }
+
+    // The borrowed-text form of SetVirtualTextCallback; the two replace each other.
+    void
+    SetVirtualTextSource(void* userdata, wxd_listctrl_virtual_text_source_callback source,
+                         wxd_listctrl_virtual_prefetch_callback prefetch,
+                         wxd_listctrl_free_userdata_callback freeUserdata)
+    {
+        ClearVirtualTextCallback();
+        m_userdata = userdata;
+        m_textSource = source;
+        m_prefetch = prefetch;
+        m_freeUserdata = freeUserdata;
+        if (prefetch && !m_cacheHintBound) {
+            Bind(wxEVT_LIST_CACHE_HINT, &WxdListCtrl::OnCacheHint, this);
+            m_cacheHintBound = true;
+        }
     }
 
 protected:
     wxString OnGetItemText(long item, long column) const override
     {
+        if (m_textSource) {
+            const char* text = nullptr;
+            size_t len = 0;
+            if (!m_textSource(m_userdata, static_cast<int64_t>(item),
+                              static_cast<int32_t>(column), &text, &len) ||
+                !text) {
+                return wxString();
+            }
+            return wxString::FromUTF8(text, len);
+        }
         if (!m_textCallback) {
             return wxListCtrl::OnGetItemText(item, column);
         }
@@ -64,11 +278,67 @@ protected:
         return result;
     }
 
+    wxItemAttr*
+    OnGetItemAttr(long item) const override
+    {
+        if (!m_attrCallback)
+            return wxListCtrl::OnGetItemAttr(item);
+        wxd_ListItemAttr style{};
+        if (!m_attrCallback(m_itemUserdata, static_cast<int64_t>(item), &style))
+            return nullptr;
+        return m_attrPool.Get(style, GetFont());
+    }
+
+    int
+    OnGetItemImage(long item) const override
+    {
+        if (!m_imageCallback)
+            return wxListCtrl::OnGetItemImage(item);
+        return m_imageCallback(m_itemUserdata, static_cast<int64_t>(item), 0);
+    }
+
+    int
+    OnGetItemColumnImage(long item, long column) const override
+    {
+        if (!m_imageCallback)
+            return wxListCtrl::OnGetItemColumnImage(item, column);
+        return m_imageCallback(m_itemUserdata, static_cast<int64_t>(item),
+                               static_cast<int32_t>(column));
+    }
+
+    bool
+    OnGetItemIsChecked(long item) const override
+    {
+        if (!m_checkedCallback)
+            return wxListCtrl::OnGetItemIsChecked(item);
+        return m_checkedCallback(m_itemUserdata, static_cast<int64_t>(item));
+    }
+
 private:
+    // The control announces the rows it is about to paint; let Rust load them in one go.
+    void
+    OnCacheHint(wxListEvent& event)
+    {
+        event.Skip();
+        if (m_prefetch && event.GetCacheFrom() <= event.GetCacheTo())
+            m_prefetch(m_userdata, static_cast<int64_t>(event.GetCacheFrom()),
+                       static_cast<int64_t>(event.GetCacheTo()));
+    }
+
     void* m_userdata;
     wxd_listctrl_virtual_text_callback m_textCallback;
     wxd_listctrl_free_string_callback m_freeString;
     wxd_listctrl_free_userdata_callback m_freeUserdata;
+    wxd_listctrl_virtual_text_source_callback m_textSource = nullptr;
+    wxd_listctrl_virtual_prefetch_callback m_prefetch = nullptr;
+    bool m_cacheHintBound = false;
+
+    void* m_itemUserdata = nullptr;
+    wxd_listctrl_virtual_attr_callback m_attrCallback = nullptr;
+    wxd_listctrl_virtual_image_callback m_imageCallback = nullptr;
+    wxd_listctrl_virtual_checked_callback m_checkedCallback = nullptr;
+    wxd_listctrl_free_userdata_callback m_freeItemUserdata = nullptr;
+    mutable ItemAttrPool m_attrPool;
 };
 
 static WxdListCtrl*
@@ -140,13 +410,59 @@ wxd_ListCtrl_InsertItem_Simple(wxd_ListCtrl_t* self, int64_t index, const char*
     return static_cast<int32_t>(reinterpret_cast<wxListCtrl*>(self)->InsertItem(item));
 }
 
+WXD_EXPORTED int64_t
+wxd_ListCtrl_InsertItemsPacked(wxd_ListCtrl_t* self, int64_t start, int64_t rows, int cols,
+                               const char* utf8, const uint32_t* offsets, const int32_t* images)
+{
+    if (!self || rows < 0 || cols < 1 || !offsets)
+        return 0;
+    wxListCtrl* ctrl = reinterpret_cast<wxListCtrl*>(self);
+    if (ctrl->IsVirtual())
+        return 0;
+    const size_t cells = static_cast<size_t>(rows) * static_cast<size_t>(cols);
+    if (offsets[cells] < offsets[0] || (!utf8 && offsets[cells] > offsets[0]))
+        return 0;
+    long at = static_cast<long>(std::min<int64_t>(std::max<int64_t>(start, 0),
+                                                  ctrl->GetItemCount()));
+    // Sub-item text only lands in existing columns; the label is kept in any view.
+    const int sub_cols = std::min(cols, std::max(ctrl->GetColumnCount(), 1));
+    auto cell = [utf8, offsets](size_t index) {
+        const uint32_t begin = offsets[index];
+        const uint32_t end = std::max(offsets[index + 1], begin);
+        return wxd_cpp_utils::ScratchWxString(utf8 ? utf8 + begin : "", end - begin);
+    };
+
+    ctrl->Freeze();
+#ifdef __WXMSW__
+    // Preallocates the native item storage instead of growing it once per insertion.
+    ListView_SetItemCountEx(static_cast<HWND>(ctrl->GetHWND()), ctrl->GetItemCount() + rows,
+                            LVSICF_NOINVALIDATEALL);
+#endif
+    int64_t inserted = 0;
+    for (int64_t row = 0; row < rows; ++row, ++at) {
+        const size_t first = static_cast<size_t>(row) * cols;
+        const long index = ctrl->InsertItem(at, cell(first), images ? images[row] : -1);
+        if (index < 0)
+            break;
+        at = index;
+        for (int col = 1; col < sub_cols; ++col) {
+            ctrl->SetItem(index, col, cell(first + col));
+        }
+        ++inserted;
+    }
+    ctrl->Thaw();
+    return inserted;
+}
+
 WXD_EXPORTED void
 wxd_ListCtrl_SetItemText(wxd_ListCtrl_t* self, int64_t index, const char* text)
 {
     if (!self)
         return;
     // Use the 2-argument SetItemText (likely for the main item label)
-    reinterpret_cast<wxListCtrl*>(self)->SetItemText(index, wxString::FromUTF8(text ? text : ""));
+    wxListCtrl* ctrl = reinterpret_cast<wxListCtrl*>(self);
+    ctrl->SetItemText(index, wxd_cpp_utils::ScratchWxString(text));
+    wxd_typeahead::rows_changed(ctrl, static_cast<long>(index), static_cast<long>(index));
 }
 
 WXD_EXPORTED int
@@ -453,7 +769,9 @@ wxd_ListCtrl_RefreshItem(wxd_ListCtrl_t* self, int64_t item)
 {
     if (!self)
         return;
-    reinterpret_cast<wxListCtrl*>(self)->RefreshItem(item);
+    wxListCtrl* ctrl = reinterpret_cast<wxListCtrl*>(self);
+    wxd_typeahead::rows_changed(ctrl, static_cast<long>(item), static_cast<long>(item));
+    ctrl->RefreshItem(item);
 }
 
 WXD_EXPORTED void
@@ -461,7 +779,9 @@ wxd_ListCtrl_RefreshItems(wxd_ListCtrl_t* self, int64_t itemFrom, int64_t itemTo
 {
     if (!self)
         return;
-    reinterpret_cast<wxListCtrl*>(self)->RefreshItems(itemFrom, itemTo);
+    wxListCtrl* ctrl = reinterpret_cast<wxListCtrl*>(self);
+    wxd_typeahead::rows_changed(ctrl, static_cast<long>(itemFrom), static_cast<long>(itemTo));
+    ctrl->RefreshItems(itemFrom, itemTo);
 }
 
 WXD_EXPORTED bool
@@ -475,6 +795,22 @@ wxd_ListCtrl_SetVirtualTextCallback(wxd_ListCtrl_t* self, void* userdata,
         return false;
 
     listCtrl->SetVirtualTextCallback(userdata, callback, freeString, freeUserdata);
+    wxd_typeahead::invalidate(listCtrl);
+    return true;
+}
+
+WXD_EXPORTED bool
+wxd_ListCtrl_SetVirtualTextSource(wxd_ListCtrl_t* self, void* userdata,
+                                  wxd_listctrl_virtual_text_source_callback source,
+                                  wxd_listctrl_virtual_prefetch_callback prefetch,
+                                  wxd_listctrl_free_userdata_callback freeUserdata)
+{
+    WxdListCtrl* listCtrl = wxd_as_custom_list_ctrl(self);
+    if (!listCtrl || !userdata || !source)
+        return false;
+
+    listCtrl->SetVirtualTextSource(userdata, source, prefetch, freeUserdata);
+    wxd_typeahead::invalidate(listCtrl);
     return true;
 }
 
@@ -488,6 +824,33 @@ wxd_ListCtrl_ClearVirtualTextCallback(wxd_ListCtrl_t* self)
     listCtrl->ClearVirtualTextCallback();
 }
 
+WXD_EXPORTED bool
+wxd_ListCtrl_SetVirtualItemCallbacks(wxd_ListCtrl_t* self, void* userdata,
+                                     wxd_listctrl_virtual_attr_callback attr,
+                                     wxd_listctrl_virtual_image_callback image,
+                                     wxd_listctrl_virtual_checked_callback checked,
+                                     wxd_listctrl_free_userdata_callback freeUserdata)
+{
+    WxdListCtrl* listCtrl = wxd_as_custom_list_ctrl(self);
+    if (!listCtrl)
+        return false;
+
+    listCtrl->SetVirtualItemCallbacks(userdata, attr, image, checked, freeUserdata);
+    listCtrl->Refresh();
+    return true;
+}
+
+WXD_EXPORTED void
+wxd_ListCtrl_ClearVirtualItemCallbacks(wxd_ListCtrl_t* self)
+{
+    WxdListCtrl* listCtrl = wxd_as_custom_list_ctrl(self);
+    if (!listCtrl)
+        return;
+
+    listCtrl->ClearVirtualItemCallbacks();
+    listCtrl->Refresh();
+}
+
 // Sorting - This is a bit tricky because of the callback
 // We'll need a mapping system or to adapt this for Rust usage
 struct SortCallbackData {
@@ -522,6 +885,39 @@ wxd_ListCtrl_SortItems(wxd_ListCtrl_t* self, int (*cmpFunc)(void*, void*, void*)
     // Clean up after sorting is done
     delete cbData;
 
+    wxd_typeahead::invalidate(reinterpret_cast<wxListCtrl*>(self));
+    return result;
+}
+
+WXD_EXPORTED bool
+wxd_ListCtrl_SortItemsByKeys(wxd_ListCtrl_t* self, const wxd_ListSortKeys* keys, int64_t count,
+                             bool ascending)
+{
+    if (!self || !keys)
+        return false;
+    wxListCtrl* ctrl = reinterpret_cast<wxListCtrl*>(self);
+    const long rows = ctrl->GetItemCount();
+    if (ctrl->IsVirtual() || count != rows)
+        return false;
+    const std::vector<long> order = sorted_rows(*keys, rows, ascending);
+    if (order.size() != static_cast<size_t>(rows))
+        return false;
+
+    // wx only reorders through item data, so swap in each row's rank, let the native sort
+    // compare plain integers, then put the original data back on the moved rows.
+    std::vector<wxUIntPtr> data(rows);
+    for (long row = 0; row < rows; ++row) {
+        data[row] = ctrl->GetItemData(row);
+    }
+    for (long rank = 0; rank < rows; ++rank) {
+        ctrl->SetItemPtrData(order[rank], static_cast<wxUIntPtr>(rank));
+    }
+    const bool result = ctrl->SortItems(compare_ranks, 0);
+    for (long row = 0; row < rows; ++row) {
+        const long rank = static_cast<long>(ctrl->GetItemData(row));
+        ctrl->SetItemPtrData(row, data[rank >= 0 && rank < rows ? order[rank] : row]);
+    }
+    wxd_typeahead::invalidate(ctrl);
     return result;
 }
 
@@ -600,7 +996,7 @@ wxd_ListCtrl_SetItem(wxd_ListCtrl_t* self, int64_t item, int col, const char* te
     listItem.SetColumn(col);
 
     if (mask & wxLIST_MASK_TEXT) {
-        listItem.SetText(wxString::FromUTF8(text ? text : ""));
+        listItem.SetText(wxd_cpp_utils::ScratchWxString(text));
     }
 
     if (mask & wxLIST_MASK_IMAGE) {
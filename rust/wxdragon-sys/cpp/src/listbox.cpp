@@ -7,6 +7,7 @@
 #include "wx/defs.h" // For wxNOT_FOUND
 #include "../include/wxdragon.h"
 #include "wxd_utils.h"
+#include <wx/wupdlock.h>
 
 // Helper to convert wxd_Point to wxPoint
 static inline wxPoint
@@ -26,8 +27,8 @@ wxd_ListBox_Create(wxd_Window_t* parent, wxd_Id id, wxd_Point pos, wxd_Size size
     if (!parentWin)
         return nullptr;
 
-    wxListBox* listbox = new wxListBox(parentWin, id, wxd_cpp_utils::to_wx(pos),
-                                       wxd_cpp_utils::to_wx(size), 0, nullptr, style);
+    wxListBox* listbox = new wxListBox(parentWin, id, wxd_cpp_utils::to_wx(pos, parentWin),
+                                       wxd_cpp_utils::to_wx(size, parentWin), 0, nullptr, style);
     return (wxd_ListBox_t*)listbox;
 }
 
@@ -49,6 +50,34 @@ wxd_ListBox_Insert(wxd_ListBox_t* listbox, const char* item, unsigned int pos)
     }
 }
 
+WXD_EXPORTED bool
+wxd_ListBox_SetItems(wxd_ListBox_t* listbox, const char* packed, const uint32_t* offsets,
+                     size_t count)
+{
+    wxListBox* lb = (wxListBox*)listbox;
+    wxArrayString items;
+    if (!lb || !wxd_cpp_utils::unpack_utf8_array(packed, offsets, count, items))
+        return false;
+    wxWindowUpdateLocker freeze(lb);
+    lb->Set(items);
+    return true;
+}
+
+WXD_EXPORTED bool
+wxd_ListBox_AppendItems(wxd_ListBox_t* listbox, const char* packed, const uint32_t* offsets,
+                        size_t count)
+{
+    wxListBox* lb = (wxListBox*)listbox;
+    wxArrayString items;
+    if (!lb || !wxd_cpp_utils::unpack_utf8_array(packed, offsets, count, items))
+        return false;
+    if (items.empty())
+        return true;
+    wxWindowUpdateLocker freeze(lb);
+    lb->Append(items);
+    return true;
+}
+
 WXD_EXPORTED void
 wxd_ListBox_Clear(wxd_ListBox_t* listbox)
 {
@@ -0,0 +1,125 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_logconsole.h"
+#include <unordered_map>
+
+namespace {
+
+// One frame at 60 Hz: bursts coalesce into a single native update per frame.
+constexpr int kFlushIntervalMs = 16;
+
+// GUI-thread only.
+std::unordered_map<wxWindow*, wxdLogConsole*> s_consoles;
+
+void
+on_console_window_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    // Match by identity: the control's derived parts are already gone.
+    auto found = s_consoles.find(static_cast<wxWindow*>(event.GetEventObject()));
+    if (found == s_consoles.end())
+        return;
+    delete found->second;
+    s_consoles.erase(found);
+}
+
+// Start of the last `lines` lines of `text`, or 0 if it has no more than that. A trailing
+// newline does not start a line.
+size_t
+tail_start(const std::string& text, int lines)
+{
+    int seen = 0;
+    for (size_t i = text.size() - 1; i > 0; --i) {
+        if (text[i - 1] == '\n' && ++seen == lines)
+            return i;
+    }
+    return 0;
+}
+
+} // namespace
+
+wxdLogConsole::wxdLogConsole(wxWindow* window) : m_window(window)
+{
+    m_timer.Bind(wxEVT_TIMER, &wxdLogConsole::OnTimer, this);
+}
+
+wxdLogConsole::~wxdLogConsole()
+{
+    m_timer.Stop();
+}
+
+void
+wxdLogConsole::Attach(wxdLogConsole* console)
+{
+    Detach(console->m_window);
+    s_consoles[console->m_window] = console;
+    console->m_window->Bind(wxEVT_DESTROY, &on_console_window_destroy);
+}
+
+void
+wxdLogConsole::Detach(wxWindow* window)
+{
+    auto found = s_consoles.find(window);
+    if (found == s_consoles.end())
+        return;
+    wxdLogConsole* console = found->second;
+    s_consoles.erase(found);
+    window->Unbind(wxEVT_DESTROY, &on_console_window_destroy);
+    console->Flush();
+    console->OnDetach();
+    delete console;
+}
+
+wxdLogConsole*
+wxdLogConsole::Get(wxWindow* window)
+{
+    auto found = s_consoles.find(window);
+    return found == s_consoles.end() ? nullptr : found->second;
+}
+
+void
+wxdLogConsole::Append(const char* text, size_t len)
+{
+    if (!text || len == 0)
+        return;
+    m_pending.append(text, len);
+    if (!m_timer.IsRunning())
+        m_timer.StartOnce(kFlushIntervalMs);
+}
+
+void
+wxdLogConsole::Flush()
+{
+    m_timer.Stop();
+    if (m_pending.empty())
+        return;
+
+    const bool follow = IsCaretAtEnd();
+    m_window->Freeze();
+    // A burst longer than the limit replaces everything: skip inserting lines that would be
+    // trimmed again straight away.
+    const size_t keep_from = m_max_lines > 0 ? tail_start(m_pending, m_max_lines) : 0;
+    if (keep_from > 0) {
+        ClearText();
+        AppendUtf8(m_pending.substr(keep_from));
+    }
+    else {
+        AppendUtf8(m_pending);
+    }
+    m_pending.clear();
+    if (m_max_lines > 0) {
+        const int excess = GetLineCount() - m_max_lines;
+        if (excess > 0)
+            RemoveHeadLines(excess);
+    }
+    if (follow)
+        ScrollToEnd();
+    m_window->Thaw();
+}
+
+void
+wxdLogConsole::OnTimer(wxTimerEvent&)
+{
+    Flush();
+}
@@ -0,0 +1,459 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "wxd_mapped_catalog.h"
+#include "wxd_mapped_file.h"
+#include <cctype>
+#include <cstdlib>
+#include <string>
+
+namespace {
+
+constexpr uint32_t kMoMagic = 0x950412de;
+constexpr uint32_t kMoMagicSwapped = 0xde120495;
+constexpr size_t kMoHeaderSize = 28;
+constexpr size_t kMaxPluralNodes = 256;
+
+// The string hash gettext uses for .mo hash tables.
+uint32_t
+hash_pjw(std::string_view text)
+{
+    uint32_t hash = 0;
+    for (unsigned char c : text) {
+        hash = (hash << 4) + c;
+        const uint32_t high = hash & 0xf0000000u;
+        if (high) {
+            hash ^= high >> 24;
+            hash ^= high;
+        }
+    }
+    return hash;
+}
+
+// A plural msgid is stored as "singular\0plural"; lookups match the singular.
+std::string_view
+singular_of(std::string_view msgid)
+{
+    return msgid.substr(0, msgid.find('\0'));
+}
+
+std::string_view
+header_field(std::string_view header, std::string_view name)
+{
+    size_t pos = 0;
+    while (pos < header.size()) {
+        size_t end = header.find('\n', pos);
+        if (end == std::string_view::npos)
+            end = header.size();
+        const std::string_view line = header.substr(pos, end - pos);
+        if (line.size() > name.size() && line.compare(0, name.size(), name) == 0 &&
+            line[name.size()] == ':')
+            return line.substr(name.size() + 1);
+        pos = end + 1;
+    }
+    return std::string_view();
+}
+
+// Recursive-descent parser for the C subset used by Plural-Forms expressions.
+class PluralParser {
+public:
+    using Node = wxdMappedCatalog::PluralNode;
+
+    PluralParser(std::string_view text, std::vector<Node>& nodes) : m_text(text), m_nodes(nodes) {}
+
+    int
+    Parse()
+    {
+        const int root = Ternary();
+        SkipSpace();
+        return m_pos == m_text.size() ? root : -1;
+    }
+
+private:
+    void
+    SkipSpace()
+    {
+        while (m_pos < m_text.size() && std::isspace(static_cast<unsigned char>(m_text[m_pos])))
+            ++m_pos;
+    }
+
+    bool
+    Accept(std::string_view token)
+    {
+        SkipSpace();
+        if (m_text.compare(m_pos, token.size(), token) != 0)
+            return false;
+        m_pos += token.size();
+        return true;
+    }
+
+    int
+    Add(char op, int a = -1, int b = -1, int c = -1, unsigned long value = 0)
+    {
+        if ((op != 'n' && op != '#' && (a < 0 || (op != '!' && b < 0))) ||
+            m_nodes.size() >= kMaxPluralNodes)
+            return -1;
+        m_nodes.push_back({ op, value, a, b, c });
+        return static_cast<int>(m_nodes.size()) - 1;
+    }
+
+    int
+    Ternary()
+    {
+        const int cond = Or();
+        if (cond < 0 || !Accept("?"))
+            return cond;
+        const int yes = Ternary();
+        if (yes < 0 || !Accept(":"))
+            return -1;
+        const int no = Ternary();
+        return no < 0 ? -1 : Add('?', cond, yes, no);
+    }
+
+    int
+    Or()
+    {
+        int left = And();
+        while (left >= 0 && Accept("||"))
+            left = Add('|', left, And());
+        return left;
+    }
+
+    int
+    And()
+    {
+        int left = Equality();
+        while (left >= 0 && Accept("&&"))
+            left = Add('&', left, Equality());
+        return left;
+    }
+
+    int
+    Equality()
+    {
+        int left = Relational();
+        while (left >= 0) {
+            if (Accept("=="))
+                left = Add('e', left, Relational());
+            else if (Accept("!="))
+                left = Add('d', left, Relational());
+            else
+                break;
+        }
+        return left;
+    }
+
+    int
+    Relational()
+    {
+        int left = Additive();
+        while (left >= 0) {
+            if (Accept("<="))
+                left = Add('l', left, Additive());
+            else if (Accept(">="))
+                left = Add('g', left, Additive());
+            else if (Accept("<"))
+                left = Add('<', left, Additive());
+            else if (Accept(">"))
+                left = Add('>', left, Additive());
+            else
+                break;
+        }
+        return left;
+    }
+
+    int
+    Additive()
+    {
+        int left = Multiplicative();
+        while (left >= 0) {
+            if (Accept("+"))
+                left = Add('+', left, Multiplicative());
+            else if (Accept("-"))
+                left = Add('-', left, Multiplicative());
+            else
+                break;
+        }
+        return left;
+    }
+
+    int
+    Multiplicative()
+    {
+        int left = Unary();
+        while (left >= 0) {
+            if (Accept("*"))
+                left = Add('*', left, Unary());
+            else if (Accept("/"))
+                left = Add('/', left, Unary());
+            else if (Accept("%"))
+                left = Add('%', left, Unary());
+            else
+                break;
+        }
+        return left;
+    }
+
+    int
+    Unary()
+    {
+        if (Accept("!"))
+            return Add('!', Unary());
+        return Primary();
+    }
+
+    int
+    Primary()
+    {
+        if (Accept("(")) {
+            const int inner = Ternary();
+            return inner >= 0 && Accept(")") ? inner : -1;
+        }
+        if (Accept("n"))
+            return Add('n');
+        SkipSpace();
+        if (m_pos >= m_text.size() || !std::isdigit(static_cast<unsigned char>(m_text[m_pos])))
+            return -1;
+        unsigned long value = 0;
+        while (m_pos < m_text.size() && std::isdigit(static_cast<unsigned char>(m_text[m_pos])))
+            value = value * 10 + static_cast<unsigned long>(m_text[m_pos++] - '0');
+        return Add('#', -1, -1, -1, value);
+    }
+
+    std::string_view m_text;
+    size_t m_pos = 0;
+    std::vector<Node>& m_nodes;
+};
+
+} // namespace
+
+std::unique_ptr<wxdMappedCatalog>
+wxdMappedCatalog::FromFile(const wxString& path)
+{
+    auto file = std::make_shared<wxdMappedFile>();
+    if (!file->Open(path))
+        return nullptr;
+    const uint8_t* data = file->Data();
+    const size_t size = file->Size();
+    return FromData(data, size, std::move(file));
+}
+
+std::unique_ptr<wxdMappedCatalog>
+wxdMappedCatalog::FromData(const uint8_t* data, size_t len, std::shared_ptr<const void> keepalive)
+{
+    std::unique_ptr<wxdMappedCatalog> catalog(new wxdMappedCatalog);
+    catalog->m_keepalive = std::move(keepalive);
+    catalog->m_data = data;
+    catalog->m_size = len;
+    if (!data || !catalog->Init())
+        return nullptr;
+    return catalog;
+}
+
+wxdMappedCatalog::~wxdMappedCatalog() = default;
+
+uint32_t
+wxdMappedCatalog::Word(size_t offset) const
+{
+    const uint8_t* p = m_data + offset;
+    if (m_swap)
+        return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | p[3];
+    return (uint32_t(p[3]) << 24) | (uint32_t(p[2]) << 16) | (uint32_t(p[1]) << 8) | p[0];
+}
+
+bool
+wxdMappedCatalog::Init()
+{
+    if (m_size < kMoHeaderSize)
+        return false;
+    const uint32_t magic = Word(0);
+    if (magic == kMoMagicSwapped)
+        m_swap = true;
+    else if (magic != kMoMagic)
+        return false;
+    if ((Word(4) >> 16) > 1)
+        return false;
+
+    m_count = Word(8);
+    m_origTable = Word(12);
+    m_transTable = Word(16);
+    m_hashSize = Word(20);
+    m_hashTable = Word(24);
+    const uint64_t size = m_size;
+    if (uint64_t(m_origTable) + uint64_t(m_count) * 8 > size ||
+        uint64_t(m_transTable) + uint64_t(m_count) * 8 > size ||
+        uint64_t(m_hashTable) + uint64_t(m_hashSize) * 4 > size)
+        return false;
+
+    // The header is the translation of the empty msgid.
+    std::string_view header;
+    if (!Lookup(std::string_view(), &header))
+        return true;
+
+    std::string_view charset = header_field(header, "Content-Type");
+    const size_t at = charset.find("charset=");
+    if (at != std::string_view::npos) {
+        charset = charset.substr(at + 8);
+        charset = charset.substr(0, charset.find_first_of(" ;\t\r"));
+        const wxString name = wxString::FromUTF8(charset.data(), charset.size()).Lower();
+        if (name != "utf-8" && name != "utf8" && name != "us-ascii" && name != "ascii" &&
+            name != "charset")
+            return false;
+    }
+    return ParsePluralForms(header_field(header, "Plural-Forms"));
+}
+
+bool
+wxdMappedCatalog::ParsePluralForms(std::string_view forms)
+{
+    if (forms.empty())
+        return true;
+    const size_t nplurals = forms.find("nplurals=");
+    const size_t plural = forms.find("plural=", nplurals == std::string_view::npos ? 0
+                                                                                  : nplurals + 9);
+    if (nplurals == std::string_view::npos || plural == std::string_view::npos)
+        return false;
+    m_nplurals = static_cast<unsigned>(std::strtoul(
+        std::string(forms.substr(nplurals + 9, 8)).c_str(), nullptr, 10));
+    std::string_view expression = forms.substr(plural + 7);
+    expression = expression.substr(0, expression.find(';'));
+    m_pluralRoot = PluralParser(expression, m_plural).Parse();
+    if (m_nplurals == 0 || m_pluralRoot < 0) {
+        m_plural.clear();
+        m_pluralRoot = -1;
+        m_nplurals = 2;
+        return false;
+    }
+    return true;
+}
+
+unsigned long
+wxdMappedCatalog::EvalPlural(int index, unsigned long n) const
+{
+    const PluralNode& node = m_plural[index];
+    switch (node.op) {
+    case 'n':
+        return n;
+    case '#':
+        return node.value;
+    case '!':
+        return !EvalPlural(node.a, n);
+    case '?':
+        return EvalPlural(node.a, n) ? EvalPlural(node.b, n) : EvalPlural(node.c, n);
+    case '&':
+        return EvalPlural(node.a, n) && EvalPlural(node.b, n);
+    case '|':
+        return EvalPlural(node.a, n) || EvalPlural(node.b, n);
+    default:
+        break;
+    }
+    const unsigned long a = EvalPlural(node.a, n);
+    const unsigned long b = EvalPlural(node.b, n);
+    switch (node.op) {
+    case '*':
+        return a * b;
+    case '/':
+        return b ? a / b : 0;
+    case '%':
+        return b ? a % b : 0;
+    case '+':
+        return a + b;
+    case '-':
+        return a - b;
+    case '<':
+        return a < b;
+    case '>':
+        return a > b;
+    case 'l':
+        return a <= b;
+    case 'g':
+        return a >= b;
+    case 'e':
+        return a == b;
+    case 'd':
+        return a != b;
+    default:
+        return 0;
+    }
+}
+
+bool
+wxdMappedCatalog::String(uint32_t table, uint32_t index, std::string_view* out) const
+{
+    const size_t entry = size_t(table) + size_t(index) * 8;
+    const uint32_t len = Word(entry);
+    const uint32_t offset = Word(entry + 4);
+    if (offset > m_size || len > m_size - offset)
+        return false;
+    *out = std::string_view(reinterpret_cast<const char*>(m_data) + offset, len);
+    return true;
+}
+
+bool
+wxdMappedCatalog::Lookup(std::string_view msgid, std::string_view* translation) const
+{
+    std::string_view orig;
+    if (m_hashSize > 2) {
+        const uint32_t hash = hash_pjw(msgid);
+        uint32_t slot = hash % m_hashSize;
+        const uint32_t step = 1 + hash % (m_hashSize - 2);
+        for (uint32_t probes = 0; probes < m_hashSize; ++probes) {
+            const uint32_t entry = Word(size_t(m_hashTable) + size_t(slot) * 4);
+            if (entry == 0)
+                return false;
+            if (entry - 1 < m_count && String(m_origTable, entry - 1, &orig) &&
+                singular_of(orig) == msgid)
+                return String(m_transTable, entry - 1, translation);
+            slot = slot >= m_hashSize - step ? slot - (m_hashSize - step) : slot + step;
+        }
+        return false;
+    }
+
+    // No hash table: msgfmt sorts the msgids.
+    uint32_t lo = 0, hi = m_count;
+    while (lo < hi) {
+        const uint32_t mid = lo + (hi - lo) / 2;
+        if (!String(m_origTable, mid, &orig))
+            return false;
+        const int cmp = singular_of(orig).compare(msgid);
+        if (cmp == 0)
+            return String(m_transTable, mid, translation);
+        if (cmp < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return false;
+}
+
+bool
+wxdMappedCatalog::Find(std::string_view msgid, std::string_view* out) const
+{
+    std::string_view translation;
+    if (msgid.empty() || !Lookup(msgid, &translation))
+        return false;
+    *out = singular_of(translation);
+    return true;
+}
+
+bool
+wxdMappedCatalog::FindPlural(std::string_view msgid, unsigned n, std::string_view* out) const
+{
+    std::string_view translation;
+    if (msgid.empty() || !Lookup(msgid, &translation))
+        return false;
+    unsigned long form = m_pluralRoot >= 0 ? EvalPlural(m_pluralRoot, n) : (n != 1);
+    if (form >= m_nplurals)
+        form = 0;
+    // Forms are separated by NULs; fall back to the first if the entry has fewer.
+    std::string_view rest = translation;
+    for (unsigned long i = 0; i < form; ++i) {
+        const size_t nul = rest.find('\0');
+        if (nul == std::string_view::npos) {
+            rest = translation;
+            break;
+        }
+        rest = rest.substr(nul + 1);
+    }
+    *out = singular_of(rest);
+    return true;
+}
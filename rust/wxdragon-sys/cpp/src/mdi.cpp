@@ -10,10 +10,11 @@ WXD_EXPORTED wxd_Frame_t*
 wxd_MDIParentFrame_Create(wxd_Window_t* parent, wxd_Id id, const char* title, wxd_Point pos,
                           wxd_Size size, wxd_Style_t style, const char* name)
 {
+    wxWindow* parentWin = reinterpret_cast<wxWindow*>(parent);
     wxMDIParentFrame* frame = new wxMDIParentFrame(
-        reinterpret_cast<wxWindow*>(parent), id, 
+        parentWin, id, 
         wxString::FromUTF8(title ? title : ""),
-        wxd_cpp_utils::to_wx(pos), wxd_cpp_utils::to_wx(size),
+        wxd_cpp_utils::to_wx(pos, parentWin), wxd_cpp_utils::to_wx(size, parentWin),
         style, wxString::FromUTF8(name ? name : "")
     );
     return reinterpret_cast<wxd_Frame_t*>(frame);
@@ -27,7 +28,7 @@ wxd_MDIChildFrame_Create(wxd_Frame_t* parent, wxd_Id id, const char* title, wxd_
     wxMDIChildFrame* frame = new wxMDIChildFrame(
         parentFrame, id, 
         wxString::FromUTF8(title ? title : ""),
-        wxd_cpp_utils::to_wx(pos), wxd_cpp_utils::to_wx(size),
+        wxd_cpp_utils::to_wx(pos, parentFrame), wxd_cpp_utils::to_wx(size, parentFrame),
         style, wxString::FromUTF8(name ? name : "")
     );
     return reinterpret_cast<wxd_Frame_t*>(frame);
@@ -0,0 +1,391 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_cache_registry.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#if defined(__WINDOWS__)
+#include <wx/msw/wrapwin.h>
+#elif defined(__APPLE__)
+#include <dispatch/dispatch.h>
+#elif defined(__linux__)
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+// Cache registry and the OS low-memory watcher. The watchers run where the OS delivers the
+// signal (a wait thread on Windows and Linux, the main dispatch queue on macOS) and hand the
+// trim to the main thread, which owns the caches.
+
+namespace {
+
+std::mutex&
+registry_mutex()
+{
+    static std::mutex m;
+    return m;
+}
+
+// Leaked like the caches in it, which live until exit.
+std::vector<wxd_cache_registry::Cache*>&
+registry()
+{
+    static auto* caches = new std::vector<wxd_cache_registry::Cache*>();
+    return *caches;
+}
+
+// Copied so a cache may register from inside another's lock without ordering against this one.
+std::vector<wxd_cache_registry::Cache*>
+snapshot()
+{
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    return registry();
+}
+
+struct Watch {
+    wxd_MemoryPressureCallback callback = nullptr;
+    void* user_data = nullptr;
+    void (*free_user_data)(void*) = nullptr;
+
+    ~Watch()
+    {
+        if (free_user_data)
+            free_user_data(user_data);
+    }
+};
+
+std::unique_ptr<Watch> s_watch;
+// Bumped per watch so a signal queued before an unwatch is ignored.
+std::atomic<unsigned> s_generation{ 0 };
+
+void
+on_pressure(unsigned generation, wxd_TrimLevel level)
+{
+    if (!s_watch || generation != s_generation.load())
+        return;
+    wxd_cache_registry::trim_all(level);
+    if (s_watch->callback)
+        s_watch->callback(level, s_watch->user_data);
+}
+
+// Any thread.
+void
+post_pressure(unsigned generation, wxd_TrimLevel level)
+{
+    if (wxTheApp)
+        wxTheApp->CallAfter([generation, level]() { on_pressure(generation, level); });
+}
+
+#if defined(__WINDOWS__)
+
+// The low-memory notification stays signalled while memory is low, so after each trim the
+// thread waits this long before looking again; still low then means the trim was not enough.
+constexpr DWORD kRecheckMs = 10000;
+
+class Watcher {
+public:
+    bool
+    Start(unsigned generation)
+    {
+        m_low = CreateMemoryResourceNotification(LowMemoryResourceNotification);
+        m_stop = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        if (!m_low || !m_stop) {
+            Close();
+            return false;
+        }
+        m_thread = std::thread([this, generation]() { Run(generation); });
+        return true;
+    }
+
+    ~Watcher()
+    {
+        if (m_thread.joinable()) {
+            SetEvent(m_stop);
+            m_thread.join();
+        }
+        Close();
+    }
+
+private:
+    void
+    Run(unsigned generation)
+    {
+        wxd_TrimLevel level = WXD_TRIM_MODERATE;
+        for (;;) {
+            HANDLE handles[2] = { m_stop, m_low };
+            if (WaitForMultipleObjects(2, handles, FALSE, INFINITE) != WAIT_OBJECT_0 + 1)
+                return;
+            post_pressure(generation, level);
+            if (WaitForSingleObject(m_stop, kRecheckMs) != WAIT_TIMEOUT)
+                return;
+            BOOL low = FALSE;
+            QueryMemoryResourceNotification(m_low, &low);
+            level = low ? WXD_TRIM_CRITICAL : WXD_TRIM_MODERATE;
+        }
+    }
+
+    void
+    Close()
+    {
+        if (m_low)
+            CloseHandle(m_low);
+        if (m_stop)
+            CloseHandle(m_stop);
+        m_low = m_stop = nullptr;
+    }
+
+    HANDLE m_low = nullptr;
+    HANDLE m_stop = nullptr;
+    std::thread m_thread;
+};
+
+#elif defined(__APPLE__)
+
+class Watcher {
+public:
+    bool
+    Start(unsigned generation)
+    {
+        m_generation = generation;
+        m_source = dispatch_source_create(DISPATCH_SOURCE_TYPE_MEMORYPRESSURE, 0,
+                                          DISPATCH_MEMORYPRESSURE_WARN |
+                                              DISPATCH_MEMORYPRESSURE_CRITICAL,
+                                          dispatch_get_main_queue());
+        if (!m_source)
+            return false;
+        dispatch_set_context(m_source, this);
+        dispatch_source_set_event_handler_f(m_source, &Watcher::Fire);
+        dispatch_resume(m_source);
+        return true;
+    }
+
+    ~Watcher()
+    {
+        if (m_source) {
+            dispatch_source_cancel(m_source);
+            dispatch_release(m_source);
+        }
+    }
+
+private:
+    // Runs on the main queue, so the trim can happen right here.
+    static void
+    Fire(void* context)
+    {
+        Watcher* self = static_cast<Watcher*>(context);
+        const unsigned long flags = dispatch_source_get_data(self->m_source);
+        on_pressure(self->m_generation, flags & DISPATCH_MEMORYPRESSURE_CRITICAL
+                                            ? WXD_TRIM_CRITICAL
+                                            : WXD_TRIM_MODERATE);
+    }
+
+    dispatch_source_t m_source = nullptr;
+    unsigned m_generation = 0;
+};
+
+#elif defined(__linux__)
+
+// PSI triggers: "some" fires when any task stalled on memory for 150 ms within a 2 s window,
+// "full" when all non-idle tasks did for 100 ms. Unprivileged processes may only use windows
+// that are multiples of 2 s.
+constexpr char kModerateTrigger[] = "some 150000 2000000";
+constexpr char kCriticalTrigger[] = "full 100000 2000000";
+
+int
+open_trigger(const char* trigger)
+{
+    int fd = open("/proc/pressure/memory", O_RDWR | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0)
+        return -1;
+    // The kernel expects the terminating NUL as part of the write.
+    if (write(fd, trigger, std::strlen(trigger) + 1) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+class Watcher {
+public:
+    bool
+    Start(unsigned generation)
+    {
+        m_moderate = open_trigger(kModerateTrigger);
+        if (m_moderate < 0)
+            return false;
+        m_critical = open_trigger(kCriticalTrigger);
+        if (pipe2(m_stop, O_CLOEXEC) != 0) {
+            m_stop[0] = m_stop[1] = -1;
+            Close();
+            return false;
+        }
+        m_thread = std::thread([this, generation]() { Run(generation); });
+        return true;
+    }
+
+    ~Watcher()
+    {
+        if (m_thread.joinable()) {
+            const char byte = 0;
+            while (write(m_stop[1], &byte, 1) < 0 && errno == EINTR) {
+            }
+            m_thread.join();
+        }
+        Close();
+    }
+
+private:
+    void
+    Run(unsigned generation)
+    {
+        pollfd fds[3] = { { m_stop[0], POLLIN, 0 },
+                          { m_moderate, POLLPRI, 0 },
+                          { m_critical, POLLPRI, 0 } };
+        const nfds_t count = m_critical >= 0 ? 3 : 2;
+        for (;;) {
+            if (poll(fds, count, -1) < 0) {
+                if (errno == EINTR)
+                    continue;
+                return;
+            }
+            if (fds[0].revents)
+                return;
+            // POLLERR means the trigger went away (e.g. the cgroup was removed).
+            if ((fds[1].revents | (count > 2 ? fds[2].revents : 0)) & POLLERR)
+                return;
+            if (count > 2 && (fds[2].revents & POLLPRI))
+                post_pressure(generation, WXD_TRIM_CRITICAL);
+            else if (fds[1].revents & POLLPRI)
+                post_pressure(generation, WXD_TRIM_MODERATE);
+        }
+    }
+
+    void
+    Close()
+    {
+        for (int fd : { m_moderate, m_critical, m_stop[0], m_stop[1] }) {
+            if (fd >= 0)
+                close(fd);
+        }
+        m_moderate = m_critical = m_stop[0] = m_stop[1] = -1;
+    }
+
+    int m_moderate = -1;
+    int m_critical = -1;
+    int m_stop[2] = { -1, -1 };
+    std::thread m_thread;
+};
+
+#else
+
+class Watcher {
+public:
+    bool
+    Start(unsigned)
+    {
+        return false;
+    }
+};
+
+#endif
+
+std::unique_ptr<Watcher> s_watcher;
+
+} // namespace
+
+namespace wxd_cache_registry {
+
+Cache::Cache(const char* name) : m_name(name)
+{
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    registry().push_back(this);
+}
+
+Cache::~Cache()
+{
+    std::lock_guard<std::mutex> lock(registry_mutex());
+    auto& caches = registry();
+    caches.erase(std::remove(caches.begin(), caches.end(), this), caches.end());
+}
+
+size_t
+trim_all(wxd_TrimLevel level)
+{
+    size_t released = 0;
+    for (Cache* cache : snapshot()) {
+        const size_t before = cache->CacheBytes();
+        cache->Trim(level);
+        const size_t after = cache->CacheBytes();
+        if (after < before)
+            released += before - after;
+    }
+    return released;
+}
+
+} // namespace wxd_cache_registry
+
+extern "C" {
+
+WXD_EXPORTED size_t
+wxd_App_TrimMemory(wxd_TrimLevel level)
+{
+    return wxd_cache_registry::trim_all(level);
+}
+
+WXD_EXPORTED size_t
+wxd_App_GetCacheBytes(void)
+{
+    size_t bytes = 0;
+    for (const wxd_cache_registry::Cache* cache : snapshot())
+        bytes += cache->CacheBytes();
+    return bytes;
+}
+
+WXD_EXPORTED size_t
+wxd_App_GetCacheUsage(wxd_CacheUsage* out, size_t capacity)
+{
+    const auto caches = snapshot();
+    for (size_t i = 0; out && i < std::min(capacity, caches.size()); ++i) {
+        out[i].name = caches[i]->CacheName();
+        out[i].bytes = caches[i]->CacheBytes();
+        out[i].entries = caches[i]->CacheEntries();
+    }
+    return caches.size();
+}
+
+WXD_EXPORTED bool
+wxd_App_WatchMemoryPressure(wxd_MemoryPressureCallback callback, void* user_data,
+                            void (*free_user_data)(void*))
+{
+    wxd_App_UnwatchMemoryPressure();
+    auto watch = std::make_unique<Watch>();
+    watch->callback = callback;
+    watch->user_data = user_data;
+    watch->free_user_data = free_user_data;
+    auto watcher = std::make_unique<Watcher>();
+    if (!watcher->Start(++s_generation)) {
+        watch->free_user_data = nullptr; // the caller keeps ownership on failure
+        return false;
+    }
+    s_watch = std::move(watch);
+    s_watcher = std::move(watcher);
+    return true;
+}
+
+WXD_EXPORTED void
+wxd_App_UnwatchMemoryPressure(void)
+{
+    // Stop the watcher first so nothing new is posted, then drop the callback.
+    s_watcher.reset();
+    ++s_generation;
+    s_watch.reset();
+}
+
+} // extern "C"
@@ -1,9 +1,53 @@
 #include <wx/wxprec.h>
 #include <wx/wx.h>
 #include "../include/wxdragon.h"
+#include "wxd_objstats.h"
 #include <wx/menu.h>  // Include for wxMenuBar, wxMenu, wxMenuItem
 #include <wx/frame.h> // Needed for obtaining owning frame from menubar
 #include <cstring>    // C runtime for strlen/memcpy
+#include <memory>
+#include <vector>
+
+namespace {
+
+wxString
+packed_text(const char* text, const uint32_t* offsets, size_t index)
+{
+    return wxString::FromUTF8(text + offsets[index], offsets[index + 1] - offsets[index]);
+}
+
+// Stands in for the contents of a lazy submenu until it first opens, as some platforms do not
+// open an empty submenu at all.
+void
+append_placeholder(wxMenu* menu)
+{
+    menu->Append(wxID_ANY, wxString::FromUTF8("\xE2\x80\xA6"))->Enable(false);
+}
+
+void
+clear_menu(wxMenu* menu)
+{
+    // Copied, as Destroy unlinks the item from the list being walked.
+    std::vector<wxMenuItem*> items(menu->GetMenuItems().begin(), menu->GetMenuItems().end());
+    for (wxMenuItem* item : items)
+        menu->Destroy(item);
+}
+
+struct LazySubMenu {
+    wxd_MenuPopulateCallback populate = nullptr;
+    void* user_data = nullptr;
+    void (*free_user_data)(void*) = nullptr;
+    bool refill = false;
+    bool filled = false;
+
+    ~LazySubMenu()
+    {
+        if (free_user_data)
+            free_user_data(user_data);
+    }
+};
+
+} // namespace
 
 extern "C" {
 
@@ -390,6 +434,59 @@ wxd_Menu_Break(wxd_Menu_t* menu)
     wx_menu->Break();
 }
 
+WXD_EXPORTED size_t
+wxd_Menu_AppendItems(wxd_Menu_t* menu, const wxd_Id* ids, const int32_t* kinds, const char* text,
+                     const uint32_t* offsets, size_t count)
+{
+    if (!menu || !ids || !text || !offsets)
+        return 0;
+    wxMenu* wx_menu = reinterpret_cast<wxMenu*>(menu);
+    for (size_t i = 0; i < count; ++i) {
+        const int kind = kinds ? kinds[i] : WXD_ITEM_NORMAL;
+        // wxITEM_SEPARATOR is -1 in wx, so the kind is not cast straight through.
+        if (kind == WXD_ITEM_SEPARATOR) {
+            wx_menu->AppendSeparator();
+            continue;
+        }
+        wx_menu->Append(ids[i], packed_text(text, offsets, 2 * i),
+                        packed_text(text, offsets, 2 * i + 1), static_cast<wxItemKind>(kind));
+    }
+    return count;
+}
+
+WXD_EXPORTED const wxd_MenuItem_t*
+wxd_Menu_AppendLazySubMenu(wxd_Menu_t* menu, const char* title, const char* helpString,
+                           bool refill, wxd_MenuPopulateCallback populate, void* user_data,
+                           void (*free_user_data)(void*))
+{
+    if (!menu || !populate)
+        return nullptr;
+    wxMenu* wx_menu = reinterpret_cast<wxMenu*>(menu);
+    wxMenu* submenu = new wxMenu();
+    append_placeholder(submenu);
+
+    // Owned by the handler's functor, which the submenu deletes with its event table.
+    auto state = std::make_shared<LazySubMenu>();
+    state->populate = populate;
+    state->user_data = user_data;
+    state->free_user_data = free_user_data;
+    state->refill = refill;
+    submenu->Bind(wxEVT_MENU_OPEN, [submenu, state](wxMenuEvent& event) {
+        event.Skip();
+        if (event.GetMenu() != submenu || (state->filled && !state->refill))
+            return;
+        state->filled = true;
+        clear_menu(submenu);
+        state->populate(state->user_data, reinterpret_cast<wxd_Menu_t*>(submenu));
+        if (submenu->GetMenuItemCount() == 0)
+            append_placeholder(submenu);
+    });
+
+    wxMenuItem* item = wx_menu->AppendSubMenu(submenu, wxString::FromUTF8(title ? title : ""),
+                                              wxString::FromUTF8(helpString ? helpString : ""));
+    return reinterpret_cast<const wxd_MenuItem_t*>(item);
+}
+
 // --- MenuBar Extended Functions ---
 
 WXD_EXPORTED wxd_Menu_t*
@@ -584,7 +681,7 @@ wxd_MenuItem_GetBitmap(const wxd_MenuItem_t* item)
     const wxBitmap& bmp = wx_item->GetBitmap();
     if (!bmp.IsOk())
         return nullptr;
-    return reinterpret_cast<wxd_Bitmap_t*>(new wxBitmap(bmp));
+    return reinterpret_cast<wxd_Bitmap_t*>(wxd_objstats::track(new wxBitmap(bmp)));
 }
 
 } // extern "C"
\ No newline at end of file
@@ -0,0 +1,245 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include <wx/cursor.h>
+#include "../include/wxdragon.h"
+#include "wxd_utils.h"
+#include "wxd_cache_registry.h"
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+
+// Interned fonts and cursors. wxFont and wxCursor share their native object through reference
+// counted data, so every handle returned here is a cheap copy of the cached instance: repeated
+// requests for the same description reuse one HFONT/PangoFontDescription/CTFont or native
+// cursor instead of creating a new one per call.
+
+namespace {
+
+// Entries only the cache still references are released once a cache grows past this size.
+constexpr size_t kPurgeThreshold = 256;
+
+using FontKey = std::tuple<int, int, int, int, bool, std::string>;
+
+std::mutex&
+cache_mutex()
+{
+    static std::mutex m;
+    return m;
+}
+
+std::map<FontKey, wxFont>&
+font_cache()
+{
+    static std::map<FontKey, wxFont> cache;
+    return cache;
+}
+
+// Keyed by the cursor's source bytes together with its size and hotspot, so lookups are exact.
+std::unordered_map<std::string, wxCursor>&
+cursor_cache()
+{
+    static std::unordered_map<std::string, wxCursor> cache;
+    return cache;
+}
+
+bool
+only_cached(const wxObject& object)
+{
+    const wxObjectRefData* data = object.GetRefData();
+    return !data || data->GetRefCount() <= 1;
+}
+
+template <typename Map>
+size_t
+purge_unused(Map& cache)
+{
+    size_t removed = 0;
+    for (auto it = cache.begin(); it != cache.end();) {
+        if (only_cached(it->second)) {
+            it = cache.erase(it);
+            ++removed;
+        }
+        else {
+            ++it;
+        }
+    }
+    return removed;
+}
+
+// Reports both maps to the cache registry. Trimming drops what only the cache references; the
+// rest is shared with live windows and would not be freed anyway.
+class InternedObjects : public wxd_cache_registry::Cache {
+public:
+    InternedObjects() : Cache("fonts_cursors") {}
+
+    // Native font and cursor sizes are not exposed; each counts at a nominal size.
+    size_t
+    CacheBytes() const override
+    {
+        return CacheEntries() * kNominalBytes;
+    }
+
+    size_t
+    CacheEntries() const override
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex());
+        return font_cache().size() + cursor_cache().size();
+    }
+
+    void
+    Trim(wxd_TrimLevel) override
+    {
+        std::lock_guard<std::mutex> lock(cache_mutex());
+        purge_unused(font_cache());
+        purge_unused(cursor_cache());
+    }
+
+private:
+    static constexpr size_t kNominalBytes = 256;
+};
+
+// Called before the first insertion; registering under cache_mutex() is fine since the
+// registry never calls back while holding its own lock.
+void
+register_interned_objects()
+{
+    static InternedObjects* registration = new InternedObjects();
+    (void)registration;
+}
+
+std::string
+cursor_key(char tag, int width, int height, int hotspot_x, int hotspot_y)
+{
+    std::string key(1, tag);
+    for (int v : { width, height, hotspot_x, hotspot_y })
+        key.append(reinterpret_cast<const char*>(&v), sizeof(v));
+    return key;
+}
+
+wxd_Cursor_t*
+intern_cursor(std::string key, wxd_Cursor_t* (*create)(const void*), const void* arg)
+{
+    std::lock_guard<std::mutex> lock(cache_mutex());
+    register_interned_objects();
+    auto& cache = cursor_cache();
+    auto it = cache.find(key);
+    if (it == cache.end()) {
+        wxd_Cursor_t* created = create(arg);
+        if (!created)
+            return nullptr;
+        wxCursor* cursor = reinterpret_cast<wxCursor*>(created);
+        if (cache.size() >= kPurgeThreshold)
+            purge_unused(cache);
+        cache.emplace(std::move(key), *cursor);
+        return created;
+    }
+    return reinterpret_cast<wxd_Cursor_t*>(new wxCursor(it->second));
+}
+
+struct CursorData {
+    const unsigned char* bits;
+    int width;
+    int height;
+    int hotspot_x;
+    int hotspot_y;
+    const unsigned char* mask_bits;
+};
+
+} // namespace
+
+extern "C" {
+
+WXD_EXPORTED wxd_Font_t*
+wxd_Font_CreateCached(int point_size, int family, int style, int weight, bool underlined,
+                      const char* face_name)
+{
+    FontKey key(point_size, family, style, weight, underlined, face_name ? face_name : "");
+    std::lock_guard<std::mutex> lock(cache_mutex());
+    register_interned_objects();
+    auto& cache = font_cache();
+    auto it = cache.find(key);
+    if (it == cache.end()) {
+        wxFont font(point_size, static_cast<wxFontFamily>(family), static_cast<wxFontStyle>(style),
+                    static_cast<wxFontWeight>(weight), underlined,
+                    WXD_STR_TO_WX_STRING_UTF8_NULL_OK(face_name));
+        if (!font.IsOk())
+            return nullptr;
+        if (cache.size() >= kPurgeThreshold)
+            purge_unused(cache);
+        it = cache.emplace(std::move(key), font).first;
+    }
+    return reinterpret_cast<wxd_Font_t*>(new wxFont(it->second));
+}
+
+WXD_EXPORTED wxd_Cursor_t*
+wxd_Cursor_CreateFromDataCached(const unsigned char* bits, int width, int height, int hotspot_x,
+                                int hotspot_y, const unsigned char* mask_bits)
+{
+    if (!bits || width <= 0 || height <= 0)
+        return nullptr;
+    const size_t len = (static_cast<size_t>(width) * height + 7) / 8;
+    std::string key = cursor_key(mask_bits ? 'm' : 'd', width, height, hotspot_x, hotspot_y);
+    key.append(reinterpret_cast<const char*>(bits), len);
+    if (mask_bits)
+        key.append(reinterpret_cast<const char*>(mask_bits), len);
+
+    const CursorData data{ bits, width, height, hotspot_x, hotspot_y, mask_bits };
+    return intern_cursor(
+        std::move(key),
+        [](const void* arg) {
+            const CursorData* d = static_cast<const CursorData*>(arg);
+            return wxd_Cursor_CreateFromData(d->bits, d->width, d->height, d->hotspot_x,
+                                             d->hotspot_y, d->mask_bits);
+        },
+        &data);
+}
+
+WXD_EXPORTED wxd_Cursor_t*
+wxd_Cursor_CreateFromImageCached(const wxd_Bitmap_t* image)
+{
+    if (!image)
+        return nullptr;
+    const wxImage img = reinterpret_cast<const wxBitmap*>(image)->ConvertToImage();
+    if (!img.IsOk())
+        return nullptr;
+    const int w = img.GetWidth();
+    const int h = img.GetHeight();
+    const int hx = img.HasOption(wxIMAGE_OPTION_CUR_HOTSPOT_X)
+                       ? img.GetOptionInt(wxIMAGE_OPTION_CUR_HOTSPOT_X)
+                       : -1;
+    const int hy = img.HasOption(wxIMAGE_OPTION_CUR_HOTSPOT_Y)
+                       ? img.GetOptionInt(wxIMAGE_OPTION_CUR_HOTSPOT_Y)
+                       : -1;
+    std::string key = cursor_key('i', w, h, hx, hy);
+    const size_t pixels = static_cast<size_t>(w) * h;
+    key.append(reinterpret_cast<const char*>(img.GetData()), pixels * 3);
+    if (img.HasAlpha())
+        key.append(reinterpret_cast<const char*>(img.GetAlpha()), pixels);
+    if (img.HasMask()) {
+        const unsigned char mask[3] = { img.GetMaskRed(), img.GetMaskGreen(), img.GetMaskBlue() };
+        key.append(reinterpret_cast<const char*>(mask), sizeof(mask));
+    }
+
+    return intern_cursor(
+        std::move(key),
+        [](const void* arg) {
+            wxCursor* cursor = new wxCursor(*static_cast<const wxImage*>(arg));
+            if (!cursor->IsOk()) {
+                delete cursor;
+                return static_cast<wxd_Cursor_t*>(nullptr);
+            }
+            return reinterpret_cast<wxd_Cursor_t*>(cursor);
+        },
+        &img);
+}
+
+WXD_EXPORTED size_t
+wxd_ObjectCache_Purge(void)
+{
+    std::lock_guard<std::mutex> lock(cache_mutex());
+    return purge_unused(font_cache()) + purge_unused(cursor_cache());
+}
+
+} // extern "C"
@@ -0,0 +1,131 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include <wx/dcclient.h>
+#include <wx/dcmemory.h>
+#include <wx/rawbmp.h>
+#include <memory>
+
+struct wxd_OffscreenSurface_t {
+    wxBitmap bitmap;
+    wxMemoryDC dc;
+};
+
+namespace {
+
+// Copies native pixel rows to opaque RGBA. The channel offsets are compile-time constants of
+// the pixel format, so the inner loop is a fixed shuffle the compiler can vectorise.
+bool
+read_native_rgba(wxBitmap& bitmap, unsigned char* dst, size_t stride)
+{
+    wxNativePixelData data(bitmap);
+    if (!data)
+        return false;
+    using Format = wxNativePixelData::PixelFormat;
+    const int width = data.GetWidth();
+    const int height = data.GetHeight();
+    wxNativePixelData::Iterator origin(data);
+    const unsigned char* rows = reinterpret_cast<const unsigned char*>(origin.m_ptr);
+    const ptrdiff_t row_stride = data.GetRowStride();
+    for (int y = 0; y < height; ++y) {
+        const unsigned char* src = rows + y * row_stride;
+        unsigned char* out = dst + y * stride;
+        for (int x = 0; x < width; ++x, src += Format::SizePixel, out += 4) {
+            out[0] = src[Format::RED];
+            out[1] = src[Format::GREEN];
+            out[2] = src[Format::BLUE];
+            out[3] = 255;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+WXD_EXPORTED wxd_OffscreenSurface_t*
+wxd_OffscreenSurface_Create(int width, int height, double scale)
+{
+    if (width <= 0 || height <= 0 || !(scale > 0))
+        return nullptr;
+    auto surface = std::make_unique<wxd_OffscreenSurface_t>();
+    // 24 bpp matches wxNativePixelData on MSW and GTK, so reading back needs no conversion of
+    // the bitmap itself.
+    if (!surface->bitmap.CreateWithLogicalSize(wxSize(width, height), scale, 24)) {
+        WXD_LOG_ERROR("wxd_OffscreenSurface_Create: failed to allocate the bitmap");
+        return nullptr;
+    }
+    surface->dc.SelectObject(surface->bitmap);
+    surface->dc.SetBackground(*wxWHITE_BRUSH);
+    surface->dc.Clear();
+    return surface.release();
+}
+
+WXD_EXPORTED void
+wxd_OffscreenSurface_Destroy(wxd_OffscreenSurface_t* surface)
+{
+    delete surface;
+}
+
+WXD_EXPORTED wxd_DC_t*
+wxd_OffscreenSurface_GetDC(wxd_OffscreenSurface_t* surface)
+{
+    if (!surface)
+        return nullptr;
+    return reinterpret_cast<wxd_DC_t*>(static_cast<wxDC*>(&surface->dc));
+}
+
+WXD_EXPORTED wxd_Size
+wxd_OffscreenSurface_GetPixelSize(const wxd_OffscreenSurface_t* surface)
+{
+    if (!surface)
+        return wxd_Size{ 0, 0 };
+    return wxd_Size{ surface->bitmap.GetWidth(), surface->bitmap.GetHeight() };
+}
+
+WXD_EXPORTED bool
+wxd_OffscreenSurface_ReadRGBA(wxd_OffscreenSurface_t* surface, unsigned char* dst, size_t stride)
+{
+    if (!surface || !dst)
+        return false;
+    const size_t row_bytes = static_cast<size_t>(surface->bitmap.GetWidth()) * 4;
+    if (stride == 0)
+        stride = row_bytes;
+    if (stride < row_bytes)
+        return false;
+    // Raw access needs the bitmap out of the DC so pending drawing is flushed to it.
+    surface->dc.SelectObject(wxNullBitmap);
+    const bool ok = read_native_rgba(surface->bitmap, dst, stride);
+    surface->dc.SelectObject(surface->bitmap);
+    return ok;
+}
+
+WXD_EXPORTED bool
+wxd_Window_CaptureToBuffer(wxd_Window_t* window, unsigned char* dst, size_t dst_len,
+                           wxd_Size* size)
+{
+    wxWindow* win = reinterpret_cast<wxWindow*>(window);
+    if (size)
+        *size = wxd_Size{ 0, 0 };
+    if (!win)
+        return false;
+    const wxSize client = win->GetClientSize();
+    if (client.x <= 0 || client.y <= 0)
+        return false;
+
+    wxBitmap bitmap;
+    if (!bitmap.CreateWithLogicalSize(client, win->GetContentScaleFactor(), 24))
+        return false;
+    const size_t needed = static_cast<size_t>(bitmap.GetWidth()) *
+                          static_cast<size_t>(bitmap.GetHeight()) * 4;
+    if (size)
+        *size = wxd_Size{ bitmap.GetWidth(), bitmap.GetHeight() };
+    if (!dst || dst_len < needed)
+        return false;
+    {
+        wxClientDC source(win);
+        wxMemoryDC target(bitmap);
+        if (!target.Blit(0, 0, client.x, client.y, &source, 0, 0))
+            return false;
+    }
+    return read_native_rgba(bitmap, dst, static_cast<size_t>(bitmap.GetWidth()) * 4);
+}
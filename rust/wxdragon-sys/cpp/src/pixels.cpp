@@ -0,0 +1,276 @@
+#include "wxd_pixels.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define WXD_PIXELS_SSSE3 1
+#include <tmmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define WXD_TARGET_SSSE3
+#else
+#define WXD_TARGET_SSSE3 __attribute__((target("ssse3")))
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define WXD_PIXELS_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+void
+split_scalar(const uint8_t* rgba, uint8_t* rgb, uint8_t* alpha, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        rgb[i * 3 + 0] = rgba[i * 4 + 0];
+        rgb[i * 3 + 1] = rgba[i * 4 + 1];
+        rgb[i * 3 + 2] = rgba[i * 4 + 2];
+        alpha[i] = rgba[i * 4 + 3];
+    }
+}
+
+void
+merge_scalar(const uint8_t* rgb, const uint8_t* alpha, uint8_t* rgba, size_t n)
+{
+    for (size_t i = 0; i < n; ++i) {
+        rgba[i * 4 + 0] = rgb[i * 3 + 0];
+        rgba[i * 4 + 1] = rgb[i * 3 + 1];
+        rgba[i * 4 + 2] = rgb[i * 3 + 2];
+        rgba[i * 4 + 3] = alpha ? alpha[i] : 255;
+    }
+}
+
+// Rounded c * a / 255.
+inline uint8_t
+premultiplied(uint8_t c, uint8_t a)
+{
+    const unsigned x = c * a + 128u;
+    return static_cast<uint8_t>((x + (x >> 8)) >> 8);
+}
+
+void
+convert_scalar(const uint8_t* rgba, uint8_t* dst, size_t n, const int order[4], bool premultiply)
+{
+    for (size_t i = 0; i < n; ++i) {
+        const uint8_t* s = rgba + i * 4;
+        uint8_t* d = dst + i * 4;
+        const uint8_t a = s[3];
+        for (int c = 0; c < 3; ++c) {
+            d[order[c]] = premultiply ? premultiplied(s[c], a) : s[c];
+        }
+        d[order[3]] = a;
+    }
+}
+
+#if WXD_PIXELS_SSSE3
+
+bool
+cpu_has_ssse3()
+{
+#if defined(_MSC_VER)
+    int info[4] = {};
+    __cpuid(info, 1);
+    return (info[2] & (1 << 9)) != 0;
+#else
+    return __builtin_cpu_supports("ssse3");
+#endif
+}
+
+// 16 pixels per step. The RGB side is read or written as four overlapping 16-byte blocks 12
+// bytes apart, so the last one touches 4 bytes past the step; the loops stop while at least two
+// more pixels follow, leaving the rest to the scalar tail.
+constexpr size_t kStep = 16;
+constexpr size_t kSlack = 2;
+
+WXD_TARGET_SSSE3 size_t
+split_ssse3(const uint8_t* rgba, uint8_t* rgb, uint8_t* alpha, size_t n)
+{
+    const __m128i to_rgb = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+    const __m128i to_alpha[4] = {
+        _mm_setr_epi8(3, 7, 11, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1),
+        _mm_setr_epi8(-1, -1, -1, -1, 3, 7, 11, 15, -1, -1, -1, -1, -1, -1, -1, -1),
+        _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 3, 7, 11, 15, -1, -1, -1, -1),
+        _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 3, 7, 11, 15),
+    };
+    size_t i = 0;
+    for (; i + kStep + kSlack <= n; i += kStep) {
+        __m128i a = _mm_setzero_si128();
+        for (int k = 0; k < 4; ++k) {
+            const __m128i px =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(rgba + (i + k * 4) * 4));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(rgb + (i + k * 4) * 3),
+                             _mm_shuffle_epi8(px, to_rgb));
+            a = _mm_or_si128(a, _mm_shuffle_epi8(px, to_alpha[k]));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(alpha + i), a);
+    }
+    return i;
+}
+
+WXD_TARGET_SSSE3 size_t
+merge_ssse3(const uint8_t* rgb, const uint8_t* alpha, uint8_t* rgba, size_t n)
+{
+    const __m128i from_rgb = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i from_alpha[4] = {
+        _mm_setr_epi8(-1, -1, -1, 0, -1, -1, -1, 1, -1, -1, -1, 2, -1, -1, -1, 3),
+        _mm_setr_epi8(-1, -1, -1, 4, -1, -1, -1, 5, -1, -1, -1, 6, -1, -1, -1, 7),
+        _mm_setr_epi8(-1, -1, -1, 8, -1, -1, -1, 9, -1, -1, -1, 10, -1, -1, -1, 11),
+        _mm_setr_epi8(-1, -1, -1, 12, -1, -1, -1, 13, -1, -1, -1, 14, -1, -1, -1, 15),
+    };
+    const __m128i opaque = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    size_t i = 0;
+    for (; i + kStep + kSlack <= n; i += kStep) {
+        const __m128i a =
+            alpha ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(alpha + i)) : opaque;
+        for (int k = 0; k < 4; ++k) {
+            const __m128i px =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(rgb + (i + k * 4) * 3));
+            const __m128i out = _mm_or_si128(_mm_shuffle_epi8(px, from_rgb),
+                                             alpha ? _mm_shuffle_epi8(a, from_alpha[k]) : a);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(rgba + (i + k * 4) * 4), out);
+        }
+    }
+    return i;
+}
+
+WXD_TARGET_SSSE3 size_t
+convert_ssse3(const uint8_t* rgba, uint8_t* dst, size_t n, const int order[4], bool premultiply)
+{
+    alignas(16) int8_t reorder[16];
+    for (int p = 0; p < 4; ++p) {
+        for (int c = 0; c < 4; ++c) {
+            reorder[p * 4 + order[c]] = static_cast<int8_t>(p * 4 + c);
+        }
+    }
+    const __m128i to_dst = _mm_load_si128(reinterpret_cast<const __m128i*>(reorder));
+    // Alpha of each pixel in the 16-bit colour lanes, 0 in the alpha lane.
+    const __m128i alpha_lo =
+        _mm_setr_epi8(3, -1, 3, -1, 3, -1, -1, -1, 7, -1, 7, -1, 7, -1, -1, -1);
+    const __m128i alpha_hi =
+        _mm_setr_epi8(11, -1, 11, -1, 11, -1, -1, -1, 15, -1, 15, -1, 15, -1, -1, -1);
+    const __m128i alpha_bytes = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i half = _mm_set1_epi16(128);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rgba + i * 4));
+        if (premultiply) {
+            __m128i lo =
+                _mm_mullo_epi16(_mm_unpacklo_epi8(px, zero), _mm_shuffle_epi8(px, alpha_lo));
+            __m128i hi =
+                _mm_mullo_epi16(_mm_unpackhi_epi8(px, zero), _mm_shuffle_epi8(px, alpha_hi));
+            lo = _mm_add_epi16(lo, half);
+            hi = _mm_add_epi16(hi, half);
+            lo = _mm_srli_epi16(_mm_add_epi16(lo, _mm_srli_epi16(lo, 8)), 8);
+            hi = _mm_srli_epi16(_mm_add_epi16(hi, _mm_srli_epi16(hi, 8)), 8);
+            px = _mm_or_si128(_mm_packus_epi16(lo, hi), _mm_and_si128(px, alpha_bytes));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), _mm_shuffle_epi8(px, to_dst));
+    }
+    return i;
+}
+
+const bool kHasSsse3 = cpu_has_ssse3();
+
+#elif WXD_PIXELS_NEON
+
+size_t
+split_neon(const uint8_t* rgba, uint8_t* rgb, uint8_t* alpha, size_t n)
+{
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const uint8x16x4_t px = vld4q_u8(rgba + i * 4);
+        uint8x16x3_t out;
+        out.val[0] = px.val[0];
+        out.val[1] = px.val[1];
+        out.val[2] = px.val[2];
+        vst3q_u8(rgb + i * 3, out);
+        vst1q_u8(alpha + i, px.val[3]);
+    }
+    return i;
+}
+
+size_t
+merge_neon(const uint8_t* rgb, const uint8_t* alpha, uint8_t* rgba, size_t n)
+{
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const uint8x16x3_t px = vld3q_u8(rgb + i * 3);
+        uint8x16x4_t out;
+        out.val[0] = px.val[0];
+        out.val[1] = px.val[1];
+        out.val[2] = px.val[2];
+        out.val[3] = alpha ? vld1q_u8(alpha + i) : vdupq_n_u8(255);
+        vst4q_u8(rgba + i * 4, out);
+    }
+    return i;
+}
+
+size_t
+convert_neon(const uint8_t* rgba, uint8_t* dst, size_t n, const int order[4], bool premultiply)
+{
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const uint8x16x4_t px = vld4q_u8(rgba + i * 4);
+        uint8x16x4_t out;
+        for (int c = 0; c < 3; ++c) {
+            uint8x16_t v = px.val[c];
+            if (premultiply) {
+                // Rounded v * a / 255 per lane.
+                const uint16x8_t lo = vmull_u8(vget_low_u8(v), vget_low_u8(px.val[3]));
+                const uint16x8_t hi = vmull_u8(vget_high_u8(v), vget_high_u8(px.val[3]));
+                v = vcombine_u8(vraddhn_u16(lo, vrshrq_n_u16(lo, 8)),
+                                vraddhn_u16(hi, vrshrq_n_u16(hi, 8)));
+            }
+            out.val[order[c]] = v;
+        }
+        out.val[order[3]] = px.val[3];
+        vst4q_u8(dst + i * 4, out);
+    }
+    return i;
+}
+
+#endif
+
+} // namespace
+
+namespace wxd_pixels {
+
+void
+split_rgba(const uint8_t* rgba, uint8_t* rgb, uint8_t* alpha, size_t n)
+{
+    size_t done = 0;
+#if WXD_PIXELS_SSSE3
+    if (kHasSsse3)
+        done = split_ssse3(rgba, rgb, alpha, n);
+#elif WXD_PIXELS_NEON
+    done = split_neon(rgba, rgb, alpha, n);
+#endif
+    split_scalar(rgba + done * 4, rgb + done * 3, alpha + done, n - done);
+}
+
+void
+merge_rgba(const uint8_t* rgb, const uint8_t* alpha, uint8_t* rgba, size_t n)
+{
+    size_t done = 0;
+#if WXD_PIXELS_SSSE3
+    if (kHasSsse3)
+        done = merge_ssse3(rgb, alpha, rgba, n);
+#elif WXD_PIXELS_NEON
+    done = merge_neon(rgb, alpha, rgba, n);
+#endif
+    merge_scalar(rgb + done * 3, alpha ? alpha + done : nullptr, rgba + done * 4, n - done);
+}
+
+void
+convert_rgba(const uint8_t* rgba, uint8_t* dst, size_t n, const int order[4], bool premultiply)
+{
+    size_t done = 0;
+#if WXD_PIXELS_SSSE3
+    if (kHasSsse3)
+        done = convert_ssse3(rgba, dst, n, order, premultiply);
+#elif WXD_PIXELS_NEON
+    done = convert_neon(rgba, dst, n, order, premultiply);
+#endif
+    convert_scalar(rgba + done * 4, dst + done * 4, n - done, order, premultiply);
+}
+
+} // namespace wxd_pixels
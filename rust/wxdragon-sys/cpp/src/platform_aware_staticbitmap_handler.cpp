@@ -9,6 +9,7 @@
 #include <wx/xrc/xh_stbmp.h> // Include for XRC_MAKE_INSTANCE macro
 #include <wx/xml/xml.h>      // Include for wxXmlNode
 #include <wx/statbmp.h>
+#include "wxd_xrc_handlers.h"
 // Include generic StaticBitmap for Windows (both native and cross-compiled)
 #if defined(__WXMSW__) || defined(WXD_TARGET_WINDOWS)
 #include <wx/generic/statbmpg.h>
@@ -117,8 +118,10 @@ wxd_XmlResource_InitPlatformAwareStaticBitmapHandler(wxd_XmlResource_t* resource
     if (!res)
         return;
 
-    // Add our custom handler - it should take precedence if registered after standard ones
-    res->AddHandler(new WxdPlatformAwareStaticBitmapHandler());
+    // Add our custom handler - it should take precedence if registered after standard ones.
+    // Queued behind wxd_XmlResource_InitAllHandlers so the registration order stays the same.
+    wxd_xrc::defer_handler_setup(
+        [res]() { res->AddHandler(new WxdPlatformAwareStaticBitmapHandler()); });
 }
 
 #else // wxdUSE_XRC
@@ -0,0 +1,86 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "wxd_pointer_history.h"
+
+#ifdef __WXMSW__
+#include <wx/msw/wrapwin.h>
+#endif
+
+namespace {
+
+constexpr float kPressureUnknown = -1.0f;
+
+// The pointer is a single device, so one record of the newest motion sample is enough to tell
+// which of the platform's buffered points are new.
+struct LastMotion {
+    const wxMouseEvent* event = nullptr;
+    long timestamp = 0;
+    wxPoint screen;
+    std::vector<wxd_PointerSample> samples; // returned again for the same event
+};
+
+LastMotion s_last;
+
+wxd_PointerSample
+make_sample(const wxPoint& pos, long timestamp)
+{
+    return wxd_PointerSample{ pos.x, pos.y, static_cast<int64_t>(timestamp), kPressureUnknown };
+}
+
+#ifdef __WXMSW__
+// Windows keeps the last 64 pointer positions, including the ones merged into a single
+// WM_MOUSEMOVE; returns those after the previous motion sample, oldest first.
+void
+append_merged_points(wxWindow* window, const wxMouseEvent& event, const wxPoint& screen,
+                     std::vector<wxd_PointerSample>& out)
+{
+    if (!s_last.event)
+        return;
+    MOUSEMOVEPOINT current = {};
+    current.x = screen.x & 0xFFFF;
+    current.y = screen.y & 0xFFFF;
+    current.time = static_cast<DWORD>(event.GetTimestamp());
+    MOUSEMOVEPOINT points[64];
+    const int count = GetMouseMovePointsEx(sizeof(current), &current, points, 64,
+                                           GMMP_USE_DISPLAY_POINTS);
+    // points[0] is the current position; older ones follow.
+    for (int i = count - 1; i >= 1; --i) {
+        const long time = static_cast<long>(points[i].time);
+        wxPoint pos(points[i].x > 32767 ? points[i].x - 65536 : points[i].x,
+                    points[i].y > 32767 ? points[i].y - 65536 : points[i].y);
+        if (time < s_last.timestamp || (time == s_last.timestamp && pos == s_last.screen))
+            continue;
+        out.push_back(make_sample(window->ScreenToClient(pos), time));
+    }
+}
+#endif
+
+} // namespace
+
+namespace wxd_pointer_history {
+
+void
+collect(const wxMouseEvent& event, std::vector<wxd_PointerSample>& out)
+{
+    if (s_last.event == &event && s_last.timestamp == event.GetTimestamp()) {
+        out.insert(out.end(), s_last.samples.begin(), s_last.samples.end());
+        return;
+    }
+    wxWindow* window = wxDynamicCast(event.GetEventObject(), wxWindow);
+    const wxPoint screen = window ? window->ClientToScreen(event.GetPosition()) : wxPoint();
+
+    std::vector<wxd_PointerSample> samples;
+#ifdef __WXMSW__
+    if (window)
+        append_merged_points(window, event, screen, samples);
+#endif
+    samples.push_back(make_sample(event.GetPosition(), event.GetTimestamp()));
+
+    s_last.event = &event;
+    s_last.timestamp = event.GetTimestamp();
+    s_last.screen = screen;
+    s_last.samples = samples;
+    out.insert(out.end(), samples.begin(), samples.end());
+}
+
+} // namespace wxd_pointer_history
@@ -2,7 +2,47 @@
 #include <wx/wx.h>
 #include <wx/print.h>
 #include <wx/printdlg.h>
+#include <wx/dcmemory.h>
+#if wxUSE_POSTSCRIPT
+#include <wx/dcps.h>
+#endif
 #include "../include/wxdragon.h"
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <vector>
+
+// --- PrintPagination ---
+
+struct wxd_PrintPagination_t {
+    std::atomic<int> refs{1};
+    std::atomic<int> pageCount{-1};
+    std::atomic<bool> isFinal{false};
+};
+
+static void ReleasePagination(wxd_PrintPagination_t* pagination) {
+    if (pagination && pagination->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        delete pagination;
+}
+
+// Runs `fn` with `dc` mapped 1:1 to device pixels, restoring the caller's mapping afterwards.
+template <typename Fn>
+static void WithDeviceMapping(wxDC& dc, Fn fn) {
+    double sx, sy;
+    dc.GetUserScale(&sx, &sy);
+    const wxPoint deviceOrigin = dc.GetDeviceOrigin();
+    const wxPoint logicalOrigin = dc.GetLogicalOrigin();
+    const wxMappingMode mapMode = dc.GetMapMode();
+    dc.SetMapMode(wxMM_TEXT);
+    dc.SetUserScale(1.0, 1.0);
+    dc.SetDeviceOrigin(0, 0);
+    dc.SetLogicalOrigin(0, 0);
+    fn();
+    dc.SetMapMode(mapMode);
+    dc.SetUserScale(sx, sy);
+    dc.SetDeviceOrigin(deviceOrigin.x, deviceOrigin.y);
+    dc.SetLogicalOrigin(logicalOrigin.x, logicalOrigin.y);
+}
 
 // --- WxdPrintout Proxy Class ---
 
@@ -29,6 +69,26 @@ public:
           m_getPageInfo(getPageInfo)
     {}
 
+    ~WxdPrintout() override {
+        ReleasePagination(m_pagination);
+        if (m_freeUserData) m_freeUserData(m_userData);
+    }
+
+    void SetFreeUserData(wxd_Printout_FreeUserData_Callback freeUserData) { m_freeUserData = freeUserData; }
+
+    void SetPagination(wxd_PrintPagination_t* pagination) {
+        if (pagination) pagination->refs.fetch_add(1, std::memory_order_relaxed);
+        ReleasePagination(m_pagination);
+        m_pagination = pagination;
+    }
+
+    void SetPreviewCacheSize(size_t maxPages) {
+        m_cacheCapacity = maxPages;
+        while (m_cache.size() > m_cacheCapacity) m_cache.pop_back();
+    }
+
+    void InvalidatePreviewCache() { m_cache.clear(); }
+
     virtual void OnPreparePrinting() override {
         if (m_onPreparePrinting) m_onPreparePrinting(m_userData);
         else wxPrintout::OnPreparePrinting();
@@ -44,35 +104,76 @@ public:
         else wxPrintout::OnEndPrinting();
     }
 
+    // The base versions start and end the DC's document, which every DC needs.
     virtual bool OnBeginDocument(int startPage, int endPage) override {
-        if (m_onBeginDocument) {
-            m_onBeginDocument(m_userData, startPage, endPage);
-            return true;
-        }
-        return wxPrintout::OnBeginDocument(startPage, endPage);
+        if (!wxPrintout::OnBeginDocument(startPage, endPage)) return false;
+        if (m_onBeginDocument) m_onBeginDocument(m_userData, startPage, endPage);
+        return true;
     }
 
     virtual void OnEndDocument() override {
         if (m_onEndDocument) m_onEndDocument(m_userData);
-        else wxPrintout::OnEndDocument();
+        wxPrintout::OnEndDocument();
     }
 
     virtual bool OnPrintPage(int pageNum) override {
-        if (m_onPrintPage) return m_onPrintPage(m_userData, pageNum);
-        return false;
+        wxMemoryDC* dc = m_cacheCapacity && IsPreview() ? wxDynamicCast(GetDC(), wxMemoryDC) : nullptr;
+        if (!dc || !dc->GetSelectedBitmap().IsOk()) return CallPrintPage(pageNum);
+
+        // The preview bitmap is sized for the current zoom, so a zoom change misses naturally.
+        const wxSize size = dc->GetSelectedBitmap().GetSize();
+        for (auto it = m_cache.begin(); it != m_cache.end(); ++it) {
+            if (it->page == pageNum && it->bitmap.GetSize() == size) {
+                m_cache.splice(m_cache.begin(), m_cache, it);
+                WithDeviceMapping(*dc, [&] { dc->DrawBitmap(m_cache.front().bitmap, 0, 0); });
+                return true;
+            }
+        }
+
+        if (!CallPrintPage(pageNum)) return false;
+        wxBitmap copy(size.x, size.y);
+        {
+            wxMemoryDC copyDC(copy);
+            WithDeviceMapping(*dc, [&] { copyDC.Blit(0, 0, size.x, size.y, dc, 0, 0); });
+        }
+        m_cache.push_front(CachedPage{ pageNum, copy });
+        while (m_cache.size() > m_cacheCapacity) m_cache.pop_back();
+        return true;
     }
 
     virtual bool HasPage(int pageNum) override {
+        if (m_pagination) {
+            const int count = m_pagination->pageCount.load(std::memory_order_acquire);
+            if (pageNum >= 1 && pageNum <= count) return true;
+            if (m_pagination->isFinal.load(std::memory_order_acquire)) return false;
+        }
         if (m_hasPage) return m_hasPage(m_userData, pageNum);
         return wxPrintout::HasPage(pageNum);
     }
 
     virtual void GetPageInfo(int* minPage, int* maxPage, int* pageFrom, int* pageTo) override {
-        if (m_getPageInfo) m_getPageInfo(m_userData, minPage, maxPage, pageFrom, pageTo);
+        if (m_pagination && m_pagination->isFinal.load(std::memory_order_acquire)) {
+            const int count = std::max(1, m_pagination->pageCount.load(std::memory_order_acquire));
+            *minPage = 1;
+            *maxPage = count;
+            *pageFrom = 1;
+            *pageTo = count;
+        }
+        else if (m_getPageInfo) m_getPageInfo(m_userData, minPage, maxPage, pageFrom, pageTo);
         else wxPrintout::GetPageInfo(minPage, maxPage, pageFrom, pageTo);
     }
 
 private:
+    struct CachedPage {
+        int page;
+        wxBitmap bitmap;
+    };
+
+    bool CallPrintPage(int pageNum) {
+        if (m_onPrintPage) return m_onPrintPage(m_userData, pageNum);
+        return false;
+    }
+
     void* m_userData;
     wxd_Printout_OnPreparePrinting_Callback m_onPreparePrinting;
     wxd_Printout_OnBeginPrinting_Callback m_onBeginPrinting;
@@ -82,8 +183,49 @@ private:
     wxd_Printout_OnPrintPage_Callback m_onPrintPage;
     wxd_Printout_HasPage_Callback m_hasPage;
     wxd_Printout_GetPageInfo_Callback m_getPageInfo;
+    wxd_Printout_FreeUserData_Callback m_freeUserData = nullptr;
+    wxd_PrintPagination_t* m_pagination = nullptr;
+    size_t m_cacheCapacity = 0;
+    std::list<CachedPage> m_cache; // Most recently shown first
 };
 
+// --- Headless export ---
+
+// Drives `printout` through the same sequence wxPrinter uses, on a DC that needs no printer or
+// dialog. `drawPage` wraps each OnPrintPage call and returns false to stop early. Returns the
+// number of pages drawn, or -1 if the document could not be started.
+template <typename DrawPage>
+static int RunPrintout(wxPrintout* printout, wxDC& dc, const wxSize& pagePixels, const wxSize& pageMM,
+                       int ppi, DrawPage drawPage) {
+    const wxSize screenPPI = wxGetDisplayPPI();
+    printout->SetPPIScreen(screenPPI.x, screenPPI.y);
+    printout->SetPPIPrinter(ppi, ppi);
+    printout->SetPageSizePixels(pagePixels.x, pagePixels.y);
+    printout->SetPaperRectPixels(wxRect(pagePixels));
+    printout->SetPageSizeMM(pageMM.x, pageMM.y);
+    printout->SetDC(&dc);
+
+    printout->OnPreparePrinting();
+    int minPage = 1, maxPage = 1, fromPage = 1, toPage = 1;
+    printout->GetPageInfo(&minPage, &maxPage, &fromPage, &toPage);
+    fromPage = std::max(fromPage, minPage);
+    toPage = std::min(toPage, maxPage);
+
+    printout->OnBeginPrinting();
+    int drawn = -1;
+    if (printout->OnBeginDocument(fromPage, toPage)) {
+        drawn = 0;
+        for (int page = fromPage; page <= toPage && printout->HasPage(page); ++page) {
+            if (!drawPage(page)) break;
+            ++drawn;
+        }
+        printout->OnEndDocument();
+    }
+    printout->OnEndPrinting();
+    printout->SetDC(nullptr);
+    return drawn;
+}
+
 // --- C API Implementation ---
 
 // PrintData
@@ -181,6 +323,135 @@ extern "C" bool wxd_Printout_IsPreview(wxd_Printout_t* self) {
     return reinterpret_cast<wxPrintout*>(self)->IsPreview();
 }
 
+extern "C" void wxd_Printout_SetFreeUserData(wxd_Printout_t* self, wxd_Printout_FreeUserData_Callback freeUserData) {
+    reinterpret_cast<WxdPrintout*>(self)->SetFreeUserData(freeUserData);
+}
+
+extern "C" void wxd_Printout_SetPreviewCacheSize(wxd_Printout_t* self, size_t maxPages) {
+    reinterpret_cast<WxdPrintout*>(self)->SetPreviewCacheSize(maxPages);
+}
+
+extern "C" void wxd_Printout_InvalidatePreviewCache(wxd_Printout_t* self) {
+    reinterpret_cast<WxdPrintout*>(self)->InvalidatePreviewCache();
+}
+
+extern "C" void wxd_Printout_SetPagination(wxd_Printout_t* self, wxd_PrintPagination_t* pagination) {
+    reinterpret_cast<WxdPrintout*>(self)->SetPagination(pagination);
+}
+
+extern "C" int wxd_Printout_ExportPostScript(wxd_Printout_t* self, wxd_PrintData_t* data, const char* path) {
+#if wxUSE_POSTSCRIPT
+    if (!self || !path) return -1;
+    wxPrintData printData = data ? *reinterpret_cast<wxPrintData*>(data) : wxPrintData();
+    printData.SetFilename(wxString::FromUTF8(path));
+    printData.SetPrintMode(wxPRINT_MODE_FILE);
+    wxPostScriptDC dc(printData);
+    if (!dc.IsOk()) return -1;
+
+    wxPrintout* printout = reinterpret_cast<wxPrintout*>(self);
+    const wxSize ppi = dc.GetPPI();
+    return RunPrintout(printout, dc, dc.GetSize(), dc.GetSizeMM(), ppi.x, [&](int page) {
+        dc.StartPage();
+        const bool ok = printout->OnPrintPage(page);
+        dc.EndPage();
+        return ok;
+    });
+#else
+    wxUnusedVar(self);
+    wxUnusedVar(data);
+    wxUnusedVar(path);
+    return -1;
+#endif
+}
+
+extern "C" int wxd_Printout_ExportBitmaps(wxd_Printout_t* self, int dpi, int pageWidthMM, int pageHeightMM,
+                                          wxd_Printout_ExportPage_Callback onPage, void* userData) {
+    if (!self || !onPage) return -1;
+    if (dpi <= 0) dpi = 150;
+    const wxSize pageMM(pageWidthMM > 0 ? pageWidthMM : 210, pageHeightMM > 0 ? pageHeightMM : 297);
+    const wxSize pixels(wxRound(pageMM.x * dpi / 25.4), wxRound(pageMM.y * dpi / 25.4));
+
+    // One page bitmap and RGBA buffer, reused for every page.
+    wxBitmap bitmap(pixels.x, pixels.y, 24);
+    wxMemoryDC dc(bitmap);
+    if (!dc.IsOk()) return -1;
+    std::vector<uint8_t> rgba(static_cast<size_t>(pixels.x) * pixels.y * 4);
+
+    wxPrintout* printout = reinterpret_cast<wxPrintout*>(self);
+    return RunPrintout(printout, dc, pixels, pageMM, dpi, [&](int page) {
+        dc.SetBackground(*wxWHITE_BRUSH);
+        dc.Clear();
+        if (!printout->OnPrintPage(page)) return false;
+
+        dc.SelectObject(wxNullBitmap);
+        const wxImage image = bitmap.ConvertToImage();
+        dc.SelectObject(bitmap);
+        const unsigned char* rgb = image.GetData();
+        const unsigned char* alpha = image.HasAlpha() ? image.GetAlpha() : nullptr;
+        const size_t count = static_cast<size_t>(pixels.x) * pixels.y;
+        for (size_t i = 0; i < count; ++i) {
+            rgba[i * 4] = rgb[i * 3];
+            rgba[i * 4 + 1] = rgb[i * 3 + 1];
+            rgba[i * 4 + 2] = rgb[i * 3 + 2];
+            rgba[i * 4 + 3] = alpha ? alpha[i] : 255;
+        }
+        return onPage(userData, page, rgba.data(), pixels.x, pixels.y);
+    });
+}
+
+// PrintPagination
+extern "C" wxd_PrintPagination_t* wxd_PrintPagination_Create() {
+    return new wxd_PrintPagination_t();
+}
+
+extern "C" wxd_PrintPagination_t* wxd_PrintPagination_Clone(wxd_PrintPagination_t* self) {
+    if (self) self->refs.fetch_add(1, std::memory_order_relaxed);
+    return self;
+}
+
+extern "C" void wxd_PrintPagination_Release(wxd_PrintPagination_t* self) {
+    ReleasePagination(self);
+}
+
+extern "C" void wxd_PrintPagination_SetPageCount(wxd_PrintPagination_t* self, int pageCount, bool isFinal) {
+    if (!self) return;
+    self->pageCount.store(pageCount, std::memory_order_release);
+    self->isFinal.store(isFinal, std::memory_order_release);
+}
+
+extern "C" int wxd_PrintPagination_GetPageCount(const wxd_PrintPagination_t* self) {
+    return self ? self->pageCount.load(std::memory_order_acquire) : -1;
+}
+
+extern "C" bool wxd_PrintPagination_IsFinal(const wxd_PrintPagination_t* self) {
+    return self && self->isFinal.load(std::memory_order_acquire);
+}
+
+// PrintPreview
+extern "C" bool wxd_PrintPreview_Show(wxd_Printout_t* preview, wxd_Printout_t* print, wxd_PrintDialogData_t* data,
+                                      wxd_Window_t* parent, const char* title, int width, int height) {
+    wxPrintPreview* wxPreview = new wxPrintPreview(
+        reinterpret_cast<wxPrintout*>(preview),
+        reinterpret_cast<wxPrintout*>(print),
+        reinterpret_cast<wxPrintDialogData*>(data)
+    );
+    if (!wxPreview->IsOk()) {
+        delete wxPreview;
+        return false;
+    }
+    wxPreviewFrame* frame = new wxPreviewFrame(
+        wxPreview,
+        reinterpret_cast<wxWindow*>(parent),
+        wxString::FromUTF8(title ? title : ""),
+        wxDefaultPosition,
+        wxSize(width > 0 ? width : 800, height > 0 ? height : 600)
+    );
+    frame->Centre(wxBOTH);
+    frame->Initialize();
+    frame->Show(true);
+    return true;
+}
+
 // Printer
 extern "C" wxd_Printer_t* wxd_Printer_Create(wxd_PrintDialogData_t* data) {
     if (data) {
@@ -0,0 +1,253 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_process.h"
+#include <wx/process.h>
+#include <wx/timer.h>
+#include <wx/utils.h>
+#include <wx/weakref.h>
+#include <vector>
+
+wxDEFINE_EVENT(wxdEVT_PROCESS_OUTPUT, wxdChildProcessEvent);
+wxDEFINE_EVENT(wxdEVT_PROCESS_EXIT, wxdChildProcessEvent);
+
+namespace {
+
+constexpr int kDefaultPollMs = 50;
+constexpr size_t kDefaultMaxBytesPerPoll = 1024 * 1024;
+constexpr size_t kMaxLineBytes = 64 * 1024;
+
+} // namespace
+
+// Redirected wxProcess whose pipes are drained by a timer; owned by the Rust handle until that
+// is dropped, then by itself until the child exits.
+struct wxd_ChildProcess_t : public wxProcess {
+    wxd_ChildProcess_t(wxEvtHandler* target, int poll_ms)
+        : wxProcess(wxPROCESS_REDIRECT), m_target(target),
+          m_pollMs(poll_ms > 0 ? poll_ms : kDefaultPollMs), m_timer(this)
+    {
+        Bind(wxEVT_TIMER, &wxd_ChildProcess_t::OnTimer, this);
+    }
+
+    void
+    Started()
+    {
+        m_running = true;
+        m_timer.Start(m_pollMs);
+    }
+
+    bool
+    IsRunning() const
+    {
+        return m_running;
+    }
+
+    void
+    SetRateLimit(int poll_ms, size_t max_bytes)
+    {
+        if (poll_ms > 0 && poll_ms != m_pollMs) {
+            m_pollMs = poll_ms;
+            if (m_timer.IsRunning())
+                m_timer.Start(m_pollMs);
+        }
+        m_maxBytes = max_bytes ? max_bytes : kDefaultMaxBytesPerPoll;
+    }
+
+    // Called by the handle's destructor.
+    void
+    Release()
+    {
+        if (m_running)
+            m_released = true;
+        else
+            delete this;
+    }
+
+    void
+    OnTerminate(int pid, int status) override
+    {
+        m_timer.Stop();
+        Pump(true);
+        m_running = false;
+        wxdChildProcessEvent* exited = new wxdChildProcessEvent(wxdEVT_PROCESS_EXIT, pid);
+        exited->exit_code = status;
+        Queue(exited);
+        if (m_released)
+            delete this;
+    }
+
+private:
+    struct Channel {
+        std::string pending;
+        bool is_stderr;
+    };
+
+    void
+    OnTimer(wxTimerEvent&)
+    {
+        Pump(false);
+    }
+
+    // Reads what is available (all of it when draining after exit, else up to the budget) and
+    // sends the complete lines of each stream.
+    void
+    Pump(bool drain)
+    {
+        Read(GetInputStream(), m_out, drain);
+        Read(GetErrorStream(), m_err, drain);
+    }
+
+    void
+    Read(wxInputStream* stream, Channel& channel, bool drain)
+    {
+        char buffer[8192];
+        size_t total = 0;
+        while (stream && stream->CanRead() && (drain || total < m_maxBytes)) {
+            stream->Read(buffer, sizeof(buffer));
+            const size_t n = stream->LastRead();
+            if (n == 0)
+                break;
+            channel.pending.append(buffer, n);
+            total += n;
+        }
+
+        size_t end = channel.pending.size();
+        if (!drain) {
+            const size_t newline = channel.pending.rfind('\n');
+            if (newline != std::string::npos)
+                end = newline + 1;
+            else if (end < kMaxLineBytes)
+                end = 0;
+        }
+        if (end == 0)
+            return;
+
+        wxdChildProcessEvent* output = new wxdChildProcessEvent(wxdEVT_PROCESS_OUTPUT, GetPid());
+        output->is_stderr = channel.is_stderr;
+        if (end == channel.pending.size()) {
+            output->data.swap(channel.pending);
+        }
+        else {
+            output->data.assign(channel.pending, 0, end);
+            channel.pending.erase(0, end);
+        }
+        Queue(output);
+    }
+
+    void
+    Queue(wxdChildProcessEvent* event)
+    {
+        if (m_target)
+            m_target->QueueEvent(event);
+        else
+            delete event;
+    }
+
+    wxWeakRef<wxEvtHandler> m_target;
+    int m_pollMs;
+    size_t m_maxBytes = kDefaultMaxBytesPerPoll;
+    wxTimer m_timer;
+    Channel m_out{ {}, false };
+    Channel m_err{ {}, true };
+    bool m_running = false;
+    bool m_released = false;
+};
+
+extern "C" {
+
+WXD_EXPORTED wxd_ChildProcess_t*
+wxd_ChildProcess_Spawn(wxd_EvtHandler_t* target, const char* const* argv, size_t argc,
+                       const char* cwd, int flags, int poll_ms)
+{
+    if (!target || !argv || argc == 0 || !argv[0] || !*argv[0])
+        return nullptr;
+
+    std::vector<wxWCharBuffer> args;
+    args.reserve(argc);
+    for (size_t i = 0; i < argc; ++i)
+        args.push_back(wxWCharBuffer(wxString::FromUTF8(argv[i] ? argv[i] : "").wc_str()));
+    std::vector<const wchar_t*> args_ptrs;
+    args_ptrs.reserve(argc + 1);
+    for (const wxWCharBuffer& arg : args)
+        args_ptrs.push_back(arg.data());
+    args_ptrs.push_back(nullptr);
+
+    // A non-null env replaces the environment, so start from the current one.
+    wxExecuteEnv env;
+    const bool with_cwd = cwd && *cwd;
+    if (with_cwd) {
+        env.cwd = wxString::FromUTF8(cwd);
+        wxGetEnvMap(&env.env);
+    }
+
+    int exec_flags = wxEXEC_ASYNC;
+    if (flags & WXD_PROCESS_HIDE_CONSOLE)
+        exec_flags |= wxEXEC_HIDE_CONSOLE;
+    if (flags & WXD_PROCESS_GROUP_LEADER)
+        exec_flags |= wxEXEC_MAKE_GROUP_LEADER;
+
+    wxd_ChildProcess_t* process =
+        new wxd_ChildProcess_t(reinterpret_cast<wxEvtHandler*>(target), poll_ms);
+    if (wxExecute(args_ptrs.data(), exec_flags, process, with_cwd ? &env : nullptr) == 0) {
+        delete process;
+        return nullptr;
+    }
+    process->Started();
+    return process;
+}
+
+WXD_EXPORTED void
+wxd_ChildProcess_Destroy(wxd_ChildProcess_t* self)
+{
+    if (self)
+        self->Release();
+}
+
+WXD_EXPORTED int64_t
+wxd_ChildProcess_GetPid(const wxd_ChildProcess_t* self)
+{
+    return self ? self->GetPid() : 0;
+}
+
+WXD_EXPORTED bool
+wxd_ChildProcess_IsRunning(const wxd_ChildProcess_t* self)
+{
+    return self && self->IsRunning();
+}
+
+WXD_EXPORTED void
+wxd_ChildProcess_SetRateLimit(wxd_ChildProcess_t* self, int poll_ms, size_t max_bytes_per_poll)
+{
+    if (self)
+        self->SetRateLimit(poll_ms, max_bytes_per_poll);
+}
+
+WXD_EXPORTED bool
+wxd_ChildProcess_Write(wxd_ChildProcess_t* self, const uint8_t* data, size_t len)
+{
+    wxOutputStream* in = self ? self->GetOutputStream() : nullptr;
+    if (!in || (!data && len))
+        return false;
+    if (len == 0)
+        return true;
+    in->Write(data, len);
+    return in->LastWrite() == len;
+}
+
+WXD_EXPORTED void
+wxd_ChildProcess_CloseInput(wxd_ChildProcess_t* self)
+{
+    if (self)
+        self->CloseOutput();
+}
+
+WXD_EXPORTED bool
+wxd_ChildProcess_Kill(wxd_ChildProcess_t* self, bool force, bool children)
+{
+    if (!self || !self->IsRunning())
+        return false;
+    return wxProcess::Kill(static_cast<int>(self->GetPid()), force ? wxSIGKILL : wxSIGTERM,
+                           children ? wxKILL_CHILDREN : wxKILL_NOCHILDREN) == wxKILL_OK;
+}
+
+} // extern "C"
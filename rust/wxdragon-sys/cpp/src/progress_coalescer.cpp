@@ -0,0 +1,228 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_progress_coalescer.h"
+#include <wx/gauge.h>
+#include <wx/statusbr.h>
+#include <wx/timer.h>
+#include <wx/weakref.h>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+constexpr int kFrameMs = 16;
+
+enum class Kind { StatusText, Gauge, AppProgress };
+
+struct Pending {
+    Kind kind;
+    const void* target;
+    int field;                   // Status bar field; 0 otherwise
+    wxWeakRef<wxWindow> window;  // Status bar or gauge
+    wxString text;
+    int value = 0;
+};
+
+struct AppProgressState {
+    int range = 100;
+    int shown_percent = -1; // Percentage last passed to the native indicator
+};
+
+// GUI-thread only, like the setters themselves.
+class ProgressCoalescer {
+public:
+    ProgressCoalescer() { m_timer.Bind(wxEVT_TIMER, &ProgressCoalescer::OnTimer, this); }
+
+    Pending&
+    Slot(Kind kind, const void* target, int field)
+    {
+        for (Pending& entry : m_pending) {
+            if (entry.kind == kind && entry.target == target && entry.field == field)
+                return entry;
+        }
+        m_pending.push_back(Pending{ kind, target, field });
+        Arm();
+        return m_pending.back();
+    }
+
+    void
+    Cancel(const void* target, int field)
+    {
+        m_pending.erase(std::remove_if(m_pending.begin(), m_pending.end(),
+                                       [&](const Pending& p) {
+                                           return p.target == target &&
+                                                  (field < 0 || p.field == field);
+                                       }),
+                        m_pending.end());
+    }
+
+    bool
+    HasPending() const
+    {
+        return !m_pending.empty();
+    }
+
+    void
+    Flush()
+    {
+        m_timer.Stop();
+        m_last_frame.Start();
+        m_frame_started = true;
+        std::vector<Pending> frame;
+        frame.swap(m_pending);
+        for (const Pending& entry : frame)
+            Apply(entry);
+    }
+
+    std::unordered_map<const wxAppProgressIndicator*, AppProgressState> app_progress;
+
+private:
+    void
+    Arm()
+    {
+        if (m_timer.IsRunning())
+            return;
+        const long elapsed = m_frame_started ? m_last_frame.Time() : kFrameMs;
+        m_timer.StartOnce(static_cast<int>(std::max(1L, kFrameMs - elapsed)));
+    }
+
+    void
+    OnTimer(wxTimerEvent&)
+    {
+        Flush();
+    }
+
+    void
+    Apply(const Pending& entry)
+    {
+        switch (entry.kind) {
+        case Kind::StatusText: {
+            wxStatusBar* bar = wxDynamicCast(entry.window.get(), wxStatusBar);
+            if (!bar || entry.field < 0 || entry.field >= bar->GetFieldsCount())
+                return;
+            if (bar->GetStatusText(entry.field) != entry.text)
+                bar->SetStatusText(entry.text, entry.field);
+            return;
+        }
+        case Kind::Gauge: {
+            wxGauge* gauge = wxDynamicCast(entry.window.get(), wxGauge);
+            if (!gauge)
+                return;
+            const int current = gauge->GetValue();
+            const int range = gauge->GetRange();
+            if (entry.value == current)
+                return;
+            // Within the range, only a change of at least one pixel of the bar is visible.
+            // The ends are always applied so a finished or reset gauge reads exactly.
+            if (range > 0 && entry.value > 0 && entry.value < range) {
+                const wxSize size = gauge->GetClientSize();
+                const long long span = gauge->IsVertical() ? size.y : size.x;
+                if (span > 0 && entry.value * span / range == current * span / range)
+                    return;
+            }
+            gauge->SetValue(entry.value);
+            return;
+        }
+        case Kind::AppProgress: {
+            auto* indicator =
+                const_cast<wxAppProgressIndicator*>(static_cast<const wxAppProgressIndicator*>(entry.target));
+            AppProgressState& state = app_progress[indicator];
+            const int percent = state.range > 0
+                                    ? static_cast<int>(100LL * std::clamp(entry.value, 0, state.range) /
+                                                       state.range)
+                                    : 0;
+            if (percent == state.shown_percent)
+                return;
+            state.shown_percent = percent;
+            indicator->SetValue(entry.value);
+            return;
+        }
+        }
+    }
+
+    wxTimer m_timer;
+    wxStopWatch m_last_frame;
+    bool m_frame_started = false;
+    std::vector<Pending> m_pending;
+};
+
+ProgressCoalescer&
+coalescer()
+{
+    static ProgressCoalescer* instance = new ProgressCoalescer(); // Leaked: used until exit
+    return *instance;
+}
+
+} // namespace
+
+void
+wxd_progress_coalescer::cancel(const void* target, int field)
+{
+    ProgressCoalescer& c = coalescer();
+    if (c.HasPending())
+        c.Cancel(target, field);
+    if (!c.app_progress.empty()) {
+        // A direct value makes the remembered percentage stale.
+        auto found = c.app_progress.find(static_cast<const wxAppProgressIndicator*>(target));
+        if (found != c.app_progress.end())
+            found->second.shown_percent = -1;
+    }
+}
+
+void
+wxd_progress_coalescer::set_app_progress_range(const wxAppProgressIndicator* indicator, int range)
+{
+    AppProgressState& state = coalescer().app_progress[indicator];
+    state.range = range;
+    state.shown_percent = -1;
+}
+
+void
+wxd_progress_coalescer::forget_app_progress(const wxAppProgressIndicator* indicator)
+{
+    ProgressCoalescer& c = coalescer();
+    c.Cancel(indicator, -1);
+    c.app_progress.erase(indicator);
+}
+
+extern "C" {
+
+WXD_EXPORTED void
+wxd_StatusBar_SetStatusTextDeferred(wxd_StatusBar_t* self, const char* text, int fieldIndex)
+{
+    wxStatusBar* bar = reinterpret_cast<wxStatusBar*>(self);
+    if (!bar)
+        return;
+    Pending& entry = coalescer().Slot(Kind::StatusText, bar, fieldIndex);
+    entry.window = bar;
+    entry.text = wxString::FromUTF8(text ? text : "");
+}
+
+WXD_EXPORTED void
+wxd_Gauge_SetValueDeferred(wxd_Gauge_t* self, int value)
+{
+    wxGauge* gauge = reinterpret_cast<wxGauge*>(self);
+    if (!gauge)
+        return;
+    Pending& entry = coalescer().Slot(Kind::Gauge, gauge, 0);
+    entry.window = gauge;
+    entry.value = value;
+}
+
+WXD_EXPORTED void
+wxd_AppProgressIndicator_SetValueDeferred(wxd_AppProgressIndicator_t* self, int value)
+{
+    if (!self)
+        return;
+    coalescer().Slot(Kind::AppProgress, self, 0).value = value;
+}
+
+WXD_EXPORTED void
+wxd_Progress_FlushDeferred(void)
+{
+    coalescer().Flush();
+}
+
+} // extern "C"
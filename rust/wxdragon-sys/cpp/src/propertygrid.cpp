@@ -3,12 +3,19 @@
 
 #include <wx/propgrid/propgrid.h>
 #include <wx/propgrid/props.h>
+#include <wx/wupdlock.h>
 
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "../include/wxdragon.h"
+#include "wxd_objstats.h"
 
 namespace {
 wxPropertyGrid*
@@ -41,6 +48,49 @@ property_name(const char* name)
     return (name && *name) ? wxString::FromUTF8(name) : wxPG_LABEL;
 }
 
+// Live properties created through this API, by handle and by address. Handles are never
+// reused, so a handle outliving its property resolves to nothing. GUI-thread only.
+std::unordered_map<wxd_PGPropertyHandle, wxPGProperty*> s_property_by_handle;
+std::unordered_map<const wxPGProperty*, wxd_PGPropertyHandle> s_handle_by_property;
+wxd_PGPropertyHandle s_next_property_handle = 1;
+
+// Property types are wrapped so that every deletion path (DeleteProperty, Clear, a deleted
+// parent, the grid itself) retires the handle from the destructor.
+template<typename Base>
+class TrackedProperty : public Base {
+public:
+    using Base::Base;
+
+    ~TrackedProperty() override
+    {
+        auto found = s_handle_by_property.find(this);
+        if (found != s_handle_by_property.end()) {
+            s_property_by_handle.erase(found->second);
+            s_handle_by_property.erase(found);
+        }
+    }
+};
+
+wxd_PGPropertyHandle
+register_property(wxPGProperty* property)
+{
+    const wxd_PGPropertyHandle handle = s_next_property_handle++;
+    s_property_by_handle.emplace(handle, property);
+    s_handle_by_property.emplace(property, handle);
+    return handle;
+}
+
+wxPGProperty*
+find_property(const wxPropertyGrid* grid, wxd_PGPropertyHandle handle)
+{
+    if (!grid || !handle)
+        return nullptr;
+    auto found = s_property_by_handle.find(handle);
+    if (found == s_property_by_handle.end() || found->second->GetGrid() != grid)
+        return nullptr;
+    return found->second;
+}
+
 wxPGProperty*
 find_property(wxPropertyGrid* grid, const char* name)
 {
@@ -71,28 +121,34 @@ property_name_available(wxPropertyGrid* grid, const char* label, const char* nam
     return grid->GetPropertyByName(wxString::FromUTF8(effective_name)) == nullptr;
 }
 
-bool
+// Inserts `property` under `parent` (null for the root) and returns its handle, or 0.
+wxd_PGPropertyHandle
+insert_property(wxPropertyGrid* grid, wxPGProperty* parent, std::unique_ptr<wxPGProperty> property)
+{
+    wxPGProperty* raw = property.release();
+    wxPGProperty* inserted = parent ? grid->AppendIn(parent, raw) : grid->Append(raw);
+    if (!inserted) {
+        // wxWidgets only takes ownership after successful insertion.
+        delete raw;
+        return 0;
+    }
+    return register_property(inserted);
+}
+
+wxd_PGPropertyHandle
 append_property(wxPropertyGrid* grid, const char* parent_name, const char* label,
                 const char* name, std::unique_ptr<wxPGProperty> property)
 {
     if (!grid || !property || !property_name_available(grid, label, name))
-        return false;
+        return 0;
 
     wxPGProperty* parent = nullptr;
     if (parent_name && *parent_name) {
         parent = find_property(grid, parent_name);
         if (!parent)
-            return false;
-    }
-
-    wxPGProperty* raw = property.release();
-    wxPGProperty* inserted = parent ? grid->AppendIn(parent, raw) : grid->Append(raw);
-    if (!inserted) {
-        // wxWidgets only takes ownership after successful insertion.
-        delete raw;
-        return false;
+            return 0;
     }
-    return true;
+    return insert_property(grid, parent, std::move(property));
 }
 
 bool
@@ -140,70 +196,70 @@ wxd_PropertyGrid_Contains(wxd_PropertyGrid_t* self, const char* name)
     return find_property(as_grid(self), name) != nullptr;
 }
 
-extern "C" WXD_EXPORTED bool
+extern "C" WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendCategory(wxd_PropertyGrid_t* self, const char* parent_name,
                                 const char* label, const char* name)
 {
     wxPropertyGrid* grid = as_grid(self);
     return append_property(grid, parent_name, label, name,
-                           std::make_unique<wxPropertyCategory>(from_utf8(label),
+                           std::make_unique<TrackedProperty<wxPropertyCategory>>(from_utf8(label),
                                                                  property_name(name)));
 }
 
-extern "C" WXD_EXPORTED bool
+extern "C" WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendString(wxd_PropertyGrid_t* self, const char* parent_name,
                               const char* label, const char* name, const char* value)
 {
     wxPropertyGrid* grid = as_grid(self);
     return append_property(grid, parent_name, label, name,
-                           std::make_unique<wxStringProperty>(from_utf8(label),
+                           std::make_unique<TrackedProperty<wxStringProperty>>(from_utf8(label),
                                                                property_name(name),
                                                                from_utf8(value)));
 }
 
-extern "C" WXD_EXPORTED bool
+extern "C" WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendInt(wxd_PropertyGrid_t* self, const char* parent_name,
                            const char* label, const char* name, int64_t value)
 {
     wxPropertyGrid* grid = as_grid(self);
     return append_property(grid, parent_name, label, name,
-                           std::make_unique<wxIntProperty>(from_utf8(label),
+                           std::make_unique<TrackedProperty<wxIntProperty>>(from_utf8(label),
                                                             property_name(name),
                                                             wxLongLong(value)));
 }
 
-extern "C" WXD_EXPORTED bool
+extern "C" WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendUInt(wxd_PropertyGrid_t* self, const char* parent_name,
                             const char* label, const char* name, uint64_t value)
 {
     wxPropertyGrid* grid = as_grid(self);
     return append_property(grid, parent_name, label, name,
-                           std::make_unique<wxUIntProperty>(from_utf8(label),
+                           std::make_unique<TrackedProperty<wxUIntProperty>>(from_utf8(label),
                                                              property_name(name),
                                                              wxULongLong(value)));
 }
 
-extern "C" WXD_EXPORTED bool
+extern "C" WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendFloat(wxd_PropertyGrid_t* self, const char* parent_name,
                              const char* label, const char* name, double value)
 {
     wxPropertyGrid* grid = as_grid(self);
     return append_property(grid, parent_name, label, name,
-                           std::make_unique<wxFloatProperty>(from_utf8(label),
+                           std::make_unique<TrackedProperty<wxFloatProperty>>(from_utf8(label),
                                                               property_name(name), value));
 }
 
-extern "C" WXD_EXPORTED bool
+extern "C" WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendBool(wxd_PropertyGrid_t* self, const char* parent_name,
                             const char* label, const char* name, bool value)
 {
     wxPropertyGrid* grid = as_grid(self);
     return append_property(grid, parent_name, label, name,
-                           std::make_unique<wxBoolProperty>(from_utf8(label),
+                           std::make_unique<TrackedProperty<wxBoolProperty>>(from_utf8(label),
                                                              property_name(name), value));
 }
 
-extern "C" WXD_EXPORTED bool
+extern "C" WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendEnum(wxd_PropertyGrid_t* self, const char* parent_name,
                             const char* label, const char* name,
                             const char* const* labels, const int32_t* values,
@@ -211,16 +267,16 @@ wxd_PropertyGrid_AppendEnum(wxd_PropertyGrid_t* self, const char* parent_name,
 {
     wxPGChoices choices;
     if (!make_choices(labels, values, choice_count, choices))
-        return false;
+        return 0;
 
     wxPropertyGrid* grid = as_grid(self);
     return append_property(grid, parent_name, label, name,
-                           std::make_unique<wxEnumProperty>(from_utf8(label),
+                           std::make_unique<TrackedProperty<wxEnumProperty>>(from_utf8(label),
                                                              property_name(name), choices,
                                                              static_cast<int>(value)));
 }
 
-extern "C" WXD_EXPORTED bool
+extern "C" WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendFlags(wxd_PropertyGrid_t* self, const char* parent_name,
                              const char* label, const char* name,
                              const char* const* labels, const int32_t* values,
@@ -228,55 +284,284 @@ wxd_PropertyGrid_AppendFlags(wxd_PropertyGrid_t* self, const char* parent_name,
 {
     wxPGChoices choices;
     if (!make_choices(labels, values, choice_count, choices))
-        return false;
+        return 0;
 
     wxPropertyGrid* grid = as_grid(self);
     return append_property(grid, parent_name, label, name,
-                           std::make_unique<wxFlagsProperty>(from_utf8(label),
+                           std::make_unique<TrackedProperty<wxFlagsProperty>>(from_utf8(label),
                                                               property_name(name), choices,
                                                               static_cast<long>(value)));
 }
 
-extern "C" WXD_EXPORTED bool
+extern "C" WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendFile(wxd_PropertyGrid_t* self, const char* parent_name,
                             const char* label, const char* name, const char* value)
 {
     wxPropertyGrid* grid = as_grid(self);
     return append_property(grid, parent_name, label, name,
-                           std::make_unique<wxFileProperty>(from_utf8(label),
+                           std::make_unique<TrackedProperty<wxFileProperty>>(from_utf8(label),
                                                              property_name(name),
                                                              from_utf8(value)));
 }
 
-extern "C" WXD_EXPORTED bool
+extern "C" WXD_EXPORTED wxd_PGPropertyHandle
 wxd_PropertyGrid_AppendDir(wxd_PropertyGrid_t* self, const char* parent_name,
                            const char* label, const char* name, const char* value)
 {
     wxPropertyGrid* grid = as_grid(self);
     return append_property(grid, parent_name, label, name,
-                           std::make_unique<wxDirProperty>(from_utf8(label),
+                           std::make_unique<TrackedProperty<wxDirProperty>>(from_utf8(label),
                                                             property_name(name),
                                                             from_utf8(value)));
 }
 
-extern "C" WXD_EXPORTED wxd_Variant_t*
-wxd_PropertyGrid_GetValue(const wxd_PropertyGrid_t* self, const char* name)
+namespace {
+// A category whose children are created by a callback when it is first expanded. Until then,
+// and again after its children are released on collapse, a disabled placeholder child keeps the
+// expander button. The category owns the callback's user data.
+class LazyCategory : public TrackedProperty<wxPropertyCategory> {
+public:
+    LazyCategory(const wxString& label, const wxString& name, bool release_when_collapsed)
+        : TrackedProperty<wxPropertyCategory>(label, name), m_release(release_when_collapsed)
+    {
+    }
+
+    ~LazyCategory() override
+    {
+        if (m_free_user_data)
+            m_free_user_data(m_user_data);
+    }
+
+    void
+    Attach(wxd_PGPopulateCallback populate, void* user_data, void (*free_user_data)(void*))
+    {
+        m_populate = populate;
+        m_user_data = user_data;
+        m_free_user_data = free_user_data;
+    }
+
+    void
+    AddPlaceholder(wxPropertyGrid* grid)
+    {
+        // Placeholders pending deferred deletion may still hold earlier names.
+        static unsigned long s_next_placeholder = 1;
+        const wxString name = wxString::Format("wxd_lazy_placeholder_%lu", s_next_placeholder++);
+        const wxString label = wxString::FromUTF8("\xE2\x80\xA6");
+        m_placeholder = grid->AppendIn(this, new wxStringProperty(label, name));
+        if (m_placeholder)
+            grid->EnableProperty(m_placeholder, false);
+        m_populated = false;
+    }
+
+    // Runs the callback unless the children already exist.
+    void
+    Populate(wxPropertyGrid* grid)
+    {
+        if (m_populated || m_populating)
+            return;
+        m_populated = true;
+        wxWindowUpdateLocker freeze(grid);
+        if (m_placeholder) {
+            grid->DeleteProperty(m_placeholder);
+            m_placeholder = nullptr;
+        }
+        auto found = s_handle_by_property.find(this);
+        if (m_populate && found != s_handle_by_property.end()) {
+            m_populating = true;
+            m_populate(m_user_data, found->second);
+            m_populating = false;
+        }
+    }
+
+    // Deletes the children of a collapsed category so the next expand creates them again.
+    void
+    Release(wxPropertyGrid* grid)
+    {
+        if (!m_release || !m_populated || m_populating || IsExpanded())
+            return;
+        // Collected first: deletion from a grid event handler is deferred.
+        std::vector<wxPGProperty*> children;
+        children.reserve(GetChildCount());
+        for (unsigned int i = 0; i < GetChildCount(); ++i)
+            children.push_back(Item(i));
+        wxWindowUpdateLocker freeze(grid);
+        for (wxPGProperty* child : children)
+            grid->DeleteProperty(child);
+        AddPlaceholder(grid);
+    }
+
+private:
+    wxd_PGPopulateCallback m_populate = nullptr;
+    void* m_user_data = nullptr;
+    void (*m_free_user_data)(void*) = nullptr;
+    wxPGProperty* m_placeholder = nullptr;
+    bool m_release;
+    bool m_populated = false;
+    bool m_populating = false;
+};
+
+LazyCategory*
+as_lazy(wxPGProperty* property)
+{
+    return dynamic_cast<LazyCategory*>(property);
+}
+
+// Grids with lazy categories, whose expand and collapse events have been bound.
+std::unordered_set<wxPropertyGrid*> s_lazy_grids;
+
+void
+on_lazy_grid_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    if (wxPropertyGrid* grid = wxDynamicCast(event.GetEventObject(), wxPropertyGrid))
+        s_lazy_grids.erase(grid);
+}
+
+void
+bind_lazy_events(wxPropertyGrid* grid)
+{
+    if (!s_lazy_grids.insert(grid).second)
+        return;
+    grid->Bind(wxEVT_DESTROY, on_lazy_grid_destroy);
+    grid->Bind(wxEVT_PG_ITEM_EXPANDED, [grid](wxPropertyGridEvent& event) {
+        event.Skip();
+        if (LazyCategory* lazy = as_lazy(event.GetProperty()))
+            lazy->Populate(grid);
+    });
+    grid->Bind(wxEVT_PG_ITEM_COLLAPSED, [grid](wxPropertyGridEvent& event) {
+        event.Skip();
+        if (LazyCategory* lazy = as_lazy(event.GetProperty()))
+            lazy->Release(grid);
+    });
+}
+
+// Expanding and collapsing through the API sends no events, so these stand in for the handlers.
+bool
+expand(wxPropertyGrid* grid, wxPGProperty* property)
 {
-    const wxPropertyGrid* grid = as_grid(self);
-    const wxPGProperty* property = find_property(grid, name);
     if (!property)
-        return nullptr;
+        return false;
+    if (LazyCategory* lazy = as_lazy(property))
+        lazy->Populate(grid);
+    return grid->Expand(property);
+}
 
-    wxVariant* value = new (std::nothrow) wxVariant(property->GetValue());
-    return reinterpret_cast<wxd_Variant_t*>(value);
+bool
+collapse(wxPropertyGrid* grid, wxPGProperty* property)
+{
+    if (!property || !grid->Collapse(property))
+        return false;
+    if (LazyCategory* lazy = as_lazy(property))
+        lazy->Release(grid);
+    return true;
+}
+
+bool
+expand_all(wxPropertyGrid* grid, bool expand)
+{
+    if (!grid)
+        return false;
+    if (!s_lazy_grids.count(grid))
+        return grid->ExpandAll(expand);
+    std::vector<LazyCategory*> lazies;
+    for (wxPropertyGridIterator it = grid->GetIterator(wxPG_ITERATE_CATEGORIES); !it.AtEnd();
+         ++it) {
+        if (LazyCategory* lazy = as_lazy(*it))
+            lazies.push_back(lazy);
+    }
+    wxWindowUpdateLocker freeze(grid);
+    if (expand) {
+        // Populating a category may add lazy categories of its own, which stay pending.
+        for (LazyCategory* lazy : lazies)
+            lazy->Populate(grid);
+    }
+    const bool done = grid->ExpandAll(expand);
+    if (!expand) {
+        for (LazyCategory* lazy : lazies)
+            lazy->Release(grid);
+    }
+    return done;
+}
+
+bool
+populate(wxPropertyGrid* grid, wxPGProperty* property)
+{
+    LazyCategory* lazy = as_lazy(property);
+    if (!lazy)
+        return false;
+    lazy->Populate(grid);
+    return true;
+}
+} // namespace
+
+extern "C" WXD_EXPORTED wxd_PGPropertyHandle
+wxd_PropertyGrid_AppendLazyCategory(wxd_PropertyGrid_t* self, const char* parent_name,
+                                    const char* label, const char* name,
+                                    wxd_PGPopulateCallback populate, void* user_data,
+                                    void (*free_user_data)(void*), bool release_when_collapsed)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    if (!grid || !populate)
+        return 0;
+    const wxd_PGPropertyHandle handle =
+        append_property(grid, parent_name, label, name,
+                        std::make_unique<LazyCategory>(from_utf8(label), property_name(name),
+                                                       release_when_collapsed));
+    if (!handle)
+        return 0;
+    LazyCategory* lazy = static_cast<LazyCategory*>(s_property_by_handle[handle]);
+    lazy->Attach(populate, user_data, free_user_data);
+    bind_lazy_events(grid);
+    wxWindowUpdateLocker freeze(grid);
+    lazy->AddPlaceholder(grid);
+    grid->Collapse(lazy);
+    return handle;
 }
 
 extern "C" WXD_EXPORTED bool
-wxd_PropertyGrid_SetValue(wxd_PropertyGrid_t* self, const char* name,
-                          const wxd_Variant_t* value)
+wxd_PropertyGrid_PopulateLazyCategory(wxd_PropertyGrid_t* self, const char* name)
 {
     wxPropertyGrid* grid = as_grid(self);
-    wxPGProperty* property = find_property(grid, name);
+    return populate(grid, find_property(grid, name));
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_PopulateLazyCategoryByHandle(wxd_PropertyGrid_t* self,
+                                              wxd_PGPropertyHandle handle)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    return populate(grid, find_property(grid, handle));
+}
+
+namespace {
+// Per-property operations behind both the name-based and the handle-based entry points.
+
+int
+missing_property(char* out, size_t out_len)
+{
+    if (out && out_len)
+        out[0] = '\0';
+    return -1;
+}
+
+int
+copy_text(const wxString& text, char* out, size_t out_len)
+{
+    return static_cast<int>(wxd_cpp_utils::copy_wxstring_to_buffer(text, out, out_len));
+}
+
+wxd_Variant_t*
+get_value(const wxPGProperty* property)
+{
+    if (!property)
+        return nullptr;
+    wxVariant* value = new (std::nothrow) wxVariant(property->GetValue());
+    return reinterpret_cast<wxd_Variant_t*>(wxd_objstats::track(WXD_OBJECT_KIND_VARIANT, value));
+}
+
+bool
+set_value(wxPropertyGrid* grid, wxPGProperty* property, const wxd_Variant_t* value)
+{
     const wxVariant* variant = as_variant(value);
     if (!property || !variant)
         return false;
@@ -284,101 +569,67 @@ wxd_PropertyGrid_SetValue(wxd_PropertyGrid_t* self, const char* name,
     return true;
 }
 
-extern "C" WXD_EXPORTED bool
-wxd_PropertyGrid_ChangeValue(wxd_PropertyGrid_t* self, const char* name,
-                             const wxd_Variant_t* value)
+bool
+change_value(wxPropertyGrid* grid, wxPGProperty* property, const wxd_Variant_t* value)
 {
-    wxPropertyGrid* grid = as_grid(self);
-    wxPGProperty* property = find_property(grid, name);
     const wxVariant* variant = as_variant(value);
     if (!property || !variant)
         return false;
     return grid->ChangePropertyValue(property, *variant);
 }
 
-extern "C" WXD_EXPORTED bool
-wxd_PropertyGrid_ClearValue(wxd_PropertyGrid_t* self, const char* name)
+bool
+clear_value(wxPropertyGrid* grid, wxPGProperty* property)
 {
-    wxPropertyGrid* grid = as_grid(self);
-    wxPGProperty* property = find_property(grid, name);
     if (!property)
         return false;
     grid->SetPropertyValueUnspecified(property);
     return true;
 }
 
-extern "C" WXD_EXPORTED int
-wxd_PropertyGrid_GetValueAsString(const wxd_PropertyGrid_t* self, const char* name,
-                                  char* out, size_t out_len)
+int
+get_value_as_string(const wxPGProperty* property, char* out, size_t out_len)
 {
-    const wxPropertyGrid* grid = as_grid(self);
-    const wxPGProperty* property = find_property(grid, name);
-    if (!property) {
-        if (out && out_len)
-            out[0] = '\0';
-        return -1;
-    }
-    return static_cast<int>(
-        wxd_cpp_utils::copy_wxstring_to_buffer(property->GetValueAsString(), out, out_len));
+    return property ? copy_text(property->GetValueAsString(), out, out_len)
+                    : missing_property(out, out_len);
 }
 
-extern "C" WXD_EXPORTED int
-wxd_PropertyGrid_GetLabel(const wxd_PropertyGrid_t* self, const char* name,
-                          char* out, size_t out_len)
+int
+get_label(const wxPGProperty* property, char* out, size_t out_len)
 {
-    const wxPGProperty* property = find_property(as_grid(self), name);
-    if (!property) {
-        if (out && out_len)
-            out[0] = '\0';
-        return -1;
-    }
-    return static_cast<int>(
-        wxd_cpp_utils::copy_wxstring_to_buffer(property->GetLabel(), out, out_len));
+    return property ? copy_text(property->GetLabel(), out, out_len)
+                    : missing_property(out, out_len);
 }
 
-extern "C" WXD_EXPORTED bool
-wxd_PropertyGrid_SetLabel(wxd_PropertyGrid_t* self, const char* name, const char* label)
+bool
+set_label(wxPropertyGrid* grid, wxPGProperty* property, const char* label)
 {
-    wxPropertyGrid* grid = as_grid(self);
-    wxPGProperty* property = find_property(grid, name);
     if (!property)
         return false;
     grid->SetPropertyLabel(property, from_utf8(label));
     return true;
 }
 
-extern "C" WXD_EXPORTED int
-wxd_PropertyGrid_GetHelpString(const wxd_PropertyGrid_t* self, const char* name,
-                               char* out, size_t out_len)
+int
+get_help_string(const wxPGProperty* property, char* out, size_t out_len)
 {
-    const wxPGProperty* property = find_property(as_grid(self), name);
-    if (!property) {
-        if (out && out_len)
-            out[0] = '\0';
-        return -1;
-    }
-    return static_cast<int>(
-        wxd_cpp_utils::copy_wxstring_to_buffer(property->GetHelpString(), out, out_len));
+    return property ? copy_text(property->GetHelpString(), out, out_len)
+                    : missing_property(out, out_len);
 }
 
-extern "C" WXD_EXPORTED bool
-wxd_PropertyGrid_SetHelpString(wxd_PropertyGrid_t* self, const char* name,
-                               const char* help_string)
+bool
+set_help_string(wxPropertyGrid* grid, wxPGProperty* property, const char* help_string)
 {
-    wxPropertyGrid* grid = as_grid(self);
-    wxPGProperty* property = find_property(grid, name);
     if (!property)
         return false;
     grid->SetPropertyHelpString(property, from_utf8(help_string));
     return true;
 }
 
-extern "C" WXD_EXPORTED bool
-wxd_PropertyGrid_SetAttribute(wxd_PropertyGrid_t* self, const char* name,
-                              const char* attribute_name, const wxd_Variant_t* value)
+bool
+set_attribute(wxPropertyGrid* grid, wxPGProperty* property, const char* attribute_name,
+              const wxd_Variant_t* value)
 {
-    wxPropertyGrid* grid = as_grid(self);
-    wxPGProperty* property = find_property(grid, name);
     const wxVariant* variant = as_variant(value);
     if (!property || !attribute_name || !*attribute_name || !variant)
         return false;
@@ -386,6 +637,105 @@ wxd_PropertyGrid_SetAttribute(wxd_PropertyGrid_t* self, const char* name,
     return true;
 }
 
+bool
+set_read_only(wxPropertyGrid* grid, wxPGProperty* property, bool read_only)
+{
+    if (!property)
+        return false;
+    grid->SetPropertyReadOnly(property, read_only);
+    return true;
+}
+
+bool
+is_modified(const wxPropertyGrid* grid, const wxPGProperty* property)
+{
+    return property ? grid->IsPropertyModified(const_cast<wxPGProperty*>(property)) : false;
+}
+
+bool
+delete_property(wxPropertyGrid* grid, wxPGProperty* property)
+{
+    if (!property)
+        return false;
+    grid->DeleteProperty(property);
+    return true;
+}
+} // namespace
+
+extern "C" WXD_EXPORTED wxd_Variant_t*
+wxd_PropertyGrid_GetValue(const wxd_PropertyGrid_t* self, const char* name)
+{
+    const wxPropertyGrid* grid = as_grid(self);
+    return get_value(find_property(grid, name));
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_SetValue(wxd_PropertyGrid_t* self, const char* name, const wxd_Variant_t* value)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    return set_value(grid, find_property(grid, name), value);
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_ChangeValue(wxd_PropertyGrid_t* self, const char* name, const wxd_Variant_t* value)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    return change_value(grid, find_property(grid, name), value);
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_ClearValue(wxd_PropertyGrid_t* self, const char* name)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    return clear_value(grid, find_property(grid, name));
+}
+
+extern "C" WXD_EXPORTED int
+wxd_PropertyGrid_GetValueAsString(const wxd_PropertyGrid_t* self, const char* name, char* out,
+                                  size_t out_len)
+{
+    const wxPropertyGrid* grid = as_grid(self);
+    return get_value_as_string(find_property(grid, name), out, out_len);
+}
+
+extern "C" WXD_EXPORTED int
+wxd_PropertyGrid_GetLabel(const wxd_PropertyGrid_t* self, const char* name, char* out,
+                          size_t out_len)
+{
+    const wxPropertyGrid* grid = as_grid(self);
+    return get_label(find_property(grid, name), out, out_len);
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_SetLabel(wxd_PropertyGrid_t* self, const char* name, const char* label)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    return set_label(grid, find_property(grid, name), label);
+}
+
+extern "C" WXD_EXPORTED int
+wxd_PropertyGrid_GetHelpString(const wxd_PropertyGrid_t* self, const char* name, char* out,
+                               size_t out_len)
+{
+    const wxPropertyGrid* grid = as_grid(self);
+    return get_help_string(find_property(grid, name), out, out_len);
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_SetHelpString(wxd_PropertyGrid_t* self, const char* name, const char* help_string)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    return set_help_string(grid, find_property(grid, name), help_string);
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_SetAttribute(wxd_PropertyGrid_t* self, const char* name,
+                              const char* attribute_name, const wxd_Variant_t* value)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    return set_attribute(grid, find_property(grid, name), attribute_name, value);
+}
+
 extern "C" WXD_EXPORTED bool
 wxd_PropertyGrid_EnableProperty(wxd_PropertyGrid_t* self, const char* name, bool enable)
 {
@@ -403,42 +753,41 @@ wxd_PropertyGrid_HideProperty(wxd_PropertyGrid_t* self, const char* name, bool h
 }
 
 extern "C" WXD_EXPORTED bool
-wxd_PropertyGrid_SetPropertyReadOnly(wxd_PropertyGrid_t* self, const char* name,
-                                     bool read_only)
+wxd_PropertyGrid_SetPropertyReadOnly(wxd_PropertyGrid_t* self, const char* name, bool read_only)
 {
     wxPropertyGrid* grid = as_grid(self);
-    wxPGProperty* property = find_property(grid, name);
-    if (!property)
-        return false;
-    grid->SetPropertyReadOnly(property, read_only);
-    return true;
+    return set_read_only(grid, find_property(grid, name), read_only);
 }
 
 extern "C" WXD_EXPORTED bool
 wxd_PropertyGrid_IsPropertyEnabled(const wxd_PropertyGrid_t* self, const char* name)
 {
-    const wxPGProperty* property = find_property(as_grid(self), name);
+    const wxPropertyGrid* grid = as_grid(self);
+    const wxPGProperty* property = find_property(grid, name);
     return property ? property->IsEnabled() : false;
 }
 
 extern "C" WXD_EXPORTED bool
 wxd_PropertyGrid_IsPropertyHidden(const wxd_PropertyGrid_t* self, const char* name)
 {
-    const wxPGProperty* property = find_property(as_grid(self), name);
+    const wxPropertyGrid* grid = as_grid(self);
+    const wxPGProperty* property = find_property(grid, name);
     return property ? property->HasFlag(wxPGFlags::Hidden) : false;
 }
 
 extern "C" WXD_EXPORTED bool
 wxd_PropertyGrid_IsPropertyExpanded(const wxd_PropertyGrid_t* self, const char* name)
 {
-    const wxPGProperty* property = find_property(as_grid(self), name);
+    const wxPropertyGrid* grid = as_grid(self);
+    const wxPGProperty* property = find_property(grid, name);
     return property ? property->IsExpanded() : false;
 }
 
 extern "C" WXD_EXPORTED bool
 wxd_PropertyGrid_IsPropertyCategory(const wxd_PropertyGrid_t* self, const char* name)
 {
-    const wxPGProperty* property = find_property(as_grid(self), name);
+    const wxPropertyGrid* grid = as_grid(self);
+    const wxPGProperty* property = find_property(grid, name);
     return property ? property->IsCategory() : false;
 }
 
@@ -446,8 +795,7 @@ extern "C" WXD_EXPORTED bool
 wxd_PropertyGrid_IsPropertyModified(const wxd_PropertyGrid_t* self, const char* name)
 {
     const wxPropertyGrid* grid = as_grid(self);
-    const wxPGProperty* property = find_property(grid, name);
-    return property ? grid->IsPropertyModified(const_cast<wxPGProperty*>(property)) : false;
+    return is_modified(grid, find_property(grid, name));
 }
 
 extern "C" WXD_EXPORTED bool
@@ -455,7 +803,7 @@ wxd_PropertyGrid_Expand(wxd_PropertyGrid_t* self, const char* name)
 {
     wxPropertyGrid* grid = as_grid(self);
     wxPGProperty* property = find_property(grid, name);
-    return property ? grid->Expand(property) : false;
+    return expand(grid, property);
 }
 
 extern "C" WXD_EXPORTED bool
@@ -463,22 +811,29 @@ wxd_PropertyGrid_Collapse(wxd_PropertyGrid_t* self, const char* name)
 {
     wxPropertyGrid* grid = as_grid(self);
     wxPGProperty* property = find_property(grid, name);
-    return property ? grid->Collapse(property) : false;
+    return collapse(grid, property);
 }
 
 extern "C" WXD_EXPORTED bool
-wxd_PropertyGrid_ExpandAll(wxd_PropertyGrid_t* self, bool expand)
+wxd_PropertyGrid_SelectProperty(wxd_PropertyGrid_t* self, const char* name, bool focus)
 {
     wxPropertyGrid* grid = as_grid(self);
-    return grid ? grid->ExpandAll(expand) : false;
+    wxPGProperty* property = find_property(grid, name);
+    return property ? grid->SelectProperty(property, focus) : false;
 }
 
 extern "C" WXD_EXPORTED bool
-wxd_PropertyGrid_SelectProperty(wxd_PropertyGrid_t* self, const char* name, bool focus)
+wxd_PropertyGrid_DeleteProperty(wxd_PropertyGrid_t* self, const char* name)
 {
     wxPropertyGrid* grid = as_grid(self);
-    wxPGProperty* property = find_property(grid, name);
-    return property ? grid->SelectProperty(property, focus) : false;
+    return delete_property(grid, find_property(grid, name));
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_ExpandAll(wxd_PropertyGrid_t* self, bool expand)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    return expand_all(grid, expand);
 }
 
 extern "C" WXD_EXPORTED int
@@ -496,17 +851,6 @@ wxd_PropertyGrid_GetSelectedPropertyName(const wxd_PropertyGrid_t* self,
         wxd_cpp_utils::copy_wxstring_to_buffer(property->GetName(), out, out_len));
 }
 
-extern "C" WXD_EXPORTED bool
-wxd_PropertyGrid_DeleteProperty(wxd_PropertyGrid_t* self, const char* name)
-{
-    wxPropertyGrid* grid = as_grid(self);
-    wxPGProperty* property = find_property(grid, name);
-    if (!property)
-        return false;
-    grid->DeleteProperty(property);
-    return true;
-}
-
 extern "C" WXD_EXPORTED void
 wxd_PropertyGrid_Clear(wxd_PropertyGrid_t* self)
 {
@@ -570,6 +914,432 @@ wxd_PropertyGrid_Refresh(wxd_PropertyGrid_t* self)
         grid->Refresh();
 }
 
+extern "C" WXD_EXPORTED wxd_Variant_t*
+wxd_PropertyGrid_GetValueByHandle(const wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle)
+{
+    const wxPropertyGrid* grid = as_grid(self);
+    return get_value(find_property(grid, handle));
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_SetValueByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                  const wxd_Variant_t* value)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    return set_value(grid, find_property(grid, handle), value);
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_ChangeValueByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                     const wxd_Variant_t* value)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    return change_value(grid, find_property(grid, handle), value);
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_ClearValueByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    return clear_value(grid, find_property(grid, handle));
+}
+
+extern "C" WXD_EXPORTED int
+wxd_PropertyGrid_GetValueAsStringByHandle(const wxd_PropertyGrid_t* self,
+                                          wxd_PGPropertyHandle handle, char* out, size_t out_len)
+{
+    const wxPropertyGrid* grid = as_grid(self);
+    return get_value_as_string(find_property(grid, handle), out, out_len);
+}
+
+extern "C" WXD_EXPORTED int
+wxd_PropertyGrid_GetLabelByHandle(const wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                  char* out, size_t out_len)
+{
+    const wxPropertyGrid* grid = as_grid(self);
+    return get_label(find_property(grid, handle), out, out_len);
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_SetLabelByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                  const char* label)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    return set_label(grid, find_property(grid, handle), label);
+}
+
+extern "C" WXD_EXPORTED int
+wxd_PropertyGrid_GetHelpStringByHandle(const wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                       char* out, size_t out_len)
+{
+    const wxPropertyGrid* grid = as_grid(self);
+    return get_help_string(find_property(grid, handle), out, out_len);
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_SetHelpStringByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                       const char* help_string)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    return set_help_string(grid, find_property(grid, handle), help_string);
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_SetAttributeByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                      const char* attribute_name, const wxd_Variant_t* value)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    return set_attribute(grid, find_property(grid, handle), attribute_name, value);
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_EnablePropertyByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                        bool enable)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    wxPGProperty* property = find_property(grid, handle);
+    return property ? grid->EnableProperty(property, enable) : false;
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_HidePropertyByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                      bool hide)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    wxPGProperty* property = find_property(grid, handle);
+    return property ? grid->HideProperty(property, hide) : false;
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_SetPropertyReadOnlyByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                             bool read_only)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    return set_read_only(grid, find_property(grid, handle), read_only);
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_IsPropertyEnabledByHandle(const wxd_PropertyGrid_t* self,
+                                           wxd_PGPropertyHandle handle)
+{
+    const wxPropertyGrid* grid = as_grid(self);
+    const wxPGProperty* property = find_property(grid, handle);
+    return property ? property->IsEnabled() : false;
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_IsPropertyHiddenByHandle(const wxd_PropertyGrid_t* self,
+                                          wxd_PGPropertyHandle handle)
+{
+    const wxPropertyGrid* grid = as_grid(self);
+    const wxPGProperty* property = find_property(grid, handle);
+    return property ? property->HasFlag(wxPGFlags::Hidden) : false;
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_IsPropertyExpandedByHandle(const wxd_PropertyGrid_t* self,
+                                            wxd_PGPropertyHandle handle)
+{
+    const wxPropertyGrid* grid = as_grid(self);
+    const wxPGProperty* property = find_property(grid, handle);
+    return property ? property->IsExpanded() : false;
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_IsPropertyCategoryByHandle(const wxd_PropertyGrid_t* self,
+                                            wxd_PGPropertyHandle handle)
+{
+    const wxPropertyGrid* grid = as_grid(self);
+    const wxPGProperty* property = find_property(grid, handle);
+    return property ? property->IsCategory() : false;
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_IsPropertyModifiedByHandle(const wxd_PropertyGrid_t* self,
+                                            wxd_PGPropertyHandle handle)
+{
+    const wxPropertyGrid* grid = as_grid(self);
+    return is_modified(grid, find_property(grid, handle));
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_ExpandByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    wxPGProperty* property = find_property(grid, handle);
+    return expand(grid, property);
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_CollapseByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    wxPGProperty* property = find_property(grid, handle);
+    return collapse(grid, property);
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_SelectPropertyByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle,
+                                        bool focus)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    wxPGProperty* property = find_property(grid, handle);
+    return property ? grid->SelectProperty(property, focus) : false;
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_DeletePropertyByHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    return delete_property(grid, find_property(grid, handle));
+}
+
+extern "C" WXD_EXPORTED bool
+wxd_PropertyGrid_ContainsHandle(wxd_PropertyGrid_t* self, wxd_PGPropertyHandle handle)
+{
+    return find_property(as_grid(self), handle) != nullptr;
+}
+
+extern "C" WXD_EXPORTED wxd_PGPropertyHandle
+wxd_PropertyGrid_GetPropertyHandle(wxd_PropertyGrid_t* self, const char* name)
+{
+    const wxPGProperty* property = find_property(as_grid(self), name);
+    if (!property)
+        return 0;
+    auto found = s_handle_by_property.find(property);
+    return found != s_handle_by_property.end() ? found->second : 0;
+}
+
+namespace {
+struct SchemaText {
+    const char* data = nullptr;
+    uint32_t len = 0;
+
+    wxString
+    ToString() const
+    {
+        return len ? wxString::FromUTF8(data, len) : wxString();
+    }
+};
+
+struct SchemaEntry {
+    uint8_t kind = 0;
+    int32_t parent_index = -1;
+    SchemaText parent_name;
+    SchemaText label;
+    SchemaText name;
+    SchemaText text;
+    int64_t int_value = 0;
+    uint64_t uint_value = 0;
+    double float_value = 0;
+    std::vector<std::pair<SchemaText, int32_t>> choices;
+};
+
+class SchemaReader {
+public:
+    SchemaReader(const uint8_t* data, size_t len) : m_data(data), m_len(len) {}
+
+    bool
+    Read(std::vector<SchemaEntry>& entries)
+    {
+        uint32_t count = 0;
+        if (!Scalar(count) || count > m_len / 4)
+            return false;
+        entries.resize(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            SchemaEntry& entry = entries[i];
+            if (!Scalar(entry.kind) || !Scalar(entry.parent_index) ||
+                entry.parent_index >= static_cast<int32_t>(i) || !Text(entry.parent_name) ||
+                !Text(entry.label) || !Text(entry.name) || !Payload(entry)) {
+                return false;
+            }
+        }
+        return m_pos == m_len;
+    }
+
+private:
+    template<typename T>
+    bool
+    Scalar(T& out)
+    {
+        if (m_len - m_pos < sizeof(T))
+            return false;
+        uint64_t value = 0;
+        for (size_t i = 0; i < sizeof(T); ++i)
+            value |= uint64_t(m_data[m_pos + i]) << (8 * i);
+        m_pos += sizeof(T);
+        const std::make_unsigned_t<T> bits = static_cast<std::make_unsigned_t<T>>(value);
+        std::memcpy(&out, &bits, sizeof(T));
+        return true;
+    }
+
+    bool
+    Text(SchemaText& out)
+    {
+        if (!Scalar(out.len) || m_len - m_pos < out.len)
+            return false;
+        out.data = reinterpret_cast<const char*>(m_data + m_pos);
+        m_pos += out.len;
+        return true;
+    }
+
+    bool
+    Payload(SchemaEntry& entry)
+    {
+        switch (entry.kind) {
+        case WXD_PG_KIND_CATEGORY:
+            return true;
+        case WXD_PG_KIND_STRING:
+        case WXD_PG_KIND_FILE:
+        case WXD_PG_KIND_DIR:
+            return Text(entry.text);
+        case WXD_PG_KIND_INT:
+            return Scalar(entry.int_value);
+        case WXD_PG_KIND_UINT:
+            return Scalar(entry.uint_value);
+        case WXD_PG_KIND_BOOL: {
+            uint8_t flag = 0;
+            if (!Scalar(flag))
+                return false;
+            entry.uint_value = flag;
+            return true;
+        }
+        case WXD_PG_KIND_FLOAT: {
+            uint64_t bits = 0;
+            if (!Scalar(bits))
+                return false;
+            std::memcpy(&entry.float_value, &bits, sizeof(bits));
+            return true;
+        }
+        case WXD_PG_KIND_ENUM:
+        case WXD_PG_KIND_FLAGS: {
+            uint32_t count = 0;
+            if (!Scalar(count) || count > (m_len - m_pos) / 8)
+                return false;
+            entry.choices.resize(count);
+            for (auto& choice : entry.choices) {
+                if (!Text(choice.first) || !Scalar(choice.second))
+                    return false;
+            }
+            int32_t value = 0;
+            if (!Scalar(value))
+                return false;
+            entry.int_value = value;
+            return true;
+        }
+        }
+        return false;
+    }
+
+    const uint8_t* m_data;
+    size_t m_len;
+    size_t m_pos = 0;
+};
+
+std::unique_ptr<wxPGProperty>
+make_schema_property(const SchemaEntry& entry)
+{
+    const wxString label = entry.label.ToString();
+    const wxString name = entry.name.len ? entry.name.ToString() : wxString(wxPG_LABEL);
+    wxPGChoices choices;
+    for (const auto& choice : entry.choices)
+        choices.Add(choice.first.ToString(), choice.second);
+
+    switch (entry.kind) {
+    case WXD_PG_KIND_CATEGORY:
+        return std::make_unique<TrackedProperty<wxPropertyCategory>>(label, name);
+    case WXD_PG_KIND_STRING:
+        return std::make_unique<TrackedProperty<wxStringProperty>>(label, name,
+                                                                   entry.text.ToString());
+    case WXD_PG_KIND_INT:
+        return std::make_unique<TrackedProperty<wxIntProperty>>(label, name,
+                                                                wxLongLong(entry.int_value));
+    case WXD_PG_KIND_UINT:
+        return std::make_unique<TrackedProperty<wxUIntProperty>>(label, name,
+                                                                 wxULongLong(entry.uint_value));
+    case WXD_PG_KIND_FLOAT:
+        return std::make_unique<TrackedProperty<wxFloatProperty>>(label, name, entry.float_value);
+    case WXD_PG_KIND_BOOL:
+        return std::make_unique<TrackedProperty<wxBoolProperty>>(label, name,
+                                                                 entry.uint_value != 0);
+    case WXD_PG_KIND_ENUM:
+        return std::make_unique<TrackedProperty<wxEnumProperty>>(
+            label, name, choices, static_cast<int>(entry.int_value));
+    case WXD_PG_KIND_FLAGS:
+        return std::make_unique<TrackedProperty<wxFlagsProperty>>(
+            label, name, choices, static_cast<long>(entry.int_value));
+    case WXD_PG_KIND_FILE:
+        return std::make_unique<TrackedProperty<wxFileProperty>>(label, name,
+                                                                 entry.text.ToString());
+    case WXD_PG_KIND_DIR:
+        return std::make_unique<TrackedProperty<wxDirProperty>>(label, name,
+                                                                entry.text.ToString());
+    }
+    return nullptr;
+}
+} // namespace
+
+extern "C" WXD_EXPORTED int
+wxd_PropertyGrid_AppendProperties(wxd_PropertyGrid_t* self, const uint8_t* schema, size_t len,
+                                  wxd_PGPropertyHandle* out_handles)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    if (!grid || !schema)
+        return -1;
+
+    std::vector<SchemaEntry> entries;
+    if (!SchemaReader(schema, len).Read(entries))
+        return -1;
+
+    int appended = 0;
+    std::vector<wxPGProperty*> created(entries.size(), nullptr);
+    {
+        wxWindowUpdateLocker freeze(grid);
+        for (size_t i = 0; i < entries.size(); ++i) {
+            const SchemaEntry& entry = entries[i];
+            wxd_PGPropertyHandle handle = 0;
+            const wxString effective_name = entry.name.len ? entry.name.ToString()
+                                                           : entry.label.ToString();
+            wxPGProperty* parent = nullptr;
+            bool parent_ok = true;
+            if (entry.parent_index >= 0) {
+                parent = created[entry.parent_index];
+                parent_ok = parent != nullptr;
+            }
+            else if (entry.parent_name.len) {
+                parent = grid->GetPropertyByName(entry.parent_name.ToString());
+                parent_ok = parent != nullptr;
+            }
+            if (parent_ok && !effective_name.empty() && !grid->GetPropertyByName(effective_name))
+                handle = insert_property(grid, parent, make_schema_property(entry));
+            if (handle) {
+                created[i] = find_property(grid, handle);
+                ++appended;
+            }
+            if (out_handles)
+                out_handles[i] = handle;
+        }
+    }
+    return appended;
+}
+
+extern "C" WXD_EXPORTED size_t
+wxd_PropertyGrid_SetValues(wxd_PropertyGrid_t* self, const wxd_PGPropertyHandle* handles,
+                           const wxd_Variant_t* const* values, size_t count)
+{
+    wxPropertyGrid* grid = as_grid(self);
+    if (!grid || !handles || !values)
+        return 0;
+
+    size_t updated = 0;
+    wxWindowUpdateLocker freeze(grid);
+    for (size_t i = 0; i < count; ++i) {
+        if (set_value(grid, find_property(grid, handles[i]), values[i]))
+            ++updated;
+    }
+    return updated;
+}
+
 extern "C" WXD_EXPORTED int
 wxd_PropertyGridEvent_GetPropertyName(wxd_Event_t* event, char* out, size_t out_len)
 {
@@ -590,7 +1360,7 @@ wxd_PropertyGridEvent_GetValue(wxd_Event_t* event)
     if (!property_event)
         return nullptr;
     wxVariant* value = new (std::nothrow) wxVariant(property_event->GetValue());
-    return reinterpret_cast<wxd_Variant_t*>(value);
+    return reinterpret_cast<wxd_Variant_t*>(wxd_objstats::track(WXD_OBJECT_KIND_VARIANT, value));
 }
 
 extern "C" WXD_EXPORTED unsigned int
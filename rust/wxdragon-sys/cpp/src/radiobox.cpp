@@ -27,7 +27,8 @@ wxd_RadioBox_Create(wxd_Window_t* parent, wxd_Id id, const char* label, wxd_Poin
     }
 
     wxRadioBox* rbox = new wxRadioBox(parentWin, id, wxString::FromUTF8(label ? label : ""),
-                                      wxd_cpp_utils::to_wx(pos), wxd_cpp_utils::to_wx(size),
+                                      wxd_cpp_utils::to_wx(pos, parentWin),
+                                      wxd_cpp_utils::to_wx(size, parentWin),
                                       wxChoices, majorDimension, style);
 
     return (wxd_RadioBox_t*)rbox;
@@ -0,0 +1,241 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_visibility.h"
+#include <wx/display.h>
+#include <wx/region.h>
+#include <wx/timer.h>
+#include <wx/weakref.h>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+constexpr int kDefaultFrameMs = 16;
+
+// Paces the refreshes of one top-level window and its children. Owned through s_schedulers and
+// deleted with the window.
+class RefreshScheduler {
+public:
+    explicit RefreshScheduler(wxWindow* tlw) : m_tlw(tlw)
+    {
+        m_timer.Bind(wxEVT_TIMER, &RefreshScheduler::OnTimer, this);
+    }
+
+    ~RefreshScheduler()
+    {
+        m_timer.Stop();
+        if (m_free)
+            m_free(m_user_data);
+    }
+
+    void
+    Schedule(wxWindow* window, const wxRect* rect)
+    {
+        Pending* entry = Find(window);
+        if (!entry) {
+            m_pending.push_back(Pending{ window, wxRegion(), false });
+            entry = &m_pending.back();
+        }
+        if (!rect)
+            entry->whole = true;
+        else if (!entry->whole)
+            entry->region.Union(*rect);
+        Arm();
+    }
+
+    void
+    SetHook(wxd_FrameBeginCallback callback, void* user_data,
+            wxd_FrameBeginFreeUserData free_user_data)
+    {
+        if (m_free)
+            m_free(m_user_data);
+        m_hook = callback;
+        m_user_data = user_data;
+        m_free = free_user_data;
+    }
+
+    void
+    SetInterval(int milliseconds)
+    {
+        m_interval_override = std::max(0, milliseconds);
+    }
+
+    void
+    Flush()
+    {
+        m_timer.Stop();
+        if (m_pending.empty())
+            return;
+        // Held while the window cannot be seen; Resume() re-arms the frame.
+        if (!wxd_visibility::refresh_allowed(m_tlw))
+            return;
+        if (m_hook)
+            m_hook(m_user_data);
+        m_last_frame.Start();
+        m_frame_started = true;
+
+        std::vector<Pending> frame;
+        frame.swap(m_pending);
+        for (Pending& entry : frame) {
+            wxWindow* window = entry.window.get();
+            if (!window || window->IsBeingDeleted())
+                continue;
+            if (entry.whole) {
+                window->Refresh(false);
+                continue;
+            }
+            for (wxRegionIterator it(entry.region); it; ++it)
+                window->RefreshRect(it.GetRect(), false);
+        }
+    }
+
+    void
+    Resume()
+    {
+        if (!m_pending.empty())
+            Arm();
+    }
+
+private:
+    struct Pending {
+        wxWeakRef<wxWindow> window;
+        wxRegion region;
+        bool whole;
+    };
+
+    Pending*
+    Find(wxWindow* window)
+    {
+        for (Pending& entry : m_pending) {
+            if (entry.window.get() == window)
+                return &entry;
+        }
+        return nullptr;
+    }
+
+    int
+    Interval() const
+    {
+        if (m_interval_override > 0)
+            return m_interval_override;
+        const int index = wxDisplay::GetFromWindow(m_tlw);
+        if (index == wxNOT_FOUND)
+            return kDefaultFrameMs;
+        const int hz = wxDisplay(static_cast<unsigned>(index)).GetCurrentMode().GetRefresh();
+        return hz > 0 ? std::max(1, 1000 / hz) : kDefaultFrameMs;
+    }
+
+    // Starts the frame timer unless a frame is already due. A request after an idle period is
+    // served after the remainder of the current frame rather than waiting a full interval.
+    void
+    Arm()
+    {
+        if (m_timer.IsRunning())
+            return;
+        const int interval = Interval();
+        const long elapsed = m_frame_started ? m_last_frame.Time() : interval;
+        m_timer.StartOnce(static_cast<int>(std::max(1L, interval - elapsed)));
+    }
+
+    void
+    OnTimer(wxTimerEvent&)
+    {
+        Flush();
+    }
+
+    wxWindow* m_tlw;
+    wxTimer m_timer;
+    wxStopWatch m_last_frame;
+    bool m_frame_started = false;
+    int m_interval_override = 0;
+    std::vector<Pending> m_pending;
+    wxd_FrameBeginCallback m_hook = nullptr;
+    void* m_user_data = nullptr;
+    wxd_FrameBeginFreeUserData m_free = nullptr;
+};
+
+// GUI-thread only.
+std::unordered_map<wxWindow*, RefreshScheduler*> s_schedulers;
+
+void
+on_scheduled_tlw_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    auto found = s_schedulers.find(static_cast<wxWindow*>(event.GetEventObject()));
+    if (found == s_schedulers.end())
+        return;
+    delete found->second;
+    s_schedulers.erase(found);
+}
+
+RefreshScheduler*
+scheduler_for(wxd_Window_t* window)
+{
+    wxWindow* win = reinterpret_cast<wxWindow*>(window);
+    if (!win)
+        return nullptr;
+    wxWindow* tlw = wxGetTopLevelParent(win);
+    if (!tlw)
+        tlw = win;
+    auto found = s_schedulers.find(tlw);
+    if (found != s_schedulers.end())
+        return found->second;
+    RefreshScheduler* scheduler = new RefreshScheduler(tlw);
+    s_schedulers[tlw] = scheduler;
+    tlw->Bind(wxEVT_DESTROY, &on_scheduled_tlw_destroy);
+    return scheduler;
+}
+
+} // namespace
+
+void
+wxd_visibility::resume_scheduled_refresh(wxWindow* tlw)
+{
+    auto found = s_schedulers.find(tlw);
+    if (found != s_schedulers.end())
+        found->second->Resume();
+}
+
+WXD_EXPORTED void
+wxd_Window_ScheduleRefresh(wxd_Window_t* window, const wxd_Rect* rect)
+{
+    RefreshScheduler* scheduler = scheduler_for(window);
+    if (!scheduler)
+        return;
+    if (rect) {
+        const wxRect r(rect->x, rect->y, rect->width, rect->height);
+        scheduler->Schedule(reinterpret_cast<wxWindow*>(window), &r);
+    }
+    else {
+        scheduler->Schedule(reinterpret_cast<wxWindow*>(window), nullptr);
+    }
+}
+
+WXD_EXPORTED void
+wxd_Window_SetFrameBeginCallback(wxd_Window_t* window, wxd_FrameBeginCallback callback,
+                                 void* user_data, wxd_FrameBeginFreeUserData free_user_data)
+{
+    RefreshScheduler* scheduler = scheduler_for(window);
+    if (!scheduler) {
+        if (free_user_data)
+            free_user_data(user_data);
+        return;
+    }
+    scheduler->SetHook(callback, user_data, free_user_data);
+}
+
+WXD_EXPORTED void
+wxd_Window_SetFrameInterval(wxd_Window_t* window, int milliseconds)
+{
+    if (RefreshScheduler* scheduler = scheduler_for(window))
+        scheduler->SetInterval(milliseconds);
+}
+
+WXD_EXPORTED void
+wxd_Window_FlushScheduledRefresh(wxd_Window_t* window)
+{
+    if (RefreshScheduler* scheduler = scheduler_for(window))
+        scheduler->Flush();
+}
@@ -0,0 +1,270 @@
+#include "wxd_resize.h"
+#include "wxd_pixels.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <new>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define WXD_RESIZE_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define WXD_RESIZE_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+// Weights are 14-bit fixed point: even the overshooting bicubic centre tap of an edge pixel
+// fits an int16, as the SSE2 multiply-add needs, and 255 times the weight sum fits an int32.
+constexpr int kBits = 14;
+constexpr int kOne = 1 << kBits;
+
+// Filter taps of every output coordinate along one axis.
+struct Taps {
+    std::vector<int> first;       // first input coordinate
+    std::vector<int> count;       // number of inputs
+    std::vector<int16_t> weights; // `stride` per output, `count` of them used
+    int stride = 0;
+};
+
+double
+box(double x)
+{
+    return x >= -0.5 && x < 0.5 ? 1.0 : 0.0;
+}
+
+double
+triangle(double x)
+{
+    x = std::fabs(x);
+    return x < 1.0 ? 1.0 - x : 0.0;
+}
+
+// Keys' cubic with a = -0.5 (Catmull-Rom).
+double
+cubic(double x)
+{
+    constexpr double a = -0.5;
+    x = std::fabs(x);
+    if (x < 1.0)
+        return ((a + 2.0) * x - (a + 3.0)) * x * x + 1.0;
+    if (x < 2.0)
+        return (((x - 5.0) * x + 8.0) * x - 4.0) * a;
+    return 0.0;
+}
+
+// Like Pillow: when shrinking, the kernel is stretched over `in / out` inputs, so every input
+// contributes and downscaling does not alias.
+bool
+compute_taps(int in, int out, double (*kernel)(double), double support, Taps& taps)
+{
+    const double scale = static_cast<double>(in) / out;
+    const double stretch = std::max(scale, 1.0);
+    support *= stretch;
+    taps.stride = static_cast<int>(std::ceil(support)) * 2 + 1;
+    try {
+        taps.first.resize(out);
+        taps.count.resize(out);
+        taps.weights.assign(static_cast<size_t>(out) * taps.stride, 0);
+    }
+    catch (const std::bad_alloc&) {
+        return false;
+    }
+    std::vector<double> w(taps.stride);
+    for (int o = 0; o < out; ++o) {
+        const double centre = (o + 0.5) * scale;
+        const int lo = std::max(static_cast<int>(centre - support + 0.5), 0);
+        const int hi = std::min(static_cast<int>(centre + support + 0.5), in);
+        const int n = std::max(std::min(hi - lo, taps.stride), 1);
+        double sum = 0.0;
+        for (int i = 0; i < n; ++i) {
+            w[i] = kernel((lo + i - centre + 0.5) / stretch);
+            sum += w[i];
+        }
+        int16_t* q = &taps.weights[static_cast<size_t>(o) * taps.stride];
+        int total = 0;
+        int largest = 0;
+        for (int i = 0; i < n; ++i) {
+            const double v = sum != 0.0 ? w[i] / sum : (i == 0 ? 1.0 : 0.0);
+            q[i] = static_cast<int16_t>(std::clamp(std::lround(v * kOne), -32768L, 32767L));
+            total += q[i];
+            if (q[i] > q[largest])
+                largest = i;
+        }
+        // Rounding must not brighten or darken flat areas.
+        q[largest] = static_cast<int16_t>(q[largest] + (kOne - total));
+        taps.first[o] = std::min(lo, in - 1);
+        taps.count[o] = n;
+    }
+    return true;
+}
+
+inline uint32_t
+load_pixel(const uint8_t* p)
+{
+    uint32_t v;
+    std::memcpy(&v, p, 4);
+    return v;
+}
+
+// Weighted sum of `n` pixels `step` bytes apart, rounded and clamped to bytes.
+inline void
+convolve(const uint8_t* p, size_t step, const int16_t* w, int n, uint8_t* out)
+{
+#if WXD_RESIZE_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = _mm_set1_epi32(1 << (kBits - 1));
+    int k = 0;
+    for (; k + 1 < n; k += 2) {
+        // [r0 r1 g0 g1 b0 b1 a0 a1] against [w0 w1 ...]: one multiply-add covers two taps.
+        const __m128i p0 = _mm_cvtsi32_si128(static_cast<int>(load_pixel(p + k * step)));
+        const __m128i p1 = _mm_cvtsi32_si128(static_cast<int>(load_pixel(p + (k + 1) * step)));
+        const __m128i px = _mm_unpacklo_epi8(_mm_unpacklo_epi8(p0, p1), zero);
+        const int pair = static_cast<uint16_t>(w[k]) | (static_cast<int>(w[k + 1]) << 16);
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(px, _mm_set1_epi32(pair)));
+    }
+    if (k < n) {
+        const __m128i p0 = _mm_cvtsi32_si128(static_cast<int>(load_pixel(p + k * step)));
+        const __m128i px = _mm_unpacklo_epi16(_mm_unpacklo_epi8(p0, zero), zero);
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(px, _mm_set1_epi32(static_cast<uint16_t>(w[k]))));
+    }
+    acc = _mm_srai_epi32(acc, kBits);
+    const __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(acc, acc), zero);
+    const uint32_t v = static_cast<uint32_t>(_mm_cvtsi128_si32(bytes));
+    std::memcpy(out, &v, 4);
+#elif WXD_RESIZE_NEON
+    int32x4_t acc = vdupq_n_s32(1 << (kBits - 1));
+    for (int k = 0; k < n; ++k) {
+        const uint8x8_t px = vreinterpret_u8_u32(vdup_n_u32(load_pixel(p + k * step)));
+        const int16x4_t wide = vget_low_s16(vreinterpretq_s16_u16(vmovl_u8(px)));
+        acc = vmlal_n_s16(acc, wide, w[k]);
+    }
+    const uint16x4_t narrow = vqmovun_s32(vshrq_n_s32(acc, kBits));
+    const uint8x8_t bytes = vqmovn_u16(vcombine_u16(narrow, narrow));
+    vst1_lane_u32(reinterpret_cast<uint32_t*>(out), vreinterpret_u32_u8(bytes), 0);
+#else
+    int acc[4] = { 1 << (kBits - 1), 1 << (kBits - 1), 1 << (kBits - 1), 1 << (kBits - 1) };
+    for (int k = 0; k < n; ++k) {
+        const uint8_t* px = p + k * step;
+        for (int c = 0; c < 4; ++c)
+            acc[c] += px[c] * w[k];
+    }
+    for (int c = 0; c < 4; ++c)
+        out[c] = static_cast<uint8_t>(std::clamp(acc[c] >> kBits, 0, 255));
+#endif
+}
+
+void
+unpremultiply_row(uint8_t* row, int width)
+{
+    for (int x = 0; x < width; ++x) {
+        uint8_t* px = row + x * 4;
+        const unsigned a = px[3];
+        if (a == 255)
+            continue;
+        if (a == 0) {
+            px[0] = px[1] = px[2] = 0;
+            continue;
+        }
+        for (int c = 0; c < 3; ++c)
+            px[c] = static_cast<uint8_t>(std::min(255u, (px[c] * 255u + a / 2) / a));
+    }
+}
+
+void
+resize_nearest(const uint8_t* src, int src_w, int src_h, size_t src_stride, uint8_t* dst,
+               int dst_w, int dst_h, size_t dst_stride)
+{
+    std::vector<int> xs(dst_w);
+    for (int x = 0; x < dst_w; ++x)
+        xs[x] = std::min(static_cast<int>((x + 0.5) * src_w / dst_w), src_w - 1);
+    for (int y = 0; y < dst_h; ++y) {
+        const int sy = std::min(static_cast<int>((y + 0.5) * src_h / dst_h), src_h - 1);
+        const uint8_t* in = src + sy * src_stride;
+        uint8_t* out = dst + y * dst_stride;
+        for (int x = 0; x < dst_w; ++x)
+            std::memcpy(out + x * 4, in + xs[x] * 4, 4);
+    }
+}
+
+} // namespace
+
+namespace wxd_resize {
+
+bool
+resize_rgba(const uint8_t* src, int src_w, int src_h, size_t src_stride, uint8_t* dst, int dst_w,
+            int dst_h, size_t dst_stride, Filter filter)
+{
+    if (!src || !dst || src_w <= 0 || src_h <= 0 || dst_w <= 0 || dst_h <= 0)
+        return false;
+    if (!src_stride)
+        src_stride = static_cast<size_t>(src_w) * 4;
+    if (!dst_stride)
+        dst_stride = static_cast<size_t>(dst_w) * 4;
+    if (filter == Filter::Nearest) {
+        resize_nearest(src, src_w, src_h, src_stride, dst, dst_w, dst_h, dst_stride);
+        return true;
+    }
+
+    double (*kernel)(double) = cubic;
+    double support = 2.0;
+    if (filter == Filter::Box) {
+        kernel = box;
+        support = 0.5;
+    }
+    else if (filter == Filter::Bilinear) {
+        kernel = triangle;
+        support = 1.0;
+    }
+    Taps horizontal, vertical;
+    if (!compute_taps(src_w, dst_w, kernel, support, horizontal) ||
+        !compute_taps(src_h, dst_h, kernel, support, vertical))
+        return false;
+
+    // Horizontal pass over the source rows the vertical taps use, premultiplying each first.
+    int row_lo = src_h, row_hi = 0;
+    for (int y = 0; y < dst_h; ++y) {
+        row_lo = std::min(row_lo, vertical.first[y]);
+        row_hi = std::max(row_hi, vertical.first[y] + vertical.count[y]);
+    }
+    const size_t mid_stride = static_cast<size_t>(dst_w) * 4;
+    std::vector<uint8_t> mid, row;
+    try {
+        mid.resize(mid_stride * (row_hi - row_lo));
+        row.resize(static_cast<size_t>(src_w) * 4);
+    }
+    catch (const std::bad_alloc&) {
+        return false;
+    }
+    static const int kRgba[4] = { 0, 1, 2, 3 };
+    for (int y = row_lo; y < row_hi; ++y) {
+        wxd_pixels::convert_rgba(src + y * src_stride, row.data(), src_w, kRgba, true);
+        uint8_t* out = &mid[(y - row_lo) * mid_stride];
+        for (int x = 0; x < dst_w; ++x) {
+            convolve(row.data() + horizontal.first[x] * 4, 4,
+                     &horizontal.weights[static_cast<size_t>(x) * horizontal.stride],
+                     horizontal.count[x], out + x * 4);
+        }
+    }
+
+    for (int y = 0; y < dst_h; ++y) {
+        const uint8_t* in = &mid[(vertical.first[y] - row_lo) * mid_stride];
+        const int16_t* w = &vertical.weights[static_cast<size_t>(y) * vertical.stride];
+        uint8_t* out = dst + y * dst_stride;
+        for (int x = 0; x < dst_w; ++x)
+            convolve(in + x * 4, mid_stride, w, vertical.count[y], out + x * 4);
+        // Bicubic overshoot can leave colour above alpha, which is not a premultiplied value.
+        for (int x = 0; x < dst_w; ++x) {
+            uint8_t* px = out + x * 4;
+            px[0] = std::min(px[0], px[3]);
+            px[1] = std::min(px[1], px[3]);
+            px[2] = std::min(px[2], px[3]);
+        }
+        unpremultiply_row(out, dst_w);
+    }
+    return true;
+}
+
+} // namespace wxd_resize
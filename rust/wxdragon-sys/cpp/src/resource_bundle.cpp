@@ -0,0 +1,375 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_mapped_file.h"
+#include "wxd_resource_bundle.h"
+#include <wx/filesys.h>
+#include <wx/mstream.h>
+#include <wx/translation.h>
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+constexpr char kMagic[8] = { 'W', 'X', 'D', 'P', 'A', 'C', 'K', '1' };
+constexpr size_t kHeaderSize = 16;
+constexpr size_t kEntrySize = 24;
+const char kProtocol[] = "wxdres";
+
+template <typename T>
+T
+read_le(const uint8_t* p)
+{
+    T value = 0;
+    for (size_t i = sizeof(T); i > 0; --i)
+        value = static_cast<T>((value << 8) | p[i - 1]);
+    return value;
+}
+
+// A mapped archive with its entry table decoded; immutable once opened, so shared freely.
+class Archive {
+public:
+    struct Entry {
+        std::string_view name;
+        const uint8_t* data;
+        size_t size;
+    };
+
+    bool
+    Open(const wxString& path)
+    {
+        return m_file.Open(path) && Parse();
+    }
+
+    const Entry*
+    Find(std::string_view name) const
+    {
+        auto it = std::lower_bound(m_entries.begin(), m_entries.end(), name,
+                                   [](const Entry& e, std::string_view n) { return e.name < n; });
+        return it != m_entries.end() && it->name == name ? &*it : nullptr;
+    }
+
+    const std::vector<Entry>&
+    Entries() const
+    {
+        return m_entries;
+    }
+
+private:
+    bool
+    Parse()
+    {
+        const uint8_t* base = m_file.Data();
+        const uint64_t size = m_file.Size();
+        if (size < kHeaderSize || std::memcmp(base, kMagic, sizeof(kMagic)) != 0)
+            return false;
+        const uint64_t count = read_le<uint32_t>(base + 8);
+        const uint64_t names_size = read_le<uint32_t>(base + 12);
+        const uint64_t names_start = kHeaderSize + count * kEntrySize;
+        if (names_start > size || names_size > size - names_start)
+            return false;
+        const char* names = reinterpret_cast<const char*>(base + names_start);
+
+        m_entries.reserve(count);
+        for (uint64_t i = 0; i < count; ++i) {
+            const uint8_t* record = base + kHeaderSize + i * kEntrySize;
+            const uint64_t data_offset = read_le<uint64_t>(record);
+            const uint64_t data_size = read_le<uint64_t>(record + 8);
+            const uint64_t name_offset = read_le<uint32_t>(record + 16);
+            const uint64_t name_size = read_le<uint32_t>(record + 20);
+            if (data_size > size || data_offset > size - data_size ||
+                name_offset + name_size > names_size)
+                return false;
+            Entry entry{ std::string_view(names + name_offset, name_size), base + data_offset,
+                         static_cast<size_t>(data_size) };
+            // Lookups binary-search the table, so reject archives that are not sorted.
+            if (!m_entries.empty() && !(m_entries.back().name < entry.name))
+                return false;
+            m_entries.push_back(entry);
+        }
+        return true;
+    }
+
+    wxdMappedFile m_file;
+    std::vector<Entry> m_entries;
+};
+
+using ArchivePtr = std::shared_ptr<const Archive>;
+
+std::mutex&
+mounts_mutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+std::unordered_map<std::string, ArchivePtr>&
+mounts()
+{
+    static std::unordered_map<std::string, ArchivePtr> table;
+    return table;
+}
+
+ArchivePtr
+find_mount(const std::string& mount)
+{
+    std::lock_guard<std::mutex> lock(mounts_mutex());
+    auto it = mounts().find(mount);
+    return it != mounts().end() ? it->second : nullptr;
+}
+
+bool
+valid_mount(const std::string& mount)
+{
+    return !mount.empty() && std::all_of(mount.begin(), mount.end(), [](char c) {
+        return wxIsalnum(c) || c == '_' || c == '-' || c == '.';
+    });
+}
+
+// Splits "mount/name" (a location without the protocol) into its parts.
+bool
+split_location(const wxString& right, std::string& mount, std::string& name)
+{
+    const std::string utf8 = right.utf8_string();
+    const size_t slash = utf8.find('/');
+    if (slash == std::string::npos)
+        return false;
+    mount = utf8.substr(0, slash);
+    name = utf8.substr(slash + 1);
+    return true;
+}
+
+wxString
+make_location(const std::string& mount, std::string_view name)
+{
+    return wxString(kProtocol) + ":" + wxString::FromUTF8(mount.data(), mount.size()) + "/" +
+           wxString::FromUTF8(name.data(), name.size());
+}
+
+// Reads an entry in place; keeps the archive mapped while the stream is alive.
+class ArchiveStream : public wxMemoryInputStream {
+public:
+    ArchiveStream(ArchivePtr archive, const Archive::Entry& entry)
+        : wxMemoryInputStream(entry.data, entry.size), m_archive(std::move(archive))
+    {
+    }
+
+private:
+    ArchivePtr m_archive;
+};
+
+// Serves "wxdres:<mount>/<name>" locations from the mounted archives.
+class ResourceFSHandler : public wxFileSystemHandler {
+public:
+    bool
+    CanOpen(const wxString& location) override
+    {
+        return GetProtocol(location) == kProtocol;
+    }
+
+    wxFSFile*
+    OpenFile(wxFileSystem& WXUNUSED(fs), const wxString& location) override
+    {
+        std::string mount, name;
+        if (!split_location(GetRightLocation(location), mount, name))
+            return nullptr;
+        ArchivePtr archive = find_mount(mount);
+        const Archive::Entry* entry = archive ? archive->Find(name) : nullptr;
+        if (!entry)
+            return nullptr;
+        return new wxFSFile(new ArchiveStream(archive, *entry), location,
+                            GetMimeTypeFromExt(location), GetAnchor(location),
+                            wxDateTime());
+    }
+
+    wxString
+    FindFirst(const wxString& spec, int flags) override
+    {
+        m_matches.clear();
+        m_next = 0;
+        std::string mount, pattern;
+        if (flags == wxDIR || !split_location(GetRightLocation(spec), mount, pattern))
+            return wxString();
+        ArchivePtr archive = find_mount(mount);
+        if (!archive)
+            return wxString();
+        const wxString wild = wxString::FromUTF8(pattern);
+        for (const Archive::Entry& entry : archive->Entries()) {
+            const wxString name = wxString::FromUTF8(entry.name.data(), entry.name.size());
+            if (wxMatchWild(wild, name, false))
+                m_matches.push_back(make_location(mount, entry.name));
+        }
+        return FindNext();
+    }
+
+    wxString
+    FindNext() override
+    {
+        return m_next < m_matches.size() ? m_matches[m_next++] : wxString();
+    }
+
+private:
+    std::vector<wxString> m_matches;
+    size_t m_next = 0;
+};
+
+// Loads .mo catalogs from an archive; wxMsgCatalog parses them straight from the mapping.
+class ResourceTranslationsLoader : public wxTranslationsLoader {
+public:
+    ResourceTranslationsLoader(ArchivePtr archive, std::string prefix)
+        : m_archive(std::move(archive)), m_prefix(std::move(prefix))
+    {
+    }
+
+    wxMsgCatalog*
+    LoadCatalog(const wxString& domain, const wxString& lang) override
+    {
+        const std::string base = m_prefix + lang.utf8_string() + "/";
+        const std::string file = domain.utf8_string() + ".mo";
+        for (const std::string& name : { base + file, base + "LC_MESSAGES/" + file }) {
+            if (const Archive::Entry* entry = m_archive->Find(name)) {
+                return wxMsgCatalog::CreateFromData(
+                    wxScopedCharBuffer::CreateNonOwned(reinterpret_cast<const char*>(entry->data),
+                                                       entry->size),
+                    domain);
+            }
+        }
+        return nullptr;
+    }
+
+    wxArrayString
+    GetAvailableTranslations(const wxString& domain) const override
+    {
+        const std::string file = domain.utf8_string() + ".mo";
+        wxArrayString langs;
+        for (const Archive::Entry& entry : m_archive->Entries()) {
+            if (entry.name.compare(0, m_prefix.size(), m_prefix) != 0)
+                continue;
+            const std::string_view rest = entry.name.substr(m_prefix.size());
+            const size_t slash = rest.find('/');
+            if (slash == std::string_view::npos || slash == 0)
+                continue;
+            const std::string_view tail = rest.substr(slash + 1);
+            if (tail != file && tail != "LC_MESSAGES/" + file)
+                continue;
+            const wxString lang = wxString::FromUTF8(rest.data(), slash);
+            if (langs.Index(lang) == wxNOT_FOUND)
+                langs.push_back(lang);
+        }
+        return langs;
+    }
+
+private:
+    ArchivePtr m_archive;
+    std::string m_prefix; // empty or ending with '/'
+};
+
+} // namespace
+
+struct wxd_ResourceBundle_t {
+    ArchivePtr archive;
+    std::string mount;
+};
+
+std::shared_ptr<const void>
+wxd_resources::retain(const wxd_ResourceBundle_t* bundle)
+{
+    return bundle ? bundle->archive : nullptr;
+}
+
+extern "C" {
+
+WXD_EXPORTED wxd_ResourceBundle_t*
+wxd_ResourceBundle_Open(const char* path, const char* mount)
+{
+    if (!path || !mount || !valid_mount(mount))
+        return nullptr;
+    auto archive = std::make_shared<Archive>();
+    if (!archive->Open(wxString::FromUTF8(path)))
+        return nullptr;
+
+    static bool handler_added = false;
+    if (!handler_added) {
+        wxFileSystem::AddHandler(new ResourceFSHandler);
+        handler_added = true;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mounts_mutex());
+        mounts()[mount] = archive;
+    }
+    return new wxd_ResourceBundle_t{ std::move(archive), mount };
+}
+
+WXD_EXPORTED void
+wxd_ResourceBundle_Close(wxd_ResourceBundle_t* self)
+{
+    if (!self)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(mounts_mutex());
+        auto it = mounts().find(self->mount);
+        if (it != mounts().end() && it->second == self->archive)
+            mounts().erase(it);
+    }
+    delete self;
+}
+
+WXD_EXPORTED size_t
+wxd_ResourceBundle_GetCount(const wxd_ResourceBundle_t* self)
+{
+    return self ? self->archive->Entries().size() : 0;
+}
+
+WXD_EXPORTED size_t
+wxd_ResourceBundle_GetNames(const wxd_ResourceBundle_t* self, wxd_ArrayString_t* out)
+{
+    if (!self)
+        return 0;
+    const auto& entries = self->archive->Entries();
+    if (out) {
+        wxArrayString* names = reinterpret_cast<wxArrayString*>(out);
+        names->clear();
+        names->reserve(entries.size());
+        for (const Archive::Entry& entry : entries)
+            names->push_back(wxString::FromUTF8(entry.name.data(), entry.name.size()));
+    }
+    return entries.size();
+}
+
+WXD_EXPORTED bool
+wxd_ResourceBundle_Find(const wxd_ResourceBundle_t* self, const char* name, const uint8_t** data,
+                        size_t* len)
+{
+    const Archive::Entry* entry = self && name ? self->archive->Find(name) : nullptr;
+    if (!entry)
+        return false;
+    if (data)
+        *data = entry->data;
+    if (len)
+        *len = entry->size;
+    return true;
+}
+
+WXD_EXPORTED void
+wxd_Translations_SetResourceLoader(wxd_Translations_t* translations,
+                                   const wxd_ResourceBundle_t* bundle, const char* prefix)
+{
+    if (!translations || !bundle)
+        return;
+    std::string normalized = prefix ? prefix : "";
+    while (!normalized.empty() && normalized.back() == '/')
+        normalized.pop_back();
+    if (!normalized.empty())
+        normalized += '/';
+    // wxTranslations takes ownership of the loader.
+    reinterpret_cast<wxTranslations*>(translations)
+        ->SetLoader(new ResourceTranslationsLoader(bundle->archive, std::move(normalized)));
+}
+
+} // extern "C"
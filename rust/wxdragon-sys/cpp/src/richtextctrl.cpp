@@ -5,8 +5,51 @@
 #endif
 
 #include "wx/richtext/richtextctrl.h"
+#include "wx/richtext/richtexthtml.h"
+#include "wx/richtext/richtextxml.h"
+#include "wx/mstream.h"
 #include "wxdragon.h"
 #include "wxd_utils.h"
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+wxRichTextAttr
+to_rich_text_attr(const wxd_RichTextRunStyle& style)
+{
+    wxRichTextAttr attr;
+    if (style.text_colour.a != 0)
+        attr.SetTextColour(wxColour(style.text_colour.r, style.text_colour.g,
+                                    style.text_colour.b, style.text_colour.a));
+    if (style.background_colour.a != 0)
+        attr.SetBackgroundColour(wxColour(style.background_colour.r, style.background_colour.g,
+                                          style.background_colour.b, style.background_colour.a));
+    if (style.font_size > 0)
+        attr.SetFontSize(style.font_size);
+    if (style.bold)
+        attr.SetFontWeight(wxFONTWEIGHT_BOLD);
+    if (style.italic)
+        attr.SetFontStyle(wxFONTSTYLE_ITALIC);
+    if (style.underline)
+        attr.SetFontUnderlined(true);
+    return attr;
+}
+
+// The XML and HTML handlers are not installed by default; add them when first needed.
+void
+ensure_file_handler(int type)
+{
+    if (wxRichTextBuffer::FindHandler(type))
+        return;
+    if (type == wxRICHTEXT_TYPE_XML)
+        wxRichTextBuffer::AddHandler(new wxRichTextXMLHandler);
+    else if (type == wxRICHTEXT_TYPE_HTML)
+        wxRichTextBuffer::AddHandler(new wxRichTextHTMLHandler);
+}
+
+} // namespace
 
 extern "C" {
 
@@ -17,7 +60,8 @@ wxd_RichTextCtrl_Create(wxd_Window_t* parent, wxd_Id id, const char* value, wxd_
 {
     wxWindow* parentWin = (wxWindow*)parent;
     wxRichTextCtrl* ctrl = new wxRichTextCtrl(parentWin, id, wxString::FromUTF8(value ? value : ""),
-                                              wxd_cpp_utils::to_wx(pos), wxd_cpp_utils::to_wx(size),
+                                              wxd_cpp_utils::to_wx(pos, parentWin),
+                                              wxd_cpp_utils::to_wx(size, parentWin),
                                               style);
     return (wxd_RichTextCtrl_t*)ctrl;
 }
@@ -65,6 +109,48 @@ wxd_RichTextCtrl_AppendText(wxd_RichTextCtrl_t* self, const char* text)
     }
 }
 
+WXD_EXPORTED bool
+wxd_RichTextCtrl_AppendRuns(wxd_RichTextCtrl_t* self, const wxd_RichTextRunStyle* palette,
+                            size_t palette_len, const wxd_RichTextRun* runs, size_t count)
+{
+    wxRichTextCtrl* ctrl = (wxRichTextCtrl*)self;
+    if (!ctrl || (!runs && count > 0))
+        return false;
+    if (count == 0)
+        return true;
+
+    std::vector<wxRichTextAttr> attrs;
+    attrs.reserve(palette ? palette_len : 0);
+    for (size_t i = 0; palette && i < palette_len; ++i)
+        attrs.push_back(to_rich_text_attr(palette[i]));
+
+    // While frozen the control only marks the buffer dirty; Thaw lays it out once.
+    ctrl->Freeze();
+    ctrl->BeginSuppressUndo();
+    ctrl->SetInsertionPointEnd();
+    std::string text;
+    for (size_t i = 0; i < count;) {
+        // Adjacent runs sharing a style are written as one object.
+        const int style = runs[i].style;
+        text.clear();
+        for (; i < count && runs[i].style == style; ++i) {
+            if (runs[i].text)
+                text.append(runs[i].text, runs[i].len);
+        }
+        if (text.empty())
+            continue;
+        const bool styled = style >= 0 && static_cast<size_t>(style) < attrs.size();
+        if (styled)
+            ctrl->BeginStyle(attrs[static_cast<size_t>(style)]);
+        ctrl->WriteText(wxString::FromUTF8(text.data(), text.size()));
+        if (styled)
+            ctrl->EndStyle();
+    }
+    ctrl->EndSuppressUndo();
+    ctrl->Thaw();
+    return true;
+}
+
 // Clear the wxRichTextCtrl contents
 WXD_EXPORTED void
 wxd_RichTextCtrl_Clear(wxd_RichTextCtrl_t* self)
@@ -322,6 +408,55 @@ wxd_RichTextCtrl_SaveFile(wxd_RichTextCtrl_t* self, const char* filename, int ty
     return ctrl->SaveFile(wxString::FromUTF8(filename), type);
 }
 
+WXD_EXPORTED bool
+wxd_RichTextCtrl_LoadFromBuffer(wxd_RichTextCtrl_t* self, const uint8_t* data, size_t len,
+                                int type)
+{
+    wxRichTextCtrl* ctrl = (wxRichTextCtrl*)self;
+    if (!ctrl || (!data && len > 0))
+        return false;
+    if (type == wxRICHTEXT_TYPE_ANY) {
+        static const char xml_prolog[] = "<?xml";
+        const size_t prolog_len = sizeof(xml_prolog) - 1;
+        type = len >= prolog_len && std::memcmp(data, xml_prolog, prolog_len) == 0
+                   ? wxRICHTEXT_TYPE_XML
+                   : wxRICHTEXT_TYPE_TEXT;
+    }
+    ensure_file_handler(type);
+
+    // The stream reads the caller's bytes directly; the handler parses them into the buffer.
+    wxMemoryInputStream stream(data, len);
+    if (!ctrl->GetBuffer().LoadFile(stream, type))
+        return false;
+    // What wxRichTextCtrl::LoadFile does after loading from a file.
+    ctrl->DiscardEdits();
+    ctrl->SetInsertionPoint(0);
+    ctrl->LayoutContent();
+    ctrl->SetupScrollbars(true);
+    ctrl->Refresh(false);
+    return true;
+}
+
+WXD_EXPORTED wxd_String_t*
+wxd_RichTextCtrl_SaveToBuffer(wxd_RichTextCtrl_t* self, int type)
+{
+    wxRichTextCtrl* ctrl = (wxRichTextCtrl*)self;
+    if (!ctrl)
+        return nullptr;
+    if (type == wxRICHTEXT_TYPE_ANY)
+        type = wxRICHTEXT_TYPE_XML;
+    ensure_file_handler(type);
+
+    wxMemoryOutputStream stream;
+    if (!ctrl->GetBuffer().SaveFile(stream, type))
+        return nullptr;
+    const size_t len = static_cast<size_t>(stream.GetLength());
+    wxCharBuffer bytes(len);
+    if (len > 0)
+        stream.CopyTo(bytes.data(), len);
+    return wxd_cpp_utils::make_owned_string(bytes);
+}
+
 // Style operations
 
 // Set style for a range of text
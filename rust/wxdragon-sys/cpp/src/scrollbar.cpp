@@ -17,7 +17,8 @@ wxd_ScrollBar_Create(wxd_Window_t* parent, wxd_Id id, wxd_Point pos, wxd_Size si
     wxWindow* wx_parent = reinterpret_cast<wxWindow*>(parent);
 
     wxScrollBar* scrollBar = new wxScrollBar(
-        wx_parent, id, wxd_cpp_utils::to_wx(pos), wxd_cpp_utils::to_wx(size), style,
+        wx_parent, id, wxd_cpp_utils::to_wx(pos, wx_parent), wxd_cpp_utils::to_wx(size, wx_parent),
+        style,
         wxDefaultValidator,                                  // Use default validator
         wxString::FromUTF8(name ? name : wxScrollBarNameStr) // Use default name if NULL
     );
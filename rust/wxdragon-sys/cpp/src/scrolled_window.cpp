@@ -3,7 +3,328 @@
 #include "wx/scrolwin.h"
 #include "wx/window.h"
 #include "wx/gdicmn.h"
+#include "wx/dcmemory.h"
 #include "wxdragon.h"
+#include <list>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace {
+
+// Renders a scrolled window's virtual area in fixed-size tiles and keeps them in an LRU under a
+// memory budget, so scrolling and repaints mostly become bitmap blits. Tiles are addressed by
+// (column, row) in virtual pixel space.
+class TileCache {
+public:
+    TileCache(wxScrolledWindow* window, int tile_w, int tile_h, size_t budget,
+              wxd_ScrolledWindow_TileRenderCallback render, void* user_data,
+              wxd_ScrolledWindow_FreeUserData free_user_data)
+        : m_window(window), m_tile_w(tile_w), m_tile_h(tile_h), m_budget(budget),
+          m_render(render), m_user_data(user_data), m_free(free_user_data)
+    {
+        // All pixels come from tiles; skip the erase that would flash under them.
+        m_old_bg_style = window->GetBackgroundStyle();
+        window->SetBackgroundStyle(wxBG_STYLE_PAINT);
+        window->Bind(wxEVT_PAINT, &TileCache::OnPaint, this);
+        window->Bind(wxEVT_DPI_CHANGED, &TileCache::OnDPIChanged, this);
+    }
+
+    ~TileCache()
+    {
+        if (m_free)
+            m_free(m_user_data);
+    }
+
+    // Called while the window is alive; the destructor alone runs when it is being destroyed.
+    void
+    Detach()
+    {
+        m_window->Unbind(wxEVT_PAINT, &TileCache::OnPaint, this);
+        m_window->Unbind(wxEVT_DPI_CHANGED, &TileCache::OnDPIChanged, this);
+        m_window->SetBackgroundStyle(m_old_bg_style);
+        m_window->Refresh();
+    }
+
+    bool
+    SetTileRGBA(int col, int row, uint64_t ticket, const unsigned char* rgba, int w, int h)
+    {
+        const uint64_t key = Key(col, row);
+        auto pending = m_pending.find(key);
+        if (pending == m_pending.end() || pending->second != ticket)
+            return false; // Invalidated, evicted or superseded since it was requested.
+        m_pending.erase(pending);
+
+        wxImage image(w, h, false);
+        unsigned char* rgb = image.GetData();
+        image.InitAlpha();
+        unsigned char* alpha = image.GetAlpha();
+        const size_t count = static_cast<size_t>(w) * static_cast<size_t>(h);
+        for (size_t i = 0; i < count; ++i) {
+            rgb[i * 3 + 0] = rgba[i * 4 + 0];
+            rgb[i * 3 + 1] = rgba[i * 4 + 1];
+            rgb[i * 3 + 2] = rgba[i * 4 + 2];
+            alpha[i] = rgba[i * 4 + 3];
+        }
+        wxBitmap tile(image, -1, m_window->GetContentScaleFactor());
+        if (!tile.IsOk())
+            return false;
+        Store(key, tile);
+        m_window->RefreshRect(ClientRect(TileRect(col, row)), false);
+        return true;
+    }
+
+    void
+    Invalidate(const wxRect& area)
+    {
+        if (area.IsEmpty())
+            return;
+        const int col0 = FloorDiv(area.x, m_tile_w);
+        const int row0 = FloorDiv(area.y, m_tile_h);
+        const int col1 = FloorDiv(area.GetRight(), m_tile_w);
+        const int row1 = FloorDiv(area.GetBottom(), m_tile_h);
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            const int col = KeyCol(it->first);
+            const int row = KeyRow(it->first);
+            auto next = std::next(it);
+            if (col >= col0 && col <= col1 && row >= row0 && row <= row1)
+                Erase(it);
+            it = next;
+        }
+        for (auto it = m_pending.begin(); it != m_pending.end();) {
+            const int col = KeyCol(it->first);
+            const int row = KeyRow(it->first);
+            if (col >= col0 && col <= col1 && row >= row0 && row <= row1)
+                it = m_pending.erase(it);
+            else
+                ++it;
+        }
+        m_window->RefreshRect(ClientRect(area), false);
+    }
+
+    void
+    InvalidateAll()
+    {
+        m_entries.clear();
+        m_index.clear();
+        m_pending.clear();
+        m_used = 0;
+        m_window->Refresh(false);
+    }
+
+    void
+    SetBudget(size_t budget)
+    {
+        m_budget = budget;
+        Trim();
+    }
+
+    size_t
+    GetUsedBytes() const
+    {
+        return m_used;
+    }
+
+private:
+    using Entry = std::pair<uint64_t, wxBitmap>;
+
+    static int
+    FloorDiv(int value, int step)
+    {
+        return value >= 0 ? value / step : -((-value + step - 1) / step);
+    }
+
+    static uint64_t
+    Key(int col, int row)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(col)) << 32) |
+               static_cast<uint32_t>(row);
+    }
+
+    static int
+    KeyCol(uint64_t key)
+    {
+        return static_cast<int32_t>(static_cast<uint32_t>(key >> 32));
+    }
+
+    static int
+    KeyRow(uint64_t key)
+    {
+        return static_cast<int32_t>(static_cast<uint32_t>(key));
+    }
+
+    static size_t
+    Cost(const wxBitmap& bitmap)
+    {
+        return static_cast<size_t>(bitmap.GetWidth()) * static_cast<size_t>(bitmap.GetHeight()) *
+               4;
+    }
+
+    wxRect
+    TileRect(int col, int row) const
+    {
+        return wxRect(col * m_tile_w, row * m_tile_h, m_tile_w, m_tile_h);
+    }
+
+    // Virtual to client coordinates.
+    wxRect
+    ClientRect(const wxRect& area) const
+    {
+        return wxRect(m_window->CalcScrolledPosition(area.GetPosition()), area.GetSize());
+    }
+
+    const wxBitmap*
+    Lookup(uint64_t key)
+    {
+        auto found = m_index.find(key);
+        if (found == m_index.end())
+            return nullptr;
+        m_entries.splice(m_entries.begin(), m_entries, found->second);
+        return &found->second->second;
+    }
+
+    void
+    Store(uint64_t key, const wxBitmap& tile)
+    {
+        auto found = m_index.find(key);
+        if (found != m_index.end())
+            Erase(found->second);
+        m_entries.emplace_front(key, tile);
+        m_index[key] = m_entries.begin();
+        m_used += Cost(tile);
+        Trim();
+    }
+
+    void
+    Erase(std::list<Entry>::iterator it)
+    {
+        m_used -= Cost(it->second);
+        m_index.erase(it->first);
+        m_entries.erase(it);
+    }
+
+    // Evicts least recently used tiles, always keeping the one just stored.
+    void
+    Trim()
+    {
+        while (m_used > m_budget && m_entries.size() > 1)
+            Erase(std::prev(m_entries.end()));
+    }
+
+    // Returns the tile, rendering it now if the renderer draws synchronously, or nullptr while
+    // it is pending.
+    const wxBitmap*
+    Acquire(int col, int row)
+    {
+        const uint64_t key = Key(col, row);
+        if (const wxBitmap* tile = Lookup(key))
+            return tile;
+        if (!m_render || m_pending.count(key))
+            return nullptr;
+
+        const wxRect rect = TileRect(col, row);
+        const double scale = m_window->GetContentScaleFactor();
+        wxBitmap tile;
+        if (!tile.CreateWithLogicalSize(rect.GetSize(), scale))
+            return nullptr;
+        const uint64_t ticket = ++m_next_ticket;
+        bool drawn;
+        {
+            wxMemoryDC dc(tile);
+            dc.SetBackground(wxBrush(m_window->GetBackgroundColour()));
+            dc.Clear();
+            // Renderers draw in virtual coordinates.
+            dc.SetDeviceOrigin(-rect.x, -rect.y);
+            drawn = m_render(m_user_data, reinterpret_cast<wxd_DC_t*>(static_cast<wxDC*>(&dc)),
+                             wxd_Rect{ rect.x, rect.y, rect.width, rect.height }, scale, ticket);
+        }
+        if (!drawn) {
+            m_pending[key] = ticket;
+            return nullptr;
+        }
+        Store(key, tile);
+        return Lookup(key);
+    }
+
+    void
+    OnPaint(wxPaintEvent&)
+    {
+        wxPaintDC dc(m_window);
+        m_window->DoPrepareDC(dc);
+        const wxBrush background(m_window->GetBackgroundColour());
+        for (wxRegionIterator it(m_window->GetUpdateRegion()); it; ++it) {
+            const wxRect client = it.GetRect();
+            const wxRect area(m_window->CalcUnscrolledPosition(client.GetPosition()),
+                              client.GetSize());
+            const int col0 = FloorDiv(area.x, m_tile_w);
+            const int row0 = FloorDiv(area.y, m_tile_h);
+            const int col1 = FloorDiv(area.GetRight(), m_tile_w);
+            const int row1 = FloorDiv(area.GetBottom(), m_tile_h);
+            dc.SetClippingRegion(area);
+            for (int row = row0; row <= row1; ++row) {
+                for (int col = col0; col <= col1; ++col) {
+                    const wxRect rect = TileRect(col, row);
+                    if (const wxBitmap* tile = Acquire(col, row)) {
+                        dc.DrawBitmap(*tile, rect.x, rect.y);
+                    }
+                    else {
+                        // Pending tiles show the background until their pixels arrive.
+                        dc.SetPen(*wxTRANSPARENT_PEN);
+                        dc.SetBrush(background);
+                        dc.DrawRectangle(rect);
+                    }
+                }
+            }
+            dc.DestroyClippingRegion();
+        }
+    }
+
+    void
+    OnDPIChanged(wxDPIChangedEvent& event)
+    {
+        InvalidateAll();
+        event.Skip();
+    }
+
+    wxScrolledWindow* m_window;
+    int m_tile_w;
+    int m_tile_h;
+    size_t m_budget;
+    size_t m_used = 0;
+    wxBackgroundStyle m_old_bg_style;
+    wxd_ScrolledWindow_TileRenderCallback m_render;
+    void* m_user_data;
+    wxd_ScrolledWindow_FreeUserData m_free;
+    uint64_t m_next_ticket = 0;
+    std::list<Entry> m_entries; // most recently used first
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> m_index;
+    std::unordered_map<uint64_t, uint64_t> m_pending; // tile key -> ticket
+};
+
+// GUI-thread only. Entries are removed when the cache is disabled or the window destroyed.
+std::unordered_map<wxScrolledWindow*, TileCache*> s_tile_caches;
+
+TileCache*
+find_tile_cache(wxd_ScrolledWindow_t* self)
+{
+    auto found = s_tile_caches.find(reinterpret_cast<wxScrolledWindow*>(self));
+    return found == s_tile_caches.end() ? nullptr : found->second;
+}
+
+void
+on_tile_window_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    // The derived parts are already gone here, so match by identity rather than casting.
+    for (auto it = s_tile_caches.begin(); it != s_tile_caches.end(); ++it) {
+        if (static_cast<wxObject*>(it->first) == event.GetEventObject()) {
+            delete it->second;
+            s_tile_caches.erase(it);
+            return;
+        }
+    }
+}
+
+} // namespace
 
 extern "C" {
 
@@ -102,6 +423,77 @@ wxd_ScrolledWindow_GetScrollPixelsPerUnit(wxd_ScrolledWindow_t* self, int* xUnit
     }
 }
 
+WXD_EXPORTED bool
+wxd_ScrolledWindow_EnableTileCache(wxd_ScrolledWindow_t* self, int tile_width, int tile_height,
+                                   size_t memory_budget,
+                                   wxd_ScrolledWindow_TileRenderCallback render, void* user_data,
+                                   wxd_ScrolledWindow_FreeUserData free_user_data)
+{
+    wxScrolledWindow* scrolledWin = (wxScrolledWindow*)self;
+    if (!scrolledWin || !render || tile_width <= 0 || tile_height <= 0) {
+        if (free_user_data)
+            free_user_data(user_data);
+        return false;
+    }
+    wxd_ScrolledWindow_DisableTileCache(self);
+    s_tile_caches[scrolledWin] = new TileCache(scrolledWin, tile_width, tile_height,
+                                               memory_budget, render, user_data, free_user_data);
+    scrolledWin->Bind(wxEVT_DESTROY, &on_tile_window_destroy);
+    scrolledWin->Refresh(false);
+    return true;
+}
+
+WXD_EXPORTED void
+wxd_ScrolledWindow_DisableTileCache(wxd_ScrolledWindow_t* self)
+{
+    wxScrolledWindow* scrolledWin = (wxScrolledWindow*)self;
+    auto found = s_tile_caches.find(scrolledWin);
+    if (found == s_tile_caches.end())
+        return;
+    scrolledWin->Unbind(wxEVT_DESTROY, &on_tile_window_destroy);
+    found->second->Detach();
+    delete found->second;
+    s_tile_caches.erase(found);
+}
+
+WXD_EXPORTED bool
+wxd_ScrolledWindow_SetTileRGBA(wxd_ScrolledWindow_t* self, int column, int row, uint64_t ticket,
+                               const unsigned char* rgba, int width, int height)
+{
+    TileCache* cache = find_tile_cache(self);
+    if (!cache || !rgba || width <= 0 || height <= 0)
+        return false;
+    return cache->SetTileRGBA(column, row, ticket, rgba, width, height);
+}
+
+WXD_EXPORTED void
+wxd_ScrolledWindow_InvalidateTiles(wxd_ScrolledWindow_t* self, wxd_Rect area)
+{
+    if (TileCache* cache = find_tile_cache(self))
+        cache->Invalidate(wxRect(area.x, area.y, area.width, area.height));
+}
+
+WXD_EXPORTED void
+wxd_ScrolledWindow_InvalidateAllTiles(wxd_ScrolledWindow_t* self)
+{
+    if (TileCache* cache = find_tile_cache(self))
+        cache->InvalidateAll();
+}
+
+WXD_EXPORTED void
+wxd_ScrolledWindow_SetTileCacheBudget(wxd_ScrolledWindow_t* self, size_t memory_budget)
+{
+    if (TileCache* cache = find_tile_cache(self))
+        cache->SetBudget(memory_budget);
+}
+
+WXD_EXPORTED size_t
+wxd_ScrolledWindow_GetTileCacheUsage(wxd_ScrolledWindow_t* self)
+{
+    TileCache* cache = find_tile_cache(self);
+    return cache ? cache->GetUsedBytes() : 0;
+}
+
 // No wxd_ScrolledWindow_Destroy needed, parent manages lifetime.
 
 } // extern "C"
\ No newline at end of file
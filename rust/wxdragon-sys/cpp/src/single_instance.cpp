@@ -0,0 +1,541 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_single_instance.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef __WINDOWS__
+#include <wx/msw/wrapwin.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/file.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+// A later instance has to hand over its arguments before it pays for initializing wxWidgets,
+// so everything up to the handoff uses plain OS calls: a per-user lock decides which process
+// runs (an flock'd file, a named mutex on Windows), and the running one accepts argument
+// messages on a local socket (a named pipe) from a listener thread. A message is a u32 count
+// followed by u32-length UTF-8 strings, the working directory first; the receiver answers one
+// byte once it has queued the arguments for the main thread.
+
+namespace {
+
+struct Handoff {
+    std::string cwd;
+    std::vector<std::string> args;
+};
+
+constexpr uint32_t kMaxStrings = 4096;
+constexpr uint32_t kMaxStringBytes = 1 << 20;
+constexpr int kConnectAttempts = 100; // 10 ms apart: the running instance may be starting up
+constexpr int kReplyTimeoutMs = 2000;
+
+std::string s_name;
+wxd_InstanceArgsCallback s_onArgs = nullptr;
+void* s_userData = nullptr;
+void (*s_freeUserData)(void*) = nullptr;
+bool s_handedOff = false;
+
+std::mutex s_mutex; // Guards s_pending and s_appReady
+std::vector<Handoff> s_pending;
+bool s_appReady = false;
+std::thread s_listener;
+std::atomic<bool> s_stopListening{ false };
+
+#ifdef __WINDOWS__
+using Channel = HANDLE;
+HANDLE s_instanceMutex = nullptr;
+std::wstring s_pipeName;
+
+std::wstring
+to_wide(const std::string& utf8)
+{
+    const int len = MultiByteToWideChar(CP_UTF8, 0, utf8.data(), static_cast<int>(utf8.size()),
+                                        nullptr, 0);
+    std::wstring out(len, L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, utf8.data(), static_cast<int>(utf8.size()), &out[0], len);
+    return out;
+}
+
+std::string
+current_dir()
+{
+    const DWORD len = GetCurrentDirectoryW(0, nullptr);
+    std::wstring wide(len, L'\0');
+    const DWORD written = GetCurrentDirectoryW(len, &wide[0]);
+    wide.resize(written);
+    const int bytes = WideCharToMultiByte(CP_UTF8, 0, wide.data(), static_cast<int>(wide.size()),
+                                          nullptr, 0, nullptr, nullptr);
+    std::string out(bytes, '\0');
+    WideCharToMultiByte(CP_UTF8, 0, wide.data(), static_cast<int>(wide.size()), &out[0], bytes,
+                        nullptr, nullptr);
+    return out;
+}
+
+bool
+write_all(Channel channel, const char* data, size_t len)
+{
+    while (len > 0) {
+        DWORD written = 0;
+        if (!WriteFile(channel, data, static_cast<DWORD>(len), &written, nullptr) || !written)
+            return false;
+        data += written;
+        len -= written;
+    }
+    return true;
+}
+
+bool
+read_exact(Channel channel, char* data, size_t len)
+{
+    while (len > 0) {
+        DWORD got = 0;
+        if (!ReadFile(channel, data, static_cast<DWORD>(len), &got, nullptr) || !got)
+            return false;
+        data += got;
+        len -= got;
+    }
+    return true;
+}
+#else
+using Channel = int;
+int s_lockFd = -1;
+int s_listenFd = -1;
+int s_wakePipe[2] = { -1, -1 };
+std::string s_socketPath;
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0 // macOS: SO_NOSIGPIPE is set on the socket instead
+#endif
+
+int
+make_socket()
+{
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+        return fd;
+    ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+#ifdef SO_NOSIGPIPE
+    const int on = 1;
+    ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+    return fd;
+}
+
+std::string
+current_dir()
+{
+    std::vector<char> buf(1024);
+    while (!::getcwd(buf.data(), buf.size())) {
+        if (errno != ERANGE)
+            return std::string();
+        buf.resize(buf.size() * 2);
+    }
+    return buf.data();
+}
+
+bool
+write_all(Channel channel, const char* data, size_t len)
+{
+    while (len > 0) {
+        const ssize_t written = ::send(channel, data, len, MSG_NOSIGNAL);
+        if (written < 0 && errno == EINTR)
+            continue;
+        if (written <= 0)
+            return false;
+        data += written;
+        len -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+bool
+read_exact(Channel channel, char* data, size_t len)
+{
+    while (len > 0) {
+        pollfd pfd{ channel, POLLIN, 0 };
+        const int ready = ::poll(&pfd, 1, kReplyTimeoutMs);
+        if (ready < 0 && errno == EINTR)
+            continue;
+        if (ready <= 0)
+            return false;
+        const ssize_t got = ::read(channel, data, len);
+        if (got < 0 && errno == EINTR)
+            continue;
+        if (got <= 0)
+            return false;
+        data += got;
+        len -= static_cast<size_t>(got);
+    }
+    return true;
+}
+#endif
+
+void
+append_u32(std::string& out, uint32_t value)
+{
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+std::string
+encode(const std::string& cwd, int argc, char** argv)
+{
+    std::string out;
+    append_u32(out, static_cast<uint32_t>(argc > 0 ? argc : 1)); // cwd + argv[1..]
+    append_u32(out, static_cast<uint32_t>(cwd.size()));
+    out += cwd;
+    for (int i = 1; i < argc; ++i) {
+        const size_t len = argv[i] ? std::strlen(argv[i]) : 0;
+        append_u32(out, static_cast<uint32_t>(len));
+        out.append(argv[i] ? argv[i] : "", len);
+    }
+    return out;
+}
+
+bool
+read_string(Channel channel, std::string& out)
+{
+    uint32_t len = 0;
+    if (!read_exact(channel, reinterpret_cast<char*>(&len), sizeof(len)) ||
+        len > kMaxStringBytes)
+        return false;
+    out.resize(len);
+    return len == 0 || read_exact(channel, &out[0], len);
+}
+
+bool
+read_handoff(Channel channel, Handoff& out)
+{
+    uint32_t count = 0;
+    if (!read_exact(channel, reinterpret_cast<char*>(&count), sizeof(count)) || count == 0 ||
+        count > kMaxStrings || !read_string(channel, out.cwd))
+        return false;
+    out.args.resize(count - 1);
+    for (std::string& arg : out.args) {
+        if (!read_string(channel, arg))
+            return false;
+    }
+    return true;
+}
+
+void
+deliver_pending()
+{
+    std::vector<Handoff> batch;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        batch.swap(s_pending);
+    }
+    for (const Handoff& handoff : batch) {
+        std::vector<const char*> args;
+        args.reserve(handoff.args.size());
+        for (const std::string& arg : handoff.args)
+            args.push_back(arg.c_str());
+        if (s_onArgs)
+            s_onArgs(s_userData, handoff.cwd.c_str(), args.data(), static_cast<int>(args.size()));
+    }
+}
+
+// Listener thread: queues the arguments and wakes the main thread once the app is running.
+void
+queue_handoff(Handoff handoff)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_pending.push_back(std::move(handoff));
+    if (s_appReady && wxTheApp && s_pending.size() == 1)
+        wxTheApp->CallAfter(deliver_pending);
+}
+
+void
+serve(Channel channel)
+{
+    Handoff handoff;
+    if (read_handoff(channel, handoff) && write_all(channel, "k", 1))
+        queue_handoff(std::move(handoff));
+}
+
+#ifdef __WINDOWS__
+void
+listen_main()
+{
+    while (!s_stopListening.load(std::memory_order_acquire)) {
+        HANDLE pipe = CreateNamedPipeW(
+            s_pipeName.c_str(), PIPE_ACCESS_DUPLEX,
+            PIPE_TYPE_BYTE | PIPE_READMODE_BYTE | PIPE_WAIT | PIPE_REJECT_REMOTE_CLIENTS,
+            PIPE_UNLIMITED_INSTANCES, 4096, 4096, 0, nullptr);
+        if (pipe == INVALID_HANDLE_VALUE)
+            return;
+        const bool connected =
+            ConnectNamedPipe(pipe, nullptr) || GetLastError() == ERROR_PIPE_CONNECTED;
+        if (connected && !s_stopListening.load(std::memory_order_acquire))
+            serve(pipe);
+        DisconnectNamedPipe(pipe);
+        CloseHandle(pipe);
+    }
+}
+
+// Returns true if this process holds the instance lock and listens for later instances.
+bool
+become_running_instance(const std::string& safe_name)
+{
+    DWORD session = 0;
+    ProcessIdToSessionId(GetCurrentProcessId(), &session);
+    s_pipeName = L"\\\\.\\pipe\\wxd-" + to_wide(safe_name) + L"-" + std::to_wstring(session);
+    s_instanceMutex = CreateMutexW(nullptr, FALSE, (L"Local\\wxd-" + to_wide(safe_name)).c_str());
+    if (!s_instanceMutex)
+        return false;
+    if (GetLastError() == ERROR_ALREADY_EXISTS) {
+        CloseHandle(s_instanceMutex);
+        s_instanceMutex = nullptr;
+        return false;
+    }
+    s_stopListening.store(false, std::memory_order_release);
+    s_listener = std::thread(listen_main);
+    return true;
+}
+
+bool
+send_to_running_instance(const std::string& message)
+{
+    HANDLE pipe = INVALID_HANDLE_VALUE;
+    for (int attempt = 0; attempt < kConnectAttempts; ++attempt) {
+        pipe = CreateFileW(s_pipeName.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+                           OPEN_EXISTING, 0, nullptr);
+        if (pipe != INVALID_HANDLE_VALUE)
+            break;
+        if (GetLastError() == ERROR_PIPE_BUSY)
+            WaitNamedPipeW(s_pipeName.c_str(), kReplyTimeoutMs);
+        else
+            Sleep(10);
+    }
+    if (pipe == INVALID_HANDLE_VALUE)
+        return false;
+    char reply = 0;
+    const bool ok = write_all(pipe, message.data(), message.size()) &&
+                    read_exact(pipe, &reply, 1) && reply == 'k';
+    CloseHandle(pipe);
+    return ok;
+}
+
+void
+stop_listening()
+{
+    if (s_listener.joinable()) {
+        s_stopListening.store(true, std::memory_order_release);
+        // Unblock ConnectNamedPipe with a connection of our own.
+        HANDLE pipe = CreateFileW(s_pipeName.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+                                  OPEN_EXISTING, 0, nullptr);
+        if (pipe != INVALID_HANDLE_VALUE)
+            CloseHandle(pipe);
+        s_listener.join();
+    }
+    if (s_instanceMutex) {
+        CloseHandle(s_instanceMutex);
+        s_instanceMutex = nullptr;
+    }
+}
+#else
+bool
+fill_address(sockaddr_un& addr)
+{
+    if (s_socketPath.size() >= sizeof(addr.sun_path))
+        return false;
+    addr.sun_family = AF_UNIX;
+    std::memcpy(addr.sun_path, s_socketPath.c_str(), s_socketPath.size() + 1);
+    return true;
+}
+
+void
+listen_main()
+{
+    for (;;) {
+        pollfd fds[2] = { { s_listenFd, POLLIN, 0 }, { s_wakePipe[0], POLLIN, 0 } };
+        if (::poll(fds, 2, -1) < 0) {
+            if (errno == EINTR)
+                continue;
+            return;
+        }
+        if (fds[1].revents)
+            return;
+        if (!(fds[0].revents & POLLIN))
+            continue;
+        const int fd = ::accept(s_listenFd, nullptr, nullptr);
+        if (fd < 0)
+            continue;
+        serve(fd);
+        ::close(fd);
+    }
+}
+
+bool
+become_running_instance(const std::string& safe_name)
+{
+    const char* dir = std::getenv("XDG_RUNTIME_DIR");
+    if (!dir || !*dir)
+        dir = std::getenv("TMPDIR");
+    if (!dir || !*dir)
+        dir = "/tmp";
+    const std::string base =
+        std::string(dir) + "/wxd-" + safe_name + "-" + std::to_string(::getuid());
+    s_socketPath = base + ".sock";
+    sockaddr_un addr{};
+    if (!fill_address(addr))
+        return false;
+
+    s_lockFd = ::open((base + ".lock").c_str(), O_CREAT | O_RDWR, 0600);
+    if (s_lockFd < 0)
+        return false;
+    ::fcntl(s_lockFd, F_SETFD, FD_CLOEXEC);
+    if (::flock(s_lockFd, LOCK_EX | LOCK_NB) != 0) {
+        ::close(s_lockFd);
+        s_lockFd = -1;
+        return false;
+    }
+
+    // Holding the lock, any socket left at the path belongs to a process that has exited.
+    ::unlink(s_socketPath.c_str());
+    s_listenFd = make_socket();
+    if (s_listenFd < 0 || ::bind(s_listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) ||
+        ::chmod(s_socketPath.c_str(), 0600) || ::listen(s_listenFd, 8) || ::pipe(s_wakePipe)) {
+        WXD_LOG_WARN("single instance: cannot listen for later instances");
+        return true; // Still the running instance; later ones will start on their own.
+    }
+    s_listener = std::thread(listen_main);
+    return true;
+}
+
+bool
+send_to_running_instance(const std::string& message)
+{
+    sockaddr_un addr{};
+    if (!fill_address(addr))
+        return false;
+    for (int attempt = 0; attempt < kConnectAttempts; ++attempt) {
+        const int fd = make_socket();
+        if (fd < 0)
+            return false;
+        if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0) {
+            char reply = 0;
+            const bool ok = write_all(fd, message.data(), message.size()) &&
+                            read_exact(fd, &reply, 1) && reply == 'k';
+            ::close(fd);
+            return ok;
+        }
+        ::close(fd);
+        ::usleep(10000);
+    }
+    return false;
+}
+
+void
+stop_listening()
+{
+    if (s_listener.joinable()) {
+        const char wake = 0;
+        if (::write(s_wakePipe[1], &wake, 1) < 0) {
+            // The reader only needs the pipe to become readable; nothing to recover.
+        }
+        s_listener.join();
+    }
+    for (int* fd : { &s_listenFd, &s_wakePipe[0], &s_wakePipe[1] }) {
+        if (*fd >= 0)
+            ::close(*fd);
+        *fd = -1;
+    }
+    if (s_lockFd >= 0) {
+        ::unlink(s_socketPath.c_str());
+        ::close(s_lockFd); // Releases the flock
+        s_lockFd = -1;
+    }
+}
+#endif
+
+} // namespace
+
+namespace wxd_single_instance {
+
+bool
+hand_off(int argc, char** argv)
+{
+    if (s_name.empty())
+        return false;
+    std::string safe_name;
+    for (char c : s_name)
+        safe_name += (c == '/' || c == '\\') ? '_' : c;
+
+    if (become_running_instance(safe_name))
+        return false;
+    // Someone else holds the lock (or it could not be taken): try handing over.
+    if (send_to_running_instance(encode(current_dir(), argc, argv))) {
+        s_handedOff = true;
+        return true;
+    }
+    WXD_LOG_WARN("single instance: the running instance did not answer; starting normally");
+    return false;
+}
+
+void
+app_started()
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_appReady = !s_name.empty();
+    if (s_appReady && !s_pending.empty())
+        wxTheApp->CallAfter(deliver_pending);
+}
+
+void
+shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_appReady = false;
+    }
+    stop_listening();
+    s_pending.clear();
+    if (s_freeUserData)
+        s_freeUserData(s_userData);
+    s_name.clear();
+    s_onArgs = nullptr;
+    s_userData = nullptr;
+    s_freeUserData = nullptr;
+}
+
+} // namespace wxd_single_instance
+
+extern "C" {
+
+WXD_EXPORTED bool
+wxd_App_SetSingleInstance(const char* name, wxd_InstanceArgsCallback on_args, void* user_data,
+                          void (*free_user_data)(void*))
+{
+    if (!name || !*name || !on_args || wxTheApp)
+        return false;
+    if (s_freeUserData)
+        s_freeUserData(s_userData);
+    s_name = name;
+    s_onArgs = on_args;
+    s_userData = user_data;
+    s_freeUserData = free_user_data;
+    s_handedOff = false;
+    return true;
+}
+
+WXD_EXPORTED bool
+wxd_App_WasHandedOff()
+{
+    return s_handedOff;
+}
+
+} // extern "C"
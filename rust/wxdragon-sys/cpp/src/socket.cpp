@@ -0,0 +1,194 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include <wx/socket.h>
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+// IPPROTO_TCP and TCP_NODELAY have these values on every platform wx supports; spelled out so
+// the platform socket headers stay out of this file.
+constexpr int kIpProtoTcp = 6;
+constexpr int kTcpNoDelay = 1;
+
+wxSocketBase*
+from_handle(wxd_Socket_t* self)
+{
+    return reinterpret_cast<wxSocketBase*>(self);
+}
+
+const wxSocketBase*
+from_handle(const wxd_Socket_t* self)
+{
+    return reinterpret_cast<const wxSocketBase*>(self);
+}
+
+void
+route_events(wxSocketBase* socket, wxd_EvtHandler_t* target, int id, wxSocketEventFlags flags)
+{
+    socket->SetEventHandler(*reinterpret_cast<wxEvtHandler*>(target), id);
+    socket->SetNotify(flags);
+    socket->Notify(true);
+}
+
+// Raises a notification wx itself does not send, e.g. for a connect that finished at once.
+void
+queue_notify(wxSocketBase* socket, wxd_EvtHandler_t* target, int id, wxSocketNotify notify)
+{
+    wxSocketEvent event(id);
+    event.m_event = notify;
+    event.SetEventObject(socket);
+    reinterpret_cast<wxEvtHandler*>(target)->AddPendingEvent(event);
+}
+
+constexpr wxSocketEventFlags kStreamEvents =
+    wxSOCKET_INPUT_FLAG | wxSOCKET_OUTPUT_FLAG | wxSOCKET_CONNECTION_FLAG | wxSOCKET_LOST_FLAG;
+
+} // namespace
+
+extern "C" {
+
+WXD_EXPORTED wxd_Socket_t*
+wxd_Socket_Connect(wxd_EvtHandler_t* target, int id, const char* host, uint16_t port)
+{
+    if (!target || !host || !*host)
+        return nullptr;
+    wxIPV4address address;
+    if (!address.Hostname(wxString::FromUTF8(host)) || !address.Service(port))
+        return nullptr;
+    wxSocketClient* client = new wxSocketClient(wxSOCKET_NOWAIT);
+    route_events(client, target, id, kStreamEvents);
+    if (client->Connect(address, false))
+        queue_notify(client, target, id, wxSOCKET_CONNECTION);
+    else if (client->LastError() != wxSOCKET_WOULDBLOCK)
+        queue_notify(client, target, id, wxSOCKET_LOST);
+    return reinterpret_cast<wxd_Socket_t*>(client);
+}
+
+WXD_EXPORTED wxd_Socket_t*
+wxd_SocketServer_Create(wxd_EvtHandler_t* target, int id, const char* host, uint16_t port)
+{
+    if (!target)
+        return nullptr;
+    wxIPV4address address;
+    if (host && *host) {
+        if (!address.Hostname(wxString::FromUTF8(host)))
+            return nullptr;
+    }
+    else {
+        address.AnyAddress();
+    }
+    address.Service(port);
+    wxSocketServer* server = new wxSocketServer(address, wxSOCKET_NOWAIT | wxSOCKET_REUSEADDR);
+    if (!server->IsOk()) {
+        server->Destroy();
+        return nullptr;
+    }
+    route_events(server, target, id, wxSOCKET_CONNECTION_FLAG);
+    return reinterpret_cast<wxd_Socket_t*>(server);
+}
+
+WXD_EXPORTED wxd_Socket_t*
+wxd_SocketServer_Accept(wxd_Socket_t* server, wxd_EvtHandler_t* target, int id)
+{
+    wxSocketServer* listener = wxDynamicCast(from_handle(server), wxSocketServer);
+    if (!listener || !target)
+        return nullptr;
+    wxSocketBase* socket = listener->Accept(false);
+    if (!socket)
+        return nullptr;
+    socket->SetFlags(wxSOCKET_NOWAIT);
+    route_events(socket, target, id, kStreamEvents);
+    return reinterpret_cast<wxd_Socket_t*>(socket);
+}
+
+WXD_EXPORTED void
+wxd_Socket_Destroy(wxd_Socket_t* self)
+{
+    // Destroy() defers the delete, so events already queued still see a live socket.
+    if (self)
+        from_handle(self)->Destroy();
+}
+
+WXD_EXPORTED int64_t
+wxd_Socket_Read(wxd_Socket_t* self, uint8_t* buffer, size_t capacity)
+{
+    if (!self || !buffer)
+        return -1;
+    wxSocketBase* socket = from_handle(self);
+    socket->Read(buffer, static_cast<wxUint32>(std::min<size_t>(capacity, 0x7fffffff)));
+    const wxUint32 count = socket->LastReadCount();
+    if (count)
+        return count;
+    if (socket->Error() && socket->LastError() == wxSOCKET_WOULDBLOCK)
+        return 0;
+    // No data and no would-block: the peer closed the stream or the socket failed.
+    return socket->Error() || socket->IsClosed() || !socket->IsConnected() ? -1 : 0;
+}
+
+WXD_EXPORTED int64_t
+wxd_Socket_Write(wxd_Socket_t* self, const uint8_t* data, size_t len)
+{
+    if (!self || (!data && len))
+        return -1;
+    wxSocketBase* socket = from_handle(self);
+    if (!len)
+        return 0;
+    socket->Write(data, static_cast<wxUint32>(std::min<size_t>(len, 0x7fffffff)));
+    const wxUint32 count = socket->LastWriteCount();
+    if (!count && socket->Error() && socket->LastError() != wxSOCKET_WOULDBLOCK)
+        return -1;
+    return count;
+}
+
+WXD_EXPORTED void
+wxd_Socket_Close(wxd_Socket_t* self)
+{
+    if (!self)
+        return;
+    wxSocketBase* socket = from_handle(self);
+    socket->Notify(false);
+    socket->Close();
+}
+
+WXD_EXPORTED bool
+wxd_Socket_IsConnected(const wxd_Socket_t* self)
+{
+    return self && from_handle(self)->IsConnected();
+}
+
+WXD_EXPORTED bool
+wxd_Socket_SetNoDelay(wxd_Socket_t* self, bool no_delay)
+{
+    if (!self)
+        return false;
+    int value = no_delay ? 1 : 0;
+    return from_handle(self)->SetOption(kIpProtoTcp, kTcpNoDelay, &value, sizeof(value));
+}
+
+WXD_EXPORTED size_t
+wxd_Socket_GetAddress(const wxd_Socket_t* self, bool local, char* buffer, size_t buffer_size,
+                      uint16_t* port)
+{
+    if (port)
+        *port = 0;
+    if (!self)
+        return 0;
+    wxIPV4address address;
+    const wxSocketBase* socket = from_handle(self);
+    if (!(local ? socket->GetLocal(address) : socket->GetPeer(address)))
+        return 0;
+    if (port)
+        *port = address.Service();
+    const wxScopedCharBuffer text = address.IPAddress().utf8_str();
+    const size_t len = text.length();
+    if (buffer && buffer_size) {
+        const size_t copied = std::min(len, buffer_size - 1);
+        std::memcpy(buffer, text.data(), copied);
+        buffer[copied] = '\0';
+    }
+    return len;
+}
+
+} // extern "C"
@@ -0,0 +1,433 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_spatialindex.h"
+#include <wx/scrolwin.h>
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+wxDEFINE_EVENT(wxdEVT_SPATIAL_HOVER_CHANGED, wxdSpatialHoverEvent);
+
+namespace {
+
+// Items spanning more cells than this are kept in a side list scanned by every query instead of
+// being copied into each cell.
+constexpr long kMaxCellsPerItem = 256;
+
+class SpatialIndex {
+public:
+    explicit SpatialIndex(int cell_size) : m_cell(cell_size > 0 ? cell_size : 64) {}
+
+    void
+    Insert(int64_t id, const wxRect& bounds)
+    {
+        Remove(id);
+        Item& item = m_items[id];
+        item.bounds = bounds;
+        item.z = ++m_next_z;
+        Link(id, item);
+    }
+
+    bool
+    Update(int64_t id, const wxRect& bounds)
+    {
+        auto found = m_items.find(id);
+        if (found == m_items.end())
+            return false;
+        Unlink(id, found->second);
+        found->second.bounds = bounds;
+        Link(id, found->second);
+        return true;
+    }
+
+    bool
+    Remove(int64_t id)
+    {
+        auto found = m_items.find(id);
+        if (found == m_items.end())
+            return false;
+        Unlink(id, found->second);
+        m_items.erase(found);
+        return true;
+    }
+
+    void
+    Clear()
+    {
+        m_items.clear();
+        m_cells.clear();
+        m_oversized.clear();
+    }
+
+    size_t
+    Count() const
+    {
+        return m_items.size();
+    }
+
+    // Matches topmost first.
+    void
+    QueryPoint(const wxPoint& pt, std::vector<int64_t>& out) const
+    {
+        out.clear();
+        m_hits.clear();
+        auto cell = m_cells.find(Key(CellOf(pt.x), CellOf(pt.y)));
+        if (cell != m_cells.end()) {
+            for (int64_t id : cell->second)
+                AddIfContains(id, pt);
+        }
+        for (int64_t id : m_oversized)
+            AddIfContains(id, pt);
+        Finish(out);
+    }
+
+    void
+    QueryRect(const wxRect& area, std::vector<int64_t>& out) const
+    {
+        out.clear();
+        m_hits.clear();
+        if (area.IsEmpty())
+            return;
+        const Range range = RangeOf(area);
+        if (range.Cells() > static_cast<long>(m_items.size())) {
+            // Cheaper to test every item than to visit mostly empty cells.
+            for (const auto& entry : m_items) {
+                if (entry.second.bounds.Intersects(area))
+                    m_hits.emplace_back(entry.second.z, entry.first);
+            }
+            Finish(out);
+            return;
+        }
+        for (int cy = range.y0; cy <= range.y1; ++cy) {
+            for (int cx = range.x0; cx <= range.x1; ++cx) {
+                auto cell = m_cells.find(Key(cx, cy));
+                if (cell == m_cells.end())
+                    continue;
+                for (int64_t id : cell->second) {
+                    const Item& item = m_items.at(id);
+                    if (!item.bounds.Intersects(area))
+                        continue;
+                    // Report each item once: from the first cell it shares with the query.
+                    const Range own = RangeOf(item.bounds);
+                    if (cx == std::max(own.x0, range.x0) && cy == std::max(own.y0, range.y0))
+                        m_hits.emplace_back(item.z, id);
+                }
+            }
+        }
+        for (int64_t id : m_oversized) {
+            const Item& item = m_items.at(id);
+            if (item.bounds.Intersects(area))
+                m_hits.emplace_back(item.z, id);
+        }
+        Finish(out);
+    }
+
+private:
+    struct Item {
+        wxRect bounds;
+        uint64_t z = 0;
+        bool oversized = false;
+    };
+
+    struct Range {
+        int x0, y0, x1, y1;
+
+        long
+        Cells() const
+        {
+            return static_cast<long>(x1 - x0 + 1) * static_cast<long>(y1 - y0 + 1);
+        }
+    };
+
+    int
+    CellOf(int v) const
+    {
+        return v >= 0 ? v / m_cell : -((-v + m_cell - 1) / m_cell);
+    }
+
+    Range
+    RangeOf(const wxRect& r) const
+    {
+        return Range{ CellOf(r.x), CellOf(r.y), CellOf(r.x + std::max(r.width, 1) - 1),
+                      CellOf(r.y + std::max(r.height, 1) - 1) };
+    }
+
+    static uint64_t
+    Key(int cx, int cy)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32) |
+               static_cast<uint32_t>(cy);
+    }
+
+    void
+    Link(int64_t id, Item& item)
+    {
+        if (item.bounds.IsEmpty())
+            return; // Never hit; kept only so Update can give it a size later.
+        const Range range = RangeOf(item.bounds);
+        item.oversized = range.Cells() > kMaxCellsPerItem;
+        if (item.oversized) {
+            m_oversized.push_back(id);
+            return;
+        }
+        for (int cy = range.y0; cy <= range.y1; ++cy) {
+            for (int cx = range.x0; cx <= range.x1; ++cx)
+                m_cells[Key(cx, cy)].push_back(id);
+        }
+    }
+
+    void
+    Unlink(int64_t id, const Item& item)
+    {
+        if (item.bounds.IsEmpty())
+            return;
+        if (item.oversized) {
+            EraseId(m_oversized, id);
+            return;
+        }
+        const Range range = RangeOf(item.bounds);
+        for (int cy = range.y0; cy <= range.y1; ++cy) {
+            for (int cx = range.x0; cx <= range.x1; ++cx) {
+                auto cell = m_cells.find(Key(cx, cy));
+                if (cell == m_cells.end())
+                    continue;
+                EraseId(cell->second, id);
+                if (cell->second.empty())
+                    m_cells.erase(cell);
+            }
+        }
+    }
+
+    static void
+    EraseId(std::vector<int64_t>& ids, int64_t id)
+    {
+        auto it = std::find(ids.begin(), ids.end(), id);
+        if (it != ids.end()) {
+            *it = ids.back();
+            ids.pop_back();
+        }
+    }
+
+    void
+    AddIfContains(int64_t id, const wxPoint& pt) const
+    {
+        const Item& item = m_items.at(id);
+        if (item.bounds.Contains(pt))
+            m_hits.emplace_back(item.z, id);
+    }
+
+    void
+    Finish(std::vector<int64_t>& out) const
+    {
+        std::sort(m_hits.begin(), m_hits.end(),
+                  [](const std::pair<uint64_t, int64_t>& a,
+                     const std::pair<uint64_t, int64_t>& b) { return a.first > b.first; });
+        out.reserve(m_hits.size());
+        for (const auto& hit : m_hits)
+            out.push_back(hit.second);
+    }
+
+    int m_cell;
+    uint64_t m_next_z = 0;
+    std::unordered_map<int64_t, Item> m_items;
+    std::unordered_map<uint64_t, std::vector<int64_t>> m_cells;
+    std::vector<int64_t> m_oversized;
+    mutable std::vector<std::pair<uint64_t, int64_t>> m_hits; // query scratch (z, id)
+};
+
+size_t
+copy_ids(const std::vector<int64_t>& found, int64_t* ids, size_t capacity)
+{
+    if (ids)
+        std::copy_n(found.begin(), std::min(capacity, found.size()), ids);
+    return found.size();
+}
+
+// Follows the mouse over one window and reports changes of the topmost item under it.
+class HoverTracker {
+public:
+    HoverTracker(wxWindow* window, std::shared_ptr<SpatialIndex> index)
+        : m_window(window), m_index(std::move(index))
+    {
+        window->Bind(wxEVT_MOTION, &HoverTracker::OnMotion, this);
+        window->Bind(wxEVT_LEAVE_WINDOW, &HoverTracker::OnLeave, this);
+    }
+
+    void
+    Detach()
+    {
+        m_window->Unbind(wxEVT_MOTION, &HoverTracker::OnMotion, this);
+        m_window->Unbind(wxEVT_LEAVE_WINDOW, &HoverTracker::OnLeave, this);
+    }
+
+private:
+    void
+    OnMotion(wxMouseEvent& event)
+    {
+        event.Skip();
+        wxPoint pt = event.GetPosition();
+        if (auto* scroll = dynamic_cast<wxScrollHelperBase*>(m_window))
+            pt = scroll->CalcUnscrolledPosition(pt);
+        m_index->QueryPoint(pt, m_scratch);
+        if (m_scratch.empty())
+            SetHovered(false, 0);
+        else
+            SetHovered(true, m_scratch.front());
+    }
+
+    void
+    OnLeave(wxMouseEvent& event)
+    {
+        event.Skip();
+        SetHovered(false, 0);
+    }
+
+    void
+    SetHovered(bool has_item, int64_t item)
+    {
+        if (has_item == m_has_item && (!has_item || item == m_item))
+            return;
+        wxdSpatialHoverEvent hover(wxdEVT_SPATIAL_HOVER_CHANGED, m_window->GetId());
+        hover.SetEventObject(m_window);
+        hover.item = item;
+        hover.has_item = has_item;
+        hover.previous = m_item;
+        hover.had_previous = m_has_item;
+        m_has_item = has_item;
+        m_item = item;
+        m_window->GetEventHandler()->ProcessEvent(hover);
+    }
+
+    wxWindow* m_window;
+    std::shared_ptr<SpatialIndex> m_index;
+    std::vector<int64_t> m_scratch;
+    bool m_has_item = false;
+    int64_t m_item = 0;
+};
+
+// GUI-thread only. Entries are removed on detach or when the window is destroyed.
+std::unordered_map<wxWindow*, HoverTracker*> s_trackers;
+
+void
+on_tracked_window_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    auto found = s_trackers.find(static_cast<wxWindow*>(event.GetEventObject()));
+    if (found == s_trackers.end())
+        return;
+    delete found->second;
+    s_trackers.erase(found);
+}
+
+} // namespace
+
+// Shared so that an attached window keeps the index alive after the caller releases it.
+struct wxd_SpatialIndex_t {
+    std::shared_ptr<SpatialIndex> index;
+    mutable std::vector<int64_t> scratch;
+};
+
+WXD_EXPORTED wxd_SpatialIndex_t*
+wxd_SpatialIndex_Create(int cell_size)
+{
+    return new wxd_SpatialIndex_t{ std::make_shared<SpatialIndex>(cell_size), {} };
+}
+
+WXD_EXPORTED void
+wxd_SpatialIndex_Destroy(wxd_SpatialIndex_t* index)
+{
+    delete index;
+}
+
+WXD_EXPORTED void
+wxd_SpatialIndex_Insert(wxd_SpatialIndex_t* index, int64_t id, wxd_Rect bounds)
+{
+    if (index)
+        index->index->Insert(id, wxRect(bounds.x, bounds.y, bounds.width, bounds.height));
+}
+
+WXD_EXPORTED bool
+wxd_SpatialIndex_Update(wxd_SpatialIndex_t* index, int64_t id, wxd_Rect bounds)
+{
+    if (!index)
+        return false;
+    return index->index->Update(id, wxRect(bounds.x, bounds.y, bounds.width, bounds.height));
+}
+
+WXD_EXPORTED bool
+wxd_SpatialIndex_Remove(wxd_SpatialIndex_t* index, int64_t id)
+{
+    return index && index->index->Remove(id);
+}
+
+WXD_EXPORTED void
+wxd_SpatialIndex_Clear(wxd_SpatialIndex_t* index)
+{
+    if (index)
+        index->index->Clear();
+}
+
+WXD_EXPORTED size_t
+wxd_SpatialIndex_GetCount(const wxd_SpatialIndex_t* index)
+{
+    return index ? index->index->Count() : 0;
+}
+
+WXD_EXPORTED bool
+wxd_SpatialIndex_HitTest(const wxd_SpatialIndex_t* index, wxd_Point pt, int64_t* id)
+{
+    if (!index)
+        return false;
+    index->index->QueryPoint(wxPoint(pt.x, pt.y), index->scratch);
+    if (index->scratch.empty())
+        return false;
+    if (id)
+        *id = index->scratch.front();
+    return true;
+}
+
+WXD_EXPORTED size_t
+wxd_SpatialIndex_QueryPoint(const wxd_SpatialIndex_t* index, wxd_Point pt, int64_t* ids,
+                            size_t capacity)
+{
+    if (!index)
+        return 0;
+    index->index->QueryPoint(wxPoint(pt.x, pt.y), index->scratch);
+    return copy_ids(index->scratch, ids, capacity);
+}
+
+WXD_EXPORTED size_t
+wxd_SpatialIndex_QueryRect(const wxd_SpatialIndex_t* index, wxd_Rect area, int64_t* ids,
+                           size_t capacity)
+{
+    if (!index)
+        return 0;
+    index->index->QueryRect(wxRect(area.x, area.y, area.width, area.height), index->scratch);
+    return copy_ids(index->scratch, ids, capacity);
+}
+
+WXD_EXPORTED void
+wxd_SpatialIndex_AttachToWindow(wxd_SpatialIndex_t* index, wxd_Window_t* window)
+{
+    wxWindow* win = reinterpret_cast<wxWindow*>(window);
+    if (!index || !win)
+        return;
+    wxd_SpatialIndex_DetachFromWindow(window);
+    s_trackers[win] = new HoverTracker(win, index->index);
+    win->Bind(wxEVT_DESTROY, &on_tracked_window_destroy);
+}
+
+WXD_EXPORTED void
+wxd_SpatialIndex_DetachFromWindow(wxd_Window_t* window)
+{
+    wxWindow* win = reinterpret_cast<wxWindow*>(window);
+    auto found = s_trackers.find(win);
+    if (found == s_trackers.end())
+        return;
+    win->Unbind(wxEVT_DESTROY, &on_tracked_window_destroy);
+    found->second->Detach();
+    delete found->second;
+    s_trackers.erase(found);
+}
@@ -2,6 +2,258 @@
 #include <wx/wx.h>
 #include "../include/wxdragon.h"
 #include <wx/splitter.h>
+#include <wx/dcclient.h>
+#include <wx/dcmemory.h>
+#include <wx/renderer.h>
+
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const uint32_t kDefaultFrameMs = 16;
+
+// Picture of a pane as it looked when the drag started; null where the port cannot read back
+// window contents.
+wxBitmap
+capture_pane(wxWindow* pane)
+{
+#if defined(__WXMSW__) || (defined(__WXGTK__) && !defined(__WXGTK3__))
+    const wxSize size = pane->GetClientSize();
+    if (size.x <= 0 || size.y <= 0)
+        return wxNullBitmap;
+    wxBitmap bitmap(size);
+    wxMemoryDC mem(bitmap);
+    wxClientDC src(pane);
+    if (!mem.Blit(0, 0, size.x, size.y, &src, 0, 0))
+        return wxNullBitmap;
+    mem.SelectObject(wxNullBitmap);
+    return bitmap;
+#else
+    wxUnusedVar(pane);
+    return wxNullBitmap;
+#endif
+}
+
+// Covers the splitter during a SNAPSHOT drag and paints the captured panes stretched to either
+// side of the dragged sash. The splitter holds the mouse capture, so it keeps getting the drag.
+class SnapshotOverlay : public wxWindow {
+public:
+    explicit SnapshotOverlay(wxSplitterWindow* splitter)
+        : wxWindow(splitter, wxID_ANY, wxPoint(0, 0), splitter->GetClientSize(), wxBORDER_NONE),
+          m_splitter(splitter), m_sash(splitter->GetSashPosition())
+    {
+        wxWindow* panes[2] = { splitter->GetWindow1(), splitter->GetWindow2() };
+        for (int i = 0; i < 2; ++i) {
+            m_rects[i] = panes[i]->GetRect();
+            m_pictures[i] = capture_pane(panes[i]);
+            m_colours[i] = panes[i]->GetBackgroundColour();
+        }
+        SetBackgroundStyle(wxBG_STYLE_PAINT);
+        Bind(wxEVT_PAINT, &SnapshotOverlay::OnPaint, this);
+        Raise();
+    }
+
+    void
+    SetSash(int position)
+    {
+        if (position != m_sash) {
+            m_sash = position;
+            Refresh(false);
+        }
+    }
+
+private:
+    void
+    OnPaint(wxPaintEvent&)
+    {
+        wxPaintDC dc(this);
+        const wxSize client = GetClientSize();
+        const bool vertical = m_splitter->GetSplitMode() == wxSPLIT_VERTICAL;
+        const int sash = m_splitter->GetSashSize();
+
+        dc.SetPen(*wxTRANSPARENT_PEN);
+        dc.SetBrush(wxBrush(m_splitter->GetBackgroundColour()));
+        dc.DrawRectangle(wxPoint(0, 0), client);
+
+        // Panes keep their outer edges; the edges next to the sash follow it.
+        wxRect rects[2] = { m_rects[0], m_rects[1] };
+        if (vertical) {
+            rects[0].width = m_sash - rects[0].x;
+            rects[1].width = m_rects[1].GetRight() + 1 - (m_sash + sash);
+            rects[1].x = m_sash + sash;
+        } else {
+            rects[0].height = m_sash - rects[0].y;
+            rects[1].height = m_rects[1].GetBottom() + 1 - (m_sash + sash);
+            rects[1].y = m_sash + sash;
+        }
+        for (int i = 0; i < 2; ++i) {
+            const wxRect& r = rects[i];
+            if (r.width <= 0 || r.height <= 0)
+                continue;
+            if (m_pictures[i].IsOk()) {
+                wxMemoryDC mem(m_pictures[i]);
+                dc.StretchBlit(r.x, r.y, r.width, r.height, &mem, 0, 0,
+                               m_pictures[i].GetWidth(), m_pictures[i].GetHeight());
+            } else {
+                dc.SetBrush(wxBrush(m_colours[i]));
+                dc.DrawRectangle(r);
+            }
+        }
+        wxRendererNative::Get().DrawSplitterSash(this, dc, client, m_sash,
+                                                 vertical ? wxVERTICAL : wxHORIZONTAL);
+    }
+
+    wxSplitterWindow* m_splitter;
+    int m_sash;
+    wxRect m_rects[2];
+    wxBitmap m_pictures[2];
+    wxColour m_colours[2];
+};
+
+// Rate-limits or replaces the live layout of one splitter's sash drags. Intermediate positions
+// are vetoed in the SASH_POS_CHANGING handler (wxSplitterWindow measures each drag step from
+// where the drag began, so vetoed steps lose nothing); the release is never vetoed, so the final
+// position always goes through the normal path, with its CHANGED event and full layout.
+class LiveResize : public wxTimer {
+public:
+    LiveResize(wxSplitterWindow* splitter, int mode, uint32_t interval_ms)
+        : m_splitter(splitter), m_mode(mode)
+    {
+        SetInterval(interval_ms);
+        splitter->Bind(wxEVT_SPLITTER_SASH_POS_CHANGING, &LiveResize::OnChanging, this);
+        splitter->Bind(wxEVT_SPLITTER_SASH_POS_CHANGED, &LiveResize::OnDragOver, this);
+        splitter->Bind(wxEVT_MOUSE_CAPTURE_LOST, &LiveResize::OnCaptureLost, this);
+    }
+
+    ~LiveResize() override
+    {
+        Stop();
+        EndDrag();
+        m_splitter->Unbind(wxEVT_SPLITTER_SASH_POS_CHANGING, &LiveResize::OnChanging, this);
+        m_splitter->Unbind(wxEVT_SPLITTER_SASH_POS_CHANGED, &LiveResize::OnDragOver, this);
+        m_splitter->Unbind(wxEVT_MOUSE_CAPTURE_LOST, &LiveResize::OnCaptureLost, this);
+    }
+
+    void
+    SetMode(int mode, uint32_t interval_ms)
+    {
+        EndDrag();
+        m_mode = mode;
+        SetInterval(interval_ms);
+    }
+
+    void
+    Notify() override
+    {
+        // Trailing update for the last step vetoed by the throttle.
+        if (m_pending < 0 || !wxGetMouseState().LeftIsDown())
+            return;
+        m_lastLayout = Clock::now();
+        m_splitter->SetSashPosition(m_pending);
+        m_pending = -1;
+    }
+
+private:
+    void
+    SetInterval(uint32_t interval_ms)
+    {
+        m_interval = std::chrono::milliseconds(interval_ms ? interval_ms : kDefaultFrameMs);
+    }
+
+    void
+    OnChanging(wxSplitterEvent& event)
+    {
+        event.Skip();
+        const int position = event.GetSashPosition();
+        // The release (or a programmatic change) goes through untouched.
+        if (!wxGetMouseState().LeftIsDown() || position < 0) {
+            EndDrag();
+            return;
+        }
+        if (m_mode == WXD_LIVE_RESIZE_SNAPSHOT) {
+            if (!m_overlay && m_splitter->IsSplit())
+                m_overlay = new SnapshotOverlay(m_splitter);
+            if (m_overlay)
+                m_overlay->SetSash(position);
+            event.Veto();
+            return;
+        }
+
+        const Clock::time_point now = Clock::now();
+        if (!m_dragging) {
+            m_dragging = true;
+            m_lastLayout = now - m_interval;
+        }
+        const auto elapsed = now - m_lastLayout;
+        if (elapsed >= m_interval) {
+            m_lastLayout = now;
+            m_pending = -1;
+            Stop();
+            return;
+        }
+        m_pending = position;
+        event.Veto();
+        if (!IsRunning()) {
+            const auto wait =
+                std::chrono::duration_cast<std::chrono::milliseconds>(m_interval - elapsed);
+            StartOnce(std::max(1, static_cast<int>(wait.count())));
+        }
+    }
+
+    void
+    OnDragOver(wxSplitterEvent& event)
+    {
+        event.Skip();
+        EndDrag();
+    }
+
+    void
+    OnCaptureLost(wxMouseCaptureLostEvent& event)
+    {
+        event.Skip();
+        EndDrag();
+    }
+
+    void
+    EndDrag()
+    {
+        Stop();
+        m_dragging = false;
+        m_pending = -1;
+        if (m_overlay) {
+            m_overlay->Destroy();
+            m_overlay = nullptr;
+        }
+    }
+
+    wxSplitterWindow* m_splitter;
+    int m_mode;
+    Clock::duration m_interval{};
+    Clock::time_point m_lastLayout;
+    bool m_dragging = false;
+    int m_pending = -1;
+    SnapshotOverlay* m_overlay = nullptr;
+};
+
+// Splitters with a live-resize mode, GUI thread only.
+std::unordered_map<wxSplitterWindow*, LiveResize*> s_live_resize;
+
+void
+on_live_resize_splitter_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    auto it = s_live_resize.find(static_cast<wxSplitterWindow*>(event.GetEventObject()));
+    if (it == s_live_resize.end())
+        return;
+    delete it->second;
+    s_live_resize.erase(it);
+}
+
+} // namespace
 
 // Implementation for wxd_SplitterWindow_Create
 WXD_EXPORTED wxd_SplitterWindow_t*
@@ -109,4 +361,32 @@ wxd_SplitterEvent_GetSashPosition(wxd_Event_t* event)
     if (!splitterEvent)
         return 0; // Or maybe -1 to indicate error?
     return splitterEvent->GetSashPosition();
-}
\ No newline at end of file
+}
+
+WXD_EXPORTED bool
+wxd_SplitterWindow_SetLiveResizeMode(wxd_SplitterWindow_t* self, int mode, uint32_t interval_ms)
+{
+    wxSplitterWindow* splitter = reinterpret_cast<wxSplitterWindow*>(self);
+    if (!splitter || mode < WXD_LIVE_RESIZE_NATIVE || mode > WXD_LIVE_RESIZE_SNAPSHOT)
+        return false;
+
+    auto it = s_live_resize.find(splitter);
+    if (mode == WXD_LIVE_RESIZE_NATIVE) {
+        if (it != s_live_resize.end()) {
+            delete it->second;
+            s_live_resize.erase(it);
+            splitter->Unbind(wxEVT_DESTROY, &on_live_resize_splitter_destroy);
+        }
+        return true;
+    }
+
+    // Both modes need the live path: the sash tracker of the default mode never reports steps.
+    splitter->SetWindowStyleFlag(splitter->GetWindowStyleFlag() | wxSP_LIVE_UPDATE);
+    if (it != s_live_resize.end()) {
+        it->second->SetMode(mode, interval_ms);
+    } else {
+        s_live_resize[splitter] = new LiveResize(splitter, mode, interval_ms);
+        splitter->Bind(wxEVT_DESTROY, &on_live_resize_splitter_destroy);
+    }
+    return true;
+}
@@ -1,6 +1,7 @@
 #include <wx/wxprec.h>
 #include <wx/wx.h>
 #include "../include/wxdragon.h" // Main header
+#include "wxd_objstats.h"
 #include <wx/statbmp.h>          // For wxStaticBitmap
 #include <wx/bitmap.h>           // For wxBitmap
 
@@ -99,7 +100,7 @@ wxd_StaticBitmap_GetBitmap(wxd_StaticBitmap_t* self)
         return nullptr;
 
     // Return a copy, as the internal one might be changed or deleted
-    wxBitmap* newBmp = new wxBitmap(currentBmp);
+    wxBitmap* newBmp = wxd_objstats::track(new wxBitmap(currentBmp));
     return reinterpret_cast<wxd_Bitmap_t*>(newBmp);
 }
 
@@ -16,7 +16,8 @@ wxd_StaticLine_Create(wxd_Window_t* parent, wxd_Id id, wxd_Point pos, wxd_Size s
     wxWindow* wx_parent = reinterpret_cast<wxWindow*>(parent);
 
     wxStaticLine* sline = new wxStaticLine(
-        wx_parent, id, wxd_cpp_utils::to_wx(pos), wxd_cpp_utils::to_wx(size), style,
+        wx_parent, id, wxd_cpp_utils::to_wx(pos, wx_parent), wxd_cpp_utils::to_wx(size, wx_parent),
+        style,
         wxString::FromUTF8(name ? name : wxStaticLineNameStr) // Use default name if NULL
     );
 
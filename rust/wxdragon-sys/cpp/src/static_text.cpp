@@ -26,8 +26,9 @@ wxd_StaticText_Create(wxd_Window_t* parent, wxd_Id id, const char* label, wxd_Po
     // Ensure label is valid UTF-8 before converting
     wxString wx_label = wxString::FromUTF8(label ? label : "");
 
-    wxStaticText* stext = new wxStaticText(wx_parent, id, wx_label, wxd_cpp_utils::to_wx(pos),
-                                           wxd_cpp_utils::to_wx(size), style);
+    wxStaticText* stext = new wxStaticText(wx_parent, id, wx_label,
+                                           wxd_cpp_utils::to_wx(pos, wx_parent),
+                                           wxd_cpp_utils::to_wx(size, wx_parent), style);
 
     return reinterpret_cast<wxd_StaticText_t*>(stext);
 }
@@ -4,6 +4,7 @@
 #include "wx/window.h" // Base class
 #include "wx/string.h" // For wxString conversions
 #include "wxdragon.h"
+#include "wxd_progress_coalescer.h"
 
 extern "C" {
 
@@ -32,6 +33,7 @@ wxd_StatusBar_SetStatusText(wxd_StatusBar_t* self, const char* text, int fieldIn
 {
     wxStatusBar* statusBar = (wxStatusBar*)self;
     if (statusBar) {
+        wxd_progress_coalescer::cancel(statusBar, fieldIndex);
         statusBar->SetStatusText(wxString::FromUTF8(text ? text : ""), fieldIndex);
     }
 }
@@ -0,0 +1,117 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include <wx/wupdlock.h>
+#include "../include/wxdragon.h"
+#include <vector>
+
+namespace {
+
+struct Rule {
+    const wxd_StyleRule* raw;
+    const wxClassInfo* class_info; // null matches any class
+    wxString name;
+};
+
+struct Style {
+    wxColour background;
+    wxColour foreground;
+    const wxFont* font = nullptr;
+};
+
+bool
+matches(const Rule& rule, const wxWindow* window)
+{
+    if (rule.class_info && !window->IsKindOf(rule.class_info))
+        return false;
+    return !rule.raw->name || window->GetName() == rule.name;
+}
+
+wxColour
+to_wx(const wxd_Colour_t& colour)
+{
+    return wxColour(colour.r, colour.g, colour.b, colour.a);
+}
+
+} // namespace
+
+extern "C" {
+
+WXD_EXPORTED int
+wxd_Window_ApplyStyleRecursive(wxd_Window_t* root_ptr, const wxd_StyleRule* rules, size_t count)
+{
+    wxWindow* root = reinterpret_cast<wxWindow*>(root_ptr);
+    if (!root || !rules || count == 0)
+        return 0;
+
+    // Resolve class names once rather than per window; rules naming an unknown class match
+    // nothing.
+    std::vector<Rule> resolved;
+    resolved.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        Rule rule{ &rules[i], nullptr, wxString() };
+        if (rules[i].class_name) {
+            rule.class_info = wxClassInfo::FindClass(wxString::FromUTF8(rules[i].class_name));
+            if (!rule.class_info)
+                continue;
+        }
+        if (rules[i].name)
+            rule.name = wxString::FromUTF8(rules[i].name);
+        resolved.push_back(rule);
+    }
+    if (resolved.empty())
+        return 0;
+
+    wxWindow* top = wxGetTopLevelParent(root);
+    if (!top)
+        top = root;
+    int changed = 0;
+    bool font_changed = false;
+    {
+        wxWindowUpdateLocker freeze(top);
+        std::vector<wxWindow*> pending{ root };
+        while (!pending.empty()) {
+            wxWindow* window = pending.back();
+            pending.pop_back();
+
+            Style style;
+            for (const Rule& rule : resolved) {
+                if (!matches(rule, window))
+                    continue;
+                const wxd_StyleRule& raw = *rule.raw;
+                if (raw.set & WXD_STYLE_RULE_BACKGROUND)
+                    style.background = to_wx(raw.background);
+                if (raw.set & WXD_STYLE_RULE_FOREGROUND)
+                    style.foreground = to_wx(raw.foreground);
+                if ((raw.set & WXD_STYLE_RULE_FONT) && raw.font)
+                    style.font = reinterpret_cast<const wxFont*>(raw.font);
+            }
+
+            bool window_changed = false;
+            if (style.background.IsOk() && window->GetBackgroundColour() != style.background)
+                window_changed |= window->SetBackgroundColour(style.background);
+            if (style.foreground.IsOk() && window->GetForegroundColour() != style.foreground)
+                window_changed |= window->SetForegroundColour(style.foreground);
+            if (style.font && style.font->IsOk() && window->GetFont() != *style.font) {
+                if (window->SetFont(*style.font)) {
+                    window_changed = true;
+                    font_changed = true;
+                }
+            }
+            if (window_changed)
+                ++changed;
+
+            // Dialogs and frames owned by a window are themed on their own.
+            for (wxWindow* child : window->GetChildren()) {
+                if (!child->IsTopLevel())
+                    pending.push_back(child);
+            }
+        }
+        if (font_changed)
+            top->Layout();
+    }
+    if (changed > 0)
+        root->Refresh();
+    return changed;
+}
+
+} // extern "C"
@@ -7,6 +7,727 @@
 #include "wx/stc/stc.h"
 #include "../include/wxdragon.h"
 #include "wxd_utils.h"
+#include "wxd_logconsole.h"
+#include <wx/file.h>
+#include <wx/stopwatch.h>
+#include <wx/wupdlock.h>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <climits>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+// SCN_STYLENEEDED hook of one control. Owned through s_style_hooks, deleted with the control.
+class StyleNeededHook {
+public:
+    StyleNeededHook(wxStyledTextCtrl* ctrl, wxd_StyledTextCtrl_StyleNeededCallback callback,
+                    void* user_data, wxd_StyledTextCtrl_FreeUserData free_user_data)
+        : m_ctrl(ctrl), m_callback(callback), m_user_data(user_data), m_free(free_user_data)
+    {
+        ctrl->Bind(wxEVT_STC_STYLENEEDED, &StyleNeededHook::OnStyleNeeded, this);
+    }
+
+    ~StyleNeededHook()
+    {
+        if (m_free)
+            m_free(m_user_data);
+    }
+
+    void
+    Detach()
+    {
+        m_ctrl->Unbind(wxEVT_STC_STYLENEEDED, &StyleNeededHook::OnStyleNeeded, this);
+    }
+
+private:
+    void
+    OnStyleNeeded(wxStyledTextEvent& event)
+    {
+        // Lexers restart at line boundaries so that state carried across lines is recomputed.
+        const int line = m_ctrl->LineFromPosition(m_ctrl->GetEndStyled());
+        const int start = m_ctrl->PositionFromLine(line);
+        const int end = event.GetPosition();
+        if (end > start)
+            m_callback(m_user_data, start, end);
+    }
+
+    wxStyledTextCtrl* m_ctrl;
+    wxd_StyledTextCtrl_StyleNeededCallback m_callback;
+    void* m_user_data;
+    wxd_StyledTextCtrl_FreeUserData m_free;
+};
+
+// GUI-thread only.
+std::unordered_map<wxStyledTextCtrl*, StyleNeededHook*> s_style_hooks;
+
+void
+on_styled_ctrl_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    auto found = s_style_hooks.find(static_cast<wxStyledTextCtrl*>(event.GetEventObject()));
+    if (found == s_style_hooks.end())
+        return;
+    delete found->second;
+    s_style_hooks.erase(found);
+}
+
+class StyledTextConsole : public wxdLogConsole {
+public:
+    explicit StyledTextConsole(wxStyledTextCtrl* ctrl)
+        : wxdLogConsole(ctrl), m_ctrl(ctrl), m_undo(ctrl->GetUndoCollection())
+    {
+        // A log has nothing to undo; history would only grow with the text.
+        ctrl->SetUndoCollection(false);
+        ctrl->EmptyUndoBuffer();
+    }
+
+protected:
+    int
+    GetLineCount() const override
+    {
+        const int lines = m_ctrl->GetLineCount();
+        return lines > 1 && m_ctrl->PositionFromLine(lines - 1) == m_ctrl->GetLength()
+                   ? lines - 1
+                   : lines;
+    }
+
+    void
+    AppendUtf8(const std::string& text) override
+    {
+        // Scintilla's append leaves the caret and selection alone.
+        Writable writable(m_ctrl);
+        m_ctrl->AppendTextRaw(text.data(), static_cast<int>(text.size()));
+    }
+
+    void
+    RemoveHeadLines(int lines) override
+    {
+        Writable writable(m_ctrl);
+        m_ctrl->DeleteRange(0, m_ctrl->PositionFromLine(lines));
+    }
+
+    void
+    ClearText() override
+    {
+        Writable writable(m_ctrl);
+        m_ctrl->ClearAll();
+    }
+
+    bool
+    IsCaretAtEnd() const override
+    {
+        return m_ctrl->GetCurrentPos() == m_ctrl->GetLength();
+    }
+
+    void
+    ScrollToEnd() override
+    {
+        m_ctrl->GotoPos(m_ctrl->GetLength());
+    }
+
+    void
+    OnDetach() override
+    {
+        m_ctrl->SetUndoCollection(m_undo);
+    }
+
+private:
+    // Lifts read-only for the console's own edits.
+    class Writable {
+    public:
+        explicit Writable(wxStyledTextCtrl* ctrl) : m_ctrl(ctrl), m_read_only(ctrl->GetReadOnly())
+        {
+            if (m_read_only)
+                ctrl->SetReadOnly(false);
+        }
+
+        ~Writable()
+        {
+            if (m_read_only)
+                m_ctrl->SetReadOnly(true);
+        }
+
+    private:
+        wxStyledTextCtrl* m_ctrl;
+        bool m_read_only;
+    };
+
+    wxStyledTextCtrl* m_ctrl;
+    bool m_undo;
+};
+
+// Bulk loads are added in chunks of this size: large enough that per-call overhead vanishes,
+// small enough to keep progress callbacks and idle steps responsive.
+constexpr size_t kLoadChunkBytes = 4 * 1024 * 1024;
+
+// Replaces the document of `ctrl` with raw bytes. While alive, undo collection and
+// modification notifications are off; the destructor restores them and leaves the document
+// unmodified, with no undo history.
+class BulkInsert {
+public:
+    BulkInsert(wxStyledTextCtrl* ctrl, size_t total)
+        : m_ctrl(ctrl), m_read_only(ctrl->GetReadOnly()), m_undo(ctrl->GetUndoCollection()),
+          m_mod_mask(ctrl->GetModEventMask())
+    {
+        ctrl->SetModEventMask(0);
+        ctrl->SetUndoCollection(false);
+        ctrl->SetReadOnly(false);
+        ctrl->ClearAll();
+        ctrl->EmptyUndoBuffer();
+        // One allocation for the whole text instead of repeated gap-buffer growth.
+        ctrl->Allocate(static_cast<int>(total) + 1);
+        ctrl->SetIdleStyling(wxSTC_IDLESTYLING_ALL);
+    }
+
+    ~BulkInsert()
+    {
+        if (!m_ctrl)
+            return;
+        m_ctrl->SetUndoCollection(m_undo);
+        m_ctrl->EmptyUndoBuffer();
+        m_ctrl->SetSavePoint();
+        m_ctrl->SetModEventMask(m_mod_mask);
+        m_ctrl->SetReadOnly(m_read_only);
+    }
+
+    void
+    Add(const char* data, size_t len)
+    {
+        m_ctrl->AddTextRaw(data, static_cast<int>(len));
+    }
+
+    // Forgets the control, which is being destroyed.
+    void
+    Abandon()
+    {
+        m_ctrl = nullptr;
+    }
+
+private:
+    wxStyledTextCtrl* m_ctrl;
+    bool m_read_only;
+    bool m_undo;
+    int m_mod_mask;
+};
+
+// Chunked file load into one control. Incremental loads are owned through s_file_loaders.
+class FileLoader {
+public:
+    FileLoader(wxStyledTextCtrl* ctrl, wxd_StyledTextCtrl_LoadProgressCallback progress,
+               void* user_data, wxd_StyledTextCtrl_FreeUserData free_user_data)
+        : m_ctrl(ctrl), m_progress(progress), m_user_data(user_data), m_free(free_user_data)
+    {
+    }
+
+    ~FileLoader()
+    {
+        if (m_free)
+            m_free(m_user_data);
+    }
+
+    bool
+    Open(const wxString& path)
+    {
+        if (!m_file.Open(path))
+            return false;
+        const wxFileOffset length = m_file.Length();
+        if (length < 0 || length >= INT_MAX) {
+            WXD_LOG_ERROR("wxd_StyledTextCtrl_LoadFileFast: file too large for the control");
+            return false;
+        }
+        m_total = static_cast<uint64_t>(length);
+        m_buffer.reset(new char[kLoadChunkBytes]);
+        m_insert.reset(new BulkInsert(m_ctrl, static_cast<size_t>(m_total)));
+        return true;
+    }
+
+    // Adds chunks until `budget_ms` has elapsed, or to the end if it is 0. Returns true once the
+    // load is over, whether complete, cancelled or failed.
+    bool
+    Step(long budget_ms)
+    {
+        wxStopWatch watch;
+        while (m_loaded < m_total) {
+            const ssize_t got = m_file.Read(m_buffer.get(), kLoadChunkBytes);
+            if (got <= 0)
+                return true;
+            m_insert->Add(m_buffer.get(), static_cast<size_t>(got));
+            m_loaded += static_cast<uint64_t>(got);
+            if (m_loaded < m_total && m_progress &&
+                !m_progress(m_user_data, m_loaded, m_total, false))
+                return true;
+            if (budget_ms > 0 && watch.Time() >= budget_ms)
+                break;
+        }
+        return m_loaded >= m_total;
+    }
+
+    // Restores the control and makes the final progress call.
+    void
+    Finish()
+    {
+        m_insert.reset();
+        m_file.Close();
+        if (m_progress)
+            m_progress(m_user_data, m_loaded, m_total, true);
+    }
+
+    void
+    StartIncremental()
+    {
+        // The user must not edit a document that is still growing.
+        m_ctrl->SetReadOnly(true);
+        m_ctrl->Bind(wxEVT_IDLE, &FileLoader::OnIdle, this);
+    }
+
+    void
+    Detach()
+    {
+        m_ctrl->Unbind(wxEVT_IDLE, &FileLoader::OnIdle, this);
+    }
+
+    void
+    Abandon()
+    {
+        m_insert->Abandon();
+    }
+
+private:
+    void OnIdle(wxIdleEvent& event);
+
+    wxStyledTextCtrl* m_ctrl;
+    wxd_StyledTextCtrl_LoadProgressCallback m_progress;
+    void* m_user_data;
+    wxd_StyledTextCtrl_FreeUserData m_free;
+    wxFile m_file;
+    std::unique_ptr<char[]> m_buffer;
+    std::unique_ptr<BulkInsert> m_insert;
+    uint64_t m_total = 0;
+    uint64_t m_loaded = 0;
+};
+
+// GUI-thread only.
+std::unordered_map<wxStyledTextCtrl*, FileLoader*> s_file_loaders;
+
+void
+on_loading_ctrl_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    auto found = s_file_loaders.find(static_cast<wxStyledTextCtrl*>(event.GetEventObject()));
+    if (found == s_file_loaders.end())
+        return;
+    found->second->Abandon();
+    delete found->second;
+    s_file_loaders.erase(found);
+}
+
+// Ends the incremental load of `ctrl`, if any, keeping what has been loaded.
+void
+finish_file_load(wxStyledTextCtrl* ctrl)
+{
+    auto found = s_file_loaders.find(ctrl);
+    if (found == s_file_loaders.end())
+        return;
+    FileLoader* loader = found->second;
+    s_file_loaders.erase(found);
+    ctrl->Unbind(wxEVT_DESTROY, &on_loading_ctrl_destroy);
+    loader->Detach();
+    loader->Finish();
+    delete loader;
+}
+
+void
+FileLoader::OnIdle(wxIdleEvent& event)
+{
+    event.Skip();
+    // A short slice per idle event keeps the UI responsive while the file streams in.
+    m_ctrl->SetReadOnly(false);
+    const bool done = Step(15);
+    m_ctrl->SetReadOnly(true);
+    if (done)
+        finish_file_load(m_ctrl); // deletes this
+    else
+        event.RequestMore();
+}
+
+// --- Background find-all ---
+
+// Bytes searched between two checks for cancellation and deliveries of matches.
+constexpr size_t kFindChunkBytes = 4 << 20;
+
+bool
+is_word_byte(unsigned char c)
+{
+    return c >= 0x80 || c == '_' || std::isalnum(c);
+}
+
+// State shared between a find-all job (GUI thread) and its worker thread. The worker reads the
+// snapshot and appends (start, length) pairs to `pending`; the GUI thread drains them.
+struct FindAllShared {
+    std::vector<char> text;
+    std::string pattern;
+    std::regex regex;
+    int flags = 0;
+    size_t visible_start = 0;
+    size_t visible_end = 0;
+    wxStyledTextCtrl* key = nullptr; // looks the job up in s_find_jobs; never dereferenced
+    std::atomic<bool> cancelled{ false };
+
+    std::mutex mutex;
+    std::vector<int32_t> pending;
+    bool finished = false;
+    bool posted = false;
+};
+
+void deliver_find_results(const std::shared_ptr<FindAllShared>& shared);
+
+// Runs on the worker thread: searches the visible lines first, then the rest of the document in
+// line-aligned chunks, handing over the matches found after each piece.
+class FindAllWorker {
+public:
+    explicit FindAllWorker(std::shared_ptr<FindAllShared> shared) : m_shared(std::move(shared)) {}
+
+    void
+    Run()
+    {
+        const size_t size = m_shared->text.size();
+        const size_t visible_start = std::min(m_shared->visible_start, size);
+        const size_t visible_end = std::max(visible_start, std::min(m_shared->visible_end, size));
+        if (Search(visible_start, visible_end) && Chunked(0, visible_start))
+            Chunked(visible_end, size);
+        Publish(true);
+    }
+
+private:
+    bool
+    Chunked(size_t begin, size_t end)
+    {
+        const char* base = m_shared->text.data();
+        while (begin < end) {
+            size_t stop = std::min(begin + kFindChunkBytes, end);
+            if (stop < end) {
+                const void* nl = std::memchr(base + stop, '\n', end - stop);
+                stop = nl ? static_cast<size_t>(static_cast<const char*>(nl) - base) + 1 : end;
+            }
+            if (!Search(begin, stop))
+                return false;
+            begin = stop;
+        }
+        return true;
+    }
+
+    // Collects the matches starting in [begin, end) and publishes them. Returns false once the
+    // job has been cancelled.
+    bool
+    Search(size_t begin, size_t end)
+    {
+        if (m_shared->cancelled)
+            return false;
+        if (begin < end) {
+            if (m_shared->flags & wxSTC_FIND_REGEXP)
+                SearchRegex(begin, end);
+            else if (m_shared->flags & wxSTC_FIND_MATCHCASE)
+                SearchLiteral(begin, end);
+            else
+                SearchFolded(begin, end);
+        }
+        Publish(false);
+        return !m_shared->cancelled;
+    }
+
+    void
+    SearchLiteral(size_t begin, size_t end)
+    {
+        const char* base = m_shared->text.data();
+        const size_t size = m_shared->text.size();
+        const std::string& pattern = m_shared->pattern;
+        size_t pos = begin;
+        while (pos < end) {
+            const void* hit = std::memchr(base + pos, pattern[0], end - pos);
+            if (!hit)
+                break;
+            const size_t at = static_cast<size_t>(static_cast<const char*>(hit) - base);
+            if (at + pattern.size() <= size &&
+                std::memcmp(base + at, pattern.data(), pattern.size()) == 0 &&
+                Add(at, pattern.size()))
+                pos = at + pattern.size();
+            else
+                pos = at + 1;
+        }
+    }
+
+    // ASCII case folding, as Scintilla does for UTF-8 documents outside the Latin range.
+    void
+    SearchFolded(size_t begin, size_t end)
+    {
+        struct FoldHash {
+            size_t
+            operator()(char c) const
+            {
+                return static_cast<size_t>(std::tolower(static_cast<unsigned char>(c)));
+            }
+        };
+        struct FoldEqual {
+            bool
+            operator()(char a, char b) const
+            {
+                return std::tolower(static_cast<unsigned char>(a)) ==
+                       std::tolower(static_cast<unsigned char>(b));
+            }
+        };
+        const std::string& pattern = m_shared->pattern;
+        const std::boyer_moore_horspool_searcher<std::string::const_iterator, FoldHash, FoldEqual>
+            searcher(pattern.begin(), pattern.end());
+        const char* base = m_shared->text.data();
+        // Matches may run past `end`, not past the document.
+        const char* last = base + std::min(m_shared->text.size(), end + pattern.size() - 1);
+        const char* pos = base + begin;
+        while (pos < base + end) {
+            const char* hit = std::search(pos, last, searcher);
+            if (hit == last || hit >= base + end)
+                break;
+            const size_t at = static_cast<size_t>(hit - base);
+            pos = Add(at, pattern.size()) ? hit + pattern.size() : hit + 1;
+        }
+    }
+
+    // Like Scintilla, regular expressions match within a line.
+    void
+    SearchRegex(size_t begin, size_t end)
+    {
+        const char* base = m_shared->text.data();
+        size_t line = begin;
+        while (line < end) {
+            const void* nl = std::memchr(base + line, '\n', end - line);
+            const size_t next = nl ? static_cast<size_t>(static_cast<const char*>(nl) - base) + 1
+                                   : end;
+            size_t line_end = nl ? next - 1 : end;
+            if (line_end > line && base[line_end - 1] == '\r')
+                --line_end;
+            for (std::cregex_iterator it(base + line, base + line_end, m_shared->regex), done;
+                 it != done; ++it) {
+                if (it->length(0) > 0)
+                    Add(line + static_cast<size_t>(it->position(0)),
+                        static_cast<size_t>(it->length(0)));
+            }
+            line = next;
+        }
+    }
+
+    bool
+    Add(size_t at, size_t length)
+    {
+        if (m_shared->flags & wxSTC_FIND_WHOLEWORD) {
+            const auto& text = m_shared->text;
+            if (at > 0 && is_word_byte(static_cast<unsigned char>(text[at - 1])))
+                return false;
+            if (at + length < text.size() &&
+                is_word_byte(static_cast<unsigned char>(text[at + length])))
+                return false;
+        }
+        m_found.push_back(static_cast<int32_t>(at));
+        m_found.push_back(static_cast<int32_t>(length));
+        return true;
+    }
+
+    // Hands the matches over, queueing a delivery unless one is already pending.
+    void
+    Publish(bool finished)
+    {
+        if (m_found.empty() && !finished)
+            return;
+        bool post;
+        {
+            std::lock_guard<std::mutex> lock(m_shared->mutex);
+            m_shared->pending.insert(m_shared->pending.end(), m_found.begin(), m_found.end());
+            m_shared->finished = finished;
+            post = !m_shared->posted;
+            m_shared->posted = true;
+        }
+        m_found.clear();
+        if (post && !m_shared->cancelled && wxTheApp) {
+            std::shared_ptr<FindAllShared> shared = m_shared;
+            wxTheApp->CallAfter([shared]() { deliver_find_results(shared); });
+        }
+    }
+
+    std::shared_ptr<FindAllShared> m_shared;
+    std::vector<int32_t> m_found;
+};
+
+// A running find-all of one control. Owned through s_find_jobs; ends when the worker is done,
+// on the next edit, on a new search or with the control.
+class FindAllJob {
+public:
+    FindAllJob(wxStyledTextCtrl* ctrl, std::shared_ptr<FindAllShared> shared, int indicator,
+               int value, wxd_StyledTextCtrl_FindAllCallback callback, void* user_data,
+               wxd_StyledTextCtrl_FreeUserData free_user_data)
+        : m_ctrl(ctrl), m_shared(std::move(shared)), m_indicator(indicator), m_value(value),
+          m_callback(callback), m_user_data(user_data), m_free(free_user_data)
+    {
+        ctrl->Bind(wxEVT_STC_MODIFIED, &FindAllJob::OnModified, this);
+    }
+
+    ~FindAllJob()
+    {
+        m_shared->cancelled = true;
+        if (m_free)
+            m_free(m_user_data);
+    }
+
+    const std::shared_ptr<FindAllShared>&
+    Shared() const
+    {
+        return m_shared;
+    }
+
+    void
+    Apply(const std::vector<int32_t>& ranges)
+    {
+        if (ranges.empty())
+            return;
+        wxWindowUpdateLocker freeze(m_ctrl);
+        m_ctrl->SetIndicatorCurrent(m_indicator);
+        m_ctrl->SetIndicatorValue(m_value);
+        for (size_t i = 0; i + 1 < ranges.size(); i += 2)
+            m_ctrl->IndicatorFillRange(ranges[i], ranges[i + 1]);
+        m_matches += ranges.size() / 2;
+    }
+
+    // Reports the outcome; the caller deletes the job afterwards.
+    void
+    Finish(bool completed)
+    {
+        m_shared->cancelled = true;
+        m_ctrl->Unbind(wxEVT_STC_MODIFIED, &FindAllJob::OnModified, this);
+        if (m_callback)
+            m_callback(m_user_data, m_matches, completed);
+    }
+
+    // Forgets the control, which is being destroyed.
+    void
+    Abandon()
+    {
+        m_shared->cancelled = true;
+    }
+
+private:
+    void OnModified(wxStyledTextEvent& event);
+
+    wxStyledTextCtrl* m_ctrl;
+    std::shared_ptr<FindAllShared> m_shared;
+    int m_indicator;
+    int m_value;
+    wxd_StyledTextCtrl_FindAllCallback m_callback;
+    void* m_user_data;
+    wxd_StyledTextCtrl_FreeUserData m_free;
+    uint64_t m_matches = 0;
+};
+
+// GUI-thread only.
+std::unordered_map<wxStyledTextCtrl*, FindAllJob*> s_find_jobs;
+
+void
+on_searched_ctrl_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    auto found = s_find_jobs.find(static_cast<wxStyledTextCtrl*>(event.GetEventObject()));
+    if (found == s_find_jobs.end())
+        return;
+    found->second->Abandon();
+    delete found->second;
+    s_find_jobs.erase(found);
+}
+
+// Ends the find-all of `ctrl`, if any, reporting whether it ran to completion.
+void
+finish_find_all(wxStyledTextCtrl* ctrl, bool completed)
+{
+    auto found = s_find_jobs.find(ctrl);
+    if (found == s_find_jobs.end())
+        return;
+    FindAllJob* job = found->second;
+    s_find_jobs.erase(found);
+    ctrl->Unbind(wxEVT_DESTROY, &on_searched_ctrl_destroy);
+    job->Finish(completed);
+    delete job;
+}
+
+void
+FindAllJob::OnModified(wxStyledTextEvent& event)
+{
+    event.Skip();
+    // Matches found in the snapshot no longer line up with the text.
+    if (event.GetModificationType() & (wxSTC_MOD_INSERTTEXT | wxSTC_MOD_DELETETEXT))
+        finish_find_all(m_ctrl, false); // deletes this
+}
+
+void
+deliver_find_results(const std::shared_ptr<FindAllShared>& shared)
+{
+    std::vector<int32_t> ranges;
+    bool finished;
+    {
+        std::lock_guard<std::mutex> lock(shared->mutex);
+        ranges.swap(shared->pending);
+        finished = shared->finished;
+        shared->posted = false;
+    }
+    auto found = s_find_jobs.find(shared->key);
+    if (found == s_find_jobs.end() || found->second->Shared() != shared)
+        return; // cancelled or superseded
+    found->second->Apply(ranges);
+    if (finished)
+        finish_find_all(shared->key, true);
+}
+
+// Scintilla document shared between controls through a wxd_StcDocument_t handle, which holds
+// one Scintilla reference for all its own references. Scintilla only takes reference messages
+// through a control, so handles release through any control that shared a document, and once
+// the last such control goes they release what they still hold and stop resolving.
+// GUI-thread only.
+struct StcDocument {
+    void* doc;
+    int refs;
+};
+
+std::unordered_set<StcDocument*> s_documents;
+std::unordered_set<wxStyledTextCtrl*> s_document_hosts;
+
+void
+on_document_host_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    auto* ctrl = static_cast<wxStyledTextCtrl*>(event.GetEventObject());
+    if (!s_document_hosts.erase(ctrl) || !s_document_hosts.empty())
+        return;
+    for (StcDocument* document : s_documents) {
+        if (document->doc) {
+            ctrl->ReleaseDocument(document->doc);
+            document->doc = nullptr;
+        }
+    }
+}
+
+void
+add_document_host(wxStyledTextCtrl* ctrl)
+{
+    if (s_document_hosts.insert(ctrl).second)
+        ctrl->Bind(wxEVT_DESTROY, &on_document_host_destroy);
+}
+
+} // namespace
 
 extern "C" {
 
@@ -16,8 +737,9 @@ wxd_StyledTextCtrl_Create(wxd_Window_t* parent, wxd_Id id, wxd_Point pos, wxd_Si
                           wxd_Style_t style)
 {
     wxWindow* parentWin = (wxWindow*)parent;
-    wxStyledTextCtrl* ctrl = new wxStyledTextCtrl(parentWin, id, wxd_cpp_utils::to_wx(pos),
-                                                  wxd_cpp_utils::to_wx(size), style);
+    wxStyledTextCtrl* ctrl = new wxStyledTextCtrl(parentWin, id,
+                                                  wxd_cpp_utils::to_wx(pos, parentWin),
+                                                  wxd_cpp_utils::to_wx(size, parentWin), style);
     return (wxd_StyledTextCtrl_t*)ctrl;
 }
 
@@ -41,6 +763,14 @@ wxd_StyledTextCtrl_GetText(wxd_StyledTextCtrl_t* self, char* buffer, int buffer_
     return wxd_cpp_utils::copy_wxstring_to_buffer(text, buffer, (size_t)buffer_len);
 }
 
+WXD_EXPORTED wxd_String_t*
+wxd_StyledTextCtrl_GetTextOwned(wxd_StyledTextCtrl_t* self)
+{
+    if (!self)
+        return nullptr;
+    return wxd_cpp_utils::make_owned_string(((wxStyledTextCtrl*)self)->GetText());
+}
+
 WXD_EXPORTED void
 wxd_StyledTextCtrl_AppendText(wxd_StyledTextCtrl_t* self, const char* text)
 {
@@ -50,6 +780,46 @@ wxd_StyledTextCtrl_AppendText(wxd_StyledTextCtrl_t* self, const char* text)
     }
 }
 
+WXD_EXPORTED void
+wxd_StyledTextCtrl_SetConsoleMode(wxd_StyledTextCtrl_t* self, bool enable, int max_lines)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (!ctrl)
+        return;
+    if (!enable) {
+        wxdLogConsole::Detach(ctrl);
+        return;
+    }
+    wxdLogConsole* console = wxdLogConsole::Get(ctrl);
+    if (!console) {
+        console = new StyledTextConsole(ctrl);
+        wxdLogConsole::Attach(console);
+    }
+    console->SetMaxLines(max_lines);
+}
+
+WXD_EXPORTED void
+wxd_StyledTextCtrl_ConsoleAppend(wxd_StyledTextCtrl_t* self, const char* text, size_t len)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (!ctrl || !text || len == 0)
+        return;
+    if (wxdLogConsole* console = wxdLogConsole::Get(ctrl))
+        console->Append(text, len);
+    else
+        ctrl->AppendTextRaw(text, static_cast<int>(len));
+}
+
+WXD_EXPORTED void
+wxd_StyledTextCtrl_ConsoleFlush(wxd_StyledTextCtrl_t* self)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (!ctrl)
+        return;
+    if (wxdLogConsole* console = wxdLogConsole::Get(ctrl))
+        console->Flush();
+}
+
 WXD_EXPORTED void
 wxd_StyledTextCtrl_InsertText(wxd_StyledTextCtrl_t* self, int pos, const char* text)
 {
@@ -86,6 +856,230 @@ wxd_StyledTextCtrl_GetLength(wxd_StyledTextCtrl_t* self)
     return ctrl->GetLength();
 }
 
+WXD_EXPORTED bool
+wxd_StyledTextCtrl_LoadFromBytes(wxd_StyledTextCtrl_t* self, const uint8_t* data, size_t len)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (!ctrl || (!data && len > 0) || len >= static_cast<size_t>(INT_MAX))
+        return false;
+    finish_file_load(ctrl);
+    BulkInsert insert(ctrl, len);
+    for (size_t offset = 0; offset < len; offset += kLoadChunkBytes) {
+        insert.Add(reinterpret_cast<const char*>(data) + offset,
+                   std::min(kLoadChunkBytes, len - offset));
+    }
+    return true;
+}
+
+WXD_EXPORTED bool
+wxd_StyledTextCtrl_LoadFileFast(wxd_StyledTextCtrl_t* self, const char* path, bool incremental,
+                                wxd_StyledTextCtrl_LoadProgressCallback progress,
+                                void* user_data,
+                                wxd_StyledTextCtrl_FreeUserData free_user_data)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (!ctrl || !path) {
+        if (free_user_data)
+            free_user_data(user_data);
+        return false;
+    }
+    finish_file_load(ctrl);
+    FileLoader* loader = new FileLoader(ctrl, progress, user_data, free_user_data);
+    if (!loader->Open(wxString::FromUTF8(path))) {
+        delete loader;
+        return false;
+    }
+    if (!incremental) {
+        loader->Step(0);
+        loader->Finish();
+        delete loader;
+        return true;
+    }
+    s_file_loaders[ctrl] = loader;
+    ctrl->Bind(wxEVT_DESTROY, &on_loading_ctrl_destroy);
+    loader->StartIncremental();
+    return true;
+}
+
+WXD_EXPORTED void
+wxd_StyledTextCtrl_CancelLoad(wxd_StyledTextCtrl_t* self)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (ctrl)
+        finish_file_load(ctrl);
+}
+
+WXD_EXPORTED bool
+wxd_StyledTextCtrl_FindAllAsync(wxd_StyledTextCtrl_t* self, const char* pattern,
+                                int search_flags, int indicator, int value,
+                                wxd_StyledTextCtrl_FindAllCallback callback, void* user_data,
+                                wxd_StyledTextCtrl_FreeUserData free_user_data)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    auto shared = std::make_shared<FindAllShared>();
+    shared->pattern = pattern ? pattern : "";
+    shared->flags = search_flags;
+    shared->key = ctrl;
+    bool valid = ctrl && !shared->pattern.empty();
+    if (valid && (search_flags & wxSTC_FIND_REGEXP)) {
+        auto syntax = std::regex::ECMAScript;
+        if (!(search_flags & wxSTC_FIND_MATCHCASE))
+            syntax |= std::regex::icase;
+        try {
+            shared->regex.assign(shared->pattern, syntax);
+        } catch (const std::regex_error&) {
+            valid = false;
+        }
+    }
+    if (!valid) {
+        if (free_user_data)
+            free_user_data(user_data);
+        return false;
+    }
+
+    finish_find_all(ctrl, false);
+    const char* text = ctrl->GetCharacterPointer();
+    const size_t length = static_cast<size_t>(ctrl->GetLength());
+    if (text && length)
+        shared->text.assign(text, text + length);
+    const int first = ctrl->DocLineFromVisible(ctrl->GetFirstVisibleLine());
+    const int last = ctrl->DocLineFromVisible(ctrl->GetFirstVisibleLine() + ctrl->LinesOnScreen());
+    shared->visible_start = static_cast<size_t>(std::max(ctrl->PositionFromLine(first), 0));
+    shared->visible_end = last + 1 < ctrl->GetLineCount()
+                              ? static_cast<size_t>(ctrl->PositionFromLine(last + 1))
+                              : length;
+
+    ctrl->SetIndicatorCurrent(indicator);
+    ctrl->IndicatorClearRange(0, ctrl->GetLength());
+    s_find_jobs[ctrl] = new FindAllJob(ctrl, shared, indicator, value, callback, user_data,
+                                       free_user_data);
+    ctrl->Bind(wxEVT_DESTROY, &on_searched_ctrl_destroy);
+    std::thread([shared]() { FindAllWorker(shared).Run(); }).detach();
+    return true;
+}
+
+WXD_EXPORTED void
+wxd_StyledTextCtrl_CancelFindAll(wxd_StyledTextCtrl_t* self)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (ctrl)
+        finish_find_all(ctrl, false);
+}
+
+WXD_EXPORTED wxd_StcDocument_t*
+wxd_StyledTextCtrl_GetDocument(wxd_StyledTextCtrl_t* self)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (!ctrl)
+        return nullptr;
+    void* doc = ctrl->GetDocPointer();
+    if (!doc)
+        return nullptr;
+    ctrl->AddRefDocument(doc);
+    add_document_host(ctrl);
+    StcDocument* document = new StcDocument{ doc, 1 };
+    s_documents.insert(document);
+    return reinterpret_cast<wxd_StcDocument_t*>(document);
+}
+
+WXD_EXPORTED bool
+wxd_StyledTextCtrl_SetDocument(wxd_StyledTextCtrl_t* self, wxd_StcDocument_t* document)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    StcDocument* shared = reinterpret_cast<StcDocument*>(document);
+    if (!ctrl || !shared || !shared->doc)
+        return false;
+    if (ctrl->GetDocPointer() == shared->doc)
+        return true;
+    // Both work on the document the control is about to let go of.
+    finish_file_load(ctrl);
+    finish_find_all(ctrl, false);
+    ctrl->SetDocPointer(shared->doc);
+    add_document_host(ctrl);
+    return true;
+}
+
+WXD_EXPORTED wxd_StcDocument_t*
+wxd_StcDocument_AddRef(wxd_StcDocument_t* document)
+{
+    StcDocument* shared = reinterpret_cast<StcDocument*>(document);
+    if (shared)
+        ++shared->refs;
+    return document;
+}
+
+WXD_EXPORTED void
+wxd_StcDocument_Release(wxd_StcDocument_t* document)
+{
+    StcDocument* shared = reinterpret_cast<StcDocument*>(document);
+    if (!shared || --shared->refs > 0)
+        return;
+    if (shared->doc && !s_document_hosts.empty())
+        (*s_document_hosts.begin())->ReleaseDocument(shared->doc);
+    s_documents.erase(shared);
+    delete shared;
+}
+
+WXD_EXPORTED bool
+wxd_StcDocument_IsValid(const wxd_StcDocument_t* document)
+{
+    const StcDocument* shared = reinterpret_cast<const StcDocument*>(document);
+    return shared && shared->doc;
+}
+
+WXD_EXPORTED bool
+wxd_StcDocument_IsShownBy(const wxd_StcDocument_t* document, wxd_StyledTextCtrl_t* self)
+{
+    const StcDocument* shared = reinterpret_cast<const StcDocument*>(document);
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    return shared && ctrl && shared->doc && ctrl->GetDocPointer() == shared->doc;
+}
+
+WXD_EXPORTED const char*
+wxd_StyledTextCtrl_GetCharacterPointer(wxd_StyledTextCtrl_t* self, size_t* length)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (length)
+        *length = 0;
+    if (!ctrl)
+        return nullptr;
+    const char* text = ctrl->GetCharacterPointer();
+    if (length)
+        *length = static_cast<size_t>(ctrl->GetLength());
+    return text;
+}
+
+WXD_EXPORTED const char*
+wxd_StyledTextCtrl_GetRangePointer(wxd_StyledTextCtrl_t* self, int start, int length)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (!ctrl || start < 0 || length < 0 || start + length > ctrl->GetLength())
+        return nullptr;
+    return ctrl->GetRangePointer(start, length);
+}
+
+WXD_EXPORTED int
+wxd_StyledTextCtrl_GetTextRangeRaw(wxd_StyledTextCtrl_t* self, int start, int end, char* buffer,
+                                   int buffer_len)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (!ctrl)
+        return -1;
+    start = std::max(0, start);
+    end = std::min(end, ctrl->GetLength());
+    if (end <= start)
+        return 0;
+    const int length = end - start;
+    if (buffer && buffer_len > 0) {
+        // Reading through the range pointer skips the wxCharBuffer GetTextRangeRaw allocates.
+        const char* range = ctrl->GetRangePointer(start, length);
+        if (!range)
+            return -1;
+        std::memcpy(buffer, range, static_cast<size_t>(std::min(length, buffer_len)));
+    }
+    return length;
+}
+
 WXD_EXPORTED int
 wxd_StyledTextCtrl_GetLineCount(wxd_StyledTextCtrl_t* self)
 {
@@ -358,6 +1352,22 @@ wxd_StyledTextCtrl_MarkerAdd(wxd_StyledTextCtrl_t* self, int line, int markerNum
     return ctrl->MarkerAdd(line, markerNumber);
 }
 
+WXD_EXPORTED size_t
+wxd_StyledTextCtrl_MarkerAddLines(wxd_StyledTextCtrl_t* self, const int32_t* lines, size_t count,
+                                  int markerNumber)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (!ctrl || !lines || count == 0)
+        return 0;
+    wxWindowUpdateLocker freeze(ctrl);
+    size_t added = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (ctrl->MarkerAdd(lines[i], markerNumber) >= 0)
+            ++added;
+    }
+    return added;
+}
+
 WXD_EXPORTED void
 wxd_StyledTextCtrl_MarkerDelete(wxd_StyledTextCtrl_t* self, int line, int markerNumber)
 {
@@ -519,6 +1529,104 @@ wxd_StyledTextCtrl_SetStyling(wxd_StyledTextCtrl_t* self, int length, int style)
     }
 }
 
+WXD_EXPORTED void
+wxd_StyledTextCtrl_SetStyleBytes(wxd_StyledTextCtrl_t* self, int start, const uint8_t* styles,
+                                 int length)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (ctrl && styles && length > 0) {
+        ctrl->StartStyling(start);
+        ctrl->SetStyleBytes(length, reinterpret_cast<const char*>(styles));
+    }
+}
+
+WXD_EXPORTED int
+wxd_StyledTextCtrl_GetEndStyled(wxd_StyledTextCtrl_t* self)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (ctrl) {
+        return ctrl->GetEndStyled();
+    }
+    return 0;
+}
+
+WXD_EXPORTED void
+wxd_StyledTextCtrl_SetStyleNeededCallback(wxd_StyledTextCtrl_t* self,
+                                          wxd_StyledTextCtrl_StyleNeededCallback callback,
+                                          void* user_data,
+                                          wxd_StyledTextCtrl_FreeUserData free_user_data)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (!ctrl) {
+        if (free_user_data)
+            free_user_data(user_data);
+        return;
+    }
+    auto found = s_style_hooks.find(ctrl);
+    if (found != s_style_hooks.end()) {
+        ctrl->Unbind(wxEVT_DESTROY, &on_styled_ctrl_destroy);
+        found->second->Detach();
+        delete found->second;
+        s_style_hooks.erase(found);
+    }
+    if (!callback) {
+        if (free_user_data)
+            free_user_data(user_data);
+        return;
+    }
+    s_style_hooks[ctrl] = new StyleNeededHook(ctrl, callback, user_data, free_user_data);
+    ctrl->Bind(wxEVT_DESTROY, &on_styled_ctrl_destroy);
+    ctrl->SetLexer(wxSTC_LEX_CONTAINER);
+    // Resets the styled end to 0, so the visible text is restyled through the new hook.
+    ctrl->ClearDocumentStyle();
+}
+
+WXD_EXPORTED void
+wxd_StyledTextCtrl_IndicatorSetStyle(wxd_StyledTextCtrl_t* self, int indicator, int style)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (ctrl) {
+        ctrl->IndicatorSetStyle(indicator, style);
+    }
+}
+
+WXD_EXPORTED void
+wxd_StyledTextCtrl_IndicatorSetForeground(wxd_StyledTextCtrl_t* self, int indicator,
+                                          wxd_Colour_t colour)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (ctrl) {
+        ctrl->IndicatorSetForeground(indicator, wxColour(colour.r, colour.g, colour.b, colour.a));
+    }
+}
+
+WXD_EXPORTED void
+wxd_StyledTextCtrl_IndicatorFillRanges(wxd_StyledTextCtrl_t* self, int indicator, int value,
+                                       const int32_t* ranges, size_t count)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (!ctrl || !ranges || count == 0)
+        return;
+    wxWindowUpdateLocker freeze(ctrl);
+    ctrl->SetIndicatorCurrent(indicator);
+    ctrl->SetIndicatorValue(value);
+    for (size_t i = 0; i < count; ++i) {
+        if (ranges[i * 2 + 1] > 0)
+            ctrl->IndicatorFillRange(ranges[i * 2], ranges[i * 2 + 1]);
+    }
+}
+
+WXD_EXPORTED void
+wxd_StyledTextCtrl_IndicatorClearRange(wxd_StyledTextCtrl_t* self, int indicator, int start,
+                                       int length)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (ctrl) {
+        ctrl->SetIndicatorCurrent(indicator);
+        ctrl->IndicatorClearRange(start, length);
+    }
+}
+
 // Lexer and language support
 WXD_EXPORTED void
 wxd_StyledTextCtrl_SetLexer(wxd_StyledTextCtrl_t* self, int lexer)
@@ -1123,6 +2231,21 @@ wxd_StyledTextCtrl_SetFoldLevel(wxd_StyledTextCtrl_t* self, int line, int level)
     }
 }
 
+WXD_EXPORTED void
+wxd_StyledTextCtrl_SetFoldLevels(wxd_StyledTextCtrl_t* self, int firstLine, const int32_t* levels,
+                                 size_t count)
+{
+    wxStyledTextCtrl* ctrl = (wxStyledTextCtrl*)self;
+    if (!ctrl || !levels || count == 0 || firstLine < 0)
+        return;
+    // Lines past the end of the document are ignored by Scintilla; stop there instead.
+    const size_t available = (size_t)std::max(ctrl->GetLineCount() - firstLine, 0);
+    count = std::min(count, available);
+    wxWindowUpdateLocker freeze(ctrl);
+    for (size_t i = 0; i < count; ++i)
+        ctrl->SetFoldLevel(firstLine + (int)i, levels[i]);
+}
+
 WXD_EXPORTED int
 wxd_StyledTextCtrl_GetFoldLevel(wxd_StyledTextCtrl_t* self, int line)
 {
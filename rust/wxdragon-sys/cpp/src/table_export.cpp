@@ -0,0 +1,259 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include <wx/grid.h>
+#include "../include/wxdragon.h"
+#include "../src/wxd_utils.h"
+#include "wxd_dataview_row_cache.h"
+#include "wxd_dataview_rows.h"
+#include <wx/dataview.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Text written before the sink is called; keeps callbacks few without holding a whole export.
+constexpr size_t kChunkSize = 256 * 1024;
+
+// Formats rows of fields as delimited text, either into one string (no sink) or in chunks to a
+// write callback.
+class TableWriter {
+public:
+    TableWriter(const wxd_TableExportFormat& format, wxd_table_export_write_fn write,
+                void* userdata)
+        : m_format(format), m_write(write), m_userdata(userdata)
+    {
+    }
+
+    const wxd_TableExportFormat&
+    Format() const
+    {
+        return m_format;
+    }
+
+    void
+    Field(const wxString& value)
+    {
+        if (m_fields++ > 0)
+            m_out.push_back(m_format.delimiter);
+        const wxScopedCharBuffer utf8 = value.utf8_str();
+        const char* text = utf8.data();
+        const size_t len = utf8.length();
+        if (std::none_of(text, text + len, [this](char ch) { return IsSpecial(ch); })) {
+            m_out.append(text, len);
+        }
+        else if (m_format.quote) {
+            m_out.push_back(m_format.quote);
+            for (size_t i = 0; i < len; ++i) {
+                if (text[i] == m_format.quote)
+                    m_out.push_back(m_format.quote);
+                m_out.push_back(text[i]);
+            }
+            m_out.push_back(m_format.quote);
+        }
+        else {
+            for (size_t i = 0; i < len; ++i)
+                m_out.push_back(IsSpecial(text[i]) ? ' ' : text[i]);
+        }
+    }
+
+    // Ends the current line; false once the sink refused data.
+    bool
+    EndLine()
+    {
+        m_out.append(m_format.crlf ? "\r\n" : "\n");
+        m_fields = 0;
+        if (m_write && m_out.size() >= kChunkSize)
+            return Flush();
+        return m_ok;
+    }
+
+    bool
+    Flush()
+    {
+        if (m_write && m_ok && !m_out.empty())
+            m_ok = m_write(m_userdata, m_out.data(), m_out.size());
+        m_out.clear();
+        return m_ok;
+    }
+
+    wxd_String_t*
+    Take()
+    {
+        return wxd_cpp_utils::make_owned_string(wxString::FromUTF8(m_out.data(), m_out.size()));
+    }
+
+private:
+    bool
+    IsSpecial(char ch) const
+    {
+        return ch == m_format.delimiter || ch == '\r' || ch == '\n' ||
+               (m_format.quote && ch == m_format.quote);
+    }
+
+    wxd_TableExportFormat m_format;
+    wxd_table_export_write_fn m_write;
+    void* m_userdata;
+    std::string m_out;
+    size_t m_fields = 0;
+    bool m_ok = true;
+};
+
+// Sorted, distinct values of [first, last] ranges clamped to [0, limit).
+std::vector<int>
+union_of(const std::vector<std::pair<int, int>>& ranges, int limit)
+{
+    std::vector<int> out;
+    for (const auto& [first, last] : ranges) {
+        for (int i = std::max(first, 0); i <= std::min(last, limit - 1); ++i)
+            out.push_back(i);
+    }
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+    return out;
+}
+
+bool
+export_grid(wxGrid* grid, const wxd_GridBlockCoords* blocks, size_t count, TableWriter& out)
+{
+    wxGridTableBase* table = grid->GetTable();
+    if (!table)
+        return false;
+    std::vector<std::pair<int, int>> row_ranges;
+    std::vector<std::pair<int, int>> col_ranges;
+    for (size_t i = 0; i < count; ++i) {
+        row_ranges.emplace_back(blocks[i].top_row, blocks[i].bottom_row);
+        col_ranges.emplace_back(blocks[i].left_col, blocks[i].right_col);
+    }
+    const std::vector<int> rows = union_of(row_ranges, grid->GetNumberRows());
+    const std::vector<int> cols = union_of(col_ranges, grid->GetNumberCols());
+    const auto inside = [&](int row, int col) {
+        for (size_t i = 0; i < count; ++i) {
+            const wxd_GridBlockCoords& b = blocks[i];
+            if (row >= b.top_row && row <= b.bottom_row && col >= b.left_col &&
+                col <= b.right_col)
+                return true;
+        }
+        return false;
+    };
+
+    const wxd_TableExportFormat& format = out.Format();
+    if (format.header) {
+        if (format.row_labels)
+            out.Field(wxString());
+        for (int col : cols)
+            out.Field(grid->GetColLabelValue(col));
+        if (!out.EndLine())
+            return false;
+    }
+    for (int row : rows) {
+        if (format.row_labels)
+            out.Field(grid->GetRowLabelValue(row));
+        // Single block (the common case): every cell of the row is inside it.
+        for (int col : cols)
+            out.Field(count == 1 || inside(row, col) ? table->GetValue(row, col) : wxString());
+        if (!out.EndLine())
+            return false;
+    }
+    return out.Flush();
+}
+
+wxString
+cell_text(wxDataViewModel* model, const wxDataViewItem& item, unsigned int col)
+{
+    if (!model->HasValue(item, col))
+        return wxString();
+    wxVariant value;
+    model->GetValue(value, item, col);
+    if (value.IsNull())
+        return wxString();
+    if (value.GetType() == wxS("wxDataViewIconText")) {
+        wxDataViewIconText icon_text;
+        icon_text << value;
+        return icon_text.GetText();
+    }
+    return value.MakeString();
+}
+
+bool
+export_dataview(wxDataViewCtrl* ctrl, bool selected_only, TableWriter& out)
+{
+    // Columns outside the visible range are exported too.
+    wxd_dataview_row_cache::FullColumnsScope full_columns;
+    wxDataViewModel* model = ctrl->GetModel();
+    std::vector<wxDataViewColumn*> columns;
+    for (unsigned int i = 0; i < ctrl->GetColumnCount(); ++i) {
+        wxDataViewColumn* column = ctrl->GetColumn(i);
+        if (column && column->IsShown())
+            columns.push_back(column);
+    }
+    if (out.Format().header) {
+        for (wxDataViewColumn* column : columns)
+            out.Field(column->GetTitle());
+        if (!out.EndLine())
+            return false;
+    }
+    const wxd_dataview_rows::DisplayedRows rows(ctrl);
+    for (size_t i = 0; i < rows.Count(); ++i) {
+        const wxDataViewItem item = rows.At(i).item;
+        if (selected_only && !ctrl->IsSelected(item))
+            continue;
+        for (wxDataViewColumn* column : columns)
+            out.Field(cell_text(model, item, column->GetModelColumn()));
+        if (!out.EndLine())
+            return false;
+    }
+    return out.Flush();
+}
+
+} // namespace
+
+extern "C" {
+
+WXD_EXPORTED wxd_String_t*
+wxd_Grid_ExportRange(wxd_Grid_t* self, const wxd_GridBlockCoords* blocks, size_t count,
+                     const wxd_TableExportFormat* format)
+{
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    if (!grid || !blocks || count == 0 || !format)
+        return nullptr;
+    TableWriter out(*format, nullptr, nullptr);
+    return export_grid(grid, blocks, count, out) ? out.Take() : nullptr;
+}
+
+WXD_EXPORTED bool
+wxd_Grid_ExportRangeTo(wxd_Grid_t* self, const wxd_GridBlockCoords* blocks, size_t count,
+                       const wxd_TableExportFormat* format, wxd_table_export_write_fn write,
+                       void* userdata)
+{
+    wxGrid* grid = reinterpret_cast<wxGrid*>(self);
+    if (!grid || !blocks || count == 0 || !format || !write)
+        return false;
+    TableWriter out(*format, write, userdata);
+    return export_grid(grid, blocks, count, out);
+}
+
+WXD_EXPORTED wxd_String_t*
+wxd_DataViewCtrl_ExportRows(wxd_Window_t* self, bool selected_only,
+                            const wxd_TableExportFormat* format)
+{
+    wxDataViewCtrl* ctrl = reinterpret_cast<wxDataViewCtrl*>(self);
+    if (!ctrl || !format || !ctrl->GetModel())
+        return nullptr;
+    TableWriter out(*format, nullptr, nullptr);
+    return export_dataview(ctrl, selected_only, out) ? out.Take() : nullptr;
+}
+
+WXD_EXPORTED bool
+wxd_DataViewCtrl_ExportRowsTo(wxd_Window_t* self, bool selected_only,
+                              const wxd_TableExportFormat* format,
+                              wxd_table_export_write_fn write, void* userdata)
+{
+    wxDataViewCtrl* ctrl = reinterpret_cast<wxDataViewCtrl*>(self);
+    if (!ctrl || !format || !write || !ctrl->GetModel())
+        return false;
+    TableWriter out(*format, write, userdata);
+    return export_dataview(ctrl, selected_only, out);
+}
+
+} // extern "C"
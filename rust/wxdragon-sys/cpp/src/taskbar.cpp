@@ -11,6 +11,10 @@
 #include "wx/menu.h"
 #include "wx/bitmap.h"
 #include "wx/platinfo.h"
+#include "wx/timer.h"
+
+#include <cstdint>
+#include <vector>
 
 #ifdef __WXOSX__
 #include "wx/osx/private.h"
@@ -20,8 +24,77 @@
 class wxdTaskBarIcon : public wxTaskBarIcon {
 public:
     explicit wxdTaskBarIcon(wxTaskBarIconType iconType)
-        : wxTaskBarIcon(iconType), m_popupMenu(nullptr)
+        : wxTaskBarIcon(iconType), m_popupMenu(nullptr), m_frameTimer(this), m_frame(0)
+    {
+        Bind(wxEVT_TIMER, &wxdTaskBarIcon::OnFrameTimer, this, m_frameTimer.GetId());
+    }
+
+    virtual ~wxdTaskBarIcon()
+    {
+        m_frameTimer.Stop();
+    }
+
+    // Sets a single bitmap, skipping the platform update when neither the pixels nor the
+    // tooltip changed since the last call. The bitmap is fingerprinted rather than compared by
+    // identity because callers may update one bitmap in place between calls.
+    bool
+    SetIconIfChanged(const wxBitmap& bitmap, const wxString& tooltip)
+    {
+        StopAnimation();
+        const uint64_t fingerprint = Fingerprint(bitmap);
+        if (IsIconInstalled() && m_hasIcon && fingerprint == m_fingerprint &&
+            tooltip == m_tooltip)
+            return true;
+        if (!SetIcon(wxBitmapBundle(bitmap), tooltip)) {
+            m_hasIcon = false;
+            return false;
+        }
+        m_hasIcon = true;
+        m_fingerprint = fingerprint;
+        m_tooltip = tooltip;
+        return true;
+    }
+
+    bool
+    SetBundle(const wxBitmapBundle& bundle, const wxString& tooltip)
     {
+        StopAnimation();
+        m_hasIcon = false;
+        m_tooltip = tooltip;
+        return SetIcon(bundle, tooltip);
+    }
+
+    bool
+    Remove()
+    {
+        StopAnimation();
+        m_hasIcon = false;
+        return RemoveIcon();
+    }
+
+    // Converts every frame to an icon once, then cycles through them on a timer. Each tick
+    // hands the port an already converted icon instead of a bitmap to convert again.
+    bool
+    SetAnimationFrames(const std::vector<wxBitmap>& bitmaps, int intervalMs)
+    {
+        StopAnimation();
+        m_hasIcon = false;
+        if (bitmaps.empty())
+            return true;
+        m_frames.reserve(bitmaps.size());
+        for (const wxBitmap& bitmap : bitmaps) {
+            wxIcon icon;
+            icon.CopyFromBitmap(bitmap);
+            m_frames.emplace_back(icon);
+        }
+        m_frame = 0;
+        if (!SetIcon(m_frames[0], m_tooltip)) {
+            m_frames.clear();
+            return false;
+        }
+        if (m_frames.size() > 1)
+            m_frameTimer.Start(intervalMs > 0 ? intervalMs : 100);
+        return true;
     }
 
     // Make the event handler accessible
@@ -81,7 +154,52 @@ protected:
     }
 
 private:
+    void
+    StopAnimation()
+    {
+        m_frameTimer.Stop();
+        m_frames.clear();
+    }
+
+    void
+    OnFrameTimer(wxTimerEvent&)
+    {
+        if (m_frames.empty())
+            return;
+        m_frame = (m_frame + 1) % m_frames.size();
+        SetIcon(m_frames[m_frame], m_tooltip);
+    }
+
+    // FNV-1a over size, colour and alpha.
+    static uint64_t
+    Fingerprint(const wxBitmap& bitmap)
+    {
+        uint64_t hash = 14695981039346656037ull;
+        const auto mix = [&hash](const unsigned char* data, size_t len) {
+            for (size_t i = 0; i < len; ++i) {
+                hash ^= data[i];
+                hash *= 1099511628211ull;
+            }
+        };
+        const wxImage image = bitmap.ConvertToImage();
+        const int size[2] = { image.GetWidth(), image.GetHeight() };
+        mix(reinterpret_cast<const unsigned char*>(size), sizeof(size));
+        if (!image.IsOk())
+            return hash;
+        const size_t pixels = static_cast<size_t>(size[0]) * size[1];
+        mix(image.GetData(), pixels * 3);
+        if (image.HasAlpha())
+            mix(image.GetAlpha(), pixels);
+        return hash;
+    }
+
     wxMenu* m_popupMenu; // Pointer to the popup menu template (not owned by this class)
+    wxTimer m_frameTimer;
+    std::vector<wxBitmapBundle> m_frames;
+    size_t m_frame;
+    wxString m_tooltip;
+    uint64_t m_fingerprint = 0;
+    bool m_hasIcon = false;
     wxDECLARE_NO_COPY_CLASS(wxdTaskBarIcon);
 };
 
@@ -140,16 +258,31 @@ wxd_TaskBarIcon_SetIcon(wxd_TaskBarIcon_t* taskbar, const wxd_Bitmap_t* icon, co
     if (icon) {
         const wxBitmap* wx_bitmap = reinterpret_cast<const wxBitmap*>(icon);
         wxString wx_tooltip = tooltip ? wxString::FromUTF8(tooltip) : wxString();
-
-        // Convert wxBitmap to wxBitmapBundle
-        wxBitmapBundle bundle(*wx_bitmap);
-
-        return wx_taskbar->SetIcon(bundle, wx_tooltip);
+        return wx_taskbar->SetIconIfChanged(*wx_bitmap, wx_tooltip);
     }
     else {
         // Remove icon if no bitmap provided
-        return wx_taskbar->RemoveIcon();
+        return wx_taskbar->Remove();
+    }
+}
+
+bool
+wxd_TaskBarIcon_SetAnimationFrames(wxd_TaskBarIcon_t* taskbar, const wxd_Bitmap_t* const* bitmaps,
+                                   int count, int interval_ms)
+{
+    if (!taskbar || (count > 0 && !bitmaps))
+        return false;
+
+    wxdTaskBarIcon* wx_taskbar = reinterpret_cast<wxdTaskBarIcon*>(taskbar);
+
+    std::vector<wxBitmap> frames;
+    frames.reserve(count > 0 ? count : 0);
+    for (int i = 0; i < count; ++i) {
+        const wxBitmap* wx_bitmap = reinterpret_cast<const wxBitmap*>(bitmaps[i]);
+        if (wx_bitmap && wx_bitmap->IsOk())
+            frames.push_back(*wx_bitmap);
     }
+    return wx_taskbar->SetAnimationFrames(frames, interval_ms);
 }
 
 bool
@@ -164,11 +297,11 @@ wxd_TaskBarIcon_SetIconBundle(wxd_TaskBarIcon_t* taskbar, const wxd_BitmapBundle
     if (iconBundle) {
         const wxBitmapBundle* wx_bundle = reinterpret_cast<const wxBitmapBundle*>(iconBundle);
         wxString wx_tooltip = tooltip ? wxString::FromUTF8(tooltip) : wxString();
-        return wx_taskbar->SetIcon(*wx_bundle, wx_tooltip);
+        return wx_taskbar->SetBundle(*wx_bundle, wx_tooltip);
     }
     else {
         // Remove icon if no bundle provided
-        return wx_taskbar->RemoveIcon();
+        return wx_taskbar->Remove();
     }
 }
 
@@ -179,7 +312,7 @@ wxd_TaskBarIcon_RemoveIcon(wxd_TaskBarIcon_t* taskbar)
         return false;
 
     wxdTaskBarIcon* wx_taskbar = reinterpret_cast<wxdTaskBarIcon*>(taskbar);
-    return wx_taskbar->RemoveIcon();
+    return wx_taskbar->Remove();
 }
 
 bool
@@ -0,0 +1,225 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_text_extent.h"
+#include "wxd_cache_registry.h"
+#include <cstring>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+struct Entry {
+    wxd_text_extent::Key key; // `text` points into `bytes`
+    std::string bytes;
+    wxd_text_extent::Extent extent;
+};
+
+// Least recently used entries at the back. Several entries may share a hash; lookups compare
+// the full key.
+class ExtentCache : public wxd_cache_registry::Cache {
+public:
+    size_t capacity = 0;
+
+    ExtentCache() : Cache("text_extent") {}
+
+    bool
+    Lookup(const wxd_text_extent::Key& key, wxd_text_extent::Extent* out)
+    {
+        auto range = m_index.equal_range(key.hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            const Entry& entry = *it->second;
+            if (Matches(entry, key)) {
+                m_entries.splice(m_entries.begin(), m_entries, it->second);
+                *out = entry.extent;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void
+    Store(const wxd_text_extent::Key& key, const wxd_text_extent::Extent& extent)
+    {
+        if (capacity == 0)
+            return;
+        while (m_entries.size() >= capacity)
+            PopBack();
+        m_entries.push_front(Entry{ key, std::string(key.text, key.len), extent });
+        Entry& entry = m_entries.front();
+        entry.key.text = entry.bytes.data();
+        m_index.emplace(key.hash, m_entries.begin());
+        m_bytes += EntryBytes(entry);
+    }
+
+    void
+    Clear()
+    {
+        m_index.clear();
+        m_entries.clear();
+        m_bytes = 0;
+    }
+
+    size_t
+    CacheBytes() const override
+    {
+        return m_bytes;
+    }
+
+    size_t
+    CacheEntries() const override
+    {
+        return m_entries.size();
+    }
+
+    void
+    Trim(wxd_TrimLevel level) override
+    {
+        const size_t keep = level == WXD_TRIM_MODERATE ? m_entries.size() / 2 : 0;
+        while (m_entries.size() > keep)
+            PopBack();
+    }
+
+private:
+    // The entry, its list node and index node, and the text.
+    static size_t
+    EntryBytes(const Entry& entry)
+    {
+        return sizeof(Entry) + 4 * sizeof(void*) + entry.bytes.capacity();
+    }
+
+    void
+    PopBack()
+    {
+        m_bytes -= EntryBytes(m_entries.back());
+        EraseIndex(m_entries.back());
+        m_entries.pop_back();
+    }
+
+    static bool
+    Matches(const Entry& entry, const wxd_text_extent::Key& key)
+    {
+        const wxd_text_extent::Key& k = entry.key;
+        return k.face == key.face && k.point_size == key.point_size && k.traits == key.traits &&
+               k.scale_x == key.scale_x && k.scale_y == key.scale_y && k.len == key.len &&
+               (key.len == 0 || std::memcmp(k.text, key.text, key.len) == 0);
+    }
+
+    void
+    EraseIndex(const Entry& entry)
+    {
+        auto range = m_index.equal_range(entry.key.hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (&*it->second == &entry) {
+                m_index.erase(it);
+                return;
+            }
+        }
+    }
+
+    std::list<Entry> m_entries;
+    std::unordered_multimap<uint64_t, std::list<Entry>::iterator> m_index;
+    size_t m_bytes = 0;
+};
+
+ExtentCache&
+cache()
+{
+    static ExtentCache instance;
+    return instance;
+}
+
+uint64_t
+mix(uint64_t hash, uint64_t value)
+{
+    hash ^= value + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+uint64_t
+fnv1a(const char* bytes, size_t len)
+{
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < len; ++i) {
+        hash = (hash ^ static_cast<unsigned char>(bytes[i])) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+uint64_t
+fnv1a(const wxScopedCharBuffer& utf8)
+{
+    return fnv1a(utf8.data(), utf8.length());
+}
+
+uint64_t
+double_bits(double value)
+{
+    uint64_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+} // namespace
+
+namespace wxd_text_extent {
+
+bool
+enabled()
+{
+    return cache().capacity > 0;
+}
+
+Key
+make_key(const wxFont& font, double scale_x, double scale_y, const char* utf8, size_t len)
+{
+    Key key;
+    // The font is identified by its properties: its ref data can be freed and its address
+    // reused by a different face.
+    key.face = font.IsOk() ? fnv1a(font.GetFaceName().utf8_str()) : 0;
+    key.point_size = font.IsOk() ? font.GetFractionalPointSize() : 0;
+    key.traits = font.IsOk() ? font.GetNumericWeight() | font.GetStyle() << 12 |
+                                   font.GetFamily() << 16 | font.GetUnderlined() << 24
+                             : 0;
+    key.scale_x = scale_x;
+    key.scale_y = scale_y;
+    key.text = utf8;
+    key.len = len;
+
+    uint64_t hash = fnv1a(utf8, len);
+    hash = mix(hash, key.face);
+    hash = mix(hash, double_bits(key.point_size));
+    hash = mix(hash, static_cast<uint64_t>(key.traits));
+    hash = mix(hash, double_bits(scale_x));
+    key.hash = mix(hash, double_bits(scale_y));
+    return key;
+}
+
+bool
+lookup(const Key& key, Extent* out)
+{
+    return cache().Lookup(key, out);
+}
+
+void
+store(const Key& key, const Extent& extent)
+{
+    cache().Store(key, extent);
+}
+
+} // namespace wxd_text_extent
+
+WXD_EXPORTED void
+wxd_TextExtentCache_SetCapacity(size_t entries)
+{
+    ExtentCache& c = cache();
+    c.capacity = entries;
+    c.Clear();
+}
+
+WXD_EXPORTED void
+wxd_TextExtentCache_Clear(void)
+{
+    cache().Clear();
+}
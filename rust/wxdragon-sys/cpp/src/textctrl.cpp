@@ -5,8 +5,68 @@
 #endif
 
 #include "wx/textctrl.h"
+#include "wx/wupdlock.h"
 #include "wxdragon.h"
 #include "wxd_utils.h"
+#include "wxd_logconsole.h"
+
+namespace {
+
+class TextCtrlConsole : public wxdLogConsole {
+public:
+    explicit TextCtrlConsole(wxTextCtrl* ctrl) : wxdLogConsole(ctrl), m_ctrl(ctrl) {}
+
+protected:
+    int
+    GetLineCount() const override
+    {
+        const int lines = m_ctrl->GetNumberOfLines();
+        return lines > 1 && m_ctrl->GetLineLength(lines - 1) == 0 ? lines - 1 : lines;
+    }
+
+    void
+    AppendUtf8(const std::string& text) override
+    {
+        // AppendText moves the insertion point to the end; keep it where the user left it.
+        const long caret = m_ctrl->GetInsertionPoint();
+        const bool at_end = caret == m_ctrl->GetLastPosition();
+        m_ctrl->AppendText(wxString::FromUTF8(text.data(), text.size()));
+        if (!at_end)
+            m_ctrl->SetInsertionPoint(caret);
+    }
+
+    void
+    RemoveHeadLines(int lines) override
+    {
+        const long end = m_ctrl->XYToPosition(0, lines);
+        if (end > 0)
+            m_ctrl->Remove(0, end);
+    }
+
+    void
+    ClearText() override
+    {
+        m_ctrl->ChangeValue(wxEmptyString);
+    }
+
+    bool
+    IsCaretAtEnd() const override
+    {
+        return m_ctrl->GetInsertionPoint() == m_ctrl->GetLastPosition();
+    }
+
+    void
+    ScrollToEnd() override
+    {
+        m_ctrl->SetInsertionPointEnd();
+        m_ctrl->ShowPosition(m_ctrl->GetLastPosition());
+    }
+
+private:
+    wxTextCtrl* m_ctrl;
+};
+
+} // namespace
 
 extern "C" {
 
@@ -17,7 +77,8 @@ wxd_TextCtrl_Create(wxd_Window_t* parent, wxd_Id id, const char* value, wxd_Poin
 {
     wxWindow* parentWin = (wxWindow*)parent;
     wxTextCtrl* ctrl = new wxTextCtrl(parentWin, id, wxString::FromUTF8(value ? value : ""),
-                                      wxd_cpp_utils::to_wx(pos), wxd_cpp_utils::to_wx(size), style);
+                                      wxd_cpp_utils::to_wx(pos, parentWin),
+                                      wxd_cpp_utils::to_wx(size, parentWin), style);
     return (wxd_TextCtrl_t*)ctrl;
 }
 
@@ -42,6 +103,14 @@ wxd_TextCtrl_GetValue(wxd_TextCtrl_t* textCtrl, char* buffer, int buffer_len)
     return wxd_cpp_utils::copy_wxstring_to_buffer(value, buffer, (size_t)buffer_len);
 }
 
+WXD_EXPORTED wxd_String_t*
+wxd_TextCtrl_GetValueOwned(wxd_TextCtrl_t* textCtrl)
+{
+    if (!textCtrl)
+        return nullptr;
+    return wxd_cpp_utils::make_owned_string(((wxTextCtrl*)textCtrl)->GetValue());
+}
+
 // Append text to the wxTextCtrl
 WXD_EXPORTED void
 wxd_TextCtrl_AppendText(wxd_TextCtrl_t* textCtrl, const char* text)
@@ -52,6 +121,46 @@ wxd_TextCtrl_AppendText(wxd_TextCtrl_t* textCtrl, const char* text)
     }
 }
 
+WXD_EXPORTED void
+wxd_TextCtrl_SetConsoleMode(wxd_TextCtrl_t* textCtrl, bool enable, int max_lines)
+{
+    wxTextCtrl* ctrl = (wxTextCtrl*)textCtrl;
+    if (!ctrl)
+        return;
+    if (!enable) {
+        wxdLogConsole::Detach(ctrl);
+        return;
+    }
+    wxdLogConsole* console = wxdLogConsole::Get(ctrl);
+    if (!console) {
+        console = new TextCtrlConsole(ctrl);
+        wxdLogConsole::Attach(console);
+    }
+    console->SetMaxLines(max_lines);
+}
+
+WXD_EXPORTED void
+wxd_TextCtrl_ConsoleAppend(wxd_TextCtrl_t* textCtrl, const char* text, size_t len)
+{
+    wxTextCtrl* ctrl = (wxTextCtrl*)textCtrl;
+    if (!ctrl || !text || len == 0)
+        return;
+    if (wxdLogConsole* console = wxdLogConsole::Get(ctrl))
+        console->Append(text, len);
+    else
+        ctrl->AppendText(wxString::FromUTF8(text, len));
+}
+
+WXD_EXPORTED void
+wxd_TextCtrl_ConsoleFlush(wxd_TextCtrl_t* textCtrl)
+{
+    wxTextCtrl* ctrl = (wxTextCtrl*)textCtrl;
+    if (!ctrl)
+        return;
+    if (wxdLogConsole* console = wxdLogConsole::Get(ctrl))
+        console->Flush();
+}
+
 // Clear the wxTextCtrl contents
 WXD_EXPORTED void
 wxd_TextCtrl_Clear(wxd_TextCtrl_t* textCtrl)
@@ -423,6 +532,43 @@ wxd_TextCtrl_SetStyle(wxd_TextCtrl_t* textCtrl, wxd_Long_t start, wxd_Long_t end
     }
 }
 
+WXD_EXPORTED size_t
+wxd_TextCtrl_SetStyleRuns(wxd_TextCtrl_t* textCtrl, const wxd_TextStyleRun* runs, size_t count,
+                          const wxd_TextAttr_t* const* palette, size_t palette_len)
+{
+    wxTextCtrl* ctrl = reinterpret_cast<wxTextCtrl*>(textCtrl);
+    if (!ctrl || !runs || !palette || count == 0)
+        return 0;
+
+    // Native controls may move the caret or scroll while styling a range.
+    long sel_from = 0, sel_to = 0;
+    ctrl->GetSelection(&sel_from, &sel_to);
+    const long insertion = ctrl->GetInsertionPoint();
+    const bool multiline = ctrl->IsMultiLine();
+    const int scroll_pos = multiline ? ctrl->GetScrollPos(wxVERTICAL) : 0;
+
+    size_t applied = 0;
+    {
+        wxWindowUpdateLocker freeze(ctrl);
+        for (size_t i = 0; i < count; ++i) {
+            const wxd_TextStyleRun& run = runs[i];
+            if (run.attr >= palette_len || !palette[run.attr] || run.end <= run.start)
+                continue;
+            if (ctrl->SetStyle(static_cast<long>(run.start), static_cast<long>(run.end),
+                               *reinterpret_cast<const wxTextAttr*>(palette[run.attr])))
+                ++applied;
+        }
+
+        if (sel_from != sel_to)
+            ctrl->SetSelection(sel_from, sel_to);
+        else
+            ctrl->SetInsertionPoint(insertion);
+        if (multiline && ctrl->GetScrollPos(wxVERTICAL) != scroll_pos)
+            ctrl->ScrollLines(scroll_pos - ctrl->GetScrollPos(wxVERTICAL));
+    }
+    return applied;
+}
+
 WXD_EXPORTED wxd_TextAttr_t*
 wxd_TextCtrl_GetDefaultStyle(wxd_TextCtrl_t* textCtrl)
 {
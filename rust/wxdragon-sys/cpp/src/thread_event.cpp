@@ -0,0 +1,105 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_thread_event.h"
+#include <wx/tracker.h>
+#include <mutex>
+#include <unordered_map>
+
+wxDEFINE_EVENT(wxdEVT_THREAD_MESSAGE, wxdThreadMessageEvent);
+
+namespace {
+
+class LivenessNode;
+
+// Handlers that may receive thread messages, keyed by address. Worker threads queue under the
+// lock, so an entry is only removed while no event is being queued to it.
+std::mutex s_live_mutex;
+std::unordered_map<wxEvtHandler*, LivenessNode*> s_live_handlers;
+
+// Removes its handler from s_live_handlers when the handler is destroyed. Windows leave the
+// table earlier, from wxEVT_DESTROY, before any of their destructors run.
+class LivenessNode : public wxTrackerNode {
+public:
+    explicit LivenessNode(wxEvtHandler* handler) : m_handler(handler) {}
+
+    void
+    OnObjectDestroy() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(s_live_mutex);
+            auto found = s_live_handlers.find(m_handler);
+            if (found != s_live_handlers.end() && found->second == this)
+                s_live_handlers.erase(found);
+        }
+        delete this;
+    }
+
+private:
+    wxEvtHandler* m_handler;
+};
+
+void
+on_thread_target_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    wxEvtHandler* handler = static_cast<wxEvtHandler*>(event.GetEventObject());
+    std::lock_guard<std::mutex> lock(s_live_mutex);
+    s_live_handlers.erase(handler);
+}
+
+} // namespace
+
+extern "C" {
+
+WXD_EXPORTED bool
+wxd_EvtHandler_EnableThreadEvents(wxd_EvtHandler_t* handler)
+{
+    wxEvtHandler* target = reinterpret_cast<wxEvtHandler*>(handler);
+    if (!target)
+        return false;
+    {
+        std::lock_guard<std::mutex> lock(s_live_mutex);
+        if (s_live_handlers.count(target))
+            return true;
+    }
+    LivenessNode* node = new LivenessNode(target);
+    target->AddNode(node);
+    if (wxWindow* window = wxDynamicCast(target, wxWindow)) {
+        if (window->IsBeingDeleted()) {
+            target->RemoveNode(node);
+            delete node;
+            return false;
+        }
+        window->Bind(wxEVT_DESTROY, &on_thread_target_destroy);
+    }
+    std::lock_guard<std::mutex> lock(s_live_mutex);
+    s_live_handlers[target] = node;
+    return true;
+}
+
+WXD_EXPORTED bool
+wxd_EvtHandler_QueueThreadEvent(wxd_EvtHandler_t* handler, int32_t kind, void* payload,
+                                void (*drop_fn)(void*))
+{
+    auto shared = std::make_shared<wxdThreadPayload>(payload, drop_fn);
+    wxEvtHandler* target = reinterpret_cast<wxEvtHandler*>(handler);
+    {
+        std::lock_guard<std::mutex> lock(s_live_mutex);
+        if (target && s_live_handlers.count(target)) {
+            wxQueueEvent(target, new wxdThreadMessageEvent(wxdEVT_THREAD_MESSAGE, kind,
+                                                           std::move(shared)));
+            return true;
+        }
+    }
+    return false; // `shared` drops the payload outside the lock
+}
+
+WXD_EXPORTED bool
+wxd_EvtHandler_AcceptsThreadEvents(wxd_EvtHandler_t* handler)
+{
+    std::lock_guard<std::mutex> lock(s_live_mutex);
+    return handler && s_live_handlers.count(reinterpret_cast<wxEvtHandler*>(handler)) != 0;
+}
+
+} // extern "C"
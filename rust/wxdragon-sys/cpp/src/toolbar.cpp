@@ -3,6 +3,9 @@
 #include "../include/wxdragon.h"
 #include <wx/toolbar.h>
 #include <wx/bmpbndl.h>
+#include "wxd_toolbar_bulk.h"
+#include <memory>
+#include <unordered_map>
 
 // Helper to create a wxBitmapBundle from optional wxd_Bitmap_t pointers
 wxBitmapBundle
@@ -25,6 +28,75 @@ CreateBundle(const wxd_Bitmap_t* bmpNormal, const wxd_Bitmap_t* bmpDisabled)
     // For now, returning bundle from just the normal bitmap is simplest.
 }
 
+namespace {
+
+struct ToolBarOps {
+    using Item = wxToolBarToolBase*;
+
+    wxToolBar* tb;
+
+    size_t
+    Count() const
+    {
+        return tb->GetToolsCount();
+    }
+    Item
+    At(size_t pos) const
+    {
+        return const_cast<wxToolBarToolBase*>(tb->GetToolByPos(static_cast<int>(pos)));
+    }
+    bool
+    Same(Item a, Item b) const
+    {
+        return a == b;
+    }
+    int
+    Id(Item item) const
+    {
+        return item->GetId();
+    }
+    Item
+    Remove(size_t pos)
+    {
+        return tb->RemoveTool(At(pos)->GetId());
+    }
+    void
+    Insert(size_t pos, Item item)
+    {
+        tb->InsertTool(pos, item);
+    }
+    void
+    Realize()
+    {
+        tb->Realize();
+    }
+    // A removed tool belongs to whoever removed it.
+    void
+    Discard(Item item)
+    {
+        delete item;
+    }
+};
+
+using HiddenToolBarTools = wxd_toolbar_bulk::HiddenTools<ToolBarOps>;
+
+std::unordered_map<wxToolBar*, std::unique_ptr<HiddenToolBarTools>>&
+hidden_tools()
+{
+    static std::unordered_map<wxToolBar*, std::unique_ptr<HiddenToolBarTools>> map;
+    return map;
+}
+
+void
+on_toolbar_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    if (wxToolBar* tb = wxDynamicCast(event.GetEventObject(), wxToolBar))
+        hidden_tools().erase(tb);
+}
+
+} // namespace
+
 WXD_EXPORTED wxd_ToolBar_t*
 wxd_ToolBar_Create(wxd_Window_t* parent, wxd_Id id, wxd_Point pos, wxd_Size size, wxd_Style_t style)
 {
@@ -185,4 +257,61 @@ wxd_ToolBar_AddToolWithBundles(wxd_ToolBar_t* toolbar, wxd_Id id, const char* la
                                           wxITEM_NORMAL, wx_shortHelp, wx_longHelp);
 
     return tool != nullptr;
-}
\ No newline at end of file
+}
+
+WXD_EXPORTED size_t
+wxd_ToolBar_AddTools(wxd_ToolBar_t* self, const wxd_ToolDesc* tools, size_t count)
+{
+    wxToolBar* tb = reinterpret_cast<wxToolBar*>(self);
+    if (!tb || !tools)
+        return 0;
+    wxd_toolbar_bulk::BundleCache bundles;
+    size_t added = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const wxd_ToolDesc& desc = tools[i];
+        wxToolBarToolBase* tool = nullptr;
+        if (desc.kind == WXD_ITEM_SEPARATOR) {
+            tool = tb->AddSeparator();
+        }
+        else {
+            tool = tb->AddTool(desc.id, wxd_toolbar_bulk::utf8(desc.label),
+                               bundles.Get(desc.bundle, desc.bitmap),
+                               bundles.Get(desc.bundle_disabled, desc.bitmap_disabled),
+                               wxd_toolbar_bulk::item_kind(desc.kind),
+                               wxd_toolbar_bulk::utf8(desc.short_help),
+                               wxd_toolbar_bulk::utf8(desc.long_help));
+        }
+        if (tool)
+            ++added;
+    }
+    tb->Realize();
+    return added;
+}
+
+WXD_EXPORTED size_t
+wxd_ToolBar_SetToolsVisible(wxd_ToolBar_t* self, const wxd_Id* ids, const bool* visible,
+                            size_t count)
+{
+    wxToolBar* tb = reinterpret_cast<wxToolBar*>(self);
+    if (!tb || !ids || !visible)
+        return 0;
+    auto& map = hidden_tools();
+    auto it = map.find(tb);
+    if (it == map.end()) {
+        tb->Bind(wxEVT_DESTROY, on_toolbar_destroy);
+        it = map.emplace(tb, std::make_unique<HiddenToolBarTools>(ToolBarOps{ tb })).first;
+    }
+    return it->second->Apply(ids, visible, count);
+}
+
+WXD_EXPORTED bool
+wxd_ToolBar_IsToolVisible(wxd_ToolBar_t* self, wxd_Id toolId)
+{
+    wxToolBar* tb = reinterpret_cast<wxToolBar*>(self);
+    if (!tb)
+        return false;
+    auto it = hidden_tools().find(tb);
+    if (it != hidden_tools().end() && it->second->IsHidden(toolId))
+        return false;
+    return tb->FindById(toolId) != nullptr;
+}
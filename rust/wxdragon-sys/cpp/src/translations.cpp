@@ -5,6 +5,15 @@
 #include <wx/intl.h>
 #include <wx/uilocale.h>
 #include <wx/arrstr.h>
+#include "wxd_mapped_catalog.h"
+#include "wxd_resource_bundle.h"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 // A wxTranslationsLoader that forwards to Rust callbacks. The C++ side is a
 // dumb trampoline: it only builds the wxWidgets objects the callbacks cannot
@@ -74,6 +83,209 @@ private:
     void* m_user_data;
 };
 
+
+// --- Interned message ids ---
+//
+// Rust interns each msgid once and keeps the returned integer. Every
+// wxTranslations instance then owns a flat table, indexed by that id, of
+// translations already converted to UTF-8, so a lookup is an array index
+// instead of two string conversions and a catalog hash lookup. Tables are
+// rebuilt when the language or the loaded catalogs change. Like the rest of
+// wxTranslations, all of this is GUI-thread only.
+namespace {
+
+struct InternedMsgId
+{
+    wxString msgid;
+    wxString plural;
+    wxString domain;
+    std::string msgid_utf8;
+    std::string plural_utf8;
+    bool is_plural;
+};
+
+std::vector<InternedMsgId>& interned_msgids()
+{
+    static std::vector<InternedMsgId> ids;
+    return ids;
+}
+
+std::unordered_map<std::string, int>& interned_msgid_index()
+{
+    static std::unordered_map<std::string, int> index;
+    return index;
+}
+
+struct TranslationCache
+{
+    // Slice of `text` holding the translation for each id; offset -1 means
+    // the catalog has no translation. Ids interned after the last rebuild
+    // are resolved lazily on first lookup.
+    struct Slot
+    {
+        int offset;
+        int len;
+    };
+    std::string text;
+    std::vector<Slot> slots;
+    // Plural translations depend on n, so they are cached by the catalog
+    // entry wxWidgets returns for the chosen form.
+    std::unordered_map<const wxString*, std::string> plural_forms;
+};
+
+std::unordered_map<wxTranslations*, TranslationCache>& translation_caches()
+{
+    static std::unordered_map<wxTranslations*, TranslationCache> caches;
+    return caches;
+}
+
+// --- Memory-mapped catalogs ---
+//
+// .mo files added with AddMappedCatalog are not handed to wxTranslations
+// (whose wxMsgCatalog parses every message into a hash map up front) but kept
+// mapped per instance and consulted before it, newest first. Lookups convert
+// nothing: the UTF-8 bytes are copied straight out of the mapping.
+
+struct MappedCatalogEntry
+{
+    std::string domain;
+    std::unique_ptr<wxdMappedCatalog> catalog;
+};
+
+std::unordered_map<wxTranslations*, std::vector<MappedCatalogEntry>>& mapped_catalogs()
+{
+    static std::unordered_map<wxTranslations*, std::vector<MappedCatalogEntry>> catalogs;
+    return catalogs;
+}
+
+// An empty domain searches every mapped catalog, like wxTranslations does.
+bool find_mapped(wxTranslations* translations, std::string_view domain,
+                 std::string_view msgid, const unsigned* n, std::string_view* out)
+{
+    auto it = mapped_catalogs().find(translations);
+    if (it == mapped_catalogs().end())
+        return false;
+    for (auto entry = it->second.rbegin(); entry != it->second.rend(); ++entry) {
+        if (!domain.empty() && entry->domain != domain)
+            continue;
+        if (n ? entry->catalog->FindPlural(msgid, *n, out)
+              : entry->catalog->Find(msgid, out))
+            return true;
+    }
+    return false;
+}
+
+bool has_mapped_domain(wxTranslations* translations, std::string_view domain)
+{
+    auto it = mapped_catalogs().find(translations);
+    return it != mapped_catalogs().end() &&
+           std::any_of(it->second.begin(), it->second.end(),
+                       [domain](const MappedCatalogEntry& e) { return e.domain == domain; });
+}
+
+int copy_utf8_to_buffer(std::string_view text, char* buffer, size_t buffer_len)
+{
+    if (buffer && buffer_len > 0) {
+        const size_t n = std::min(text.size(), buffer_len - 1);
+        std::memcpy(buffer, text.data(), n);
+        buffer[n] = '\0';
+    }
+    return (int)text.size();
+}
+
+void resolve_slots(wxTranslations* translations, TranslationCache& cache,
+                   size_t upto)
+{
+    const std::vector<InternedMsgId>& ids = interned_msgids();
+    if (upto > ids.size())
+        upto = ids.size();
+    cache.slots.reserve(upto);
+    for (size_t i = cache.slots.size(); i < upto; ++i) {
+        const InternedMsgId& id = ids[i];
+        std::string_view mapped;
+        if (!id.is_plural &&
+            find_mapped(translations, id.domain.utf8_string(), id.msgid_utf8, nullptr, &mapped)) {
+            cache.slots.push_back({ (int)cache.text.size(), (int)mapped.size() });
+            cache.text.append(mapped.data(), mapped.size());
+            continue;
+        }
+        const wxString* result =
+            id.is_plural ? nullptr
+                         : translations->GetTranslatedString(id.msgid, id.domain);
+        if (!result) {
+            cache.slots.push_back({ -1, 0 });
+            continue;
+        }
+        const wxScopedCharBuffer utf8 = result->utf8_str();
+        cache.slots.push_back({ (int)cache.text.size(), (int)utf8.length() });
+        cache.text.append(utf8.data(), utf8.length());
+    }
+}
+
+// Throw away and eagerly refill the table after anything that can change
+// lookup results (language switch, catalog load). Instances that have never
+// been queried by id have no table and are left alone.
+void rebuild_translation_cache(wxTranslations* translations)
+{
+    auto it = translation_caches().find(translations);
+    if (it == translation_caches().end())
+        return;
+    TranslationCache& cache = it->second;
+    cache.text.clear();
+    cache.slots.clear();
+    cache.plural_forms.clear();
+    resolve_slots(translations, cache, interned_msgids().size());
+}
+
+// Forget everything kept for an instance that is being deleted.
+void drop_translation_cache(wxTranslations* translations)
+{
+    translation_caches().erase(translations);
+    mapped_catalogs().erase(translations);
+}
+
+bool add_mapped_catalog(wxTranslations* translations, const char* domain,
+                        std::unique_ptr<wxdMappedCatalog> catalog)
+{
+    if (!catalog)
+        return false;
+    mapped_catalogs()[translations].push_back({ domain, std::move(catalog) });
+    rebuild_translation_cache(translations);
+    return true;
+}
+
+int intern_msgid(const char* msgid, const char* plural, const char* domain)
+{
+    std::string key(domain ? domain : "");
+    key += '\x04';
+    key += msgid;
+    if (plural) {
+        key += '\0';
+        key += plural;
+    }
+
+    std::unordered_map<std::string, int>& index = interned_msgid_index();
+    auto it = index.find(key);
+    if (it != index.end())
+        return it->second;
+
+    std::vector<InternedMsgId>& ids = interned_msgids();
+    InternedMsgId id;
+    id.msgid = wxString::FromUTF8(msgid);
+    id.plural = wxString::FromUTF8(plural ? plural : "");
+    id.domain = wxString::FromUTF8(domain ? domain : "");
+    id.msgid_utf8 = msgid;
+    id.plural_utf8 = plural ? plural : "";
+    id.is_plural = plural != nullptr;
+    ids.push_back(std::move(id));
+
+    const int result = (int)ids.size() - 1;
+    index.emplace(std::move(key), result);
+    return result;
+}
+
+} // namespace
+
 extern "C" {
 
 wxd_Translations_t*
@@ -87,6 +299,10 @@ wxd_Translations_Set(wxd_Translations_t* translations)
 {
     wxTranslations* wx_translations =
         reinterpret_cast<wxTranslations*>(translations);
+    // wxTranslations::Set deletes the previous global instance.
+    wxTranslations* previous = wxTranslations::Get();
+    if (previous && previous != wx_translations)
+        drop_translation_cache(previous);
     wxTranslations::Set(wx_translations);
 }
 
@@ -104,6 +320,7 @@ wxd_Translations_Destroy(wxd_Translations_t* translations)
         return;
     wxTranslations* wx_translations =
         reinterpret_cast<wxTranslations*>(translations);
+    drop_translation_cache(wx_translations);
     delete wx_translations;
 }
 
@@ -115,6 +332,7 @@ wxd_Translations_SetLanguage(wxd_Translations_t* translations, int lang)
     wxTranslations* wx_translations =
         reinterpret_cast<wxTranslations*>(translations);
     wx_translations->SetLanguage(static_cast<wxLanguage>(lang));
+    rebuild_translation_cache(wx_translations);
 }
 
 void
@@ -126,6 +344,7 @@ wxd_Translations_SetLanguageStr(wxd_Translations_t* translations,
     wxTranslations* wx_translations =
         reinterpret_cast<wxTranslations*>(translations);
     wx_translations->SetLanguage(wxString::FromUTF8(lang ? lang : ""));
+    rebuild_translation_cache(wx_translations);
 }
 
 bool
@@ -137,8 +356,11 @@ wxd_Translations_AddCatalog(wxd_Translations_t* translations,
         return false;
     wxTranslations* wx_translations =
         reinterpret_cast<wxTranslations*>(translations);
-    return wx_translations->AddCatalog(wxString::FromUTF8(domain),
-                                       static_cast<wxLanguage>(msg_id_language));
+    const bool loaded = wx_translations->AddCatalog(
+        wxString::FromUTF8(domain), static_cast<wxLanguage>(msg_id_language));
+    if (loaded)
+        rebuild_translation_cache(wx_translations);
+    return loaded;
 }
 
 bool
@@ -148,7 +370,10 @@ wxd_Translations_AddStdCatalog(wxd_Translations_t* translations)
         return false;
     wxTranslations* wx_translations =
         reinterpret_cast<wxTranslations*>(translations);
-    return wx_translations->AddStdCatalog();
+    const bool loaded = wx_translations->AddStdCatalog();
+    if (loaded)
+        rebuild_translation_cache(wx_translations);
+    return loaded;
 }
 
 bool
@@ -158,7 +383,8 @@ wxd_Translations_IsLoaded(wxd_Translations_t* translations, const char* domain)
         return false;
     wxTranslations* wx_translations =
         reinterpret_cast<wxTranslations*>(translations);
-    return wx_translations->IsLoaded(wxString::FromUTF8(domain));
+    return has_mapped_domain(wx_translations, domain) ||
+           wx_translations->IsLoaded(wxString::FromUTF8(domain));
 }
 
 int
@@ -174,6 +400,10 @@ wxd_Translations_GetTranslatedString(wxd_Translations_t* translations,
     wxTranslations* wx_translations =
         reinterpret_cast<wxTranslations*>(translations);
 
+    std::string_view mapped;
+    if (find_mapped(wx_translations, domain ? domain : "", orig, nullptr, &mapped))
+        return copy_utf8_to_buffer(mapped, buffer, buffer_len);
+
     wxString wx_domain;
     if (domain && domain[0] != '\0') {
         wx_domain = wxString::FromUTF8(domain);
@@ -205,6 +435,10 @@ wxd_Translations_GetTranslatedPluralString(wxd_Translations_t* translations,
     wxTranslations* wx_translations =
         reinterpret_cast<wxTranslations*>(translations);
 
+    std::string_view mapped;
+    if (find_mapped(wx_translations, domain ? domain : "", singular, &n, &mapped))
+        return copy_utf8_to_buffer(mapped, buffer, buffer_len);
+
     wxString wx_domain;
     if (domain && domain[0] != '\0') {
         wx_domain = wxString::FromUTF8(domain);
@@ -231,6 +465,100 @@ wxd_Translations_GetTranslatedPluralString(wxd_Translations_t* translations,
                                                        buffer_len);
 }
 
+int
+wxd_Translations_InternMsgId(const char* msgid, const char* domain)
+{
+    if (!msgid)
+        return -1;
+    return intern_msgid(msgid, nullptr, domain);
+}
+
+int
+wxd_Translations_InternPluralMsgId(const char* singular,
+                                   const char* plural,
+                                   const char* domain)
+{
+    if (!singular || !plural)
+        return -1;
+    return intern_msgid(singular, plural, domain);
+}
+
+const char*
+wxd_Translations_GetMsgIdString(int id, bool plural, size_t* out_len)
+{
+    const std::vector<InternedMsgId>& ids = interned_msgids();
+    if (id < 0 || (size_t)id >= ids.size())
+        return nullptr;
+    const InternedMsgId& entry = ids[id];
+    const std::string& s =
+        plural && entry.is_plural ? entry.plural_utf8 : entry.msgid_utf8;
+    if (out_len)
+        *out_len = s.size();
+    return s.c_str();
+}
+
+const char*
+wxd_Translations_GetTranslatedStringById(wxd_Translations_t* translations,
+                                         int id,
+                                         size_t* out_len)
+{
+    if (!translations || id < 0 || (size_t)id >= interned_msgids().size())
+        return nullptr;
+
+    wxTranslations* wx_translations =
+        reinterpret_cast<wxTranslations*>(translations);
+    TranslationCache& cache = translation_caches()[wx_translations];
+    if ((size_t)id >= cache.slots.size())
+        resolve_slots(wx_translations, cache, (size_t)id + 1);
+
+    const TranslationCache::Slot& slot = cache.slots[id];
+    if (slot.offset < 0)
+        return nullptr;
+    if (out_len)
+        *out_len = (size_t)slot.len;
+    return cache.text.data() + slot.offset;
+}
+
+const char*
+wxd_Translations_GetTranslatedPluralStringById(wxd_Translations_t* translations,
+                                               int id,
+                                               unsigned int n,
+                                               size_t* out_len)
+{
+    const std::vector<InternedMsgId>& ids = interned_msgids();
+    if (!translations || id < 0 || (size_t)id >= ids.size())
+        return nullptr;
+    const InternedMsgId& entry = ids[id];
+    if (!entry.is_plural)
+        return nullptr;
+
+    wxTranslations* wx_translations =
+        reinterpret_cast<wxTranslations*>(translations);
+    std::string_view mapped;
+    if (find_mapped(wx_translations, entry.domain.utf8_string(), entry.msgid_utf8, &n,
+                    &mapped)) {
+        if (out_len)
+            *out_len = mapped.size();
+        return mapped.data();
+    }
+    const wxString* result =
+        wx_translations->GetTranslatedString(entry.msgid, n, entry.domain);
+    if (!result)
+        return nullptr;
+
+    TranslationCache& cache = translation_caches()[wx_translations];
+    auto it = cache.plural_forms.find(result);
+    if (it == cache.plural_forms.end()) {
+        const wxScopedCharBuffer utf8 = result->utf8_str();
+        it = cache.plural_forms
+                 .emplace(result, std::string(utf8.data(), utf8.length()))
+                 .first;
+    }
+    if (out_len)
+        *out_len = it->second.size();
+    return it->second.c_str();
+}
+
 int
 wxd_Translations_GetHeaderValue(wxd_Translations_t* translations,
                                 const char* header,
@@ -331,6 +659,32 @@ wxd_Translations_SetRustLoader(wxd_Translations_t* translations,
         new WxdRustTranslationsLoader(vtable, user_data));
 }
 
+bool
+wxd_Translations_AddMappedCatalog(wxd_Translations_t* translations,
+                                  const char* domain,
+                                  const char* path)
+{
+    if (!translations || !domain || !path)
+        return false;
+    return add_mapped_catalog(reinterpret_cast<wxTranslations*>(translations), domain,
+                              wxdMappedCatalog::FromFile(wxString::FromUTF8(path)));
+}
+
+bool
+wxd_Translations_AddMappedCatalogFromResource(wxd_Translations_t* translations,
+                                              const char* domain,
+                                              const wxd_ResourceBundle_t* bundle,
+                                              const char* name)
+{
+    const uint8_t* data = nullptr;
+    size_t len = 0;
+    if (!translations || !domain || !wxd_ResourceBundle_Find(bundle, name, &data, &len))
+        return false;
+    return add_mapped_catalog(reinterpret_cast<wxTranslations*>(translations), domain,
+                              wxdMappedCatalog::FromData(data, len,
+                                                         wxd_resources::retain(bundle)));
+}
+
 void
 wxd_FileTranslationsLoader_AddCatalogLookupPathPrefix(const char* prefix)
 {
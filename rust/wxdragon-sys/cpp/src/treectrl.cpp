@@ -1,9 +1,19 @@
 #include <wx/wxprec.h>
 #include <wx/wx.h>
 #include "../include/wxdragon.h"
+#include "wxd_objstats.h"
 #include "../src/wxd_utils.h"
+#include "wxd_tree_subtree.h"
 #include <wx/treectrl.h>
 #include <wx/imaglist.h>
+#include <algorithm>
+#include <list>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 // Helper class that wraps a long value so it can be used with TreeCtrl's native SetItemData
 // which expects a wxTreeItemData pointer
@@ -17,11 +27,270 @@ public:
     {
         return m_value;
     }
+    void
+    SetValue(int64_t value)
+    {
+        m_value = value;
+    }
 
 private:
     int64_t m_value;
 };
 
+// Data of a node whose children are created on first expansion. The long value stays
+// available to wxd_TreeCtrl_SetItemData / GetItemData; `key` identifies the node to Rust.
+class LazyTreeItemData : public LongValueTreeItemData {
+public:
+    explicit LazyTreeItemData(int64_t key) : LongValueTreeItemData(0), key(key)
+    {
+    }
+
+    int64_t key;
+    bool populated = false;
+};
+
+// Tree control created by wxd_TreeCtrl_Create. While SortChildrenByKeys runs, items are
+// ordered by precomputed ranks instead of their labels. The class info tells wxMSW that
+// OnCompareItems is overridden.
+class WxdTreeCtrl : public wxTreeCtrl {
+public:
+    WxdTreeCtrl() = default;
+
+    WxdTreeCtrl(wxWindow* parent, wxWindowID id, const wxPoint& pos, const wxSize& size,
+                long style)
+        : wxTreeCtrl(parent, id, pos, size, style)
+    {
+    }
+
+    int
+    OnCompareItems(const wxTreeItemId& item1, const wxTreeItemId& item2) override
+    {
+        if (m_sortRanks.empty())
+            return wxTreeCtrl::OnCompareItems(item1, item2);
+        const auto a = m_sortRanks.find(item1.GetID());
+        const auto b = m_sortRanks.find(item2.GetID());
+        if (a == m_sortRanks.end() || b == m_sortRanks.end())
+            return 0;
+        return a->second < b->second ? -1 : (a->second > b->second ? 1 : 0);
+    }
+
+    // Sorts the children of every item in `parents` by the ranks of `items` (rank = position
+    // after a stable sort by key), all inside one Freeze/Thaw.
+    void
+    SortByRanks(const std::vector<wxTreeItemId>& parents, const std::vector<wxTreeItemId>& items,
+                const std::vector<size_t>& order)
+    {
+        m_sortRanks.reserve(items.size());
+        for (size_t rank = 0; rank < order.size(); ++rank)
+            m_sortRanks[items[order[rank]].GetID()] = rank;
+        Freeze();
+        for (const wxTreeItemId& parent : parents)
+            SortChildren(parent);
+        Thaw();
+        m_sortRanks.clear();
+    }
+
+private:
+    std::unordered_map<void*, size_t> m_sortRanks;
+
+    wxDECLARE_DYNAMIC_CLASS(WxdTreeCtrl);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(WxdTreeCtrl, wxTreeCtrl);
+
+namespace {
+
+class LazyTreeState;
+
+std::unordered_map<wxTreeCtrl*, std::unique_ptr<LazyTreeState>>&
+lazy_states()
+{
+    static std::unordered_map<wxTreeCtrl*, std::unique_ptr<LazyTreeState>> map;
+    return map;
+}
+
+LazyTreeItemData*
+lazy_data(wxTreeCtrl* tree, const wxTreeItemId& item)
+{
+    return dynamic_cast<LazyTreeItemData*>(tree->GetItemData(item));
+}
+
+// Per-tree lazy-children mode: fills a node from the Rust callback when it first expands and,
+// with a budget, releases the children of the least recently collapsed nodes again.
+class LazyTreeState {
+public:
+    explicit LazyTreeState(wxTreeCtrl* tree) : m_tree(tree)
+    {
+        m_tree->Bind(wxEVT_TREE_ITEM_EXPANDING, &LazyTreeState::OnExpanding, this);
+        m_tree->Bind(wxEVT_TREE_ITEM_COLLAPSED, &LazyTreeState::OnCollapsed, this);
+        m_tree->Bind(wxEVT_TREE_DELETE_ITEM, &LazyTreeState::OnDeleteItem, this);
+    }
+
+    ~LazyTreeState()
+    {
+        m_tree->Unbind(wxEVT_TREE_ITEM_EXPANDING, &LazyTreeState::OnExpanding, this);
+        m_tree->Unbind(wxEVT_TREE_ITEM_COLLAPSED, &LazyTreeState::OnCollapsed, this);
+        m_tree->Unbind(wxEVT_TREE_DELETE_ITEM, &LazyTreeState::OnDeleteItem, this);
+        if (m_userdata && m_free_userdata)
+            m_free_userdata(m_userdata);
+    }
+
+    void
+    Configure(void* userdata, wxd_treectrl_lazy_children_callback callback,
+              wxd_treectrl_free_userdata_callback free_userdata, size_t release_budget)
+    {
+        if (m_userdata && m_free_userdata)
+            m_free_userdata(m_userdata);
+        m_userdata = userdata;
+        m_callback = callback;
+        m_free_userdata = free_userdata;
+        m_budget = release_budget;
+    }
+
+    // Drops the children of `item` and marks it for refilling on the next expansion.
+    void
+    Reset(const wxTreeItemId& item, LazyTreeItemData& data)
+    {
+        Forget(item);
+        m_tree->CollapseAndReset(item);
+        data.populated = false;
+        m_tree->SetItemHasChildren(item, true);
+    }
+
+private:
+    struct Retained {
+        wxTreeItemId item;
+        size_t nodes;
+    };
+
+    void
+    OnExpanding(wxTreeEvent& event)
+    {
+        event.Skip();
+        const wxTreeItemId item = event.GetItem();
+        if (!item.IsOk())
+            return;
+        Forget(item);
+        LazyTreeItemData* data = lazy_data(m_tree, item);
+        if (data && !data->populated && m_callback)
+            Populate(item, *data);
+    }
+
+    void
+    OnCollapsed(wxTreeEvent& event)
+    {
+        event.Skip();
+        const wxTreeItemId item = event.GetItem();
+        LazyTreeItemData* data = item.IsOk() ? lazy_data(m_tree, item) : nullptr;
+        if (m_budget == 0 || !data || !data->populated || m_positions.count(item.GetID()))
+            return;
+        const size_t nodes = m_tree->GetChildrenCount(item, true);
+        m_positions[item.GetID()] = m_retained.insert(m_retained.end(), Retained{ item, nodes });
+        m_retained_nodes += nodes;
+        if (m_retained_nodes > m_budget && !m_trim_pending) {
+            // Deleting items from inside the collapse notification is not safe on every port.
+            m_trim_pending = true;
+            wxTreeCtrl* tree = m_tree;
+            tree->CallAfter([tree]() {
+                auto it = lazy_states().find(tree);
+                if (it != lazy_states().end())
+                    it->second->Trim();
+            });
+        }
+    }
+
+    void
+    OnDeleteItem(wxTreeEvent& event)
+    {
+        event.Skip();
+        if (event.GetItem().IsOk())
+            Forget(event.GetItem());
+    }
+
+    void
+    Populate(const wxTreeItemId& item, LazyTreeItemData& data)
+    {
+        data.populated = true;
+        wxd_TreeLazyChildren batch{};
+        if (!m_callback(m_userdata, data.key, reinterpret_cast<const wxd_TreeItemId_t*>(&item),
+                        &batch) ||
+            batch.count == 0 || !batch.offsets) {
+            m_tree->SetItemHasChildren(item, false);
+            return;
+        }
+        m_tree->Freeze();
+        for (size_t i = 0; i < batch.count; ++i) {
+            const uint32_t begin = batch.offsets[i];
+            const uint32_t end = std::max(batch.offsets[i + 1], begin);
+            const int image = batch.images ? batch.images[i] : -1;
+            const wxTreeItemId child = m_tree->AppendItem(
+                item,
+                wxd_cpp_utils::ScratchWxString(batch.text ? batch.text + begin : "", end - begin),
+                image, image, new LazyTreeItemData(batch.keys ? batch.keys[i] : 0));
+            if (child.IsOk() && batch.has_children && batch.has_children[i])
+                m_tree->SetItemHasChildren(child, true);
+        }
+        m_tree->Thaw();
+    }
+
+    void
+    Trim()
+    {
+        m_trim_pending = false;
+        while (m_retained_nodes > m_budget && !m_retained.empty()) {
+            const wxTreeItemId item = m_retained.front().item;
+            Forget(item);
+            LazyTreeItemData* data = lazy_data(m_tree, item);
+            if (data && !m_tree->IsExpanded(item))
+                Reset(item, *data);
+        }
+    }
+
+    void
+    Forget(const wxTreeItemId& item)
+    {
+        auto it = m_positions.find(item.GetID());
+        if (it == m_positions.end())
+            return;
+        m_retained_nodes -= it->second->nodes;
+        m_retained.erase(it->second);
+        m_positions.erase(it);
+    }
+
+    wxTreeCtrl* m_tree;
+    void* m_userdata = nullptr;
+    wxd_treectrl_lazy_children_callback m_callback = nullptr;
+    wxd_treectrl_free_userdata_callback m_free_userdata = nullptr;
+    size_t m_budget = 0;
+    // Collapsed, populated lazy nodes, least recently collapsed first.
+    std::list<Retained> m_retained;
+    std::unordered_map<void*, std::list<Retained>::iterator> m_positions;
+    size_t m_retained_nodes = 0;
+    bool m_trim_pending = false;
+};
+
+wxd_TreeItemHandle
+to_handle(const wxTreeItemId& item)
+{
+    return reinterpret_cast<wxd_TreeItemHandle>(item.GetID());
+}
+
+wxTreeItemId
+from_handle(wxd_TreeItemHandle handle)
+{
+    return wxTreeItemId(reinterpret_cast<void*>(handle));
+}
+
+void
+on_lazy_tree_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    if (wxTreeCtrl* tree = wxDynamicCast(event.GetEventObject(), wxTreeCtrl))
+        lazy_states().erase(tree);
+}
+
+} // namespace
+
 extern "C" {
 
 #define WXD_UNWRAP_TREE_CTRL(ptr) reinterpret_cast<wxTreeCtrl*>(ptr)
@@ -29,7 +298,8 @@ extern "C" {
 
 #define WXD_UNWRAP_WINDOW(ptr)       reinterpret_cast<wxWindow*>(ptr)
 #define WXD_UNWRAP_TREE_ITEM_ID(ptr) reinterpret_cast<wxTreeItemId*>(ptr)
-#define WXD_WRAP_TREE_ITEM_ID(ptr)   reinterpret_cast<wxd_TreeItemId_t*>(ptr)
+#define WXD_WRAP_TREE_ITEM_ID(ptr)                                                             \
+    reinterpret_cast<wxd_TreeItemId_t*>(wxd_objstats::track(WXD_OBJECT_KIND_TREE_ITEM_ID, ptr))
 
 // --- TreeCtrl ---
 WXD_EXPORTED wxd_TreeCtrl_t*
@@ -42,7 +312,7 @@ wxd_TreeCtrl_Create(wxd_Window_t* parent, int id, wxd_Point pos, wxd_Size size,
     wxPoint wxpos(pos.x, pos.y);
     wxSize wxsize(size.width, size.height);
 
-    wxTreeCtrl* ctrl = new wxTreeCtrl(p, id, wxpos, wxsize, style);
+    wxTreeCtrl* ctrl = new WxdTreeCtrl(p, id, wxpos, wxsize, style);
     return WXD_WRAP_TREE_CTRL(ctrl);
 }
 
@@ -72,7 +342,7 @@ wxd_TreeCtrl_AppendItem(wxd_TreeCtrl_t* self, wxd_TreeItemId_t* parent, const ch
     if (!parentId || !parentId->IsOk())
         return nullptr;
 
-    wxString wxText = wxString::FromUTF8(text ? text : "");
+    wxd_cpp_utils::ScratchWxString wxText(text);
     wxTreeItemId* id = new wxTreeItemId(ctrl->AppendItem(*parentId, wxText, image, selImage,
                                                          reinterpret_cast<wxTreeItemData*>(data)));
 
@@ -137,6 +407,7 @@ WXD_EXPORTED void
 wxd_TreeItemId_Free(wxd_TreeItemId_t* item_id)
 {
     wxTreeItemId* id = WXD_UNWRAP_TREE_ITEM_ID(item_id);
+    wxd_objstats::untrack(WXD_OBJECT_KIND_TREE_ITEM_ID, id);
     delete id;
 }
 
@@ -169,6 +440,12 @@ wxd_TreeCtrl_SetItemData(wxd_TreeCtrl_t* self, wxd_TreeItemId_t* item_id, int64_
     if (!tree || !id || !id->IsOk())
         return false;
 
+    // Lazy nodes keep their key; only the value changes.
+    if (LongValueTreeItemData* lazy = lazy_data(tree, *id)) {
+        lazy->SetValue(data);
+        return true;
+    }
+
     // If data is 0, just clear the item data
     if (data == 0) {
         tree->SetItemData(*id, nullptr);
@@ -346,6 +623,20 @@ wxd_TreeEvent_GetOldItem(wxd_Event_t* event)
     return WXD_WRAP_TREE_ITEM_ID(id);
 }
 
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeEvent_GetItemHandle(wxd_Event_t* event)
+{
+    wxTreeEvent* treeEvent = GetTreeEvent(event);
+    return treeEvent ? to_handle(treeEvent->GetItem()) : 0;
+}
+
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeEvent_GetOldItemHandle(wxd_Event_t* event)
+{
+    wxTreeEvent* treeEvent = GetTreeEvent(event);
+    return treeEvent ? to_handle(treeEvent->GetOldItem()) : 0;
+}
+
 // Get the label from a tree event (for label editing events)
 WXD_EXPORTED int
 wxd_TreeEvent_GetLabel(wxd_Event_t* event, char* buffer, size_t buffer_len)
@@ -618,6 +909,43 @@ wxd_TreeCtrl_GetSelections(wxd_TreeCtrl_t* self, wxd_TreeItemId_t** items, size_
     return count;
 }
 
+WXD_EXPORTED void
+wxd_TreeCtrl_SelectItems(wxd_TreeCtrl_t* self, const wxd_TreeItemHandle* items, size_t count,
+                         bool replace)
+{
+    wxTreeCtrl* tree = WXD_UNWRAP_TREE_CTRL(self);
+    if (!tree || (count > 0 && !items) || (count == 0 && !replace))
+        return;
+    const wxTreeItemId old_item = tree->GetFocusedItem();
+    wxTreeItemId last;
+    {
+        // Swallows the changing/changed pair each SelectItem sends, ahead of every handler
+        // bound to the tree.
+        wxEvtHandler mute;
+        mute.Bind(wxEVT_TREE_SEL_CHANGING, [](wxTreeEvent&) {});
+        mute.Bind(wxEVT_TREE_SEL_CHANGED, [](wxTreeEvent&) {});
+        tree->PushEventHandler(&mute);
+        tree->Freeze();
+        if (replace)
+            tree->UnselectAll();
+        const bool multiple = tree->HasFlag(wxTR_MULTIPLE);
+        for (size_t i = 0; i < count; ++i) {
+            const wxTreeItemId item = from_handle(items[i]);
+            if (!item.IsOk())
+                continue;
+            tree->SelectItem(item, true);
+            last = item;
+            if (!multiple)
+                break;
+        }
+        tree->Thaw();
+        tree->PopEventHandler(false);
+    }
+    wxTreeEvent event(wxEVT_TREE_SEL_CHANGED, tree, last);
+    event.SetOldItem(old_item);
+    tree->HandleWindowEvent(event);
+}
+
 // GetItemParent
 WXD_EXPORTED wxd_TreeItemId_t*
 wxd_TreeCtrl_GetItemParent(wxd_TreeCtrl_t* self, wxd_TreeItemId_t* itemId)
@@ -887,6 +1215,62 @@ wxd_TreeCtrl_SortChildren(wxd_TreeCtrl_t* self, wxd_TreeItemId_t* itemId)
     treeCtrl->SortChildren(*wx_itemId);
 }
 
+WXD_EXPORTED bool
+wxd_TreeCtrl_SortChildrenByKeys(wxd_TreeCtrl_t* self, wxd_TreeItemHandle parent,
+                                const uint8_t* keys, size_t keys_len, const uint32_t* offsets,
+                                size_t count, bool recursive)
+{
+    WxdTreeCtrl* tree = dynamic_cast<WxdTreeCtrl*>(WXD_UNWRAP_TREE_CTRL(self));
+    const wxTreeItemId anchor = from_handle(parent);
+    if (!tree || !anchor.IsOk() || !offsets || (keys_len > 0 && !keys))
+        return false;
+
+    // The items the keys belong to, in pre-order, and the items whose children get sorted.
+    std::vector<wxTreeItemId> items;
+    std::vector<wxTreeItemId> parents;
+    std::vector<wxTreeItemId> stack{ anchor };
+    std::vector<wxTreeItemId> kids;
+    while (!stack.empty()) {
+        const wxTreeItemId node = stack.back();
+        stack.pop_back();
+        if (node != anchor) {
+            items.push_back(node);
+            if (!recursive)
+                continue;
+        }
+        kids.clear();
+        wxTreeItemIdValue cookie;
+        for (wxTreeItemId child = tree->GetFirstChild(node, cookie); child.IsOk();
+             child = tree->GetNextChild(node, cookie)) {
+            kids.push_back(child);
+        }
+        if (kids.size() > 1)
+            parents.push_back(node);
+        stack.insert(stack.end(), kids.rbegin(), kids.rend());
+    }
+    if (items.size() != count)
+        return false;
+    for (size_t i = 0; i < count; ++i) {
+        if (offsets[i] > offsets[i + 1])
+            return false;
+    }
+    if (count > 0 && offsets[count] > keys_len)
+        return false;
+
+    std::vector<size_t> order(count);
+    std::iota(order.begin(), order.end(), size_t{ 0 });
+    std::stable_sort(order.begin(), order.end(), [keys, offsets](size_t a, size_t b) {
+        const size_t len_a = offsets[a + 1] - offsets[a];
+        const size_t len_b = offsets[b + 1] - offsets[b];
+        const int cmp = len_a && len_b ? std::memcmp(keys + offsets[a], keys + offsets[b],
+                                                     std::min(len_a, len_b))
+                                       : 0;
+        return cmp != 0 ? cmp < 0 : len_a < len_b;
+    });
+    tree->SortByRanks(parents, items, order);
+    return true;
+}
+
 // HitTest
 WXD_EXPORTED wxd_TreeItemId_t*
 wxd_TreeCtrl_HitTest(wxd_TreeCtrl_t* self, wxd_Point point, int* flags)
@@ -965,6 +1349,339 @@ wxd_TreeCtrl_SetItemHasChildren(wxd_TreeCtrl_t* self, wxd_TreeItemId_t* itemId,
     treeCtrl->SetItemHasChildren(*wx_itemId, has);
 }
 
+// --- Value handles ---
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeItemId_GetHandle(const wxd_TreeItemId_t* item_id)
+{
+    const wxTreeItemId* id = reinterpret_cast<const wxTreeItemId*>(item_id);
+    return id ? to_handle(*id) : 0;
+}
+
+WXD_EXPORTED wxd_TreeItemId_t*
+wxd_TreeItemId_FromHandle(wxd_TreeItemHandle handle)
+{
+    if (!handle)
+        return nullptr;
+    return WXD_WRAP_TREE_ITEM_ID(new wxTreeItemId(from_handle(handle)));
+}
+
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeCtrl_GetRootItemHandle(wxd_TreeCtrl_t* self)
+{
+    wxTreeCtrl* tree = WXD_UNWRAP_TREE_CTRL(self);
+    return tree ? to_handle(tree->GetRootItem()) : 0;
+}
+
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeCtrl_GetSelectionHandle(wxd_TreeCtrl_t* self)
+{
+    wxTreeCtrl* tree = WXD_UNWRAP_TREE_CTRL(self);
+    return tree ? to_handle(tree->GetSelection()) : 0;
+}
+
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeCtrl_GetFocusedItemHandle(wxd_TreeCtrl_t* self)
+{
+    wxTreeCtrl* tree = WXD_UNWRAP_TREE_CTRL(self);
+    return tree ? to_handle(tree->GetFocusedItem()) : 0;
+}
+
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeCtrl_GetFirstChildHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item, void** cookie)
+{
+    wxTreeCtrl* tree = WXD_UNWRAP_TREE_CTRL(self);
+    if (!tree || !item || !cookie)
+        return 0;
+    // wxTreeItemIdValue is itself a void*, so the cookie is kept inline.
+    wxTreeItemIdValue wxCookie = nullptr;
+    const wxTreeItemId child = tree->GetFirstChild(from_handle(item), wxCookie);
+    *cookie = wxCookie;
+    return to_handle(child);
+}
+
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeCtrl_GetNextChildHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item, void** cookie)
+{
+    wxTreeCtrl* tree = WXD_UNWRAP_TREE_CTRL(self);
+    if (!tree || !item || !cookie)
+        return 0;
+    wxTreeItemIdValue wxCookie = *cookie;
+    const wxTreeItemId child = tree->GetNextChild(from_handle(item), wxCookie);
+    *cookie = wxCookie;
+    return to_handle(child);
+}
+
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeCtrl_GetLastChildHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item)
+{
+    wxTreeCtrl* tree = WXD_UNWRAP_TREE_CTRL(self);
+    return tree && item ? to_handle(tree->GetLastChild(from_handle(item))) : 0;
+}
+
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeCtrl_GetNextSiblingHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item)
+{
+    wxTreeCtrl* tree = WXD_UNWRAP_TREE_CTRL(self);
+    return tree && item ? to_handle(tree->GetNextSibling(from_handle(item))) : 0;
+}
+
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeCtrl_GetPrevSiblingHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item)
+{
+    wxTreeCtrl* tree = WXD_UNWRAP_TREE_CTRL(self);
+    return tree && item ? to_handle(tree->GetPrevSibling(from_handle(item))) : 0;
+}
+
+WXD_EXPORTED wxd_TreeItemHandle
+wxd_TreeCtrl_GetItemParentHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item)
+{
+    wxTreeCtrl* tree = WXD_UNWRAP_TREE_CTRL(self);
+    return tree && item ? to_handle(tree->GetItemParent(from_handle(item))) : 0;
+}
+
+WXD_EXPORTED int
+wxd_TreeCtrl_GetItemTextByHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item, char* buffer,
+                                 size_t buffer_len)
+{
+    wxTreeCtrl* tree = WXD_UNWRAP_TREE_CTRL(self);
+    if (!tree || !item)
+        return -1;
+    return (int)wxd_cpp_utils::copy_wxstring_to_buffer(tree->GetItemText(from_handle(item)),
+                                                        buffer, buffer_len);
+}
+
+WXD_EXPORTED int64_t
+wxd_TreeCtrl_GetItemDataByHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item)
+{
+    wxTreeCtrl* tree = WXD_UNWRAP_TREE_CTRL(self);
+    if (!tree || !item)
+        return 0;
+    LongValueTreeItemData* data =
+        dynamic_cast<LongValueTreeItemData*>(tree->GetItemData(from_handle(item)));
+    return data ? data->GetValue() : 0;
+}
+
+WXD_EXPORTED bool
+wxd_TreeCtrl_ItemHasChildrenByHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item)
+{
+    wxTreeCtrl* tree = WXD_UNWRAP_TREE_CTRL(self);
+    return tree && item && tree->ItemHasChildren(from_handle(item));
+}
+
+WXD_EXPORTED bool
+wxd_TreeCtrl_IsExpandedByHandle(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item)
+{
+    wxTreeCtrl* tree = WXD_UNWRAP_TREE_CTRL(self);
+    return tree && item && tree->IsExpanded(from_handle(item));
+}
+
+// --- Whole subtrees in one call ---
+WXD_EXPORTED wxd_TreeSubtree_t*
+wxd_TreeCtrl_GetSubtree(wxd_TreeCtrl_t* self, wxd_TreeItemHandle item, int32_t depth)
+{
+    wxTreeCtrl* tree = WXD_UNWRAP_TREE_CTRL(self);
+    if (!tree || !item)
+        return nullptr;
+    auto* subtree = new wxd_TreeSubtree_t();
+    wxd_tree_subtree::walk(
+        *subtree, from_handle(item), depth,
+        [tree](const wxTreeItemId& parent, std::vector<wxTreeItemId>& kids) {
+            wxTreeItemIdValue cookie;
+            for (wxTreeItemId child = tree->GetFirstChild(parent, cookie); child.IsOk();
+                 child = tree->GetNextChild(parent, cookie)) {
+                kids.push_back(child);
+            }
+        },
+        [tree](wxd_TreeSubtree_t& out, const wxTreeItemId& node, int32_t parent) {
+            uint32_t state = 0;
+            if (tree->IsExpanded(node))
+                state |= WXD_TREE_NODE_EXPANDED;
+            if (tree->IsSelected(node))
+                state |= WXD_TREE_NODE_SELECTED;
+            if (tree->ItemHasChildren(node))
+                state |= WXD_TREE_NODE_HAS_CHILDREN;
+            if (tree->IsBold(node))
+                state |= WXD_TREE_NODE_BOLD;
+            return wxd_tree_subtree::add_node(out, to_handle(node), parent,
+                                              tree->GetItemText(node), tree->GetItemImage(node),
+                                              state);
+        });
+    return subtree;
+}
+
+WXD_EXPORTED const wxd_TreeNode*
+wxd_TreeSubtree_GetNodes(const wxd_TreeSubtree_t* subtree, size_t* count)
+{
+    if (count)
+        *count = subtree ? subtree->nodes.size() : 0;
+    return subtree ? subtree->nodes.data() : nullptr;
+}
+
+WXD_EXPORTED const char*
+wxd_TreeSubtree_GetText(const wxd_TreeSubtree_t* subtree, size_t* len)
+{
+    if (len)
+        *len = subtree ? subtree->text.size() : 0;
+    return subtree ? subtree->text.data() : nullptr;
+}
+
+WXD_EXPORTED void
+wxd_TreeSubtree_Free(wxd_TreeSubtree_t* subtree)
+{
+    delete subtree;
+}
+
+WXD_EXPORTED size_t
+wxd_TreeCtrl_InsertSubtree(wxd_TreeCtrl_t* self, wxd_TreeItemHandle parent,
+                           const wxd_TreeNode* nodes, size_t count, const char* text,
+                           size_t text_len, wxd_TreeItemHandle* out_items)
+{
+    wxTreeCtrl* tree = WXD_UNWRAP_TREE_CTRL(self);
+    if (!tree || !wxd_tree_subtree::valid_nodes(nodes, count, text, text_len))
+        return 0;
+    const wxTreeItemId anchor = from_handle(parent);
+    if (!anchor.IsOk() && tree->GetRootItem().IsOk())
+        return 0;
+
+    std::vector<wxTreeItemId> created;
+    created.reserve(count);
+    tree->Freeze();
+    for (size_t i = 0; i < count; ++i) {
+        const wxd_TreeNode& node = nodes[i];
+        const wxd_cpp_utils::ScratchWxString label(text ? text + node.label_offset : "",
+                                                   node.label_len);
+        wxTreeItemId id;
+        if (node.parent >= 0)
+            id = tree->AppendItem(created[node.parent], label, node.image, node.image);
+        else if (anchor.IsOk())
+            id = tree->AppendItem(anchor, label, node.image, node.image);
+        else if (!tree->GetRootItem().IsOk())
+            id = tree->AddRoot(label, node.image, node.image);
+        if (!id.IsOk())
+            break;
+        if (node.state & WXD_TREE_NODE_HAS_CHILDREN)
+            tree->SetItemHasChildren(id, true);
+        if (node.state & WXD_TREE_NODE_BOLD)
+            tree->SetItemBold(id, true);
+        if (out_items)
+            out_items[i] = to_handle(id);
+        created.push_back(id);
+    }
+    // Expanding needs the children in place.
+    for (size_t i = 0; i < created.size(); ++i) {
+        if (nodes[i].state & WXD_TREE_NODE_EXPANDED)
+            tree->Expand(created[i]);
+        if (nodes[i].state & WXD_TREE_NODE_SELECTED)
+            tree->SelectItem(created[i]);
+    }
+    tree->Thaw();
+    return created.size();
+}
+
+// --- Lazily populated children ---
+WXD_EXPORTED bool
+wxd_TreeCtrl_EnableLazyChildren(wxd_TreeCtrl_t* self, void* userdata,
+                                wxd_treectrl_lazy_children_callback callback,
+                                wxd_treectrl_free_userdata_callback free_userdata,
+                                size_t releaseBudget)
+{
+    wxTreeCtrl* treeCtrl = WXD_UNWRAP_TREE_CTRL(self);
+    if (!treeCtrl || !callback)
+        return false;
+    auto& map = lazy_states();
+    auto it = map.find(treeCtrl);
+    if (it == map.end()) {
+        treeCtrl->Bind(wxEVT_DESTROY, on_lazy_tree_destroy);
+        it = map.emplace(treeCtrl, std::make_unique<LazyTreeState>(treeCtrl)).first;
+    }
+    it->second->Configure(userdata, callback, free_userdata, releaseBudget);
+    return true;
+}
+
+WXD_EXPORTED void
+wxd_TreeCtrl_DisableLazyChildren(wxd_TreeCtrl_t* self)
+{
+    wxTreeCtrl* treeCtrl = WXD_UNWRAP_TREE_CTRL(self);
+    if (!treeCtrl)
+        return;
+    if (lazy_states().erase(treeCtrl))
+        treeCtrl->Unbind(wxEVT_DESTROY, on_lazy_tree_destroy);
+}
+
+WXD_EXPORTED bool
+wxd_TreeCtrl_SetLazyItem(wxd_TreeCtrl_t* self, wxd_TreeItemId_t* itemId, int64_t key,
+                         bool hasChildren)
+{
+    wxTreeCtrl* treeCtrl = WXD_UNWRAP_TREE_CTRL(self);
+    wxTreeItemId* wx_itemId = WXD_UNWRAP_TREE_ITEM_ID(itemId);
+    if (!treeCtrl || !wx_itemId || !wx_itemId->IsOk())
+        return false;
+    LazyTreeItemData* data = lazy_data(treeCtrl, *wx_itemId);
+    if (data) {
+        data->key = key;
+    } else {
+        // Carry over a value set through wxd_TreeCtrl_SetItemData.
+        LongValueTreeItemData* old =
+            dynamic_cast<LongValueTreeItemData*>(treeCtrl->GetItemData(*wx_itemId));
+        data = new LazyTreeItemData(key);
+        data->SetValue(old ? old->GetValue() : 0);
+        treeCtrl->SetItemData(*wx_itemId, data);
+    }
+    data->populated = !hasChildren || treeCtrl->GetChildrenCount(*wx_itemId, false) > 0;
+    treeCtrl->SetItemHasChildren(*wx_itemId, hasChildren);
+    return true;
+}
+
+WXD_EXPORTED wxd_TreeItemId_t*
+wxd_TreeCtrl_AppendLazyItem(wxd_TreeCtrl_t* self, wxd_TreeItemId_t* parent_id, const char* text,
+                            int image, int selImage, int64_t key, bool hasChildren)
+{
+    wxTreeCtrl* treeCtrl = WXD_UNWRAP_TREE_CTRL(self);
+    wxTreeItemId* parentId = WXD_UNWRAP_TREE_ITEM_ID(parent_id);
+    if (!treeCtrl || !parentId || !parentId->IsOk())
+        return nullptr;
+    wxTreeItemId id = treeCtrl->AppendItem(*parentId, wxd_cpp_utils::ScratchWxString(text), image,
+                                           selImage, new LazyTreeItemData(key));
+    if (!id.IsOk())
+        return nullptr;
+    treeCtrl->SetItemHasChildren(id, hasChildren);
+    return WXD_WRAP_TREE_ITEM_ID(new wxTreeItemId(id));
+}
+
+WXD_EXPORTED bool
+wxd_TreeCtrl_GetLazyItemKey(wxd_TreeCtrl_t* self, wxd_TreeItemId_t* itemId, int64_t* key)
+{
+    wxTreeCtrl* treeCtrl = WXD_UNWRAP_TREE_CTRL(self);
+    wxTreeItemId* wx_itemId = WXD_UNWRAP_TREE_ITEM_ID(itemId);
+    if (!treeCtrl || !wx_itemId || !wx_itemId->IsOk() || !key)
+        return false;
+    LazyTreeItemData* data = lazy_data(treeCtrl, *wx_itemId);
+    if (!data)
+        return false;
+    *key = data->key;
+    return true;
+}
+
+WXD_EXPORTED void
+wxd_TreeCtrl_ResetLazyItem(wxd_TreeCtrl_t* self, wxd_TreeItemId_t* itemId)
+{
+    wxTreeCtrl* treeCtrl = WXD_UNWRAP_TREE_CTRL(self);
+    wxTreeItemId* wx_itemId = WXD_UNWRAP_TREE_ITEM_ID(itemId);
+    if (!treeCtrl || !wx_itemId || !wx_itemId->IsOk())
+        return;
+    LazyTreeItemData* data = lazy_data(treeCtrl, *wx_itemId);
+    if (!data)
+        return;
+    auto it = lazy_states().find(treeCtrl);
+    if (it != lazy_states().end()) {
+        it->second->Reset(*wx_itemId, *data);
+    } else {
+        treeCtrl->CollapseAndReset(*wx_itemId);
+        data->populated = false;
+        treeCtrl->SetItemHasChildren(*wx_itemId, true);
+    }
+}
+
 // EnableItem - Note: This may not be available in all wxWidgets versions
 WXD_EXPORTED void
 wxd_TreeCtrl_EnableItem(wxd_TreeCtrl_t* self, wxd_TreeItemId_t* itemId, bool enable)
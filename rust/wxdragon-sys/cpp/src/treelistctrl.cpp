@@ -5,8 +5,29 @@
 #endif
 
 #include "wx/treelist.h"
+#include "wx/wupdlock.h"
 #include "../include/wxdragon.h"
 #include "wxd_utils.h"
+#include "wxd_tree_subtree.h"
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+wxCheckBoxState
+to_check_state(int state)
+{
+    switch (state) {
+    case 1:
+        return wxCHK_CHECKED;
+    case 2:
+        return wxCHK_UNDETERMINED;
+    default:
+        return wxCHK_UNCHECKED;
+    }
+}
+
+} // namespace
 
 extern "C" {
 
@@ -24,8 +45,8 @@ wxd_TreeListCtrl_Create(wxd_Window_t* parent, wxd_Id id, wxd_Point pos, wxd_Size
     if (style & 2)
         wxStyle |= wxTL_3STATE; // 3-state checkbox style
 
-    wxTreeListCtrl* ctrl = new wxTreeListCtrl(parentWin, id, wxd_cpp_utils::to_wx(pos),
-                                              wxd_cpp_utils::to_wx(size), wxStyle);
+    wxTreeListCtrl* ctrl = new wxTreeListCtrl(parentWin, id, wxd_cpp_utils::to_wx(pos, parentWin),
+                                              wxd_cpp_utils::to_wx(size, parentWin), wxStyle);
     return (wxd_TreeListCtrl_t*)ctrl;
 }
 
@@ -278,6 +299,61 @@ wxd_TreeListCtrl_UpdateItemParentState(wxd_TreeListCtrl_t* self, wxd_Long_t item
     }
 }
 
+WXD_EXPORTED void
+wxd_TreeListCtrl_SelectItems(wxd_TreeListCtrl_t* self, const wxd_Long_t* items, size_t count,
+                             bool replace)
+{
+    wxTreeListCtrl* ctrl = (wxTreeListCtrl*)self;
+    if (!ctrl || (count > 0 && !items) || (count == 0 && !replace))
+        return;
+    {
+        wxWindowUpdateLocker lock(ctrl);
+        if (replace)
+            ctrl->UnselectAll();
+        const bool multiple = ctrl->HasFlag(wxTL_MULTIPLE);
+        for (size_t i = 0; i < count; ++i) {
+            if (!items[i])
+                continue;
+            ctrl->Select(wxTreeListItem(reinterpret_cast<wxTreeListModelNode*>(items[i])));
+            if (!multiple)
+                break;
+        }
+    }
+    // Programmatic selection is silent; tell handlers once that it changed.
+    wxTreeListEvent event;
+    event.SetEventType(wxEVT_TREELIST_SELECTION_CHANGED);
+    event.SetEventObject(ctrl);
+    event.SetId(ctrl->GetId());
+    ctrl->HandleWindowEvent(event);
+}
+
+WXD_EXPORTED void
+wxd_TreeListCtrl_SetCheckedStates(wxd_TreeListCtrl_t* self, const wxd_Long_t* items,
+                                  const int* states, size_t count, bool recursive,
+                                  bool update_parents)
+{
+    wxTreeListCtrl* ctrl = (wxTreeListCtrl*)self;
+    if (!ctrl || count == 0 || !items || !states)
+        return;
+    wxWindowUpdateLocker lock(ctrl);
+    std::unordered_set<void*> parents;
+    std::vector<wxTreeListItem> representatives;
+    for (size_t i = 0; i < count; ++i) {
+        if (!items[i])
+            continue;
+        const wxTreeListItem item(reinterpret_cast<wxTreeListModelNode*>(items[i]));
+        if (recursive)
+            ctrl->CheckItemRecursively(item, to_check_state(states[i]));
+        else
+            ctrl->CheckItem(item, to_check_state(states[i]));
+        // One child per parent is enough: the update walks up from the parent.
+        if (update_parents && parents.insert(ctrl->GetItemParent(item).GetID()).second)
+            representatives.push_back(item);
+    }
+    for (const wxTreeListItem& item : representatives)
+        ctrl->UpdateItemParentStateRecursively(item);
+}
+
 // Additional column operations
 WXD_EXPORTED bool
 wxd_TreeListCtrl_DeleteColumn(wxd_TreeListCtrl_t* self, unsigned col)
@@ -518,4 +594,89 @@ wxd_TreeListCtrl_GetSortColumn(wxd_TreeListCtrl_t* self, unsigned* col, bool* as
     return ctrl->GetSortColumn(col, ascending);
 }
 
+// Whole subtrees in one call
+WXD_EXPORTED wxd_TreeSubtree_t*
+wxd_TreeListCtrl_GetSubtree(wxd_TreeListCtrl_t* self, wxd_Long_t item, int32_t depth)
+{
+    wxTreeListCtrl* ctrl = (wxTreeListCtrl*)self;
+    if (!ctrl)
+        return nullptr;
+    wxTreeListItem start(reinterpret_cast<wxTreeListModelNode*>(item));
+    if (!item)
+        start = ctrl->GetRootItem();
+    if (!start.IsOk())
+        return nullptr;
+    auto* subtree = new wxd_TreeSubtree_t();
+    wxd_tree_subtree::walk(
+        *subtree, start, depth,
+        [ctrl](const wxTreeListItem& parent, std::vector<wxTreeListItem>& kids) {
+            for (wxTreeListItem child = ctrl->GetFirstChild(parent); child.IsOk();
+                 child = ctrl->GetNextSibling(child)) {
+                kids.push_back(child);
+            }
+        },
+        [ctrl](wxd_TreeSubtree_t& out, const wxTreeListItem& node, int32_t parent) {
+            uint32_t state = 0;
+            if (ctrl->IsExpanded(node))
+                state |= WXD_TREE_NODE_EXPANDED;
+            if (ctrl->IsSelected(node))
+                state |= WXD_TREE_NODE_SELECTED;
+            if (ctrl->GetFirstChild(node).IsOk())
+                state |= WXD_TREE_NODE_HAS_CHILDREN;
+            if (ctrl->HasFlag(wxTL_CHECKBOX)) {
+                const wxCheckBoxState checked = ctrl->GetCheckedState(node);
+                if (checked == wxCHK_CHECKED)
+                    state |= WXD_TREE_NODE_CHECKED;
+                else if (checked == wxCHK_UNDETERMINED)
+                    state |= WXD_TREE_NODE_UNDETERMINED;
+            }
+            // wxTreeListCtrl has no image getter.
+            return wxd_tree_subtree::add_node(out, reinterpret_cast<uint64_t>(node.GetID()),
+                                              parent, ctrl->GetItemText(node, 0), -1, state);
+        });
+    return subtree;
+}
+
+WXD_EXPORTED size_t
+wxd_TreeListCtrl_InsertSubtree(wxd_TreeListCtrl_t* self, wxd_Long_t parent,
+                               const wxd_TreeNode* nodes, size_t count, const char* text,
+                               size_t text_len, wxd_Long_t* out_items)
+{
+    wxTreeListCtrl* ctrl = (wxTreeListCtrl*)self;
+    if (!ctrl || !wxd_tree_subtree::valid_nodes(nodes, count, text, text_len))
+        return 0;
+    wxTreeListItem anchor(reinterpret_cast<wxTreeListModelNode*>(parent));
+    if (!parent)
+        anchor = ctrl->GetRootItem();
+    if (!anchor.IsOk())
+        return 0;
+
+    std::vector<wxTreeListItem> created;
+    created.reserve(count);
+    ctrl->Freeze();
+    for (size_t i = 0; i < count; ++i) {
+        const wxd_TreeNode& node = nodes[i];
+        const wxTreeListItem id = ctrl->AppendItem(
+            node.parent >= 0 ? created[node.parent] : anchor,
+            wxd_cpp_utils::ScratchWxString(text ? text + node.label_offset : "", node.label_len),
+            node.image, node.image);
+        if (!id.IsOk())
+            break;
+        if (node.state & (WXD_TREE_NODE_CHECKED | WXD_TREE_NODE_UNDETERMINED))
+            ctrl->CheckItem(id, node.state & WXD_TREE_NODE_CHECKED ? wxCHK_CHECKED
+                                                                   : wxCHK_UNDETERMINED);
+        if (out_items)
+            out_items[i] = (wxd_Long_t)id.GetID();
+        created.push_back(id);
+    }
+    for (size_t i = 0; i < created.size(); ++i) {
+        if (nodes[i].state & WXD_TREE_NODE_EXPANDED)
+            ctrl->Expand(created[i]);
+        if (nodes[i].state & WXD_TREE_NODE_SELECTED)
+            ctrl->Select(created[i]);
+    }
+    ctrl->Thaw();
+    return created.size();
+}
+
 } // extern "C"
\ No newline at end of file
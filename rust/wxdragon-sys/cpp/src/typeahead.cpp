@@ -0,0 +1,638 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include <wx/dataview.h>
+#include <wx/listctrl.h>
+#include <wx/stopwatch.h>
+#include "../include/wxdragon.h"
+#include "wxd_typeahead.h"
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// Typing pause after which the search text starts over.
+constexpr long kResetMs = 1000;
+// Past this many changed rows (or a fraction of the index) one rebuild beats patching rows.
+constexpr size_t kMinPatchLimit = 64;
+
+wxString
+fold(const wxString& text)
+{
+    return text.Lower();
+}
+
+// Text and selection access for one kind of control.
+class TypeAheadSource {
+public:
+    virtual ~TypeAheadSource() = default;
+
+    virtual unsigned int
+    RowCount() const = 0;
+    virtual wxString
+    RowText(unsigned int row) const = 0;
+    // The focused row, or -1.
+    virtual long
+    CurrentRow() const = 0;
+    virtual void
+    SelectRow(unsigned int row) = 0;
+    // Called before every query, e.g. to follow a newly associated model.
+    virtual void
+    Sync()
+    {
+    }
+};
+
+// Folded row texts plus the rows ordered by text, so a prefix query is a binary search.
+class TypeAheadIndex {
+public:
+    void
+    Invalidate()
+    {
+        m_stale = true;
+        m_keys.clear();
+        m_sorted.clear();
+        m_dirty.clear();
+    }
+
+    void
+    MarkRows(long first, long last)
+    {
+        if (m_stale || m_keys.empty())
+            return;
+        first = std::max(first, 0L);
+        last = std::min(last, static_cast<long>(m_keys.size()) - 1);
+        if (first > last)
+            return;
+        if (static_cast<size_t>(last - first) + m_dirty.size() >= PatchLimit()) {
+            Invalidate();
+            return;
+        }
+        for (long row = first; row <= last; ++row) {
+            m_dirty.push_back(static_cast<uint32_t>(row));
+        }
+    }
+
+    void
+    InsertRows(unsigned int before, unsigned int count)
+    {
+        if (m_stale)
+            return;
+        if (before > m_keys.size() || count + m_dirty.size() >= PatchLimit()) {
+            Invalidate();
+            return;
+        }
+        for (uint32_t& row : m_sorted) {
+            if (row >= before)
+                row += count;
+        }
+        for (uint32_t& row : m_dirty) {
+            if (row >= before)
+                row += count;
+        }
+        m_keys.insert(m_keys.begin() + before, count, wxString());
+        for (unsigned int row = before; row < before + count; ++row) {
+            Insert(row);
+            m_dirty.push_back(row);
+        }
+    }
+
+    // Brings the index up to date with `source`; the only place that calls out for text.
+    void
+    Update(const TypeAheadSource& source)
+    {
+        const unsigned int count = source.RowCount();
+        if (m_stale || count != m_keys.size()) {
+            Rebuild(source, count);
+            return;
+        }
+        if (m_dirty.empty())
+            return;
+        std::sort(m_dirty.begin(), m_dirty.end());
+        m_dirty.erase(std::unique(m_dirty.begin(), m_dirty.end()), m_dirty.end());
+        for (uint32_t row : m_dirty) {
+            Remove(row);
+            m_keys[row] = fold(source.RowText(row));
+            Insert(row);
+        }
+        m_dirty.clear();
+    }
+
+    // First matching row at or after `start`, wrapping around; -1 if none.
+    long
+    Find(const wxString& text, long start, int mode) const
+    {
+        const size_t count = m_keys.size();
+        if (count == 0)
+            return -1;
+        if (start < 0 || static_cast<size_t>(start) >= count)
+            start = 0;
+        const wxString needle = fold(text);
+
+        if (mode == WXD_TYPEAHEAD_SUBSTRING) {
+            // Scans the cached texts: no callbacks, but linear in the row count.
+            for (size_t i = 0; i < count; ++i) {
+                const size_t row = (static_cast<size_t>(start) + i) % count;
+                if (m_keys[row].find(needle) != wxString::npos)
+                    return static_cast<long>(row);
+            }
+            return -1;
+        }
+
+        long next = -1;
+        long lowest = -1;
+        for (auto it = LowerBound(needle); it != m_sorted.end(); ++it) {
+            if (!m_keys[*it].StartsWith(needle))
+                break;
+            const long row = static_cast<long>(*it);
+            if (row >= start && (next < 0 || row < next))
+                next = row;
+            if (lowest < 0 || row < lowest)
+                lowest = row;
+        }
+        return next >= 0 ? next : lowest;
+    }
+
+private:
+    size_t
+    PatchLimit() const
+    {
+        return std::max(kMinPatchLimit, m_keys.size() / 8);
+    }
+
+    void
+    Rebuild(const TypeAheadSource& source, unsigned int count)
+    {
+        m_keys.resize(count);
+        for (unsigned int row = 0; row < count; ++row) {
+            m_keys[row] = fold(source.RowText(row));
+        }
+        m_sorted.resize(count);
+        std::iota(m_sorted.begin(), m_sorted.end(), 0u);
+        std::stable_sort(m_sorted.begin(), m_sorted.end(),
+                         [this](uint32_t a, uint32_t b) { return m_keys[a] < m_keys[b]; });
+        m_dirty.clear();
+        m_stale = false;
+    }
+
+    std::vector<uint32_t>::const_iterator
+    LowerBound(const wxString& key) const
+    {
+        return std::lower_bound(
+            m_sorted.begin(), m_sorted.end(), key,
+            [this](uint32_t row, const wxString& value) { return m_keys[row] < value; });
+    }
+
+    void
+    Remove(uint32_t row)
+    {
+        for (auto it = LowerBound(m_keys[row]); it != m_sorted.end(); ++it) {
+            if (*it == row) {
+                m_sorted.erase(it);
+                return;
+            }
+            if (m_keys[*it] != m_keys[row])
+                return;
+        }
+    }
+
+    void
+    Insert(uint32_t row)
+    {
+        auto it = std::upper_bound(
+            m_sorted.cbegin(), m_sorted.cend(), m_keys[row],
+            [this](const wxString& value, uint32_t other) { return value < m_keys[other]; });
+        m_sorted.insert(it, row);
+    }
+
+    bool m_stale = true;
+    std::vector<wxString> m_keys;   // folded text per row
+    std::vector<uint32_t> m_sorted; // rows ordered by m_keys
+    std::vector<uint32_t> m_dirty;  // rows to re-read
+};
+
+class DataViewSource;
+
+// Forwards a list model's row notifications to the index. Owned (and deleted) by the model.
+class IndexNotifier : public wxDataViewModelNotifier {
+public:
+    IndexNotifier(DataViewSource* source, TypeAheadIndex* index, unsigned int column)
+        : m_source(source), m_index(index), m_column(column)
+    {
+    }
+
+    ~IndexNotifier() override;
+
+    bool
+    ItemAdded(const wxDataViewItem& WXUNUSED(parent), const wxDataViewItem& item) override
+    {
+        if (wxDataViewListModel* model = ListModel())
+            m_index->InsertRows(model->GetRow(item), 1);
+        return true;
+    }
+
+    bool
+    ItemDeleted(const wxDataViewItem& WXUNUSED(parent),
+                const wxDataViewItem& WXUNUSED(item)) override
+    {
+        // An index model no longer knows the deleted item's row.
+        m_index->Invalidate();
+        return true;
+    }
+
+    bool
+    ItemChanged(const wxDataViewItem& item) override
+    {
+        MarkItem(item);
+        return true;
+    }
+
+    bool
+    ValueChanged(const wxDataViewItem& item, unsigned int col) override
+    {
+        if (col == m_column)
+            MarkItem(item);
+        return true;
+    }
+
+    bool
+    Cleared() override
+    {
+        m_index->Invalidate();
+        return true;
+    }
+
+    void
+    Resort() override
+    {
+    }
+
+    // Cleared when the source goes first, so the destructor does not call back into it.
+    DataViewSource* m_source;
+
+private:
+    wxDataViewListModel*
+    ListModel() const
+    {
+        wxDataViewModel* model = GetOwner();
+        return model && model->IsListModel() ? static_cast<wxDataViewListModel*>(model) : nullptr;
+    }
+
+    void
+    MarkItem(const wxDataViewItem& item)
+    {
+        if (wxDataViewListModel* model = ListModel()) {
+            const long row = static_cast<long>(model->GetRow(item));
+            m_index->MarkRows(row, row);
+        }
+    }
+
+    TypeAheadIndex* m_index;
+    unsigned int m_column;
+};
+
+class DataViewSource : public TypeAheadSource {
+public:
+    DataViewSource(wxDataViewCtrl* ctrl, unsigned int column, TypeAheadIndex* index)
+        : m_ctrl(ctrl), m_column(column), m_index(index)
+    {
+    }
+
+    ~DataViewSource() override
+    {
+        Detach();
+    }
+
+    unsigned int
+    RowCount() const override
+    {
+        wxDataViewListModel* model = Model();
+        return model ? model->GetCount() : 0;
+    }
+
+    wxString
+    RowText(unsigned int row) const override
+    {
+        wxVariant value;
+        Model()->GetValueByRow(value, row, m_column);
+        if (value.GetType() == wxS("wxDataViewIconText")) {
+            wxDataViewIconText icon_text;
+            icon_text << value;
+            return icon_text.GetText();
+        }
+        return value.IsNull() ? wxString() : value.MakeString();
+    }
+
+    long
+    CurrentRow() const override
+    {
+        wxDataViewListModel* model = Model();
+        const wxDataViewItem item = m_ctrl->GetCurrentItem();
+        return model && item.IsOk() ? static_cast<long>(model->GetRow(item)) : -1;
+    }
+
+    void
+    SelectRow(unsigned int row) override
+    {
+        const wxDataViewItem item = ItemForRow(row);
+        if (!item.IsOk())
+            return;
+        m_ctrl->UnselectAll();
+        m_ctrl->Select(item);
+        m_ctrl->SetCurrentItem(item);
+        m_ctrl->EnsureVisible(item);
+        // Programmatic selection is silent, but this one comes from the user.
+        wxDataViewEvent event(wxEVT_DATAVIEW_SELECTION_CHANGED, m_ctrl, item);
+        m_ctrl->ProcessWindowEvent(event);
+    }
+
+    void
+    Sync() override
+    {
+        wxDataViewListModel* model = Model();
+        if (model == m_model && (m_notifier || !model))
+            return;
+        Detach();
+        m_index->Invalidate();
+        if (!model)
+            return;
+        m_model = model;
+        m_notifier = new IndexNotifier(this, m_index, m_column);
+        model->AddNotifier(m_notifier);
+    }
+
+    // The model deleted the notifier; a later Sync() attaches a new one.
+    void
+    NotifierGone()
+    {
+        m_notifier = nullptr;
+        m_model = nullptr;
+        m_index->Invalidate();
+    }
+
+private:
+    wxDataViewListModel*
+    Model() const
+    {
+        wxDataViewModel* model = m_ctrl->GetModel();
+        return model && model->IsListModel() ? static_cast<wxDataViewListModel*>(model) : nullptr;
+    }
+
+    wxDataViewItem
+    ItemForRow(unsigned int row) const
+    {
+        wxDataViewModel* model = m_ctrl->GetModel();
+        if (auto* index = dynamic_cast<wxDataViewIndexListModel*>(model))
+            return index->GetItem(row);
+#if !defined(__WXMAC__) || defined(__WXUNIVERSAL__)
+        // On macOS the virtual model is the index model.
+        if (auto* virtual_model = dynamic_cast<wxDataViewVirtualListModel*>(model))
+            return virtual_model->GetItem(row);
+#endif
+        return wxDataViewItem();
+    }
+
+    void
+    Detach()
+    {
+        if (!m_notifier)
+            return;
+        m_notifier->m_source = nullptr;
+        // Deletes the notifier.
+        m_model->RemoveNotifier(m_notifier);
+        m_notifier = nullptr;
+        m_model = nullptr;
+    }
+
+    wxDataViewCtrl* m_ctrl;
+    unsigned int m_column;
+    TypeAheadIndex* m_index;
+    wxDataViewListModel* m_model = nullptr;
+    IndexNotifier* m_notifier = nullptr;
+};
+
+IndexNotifier::~IndexNotifier()
+{
+    if (m_source)
+        m_source->NotifierGone();
+}
+
+class ListCtrlSource : public TypeAheadSource {
+public:
+    ListCtrlSource(wxListCtrl* ctrl, int column) : m_ctrl(ctrl), m_column(column) {}
+
+    unsigned int
+    RowCount() const override
+    {
+        return static_cast<unsigned int>(std::max(m_ctrl->GetItemCount(), 0));
+    }
+
+    wxString
+    RowText(unsigned int row) const override
+    {
+        // Virtual controls answer through OnGetItemText.
+        return m_ctrl->GetItemText(row, m_column);
+    }
+
+    long
+    CurrentRow() const override
+    {
+        return m_ctrl->GetNextItem(-1, wxLIST_NEXT_ALL, wxLIST_STATE_FOCUSED);
+    }
+
+    void
+    SelectRow(unsigned int row) override
+    {
+        for (long item = m_ctrl->GetNextItem(-1, wxLIST_NEXT_ALL, wxLIST_STATE_SELECTED);
+             item != -1; item = m_ctrl->GetNextItem(item, wxLIST_NEXT_ALL, wxLIST_STATE_SELECTED)) {
+            m_ctrl->SetItemState(item, 0, wxLIST_STATE_SELECTED);
+        }
+        const long state = wxLIST_STATE_SELECTED | wxLIST_STATE_FOCUSED;
+        m_ctrl->SetItemState(row, state, state);
+        m_ctrl->EnsureVisible(row);
+    }
+
+private:
+    wxListCtrl* m_ctrl;
+    int m_column;
+};
+
+// Per-control state: the index, its source and the typing buffer.
+class TypeAheadState {
+public:
+    TypeAheadState(wxWindow* ctrl, int mode) : m_ctrl(ctrl), m_mode(mode)
+    {
+        // Keys go to whichever child has focus (the generic controls draw in a child window).
+        m_targets.push_back(ctrl);
+        for (wxWindow* child : ctrl->GetChildren()) {
+            m_targets.push_back(child);
+        }
+        for (wxWindow* target : m_targets) {
+            target->Bind(wxEVT_CHAR, &TypeAheadState::OnChar, this);
+        }
+    }
+
+    ~TypeAheadState()
+    {
+        for (wxWindow* target : m_targets) {
+            target->Unbind(wxEVT_CHAR, &TypeAheadState::OnChar, this);
+        }
+    }
+
+    TypeAheadIndex index;
+    std::unique_ptr<TypeAheadSource> source;
+
+    long
+    Find(const wxString& text, long start, int mode)
+    {
+        source->Sync();
+        index.Update(*source);
+        return index.Find(text, start, mode);
+    }
+
+private:
+    void
+    OnChar(wxKeyEvent& event)
+    {
+        const wxChar ch = event.GetUnicodeKey();
+        if (ch == WXK_NONE || ch < WXK_SPACE || ch == WXK_DELETE ||
+            (event.GetModifiers() & ~wxMOD_SHIFT) != 0) {
+            event.Skip();
+            return;
+        }
+        if (m_since_key.Time() > kResetMs)
+            m_typed.clear();
+        m_since_key.Start();
+        // Leading spaces usually toggle or activate; leave them to the control.
+        if (m_typed.empty() && ch == WXK_SPACE) {
+            event.Skip();
+            return;
+        }
+        m_typed += ch;
+
+        const long current = source->CurrentRow();
+        // A longer text may still match the current row; a fresh one moves past it.
+        long row = Find(m_typed, m_typed.length() > 1 ? std::max(current, 0L) : current + 1,
+                        m_mode);
+        // Repeating one character cycles through the rows starting with it.
+        if (row < 0 && m_typed.length() > 1 &&
+            m_typed.find_first_not_of(m_typed[0]) == wxString::npos) {
+            row = Find(wxString(m_typed[0]), current + 1, m_mode);
+        }
+        if (row >= 0 && row != current)
+            source->SelectRow(static_cast<unsigned int>(row));
+    }
+
+    wxWindow* m_ctrl;
+    int m_mode;
+    std::vector<wxWindow*> m_targets;
+    wxString m_typed;
+    wxStopWatch m_since_key;
+};
+
+// States are only ever touched from the GUI thread.
+std::unordered_map<wxWindow*, std::unique_ptr<TypeAheadState>>&
+states()
+{
+    static std::unordered_map<wxWindow*, std::unique_ptr<TypeAheadState>> map;
+    return map;
+}
+
+TypeAheadState*
+state_for(wxWindow* ctrl)
+{
+    auto& map = states();
+    auto it = map.find(ctrl);
+    return it == map.end() ? nullptr : it->second.get();
+}
+
+void
+on_ctrl_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    // Children's destroy events propagate here too; only the control's own one matters.
+    if (wxWindow* window = wxDynamicCast(event.GetEventObject(), wxWindow))
+        states().erase(window);
+}
+
+TypeAheadState&
+attach(wxWindow* ctrl, int mode)
+{
+    auto& map = states();
+    if (map.erase(ctrl) == 0)
+        ctrl->Bind(wxEVT_DESTROY, on_ctrl_destroy);
+    return *map.emplace(ctrl, std::make_unique<TypeAheadState>(ctrl, mode)).first->second;
+}
+
+int
+checked_mode(int mode)
+{
+    return mode == WXD_TYPEAHEAD_SUBSTRING ? WXD_TYPEAHEAD_SUBSTRING : WXD_TYPEAHEAD_PREFIX;
+}
+
+} // namespace
+
+namespace wxd_typeahead {
+
+void
+rows_changed(wxWindow* ctrl, long first, long last)
+{
+    if (TypeAheadState* state = state_for(ctrl))
+        state->index.MarkRows(first, last);
+}
+
+void
+invalidate(wxWindow* ctrl)
+{
+    if (TypeAheadState* state = state_for(ctrl))
+        state->index.Invalidate();
+}
+
+} // namespace wxd_typeahead
+
+WXD_EXPORTED bool
+wxd_DataViewCtrl_EnableTypeAhead(wxd_Window_t* self, int32_t column, int mode)
+{
+    wxDataViewCtrl* ctrl = wxDynamicCast(reinterpret_cast<wxWindow*>(self), wxDataViewCtrl);
+    if (!ctrl || column < 0)
+        return false;
+    wxDataViewModel* model = ctrl->GetModel();
+    if (!model || !model->IsListModel())
+        return false;
+    TypeAheadState& state = attach(ctrl, checked_mode(mode));
+    state.source = std::make_unique<DataViewSource>(ctrl, static_cast<unsigned int>(column),
+                                                    &state.index);
+    state.source->Sync();
+    return true;
+}
+
+WXD_EXPORTED bool
+wxd_ListCtrl_EnableTypeAhead(wxd_ListCtrl_t* self, int32_t column, int mode)
+{
+    wxListCtrl* ctrl = reinterpret_cast<wxListCtrl*>(self);
+    if (!ctrl || column < 0)
+        return false;
+    TypeAheadState& state = attach(ctrl, checked_mode(mode));
+    state.source = std::make_unique<ListCtrlSource>(ctrl, column);
+    return true;
+}
+
+WXD_EXPORTED void
+wxd_TypeAhead_Disable(wxd_Window_t* ctrl)
+{
+    wxWindow* window = reinterpret_cast<wxWindow*>(ctrl);
+    if (window && states().erase(window) > 0)
+        window->Unbind(wxEVT_DESTROY, on_ctrl_destroy);
+}
+
+WXD_EXPORTED int64_t
+wxd_TypeAhead_Find(wxd_Window_t* ctrl, const char* text, int64_t startRow, int mode)
+{
+    TypeAheadState* state = state_for(reinterpret_cast<wxWindow*>(ctrl));
+    if (!state || !state->source)
+        return -1;
+    const long start = static_cast<long>(std::max<int64_t>(startRow, 0));
+    return state->Find(wxString::FromUTF8(text ? text : ""), start, checked_mode(mode));
+}
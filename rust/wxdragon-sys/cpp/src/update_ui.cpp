@@ -0,0 +1,278 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include <wx/menu.h>
+#include <wx/timer.h>
+#include <wx/toolbar.h>
+#include "../include/wxdragon.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// Polls the enable/check state of every registered command id with one Rust callback per
+// interval and pushes only the bits that changed into the window's menubar and toolbars.
+// Main thread only.
+struct wxd_UpdateUIAggregator_t : public wxTimer {
+    wxd_UpdateUIAggregator_t(wxWindow* window, int interval_ms,
+                             wxd_UpdateUIAggregator_Callback callback, void* user_data,
+                             wxd_UpdateUIAggregator_FreeUserData free_user_data)
+        : m_window(window), m_interval_ms(std::max(interval_ms, 1)), m_callback(callback),
+          m_user_data(user_data), m_free_user_data(free_user_data)
+    {
+        m_window->Bind(wxEVT_DESTROY, &wxd_UpdateUIAggregator_t::OnWindowDestroy, this);
+        Start(m_interval_ms);
+    }
+
+    ~wxd_UpdateUIAggregator_t()
+    {
+        Detach();
+    }
+
+    void
+    Register(int id, bool checkable)
+    {
+        auto it = std::lower_bound(m_ids.begin(), m_ids.end(), id);
+        const size_t index = static_cast<size_t>(it - m_ids.begin());
+        if (it != m_ids.end() && *it == id) {
+            m_checkable[index] = checkable;
+        }
+        else {
+            m_ids.insert(it, id);
+            m_checkable.insert(m_checkable.begin() + index, checkable);
+        }
+        Invalidate();
+    }
+
+    void
+    Unregister(int id)
+    {
+        auto it = std::lower_bound(m_ids.begin(), m_ids.end(), id);
+        if (it == m_ids.end() || *it != id)
+            return;
+        m_checkable.erase(m_checkable.begin() + (it - m_ids.begin()));
+        m_ids.erase(it);
+        Invalidate();
+    }
+
+    void
+    AddToolBar(wxToolBar* toolbar)
+    {
+        if (std::find(m_toolbars.begin(), m_toolbars.end(), toolbar) == m_toolbars.end()) {
+            m_toolbars.push_back(toolbar);
+            toolbar->Bind(wxEVT_DESTROY, &wxd_UpdateUIAggregator_t::OnToolBarDestroy, this);
+            Invalidate();
+        }
+    }
+
+    void
+    SetInterval(int interval_ms)
+    {
+        m_interval_ms = std::max(interval_ms, 1);
+        if (m_window)
+            Start(m_interval_ms);
+    }
+
+    // Forget the applied state so the next pass pushes every item again.
+    void
+    Invalidate()
+    {
+        m_applied_enabled.clear();
+        m_applied_checked.clear();
+    }
+
+    // One collection pass; also run early by wxd_UpdateUIAggregator_UpdateNow.
+    void
+    Notify() override
+    {
+        if (!m_window || !m_callback || m_ids.empty())
+            return;
+        // Hidden or iconized windows show nothing worth refreshing.
+        if (!m_window->IsShownOnScreen())
+            return;
+
+        const size_t bytes = (m_ids.size() + 7) / 8;
+        m_enabled.assign(bytes, 0);
+        m_checked.assign(bytes, 0);
+        m_callback(m_user_data, m_ids.data(), m_ids.size(), m_enabled.data(), m_checked.data());
+
+        const bool full = m_applied_enabled.size() != bytes;
+        if (!full && m_enabled == m_applied_enabled && m_checked == m_applied_checked)
+            return;
+
+        wxMenuBar* menubar = nullptr;
+        if (wxFrame* frame = wxDynamicCast(m_window, wxFrame)) {
+            menubar = frame->GetMenuBar();
+            wxToolBar* toolbar = frame->GetToolBar();
+            if (toolbar && std::find(m_toolbars.begin(), m_toolbars.end(), toolbar) ==
+                               m_toolbars.end())
+                m_frame_toolbar = toolbar;
+            else
+                m_frame_toolbar = nullptr;
+        }
+
+        for (size_t i = 0; i < m_ids.size(); ++i) {
+            const uint8_t mask = static_cast<uint8_t>(1u << (i % 8));
+            const bool enabled = (m_enabled[i / 8] & mask) != 0;
+            const bool checked = (m_checked[i / 8] & mask) != 0;
+            const bool enabled_changed =
+                full || ((m_applied_enabled[i / 8] ^ m_enabled[i / 8]) & mask) != 0;
+            const bool checked_changed = m_checkable[i] &&
+                (full || ((m_applied_checked[i / 8] ^ m_checked[i / 8]) & mask) != 0);
+            if (enabled_changed || checked_changed)
+                Apply(menubar, m_ids[i], enabled_changed, enabled, checked_changed, checked);
+        }
+
+        m_applied_enabled.swap(m_enabled);
+        m_applied_checked.swap(m_checked);
+    }
+
+private:
+    void
+    Apply(wxMenuBar* menubar, int id, bool set_enabled, bool enabled, bool set_checked,
+          bool checked)
+    {
+        if (menubar) {
+            if (wxMenuItem* item = menubar->FindItem(id)) {
+                if (set_enabled && item->IsEnabled() != enabled)
+                    item->Enable(enabled);
+                if (set_checked && item->IsCheckable() && item->IsChecked() != checked)
+                    item->Check(checked);
+            }
+        }
+        if (m_frame_toolbar)
+            ApplyTool(m_frame_toolbar, id, set_enabled, enabled, set_checked, checked);
+        for (wxToolBar* toolbar : m_toolbars)
+            ApplyTool(toolbar, id, set_enabled, enabled, set_checked, checked);
+    }
+
+    static void
+    ApplyTool(wxToolBar* toolbar, int id, bool set_enabled, bool enabled, bool set_checked,
+              bool checked)
+    {
+        wxToolBarToolBase* tool = toolbar->FindById(id);
+        if (!tool)
+            return;
+        if (set_enabled && tool->IsEnabled() != enabled)
+            toolbar->EnableTool(id, enabled);
+        if (set_checked && tool->CanBeToggled() && tool->IsToggled() != checked)
+            toolbar->ToggleTool(id, checked);
+    }
+
+    // Stop polling and release the Rust state; the handle itself stays valid until
+    // wxd_UpdateUIAggregator_Destroy.
+    void
+    Detach()
+    {
+        Stop();
+        if (m_window) {
+            m_window->Unbind(wxEVT_DESTROY, &wxd_UpdateUIAggregator_t::OnWindowDestroy, this);
+            m_window = nullptr;
+        }
+        for (wxToolBar* toolbar : m_toolbars)
+            toolbar->Unbind(wxEVT_DESTROY, &wxd_UpdateUIAggregator_t::OnToolBarDestroy, this);
+        m_toolbars.clear();
+        m_frame_toolbar = nullptr;
+        if (m_free_user_data)
+            m_free_user_data(m_user_data);
+        m_free_user_data = nullptr;
+        m_callback = nullptr;
+        m_user_data = nullptr;
+    }
+
+    void
+    OnWindowDestroy(wxWindowDestroyEvent& event)
+    {
+        event.Skip();
+        if (m_window && event.GetEventObject() == m_window)
+            Detach();
+    }
+
+    void
+    OnToolBarDestroy(wxWindowDestroyEvent& event)
+    {
+        event.Skip();
+        wxObject* object = event.GetEventObject();
+        m_toolbars.erase(std::remove(m_toolbars.begin(), m_toolbars.end(), object),
+                         m_toolbars.end());
+        if (m_frame_toolbar == object)
+            m_frame_toolbar = nullptr;
+    }
+
+    wxWindow* m_window;
+    int m_interval_ms;
+    wxd_UpdateUIAggregator_Callback m_callback;
+    void* m_user_data;
+    wxd_UpdateUIAggregator_FreeUserData m_free_user_data;
+
+    // Sorted ids; bit i of each bitset belongs to m_ids[i].
+    std::vector<int> m_ids;
+    std::vector<bool> m_checkable;
+    std::vector<wxToolBar*> m_toolbars;
+    wxToolBar* m_frame_toolbar = nullptr;
+
+    std::vector<uint8_t> m_enabled;
+    std::vector<uint8_t> m_checked;
+    std::vector<uint8_t> m_applied_enabled;
+    std::vector<uint8_t> m_applied_checked;
+};
+
+extern "C" {
+
+WXD_EXPORTED wxd_UpdateUIAggregator_t*
+wxd_UpdateUIAggregator_Create(wxd_Window_t* window, int interval_ms,
+                              wxd_UpdateUIAggregator_Callback callback, void* user_data,
+                              wxd_UpdateUIAggregator_FreeUserData free_user_data)
+{
+    if (!window || !callback) {
+        if (free_user_data)
+            free_user_data(user_data);
+        return nullptr;
+    }
+    return new wxd_UpdateUIAggregator_t(reinterpret_cast<wxWindow*>(window), interval_ms,
+                                        callback, user_data, free_user_data);
+}
+
+WXD_EXPORTED void
+wxd_UpdateUIAggregator_Destroy(wxd_UpdateUIAggregator_t* aggregator)
+{
+    delete aggregator;
+}
+
+WXD_EXPORTED void
+wxd_UpdateUIAggregator_Register(wxd_UpdateUIAggregator_t* aggregator, wxd_Id id, bool checkable)
+{
+    if (aggregator)
+        aggregator->Register(id, checkable);
+}
+
+WXD_EXPORTED void
+wxd_UpdateUIAggregator_Unregister(wxd_UpdateUIAggregator_t* aggregator, wxd_Id id)
+{
+    if (aggregator)
+        aggregator->Unregister(id);
+}
+
+WXD_EXPORTED void
+wxd_UpdateUIAggregator_AddToolBar(wxd_UpdateUIAggregator_t* aggregator, wxd_ToolBar_t* toolbar)
+{
+    if (aggregator && toolbar)
+        aggregator->AddToolBar(reinterpret_cast<wxToolBar*>(toolbar));
+}
+
+WXD_EXPORTED void
+wxd_UpdateUIAggregator_SetInterval(wxd_UpdateUIAggregator_t* aggregator, int interval_ms)
+{
+    if (aggregator)
+        aggregator->SetInterval(interval_ms);
+}
+
+WXD_EXPORTED void
+wxd_UpdateUIAggregator_UpdateNow(wxd_UpdateUIAggregator_t* aggregator, bool force)
+{
+    if (!aggregator)
+        return;
+    if (force)
+        aggregator->Invalidate();
+    aggregator->Notify();
+}
+
+} // extern "C"
@@ -0,0 +1,367 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_visibility.h"
+#include <wx/timer.h>
+#include <wx/toplevel.h>
+#ifdef __WXMSW__
+#include <wx/dynlib.h>
+#include <wx/msw/wrapwin.h>
+#endif
+#include <unordered_map>
+
+wxDEFINE_EVENT(wxdEVT_VISIBILITY_CHANGED, wxdVisibilityEvent);
+
+namespace {
+
+#ifdef __WXMSW__
+// DWM has no change notification for cloaking, so it is polled at this rate while shown.
+constexpr int kCloakPollMs = 1000;
+
+bool
+is_cloaked(wxWindow* tlw)
+{
+    typedef HRESULT(WINAPI * GetWindowAttributeFn)(HWND, DWORD, PVOID, DWORD);
+    static GetWindowAttributeFn get_attribute = []() -> GetWindowAttributeFn {
+        static wxDynamicLibrary dwm(wxT("dwmapi.dll"), wxDL_VERBATIM | wxDL_QUIET);
+        if (!dwm.IsLoaded())
+            return nullptr;
+        return reinterpret_cast<GetWindowAttributeFn>(dwm.GetSymbol(wxT("DwmGetWindowAttribute")));
+    }();
+    if (!get_attribute)
+        return false;
+    DWORD cloaked = 0;
+    const DWORD kDwmwaCloaked = 14; // DWMWA_CLOAKED, Windows 8+
+    return SUCCEEDED(get_attribute(static_cast<HWND>(tlw->GetHWND()), kDwmwaCloaked, &cloaked,
+                                   sizeof(cloaked))) &&
+           cloaked != 0;
+}
+#endif
+
+// Timers slowed down while their top-level window is hidden.
+struct HiddenTimer {
+    wxWindow* tlw;
+    int hidden_ms;
+    int normal_ms = 0;
+    bool slowed = false;
+};
+
+// GUI-thread only.
+std::unordered_map<wxTimer*, HiddenTimer> s_hidden_timers;
+
+// Number of trackers that pause refreshes and are currently hidden; refresh_allowed() returns
+// at once while it is zero.
+int s_paused_hidden = 0;
+
+class VisibilityTracker;
+std::unordered_map<wxWindow*, VisibilityTracker*> s_trackers;
+
+// Follows one top-level window. Owned through s_trackers and deleted with the window.
+class VisibilityTracker {
+public:
+    explicit VisibilityTracker(wxWindow* tlw) : m_tlw(tlw)
+    {
+        wxTopLevelWindow* frame = wxDynamicCast(tlw, wxTopLevelWindow);
+        m_iconized = frame && frame->IsIconized();
+        tlw->Bind(wxEVT_ICONIZE, &VisibilityTracker::OnIconize, this);
+        tlw->Bind(wxEVT_SHOW, &VisibilityTracker::OnShow, this);
+        tlw->Bind(wxEVT_ACTIVATE, &VisibilityTracker::OnActivate, this);
+#ifdef __WXMSW__
+        m_poll.Bind(wxEVT_TIMER, [this](wxTimerEvent&) { Update(); });
+#endif
+#ifdef __WXOSX__
+        m_observer = wxd_visibility::osx_observe_occlusion(
+            tlw, [](void* ctx) { static_cast<VisibilityTracker*>(ctx)->Update(); }, this);
+#endif
+        m_reasons = Compute();
+        UpdatePolling();
+    }
+
+    // Only runs while the window is being destroyed, so nothing is refreshed or unbound.
+    ~VisibilityTracker()
+    {
+        if (m_pauseRefresh && m_reasons)
+            --s_paused_hidden;
+#ifdef __WXMSW__
+        m_poll.Stop();
+#endif
+#ifdef __WXOSX__
+        if (m_observer)
+            wxd_visibility::osx_stop_observing(m_observer);
+#endif
+        for (auto it = s_hidden_timers.begin(); it != s_hidden_timers.end();) {
+            if (it->second.tlw == m_tlw)
+                it = s_hidden_timers.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    uint32_t
+    Reasons() const
+    {
+        return m_reasons;
+    }
+
+    void
+    SetPauseRefresh(bool pause)
+    {
+        if (pause == m_pauseRefresh)
+            return;
+        if (m_reasons)
+            s_paused_hidden += pause ? 1 : -1;
+        m_pauseRefresh = pause;
+        if (!pause)
+            Resume();
+    }
+
+    bool
+    RefreshAllowed()
+    {
+        if (!m_pauseRefresh || !m_reasons)
+            return true;
+        m_dirty = true;
+        return false;
+    }
+
+    // Applies the hidden interval to a timer registered while the window is already hidden.
+    void
+    ApplyToTimer(wxTimer* timer, HiddenTimer& entry) const
+    {
+        if (m_reasons)
+            Slow(timer, entry);
+    }
+
+    static void
+    Restore(wxTimer* timer, HiddenTimer& entry)
+    {
+        if (entry.slowed && timer->IsRunning() && timer->GetInterval() == entry.hidden_ms)
+            timer->Start(entry.normal_ms, wxTIMER_CONTINUOUS);
+        entry.slowed = false;
+    }
+
+    void
+    Update()
+    {
+        const uint32_t reasons = Compute();
+        UpdatePolling();
+        if (reasons == m_reasons)
+            return;
+        const bool was_hidden = m_reasons != 0;
+        const bool hidden = reasons != 0;
+        m_reasons = reasons;
+        if (was_hidden != hidden) {
+            if (m_pauseRefresh)
+                s_paused_hidden += hidden ? 1 : -1;
+            for (auto& [timer, entry] : s_hidden_timers) {
+                if (entry.tlw != m_tlw)
+                    continue;
+                if (hidden)
+                    Slow(timer, entry);
+                else
+                    Restore(timer, entry);
+            }
+            if (!hidden)
+                Resume();
+        }
+        wxdVisibilityEvent event(wxdEVT_VISIBILITY_CHANGED, m_tlw->GetId(), reasons);
+        event.SetEventObject(m_tlw);
+        wxQueueEvent(m_tlw, event.Clone());
+    }
+
+private:
+    uint32_t
+    Compute() const
+    {
+        uint32_t reasons = 0;
+        if (!m_shown)
+            reasons |= WXD_HIDDEN_NOT_SHOWN;
+        if (m_iconized)
+            reasons |= WXD_HIDDEN_ICONIZED;
+#ifdef __WXMSW__
+        if (m_shown && !m_iconized && is_cloaked(m_tlw))
+            reasons |= WXD_HIDDEN_OCCLUDED;
+#endif
+#ifdef __WXOSX__
+        if (m_shown && !m_iconized && wxd_visibility::osx_is_occluded(m_tlw))
+            reasons |= WXD_HIDDEN_OCCLUDED;
+#endif
+        return reasons;
+    }
+
+    void
+    UpdatePolling()
+    {
+#ifdef __WXMSW__
+        const bool poll = m_shown && !m_iconized;
+        if (poll && !m_poll.IsRunning())
+            m_poll.Start(kCloakPollMs);
+        else if (!poll && m_poll.IsRunning())
+            m_poll.Stop();
+#endif
+    }
+
+    static void
+    Slow(wxTimer* timer, HiddenTimer& entry)
+    {
+        if (entry.slowed || !timer->IsRunning() || timer->IsOneShot())
+            return;
+        entry.normal_ms = timer->GetInterval();
+        if (entry.hidden_ms <= entry.normal_ms)
+            return;
+        timer->Start(entry.hidden_ms, wxTIMER_CONTINUOUS);
+        entry.slowed = true;
+    }
+
+    void
+    Resume()
+    {
+        if (m_dirty) {
+            m_dirty = false;
+            m_tlw->Refresh(false);
+        }
+        wxd_visibility::resume_scheduled_refresh(m_tlw);
+    }
+
+    void
+    OnIconize(wxIconizeEvent& event)
+    {
+        event.Skip();
+        m_iconized = event.IsIconized();
+        Update();
+    }
+
+    void
+    OnShow(wxShowEvent& event)
+    {
+        event.Skip();
+        if (event.GetEventObject() != m_tlw)
+            return;
+        m_shown = event.IsShown();
+        Update();
+    }
+
+    void
+    OnActivate(wxActivateEvent& event)
+    {
+        event.Skip();
+        Update();
+    }
+
+    wxWindow* m_tlw;
+    bool m_shown = m_tlw->IsShown();
+    bool m_iconized = false;
+    uint32_t m_reasons = 0;
+    bool m_pauseRefresh = false;
+    bool m_dirty = false;
+#ifdef __WXMSW__
+    wxTimer m_poll;
+#endif
+#ifdef __WXOSX__
+    void* m_observer = nullptr;
+#endif
+};
+
+void
+on_tracked_tlw_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    auto found = s_trackers.find(static_cast<wxWindow*>(event.GetEventObject()));
+    if (found == s_trackers.end())
+        return;
+    delete found->second;
+    s_trackers.erase(found);
+}
+
+wxWindow*
+top_level_of(wxWindow* window)
+{
+    wxWindow* tlw = wxGetTopLevelParent(window);
+    return tlw ? tlw : window;
+}
+
+VisibilityTracker*
+tracker_for(wxWindow* window)
+{
+    if (!window)
+        return nullptr;
+    wxWindow* tlw = top_level_of(window);
+    auto found = s_trackers.find(tlw);
+    if (found != s_trackers.end())
+        return found->second;
+    if (tlw->IsBeingDeleted())
+        return nullptr;
+    VisibilityTracker* tracker = new VisibilityTracker(tlw);
+    s_trackers[tlw] = tracker;
+    tlw->Bind(wxEVT_DESTROY, &on_tracked_tlw_destroy);
+    return tracker;
+}
+
+} // namespace
+
+namespace wxd_visibility {
+
+bool
+refresh_allowed(wxWindow* window)
+{
+    if (s_paused_hidden == 0 || !window)
+        return true;
+    auto found = s_trackers.find(top_level_of(window));
+    return found == s_trackers.end() || found->second->RefreshAllowed();
+}
+
+void
+forget_timer(wxTimer* timer)
+{
+    s_hidden_timers.erase(timer);
+}
+
+} // namespace wxd_visibility
+
+WXD_EXPORTED bool
+wxd_Window_IsEffectivelyVisible(wxd_Window_t* window)
+{
+    wxWindow* win = reinterpret_cast<wxWindow*>(window);
+    VisibilityTracker* tracker = tracker_for(win);
+    return tracker && tracker->Reasons() == 0 && win->IsShownOnScreen();
+}
+
+WXD_EXPORTED uint32_t
+wxd_Window_GetHiddenReasons(wxd_Window_t* window)
+{
+    VisibilityTracker* tracker = tracker_for(reinterpret_cast<wxWindow*>(window));
+    return tracker ? tracker->Reasons() : WXD_HIDDEN_NOT_SHOWN;
+}
+
+WXD_EXPORTED void
+wxd_Window_TrackVisibility(wxd_Window_t* window)
+{
+    tracker_for(reinterpret_cast<wxWindow*>(window));
+}
+
+WXD_EXPORTED void
+wxd_Window_SetPauseRefreshWhenHidden(wxd_Window_t* window, bool pause)
+{
+    if (VisibilityTracker* tracker = tracker_for(reinterpret_cast<wxWindow*>(window)))
+        tracker->SetPauseRefresh(pause);
+}
+
+WXD_EXPORTED void
+wxd_Timer_SetHiddenInterval(wxd_Timer_t* timer, wxd_Window_t* window, int hidden_ms)
+{
+    wxTimer* wx_timer = reinterpret_cast<wxTimer*>(timer);
+    if (!wx_timer)
+        return;
+    auto found = s_hidden_timers.find(wx_timer);
+    if (found != s_hidden_timers.end()) {
+        VisibilityTracker::Restore(wx_timer, found->second);
+        s_hidden_timers.erase(found);
+    }
+    VisibilityTracker* tracker = tracker_for(reinterpret_cast<wxWindow*>(window));
+    if (hidden_ms <= 0 || !tracker)
+        return;
+    HiddenTimer& entry = s_hidden_timers[wx_timer];
+    entry.tlw = top_level_of(reinterpret_cast<wxWindow*>(window));
+    entry.hidden_ms = hidden_ms;
+    tracker->ApplyToTimer(wx_timer, entry);
+}
@@ -0,0 +1,219 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include <wx/vlbox.h>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+constexpr int32_t kUnmeasured = -1;
+
+} // namespace
+
+struct wxd_VListBox : public wxVListBox {
+    wxd_VListBox(wxWindow* parent, wxWindowID id, const wxPoint& pos, const wxSize& size,
+                 long style)
+        : wxVListBox(parent, id, pos, size, style)
+    {
+    }
+
+    ~wxd_VListBox()
+    {
+        if (m_free)
+            m_free(m_user_data);
+    }
+
+    void
+    SetCallbacks(wxd_VListBox_DrawItem draw, wxd_VListBox_MeasureItem measure, void* user_data,
+                 wxd_VListBox_FreeUserData free)
+    {
+        if (m_free)
+            m_free(m_user_data);
+        m_draw = draw;
+        m_measure = measure;
+        m_user_data = user_data;
+        m_free = free;
+        InvalidateHeights();
+    }
+
+    void
+    SetDefaultRowHeight(int height)
+    {
+        m_defaultHeight = height > 0 ? height : 1;
+        if (!m_measure)
+            RefreshAll();
+    }
+
+    void
+    SetCount(size_t count)
+    {
+        m_heights.resize(count, kUnmeasured);
+        SetItemCount(count);
+    }
+
+    void
+    RefreshItemHeight(size_t row)
+    {
+        if (row >= m_heights.size())
+            return;
+        const int32_t old = m_heights[row];
+        m_heights[row] = kUnmeasured;
+        if (old != kUnmeasured && Measure(row) != old)
+            RefreshAll();
+        else
+            RefreshRow(row);
+    }
+
+    void
+    InvalidateHeights()
+    {
+        std::fill(m_heights.begin(), m_heights.end(), kUnmeasured);
+        RefreshAll();
+    }
+
+protected:
+    void
+    OnDrawItem(wxDC& dc, const wxRect& rect, size_t n) const override
+    {
+        if (m_draw)
+            m_draw(m_user_data, reinterpret_cast<wxd_DC_t*>(&dc),
+                   wxd_Rect{ rect.x, rect.y, rect.width, rect.height }, n, IsSelected(n));
+    }
+
+    wxCoord
+    OnMeasureItem(size_t n) const override
+    {
+        return const_cast<wxd_VListBox*>(this)->Measure(n);
+    }
+
+private:
+    int32_t
+    Measure(size_t row)
+    {
+        if (!m_measure)
+            return m_defaultHeight;
+        if (row >= m_heights.size())
+            return m_measure(m_user_data, row);
+        int32_t& height = m_heights[row];
+        if (height == kUnmeasured) {
+            const int measured = m_measure(m_user_data, row);
+            height = measured > 0 ? measured : 1;
+        }
+        return height;
+    }
+
+    std::vector<int32_t> m_heights;
+    int m_defaultHeight = 20;
+    wxd_VListBox_DrawItem m_draw = nullptr;
+    wxd_VListBox_MeasureItem m_measure = nullptr;
+    void* m_user_data = nullptr;
+    wxd_VListBox_FreeUserData m_free = nullptr;
+};
+
+WXD_EXPORTED wxd_VListBox_t*
+wxd_VListBox_Create(wxd_Window_t* parent, int id, int x, int y, int w, int h, int64_t style)
+{
+    wxWindow* p = reinterpret_cast<wxWindow*>(parent);
+    if (!p)
+        return nullptr;
+    wxPoint pos = (x == -1 && y == -1) ? wxDefaultPosition : wxPoint(x, y);
+    wxSize size = (w == -1 && h == -1) ? wxDefaultSize : wxSize(w, h);
+    return new wxd_VListBox(p, id, pos, size, static_cast<long>(style));
+}
+
+WXD_EXPORTED void
+wxd_VListBox_SetCallbacks(wxd_VListBox_t* self, wxd_VListBox_DrawItem draw,
+                          wxd_VListBox_MeasureItem measure, void* user_data,
+                          wxd_VListBox_FreeUserData free_user_data)
+{
+    if (!self) {
+        if (free_user_data)
+            free_user_data(user_data);
+        return;
+    }
+    self->SetCallbacks(draw, measure, user_data, free_user_data);
+}
+
+WXD_EXPORTED void
+wxd_VListBox_SetDefaultRowHeight(wxd_VListBox_t* self, int height)
+{
+    if (self)
+        self->SetDefaultRowHeight(height);
+}
+
+WXD_EXPORTED void
+wxd_VListBox_SetItemCount(wxd_VListBox_t* self, size_t count)
+{
+    if (self)
+        self->SetCount(count);
+}
+
+WXD_EXPORTED size_t
+wxd_VListBox_GetItemCount(const wxd_VListBox_t* self)
+{
+    return self ? self->GetItemCount() : 0;
+}
+
+WXD_EXPORTED void
+wxd_VListBox_RefreshRow(wxd_VListBox_t* self, size_t row)
+{
+    if (self)
+        self->RefreshItemHeight(row);
+}
+
+WXD_EXPORTED void
+wxd_VListBox_InvalidateHeights(wxd_VListBox_t* self)
+{
+    if (self)
+        self->InvalidateHeights();
+}
+
+WXD_EXPORTED int64_t
+wxd_VListBox_GetSelection(const wxd_VListBox_t* self)
+{
+    return self ? static_cast<int64_t>(self->GetSelection()) : -1;
+}
+
+WXD_EXPORTED void
+wxd_VListBox_SetSelection(wxd_VListBox_t* self, int64_t row)
+{
+    if (self)
+        self->SetSelection(static_cast<int>(row));
+}
+
+WXD_EXPORTED bool
+wxd_VListBox_IsSelected(const wxd_VListBox_t* self, size_t row)
+{
+    return self && row < self->GetItemCount() && self->IsSelected(row);
+}
+
+WXD_EXPORTED void
+wxd_VListBox_Select(wxd_VListBox_t* self, size_t row, bool select)
+{
+    if (!self || row >= self->GetItemCount())
+        return;
+    if (self->HasMultipleSelection())
+        self->Select(row, select);
+    else
+        self->SetSelection(select ? static_cast<int>(row) : wxNOT_FOUND);
+}
+
+WXD_EXPORTED void
+wxd_VListBox_ScrollToRow(wxd_VListBox_t* self, size_t row)
+{
+    if (self)
+        self->ScrollToRow(row);
+}
+
+WXD_EXPORTED void
+wxd_VListBox_GetVisibleRows(const wxd_VListBox_t* self, size_t* begin, size_t* end)
+{
+    const size_t first = self ? self->GetVisibleRowsBegin() : 0;
+    const size_t last = self ? self->GetVisibleRowsEnd() : 0;
+    if (begin)
+        *begin = first;
+    if (end)
+        *end = last;
+}
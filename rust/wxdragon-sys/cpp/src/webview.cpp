@@ -12,6 +12,14 @@
 #include "wx/webview.h"
 #include "wx/mstream.h"
 #include "wx/filesys.h"
+#include "wx/base64.h"
+#include "wx/timer.h"
+#include "wx/weakref.h"
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 // Custom scheme handler that bridges wxWebViewHandler::GetFile to a Rust callback.
 // We override GetFile rather than StartRequest because the base StartRequest
@@ -72,8 +80,570 @@ private:
     void* m_userdata;
 };
 
+// Reads a resource in place and hands its token back once the engine has finished with it.
+class WxdBorrowedAssetStream : public wxMemoryInputStream
+{
+public:
+    WxdBorrowedAssetStream(const unsigned char* data, size_t len,
+                           wxd_WebViewMemoryHandler_Release release, void* token)
+        : wxMemoryInputStream(data, len), m_release(release), m_token(token)
+    {
+    }
+
+    ~WxdBorrowedAssetStream() override
+    {
+        if (m_release)
+            m_release(m_token);
+    }
+
+private:
+    wxd_WebViewMemoryHandler_Release m_release;
+    void* m_token;
+};
+
+// Scheme handler serving borrowed memory through WxdBorrowedAssetStream.
+class WxdMemoryWebViewHandler : public wxWebViewHandler
+{
+public:
+    WxdMemoryWebViewHandler(const wxString& scheme, wxd_WebViewMemoryHandler_Resolve resolve,
+                            wxd_WebViewMemoryHandler_Release release,
+                            wxd_WebViewHandler_DropUserdata drop_userdata, void* userdata)
+        : wxWebViewHandler(scheme), m_resolve(resolve), m_release(release),
+          m_dropUserdata(drop_userdata), m_userdata(userdata)
+    {
+    }
+
+    ~WxdMemoryWebViewHandler() override
+    {
+        if (m_dropUserdata)
+            m_dropUserdata(m_userdata);
+    }
+
+    wxFSFile* GetFile(const wxString& uri) override
+    {
+        const unsigned char* data = nullptr;
+        size_t len = 0;
+        const char* mime = nullptr;
+        void* token = nullptr;
+        if (!m_resolve(m_userdata, uri.utf8_str(), &data, &len, &mime, &token))
+            return nullptr;
+
+        static const unsigned char empty = 0;
+        const wxString mimeStr = mime ? wxString::FromUTF8(mime) : wxString();
+        wxInputStream* stream =
+            new WxdBorrowedAssetStream(data && len > 0 ? data : &empty, data ? len : 0,
+                                       m_release, token);
+        return new wxFSFile(stream, uri, mimeStr, wxString()
+#if wxUSE_DATETIME
+                            , wxDateTime::Now()
+#endif
+        );
+    }
+
+private:
+    wxd_WebViewMemoryHandler_Resolve m_resolve;
+    wxd_WebViewMemoryHandler_Release m_release;
+    wxd_WebViewHandler_DropUserdata m_dropUserdata;
+    void* m_userdata;
+};
+
+// RunScriptAsync calls of one webview still waiting for their result. Owned through
+// s_script_runners and deleted with the webview, freeing whatever is left.
+class WxdScriptRunner
+{
+public:
+    struct Call {
+        wxd_WebView_ScriptCallback callback;
+        void* user_data;
+        wxd_WebView_FreeUserData free_user_data;
+    };
+
+    explicit WxdScriptRunner(wxWebView* webview) : m_webview(webview)
+    {
+#if wxCHECK_VERSION(3, 3, 0)
+        webview->Bind(wxEVT_WEBVIEW_SCRIPT_RESULT, &WxdScriptRunner::OnScriptResult, this);
+#endif
+    }
+
+    ~WxdScriptRunner()
+    {
+        for (Call* call : m_pending) {
+            if (call->free_user_data)
+                call->free_user_data(call->user_data);
+            delete call;
+        }
+    }
+
+    void
+    Run(const wxString& script, Call* call)
+    {
+        m_pending.insert(call);
+#if wxCHECK_VERSION(3, 3, 0)
+        m_webview->RunScriptAsync(script, call);
+#else
+        // No async API: at least keep the nested loop out of the caller's stack frame.
+        m_webview->CallAfter([this, script, call]() {
+            wxString result;
+            const bool success = m_webview->RunScript(script, &result);
+            Complete(call, success, result);
+        });
+#endif
+    }
+
+private:
+#if wxCHECK_VERSION(3, 3, 0)
+    void
+    OnScriptResult(wxWebViewEvent& event)
+    {
+        Call* call = static_cast<Call*>(event.GetClientData());
+        if (m_pending.count(call) == 0) {
+            event.Skip();
+            return;
+        }
+        Complete(call, !event.IsError(), event.GetString());
+    }
+#endif
+
+    void
+    Complete(Call* call, bool success, const wxString& result)
+    {
+        if (m_pending.erase(call) == 0)
+            return;
+        call->callback(call->user_data, success, wxd_cpp_utils::make_owned_string(result));
+        if (call->free_user_data)
+            call->free_user_data(call->user_data);
+        delete call;
+    }
+
+    wxWebView* m_webview;
+    std::unordered_set<Call*> m_pending;
+};
+
+// GUI-thread only.
+static std::unordered_map<wxWebView*, WxdScriptRunner*> s_script_runners;
+
+static void
+on_scripted_webview_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    auto found = s_script_runners.find(static_cast<wxWebView*>(event.GetEventObject()));
+    if (found == s_script_runners.end())
+        return;
+    delete found->second;
+    s_script_runners.erase(found);
+}
+
+// Appends `text` to `out` as a double-quoted JavaScript string literal.
+static void
+append_js_string(std::string& out, const char* text, size_t len)
+{
+    static const char hex[] = "0123456789abcdef";
+    out += '"';
+    for (size_t i = 0; i < len; ++i) {
+        const unsigned char c = static_cast<unsigned char>(text[i]);
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += static_cast<char>(c);
+        }
+        else if (c < 0x20) {
+            out += "\\u00";
+            out += hex[c >> 4];
+            out += hex[c & 0xf];
+        }
+        else if (c == 0xe2 && i + 2 < len && static_cast<unsigned char>(text[i + 1]) == 0x80 &&
+                 (static_cast<unsigned char>(text[i + 2]) & 0xfe) == 0xa8) {
+            // U+2028/U+2029 end a statement in older engines.
+            out += (static_cast<unsigned char>(text[i + 2]) == 0xa8) ? "\\u2028" : "\\u2029";
+            i += 2;
+        }
+        else {
+            out += static_cast<char>(c);
+        }
+    }
+    out += '"';
+}
+
+// Page side of a channel; %NAME% and %HANDLER% are JS string literals. Outgoing batches are
+// framed as <utf8 length>:<topic><kind t|b><utf8 length>:<payload>... so the native side can
+// slice them without a JSON parser.
+static const char s_channel_script[] = R"JS((function () {
+    var name = %NAME%, handler = %HANDLER%;
+    var channels = window.wxdChannels = window.wxdChannels || {};
+    if (channels[name]) return;
+    var queue = [], scheduled = false, listeners = [], encoder = new TextEncoder();
+    function toBase64(bytes) {
+        if (bytes.toBase64) return bytes.toBase64();
+        var s = '';
+        for (var i = 0; i < bytes.length; i += 0x8000)
+            s += String.fromCharCode.apply(null, bytes.subarray(i, i + 0x8000));
+        return btoa(s);
+    }
+    function fromBase64(s) {
+        if (Uint8Array.fromBase64) return Uint8Array.fromBase64(s);
+        var bin = atob(s), bytes = new Uint8Array(bin.length);
+        for (var i = 0; i < bin.length; i++) bytes[i] = bin.charCodeAt(i);
+        return bytes;
+    }
+    function flush() {
+        scheduled = false;
+        if (!queue.length) return;
+        var out = '';
+        for (var i = 0; i < queue.length; i++) {
+            var m = queue[i];
+            var size = m[2] === 'b' ? m[1].length : encoder.encode(m[1]).length;
+            out += encoder.encode(m[0]).length + ':' + m[0] + m[2] + size + ':' + m[1];
+        }
+        queue = [];
+        window[handler].postMessage(out);
+    }
+    channels[name] = {
+        post: function (topic, data) {
+            var kind = 't';
+            if (data instanceof ArrayBuffer) data = new Uint8Array(data);
+            if (ArrayBuffer.isView(data)) {
+                data = toBase64(new Uint8Array(data.buffer, data.byteOffset, data.byteLength));
+                kind = 'b';
+            } else {
+                data = String(data);
+            }
+            queue.push([String(topic), data, kind]);
+            if (!scheduled) {
+                scheduled = true;
+                setTimeout(flush, 16);
+            }
+        },
+        flush: flush,
+        addListener: function (listener) { listeners.push(listener); },
+        _deliver: function (batch) {
+            for (var i = 0; i < batch.length; i++) {
+                var data = batch[i][2] ? fromBase64(batch[i][1]) : batch[i][1];
+                for (var j = 0; j < listeners.length; j++) listeners[j](batch[i][0], data);
+            }
+        }
+    };
+})();)JS";
+
+// Both directions of a batched channel, bound to the webview's script message events.
+struct wxd_WebViewChannel {
+    wxd_WebViewChannel(wxWebView* webview, const wxString& name,
+                       wxd_WebViewChannel_Callback callback, void* user_data,
+                       wxd_WebView_FreeUserData free_user_data)
+        : m_webview(webview), m_handler("wxdChannel_" + name), m_callback(callback),
+          m_user_data(user_data), m_free(free_user_data)
+    {
+        std::string literal;
+        const wxScopedCharBuffer name_utf8 = name.utf8_str();
+        append_js_string(literal, name_utf8.data(), name_utf8.length());
+        m_deliver_prefix = "window.wxdChannels[" + literal + "]._deliver([";
+        m_timer.Bind(wxEVT_TIMER, &wxd_WebViewChannel::OnTimer, this);
+        webview->Bind(wxEVT_WEBVIEW_SCRIPT_MESSAGE_RECEIVED, &wxd_WebViewChannel::OnMessage,
+                      this);
+    }
+
+    ~wxd_WebViewChannel()
+    {
+        m_timer.Stop();
+        if (m_webview) {
+            m_webview->Unbind(wxEVT_WEBVIEW_SCRIPT_MESSAGE_RECEIVED,
+                              &wxd_WebViewChannel::OnMessage, this);
+            m_webview->RemoveScriptMessageHandler(m_handler);
+        }
+        if (m_free)
+            m_free(m_user_data);
+    }
+
+    bool
+    Install(const wxString& name)
+    {
+        if (!m_webview->AddScriptMessageHandler(m_handler))
+            return false;
+        std::string name_literal, handler_literal;
+        const wxScopedCharBuffer name_utf8 = name.utf8_str();
+        const wxScopedCharBuffer handler_utf8 = m_handler.utf8_str();
+        append_js_string(name_literal, name_utf8.data(), name_utf8.length());
+        append_js_string(handler_literal, handler_utf8.data(), handler_utf8.length());
+        wxString script = wxString::FromUTF8(s_channel_script);
+        script.Replace("%NAME%", wxString::FromUTF8(name_literal));
+        script.Replace("%HANDLER%", wxString::FromUTF8(handler_literal));
+        m_webview->AddUserScript(script, wxWEBVIEW_INJECT_AT_DOCUMENT_START);
+        // The user script only applies to later loads; install into the current page as well.
+#if wxCHECK_VERSION(3, 3, 0)
+        m_webview->RunScriptAsync(script);
+#else
+        m_webview->RunScript(script);
+#endif
+        return true;
+    }
+
+    void
+    Post(const char* topic, size_t topic_len, const unsigned char* data, size_t data_len,
+         bool binary)
+    {
+        if (!m_webview)
+            return;
+        m_batch += m_batch.empty() ? "[" : ",[";
+        append_js_string(m_batch, topic, topic_len);
+        m_batch += ',';
+        if (binary) {
+            const wxString encoded = wxBase64Encode(data, data_len);
+            m_batch += '"';
+            m_batch += encoded.ToStdString();
+            m_batch += "\",1]";
+        }
+        else {
+            append_js_string(m_batch, reinterpret_cast<const char*>(data), data_len);
+            m_batch += ",0]";
+        }
+        if (!m_timer.IsRunning())
+            m_timer.StartOnce(16);
+    }
+
+    void
+    Flush()
+    {
+        m_timer.Stop();
+        if (m_batch.empty() || !m_webview)
+            return;
+        const wxString script = wxString::FromUTF8(m_deliver_prefix + m_batch + "]);");
+        m_batch.clear();
+#if wxCHECK_VERSION(3, 3, 0)
+        m_webview->RunScriptAsync(script);
+#else
+        m_webview->RunScript(script);
+#endif
+    }
+
+private:
+    // Reads "<digits>:" at `pos`, advancing past the colon.
+    static bool
+    ReadLength(const char* text, size_t len, size_t& pos, size_t& value)
+    {
+        value = 0;
+        const size_t start = pos;
+        while (pos < len && text[pos] >= '0' && text[pos] <= '9')
+            value = value * 10 + static_cast<size_t>(text[pos++] - '0');
+        if (pos == start || pos >= len || text[pos] != ':')
+            return false;
+        ++pos;
+        return true;
+    }
+
+    void
+    OnMessage(wxWebViewEvent& event)
+    {
+        if (event.GetMessageHandler() != m_handler) {
+            event.Skip();
+            return;
+        }
+        const wxScopedCharBuffer utf8 = event.GetString().utf8_str();
+        const char* text = utf8.data();
+        const size_t len = utf8.length();
+
+        std::vector<wxd_WebViewChannelMessage> messages;
+        std::vector<wxMemoryBuffer> decoded;
+        size_t pos = 0;
+        while (pos < len) {
+            wxd_WebViewChannelMessage message = {};
+            size_t topic_len = 0, data_len = 0;
+            if (!ReadLength(text, len, pos, topic_len) || topic_len > len - pos)
+                break;
+            message.topic = text + pos;
+            message.topic_len = topic_len;
+            pos += topic_len;
+            if (pos >= len)
+                break;
+            message.binary = text[pos++] == 'b';
+            if (!ReadLength(text, len, pos, data_len) || data_len > len - pos)
+                break;
+            if (message.binary) {
+                decoded.push_back(wxBase64Decode(text + pos, data_len));
+                message.data = static_cast<const unsigned char*>(decoded.back().GetData());
+                message.data_len = decoded.back().GetDataLen();
+            }
+            else {
+                message.data = reinterpret_cast<const unsigned char*>(text + pos);
+                message.data_len = data_len;
+            }
+            pos += data_len;
+            messages.push_back(message);
+        }
+        if (pos < len)
+            WXD_LOG_ERROR("wxd_WebViewChannel: malformed batch from the page was truncated");
+        // wxMemoryBuffer is reference counted, so the views stay valid as `decoded` grows.
+        if (!messages.empty())
+            m_callback(m_user_data, messages.data(), messages.size());
+    }
+
+    void
+    OnTimer(wxTimerEvent&)
+    {
+        Flush();
+    }
+
+    wxWeakRef<wxWebView> m_webview;
+    wxString m_handler;
+    wxd_WebViewChannel_Callback m_callback;
+    void* m_user_data;
+    wxd_WebView_FreeUserData m_free;
+    wxTimer m_timer;
+    std::string m_deliver_prefix;
+    std::string m_batch;
+};
+
+// Hidden frame holding the warm webview; it must not keep the application running.
+class WxdWebViewPrewarmFrame : public wxFrame
+{
+public:
+    WxdWebViewPrewarmFrame()
+        : wxFrame(nullptr, wxID_ANY, wxEmptyString, wxDefaultPosition, wxSize(1, 1),
+                  wxFRAME_NO_TASKBAR | wxFRAME_TOOL_WINDOW)
+    {
+    }
+
+    bool ShouldPreventAppExit() const override { return false; }
+};
+
+// State of wxd_WebView_PrewarmAsync. GUI-thread only.
+struct WxdWebViewPrewarm
+{
+    wxString backend;
+#if wxCHECK_VERSION(3, 3, 0)
+    std::unique_ptr<wxWebViewConfiguration> config;
+#endif
+    wxWeakRef<wxFrame> holder;
+    bool done = false;
+    wxd_WebView_PrewarmCallback callback = nullptr;
+    void* user_data = nullptr;
+    wxd_WebView_FreeUserData free_user_data = nullptr;
+
+    ~WxdWebViewPrewarm()
+    {
+        if (free_user_data)
+            free_user_data(user_data);
+    }
+};
+
+static std::unique_ptr<WxdWebViewPrewarm> s_prewarm;
+
+static void
+finish_prewarm(bool success)
+{
+    if (!s_prewarm || s_prewarm->done)
+        return;
+    s_prewarm->done = true;
+    wxd_WebView_PrewarmCallback callback = s_prewarm->callback;
+    void* user_data = s_prewarm->user_data;
+    wxd_WebView_FreeUserData free_user_data = s_prewarm->free_user_data;
+    s_prewarm->free_user_data = nullptr;
+    if (callback)
+        callback(user_data, success);
+    if (free_user_data)
+        free_user_data(user_data);
+}
+
+// Creates `webview` as a child of `parent` with the prewarmed configuration, so it joins the
+// running engine instead of starting its own. False if there is none for `backend`.
+static bool
+create_from_prewarm(wxWebView*& webview, const wxString& backend, wxWindow* parent, wxWindowID id,
+                    const wxString& url, const wxPoint& pos, const wxSize& size, long style,
+                    const wxString& name)
+{
+#if wxCHECK_VERSION(3, 3, 0)
+    if (!s_prewarm || !s_prewarm->config || s_prewarm->backend != backend)
+        return false;
+    webview = wxWebView::New(*s_prewarm->config);
+    if (webview && webview->Create(parent, id, url, pos, size, style, name))
+        return true;
+    delete webview;
+    webview = nullptr;
+#else
+    wxUnusedVar(webview);
+    wxUnusedVar(backend);
+    wxUnusedVar(parent);
+    wxUnusedVar(id);
+    wxUnusedVar(url);
+    wxUnusedVar(pos);
+    wxUnusedVar(size);
+    wxUnusedVar(style);
+    wxUnusedVar(name);
+#endif
+    return false;
+}
+
 extern "C" {
 
+WXD_EXPORTED bool
+wxd_WebView_PrewarmAsync(const char* backend, const char* user_data_dir,
+                         wxd_WebView_PrewarmCallback callback, void* user_data,
+                         wxd_WebView_FreeUserData free_user_data)
+{
+    const wxString backendStr = (!backend || backend[0] == '\0') ? wxString(wxWebViewBackendDefault)
+                                                                : wxString::FromUTF8(backend);
+    if (s_prewarm || !wxTheApp || !wxWebView::IsBackendAvailable(backendStr)) {
+        if (free_user_data)
+            free_user_data(user_data);
+        return false;
+    }
+    s_prewarm.reset(new WxdWebViewPrewarm);
+    s_prewarm->backend = backendStr;
+    s_prewarm->callback = callback;
+    s_prewarm->user_data = user_data;
+    s_prewarm->free_user_data = free_user_data;
+
+    wxFrame* holder = new WxdWebViewPrewarmFrame();
+    s_prewarm->holder = holder;
+    wxWebView* webview = nullptr;
+#if wxCHECK_VERSION(3, 3, 0)
+    s_prewarm->config.reset(new wxWebViewConfiguration(wxWebView::NewConfiguration(backendStr)));
+    if (user_data_dir && user_data_dir[0] != '\0')
+        s_prewarm->config->SetDataPath(wxString::FromUTF8(user_data_dir));
+    webview = wxWebView::New(*s_prewarm->config);
+    if (webview && !webview->Create(holder, wxID_ANY, "about:blank")) {
+        delete webview;
+        webview = nullptr;
+    }
+#else
+    wxUnusedVar(user_data_dir);
+    webview = wxWebView::New(holder, wxID_ANY, "about:blank", wxDefaultPosition, wxDefaultSize,
+                             backendStr);
+#endif
+    if (!webview) {
+        holder->CallAfter([] { finish_prewarm(false); });
+        return true;
+    }
+    // Edge reports the engine ready with CREATED, before its first load; the other backends
+    // create it synchronously and are warm once the blank page has loaded.
+    webview->Bind(wxEVT_WEBVIEW_CREATED, [](wxWebViewEvent& event) {
+        event.Skip();
+        finish_prewarm(true);
+    });
+    webview->Bind(wxEVT_WEBVIEW_LOADED, [](wxWebViewEvent& event) {
+        event.Skip();
+        finish_prewarm(true);
+    });
+    webview->Bind(wxEVT_WEBVIEW_ERROR, [](wxWebViewEvent& event) {
+        event.Skip();
+        finish_prewarm(false);
+    });
+    return true;
+}
+
+WXD_EXPORTED bool
+wxd_WebView_IsPrewarmed(void)
+{
+    return s_prewarm && s_prewarm->done && s_prewarm->holder.get() != nullptr;
+}
+
+WXD_EXPORTED void
+wxd_WebView_ReleasePrewarm(void)
+{
+    if (!s_prewarm)
+        return;
+    if (s_prewarm->holder)
+        s_prewarm->holder->Destroy();
+    s_prewarm->holder = nullptr;
+}
+
 WXD_EXPORTED wxd_WebView_t*
 wxd_WebView_Create(wxd_Window_t* parent, wxd_Id id, const char* url, wxd_Point pos, wxd_Size size,
                    long style, const char* name, const char* backend)
@@ -86,9 +656,13 @@ wxd_WebView_Create(wxd_Window_t* parent, wxd_Id id, const char* url, wxd_Point p
     // On macOS/Linux, wxWebViewBackendDefault is "wxWebViewWebKit"
     wxString backendStr = (!backend || backend[0] == '\0') ? wxWebViewBackendDefault : wxString::FromUTF8(backend);
 
-    wxWebView* webview = wxWebView::New(parentWin, id, urlStr, wxd_cpp_utils::to_wx(pos),
-                                        wxd_cpp_utils::to_wx(size), backendStr, style,
-                                        nameStr);
+    const wxPoint position = wxd_cpp_utils::to_wx(pos, parentWin);
+    const wxSize extent = wxd_cpp_utils::to_wx(size, parentWin);
+    wxWebView* webview = nullptr;
+    if (!create_from_prewarm(webview, backendStr, parentWin, id, urlStr, position, extent, style,
+                             nameStr))
+        webview = wxWebView::New(parentWin, id, urlStr, position, extent, backendStr, style,
+                                 nameStr);
 
     return (wxd_WebView_t*)webview;
 }
@@ -195,6 +769,15 @@ wxd_WebView_GetPageSource(wxd_WebView_t* self, char* buffer, int len)
     return wxd_cpp_utils::copy_wxstring_to_buffer(webview->GetPageSource(), buffer, len);
 }
 
+WXD_EXPORTED wxd_String_t*
+wxd_WebView_GetPageSourceOwned(wxd_WebView_t* self)
+{
+    wxWebView* webview = (wxWebView*)self;
+    if (!webview)
+        return nullptr;
+    return wxd_cpp_utils::make_owned_string(webview->GetPageSource());
+}
+
 WXD_EXPORTED int
 wxd_WebView_GetPageText(wxd_WebView_t* self, char* buffer, int len)
 {
@@ -303,6 +886,27 @@ wxd_WebView_RunScript(wxd_WebView_t* self, const char* javascript, char* output,
     return 0;
 }
 
+WXD_EXPORTED bool
+wxd_WebView_RunScriptAsync(wxd_WebView_t* self, const char* javascript,
+                           wxd_WebView_ScriptCallback callback, void* user_data,
+                           wxd_WebView_FreeUserData free_user_data)
+{
+    wxWebView* webview = (wxWebView*)self;
+    if (!webview || !javascript || !callback) {
+        if (free_user_data)
+            free_user_data(user_data);
+        return false;
+    }
+    WxdScriptRunner*& runner = s_script_runners[webview];
+    if (!runner) {
+        runner = new WxdScriptRunner(webview);
+        webview->Bind(wxEVT_DESTROY, &on_scripted_webview_destroy);
+    }
+    runner->Run(wxString::FromUTF8(javascript),
+                new WxdScriptRunner::Call{ callback, user_data, free_user_data });
+    return true;
+}
+
 WXD_EXPORTED bool
 wxd_WebView_CanCut(wxd_WebView_t* self)
 {
@@ -633,6 +1237,49 @@ wxd_WebView_RemoveScriptMessageHandler(wxd_WebView_t* self, const char* name)
     return webview->RemoveScriptMessageHandler(nameStr);
 }
 
+WXD_EXPORTED wxd_WebViewChannel_t*
+wxd_WebViewChannel_Create(wxd_WebView_t* webview, const char* name,
+                          wxd_WebViewChannel_Callback callback, void* user_data,
+                          wxd_WebView_FreeUserData free_user_data)
+{
+    wxWebView* view = (wxWebView*)webview;
+    if (!view || !name || !callback) {
+        if (free_user_data)
+            free_user_data(user_data);
+        return nullptr;
+    }
+    const wxString nameStr = wxString::FromUTF8(name);
+    wxd_WebViewChannel* channel =
+        new wxd_WebViewChannel(view, nameStr, callback, user_data, free_user_data);
+    if (!channel->Install(nameStr)) {
+        delete channel;
+        return nullptr;
+    }
+    return channel;
+}
+
+WXD_EXPORTED void
+wxd_WebViewChannel_Destroy(wxd_WebViewChannel_t* channel)
+{
+    delete channel;
+}
+
+WXD_EXPORTED void
+wxd_WebViewChannel_Post(wxd_WebViewChannel_t* channel, const char* topic, size_t topic_len,
+                        const unsigned char* data, size_t data_len, bool binary)
+{
+    if (!channel || (!topic && topic_len > 0) || (!data && data_len > 0))
+        return;
+    channel->Post(topic ? topic : "", topic_len, data, data_len, binary);
+}
+
+WXD_EXPORTED void
+wxd_WebViewChannel_Flush(wxd_WebViewChannel_t* channel)
+{
+    if (channel)
+        channel->Flush();
+}
+
 WXD_EXPORTED bool
 wxd_WebView_AddUserScript(wxd_WebView_t* self, const char* javascript, int injectionTime)
 {
@@ -672,6 +1319,23 @@ wxd_WebView_RegisterHandler(wxd_WebView_t* self, const char* scheme,
         new WxdRustWebViewHandler(schemeStr, callback, free_data, drop_userdata, userdata)));
 }
 
+WXD_EXPORTED void
+wxd_WebView_RegisterMemoryHandler(wxd_WebView_t* self, const char* scheme,
+                                  wxd_WebViewMemoryHandler_Resolve resolve,
+                                  wxd_WebViewMemoryHandler_Release release,
+                                  wxd_WebViewHandler_DropUserdata drop_userdata, void* userdata)
+{
+    wxWebView* webview = (wxWebView*)self;
+    if (!webview || !scheme || !resolve) {
+        if (drop_userdata)
+            drop_userdata(userdata);
+        return;
+    }
+
+    webview->RegisterHandler(wxSharedPtr<wxWebViewHandler>(new WxdMemoryWebViewHandler(
+        wxString::FromUTF8(scheme), resolve, release, drop_userdata, userdata)));
+}
+
 // Native Backend
 WXD_EXPORTED void*
 wxd_WebView_GetNativeBackend(wxd_WebView_t* self)
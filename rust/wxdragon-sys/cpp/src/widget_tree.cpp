@@ -0,0 +1,270 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_window_timing.h"
+#include <wx/wupdlock.h>
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+struct TreeNode {
+    uint8_t kind = 0;
+    int32_t id = wxID_ANY;
+    int64_t style = 0;
+    int32_t width = -1;
+    int32_t height = -1;
+    int32_t proportion = 0;
+    int32_t sizer_flags = 0;
+    int32_t border = 0;
+    const char* label = nullptr;
+    uint32_t label_len = 0;
+    const char* tooltip = nullptr;
+    uint32_t tooltip_len = 0;
+    std::vector<size_t> children;
+};
+
+bool
+is_sizer_kind(uint8_t kind)
+{
+    return kind == WXD_WIDGET_TREE_BOX_SIZER || kind == WXD_WIDGET_TREE_STATIC_BOX_SIZER;
+}
+
+bool
+is_window_kind(uint8_t kind)
+{
+    return kind >= WXD_WIDGET_TREE_PANEL && kind <= WXD_WIDGET_TREE_TEXT_CTRL;
+}
+
+// Validates the whole blob up front so a malformed description creates nothing.
+class TreeReader {
+public:
+    TreeReader(const uint8_t* data, size_t len) : m_data(data), m_len(len) {}
+
+    bool
+    Read(std::vector<TreeNode>& nodes)
+    {
+        return ReadNode(nodes, 0, 0) && m_pos == m_len;
+    }
+
+private:
+    // Deep enough for any real dialog, shallow enough to keep recursion off the stack limit.
+    static constexpr int kMaxDepth = 128;
+    // Fixed-size fields of a node: kind, id, style, size, sizer item, the two lengths, count.
+    static constexpr size_t kMinNodeSize = 1 + 4 + 8 + 4 * 5 + 4 * 3;
+
+    template<typename T>
+    bool
+    Scalar(T& out)
+    {
+        if (m_len - m_pos < sizeof(T))
+            return false;
+        // Assemble little-endian bytes explicitly; the blob is not aligned.
+        uint64_t value = 0;
+        for (size_t i = 0; i < sizeof(T); ++i)
+            value |= uint64_t(m_data[m_pos + i]) << (8 * i);
+        m_pos += sizeof(T);
+        const std::make_unsigned_t<T> bits = static_cast<std::make_unsigned_t<T>>(value);
+        std::memcpy(&out, &bits, sizeof(T));
+        return true;
+    }
+
+    bool
+    Text(const char*& out, uint32_t& len)
+    {
+        if (!Scalar(len) || m_len - m_pos < len)
+            return false;
+        out = reinterpret_cast<const char*>(m_data + m_pos);
+        m_pos += len;
+        return true;
+    }
+
+    bool
+    ReadNode(std::vector<TreeNode>& nodes, int depth, uint8_t parent_kind)
+    {
+        if (depth > kMaxDepth)
+            return false;
+        TreeNode node;
+        uint32_t child_count = 0;
+        if (!Scalar(node.kind) || !Scalar(node.id) || !Scalar(node.style) ||
+            !Scalar(node.width) || !Scalar(node.height) || !Scalar(node.proportion) ||
+            !Scalar(node.sizer_flags) || !Scalar(node.border) ||
+            !Text(node.label, node.label_len) || !Text(node.tooltip, node.tooltip_len) ||
+            !Scalar(child_count)) {
+            return false;
+        }
+
+        const bool sizer = is_sizer_kind(node.kind);
+        if (!sizer && !is_window_kind(node.kind) && node.kind != WXD_WIDGET_TREE_SPACER)
+            return false;
+        // Spacers only exist inside sizers; windows hold at most their own sizer.
+        if (node.kind == WXD_WIDGET_TREE_SPACER && (parent_kind == 0 || child_count != 0))
+            return false;
+        if (!sizer && child_count > 1)
+            return false;
+        // Rejects absurd counts before anything is reserved.
+        if (child_count > (m_len - m_pos) / kMinNodeSize)
+            return false;
+
+        const size_t index = nodes.size();
+        nodes.push_back(std::move(node));
+        for (uint32_t i = 0; i < child_count; ++i) {
+            const size_t child = nodes.size();
+            if (!ReadNode(nodes, depth + 1, nodes[index].kind))
+                return false;
+            if (!sizer && !is_sizer_kind(nodes[child].kind))
+                return false;
+            nodes[index].children.push_back(child);
+        }
+        return true;
+    }
+
+    const uint8_t* m_data;
+    size_t m_len;
+    size_t m_pos = 0;
+};
+
+wxString
+node_text(const char* text, uint32_t len)
+{
+    return len ? wxString::FromUTF8(text, len) : wxString();
+}
+
+class TreeBuilder {
+public:
+    explicit TreeBuilder(const std::vector<TreeNode>& nodes)
+        : m_nodes(nodes), m_handles(nodes.size(), nullptr)
+    {
+    }
+
+    const std::vector<void*>&
+    Build(wxWindow* parent)
+    {
+        const TreeNode& root = m_nodes[0];
+        if (is_sizer_kind(root.kind))
+            parent->SetSizer(BuildSizer(0, parent), true);
+        else
+            BuildWindow(0, parent);
+        return m_handles;
+    }
+
+private:
+    wxSize
+    NodeSize(const TreeNode& node, wxWindow* dip_source) const
+    {
+        if (node.width == -1 && node.height == -1)
+            return wxDefaultSize;
+        return dip_source->FromDIP(wxSize(node.width, node.height));
+    }
+
+    wxWindow*
+    BuildWindow(size_t index, wxWindow* parent)
+    {
+        const TreeNode& node = m_nodes[index];
+        const wxString label = node_text(node.label, node.label_len);
+        const wxSize size = NodeSize(node, parent);
+        const long style = static_cast<long>(node.style);
+        wxWindow* window = nullptr;
+        switch (node.kind) {
+        case WXD_WIDGET_TREE_PANEL:
+            window = new wxPanel(parent, node.id, wxDefaultPosition, size, style);
+            break;
+        case WXD_WIDGET_TREE_STATIC_TEXT:
+            window = new wxStaticText(parent, node.id, label, wxDefaultPosition, size, style);
+            break;
+        case WXD_WIDGET_TREE_BUTTON:
+            window = new wxButton(parent, node.id, label, wxDefaultPosition, size, style);
+            break;
+        case WXD_WIDGET_TREE_CHECK_BOX:
+            window = new wxCheckBox(parent, node.id, label, wxDefaultPosition, size, style);
+            break;
+        case WXD_WIDGET_TREE_TEXT_CTRL:
+            window = new wxTextCtrl(parent, node.id, label, wxDefaultPosition, size, style);
+            break;
+        }
+        if (node.tooltip_len)
+            window->SetToolTip(node_text(node.tooltip, node.tooltip_len));
+        m_handles[index] = window;
+        if (!node.children.empty())
+            window->SetSizer(BuildSizer(node.children[0], window));
+        return window;
+    }
+
+    wxSizer*
+    BuildSizer(size_t index, wxWindow* owner)
+    {
+        const TreeNode& node = m_nodes[index];
+        const int orient = node.style == wxHORIZONTAL ? wxHORIZONTAL : wxVERTICAL;
+        wxSizer* sizer = nullptr;
+        wxWindow* children_parent = owner;
+        if (node.kind == WXD_WIDGET_TREE_STATIC_BOX_SIZER) {
+            wxStaticBoxSizer* box_sizer =
+                new wxStaticBoxSizer(orient, owner, node_text(node.label, node.label_len));
+            children_parent = box_sizer->GetStaticBox();
+            sizer = box_sizer;
+        }
+        else {
+            sizer = new wxBoxSizer(orient);
+        }
+        m_handles[index] = sizer;
+
+        for (size_t child_index : node.children) {
+            const TreeNode& child = m_nodes[child_index];
+            if (child.kind == WXD_WIDGET_TREE_SPACER) {
+                if (child.proportion > 0)
+                    sizer->AddStretchSpacer(child.proportion);
+                else {
+                    const wxSize size = owner->FromDIP(wxSize(child.width, child.height));
+                    sizer->Add(size.x, size.y, 0, child.sizer_flags, child.border);
+                }
+            }
+            else if (is_sizer_kind(child.kind)) {
+                sizer->Add(BuildSizer(child_index, children_parent), child.proportion,
+                           child.sizer_flags, child.border);
+            }
+            else {
+                sizer->Add(BuildWindow(child_index, children_parent), child.proportion,
+                           child.sizer_flags, child.border);
+            }
+        }
+        return sizer;
+    }
+
+    const std::vector<TreeNode>& m_nodes;
+    std::vector<void*> m_handles;
+};
+
+} // namespace
+
+extern "C" {
+
+WXD_EXPORTED int
+wxd_BuildWidgetTree(wxd_Window_t* parent, const uint8_t* blob, size_t len, void** out_handles,
+                    size_t out_capacity)
+{
+    wxWindow* wx_parent = reinterpret_cast<wxWindow*>(parent);
+    if (!wx_parent || !blob)
+        return -1;
+
+    std::vector<TreeNode> nodes;
+    if (!TreeReader(blob, len).Read(nodes) || nodes.size() > INT_MAX)
+        return -1;
+
+    TreeBuilder builder(nodes);
+    {
+        wxWindowUpdateLocker freeze(wx_parent);
+        const std::vector<void*>& handles = builder.Build(wx_parent);
+        if (out_handles) {
+            const size_t count = std::min(out_capacity, handles.size());
+            std::copy(handles.begin(), handles.begin() + count, out_handles);
+        }
+        wxd_window_timing::Scope timing(WXD_WINDOW_TIMING_LAYOUT, wx_parent);
+        wx_parent->Layout();
+    }
+    return static_cast<int>(nodes.size());
+}
+
+} // extern "C"
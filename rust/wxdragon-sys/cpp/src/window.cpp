@@ -11,6 +11,7 @@
 #include <wx/cursor.h>   // For wxCursor
 #include <wx/textctrl.h> // For wxTextCtrl scrolling
 #include <wx/menu.h>     // For wxCommandEvent wxEVT_MENU
+#include "wxd_window_index.h"
 
 // Conditional includes for optional features
 #if wxdUSE_RICHTEXT
@@ -21,6 +22,172 @@
 #include <wx/stc/stc.h> // For wxStyledTextCtrl scrolling
 #endif
 
+#include "wxd_text_extent.h"
+#include "wxd_window_timing.h"
+#include "wxd_visibility.h"
+#include <wx/weakref.h>
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// Measures with `font` (the window's own if null), through the extent cache when it is enabled.
+wxd_text_extent::Extent
+window_text_extent(wxWindow* window, const char* utf8, size_t len, const wxFont* font)
+{
+    const double scale = window->GetDPIScaleFactor();
+    return wxd_text_extent::measure(font ? *font : window->GetFont(), scale, scale, utf8, len,
+                                    [&](const wxString& text, wxd_text_extent::Extent* out) {
+                                        window->GetTextExtent(text, &out->width, &out->height,
+                                                              &out->descent,
+                                                              &out->external_leading, font);
+                                    });
+}
+
+// Deferred layout work of one top-level window (see wxd_Window_BeginLayoutBatch).
+struct LayoutBatch {
+    enum class Op { SizeHints, Fit, Layout };
+
+    struct Entry {
+        wxWeakRef<wxWindow> window;
+        Op op;
+        int depth;
+    };
+
+    int nesting = 0;
+    std::vector<Entry> entries;
+
+    void
+    Record(wxWindow* window, Op op)
+    {
+        for (const Entry& entry : entries) {
+            if (entry.window == window && entry.op == op)
+                return;
+        }
+        int depth = 0;
+        for (wxWindow* w = window; w && !w->IsTopLevel(); w = w->GetParent())
+            ++depth;
+        entries.push_back(Entry{ window, op, depth });
+    }
+
+    void
+    Commit()
+    {
+        // Children are sized before the parents that fit around them, and parents are laid out
+        // before the children whose size that decides. Window lifetimes are rechecked per entry.
+        std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+            const bool a_fit = a.op != Op::Layout, b_fit = b.op != Op::Layout;
+            if (a_fit != b_fit)
+                return a_fit;
+            return a_fit ? a.depth > b.depth : a.depth < b.depth;
+        });
+        for (const Entry& entry : entries) {
+            wxWindow* window = entry.window.get();
+            if (!window)
+                continue;
+            switch (entry.op) {
+            case Op::SizeHints:
+                if (wxSizer* sizer = window->GetSizer())
+                    sizer->SetSizeHints(window);
+                break;
+            case Op::Fit:
+                window->Fit();
+                break;
+            case Op::Layout: {
+                wxd_window_timing::Scope timing(WXD_WINDOW_TIMING_LAYOUT, window);
+                window->Layout();
+                break;
+            }
+            }
+        }
+        entries.clear();
+    }
+};
+
+// GUI-thread only.
+std::unordered_map<wxWindow*, LayoutBatch> s_layout_batches;
+
+void
+on_batched_window_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    s_layout_batches.erase(static_cast<wxWindow*>(event.GetEventObject()));
+}
+
+// Records `op` if `window` is in a layout batch; returns false if it must run now.
+bool
+defer_layout(wxWindow* window, LayoutBatch::Op op)
+{
+    if (s_layout_batches.empty())
+        return false;
+    auto found = s_layout_batches.find(wxGetTopLevelParent(window));
+    if (found == s_layout_batches.end())
+        return false;
+    found->second.Record(window, op);
+    return true;
+}
+
+// Best size of a leaf control with the inputs it was measured from, used only by the batch
+// query. wx's own cache is left alone, so sizer layout and wxd_Window_GetBestSize still see
+// every invalidation; callers of the batch query whose controls change in other ways (bitmap,
+// value, style, min size) have to call wxd_Window_InvalidateBestSize themselves.
+struct MeasuredSize {
+    wxString label;
+    wxFont font;
+    double scale = 0;
+    unsigned int items = 0;
+    wxSize best;
+};
+
+// GUI-thread only.
+std::unordered_map<wxWindow*, MeasuredSize> s_measured_sizes;
+
+void
+on_measured_window_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    s_measured_sizes.erase(static_cast<wxWindow*>(event.GetEventObject()));
+}
+
+unsigned int
+item_count(wxWindow* window)
+{
+    const wxItemContainerImmutable* items = dynamic_cast<wxItemContainerImmutable*>(window);
+    return items ? items->GetCount() : 0;
+}
+
+wxSize
+measured_best_size(wxWindow* window)
+{
+    // Containers derive their size from their children, which change without notice.
+    if (window->GetSizer() || !window->GetChildren().IsEmpty())
+        return window->GetBestSize();
+
+    const double scale = window->GetDPIScaleFactor();
+    auto found = s_measured_sizes.find(window);
+    if (found != s_measured_sizes.end()) {
+        MeasuredSize& cached = found->second;
+        if (cached.scale == scale && cached.items == item_count(window) &&
+            cached.font == window->GetFont() && cached.label == window->GetLabel()) {
+            return cached.best;
+        }
+    }
+    else {
+        window->Bind(wxEVT_DESTROY, &on_measured_window_destroy);
+    }
+
+    MeasuredSize& entry = s_measured_sizes[window];
+    entry.label = window->GetLabel();
+    entry.font = window->GetFont();
+    entry.scale = scale;
+    entry.items = item_count(window);
+    entry.best = window->GetBestSize();
+    return entry.best;
+}
+
+} // namespace
+
 extern "C" {
 
 // --- General Window Functions ---
@@ -43,7 +210,10 @@ wxd_Window_SetSizerAndFit(wxd_Window_t* window, wxd_Sizer_t* sizer, bool deleteO
     wxWindow* wx_window = reinterpret_cast<wxWindow*>(window);
     wxSizer* wx_sizer = reinterpret_cast<wxSizer*>(sizer);
     if (wx_window && wx_sizer) {
-        wx_window->SetSizerAndFit(wx_sizer, deleteOldSizer);
+        if (defer_layout(wx_window, LayoutBatch::Op::SizeHints))
+            wx_window->SetSizer(wx_sizer, deleteOldSizer);
+        else
+            wx_window->SetSizerAndFit(wx_sizer, deleteOldSizer);
     }
 }
 
@@ -115,7 +285,7 @@ WXD_EXPORTED void
 wxd_Window_Refresh(wxd_Window_t* window, int eraseBackground, const wxd_Rect* rect)
 {
     wxWindow* wx_window = reinterpret_cast<wxWindow*>(window);
-    if (wx_window) {
+    if (wx_window && wxd_visibility::refresh_allowed(wx_window)) {
         if (rect) {
             wx_window->RefreshRect(wxRect(rect->x, rect->y, rect->width, rect->height),
                                    eraseBackground);
@@ -139,7 +309,7 @@ WXD_EXPORTED void
 wxd_Window_Fit(wxd_Window_t* window)
 {
     wxWindow* win = (wxWindow*)window;
-    if (win) {
+    if (win && !defer_layout(win, LayoutBatch::Op::Fit)) {
         win->Fit();
     }
 }
@@ -148,11 +318,39 @@ WXD_EXPORTED void
 wxd_Window_Layout(wxd_Window_t* window)
 {
     wxWindow* win = (wxWindow*)window;
-    if (win) {
+    if (win && !defer_layout(win, LayoutBatch::Op::Layout)) {
+        wxd_window_timing::Scope timing(WXD_WINDOW_TIMING_LAYOUT, win);
         win->Layout();
     }
 }
 
+WXD_EXPORTED void
+wxd_Window_BeginLayoutBatch(wxd_Window_t* window)
+{
+    wxWindow* tlw = wxGetTopLevelParent(reinterpret_cast<wxWindow*>(window));
+    if (!tlw)
+        return;
+    LayoutBatch& batch = s_layout_batches[tlw];
+    if (batch.nesting++ == 0) {
+        tlw->Bind(wxEVT_DESTROY, &on_batched_window_destroy);
+        tlw->Freeze();
+    }
+}
+
+WXD_EXPORTED void
+wxd_Window_EndLayoutBatch(wxd_Window_t* window)
+{
+    wxWindow* tlw = wxGetTopLevelParent(reinterpret_cast<wxWindow*>(window));
+    auto found = tlw ? s_layout_batches.find(tlw) : s_layout_batches.end();
+    if (found == s_layout_batches.end() || --found->second.nesting > 0)
+        return;
+    LayoutBatch batch = std::move(found->second);
+    s_layout_batches.erase(found);
+    tlw->Unbind(wxEVT_DESTROY, &on_batched_window_destroy);
+    batch.Commit();
+    tlw->Thaw();
+}
+
 WXD_EXPORTED wxd_Size
 wxd_Window_GetBestSize(wxd_Window_t* window)
 {
@@ -166,6 +364,32 @@ wxd_Window_GetBestSize(wxd_Window_t* window)
     return result;
 }
 
+WXD_EXPORTED void
+wxd_Window_GetBestSizes(wxd_Window_t* const* windows, size_t count, wxd_Size* out)
+{
+    if (!windows || !out)
+        return;
+    for (size_t i = 0; i < count; ++i) {
+        wxWindow* win = reinterpret_cast<wxWindow*>(windows[i]);
+        const wxSize best = win ? measured_best_size(win) : wxSize(-1, -1);
+        out[i] = wxd_Size{ best.GetWidth(), best.GetHeight() };
+    }
+}
+
+WXD_EXPORTED void
+wxd_Window_InvalidateBestSize(wxd_Window_t* window)
+{
+    wxWindow* win = reinterpret_cast<wxWindow*>(window);
+    if (!win)
+        return;
+    auto found = s_measured_sizes.find(win);
+    if (found != s_measured_sizes.end()) {
+        win->Unbind(wxEVT_DESTROY, &on_measured_window_destroy);
+        s_measured_sizes.erase(found);
+    }
+    win->InvalidateBestSize();
+}
+
 // ADDED: Implementation for wxd_Window_SetToolTip
 WXD_EXPORTED void
 wxd_Window_SetToolTip(wxd_Window_t* window, const char* tipString)
@@ -606,7 +830,7 @@ wxd_Window_FindWindowByName(wxd_Window_t* window, const char* name)
     }
 
     wxString windowName = wxString::FromUTF8(name);
-    wxWindow* child = wx_window->FindWindow(windowName);
+    wxWindow* child = wxd_window_index::find_by_name(wx_window, windowName);
     return reinterpret_cast<wxd_Window_t*>(child);
 }
 
@@ -618,7 +842,7 @@ wxd_Window_FindWindowById(wxd_Window_t* window, int id)
         return nullptr;
     }
 
-    wxWindow* child = wx_window->FindWindow(id);
+    wxWindow* child = wxd_window_index::find_by_id(wx_window, id);
     return reinterpret_cast<wxd_Window_t*>(child);
 }
 
@@ -744,9 +968,9 @@ wxd_Window_GetTextExtent(wxd_Window_t* window, const char* text)
 {
     wxWindow* wx_window = reinterpret_cast<wxWindow*>(window);
     if (wx_window && text) {
-        wxString wx_text = wxString::FromUTF8(text);
-        wxSize size = wx_window->GetTextExtent(wx_text);
-        return { size.GetWidth(), size.GetHeight() };
+        const wxd_text_extent::Extent extent =
+            window_text_extent(wx_window, text, std::strlen(text), nullptr);
+        return { extent.width, extent.height };
     }
     return { 0, 0 }; // Default size if window is null or text is null
 }
@@ -768,18 +992,35 @@ wxd_Window_GetFullTextExtent(wxd_Window_t* window, const char* text, wxd_Size* s
         return;
     }
 
-    wxString wx_text = wxString::FromUTF8(text);
     wxFont* wx_font = font ? reinterpret_cast<wxFont*>(font) : nullptr;
+    const wxd_text_extent::Extent extent =
+        window_text_extent(wx_window, text, std::strlen(text), wx_font);
 
-    int w, h, desc, ext_lead;
-    wx_window->GetTextExtent(wx_text, &w, &h, &desc, &ext_lead, wx_font);
-
-    size->width = w;
-    size->height = h;
+    size->width = extent.width;
+    size->height = extent.height;
     if (descent)
-        *descent = desc;
+        *descent = extent.descent;
     if (external_leading)
-        *external_leading = ext_lead;
+        *external_leading = extent.external_leading;
+}
+
+WXD_EXPORTED void
+wxd_Window_GetTextExtents(wxd_Window_t* window, const char* packed, const uint32_t* offsets,
+                          size_t n, int32_t* widths, int32_t* heights)
+{
+    wxWindow* wx_window = reinterpret_cast<wxWindow*>(window);
+    if (!wx_window || !offsets || (!packed && n > 0 && offsets[n] > offsets[0]))
+        return;
+    for (size_t i = 0; i < n; ++i) {
+        const uint32_t begin = offsets[i];
+        const uint32_t end = std::max(offsets[i + 1], begin);
+        const wxd_text_extent::Extent extent =
+            window_text_extent(wx_window, packed ? packed + begin : "", end - begin, nullptr);
+        if (widths)
+            widths[i] = extent.width;
+        if (heights)
+            heights[i] = extent.height;
+    }
 }
 
 WXD_EXPORTED int
@@ -0,0 +1,223 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include <wx/weakref.h>
+#include "../include/wxdragon.h"
+#include "wxd_window_index.h"
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+// Id and name maps of one window's descendants (itself included). Entries are weak, so
+// destroyed windows drop out on their own; hits are checked against the window's current id or
+// name and position, so renamed or reparented windows are never returned by mistake. New
+// windows are added as their wxEVT_CREATE bubbles up where the port sends one, which also marks
+// the maps stale: the first miss after that rebuilds them once, so windows the events did not
+// cover are found too. Other misses walk the tree like wxWindow::FindWindow.
+struct WindowIndex {
+    wxWindow* root = nullptr;
+    bool stale = false;
+    std::unordered_map<int, wxWeakRef<wxWindow>> by_id;
+    std::unordered_map<std::string, wxWeakRef<wxWindow>> by_name;
+
+    void
+    Add(wxWindow* window)
+    {
+        // Keep the first in pre-order, as FindWindow would return it.
+        auto id = by_id.find(window->GetId());
+        if (id == by_id.end() || !id->second)
+            by_id[window->GetId()] = window;
+        const std::string name(window->GetName().utf8_str());
+        auto named = by_name.find(name);
+        if (named == by_name.end() || !named->second)
+            by_name[name] = window;
+    }
+
+    void
+    Rebuild()
+    {
+        by_id.clear();
+        by_name.clear();
+        stale = false;
+        Walk(root);
+    }
+
+private:
+    void
+    Walk(wxWindow* window)
+    {
+        Add(window);
+        for (wxWindow* child : window->GetChildren())
+            Walk(child);
+    }
+};
+
+std::unordered_map<wxWindow*, WindowIndex>&
+indexes()
+{
+    static std::unordered_map<wxWindow*, WindowIndex> map;
+    return map;
+}
+
+void
+on_index_root_destroy(wxWindowDestroyEvent& event)
+{
+    event.Skip();
+    if (event.GetEventObject() == event.GetWindow())
+        indexes().erase(event.GetWindow());
+}
+
+void
+on_index_child_create(wxWindowCreateEvent& event)
+{
+    event.Skip();
+    wxWindow* created = event.GetWindow();
+    if (!created)
+        return;
+    for (wxWindow* w = created; w; w = w->GetParent()) {
+        auto found = indexes().find(w);
+        if (found != indexes().end()) {
+            found->second.Add(created);
+            found->second.stale = true;
+            return;
+        }
+    }
+}
+
+WindowIndex*
+index_for(wxWindow* window)
+{
+    if (indexes().empty())
+        return nullptr;
+    for (wxWindow* w = window; w; w = w->GetParent()) {
+        auto found = indexes().find(w);
+        if (found != indexes().end())
+            return &found->second;
+    }
+    return nullptr;
+}
+
+bool
+is_within(wxWindow* window, const wxWindow* ancestor)
+{
+    for (; window; window = window->GetParent()) {
+        if (window == ancestor)
+            return true;
+    }
+    return false;
+}
+
+enum class Hit { Found, Outside, Missing };
+
+// Checks the entry of `map` for `key` against `matches`. A miss rebuilds a stale index and
+// checks again; on an up-to-date index it searches the subtree directly, as a rebuild would
+// cost more than that walk.
+template <typename Map, typename Key, typename Matches>
+wxWindow*
+lookup(WindowIndex& index, Map& map, const Key& key, wxWindow* window, Matches matches,
+       wxWindow* (*walk)(wxWindow*, const Key&))
+{
+    const auto check = [&]() {
+        auto it = map.find(key);
+        if (it == map.end() || !it->second || !matches(it->second.get()) ||
+            !is_within(it->second.get(), index.root))
+            return std::make_pair(Hit::Missing, static_cast<wxWindow*>(nullptr));
+        if (!is_within(it->second.get(), window))
+            return std::make_pair(Hit::Outside, static_cast<wxWindow*>(nullptr));
+        return std::make_pair(Hit::Found, it->second.get());
+    };
+    auto result = check();
+    if (result.first == Hit::Missing) {
+        if (!index.stale) {
+            // Absent, or renamed / reparented without notice.
+            return walk(window, key);
+        }
+        index.Rebuild();
+        result = check();
+    }
+    switch (result.first) {
+    case Hit::Found:
+        return result.second;
+    case Hit::Outside:
+        // The first match of the whole index is outside `window`; search just its subtree.
+        return walk(window, key);
+    case Hit::Missing:
+        break;
+    }
+    return nullptr;
+}
+
+wxWindow*
+walk_by_id(wxWindow* window, const int& id)
+{
+    return window->FindWindow(id);
+}
+
+wxWindow*
+walk_by_name(wxWindow* window, const std::string& name)
+{
+    return window->FindWindow(wxString::FromUTF8(name.data(), name.size()));
+}
+
+} // namespace
+
+namespace wxd_window_index {
+
+wxWindow*
+find_by_id(wxWindow* window, int id)
+{
+    WindowIndex* index = index_for(window);
+    if (!index)
+        return window->FindWindow(id);
+    return lookup(
+        *index, index->by_id, id, window, [id](wxWindow* w) { return w->GetId() == id; },
+        walk_by_id);
+}
+
+wxWindow*
+find_by_name(wxWindow* window, const wxString& name)
+{
+    WindowIndex* index = index_for(window);
+    if (!index)
+        return window->FindWindow(name);
+    const std::string key(name.utf8_str());
+    return lookup(
+        *index, index->by_name, key, window, [&name](wxWindow* w) { return w->GetName() == name; },
+        walk_by_name);
+}
+
+} // namespace wxd_window_index
+
+extern "C" {
+
+WXD_EXPORTED void
+wxd_Window_SetLookupIndexEnabled(wxd_Window_t* self, bool enable)
+{
+    wxWindow* root = reinterpret_cast<wxWindow*>(self);
+    if (!root)
+        return;
+    auto it = indexes().find(root);
+    if (!enable) {
+        if (it != indexes().end()) {
+            indexes().erase(it);
+            root->Unbind(wxEVT_DESTROY, on_index_root_destroy);
+            root->Unbind(wxEVT_CREATE, on_index_child_create);
+        }
+        return;
+    }
+    if (it != indexes().end())
+        return;
+    WindowIndex& index = indexes()[root];
+    index.root = root;
+    index.Rebuild();
+    root->Bind(wxEVT_DESTROY, on_index_root_destroy);
+    root->Bind(wxEVT_CREATE, on_index_child_create);
+}
+
+WXD_EXPORTED bool
+wxd_Window_IsLookupIndexEnabled(wxd_Window_t* self)
+{
+    return self && indexes().count(reinterpret_cast<wxWindow*>(self)) > 0;
+}
+
+} // extern "C"
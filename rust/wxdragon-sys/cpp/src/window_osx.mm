@@ -1,5 +1,6 @@
 #import <AppKit/AppKit.h>
 #include "../include/wxdragon.h"
+#include "wxd_visibility.h"
 
 void
 wxd_Window_SetAccessibilityLabel(wxd_Window_t* window, const char* label)
@@ -40,3 +41,35 @@ wxd_App_ActivateMac(void)
     [[NSRunningApplication currentApplication]
         activateWithOptions:NSApplicationActivateIgnoringOtherApps];
 }
+
+bool
+wxd_visibility::osx_is_occluded(wxWindow* tlw)
+{
+    NSWindow* window = tlw ? tlw->MacGetTopLevelWindowRef() : nil;
+    return window && !([window occlusionState] & NSWindowOcclusionStateVisible);
+}
+
+void*
+wxd_visibility::osx_observe_occlusion(wxWindow* tlw, void (*changed)(void* ctx), void* ctx)
+{
+    NSWindow* window = tlw ? tlw->MacGetTopLevelWindowRef() : nil;
+    if (!window || !changed)
+        return nullptr;
+    id token = [[NSNotificationCenter defaultCenter]
+        addObserverForName:NSWindowDidChangeOcclusionStateNotification
+                    object:window
+                     queue:[NSOperationQueue mainQueue]
+                usingBlock:^(NSNotification*) {
+                  changed(ctx);
+                }];
+    return (__bridge_retained void*)token;
+}
+
+void
+wxd_visibility::osx_stop_observing(void* token)
+{
+    if (!token)
+        return;
+    id observer = (__bridge_transfer id)token;
+    [[NSNotificationCenter defaultCenter] removeObserver:observer];
+}
@@ -0,0 +1,144 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct wxd_WindowSnapshot_t {
+    std::vector<wxd_WindowSnapshotNode> nodes;
+    std::string strings;
+};
+
+namespace {
+
+wxd_Rect
+to_rect(const wxRect& rect)
+{
+    return wxd_Rect{ rect.x, rect.y, rect.width, rect.height };
+}
+
+class SnapshotBuilder {
+public:
+    SnapshotBuilder(wxd_WindowSnapshot_t& out, uint32_t flags)
+        : m_out(out), m_flags(flags), m_focus(wxWindow::FindFocus())
+    {
+    }
+
+    // Iterative, so deep trees cannot exhaust the stack.
+    void
+    Build(wxWindow* root)
+    {
+        std::vector<std::pair<wxWindow*, int32_t>> stack{ { root, -1 } };
+        while (!stack.empty()) {
+            const auto [window, parent] = stack.back();
+            stack.pop_back();
+            const int32_t index = Add(window, parent);
+            if (index < 0)
+                continue;
+            const wxWindowList& children = window->GetChildren();
+            // Reversed, so children come off the stack in order.
+            for (auto it = children.rbegin(); it != children.rend(); ++it) {
+                wxWindow* child = *it;
+                if ((m_flags & WXD_WINDOW_SNAPSHOT_SKIP_TOP_LEVEL) && child->IsTopLevel())
+                    continue;
+                stack.emplace_back(child, index);
+            }
+        }
+    }
+
+private:
+    // Appends `window`; -1 if it and its subtree are skipped.
+    int32_t
+    Add(wxWindow* window, int32_t parent)
+    {
+        const bool shown = window->IsShown();
+        if (!shown && parent >= 0 && (m_flags & WXD_WINDOW_SNAPSHOT_SHOWN_ONLY))
+            return -1;
+        wxd_WindowSnapshotNode node{};
+        node.window = reinterpret_cast<wxd_Window_t*>(window);
+        node.parent = parent;
+        node.depth = parent >= 0 ? m_out.nodes[parent].depth + 1 : 0;
+        node.id = window->GetId();
+        node.flags = (shown ? WXD_WINDOW_NODE_SHOWN : 0) |
+                     (window->IsShownOnScreen() ? WXD_WINDOW_NODE_SHOWN_ON_SCREEN : 0) |
+                     (window->IsEnabled() ? WXD_WINDOW_NODE_ENABLED : 0) |
+                     (window->IsTopLevel() ? WXD_WINDOW_NODE_TOP_LEVEL : 0) |
+                     (window == m_focus ? WXD_WINDOW_NODE_FOCUSED : 0);
+        ClassName(window, node);
+        const wxScopedCharBuffer name = window->GetName().utf8_str();
+        node.name_offset = static_cast<uint32_t>(m_out.strings.size());
+        node.name_len = static_cast<uint32_t>(name.length());
+        m_out.strings.append(name.data(), name.length());
+        node.rect = to_rect(window->GetRect());
+        node.client_rect = to_rect(window->GetClientRect());
+        if (m_flags & WXD_WINDOW_SNAPSHOT_SCREEN_RECTS)
+            node.screen_rect = to_rect(window->GetScreenRect());
+        m_out.nodes.push_back(node);
+        return static_cast<int32_t>(m_out.nodes.size() - 1);
+    }
+
+    void
+    ClassName(wxWindow* window, wxd_WindowSnapshotNode& node)
+    {
+        const wxClassInfo* info = window->GetClassInfo();
+        auto it = m_classes.find(info);
+        if (it == m_classes.end()) {
+            const wxScopedCharBuffer name = wxString(info->GetClassName()).utf8_str();
+            const auto range = std::make_pair(static_cast<uint32_t>(m_out.strings.size()),
+                                              static_cast<uint32_t>(name.length()));
+            m_out.strings.append(name.data(), name.length());
+            it = m_classes.emplace(info, range).first;
+        }
+        node.class_offset = it->second.first;
+        node.class_len = it->second.second;
+    }
+
+    wxd_WindowSnapshot_t& m_out;
+    uint32_t m_flags;
+    const wxWindow* m_focus;
+    std::unordered_map<const wxClassInfo*, std::pair<uint32_t, uint32_t>> m_classes;
+};
+
+} // namespace
+
+extern "C" {
+
+WXD_EXPORTED wxd_WindowSnapshot_t*
+wxd_Window_SnapshotTree(wxd_Window_t* root, uint32_t flags)
+{
+    wxWindow* window = reinterpret_cast<wxWindow*>(root);
+    if (!window)
+        return nullptr;
+    auto* snapshot = new wxd_WindowSnapshot_t;
+    SnapshotBuilder(*snapshot, flags).Build(window);
+    return snapshot;
+}
+
+WXD_EXPORTED size_t
+wxd_WindowSnapshot_GetCount(const wxd_WindowSnapshot_t* snapshot)
+{
+    return snapshot ? snapshot->nodes.size() : 0;
+}
+
+WXD_EXPORTED const wxd_WindowSnapshotNode*
+wxd_WindowSnapshot_GetNodes(const wxd_WindowSnapshot_t* snapshot)
+{
+    return snapshot ? snapshot->nodes.data() : nullptr;
+}
+
+WXD_EXPORTED const char*
+wxd_WindowSnapshot_GetStrings(const wxd_WindowSnapshot_t* snapshot, size_t* len)
+{
+    if (len)
+        *len = snapshot ? snapshot->strings.size() : 0;
+    return snapshot ? snapshot->strings.data() : nullptr;
+}
+
+WXD_EXPORTED void
+wxd_WindowSnapshot_Destroy(wxd_WindowSnapshot_t* snapshot)
+{
+    delete snapshot;
+}
+
+} // extern "C"
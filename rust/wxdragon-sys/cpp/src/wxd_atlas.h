@@ -0,0 +1,25 @@
+#ifndef WXD_ATLAS_H
+#define WXD_ATLAS_H
+
+#include <wx/bitmap.h>
+#include <wx/gdicmn.h>
+
+// Icon atlases (internal): one RGBA sheet holding equally sized tiles in row-major order, turned
+// into a single native bitmap with one pixel conversion pass and then sliced per tile.
+namespace wxd_atlas {
+
+// Number of whole tiles in the sheet; 0 if any dimension is not positive.
+int
+tile_count(int sheet_w, int sheet_h, int tile_w, int tile_h);
+
+// Position of tile `index` in a sheet `sheet_w` pixels wide.
+wxRect
+tile_rect(int sheet_w, int tile_w, int tile_h, int index);
+
+// Converts `rgba` (4 * w * h bytes) to a bitmap; invalid on failure.
+wxBitmap
+sheet_bitmap(const unsigned char* rgba, int w, int h);
+
+} // namespace wxd_atlas
+
+#endif // WXD_ATLAS_H
@@ -0,0 +1,48 @@
+#ifndef WXD_CACHE_REGISTRY_H
+#define WXD_CACHE_REGISTRY_H
+
+#include "../include/wxd_types.h"
+#include <cstddef>
+
+// Registry of the wrapper's own caches (internal), so wxd_App_TrimMemory and the OS memory
+// pressure watcher can account for and shrink all of them. A cache derives from Cache, which
+// registers it for its lifetime. Trim and the accessors run on the main thread, like the caches.
+namespace wxd_cache_registry {
+
+class Cache {
+public:
+    explicit Cache(const char* name);
+    virtual ~Cache();
+    Cache(const Cache&) = delete;
+    Cache& operator=(const Cache&) = delete;
+
+    const char*
+    CacheName() const
+    {
+        return m_name;
+    }
+
+    // Approximate memory held, in bytes. Native objects whose size is unknown count at a
+    // nominal size.
+    virtual size_t
+    CacheBytes() const = 0;
+
+    virtual size_t
+    CacheEntries() const = 0;
+
+    // WXD_TRIM_MODERATE keeps the more recently used half where that is tracked;
+    // WXD_TRIM_CRITICAL empties the cache. Entries still in use elsewhere may survive either.
+    virtual void
+    Trim(wxd_TrimLevel level) = 0;
+
+private:
+    const char* m_name; // static string
+};
+
+// Trims every registered cache; returns the bytes released.
+size_t
+trim_all(wxd_TrimLevel level);
+
+} // namespace wxd_cache_registry
+
+#endif // WXD_CACHE_REGISTRY_H
@@ -0,0 +1,47 @@
+#ifndef WXD_DATAVIEW_ROW_CACHE_H
+#define WXD_DATAVIEW_ROW_CACHE_H
+
+#include <cstdint>
+#include <vector>
+
+class wxDataViewVirtualListModel;
+
+// Row-range value cache of the custom virtual list model (internal). The notification wrappers
+// call this before forwarding, so no stale cell survives a change the model was told about.
+namespace wxd_dataview_row_cache {
+
+// Drops cached rows if `model` is a custom callback model; a no-op for any other model.
+void
+invalidate(wxDataViewVirtualListModel* model);
+
+// Like invalidate(), but keeps the cached attributes of rows outside [first..last].
+void
+invalidate_rows(wxDataViewVirtualListModel* model, unsigned int first, unsigned int last);
+
+// Restricts a custom callback model to the model columns with a nonzero entry in `visible`;
+// the others read as null without calling out, and the bulk provider gets null slots for them.
+// An empty vector projects every column. A no-op for any other model.
+void
+set_projection(wxDataViewVirtualListModel* model, std::vector<uint8_t> visible);
+
+extern int g_full_columns; // main thread
+
+// While alive, every column is served in full, for code that reads cells the user cannot see
+// (auto-sizing, export).
+class FullColumnsScope {
+public:
+    FullColumnsScope()
+    {
+        ++g_full_columns;
+    }
+    ~FullColumnsScope()
+    {
+        --g_full_columns;
+    }
+    FullColumnsScope(const FullColumnsScope&) = delete;
+    FullColumnsScope& operator=(const FullColumnsScope&) = delete;
+};
+
+} // namespace wxd_dataview_row_cache
+
+#endif // WXD_DATAVIEW_ROW_CACHE_H
@@ -0,0 +1,82 @@
+#ifndef WXD_DATAVIEW_ROWS_H
+#define WXD_DATAVIEW_ROWS_H
+
+#include <wx/dataview.h>
+#include <vector>
+
+// Rows of a wxDataViewCtrl in display order, shared by sampled autosizing and export
+// (internal).
+namespace wxd_dataview_rows {
+
+// A displayed row: the item and its depth below the root (0 for top-level rows).
+struct Row {
+    wxDataViewItem item;
+    int depth;
+};
+
+// Rows in display order: every item of a list model, or the items of a tree model reachable
+// through expanded nodes.
+class DisplayedRows {
+public:
+    explicit DisplayedRows(wxDataViewCtrl* ctrl) : m_ctrl(ctrl), m_model(ctrl->GetModel())
+    {
+        if (!m_model)
+            return;
+        m_list = dynamic_cast<wxDataViewListModel*>(m_model);
+        if (!m_list)
+            Walk(wxDataViewItem(), 0);
+    }
+
+    size_t
+    Count() const
+    {
+        if (m_list)
+            return m_list->GetCount();
+        return m_rows.size();
+    }
+
+    Row
+    At(size_t index) const
+    {
+        if (m_list)
+            return Row{ m_list->GetItem(static_cast<unsigned int>(index)), 0 };
+        return m_rows[index];
+    }
+
+    // Display index of `item`, or Count() if it is not shown.
+    size_t
+    IndexOf(const wxDataViewItem& item) const
+    {
+        if (!item.IsOk())
+            return Count();
+        if (m_list)
+            return m_list->GetRow(item);
+        for (size_t i = 0; i < m_rows.size(); ++i) {
+            if (m_rows[i].item == item)
+                return i;
+        }
+        return Count();
+    }
+
+private:
+    void
+    Walk(const wxDataViewItem& parent, int depth)
+    {
+        wxDataViewItemArray children;
+        m_model->GetChildren(parent, children);
+        for (const wxDataViewItem& child : children) {
+            m_rows.push_back(Row{ child, depth });
+            if (m_model->IsContainer(child) && m_ctrl->IsExpanded(child))
+                Walk(child, depth + 1);
+        }
+    }
+
+    wxDataViewCtrl* m_ctrl;
+    wxDataViewModel* m_model;
+    wxDataViewListModel* m_list = nullptr;
+    std::vector<Row> m_rows;
+};
+
+} // namespace wxd_dataview_rows
+
+#endif // WXD_DATAVIEW_ROWS_H
@@ -0,0 +1,120 @@
+#ifndef WXD_DATAVIEW_SNAPSHOT_H
+#define WXD_DATAVIEW_SNAPSHOT_H
+
+#include "../include/wxdragon.h"
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class wxDataViewItemAttr;
+class wxVariant;
+
+// An immutable table of cells, built on any thread and then only read (internal; see
+// wxd_DataViewSnapshot_Create). Holds no wx objects, so building and freeing it off the GUI
+// thread is safe.
+struct wxd_DataViewSnapshot_t {
+    struct Column {
+        wxd_VariantValueKind kind = WXD_VARIANT_VALUE_NULL;
+        std::vector<int64_t> ints; // bools and int64 values
+        std::vector<double> doubles;
+        std::string text;
+        std::vector<uint32_t> offsets; // rows + 1 entries into `text`
+    };
+
+    size_t rows = 0;
+    std::vector<Column> columns;
+    std::vector<uint64_t> keys;    // empty: rows are matched by position
+    std::vector<uint64_t> parents; // tree snapshots only; 0 = top level
+    std::vector<wxd_DataViewItemAttr_t> attrs;
+
+    // Tree index, built once before the snapshot is handed to the GUI thread.
+    std::unordered_map<uint64_t, size_t> row_of_key;
+    std::unordered_map<uint64_t, std::vector<uint64_t>> children; // by parent key
+
+    void
+    Fill(wxVariant& variant, size_t row, unsigned int col) const;
+
+    // True if every cell and the attribute of `row` match `other_row` of `other`.
+    bool
+    RowEquals(size_t row, const wxd_DataViewSnapshot_t& other, size_t other_row) const;
+
+    const wxd_DataViewItemAttr_t*
+    Attr(size_t row) const
+    {
+        return row < attrs.size() ? &attrs[row] : nullptr;
+    }
+
+    void
+    BuildTreeIndex();
+};
+
+namespace wxd_dataview_snapshot {
+
+using Snapshot = wxd_DataViewSnapshot_t;
+using SnapshotPtr = std::shared_ptr<const Snapshot>;
+
+class Target;
+
+// Hand-over point between publishers and one model. Publishers only touch `pending` under the
+// lock; `target` is GUI-thread only and cleared when the model goes away.
+struct Channel {
+    bool tree = false; // set once on creation: snapshots need keys and get a tree index
+    std::mutex lock;
+    std::unique_ptr<Snapshot> pending;
+    bool delivery_posted = false;
+    Target* target = nullptr;
+};
+
+// Stores `snapshot` as the next one for the channel's model, replacing an undelivered one, and
+// makes sure one delivery is queued to the GUI thread. Any thread.
+void
+publish(const std::shared_ptr<Channel>& channel, std::unique_ptr<Snapshot> snapshot);
+
+// Implemented by models that take snapshots. ApplySnapshot runs on the GUI thread with the
+// latest published snapshot, once per event loop iteration at most.
+class Target {
+public:
+    virtual ~Target();
+
+    virtual void
+    ApplySnapshot(SnapshotPtr snapshot) = 0;
+
+    virtual bool
+    IsTree() const
+    {
+        return false;
+    }
+
+    std::shared_ptr<Channel>
+    GetChannel();
+
+private:
+    std::shared_ptr<Channel> m_channel;
+};
+
+// Copies the styling set in `from` into `attr`; false if `from` sets nothing.
+bool
+apply_attr(const wxd_DataViewItemAttr_t& from, wxDataViewItemAttr& attr);
+
+// Minimal row-level difference between two list snapshots.
+struct ListDiff {
+    // Rows moved: nothing else is set and the model has to be reset.
+    bool reset = false;
+    // Rows of `before`, ascending.
+    std::vector<unsigned int> deleted;
+    // (first row of `after`, count), ascending.
+    std::vector<std::pair<unsigned int, unsigned int>> inserted;
+    // [first, last] rows of `after`, ascending.
+    std::vector<std::pair<unsigned int, unsigned int>> changed;
+};
+
+// Rows are matched by key when both snapshots have keys, otherwise by position.
+ListDiff
+diff_rows(const Snapshot& before, const Snapshot& after);
+
+} // namespace wxd_dataview_snapshot
+
+#endif // WXD_DATAVIEW_SNAPSHOT_H
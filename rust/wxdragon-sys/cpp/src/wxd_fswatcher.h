@@ -0,0 +1,34 @@
+#ifndef WXD_FSWATCHER_INTERNAL_H
+#define WXD_FSWATCHER_INTERNAL_H
+
+#include <stdint.h>
+#include <vector>
+#include <wx/event.h>
+#include <wx/string.h>
+
+// One coalesced batch of file system changes, sent by a wxd_FileSystemWatcher_t to its target
+// handler (internal; exposed as WXD_EVENT_TYPE_FS_CHANGES). Does not propagate.
+class wxdFileSystemChangesEvent : public wxEvent {
+public:
+    struct Change {
+        wxString path;
+        int32_t kinds; // wxd_FileSystemChange bits
+    };
+
+    wxdFileSystemChangesEvent(wxEventType type = wxEVT_NULL, int winid = 0) : wxEvent(winid, type)
+    {
+    }
+
+    wxEvent*
+    Clone() const override
+    {
+        return new wxdFileSystemChangesEvent(*this);
+    }
+
+    std::vector<Change> changes;
+    bool overflowed = false;
+};
+
+wxDECLARE_EVENT(wxdEVT_FS_CHANGES, wxdFileSystemChangesEvent);
+
+#endif // WXD_FSWATCHER_INTERNAL_H
@@ -0,0 +1,16 @@
+#ifndef WXD_GRID_AUTOSIZE_H
+#define WXD_GRID_AUTOSIZE_H
+
+class wxGrid;
+
+// Column auto-sizing state (internal).
+namespace wxd_grid_autosize {
+
+// Keeps the rows already measured by auto-grow aligned with the grid after `count` rows were
+// inserted (count > 0) or deleted (count < 0) at `pos`.
+void
+rows_moved(wxGrid* grid, int pos, int count);
+
+} // namespace wxd_grid_autosize
+
+#endif // WXD_GRID_AUTOSIZE_H
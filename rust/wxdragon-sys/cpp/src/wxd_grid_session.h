@@ -0,0 +1,20 @@
+#ifndef WXD_GRID_SESSION_H
+#define WXD_GRID_SESSION_H
+
+class wxGrid;
+
+// Grid update sessions (internal). Setters report the cells they changed here; while a session
+// is open on the grid the block is only recorded, otherwise it is refreshed right away.
+namespace wxd_grid_session {
+
+// Records the block [top..bottom] x [left..right] if a session is open; returns false when not.
+bool
+mark(wxGrid* grid, int top, int left, int bottom, int right);
+
+// Records the block during a session, otherwise refreshes it immediately.
+void
+refresh_block(wxGrid* grid, int top, int left, int bottom, int right);
+
+} // namespace wxd_grid_session
+
+#endif // WXD_GRID_SESSION_H
@@ -0,0 +1,26 @@
+#ifndef WXD_LATENCY_H
+#define WXD_LATENCY_H
+
+#include <atomic>
+#include <wx/event.h>
+
+// Paint-end hook for the input latency probe (internal). The event dispatcher reports every
+// finished wxEVT_PAINT dispatch; the call is a single relaxed load unless a probe is waiting
+// for a paint.
+namespace wxd_latency {
+
+extern std::atomic<int> g_waiting;
+
+void
+paint_finished_slow(wxEvtHandler* handler);
+
+inline void
+paint_finished(wxEvtHandler* handler)
+{
+    if (g_waiting.load(std::memory_order_relaxed) > 0)
+        paint_finished_slow(handler);
+}
+
+} // namespace wxd_latency
+
+#endif // WXD_LATENCY_H
@@ -0,0 +1,57 @@
+#ifndef WXD_LOGCONSOLE_H
+#define WXD_LOGCONSOLE_H
+
+#include <wx/timer.h>
+#include <wx/window.h>
+#include <string>
+
+// Tail/console mode of a text control (internal). Appends are buffered and written once per
+// frame inside Freeze/Thaw, lines beyond the maximum are trimmed from the head, and the view
+// follows the end only while the caret is there. Subclasses adapt a concrete control.
+class wxdLogConsole {
+public:
+    explicit wxdLogConsole(wxWindow* window);
+    virtual ~wxdLogConsole();
+
+    // Installs `console` on its window, replacing any previous one, and takes ownership.
+    static void Attach(wxdLogConsole* console);
+    // Flushes and removes the console of `window`, if any.
+    static void Detach(wxWindow* window);
+    static wxdLogConsole* Get(wxWindow* window);
+
+    void Append(const char* text, size_t len);
+    void Flush();
+
+    // 0 keeps every line.
+    void
+    SetMaxLines(int max_lines)
+    {
+        m_max_lines = max_lines > 0 ? max_lines : 0;
+    }
+
+protected:
+    // Lines in the control, counting a trailing partial line.
+    virtual int GetLineCount() const = 0;
+    // Appends UTF-8 text at the end, leaving the caret where it is.
+    virtual void AppendUtf8(const std::string& text) = 0;
+    virtual void RemoveHeadLines(int lines) = 0;
+    virtual void ClearText() = 0;
+    virtual bool IsCaretAtEnd() const = 0;
+    // Moves the caret to the end and scrolls it into view.
+    virtual void ScrollToEnd() = 0;
+    // Called before a detach while the control is alive; not called on destruction.
+    virtual void
+    OnDetach()
+    {
+    }
+
+private:
+    void OnTimer(wxTimerEvent& event);
+
+    wxWindow* m_window;
+    wxTimer m_timer;
+    std::string m_pending;
+    int m_max_lines = 0;
+};
+
+#endif // WXD_LOGCONSOLE_H
@@ -10,11 +10,245 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stddef.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// Level filter pushed from Rust; defaults to everything until the Rust side reports its level.
+static std::atomic<int> s_log_max_level{ 5 };
+
+extern "C" void
+wxd_log_set_max_level(int level)
+{
+    s_log_max_level.store(level, std::memory_order_relaxed);
+}
+
+extern "C" int
+wxd_log_get_max_level(void)
+{
+    return s_log_max_level.load(std::memory_order_relaxed);
+}
+
+// --- Asynchronous delivery ---
+// A bounded multi-producer ring (Vyukov's sequence-numbered slots): a producer claims a slot
+// with one CAS, formats straight into it and publishes it by bumping the slot's sequence, so
+// logging threads never lock or, for short messages, allocate. One drain thread consumes the
+// slots in claim order. A producer never waits for the consumer; a full ring drops the record.
+namespace {
+
+constexpr size_t kInlineText = 240;
+
+struct LogSlot {
+    std::atomic<size_t> seq;
+    int level;
+    char* heap; // Messages that do not fit `text`, malloc'd by the producer
+    char text[kInlineText];
+};
+
+struct LogRing {
+    explicit LogRing(size_t capacity) : slots(new LogSlot[capacity]), mask(capacity - 1)
+    {
+        for (size_t i = 0; i < capacity; ++i) {
+            slots[i].seq.store(i, std::memory_order_relaxed);
+            slots[i].heap = nullptr;
+        }
+    }
+
+    std::unique_ptr<LogSlot[]> slots;
+    const size_t mask;
+    std::atomic<size_t> enqueue_pos{ 0 };
+    size_t dequeue_pos = 0; // Drain thread only
+};
+
+std::atomic<LogRing*> s_ring{ nullptr };
+std::atomic<int> s_producers{ 0 }; // Producers that may still touch s_ring
+std::atomic<uint64_t> s_dropped{ 0 };
+std::atomic<bool> s_drain_waiting{ false };
+std::mutex s_async_control; // Serializes wxd_log_set_async
+std::mutex s_drain_mutex;
+std::condition_variable s_drain_wake;
+bool s_drain_stop = false;
+std::thread s_drain_thread;
+
+// Formats into a claimed slot: inline when it fits, else into a heap buffer, falling back to
+// the truncated inline text if that allocation fails.
+void
+format_into(LogSlot& slot, const char* fmt, va_list ap)
+{
+    slot.heap = nullptr;
+    va_list ap_copy;
+    va_copy(ap_copy, ap);
+    int required = vsnprintf(slot.text, kInlineText, fmt, ap_copy);
+    va_end(ap_copy);
+    if (required < 0) {
+        strcpy(slot.text, "(format error)");
+        return;
+    }
+    if (static_cast<size_t>(required) < kInlineText)
+        return;
+    char* buf = static_cast<char*>(malloc(static_cast<size_t>(required) + 1));
+    if (!buf)
+        return;
+    va_copy(ap_copy, ap);
+    vsnprintf(buf, static_cast<size_t>(required) + 1, fmt, ap_copy);
+    va_end(ap_copy);
+    slot.heap = buf;
+}
+
+// Queues one record. Returns false only if async delivery is off; a full ring counts a drop.
+bool
+try_log_async(int level, const char* fmt, va_list ap)
+{
+    // Sequentially consistent with stop_async: either it sees this producer or this producer
+    // sees the ring gone.
+    s_producers.fetch_add(1);
+    LogRing* ring = s_ring.load();
+    if (!ring) {
+        s_producers.fetch_sub(1, std::memory_order_release);
+        return false;
+    }
+
+    size_t pos = ring->enqueue_pos.load(std::memory_order_relaxed);
+    LogSlot* slot = nullptr;
+    for (;;) {
+        LogSlot& candidate = ring->slots[pos & ring->mask];
+        const size_t seq = candidate.seq.load(std::memory_order_acquire);
+        const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            if (ring->enqueue_pos.compare_exchange_weak(pos, pos + 1,
+                                                        std::memory_order_relaxed)) {
+                slot = &candidate;
+                break;
+            }
+        }
+        else if (diff < 0) {
+            break; // Full
+        }
+        else {
+            pos = ring->enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+
+    if (slot) {
+        slot->level = level;
+        if (fmt)
+            format_into(*slot, fmt, ap);
+        else
+            strcpy(slot->text, "(null)");
+        slot->seq.store(pos + 1, std::memory_order_release);
+    }
+    else {
+        s_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+    s_producers.fetch_sub(1, std::memory_order_release);
+
+    // No lock here: a wakeup racing with the drain thread going to sleep is caught by its
+    // timed wait.
+    if (slot && s_drain_waiting.load(std::memory_order_relaxed))
+        s_drain_wake.notify_one();
+    return true;
+}
+
+// Hands every published record to Rust. Returns false if the ring was empty.
+bool
+drain_ring(LogRing& ring)
+{
+    bool any = false;
+    for (;;) {
+        LogSlot& slot = ring.slots[ring.dequeue_pos & ring.mask];
+        if (slot.seq.load(std::memory_order_acquire) != ring.dequeue_pos + 1)
+            return any;
+        any = true;
+        wxd_rust_log(slot.level, slot.heap ? slot.heap : slot.text);
+        free(slot.heap);
+        slot.heap = nullptr;
+        slot.seq.store(ring.dequeue_pos + ring.mask + 1, std::memory_order_release);
+        ++ring.dequeue_pos;
+    }
+}
+
+void
+drain_main(LogRing* ring)
+{
+    for (;;) {
+        if (drain_ring(*ring))
+            continue;
+        std::unique_lock<std::mutex> lock(s_drain_mutex);
+        if (s_drain_stop)
+            return;
+        s_drain_waiting.store(true, std::memory_order_relaxed);
+        s_drain_wake.wait_for(lock, std::chrono::milliseconds(20));
+        s_drain_waiting.store(false, std::memory_order_relaxed);
+    }
+}
+
+void
+stop_async()
+{
+    LogRing* ring = s_ring.exchange(nullptr);
+    if (!ring)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(s_drain_mutex);
+        s_drain_stop = true;
+    }
+    s_drain_wake.notify_all();
+    s_drain_thread.join();
+    // Producers that saw the ring before it was unpublished finish their record first.
+    while (s_producers.load() != 0)
+        std::this_thread::yield();
+    drain_ring(*ring);
+    delete ring;
+}
+
+} // namespace
+
+extern "C" bool
+wxd_log_set_async(size_t capacity)
+{
+    std::lock_guard<std::mutex> control(s_async_control);
+    if (capacity == 0) {
+        stop_async();
+        return true;
+    }
+    if (s_ring.load(std::memory_order_acquire))
+        return true;
+
+    size_t rounded = 2;
+    while (rounded < capacity && rounded < (SIZE_MAX >> 1))
+        rounded <<= 1;
+    {
+        std::lock_guard<std::mutex> lock(s_drain_mutex);
+        s_drain_stop = false;
+    }
+    LogRing* ring = nullptr;
+    try {
+        ring = new LogRing(rounded);
+        s_drain_thread = std::thread(drain_main, ring);
+    }
+    catch (...) {
+        delete ring;
+        return false;
+    }
+    s_ring.store(ring, std::memory_order_release);
+    return true;
+}
+
+extern "C" uint64_t
+wxd_log_get_dropped(void)
+{
+    return s_dropped.load(std::memory_order_relaxed);
+}
 
 // helper function: format with va_list and send to wxd_rust_log
 static void
 wxd_log_vformat_and_send(int level, const char* fmt, va_list ap)
 {
+    if (try_log_async(level, fmt, ap))
+        return;
     if (!fmt) {
         wxd_rust_log(level, "(null)");
         return;
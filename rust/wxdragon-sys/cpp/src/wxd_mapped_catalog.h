@@ -0,0 +1,73 @@
+#ifndef WXD_MAPPED_CATALOG_H
+#define WXD_MAPPED_CATALOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <memory>
+#include <string_view>
+#include <vector>
+#include <wx/string.h>
+
+// A GNU .mo catalog served in place from memory (internal). Opening reads only the header
+// entry; lookups use the catalog's own hash table (or a binary search over the sorted msgids
+// when it has none) and return UTF-8 views into the data, so nothing is converted or copied for
+// messages that are never requested. Only UTF-8 (or ASCII) catalogs are accepted.
+class wxdMappedCatalog {
+public:
+    // Maps the file at `path`.
+    static std::unique_ptr<wxdMappedCatalog>
+    FromFile(const wxString& path);
+
+    // Uses `data`, which must stay valid as long as `keepalive` is held.
+    static std::unique_ptr<wxdMappedCatalog>
+    FromData(const uint8_t* data, size_t len, std::shared_ptr<const void> keepalive);
+
+    ~wxdMappedCatalog();
+
+    // The translation of `msgid` (for a plural entry, its first form).
+    bool
+    Find(std::string_view msgid, std::string_view* out) const;
+
+    // The plural form for `n` of the entry whose singular msgid is `msgid`, chosen by the
+    // catalog's Plural-Forms expression.
+    bool
+    FindPlural(std::string_view msgid, unsigned n, std::string_view* out) const;
+
+    // Node of a parsed Plural-Forms expression; operands are indices of other nodes.
+    struct PluralNode {
+        char op; // 'n', '#' (number), '?' (ternary) or a C operator ('&' and '|' are && and ||,
+                 // 'l', 'g', 'e' and 'd' are <=, >=, == and !=)
+        unsigned long value;
+        int a, b, c;
+    };
+
+private:
+    wxdMappedCatalog() = default;
+    bool
+    Init();
+    uint32_t
+    Word(size_t offset) const;
+    bool
+    String(uint32_t table, uint32_t index, std::string_view* out) const;
+    bool
+    Lookup(std::string_view msgid, std::string_view* translation) const;
+    bool
+    ParsePluralForms(std::string_view header);
+    unsigned long
+    EvalPlural(int node, unsigned long n) const;
+
+    std::shared_ptr<const void> m_keepalive;
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    bool m_swap = false;
+    uint32_t m_count = 0;
+    uint32_t m_origTable = 0;
+    uint32_t m_transTable = 0;
+    uint32_t m_hashSize = 0;
+    uint32_t m_hashTable = 0;
+    unsigned m_nplurals = 2;
+    std::vector<PluralNode> m_plural; // empty: n != 1
+    int m_pluralRoot = -1;
+};
+
+#endif // WXD_MAPPED_CATALOG_H
@@ -0,0 +1,106 @@
+#ifndef WXD_MAPPED_FILE_H
+#define WXD_MAPPED_FILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <wx/string.h>
+#ifdef __WINDOWS__
+#include <wx/msw/wrapwin.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Read-only memory mapping of a whole file (internal). The file is mapped with one call and
+// paged in on first touch, so loaders can parse it in place instead of reading it into buffers.
+class wxdMappedFile {
+public:
+    wxdMappedFile() = default;
+    wxdMappedFile(const wxdMappedFile&) = delete;
+    wxdMappedFile& operator=(const wxdMappedFile&) = delete;
+    ~wxdMappedFile() { Close(); }
+
+    // Fails for missing or empty files.
+    bool
+    Open(const wxString& path)
+    {
+        Close();
+#ifdef __WINDOWS__
+        HANDLE file = ::CreateFileW(path.wc_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER size;
+        if (::GetFileSizeEx(file, &size) && size.QuadPart > 0 &&
+            static_cast<unsigned long long>(size.QuadPart) <= SIZE_MAX) {
+            m_mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (m_mapping) {
+                m_data = static_cast<const uint8_t*>(
+                    ::MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+                m_size = static_cast<size_t>(size.QuadPart);
+            }
+        }
+        // The mapping keeps the file open.
+        ::CloseHandle(file);
+#else
+        const int fd = ::open(path.utf8_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return false;
+        struct stat info;
+        if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+            void* view = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ,
+                                MAP_PRIVATE, fd, 0);
+            if (view != MAP_FAILED) {
+                m_data = static_cast<const uint8_t*>(view);
+                m_size = static_cast<size_t>(info.st_size);
+            }
+        }
+        ::close(fd);
+#endif
+        if (!m_data) {
+            Close();
+            return false;
+        }
+        return true;
+    }
+
+    void
+    Close()
+    {
+#ifdef __WINDOWS__
+        if (m_data)
+            ::UnmapViewOfFile(m_data);
+        if (m_mapping)
+            ::CloseHandle(m_mapping);
+        m_mapping = nullptr;
+#else
+        if (m_data)
+            ::munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    const uint8_t*
+    Data() const
+    {
+        return m_data;
+    }
+
+    size_t
+    Size() const
+    {
+        return m_size;
+    }
+
+private:
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+#ifdef __WINDOWS__
+    HANDLE m_mapping = nullptr;
+#endif
+};
+
+#endif // WXD_MAPPED_FILE_H
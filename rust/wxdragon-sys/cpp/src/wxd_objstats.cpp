@@ -0,0 +1,131 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_objstats.h"
+
+#include <atomic>
+
+#if WXD_OBJECT_STATS
+
+namespace {
+
+struct Counter {
+    std::atomic<int64_t> live{ 0 };
+    std::atomic<int64_t> high_water{ 0 };
+    std::atomic<int64_t> created{ 0 };
+    std::atomic<int64_t> bytes{ 0 };
+    std::atomic<int64_t> high_water_bytes{ 0 };
+};
+
+Counter s_counters[WXD_OBJECT_KIND_COUNT];
+
+const char* const s_names[WXD_OBJECT_KIND_COUNT] = {
+    "Bitmap", "TreeItemId", "Variant", "EventHandler", "EventClosure",
+};
+
+void
+raise(std::atomic<int64_t>& mark, int64_t value)
+{
+    int64_t seen = mark.load(std::memory_order_relaxed);
+    while (value > seen &&
+           !mark.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {
+    }
+}
+
+uint64_t
+clamped(const std::atomic<int64_t>& value)
+{
+    // A row can dip below zero transiently when another thread's add has not landed yet.
+    const int64_t v = value.load(std::memory_order_relaxed);
+    return v > 0 ? static_cast<uint64_t>(v) : 0;
+}
+
+} // namespace
+
+void
+wxd_objstats::add(wxd_ObjectKind kind, int64_t bytes)
+{
+    Counter& c = s_counters[kind];
+    c.created.fetch_add(1, std::memory_order_relaxed);
+    raise(c.high_water, c.live.fetch_add(1, std::memory_order_relaxed) + 1);
+    raise(c.high_water_bytes, c.bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+}
+
+void
+wxd_objstats::remove(wxd_ObjectKind kind, int64_t bytes)
+{
+    Counter& c = s_counters[kind];
+    c.live.fetch_sub(1, std::memory_order_relaxed);
+    c.bytes.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+int64_t
+wxd_objstats::bitmap_bytes(const wxBitmap* bitmap)
+{
+    if (!bitmap->IsOk())
+        return 0;
+    return static_cast<int64_t>(bitmap->GetWidth()) * bitmap->GetHeight() * 4;
+}
+
+extern "C" {
+
+WXD_EXPORTED bool
+wxd_Debug_IsObjectAccountingEnabled(void)
+{
+    return true;
+}
+
+WXD_EXPORTED size_t
+wxd_Debug_GetObjectStats(wxd_ObjectStats* stats, size_t max_entries)
+{
+    if (stats) {
+        for (size_t i = 0; i < max_entries && i < WXD_OBJECT_KIND_COUNT; ++i) {
+            const Counter& c = s_counters[i];
+            stats[i].kind = static_cast<int32_t>(i);
+            stats[i].name = s_names[i];
+            stats[i].live = clamped(c.live);
+            stats[i].high_water = clamped(c.high_water);
+            stats[i].created = clamped(c.created);
+            stats[i].live_bytes = clamped(c.bytes);
+            stats[i].high_water_bytes = clamped(c.high_water_bytes);
+        }
+    }
+    return WXD_OBJECT_KIND_COUNT;
+}
+
+WXD_EXPORTED void
+wxd_Debug_ResetObjectHighWater(void)
+{
+    for (Counter& c : s_counters) {
+        c.high_water.store(c.live.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        c.high_water_bytes.store(c.bytes.load(std::memory_order_relaxed),
+                                 std::memory_order_relaxed);
+    }
+}
+
+} // extern "C"
+
+#else // !WXD_OBJECT_STATS
+
+extern "C" {
+
+WXD_EXPORTED bool
+wxd_Debug_IsObjectAccountingEnabled(void)
+{
+    return false;
+}
+
+WXD_EXPORTED size_t
+wxd_Debug_GetObjectStats(wxd_ObjectStats* /*stats*/, size_t /*max_entries*/)
+{
+    return 0;
+}
+
+WXD_EXPORTED void
+wxd_Debug_ResetObjectHighWater(void)
+{
+}
+
+} // extern "C"
+
+#endif // WXD_OBJECT_STATS
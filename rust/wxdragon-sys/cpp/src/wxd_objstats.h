@@ -0,0 +1,74 @@
+#ifndef WXD_OBJSTATS_H
+#define WXD_OBJSTATS_H
+
+#include <stdint.h>
+#include "../include/wxd_types.h"
+
+class wxBitmap;
+
+// Live object accounting (internal). Objects handed across the C API are counted when created
+// and when destroyed, per wxd_ObjectKind. Only built with wxdENABLE_OBJECT_STATS; otherwise
+// every hook below is an empty inline function and the pointer passes straight through.
+namespace wxd_objstats {
+
+#if WXD_OBJECT_STATS
+void
+add(wxd_ObjectKind kind, int64_t bytes);
+void
+remove(wxd_ObjectKind kind, int64_t bytes);
+// Approximate pixel memory: width * height * 4.
+int64_t
+bitmap_bytes(const wxBitmap* bitmap);
+#else
+inline void
+add(wxd_ObjectKind, int64_t)
+{
+}
+inline void
+remove(wxd_ObjectKind, int64_t)
+{
+}
+inline int64_t
+bitmap_bytes(const wxBitmap*)
+{
+    return 0;
+}
+#endif
+
+// Counts a bitmap about to be returned to the caller; null passes through uncounted.
+inline wxBitmap*
+track(wxBitmap* bitmap)
+{
+    if (bitmap)
+        add(WXD_OBJECT_KIND_BITMAP, bitmap_bytes(bitmap));
+    return bitmap;
+}
+
+inline void
+untrack(const wxBitmap* bitmap)
+{
+    if (bitmap)
+        remove(WXD_OBJECT_KIND_BITMAP, bitmap_bytes(bitmap));
+}
+
+// Same for fixed-size objects, charged sizeof(T).
+template <typename T>
+T*
+track(wxd_ObjectKind kind, T* object)
+{
+    if (object)
+        add(kind, static_cast<int64_t>(sizeof(T)));
+    return object;
+}
+
+template <typename T>
+void
+untrack(wxd_ObjectKind kind, const T* object)
+{
+    if (object)
+        remove(kind, static_cast<int64_t>(sizeof(T)));
+}
+
+} // namespace wxd_objstats
+
+#endif // WXD_OBJSTATS_H
@@ -0,0 +1,29 @@
+#ifndef WXD_PIXELS_H
+#define WXD_PIXELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Conversion between interleaved RGBA and wxImage's separate RGB and alpha planes (internal).
+// Uses SSSE3 when the CPU has it (checked once at run time) or NEON on ARM64, with a scalar
+// fallback.
+namespace wxd_pixels {
+
+// `rgba` (4 * n bytes) -> `rgb` (3 * n) and `alpha` (n).
+void
+split_rgba(const uint8_t* rgba, uint8_t* rgb, uint8_t* alpha, size_t n);
+
+// `rgb` (3 * n bytes) and `alpha` (n, nullable for opaque) -> `rgba` (4 * n).
+void
+merge_rgba(const uint8_t* rgb, const uint8_t* alpha, uint8_t* rgba, size_t n);
+
+/**
+ * Copies `n` RGBA pixels to 4-byte pixels whose red, green, blue and alpha bytes sit at
+ * `order[0..3]`, multiplying the colour by alpha first if `premultiply`.
+ */
+void
+convert_rgba(const uint8_t* rgba, uint8_t* dst, size_t n, const int order[4], bool premultiply);
+
+} // namespace wxd_pixels
+
+#endif // WXD_PIXELS_H
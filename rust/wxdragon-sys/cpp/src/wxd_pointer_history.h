@@ -0,0 +1,20 @@
+#ifndef WXD_POINTER_HISTORY_H
+#define WXD_POINTER_HISTORY_H
+
+#include "../include/wxdragon.h"
+#include <vector>
+
+class wxMouseEvent;
+
+// Motion samples behind mouse events (internal; read through wxd_MouseEvent_GetPointerHistory).
+namespace wxd_pointer_history {
+
+// Appends the samples that make up motion `event`: the points the platform merged into it since
+// the previous motion event collected here, oldest first, then the event's own position. Calling
+// it again for the same event appends the same samples. GUI thread only.
+void
+collect(const wxMouseEvent& event, std::vector<wxd_PointerSample>& out);
+
+} // namespace wxd_pointer_history
+
+#endif // WXD_POINTER_HISTORY_H
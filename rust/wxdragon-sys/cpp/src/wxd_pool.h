@@ -0,0 +1,111 @@
+#ifndef WXD_POOL_H
+#define WXD_POOL_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+// Fixed-size block pools (internal) for small objects that widgets create and destroy in bulk,
+// such as per-window event handlers and their closure records. Blocks are carved out of chunks
+// and recycled through a per-thread free list, so allocation and release are a pointer swap.
+// Chunks are never returned to the system; they stay available for the next window.
+namespace wxd_pool {
+
+template <size_t Size, size_t Align>
+class FixedPool {
+public:
+    static void*
+    allocate()
+    {
+        Node*& head = free_list();
+        if (!head)
+            refill(head);
+        Node* node = head;
+        head = node->next;
+        return node;
+    }
+
+    // May be called on a different thread than allocate(); the block joins that thread's list.
+    static void
+    deallocate(void* block)
+    {
+        Node*& head = free_list();
+        Node* node = static_cast<Node*>(block);
+        node->next = head;
+        head = node;
+    }
+
+private:
+    union Node {
+        Node* next;
+        alignas(Align) unsigned char storage[Size];
+    };
+
+    static constexpr size_t kBlocksPerChunk = 64;
+
+    static Node*&
+    free_list()
+    {
+        thread_local Node* head = nullptr;
+        return head;
+    }
+
+    static void
+    refill(Node*& head)
+    {
+        Node* chunk = static_cast<Node*>(::operator new(sizeof(Node) * kBlocksPerChunk));
+        for (size_t i = kBlocksPerChunk; i > 0; --i) {
+            chunk[i - 1].next = head;
+            head = &chunk[i - 1];
+        }
+    }
+};
+
+// std::allocator replacement that serves single-element allocations from a FixedPool. Meant for
+// containers that usually hold one element, like the closure list of a dispatch slot; larger
+// requests go to operator new.
+template <typename T>
+struct SingleAllocator {
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    SingleAllocator() noexcept = default;
+    template <typename U>
+    SingleAllocator(const SingleAllocator<U>&) noexcept
+    {
+    }
+
+    T*
+    allocate(size_t n)
+    {
+        if (n == 1)
+            return static_cast<T*>(FixedPool<sizeof(T), alignof(T)>::allocate());
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void
+    deallocate(T* p, size_t n) noexcept
+    {
+        if (n == 1)
+            FixedPool<sizeof(T), alignof(T)>::deallocate(p);
+        else
+            ::operator delete(p);
+    }
+
+    template <typename U>
+    bool
+    operator==(const SingleAllocator<U>&) const noexcept
+    {
+        return true;
+    }
+    template <typename U>
+    bool
+    operator!=(const SingleAllocator<U>&) const noexcept
+    {
+        return false;
+    }
+};
+
+} // namespace wxd_pool
+
+#endif // WXD_POOL_H
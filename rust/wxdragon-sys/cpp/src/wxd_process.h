@@ -0,0 +1,33 @@
+#ifndef WXD_PROCESS_INTERNAL_H
+#define WXD_PROCESS_INTERNAL_H
+
+#include <stdint.h>
+#include <string>
+#include <wx/event.h>
+
+// Output chunk or exit notification of a wxd_ChildProcess_t, queued to its target handler
+// (internal; exposed as WXD_EVENT_TYPE_PROCESS_OUTPUT / WXD_EVENT_TYPE_PROCESS_EXIT). Does not
+// propagate.
+class wxdChildProcessEvent : public wxEvent {
+public:
+    wxdChildProcessEvent(wxEventType type = wxEVT_NULL, int64_t pid = 0)
+        : wxEvent(0, type), pid(pid)
+    {
+    }
+
+    wxEvent*
+    Clone() const override
+    {
+        return new wxdChildProcessEvent(*this);
+    }
+
+    int64_t pid;
+    bool is_stderr = false;
+    std::string data; // whole lines, except for the final chunk and pieces of over-long lines
+    int exit_code = -1;
+};
+
+wxDECLARE_EVENT(wxdEVT_PROCESS_OUTPUT, wxdChildProcessEvent);
+wxDECLARE_EVENT(wxdEVT_PROCESS_EXIT, wxdChildProcessEvent);
+
+#endif // WXD_PROCESS_INTERNAL_H
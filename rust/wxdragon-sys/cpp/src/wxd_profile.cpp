@@ -0,0 +1,251 @@
+#include "../include/wxdragon.h"
+
+#include <string.h>
+
+// FFI call profiler. When the library is configured with wxdENABLE_FFI_PROFILE, libwxdragon is
+// compiled with function instrumentation and the hooks below count calls and inclusive time per
+// function in per-thread tables. Inline wxWidgets and standard library code is left out at
+// compile time where the compiler allows it (-finstrument-functions-after-inlining on Clang, an
+// exclude file list on GCC), so the hooks mostly run for library functions. This file itself is
+// compiled without instrumentation. Without the option the C API still exists and reports
+// nothing.
+
+#if defined(WXD_FFI_PROFILE) && (defined(__GNUC__) || defined(__clang__))
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#if !defined(_WIN32)
+#include <dlfcn.h>
+#endif
+
+#define WXD_NO_INSTRUMENT __attribute__((no_instrument_function))
+
+namespace {
+
+constexpr size_t kSlotCount = 4096; // Power of two; distinct functions seen per thread
+constexpr size_t kMaxDepth = 256;
+
+// Each slot is written only by its owning thread (plain load + relaxed store, no RMW) and
+// read by wxd_Profile_Snapshot from any thread.
+struct ProfileSlot {
+    std::atomic<void*> fn{ nullptr };
+    std::atomic<uint64_t> calls{ 0 };
+    std::atomic<uint64_t> nanos{ 0 };
+};
+
+struct ThreadTable {
+    ProfileSlot slots[kSlotCount];
+    struct Frame {
+        ProfileSlot* slot;
+        std::chrono::steady_clock::time_point start;
+    } stack[kMaxDepth];
+    size_t depth = 0;
+    bool in_hook = false;
+};
+
+std::mutex s_tables_mutex;
+// Tables are never freed so a snapshot can still read threads that have exited.
+std::vector<ThreadTable*>& all_tables() WXD_NO_INSTRUMENT;
+
+std::vector<ThreadTable*>&
+all_tables()
+{
+    static std::vector<ThreadTable*> tables;
+    return tables;
+}
+
+ThreadTable* current_table() WXD_NO_INSTRUMENT;
+
+ThreadTable*
+current_table()
+{
+    thread_local ThreadTable* table = nullptr;
+    thread_local bool creating = false;
+    if (!table) {
+        // Library code called while registering (e.g. a shared, instrumented vector
+        // instantiation) re-enters the hooks; skip those calls.
+        if (creating)
+            return nullptr;
+        creating = true;
+        ThreadTable* created = new ThreadTable();
+        {
+            std::lock_guard<std::mutex> lock(s_tables_mutex);
+            all_tables().push_back(created);
+        }
+        table = created;
+        creating = false;
+    }
+    return table;
+}
+
+ProfileSlot* find_slot(ThreadTable* table, void* fn) WXD_NO_INSTRUMENT;
+
+ProfileSlot*
+find_slot(ThreadTable* table, void* fn)
+{
+    size_t index = (reinterpret_cast<uintptr_t>(fn) >> 4) & (kSlotCount - 1);
+    for (size_t probe = 0; probe < kSlotCount; ++probe) {
+        ProfileSlot& slot = table->slots[(index + probe) & (kSlotCount - 1)];
+        void* current = slot.fn.load(std::memory_order_relaxed);
+        if (current == fn)
+            return &slot;
+        if (!current) {
+            slot.fn.store(fn, std::memory_order_release);
+            return &slot;
+        }
+    }
+    return nullptr; // Table full; stop recording new functions on this thread
+}
+
+} // namespace
+
+extern "C" {
+
+void __cyg_profile_func_enter(void* fn, void* call_site) WXD_NO_INSTRUMENT;
+void __cyg_profile_func_exit(void* fn, void* call_site) WXD_NO_INSTRUMENT;
+
+void
+__cyg_profile_func_enter(void* fn, void* /*call_site*/)
+{
+    ThreadTable* table = current_table();
+    if (!table || table->in_hook)
+        return;
+    table->in_hook = true;
+    if (table->depth < kMaxDepth) {
+        ThreadTable::Frame& frame = table->stack[table->depth];
+        frame.slot = find_slot(table, fn);
+        frame.start = std::chrono::steady_clock::now();
+    }
+    ++table->depth;
+    table->in_hook = false;
+}
+
+void
+__cyg_profile_func_exit(void* /*fn*/, void* /*call_site*/)
+{
+    ThreadTable* table = current_table();
+    if (!table || table->in_hook || table->depth == 0)
+        return;
+    table->in_hook = true;
+    --table->depth;
+    if (table->depth < kMaxDepth) {
+        ThreadTable::Frame& frame = table->stack[table->depth];
+        if (frame.slot) {
+            const uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now() - frame.start)
+                                         .count();
+            ProfileSlot& slot = *frame.slot;
+            slot.calls.store(slot.calls.load(std::memory_order_relaxed) + 1,
+                             std::memory_order_relaxed);
+            slot.nanos.store(slot.nanos.load(std::memory_order_relaxed) + elapsed,
+                             std::memory_order_relaxed);
+        }
+    }
+    table->in_hook = false;
+}
+
+} // extern "C"
+
+namespace {
+
+const char*
+symbol_name(void* fn)
+{
+#if !defined(_WIN32)
+    Dl_info info;
+    if (dladdr(fn, &info) && info.dli_sname && info.dli_saddr == fn)
+        return info.dli_sname;
+#endif
+    (void)fn;
+    return nullptr;
+}
+
+} // namespace
+
+WXD_EXPORTED bool
+wxd_Profile_IsEnabled()
+{
+    return true;
+}
+
+WXD_EXPORTED size_t
+wxd_Profile_Snapshot(wxd_ProfileEntry* entries, size_t max_entries)
+{
+    // Merge every thread's table by function address.
+    std::vector<wxd_ProfileEntry> merged;
+    std::unordered_map<const void*, size_t> index_by_fn;
+    {
+        std::lock_guard<std::mutex> lock(s_tables_mutex);
+        for (ThreadTable* table : all_tables()) {
+            for (const ProfileSlot& slot : table->slots) {
+                void* fn = slot.fn.load(std::memory_order_acquire);
+                if (!fn)
+                    continue;
+                const uint64_t calls = slot.calls.load(std::memory_order_relaxed);
+                if (calls == 0)
+                    continue;
+                const uint64_t nanos = slot.nanos.load(std::memory_order_relaxed);
+                auto inserted = index_by_fn.emplace(fn, merged.size());
+                if (inserted.second) {
+                    merged.push_back(wxd_ProfileEntry{ fn, nullptr, calls, nanos });
+                }
+                else {
+                    wxd_ProfileEntry& entry = merged[inserted.first->second];
+                    entry.calls += calls;
+                    entry.total_nanos += nanos;
+                }
+            }
+        }
+    }
+
+    // Keep only the C API surface when symbols can be resolved; unnamed entries are kept.
+    size_t count = 0;
+    for (wxd_ProfileEntry& entry : merged) {
+        entry.name = symbol_name(const_cast<void*>(entry.function));
+        if (entry.name && strncmp(entry.name, "wxd_", 4) != 0)
+            continue;
+        if (entries && count < max_entries)
+            entries[count] = entry;
+        ++count;
+    }
+    return count;
+}
+
+// Best effort: a thread that is inside an instrumented call may still add its in-flight sample.
+WXD_EXPORTED void
+wxd_Profile_Reset()
+{
+    std::lock_guard<std::mutex> lock(s_tables_mutex);
+    for (ThreadTable* table : all_tables()) {
+        for (ProfileSlot& slot : table->slots) {
+            slot.calls.store(0, std::memory_order_relaxed);
+            slot.nanos.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+#else // !WXD_FFI_PROFILE
+
+WXD_EXPORTED bool
+wxd_Profile_IsEnabled()
+{
+    return false;
+}
+
+WXD_EXPORTED size_t
+wxd_Profile_Snapshot(wxd_ProfileEntry* entries, size_t max_entries)
+{
+    (void)entries;
+    (void)max_entries;
+    return 0;
+}
+
+WXD_EXPORTED void
+wxd_Profile_Reset()
+{
+}
+
+#endif
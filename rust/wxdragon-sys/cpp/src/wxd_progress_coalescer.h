@@ -0,0 +1,26 @@
+#ifndef WXD_PROGRESS_COALESCER_H
+#define WXD_PROGRESS_COALESCER_H
+
+#include <wx/appprogress.h>
+
+// Frame-paced progress setters (internal). Deferred status texts, gauge values and taskbar
+// progress values are held per target and applied at most once per display frame. The direct
+// setters call cancel() so that an immediate value is not overwritten by an older deferred one.
+namespace wxd_progress_coalescer {
+
+// Drops a pending deferred value for `target` (and `field` for status bars; -1 for all), called
+// by the direct setters.
+void
+cancel(const void* target, int field = -1);
+
+// Range of an app progress indicator as last set through the wrapper, for percentage checks.
+void
+set_app_progress_range(const wxAppProgressIndicator* indicator, int range);
+
+// Forgets everything about a destroyed app progress indicator.
+void
+forget_app_progress(const wxAppProgressIndicator* indicator);
+
+} // namespace wxd_progress_coalescer
+
+#endif // WXD_PROGRESS_COALESCER_H
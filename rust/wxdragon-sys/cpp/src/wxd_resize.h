@@ -0,0 +1,23 @@
+#ifndef WXD_RESIZE_H
+#define WXD_RESIZE_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Separable RGBA resampling (internal). Filters run on premultiplied colour in 14-bit fixed
+// point, with SSE2 or NEON doing the four channels of a pixel at once. Touches no wx state, so
+// it may run on any thread.
+namespace wxd_resize {
+
+enum class Filter { Nearest, Box, Bilinear, Bicubic };
+
+// Resizes straight (not premultiplied) RGBA rows `src_stride` bytes apart into `dst`, whose
+// rows are `dst_stride` bytes apart (0 for tightly packed, either side). False if a size is not
+// positive or memory runs out.
+bool
+resize_rgba(const uint8_t* src, int src_w, int src_h, size_t src_stride, uint8_t* dst, int dst_w,
+            int dst_h, size_t dst_stride, Filter filter);
+
+} // namespace wxd_resize
+
+#endif // WXD_RESIZE_H
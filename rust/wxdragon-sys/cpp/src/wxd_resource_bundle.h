@@ -0,0 +1,17 @@
+#ifndef WXD_RESOURCE_BUNDLE_INTERNAL_H
+#define WXD_RESOURCE_BUNDLE_INTERNAL_H
+
+#include <memory>
+#include "../include/wxd_types.h"
+
+// Internal access to resource bundles for other loaders.
+namespace wxd_resources {
+
+// A reference that keeps the bundle's mapping alive after the bundle is closed, so pointers from
+// wxd_ResourceBundle_Find can be held by long-lived objects.
+std::shared_ptr<const void>
+retain(const wxd_ResourceBundle_t* bundle);
+
+} // namespace wxd_resources
+
+#endif // WXD_RESOURCE_BUNDLE_INTERNAL_H
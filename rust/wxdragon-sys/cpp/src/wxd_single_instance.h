@@ -0,0 +1,24 @@
+#ifndef WXD_SINGLE_INSTANCE_H
+#define WXD_SINGLE_INSTANCE_H
+
+// Single-instance handoff (internal), configured with wxd_App_SetSingleInstance. wxd_Main calls
+// these around the application's lifetime; all are no-ops when no instance name is set.
+namespace wxd_single_instance {
+
+// Before wxEntryStart. Returns true if argv went to a running instance and wxd_Main should
+// return; otherwise this process may have become the running instance and started listening.
+bool
+hand_off(int argc, char** argv);
+
+// After OnInit succeeded: arguments received so far, and from now on, reach the callback on the
+// main thread.
+void
+app_started();
+
+// Before wxEntryCleanup: stops listening, drops undelivered arguments and frees the user data.
+void
+shutdown();
+
+} // namespace wxd_single_instance
+
+#endif // WXD_SINGLE_INSTANCE_H
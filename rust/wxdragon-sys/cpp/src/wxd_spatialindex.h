@@ -0,0 +1,27 @@
+#ifndef WXD_SPATIALINDEX_H
+#define WXD_SPATIALINDEX_H
+
+#include <stdint.h>
+#include <wx/event.h>
+
+// Sent to a window with an attached spatial index when the topmost item under the mouse
+// changes (internal; exposed as WXD_EVENT_TYPE_SPATIAL_HOVER_CHANGED). Does not propagate.
+class wxdSpatialHoverEvent : public wxEvent {
+public:
+    wxdSpatialHoverEvent(wxEventType type = wxEVT_NULL, int winid = 0) : wxEvent(winid, type) {}
+
+    wxEvent*
+    Clone() const override
+    {
+        return new wxdSpatialHoverEvent(*this);
+    }
+
+    int64_t item = 0;
+    int64_t previous = 0;
+    bool has_item = false;
+    bool had_previous = false;
+};
+
+wxDECLARE_EVENT(wxdEVT_SPATIAL_HOVER_CHANGED, wxdSpatialHoverEvent);
+
+#endif // WXD_SPATIALINDEX_H
@@ -0,0 +1,118 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include <wx/eventfilter.h>
+#include "../include/wxdragon.h"
+#include "wxd_startup.h"
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Nanoseconds since the clock epoch, +1 so that 0 means "not reached".
+std::atomic<int64_t> s_phases[WXD_STARTUP_PHASE_COUNT];
+
+int64_t
+now_ticks()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               Clock::now().time_since_epoch())
+               .count() +
+           1;
+}
+
+std::once_flag s_imageHandlersOnce;
+
+// Sees every event until the first paint, then removes itself and finishes the deferred
+// initialization once the loop is idle again.
+class FirstPaintFilter : public wxEventFilter {
+public:
+    int
+    FilterEvent(wxEvent& event) override
+    {
+        const wxEventType type = event.GetEventType();
+        if (type == wxEVT_IDLE) {
+            wxd_startup::mark(WXD_STARTUP_FIRST_IDLE);
+        }
+        else if (type == wxEVT_PAINT && !m_painted) {
+            m_painted = true;
+            wxd_startup::mark(WXD_STARTUP_FIRST_PAINT);
+            wxTheApp->CallAfter([this]() {
+                Remove();
+                wxd_startup::ensure_image_handlers();
+            });
+        }
+        return Event_Skip;
+    }
+
+    void
+    Install()
+    {
+        if (m_installed)
+            return;
+        m_painted = false;
+        wxEvtHandler::AddFilter(this);
+        m_installed = true;
+    }
+
+    void
+    Remove()
+    {
+        if (!m_installed)
+            return;
+        wxEvtHandler::RemoveFilter(this);
+        m_installed = false;
+    }
+
+private:
+    bool m_installed = false;
+    bool m_painted = false;
+};
+
+FirstPaintFilter s_firstPaintFilter;
+
+} // namespace
+
+void
+wxd_startup::mark(wxd_StartupPhase phase)
+{
+    if (phase < 0 || phase >= WXD_STARTUP_PHASE_COUNT)
+        return;
+    int64_t unset = 0;
+    s_phases[phase].compare_exchange_strong(unset, now_ticks(), std::memory_order_relaxed);
+}
+
+void
+wxd_startup::ensure_image_handlers()
+{
+    std::call_once(s_imageHandlersOnce, []() {
+        wxInitAllImageHandlers();
+        mark(WXD_STARTUP_IMAGE_HANDLERS);
+    });
+}
+
+void
+wxd_startup::app_started()
+{
+    s_firstPaintFilter.Install();
+}
+
+void
+wxd_startup::shutdown()
+{
+    s_firstPaintFilter.Remove();
+}
+
+WXD_EXPORTED int64_t
+wxd_Debug_GetStartupPhaseMicros(int phase)
+{
+    if (phase < 0 || phase >= WXD_STARTUP_PHASE_COUNT)
+        return -1;
+    const int64_t origin = s_phases[WXD_STARTUP_MAIN_ENTRY].load(std::memory_order_relaxed);
+    const int64_t at = s_phases[phase].load(std::memory_order_relaxed);
+    if (origin == 0 || at == 0)
+        return -1;
+    return (at - origin) / 1000;
+}
@@ -0,0 +1,29 @@
+#ifndef WXD_STARTUP_H
+#define WXD_STARTUP_H
+
+#include "../include/wxd_types.h"
+
+// Startup phase timestamps and deferred subsystem initialization (internal).
+namespace wxd_startup {
+
+// Records `phase` the first time it is reached. Any thread.
+void
+mark(wxd_StartupPhase phase);
+
+// Registers the wxImage handlers (PNG, JPEG, ...) unless done already. wxd_Main no longer does
+// this eagerly: call it before anything that reads or writes image files or streams. It also
+// runs on its own once the first paint has happened.
+void
+ensure_image_handlers();
+
+// After OnInit succeeded: watches for the first paint and idle events.
+void
+app_started();
+
+// Before wxEntryCleanup.
+void
+shutdown();
+
+} // namespace wxd_startup
+
+#endif // WXD_STARTUP_H
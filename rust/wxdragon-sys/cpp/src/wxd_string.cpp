@@ -0,0 +1,53 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include <wx/buffer.h>
+
+// Backing object for wxd_String_t. wxCharBuffer takes over (or copies, when the conversion
+// only borrowed the string's storage) the result of a single ToUTF8() call.
+struct WxdOwnedString {
+    wxCharBuffer utf8;
+};
+
+namespace wxd_cpp_utils {
+
+wxd_String_t*
+make_owned_string(const wxString& str)
+{
+    WxdOwnedString* owned = new (std::nothrow) WxdOwnedString{ wxCharBuffer(str.ToUTF8()) };
+    return reinterpret_cast<wxd_String_t*>(owned);
+}
+
+wxd_String_t*
+make_owned_string(const wxCharBuffer& utf8)
+{
+    WxdOwnedString* owned = new (std::nothrow) WxdOwnedString{ utf8 };
+    return reinterpret_cast<wxd_String_t*>(owned);
+}
+
+}
+
+WXD_EXPORTED const char*
+wxd_String_GetData(const wxd_String_t* self)
+{
+    if (!self)
+        return "";
+    const char* data = reinterpret_cast<const WxdOwnedString*>(self)->utf8.data();
+    return data ? data : "";
+}
+
+WXD_EXPORTED size_t
+wxd_String_GetLength(const wxd_String_t* self)
+{
+    if (!self)
+        return 0;
+    return reinterpret_cast<const WxdOwnedString*>(self)->utf8.length();
+}
+
+WXD_EXPORTED void
+wxd_String_Free(wxd_String_t* self)
+{
+    if (self) {
+        delete reinterpret_cast<WxdOwnedString*>(self);
+    }
+}
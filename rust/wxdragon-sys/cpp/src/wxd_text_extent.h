@@ -0,0 +1,65 @@
+#ifndef WXD_TEXT_EXTENT_H
+#define WXD_TEXT_EXTENT_H
+
+#include <wx/font.h>
+#include <cstddef>
+#include <cstdint>
+
+// Opt-in cache of measured text, shared by the DC and window extent entry points. Entries are
+// keyed by the UTF-8 bytes, the font's face, size and traits and the DPI / user scale, so a
+// changed font or scale simply misses. Main thread only.
+namespace wxd_text_extent {
+
+struct Extent {
+    int width = 0;
+    int height = 0;
+    int descent = 0;
+    int external_leading = 0;
+};
+
+struct Key {
+    uint64_t hash = 0;
+    uint64_t face = 0; // hash of the face name
+    double point_size = 0;
+    int traits = 0;
+    double scale_x = 1.0;
+    double scale_y = 1.0;
+    const char* text = nullptr;
+    size_t len = 0;
+};
+
+bool
+enabled();
+
+Key
+make_key(const wxFont& font, double scale_x, double scale_y, const char* utf8, size_t len);
+
+bool
+lookup(const Key& key, Extent* out);
+
+void
+store(const Key& key, const Extent& extent);
+
+// Returns the cached extent of `utf8` or calls `measure(const wxString&, Extent*)` and caches
+// the result. Without the cache enabled this only converts and measures.
+template <typename Measure>
+Extent
+measure(const wxFont& font, double scale_x, double scale_y, const char* utf8, size_t len,
+        Measure measure_fn)
+{
+    Extent extent;
+    if (!enabled()) {
+        measure_fn(wxString::FromUTF8(utf8, len), &extent);
+        return extent;
+    }
+    const Key key = make_key(font, scale_x, scale_y, utf8, len);
+    if (lookup(key, &extent))
+        return extent;
+    measure_fn(wxString::FromUTF8(utf8, len), &extent);
+    store(key, extent);
+    return extent;
+}
+
+} // namespace wxd_text_extent
+
+#endif // WXD_TEXT_EXTENT_H
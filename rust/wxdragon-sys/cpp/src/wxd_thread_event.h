@@ -0,0 +1,63 @@
+#ifndef WXD_THREAD_EVENT_INTERNAL_H
+#define WXD_THREAD_EVENT_INTERNAL_H
+
+#include <stdint.h>
+#include <memory>
+#include <wx/event.h>
+
+// Payload of a thread message; the drop function runs when the last event copy holding it is
+// deleted, unless the payload was taken first.
+class wxdThreadPayload {
+public:
+    wxdThreadPayload(void* data, void (*drop)(void*)) : m_data(data), m_drop(drop) {}
+    wxdThreadPayload(const wxdThreadPayload&) = delete;
+    wxdThreadPayload& operator=(const wxdThreadPayload&) = delete;
+
+    ~wxdThreadPayload()
+    {
+        if (m_data && m_drop)
+            m_drop(m_data);
+    }
+
+    void*
+    Get() const
+    {
+        return m_data;
+    }
+
+    void*
+    Take()
+    {
+        void* data = m_data;
+        m_data = nullptr;
+        return data;
+    }
+
+private:
+    void* m_data;
+    void (*m_drop)(void*);
+};
+
+// Message queued from a worker thread by wxd_EvtHandler_QueueThreadEvent (internal; exposed as
+// WXD_EVENT_TYPE_THREAD_MESSAGE). Copies share the payload.
+class wxdThreadMessageEvent : public wxThreadEvent {
+public:
+    wxdThreadMessageEvent(wxEventType type = wxEVT_NULL, int32_t kind = 0,
+                          std::shared_ptr<wxdThreadPayload> payload = nullptr)
+        : wxThreadEvent(type), kind(kind), payload(std::move(payload))
+    {
+    }
+
+    wxEvent*
+    Clone() const override
+    {
+        return new wxdThreadMessageEvent(*this);
+    }
+
+    int32_t kind;
+    std::shared_ptr<wxdThreadPayload> payload;
+};
+
+wxDECLARE_EVENT(wxdEVT_THREAD_MESSAGE, wxdThreadMessageEvent);
+
+#endif // WXD_THREAD_EVENT_INTERNAL_H
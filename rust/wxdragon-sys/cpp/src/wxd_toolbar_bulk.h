@@ -0,0 +1,177 @@
+#ifndef WXD_TOOLBAR_BULK_H
+#define WXD_TOOLBAR_BULK_H
+
+#include <wx/wx.h>
+#include <wx/bmpbndl.h>
+#include "../include/wxdragon.h"
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+// Bulk tool addition and tool visibility, shared by wxToolBar and wxAuiToolBar (internal).
+namespace wxd_toolbar_bulk {
+
+inline wxItemKind
+item_kind(int kind)
+{
+    switch (kind) {
+    case WXD_ITEM_CHECK:
+        return wxITEM_CHECK;
+    case WXD_ITEM_RADIO:
+        return wxITEM_RADIO;
+    case WXD_ITEM_SEPARATOR:
+        return wxITEM_SEPARATOR;
+    default:
+        return wxITEM_NORMAL;
+    }
+}
+
+inline wxString
+utf8(const char* text)
+{
+    return text ? wxString::FromUTF8(text) : wxString();
+}
+
+// Resolves the bitmaps of one batch. Tools naming the same bundle, or bitmaps sharing their
+// data, get one wxBitmapBundle, instead of a bundle wrapping a copy of the bitmap per tool.
+class BundleCache {
+public:
+    wxBitmapBundle
+    Get(const wxd_BitmapBundle_t* bundle, const wxd_Bitmap_t* bitmap)
+    {
+        if (bundle)
+            return *reinterpret_cast<const wxBitmapBundle*>(bundle);
+        const wxBitmap* bmp = reinterpret_cast<const wxBitmap*>(bitmap);
+        if (!bmp || !bmp->IsOk())
+            return wxBitmapBundle();
+        const void* key = bmp->GetRefData();
+        auto it = m_from_bitmaps.find(key);
+        if (it == m_from_bitmaps.end())
+            it = m_from_bitmaps.emplace(key, wxBitmapBundle::FromBitmap(*bmp)).first;
+        return it->second;
+    }
+
+private:
+    std::unordered_map<const void*, wxBitmapBundle> m_from_bitmaps;
+};
+
+// Neither toolbar can hide a tool, so a hidden tool is taken out and kept here together with
+// its place in the full tool order, and put back there among the tools shown at the time. Only
+// the changed tools move, and the toolbar is realized once per update.
+//
+// Ops provides: Item; size_t Count(); Item At(size_t pos); bool Same(const Item&, const Item&);
+// int Id(const Item&); Item Remove(size_t pos); void Insert(size_t pos, const Item&);
+// void Realize(); void Discard(Item&).
+template <typename Ops>
+class HiddenTools {
+public:
+    using Item = typename Ops::Item;
+
+    explicit HiddenTools(Ops ops) : m_ops(std::move(ops)) {}
+
+    ~HiddenTools()
+    {
+        for (Entry& entry : m_order) {
+            if (entry.hidden)
+                m_ops.Discard(entry.item);
+        }
+    }
+
+    HiddenTools(const HiddenTools&) = delete;
+    HiddenTools& operator=(const HiddenTools&) = delete;
+
+    // Returns how many tools changed visibility.
+    size_t
+    Apply(const wxd_Id* ids, const bool* visible, size_t count)
+    {
+        Sync();
+        size_t changed = 0;
+        std::unordered_set<int> show;
+        for (size_t i = 0; i < count; ++i) {
+            if (visible[i]) {
+                show.insert(ids[i]);
+                continue;
+            }
+            // Shown entries line up with the toolbar's tools.
+            size_t pos = 0;
+            for (Entry& entry : m_order) {
+                if (entry.hidden)
+                    continue;
+                if (m_ops.Id(entry.item) == ids[i]) {
+                    entry.item = m_ops.Remove(pos);
+                    entry.hidden = true;
+                    ++changed;
+                    break;
+                }
+                ++pos;
+            }
+        }
+        size_t pos = 0;
+        for (Entry& entry : m_order) {
+            if (entry.hidden && show.count(m_ops.Id(entry.item))) {
+                m_ops.Insert(pos, entry.item);
+                entry.hidden = false;
+                ++changed;
+            }
+            if (!entry.hidden)
+                ++pos;
+        }
+        if (changed)
+            m_ops.Realize();
+        return changed;
+    }
+
+    bool
+    IsHidden(wxd_Id id) const
+    {
+        for (const Entry& entry : m_order) {
+            if (entry.hidden && m_ops.Id(entry.item) == id)
+                return true;
+        }
+        return false;
+    }
+
+private:
+    struct Entry {
+        Item item;
+        bool hidden;
+    };
+
+    // Folds tools added or deleted since the last update into the order: a new tool goes after
+    // the tool shown before it, a deleted one is dropped, and hidden tools keep their place.
+    void
+    Sync()
+    {
+        std::vector<Entry> merged;
+        merged.reserve(m_order.size() + m_ops.Count());
+        size_t next = 0;
+        for (size_t pos = 0; pos < m_ops.Count(); ++pos) {
+            Item current = m_ops.At(pos);
+            size_t match = next;
+            while (match < m_order.size() &&
+                   (m_order[match].hidden || !m_ops.Same(m_order[match].item, current)))
+                ++match;
+            if (match < m_order.size()) {
+                for (; next < match; ++next) {
+                    if (m_order[next].hidden)
+                        merged.push_back(m_order[next]);
+                }
+                next = match + 1;
+            }
+            merged.push_back(Entry{ current, false });
+        }
+        for (; next < m_order.size(); ++next) {
+            if (m_order[next].hidden)
+                merged.push_back(m_order[next]);
+        }
+        m_order.swap(merged);
+    }
+
+    Ops m_ops;
+    std::vector<Entry> m_order;
+};
+
+} // namespace wxd_toolbar_bulk
+
+#endif // WXD_TOOLBAR_BULK_H
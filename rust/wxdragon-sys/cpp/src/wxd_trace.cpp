@@ -0,0 +1,313 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_trace.h"
+#include <wx/thread.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace wxd_trace {
+
+std::atomic<bool> g_enabled{ false };
+
+} // namespace wxd_trace
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr uint32_t kDefaultCapacity = 1u << 16;
+constexpr size_t kNameLen = 40;
+constexpr uint32_t kMainTid = 1;
+
+// One ring slot. `seq` is 0 while the slot is being written and index + 1 once complete, so
+// the exporter can skip slots torn by a concurrent writer.
+struct Record {
+    std::atomic<uint64_t> seq{ 0 };
+    uint64_t start_ns = 0;
+    uint64_t end_ns = 0;
+    const wxClassInfo* handler_class = nullptr;
+    int32_t event_type = 0;
+    uint32_t tid = 0;
+    uint8_t category = 0;
+    char name[kNameLen] = {};
+};
+
+struct Ring {
+    explicit Ring(uint32_t capacity) : records(new Record[capacity]), mask(capacity - 1) {}
+    std::unique_ptr<Record[]> records;
+    uint64_t mask;
+    std::atomic<uint64_t> next{ 0 };
+};
+
+std::atomic<Ring*> s_ring{ nullptr };
+// Rings replaced by a Start with a different capacity are kept, not freed: a writer on another
+// thread may still hold a pointer to one.
+std::vector<std::unique_ptr<Ring>> s_rings;
+std::mutex s_control_mutex;
+std::atomic<int64_t> s_epoch{ 0 };
+std::atomic<uint32_t> s_next_tid{ kMainTid + 1 };
+
+uint32_t
+current_tid()
+{
+    thread_local uint32_t tid = wxThread::IsMain()
+                                    ? kMainTid
+                                    : s_next_tid.fetch_add(1, std::memory_order_relaxed);
+    return tid;
+}
+
+uint32_t
+round_up_pow2(uint32_t value)
+{
+    uint32_t capacity = 1;
+    while (capacity < value && capacity < (1u << 30))
+        capacity <<= 1;
+    return capacity;
+}
+
+const char*
+category_name(uint8_t category)
+{
+    switch (category) {
+    case wxd_trace::CATEGORY_PAINT:
+        return "paint";
+    case wxd_trace::CATEGORY_IDLE:
+        return "idle";
+    case wxd_trace::CATEGORY_TIMER:
+        return "timer";
+    case wxd_trace::CATEGORY_USER:
+        return "rust";
+    default:
+        return "dispatch";
+    }
+}
+
+const char*
+event_name(int type)
+{
+    struct Named {
+        wxEventType type;
+        const char* name;
+    };
+    static const Named kNames[] = {
+        { wxEVT_PAINT, "Paint" },
+        { wxEVT_ERASE_BACKGROUND, "EraseBackground" },
+        { wxEVT_SIZE, "Size" },
+        { wxEVT_MOVE, "Move" },
+        { wxEVT_TIMER, "Timer" },
+        { wxEVT_IDLE, "Idle" },
+        { wxEVT_LEFT_DOWN, "LeftDown" },
+        { wxEVT_LEFT_UP, "LeftUp" },
+        { wxEVT_RIGHT_DOWN, "RightDown" },
+        { wxEVT_MOTION, "Motion" },
+        { wxEVT_MOUSEWHEEL, "MouseWheel" },
+        { wxEVT_KEY_DOWN, "KeyDown" },
+        { wxEVT_KEY_UP, "KeyUp" },
+        { wxEVT_CHAR, "Char" },
+        { wxEVT_SET_FOCUS, "SetFocus" },
+        { wxEVT_KILL_FOCUS, "KillFocus" },
+        { wxEVT_BUTTON, "Button" },
+        { wxEVT_MENU, "Menu" },
+        { wxEVT_TEXT, "Text" },
+        { wxEVT_CLOSE_WINDOW, "CloseWindow" },
+        { wxEVT_SHOW, "Show" },
+    };
+    for (const Named& named : kNames) {
+        if (named.type == type)
+            return named.name;
+    }
+    return "Event";
+}
+
+void
+append_json_string(std::string& out, const char* text)
+{
+    out += '"';
+    for (const char* p = text; *p; ++p) {
+        const unsigned char c = static_cast<unsigned char>(*p);
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += static_cast<char>(c);
+        }
+        else if (c < 0x20) {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out += escaped;
+        }
+        else {
+            out += static_cast<char>(c);
+        }
+    }
+    out += '"';
+}
+
+std::string
+chrome_json()
+{
+    std::string out = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    out += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,"
+           "\"args\":{\"name\":\"main\"}}";
+
+    Ring* ring = s_ring.load(std::memory_order_acquire);
+    if (ring) {
+        const uint64_t end = ring->next.load(std::memory_order_acquire);
+        const uint64_t capacity = ring->mask + 1;
+        const uint64_t begin = end > capacity ? end - capacity : 0;
+        char line[160];
+        for (uint64_t i = begin; i < end; ++i) {
+            const Record& slot = ring->records[i & ring->mask];
+            const uint64_t seq = slot.seq.load(std::memory_order_acquire);
+            if (seq != i + 1)
+                continue;
+            Record copy;
+            copy.start_ns = slot.start_ns;
+            copy.end_ns = slot.end_ns;
+            copy.handler_class = slot.handler_class;
+            copy.event_type = slot.event_type;
+            copy.tid = slot.tid;
+            copy.category = slot.category;
+            std::memcpy(copy.name, slot.name, kNameLen);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.seq.load(std::memory_order_relaxed) != seq)
+                continue;
+            copy.name[kNameLen - 1] = '\0';
+
+            out += ",{\"name\":";
+            append_json_string(out, copy.name[0] ? copy.name : event_name(copy.event_type));
+            const uint64_t dur = copy.end_ns > copy.start_ns ? copy.end_ns - copy.start_ns : 0;
+            snprintf(line, sizeof(line),
+                     ",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%" PRIu64
+                     ".%03u,\"dur\":%" PRIu64 ".%03u",
+                     category_name(copy.category), copy.tid, copy.start_ns / 1000,
+                     static_cast<unsigned>(copy.start_ns % 1000), dur / 1000,
+                     static_cast<unsigned>(dur % 1000));
+            out += line;
+            if (copy.handler_class) {
+                out += ",\"args\":{\"handler\":";
+                append_json_string(out,
+                                   wxString(copy.handler_class->GetClassName()).utf8_str());
+                snprintf(line, sizeof(line), ",\"event_type\":%d}", copy.event_type);
+                out += line;
+            }
+            out += '}';
+        }
+    }
+    out += "]}";
+    return out;
+}
+
+} // namespace
+
+uint64_t
+wxd_trace::now_ns()
+{
+    const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            Clock::now().time_since_epoch())
+                            .count();
+    const int64_t since = now - s_epoch.load(std::memory_order_relaxed);
+    return since > 0 ? static_cast<uint64_t>(since) : 0;
+}
+
+void
+wxd_trace::record(Category category, const char* name, int event_type,
+                  const wxClassInfo* handler_class, uint64_t start_ns, uint64_t end_ns)
+{
+    Ring* ring = s_ring.load(std::memory_order_acquire);
+    if (!ring)
+        return;
+    const uint64_t index = ring->next.fetch_add(1, std::memory_order_relaxed);
+    Record& slot = ring->records[index & ring->mask];
+    slot.seq.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.start_ns = start_ns;
+    slot.end_ns = end_ns;
+    slot.handler_class = handler_class;
+    slot.event_type = event_type;
+    slot.tid = current_tid();
+    slot.category = category;
+    if (name) {
+        strncpy(slot.name, name, kNameLen - 1);
+        slot.name[kNameLen - 1] = '\0';
+    }
+    else {
+        slot.name[0] = '\0';
+    }
+    slot.seq.store(index + 1, std::memory_order_release);
+}
+
+extern "C" {
+
+WXD_EXPORTED void
+wxd_Trace_Start(uint32_t capacity)
+{
+    std::lock_guard<std::mutex> lock(s_control_mutex);
+    capacity = round_up_pow2(capacity ? capacity : kDefaultCapacity);
+    wxd_trace::g_enabled.store(false, std::memory_order_relaxed);
+
+    Ring* ring = s_ring.load(std::memory_order_relaxed);
+    if (!ring || ring->mask + 1 != capacity) {
+        s_rings.push_back(std::make_unique<Ring>(capacity));
+        ring = s_rings.back().get();
+    }
+    else {
+        for (uint64_t i = 0; i <= ring->mask; ++i)
+            ring->records[i].seq.store(0, std::memory_order_relaxed);
+        ring->next.store(0, std::memory_order_relaxed);
+    }
+    s_epoch.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      Clock::now().time_since_epoch())
+                      .count(),
+                  std::memory_order_relaxed);
+    s_ring.store(ring, std::memory_order_release);
+    wxd_trace::g_enabled.store(true, std::memory_order_release);
+}
+
+WXD_EXPORTED void
+wxd_Trace_Stop(void)
+{
+    wxd_trace::g_enabled.store(false, std::memory_order_relaxed);
+}
+
+WXD_EXPORTED bool
+wxd_Trace_IsRecording(void)
+{
+    return wxd_trace::g_enabled.load(std::memory_order_relaxed);
+}
+
+WXD_EXPORTED uint64_t
+wxd_Trace_Now(void)
+{
+    return wxd_trace::now_ns();
+}
+
+WXD_EXPORTED void
+wxd_Trace_RecordSpan(const char* name, uint64_t start_ns, uint64_t end_ns)
+{
+    if (!wxd_trace::g_enabled.load(std::memory_order_relaxed))
+        return;
+    wxd_trace::record(wxd_trace::CATEGORY_USER, name ? name : "span", 0, nullptr, start_ns,
+                      end_ns);
+}
+
+WXD_EXPORTED size_t
+wxd_Trace_GetChromeJson(char* buffer, size_t buffer_len)
+{
+    const std::string json = chrome_json();
+    if (buffer && buffer_len > 0) {
+        const size_t n = std::min(buffer_len - 1, json.size());
+        std::memcpy(buffer, json.data(), n);
+        buffer[n] = '\0';
+    }
+    return json.size();
+}
+
+} // extern "C"
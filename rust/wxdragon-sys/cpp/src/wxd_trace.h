@@ -0,0 +1,77 @@
+#ifndef WXD_TRACE_H
+#define WXD_TRACE_H
+
+#include <atomic>
+#include <stdint.h>
+#include <wx/event.h>
+
+// Event-loop timeline recorder (internal). Spans around event dispatch, the idle callback drain,
+// paints and timer fires go into a fixed-size lock-free ring that can be exported as Chrome
+// trace_event JSON. Until wxd_Trace_Start is called every span is a single relaxed load.
+namespace wxd_trace {
+
+enum Category : uint8_t {
+    CATEGORY_DISPATCH,
+    CATEGORY_PAINT,
+    CATEGORY_IDLE,
+    CATEGORY_TIMER,
+    CATEGORY_USER, // Spans recorded through wxd_Trace_RecordSpan
+};
+
+extern std::atomic<bool> g_enabled;
+
+// Nanoseconds since the trace was started.
+uint64_t
+now_ns();
+
+// `name` is copied (truncated) into the ring; `handler_class` may be null.
+void
+record(Category category, const char* name, int event_type, const wxClassInfo* handler_class,
+       uint64_t start_ns, uint64_t end_ns);
+
+class Span {
+public:
+    // An event dispatch; paints and timer events get their own categories.
+    Span(wxEventType event_type, const wxEvtHandler* handler)
+    {
+        if (!g_enabled.load(std::memory_order_relaxed))
+            return;
+        m_category = event_type == wxEVT_PAINT   ? CATEGORY_PAINT
+                     : event_type == wxEVT_TIMER ? CATEGORY_TIMER
+                                                 : CATEGORY_DISPATCH;
+        m_eventType = event_type;
+        m_handlerClass = handler ? handler->GetClassInfo() : nullptr;
+        m_start = now_ns();
+        m_active = true;
+    }
+    // Work outside event dispatch; `name` must be a string literal.
+    Span(Category category, const char* name)
+    {
+        if (!g_enabled.load(std::memory_order_relaxed))
+            return;
+        m_category = category;
+        m_name = name;
+        m_start = now_ns();
+        m_active = true;
+    }
+    ~Span()
+    {
+        if (m_active)
+            record(m_category, m_name, m_eventType, m_handlerClass, m_start, now_ns());
+    }
+    Span(const Span&) = delete;
+    Span&
+    operator=(const Span&) = delete;
+
+private:
+    bool m_active = false;
+    Category m_category = CATEGORY_DISPATCH;
+    const char* m_name = nullptr;
+    int m_eventType = 0;
+    const wxClassInfo* m_handlerClass = nullptr;
+    uint64_t m_start = 0;
+};
+
+} // namespace wxd_trace
+
+#endif // WXD_TRACE_H
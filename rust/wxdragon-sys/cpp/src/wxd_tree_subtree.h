@@ -0,0 +1,83 @@
+#ifndef WXD_TREE_SUBTREE_INTERNAL_H
+#define WXD_TREE_SUBTREE_INTERNAL_H
+
+#include <wx/string.h>
+#include "../include/wxdragon.h"
+#include <string>
+#include <vector>
+
+// Flattened subtree returned by wxd_TreeCtrl_GetSubtree / wxd_TreeListCtrl_GetSubtree.
+struct wxd_TreeSubtree_t {
+    std::vector<wxd_TreeNode> nodes;
+    std::string text;
+};
+
+// Shared walking and validation for the TreeCtrl and TreeListCtrl subtree calls (internal).
+namespace wxd_tree_subtree {
+
+// Appends one node and returns its index.
+inline int32_t
+add_node(wxd_TreeSubtree_t& out, uint64_t item, int32_t parent, const wxString& label,
+         int32_t image, uint32_t state)
+{
+    const wxScopedCharBuffer utf8 = label.utf8_str();
+    wxd_TreeNode node{};
+    node.item = item;
+    node.parent = parent;
+    node.image = image;
+    node.label_offset = static_cast<uint32_t>(out.text.size());
+    node.label_len = static_cast<uint32_t>(utf8.length());
+    node.state = state;
+    out.text.append(utf8.data(), utf8.length());
+    out.nodes.push_back(node);
+    return static_cast<int32_t>(out.nodes.size() - 1);
+}
+
+// Pre-order walk from `start` down to `depth` levels below it (negative: all). `children(item,
+// vec)` appends the direct children of an item; `describe(out, item, parent)` adds its node.
+// Iterative, so deep trees do not exhaust the stack.
+template <typename Item, typename Children, typename Describe>
+void
+walk(wxd_TreeSubtree_t& out, const Item& start, int depth, Children children, Describe describe)
+{
+    struct Pending {
+        Item item;
+        int32_t parent;
+        int level;
+    };
+    std::vector<Pending> stack{ { start, -1, 0 } };
+    std::vector<Item> kids;
+    while (!stack.empty()) {
+        const Pending pending = stack.back();
+        stack.pop_back();
+        const int32_t index = describe(out, pending.item, pending.parent);
+        if (depth >= 0 && pending.level >= depth)
+            continue;
+        kids.clear();
+        children(pending.item, kids);
+        for (auto it = kids.rbegin(); it != kids.rend(); ++it) {
+            stack.push_back({ *it, index, pending.level + 1 });
+        }
+    }
+}
+
+// True if every node names an earlier parent (or -1) and its label lies inside `text`.
+inline bool
+valid_nodes(const wxd_TreeNode* nodes, size_t count, const char* text, size_t text_len)
+{
+    if (count > 0 && !nodes)
+        return false;
+    for (size_t i = 0; i < count; ++i) {
+        const wxd_TreeNode& node = nodes[i];
+        if (node.parent < -1 || (node.parent >= 0 && static_cast<size_t>(node.parent) >= i))
+            return false;
+        if (static_cast<uint64_t>(node.label_offset) + node.label_len > text_len ||
+            (node.label_len > 0 && !text))
+            return false;
+    }
+    return true;
+}
+
+} // namespace wxd_tree_subtree
+
+#endif // WXD_TREE_SUBTREE_INTERNAL_H
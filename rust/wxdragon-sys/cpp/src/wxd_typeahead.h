@@ -0,0 +1,20 @@
+#ifndef WXD_TYPEAHEAD_INTERNAL_H
+#define WXD_TYPEAHEAD_INTERNAL_H
+
+class wxWindow;
+
+// Type-ahead index of a control (internal). Wrappers that change a control's text without a
+// model notification call these, so the index re-reads what changed.
+namespace wxd_typeahead {
+
+// Marks rows [first..last] for re-reading; a no-op if no index is attached to `ctrl`.
+void
+rows_changed(wxWindow* ctrl, long first, long last);
+
+// Drops the index contents; it is rebuilt on the next query.
+void
+invalidate(wxWindow* ctrl);
+
+} // namespace wxd_typeahead
+
+#endif // WXD_TYPEAHEAD_INTERNAL_H
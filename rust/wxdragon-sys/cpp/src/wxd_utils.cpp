@@ -3,12 +3,159 @@
 #include <cstring>   // For strncpy, strlen
 #include <algorithm> // For std::min
 #include <cstdlib>   // For strdup
+#include <memory>    // For the scratch slots
+#include <unordered_map>
+#include <vector>    // For the per-thread conversion buffers
 
 namespace wxd_cpp_utils {
 
+namespace {
+
+struct DpiCache {
+    std::unordered_map<const wxWindow*, wxSize> windows;
+    wxSize screen;
+};
+
+DpiCache&
+dpi_cache()
+{
+    static DpiCache cache;
+    return cache;
+}
+
+wxSize
+screen_dpi()
+{
+    return wxGetDisplayPPI();
+}
+
+// Strings longer than this are converted with a one-off allocation so a single huge document
+// does not pin its size in every thread's scratch buffers.
+constexpr size_t kScratchMaxRetained = 1 << 20;
+
+struct ConversionArena {
+    std::vector<std::unique_ptr<wxString>> slots;
+    size_t depth = 0;
+    std::vector<wchar_t> wide;
+    std::vector<char> utf8;
+};
+
+ConversionArena&
+arena()
+{
+    thread_local ConversionArena instance;
+    return instance;
+}
+
+bool
+is_ascii(const char* s, size_t len)
+{
+    for (size_t i = 0; i < len; ++i) {
+        if (static_cast<unsigned char>(s[i]) >= 0x80)
+            return false;
+    }
+    return true;
+}
+
+void
+assign_from_utf8(wxString& out, const char* utf8, size_t len)
+{
+#if wxUSE_UNICODE_WCHAR
+    if (len > kScratchMaxRetained) {
+        out = wxString::FromUTF8(utf8, len);
+        return;
+    }
+    std::vector<wchar_t>& wide = arena().wide;
+    if (wide.size() < len + 1)
+        wide.resize(len + 1); // A UTF-8 byte never decodes to more than one wchar_t
+    size_t wide_len;
+    if (is_ascii(utf8, len)) {
+        for (size_t i = 0; i < len; ++i)
+            wide[i] = static_cast<wchar_t>(utf8[i]);
+        wide_len = len;
+    }
+    else {
+        wide_len = wxConvUTF8.ToWChar(wide.data(), wide.size(), utf8, len);
+        if (wide_len == wxCONV_FAILED) {
+            out.clear(); // Same result as FromUTF8() on invalid input
+            return;
+        }
+    }
+    out.assign(wide.data(), wide_len); // Reuses the slot's existing capacity
+#else
+    out = wxString::FromUTF8(utf8, len);
+#endif
+}
+
+} // namespace
+
+ScratchWxString::ScratchWxString(const char* utf8)
+    : ScratchWxString(utf8, utf8 ? strlen(utf8) : 0)
+{
+}
+
+ScratchWxString::ScratchWxString(const char* utf8, size_t len)
+{
+    ConversionArena& a = arena();
+    if (a.depth == a.slots.size())
+        a.slots.push_back(std::unique_ptr<wxString>(new wxString()));
+    m_str = a.slots[a.depth++].get();
+    if (utf8)
+        assign_from_utf8(*m_str, utf8, len);
+    else
+        m_str->clear();
+}
+
+ScratchWxString::~ScratchWxString()
+{
+    ConversionArena& a = arena();
+    --a.depth;
+    if (m_str->length() > kScratchMaxRetained)
+        *m_str = wxString(); // Release a huge buffer rather than keep it per thread
+}
+
+bool
+unpack_utf8_array(const char* packed, const uint32_t* offsets, size_t count, wxArrayString& out)
+{
+    out.clear();
+    if (count == 0)
+        return true;
+    if (!packed || !offsets)
+        return false;
+    out.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        if (offsets[i + 1] < offsets[i]) {
+            out.clear();
+            return false;
+        }
+        out.push_back(wxString());
+        assign_from_utf8(out.back(), packed + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+    return true;
+}
+
 size_t
 copy_wxstring_to_buffer(const wxString& str, char* buffer, size_t buffer_len)
 {
+#if wxUSE_UNICODE_WCHAR
+    // Encode into the per-thread buffer instead of allocating a wxCharBuffer per call.
+    const size_t wide_len = str.length();
+    if (wide_len <= kScratchMaxRetained) {
+        std::vector<char>& utf8 = arena().utf8;
+        if (utf8.size() < wide_len * 4 + 1)
+            utf8.resize(wide_len * 4 + 1); // Worst case is 4 bytes per code unit
+        size_t source_len = wxConvUTF8.FromWChar(utf8.data(), utf8.size(), str.wc_str(), wide_len);
+        if (source_len != wxCONV_FAILED) {
+            if (buffer && buffer_len > 0) {
+                size_t copy_len = std::min(source_len, buffer_len - 1);
+                memcpy(buffer, utf8.data(), copy_len);
+                buffer[copy_len] = '\0';
+            }
+            return source_len;
+        }
+    }
+#endif
+
     wxScopedCharBuffer utf8_buf = str.ToUTF8();
     size_t source_len = utf8_buf.length(); // Length of the UTF-8 string, excluding null terminator
 
@@ -28,6 +175,45 @@ copy_wxstring_to_buffer(const wxString& str, char* buffer, size_t buffer_len)
     return source_len; // Return the original length of the UTF-8 string (excluding its null terminator)
 }
 
+wxSize
+cached_dpi(const wxWindow* window)
+{
+    if (!wxThread::IsMain())
+        return window ? window->GetDPI() : screen_dpi();
+
+    DpiCache& cache = dpi_cache();
+    wxWindow* tlw = window ? wxGetTopLevelParent(const_cast<wxWindow*>(window)) : nullptr;
+    if (!tlw) {
+        if (window)
+            return window->GetDPI();
+        if (cache.screen == wxSize())
+            cache.screen = screen_dpi();
+        return cache.screen;
+    }
+
+    auto it = cache.windows.find(tlw);
+    if (it != cache.windows.end())
+        return it->second;
+
+    // The entry lives as long as the window and is refreshed in place, so these handlers are
+    // bound once per top-level window.
+    const wxSize dpi = tlw->GetDPI();
+    cache.windows.emplace(tlw, dpi);
+    tlw->Bind(wxEVT_DPI_CHANGED, [tlw](wxDPIChangedEvent& event) {
+        DpiCache& c = dpi_cache();
+        c.windows[tlw] = event.GetNewDPI();
+        c.screen = wxSize();
+        event.Skip();
+    });
+    // Destroy events of children propagate here too.
+    tlw->Bind(wxEVT_DESTROY, [tlw](wxWindowDestroyEvent& event) {
+        if (event.GetEventObject() == tlw)
+            dpi_cache().windows.erase(tlw);
+        event.Skip();
+    });
+    return dpi;
+}
+
 }
 
 // --- Colour Conversion Helper Implementations ---
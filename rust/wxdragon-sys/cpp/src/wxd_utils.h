@@ -3,6 +3,7 @@
 
 #include <wx/gdicmn.h>            // For wxPoint, wxSize, wxDefaultPosition, wxDefaultSize
 #include <wx/string.h>            // For wxString
+#include <wx/arrstr.h>            // For wxArrayString
 #include <wx/window.h>            // For wxWindow and FromDIP/ToDIP functions
 #include "../include/wxd_types.h" // For wxd_Point, wxd_Size (CHANGED from wxdragon.h)
 #include <wx/colour.h>            // For wxColour type
@@ -34,30 +35,56 @@ wxd_Variant_Free_Rust_String(char* str);
 
 namespace wxd_cpp_utils {
 
+// DPI of the display `window` is on, or of the main display for nullptr. Cached per top-level
+// window and dropped on wxEVT_DPI_CHANGED, so conversions don't query system metrics each call.
+wxSize
+cached_dpi(const wxWindow* window);
+
+// Same result as wxWindow::FromDIP(v, window) for one coordinate, given the cached DPI.
+inline int
+from_dip(int v, int dpi)
+{
+#ifdef wxHAS_DPI_INDEPENDENT_PIXELS
+    wxUnusedVar(dpi);
+    return v;
+#else
+    return v == wxDefaultCoord ? v : wxRescaleCoord(v).From(96).To(dpi);
+#endif
+}
+
 // Inline helper function to convert wxd_Point to wxPoint
-// This function automatically applies FromDIP() to ensure DPI-aware positioning
+// Converts from DIPs for the display of `window` (usually the new widget's parent), so that
+// positions are right on mixed-DPI setups
 inline wxPoint
-to_wx(const wxd_Point& p)
+to_wx(const wxd_Point& p, const wxWindow* window = nullptr)
 {
     if (p.x == -1 && p.y == -1) { // Common convention for default pos
         return wxDefaultPosition;
     }
-    // Apply FromDIP to convert device-independent pixels to physical pixels
-    // This ensures consistent positioning across different DPI settings and build configurations
-    return wxWindow::FromDIP(wxPoint(p.x, p.y), nullptr);
+#ifdef wxHAS_DPI_INDEPENDENT_PIXELS
+    wxUnusedVar(window);
+    return wxPoint(p.x, p.y);
+#else
+    const wxSize dpi = cached_dpi(window);
+    return wxPoint(from_dip(p.x, dpi.x), from_dip(p.y, dpi.y));
+#endif
 }
 
 // Inline helper function to convert wxd_Size to wxSize
-// This function automatically applies FromDIP() to ensure DPI-aware sizing
+// Converts from DIPs for the display of `window`, like the wxd_Point overload
 inline wxSize
-to_wx(const wxd_Size& s)
+to_wx(const wxd_Size& s, const wxWindow* window = nullptr)
 {
     if (s.width == -1 && s.height == -1) { // Common convention for default size
         return wxDefaultSize;
     }
-    // Apply FromDIP to convert device-independent pixels to physical pixels
-    // This ensures consistent sizing across different DPI settings and build configurations
-    return wxWindow::FromDIP(wxSize(s.width, s.height), nullptr);
+#ifdef wxHAS_DPI_INDEPENDENT_PIXELS
+    wxUnusedVar(window);
+    return wxSize(s.width, s.height);
+#else
+    const wxSize dpi = cached_dpi(window);
+    return wxSize(from_dip(s.width, dpi.x), from_dip(s.height, dpi.y));
+#endif
 }
 
 /**
@@ -75,6 +102,63 @@ to_wx(const wxd_Size& s)
 size_t
 copy_wxstring_to_buffer(const wxString& str, char* buffer, size_t buffer_len);
 
+/**
+ * @brief UTF-8 -> wxString conversion into a reusable per-thread buffer.
+ *
+ * Drop-in for wxString::FromUTF8() in setters: the decoded text lives in a thread-local slot
+ * whose capacity is kept between calls, so hot paths (grid cells, list/tree item text) stop
+ * allocating a temporary per call. Slots are stacked, so a handler that runs synchronously
+ * inside the setter (e.g. wxEVT_TEXT) and converts again gets its own slot. Must not outlive
+ * the enclosing scope; copy it if the callee keeps only a reference.
+ */
+class ScratchWxString {
+public:
+    // NUL-terminated input; nullptr yields an empty string.
+    explicit ScratchWxString(const char* utf8);
+    // Length-aware input; does not need NUL termination and skips strlen().
+    ScratchWxString(const char* utf8, size_t len);
+    ~ScratchWxString();
+
+    ScratchWxString(const ScratchWxString&) = delete;
+    ScratchWxString&
+    operator=(const ScratchWxString&) = delete;
+
+    const wxString&
+    str() const
+    {
+        return *m_str;
+    }
+    operator const wxString&() const
+    {
+        return *m_str;
+    }
+
+private:
+    wxString* m_str;
+};
+
+/**
+ * @brief Converts a wxString to UTF-8 once and returns it as an owned wxd_String_t.
+ *
+ * Preferred over copy_wxstring_to_buffer for getters that can return large text, since the
+ * caller does not need a sizing call. Returns nullptr on allocation failure.
+ */
+wxd_String_t*
+make_owned_string(const wxString& str);
+
+// Wraps UTF-8 bytes that were already assembled (wxCharBuffer is ref-counted, so no copy).
+wxd_String_t*
+make_owned_string(const wxCharBuffer& utf8);
+
+/**
+ * @brief Decodes `count` packed UTF-8 strings into `out` (replacing its contents).
+ *
+ * String i is packed[offsets[i]..offsets[i + 1]), so `offsets` holds count + 1 entries. Storage
+ * is reserved up front. Returns false, leaving `out` empty, if the offsets are not monotonic.
+ */
+bool
+unpack_utf8_array(const char* packed, const uint32_t* offsets, size_t count, wxArrayString& out);
+
 }
 
 // Helper to convert wxd_Colour_t representation (unsigned long RGBA) to wxColour
@@ -14,6 +14,7 @@
 
 #include "../include/wxdragon.h"
 #include "../include/wxd_variant.h"
+#include "wxd_objstats.h"
 
 // Opaque handle is actually a wxVariant
 static inline const wxVariant*
@@ -119,7 +120,7 @@ extern "C" WXD_EXPORTED wxd_Variant_t*
 wxd_Variant_CreateEmpty(void)
 {
     wxVariant* v = new (std::nothrow) wxVariant();
-    return reinterpret_cast<wxd_Variant_t*>(v);
+    return reinterpret_cast<wxd_Variant_t*>(wxd_objstats::track(WXD_OBJECT_KIND_VARIANT, v));
 }
 
 // Clone the variant. Returns nullptr if input is nullptr.
@@ -132,13 +133,14 @@ wxd_Variant_Clone(const wxd_Variant_t* variant)
     }
     const wxVariant* src = as_wx_const(variant);
     wxVariant* v = new (std::nothrow) wxVariant(*src);
-    return reinterpret_cast<wxd_Variant_t*>(v);
+    return reinterpret_cast<wxd_Variant_t*>(wxd_objstats::track(WXD_OBJECT_KIND_VARIANT, v));
 }
 
 extern "C" WXD_EXPORTED void
 wxd_Variant_Destroy(wxd_Variant_t* variant)
 {
     wxVariant* v = as_wx_mut(variant);
+    wxd_objstats::untrack(WXD_OBJECT_KIND_VARIANT, v);
     delete v;
 }
 
@@ -252,6 +254,39 @@ wxd_Variant_SetString_Utf8(wxd_Variant_t* variant, const char* s, int len)
     *v = ws;
 }
 
+extern "C" WXD_EXPORTED void
+wxd_Variant_SetValue(wxd_Variant_t* variant, const wxd_VariantValue* value)
+{
+    wxVariant* v = as_wx_mut(variant);
+    if (!v)
+        return;
+    if (!value) {
+        v->MakeNull();
+        return;
+    }
+    // wxVariant's scalar assignments overwrite unshared data of the same type in place.
+    switch (value->kind) {
+    case WXD_VARIANT_VALUE_BOOL:
+        *v = value->data.b;
+        break;
+    case WXD_VARIANT_VALUE_INT64:
+        *v = wxLongLong(value->data.i);
+        break;
+    case WXD_VARIANT_VALUE_DOUBLE:
+        *v = value->data.d;
+        break;
+    case WXD_VARIANT_VALUE_STRING:
+        if (value->data.text.ptr)
+            *v = wxString::FromUTF8(value->data.text.ptr, value->data.text.len);
+        else
+            *v = wxString();
+        break;
+    default:
+        v->MakeNull();
+        break;
+    }
+}
+
 extern "C" WXD_EXPORTED void
 wxd_Variant_SetDateTime(wxd_Variant_t* variant, const wxd_DateTime_t* value)
 {
@@ -408,7 +443,7 @@ wxd_Variant_GetBitmapClone(const wxd_Variant_t* variant)
         delete cloned;
         return nullptr;
     }
-    return reinterpret_cast<wxd_Bitmap_t*>(cloned);
+    return reinterpret_cast<wxd_Bitmap_t*>(wxd_objstats::track(cloned));
 }
 
 extern "C" WXD_EXPORTED void
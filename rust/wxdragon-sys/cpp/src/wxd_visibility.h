@@ -0,0 +1,57 @@
+#ifndef WXD_VISIBILITY_INTERNAL_H
+#define WXD_VISIBILITY_INTERNAL_H
+
+#include <stdint.h>
+#include <wx/event.h>
+
+class wxTimer;
+class wxWindow;
+
+// Sent (queued) to a tracked top-level window when it becomes visible or hidden (internal;
+// exposed as WXD_EVENT_TYPE_VISIBILITY_CHANGED).
+class wxdVisibilityEvent : public wxEvent {
+public:
+    wxdVisibilityEvent(wxEventType type = wxEVT_NULL, int winid = 0, uint32_t reasons = 0)
+        : wxEvent(winid, type), reasons(reasons)
+    {
+    }
+
+    wxEvent*
+    Clone() const override
+    {
+        return new wxdVisibilityEvent(*this);
+    }
+
+    uint32_t reasons; // wxd_HiddenReason bits; 0 = visible
+};
+
+wxDECLARE_EVENT(wxdEVT_VISIBILITY_CHANGED, wxdVisibilityEvent);
+
+namespace wxd_visibility {
+
+// False while `window`'s top-level window pauses refreshes and cannot be seen; the whole
+// top-level window is then refreshed once it is visible again. Free when nothing is paused.
+bool
+refresh_allowed(wxWindow* window);
+
+// Drops the hidden-interval override of a timer about to be deleted.
+void
+forget_timer(wxTimer* timer);
+
+// Re-arms the frame-paced refreshes held for `tlw` while it was hidden (refresh_scheduler.cpp).
+void
+resume_scheduled_refresh(wxWindow* tlw);
+
+#ifdef __WXOSX__
+// NSWindow occlusion state (window_osx.mm). The observer calls `changed(ctx)` on the main thread.
+bool
+osx_is_occluded(wxWindow* tlw);
+void*
+osx_observe_occlusion(wxWindow* tlw, void (*changed)(void* ctx), void* ctx);
+void
+osx_stop_observing(void* token);
+#endif
+
+} // namespace wxd_visibility
+
+#endif // WXD_VISIBILITY_INTERNAL_H
@@ -0,0 +1,138 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_watchdog.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace wxd_watchdog {
+
+std::atomic<bool> g_enabled{ false };
+std::atomic<uint64_t> g_state{ 0 };
+Frame g_frames[kMaxFrames];
+
+} // namespace wxd_watchdog
+
+namespace {
+
+std::atomic<uint32_t> s_threshold_ms{ 0 };
+std::mutex s_control_mutex; // Serializes start()/stop()
+std::mutex s_mutex;
+std::condition_variable s_wake;
+std::thread s_thread;
+bool s_stop = false;
+
+void
+report_stall(uint64_t stalled_ms)
+{
+    using namespace wxd_watchdog;
+    uint32_t depth = depth_of(g_state.load(std::memory_order_acquire));
+    if (depth == 0)
+        return; // Finished between the check and now
+    if (depth > static_cast<uint32_t>(kMaxFrames))
+        depth = kMaxFrames;
+
+    WXD_LOG_WARNF("Main thread stalled for %llu ms inside %u nested event dispatch(es)",
+                  static_cast<unsigned long long>(stalled_ms), depth);
+    for (uint32_t i = depth; i > 0; --i) {
+        const Frame& frame = g_frames[i - 1];
+        const wxClassInfo* cls = frame.handler_class.load(std::memory_order_relaxed);
+        // Class names are static string literals, so reading them off-thread is safe.
+        wxString name = cls ? wxString(cls->GetClassName()) : wxString("<unknown>");
+        WXD_LOG_WARNF("  #%u event type %d, handler %s, binding token %zu", depth - i,
+                      frame.event_type.load(std::memory_order_relaxed),
+                      static_cast<const char*>(name.utf8_str()),
+                      frame.binding.load(std::memory_order_relaxed));
+    }
+}
+
+void
+watchdog_main()
+{
+    using namespace wxd_watchdog;
+    uint64_t last_beat = heartbeat_of(g_state.load(std::memory_order_acquire));
+    auto last_change = std::chrono::steady_clock::now();
+    uint64_t reported_beat = 0;
+    bool reported = false;
+
+    std::unique_lock<std::mutex> lock(s_mutex);
+    while (!s_stop) {
+        const uint32_t threshold = s_threshold_ms.load(std::memory_order_relaxed);
+        s_wake.wait_for(lock, std::chrono::milliseconds(threshold / 4 + 1));
+        if (s_stop)
+            break;
+
+        const auto now = std::chrono::steady_clock::now();
+        const uint64_t state = g_state.load(std::memory_order_acquire);
+        const uint64_t beat = heartbeat_of(state);
+        if (beat != last_beat || depth_of(state) == 0) {
+            // Progress, or idle in the native event loop: not a stall.
+            last_beat = beat;
+            last_change = now;
+            continue;
+        }
+
+        const uint64_t stalled_ms =
+            std::chrono::duration_cast<std::chrono::milliseconds>(now - last_change).count();
+        if (stalled_ms >= threshold && !(reported && reported_beat == beat)) {
+            report_stall(stalled_ms);
+            reported = true;
+            reported_beat = beat; // One report per stall
+        }
+    }
+}
+
+} // namespace
+
+void
+wxd_watchdog::start()
+{
+    std::lock_guard<std::mutex> control(s_control_mutex);
+    if (s_threshold_ms.load(std::memory_order_relaxed) == 0 || s_thread.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_stop = false;
+    }
+    g_state.store(0, std::memory_order_relaxed);
+    g_enabled.store(true, std::memory_order_relaxed);
+    s_thread = std::thread(watchdog_main);
+}
+
+void
+wxd_watchdog::stop()
+{
+    std::lock_guard<std::mutex> control(s_control_mutex);
+    g_enabled.store(false, std::memory_order_relaxed);
+    if (!s_thread.joinable())
+        return;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        s_stop = true;
+    }
+    s_wake.notify_all();
+    s_thread.join();
+}
+
+// --- C API ---
+
+WXD_EXPORTED void
+wxd_Watchdog_SetThreshold(uint32_t threshold_ms)
+{
+    s_threshold_ms.store(threshold_ms, std::memory_order_relaxed);
+    if (threshold_ms == 0) {
+        wxd_watchdog::stop();
+    }
+    else if (wxTheApp && wxTheApp->IsMainLoopRunning()) {
+        wxd_watchdog::start(); // Enabled after startup: begin watching right away
+    }
+}
+
+WXD_EXPORTED uint32_t
+wxd_Watchdog_GetThreshold()
+{
+    return s_threshold_ms.load(std::memory_order_relaxed);
+}
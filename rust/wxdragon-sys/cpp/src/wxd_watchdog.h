@@ -0,0 +1,110 @@
+#ifndef WXD_WATCHDOG_H
+#define WXD_WATCHDOG_H
+
+#include <atomic>
+#include <stdint.h>
+#include <wx/event.h>
+
+// Main-thread stall watchdog (internal). The event loop marks the start and end of every
+// dispatch; a background thread reports through the log sink when a dispatch has been running
+// longer than the configured threshold. All hooks are no-ops until the watchdog is enabled.
+namespace wxd_watchdog {
+
+// What the main thread is currently executing. Lives in static storage so the watchdog thread
+// can read it at any time; fields are relaxed atomics (plain moves on the usual targets) and
+// only ever give a best-effort picture.
+struct Frame {
+    std::atomic<int> event_type{ 0 };
+    std::atomic<const wxClassInfo*> handler_class{ nullptr };
+    std::atomic<size_t> binding{ 0 }; // Token of the closure running, 0 before the first
+};
+
+constexpr int kMaxFrames = 16;
+constexpr int kDepthBits = 16;
+constexpr uint64_t kDepthMask = (uint64_t(1) << kDepthBits) - 1;
+
+extern std::atomic<bool> g_enabled;
+// Published dispatch state, written only by the main thread: the nesting depth in the low
+// kDepthBits bits and a heartbeat counting entries and exits above them. One release store per
+// entry and exit publishes both, without read-modify-write.
+extern std::atomic<uint64_t> g_state;
+extern Frame g_frames[kMaxFrames];
+
+inline uint32_t
+depth_of(uint64_t state)
+{
+    return static_cast<uint32_t>(state & kDepthMask);
+}
+
+inline uint64_t
+heartbeat_of(uint64_t state)
+{
+    return state >> kDepthBits;
+}
+
+inline void
+enter(wxEventType event_type, const wxEvtHandler* handler)
+{
+    if (!g_enabled.load(std::memory_order_relaxed))
+        return;
+    const uint64_t state = g_state.load(std::memory_order_relaxed);
+    const uint32_t depth = depth_of(state);
+    Frame& frame = g_frames[depth < kMaxFrames ? depth : kMaxFrames - 1];
+    frame.event_type.store(event_type, std::memory_order_relaxed);
+    frame.handler_class.store(handler ? handler->GetClassInfo() : nullptr,
+                              std::memory_order_relaxed);
+    frame.binding.store(0, std::memory_order_relaxed);
+    g_state.store(((heartbeat_of(state) + 1) << kDepthBits) | ((depth + 1) & kDepthMask),
+                  std::memory_order_release);
+}
+
+// Records the binding (its unbind token) about to run in the innermost dispatch, so a report
+// names the handler rather than the trampoline all bindings share.
+inline void
+set_binding(size_t token)
+{
+    if (!g_enabled.load(std::memory_order_relaxed))
+        return;
+    const uint32_t depth = depth_of(g_state.load(std::memory_order_relaxed));
+    if (depth == 0)
+        return;
+    g_frames[depth <= kMaxFrames ? depth - 1 : kMaxFrames - 1].binding.store(
+        token, std::memory_order_relaxed);
+}
+
+inline void
+leave()
+{
+    if (!g_enabled.load(std::memory_order_relaxed))
+        return;
+    const uint64_t state = g_state.load(std::memory_order_relaxed);
+    const uint32_t depth = depth_of(state);
+    g_state.store(((heartbeat_of(state) + 1) << kDepthBits) | (depth > 0 ? depth - 1 : 0),
+                  std::memory_order_release);
+}
+
+// Scope helper for dispatch entry/exit.
+class Scope {
+public:
+    Scope(wxEventType event_type, const wxEvtHandler* handler)
+    {
+        enter(event_type, handler);
+    }
+    ~Scope()
+    {
+        leave();
+    }
+    Scope(const Scope&) = delete;
+    Scope&
+    operator=(const Scope&) = delete;
+};
+
+// Starts/stops the watchdog thread; called from wxd_Main around the event loop.
+void
+start();
+void
+stop();
+
+} // namespace wxd_watchdog
+
+#endif // WXD_WATCHDOG_H
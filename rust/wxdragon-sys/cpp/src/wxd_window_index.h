@@ -0,0 +1,20 @@
+#ifndef WXD_WINDOW_INDEX_H
+#define WXD_WINDOW_INDEX_H
+
+class wxString;
+class wxWindow;
+
+// Lookups behind wxd_Window_FindWindowById/ByName/ByXRCName (internal). They answer from the
+// index of the nearest ancestor that has one (see wxd_Window_SetLookupIndexEnabled) and fall
+// back to wxWindow::FindWindow otherwise, with the same results.
+namespace wxd_window_index {
+
+wxWindow*
+find_by_id(wxWindow* window, int id);
+
+wxWindow*
+find_by_name(wxWindow* window, const wxString& name);
+
+} // namespace wxd_window_index
+
+#endif // WXD_WINDOW_INDEX_H
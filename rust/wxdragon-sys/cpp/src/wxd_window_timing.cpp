@@ -0,0 +1,136 @@
+#include <wx/wxprec.h>
+#include <wx/wx.h>
+#include "../include/wxdragon.h"
+#include "wxd_window_timing.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace wxd_window_timing {
+
+std::atomic<bool> g_enabled{ false };
+
+} // namespace wxd_window_timing
+
+namespace {
+
+struct Totals {
+    uint64_t count = 0;
+    uint64_t total_nanos = 0;
+    uint64_t max_nanos = 0;
+    uint64_t over_budget = 0;
+};
+
+using RowKey = std::tuple<std::string, std::string, int>;
+
+std::mutex s_mutex;
+std::map<RowKey, Totals> s_rows;
+std::atomic<uint64_t> s_budget_nanos{ 0 };
+
+const char*
+kind_name(int kind)
+{
+    switch (kind) {
+    case WXD_WINDOW_TIMING_PAINT:
+        return "paint";
+    case WXD_WINDOW_TIMING_SIZE:
+        return "size";
+    default:
+        return "layout";
+    }
+}
+
+void
+copy_truncated(char* dest, size_t capacity, const std::string& src)
+{
+    const size_t n = std::min(capacity - 1, src.size());
+    std::memcpy(dest, src.data(), n);
+    dest[n] = '\0';
+}
+
+} // namespace
+
+wxd_window_timing::Key
+wxd_window_timing::key_for(wxEvtHandler* handler)
+{
+    Key key;
+    if (wxClassInfo* info = handler->GetClassInfo())
+        key.class_name = wxString(info->GetClassName()).utf8_string();
+    if (wxWindow* win = wxDynamicCast(handler, wxWindow))
+        key.window_name = win->GetName().utf8_string();
+    return key;
+}
+
+void
+wxd_window_timing::record(int kind, const Key& key, std::chrono::steady_clock::duration elapsed)
+{
+    const uint64_t nanos = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    const uint64_t budget = s_budget_nanos.load(std::memory_order_relaxed);
+    const bool over = budget > 0 && nanos > budget;
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        Totals& row = s_rows[RowKey(key.class_name, key.window_name, kind)];
+        ++row.count;
+        row.total_nanos += nanos;
+        row.max_nanos = std::max(row.max_nanos, nanos);
+        if (over)
+            ++row.over_budget;
+    }
+    if (over) {
+        WXD_LOG_WARNF("%s of %s \"%s\" took %llu us (budget %llu us)", kind_name(kind),
+                      key.class_name.c_str(), key.window_name.c_str(),
+                      static_cast<unsigned long long>(nanos / 1000),
+                      static_cast<unsigned long long>(budget / 1000));
+    }
+}
+
+extern "C" {
+
+WXD_EXPORTED void
+wxd_Debug_EnableWindowTimings(bool enable)
+{
+    wxd_window_timing::g_enabled.store(enable, std::memory_order_relaxed);
+}
+
+WXD_EXPORTED void
+wxd_Debug_SetWindowTimingBudget(uint32_t budget_us)
+{
+    s_budget_nanos.store(static_cast<uint64_t>(budget_us) * 1000, std::memory_order_relaxed);
+}
+
+WXD_EXPORTED size_t
+wxd_Debug_GetWindowTimings(wxd_WindowTiming* entries, size_t max_entries, bool reset)
+{
+    std::vector<std::pair<const RowKey*, const Totals*>> sorted;
+    std::lock_guard<std::mutex> lock(s_mutex);
+    const size_t available = s_rows.size();
+    if (entries && max_entries > 0) {
+        sorted.reserve(available);
+        for (const auto& row : s_rows)
+            sorted.emplace_back(&row.first, &row.second);
+        std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+            return a.second->total_nanos > b.second->total_nanos;
+        });
+        for (size_t i = 0; i < max_entries && i < sorted.size(); ++i) {
+            wxd_WindowTiming& out = entries[i];
+            copy_truncated(out.class_name, sizeof(out.class_name), std::get<0>(*sorted[i].first));
+            copy_truncated(out.window_name, sizeof(out.window_name),
+                           std::get<1>(*sorted[i].first));
+            out.kind = std::get<2>(*sorted[i].first);
+            out.count = sorted[i].second->count;
+            out.total_nanos = sorted[i].second->total_nanos;
+            out.max_nanos = sorted[i].second->max_nanos;
+            out.over_budget = sorted[i].second->over_budget;
+        }
+    }
+    if (reset)
+        s_rows.clear();
+    return available;
+}
+
+} // extern "C"
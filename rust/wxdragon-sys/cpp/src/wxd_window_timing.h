@@ -0,0 +1,68 @@
+#ifndef WXD_WINDOW_TIMING_H
+#define WXD_WINDOW_TIMING_H
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <wx/event.h>
+#include "../include/wxd_types.h"
+
+// Per-window paint/size/layout timing (internal). Scopes placed around wxEVT_PAINT and
+// wxEVT_SIZE dispatch and around wrapper-triggered Layout() calls add their duration to a table
+// keyed by window class and name. Disabled, a scope is a single relaxed load.
+namespace wxd_window_timing {
+
+extern std::atomic<bool> g_enabled;
+
+// Resolved when the scope starts, since the window may be gone by the time it ends.
+struct Key {
+    std::string class_name;
+    std::string window_name;
+};
+
+Key
+key_for(wxEvtHandler* handler);
+
+void
+record(int kind, const Key& key, std::chrono::steady_clock::duration elapsed);
+
+// Kind timed for an event type, or -1 if the dispatcher does not time it.
+inline int
+kind_for_event(wxEventType event_type)
+{
+    if (event_type == wxEVT_PAINT)
+        return WXD_WINDOW_TIMING_PAINT;
+    if (event_type == wxEVT_SIZE)
+        return WXD_WINDOW_TIMING_SIZE;
+    return -1;
+}
+
+class Scope {
+public:
+    // A negative kind makes the scope inert.
+    Scope(int kind, wxEvtHandler* handler)
+    {
+        if (kind >= 0 && handler && g_enabled.load(std::memory_order_relaxed)) {
+            m_kind = kind;
+            m_key = key_for(handler);
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+    ~Scope()
+    {
+        if (m_kind >= 0)
+            record(m_kind, m_key, std::chrono::steady_clock::now() - m_start);
+    }
+    Scope(const Scope&) = delete;
+    Scope&
+    operator=(const Scope&) = delete;
+
+private:
+    int m_kind = -1;
+    Key m_key;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+} // namespace wxd_window_timing
+
+#endif // WXD_WINDOW_TIMING_H
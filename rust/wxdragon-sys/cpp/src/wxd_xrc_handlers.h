@@ -0,0 +1,21 @@
+#ifndef WXD_XRC_HANDLERS_H
+#define WXD_XRC_HANDLERS_H
+
+#include <functional>
+
+// Deferred XRC handler registration (internal). Registering every standard handler creates
+// some eighty objects, so wxd_XmlResource_InitAllHandlers and the custom handlers only queue
+// their registration; the queue runs, in request order, before the first object is created
+// from XRC.
+namespace wxd_xrc {
+
+void
+defer_handler_setup(std::function<void()> step);
+
+// Runs the queued registrations, and registers the image handlers XRC bitmaps need.
+void
+ensure_handlers();
+
+} // namespace wxd_xrc
+
+#endif // WXD_XRC_HANDLERS_H
@@ -10,6 +10,44 @@
 #include <wx/panel.h>
 #include <wx/filename.h>
 #include <wx/file.h>
+#include "wxd_utils.h"
+#include "wxd_startup.h"
+#include "wxd_window_index.h"
+#include "wxd_xrc_handlers.h"
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+std::vector<std::function<void()>>&
+pending_handler_setup()
+{
+    static std::vector<std::function<void()>> steps;
+    return steps;
+}
+
+} // namespace
+
+void
+wxd_xrc::defer_handler_setup(std::function<void()> step)
+{
+    pending_handler_setup().push_back(std::move(step));
+}
+
+void
+wxd_xrc::ensure_handlers()
+{
+    wxd_startup::ensure_image_handlers();
+    std::vector<std::function<void()>> steps;
+    steps.swap(pending_handler_setup());
+    for (const auto& step : steps)
+        step();
+}
 
 // Get the global wxXmlResource instance
 extern "C" WXD_EXPORTED wxd_XmlResource_t*
@@ -18,14 +56,15 @@ wxd_XmlResource_Get(void)
     return reinterpret_cast<wxd_XmlResource_t*>(wxXmlResource::Get());
 }
 
-// Initialize all standard handlers
+// Initialize all standard handlers; deferred until the first object is loaded, and only once
+// per resource object since InitAllHandlers itself appends duplicates.
 extern "C" WXD_EXPORTED void
 wxd_XmlResource_InitAllHandlers(wxd_XmlResource_t* self)
 {
     wxXmlResource* resource = reinterpret_cast<wxXmlResource*>(self);
-    if (resource) {
-        resource->InitAllHandlers();
-    }
+    static std::unordered_set<wxXmlResource*> s_requested;
+    if (resource && s_requested.insert(resource).second)
+        wxd_xrc::defer_handler_setup([resource]() { resource->InitAllHandlers(); });
 }
 
 // Load XRC from file
@@ -76,6 +115,7 @@ wxd_XmlResource_LoadDialog(wxd_XmlResource_t* self, wxd_Window_t* parent, const
     wxXmlResource* resource = reinterpret_cast<wxXmlResource*>(self);
     wxWindow* parentWindow = reinterpret_cast<wxWindow*>(parent);
     wxString dialogName = wxString::FromUTF8(name);
+    wxd_xrc::ensure_handlers();
 
     wxDialog* dialog = resource->LoadDialog(parentWindow, dialogName);
     return reinterpret_cast<wxd_Dialog_t*>(dialog);
@@ -91,6 +131,7 @@ wxd_XmlResource_LoadFrame(wxd_XmlResource_t* self, wxd_Window_t* parent, const c
     wxXmlResource* resource = reinterpret_cast<wxXmlResource*>(self);
     wxWindow* parentWindow = reinterpret_cast<wxWindow*>(parent);
     wxString frameName = wxString::FromUTF8(name);
+    wxd_xrc::ensure_handlers();
 
     wxFrame* frame = resource->LoadFrame(parentWindow, frameName);
     return reinterpret_cast<wxd_Frame_t*>(frame);
@@ -106,6 +147,7 @@ wxd_XmlResource_LoadPanel(wxd_XmlResource_t* self, wxd_Window_t* parent, const c
     wxXmlResource* resource = reinterpret_cast<wxXmlResource*>(self);
     wxWindow* parentWindow = reinterpret_cast<wxWindow*>(parent);
     wxString panelName = wxString::FromUTF8(name);
+    wxd_xrc::ensure_handlers();
 
     wxPanel* panel = resource->LoadPanel(parentWindow, panelName);
     return reinterpret_cast<wxd_Panel_t*>(panel);
@@ -121,6 +163,7 @@ wxd_XmlResource_LoadMenuBar(wxd_XmlResource_t* self, wxd_Window_t* parent, const
     wxXmlResource* resource = reinterpret_cast<wxXmlResource*>(self);
     wxWindow* parentWindow = reinterpret_cast<wxWindow*>(parent); // parent can be null for menubars
     wxString menubarName = wxString::FromUTF8(name);
+    wxd_xrc::ensure_handlers();
 
     wxMenuBar* menubar = resource->LoadMenuBar(parentWindow, menubarName);
     return reinterpret_cast<wxd_MenuBar_t*>(menubar);
@@ -138,6 +181,7 @@ wxd_XmlResource_LoadObject(wxd_XmlResource_t* self, wxd_Window_t* parent, const
     wxWindow* parentWindow = reinterpret_cast<wxWindow*>(parent); // parent can be null
     wxString wxName = wxString::FromUTF8(name);
     wxString wxClassname = wxString::FromUTF8(classname);
+    wxd_xrc::ensure_handlers();
 
     wxObject* object = resource->LoadObject(parentWindow, wxName, wxClassname);
     if (object && object->IsKindOf(wxCLASSINFO(wxWindow))) {
@@ -168,6 +212,245 @@ wxd_Window_FindWindowByXRCName(wxd_Window_t* self, const char* name)
     wxString windowName = wxString::FromUTF8(name);
 
     // Use FindWindow to find child by name
-    wxWindow* child = window->FindWindow(windowName);
+    wxWindow* child = wxd_window_index::find_by_name(window, windowName);
     return reinterpret_cast<wxd_Window_t*>(child);
-}
\ No newline at end of file
+}
+
+// --- Compiled XRC ---
+// A compiled resource is the parsed DOM of an XRC document, so loading it rebuilds the
+// wxXmlNode tree directly without running the XML parser. Little-endian layout:
+//   "WXRB", u32 format version, u32 string count, strings (u32 length + UTF-8),
+//   then the root element: u8 node type, u32 name, u32 content, u32 attribute count,
+//   attribute (name, value) string indices, u32 child count, children.
+
+namespace {
+
+const char kCompiledXrcMagic[4] = { 'W', 'X', 'R', 'B' };
+const uint32_t kCompiledXrcVersion = 1;
+
+class CompiledXrcWriter {
+public:
+    wxCharBuffer
+    Write(const wxXmlNode* root)
+    {
+        WriteNode(root);
+        std::string out(kCompiledXrcMagic, sizeof(kCompiledXrcMagic));
+        PutU32(out, kCompiledXrcVersion);
+        PutU32(out, static_cast<uint32_t>(m_strings.size()));
+        for (const std::string& str : m_strings) {
+            PutU32(out, static_cast<uint32_t>(str.size()));
+            out += str;
+        }
+        out += m_nodes;
+        wxCharBuffer buffer(out.size());
+        memcpy(buffer.data(), out.data(), out.size());
+        return buffer;
+    }
+
+private:
+    static void
+    PutU32(std::string& out, uint32_t value)
+    {
+        for (int i = 0; i < 4; ++i)
+            out += static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+
+    uint32_t
+    Intern(const wxString& str)
+    {
+        const wxScopedCharBuffer utf8 = str.utf8_str();
+        std::string key(utf8.data(), utf8.length());
+        auto found = m_index.find(key);
+        if (found != m_index.end())
+            return found->second;
+        const uint32_t index = static_cast<uint32_t>(m_strings.size());
+        m_index.emplace(key, index);
+        m_strings.push_back(std::move(key));
+        return index;
+    }
+
+    void
+    WriteNode(const wxXmlNode* node)
+    {
+        m_nodes += static_cast<char>(node->GetType());
+        PutU32(m_nodes, Intern(node->GetName()));
+        PutU32(m_nodes, Intern(node->GetContent()));
+
+        uint32_t attr_count = 0;
+        for (const wxXmlAttribute* attr = node->GetAttributes(); attr; attr = attr->GetNext())
+            ++attr_count;
+        PutU32(m_nodes, attr_count);
+        for (const wxXmlAttribute* attr = node->GetAttributes(); attr; attr = attr->GetNext()) {
+            PutU32(m_nodes, Intern(attr->GetName()));
+            PutU32(m_nodes, Intern(attr->GetValue()));
+        }
+
+        uint32_t child_count = 0;
+        for (const wxXmlNode* child = node->GetChildren(); child; child = child->GetNext()) {
+            // Comments never reach the XRC handlers.
+            if (child->GetType() != wxXML_COMMENT_NODE)
+                ++child_count;
+        }
+        PutU32(m_nodes, child_count);
+        for (const wxXmlNode* child = node->GetChildren(); child; child = child->GetNext()) {
+            if (child->GetType() != wxXML_COMMENT_NODE)
+                WriteNode(child);
+        }
+    }
+
+    std::vector<std::string> m_strings;
+    std::unordered_map<std::string, uint32_t> m_index;
+    std::string m_nodes;
+};
+
+class CompiledXrcReader {
+public:
+    CompiledXrcReader(const uint8_t* data, size_t len) : m_data(data), m_len(len) {}
+
+    // Returns the root element, or null if the data is not a compiled resource of this version.
+    wxXmlNode*
+    Read()
+    {
+        uint32_t version = 0;
+        uint32_t string_count = 0;
+        if (m_len < sizeof(kCompiledXrcMagic) ||
+            memcmp(m_data, kCompiledXrcMagic, sizeof(kCompiledXrcMagic)) != 0) {
+            return nullptr;
+        }
+        m_pos = sizeof(kCompiledXrcMagic);
+        if (!U32(version) || version != kCompiledXrcVersion || !U32(string_count) ||
+            string_count > (m_len - m_pos) / 4) {
+            return nullptr;
+        }
+        m_strings.reserve(string_count);
+        for (uint32_t i = 0; i < string_count; ++i) {
+            uint32_t len = 0;
+            if (!U32(len) || m_len - m_pos < len)
+                return nullptr;
+            m_strings.push_back(
+                wxString::FromUTF8(reinterpret_cast<const char*>(m_data + m_pos), len));
+            m_pos += len;
+        }
+        wxXmlNode* root = ReadNode(0);
+        if (root && (m_pos != m_len || root->GetType() != wxXML_ELEMENT_NODE)) {
+            delete root;
+            return nullptr;
+        }
+        return root;
+    }
+
+private:
+    // XRC nests a few levels per sizer; this only guards against corrupt input.
+    static constexpr int kMaxDepth = 512;
+
+    bool
+    U32(uint32_t& out)
+    {
+        if (m_len - m_pos < 4)
+            return false;
+        out = uint32_t(m_data[m_pos]) | uint32_t(m_data[m_pos + 1]) << 8 |
+              uint32_t(m_data[m_pos + 2]) << 16 | uint32_t(m_data[m_pos + 3]) << 24;
+        m_pos += 4;
+        return true;
+    }
+
+    bool
+    String(const wxString*& out)
+    {
+        uint32_t index = 0;
+        if (!U32(index) || index >= m_strings.size())
+            return false;
+        out = &m_strings[index];
+        return true;
+    }
+
+    wxXmlNode*
+    ReadNode(int depth)
+    {
+        const wxString* name = nullptr;
+        const wxString* content = nullptr;
+        uint32_t attr_count = 0;
+        if (depth > kMaxDepth || m_pos >= m_len)
+            return nullptr;
+        const uint8_t type = m_data[m_pos++];
+        if (type < wxXML_ELEMENT_NODE || type > wxXML_HTML_DOCUMENT_NODE || !String(name) ||
+            !String(content) || !U32(attr_count)) {
+            return nullptr;
+        }
+
+        std::unique_ptr<wxXmlNode> node(
+            new wxXmlNode(static_cast<wxXmlNodeType>(type), *name, *content));
+        // Attributes and children are linked by hand: AddAttribute/AddChild walk the list.
+        wxXmlAttribute* last_attr = nullptr;
+        for (uint32_t i = 0; i < attr_count; ++i) {
+            const wxString* attr_name = nullptr;
+            const wxString* attr_value = nullptr;
+            if (!String(attr_name) || !String(attr_value))
+                return nullptr;
+            wxXmlAttribute* attr = new wxXmlAttribute(*attr_name, *attr_value);
+            if (last_attr)
+                last_attr->SetNext(attr);
+            else
+                node->SetAttributes(attr);
+            last_attr = attr;
+        }
+
+        uint32_t child_count = 0;
+        if (!U32(child_count))
+            return nullptr;
+        wxXmlNode* last_child = nullptr;
+        for (uint32_t i = 0; i < child_count; ++i) {
+            wxXmlNode* child = ReadNode(depth + 1);
+            if (!child)
+                return nullptr;
+            child->SetParent(node.get());
+            if (last_child)
+                last_child->SetNext(child);
+            else
+                node->SetChildren(child);
+            last_child = child;
+        }
+        return node.release();
+    }
+
+    const uint8_t* m_data;
+    size_t m_len;
+    size_t m_pos = 0;
+    std::vector<wxString> m_strings;
+};
+
+} // namespace
+
+// Parse XRC data once and return its compiled form
+extern "C" WXD_EXPORTED wxd_String_t*
+wxd_XmlResource_CompileString(const char* xrc_data, size_t len)
+{
+    if (!xrc_data)
+        return nullptr;
+
+    wxMemoryInputStream stream(xrc_data, len);
+    wxXmlDocument doc;
+    if (!doc.Load(stream) || !doc.GetRoot())
+        return nullptr;
+    return wxd_cpp_utils::make_owned_string(CompiledXrcWriter().Write(doc.GetRoot()));
+}
+
+// Load compiled XRC data without parsing XML
+extern "C" WXD_EXPORTED bool
+wxd_XmlResource_LoadCompiled(wxd_XmlResource_t* self, const uint8_t* data, size_t len,
+                             const char* name)
+{
+    if (!self || !data)
+        return false;
+
+    wxXmlNode* root = CompiledXrcReader(data, len).Read();
+    if (!root)
+        return false;
+
+    wxXmlResource* resource = reinterpret_cast<wxXmlResource*>(self);
+    wxXmlDocument* doc = new wxXmlDocument();
+    doc->SetRoot(root);
+    const wxString doc_name =
+        name ? wxString::FromUTF8(name) : wxString::Format("compiled_xrc_%p", (void*)doc);
+    return resource->LoadDocument(doc, doc_name);
+}
@@ -21,6 +21,7 @@ include!("generated_constants/wx_gtk_constants.rs");
 compile_error!("Target OS not supported by pre-generated constants. Please add a constants file for this OS.");
 
 mod logging4c;
+pub use logging4c::sync_log_max_level;
 
 // Type alias for convenience maybe?
 // pub type wxWindow_t = self::wxd_Window_t; // Example
@@ -14,6 +14,27 @@ fn map_level(level: i32) -> log::Level {
     }
 }
 
+fn level_filter_to_int(filter: log::LevelFilter) -> i32 {
+    match filter {
+        log::LevelFilter::Off => 0,
+        log::LevelFilter::Error => 1,
+        log::LevelFilter::Warn => 2,
+        log::LevelFilter::Info => 3,
+        log::LevelFilter::Debug => 4,
+        log::LevelFilter::Trace => 5,
+    }
+}
+
+/// Pushes `log::max_level()` to the C/C++ side.
+///
+/// The C/C++ logging macros test this cached level before formatting anything, so messages
+/// the Rust logger would discard cost no more than an atomic load. The cached level starts at
+/// Trace and only changes through this function, so call it again after every change of the
+/// maximum level, raising as well as lowering.
+pub fn sync_log_max_level() {
+    unsafe { crate::wxd_log_set_max_level(level_filter_to_int(log::max_level())) };
+}
+
 /// General logging entrypoint for C/C++ with explicit level.
 ///
 /// Safety and behavior:
@@ -23,6 +44,11 @@ fn map_level(level: i32) -> log::Level {
 #[unsafe(no_mangle)]
 pub extern "C" fn wxd_rust_log(level: i32, msg: *const std::os::raw::c_char) {
     let c_cpp = "C/C++";
+    // Not synced from here: before a logger is installed the level reads Off, and a cached Off
+    // would keep dropping native records after the level is raised.
+    if level > level_filter_to_int(log::max_level()) {
+        return;
+    }
     if msg.is_null() {
         log::warn!("{c_cpp}: wxd_rust_log called with null pointer (level: {level:?})");
         return;
@@ -280,6 +280,66 @@ pub trait AccessibleImpl {
     }
 }
 
+/// Properties of one accessible child (or of the object itself, child id 0) published ahead
+/// of time with [`Accessible::publish_nodes`]. Unset properties are still asked from the
+/// [`AccessibleImpl`].
+#[derive(Debug, Clone, Default, PartialEq)]
+pub struct AccessibleNode {
+    pub child_id: i32,
+    pub name: Option<String>,
+    pub description: Option<String>,
+    pub value: Option<String>,
+    pub default_action: Option<String>,
+    pub role: Option<AccRole>,
+    pub state: Option<AccState>,
+    /// In the window's client coordinates.
+    pub location: Option<crate::geometry::Rect>,
+}
+
+impl AccessibleNode {
+    pub fn new(child_id: i32) -> Self {
+        Self {
+            child_id,
+            ..Default::default()
+        }
+    }
+
+    pub fn name(mut self, name: impl Into<String>) -> Self {
+        self.name = Some(name.into());
+        self
+    }
+
+    pub fn description(mut self, description: impl Into<String>) -> Self {
+        self.description = Some(description.into());
+        self
+    }
+
+    pub fn value(mut self, value: impl Into<String>) -> Self {
+        self.value = Some(value.into());
+        self
+    }
+
+    pub fn default_action(mut self, action: impl Into<String>) -> Self {
+        self.default_action = Some(action.into());
+        self
+    }
+
+    pub fn role(mut self, role: AccRole) -> Self {
+        self.role = Some(role);
+        self
+    }
+
+    pub fn state(mut self, state: AccState) -> Self {
+        self.state = Some(state);
+        self
+    }
+
+    pub fn location(mut self, rect: crate::geometry::Rect) -> Self {
+        self.location = Some(rect);
+        self
+    }
+}
+
 /// A wrapper around wxAccessible for providing accessibility information.
 pub struct Accessible {
     pub(crate) ptr: *mut ffi::wxd_Accessible_t,
@@ -329,6 +389,74 @@ impl Accessible {
         self.ptr
     }
 
+    /// Caches `nodes` natively so screen reader queries for them no longer reach the
+    /// [`AccessibleImpl`]; a virtual control can publish just the rows in view. With `notify`,
+    /// changes to nodes that were already cached are announced to assistive technology.
+    ///
+    /// Only accessibles made with [`Accessible::new`] have a cache; for others this does nothing.
+    pub fn publish_nodes(&self, nodes: &[AccessibleNode], notify: bool) {
+        let cstr = |s: &Option<String>| s.as_deref().map(|s| std::ffi::CString::new(s).unwrap_or_default());
+        let strings: Vec<[Option<std::ffi::CString>; 4]> = nodes
+            .iter()
+            .map(|n| [cstr(&n.name), cstr(&n.description), cstr(&n.value), cstr(&n.default_action)])
+            .collect();
+        let ptr = |s: &Option<std::ffi::CString>| s.as_ref().map_or(std::ptr::null(), |s| s.as_ptr());
+        let raw: Vec<ffi::wxd_AccNode> = nodes
+            .iter()
+            .zip(&strings)
+            .map(|(n, [name, description, value, action])| {
+                let mut fields = 0u32;
+                let mut flag = |set: bool, field: ffi::wxd_AccNodeFields| {
+                    if set {
+                        fields |= field as u32;
+                    }
+                };
+                flag(name.is_some(), ffi::wxd_AccNodeFields_WXD_ACC_NODE_NAME);
+                flag(description.is_some(), ffi::wxd_AccNodeFields_WXD_ACC_NODE_DESCRIPTION);
+                flag(value.is_some(), ffi::wxd_AccNodeFields_WXD_ACC_NODE_VALUE);
+                flag(action.is_some(), ffi::wxd_AccNodeFields_WXD_ACC_NODE_DEFAULT_ACTION);
+                flag(n.role.is_some(), ffi::wxd_AccNodeFields_WXD_ACC_NODE_ROLE);
+                flag(n.state.is_some(), ffi::wxd_AccNodeFields_WXD_ACC_NODE_STATE);
+                flag(n.location.is_some(), ffi::wxd_AccNodeFields_WXD_ACC_NODE_LOCATION);
+                let rect = n.location.unwrap_or_default();
+                ffi::wxd_AccNode {
+                    child_id: n.child_id,
+                    fields,
+                    role: n.role.unwrap_or(AccRole::None).to_ffi(),
+                    state: n.state.map_or(0, |s| s.bits() as c_long),
+                    name: ptr(name),
+                    description: ptr(description),
+                    value: ptr(value),
+                    default_action: ptr(action),
+                    rect: ffi::wxd_Rect {
+                        x: rect.x,
+                        y: rect.y,
+                        width: rect.width,
+                        height: rect.height,
+                    },
+                }
+            })
+            .collect();
+        unsafe { ffi::wxd_Accessible_PublishNodes(self.ptr, raw.as_ptr(), raw.len() as c_int, notify) };
+    }
+
+    /// Answers child count queries with `count` instead of the [`AccessibleImpl`]; `None`
+    /// asks the implementation again.
+    pub fn set_cached_child_count(&self, count: Option<i32>) {
+        unsafe { ffi::wxd_Accessible_SetCachedChildCount(self.ptr, count.unwrap_or(-1)) };
+    }
+
+    /// Drops the cached nodes for `child_ids`, e.g. rows scrolled out of view or changed.
+    pub fn invalidate_nodes(&self, child_ids: std::ops::Range<i32>) {
+        let count = child_ids.end.saturating_sub(child_ids.start).max(0);
+        unsafe { ffi::wxd_Accessible_InvalidateNodes(self.ptr, child_ids.start, count) };
+    }
+
+    /// Drops every cached node and the cached child count.
+    pub fn clear_cache(&self) {
+        unsafe { ffi::wxd_Accessible_InvalidateNodes(self.ptr, 0, -1) };
+    }
+
     /// Notifies the accessibility system of an event.
     pub fn notify_event(event_type: u32, window: &dyn crate::window::WxWidget, object_type: AccObjectType, object_id: i32) {
         unsafe {
@@ -2,23 +2,370 @@
 // Currently, the main application logic is driven by the C wxd_Main function.
 // This module might later contain wrappers for App-specific functions if needed.
 
-use std::collections::VecDeque;
+use crate::bitmap::{Bitmap, DecodedImage};
+use crate::event::{EventToken, EventType, WxEvtHandler};
+use crate::geometry::Size;
+use std::any::Any;
+use std::cell::RefCell;
+use std::collections::HashMap;
 #[cfg(target_os = "macos")]
 use std::ffi::c_int;
 use std::ffi::{CStr, CString, c_char, c_void};
-use std::sync::{Arc, LazyLock, Mutex};
+use std::sync::atomic::{AtomicBool, AtomicU64, AtomicUsize, Ordering};
+use std::sync::{Arc, LazyLock, Mutex, mpsc};
+use std::time::{Duration, Instant};
 use wxdragon_sys as ffi; // Import Window and WxWidget trait
 
-// Type alias to reduce complexity
-type CallbackQueue = Arc<Mutex<VecDeque<Box<dyn FnOnce() + Send + 'static>>>>;
+struct QueuedCallback {
+    callback: Box<dyn FnOnce() + Send + 'static>,
+    enqueued_at: Instant,
+}
+
+/// Priority class of a callback queued with [`call_after_with_priority`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, Default)]
+pub enum CallbackPriority {
+    /// Latency-critical work such as cursor feedback or progress ticks; always served first.
+    Interactive = 0,
+    /// Regular work; the priority used by [`call_after`].
+    #[default]
+    Normal = 1,
+    /// Bulk work that only runs when no higher-priority callback is pending and the event loop
+    /// has no native events (such as user input) waiting.
+    Background = 2,
+}
+
+const CALLBACK_LANE_COUNT: usize = 3;
+
+// One FIFO per priority class.
+// Producers only touch the lock-free `mpsc::Sender`; the receiver is only drained on the main
+// thread, so its mutex is never contended by workers.
+struct CallbackLane {
+    sender: mpsc::Sender<QueuedCallback>,
+    receiver: Mutex<mpsc::Receiver<QueuedCallback>>,
+    depth: AtomicUsize,
+}
+
+impl CallbackLane {
+    fn new() -> Self {
+        let (sender, receiver) = mpsc::channel();
+        CallbackLane {
+            sender,
+            receiver: Mutex::new(receiver),
+            depth: AtomicUsize::new(0),
+        }
+    }
+}
+
+// Queue for storing callbacks to be executed on the main thread, indexed by `CallbackPriority`.
+struct CallbackQueue {
+    lanes: [CallbackLane; CALLBACK_LANE_COUNT],
+}
+
+static MAIN_THREAD_QUEUE: LazyLock<CallbackQueue> = LazyLock::new(|| CallbackQueue {
+    lanes: std::array::from_fn(|_| CallbackLane::new()),
+});
+
+// Set while a wakeup is posted to the event loop and not yet drained, so a burst of
+// `call_after` calls costs a single native wakeup.
+static WAKEUP_PENDING: AtomicBool = AtomicBool::new(false);
+static CALLBACKS_RUN: AtomicU64 = AtomicU64::new(0);
+static LAST_LATENCY_NANOS: AtomicU64 = AtomicU64::new(0);
+static MAX_LATENCY_NANOS: AtomicU64 = AtomicU64::new(0);
+
+/// Counters describing the `call_after` queue, see [`callback_queue_stats`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub struct CallbackQueueStats {
+    /// Callbacks queued but not yet run.
+    pub depth: usize,
+    /// Callbacks run since startup.
+    pub executed: u64,
+    /// Time between enqueueing and running for the most recent callback.
+    pub last_latency: Duration,
+    /// Largest enqueue-to-run time observed since startup.
+    pub max_latency: Duration,
+}
 
-// Queue for storing callbacks to be executed on the main thread
-static MAIN_THREAD_QUEUE: LazyLock<CallbackQueue> = LazyLock::new(|| Arc::new(Mutex::new(VecDeque::new())));
+/// Sets how long one drain of the `call_after` queue may run before yielding to the event loop.
+///
+/// Callbacks are run until the budget has elapsed (at least one per drain); the remaining ones
+/// run on the next loop iteration. The default is 4 ms.
+pub fn set_callback_budget(budget: Duration) {
+    let micros = budget.as_micros().min(u32::MAX as u128) as u32;
+    unsafe { ffi::wxd_App_SetCallbackBudgetMicros(micros) };
+}
+
+/// When the application's idle handler, which drains deferred `call_after` work, is bound.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub enum IdleMode {
+    /// Bound for the lifetime of the app. Idle iterations with nothing queued return without
+    /// touching the queue.
+    #[default]
+    Always,
+    /// Bound only while callbacks are pending, so idle events are not requested for the queue
+    /// at all when it is empty.
+    OnDemand,
+}
+
+/// Selects when the idle handler is bound. Call before [`main`] or from the main thread.
+pub fn set_idle_mode(mode: IdleMode) {
+    let raw = match mode {
+        IdleMode::Always => ffi::wxd_IdleMode_WXD_IDLE_MODE_ALWAYS,
+        IdleMode::OnDemand => ffi::wxd_IdleMode_WXD_IDLE_MODE_ON_DEMAND,
+    };
+    unsafe { ffi::wxd_App_SetIdleMode(raw) };
+}
+
+/// Returns the current depth and enqueue-to-run latency of the `call_after` queue.
+pub fn callback_queue_stats() -> CallbackQueueStats {
+    CallbackQueueStats {
+        depth: unsafe { ffi::wxd_App_GetPendingCallbacks() } as usize,
+        executed: CALLBACKS_RUN.load(Ordering::Relaxed),
+        last_latency: Duration::from_nanos(LAST_LATENCY_NANOS.load(Ordering::Relaxed)),
+        max_latency: Duration::from_nanos(MAX_LATENCY_NANOS.load(Ordering::Relaxed)),
+    }
+}
+
+fn request_queue_wakeup() {
+    if !WAKEUP_PENDING.swap(true, Ordering::AcqRel) {
+        unsafe { ffi::wxd_App_PostCallbacksWakeup() };
+    }
+}
+
+/// Enables the main-thread stall watchdog.
+///
+/// When a single event handler (or one idle drain of the `call_after` queue) runs longer than
+/// `threshold`, a warning is logged through the `log` crate with the wx event type, the class
+/// of the handler's window and the [`EventToken`](crate::event::EventToken) value of the
+/// binding that is executing. The per-dispatch cost while enabled is one release store of a
+/// packed depth/heartbeat word on entry and exit, plus a few relaxed stores of the frame. Pass `Duration::ZERO` to
+/// disable. Call before [`main`] to watch from startup; it can also be toggled later.
+pub fn enable_stall_watchdog(threshold: Duration) {
+    let millis = threshold.as_millis().min(u32::MAX as u128) as u32;
+    unsafe { ffi::wxd_Watchdog_SetThreshold(millis) };
+}
+
+/// Sets the maximum log level and propagates it to the native logging macros.
+///
+/// Equivalent to `log::set_max_level`, but also updates the cached level used by the C++
+/// side so that disabled messages are not formatted there. Until this is first called the C++
+/// side formats everything and the `log` crate filters it, so call it once the logger is
+/// installed, and again for every later change.
+pub fn set_log_max_level(level: log::LevelFilter) {
+    log::set_max_level(level);
+    ffi::sync_log_max_level();
+}
+
+/// Delivers log records from the native side asynchronously.
+///
+/// By default the C++ code hands each record to the `log` crate on the thread that logged it,
+/// which may be the UI thread in the middle of a paint. With `capacity > 0`, records are
+/// formatted into a preallocated ring of that many slots (rounded up to a power of two) and a
+/// background thread passes them on, so a slow logger no longer stalls the UI. When the ring
+/// is full, records are dropped and counted in [`native_log_dropped`]. `0` restores
+/// synchronous delivery after passing on every queued record; [`main`] does this on exit.
+/// Returns false if the ring or its thread could not be created.
+pub fn set_native_log_async(capacity: usize) -> bool {
+    unsafe { ffi::wxd_log_set_async(capacity) }
+}
+
+/// Native log records dropped because the asynchronous ring was full.
+pub fn native_log_dropped() -> u64 {
+    unsafe { ffi::wxd_log_get_dropped() }
+}
+
+/// Arguments a later instance of the application handed to the running one.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct InstanceHandoff {
+    /// Working directory of the later instance, for resolving relative paths in `args`.
+    pub cwd: std::path::PathBuf,
+    /// Its command line without the program name.
+    pub args: Vec<String>,
+}
+
+/// Keeps the application to one running instance per user, registered under `name`.
+///
+/// Call before [`main`]. If an instance registered under `name` is already running, `main`
+/// sends it the working directory and arguments and returns `Ok(())` straight away, before
+/// initializing wxWidgets, so the handoff takes milliseconds; [`was_handed_off`] then returns
+/// true. Otherwise this process becomes the running instance and `on_args` runs on the main
+/// thread, once the event loop is up, for each later instance. Returns false if `name` is empty
+/// or `main` is already running.
+pub fn set_single_instance<F>(name: &str, on_args: F) -> bool
+where
+    F: FnMut(InstanceHandoff) + 'static,
+{
+    let Ok(c_name) = CString::new(name) else {
+        return false;
+    };
+    let callback: Box<RefCell<Box<dyn FnMut(InstanceHandoff)>>> = Box::new(RefCell::new(Box::new(on_args)));
+    let user_data = Box::into_raw(callback) as *mut c_void;
+    let ok = unsafe {
+        ffi::wxd_App_SetSingleInstance(
+            c_name.as_ptr(),
+            Some(instance_args_trampoline),
+            user_data,
+            Some(instance_args_free),
+        )
+    };
+    if !ok {
+        unsafe { instance_args_free(user_data) };
+    }
+    ok
+}
+
+/// True if the last [`main`] passed its arguments to a running instance instead of starting.
+pub fn was_handed_off() -> bool {
+    unsafe { ffi::wxd_App_WasHandedOff() }
+}
+
+unsafe extern "C" fn instance_args_trampoline(user_data: *mut c_void, cwd: *const c_char, args: *mut *const c_char, count: i32) {
+    if user_data.is_null() {
+        return;
+    }
+    let to_string = |ptr: *const c_char| {
+        if ptr.is_null() {
+            String::new()
+        } else {
+            unsafe { CStr::from_ptr(ptr) }.to_string_lossy().into_owned()
+        }
+    };
+    let args = if args.is_null() || count <= 0 {
+        Vec::new()
+    } else {
+        unsafe { std::slice::from_raw_parts(args, count as usize) }
+            .iter()
+            .map(|&arg| to_string(arg))
+            .collect()
+    };
+    let handoff = InstanceHandoff {
+        cwd: to_string(cwd).into(),
+        args,
+    };
+    let callback = unsafe { &*(user_data as *const RefCell<Box<dyn FnMut(InstanceHandoff)>>) };
+    if let Ok(mut callback) = callback.try_borrow_mut() {
+        callback(handoff);
+    }
+}
+
+unsafe extern "C" fn instance_args_free(user_data: *mut c_void) {
+    if !user_data.is_null() {
+        drop(unsafe { Box::from_raw(user_data as *mut RefCell<Box<dyn FnMut(InstanceHandoff)>>) });
+    }
+}
+
+/// How far [`trim_memory`] shrinks the native caches.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum TrimLevel {
+    /// Drop the less recently used half of each cache.
+    Moderate,
+    /// Empty every cache.
+    Critical,
+}
+
+impl TrimLevel {
+    fn to_raw(self) -> ffi::wxd_TrimLevel {
+        match self {
+            TrimLevel::Moderate => ffi::wxd_TrimLevel_WXD_TRIM_MODERATE,
+            TrimLevel::Critical => ffi::wxd_TrimLevel_WXD_TRIM_CRITICAL,
+        }
+    }
+
+    fn from_raw(raw: ffi::wxd_TrimLevel) -> Self {
+        if raw == ffi::wxd_TrimLevel_WXD_TRIM_CRITICAL {
+            TrimLevel::Critical
+        } else {
+            TrimLevel::Moderate
+        }
+    }
+}
+
+/// Memory held by one of the native caches, see [`cache_usage`].
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct CacheUsage {
+    /// Which cache, e.g. `"text_extent"` or `"svg_raster"`.
+    pub name: String,
+    /// Approximate bytes held.
+    pub bytes: usize,
+    pub entries: usize,
+}
+
+/// Shrinks the native caches (text extents, SVG rasters, pens and brushes, interned fonts and
+/// cursors, DataView cell renders) and returns roughly how many bytes were released. Main
+/// thread only.
+pub fn trim_memory(level: TrimLevel) -> usize {
+    unsafe { ffi::wxd_App_TrimMemory(level.to_raw()) }
+}
+
+/// Per-cache memory usage of the native caches. Main thread only.
+pub fn cache_usage() -> Vec<CacheUsage> {
+    let count = unsafe { ffi::wxd_App_GetCacheUsage(std::ptr::null_mut(), 0) };
+    let mut raw = vec![
+        ffi::wxd_CacheUsage {
+            name: std::ptr::null(),
+            bytes: 0,
+            entries: 0,
+        };
+        count
+    ];
+    let count = unsafe { ffi::wxd_App_GetCacheUsage(raw.as_mut_ptr(), raw.len()) }.min(raw.len());
+    raw[..count]
+        .iter()
+        .map(|usage| CacheUsage {
+            name: if usage.name.is_null() {
+                String::new()
+            } else {
+                unsafe { CStr::from_ptr(usage.name) }.to_string_lossy().into_owned()
+            },
+            bytes: usage.bytes,
+            entries: usage.entries,
+        })
+        .collect()
+}
+
+/// Trims the native caches whenever the OS reports memory pressure (a low-memory resource
+/// notification on Windows, the dispatch memory pressure source on macOS, a PSI trigger on
+/// Linux), then calls `on_pressure` on the main thread so the application can drop its own
+/// caches too. Replaces an earlier watch. Returns false if the platform offers no such signal,
+/// e.g. a Linux kernel without PSI. Main thread only.
+pub fn watch_memory_pressure<F>(on_pressure: F) -> bool
+where
+    F: FnMut(TrimLevel) + 'static,
+{
+    let callback: Box<RefCell<Box<dyn FnMut(TrimLevel)>>> = Box::new(RefCell::new(Box::new(on_pressure)));
+    let user_data = Box::into_raw(callback) as *mut c_void;
+    let ok = unsafe { ffi::wxd_App_WatchMemoryPressure(Some(memory_pressure_trampoline), user_data, Some(memory_pressure_free)) };
+    if !ok {
+        unsafe { memory_pressure_free(user_data) };
+    }
+    ok
+}
+
+/// Stops the watch started by [`watch_memory_pressure`]. Main thread only.
+pub fn unwatch_memory_pressure() {
+    unsafe { ffi::wxd_App_UnwatchMemoryPressure() }
+}
+
+unsafe extern "C" fn memory_pressure_trampoline(level: ffi::wxd_TrimLevel, user_data: *mut c_void) {
+    if user_data.is_null() {
+        return;
+    }
+    let callback = unsafe { &*(user_data as *const RefCell<Box<dyn FnMut(TrimLevel)>>) };
+    if let Ok(mut callback) = callback.try_borrow_mut() {
+        callback(TrimLevel::from_raw(level));
+    }
+}
+
+unsafe extern "C" fn memory_pressure_free(user_data: *mut c_void) {
+    if !user_data.is_null() {
+        drop(unsafe { Box::from_raw(user_data as *mut RefCell<Box<dyn FnMut(TrimLevel)>>) });
+    }
+}
 
 /// Schedules a callback to be executed on the main thread.
 ///
 /// This is useful when you need to update UI elements from a background thread.
-/// The callback will be executed during the next event loop iteration.
+/// The callback will be executed during the next event loop iteration: enqueueing is
+/// lock-free and the first callback of a burst wakes the event loop directly.
 ///
 /// # Example
 /// ```rust,no_run
@@ -38,8 +385,54 @@ pub fn call_after<F>(callback: Box<F>)
 where
     F: FnOnce() + Send + 'static,
 {
-    let mut queue = MAIN_THREAD_QUEUE.lock().unwrap();
-    queue.push_back(callback);
+    call_after_with_priority(CallbackPriority::Normal, callback);
+}
+
+/// Schedules a callback to be executed on the main thread with the given priority.
+///
+/// Pending interactive callbacks always run before normal ones, which run before background
+/// ones; within a priority class callbacks run in FIFO order. Background callbacks are held
+/// back while the event loop has native events (e.g. user input) waiting.
+pub fn call_after_with_priority<F>(priority: CallbackPriority, callback: Box<F>)
+where
+    F: FnOnce() + Send + 'static,
+{
+    let lane = &MAIN_THREAD_QUEUE.lanes[priority as usize];
+    // The total lives on the native side so the idle handler can test it without calling in here.
+    unsafe { ffi::wxd_App_AdjustPendingCallbacks(1) };
+    lane.depth.fetch_add(1, Ordering::AcqRel);
+    let queued = QueuedCallback {
+        callback,
+        enqueued_at: Instant::now(),
+    };
+    // The receiver lives in a static, so sending cannot fail.
+    let _ = lane.sender.send(queued);
+    request_queue_wakeup();
+}
+
+// Pops the next callback in priority order. Returns `None` when nothing is runnable right now,
+// which includes background work being deferred because native events are pending.
+fn pop_next_callback() -> Option<QueuedCallback> {
+    for (index, lane) in MAIN_THREAD_QUEUE.lanes.iter().enumerate() {
+        if lane.depth.load(Ordering::Acquire) == 0 {
+            continue;
+        }
+        if index == CallbackPriority::Background as usize && unsafe { ffi::wxd_App_HasPendingEvents() } {
+            return None;
+        }
+        // Only hold the receiver while popping so that a callback running a nested event loop
+        // (e.g. a modal dialog) can drain the queue again.
+        let next = match lane.receiver.try_lock() {
+            Ok(receiver) => receiver.try_recv().ok(),
+            Err(_) => None,
+        };
+        if let Some(queued) = next {
+            lane.depth.fetch_sub(1, Ordering::AcqRel);
+            unsafe { ffi::wxd_App_AdjustPendingCallbacks(-1) };
+            return Some(queued);
+        }
+    }
+    None
 }
 
 /// Processes pending callbacks queued via `call_after`.
@@ -47,34 +440,42 @@ where
 /// This function is called automatically by the event loop.
 /// You do not need to call this function manually.
 ///
-/// Returns true if any callbacks were processed, false if the queue was empty.
+/// Returns true if any callbacks were processed or some are still pending, false if the
+/// queue was empty.
 pub fn process_main_thread_queue() -> bool {
-    let mut callbacks = Vec::new();
-
-    // Move callbacks from the queue to our local vector to minimize lock time
-    {
-        let mut queue = MAIN_THREAD_QUEUE.lock().unwrap();
-        if queue.is_empty() {
-            return false;
-        }
-
-        // Move up to 10 callbacks at a time to prevent UI freezes
-        // if there are many callbacks pending
-        for _ in 0..10 {
-            if let Some(callback) = queue.pop_front() {
-                callbacks.push(callback);
-            } else {
-                break;
-            }
+    // Posts from now on need a fresh wakeup; clear before draining so none is lost.
+    WAKEUP_PENDING.store(false, Ordering::Release);
+
+    // Run callbacks until the per-drain time budget is used up, so throughput follows the cost
+    // of the callbacks rather than a fixed batch size. At least one callback always runs.
+    let budget = Duration::from_micros(u64::from(unsafe { ffi::wxd_App_GetCallbackBudgetMicros() }));
+    let started = Instant::now();
+    let mut processed = false;
+
+    while let Some(queued) = pop_next_callback() {
+        let latency = queued.enqueued_at.elapsed().as_nanos().min(u64::MAX as u128) as u64;
+        LAST_LATENCY_NANOS.store(latency, Ordering::Relaxed);
+        MAX_LATENCY_NANOS.fetch_max(latency, Ordering::Relaxed);
+        CALLBACKS_RUN.fetch_add(1, Ordering::Relaxed);
+        (queued.callback)();
+        processed = true;
+
+        if started.elapsed() >= budget {
+            break;
         }
     }
 
-    // Execute callbacks outside of the lock
-    for callback in callbacks {
-        callback();
+    // Interactive/normal left-overs get another wakeup instead of waiting for idle. Background
+    // work is picked up by the idle handler, which only runs once native events are handled.
+    let lanes = &MAIN_THREAD_QUEUE.lanes;
+    if lanes[CallbackPriority::Interactive as usize].depth.load(Ordering::Acquire) > 0
+        || lanes[CallbackPriority::Normal as usize].depth.load(Ordering::Acquire) > 0
+    {
+        request_queue_wakeup();
     }
 
-    true // We processed some callbacks
+    // Keep idle events coming while deferred background work remains.
+    processed || unsafe { ffi::wxd_App_GetPendingCallbacks() } > 0
 }
 
 // This function is called from C++ to process pending callbacks
@@ -319,6 +720,277 @@ pub fn wake_up_idle() {
     unsafe { ffi::wxd_WakeUpIdle() };
 }
 
+// --- Worker Pool ---
+
+/// Cancellation flag handed to a [`WorkerPool`] job.
+///
+/// It is set when the job's target window is destroyed, the pool is dropped or
+/// [`JobCancel::cancel`] is called. Long-running jobs should poll [`JobCancel::is_cancelled`] and
+/// return early; their result is discarded.
+#[derive(Debug, Clone, Default)]
+pub struct JobCancel(Arc<AtomicBool>);
+
+impl JobCancel {
+    /// Returns true once the job's result is no longer wanted.
+    pub fn is_cancelled(&self) -> bool {
+        self.0.load(Ordering::Relaxed)
+    }
+
+    /// Marks the job as no longer wanted; its result, if any, is dropped.
+    pub fn cancel(&self) {
+        self.0.store(true, Ordering::Relaxed);
+    }
+}
+
+type JobWork = Box<dyn FnOnce(&JobCancel) -> Box<dyn Any + Send> + Send>;
+
+// Worker-side half of a job. Owned by the C++ pool between submit and `done`.
+struct WorkerJob {
+    id: u64,
+    work: Option<JobWork>,
+    result: Option<Box<dyn Any + Send>>,
+    cancel: JobCancel,
+}
+
+// Main-thread half of a job; its closure may capture non-`Send` UI handles, so it never
+// leaves the main thread.
+struct JobCompletion {
+    pool_id: u64,
+    on_result: Box<dyn FnOnce(Box<dyn Any + Send>)>,
+    cancel: JobCancel,
+    handler: *mut ffi::wxd_EvtHandler_t,
+    destroy_token: EventToken,
+}
+
+thread_local! {
+    static JOB_COMPLETIONS: RefCell<HashMap<u64, JobCompletion>> = RefCell::new(HashMap::new());
+}
+
+static NEXT_JOB_ID: AtomicU64 = AtomicU64::new(1);
+
+unsafe extern "C" fn worker_job_run(job: *mut c_void) {
+    if job.is_null() {
+        return;
+    }
+    let job = unsafe { &mut *(job as *mut WorkerJob) };
+    let Some(work) = job.work.take() else {
+        return;
+    };
+    if job.cancel.is_cancelled() {
+        return;
+    }
+    // Never unwind into the C++ worker thread.
+    match std::panic::catch_unwind(std::panic::AssertUnwindSafe(|| work(&job.cancel))) {
+        Ok(result) => job.result = Some(result),
+        Err(_) => log::error!("Panic caught in WorkerPool job {}", job.id),
+    }
+}
+
+unsafe extern "C" fn worker_job_done(job: *mut c_void, target_alive: bool) {
+    if job.is_null() {
+        return;
+    }
+    let job = unsafe { Box::from_raw(job as *mut WorkerJob) };
+    let Some(completion) = JOB_COMPLETIONS.with(|jobs| jobs.borrow_mut().remove(&job.id)) else {
+        return;
+    };
+    // A destroyed target already dropped the DESTROY binding through UnbindAll; a live one,
+    // including during pool shutdown, still holds it.
+    if target_alive && !completion.handler.is_null() {
+        unsafe { ffi::wxd_EvtHandler_Unbind(completion.handler, completion.destroy_token.into()) };
+    }
+    if !target_alive || completion.cancel.is_cancelled() {
+        return;
+    }
+    if let Some(result) = job.result {
+        (completion.on_result)(result);
+    }
+}
+
+/// A pool of native worker threads whose results are delivered on the GUI thread.
+///
+/// Jobs run on `wxThread`s; when they finish, their `on_result` closure runs on the main thread,
+/// with results that complete close together delivered in a single event-loop wakeup. A job
+/// submitted with [`WorkerPool::submit_for`] is tied to a target window: if the window is
+/// destroyed first, the job is cancelled (see [`JobCancel`]) and its result dropped.
+///
+/// The pool must be created and used on the main thread. Dropping it cancels outstanding jobs
+/// and waits for running ones to return.
+///
+/// # Example
+/// ```rust,no_run
+/// use wxdragon::prelude::*;
+/// # fn load_rows() -> Vec<String> { Vec::new() }
+/// # let frame = Frame::builder().build();
+/// let pool = WorkerPool::new(0).expect("worker pool");
+/// pool.submit_for(&frame, |_cancel| load_rows(), move |rows| {
+///     println!("loaded {} rows", rows.len());
+/// });
+/// ```
+pub struct WorkerPool {
+    ptr: *mut ffi::wxd_WorkerPool_t,
+    id: u64,
+}
+
+impl WorkerPool {
+    /// Starts a pool with `threads` workers, or one per CPU when `threads` is 0.
+    pub fn new(threads: usize) -> Option<Self> {
+        let ptr = unsafe { ffi::wxd_WorkerPool_Create(threads.min(i32::MAX as usize) as i32) };
+        if ptr.is_null() {
+            None
+        } else {
+            Some(WorkerPool {
+                ptr,
+                id: NEXT_JOB_ID.fetch_add(1, Ordering::Relaxed),
+            })
+        }
+    }
+
+    /// Runs `job` on a worker thread and passes its result to `on_result` on the main thread.
+    pub fn submit<J, T, R>(&self, job: J, on_result: R) -> bool
+    where
+        J: FnOnce(&JobCancel) -> T + Send + 'static,
+        T: Send + 'static,
+        R: FnOnce(T) + 'static,
+    {
+        self.submit_internal(
+            std::ptr::null_mut(),
+            EventToken::INVALID_TOKEN,
+            JobCancel::default(),
+            job,
+            on_result,
+        )
+    }
+
+    /// Like [`WorkerPool::submit`], but the job is cancelled and its result dropped if `target`
+    /// is destroyed before the result is delivered.
+    pub fn submit_for<W, J, T, R>(&self, target: &W, job: J, on_result: R) -> bool
+    where
+        W: WxEvtHandler,
+        J: FnOnce(&JobCancel) -> T + Send + 'static,
+        T: Send + 'static,
+        R: FnOnce(T) + 'static,
+    {
+        let handler = unsafe { target.get_event_handler_ptr() };
+        if handler.is_null() {
+            return false;
+        }
+        let cancel = JobCancel::default();
+        let on_destroy = cancel.clone();
+        let destroy_token = target.bind_internal(EventType::DESTROY, move |_| on_destroy.cancel());
+        self.submit_internal(handler, destroy_token, cancel, job, on_result)
+    }
+
+    /// Decodes `bytes` (PNG, JPEG, GIF, ...) on a worker thread, downscaled to fit `max_size` if
+    /// given, and passes the bitmap to `on_done` on the main thread (`None` if undecodable).
+    ///
+    /// Cancelling the returned flag before the result arrives skips the decode if it has not
+    /// started and drops the result otherwise, so `on_done` is not called. Returns `None` if the
+    /// job could not be queued.
+    pub fn decode_image<R>(&self, bytes: Vec<u8>, max_size: Option<Size>, on_done: R) -> Option<JobCancel>
+    where
+        R: FnOnce(Option<Bitmap>) + 'static,
+    {
+        let cancel = JobCancel::default();
+        let queued = self.submit_internal(
+            std::ptr::null_mut(),
+            EventToken::INVALID_TOKEN,
+            cancel.clone(),
+            move |_: &JobCancel| DecodedImage::decode(&bytes, max_size),
+            move |image: Option<DecodedImage>| on_done(image.and_then(|image| image.to_bitmap())),
+        );
+        queued.then_some(cancel)
+    }
+
+    /// Like [`WorkerPool::decode_image`], but also cancelled when `target` is destroyed, e.g. a
+    /// gallery panel closed while its thumbnails are still loading.
+    pub fn decode_image_for<W, R>(&self, target: &W, bytes: Vec<u8>, max_size: Option<Size>, on_done: R) -> Option<JobCancel>
+    where
+        W: WxEvtHandler,
+        R: FnOnce(Option<Bitmap>) + 'static,
+    {
+        let handler = unsafe { target.get_event_handler_ptr() };
+        if handler.is_null() {
+            return None;
+        }
+        let cancel = JobCancel::default();
+        let on_destroy = cancel.clone();
+        let destroy_token = target.bind_internal(EventType::DESTROY, move |_| on_destroy.cancel());
+        let queued = self.submit_internal(
+            handler,
+            destroy_token,
+            cancel.clone(),
+            move |_: &JobCancel| DecodedImage::decode(&bytes, max_size),
+            move |image: Option<DecodedImage>| on_done(image.and_then(|image| image.to_bitmap())),
+        );
+        queued.then_some(cancel)
+    }
+
+    /// Number of submitted jobs whose result has not been delivered yet.
+    pub fn pending(&self) -> usize {
+        unsafe { ffi::wxd_WorkerPool_GetPendingCount(self.ptr) }.max(0) as usize
+    }
+
+    fn submit_internal<J, T, R>(
+        &self,
+        handler: *mut ffi::wxd_EvtHandler_t,
+        destroy_token: EventToken,
+        cancel: JobCancel,
+        job: J,
+        on_result: R,
+    ) -> bool
+    where
+        J: FnOnce(&JobCancel) -> T + Send + 'static,
+        T: Send + 'static,
+        R: FnOnce(T) + 'static,
+    {
+        let id = NEXT_JOB_ID.fetch_add(1, Ordering::Relaxed);
+        let work: JobWork = Box::new(move |cancel| Box::new(job(cancel)));
+        let on_result = Box::new(move |result: Box<dyn Any + Send>| {
+            if let Ok(value) = result.downcast::<T>() {
+                on_result(*value);
+            }
+        });
+        JOB_COMPLETIONS.with(|jobs| {
+            jobs.borrow_mut().insert(
+                id,
+                JobCompletion {
+                    pool_id: self.id,
+                    on_result,
+                    cancel: cancel.clone(),
+                    handler,
+                    destroy_token,
+                },
+            )
+        });
+
+        let raw = Box::into_raw(Box::new(WorkerJob {
+            id,
+            work: Some(work),
+            result: None,
+            cancel,
+        })) as *mut c_void;
+        let ok = unsafe { ffi::wxd_WorkerPool_Submit(self.ptr, handler, Some(worker_job_run), Some(worker_job_done), raw) };
+        if !ok {
+            // Not queued: reclaim both halves through the normal completion path.
+            unsafe { worker_job_done(raw, !handler.is_null()) };
+        }
+        ok
+    }
+}
+
+impl Drop for WorkerPool {
+    fn drop(&mut self) {
+        // Let running jobs notice, then join; the C++ side reports every outstanding job as done.
+        JOB_COMPLETIONS.with(|jobs| {
+            for completion in jobs.borrow().values().filter(|c| c.pool_id == self.id) {
+                completion.cancel.cancel();
+            }
+        });
+        unsafe { ffi::wxd_WorkerPool_Destroy(self.ptr) };
+    }
+}
+
 /// Gets the current wxWidgets app instance.
 pub fn get_app_instance() -> Option<App> {
     App::new()
@@ -650,6 +1322,9 @@ where
         // If it didn't, dropping here frees the closure too.
         let _ = Box::from_raw(user_data_ptr as *mut OnInitPayload);
 
+        // Pass on native log records still queued by set_native_log_async.
+        ffi::wxd_log_set_async(0);
+
         code
     };
 
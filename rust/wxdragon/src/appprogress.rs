@@ -54,6 +54,13 @@ impl AppProgressIndicator {
         unsafe { ffi::wxd_AppProgressIndicator_SetValue(self.ptr, value) }
     }
 
+    /// Like [`set_value`](Self::set_value), but only the newest value is kept and applied at most
+    /// once per display frame, and only when the shown percentage changes. Meant for workers that
+    /// report progress per item.
+    pub fn set_value_deferred(&self, value: i32) {
+        unsafe { ffi::wxd_AppProgressIndicator_SetValueDeferred(self.ptr, value) }
+    }
+
     // Set the progress range in taskbar button of parent window.
     pub fn set_range(&self, range: i32) {
         unsafe { ffi::wxd_AppProgressIndicator_SetRange(self.ptr, range) }
@@ -72,3 +79,10 @@ impl Drop for AppProgressIndicator {
         }
     }
 }
+
+/// Applies all pending deferred progress updates now: [`AppProgressIndicator::set_value_deferred`],
+/// [`Gauge::set_value_deferred`](crate::widgets::Gauge::set_value_deferred) and
+/// [`StatusBar::set_status_text_deferred`](crate::widgets::StatusBar::set_status_text_deferred).
+pub fn flush_deferred_progress() {
+    unsafe { ffi::wxd_Progress_FlushDeferred() }
+}
@@ -1,11 +1,52 @@
 //!
 //! Safe wrapper for wxBitmap.
 
+use crate::geometry::Size;
 use std::marker::PhantomData;
 use std::os::raw::{c_int, c_uchar};
 use std::rc::Rc;
 use wxdragon_sys as ffi;
 
+/// Byte order of a 32-bit pixel in memory, for [`Bitmap::from_native`].
+///
+/// The premultiplied variants store colour already multiplied by alpha, as tiny-skia and the
+/// native bitmaps on Windows and macOS do.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum PixelFormat {
+    Rgba,
+    Bgra,
+    Argb,
+    RgbaPremultiplied,
+    BgraPremultiplied,
+    ArgbPremultiplied,
+}
+
+impl PixelFormat {
+    /// The format of this platform's 32 bpp bitmaps, which [`Bitmap::from_native`] copies without
+    /// any conversion.
+    pub fn native() -> Self {
+        match unsafe { ffi::wxd_Bitmap_GetNativePixelFormat() } {
+            ffi::wxd_PixelFormat_WXD_PIXEL_FORMAT_BGRA => PixelFormat::Bgra,
+            ffi::wxd_PixelFormat_WXD_PIXEL_FORMAT_ARGB => PixelFormat::Argb,
+            ffi::wxd_PixelFormat_WXD_PIXEL_FORMAT_RGBA_PREMULTIPLIED => PixelFormat::RgbaPremultiplied,
+            ffi::wxd_PixelFormat_WXD_PIXEL_FORMAT_BGRA_PREMULTIPLIED => PixelFormat::BgraPremultiplied,
+            ffi::wxd_PixelFormat_WXD_PIXEL_FORMAT_ARGB_PREMULTIPLIED => PixelFormat::ArgbPremultiplied,
+            _ => PixelFormat::Rgba,
+        }
+    }
+
+    fn to_raw(self) -> ffi::wxd_PixelFormat {
+        match self {
+            PixelFormat::Rgba => ffi::wxd_PixelFormat_WXD_PIXEL_FORMAT_RGBA,
+            PixelFormat::Bgra => ffi::wxd_PixelFormat_WXD_PIXEL_FORMAT_BGRA,
+            PixelFormat::Argb => ffi::wxd_PixelFormat_WXD_PIXEL_FORMAT_ARGB,
+            PixelFormat::RgbaPremultiplied => ffi::wxd_PixelFormat_WXD_PIXEL_FORMAT_RGBA_PREMULTIPLIED,
+            PixelFormat::BgraPremultiplied => ffi::wxd_PixelFormat_WXD_PIXEL_FORMAT_BGRA_PREMULTIPLIED,
+            PixelFormat::ArgbPremultiplied => ffi::wxd_PixelFormat_WXD_PIXEL_FORMAT_ARGB_PREMULTIPLIED,
+        }
+    }
+}
+
 /// Represents a platform-dependent bitmap image.
 #[derive(Debug)] // Keep Debug if useful, or remove if pointer isn't meaningful for debug
 pub struct Bitmap {
@@ -83,6 +124,44 @@ impl Bitmap {
         }) // We own bitmaps created this way
     }
 
+    /// Creates a 32 bpp bitmap with alpha from pixels in `format`, `stride` bytes apart (0 for
+    /// tightly packed rows).
+    ///
+    /// When `format` is [`PixelFormat::native()`] the rows are copied straight into the native
+    /// bitmap, skipping the two full-frame conversions of [`Bitmap::from_rgba`]; other formats
+    /// are converted once. Returns `None` if `data` is too short or creation fails.
+    pub fn from_native(data: &[u8], width: u32, height: u32, stride: usize, format: PixelFormat) -> Option<Self> {
+        let row = width as usize * 4;
+        let stride = if stride == 0 { row } else { stride };
+        if width == 0 || height == 0 || stride < row || data.len() < stride * (height as usize - 1) + row {
+            log::error!(
+                "Bitmap::from_native: Invalid data length or dimensions. Got {}, w={}, h={}, stride={}",
+                data.len(),
+                width,
+                height,
+                stride
+            );
+            return None;
+        }
+        let ptr = unsafe {
+            ffi::wxd_Bitmap_CreateFromNative(
+                data.as_ptr() as *const c_uchar,
+                width as c_int,
+                height as c_int,
+                stride,
+                format.to_raw(),
+            )
+        };
+        if ptr.is_null() {
+            return None;
+        }
+        Some(Bitmap {
+            ptr,
+            owned: true,
+            _nosend_nosync: PhantomData,
+        })
+    }
+
     /// Returns `true` if this bitmap is owned by Rust and will be automatically destroyed when dropped.
     ///
     /// Returns `false` if the bitmap is managed elsewhere (e.g., by wxWidgets or another owner)
@@ -209,6 +288,46 @@ impl Bitmap {
         self.try_into()
             .expect("into_raw_const must only be used on non-owning (borrowed) wrappers")
     }
+
+    /// Locks the bitmap's native pixel storage for direct writing, without copying it.
+    ///
+    /// With `with_alpha` the bitmap must be 32 bits per pixel; otherwise its native RGB layout is
+    /// used. Returns `None` if the pixels cannot be accessed that way. The changes become visible
+    /// when the returned guard is dropped. Byte order, stride and premultiplication are platform
+    /// specific; see [`BitmapPixels`].
+    pub fn lock_pixels(&mut self, with_alpha: bool) -> Option<BitmapPixels<'_>> {
+        if self.ptr.is_null() || !self.is_ok() {
+            return None;
+        }
+        let mut layout = std::mem::MaybeUninit::<ffi::wxd_BitmapPixelLayout>::zeroed();
+        let ptr = unsafe { ffi::wxd_Bitmap_LockPixels(self.ptr, with_alpha, layout.as_mut_ptr()) };
+        if ptr.is_null() {
+            return None;
+        }
+        Some(BitmapPixels {
+            ptr,
+            layout: unsafe { layout.assume_init() },
+            _bitmap: PhantomData,
+        })
+    }
+
+    /// Overwrites the bitmap's pixels in place with straight RGBA rows of the same size.
+    ///
+    /// `stride` is the distance between rows of `data` in bytes, or 0 for tightly packed rows.
+    /// Unlike [`Bitmap::from_rgba`] this reuses the existing native bitmap, which suits frames of
+    /// a video or animation. Returns false if `data` is too short or the pixels are not accessible.
+    pub fn update_from_rgba(&mut self, data: &[u8], stride: usize) -> bool {
+        if self.ptr.is_null() || !self.is_ok() {
+            return false;
+        }
+        let (width, height) = (self.get_width().max(0) as usize, self.get_height().max(0) as usize);
+        let row = width * 4;
+        let stride = if stride == 0 { row } else { stride };
+        if stride < row || (height > 0 && data.len() < stride * (height - 1) + row) {
+            return false;
+        }
+        unsafe { ffi::wxd_Bitmap_UpdateFromRGBA(self.ptr, data.as_ptr() as *const c_uchar, stride) }
+    }
 }
 
 impl Clone for Bitmap {
@@ -293,6 +412,191 @@ impl Drop for Bitmap {
     }
 }
 
+/// Direct access to the pixels of a locked [`Bitmap`], returned by [`Bitmap::lock_pixels`].
+///
+/// Each pixel occupies [`bytes_per_pixel`](Self::bytes_per_pixel) bytes with the channels at the
+/// offsets reported by [`red_offset`](Self::red_offset) and friends. If
+/// [`is_premultiplied`](Self::is_premultiplied), colour bytes must be stored multiplied by alpha.
+/// The pixels are released back to the bitmap on drop.
+pub struct BitmapPixels<'a> {
+    ptr: *mut ffi::wxd_BitmapPixels_t,
+    layout: ffi::wxd_BitmapPixelLayout,
+    _bitmap: PhantomData<&'a mut Bitmap>,
+}
+
+impl BitmapPixels<'_> {
+    pub fn width(&self) -> usize {
+        self.layout.width.max(0) as usize
+    }
+
+    pub fn height(&self) -> usize {
+        self.layout.height.max(0) as usize
+    }
+
+    pub fn bytes_per_pixel(&self) -> usize {
+        self.layout.bytes_per_pixel.max(0) as usize
+    }
+
+    /// Distance between the starts of consecutive rows in bytes; negative for bottom-up storage.
+    pub fn stride(&self) -> isize {
+        self.layout.stride as isize
+    }
+
+    pub fn red_offset(&self) -> usize {
+        self.layout.red as usize
+    }
+
+    pub fn green_offset(&self) -> usize {
+        self.layout.green as usize
+    }
+
+    pub fn blue_offset(&self) -> usize {
+        self.layout.blue as usize
+    }
+
+    /// Offset of the alpha byte, or `None` if the pixels were locked without alpha.
+    pub fn alpha_offset(&self) -> Option<usize> {
+        (self.layout.alpha >= 0).then_some(self.layout.alpha as usize)
+    }
+
+    pub fn is_premultiplied(&self) -> bool {
+        self.layout.premultiplied
+    }
+
+    /// The `width() * bytes_per_pixel()` bytes of row `y`, or `None` if `y` is out of range.
+    pub fn row_mut(&mut self, y: usize) -> Option<&mut [u8]> {
+        if y >= self.height() {
+            return None;
+        }
+        let len = self.width() * self.bytes_per_pixel();
+        unsafe {
+            let start = self.layout.pixels.offset(y as isize * self.stride());
+            Some(std::slice::from_raw_parts_mut(start, len))
+        }
+    }
+}
+
+impl Drop for BitmapPixels<'_> {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_Bitmap_UnlockPixels(self.ptr) };
+    }
+}
+
+/// Resampling filter for [`resize_rgba`] and [`DecodedImage::decode_with_quality`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, Default)]
+pub enum ResizeQuality {
+    Nearest,
+    /// Area average: the cheapest filter that does not alias when shrinking.
+    Box,
+    Bilinear,
+    /// Catmull-Rom, the sharpest.
+    #[default]
+    Bicubic,
+}
+
+impl ResizeQuality {
+    fn to_raw(self) -> ffi::wxd_ResizeQuality {
+        match self {
+            ResizeQuality::Nearest => ffi::wxd_ResizeQuality_WXD_RESIZE_NEAREST,
+            ResizeQuality::Box => ffi::wxd_ResizeQuality_WXD_RESIZE_BOX,
+            ResizeQuality::Bilinear => ffi::wxd_ResizeQuality_WXD_RESIZE_BILINEAR,
+            ResizeQuality::Bicubic => ffi::wxd_ResizeQuality_WXD_RESIZE_BICUBIC,
+        }
+    }
+}
+
+/// Resizes straight RGBA pixels (`src_width * src_height * 4` bytes) to `dst_width` x
+/// `dst_height`. Colour is filtered premultiplied, so transparent areas do not bleed dark
+/// fringes. Touches no GUI state, so it can run on a worker thread. Returns `None` if a size is
+/// zero or `src` is too short.
+pub fn resize_rgba(
+    src: &[u8],
+    src_width: u32,
+    src_height: u32,
+    dst_width: u32,
+    dst_height: u32,
+    quality: ResizeQuality,
+) -> Option<Vec<u8>> {
+    let src_len = (src_width as usize).checked_mul(src_height as usize)?.checked_mul(4)?;
+    let dst_len = (dst_width as usize).checked_mul(dst_height as usize)?.checked_mul(4)?;
+    if src.len() < src_len
+        || [src_width, src_height, dst_width, dst_height]
+            .iter()
+            .any(|&v| v > i32::MAX as u32)
+    {
+        return None;
+    }
+    let mut dst = vec![0u8; dst_len];
+    let ok = unsafe {
+        ffi::wxd_Image_ResizeRGBA(
+            src.as_ptr(),
+            src_width as c_int,
+            src_height as c_int,
+            dst.as_mut_ptr(),
+            dst_width as c_int,
+            dst_height as c_int,
+            quality.to_raw(),
+        )
+    };
+    ok.then_some(dst)
+}
+
+/// An image decoded from PNG, JPEG, GIF, ... bytes but not yet turned into a [`Bitmap`].
+///
+/// Decoding holds no GUI resources, so it can run on a worker thread (see
+/// [`WorkerPool::decode_image`](crate::WorkerPool::decode_image)); only [`DecodedImage::to_bitmap`]
+/// must run on the main thread.
+#[derive(Debug)]
+pub struct DecodedImage {
+    ptr: *mut ffi::wxd_DecodedImage_t,
+}
+
+// The wrapped wxImage is unshared and touches no GUI state until `to_bitmap`.
+unsafe impl Send for DecodedImage {}
+
+impl DecodedImage {
+    /// Decodes `bytes` with wxWidgets' image handlers, downscaling to fit inside `max_size` (keeping
+    /// the aspect ratio) if given. Returns `None` if the data is not a supported image.
+    pub fn decode(bytes: &[u8], max_size: Option<Size>) -> Option<Self> {
+        let max_size = max_size.unwrap_or(Size::new(0, 0)).into();
+        let ptr = unsafe { ffi::wxd_DecodedImage_Decode(bytes.as_ptr() as *const c_uchar, bytes.len(), max_size) };
+        if ptr.is_null() { None } else { Some(DecodedImage { ptr }) }
+    }
+
+    /// Like [`decode`](Self::decode), downscaling with the given filter; `decode` uses
+    /// [`ResizeQuality::Bicubic`]. [`ResizeQuality::Box`] is the fastest choice for thumbnails.
+    pub fn decode_with_quality(bytes: &[u8], max_size: Option<Size>, quality: ResizeQuality) -> Option<Self> {
+        let max_size = max_size.unwrap_or(Size::new(0, 0)).into();
+        let ptr = unsafe {
+            ffi::wxd_DecodedImage_DecodeScaled(bytes.as_ptr() as *const c_uchar, bytes.len(), max_size, quality.to_raw())
+        };
+        if ptr.is_null() { None } else { Some(DecodedImage { ptr }) }
+    }
+
+    pub fn get_size(&self) -> Size {
+        unsafe { ffi::wxd_DecodedImage_GetSize(self.ptr) }.into()
+    }
+
+    /// Converts the image to a bitmap. Main thread only.
+    pub fn to_bitmap(&self) -> Option<Bitmap> {
+        let ptr = unsafe { ffi::wxd_DecodedImage_ToBitmap(self.ptr) };
+        if ptr.is_null() {
+            return None;
+        }
+        Some(Bitmap {
+            ptr,
+            owned: true,
+            _nosend_nosync: PhantomData,
+        })
+    }
+}
+
+impl Drop for DecodedImage {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_DecodedImage_Destroy(self.ptr) };
+    }
+}
+
 #[cfg(test)]
 mod tests {
     use super::Bitmap;
@@ -9,6 +9,36 @@ use crate::bitmap::Bitmap;
 use crate::geometry::Size;
 use crate::window::WxWidget;
 
+/// An RGBA sheet of equally sized icons laid out row by row, for building many images with one
+/// pixel conversion instead of one [`Bitmap`] per icon.
+#[derive(Debug, Clone, Copy)]
+pub struct AtlasSheet<'a> {
+    /// Pixels, 4 bytes per pixel, `size.width * size.height` pixels.
+    pub rgba: &'a [u8],
+    pub size: Size,
+    pub tile_size: Size,
+}
+
+impl<'a> AtlasSheet<'a> {
+    pub fn new(rgba: &'a [u8], size: Size, tile_size: Size) -> Self {
+        Self { rgba, size, tile_size }
+    }
+
+    /// Number of whole tiles in the sheet.
+    pub fn tile_count(&self) -> usize {
+        let (s, t) = (self.size, self.tile_size);
+        if s.width <= 0 || s.height <= 0 || t.width <= 0 || t.height <= 0 {
+            return 0;
+        }
+        ((s.width / t.width) * (s.height / t.height)) as usize
+    }
+
+    pub(crate) fn holds(&self, count: usize) -> bool {
+        let pixels = self.size.width.max(0) as usize * self.size.height.max(0) as usize;
+        count > 0 && count <= self.tile_count() && self.rgba.len() >= pixels * 4
+    }
+}
+
 /// Represents a collection of bitmaps of the same image in different sizes/resolutions.
 ///
 /// This class allows the application to provide images in different resolutions so
@@ -83,6 +113,33 @@ impl BitmapBundle {
         BitmapBundle { ptr, is_owned: true }
     }
 
+    /// Creates one bundle per icon from atlases of the same icons at different resolutions. Icon
+    /// `i` is tile `i` of every sheet, so all sheets must use the same grid (e.g. 16px, 24px and
+    /// 32px tiles). Each sheet is converted once, which is much cheaper than building thousands
+    /// of bitmaps individually. Returns an empty vector if any sheet holds fewer than `count`
+    /// tiles or is too short.
+    pub fn from_atlases(sheets: &[AtlasSheet], count: usize) -> Vec<Self> {
+        if sheets.is_empty() || !sheets.iter().all(|s| s.holds(count)) {
+            return Vec::new();
+        }
+        let pixels: Vec<*const u8> = sheets.iter().map(|s| s.rgba.as_ptr()).collect();
+        let sizes: Vec<ffi::wxd_Size> = sheets.iter().map(|s| s.size.into()).collect();
+        let tiles: Vec<ffi::wxd_Size> = sheets.iter().map(|s| s.tile_size.into()).collect();
+        let mut out = vec![std::ptr::null_mut(); count];
+        let created = unsafe {
+            ffi::wxd_BitmapBundle_FromAtlases(
+                pixels.as_ptr(),
+                sizes.as_ptr(),
+                tiles.as_ptr(),
+                sheets.len(),
+                count,
+                out.as_mut_ptr(),
+            )
+        };
+        out.truncate(created);
+        out.into_iter().map(|ptr| BitmapBundle { ptr, is_owned: true }).collect()
+    }
+
     /// Creates a bitmap bundle from an SVG file.
     ///
     /// # Arguments
@@ -245,6 +302,34 @@ impl BitmapBundle {
     pub fn as_ptr(&self) -> *mut ffi::wxd_BitmapBundle_t {
         self.ptr
     }
+
+    /// Sets how many rasterized SVG bitmaps the process-wide cache keeps (default 256, 0
+    /// disables it) and empties it.
+    ///
+    /// Bundles created from SVG share this cache, keyed by SVG content and pixel size, so an
+    /// icon used by many toolbars is rasterized once per size and DPI change.
+    pub fn set_svg_cache_capacity(entries: usize) {
+        unsafe { ffi::wxd_BitmapBundle_SetSVGCacheCapacity(entries) };
+    }
+
+    /// Drops every cached SVG rasterization.
+    pub fn clear_svg_cache() {
+        unsafe { ffi::wxd_BitmapBundle_ClearSVGCache() };
+    }
+
+    /// Additionally stores SVG rasterizations as PNG files in `dir` (created if missing), so later
+    /// runs start without rasterizing; `None` turns the disk cache off.
+    ///
+    /// Returns false if the directory cannot be used.
+    pub fn set_svg_disk_cache_dir<P: AsRef<Path>>(dir: Option<P>) -> bool {
+        let Some(dir) = dir else {
+            return unsafe { ffi::wxd_BitmapBundle_SetSVGDiskCacheDir(std::ptr::null()) };
+        };
+        match dir.as_ref().to_str().map(CString::new) {
+            Some(Ok(c_dir)) => unsafe { ffi::wxd_BitmapBundle_SetSVGDiskCacheDir(c_dir.as_ptr()) },
+            _ => false,
+        }
+    }
 }
 
 impl Clone for BitmapBundle {
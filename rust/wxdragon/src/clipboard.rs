@@ -1,8 +1,105 @@
 use crate::data_object::DataObject;
 use std::ffi::{CStr, CString};
-use std::os::raw::c_char;
+use std::os::raw::{c_char, c_void};
 use wxdragon_sys as ffi;
 
+/// A format for [`Clipboard::request_async`].
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub enum ClipboardFormat {
+    /// Plain text.
+    Text,
+    /// HTML.
+    Html,
+    /// An image, delivered PNG-encoded.
+    Png,
+    /// A list of files.
+    Files,
+    /// A private format identified by name.
+    Custom(String),
+}
+
+impl ClipboardFormat {
+    fn to_raw(&self) -> ffi::wxd_ClipboardFormat {
+        match self {
+            ClipboardFormat::Text => ffi::wxd_ClipboardFormat_WXD_CLIPBOARD_FORMAT_TEXT,
+            ClipboardFormat::Html => ffi::wxd_ClipboardFormat_WXD_CLIPBOARD_FORMAT_HTML,
+            ClipboardFormat::Png => ffi::wxd_ClipboardFormat_WXD_CLIPBOARD_FORMAT_PNG,
+            ClipboardFormat::Files => ffi::wxd_ClipboardFormat_WXD_CLIPBOARD_FORMAT_FILES,
+            ClipboardFormat::Custom(_) => ffi::wxd_ClipboardFormat_WXD_CLIPBOARD_FORMAT_CUSTOM,
+        }
+    }
+}
+
+/// Data read by [`Clipboard::request_async`].
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub enum ClipboardData {
+    /// Plain text.
+    Text(String),
+    /// HTML.
+    Html(String),
+    /// A PNG-encoded image.
+    Png(Vec<u8>),
+    /// Local file paths.
+    Files(Vec<String>),
+    /// Raw bytes of a private format, with its name.
+    Custom(String, Vec<u8>),
+}
+
+type ReadCallback = Box<dyn FnOnce(Option<ClipboardData>)>;
+
+struct ReadRequest {
+    formats: Vec<ClipboardFormat>,
+    callback: Option<ReadCallback>,
+}
+
+#[allow(unsafe_op_in_unsafe_fn)]
+unsafe extern "C" fn read_request_trampoline(user_data: *mut c_void, format_index: i32, data: *mut ffi::wxd_String_t) {
+    let bytes = if data.is_null() {
+        Vec::new()
+    } else {
+        let ptr = ffi::wxd_String_GetData(data) as *const u8;
+        let len = ffi::wxd_String_GetLength(data);
+        let bytes = if ptr.is_null() || len == 0 {
+            Vec::new()
+        } else {
+            std::slice::from_raw_parts(ptr, len).to_vec()
+        };
+        ffi::wxd_String_Free(data);
+        bytes
+    };
+    if user_data.is_null() {
+        return;
+    }
+    let request = &mut *(user_data as *mut ReadRequest);
+    let Some(callback) = request.callback.take() else {
+        return;
+    };
+    let result = usize::try_from(format_index)
+        .ok()
+        .and_then(|i| request.formats.get(i))
+        .map(|format| match format {
+            ClipboardFormat::Text => ClipboardData::Text(String::from_utf8_lossy(&bytes).into_owned()),
+            ClipboardFormat::Html => ClipboardData::Html(String::from_utf8_lossy(&bytes).into_owned()),
+            ClipboardFormat::Png => ClipboardData::Png(bytes),
+            ClipboardFormat::Files => ClipboardData::Files(
+                String::from_utf8_lossy(&bytes)
+                    .split('\n')
+                    .filter(|path| !path.is_empty())
+                    .map(str::to_owned)
+                    .collect(),
+            ),
+            ClipboardFormat::Custom(id) => ClipboardData::Custom(id.clone(), bytes),
+        });
+    callback(result);
+}
+
+#[allow(unsafe_op_in_unsafe_fn)]
+unsafe extern "C" fn free_read_request(user_data: *mut c_void) {
+    if !user_data.is_null() {
+        let _ = Box::from_raw(user_data as *mut ReadRequest);
+    }
+}
+
 /// A struct representing the system clipboard.
 ///
 /// The clipboard can be used to copy data to or paste data from.
@@ -184,6 +281,55 @@ impl Clipboard {
         Some(unsafe { CStr::from_ptr(buf.as_ptr()).to_string_lossy().to_string() })
     }
 
+    /// Read the clipboard in the background, returning the first available format.
+    ///
+    /// `formats` are tried in order and `callback` receives the first one the
+    /// clipboard can provide, or `None`. On GTK (X11 and Wayland) the data is
+    /// requested asynchronously from the clipboard owner, so a slow owner no
+    /// longer stalls the UI; on other platforms it is read on the next event
+    /// loop pass. The callback runs once on the GUI thread, never before this
+    /// returns. The data arrives in a single owned buffer, without a
+    /// size-then-copy round trip.
+    ///
+    /// Returns false (without calling `callback`) if the request is invalid.
+    pub fn request_async<F>(&self, formats: &[ClipboardFormat], callback: F) -> bool
+    where
+        F: FnOnce(Option<ClipboardData>) + 'static,
+    {
+        if self.ptr.is_null() || formats.is_empty() {
+            return false;
+        }
+        let kinds: Vec<ffi::wxd_ClipboardFormat> = formats.iter().map(ClipboardFormat::to_raw).collect();
+        let ids: Vec<Option<CString>> = formats
+            .iter()
+            .map(|format| match format {
+                ClipboardFormat::Custom(id) => Some(CString::new(id.as_str()).unwrap_or_default()),
+                _ => None,
+            })
+            .collect();
+        let id_ptrs: Vec<*const c_char> = ids
+            .iter()
+            .map(|id| id.as_ref().map_or(std::ptr::null(), |id| id.as_ptr()))
+            .collect();
+
+        let state = Box::new(ReadRequest {
+            formats: formats.to_vec(),
+            callback: Some(Box::new(callback)),
+        });
+        let user_data = Box::into_raw(state) as *mut c_void;
+        unsafe {
+            ffi::wxd_Clipboard_RequestAsync(
+                self.ptr,
+                kinds.as_ptr(),
+                id_ptrs.as_ptr(),
+                kinds.len(),
+                Some(read_request_trampoline),
+                user_data,
+                Some(free_read_request),
+            )
+        }
+    }
+
     /// Create a ClipboardLocker to safely manage clipboard access
     pub fn locker(&self) -> Option<ClipboardLocker<'_>> {
         ClipboardLocker::new(self)
@@ -31,6 +31,8 @@
 //! config.flush(false);
 //! ```
 
+use crate::utils::take_wxd_string;
+use std::collections::HashMap;
 use std::ffi::{CStr, CString};
 use std::os::raw::{c_char, c_long};
 use wxdragon_sys as ffi;
@@ -61,6 +63,9 @@ impl ConfigStyle {
     /// Use subdirectory for config file.
     pub const USE_SUBDIR: ConfigStyle = ConfigStyle(ffi::wxd_ConfigStyle_WXD_CONFIG_USE_SUBDIR as c_long);
 
+    /// Defer flushes to a 1 second debounce timer; see [`Config::set_write_behind`].
+    pub const WRITE_BEHIND: ConfigStyle = ConfigStyle(ffi::wxd_ConfigStyle_WXD_CONFIG_WRITE_BEHIND as c_long);
+
     /// Get the raw value.
     pub fn to_raw(self) -> c_long {
         self.0
@@ -114,6 +119,193 @@ impl From<i32> for ConfigEntryType {
     }
 }
 
+/// A typed configuration value, as stored in a [`ConfigSnapshot`] or passed to
+/// [`Config::write_batch`].
+#[derive(Debug, Clone, PartialEq)]
+pub enum ConfigValue {
+    String(String),
+    Bool(bool),
+    Integer(i64),
+    Float(f64),
+}
+
+impl ConfigValue {
+    /// Returns the value as text, formatting non-string values.
+    pub fn as_string(&self) -> String {
+        match self {
+            ConfigValue::String(value) => value.clone(),
+            ConfigValue::Bool(value) => (*value as i32).to_string(),
+            ConfigValue::Integer(value) => value.to_string(),
+            ConfigValue::Float(value) => value.to_string(),
+        }
+    }
+
+    /// Returns the value as an integer, parsing strings the way [`Config::read_long`] does.
+    pub fn as_long(&self) -> Option<i64> {
+        match self {
+            ConfigValue::String(value) => value.trim().parse().ok(),
+            ConfigValue::Bool(value) => Some(*value as i64),
+            ConfigValue::Integer(value) => Some(*value),
+            ConfigValue::Float(_) => None,
+        }
+    }
+
+    /// Returns the value as a double, parsing strings the way [`Config::read_double`] does.
+    pub fn as_double(&self) -> Option<f64> {
+        match self {
+            ConfigValue::String(value) => value.trim().parse().ok(),
+            ConfigValue::Bool(_) => None,
+            ConfigValue::Integer(value) => Some(*value as f64),
+            ConfigValue::Float(value) => Some(*value),
+        }
+    }
+
+    /// Returns the value as a boolean; like wxConfig, a bool is stored as an integer.
+    pub fn as_bool(&self) -> Option<bool> {
+        match self {
+            ConfigValue::Bool(value) => Some(*value),
+            _ => self.as_long().map(|value| value != 0),
+        }
+    }
+}
+
+/// All entries of a config group, read in one call by [`Config::read_group_snapshot`].
+///
+/// Keys are relative to the group that was read; entries of subgroups appear
+/// as `"sub/key"`. Lookups are served from memory without touching the backend.
+///
+/// # Example
+///
+/// ```rust,no_run
+/// use wxdragon::config::{Config, ConfigStyle};
+///
+/// let config = Config::new("MyApp", None, None, None, ConfigStyle::empty());
+/// if let Some(ui) = config.read_group_snapshot("/UI", true) {
+///     let width = ui.read_long("Window/Width", 800);
+///     let theme = ui.read_string("Theme", "system");
+/// }
+/// ```
+#[derive(Debug, Clone, Default)]
+pub struct ConfigSnapshot {
+    entries: Vec<(String, ConfigValue)>,
+    index: HashMap<String, usize>,
+}
+
+impl ConfigSnapshot {
+    /// Returns the number of entries.
+    pub fn len(&self) -> usize {
+        self.entries.len()
+    }
+
+    /// Returns true if the group had no entries.
+    pub fn is_empty(&self) -> bool {
+        self.entries.is_empty()
+    }
+
+    /// Returns the value stored under `key`.
+    pub fn get(&self, key: &str) -> Option<&ConfigValue> {
+        self.index.get(key).map(|&i| &self.entries[i].1)
+    }
+
+    /// Iterates over the entries in enumeration order.
+    pub fn iter(&self) -> impl Iterator<Item = (&str, &ConfigValue)> {
+        self.entries.iter().map(|(key, value)| (key.as_str(), value))
+    }
+
+    /// Reads a string value.
+    pub fn read_string(&self, key: &str, default: &str) -> String {
+        self.get(key).map_or_else(|| default.to_string(), ConfigValue::as_string)
+    }
+
+    /// Reads a long integer value.
+    pub fn read_long(&self, key: &str, default: i64) -> i64 {
+        self.get(key).and_then(ConfigValue::as_long).unwrap_or(default)
+    }
+
+    /// Reads a double value.
+    pub fn read_double(&self, key: &str, default: f64) -> f64 {
+        self.get(key).and_then(ConfigValue::as_double).unwrap_or(default)
+    }
+
+    /// Reads a boolean value.
+    pub fn read_bool(&self, key: &str, default: bool) -> bool {
+        self.get(key).and_then(ConfigValue::as_bool).unwrap_or(default)
+    }
+
+    // Parses the layout documented in wxd_config.h.
+    fn decode(bytes: &[u8]) -> Option<Self> {
+        fn take<'a>(bytes: &mut &'a [u8], n: usize) -> Option<&'a [u8]> {
+            if bytes.len() < n {
+                return None;
+            }
+            let (head, tail) = bytes.split_at(n);
+            *bytes = tail;
+            Some(head)
+        }
+        fn take_u64(bytes: &mut &[u8]) -> Option<u64> {
+            Some(u64::from_le_bytes(take(bytes, 8)?.try_into().ok()?))
+        }
+        fn take_text(bytes: &mut &[u8]) -> Option<String> {
+            let len = u32::from_le_bytes(take(bytes, 4)?.try_into().ok()?) as usize;
+            Some(String::from_utf8_lossy(take(bytes, len)?).into_owned())
+        }
+
+        let mut rest = bytes;
+        let count = u32::from_le_bytes(take(&mut rest, 4)?.try_into().ok()?) as usize;
+        let mut snapshot = ConfigSnapshot::default();
+        for _ in 0..count {
+            let key = take_text(&mut rest)?;
+            let value = match take(&mut rest, 1)?[0] as i64 {
+                t if t == ffi::wxd_ConfigEntryType_WXD_CONFIG_TYPE_BOOLEAN as i64 => {
+                    ConfigValue::Bool(take(&mut rest, 1)?[0] != 0)
+                }
+                t if t == ffi::wxd_ConfigEntryType_WXD_CONFIG_TYPE_INTEGER as i64 => {
+                    ConfigValue::Integer(take_u64(&mut rest)? as i64)
+                }
+                t if t == ffi::wxd_ConfigEntryType_WXD_CONFIG_TYPE_FLOAT as i64 => {
+                    ConfigValue::Float(f64::from_bits(take_u64(&mut rest)?))
+                }
+                _ => ConfigValue::String(take_text(&mut rest)?),
+            };
+            snapshot.index.insert(key.clone(), snapshot.entries.len());
+            snapshot.entries.push((key, value));
+        }
+        Some(snapshot)
+    }
+}
+
+fn encode_batch<K: AsRef<str>>(entries: &[(K, ConfigValue)]) -> Vec<u8> {
+    fn put_text(out: &mut Vec<u8>, text: &str) {
+        out.extend_from_slice(&(text.len() as u32).to_le_bytes());
+        out.extend_from_slice(text.as_bytes());
+    }
+
+    let mut out = Vec::new();
+    out.extend_from_slice(&(entries.len() as u32).to_le_bytes());
+    for (key, value) in entries {
+        put_text(&mut out, key.as_ref());
+        match value {
+            ConfigValue::String(text) => {
+                out.push(ffi::wxd_ConfigEntryType_WXD_CONFIG_TYPE_STRING as u8);
+                put_text(&mut out, text);
+            }
+            ConfigValue::Bool(flag) => {
+                out.push(ffi::wxd_ConfigEntryType_WXD_CONFIG_TYPE_BOOLEAN as u8);
+                out.push(*flag as u8);
+            }
+            ConfigValue::Integer(number) => {
+                out.push(ffi::wxd_ConfigEntryType_WXD_CONFIG_TYPE_INTEGER as u8);
+                out.extend_from_slice(&number.to_le_bytes());
+            }
+            ConfigValue::Float(number) => {
+                out.push(ffi::wxd_ConfigEntryType_WXD_CONFIG_TYPE_FLOAT as u8);
+                out.extend_from_slice(&number.to_bits().to_le_bytes());
+            }
+        }
+    }
+    out
+}
+
 /// Configuration object for storing application settings.
 ///
 /// This provides a platform-appropriate way to store configuration data:
@@ -241,14 +433,8 @@ impl Config {
         };
         let c_default = CString::new(default).unwrap_or_default();
 
-        // First get the length
-        let len = unsafe { ffi::wxd_Config_ReadString(self.ptr, c_key.as_ptr(), std::ptr::null_mut(), 0, c_default.as_ptr()) };
-        if len < 0 {
-            return default.to_string();
-        }
-        let mut buf: Vec<c_char> = vec![0; len as usize + 1];
-        unsafe { ffi::wxd_Config_ReadString(self.ptr, c_key.as_ptr(), buf.as_mut_ptr(), buf.len(), c_default.as_ptr()) };
-        unsafe { CStr::from_ptr(buf.as_ptr()).to_string_lossy().to_string() }
+        let value = unsafe { ffi::wxd_Config_ReadStringOwned(self.ptr, c_key.as_ptr(), c_default.as_ptr()) };
+        unsafe { take_wxd_string(value) }.unwrap_or_else(|| default.to_string())
     }
 
     /// Reads a long integer value.
@@ -497,6 +683,58 @@ impl Config {
         unsafe { ffi::wxd_Config_GetNumberOfGroups(self.ptr, recursive) }
     }
 
+    // --- Bulk Operations ---
+
+    /// Reads every entry of a group in one native call.
+    ///
+    /// `path` is absolute or relative to the current path; pass `""` for the
+    /// current group. With `recursive`, entries of subgroups are included with
+    /// keys such as `"sub/key"`. Returns `None` if the group does not exist.
+    pub fn read_group_snapshot(&self, path: &str, recursive: bool) -> Option<ConfigSnapshot> {
+        if self.ptr.is_null() {
+            return None;
+        }
+        let c_path = CString::new(path).ok()?;
+        let owned = unsafe { ffi::wxd_Config_ReadGroupSnapshot(self.ptr, c_path.as_ptr(), recursive) };
+        if owned.is_null() {
+            return None;
+        }
+        unsafe {
+            let data = ffi::wxd_String_GetData(owned) as *const u8;
+            let len = ffi::wxd_String_GetLength(owned);
+            let snapshot = ConfigSnapshot::decode(std::slice::from_raw_parts(data, len));
+            ffi::wxd_String_Free(owned);
+            snapshot
+        }
+    }
+
+    /// Writes many entries in one native call, optionally flushing once afterwards.
+    ///
+    /// Keys are absolute or relative to the current path. Returns the number of
+    /// entries written, or `None` if a key is empty (nothing is written then).
+    ///
+    /// ```rust,no_run
+    /// use wxdragon::config::{Config, ConfigStyle, ConfigValue};
+    ///
+    /// let config = Config::new("MyApp", None, None, None, ConfigStyle::empty());
+    /// config.write_batch(
+    ///     &[
+    ///         ("/UI/Window/Width", ConfigValue::Integer(1024)),
+    ///         ("/UI/Window/Maximized", ConfigValue::Bool(false)),
+    ///         ("/UI/Theme", ConfigValue::String("dark".into())),
+    ///     ],
+    ///     true,
+    /// );
+    /// ```
+    pub fn write_batch<K: AsRef<str>>(&self, entries: &[(K, ConfigValue)], flush: bool) -> Option<usize> {
+        if self.ptr.is_null() {
+            return None;
+        }
+        let batch = encode_batch(entries);
+        let written = unsafe { ffi::wxd_Config_WriteBatch(self.ptr, batch.as_ptr(), batch.len(), flush) };
+        usize::try_from(written).ok()
+    }
+
     // --- Rename Operations ---
 
     /// Renames an entry.
@@ -535,7 +773,9 @@ impl Config {
 
     /// Flushes all changes to storage.
     ///
-    /// If `current_only` is true, only flushes the current group.
+    /// If `current_only` is true, only flushes the current group. In
+    /// write-behind mode this schedules the flush instead; use
+    /// [`Config::flush_pending`] to write immediately.
     pub fn flush(&self, current_only: bool) -> bool {
         if self.ptr.is_null() {
             return false;
@@ -543,6 +783,46 @@ impl Config {
         unsafe { ffi::wxd_Config_Flush(self.ptr, current_only) }
     }
 
+    /// Enables write-behind persistence with the given debounce delay in milliseconds.
+    ///
+    /// Writes still update the in-memory config immediately, but each change
+    /// (and each [`Config::flush`]) only re-arms a one-shot timer, so a burst of
+    /// writes, such as saving window geometry on every resize, is persisted
+    /// by one flush once it pauses. Pending changes are also flushed when the
+    /// config is dropped and when the application exits. A delay of `0` flushes
+    /// anything pending and returns to synchronous flushing.
+    ///
+    /// ```rust,no_run
+    /// use wxdragon::config::{Config, ConfigStyle};
+    ///
+    /// let config = Config::new("MyApp", None, None, None, ConfigStyle::WRITE_BEHIND);
+    /// config.set_write_behind(500);
+    /// config.write_long("/Window/Width", 1024);
+    /// config.flush(false); // returns at memory speed; the file is written later
+    /// ```
+    pub fn set_write_behind(&self, delay_ms: i32) {
+        if self.ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_Config_SetWriteBehind(self.ptr, delay_ms) };
+    }
+
+    /// Returns true if write-behind changes are waiting to be flushed.
+    pub fn is_flush_pending(&self) -> bool {
+        if self.ptr.is_null() {
+            return false;
+        }
+        unsafe { ffi::wxd_Config_IsFlushPending(self.ptr) }
+    }
+
+    /// Writes pending changes now, cancelling any scheduled write-behind flush.
+    pub fn flush_pending(&self) -> bool {
+        if self.ptr.is_null() {
+            return false;
+        }
+        unsafe { ffi::wxd_Config_FlushPending(self.ptr) }
+    }
+
     /// Gets the application name.
     pub fn get_app_name(&self) -> String {
         if self.ptr.is_null() {
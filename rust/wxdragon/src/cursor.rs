@@ -227,6 +227,36 @@ impl Cursor {
         if ptr.is_null() { None } else { Some(Self(ptr)) }
     }
 
+    /// Like [`from_data`](Self::from_data), but reuses the native cursor of an earlier cached
+    /// cursor with identical bits, mask, size and hotspot.
+    pub fn from_data_cached(
+        bits: &[u8],
+        width: i32,
+        height: i32,
+        hotspot_x: i32,
+        hotspot_y: i32,
+        mask_bits: Option<&[u8]>,
+    ) -> Option<Self> {
+        if width <= 0 || height <= 0 {
+            return None;
+        }
+        let expected_size = ((width * height + 7) / 8) as usize;
+        if bits.len() < expected_size || mask_bits.is_some_and(|m| m.len() < expected_size) {
+            return None;
+        }
+        let mask_ptr = mask_bits.map(|m| m.as_ptr()).unwrap_or(std::ptr::null());
+        let ptr = unsafe { ffi::wxd_Cursor_CreateFromDataCached(bits.as_ptr(), width, height, hotspot_x, hotspot_y, mask_ptr) };
+        if ptr.is_null() { None } else { Some(Self(ptr)) }
+    }
+
+    /// Like [`from_bitmap`](Self::from_bitmap), but reuses the native cursor of an earlier cached
+    /// cursor with identical pixels and hotspot, so setting the same custom cursor repeatedly does
+    /// not create a new one each time.
+    pub fn from_bitmap_cached(bitmap: &Bitmap) -> Option<Self> {
+        let ptr = unsafe { ffi::wxd_Cursor_CreateFromImageCached(bitmap.as_const_ptr()) };
+        if ptr.is_null() { None } else { Some(Self(ptr)) }
+    }
+
     /// Creates a copy of this cursor.
     ///
     /// # Returns
@@ -310,3 +310,149 @@ impl TransferOwnership for BitmapDataObject {
         self.data_object.transfer_ownership();
     }
 }
+
+/// A format offered by a [`LazyDataObject`].
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub enum LazyFormat {
+    /// Plain text (e.g. TSV); rendered bytes must be UTF-8.
+    Text,
+    /// An HTML fragment; rendered bytes must be UTF-8.
+    Html,
+    /// A private binary format identified by name (e.g. `"application/x-myapp-rows"`).
+    Custom(String),
+}
+
+struct LazyRenderState {
+    formats: Vec<LazyFormat>,
+    render: Box<dyn FnMut(&LazyFormat) -> Vec<u8>>,
+    /// Last rendered payload; C++ copies it before the next render call.
+    buffer: Vec<u8>,
+}
+
+#[allow(unsafe_op_in_unsafe_fn)]
+unsafe extern "C" fn lazy_render_trampoline(
+    user_data: *mut std::os::raw::c_void,
+    format_index: i32,
+    out_size: *mut usize,
+) -> *const std::os::raw::c_void {
+    if user_data.is_null() || format_index < 0 {
+        return std::ptr::null();
+    }
+    let state = &mut *(user_data as *mut LazyRenderState);
+    let Some(format) = state.formats.get(format_index as usize) else {
+        return std::ptr::null();
+    };
+    state.buffer = (state.render)(format);
+    if !out_size.is_null() {
+        *out_size = state.buffer.len();
+    }
+    state.buffer.as_ptr() as *const std::os::raw::c_void
+}
+
+#[allow(unsafe_op_in_unsafe_fn)]
+unsafe extern "C" fn lazy_free_trampoline(user_data: *mut std::os::raw::c_void) {
+    if !user_data.is_null() {
+        let _ = Box::from_raw(user_data as *mut LazyRenderState);
+    }
+}
+
+/// Data object whose payload is rendered only when a consumer asks for it.
+///
+/// Offering a large selection on the clipboard or in a drag no longer means
+/// serializing it up front: `render` runs on the GUI thread the first time a
+/// paste or drop reads a format, at most once per format, and only for the
+/// formats actually read. The first format is the preferred one.
+///
+/// # Example
+///
+/// ```rust,no_run
+/// use wxdragon::data_object::{LazyDataObject, LazyFormat};
+/// use wxdragon::clipboard::Clipboard;
+///
+/// let mut data = LazyDataObject::new(
+///     vec![LazyFormat::Text, LazyFormat::Html, LazyFormat::Custom("application/x-rows".into())],
+///     |format| match format {
+///         LazyFormat::Text => b"a\tb\n".to_vec(),
+///         LazyFormat::Html => b"<table><tr><td>a</td><td>b</td></tr></table>".to_vec(),
+///         LazyFormat::Custom(_) => vec![0, 1, 2],
+///     },
+/// );
+/// let clipboard = Clipboard::get();
+/// if clipboard.open() {
+///     clipboard.set_data(&mut data);
+///     clipboard.close();
+/// }
+/// ```
+pub struct LazyDataObject {
+    data_object: DataObjectBase,
+}
+
+impl LazyDataObject {
+    /// Creates a lazy data object offering `formats`, rendered by `render` on demand.
+    pub fn new<F>(formats: Vec<LazyFormat>, render: F) -> Self
+    where
+        F: FnMut(&LazyFormat) -> Vec<u8> + 'static,
+    {
+        let ids: Vec<Option<CString>> = formats
+            .iter()
+            .map(|format| match format {
+                LazyFormat::Custom(id) => Some(CString::new(id.as_str()).unwrap_or_default()),
+                _ => None,
+            })
+            .collect();
+        let kinds: Vec<ffi::wxd_LazyDataFormat> = formats
+            .iter()
+            .map(|format| match format {
+                LazyFormat::Text => ffi::wxd_LazyDataFormat_WXD_LAZY_FORMAT_TEXT,
+                LazyFormat::Html => ffi::wxd_LazyDataFormat_WXD_LAZY_FORMAT_HTML,
+                LazyFormat::Custom(_) => ffi::wxd_LazyDataFormat_WXD_LAZY_FORMAT_CUSTOM,
+            })
+            .collect();
+
+        let state = Box::new(LazyRenderState {
+            formats,
+            render: Box::new(render),
+            buffer: Vec::new(),
+        });
+        let user_data = Box::into_raw(state) as *mut std::os::raw::c_void;
+        let ptr = unsafe { ffi::wxd_LazyDataObject_Create(user_data, Some(lazy_render_trampoline), Some(lazy_free_trampoline)) };
+        for (i, (kind, id)) in kinds.into_iter().zip(ids.iter()).enumerate() {
+            let id_ptr = id.as_ref().map_or(std::ptr::null(), |id| id.as_ptr());
+            // Indices follow call order, so they stay aligned with `formats` even if one is rejected.
+            unsafe { ffi::wxd_LazyDataObject_AddFormat(ptr, kind, id_ptr, i == 0) };
+        }
+        Self {
+            data_object: DataObjectBase::from_ptr(ptr, true),
+        }
+    }
+
+    /// Gets the underlying DataObject.
+    pub fn as_data_object(&self) -> &DataObjectBase {
+        &self.data_object
+    }
+
+    /// Gets the underlying DataObject as mutable.
+    pub fn as_data_object_mut(&mut self) -> &mut DataObjectBase {
+        &mut self.data_object
+    }
+}
+
+impl DataObject for LazyDataObject {
+    fn as_data_object_ptr(&self) -> *mut ffi::wxd_DataObject_t {
+        self.data_object.as_ptr()
+    }
+}
+
+impl Drop for LazyDataObject {
+    fn drop(&mut self) {
+        if !self.data_object.as_ptr().is_null() && self.data_object.owned {
+            unsafe { ffi::wxd_DataObject_Destroy(self.data_object.as_ptr()) };
+        }
+    }
+}
+
+impl TransferOwnership for LazyDataObject {
+    fn transfer_ownership(&mut self) {
+        self.data_object.transfer_ownership();
+    }
+}
@@ -0,0 +1,214 @@
+//! Recorded drawing commands replayed on a device context in one call.
+
+use super::{BrushStyle, PenStyle, Point, PolygonFillMode};
+use crate::color::Colour;
+use wxdragon_sys as ffi;
+
+/// A reusable list of drawing commands.
+///
+/// Record once, then replay with [`DeviceContext::execute_commands`](super::DeviceContext::execute_commands)
+/// on every paint: the whole list crosses into native code in a single call instead of one call
+/// per primitive. [`clear`](Self::clear) keeps the allocation, so a list rebuilt each frame does
+/// not allocate either.
+///
+/// ```ignore
+/// let mut commands = DrawCommands::new();
+/// commands.set_pen(Colour::rgb(0, 0, 0), 1, PenStyle::Solid);
+/// for (x, y) in samples {
+///     commands.point(x, y);
+/// }
+/// dc.execute_commands(&commands);
+/// ```
+#[derive(Debug, Clone, Default)]
+pub struct DrawCommands {
+    words: Vec<u32>,
+    count: usize,
+}
+
+impl DrawCommands {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Number of recorded commands.
+    pub fn len(&self) -> usize {
+        self.count
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.count == 0
+    }
+
+    /// Removes all commands, keeping the buffer.
+    pub fn clear(&mut self) {
+        self.words.clear();
+        self.count = 0;
+    }
+
+    pub fn set_pen(&mut self, colour: Colour, width: i32, style: PenStyle) -> &mut Self {
+        self.op(
+            ffi::wxd_DrawOp_WXD_DRAW_OP_SET_PEN,
+            &[pack(colour), width as u32, style.bits() as u32],
+        )
+    }
+
+    pub fn set_brush(&mut self, colour: Colour, style: BrushStyle) -> &mut Self {
+        self.op(ffi::wxd_DrawOp_WXD_DRAW_OP_SET_BRUSH, &[pack(colour), style.bits() as u32])
+    }
+
+    pub fn set_text_foreground(&mut self, colour: Colour) -> &mut Self {
+        self.op(ffi::wxd_DrawOp_WXD_DRAW_OP_SET_TEXT_FOREGROUND, &[pack(colour)])
+    }
+
+    pub fn set_text_background(&mut self, colour: Colour) -> &mut Self {
+        self.op(ffi::wxd_DrawOp_WXD_DRAW_OP_SET_TEXT_BACKGROUND, &[pack(colour)])
+    }
+
+    pub fn point(&mut self, x: i32, y: i32) -> &mut Self {
+        self.op(ffi::wxd_DrawOp_WXD_DRAW_OP_POINT, &[x as u32, y as u32])
+    }
+
+    pub fn line(&mut self, x1: i32, y1: i32, x2: i32, y2: i32) -> &mut Self {
+        self.op(
+            ffi::wxd_DrawOp_WXD_DRAW_OP_LINE,
+            &[x1 as u32, y1 as u32, x2 as u32, y2 as u32],
+        )
+    }
+
+    pub fn rectangle(&mut self, x: i32, y: i32, width: i32, height: i32) -> &mut Self {
+        self.op(
+            ffi::wxd_DrawOp_WXD_DRAW_OP_RECTANGLE,
+            &[x as u32, y as u32, width as u32, height as u32],
+        )
+    }
+
+    pub fn rounded_rectangle(&mut self, x: i32, y: i32, width: i32, height: i32, radius: f32) -> &mut Self {
+        self.op(
+            ffi::wxd_DrawOp_WXD_DRAW_OP_ROUNDED_RECTANGLE,
+            &[x as u32, y as u32, width as u32, height as u32, radius.to_bits()],
+        )
+    }
+
+    pub fn circle(&mut self, x: i32, y: i32, radius: i32) -> &mut Self {
+        self.op(ffi::wxd_DrawOp_WXD_DRAW_OP_CIRCLE, &[x as u32, y as u32, radius as u32])
+    }
+
+    pub fn ellipse(&mut self, x: i32, y: i32, width: i32, height: i32) -> &mut Self {
+        self.op(
+            ffi::wxd_DrawOp_WXD_DRAW_OP_ELLIPSE,
+            &[x as u32, y as u32, width as u32, height as u32],
+        )
+    }
+
+    /// Arc from (x1, y1) to (x2, y2) around the centre (xc, yc), as `DeviceContext::draw_arc`.
+    pub fn arc(&mut self, x1: i32, y1: i32, x2: i32, y2: i32, xc: i32, yc: i32) -> &mut Self {
+        self.op(
+            ffi::wxd_DrawOp_WXD_DRAW_OP_ARC,
+            &[x1 as u32, y1 as u32, x2 as u32, y2 as u32, xc as u32, yc as u32],
+        )
+    }
+
+    pub fn text(&mut self, text: &str, x: i32, y: i32) -> &mut Self {
+        let bytes = text.as_bytes();
+        self.op(ffi::wxd_DrawOp_WXD_DRAW_OP_TEXT, &[x as u32, y as u32, bytes.len() as u32]);
+        for chunk in bytes.chunks(4) {
+            let mut word = [0u8; 4];
+            word[..chunk.len()].copy_from_slice(chunk);
+            self.words.push(u32::from_ne_bytes(word));
+        }
+        self
+    }
+
+    /// Connected line segments through `points`.
+    pub fn lines(&mut self, points: &[Point]) -> &mut Self {
+        self.op(ffi::wxd_DrawOp_WXD_DRAW_OP_LINES, &[points.len() as u32]);
+        self.push_points(points);
+        self
+    }
+
+    pub fn polygon(&mut self, points: &[Point], fill_mode: PolygonFillMode) -> &mut Self {
+        self.op(
+            ffi::wxd_DrawOp_WXD_DRAW_OP_POLYGON,
+            &[points.len() as u32, fill_mode.to_raw() as u32],
+        );
+        self.push_points(points);
+        self
+    }
+
+    /// Clips to the given rectangle within the DC's clipping region at the start of the replay,
+    /// replacing any clip set earlier in the list.
+    pub fn set_clipping_region(&mut self, x: i32, y: i32, width: i32, height: i32) -> &mut Self {
+        self.op(
+            ffi::wxd_DrawOp_WXD_DRAW_OP_SET_CLIP,
+            &[x as u32, y as u32, width as u32, height as u32],
+        )
+    }
+
+    /// Goes back to the DC's clipping region at the start of the replay, which is also restored
+    /// when the replay ends.
+    pub fn destroy_clipping_region(&mut self) -> &mut Self {
+        self.op(ffi::wxd_DrawOp_WXD_DRAW_OP_RESET_CLIP, &[])
+    }
+
+    pub(crate) fn words(&self) -> &[u32] {
+        &self.words
+    }
+
+    fn op(&mut self, op: ffi::wxd_DrawOp, operands: &[u32]) -> &mut Self {
+        self.words.push(op as u32);
+        self.words.extend_from_slice(operands);
+        self.count += 1;
+        self
+    }
+
+    fn push_points(&mut self, points: &[Point]) {
+        self.words.reserve(points.len() * 2);
+        for p in points {
+            self.words.push(p.x as u32);
+            self.words.push(p.y as u32);
+        }
+    }
+}
+
+fn pack(colour: Colour) -> u32 {
+    u32::from_be_bytes([colour.r, colour.g, colour.b, colour.a])
+}
+
+#[cfg(test)]
+mod tests {
+    use super::{DrawCommands, Point};
+    use crate::color::Colour;
+    use wxdragon_sys as ffi;
+
+    #[test]
+    fn text_is_padded_to_whole_words() {
+        let mut commands = DrawCommands::new();
+        commands.text("hello", 1, 2);
+        let words = commands.words();
+        assert_eq!(&words[..4], &[ffi::wxd_DrawOp_WXD_DRAW_OP_TEXT as u32, 1, 2, 5]);
+        assert_eq!(words.len(), 6);
+        assert_eq!(words[4].to_ne_bytes(), *b"hell");
+        assert_eq!(words[5].to_ne_bytes(), *b"o\0\0\0");
+    }
+
+    #[test]
+    fn points_follow_their_count() {
+        let mut commands = DrawCommands::new();
+        commands.lines(&[Point::new(1, -1), Point::new(3, 4)]);
+        assert_eq!(
+            commands.words(),
+            &[ffi::wxd_DrawOp_WXD_DRAW_OP_LINES as u32, 2, 1, -1i32 as u32, 3, 4]
+        );
+    }
+
+    #[test]
+    fn colours_pack_as_rgba_and_clear_resets_the_count() {
+        let mut commands = DrawCommands::new();
+        commands.set_text_foreground(Colour::new(0x11, 0x22, 0x33, 0x44)).point(0, 0);
+        assert_eq!(commands.len(), 2);
+        assert_eq!(commands.words()[1], 0x1122_3344);
+        commands.clear();
+        assert!(commands.is_empty());
+        assert!(commands.words().is_empty());
+    }
+}
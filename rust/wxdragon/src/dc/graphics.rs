@@ -0,0 +1,322 @@
+//! Anti-aliased drawing through `wxGraphicsContext`.
+
+use std::marker::PhantomData;
+
+use super::{BrushStyle, DeviceContext, PenStyle, PolygonFillMode};
+use crate::bitmap::Bitmap;
+use crate::color::Colour;
+use crate::font::Font;
+use wxdragon_sys as ffi;
+
+/// A point with floating-point coordinates, as used by [`GraphicsContext`].
+#[derive(Debug, Clone, Copy, PartialEq, Default)]
+#[repr(C)]
+pub struct Point2D {
+    pub x: f64,
+    pub y: f64,
+}
+
+impl Point2D {
+    pub fn new(x: f64, y: f64) -> Self {
+        Self { x, y }
+    }
+}
+
+// `Point2D` is passed to C as `wxd_Point2D` without copying.
+const _: () = assert!(std::mem::size_of::<Point2D>() == std::mem::size_of::<ffi::wxd_Point2D>());
+
+fn as_ffi_points(points: &[Point2D]) -> *const ffi::wxd_Point2D {
+    points.as_ptr() as *const ffi::wxd_Point2D
+}
+
+/// Which graphics backend to create a context with.
+///
+/// A backend that is not available in this build of wxWidgets falls back to the default one.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub enum GraphicsRenderer {
+    /// The platform default (GDI+ on MSW, CoreGraphics on macOS, Cairo on GTK).
+    #[default]
+    Default,
+    /// Direct2D (MSW only).
+    Direct2D,
+    /// GDI+ (MSW only).
+    GdiPlus,
+    /// Cairo.
+    Cairo,
+}
+
+impl GraphicsRenderer {
+    fn to_raw(self) -> i32 {
+        (match self {
+            GraphicsRenderer::Default => ffi::wxd_GraphicsRendererKind_WXD_GRAPHICS_RENDERER_DEFAULT,
+            GraphicsRenderer::Direct2D => ffi::wxd_GraphicsRendererKind_WXD_GRAPHICS_RENDERER_DIRECT2D,
+            GraphicsRenderer::GdiPlus => ffi::wxd_GraphicsRendererKind_WXD_GRAPHICS_RENDERER_GDIPLUS,
+            GraphicsRenderer::Cairo => ffi::wxd_GraphicsRendererKind_WXD_GRAPHICS_RENDERER_CAIRO,
+        }) as i32
+    }
+}
+
+/// A `wxGraphicsContext` drawing on a device context or into a bitmap.
+///
+/// Drawing is anti-aliased and uses floating-point coordinates. Point arrays are passed to
+/// native code whole, so a polyline or path costs one call regardless of its length. The
+/// context borrows its target; pending drawing is flushed when it is dropped.
+pub struct GraphicsContext<'a> {
+    ptr: *mut ffi::wxd_GraphicsContext_t,
+    _target: PhantomData<&'a ()>,
+}
+
+impl<'a> GraphicsContext<'a> {
+    /// Creates a context on a window, paint, client, memory or buffered paint DC.
+    ///
+    /// Returns `None` for other DC types.
+    pub fn from_dc<D: DeviceContext + ?Sized>(dc: &'a D) -> Option<Self> {
+        Self::from_dc_with_renderer(dc, GraphicsRenderer::Default)
+    }
+
+    pub fn from_dc_with_renderer<D: DeviceContext + ?Sized>(dc: &'a D, renderer: GraphicsRenderer) -> Option<Self> {
+        let ptr = unsafe { ffi::wxd_GraphicsContext_CreateFromDC(dc.dc_ptr(), renderer.to_raw()) };
+        Self::from_ptr(ptr)
+    }
+
+    /// Creates a context drawing into `bitmap`; the drawing lands in the bitmap when the
+    /// context is dropped.
+    pub fn from_bitmap(bitmap: &'a mut Bitmap) -> Option<Self> {
+        Self::from_bitmap_with_renderer(bitmap, GraphicsRenderer::Default)
+    }
+
+    pub fn from_bitmap_with_renderer(bitmap: &'a mut Bitmap, renderer: GraphicsRenderer) -> Option<Self> {
+        let ptr = unsafe { ffi::wxd_GraphicsContext_CreateFromBitmap(bitmap.as_mut_ptr(), renderer.to_raw()) };
+        Self::from_ptr(ptr)
+    }
+
+    fn from_ptr(ptr: *mut ffi::wxd_GraphicsContext_t) -> Option<Self> {
+        if ptr.is_null() {
+            None
+        } else {
+            Some(Self {
+                ptr,
+                _target: PhantomData,
+            })
+        }
+    }
+
+    pub fn flush(&self) {
+        unsafe { ffi::wxd_GraphicsContext_Flush(self.ptr) };
+    }
+
+    // --- State ---
+
+    pub fn set_pen(&self, colour: Colour, width: f64, style: PenStyle) {
+        unsafe { ffi::wxd_GraphicsContext_SetPen(self.ptr, colour.into(), width, style.bits() as i32) };
+    }
+
+    pub fn set_brush(&self, colour: Colour, style: BrushStyle) {
+        unsafe { ffi::wxd_GraphicsContext_SetBrush(self.ptr, colour.into(), style.bits() as i32) };
+    }
+
+    pub fn set_font(&self, font: &Font, colour: Colour) {
+        unsafe { ffi::wxd_GraphicsContext_SetFont(self.ptr, font.as_ptr(), colour.into()) };
+    }
+
+    /// Turns anti-aliasing on or off; returns false if the backend does not support the change.
+    pub fn set_antialias(&self, enable: bool) -> bool {
+        unsafe { ffi::wxd_GraphicsContext_SetAntialias(self.ptr, enable) }
+    }
+
+    /// Saves the transform, clip and drawing objects; see [`pop_state`](Self::pop_state).
+    pub fn push_state(&self) {
+        unsafe { ffi::wxd_GraphicsContext_PushState(self.ptr) };
+    }
+
+    pub fn pop_state(&self) {
+        unsafe { ffi::wxd_GraphicsContext_PopState(self.ptr) };
+    }
+
+    pub fn translate(&self, dx: f64, dy: f64) {
+        unsafe { ffi::wxd_GraphicsContext_Translate(self.ptr, dx, dy) };
+    }
+
+    pub fn scale(&self, sx: f64, sy: f64) {
+        unsafe { ffi::wxd_GraphicsContext_Scale(self.ptr, sx, sy) };
+    }
+
+    pub fn rotate(&self, radians: f64) {
+        unsafe { ffi::wxd_GraphicsContext_Rotate(self.ptr, radians) };
+    }
+
+    pub fn clip(&self, x: f64, y: f64, width: f64, height: f64) {
+        unsafe { ffi::wxd_GraphicsContext_Clip(self.ptr, x, y, width, height) };
+    }
+
+    pub fn reset_clip(&self) {
+        unsafe { ffi::wxd_GraphicsContext_ResetClip(self.ptr) };
+    }
+
+    // --- Drawing ---
+
+    pub fn stroke_line(&self, x1: f64, y1: f64, x2: f64, y2: f64) {
+        unsafe { ffi::wxd_GraphicsContext_StrokeLine(self.ptr, x1, y1, x2, y2) };
+    }
+
+    /// Strokes a connected polyline through `points`.
+    pub fn stroke_lines(&self, points: &[Point2D]) {
+        unsafe { ffi::wxd_GraphicsContext_StrokeLines(self.ptr, as_ffi_points(points), points.len()) };
+    }
+
+    /// Strokes independent segments from `begin[i]` to `end[i]`; extra points in the longer
+    /// slice are ignored.
+    pub fn stroke_line_segments(&self, begin: &[Point2D], end: &[Point2D]) {
+        let n = begin.len().min(end.len());
+        unsafe { ffi::wxd_GraphicsContext_StrokeLineSegments(self.ptr, as_ffi_points(begin), as_ffi_points(end), n) };
+    }
+
+    /// Fills and strokes the polygon through `points`.
+    pub fn draw_lines(&self, points: &[Point2D], fill_mode: PolygonFillMode) {
+        unsafe { ffi::wxd_GraphicsContext_DrawLines(self.ptr, as_ffi_points(points), points.len(), fill_mode.to_raw()) };
+    }
+
+    pub fn draw_rectangle(&self, x: f64, y: f64, width: f64, height: f64) {
+        unsafe { ffi::wxd_GraphicsContext_DrawRectangle(self.ptr, x, y, width, height) };
+    }
+
+    pub fn draw_rounded_rectangle(&self, x: f64, y: f64, width: f64, height: f64, radius: f64) {
+        unsafe { ffi::wxd_GraphicsContext_DrawRoundedRectangle(self.ptr, x, y, width, height, radius) };
+    }
+
+    pub fn draw_ellipse(&self, x: f64, y: f64, width: f64, height: f64) {
+        unsafe { ffi::wxd_GraphicsContext_DrawEllipse(self.ptr, x, y, width, height) };
+    }
+
+    pub fn draw_text(&self, text: &str, x: f64, y: f64) {
+        unsafe { ffi::wxd_GraphicsContext_DrawText(self.ptr, text.as_ptr() as *const _, text.len(), x, y) };
+    }
+
+    /// Width and height of `text` in the current font.
+    pub fn get_text_extent(&self, text: &str) -> (f64, f64) {
+        let mut width = 0.0;
+        let mut height = 0.0;
+        unsafe {
+            ffi::wxd_GraphicsContext_GetTextExtent(self.ptr, text.as_ptr() as *const _, text.len(), &mut width, &mut height)
+        };
+        (width, height)
+    }
+
+    pub fn draw_bitmap(&self, bitmap: &Bitmap, x: f64, y: f64, width: f64, height: f64) {
+        unsafe { ffi::wxd_GraphicsContext_DrawBitmap(self.ptr, bitmap.as_const_ptr(), x, y, width, height) };
+    }
+
+    // --- Paths ---
+
+    /// Creates an empty path for this context.
+    pub fn create_path(&self) -> GraphicsPath {
+        GraphicsPath {
+            ptr: unsafe { ffi::wxd_GraphicsPath_Create(self.ptr) },
+        }
+    }
+
+    pub fn stroke_path(&self, path: &GraphicsPath) {
+        unsafe { ffi::wxd_GraphicsContext_StrokePath(self.ptr, path.ptr) };
+    }
+
+    pub fn fill_path(&self, path: &GraphicsPath, fill_mode: PolygonFillMode) {
+        unsafe { ffi::wxd_GraphicsContext_FillPath(self.ptr, path.ptr, fill_mode.to_raw()) };
+    }
+
+    /// Fills, then strokes `path`.
+    pub fn draw_path(&self, path: &GraphicsPath, fill_mode: PolygonFillMode) {
+        unsafe { ffi::wxd_GraphicsContext_DrawPath(self.ptr, path.ptr, fill_mode.to_raw()) };
+    }
+}
+
+impl Drop for GraphicsContext<'_> {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_GraphicsContext_Destroy(self.ptr) };
+    }
+}
+
+/// A `wxGraphicsPath`, created with [`GraphicsContext::create_path`].
+///
+/// A path can be kept and drawn again, also on other contexts of the same renderer.
+pub struct GraphicsPath {
+    ptr: *mut ffi::wxd_GraphicsPath_t,
+}
+
+impl GraphicsPath {
+    pub fn move_to_point(&mut self, x: f64, y: f64) -> &mut Self {
+        unsafe { ffi::wxd_GraphicsPath_MoveToPoint(self.ptr, x, y) };
+        self
+    }
+
+    pub fn add_line_to_point(&mut self, x: f64, y: f64) -> &mut Self {
+        unsafe { ffi::wxd_GraphicsPath_AddLineToPoint(self.ptr, x, y) };
+        self
+    }
+
+    /// Adds a subpath starting at `points[0]` through the remaining points in one call.
+    pub fn add_lines(&mut self, points: &[Point2D], close: bool) -> &mut Self {
+        unsafe { ffi::wxd_GraphicsPath_AddLines(self.ptr, as_ffi_points(points), points.len(), close) };
+        self
+    }
+
+    /// Adds several polylines in one call: polyline `i` is `points[offsets[i]..offsets[i + 1]]`.
+    pub fn add_polylines(&mut self, points: &[Point2D], offsets: &[u32], close: bool) -> &mut Self {
+        if offsets.len() < 2 {
+            return self;
+        }
+        unsafe {
+            ffi::wxd_GraphicsPath_AddPolylines(
+                self.ptr,
+                as_ffi_points(points),
+                points.len(),
+                offsets.as_ptr(),
+                offsets.len() - 1,
+                close,
+            )
+        };
+        self
+    }
+
+    pub fn add_rectangle(&mut self, x: f64, y: f64, width: f64, height: f64) -> &mut Self {
+        unsafe { ffi::wxd_GraphicsPath_AddRectangle(self.ptr, x, y, width, height) };
+        self
+    }
+
+    pub fn add_rounded_rectangle(&mut self, x: f64, y: f64, width: f64, height: f64, radius: f64) -> &mut Self {
+        unsafe { ffi::wxd_GraphicsPath_AddRoundedRectangle(self.ptr, x, y, width, height, radius) };
+        self
+    }
+
+    pub fn add_circle(&mut self, x: f64, y: f64, radius: f64) -> &mut Self {
+        unsafe { ffi::wxd_GraphicsPath_AddCircle(self.ptr, x, y, radius) };
+        self
+    }
+
+    pub fn add_ellipse(&mut self, x: f64, y: f64, width: f64, height: f64) -> &mut Self {
+        unsafe { ffi::wxd_GraphicsPath_AddEllipse(self.ptr, x, y, width, height) };
+        self
+    }
+
+    /// Adds an arc of a circle centred on (`x`, `y`) between angles in radians.
+    pub fn add_arc(&mut self, x: f64, y: f64, radius: f64, start: f64, end: f64, clockwise: bool) -> &mut Self {
+        unsafe { ffi::wxd_GraphicsPath_AddArc(self.ptr, x, y, radius, start, end, clockwise) };
+        self
+    }
+
+    /// Adds a cubic Bézier curve from the current point to (`x`, `y`).
+    pub fn add_curve_to_point(&mut self, cx1: f64, cy1: f64, cx2: f64, cy2: f64, x: f64, y: f64) -> &mut Self {
+        unsafe { ffi::wxd_GraphicsPath_AddCurveToPoint(self.ptr, cx1, cy1, cx2, cy2, x, y) };
+        self
+    }
+
+    pub fn close_subpath(&mut self) -> &mut Self {
+        unsafe { ffi::wxd_GraphicsPath_CloseSubpath(self.ptr) };
+        self
+    }
+}
+
+impl Drop for GraphicsPath {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_GraphicsPath_Destroy(self.ptr) };
+    }
+}
@@ -274,7 +274,10 @@ impl GradientDirection {
 }
 
 /// Point structure for drawing operations
+///
+/// Laid out as `wxd_Point`, so point slices are passed to the batched drawing calls as is.
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
+#[repr(C)]
 pub struct Point {
     pub x: i32,
     pub y: i32,
@@ -298,8 +301,130 @@ impl From<wxdragon_sys::wxd_Point> for Point {
     }
 }
 
+/// A pen created once and selected with [`DeviceContext::select_pen`], for drawing code that
+/// switches pens often. Selecting shares the native object instead of creating one.
+pub struct Pen {
+    ptr: *mut wxdragon_sys::wxd_Pen_t,
+}
+
+impl Pen {
+    pub fn new(colour: Colour, width: i32, style: PenStyle) -> Self {
+        Self {
+            ptr: unsafe { wxdragon_sys::wxd_Pen_Create(colour.into(), width, style.bits() as i32) },
+        }
+    }
+}
+
+impl Drop for Pen {
+    fn drop(&mut self) {
+        unsafe { wxdragon_sys::wxd_Pen_Destroy(self.ptr) };
+    }
+}
+
+/// A brush created once and selected with [`DeviceContext::select_brush`], see [`Pen`].
+pub struct Brush {
+    ptr: *mut wxdragon_sys::wxd_Brush_t,
+}
+
+impl Brush {
+    pub fn new(colour: Colour, style: BrushStyle) -> Self {
+        Self {
+            ptr: unsafe { wxdragon_sys::wxd_Brush_Create(colour.into(), style.bits() as i32) },
+        }
+    }
+}
+
+impl Drop for Brush {
+    fn drop(&mut self) {
+        unsafe { wxdragon_sys::wxd_Brush_Destroy(self.ptr) };
+    }
+}
+
+/// Per-item pens and brushes for the batched `draw_*_list` calls of [`DeviceContext`].
+///
+/// Each palette comes with one index per item; an index past the palette keeps the pen or brush
+/// of the previous item. An index slice shorter than the item list is ignored.
+#[derive(Clone, Copy, Default)]
+pub struct DrawListStyle<'a> {
+    pens: &'a [Pen],
+    pen_indices: &'a [u32],
+    brushes: &'a [Brush],
+    brush_indices: &'a [u32],
+}
+
+impl<'a> DrawListStyle<'a> {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    pub fn pens(mut self, palette: &'a [Pen], indices: &'a [u32]) -> Self {
+        self.pens = palette;
+        self.pen_indices = indices;
+        self
+    }
+
+    pub fn brushes(mut self, palette: &'a [Brush], indices: &'a [u32]) -> Self {
+        self.brushes = palette;
+        self.brush_indices = indices;
+        self
+    }
+
+    /// Calls `f` with the C form of `style` for a list of `n` items.
+    fn with_raw<R>(style: Option<&Self>, n: usize, f: impl FnOnce(*const wxdragon_sys::wxd_DrawListStyle) -> R) -> R {
+        let Some(style) = style else {
+            return f(std::ptr::null());
+        };
+        let pens: Vec<*const wxdragon_sys::wxd_Pen_t> = style.pens.iter().map(|p| p.ptr as *const _).collect();
+        let brushes: Vec<*const wxdragon_sys::wxd_Brush_t> = style.brushes.iter().map(|b| b.ptr as *const _).collect();
+        let indices = |indices: &[u32]| {
+            if indices.len() >= n {
+                indices.as_ptr()
+            } else {
+                std::ptr::null()
+            }
+        };
+        let raw = wxdragon_sys::wxd_DrawListStyle {
+            pens: pens.as_ptr(),
+            pen_count: pens.len(),
+            pen_indices: indices(style.pen_indices),
+            brushes: brushes.as_ptr(),
+            brush_count: brushes.len(),
+            brush_indices: indices(style.brush_indices),
+        };
+        f(&raw)
+    }
+}
+
+/// Enables a cache of measured text shared by the DC and window `get_text_extent` /
+/// `get_full_text_extent` / `get_text_extents` calls, holding up to `entries` strings.
+///
+/// Entries are keyed by the text, the font and the DPI and user scale, so a font or scale
+/// change measures again. Changing the capacity clears the cache; 0 disables it.
+pub fn set_text_extent_cache_capacity(entries: usize) {
+    unsafe { wxdragon_sys::wxd_TextExtentCache_SetCapacity(entries) };
+}
+
+/// Drops all cached text extents, e.g. after installing fonts.
+pub fn clear_text_extent_cache() {
+    unsafe { wxdragon_sys::wxd_TextExtentCache_Clear() };
+}
+
+/// Packs strings into one UTF-8 buffer with `len + 1` offsets.
+pub(crate) fn pack_utf8<'s>(texts: impl Iterator<Item = &'s str>) -> (Vec<u8>, Vec<u32>) {
+    let mut packed = Vec::new();
+    let mut offsets = vec![0u32];
+    for text in texts {
+        packed.extend_from_slice(text.as_bytes());
+        offsets.push(packed.len() as u32);
+    }
+    (packed, offsets)
+}
+
 /// Rectangle structure for drawing operations
+///
+/// Laid out as `wxd_Rect`, see [`Point`].
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
+#[repr(C)]
 pub struct Rect {
     pub x: i32,
     pub y: i32,
@@ -337,14 +462,20 @@ impl From<wxdragon_sys::wxd_Rect> for Rect {
 
 pub mod auto_buffered_paint_dc;
 pub mod client_dc;
+pub mod commands;
+pub mod graphics;
 pub mod memory_dc;
+pub mod offscreen;
 pub mod paint_dc;
 pub mod screen_dc;
 pub mod window_dc;
 
 pub use auto_buffered_paint_dc::AutoBufferedPaintDC;
 pub use client_dc::ClientDC;
+pub use commands::DrawCommands;
+pub use graphics::{GraphicsContext, GraphicsPath, GraphicsRenderer, Point2D};
 pub use memory_dc::MemoryDC;
+pub use offscreen::OffscreenSurface;
 pub use paint_dc::PaintDC;
 pub use screen_dc::ScreenDC;
 pub use window_dc::WindowDC;
@@ -519,6 +650,9 @@ pub trait DeviceContext {
     }
 
     /// Set the pen for drawing outlines
+    ///
+    /// Pens are reused from a small cache keyed by the arguments; see [`Pen`] for selecting a
+    /// prebuilt one.
     fn set_pen(&self, colour: Colour, width: i32, style: PenStyle) {
         unsafe {
             wxdragon_sys::wxd_DC_SetPen(self.dc_ptr(), colour.into(), width, style.bits() as i32);
@@ -526,12 +660,28 @@ pub trait DeviceContext {
     }
 
     /// Set the brush for filling shapes
+    ///
+    /// Brushes are reused from a small cache keyed by the arguments; see [`Brush`].
     fn set_brush(&self, colour: Colour, style: BrushStyle) {
         unsafe {
             wxdragon_sys::wxd_DC_SetBrush(self.dc_ptr(), colour.into(), style.bits() as i32);
         }
     }
 
+    /// Select a prebuilt pen
+    fn select_pen(&self, pen: &Pen) {
+        unsafe {
+            wxdragon_sys::wxd_DC_SelectPen(self.dc_ptr(), pen.ptr);
+        }
+    }
+
+    /// Select a prebuilt brush
+    fn select_brush(&self, brush: &Brush) {
+        unsafe {
+            wxdragon_sys::wxd_DC_SelectBrush(self.dc_ptr(), brush.ptr);
+        }
+    }
+
     /// Draw a point at the specified coordinates
     fn draw_point(&self, x: i32, y: i32) {
         unsafe {
@@ -684,6 +834,115 @@ pub trait DeviceContext {
         unsafe { wxdragon_sys::wxd_DC_DrawSpline(self.dc_ptr(), ffi_points.len() as i32, ffi_points.as_mut_ptr()) };
     }
 
+    /// Draw many points in one native call
+    fn draw_point_list(&self, points: &[Point], style: Option<&DrawListStyle>) {
+        DrawListStyle::with_raw(style, points.len(), |style| unsafe {
+            wxdragon_sys::wxd_DC_DrawPointList(self.dc_ptr(), points.as_ptr() as *const _, points.len(), style)
+        });
+    }
+
+    /// Draw many independent line segments, each from its first point to its second
+    fn draw_line_list(&self, segments: &[[Point; 2]], style: Option<&DrawListStyle>) {
+        DrawListStyle::with_raw(style, segments.len(), |style| unsafe {
+            wxdragon_sys::wxd_DC_DrawLineList(self.dc_ptr(), segments.as_ptr() as *const _, segments.len(), style)
+        });
+    }
+
+    /// Draw many rectangles in one native call
+    fn draw_rectangle_list(&self, rects: &[Rect], style: Option<&DrawListStyle>) {
+        DrawListStyle::with_raw(style, rects.len(), |style| unsafe {
+            wxdragon_sys::wxd_DC_DrawRectangleList(self.dc_ptr(), rects.as_ptr() as *const _, rects.len(), style)
+        });
+    }
+
+    /// Draw many ellipses, each inside its rectangle, in one native call
+    fn draw_ellipse_list(&self, rects: &[Rect], style: Option<&DrawListStyle>) {
+        DrawListStyle::with_raw(style, rects.len(), |style| unsafe {
+            wxdragon_sys::wxd_DC_DrawEllipseList(self.dc_ptr(), rects.as_ptr() as *const _, rects.len(), style)
+        });
+    }
+
+    /// Draw circles of one radius around `centres` in one native call
+    fn draw_circle_list(&self, centres: &[Point], radius: i32, style: Option<&DrawListStyle>) {
+        DrawListStyle::with_raw(style, centres.len(), |style| unsafe {
+            wxdragon_sys::wxd_DC_DrawCircleList(
+                self.dc_ptr(),
+                centres.as_ptr() as *const _,
+                std::ptr::null(),
+                radius,
+                centres.len(),
+                style,
+            )
+        });
+    }
+
+    /// Draw circles with per-item radii; extra entries in the longer slice are ignored
+    fn draw_circle_list_with_radii(&self, centres: &[Point], radii: &[i32], style: Option<&DrawListStyle>) {
+        let n = centres.len().min(radii.len());
+        DrawListStyle::with_raw(style, n, |style| unsafe {
+            wxdragon_sys::wxd_DC_DrawCircleList(self.dc_ptr(), centres.as_ptr() as *const _, radii.as_ptr(), 0, n, style)
+        });
+    }
+
+    /// Draw many strings at their positions in one native call, optionally each in its own
+    /// text colour; extra entries in the longer slices are ignored
+    fn draw_text_list<S: AsRef<str>>(&self, texts: &[S], positions: &[Point], foregrounds: Option<&[Colour]>)
+    where
+        Self: Sized,
+    {
+        let n = texts
+            .len()
+            .min(positions.len())
+            .min(foregrounds.map_or(usize::MAX, |f| f.len()));
+        let (packed, offsets) = pack_utf8(texts[..n].iter().map(|t| t.as_ref()));
+        let colours: Option<Vec<wxdragon_sys::wxd_Colour_t>> = foregrounds.map(|f| f[..n].iter().map(|c| (*c).into()).collect());
+        unsafe {
+            wxdragon_sys::wxd_DC_DrawTextList(
+                self.dc_ptr(),
+                packed.as_ptr() as *const _,
+                offsets.as_ptr(),
+                positions.as_ptr() as *const _,
+                n,
+                colours.as_ref().map_or(std::ptr::null(), |c| c.as_ptr()),
+            )
+        };
+    }
+
+    /// Measure many strings in the current font in one native call
+    fn get_text_extents(&self, texts: &[&str]) -> Vec<(i32, i32)> {
+        let (packed, offsets) = pack_utf8(texts.iter().copied());
+        let mut widths = vec![0i32; texts.len()];
+        let mut heights = vec![0i32; texts.len()];
+        unsafe {
+            wxdragon_sys::wxd_DC_GetTextExtents(
+                self.dc_ptr(),
+                packed.as_ptr() as *const _,
+                offsets.as_ptr(),
+                texts.len(),
+                widths.as_mut_ptr(),
+                heights.as_mut_ptr(),
+            )
+        };
+        widths.into_iter().zip(heights).collect()
+    }
+
+    /// Replay recorded drawing commands in one native call
+    ///
+    /// Returns the number of commands executed, which is less than `commands.len()` only if the
+    /// list was malformed.
+    fn execute_commands(&self, commands: &DrawCommands) -> usize {
+        let words = commands.words();
+        unsafe { wxdragon_sys::wxd_DC_ExecuteCommands(self.dc_ptr(), words.as_ptr(), words.len(), std::ptr::null()) }
+    }
+
+    /// Replay recorded drawing commands offset by (`dx`, `dy`) device units and scaled by
+    /// (`sx`, `sy`); the origin and scale of the device context are restored afterwards
+    fn execute_commands_transformed(&self, commands: &DrawCommands, dx: i32, dy: i32, sx: f64, sy: f64) -> usize {
+        let words = commands.words();
+        let transform = wxdragon_sys::wxd_DrawTransform { dx, dy, sx, sy };
+        unsafe { wxdragon_sys::wxd_DC_ExecuteCommands(self.dc_ptr(), words.as_ptr(), words.len(), &transform) }
+    }
+
     /// Draw rotated text at the specified position
     fn draw_rotated_text(&self, text: &str, x: i32, y: i32, angle: f64) {
         use std::ffi::CString;
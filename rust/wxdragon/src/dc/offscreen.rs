@@ -0,0 +1,86 @@
+use crate::dc::DeviceContext;
+use crate::geometry::Size;
+
+/// An offscreen drawing surface whose pixels can be read into an RGBA buffer in one pass.
+///
+/// Intended for thumbnails, exports and golden images: draw through the [`DeviceContext`]
+/// methods, then call [`OffscreenSurface::read_rgba`]. Reading goes straight from the native
+/// backing store, without the `wxImage` round trip of [`crate::bitmap::Bitmap::get_rgba_data`]. The
+/// surface is opaque and starts out white; reuse one surface across many renders to avoid
+/// reallocating.
+///
+/// # Example
+/// ```rust,no_run
+/// use wxdragon::prelude::*;
+/// let surface = OffscreenSurface::new(256, 256).expect("surface");
+/// let mut pixels = vec![0u8; surface.buffer_len()];
+/// surface.clear();
+/// surface.draw_circle(128, 128, 100);
+/// surface.read_rgba(&mut pixels, 0);
+/// ```
+pub struct OffscreenSurface {
+    ptr: *mut wxdragon_sys::wxd_OffscreenSurface_t,
+}
+
+impl OffscreenSurface {
+    /// Creates a `width` x `height` surface. Returns `None` for an empty size or if the bitmap
+    /// cannot be allocated.
+    pub fn new(width: i32, height: i32) -> Option<Self> {
+        Self::with_scale(width, height, 1.0)
+    }
+
+    /// Creates a surface of `width` x `height` logical pixels backed by `scale` times as many
+    /// physical pixels, e.g. for HiDPI exports.
+    pub fn with_scale(width: i32, height: i32, scale: f64) -> Option<Self> {
+        let ptr = unsafe { wxdragon_sys::wxd_OffscreenSurface_Create(width, height, scale) };
+        if ptr.is_null() { None } else { Some(Self { ptr }) }
+    }
+
+    /// Size of the pixel data returned by [`OffscreenSurface::read_rgba`].
+    pub fn pixel_size(&self) -> Size {
+        unsafe { wxdragon_sys::wxd_OffscreenSurface_GetPixelSize(self.ptr) }.into()
+    }
+
+    /// Bytes needed for a tightly packed RGBA copy of the surface.
+    pub fn buffer_len(&self) -> usize {
+        let size = self.pixel_size();
+        size.width.max(0) as usize * size.height.max(0) as usize * 4
+    }
+
+    /// Copies the pixels as RGBA rows of `stride` bytes (0 for tightly packed) into `dst`.
+    /// Returns false if `dst` is too small for the surface.
+    pub fn read_rgba(&self, dst: &mut [u8], stride: usize) -> bool {
+        let size = self.pixel_size();
+        let row_bytes = size.width.max(0) as usize * 4;
+        let stride = if stride == 0 { row_bytes } else { stride };
+        if stride < row_bytes || size.height <= 0 {
+            return false;
+        }
+        let needed = stride * (size.height as usize - 1) + row_bytes;
+        if dst.len() < needed {
+            return false;
+        }
+        unsafe { wxdragon_sys::wxd_OffscreenSurface_ReadRGBA(self.ptr, dst.as_mut_ptr(), stride) }
+    }
+
+    /// Returns a tightly packed RGBA copy of the surface.
+    pub fn to_rgba(&self) -> Vec<u8> {
+        let mut pixels = vec![0u8; self.buffer_len()];
+        if !self.read_rgba(&mut pixels, 0) {
+            pixels.clear();
+        }
+        pixels
+    }
+}
+
+impl DeviceContext for OffscreenSurface {
+    fn dc_ptr(&self) -> *mut wxdragon_sys::wxd_DC_t {
+        unsafe { wxdragon_sys::wxd_OffscreenSurface_GetDC(self.ptr) }
+    }
+}
+
+impl Drop for OffscreenSurface {
+    fn drop(&mut self) {
+        unsafe { wxdragon_sys::wxd_OffscreenSurface_Destroy(self.ptr) };
+    }
+}
@@ -226,6 +226,87 @@ impl Dialog {
     pub fn builder<'a>(parent: &'a dyn WxWidget, title: &str) -> DialogBuilder<'a> {
         DialogBuilder::new(parent, title)
     }
+
+    // --- Dialog Pool ---
+
+    /// Takes a dialog released under `key` out of the pool, or builds one with `create`.
+    /// The flag is true for a reused dialog. Its children and event handlers are those it had
+    /// when released, so only per-use state needs resetting.
+    ///
+    /// ```rust,no_run
+    /// # use wxdragon::prelude::*;
+    /// # fn edit(frame: &Frame) {
+    /// let (dialog, reused) = Dialog::acquire("properties", || Dialog::builder(frame, "Properties").build());
+    /// if !reused {
+    ///     // Add controls and bind handlers once.
+    /// }
+    /// dialog.show_modal();
+    /// dialog.release_to_pool("properties");
+    /// # }
+    /// ```
+    pub fn acquire<F>(key: &str, create: F) -> (Dialog, bool)
+    where
+        F: FnOnce() -> Dialog,
+    {
+        let c_key = CString::new(key).unwrap_or_default();
+        let mut slot = Some(create);
+        let mut reused = false;
+        let ptr = unsafe {
+            ffi::wxd_Dialog_Acquire(
+                c_key.as_ptr(),
+                Some(dialog_factory_trampoline::<F>),
+                &mut slot as *mut Option<F> as *mut std::os::raw::c_void,
+                &mut reused,
+            )
+        };
+        // A reused dialog keeps its handle, so copies held by its event handlers stay valid.
+        let ptr = ptr as *mut ffi::wxd_Window_t;
+        let handle = WindowHandle::from_ptr(ptr).unwrap_or_else(|| WindowHandle::new(ptr));
+        (
+            Dialog {
+                handle,
+                _marker: PhantomData,
+            },
+            reused,
+        )
+    }
+
+    /// Hides the dialog, ending its modal loop if needed, and parks it under `key` for
+    /// [`acquire`](Self::acquire) instead of destroying it. The oldest pooled dialogs beyond
+    /// [`set_pool_limits`](Self::set_pool_limits) are destroyed. Returns false if this dialog
+    /// was destroyed instead.
+    pub fn release_to_pool(&self, key: &str) -> bool {
+        let ptr = self.dialog_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        let c_key = CString::new(key).unwrap_or_default();
+        unsafe { ffi::wxd_Dialog_Release(ptr, c_key.as_ptr()) }
+    }
+
+    /// Caps pooled dialogs per key and in total (defaults 4 and 16); 0 disables pooling.
+    pub fn set_pool_limits(per_key: usize, total: usize) {
+        unsafe { ffi::wxd_Dialog_SetPoolLimits(per_key, total) }
+    }
+
+    /// Destroys the pooled dialogs of `key`, or all of them.
+    pub fn clear_pool(key: Option<&str>) {
+        let c_key = key.map(|k| CString::new(k).unwrap_or_default());
+        unsafe { ffi::wxd_Dialog_ClearPool(c_key.as_ref().map_or(std::ptr::null(), |k| k.as_ptr())) }
+    }
+
+    /// Number of pooled dialogs for `key`, or in total.
+    pub fn pooled_count(key: Option<&str>) -> usize {
+        let c_key = key.map(|k| CString::new(k).unwrap_or_default());
+        unsafe { ffi::wxd_Dialog_GetPooledCount(c_key.as_ref().map_or(std::ptr::null(), |k| k.as_ptr())) }
+    }
+}
+
+unsafe extern "C" fn dialog_factory_trampoline<F: FnOnce() -> Dialog>(
+    userdata: *mut std::os::raw::c_void,
+) -> *mut ffi::wxd_Dialog_t {
+    let slot = unsafe { &mut *(userdata as *mut Option<F>) };
+    slot.take().map_or(std::ptr::null_mut(), |create| create().as_ptr())
 }
 
 // Manual WxWidget implementation for Dialog (using WindowHandle)
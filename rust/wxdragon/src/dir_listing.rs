@@ -0,0 +1,141 @@
+//! Directories listed on a worker thread and delivered to the main thread in batches.
+//!
+//! Only names and types come back, which the file system returns without touching each file.
+//! Look up sizes, dates or icons for the rows a view actually shows, e.g. with
+//! [`std::fs::metadata`] from a virtual list's item callback.
+//!
+//! ```rust,no_run
+//! use wxdragon::prelude::*;
+//!
+//! # fn browse(dir: &str) -> Option<DirListing> {
+//! let mut names = Vec::new();
+//! DirListing::start(dir, 0, move |entries, status| {
+//!     names.extend(entries.iter().map(|e| e.name.clone()));
+//!     if status == DirListingStatus::Done {
+//!         println!("{} entries", names.len());
+//!     }
+//! })
+//! # }
+//! ```
+
+use std::ffi::{CStr, CString, c_char, c_int, c_void};
+use wxdragon_sys as ffi;
+
+bitflags::bitflags! {
+    /// What the enumeration reported about a [`DirEntry`].
+    #[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, Default)]
+    pub struct DirEntryFlags: u8 {
+        /// A directory, or a symbolic link to one.
+        const DIR = ffi::wxd_DirEntryFlags_WXD_DIR_ENTRY_DIR as u8;
+        /// Hidden attribute on Windows, a leading dot elsewhere.
+        const HIDDEN = ffi::wxd_DirEntryFlags_WXD_DIR_ENTRY_HIDDEN as u8;
+        /// A symbolic link or other reparse point.
+        const LINK = ffi::wxd_DirEntryFlags_WXD_DIR_ENTRY_LINK as u8;
+    }
+}
+
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct DirEntry {
+    pub name: String,
+    pub flags: DirEntryFlags,
+}
+
+impl DirEntry {
+    pub fn is_dir(&self) -> bool {
+        self.flags.contains(DirEntryFlags::DIR)
+    }
+}
+
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum DirListingStatus {
+    /// More batches follow.
+    More,
+    /// The last batch, possibly empty.
+    Done,
+    /// The directory could not be opened.
+    Failed,
+}
+
+/// A directory listing in progress. Dropping it cancels the listing; no callback runs after
+/// the drop.
+pub struct DirListing {
+    ptr: *mut ffi::wxd_DirListing_t,
+}
+
+impl DirListing {
+    /// Lists `dir`, calling `on_entries` on the main thread with batches of up to `batch_size`
+    /// entries (0 for the default). Partial batches are also sent while a slow directory is
+    /// still being read. Returns `None` if no application is running.
+    pub fn start<F>(dir: &str, batch_size: usize, on_entries: F) -> Option<Self>
+    where
+        F: FnMut(&[DirEntry], DirListingStatus) + 'static,
+    {
+        let c_dir = CString::new(dir).ok()?;
+        let callback: Box<dyn FnMut(&[DirEntry], DirListingStatus)> = Box::new(on_entries);
+        let userdata = Box::into_raw(Box::new(callback)) as *mut c_void;
+        let batch_size = i32::try_from(batch_size).unwrap_or(i32::MAX);
+        let ptr = unsafe {
+            ffi::wxd_DirListing_Start(
+                c_dir.as_ptr(),
+                batch_size,
+                Some(entries_trampoline),
+                userdata,
+                Some(entries_free),
+            )
+        };
+        (!ptr.is_null()).then_some(Self { ptr })
+    }
+
+    /// Whether the last batch has been delivered.
+    pub fn is_done(&self) -> bool {
+        unsafe { ffi::wxd_DirListing_IsDone(self.ptr) }
+    }
+}
+
+impl Drop for DirListing {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_DirListing_Destroy(self.ptr) };
+    }
+}
+
+type EntriesCallback = Box<dyn FnMut(&[DirEntry], DirListingStatus)>;
+
+unsafe extern "C" fn entries_trampoline(
+    userdata: *mut c_void,
+    names: *const *const c_char,
+    flags: *const u8,
+    count: c_int,
+    status: c_int,
+) {
+    if userdata.is_null() {
+        return;
+    }
+    let count = usize::try_from(count).unwrap_or(0);
+    let entries: Vec<DirEntry> = if count == 0 || names.is_null() || flags.is_null() {
+        Vec::new()
+    } else {
+        let names = unsafe { std::slice::from_raw_parts(names, count) };
+        let flags = unsafe { std::slice::from_raw_parts(flags, count) };
+        names
+            .iter()
+            .zip(flags)
+            .map(|(&name, &flags)| DirEntry {
+                name: unsafe { CStr::from_ptr(name) }.to_string_lossy().into_owned(),
+                flags: DirEntryFlags::from_bits_truncate(flags),
+            })
+            .collect()
+    };
+    let status = match status {
+        s if s == ffi::wxd_DirListingStatus_WXD_DIR_LISTING_MORE as c_int => DirListingStatus::More,
+        s if s == ffi::wxd_DirListingStatus_WXD_DIR_LISTING_DONE as c_int => DirListingStatus::Done,
+        _ => DirListingStatus::Failed,
+    };
+    let callback = unsafe { &mut *(userdata as *mut EntriesCallback) };
+    callback(&entries, status);
+}
+
+unsafe extern "C" fn entries_free(userdata: *mut c_void) {
+    if !userdata.is_null() {
+        drop(unsafe { Box::from_raw(userdata as *mut EntriesCallback) });
+    }
+}
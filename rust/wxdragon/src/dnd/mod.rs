@@ -9,7 +9,7 @@ mod droptarget;
 // mod dataobject;
 
 pub use dropsource::DropSource;
-pub use droptarget::{FileDropTarget, TextDropTarget};
+pub use droptarget::{DroppedFileFlags, DroppedFileInfo, DroppedFiles, FileDropTarget, TextDropTarget};
 // Re-export data objects from the main module
 pub use crate::data_object::{BitmapDataObject, DataObject, FileDataObject, TextDataObject};
 
@@ -0,0 +1,94 @@
+//! Pooled storage for the outer box of bound event closures.
+//!
+//! Every binding hands C++ a thin pointer to a `Box<dyn FnMut(Event)>`. Instead of a separate
+//! heap allocation per binding, those fat pointers live in fixed-size chunks and are recycled
+//! through a free list, so binding and unbinding thousands of widget handlers does not churn
+//! the allocator. Chunks are kept for reuse once allocated.
+
+use super::Event;
+use std::ffi::c_void;
+use std::mem::MaybeUninit;
+use std::sync::Mutex;
+
+type Closure = Box<dyn FnMut(Event) + 'static>;
+
+const CHUNK_LEN: usize = 256;
+
+// Only keeps the cells alive; their contents are reached through the pointers handed out.
+struct Chunk(#[allow(dead_code)] Box<[MaybeUninit<Closure>]>);
+
+// SAFETY: the pool never touches a cell's contents, it only stores chunk ownership and
+// addresses. Closures are created and dropped by the callers of `alloc` and `free`.
+unsafe impl Send for Chunk {}
+
+struct Pool {
+    chunks: Vec<Chunk>,
+    // Addresses of unused cells; stored as usize so the pool is Send.
+    free: Vec<usize>,
+}
+
+static POOL: Mutex<Pool> = Mutex::new(Pool {
+    chunks: Vec::new(),
+    free: Vec::new(),
+});
+
+/// Moves `closure` into a pooled cell and returns the cell as the closure pointer given to C++.
+pub(crate) fn alloc(closure: Closure) -> *mut c_void {
+    let cell = {
+        let mut pool = POOL.lock().unwrap_or_else(|e| e.into_inner());
+        if pool.free.is_empty() {
+            let mut chunk: Box<[MaybeUninit<Closure>]> = (0..CHUNK_LEN).map(|_| MaybeUninit::uninit()).collect();
+            // Hand out low addresses first.
+            let cells: Vec<usize> = chunk.iter_mut().rev().map(|c| c.as_mut_ptr() as usize).collect();
+            pool.free.extend(cells);
+            pool.chunks.push(Chunk(chunk));
+        }
+        pool.free.pop().expect("refilled above") as *mut Closure
+    };
+    unsafe { cell.write(closure) };
+    cell as *mut c_void
+}
+
+/// Drops the closure in `ptr` and returns its cell to the pool.
+///
+/// # Safety
+/// `ptr` must come from [`alloc`] and not have been freed.
+pub(crate) unsafe fn free(ptr: *mut c_void) {
+    let cell = ptr as *mut Closure;
+    // Dropped outside the lock: the closure's captures may bind or unbind handlers.
+    drop(unsafe { cell.read() });
+    POOL.lock().unwrap_or_else(|e| e.into_inner()).free.push(cell as usize);
+}
+
+/// [`free`] for a batch of cells, taking the pool lock once.
+///
+/// # Safety
+/// Every pointer must come from [`alloc`], appear once, and not have been freed.
+pub(crate) unsafe fn free_many(ptrs: &[*mut c_void]) {
+    for &ptr in ptrs {
+        drop(unsafe { (ptr as *mut Closure).read() });
+    }
+    let mut pool = POOL.lock().unwrap_or_else(|e| e.into_inner());
+    pool.free.extend(ptrs.iter().map(|&ptr| ptr as usize));
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::event::EventToken;
+
+    #[test]
+    fn reused_cell_gets_a_new_token() {
+        let first = alloc(Box::new(|_| {}));
+        let first_token = EventToken::next();
+        unsafe { free(first) };
+
+        let second = alloc(Box::new(|_| {}));
+        let second_token = EventToken::next();
+        // The cell usually comes straight back (other tests may take it first); the token
+        // must never repeat.
+        assert_ne!(first_token, second_token);
+        assert!(second_token.is_valid());
+        unsafe { free(second) };
+    }
+}
@@ -5,12 +5,15 @@ use crate::window::Window;
 use std::boxed::Box;
 use std::ffi::CStr;
 use std::ffi::c_void;
+use std::sync::atomic::{AtomicUsize, Ordering};
 use wxdragon_sys as ffi;
 pub mod app_events;
 pub mod button_events;
+mod closure_pool;
 pub mod event_data;
 pub mod macros;
 pub mod menu_events;
+mod paint;
 pub mod scroll_events;
 pub mod taskbar_events;
 pub mod text_events;
@@ -25,11 +28,13 @@ pub use window_events::{
     WindowEventData, WindowEvents, WindowSizeEvent,
 };
 
+pub use paint::PaintContext;
+
 // Re-export button events for easier access
 pub use button_events::{ButtonEvent, ButtonEventData, ButtonEvents};
 
 // Re-export text events for easier access
-pub use text_events::{TextEvent, TextEventData, TextEvents};
+pub use text_events::{RateLimitedTextEvents, TextEvent, TextEventData, TextEvents};
 
 // Re-export tree events for easier access
 pub use tree_events::{TreeEvent, TreeEventData, TreeEvents};
@@ -54,6 +59,18 @@ pub use app_events::AppEvents;
 // Re-export the stable C enum for use in the safe wrapper
 pub use ffi::WXDEventTypeCEnum;
 
+// --- RateLimit ---
+
+/// Delivery policy for [`WxEvtHandler::bind_rate_limited`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum RateLimit {
+    /// Deliver the newest event once no further event has arrived for this long.
+    Debounce(std::time::Duration),
+    /// Deliver at most once per interval: the first event immediately, the newest of the rest
+    /// when the interval ends.
+    Throttle(std::time::Duration),
+}
+
 // --- EventToken ---
 
 /// Unique identifier for an event binding.
@@ -91,6 +108,19 @@ impl EventToken {
 
     /// Constant representing an invalid/null token
     pub const INVALID_TOKEN: EventToken = EventToken(0);
+
+    /// A token no earlier binding has had. Tokens are not derived from the closure cell, which
+    /// the pool hands to the next binding right away, so a stale token never matches a newer
+    /// binding.
+    pub(crate) fn next() -> Self {
+        static NEXT: AtomicUsize = AtomicUsize::new(1);
+        loop {
+            let value = NEXT.fetch_add(1, Ordering::Relaxed);
+            if value != 0 {
+                return EventToken(value);
+            }
+        }
+    }
 }
 
 // --- EventType Enum ---
@@ -496,6 +526,19 @@ pub struct EventType: ffi::WXDEventTypeCEnum { // Use the generated C enum type
     const PG_COL_BEGIN_DRAG = ffi::WXDEventTypeCEnum_WXD_EVENT_TYPE_PG_COL_BEGIN_DRAG;
     const PG_COL_DRAGGING = ffi::WXDEventTypeCEnum_WXD_EVENT_TYPE_PG_COL_DRAGGING;
     const PG_COL_END_DRAG = ffi::WXDEventTypeCEnum_WXD_EVENT_TYPE_PG_COL_END_DRAG;
+    // Spatial index hover tracking
+    const SPATIAL_HOVER_CHANGED = ffi::WXDEventTypeCEnum_WXD_EVENT_TYPE_SPATIAL_HOVER_CHANGED;
+    // Coalesced file system watcher batches
+    const FS_CHANGES = ffi::WXDEventTypeCEnum_WXD_EVENT_TYPE_FS_CHANGES;
+    // Asynchronous child process output and exit
+    const PROCESS_OUTPUT = ffi::WXDEventTypeCEnum_WXD_EVENT_TYPE_PROCESS_OUTPUT;
+    const PROCESS_EXIT = ffi::WXDEventTypeCEnum_WXD_EVENT_TYPE_PROCESS_EXIT;
+    // Typed message queued from a worker thread
+    const THREAD_MESSAGE = ffi::WXDEventTypeCEnum_WXD_EVENT_TYPE_THREAD_MESSAGE;
+    // Top-level window became visible or hidden
+    const VISIBILITY_CHANGED = ffi::WXDEventTypeCEnum_WXD_EVENT_TYPE_VISIBILITY_CHANGED;
+    // Readiness of a non-blocking socket
+    const SOCKET = ffi::WXDEventTypeCEnum_WXD_EVENT_TYPE_SOCKET;
 }
 }
 
@@ -547,6 +590,66 @@ impl IdleEvent {
     }
 }
 
+// --- Event Snapshot ---
+
+/// Flat copy of the commonly used fields of an event, read with a single FFI call.
+///
+/// Obtained from [`Event::snapshot`]. Only the field groups reported by the `has_*`
+/// flags are meaningful; the others keep their defaults.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct EventSnapshot {
+    /// The event type, if it is one wxDragon knows about.
+    pub event_type: Option<EventType>,
+    /// The ID of the event.
+    pub id: i32,
+    /// True for command events; `int_value` and `checked` are valid.
+    pub has_command: bool,
+    /// True for mouse events; `position`, `buttons` and the wheel fields are valid.
+    pub has_mouse: bool,
+    /// True for key events; `position` and the key codes are valid.
+    pub has_key: bool,
+    /// True when the modifier flags are valid (mouse and key events).
+    pub has_modifiers: bool,
+    /// Mouse or key position, `(-1, -1)` otherwise.
+    pub position: Point,
+    /// Mouse buttons held down, as `ffi::WXD_MOUSE_BUTTON_*` bits.
+    pub buttons: u32,
+    pub control_down: bool,
+    pub shift_down: bool,
+    pub alt_down: bool,
+    pub meta_down: bool,
+    pub cmd_down: bool,
+    pub key_code: i32,
+    pub unicode_key: i32,
+    pub wheel_rotation: i32,
+    pub wheel_delta: i32,
+    /// 0 for the vertical wheel axis, 1 for horizontal.
+    pub wheel_axis: i32,
+    /// The integer value of a command event.
+    pub int_value: i32,
+    /// The checked state of a command event.
+    pub checked: bool,
+}
+
+impl EventSnapshot {
+    /// Returns true if the given `ffi::WXD_MOUSE_BUTTON_*` button was held down.
+    pub fn button_down(&self, button: u32) -> bool {
+        self.buttons & button != 0
+    }
+}
+
+/// One pointer position behind a motion event, from [`Event::pointer_history`].
+#[derive(Debug, Clone, Copy, PartialEq)]
+pub struct PointerSample {
+    /// Client coordinates of the window that received the event.
+    pub x: i32,
+    pub y: i32,
+    /// Milliseconds, on the same clock as the event timestamps.
+    pub timestamp_ms: i64,
+    /// Normalised pressure, or `None` if the device or platform does not report it.
+    pub pressure: Option<f32>,
+}
+
 // --- Simple Event Struct ---
 
 /// Represents a wxWidgets event.
@@ -743,6 +846,91 @@ impl Event {
         unsafe { ffi::wxd_KeyEvent_CmdDown(self.0) }
     }
 
+    /// Number of events merged into this one when it is delivered to a handler bound with
+    /// [`WxEvtHandler::bind_coalesced`] or [`WxEvtHandler::bind_rate_limited`]; 1 for every
+    /// other event.
+    pub fn coalesced_count(&self) -> i32 {
+        if self.0.is_null() {
+            return 1;
+        }
+        unsafe { ffi::wxd_Event_GetCoalescedCount(self.0) }
+    }
+
+    /// All pointer positions that make up a motion event, oldest first, read in one call.
+    ///
+    /// On Windows this includes the positions the system merged into the event since the
+    /// previous one; elsewhere, and for other events, only the event's own position is known.
+    /// For a `MOTION` handler bound with [`WxEvtHandler::bind_coalesced`] it covers every
+    /// event merged into the delivery, so strokes stay smooth at one call per frame. Empty for
+    /// events other than motion.
+    pub fn pointer_history(&self) -> Vec<PointerSample> {
+        if self.0.is_null() {
+            return Vec::new();
+        }
+        let empty = ffi::wxd_PointerSample {
+            x: 0,
+            y: 0,
+            timestamp_ms: 0,
+            pressure: -1.0,
+        };
+        let mut raw = vec![empty; 16];
+        let mut count = unsafe { ffi::wxd_MouseEvent_GetPointerHistory(self.0, raw.as_mut_ptr(), raw.len()) };
+        if count > raw.len() {
+            raw.resize(count, empty);
+            count = unsafe { ffi::wxd_MouseEvent_GetPointerHistory(self.0, raw.as_mut_ptr(), raw.len()) };
+        }
+        raw.truncate(count);
+        raw.into_iter()
+            .map(|sample| PointerSample {
+                x: sample.x,
+                y: sample.y,
+                timestamp_ms: sample.timestamp_ms,
+                pressure: (sample.pressure >= 0.0).then_some(sample.pressure),
+            })
+            .collect()
+    }
+
+    /// Reads the id, type, mouse, keyboard and command data of this event in one call.
+    ///
+    /// Handlers that need several of these values should prefer this over the individual
+    /// accessors, each of which crosses the FFI boundary and re-checks the event class.
+    pub fn snapshot(&self) -> Option<EventSnapshot> {
+        if self.0.is_null() {
+            return None;
+        }
+        let mut raw: ffi::wxd_EventSnapshot = unsafe { std::mem::zeroed() };
+        if !unsafe { ffi::wxd_Event_GetSnapshot(self.0, &mut raw) } {
+            return None;
+        }
+        #[allow(clippy::useless_conversion)]
+        let event_type = EventType::from_bits_retain(raw.event_type as WXDEventTypeCEnum);
+        Some(EventSnapshot {
+            event_type: if event_type.is_recognized() { Some(event_type) } else { None },
+            id: raw.id,
+            has_command: raw.kinds & ffi::WXD_EVENT_SNAPSHOT_COMMAND != 0,
+            has_mouse: raw.kinds & ffi::WXD_EVENT_SNAPSHOT_MOUSE != 0,
+            has_key: raw.kinds & ffi::WXD_EVENT_SNAPSHOT_KEY != 0,
+            has_modifiers: raw.kinds & ffi::WXD_EVENT_SNAPSHOT_KEYSTATE != 0,
+            position: Point {
+                x: raw.position.x,
+                y: raw.position.y,
+            },
+            buttons: raw.buttons,
+            control_down: raw.control_down,
+            shift_down: raw.shift_down,
+            alt_down: raw.alt_down,
+            meta_down: raw.meta_down,
+            cmd_down: raw.cmd_down,
+            key_code: raw.key_code,
+            unicode_key: raw.unicode_key,
+            wheel_rotation: raw.wheel_rotation,
+            wheel_delta: raw.wheel_delta,
+            wheel_axis: raw.wheel_axis,
+            int_value: raw.command_int,
+            checked: raw.checked,
+        })
+    }
+
     /// Requests more idle events to be sent.
     /// This should only be called from an idle event handler.
     /// When `need_more` is true, the system will continue sending idle events.
@@ -835,17 +1023,14 @@ pub trait WxEvtHandler {
             return EventToken::INVALID_TOKEN;
         }
 
-        // Double-box the callback to match trampoline expectations
-        let boxed_callback: Box<dyn FnMut(Event) + 'static> = Box::new(callback);
-        let double_boxed = Box::new(boxed_callback);
-        let user_data = Box::into_raw(double_boxed) as *mut c_void;
+        // Box the callback and keep the fat pointer in a pooled cell; the trampoline gets a thin pointer
+        let user_data = closure_pool::alloc(Box::new(callback));
 
         type TrampolineFn = unsafe extern "C" fn(*mut c_void, *mut c_void);
         let trampoline_ptr: TrampolineFn = rust_event_handler_trampoline;
         let trampoline_c_void = trampoline_ptr as *mut c_void;
 
-        // use the callback closure pointer as the token identifier
-        let token = EventToken::from(user_data as usize);
+        let token = EventToken::next();
 
         let et = event_type.bits();
         unsafe { ffi::wxd_EvtHandler_Bind(handler_ptr, et, trampoline_c_void, user_data, token.into()) };
@@ -853,6 +1038,104 @@ pub trait WxEvtHandler {
         token
     }
 
+    /// Binds a handler for a high-frequency event whose intermediate states can be dropped.
+    ///
+    /// Supported for mouse motion, size, mouse wheel and scroll events. Events of the same type
+    /// and id are merged natively and only the newest is delivered, once per event-loop
+    /// iteration. For wheel events the delivered rotation is the sum of the merged events, and
+    /// [`Event::coalesced_count`] reports how many events were merged. A coalesced handler runs
+    /// after the original event has been processed, so it cannot consume or veto it. Other
+    /// event types are bound normally.
+    fn bind_coalesced<F>(&self, event_type: EventType, callback: F) -> EventToken
+    where
+        F: FnMut(Event) + 'static,
+    {
+        let handler_ptr = unsafe { self.get_event_handler_ptr() };
+        if handler_ptr.is_null() {
+            return EventToken::INVALID_TOKEN;
+        }
+
+        // Box the callback and keep the fat pointer in a pooled cell; the trampoline gets a thin pointer
+        let user_data = closure_pool::alloc(Box::new(callback));
+
+        type TrampolineFn = unsafe extern "C" fn(*mut c_void, *mut c_void);
+        let trampoline_ptr: TrampolineFn = rust_event_handler_trampoline;
+        let trampoline_c_void = trampoline_ptr as *mut c_void;
+
+        let token = EventToken::next();
+
+        let et = event_type.bits();
+        unsafe { ffi::wxd_EvtHandler_BindCoalesced(handler_ptr, et, trampoline_c_void, user_data, token.into()) };
+
+        token
+    }
+
+    /// Binds a handler that sees only the newest event of a burst, as limited by `limit`.
+    ///
+    /// Meant for text-change events on search and filter inputs whose handlers start expensive
+    /// work: the rate limiting runs natively on one timer per control, so skipped keystrokes
+    /// never reach Rust. For text events the delivered event's string is the control's value at
+    /// delivery time. [`Event::coalesced_count`] reports how many events the delivery stands
+    /// for. Like [`bind_coalesced`](Self::bind_coalesced) handlers, these cannot consume or
+    /// veto the event. A zero interval binds normally.
+    fn bind_rate_limited<F>(&self, event_type: EventType, limit: RateLimit, callback: F) -> EventToken
+    where
+        F: FnMut(Event) + 'static,
+    {
+        let handler_ptr = unsafe { self.get_event_handler_ptr() };
+        if handler_ptr.is_null() {
+            return EventToken::INVALID_TOKEN;
+        }
+
+        let (mode, interval) = match limit {
+            RateLimit::Debounce(interval) => (ffi::wxd_RateLimitMode_WXD_RATE_LIMIT_DEBOUNCE, interval),
+            RateLimit::Throttle(interval) => (ffi::wxd_RateLimitMode_WXD_RATE_LIMIT_THROTTLE, interval),
+        };
+        let interval_ms = interval.as_millis().min(u32::MAX as u128) as u32;
+
+        // Box the callback and keep the fat pointer in a pooled cell; the trampoline gets a thin pointer
+        let user_data = closure_pool::alloc(Box::new(callback));
+
+        type TrampolineFn = unsafe extern "C" fn(*mut c_void, *mut c_void);
+        let trampoline_ptr: TrampolineFn = rust_event_handler_trampoline;
+        let trampoline_c_void = trampoline_ptr as *mut c_void;
+
+        let token = EventToken::next();
+
+        let et = event_type.bits();
+        unsafe {
+            ffi::wxd_EvtHandler_BindRateLimited(handler_ptr, et, mode, interval_ms, trampoline_c_void, user_data, token.into())
+        };
+
+        token
+    }
+
+    /// Binds a paint handler that gets the window's paint DC and update region ready-made.
+    ///
+    /// The DC (a buffered one with `buffered`, which also sets the paint background style) is
+    /// created natively before the first paint handler runs, and the update region is passed as
+    /// rectangles, so a repaint takes a single call into Rust. All such handlers of one paint
+    /// event share the DC; don't mix them with paint handlers that create their own `PaintDC`.
+    /// Returns [`EventToken::INVALID_TOKEN`] if this handler is not a window.
+    fn bind_paint<F>(&self, buffered: bool, callback: F) -> EventToken
+    where
+        F: FnMut(&PaintContext) + 'static,
+    {
+        let handler_ptr = unsafe { self.get_event_handler_ptr() };
+        if handler_ptr.is_null() {
+            return EventToken::INVALID_TOKEN;
+        }
+
+        let user_data = closure_pool::alloc(Box::new(paint::wrap(callback)));
+        let token = EventToken::next();
+        // On failure the closure has already been dropped natively.
+        let bound = unsafe {
+            ffi::wxd_EvtHandler_BindPaint(handler_ptr, buffered, Some(paint::paint_trampoline), user_data, token.into())
+        };
+
+        if bound { token } else { EventToken::INVALID_TOKEN }
+    }
+
     /// Unbind a specific event handler by token.
     ///
     /// Returns `true` if the handler was found and removed, `false` otherwise.
@@ -896,17 +1179,14 @@ pub trait WxEvtHandler {
             return EventToken::INVALID_TOKEN;
         }
 
-        // Double-box the callback to match trampoline expectations
-        let boxed_callback: Box<dyn FnMut(Event) + 'static> = Box::new(callback);
-        let double_boxed = Box::new(boxed_callback);
-        let user_data = Box::into_raw(double_boxed) as *mut c_void;
+        // Box the callback and keep the fat pointer in a pooled cell; the trampoline gets a thin pointer
+        let user_data = closure_pool::alloc(Box::new(callback));
 
         type TrampolineFn = unsafe extern "C" fn(*mut c_void, *mut c_void);
         let trampoline_ptr: TrampolineFn = rust_event_handler_trampoline;
         let trampoline_c_void = trampoline_ptr as *mut c_void;
 
-        // use the callback closure pointer as the token identifier
-        let token = EventToken::from(user_data as usize);
+        let token = EventToken::next();
 
         let et = event_type.bits();
         unsafe { ffi::wxd_EvtHandler_BindWithId(handler_ptr, et, id, trampoline_c_void, user_data, token.into()) };
@@ -922,7 +1202,7 @@ pub trait WxEvtHandler {
 ///
 /// # Safety
 /// This function is called from C++ code and must maintain the following invariants:
-/// - `user_data` must be a valid pointer to a `Box<Box<dyn FnMut(Event) + 'static>>`
+/// - `user_data` must be a valid pointer to a pooled `Box<dyn FnMut(Event) + 'static>` cell
 /// - `event_ptr_cvoid` must be a valid pointer to a `wxd_Event_t` object
 /// - The pointers must remain valid for the duration of this function call
 /// - This function must not be called from multiple threads simultaneously
@@ -951,15 +1231,32 @@ pub unsafe extern "C" fn rust_event_handler_trampoline(user_data: *mut c_void, e
 ///
 /// # Safety
 /// This function is called from C++ code to clean up Rust callbacks.
-/// - `ptr` must be a valid pointer to a `Box<Box<dyn FnMut(Event) + 'static>>`
+/// - `ptr` must be a valid pointer to a pooled `Box<dyn FnMut(Event) + 'static>` cell
 ///   that was previously allocated by Rust
 /// - The pointer must not be used after this function returns
 /// - This function must only be called once per pointer
 #[unsafe(no_mangle)]
 pub unsafe extern "C" fn drop_rust_event_closure_box(ptr: *mut c_void) {
     if !ptr.is_null() {
-        // Drop the Box<dyn FnMut(Event)>
+        // Drop the Box<dyn FnMut(Event)> and recycle its cell
         log::trace!("Dropping Rust event closure box at ptr: {ptr:?}");
-        let _ = unsafe { Box::from_raw(ptr as *mut Box<dyn FnMut(Event) + 'static>) };
+        unsafe { closure_pool::free(ptr) };
+    }
+}
+
+/// Function called by C++ to drop several Rust closure boxes at once, e.g. every binding of a
+/// window that is being destroyed.
+///
+/// # Safety
+/// - `ptrs` must point to `count` pointers, each satisfying the requirements of
+///   [`drop_rust_event_closure_box`] and appearing only once
+#[unsafe(no_mangle)]
+pub unsafe extern "C" fn drop_rust_event_closure_boxes(ptrs: *const *mut c_void, count: usize) {
+    if ptrs.is_null() || count == 0 {
+        return;
     }
+    log::trace!("Dropping {count} Rust event closure boxes");
+    let ptrs = unsafe { std::slice::from_raw_parts(ptrs, count) };
+    let ptrs: Vec<*mut c_void> = ptrs.iter().copied().filter(|p| !p.is_null()).collect();
+    unsafe { closure_pool::free_many(&ptrs) };
 }
@@ -0,0 +1,95 @@
+//! Paint handlers with a prebuilt device context, see [`WxEvtHandler::bind_paint`].
+//!
+//! [`WxEvtHandler::bind_paint`]: super::WxEvtHandler::bind_paint
+
+use super::{Event, rust_event_handler_trampoline};
+use crate::dc::GenericDC;
+use crate::geometry::Rect;
+use std::cell::Cell;
+use std::ffi::c_void;
+use wxdragon_sys as ffi;
+
+thread_local! {
+    // Context of the paint dispatch in progress, read by the closure `wrap` builds.
+    static CURRENT: Cell<*const ffi::wxd_PaintContext> = const { Cell::new(std::ptr::null()) };
+}
+
+/// What a paint handler draws with: the window's paint DC and the parts of the window that
+/// need repainting, as rectangles in client coordinates.
+///
+/// Valid only during the handler call; all paint handlers of one paint event share the DC.
+pub struct PaintContext<'a> {
+    event: Event,
+    dc: GenericDC,
+    update_rects: &'a [Rect],
+    bounds: Rect,
+}
+
+impl PaintContext<'_> {
+    /// The paint event itself.
+    pub fn event(&self) -> Event {
+        self.event
+    }
+
+    /// The paint DC, buffered if the handler was bound with `buffered`.
+    pub fn dc(&self) -> &GenericDC {
+        &self.dc
+    }
+
+    /// The update region, as the rectangles it is made of.
+    pub fn update_rects(&self) -> &[Rect] {
+        self.update_rects
+    }
+
+    /// Bounding box of the update region.
+    pub fn bounds(&self) -> Rect {
+        self.bounds
+    }
+
+    /// Whether `rect` overlaps the update region, to skip drawing items nobody will see.
+    pub fn is_exposed(&self, rect: Rect) -> bool {
+        self.update_rects
+            .iter()
+            .any(|r| rect.x < r.x + r.width && r.x < rect.x + rect.width && rect.y < r.y + r.height && r.y < rect.y + rect.height)
+    }
+}
+
+/// Wraps a paint handler into a plain event closure, so the binding is owned and dropped like
+/// any other.
+pub(crate) fn wrap<F>(mut callback: F) -> impl FnMut(Event) + 'static
+where
+    F: FnMut(&PaintContext) + 'static,
+{
+    move |event| {
+        let raw = CURRENT.with(Cell::get);
+        if raw.is_null() {
+            return;
+        }
+        let raw = unsafe { &*raw };
+        let update_rects = if raw.rects.is_null() || raw.rect_count == 0 {
+            &[][..]
+        } else {
+            // Rect is laid out as wxd_Rect.
+            unsafe { std::slice::from_raw_parts(raw.rects as *const Rect, raw.rect_count) }
+        };
+        let context = PaintContext {
+            event,
+            dc: unsafe { GenericDC::from_ffi_ptr_unowned(raw.dc) },
+            update_rects,
+            bounds: raw.bounds.into(),
+        };
+        callback(&context);
+    }
+}
+
+/// Called by C++ for paint bindings; `closure` is a closure built by [`wrap`].
+pub(crate) unsafe extern "C" fn paint_trampoline(
+    closure: *mut c_void,
+    event: *mut ffi::wxd_Event_t,
+    context: *const ffi::wxd_PaintContext,
+) {
+    // Painting does not nest in practice, but restoring keeps a nested dispatch harmless.
+    let previous = CURRENT.with(|current| current.replace(context));
+    unsafe { rust_event_handler_trampoline(closure, event as *mut c_void) };
+    CURRENT.with(|current| current.set(previous));
+}
@@ -1,7 +1,8 @@
 //! Event system for text input controls.
 
 use crate::event::event_data::CommandEventData;
-use crate::event::{Event, EventType};
+use crate::event::{Event, EventToken, EventType, RateLimit, WxEvtHandler};
+use std::time::Duration;
 
 /// Events specific to text input controls (TextCtrl, SearchCtrl, etc.)
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
@@ -41,3 +42,37 @@ crate::implement_category_event_handlers!(TextEvents, TextEvent, TextEventData,
     Updated => text_updated, EventType::TEXT,
     EnterPressed => enter_pressed, EventType::TEXT_ENTER
 );
+
+/// Debounced and throttled text-change handlers for every control with [`TextEvents`].
+///
+/// The callback receives the control's value at delivery as an owned `String`.
+pub trait RateLimitedTextEvents: TextEvents {
+    /// Calls `callback` once typing has paused for `quiet`.
+    fn on_text_debounced<F>(&self, quiet: Duration, callback: F) -> EventToken
+    where
+        F: FnMut(String) + 'static,
+    {
+        bind_text_rate_limited(self, RateLimit::Debounce(quiet), callback)
+    }
+
+    /// Calls `callback` at most once per `interval` while the text keeps changing, always
+    /// ending with the final value.
+    fn on_text_throttled<F>(&self, interval: Duration, callback: F) -> EventToken
+    where
+        F: FnMut(String) + 'static,
+    {
+        bind_text_rate_limited(self, RateLimit::Throttle(interval), callback)
+    }
+}
+
+impl<T: TextEvents + ?Sized> RateLimitedTextEvents for T {}
+
+fn bind_text_rate_limited<H, F>(handler: &H, limit: RateLimit, mut callback: F) -> EventToken
+where
+    H: WxEvtHandler + ?Sized,
+    F: FnMut(String) + 'static,
+{
+    handler.bind_rate_limited(EventType::TEXT, limit, move |event: Event| {
+        callback(TextEventData::new(event).get_string().unwrap_or_default());
+    })
+}
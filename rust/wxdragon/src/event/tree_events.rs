@@ -1,7 +1,7 @@
 //! Event system for tree controls.
 
 use crate::event::{Event, EventType};
-use crate::widgets::treectrl::TreeItemId;
+use crate::widgets::treectrl::{TreeItemHandle, TreeItemId};
 use std::ffi::CStr;
 use wxdragon_sys as ffi;
 
@@ -59,6 +59,22 @@ impl TreeEventData {
         unsafe { TreeItemId::from_ptr(item_ptr) }
     }
 
+    /// The affected item as a [`TreeItemHandle`], without allocating.
+    pub fn get_item_handle(&self) -> Option<TreeItemHandle> {
+        if self.event.is_null() {
+            return None;
+        }
+        TreeItemHandle::from_raw(unsafe { ffi::wxd_TreeEvent_GetItemHandle(self.event.0) })
+    }
+
+    /// The previously selected item of a selection change, as a [`TreeItemHandle`].
+    pub fn get_old_item_handle(&self) -> Option<TreeItemHandle> {
+        if self.event.is_null() {
+            return None;
+        }
+        TreeItemHandle::from_raw(unsafe { ffi::wxd_TreeEvent_GetOldItemHandle(self.event.0) })
+    }
+
     /// Get the label text for label edit events
     pub fn get_label(&self) -> Option<String> {
         if self.event.is_null() {
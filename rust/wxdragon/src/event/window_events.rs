@@ -148,6 +148,11 @@ impl MouseMotionEvent {
     pub fn get_position(&self) -> Option<crate::geometry::Point> {
         self.event.get_position()
     }
+
+    /// Every pointer position behind this event; see [`Event::pointer_history`].
+    pub fn pointer_history(&self) -> Vec<crate::event::PointerSample> {
+        self.event.event.pointer_history()
+    }
 }
 
 /// Mouse enter events
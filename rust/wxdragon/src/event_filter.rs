@@ -0,0 +1,135 @@
+//! Process-wide event filters.
+//!
+//! An [`EventFilter`] sees every event the application processes, before any window handler,
+//! without binding anything per window. The class of each event is determined natively and the
+//! closure only runs for the [`EventClass`]es it asked for, so a filter watching key presses
+//! costs nothing for paint, size or timer traffic.
+//!
+//! ```rust,no_run
+//! # use wxdragon::prelude::*;
+//! use std::cell::Cell;
+//! use std::rc::Rc;
+//! use std::time::Instant;
+//!
+//! let last_input = Rc::new(Cell::new(Instant::now()));
+//! let seen = last_input.clone();
+//! let _filter = EventFilter::new(EventClass::INPUT, move |_event, _class| {
+//!     seen.set(Instant::now());
+//!     FilterResult::Skip
+//! });
+//! ```
+
+use crate::event::Event;
+use std::ffi::c_void;
+use std::marker::PhantomData;
+use std::rc::Rc;
+use wxdragon_sys as ffi;
+
+bitflags::bitflags! {
+    /// Event classes an [`EventFilter`] is called for.
+    #[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+    pub struct EventClass: u32 {
+        /// Key down/up, char and char hook.
+        const KEY = ffi::wxd_EventFilterClass_WXD_EVENT_FILTER_KEY as u32;
+        /// Mouse button down/up and double-click.
+        const MOUSE_BUTTON = ffi::wxd_EventFilterClass_WXD_EVENT_FILTER_MOUSE_BUTTON as u32;
+        /// Mouse motion and entering or leaving a window.
+        const MOUSE_MOTION = ffi::wxd_EventFilterClass_WXD_EVENT_FILTER_MOUSE_MOTION as u32;
+        const MOUSE_WHEEL = ffi::wxd_EventFilterClass_WXD_EVENT_FILTER_MOUSE_WHEEL as u32;
+        /// Focus changes and window/app activation.
+        const FOCUS = ffi::wxd_EventFilterClass_WXD_EVENT_FILTER_FOCUS as u32;
+        /// Any command event: menus, buttons, text changes and so on.
+        const COMMAND = ffi::wxd_EventFilterClass_WXD_EVENT_FILTER_COMMAND as u32;
+        /// Paint and erase background.
+        const PAINT = ffi::wxd_EventFilterClass_WXD_EVENT_FILTER_PAINT as u32;
+        /// Size and move.
+        const LAYOUT = ffi::wxd_EventFilterClass_WXD_EVENT_FILTER_LAYOUT as u32;
+        const TIMER = ffi::wxd_EventFilterClass_WXD_EVENT_FILTER_TIMER as u32;
+        /// Everything not covered by another class.
+        const OTHER = ffi::wxd_EventFilterClass_WXD_EVENT_FILTER_OTHER as u32;
+
+        /// Direct user input: keys and all mouse events.
+        const INPUT = Self::KEY.bits() | Self::MOUSE_BUTTON.bits() | Self::MOUSE_MOTION.bits() | Self::MOUSE_WHEEL.bits();
+    }
+}
+
+impl EventClass {
+    /// The class `event` belongs to.
+    pub fn of(event: &Event) -> Self {
+        Self::from_bits_truncate(unsafe { ffi::wxd_Event_GetFilterClass(event.0) })
+    }
+}
+
+/// What an [`EventFilter`] decided about an event.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum FilterResult {
+    /// Process the event normally (and let older filters see it).
+    Skip,
+    /// Drop the event without processing it.
+    Ignore,
+    /// Treat the event as handled without running its handlers.
+    Processed,
+}
+
+type FilterFn = Box<dyn FnMut(&Event, EventClass) -> FilterResult + 'static>;
+
+/// A process-wide event filter, uninstalled when dropped.
+///
+/// Filters run on the main thread, newest first; the first one not returning
+/// [`FilterResult::Skip`] decides the event's fate. Keep the work in the closure short: it runs
+/// for every event of the requested classes anywhere in the application.
+pub struct EventFilter {
+    ptr: *mut ffi::wxd_EventFilter_t,
+    _nosend_nosync: PhantomData<Rc<()>>,
+}
+
+impl EventFilter {
+    /// Installs `callback` for the events in `classes`.
+    pub fn new<F>(classes: EventClass, callback: F) -> Self
+    where
+        F: FnMut(&Event, EventClass) -> FilterResult + 'static,
+    {
+        let boxed: Box<FilterFn> = Box::new(Box::new(callback));
+        let user_data = Box::into_raw(boxed) as *mut c_void;
+        let ptr = unsafe { ffi::wxd_App_AddEventFilter(Some(filter_trampoline), classes.bits(), user_data, Some(free_filter)) };
+        assert!(!ptr.is_null(), "Failed to install event filter");
+        Self {
+            ptr,
+            _nosend_nosync: PhantomData,
+        }
+    }
+
+    /// Changes the classes the filter is called for; empty pauses it without uninstalling.
+    pub fn set_classes(&self, classes: EventClass) {
+        unsafe { ffi::wxd_EventFilter_SetClassMask(self.ptr, classes.bits()) };
+    }
+}
+
+impl Drop for EventFilter {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_App_RemoveEventFilter(self.ptr) };
+    }
+}
+
+extern "C" fn filter_trampoline(user_data: *mut c_void, event: *mut ffi::wxd_Event_t, class: u32) -> i32 {
+    if user_data.is_null() || event.is_null() {
+        return ffi::wxd_EventFilterResult_WXD_EVENT_FILTER_RESULT_SKIP as i32;
+    }
+    let callback = unsafe { &mut *(user_data as *mut FilterFn) };
+    let event = unsafe { Event::from_ptr(event) };
+    let result = std::panic::catch_unwind(std::panic::AssertUnwindSafe(|| {
+        callback(&event, EventClass::from_bits_truncate(class))
+    }))
+    .unwrap_or(FilterResult::Skip);
+    match result {
+        FilterResult::Skip => ffi::wxd_EventFilterResult_WXD_EVENT_FILTER_RESULT_SKIP as i32,
+        FilterResult::Ignore => ffi::wxd_EventFilterResult_WXD_EVENT_FILTER_RESULT_IGNORE as i32,
+        FilterResult::Processed => ffi::wxd_EventFilterResult_WXD_EVENT_FILTER_RESULT_PROCESSED as i32,
+    }
+}
+
+extern "C" fn free_filter(user_data: *mut c_void) {
+    if !user_data.is_null() {
+        drop(unsafe { Box::from_raw(user_data as *mut FilterFn) });
+    }
+}
@@ -112,6 +112,20 @@ impl Font {
         }
     }
 
+    /// Like [`new_with_details`](Self::new_with_details), but shares the native font with every
+    /// other font created from the same description through this call, so code that builds fonts
+    /// per paint does not create a native font each time. Modifying the returned font detaches a
+    /// private copy; the shared one is unaffected.
+    pub fn new_cached(point_size: i32, family: i32, style: i32, weight: i32, underlined: bool, face_name: &str) -> Option<Self> {
+        let c_face_name = std::ffi::CString::new(face_name).ok()?;
+        let ptr = unsafe { ffi::wxd_Font_CreateCached(point_size, family, style, weight, underlined, c_face_name.as_ptr()) };
+        if ptr.is_null() {
+            None
+        } else {
+            Some(Self { ptr, owned: true })
+        }
+    }
+
     /// Create a Font wrapper from a raw pointer.
     /// # Safety
     /// The pointer must be a valid pointer to a wxFont.
@@ -341,9 +355,19 @@ impl FontBuilder {
     }
 
     pub fn build(self) -> Option<Font> {
+        self.build_with(Font::new_with_details)
+    }
+
+    /// Like [`build`](Self::build), but returns a font sharing its native object with other
+    /// cached fonts of the same description; see [`Font::new_cached`].
+    pub fn build_cached(self) -> Option<Font> {
+        self.build_with(Font::new_cached)
+    }
+
+    fn build_with(self, create: fn(i32, i32, i32, i32, bool, &str) -> Option<Font>) -> Option<Font> {
         let point_size = if self.point_size == 0 { 10 } else { self.point_size };
 
-        let mut font = Font::new_with_details(
+        let mut font = create(
             point_size as c_int,
             self.family.as_i32(), // Convert enum to i32
             self.style.as_i32(),  // Convert enum to i32
@@ -359,3 +383,10 @@ impl FontBuilder {
         font
     }
 }
+
+/// Releases cached fonts and cursors (see [`Font::new_cached`] and
+/// [`Cursor::from_bitmap_cached`](crate::cursor::Cursor::from_bitmap_cached)) that no live handle
+/// uses any more, returning how many were dropped. The caches also prune themselves as they grow.
+pub fn purge_object_caches() -> usize {
+    unsafe { ffi::wxd_ObjectCache_Purge() }
+}
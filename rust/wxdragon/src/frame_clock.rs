@@ -0,0 +1,136 @@
+//! Display-paced animation frames.
+//!
+//! A [`FrameClock`] calls back once per display frame with a precise timestamp, driven by the
+//! display where the platform exposes it (CVDisplayLink on macOS, the window's GdkFrameClock on
+//! GTK) and by a drift-free timer elsewhere, with the system timer resolution raised to 1 ms on
+//! Windows while it runs. Refreshes queued with [`WxWidget::schedule_refresh`] during the
+//! callback are painted in the same frame.
+//!
+//! ```rust,no_run
+//! use wxdragon::frame_clock::FrameClock;
+//! use wxdragon::prelude::*;
+//!
+//! fn animate(canvas: &Panel) -> FrameClock {
+//!     let target = *canvas;
+//!     let clock = FrameClock::new(canvas, move |frame| {
+//!         // Advance the animation to `frame.timestamp`, then repaint in this frame.
+//!         let _t = frame.timestamp.as_secs_f64();
+//!         target.schedule_refresh(None);
+//!     });
+//!     clock.start();
+//!     clock // keep it alive while animating
+//! }
+//! ```
+
+use crate::window::WxWidget;
+use std::os::raw::c_void;
+use std::panic::{self, AssertUnwindSafe};
+use std::time::Duration;
+use wxdragon_sys as ffi;
+
+/// One display frame, passed to the [`FrameClock`] callback.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct FrameInfo {
+    /// Frame time on a monotonic clock with an unspecified origin; only differences matter.
+    pub timestamp: Duration,
+    /// Current display refresh interval.
+    pub interval: Duration,
+    /// Frames delivered since the clock was created, starting at 0.
+    pub frame: u64,
+    /// Frames missed since the previous callback, e.g. because the main thread was busy.
+    pub dropped: u32,
+}
+
+type FrameCallback = Box<dyn FnMut(&FrameInfo)>;
+
+/// Per-frame callbacks paced by the display. Stops by itself when its window is destroyed and
+/// releases the callback when dropped.
+pub struct FrameClock {
+    ptr: *mut ffi::wxd_FrameClock_t,
+}
+
+impl FrameClock {
+    /// Creates a stopped clock for `window`. The callback runs on the main thread; it may stop
+    /// and restart the clock.
+    pub fn new<W, F>(window: &W, callback: F) -> Self
+    where
+        W: WxWidget + ?Sized,
+        F: FnMut(&FrameInfo) + 'static,
+    {
+        let window_ptr = window.handle_ptr();
+        if window_ptr.is_null() {
+            return Self {
+                ptr: std::ptr::null_mut(),
+            };
+        }
+        let raw = Box::into_raw(Box::new(Box::new(callback) as FrameCallback));
+        let ptr = unsafe {
+            ffi::wxd_FrameClock_Create(
+                window_ptr,
+                Some(frame_clock_tick),
+                raw as *mut c_void,
+                Some(frame_clock_drop_callback),
+            )
+        };
+        if ptr.is_null() {
+            unsafe { drop(Box::from_raw(raw)) };
+        }
+        Self { ptr }
+    }
+
+    /// Starts delivering frames. Returns false if the window is gone.
+    pub fn start(&self) -> bool {
+        !self.ptr.is_null() && unsafe { ffi::wxd_FrameClock_Start(self.ptr) }
+    }
+
+    /// Stops delivering frames; the next `start` does not report the pause as dropped frames.
+    pub fn stop(&self) {
+        if !self.ptr.is_null() {
+            unsafe { ffi::wxd_FrameClock_Stop(self.ptr) };
+        }
+    }
+
+    /// Whether frames are being delivered.
+    pub fn is_running(&self) -> bool {
+        !self.ptr.is_null() && unsafe { ffi::wxd_FrameClock_IsRunning(self.ptr) }
+    }
+
+    /// Refresh interval of the display showing the window.
+    pub fn refresh_interval(&self) -> Duration {
+        let us = if self.ptr.is_null() {
+            0
+        } else {
+            unsafe { ffi::wxd_FrameClock_GetRefreshInterval(self.ptr) }
+        };
+        Duration::from_micros(us.max(0) as u64)
+    }
+}
+
+impl Drop for FrameClock {
+    fn drop(&mut self) {
+        if !self.ptr.is_null() {
+            unsafe { ffi::wxd_FrameClock_Destroy(self.ptr) };
+        }
+    }
+}
+
+unsafe extern "C" fn frame_clock_tick(user_data: *mut c_void, info: *const ffi::wxd_FrameInfo) {
+    if user_data.is_null() || info.is_null() {
+        return;
+    }
+    let callback = unsafe { &mut *(user_data as *mut FrameCallback) };
+    let raw = unsafe { &*info };
+    let frame = FrameInfo {
+        timestamp: Duration::from_micros(raw.timestamp_us.max(0) as u64),
+        interval: Duration::from_micros(raw.interval_us.max(0) as u64),
+        frame: raw.frame,
+        dropped: raw.dropped,
+    };
+    let _ = panic::catch_unwind(AssertUnwindSafe(|| callback(&frame)));
+}
+
+unsafe extern "C" fn frame_clock_drop_callback(user_data: *mut c_void) {
+    if !user_data.is_null() {
+        unsafe { drop(Box::from_raw(user_data as *mut FrameCallback)) };
+    }
+}
@@ -0,0 +1,167 @@
+//! Coalescing file system watcher.
+
+use crate::event::{Event, EventToken, EventType, WxEvtHandler};
+use crate::utils::ArrayString;
+use std::ffi::CString;
+use std::marker::PhantomData;
+use std::path::{Path, PathBuf};
+use std::rc::Rc;
+use std::time::Duration;
+use wxdragon_sys as ffi;
+
+bitflags::bitflags! {
+    /// The kinds of change reported for a path in a [`FileSystemChangesEvent`]. A path that
+    /// changed several times during one batch carries all of them.
+    #[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+    pub struct FileChange: i32 {
+        const CREATE = ffi::wxd_FileSystemChange_WXD_FS_CHANGE_CREATE as i32;
+        const DELETE = ffi::wxd_FileSystemChange_WXD_FS_CHANGE_DELETE as i32;
+        /// Set on both the old and the new path of a rename.
+        const RENAME = ffi::wxd_FileSystemChange_WXD_FS_CHANGE_RENAME as i32;
+        const MODIFY = ffi::wxd_FileSystemChange_WXD_FS_CHANGE_MODIFY as i32;
+        const ACCESS = ffi::wxd_FileSystemChange_WXD_FS_CHANGE_ACCESS as i32;
+        const ATTRIB = ffi::wxd_FileSystemChange_WXD_FS_CHANGE_ATTRIB as i32;
+    }
+}
+
+/// Watches files and directories and reports changes in batches.
+///
+/// Native notifications are merged per path over a batch window that opens with the first
+/// change. When it closes, the target handler receives a single [`FileSystemChangesEvent`]
+/// listing every changed path once, so a save, checkout or build that touches hundreds of files
+/// costs one callback instead of one per notification.
+///
+/// Create the watcher on the main thread once the event loop is running.
+///
+/// # Example
+/// ```rust,no_run
+/// use std::time::Duration;
+/// use wxdragon::prelude::*;
+/// # let frame = Frame::builder().build();
+/// let watcher = FileSystemWatcher::new(&frame, Duration::from_millis(200)).expect("no fswatcher");
+/// watcher.add("/tmp/project", true);
+/// FileSystemWatcher::on_changes(&frame, |event| {
+///     for (path, kinds) in event.changes() {
+///         println!("{kinds:?} {}", path.display());
+///     }
+/// });
+/// ```
+pub struct FileSystemWatcher {
+    ptr: *mut ffi::wxd_FileSystemWatcher_t,
+    // Owns native objects living on the GUI thread.
+    _nosend_nosync: PhantomData<Rc<()>>,
+}
+
+impl FileSystemWatcher {
+    /// Creates a watcher that sends its batches to `target`, using a batch window of `batch`.
+    /// Returns `None` if file system watching is not available in this build.
+    pub fn new<T: WxEvtHandler>(target: &T, batch: Duration) -> Option<Self> {
+        let handler = unsafe { target.get_event_handler_ptr() };
+        if handler.is_null() {
+            return None;
+        }
+        let ptr = unsafe { ffi::wxd_FileSystemWatcher_Create(handler, duration_ms(batch)) };
+        (!ptr.is_null()).then_some(Self {
+            ptr,
+            _nosend_nosync: PhantomData,
+        })
+    }
+
+    /// Changes the batch window. A zero duration delivers changes on the next event loop
+    /// iteration, still merged with those that arrived in the same iteration.
+    pub fn set_batch_interval(&self, batch: Duration) {
+        unsafe { ffi::wxd_FileSystemWatcher_SetBatchInterval(self.ptr, duration_ms(batch)) }
+    }
+
+    /// Watches a file or directory; with `recursive`, the whole tree below a directory.
+    pub fn add(&self, path: impl AsRef<Path>, recursive: bool) -> bool {
+        self.add_filtered(path, "", recursive)
+    }
+
+    /// Like [`add`](Self::add), reporting only files matching `filespec` (e.g. `"*.rs"`).
+    pub fn add_filtered(&self, path: impl AsRef<Path>, filespec: &str, recursive: bool) -> bool {
+        let (Some(path), Ok(filespec)) = (path_cstring(path.as_ref()), CString::new(filespec)) else {
+            return false;
+        };
+        unsafe { ffi::wxd_FileSystemWatcher_Add(self.ptr, path.as_ptr(), recursive, filespec.as_ptr()) }
+    }
+
+    /// Stops watching a path added with the same `recursive` flag.
+    pub fn remove(&self, path: impl AsRef<Path>, recursive: bool) -> bool {
+        let Some(path) = path_cstring(path.as_ref()) else {
+            return false;
+        };
+        unsafe { ffi::wxd_FileSystemWatcher_Remove(self.ptr, path.as_ptr(), recursive) }
+    }
+
+    pub fn remove_all(&self) {
+        unsafe { ffi::wxd_FileSystemWatcher_RemoveAll(self.ptr) }
+    }
+
+    /// Delivers the pending batch now instead of waiting for the window to close.
+    pub fn flush(&self) {
+        unsafe { ffi::wxd_FileSystemWatcher_Flush(self.ptr) }
+    }
+
+    /// Binds `callback` to the change batches sent to `target`.
+    pub fn on_changes<W, F>(target: &W, mut callback: F) -> EventToken
+    where
+        W: WxEvtHandler,
+        F: FnMut(FileSystemChangesEvent) + 'static,
+    {
+        target.bind_internal(EventType::FS_CHANGES, move |event| {
+            callback(FileSystemChangesEvent::new(event))
+        })
+    }
+}
+
+impl Drop for FileSystemWatcher {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_FileSystemWatcher_Destroy(self.ptr) };
+    }
+}
+
+fn duration_ms(duration: Duration) -> i32 {
+    duration.as_millis().min(i32::MAX as u128) as i32
+}
+
+fn path_cstring(path: &Path) -> Option<CString> {
+    CString::new(path.to_str()?).ok()
+}
+
+/// Event data for [`FileSystemWatcher::on_changes`].
+#[derive(Debug)]
+pub struct FileSystemChangesEvent {
+    /// The base event.
+    pub event: Event,
+}
+
+impl FileSystemChangesEvent {
+    /// Creates a new `FileSystemChangesEvent` from a base `Event`.
+    pub fn new(event: Event) -> Self {
+        Self { event }
+    }
+
+    /// The changed paths in order of their first change, each with every kind of change seen
+    /// during the batch.
+    pub fn changes(&self) -> Vec<(PathBuf, FileChange)> {
+        let ptr = self.event._as_ptr();
+        let mut paths = ArrayString::new();
+        let count = unsafe { ffi::wxd_FileSystemChangesEvent_GetPaths(ptr, paths.as_mut_ptr()) };
+        let mut kinds = vec![0i32; count];
+        let written = unsafe { ffi::wxd_FileSystemChangesEvent_GetChanges(ptr, kinds.as_mut_ptr(), count) };
+        kinds.truncate(written);
+        paths
+            .get_strings()
+            .into_iter()
+            .zip(kinds)
+            .map(|(path, kind)| (PathBuf::from(path), FileChange::from_bits_truncate(kind)))
+            .collect()
+    }
+
+    /// True if the native watcher lost events during the batch (for example on a queue
+    /// overflow); the watched trees should then be rescanned.
+    pub fn overflowed(&self) -> bool {
+        unsafe { ffi::wxd_FileSystemChangesEvent_HasOverflowed(self.event._as_ptr()) }
+    }
+}
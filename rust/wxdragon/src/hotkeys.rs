@@ -0,0 +1,119 @@
+//! Native keyboard shortcut table.
+//!
+//! A [`HotkeyTable`] maps key combinations to command ids in a hash table on the native side.
+//! Attached to a window with [`HotkeyTable::attach`], it is looked up for every key press before
+//! anything reaches Rust: a registered shortcut sends a single `MENU` command event with its id,
+//! handled like a menu item with `on_menu`, and every other key continues as a normal key event.
+//! This replaces matching combos in `KEY_DOWN` / `CHAR_HOOK` closures.
+//!
+//! ```rust,no_run
+//! # use wxdragon::prelude::*;
+//! # let frame = Frame::builder().build();
+//! const ID_SAVE: i32 = 1001;
+//! let hotkeys = HotkeyTable::new();
+//! hotkeys.set(KeyModifier::CONTROL, 'S' as i32, ID_SAVE);
+//! hotkeys.attach(&frame);
+//! frame.on_menu(|event| {
+//!     if event.get_id() == ID_SAVE {
+//!         println!("save");
+//!     }
+//! });
+//! ```
+
+use crate::id::{ID_NONE, Id};
+use crate::uiactionsimulator::KeyModifier;
+use crate::window::WxWidget;
+use std::marker::PhantomData;
+use std::rc::Rc;
+use wxdragon_sys as ffi;
+
+/// Key combinations and the command ids they fire. Letter keys match regardless of case (use
+/// [`KeyModifier::SHIFT`] to require Shift) and other keys use the `KEY_*` key codes of key
+/// events. Windows keep the table alive while attached, and changes apply to them immediately.
+pub struct HotkeyTable {
+    ptr: *mut ffi::wxd_HotkeyTable_t,
+    // Shared with windows on the GUI thread.
+    _nosend_nosync: PhantomData<Rc<()>>,
+}
+
+impl HotkeyTable {
+    pub fn new() -> Self {
+        let ptr = unsafe { ffi::wxd_HotkeyTable_Create() };
+        assert!(!ptr.is_null(), "Failed to create HotkeyTable");
+        Self {
+            ptr,
+            _nosend_nosync: PhantomData,
+        }
+    }
+
+    /// Maps the combination to `command_id`, replacing any previous mapping.
+    pub fn set(&self, modifiers: KeyModifier, key_code: i32, command_id: Id) {
+        unsafe { ffi::wxd_HotkeyTable_Set(self.ptr, modifiers.to_raw(), key_code, command_id) };
+    }
+
+    /// Adds many `(modifiers, key code, command id)` shortcuts in one call.
+    pub fn set_many(&self, entries: &[(KeyModifier, i32, Id)]) {
+        if entries.is_empty() {
+            return;
+        }
+        let flat: Vec<i32> = entries
+            .iter()
+            .flat_map(|&(modifiers, key_code, id)| [modifiers.to_raw(), key_code, id])
+            .collect();
+        unsafe { ffi::wxd_HotkeyTable_SetMany(self.ptr, flat.as_ptr(), entries.len()) };
+    }
+
+    /// Removes the combination; returns false if it was not registered.
+    pub fn remove(&self, modifiers: KeyModifier, key_code: i32) -> bool {
+        unsafe { ffi::wxd_HotkeyTable_Remove(self.ptr, modifiers.to_raw(), key_code) }
+    }
+
+    pub fn clear(&self) {
+        unsafe { ffi::wxd_HotkeyTable_Clear(self.ptr) };
+    }
+
+    pub fn len(&self) -> usize {
+        unsafe { ffi::wxd_HotkeyTable_GetCount(self.ptr) }
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    /// The command id registered for the combination.
+    pub fn lookup(&self, modifiers: KeyModifier, key_code: i32) -> Option<Id> {
+        let id = unsafe { ffi::wxd_HotkeyTable_Lookup(self.ptr, modifiers.to_raw(), key_code) };
+        (id != ID_NONE).then_some(id)
+    }
+
+    /// Dispatches the key presses of `window` and its children through this table, replacing a
+    /// table attached before. Attach to the frame to make shortcuts work application-wide.
+    pub fn attach<W: WxWidget>(&self, window: &W) {
+        unsafe { ffi::wxd_Window_SetHotkeyTable(window.handle_ptr(), self.ptr) };
+    }
+
+    /// Stops dispatching the key presses of `window` through its hotkey table.
+    pub fn detach<W: WxWidget>(window: &W) {
+        unsafe { ffi::wxd_Window_SetHotkeyTable(window.handle_ptr(), std::ptr::null_mut()) };
+    }
+
+    /// Installs the current shortcuts as the window's native accelerator table instead of
+    /// attaching the table, letting the platform send the command events. Later changes are not
+    /// picked up until installed again, and [`KeyModifier::META`] combinations are left out.
+    /// Returns the number of accelerators installed.
+    pub fn install_accelerators<W: WxWidget>(&self, window: &W) -> usize {
+        unsafe { ffi::wxd_HotkeyTable_InstallAccelerators(self.ptr, window.handle_ptr()) }
+    }
+}
+
+impl Default for HotkeyTable {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl Drop for HotkeyTable {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_HotkeyTable_Destroy(self.ptr) };
+    }
+}
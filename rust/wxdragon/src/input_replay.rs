@@ -0,0 +1,158 @@
+//! Recording and replaying user input for reproducible performance measurements.
+//!
+//! The recorder logs every mouse and keyboard event with its timing and the path of the target
+//! window (window names and sibling indices from the top-level window down) into a compact
+//! binary blob. Replaying it later, against the same UI, injects the same input at the original
+//! pace or as fast as the event loop takes it, optionally while the event-loop
+//! [trace](crate::trace) and the window paint timings record, so a slowdown reported from the
+//! field can be measured before and after a fix.
+//!
+//! ```rust,no_run
+//! use wxdragon::input_replay::{self, ReplayMode};
+//!
+//! // In the user's session:
+//! input_replay::start_recording();
+//! // ... later ...
+//! input_replay::stop_recording();
+//! input_replay::save_recording("session.wxdinput").unwrap();
+//!
+//! // In the lab, once the same windows are open:
+//! let data = std::fs::read("session.wxdinput").unwrap();
+//! input_replay::replay(&data, ReplayMode::Direct, 1.0, true, |stats| {
+//!     println!("{} events, worst lag {} us", stats.events, stats.max_lag_us);
+//!     wxdragon::trace::save_chrome_json("replay.json").unwrap();
+//! });
+//! ```
+//!
+//! Windows are found again by name, so give the windows that receive input stable names.
+
+use std::ffi::c_void;
+use std::path::Path;
+use wxdragon_sys as ffi;
+
+/// How a replay delivers events.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, Default)]
+pub enum ReplayMode {
+    /// Events are built and sent straight to the target window's handler. Deterministic and
+    /// independent of focus and pointer position.
+    #[default]
+    Direct,
+    /// Native input through `wxUIActionSimulator`, which also exercises the platform's input
+    /// path. Moves the real pointer; the application must be in front.
+    Simulated,
+}
+
+/// Outcome of a replay.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub struct ReplayStats {
+    pub events: u32,
+    /// Events whose window could not be found, plus malformed records.
+    pub skipped: u32,
+    /// Microseconds from the start to the last event.
+    pub elapsed_us: i64,
+    /// Worst delay, in microseconds, between an event's due time and its injection; with a
+    /// paced replay this is how far the event loop fell behind the recorded input.
+    pub max_lag_us: i64,
+    pub total_lag_us: i64,
+    pub cancelled: bool,
+}
+
+/// Starts recording input, discarding the previous recording.
+pub fn start_recording() {
+    unsafe { ffi::wxd_InputRecorder_Start() }
+}
+
+pub fn stop_recording() {
+    unsafe { ffi::wxd_InputRecorder_Stop() }
+}
+
+pub fn is_recording() -> bool {
+    unsafe { ffi::wxd_InputRecorder_IsRecording() }
+}
+
+/// The current (or, after [`stop_recording`], the last) recording.
+pub fn recording() -> Vec<u8> {
+    loop {
+        let len = unsafe { ffi::wxd_InputRecorder_GetData(std::ptr::null_mut(), 0) };
+        let mut buf = vec![0u8; len];
+        let full = unsafe { ffi::wxd_InputRecorder_GetData(buf.as_mut_ptr(), buf.len()) };
+        // A live recording may have grown between the two calls.
+        if full <= len {
+            buf.truncate(full);
+            return buf;
+        }
+    }
+}
+
+/// Writes [`recording`] to `path`.
+pub fn save_recording(path: impl AsRef<Path>) -> std::io::Result<()> {
+    std::fs::write(path, recording())
+}
+
+/// Replays `data` from [`recording`]. `speed` scales the recorded timing (`2.0` is twice as
+/// fast); `0.0` injects each event once the previous one was handled and the loop has run. With
+/// `collect_timings`, the [trace](crate::trace) and the window timings are reset and record for
+/// the duration of the replay. `on_done` runs on the main thread at the end, or when the replay
+/// is cancelled or replaced. Returns false if `data` is not a recording or the simulated mode is
+/// unavailable.
+pub fn replay<F>(data: &[u8], mode: ReplayMode, speed: f64, collect_timings: bool, on_done: F) -> bool
+where
+    F: FnOnce(ReplayStats) + 'static,
+{
+    let raw_mode = match mode {
+        ReplayMode::Direct => ffi::wxd_InputReplayMode_WXD_INPUT_REPLAY_DIRECT,
+        ReplayMode::Simulated => ffi::wxd_InputReplayMode_WXD_INPUT_REPLAY_SIMULATED,
+    };
+    let callback: Box<Option<Box<dyn FnOnce(ReplayStats)>>> = Box::new(Some(Box::new(on_done)));
+    let user_data = Box::into_raw(callback) as *mut c_void;
+    let ok = unsafe {
+        ffi::wxd_InputReplay_Start(
+            data.as_ptr(),
+            data.len(),
+            raw_mode,
+            speed,
+            collect_timings,
+            Some(replay_done_trampoline),
+            user_data,
+            Some(replay_done_free),
+        )
+    };
+    if !ok {
+        unsafe { replay_done_free(user_data) };
+    }
+    ok
+}
+
+/// Stops a running replay; its `on_done` still runs, with `cancelled` set.
+pub fn cancel_replay() {
+    unsafe { ffi::wxd_InputReplay_Cancel() }
+}
+
+pub fn is_replaying() -> bool {
+    unsafe { ffi::wxd_InputReplay_IsRunning() }
+}
+
+unsafe extern "C" fn replay_done_trampoline(user_data: *mut c_void, stats: *const ffi::wxd_InputReplayStats) {
+    if user_data.is_null() || stats.is_null() {
+        return;
+    }
+    let stats = unsafe { &*stats };
+    let stats = ReplayStats {
+        events: stats.events,
+        skipped: stats.skipped,
+        elapsed_us: stats.elapsed_us,
+        max_lag_us: stats.max_lag_us,
+        total_lag_us: stats.total_lag_us,
+        cancelled: stats.cancelled,
+    };
+    let callback = unsafe { &mut *(user_data as *mut Option<Box<dyn FnOnce(ReplayStats)>>) };
+    if let Some(callback) = callback.take() {
+        callback(stats);
+    }
+}
+
+unsafe extern "C" fn replay_done_free(user_data: *mut c_void) {
+    if !user_data.is_null() {
+        drop(unsafe { Box::from_raw(user_data as *mut Option<Box<dyn FnOnce(ReplayStats)>>) });
+    }
+}
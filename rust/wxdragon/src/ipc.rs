@@ -5,7 +5,8 @@
 //! - **Windows**: Uses DDE (Dynamic Data Exchange), which is OS-native and does not
 //!   trigger firewall prompts.
 //! - **Unix/macOS**: Uses TCP sockets. Unix domain sockets are also supported when a
-//!   file path is passed as the service name instead of a port number.
+//!   file path is passed as the service name instead of a port number, or for any name
+//!   with [`IPCTransport::Local`], which avoids the TCP stack for same-machine peers.
 //!
 //! # Overview
 //!
@@ -41,6 +42,7 @@
 use std::ffi::{CStr, CString};
 use std::os::raw::c_void;
 use std::ptr;
+use std::time::Duration;
 use wxdragon_sys as ffi;
 
 /// IPC data format for Execute, Request, Poke, and Advise operations.
@@ -88,6 +90,152 @@ impl From<IPCFormat> for ffi::wxd_IPCFormat {
     }
 }
 
+/// How a service name maps to an endpoint. Server and client must use the same one.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub enum IPCTransport {
+    /// DDE on Windows; on Unix a TCP port, or a Unix domain socket for a name containing `/`.
+    #[default]
+    Default,
+    /// Same-machine only. On Unix a Unix domain socket, with a bare name placed in the
+    /// user's runtime directory; on Windows DDE, which is already local.
+    Local,
+}
+
+impl From<IPCTransport> for ffi::wxd_IPCTransport {
+    fn from(transport: IPCTransport) -> Self {
+        match transport {
+            IPCTransport::Default => ffi::wxd_IPCTransport_WXD_IPC_TRANSPORT_DEFAULT,
+            IPCTransport::Local => ffi::wxd_IPCTransport_WXD_IPC_TRANSPORT_LOCAL,
+        }
+    }
+}
+
+impl IPCTransport {
+    /// The endpoint `service` maps to, e.g. the socket path of a local service.
+    pub fn resolve(self, service: &str) -> String {
+        let Ok(c_service) = CString::new(service) else {
+            return service.to_string();
+        };
+        let len = unsafe { ffi::wxd_IPC_ResolveService(c_service.as_ptr(), self.into(), ptr::null_mut(), 0) };
+        let mut buffer = vec![0u8; len + 1];
+        unsafe { ffi::wxd_IPC_ResolveService(c_service.as_ptr(), self.into(), buffer.as_mut_ptr() as *mut _, buffer.len()) };
+        buffer.truncate(len);
+        String::from_utf8_lossy(&buffer).into_owned()
+    }
+}
+
+// =============================================================================
+// Asynchronous Operations
+// =============================================================================
+
+/// Why an asynchronous connect or request ended without a result.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum IPCAsyncError {
+    /// The server was unreachable, rejected the topic or request, or the connection was lost.
+    Failed,
+    /// The operation did not complete within its timeout.
+    TimedOut,
+    /// The operation was cancelled through its [`IPCAsyncHandle`].
+    Cancelled,
+}
+
+impl IPCAsyncError {
+    fn from_status(status: ffi::wxd_IPCAsyncStatus) -> Self {
+        match status {
+            ffi::wxd_IPCAsyncStatus_WXD_IPC_ASYNC_TIMEOUT => IPCAsyncError::TimedOut,
+            ffi::wxd_IPCAsyncStatus_WXD_IPC_ASYNC_CANCELLED => IPCAsyncError::Cancelled,
+            _ => IPCAsyncError::Failed,
+        }
+    }
+}
+
+/// Handle to a pending asynchronous connect or request.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub struct IPCAsyncHandle(u64);
+
+impl IPCAsyncHandle {
+    /// Cancel the operation if it is still pending.
+    ///
+    /// Its completion callback runs immediately with [`IPCAsyncError::Cancelled`].
+    /// Returns false if the operation has already completed.
+    pub fn cancel(&self) -> bool {
+        unsafe { ffi::wxd_IPC_CancelAsync(self.0) }
+    }
+
+    /// The operation id.
+    pub fn id(&self) -> u64 {
+        self.0
+    }
+}
+
+fn duration_ms(duration: Option<Duration>) -> u32 {
+    // 0 means "none" on the C side, so round sub-millisecond durations up.
+    duration.map_or(0, |d| d.as_millis().clamp(1, u32::MAX as u128) as u32)
+}
+
+type ConnectCompleteCallback = Box<dyn FnOnce(Result<IPCConnection, IPCAsyncError>)>;
+type RequestCompleteCallback = Box<dyn FnOnce(Result<Vec<u8>, IPCAsyncError>)>;
+
+#[allow(unsafe_op_in_unsafe_fn)]
+unsafe extern "C" fn on_connect_complete_trampoline(
+    user_data: *mut c_void,
+    _op_id: u64,
+    status: ffi::wxd_IPCAsyncStatus,
+    conn: *mut ffi::wxd_IPCConnection_t,
+) {
+    if user_data.is_null() {
+        return;
+    }
+    let slot = &mut *(user_data as *mut Option<ConnectCompleteCallback>);
+    if let Some(callback) = slot.take() {
+        let result = if status == ffi::wxd_IPCAsyncStatus_WXD_IPC_ASYNC_OK && !conn.is_null() {
+            ffi::wxd_IPCConnection_SetOnAdviseBatch(conn, Some(on_advise_batch_trampoline));
+            Ok(IPCConnection { ptr: conn, owned: false })
+        } else {
+            Err(IPCAsyncError::from_status(status))
+        };
+        callback(result);
+    }
+}
+
+#[allow(unsafe_op_in_unsafe_fn)]
+unsafe extern "C" fn free_connect_complete(user_data: *mut c_void) {
+    if !user_data.is_null() {
+        let _ = Box::from_raw(user_data as *mut Option<ConnectCompleteCallback>);
+    }
+}
+
+#[allow(unsafe_op_in_unsafe_fn)]
+unsafe extern "C" fn on_request_complete_trampoline(
+    user_data: *mut c_void,
+    _op_id: u64,
+    status: ffi::wxd_IPCAsyncStatus,
+    data: *const c_void,
+    size: usize,
+) {
+    if user_data.is_null() {
+        return;
+    }
+    let slot = &mut *(user_data as *mut Option<RequestCompleteCallback>);
+    if let Some(callback) = slot.take() {
+        let result = if status != ffi::wxd_IPCAsyncStatus_WXD_IPC_ASYNC_OK {
+            Err(IPCAsyncError::from_status(status))
+        } else if data.is_null() || size == 0 {
+            Ok(Vec::new())
+        } else {
+            Ok(std::slice::from_raw_parts(data as *const u8, size).to_vec())
+        };
+        callback(result);
+    }
+}
+
+#[allow(unsafe_op_in_unsafe_fn)]
+unsafe extern "C" fn free_request_complete(user_data: *mut c_void) {
+    if !user_data.is_null() {
+        let _ = Box::from_raw(user_data as *mut Option<RequestCompleteCallback>);
+    }
+}
+
 // =============================================================================
 // Connection Callbacks - stored in a Box and passed to C++
 // =============================================================================
@@ -98,6 +246,7 @@ type RequestCallback = Box<dyn FnMut(&str, &str, IPCFormat) -> Option<Vec<u8>>>;
 type PokeCallback = Box<dyn FnMut(&str, &str, &[u8], IPCFormat) -> bool>;
 type AdviseTopicCallback = Box<dyn FnMut(&str, &str) -> bool>;
 type AdviseDataCallback = Box<dyn FnMut(&str, &str, &[u8], IPCFormat) -> bool>;
+type AdviseBatchCallback = Box<dyn FnMut(&str, &[AdviseSlice<'_>]) -> bool>;
 type DisconnectCallback = Box<dyn FnMut() -> bool>;
 type AcceptConnectionCallback = Box<dyn FnMut(&str) -> Option<IPCConnection>>;
 
@@ -109,6 +258,7 @@ struct ConnectionCallbacks {
     on_start_advise: Option<AdviseTopicCallback>,
     on_stop_advise: Option<AdviseTopicCallback>,
     on_advise: Option<AdviseDataCallback>,
+    on_advise_batch: Option<AdviseBatchCallback>,
     on_disconnect: Option<DisconnectCallback>,
     /// Buffer for OnRequest response data (must outlive the callback return)
     request_buffer: Vec<u8>,
@@ -123,6 +273,7 @@ impl ConnectionCallbacks {
             on_start_advise: None,
             on_stop_advise: None,
             on_advise: None,
+            on_advise_batch: None,
             on_disconnect: None,
             request_buffer: Vec::new(),
         }
@@ -320,6 +471,67 @@ unsafe extern "C" fn on_advise_trampoline(
     false
 }
 
+/// One update of a batched Advise frame (see [`IPCConnection::set_advise_batching`]).
+#[derive(Debug, Clone, Copy)]
+pub struct AdviseSlice<'a> {
+    /// The advised item.
+    pub item: &'a str,
+    /// The update's data.
+    pub data: &'a [u8],
+    /// The update's format.
+    pub format: IPCFormat,
+}
+
+#[allow(unsafe_op_in_unsafe_fn)]
+unsafe extern "C" fn on_advise_batch_trampoline(
+    user_data: *mut c_void,
+    topic: *const core::ffi::c_char,
+    slices: *const ffi::wxd_IPCAdviseSlice,
+    count: usize,
+) -> bool {
+    if user_data.is_null() {
+        return false;
+    }
+    let callbacks = &mut *(user_data as *mut ConnectionCallbacks);
+    let topic_str = if topic.is_null() {
+        ""
+    } else {
+        CStr::from_ptr(topic).to_str().unwrap_or("")
+    };
+    let raw = if slices.is_null() || count == 0 {
+        &[]
+    } else {
+        std::slice::from_raw_parts(slices, count)
+    };
+    let updates: Vec<AdviseSlice<'_>> = raw
+        .iter()
+        .map(|slice| AdviseSlice {
+            item: if slice.item.is_null() {
+                ""
+            } else {
+                CStr::from_ptr(slice.item).to_str().unwrap_or("")
+            },
+            data: if slice.data.is_null() || slice.size == 0 {
+                &[]
+            } else {
+                std::slice::from_raw_parts(slice.data as *const u8, slice.size)
+            },
+            format: IPCFormat::from(slice.format),
+        })
+        .collect();
+    if let Some(ref mut cb) = callbacks.on_advise_batch {
+        return cb(topic_str, &updates);
+    }
+    // No batch callback: hand each update to on_advise in turn.
+    let mut ok = true;
+    if let Some(ref mut cb) = callbacks.on_advise {
+        for update in &updates {
+            ok = cb(topic_str, update.item, update.data, update.format) && ok;
+        }
+    }
+    ok
+}
+
 #[allow(unsafe_op_in_unsafe_fn)]
 unsafe extern "C" fn on_disconnect_trampoline(user_data: *mut c_void) -> bool {
     if user_data.is_null() {
@@ -419,6 +631,44 @@ impl IPCConnection {
         Some(data_slice.to_vec())
     }
 
+    /// Request data without blocking until the reply arrives.
+    ///
+    /// The peer's `on_request` callback answers on its next idle pass and
+    /// `on_complete` runs exactly once on the GUI thread with the reply or the
+    /// reason there is none. `None` for `timeout` waits indefinitely. Both ends
+    /// must be wxDragon connections.
+    ///
+    /// Returns `None` (without calling `on_complete`) if the request could not be sent.
+    pub fn request_async<F>(
+        &self,
+        item: &str,
+        format: IPCFormat,
+        timeout: Option<Duration>,
+        on_complete: F,
+    ) -> Option<IPCAsyncHandle>
+    where
+        F: FnOnce(Result<Vec<u8>, IPCAsyncError>) + 'static,
+    {
+        if self.ptr.is_null() {
+            return None;
+        }
+        let c_item = CString::new(item).ok()?;
+        let callback: Option<RequestCompleteCallback> = Some(Box::new(on_complete));
+        let user_data = Box::into_raw(Box::new(callback)) as *mut c_void;
+        let id = unsafe {
+            ffi::wxd_IPCConnection_RequestAsync(
+                self.ptr,
+                c_item.as_ptr(),
+                format.into(),
+                duration_ms(timeout),
+                Some(on_request_complete_trampoline),
+                user_data,
+                Some(free_request_complete),
+            )
+        };
+        (id != 0).then_some(IPCAsyncHandle(id))
+    }
+
     /// Poke data to the remote side.
     pub fn poke(&self, item: &str, data: &[u8], format: IPCFormat) -> bool {
         if self.ptr.is_null() {
@@ -500,6 +750,57 @@ impl IPCConnection {
         }
         unsafe { ffi::wxd_IPCConnection_IsConnected(self.ptr) }
     }
+
+    /// Configure Advise batching for high-frequency updates.
+    ///
+    /// On a server connection, `advise` calls are queued and sent as one frame
+    /// every `interval`, or sooner once a frame reaches `max_bytes` (`0` for
+    /// the 64 KiB default); this applies once the client has asked for
+    /// batches. On a client connection, any `Some` interval asks the server
+    /// for batched frames, which arrive through
+    /// [`IPCConnectionBuilder::on_advise_batch`]. `None` disables batching
+    /// (a server sends whatever is queued).
+    pub fn set_advise_batching(&self, interval: Option<Duration>, max_bytes: usize) -> bool {
+        if self.ptr.is_null() {
+            return false;
+        }
+        unsafe { ffi::wxd_IPCConnection_SetAdviseBatching(self.ptr, duration_ms(interval), max_bytes) }
+    }
+
+    /// Send any queued Advise updates now (server-side).
+    pub fn flush_advise(&self) -> bool {
+        if self.ptr.is_null() {
+            return false;
+        }
+        unsafe { ffi::wxd_IPCConnection_FlushAdvise(self.ptr) }
+    }
+
+    /// Enable the shared-memory side channel for payloads of at least `threshold` bytes.
+    ///
+    /// Large `execute`/`poke` (client) and `advise` (server) payloads are then
+    /// copied once into a named shared-memory segment and only a small
+    /// descriptor passes through the connection; the receiving callback gets
+    /// the mapped segment as its `&[u8]`, borrowed for the duration of the call.
+    /// Both sides must enable it: a server on the connection it returns from
+    /// its accept callback, a client after connecting, which negotiates with
+    /// the server. `request` replies always use the connection. A threshold of
+    /// `0` disables the channel.
+    ///
+    /// Returns true once the peer has accepted shared memory.
+    pub fn enable_shared_memory(&self, threshold: usize) -> bool {
+        if self.ptr.is_null() {
+            return false;
+        }
+        unsafe { ffi::wxd_IPCConnection_EnableSharedMemory(self.ptr, threshold) }
+    }
+
+    /// Returns true if large payloads on this connection go through shared memory.
+    pub fn uses_shared_memory(&self) -> bool {
+        if self.ptr.is_null() {
+            return false;
+        }
+        unsafe { ffi::wxd_IPCConnection_UsesSharedMemory(self.ptr) }
+    }
 }
 
 impl Drop for IPCConnection {
@@ -577,6 +878,18 @@ impl IPCConnectionBuilder {
         self
     }
 
+    /// Set the OnAdviseBatch callback (client-side: called once per batched Advise frame).
+    ///
+    /// Receives all updates of a frame in send order; without it, each update
+    /// is passed to `on_advise`. See [`IPCConnection::set_advise_batching`].
+    pub fn on_advise_batch<F>(mut self, callback: F) -> Self
+    where
+        F: FnMut(&str, &[AdviseSlice<'_>]) -> bool + 'static,
+    {
+        self.callbacks.on_advise_batch = Some(Box::new(callback));
+        self
+    }
+
     /// Set the OnDisconnect callback (both sides: called when connection is terminated).
     pub fn on_disconnect<F>(mut self, callback: F) -> Self
     where
@@ -605,6 +918,7 @@ impl IPCConnectionBuilder {
             )
         };
 
+        unsafe { ffi::wxd_IPCConnection_SetOnAdviseBatch(ptr, Some(on_advise_batch_trampoline)) };
         IPCConnection { ptr, owned: true }
     }
 }
@@ -720,6 +1034,20 @@ impl IPCServer {
         };
         unsafe { ffi::wxd_IPCServer_Create_Service(self.ptr, c_service.as_ptr()) }
     }
+
+    /// Start the server listening on `service` over `transport`.
+    ///
+    /// With [`IPCTransport::Local`] this fails if another server is already listening
+    /// on the same name.
+    pub fn create_with_transport(&self, service: &str, transport: IPCTransport) -> bool {
+        if self.ptr.is_null() {
+            return false;
+        }
+        let Ok(c_service) = CString::new(service) else {
+            return false;
+        };
+        unsafe { ffi::wxd_IPCServer_Create_ServiceEx(self.ptr, c_service.as_ptr(), transport.into()) }
+    }
 }
 
 impl Drop for IPCServer {
@@ -774,6 +1102,13 @@ impl IPCClient {
         Self { ptr }
     }
 
+    /// Set how later connects map their service name; must match the server's transport.
+    pub fn set_transport(&self, transport: IPCTransport) {
+        if !self.ptr.is_null() {
+            unsafe { ffi::wxd_IPCClient_SetTransport(self.ptr, transport.into()) };
+        }
+    }
+
     /// Connect to a server.
     ///
     /// # Arguments
@@ -830,12 +1165,70 @@ impl IPCClient {
         if conn_ptr.is_null() {
             None
         } else {
+            unsafe { ffi::wxd_IPCConnection_SetOnAdviseBatch(conn_ptr, Some(on_advise_batch_trampoline)) };
             Some(IPCConnection {
                 ptr: conn_ptr,
                 owned: false, // Owned by the wxWidgets system
             })
         }
     }
+
+    /// Connect to a server without blocking the GUI thread.
+    ///
+    /// On socket transports a worker thread first waits for the server to
+    /// accept connections; the connection itself is then made on the GUI
+    /// thread. `on_complete` runs exactly once on the GUI thread with the
+    /// connection or the reason there is none. `None` for `timeout` waits
+    /// indefinitely.
+    ///
+    /// Returns `None` (without calling `on_complete`) if nothing was started.
+    pub fn make_connection_async<F>(
+        &self,
+        host: &str,
+        service: &str,
+        topic: &str,
+        builder: IPCConnectionBuilder,
+        timeout: Option<Duration>,
+        on_complete: F,
+    ) -> Option<IPCAsyncHandle>
+    where
+        F: FnOnce(Result<IPCConnection, IPCAsyncError>) + 'static,
+    {
+        if self.ptr.is_null() {
+            return None;
+        }
+
+        let c_host = CString::new(host).ok()?;
+        let c_service = CString::new(service).ok()?;
+        let c_topic = CString::new(topic).ok()?;
+
+        let user_data = Box::into_raw(Box::new(builder.callbacks)) as *mut c_void;
+        let callback: Option<ConnectCompleteCallback> = Some(Box::new(on_complete));
+        let complete_data = Box::into_raw(Box::new(callback)) as *mut c_void;
+
+        let id = unsafe {
+            ffi::wxd_IPCClient_MakeConnectionAsync(
+                self.ptr,
+                c_host.as_ptr(),
+                c_service.as_ptr(),
+                c_topic.as_ptr(),
+                duration_ms(timeout),
+                user_data,
+                Some(on_execute_trampoline),
+                Some(on_request_trampoline),
+                Some(on_poke_trampoline),
+                Some(on_start_advise_trampoline),
+                Some(on_stop_advise_trampoline),
+                Some(on_advise_trampoline),
+                Some(on_disconnect_trampoline),
+                Some(free_connection_callbacks),
+                Some(on_connect_complete_trampoline),
+                complete_data,
+                Some(free_connect_complete),
+            )
+        };
+        (id != 0).then_some(IPCAsyncHandle(id))
+    }
 }
 
 impl Default for IPCClient {
@@ -851,3 +1244,18 @@ impl Drop for IPCClient {
         }
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::duration_ms;
+    use std::time::Duration;
+
+    #[test]
+    fn duration_ms_keeps_zero_for_none_only() {
+        assert_eq!(duration_ms(None), 0);
+        assert_eq!(duration_ms(Some(Duration::ZERO)), 1);
+        assert_eq!(duration_ms(Some(Duration::from_micros(10))), 1);
+        assert_eq!(duration_ms(Some(Duration::from_millis(250))), 250);
+        assert_eq!(duration_ms(Some(Duration::from_secs(u64::MAX))), u32::MAX);
+    }
+}
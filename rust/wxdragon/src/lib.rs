@@ -19,29 +19,46 @@ pub mod data_object;
 pub mod datetime;
 pub mod dc;
 pub mod dialogs;
+pub mod dir_listing;
 pub mod dnd;
 pub mod event;
+pub mod event_filter;
 pub mod font;
 pub mod font_data;
+pub mod frame_clock;
+pub mod fs_watcher;
 pub mod geometry;
+pub mod hotkeys;
 pub mod id;
+pub mod input_replay;
 pub mod ipc;
 pub mod language;
 pub mod menus;
 pub mod prelude;
 pub mod printing;
+pub mod process;
+pub mod profile;
+pub mod resource_bundle;
 pub mod scrollable;
 pub mod single_instance_checker;
 pub mod sizers;
+pub mod socket;
 pub mod sound;
+pub mod spatial_index;
+pub mod style_rules;
 pub mod sysopt;
+pub mod thread_event;
 pub mod timer;
+pub mod trace;
 pub mod translations;
 pub mod types;
 pub mod uiactionsimulator;
 pub mod utils;
+pub mod visibility;
+pub mod widget_tree;
 pub mod widgets;
 pub mod window;
+pub mod window_snapshot;
 #[cfg(feature = "xrc")]
 pub mod xrc;
 
@@ -65,7 +82,9 @@ pub use widgets::dataview::{
 };
 
 // Re-export DC functionality for custom renderers
-pub use dc::{BrushStyle, DeviceContext, PenStyle};
+pub use dc::{
+    Brush, BrushStyle, DeviceContext, DrawCommands, DrawListStyle, GraphicsContext, GraphicsPath, Pen, PenStyle, Point2D,
+};
 
 // Re-export window functionality including downcasting
 pub use window::{BackgroundStyle, ExtraWindowStyle, Window, WxWidget, WxWidgetDowncast};
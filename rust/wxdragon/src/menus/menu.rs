@@ -1,11 +1,12 @@
 //! wxMenu wrapper
 
 use crate::id::Id;
-use crate::menus::menuitem::{ItemKind, MenuItem};
+use crate::menus::menuitem::{ID_SEPARATOR, ItemKind, MenuItem};
 #[cfg(feature = "xrc")]
 use crate::window::WindowHandle;
 use crate::{CommandEventData, Event, EventType};
-use std::ffi::{CStr, CString};
+use std::cell::RefCell;
+use std::ffi::{CStr, CString, c_void};
 use std::marker::PhantomData;
 use std::rc::Rc;
 use wxdragon_sys as ffi;
@@ -366,6 +367,70 @@ impl Menu {
         MenuItem::from_xrc_name(parent_handle, item_name)
     }
 
+    /// Appends `(id, label, help, kind)` items in one native call instead of one call and two
+    /// string conversions per item. Returns the number of items appended.
+    pub fn append_items<'a, I>(&self, items: I) -> usize
+    where
+        I: IntoIterator<Item = (Id, &'a str, &'a str, ItemKind)>,
+    {
+        let mut ids = Vec::new();
+        let mut kinds = Vec::new();
+        let mut text = String::new();
+        let mut offsets = vec![0u32];
+        for (id, label, help, kind) in items {
+            ids.push(id);
+            kinds.push(i32::from(kind));
+            text.push_str(label);
+            offsets.push(text.len() as u32);
+            text.push_str(help);
+            offsets.push(text.len() as u32);
+        }
+        if ids.is_empty() {
+            return 0;
+        }
+        unsafe {
+            ffi::wxd_Menu_AppendItems(
+                self.ptr,
+                ids.as_ptr(),
+                kinds.as_ptr(),
+                text.as_ptr() as *const _,
+                offsets.as_ptr(),
+                ids.len(),
+            )
+        }
+    }
+
+    /// Appends a submenu that `populate` fills when the user first opens it, so large menu
+    /// trees cost nothing until they are browsed. With `refill`, the submenu is cleared and
+    /// `populate` runs on every open, which suits lists that change such as recent files.
+    /// Until it is filled (and whenever `populate` adds nothing), the submenu shows a disabled
+    /// placeholder item.
+    pub fn append_lazy_submenu<F>(&self, title: &str, help_string: &str, refill: bool, populate: F) -> Option<MenuItem>
+    where
+        F: FnMut(&Menu) + 'static,
+    {
+        let title_c = CString::new(title).unwrap_or_default();
+        let help_c = CString::new(help_string).unwrap_or_default();
+        let callback: Box<RefCell<Box<dyn FnMut(&Menu)>>> = Box::new(RefCell::new(Box::new(populate)));
+        let user_data = Box::into_raw(callback) as *mut c_void;
+        let item_ptr = unsafe {
+            ffi::wxd_Menu_AppendLazySubMenu(
+                self.ptr,
+                title_c.as_ptr(),
+                help_c.as_ptr(),
+                refill,
+                Some(populate_lazy_submenu),
+                user_data,
+                Some(free_lazy_submenu),
+            )
+        };
+        if item_ptr.is_null() {
+            unsafe { free_lazy_submenu(user_data) };
+            return None;
+        }
+        Some(MenuItem::from(item_ptr))
+    }
+
     // Make append private as it's called by builder
     fn append_raw(&self, id: Id, item: &str, help_string: &str, kind: ItemKind) -> Option<MenuItem> {
         let item_c = CString::new(item).unwrap_or_default();
@@ -385,6 +450,24 @@ impl Menu {
     }
 }
 
+unsafe extern "C" fn populate_lazy_submenu(user_data: *mut c_void, submenu: *mut ffi::wxd_Menu_t) {
+    if user_data.is_null() || submenu.is_null() {
+        return;
+    }
+    let callback = unsafe { &*(user_data as *const RefCell<Box<dyn FnMut(&Menu)>>) };
+    // Borrowed: the parent menu owns the submenu.
+    let menu = Menu::from(submenu as *const ffi::wxd_Menu_t);
+    if let Ok(mut populate) = callback.try_borrow_mut() {
+        populate(&menu);
+    }
+}
+
+unsafe extern "C" fn free_lazy_submenu(user_data: *mut c_void) {
+    if !user_data.is_null() {
+        drop(unsafe { Box::from_raw(user_data as *mut RefCell<Box<dyn FnMut(&Menu)>>) });
+    }
+}
+
 // Note: No Drop impl here, as wxMenuBar takes ownership via Append.
 
 // --- Menu Builder ---
@@ -476,18 +559,11 @@ impl MenuBuilder {
             _nosend_nosync: PhantomData,
         };
 
-        // Perform actions
-        for action in self.actions {
-            match action {
-                MenuAction::AppendItem { id, item, help, kind } => {
-                    // We might ignore the returned MenuItem here, as the builder doesn't expose it.
-                    let _ = menu.append_raw(id, &item, &help, kind);
-                }
-                MenuAction::AppendSeparator => {
-                    menu.append_separator_raw();
-                }
-            }
-        }
+        // Perform actions, all in one native call.
+        menu.append_items(self.actions.iter().map(|action| match action {
+            MenuAction::AppendItem { id, item, help, kind } => (*id, item.as_str(), help.as_str(), *kind),
+            MenuAction::AppendSeparator => (ID_SEPARATOR, "", "", ItemKind::Separator),
+        }));
         menu
     }
 }
@@ -1,11 +1,13 @@
 // wxdragon/src/menus/mod.rs
-//! Menu-related widgets and types (`MenuBar`, `Menu`, `MenuItem`).
+//! Menu-related widgets and types (`MenuBar`, `Menu`, `MenuItem`, `UpdateUIAggregator`).
 
 pub mod menu;
 pub mod menubar;
 pub mod menuitem;
+pub mod update_ui;
 
 // Re-export main types
 pub use menu::Menu;
 pub use menubar::MenuBar;
 pub use menuitem::{ItemKind, MenuItem};
+pub use update_ui::{UpdateUIAggregator, UpdateUIState};
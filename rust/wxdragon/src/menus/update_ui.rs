@@ -0,0 +1,186 @@
+//! Batched UpdateUI for menu and toolbar commands.
+//!
+//! Binding `EventType::UPDATE_UI` on every command runs one Rust closure per item on each idle
+//! pass. An [`UpdateUIAggregator`] instead polls the enable/check state of all its registered
+//! commands in a single call, once per interval, and only touches the items whose state changed.
+//!
+//! ```rust,no_run
+//! use std::cell::Cell;
+//! use std::rc::Rc;
+//! use std::time::Duration;
+//! use wxdragon::prelude::*;
+//!
+//! # fn build(frame: &Frame, dirty: Rc<Cell<bool>>, wrap: Rc<Cell<bool>>) {
+//! const ID_SAVE: i32 = ID_HIGHEST + 1;
+//! const ID_WORD_WRAP: i32 = ID_HIGHEST + 2;
+//!
+//! let updates = UpdateUIAggregator::new(frame, Duration::from_millis(200)).unwrap();
+//! updates.register_enable(ID_SAVE, move || dirty.get());
+//! updates.register(ID_WORD_WRAP, move || UpdateUIState { enabled: true, checked: wrap.get() });
+//! # }
+//! ```
+
+use crate::id::Id;
+use crate::widgets::ToolBar;
+use crate::window::WxWidget;
+use std::cell::RefCell;
+use std::collections::HashMap;
+use std::os::raw::c_void;
+use std::rc::Rc;
+use std::time::Duration;
+use wxdragon_sys as ffi;
+
+/// State reported for a checkable command by an [`UpdateUIAggregator`] provider.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct UpdateUIState {
+    pub enabled: bool,
+    pub checked: bool,
+}
+
+enum Provider {
+    Enable(Box<dyn Fn() -> bool>),
+    State(Box<dyn Fn() -> UpdateUIState>),
+}
+
+type Providers = Rc<RefCell<HashMap<Id, Provider>>>;
+
+#[allow(unsafe_op_in_unsafe_fn)]
+unsafe extern "C" fn collect_trampoline(
+    user_data: *mut c_void,
+    ids: *const i32,
+    count: usize,
+    enabled_bits: *mut u8,
+    checked_bits: *mut u8,
+) {
+    if user_data.is_null() || ids.is_null() || count == 0 {
+        return;
+    }
+    let providers = &*(user_data as *const Providers);
+    // A provider that registers or unregisters commands re-entrantly skips this pass.
+    let Ok(providers) = providers.try_borrow() else {
+        return;
+    };
+    let ids = std::slice::from_raw_parts(ids, count);
+    let bytes = count.div_ceil(8);
+    let enabled_bits = std::slice::from_raw_parts_mut(enabled_bits, bytes);
+    let checked_bits = std::slice::from_raw_parts_mut(checked_bits, bytes);
+    for (i, id) in ids.iter().enumerate() {
+        let state = match providers.get(id) {
+            Some(Provider::Enable(f)) => UpdateUIState {
+                enabled: f(),
+                checked: false,
+            },
+            Some(Provider::State(f)) => f(),
+            None => continue,
+        };
+        let mask = 1u8 << (i % 8);
+        if state.enabled {
+            enabled_bits[i / 8] |= mask;
+        }
+        if state.checked {
+            checked_bits[i / 8] |= mask;
+        }
+    }
+}
+
+#[allow(unsafe_op_in_unsafe_fn)]
+unsafe extern "C" fn free_providers(user_data: *mut c_void) {
+    if !user_data.is_null() {
+        let _ = Box::from_raw(user_data as *mut Providers);
+    }
+}
+
+/// Polls registered command states together and applies only the changes to a window's
+/// menubar and toolbars.
+///
+/// Every `interval`, all providers run in one pass; items whose enabled or checked state
+/// differs from what was last applied are updated in the window's menubar, its frame toolbar
+/// and any toolbar added with [`add_tool_bar`](Self::add_tool_bar). Polling pauses while the
+/// window is hidden. Providers are dropped when the window is destroyed or the aggregator is
+/// dropped, whichever comes first.
+pub struct UpdateUIAggregator {
+    ptr: *mut ffi::wxd_UpdateUIAggregator_t,
+    providers: Providers,
+}
+
+impl UpdateUIAggregator {
+    /// Creates an aggregator for `window` (usually a frame) that polls every `interval`.
+    pub fn new(window: &impl WxWidget, interval: Duration) -> Option<Self> {
+        let handle = window.handle_ptr();
+        if handle.is_null() {
+            return None;
+        }
+        let providers: Providers = Rc::new(RefCell::new(HashMap::new()));
+        let user_data = Box::into_raw(Box::new(Rc::clone(&providers))) as *mut c_void;
+        let ptr = unsafe {
+            ffi::wxd_UpdateUIAggregator_Create(
+                handle,
+                interval_ms(interval),
+                Some(collect_trampoline),
+                user_data,
+                Some(free_providers),
+            )
+        };
+        if ptr.is_null() {
+            return None;
+        }
+        Some(Self { ptr, providers })
+    }
+
+    /// Registers a command whose enabled state is reported by `provider`.
+    ///
+    /// Replaces any provider previously registered for `id`.
+    pub fn register_enable<F>(&self, id: Id, provider: F)
+    where
+        F: Fn() -> bool + 'static,
+    {
+        self.providers.borrow_mut().insert(id, Provider::Enable(Box::new(provider)));
+        unsafe { ffi::wxd_UpdateUIAggregator_Register(self.ptr, id, false) };
+    }
+
+    /// Registers a checkable command whose enabled and checked state is reported by `provider`.
+    ///
+    /// Replaces any provider previously registered for `id`.
+    pub fn register<F>(&self, id: Id, provider: F)
+    where
+        F: Fn() -> UpdateUIState + 'static,
+    {
+        self.providers.borrow_mut().insert(id, Provider::State(Box::new(provider)));
+        unsafe { ffi::wxd_UpdateUIAggregator_Register(self.ptr, id, true) };
+    }
+
+    /// Stops polling `id`. Its items keep their last applied state.
+    pub fn unregister(&self, id: Id) {
+        self.providers.borrow_mut().remove(&id);
+        unsafe { ffi::wxd_UpdateUIAggregator_Unregister(self.ptr, id) };
+    }
+
+    /// Also applies command states to `tool_bar`, for toolbars other than the frame's own.
+    pub fn add_tool_bar(&self, tool_bar: &ToolBar) {
+        let handle = tool_bar.handle_ptr();
+        if !handle.is_null() {
+            unsafe { ffi::wxd_UpdateUIAggregator_AddToolBar(self.ptr, handle as *mut ffi::wxd_ToolBar_t) };
+        }
+    }
+
+    /// Changes the polling interval.
+    pub fn set_interval(&self, interval: Duration) {
+        unsafe { ffi::wxd_UpdateUIAggregator_SetInterval(self.ptr, interval_ms(interval)) };
+    }
+
+    /// Polls immediately instead of waiting for the next interval, e.g. right after a command
+    /// changed the application state. With `force`, every item is re-applied.
+    pub fn update_now(&self, force: bool) {
+        unsafe { ffi::wxd_UpdateUIAggregator_UpdateNow(self.ptr, force) };
+    }
+}
+
+impl Drop for UpdateUIAggregator {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_UpdateUIAggregator_Destroy(self.ptr) }
+    }
+}
+
+fn interval_ms(interval: Duration) -> i32 {
+    interval.as_millis().clamp(1, i32::MAX as u128) as i32
+}
@@ -1,19 +1,29 @@
 // --- Core Types & Traits ---
 #[cfg(target_os = "windows")]
-pub use crate::accessible::Accessible;
-pub use crate::app::{App, call_after, get_app, get_app_instance, main, set_appearance, set_top_window, wake_up_idle};
+pub use crate::accessible::{Accessible, AccessibleNode};
+pub use crate::app::{
+    App, CacheUsage, CallbackPriority, CallbackQueueStats, IdleMode, InstanceHandoff, JobCancel, TrimLevel, WorkerPool,
+    cache_usage, call_after, call_after_with_priority, callback_queue_stats, enable_stall_watchdog, get_app, get_app_instance,
+    main, native_log_dropped, set_appearance, set_callback_budget, set_idle_mode, set_log_max_level, set_native_log_async,
+    set_single_instance, set_top_window, trim_memory, unwatch_memory_pressure, wake_up_idle, was_handed_off,
+    watch_memory_pressure,
+};
 pub use crate::appearance::{
     AppAppearance, Appearance, AppearanceResult, SystemAppearance, get_app as get_app_for_appearance, get_system_appearance,
     is_system_dark_mode,
 };
-pub use crate::clipboard::{Clipboard, ClipboardLocker};
+pub use crate::clipboard::{Clipboard, ClipboardData, ClipboardFormat, ClipboardLocker};
 pub use crate::color::{Colour, colours};
-pub use crate::config::{Config, ConfigEntryType, ConfigPathGuard, ConfigStyle};
+pub use crate::config::{Config, ConfigEntryType, ConfigPathGuard, ConfigSnapshot, ConfigStyle, ConfigValue};
 pub use crate::cursor::{BitmapType, BusyCursor, Cursor, StockCursor, begin_busy_cursor, end_busy_cursor, is_busy, set_cursor};
 pub use crate::datetime::DateTime;
-pub use crate::event::{Event, EventType, IdleEvent, IdleMode, WindowEventData, WxEvtHandler};
+pub use crate::event::{
+    Event, EventSnapshot, EventType, IdleEvent, IdleMode, PaintContext, PointerSample, RateLimit, WindowEventData, WxEvtHandler,
+};
 // ADDED: Event category traits
-pub use crate::event::{AppEvents, ButtonEvents, MenuEvents, ScrollEvents, TextEvents, TreeEvents, WindowEvents};
+pub use crate::event::{
+    AppEvents, ButtonEvents, MenuEvents, RateLimitedTextEvents, ScrollEvents, TextEvents, TreeEvents, WindowEvents,
+};
 // ADDED: Event Data Structs
 pub use crate::event::event_data::{CommandEventData, KeyEventData, MouseEventData};
 pub use crate::event::{IdleEventData, MenuEventData};
@@ -21,7 +31,7 @@ pub use crate::geometry::{Point, Rect, Size};
 pub use crate::id::{ID_ANY, ID_APPLY, ID_CANCEL, ID_HELP, ID_HIGHEST, ID_NO, ID_OK, ID_YES, Id};
 pub use crate::language::Language;
 pub use crate::sizers::WxSizer;
-pub use crate::sound::{Sound, SoundFlags};
+pub use crate::sound::{Sound, SoundFlags, SoundPool};
 pub use crate::sysopt::SystemOptions;
 pub use crate::types::Style;
 pub use crate::utils::{ArrayString, BrowserLaunchFlags, bell, launch_default_browser};
@@ -42,34 +52,41 @@ pub use crate::sizers::base::{Orientation, SizerFlag};
 
 // --- Widgets & Builders ---
 pub use crate::widgets::activity_indicator::{ActivityIndicator, ActivityIndicatorBuilder, ActivityIndicatorStyle}; // Added Style
-pub use crate::widgets::animation_ctrl::{AnimationCtrl, AnimationCtrlBuilder, AnimationCtrlStyle}; // Added Style
+pub use crate::widgets::animation_ctrl::{Animation, AnimationCtrl, AnimationCtrlBuilder, AnimationCtrlStyle}; // Added Style
 #[cfg(feature = "aui")]
-pub use crate::widgets::aui_manager::{AuiManager, AuiPaneInfo, DockDirection};
+pub use crate::widgets::aui_manager::{AuiManager, AuiPaneChange, AuiPaneInfo, DockDirection};
 #[cfg(feature = "aui")]
 pub use crate::widgets::aui_mdi_child_frame::{AuiMdiChildFrame, AuiMdiChildFrameBuilder};
 #[cfg(feature = "aui")]
 pub use crate::widgets::aui_mdi_parent_frame::{AuiMdiParentFrame, AuiMdiParentFrameBuilder};
 #[cfg(feature = "aui")]
-pub use crate::widgets::aui_notebook::{AuiNotebook, AuiNotebookBuilder, AuiNotebookStyle}; // Added Style
+pub use crate::widgets::aui_notebook::{AuiNotebook, AuiNotebookBuilder, AuiNotebookStyle, VirtualTabLabel}; // Added Style
 #[cfg(feature = "aui")]
 pub use crate::widgets::aui_toolbar::{AuiToolBar, AuiToolBarBuilder, AuiToolBarStyle}; // Added Style
 pub use crate::widgets::bitmap_button::{BitmapButton, BitmapButtonBuilder, BitmapButtonStyle}; // Added Style
 pub use crate::widgets::bitmap_combobox::{BitmapComboBox, BitmapComboBoxBuilder}; // Style is ComboBoxStyle
 pub use crate::widgets::bitmaptogglebutton::{BitmapToggleButton, BitmapToggleButtonBuilder, BitmapToggleButtonStyle};
 pub use crate::widgets::button::{Button, ButtonBuilder, ButtonStyle};
-pub use crate::widgets::calendar_ctrl::{CalendarCtrl, CalendarCtrlBuilder, CalendarCtrlStyle};
+pub use crate::widgets::calendar_ctrl::{
+    CalendarCtrl, CalendarCtrlBuilder, CalendarCtrlStyle, CalendarDateBorder, CalendarDayAttr,
+};
+pub use crate::widgets::canvas::{Canvas, CanvasBuilder, CanvasStyle};
 pub use crate::widgets::checkbox::{CheckBox, CheckBoxBuilder, CheckBoxStyle};
 pub use crate::widgets::checklistbox::{CheckListBox, CheckListBoxBuilder, CheckListBoxStyle}; // Added Style
 pub use crate::widgets::choice::{Choice, ChoiceBuilder, ChoiceStyle};
 pub use crate::widgets::collapsible_pane::{CollapsiblePane, CollapsiblePaneBuilder, CollapsiblePaneStyle};
 pub use crate::widgets::colour_picker_ctrl::{ColourPickerCtrl, ColourPickerCtrlBuilder, ColourPickerCtrlStyle};
 pub use crate::widgets::combobox::{ComboBox, ComboBoxBuilder, ComboBoxStyle};
-pub use crate::widgets::command_link_button::{CommandLinkButton, CommandLinkButtonBuilder, CommandLinkButtonStyle}; // Added Style
+pub use crate::widgets::command_link_button::{CommandLinkButton, CommandLinkButtonBuilder, CommandLinkButtonStyle};
+pub use crate::widgets::completion_index::CompletionIndex;
+pub use crate::widgets::hv_scrolled_window::{HVScrolledWindow, HVScrolledWindowBuilder, HVScrolledWindowStyle};
+pub use crate::widgets::vlistbox::{VListBox, VListBoxBuilder, VListBoxEvent, VListBoxStyle}; // Added Style
 
 pub use crate::widgets::dataview::{
     CustomDataViewTreeModel,
     CustomDataViewVirtualListModel, // Added CustomDataViewVirtualListModel
     DataViewAlign,
+    DataViewAutoSizeSample,
     DataViewCellMode,
     DataViewColumn,
     DataViewCtrl,
@@ -86,13 +103,20 @@ pub use crate::widgets::dataview::{
     DataViewListCtrlBuilder,
     DataViewListModel,
     DataViewModel,
+    DataViewRowValues,
+    DataViewSnapshot,
+    DataViewSnapshotPublisher,
     DataViewStyle,
     DataViewTextRenderer, // Added DataViewTextRenderer
     DataViewTreeCtrl,
     DataViewTreeCtrlBuilder,
     DataViewTreeEventHandler,
+    PackedColumn,
+    PackedStrings,
+    SnapshotDataViewTreeModel,
     Variant,
     VariantType, // Added VariantType
+    VariantValue,
 };
 // Added DataView enums
 pub use crate::widgets::dataview::enums::DataViewColumnFlags;
@@ -104,10 +128,17 @@ pub use crate::widgets::file_picker_ctrl::{FilePickerCtrl, FilePickerCtrlBuilder
 pub use crate::widgets::font_picker_ctrl::{FontPickerCtrl, FontPickerCtrlBuilder, FontPickerCtrlStyle};
 pub use crate::widgets::frame::{Frame, FrameBuilder, FrameStyle, UserAttentionFlag};
 pub use crate::widgets::gauge::{Gauge, GaugeBuilder, GaugeStyle};
+#[cfg(feature = "opengl")]
+pub use crate::widgets::gl_canvas::{GLAttributes, GLCanvas, GLCanvasBuilder, GLCanvasStyle, GLContext, NativeWindowHandle};
 pub use crate::widgets::grid::{
-    CellSpan, Grid, GridBlockCoords, GridBuilder, GridCellCoords, GridEvent, GridEventData, GridSelectionMode, GridStyle,
-    TabBehaviour,
+    CellSpan, Grid, GridAutoSizeSample, GridBlockCoords, GridBuilder, GridCellCoords, GridEvent, GridEventData,
+    GridSelectionMode, GridSelectionRange, GridStyle, TabBehaviour,
 };
+pub use crate::widgets::grid_editor::{GridCellEditHandler, GridCellEditor};
+pub use crate::widgets::grid_ingest::{GridIngest, GridIngestOptions};
+pub use crate::widgets::grid_renderer::{GridCellPainter, GridCellRenderer, GridRenderCell};
+pub use crate::widgets::grid_style::GridCellStyle;
+pub use crate::widgets::grid_table::{GridCellAttrSpec, GridTable, GridValueType};
 pub use crate::widgets::hyperlink_ctrl::{HyperlinkCtrl, HyperlinkCtrlBuilder, HyperlinkCtrlStyle};
 // ADDED: ImageList
 pub use crate::widgets::imagelist::ImageList;
@@ -118,11 +149,16 @@ pub use crate::widgets::list_ctrl::{
     ListCtrl,
     ListCtrlBuilder,
     ListCtrlStyle,
+    ListItemAttr,
     ListItemState,
     ListNextItemFlag,
+    ListSortKeys,
+    TypeAheadMode,
+    VirtualListItemCallbacks,
     // Events for ListCtrl are now in list_ctrl/event.rs, re-exported from list_ctrl/mod.rs
 }; // Added Events
 
+pub use crate::widgets::lazy_book::{LazyBookCtrl, LazyPageBudget};
 pub use crate::widgets::list_ctrl::image_list_type;
 pub use crate::widgets::listbox::{ListBox, ListBoxBuilder, ListBoxStyle};
 pub use crate::widgets::mdi_child_frame::{MDIChildFrame, MDIChildFrameBuilder};
@@ -141,7 +177,7 @@ pub use crate::widgets::notification_message::{
 pub use crate::widgets::panel::{Panel, PanelBuilder, PanelStyle};
 pub use crate::widgets::property_grid::{
     Property, PropertyChoice, PropertyGrid, PropertyGridBuilder, PropertyGridEvent, PropertyGridEventData, PropertyGridStyle,
-    PropertyId, PropertyKind,
+    PropertyHandle, PropertyId, PropertyKey, PropertyKind,
 };
 pub use crate::widgets::radio_button::{RadioButton, RadioButtonBuilder, RadioButtonStyle};
 pub use crate::widgets::radiobox::{RadioBox, RadioBoxBuilder, RadioBoxStyle};
@@ -150,15 +186,17 @@ pub use crate::widgets::rearrangelist::{RearrangeList, RearrangeListBuilder, Rea
 #[cfg(feature = "richtext")]
 pub use crate::widgets::richtextctrl::{
     RichTextCtrl, RichTextCtrlBuilder, RichTextCtrlEvent, RichTextCtrlEventData, RichTextCtrlStyle, RichTextFileType,
+    RichTextRunStyle,
 };
 pub use crate::widgets::scrollbar::{ScrollBar, ScrollBarBuilder, ScrollBarStyle};
-pub use crate::widgets::scrolled_window::{ScrolledWindow, ScrolledWindowBuilder, ScrolledWindowStyle}; // Added Style
+pub use crate::widgets::scrolled_window::{ScrolledWindow, ScrolledWindowBuilder, ScrolledWindowStyle, TileRequest}; // Added Style
 pub use crate::widgets::search_ctrl::{SearchCtrl, SearchCtrlBuilder, SearchCtrlStyle};
 pub use crate::widgets::slider::{Slider, SliderBuilder, SliderStyle};
 pub use crate::widgets::spinbutton::{SpinButton, SpinButtonBuilder, SpinButtonStyle};
 pub use crate::widgets::spinctrl::{SpinCtrl, SpinCtrlBuilder, SpinCtrlStyle};
 pub use crate::widgets::spinctrl_double::{SpinCtrlDouble, SpinCtrlDoubleBuilder, SpinCtrlDoubleStyle};
 pub use crate::widgets::splitter_window::{
+    LiveResizeMode,
     SplitterWindow,
     SplitterWindowBuilder,
     SplitterWindowStyle,
@@ -171,20 +209,24 @@ pub use crate::widgets::staticbox::{StaticBox, StaticBoxBuilder, StaticBoxStyle}
 pub use crate::widgets::statusbar::{StatusBar, StatusBarBuilder};
 #[cfg(feature = "stc")]
 pub use crate::widgets::styledtextctrl::{
-    EolMode, FindFlags, Lexer, MarginType, MarkerSymbol, SelectionMode, StyledTextCtrl, StyledTextCtrlBuilder,
-    StyledTextCtrlEvent, StyledTextCtrlEventData, StyledTextCtrlStyle, WhiteSpaceView, WrapMode,
+    EolMode, FindAllResult, FindFlags, Lexer, LoadProgress, MarginType, MarkerSymbol, SelectionMode, StcDocument, StyledTextCtrl,
+    StyledTextCtrlBuilder, StyledTextCtrlEvent, StyledTextCtrlEventData, StyledTextCtrlStyle, WhiteSpaceView, WrapMode,
 };
+pub use crate::widgets::table_export::TableExportFormat;
 pub use crate::widgets::taskbar_icon::{TaskBarIcon, TaskBarIconBuilder, TaskBarIconStyle, TaskBarIconType};
 pub use crate::widgets::textctrl::{TextCtrl, TextCtrlBuilder, TextCtrlStyle};
 pub use crate::widgets::time_picker_ctrl::{TimePickerCtrl, TimePickerCtrlBuilder, TimePickerCtrlStyle};
 pub use crate::widgets::togglebutton::{ToggleButton, ToggleButtonBuilder, ToggleButtonStyle};
-pub use crate::widgets::toolbar::{ToolBar, ToolBarStyle}; // Added Style
+pub use crate::widgets::toolbar::{ToolBar, ToolBarStyle, ToolDesc}; // Added Style
 pub use crate::widgets::treebook::{Treebook, TreebookBuilder, TreebookStyle}; // Added Style
-pub use crate::widgets::treectrl::{TreeCtrl, TreeCtrlBuilder, TreeCtrlStyle, TreeHitTestFlags, TreeItemIcon, TreeItemId};
+pub use crate::widgets::treectrl::{
+    LazyTreeChildren, TreeCtrl, TreeCtrlBuilder, TreeCtrlStyle, TreeHitTestFlags, TreeItemHandle, TreeItemIcon, TreeItemId,
+    TreeNodeOptions, TreeSubtree, TreeSubtreeBuilder,
+};
 
 // --- Menus ---
 pub use crate::menus::menuitem::{ID_ABOUT, ID_EXIT, ID_SEPARATOR};
-pub use crate::menus::{ItemKind, Menu, MenuBar, MenuItem};
+pub use crate::menus::{ItemKind, Menu, MenuBar, MenuItem, UpdateUIAggregator, UpdateUIState};
 
 // --- Widgets ItemKind (for toolbar) ---
 #[cfg(feature = "aui")]
@@ -192,8 +234,8 @@ pub use crate::widgets::ItemKind as WidgetItemKind;
 
 // --- Bitmaps & Art ---
 pub use crate::art_provider::{ArtClient, ArtId, ArtProvider};
-pub use crate::bitmap::Bitmap;
-pub use crate::bitmap_bundle::BitmapBundle; // Added BitmapBundle
+pub use crate::bitmap::{Bitmap, BitmapPixels, DecodedImage, PixelFormat, ResizeQuality, resize_rgba};
+pub use crate::bitmap_bundle::{AtlasSheet, BitmapBundle}; // Added BitmapBundle
 
 // --- Dialogs ---
 pub use crate::dialogs::about_dialog::{AboutDialogInfo, show_about_box};
@@ -209,31 +251,53 @@ pub use crate::dialogs::text_entry_dialog::{TextEntryDialog, TextEntryDialogBuil
 pub use crate::dialogs::{Dialog, DialogBuilder, DialogStyle}; // Base Dialog struct and builder
 
 // --- Fonts ---
-pub use crate::font::{Font, FontBuilder, FontFamily, FontStyle, FontWeight}; // Added FontBuilder
+pub use crate::font::{Font, FontBuilder, FontFamily, FontStyle, FontWeight, purge_object_caches}; // Added FontBuilder
 pub use crate::font_data::FontData;
 
 // --- Drag and Drop ---
-pub use crate::data_object::{BitmapDataObject, DataFormat};
-pub use crate::dnd::{DataObject, DragResult, DropSource, FileDataObject, FileDropTarget, TextDataObject, TextDropTarget};
+pub use crate::data_object::{BitmapDataObject, DataFormat, LazyDataObject, LazyFormat};
+pub use crate::dnd::{
+    DataObject, DragResult, DropSource, DroppedFileInfo, DroppedFiles, FileDataObject, FileDropTarget, TextDataObject,
+    TextDropTarget,
+};
 
 // --- Painting & DeviceContexts ---
 
 pub use crate::dc::{
-    AutoBufferedPaintDC, BackgroundMode, BrushStyle, ClientDC, DeviceContext, GenericDC, MemoryDC, PaintDC, PenStyle, ScreenDC,
+    AutoBufferedPaintDC, BackgroundMode, Brush, BrushStyle, ClientDC, DeviceContext, DrawCommands, DrawListStyle, GenericDC,
+    GraphicsContext, GraphicsPath, GraphicsRenderer, MemoryDC, OffscreenSurface, PaintDC, Pen, PenStyle, Point2D, ScreenDC,
     WindowDC,
 };
 pub use crate::printing::*;
+pub use crate::process::{ChildProcess, ChildProcessBuilder, ProcessExitEvent, ProcessOutputEvent};
+pub use crate::resource_bundle::{ResourceBundle, ResourceBundleWriter};
 
 // --- Application & Misc ---
 // pub use crate::app::App; // Commented out as per previous error, App is in main or app module
 pub use crate::appprogress::AppProgressIndicator;
-pub use crate::ipc::{IPCClient, IPCConnection, IPCConnectionBuilder, IPCFormat, IPCServer};
+pub use crate::dir_listing::{DirEntry, DirEntryFlags, DirListing, DirListingStatus};
+pub use crate::event_filter::{EventClass, EventFilter, FilterResult};
+pub use crate::frame_clock::{FrameClock, FrameInfo};
+pub use crate::fs_watcher::{FileChange, FileSystemChangesEvent, FileSystemWatcher};
+pub use crate::hotkeys::HotkeyTable;
+pub use crate::ipc::{
+    AdviseSlice, IPCAsyncError, IPCAsyncHandle, IPCClient, IPCConnection, IPCConnectionBuilder, IPCFormat, IPCServer,
+    IPCTransport,
+};
 pub use crate::single_instance_checker::SingleInstanceChecker;
-pub use crate::timer::Timer;
+pub use crate::socket::{Socket, SocketEvent, SocketNotify, SocketServer};
+pub use crate::spatial_index::{SpatialHoverEvent, SpatialIndex};
+pub use crate::style_rules::{StyleRule, apply_style_rules};
+pub use crate::thread_event::{ThreadEventSender, ThreadMessageEvent};
+pub use crate::timer::{Timer, TimerId, TimerWheel};
 pub use crate::translations::{
-    LanguageInfo, Locale, Translations, TranslationsLoader, add_catalog_lookup_path_prefix, translate, translate_plural,
+    LanguageInfo, Locale, MsgId, Translations, TranslationsLoader, add_catalog_lookup_path_prefix, translate, translate_id,
+    translate_plural, translate_plural_id,
 };
-pub use crate::uiactionsimulator::{KeyModifier, MouseButton, UIActionSimulator};
+pub use crate::uiactionsimulator::{KeyModifier, LatencyProbe, MouseButton, UIActionSimulator};
+pub use crate::visibility::{HiddenReasons, VisibilityEvent, on_visibility_changed};
+pub use crate::widget_tree::{BuiltNode, WidgetNode};
+pub use crate::window_snapshot::{SnapshotOptions, WindowNode, WindowNodeFlags, WindowSnapshot};
 
 // --- Constants for specific widgets that might be commonly used ---
 // Example: ListBox specific constants
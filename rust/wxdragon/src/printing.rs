@@ -22,6 +22,86 @@ pub trait Printout {
     fn get_page_info(&mut self) -> (i32, i32, i32, i32) {
         (1, 32000, 1, 1)
     }
+    /// Page count published by a paginator, possibly running on another thread. While set,
+    /// [`has_page`](Self::has_page) and, once the count is final,
+    /// [`get_page_info`](Self::get_page_info) are answered natively without calling back.
+    fn pagination(&self) -> Option<PrintPagination> {
+        None
+    }
+    /// Number of preview pages kept as bitmaps at the current zoom, so navigating a preview
+    /// does not call [`on_print_page`](Self::on_print_page) again for recently shown pages.
+    fn preview_cache_pages(&self) -> usize {
+        0
+    }
+}
+
+// --- PrintPagination ---
+
+/// A page count shared between a background paginator and a [`Printout`].
+///
+/// Lay the document out on a worker thread ahead of time and publish progress with
+/// [`set_page_count`](Self::set_page_count); the printout answers page queries from it
+/// natively, so opening and navigating a print preview never waits for pagination callbacks.
+///
+/// ```rust,no_run
+/// # use wxdragon::prelude::*;
+/// let pagination = PrintPagination::new();
+/// let worker = pagination.clone();
+/// std::thread::spawn(move || {
+///     // ... lay out the report ...
+///     worker.set_page_count(400, true);
+/// });
+/// ```
+pub struct PrintPagination {
+    ffi_ptr: *mut ffi::wxd_PrintPagination_t,
+}
+
+// SAFETY: the native object is reference counted and only holds atomics.
+unsafe impl Send for PrintPagination {}
+unsafe impl Sync for PrintPagination {}
+
+impl Default for PrintPagination {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl PrintPagination {
+    pub fn new() -> Self {
+        Self {
+            ffi_ptr: unsafe { ffi::wxd_PrintPagination_Create() },
+        }
+    }
+
+    /// Publishes `page_count` laid-out pages; `is_final` marks the document complete.
+    pub fn set_page_count(&self, page_count: u32, is_final: bool) {
+        let page_count = page_count.min(i32::MAX as u32) as i32;
+        unsafe { ffi::wxd_PrintPagination_SetPageCount(self.ffi_ptr, page_count, is_final) };
+    }
+
+    /// The published page count, or `None` before the first [`set_page_count`](Self::set_page_count).
+    pub fn page_count(&self) -> Option<u32> {
+        let count = unsafe { ffi::wxd_PrintPagination_GetPageCount(self.ffi_ptr) };
+        u32::try_from(count).ok()
+    }
+
+    pub fn is_final(&self) -> bool {
+        unsafe { ffi::wxd_PrintPagination_IsFinal(self.ffi_ptr) }
+    }
+}
+
+impl Clone for PrintPagination {
+    fn clone(&self) -> Self {
+        Self {
+            ffi_ptr: unsafe { ffi::wxd_PrintPagination_Clone(self.ffi_ptr) },
+        }
+    }
+}
+
+impl Drop for PrintPagination {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_PrintPagination_Release(self.ffi_ptr) };
+    }
 }
 
 // --- Printout Proxy ---
@@ -57,9 +137,32 @@ impl<T: Printout> PrintoutProxy<T> {
             )
         };
 
+        if let Some(pagination) = proxy.inner.pagination() {
+            unsafe { ffi::wxd_Printout_SetPagination(proxy.ffi_ptr, pagination.ffi_ptr) };
+        }
+        let cache_pages = proxy.inner.preview_cache_pages();
+        if cache_pages > 0 {
+            unsafe { ffi::wxd_Printout_SetPreviewCacheSize(proxy.ffi_ptr, cache_pages) };
+        }
+
         proxy
     }
 
+    /// Hands the proxy to wxWidgets, which deletes the printout (and through it the proxy).
+    fn into_owned_by_wx(proxy: Box<Self>) -> *mut ffi::wxd_Printout_t {
+        let ffi_ptr = proxy.ffi_ptr;
+        // The printout already holds this address as its user data.
+        let _ = Box::into_raw(proxy);
+        unsafe { ffi::wxd_Printout_SetFreeUserData(ffi_ptr, Some(Self::free_user_data_cb)) };
+        ffi_ptr
+    }
+
+    unsafe extern "C" fn free_user_data_cb(user_data: *mut c_void) {
+        let mut proxy = unsafe { Box::from_raw(user_data as *mut Self) };
+        // The printout is being deleted already.
+        proxy.ffi_ptr = ptr::null_mut();
+    }
+
     unsafe extern "C" fn on_prepare_printing_cb(user_data: *mut c_void) {
         let proxy = unsafe { &mut *(user_data as *mut Self) };
         let dc = proxy.get_dc();
@@ -127,7 +230,9 @@ impl<T: Printout> PrintoutProxy<T> {
 
 impl<T: Printout> Drop for PrintoutProxy<T> {
     fn drop(&mut self) {
-        unsafe { ffi::wxd_Printout_Destroy(self.ffi_ptr) };
+        if !self.ffi_ptr.is_null() {
+            unsafe { ffi::wxd_Printout_Destroy(self.ffi_ptr) };
+        }
     }
 }
 
@@ -291,6 +396,114 @@ impl Drop for Printer {
     }
 }
 
+// --- PrintPreview ---
+
+/// Opens a print preview frame for `printout`. `print_printout`, if given, backs the frame's
+/// Print button. Both printouts are owned by the preview frame and dropped when it closes.
+pub fn show_print_preview<T, U, W>(
+    parent: Option<&W>,
+    title: &str,
+    printout: T,
+    print_printout: Option<U>,
+    data: Option<&PrintDialogData>,
+    size: Size,
+) -> bool
+where
+    T: Printout + 'static,
+    U: Printout + 'static,
+    W: WxWidget,
+{
+    let preview = PrintoutProxy::into_owned_by_wx(PrintoutProxy::new(title, printout));
+    let print = print_printout.map_or(ptr::null_mut(), |p| {
+        PrintoutProxy::into_owned_by_wx(PrintoutProxy::new(title, p))
+    });
+    let title_c = CString::new(title).unwrap_or_default();
+    unsafe {
+        ffi::wxd_PrintPreview_Show(
+            preview,
+            print,
+            data.map_or(ptr::null_mut(), |d| d.ffi_ptr),
+            parent.map_or(ptr::null_mut(), |p| p.handle_ptr()),
+            title_c.as_ptr(),
+            size.width,
+            size.height,
+        )
+    }
+}
+
+// --- Headless export ---
+
+/// One page rendered by [`export_printout_bitmaps`], as tightly packed RGBA rows.
+pub struct ExportedPage<'a> {
+    pub page: i32,
+    pub width: u32,
+    pub height: u32,
+    pub rgba: &'a [u8],
+}
+
+/// Prints `printout` to a PostScript file at `path` without a printer or dialog. Paper and
+/// orientation come from `data`. Returns the number of pages written, or `None` if the export
+/// could not start (including wxWidgets builds without PostScript support, such as wxMSW).
+pub fn export_printout_postscript<T: Printout>(
+    title: &str,
+    printout: T,
+    data: Option<&PrintData>,
+    path: impl AsRef<std::path::Path>,
+) -> Option<usize> {
+    let path_c = CString::new(path.as_ref().to_string_lossy().as_bytes()).ok()?;
+    let proxy = PrintoutProxy::new(title, printout);
+    let pages = unsafe {
+        ffi::wxd_Printout_ExportPostScript(proxy.ffi_ptr, data.map_or(ptr::null_mut(), |d| d.ffi_ptr), path_c.as_ptr())
+    };
+    usize::try_from(pages).ok()
+}
+
+/// Renders every page of `printout` at `dpi` on a white page of `page_size_mm` (width, height;
+/// `(0, 0)` selects A4) and passes it to `on_page`, which returns `false` to stop. No printer,
+/// preview or dialog is involved. Pages are drawn on the calling (GUI) thread; copy the pixels
+/// out to encode or store them on worker threads. Returns the number of pages exported.
+pub fn export_printout_bitmaps<T, F>(title: &str, printout: T, dpi: u32, page_size_mm: (u32, u32), on_page: F) -> Option<usize>
+where
+    T: Printout,
+    F: FnMut(ExportedPage<'_>) -> bool,
+{
+    unsafe extern "C" fn page_cb<F: FnMut(ExportedPage<'_>) -> bool>(
+        user_data: *mut c_void,
+        page: i32,
+        rgba: *const u8,
+        width: i32,
+        height: i32,
+    ) -> bool {
+        let on_page = unsafe { &mut *(user_data as *mut F) };
+        let len = width.max(0) as usize * height.max(0) as usize * 4;
+        let rgba = if rgba.is_null() {
+            &[][..]
+        } else {
+            unsafe { std::slice::from_raw_parts(rgba, len) }
+        };
+        on_page(ExportedPage {
+            page,
+            width: width.max(0) as u32,
+            height: height.max(0) as u32,
+            rgba,
+        })
+    }
+
+    let proxy = PrintoutProxy::new(title, printout);
+    let mut on_page = on_page;
+    let pages = unsafe {
+        ffi::wxd_Printout_ExportBitmaps(
+            proxy.ffi_ptr,
+            dpi.min(i32::MAX as u32) as i32,
+            page_size_mm.0.min(i32::MAX as u32) as i32,
+            page_size_mm.1.min(i32::MAX as u32) as i32,
+            Some(page_cb::<F>),
+            &mut on_page as *mut F as *mut c_void,
+        )
+    };
+    usize::try_from(pages).ok()
+}
+
 // --- PrintDialog ---
 
 pub struct PrintDialog {
@@ -0,0 +1,273 @@
+//! Asynchronous child processes with output streamed into the event loop.
+
+use crate::event::{Event, EventToken, EventType, WxEvtHandler};
+use std::ffi::{CString, OsStr};
+use std::marker::PhantomData;
+use std::path::{Path, PathBuf};
+use std::rc::Rc;
+use std::time::Duration;
+use wxdragon_sys as ffi;
+
+/// A child process started with [`ChildProcess::builder`] whose stdout and stderr are read on
+/// the GUI thread without blocking it.
+///
+/// The pipes are polled by a native timer. Each poll reads up to a byte budget per stream and
+/// sends everything up to the last newline as one [`ProcessOutputEvent`] to the target handler,
+/// so tens of megabytes of build output arrive as a few thousand chunks of whole lines instead
+/// of a closure per line. When the child exits, its remaining output is delivered followed by a
+/// [`ProcessExitEvent`]. Events carry the pid, so one handler can serve several children.
+///
+/// Dropping the handle does not kill the child; its events keep arriving until it exits.
+///
+/// # Example
+/// ```rust,no_run
+/// use wxdragon::prelude::*;
+/// # let frame = Frame::builder().build();
+/// # let log = TextCtrl::builder(&frame).build();
+/// let child = ChildProcess::builder("cargo").args(["build", "--release"]).spawn(&frame);
+/// ChildProcess::on_output(&frame, move |event| log.append_text(&event.text()));
+/// ChildProcess::on_exit(&frame, |event| println!("exited with {}", event.exit_code()));
+/// ```
+pub struct ChildProcess {
+    ptr: *mut ffi::wxd_ChildProcess_t,
+    group_leader: bool,
+    // The native process object is driven by the GUI thread's timers.
+    _nosend_nosync: PhantomData<Rc<()>>,
+}
+
+impl ChildProcess {
+    /// Starts describing a child that runs `program`.
+    pub fn builder(program: impl AsRef<OsStr>) -> ChildProcessBuilder {
+        ChildProcessBuilder {
+            args: vec![program.as_ref().to_string_lossy().into_owned()],
+            current_dir: None,
+            hide_console: false,
+            group_leader: false,
+            poll_interval: None,
+        }
+    }
+
+    /// The operating system process id.
+    pub fn pid(&self) -> u32 {
+        unsafe { ffi::wxd_ChildProcess_GetPid(self.ptr) as u32 }
+    }
+
+    /// False once the child has exited and its exit event was queued.
+    pub fn is_running(&self) -> bool {
+        unsafe { ffi::wxd_ChildProcess_IsRunning(self.ptr) }
+    }
+
+    /// Sets how often the pipes are polled and how many bytes each stream may deliver per
+    /// poll (0 for the default of 1 MiB); the rest waits for the next poll.
+    pub fn set_rate_limit(&self, poll_interval: Duration, max_bytes_per_poll: usize) {
+        unsafe { ffi::wxd_ChildProcess_SetRateLimit(self.ptr, duration_ms(poll_interval), max_bytes_per_poll) }
+    }
+
+    /// Writes `data` to the child's stdin, blocking while the pipe is full.
+    pub fn write(&self, data: &[u8]) -> bool {
+        unsafe { ffi::wxd_ChildProcess_Write(self.ptr, data.as_ptr(), data.len()) }
+    }
+
+    /// Closes the child's stdin so it sees end of file.
+    pub fn close_input(&self) {
+        unsafe { ffi::wxd_ChildProcess_CloseInput(self.ptr) }
+    }
+
+    /// Asks the child to terminate (SIGTERM), or kills it outright with `force` (SIGKILL).
+    /// A child started as a group leader takes its whole process group with it.
+    pub fn kill(&self, force: bool) -> bool {
+        unsafe { ffi::wxd_ChildProcess_Kill(self.ptr, force, self.group_leader) }
+    }
+
+    /// Binds `callback` to the output chunks of the children reporting to `target`.
+    pub fn on_output<W, F>(target: &W, mut callback: F) -> EventToken
+    where
+        W: WxEvtHandler,
+        F: FnMut(ProcessOutputEvent) + 'static,
+    {
+        target.bind_internal(EventType::PROCESS_OUTPUT, move |event| {
+            callback(ProcessOutputEvent::new(event))
+        })
+    }
+
+    /// Binds `callback` to the exit of the children reporting to `target`.
+    pub fn on_exit<W, F>(target: &W, mut callback: F) -> EventToken
+    where
+        W: WxEvtHandler,
+        F: FnMut(ProcessExitEvent) + 'static,
+    {
+        target.bind_internal(EventType::PROCESS_EXIT, move |event| callback(ProcessExitEvent::new(event)))
+    }
+}
+
+impl Drop for ChildProcess {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_ChildProcess_Destroy(self.ptr) };
+    }
+}
+
+/// Builder for [`ChildProcess`].
+#[derive(Debug, Clone)]
+pub struct ChildProcessBuilder {
+    args: Vec<String>,
+    current_dir: Option<PathBuf>,
+    hide_console: bool,
+    group_leader: bool,
+    poll_interval: Option<Duration>,
+}
+
+impl ChildProcessBuilder {
+    pub fn arg(mut self, arg: impl AsRef<OsStr>) -> Self {
+        self.args.push(arg.as_ref().to_string_lossy().into_owned());
+        self
+    }
+
+    pub fn args<I, S>(mut self, args: I) -> Self
+    where
+        I: IntoIterator<Item = S>,
+        S: AsRef<OsStr>,
+    {
+        self.args
+            .extend(args.into_iter().map(|a| a.as_ref().to_string_lossy().into_owned()));
+        self
+    }
+
+    /// Runs the child in `dir` instead of the current directory.
+    pub fn current_dir(mut self, dir: impl AsRef<Path>) -> Self {
+        self.current_dir = Some(dir.as_ref().to_path_buf());
+        self
+    }
+
+    /// Does not show a console window for console programs (Windows).
+    pub fn hide_console(mut self, hide: bool) -> Self {
+        self.hide_console = hide;
+        self
+    }
+
+    /// Starts the child in a new process group, so [`ChildProcess::kill`] also stops the
+    /// processes it spawns.
+    pub fn group_leader(mut self, group_leader: bool) -> Self {
+        self.group_leader = group_leader;
+        self
+    }
+
+    /// How often the pipes are polled; 50 ms by default.
+    pub fn poll_interval(mut self, interval: Duration) -> Self {
+        self.poll_interval = Some(interval);
+        self
+    }
+
+    /// Launches the child, sending its events to `target`. Returns `None` if it could not be
+    /// started or an argument contains a NUL byte.
+    pub fn spawn<T: WxEvtHandler>(self, target: &T) -> Option<ChildProcess> {
+        let handler = unsafe { target.get_event_handler_ptr() };
+        if handler.is_null() {
+            return None;
+        }
+        let args = self
+            .args
+            .iter()
+            .map(|arg| CString::new(arg.as_str()))
+            .collect::<Result<Vec<_>, _>>()
+            .ok()?;
+        let arg_ptrs: Vec<*const std::os::raw::c_char> = args.iter().map(|arg| arg.as_ptr()).collect();
+        let cwd = match &self.current_dir {
+            Some(dir) => Some(CString::new(dir.to_str()?).ok()?),
+            None => None,
+        };
+        let mut flags = 0;
+        if self.hide_console {
+            flags |= ffi::wxd_ProcessFlags_WXD_PROCESS_HIDE_CONSOLE as i32;
+        }
+        if self.group_leader {
+            flags |= ffi::wxd_ProcessFlags_WXD_PROCESS_GROUP_LEADER as i32;
+        }
+        let ptr = unsafe {
+            ffi::wxd_ChildProcess_Spawn(
+                handler,
+                arg_ptrs.as_ptr(),
+                arg_ptrs.len(),
+                cwd.as_ref().map_or(std::ptr::null(), |c| c.as_ptr()),
+                flags,
+                self.poll_interval.map_or(0, duration_ms),
+            )
+        };
+        (!ptr.is_null()).then_some(ChildProcess {
+            ptr,
+            group_leader: self.group_leader,
+            _nosend_nosync: PhantomData,
+        })
+    }
+}
+
+fn duration_ms(duration: Duration) -> i32 {
+    duration.as_millis().clamp(1, i32::MAX as u128) as i32
+}
+
+/// Event data for [`ChildProcess::on_output`]: a chunk of whole lines from one stream.
+#[derive(Debug)]
+pub struct ProcessOutputEvent {
+    /// The base event.
+    pub event: Event,
+}
+
+impl ProcessOutputEvent {
+    /// Creates a new `ProcessOutputEvent` from a base `Event`.
+    pub fn new(event: Event) -> Self {
+        Self { event }
+    }
+
+    /// The pid of the child that wrote the output.
+    pub fn pid(&self) -> u32 {
+        unsafe { ffi::wxd_ChildProcessEvent_GetPid(self.event._as_ptr()) as u32 }
+    }
+
+    /// True for stderr output, false for stdout.
+    pub fn is_stderr(&self) -> bool {
+        unsafe { ffi::wxd_ChildProcessEvent_IsStderr(self.event._as_ptr()) }
+    }
+
+    /// The raw bytes of the chunk. They end with a newline except for the child's final
+    /// output and for pieces of lines longer than 64 KiB.
+    pub fn data(&self) -> Vec<u8> {
+        let ptr = self.event._as_ptr();
+        let len = unsafe { ffi::wxd_ChildProcessEvent_GetData(ptr, std::ptr::null_mut(), 0) };
+        let mut data = vec![0u8; len];
+        unsafe { ffi::wxd_ChildProcessEvent_GetData(ptr, data.as_mut_ptr(), len) };
+        data
+    }
+
+    /// The chunk as text, with invalid UTF-8 replaced.
+    pub fn text(&self) -> String {
+        String::from_utf8_lossy(&self.data()).into_owned()
+    }
+
+    /// The lines of the chunk without their line endings.
+    pub fn lines(&self) -> Vec<String> {
+        self.text().lines().map(str::to_owned).collect()
+    }
+}
+
+/// Event data for [`ChildProcess::on_exit`].
+#[derive(Debug)]
+pub struct ProcessExitEvent {
+    /// The base event.
+    pub event: Event,
+}
+
+impl ProcessExitEvent {
+    /// Creates a new `ProcessExitEvent` from a base `Event`.
+    pub fn new(event: Event) -> Self {
+        Self { event }
+    }
+
+    /// The pid of the child that exited.
+    pub fn pid(&self) -> u32 {
+        unsafe { ffi::wxd_ChildProcessEvent_GetPid(self.event._as_ptr()) as u32 }
+    }
+
+    /// The child's exit code (-1 if it could not be determined).
+    pub fn exit_code(&self) -> i32 {
+        unsafe { ffi::wxd_ChildProcessEvent_GetExitCode(self.event._as_ptr()) }
+    }
+}
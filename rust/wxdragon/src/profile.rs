@@ -0,0 +1,312 @@
+//! FFI call profiler, live object accounting, per-window paint/layout timing and startup phases.
+//!
+//! Build with the `ffi-profile` feature (GCC/Clang only) to instrument every function in the
+//! native wxDragon library with a per-thread call counter and inclusive timer. The snapshot shows
+//! which `wxd_*` entry points dominate frame time without an external profiler.
+//!
+//! ```rust,no_run
+//! for entry in wxdragon::profile::snapshot().iter().take(10) {
+//!     println!("{:>10} calls {:>10.3?} {}", entry.calls, entry.total, entry.display_name());
+//! }
+//! ```
+//!
+//! Build with the `object-stats` feature to count live native objects (bitmaps, variants, tree
+//! item ids, event handlers and bound closures) for leak and memory trending:
+//!
+//! ```rust,no_run
+//! for row in wxdragon::profile::object_stats() {
+//!     println!("{:<14} live {:>8} peak {:>8} {:>10} bytes", row.name, row.live, row.high_water, row.live_bytes);
+//! }
+//! ```
+//!
+//! Per-window paint, size and layout timing needs no feature; switch it on at runtime and poll
+//! the table, e.g. once a second, to find the windows that dominate frame time:
+//!
+//! ```rust,no_run
+//! use std::time::Duration;
+//! wxdragon::profile::enable_window_timings(true);
+//! wxdragon::profile::set_window_timing_budget(Some(Duration::from_millis(8)));
+//! // ... later ...
+//! for row in wxdragon::profile::window_timings(true).iter().take(5) {
+//!     println!("{:?} {} \"{}\" {}x {:?} (max {:?})", row.kind, row.class_name, row.window_name, row.count, row.total, row.max);
+//! }
+//! ```
+//!
+//! Startup milestones are always recorded:
+//!
+//! ```rust,no_run
+//! let startup = wxdragon::profile::startup_timings();
+//! println!("toolkit {:?}, on-init {:?}, first paint {:?}", startup.toolkit_ready, startup.rust_init(), startup.first_paint);
+//! ```
+
+use std::ffi::CStr;
+use std::time::Duration;
+use wxdragon_sys as ffi;
+
+/// Totals for one native function, merged across threads.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct ProfileEntry {
+    /// Symbol name, when the platform can resolve it (requires exported symbols on Linux).
+    pub name: Option<String>,
+    /// Code address of the function; resolve with `addr2line` if `name` is `None`.
+    pub address: usize,
+    /// Number of calls.
+    pub calls: u64,
+    /// Inclusive wall time across all calls.
+    pub total: Duration,
+}
+
+impl ProfileEntry {
+    /// The symbol name, or the address formatted as hex.
+    pub fn display_name(&self) -> String {
+        self.name.clone().unwrap_or_else(|| format!("{:#x}", self.address))
+    }
+}
+
+/// Whether the native library was built with the profiler.
+pub fn is_enabled() -> bool {
+    unsafe { ffi::wxd_Profile_IsEnabled() }
+}
+
+/// Returns per-function totals, sorted by total time (descending). Empty unless [`is_enabled`].
+pub fn snapshot() -> Vec<ProfileEntry> {
+    let available = unsafe { ffi::wxd_Profile_Snapshot(std::ptr::null_mut(), 0) };
+    if available == 0 {
+        return Vec::new();
+    }
+    // Leave room for functions first called between the sizing call and the copy.
+    let mut raw: Vec<ffi::wxd_ProfileEntry> = Vec::with_capacity(available + 64);
+    let written = unsafe { ffi::wxd_Profile_Snapshot(raw.as_mut_ptr(), raw.capacity()) };
+    unsafe { raw.set_len(written.min(raw.capacity())) };
+
+    let mut entries: Vec<ProfileEntry> = raw
+        .iter()
+        .map(|e| ProfileEntry {
+            name: (!e.name.is_null()).then(|| unsafe { CStr::from_ptr(e.name) }.to_string_lossy().into_owned()),
+            address: e.function as usize,
+            calls: e.calls,
+            total: Duration::from_nanos(e.total_nanos),
+        })
+        .collect();
+    entries.sort_by(|a, b| b.total.cmp(&a.total));
+    entries
+}
+
+/// Resets all counters, e.g. before measuring a single frame or interaction.
+pub fn reset() {
+    unsafe { ffi::wxd_Profile_Reset() };
+}
+
+/// Native object kinds counted by [`object_stats`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum ObjectKind {
+    /// Bitmaps handed out by the library; bytes are approximate pixel memory.
+    Bitmap,
+    /// Tree control item ids.
+    TreeItemId,
+    /// Variants (DataView, PropertyGrid and event values).
+    Variant,
+    /// Per-window event dispatch tables.
+    EventHandler,
+    /// Rust closures bound to events.
+    EventClosure,
+}
+
+impl ObjectKind {
+    fn from_raw(raw: i32) -> Option<Self> {
+        // The C enum's Rust type differs between platforms, so compare as i32.
+        [
+            (ffi::wxd_ObjectKind_WXD_OBJECT_KIND_BITMAP as i32, Self::Bitmap),
+            (ffi::wxd_ObjectKind_WXD_OBJECT_KIND_TREE_ITEM_ID as i32, Self::TreeItemId),
+            (ffi::wxd_ObjectKind_WXD_OBJECT_KIND_VARIANT as i32, Self::Variant),
+            (ffi::wxd_ObjectKind_WXD_OBJECT_KIND_EVENT_HANDLER as i32, Self::EventHandler),
+            (ffi::wxd_ObjectKind_WXD_OBJECT_KIND_EVENT_CLOSURE as i32, Self::EventClosure),
+        ]
+        .into_iter()
+        .find_map(|(value, kind)| (value == raw).then_some(kind))
+    }
+}
+
+/// Live counts for one [`ObjectKind`].
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct ObjectStats {
+    pub kind: ObjectKind,
+    /// Short name, e.g. `"Bitmap"`, suitable as a telemetry key.
+    pub name: &'static str,
+    pub live: u64,
+    /// Highest live count since start or [`reset_object_high_water`].
+    pub high_water: u64,
+    /// Total created since start.
+    pub created: u64,
+    /// Approximate native memory held by live objects.
+    pub live_bytes: u64,
+    pub high_water_bytes: u64,
+}
+
+/// Whether the native library was built with object accounting (`object-stats` feature).
+pub fn object_accounting_enabled() -> bool {
+    unsafe { ffi::wxd_Debug_IsObjectAccountingEnabled() }
+}
+
+/// Returns one row per [`ObjectKind`]. Empty unless [`object_accounting_enabled`]. Callable
+/// from any thread.
+pub fn object_stats() -> Vec<ObjectStats> {
+    let count = unsafe { ffi::wxd_Debug_GetObjectStats(std::ptr::null_mut(), 0) };
+    if count == 0 {
+        return Vec::new();
+    }
+    let mut raw: Vec<ffi::wxd_ObjectStats> = Vec::with_capacity(count);
+    let written = unsafe { ffi::wxd_Debug_GetObjectStats(raw.as_mut_ptr(), count) };
+    unsafe { raw.set_len(written.min(count)) };
+    raw.iter()
+        .filter_map(|r| {
+            let kind = ObjectKind::from_raw(r.kind)?;
+            let name = if r.name.is_null() {
+                ""
+            } else {
+                // Names are static strings in the native library.
+                unsafe { CStr::from_ptr(r.name) }.to_str().unwrap_or("")
+            };
+            Some(ObjectStats {
+                kind,
+                name,
+                live: r.live,
+                high_water: r.high_water,
+                created: r.created,
+                live_bytes: r.live_bytes,
+                high_water_bytes: r.high_water_bytes,
+            })
+        })
+        .collect()
+}
+
+/// Lowers every high-water mark to the current live value.
+pub fn reset_object_high_water() {
+    unsafe { ffi::wxd_Debug_ResetObjectHighWater() };
+}
+
+/// What a [`WindowTiming`] row measures.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum WindowTimingKind {
+    /// Paint handlers bound through wxDragon.
+    Paint,
+    /// Size handlers bound through wxDragon.
+    Size,
+    /// `Layout()` run by wxDragon (`layout()`, layout batches, notebook pages, widget trees).
+    Layout,
+}
+
+impl WindowTimingKind {
+    fn from_raw(raw: i32) -> Option<Self> {
+        [
+            (ffi::wxd_WindowTimingKind_WXD_WINDOW_TIMING_PAINT as i32, Self::Paint),
+            (ffi::wxd_WindowTimingKind_WXD_WINDOW_TIMING_SIZE as i32, Self::Size),
+            (ffi::wxd_WindowTimingKind_WXD_WINDOW_TIMING_LAYOUT as i32, Self::Layout),
+        ]
+        .into_iter()
+        .find_map(|(value, kind)| (value == raw).then_some(kind))
+    }
+}
+
+/// Accumulated time for one window class and name.
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct WindowTiming {
+    /// wxWidgets class name, e.g. `"wxPanel"`.
+    pub class_name: String,
+    /// Window name as set at creation; many windows share the default.
+    pub window_name: String,
+    pub kind: WindowTimingKind,
+    pub count: u64,
+    pub total: Duration,
+    pub max: Duration,
+    /// Measurements longer than the budget set with [`set_window_timing_budget`].
+    pub over_budget: u64,
+}
+
+/// Starts or stops recording paint, size and layout durations. Off by default.
+pub fn enable_window_timings(enable: bool) {
+    unsafe { ffi::wxd_Debug_EnableWindowTimings(enable) };
+}
+
+/// Logs a warning for every single paint, size or layout slower than `budget`. `None` stops
+/// the log.
+pub fn set_window_timing_budget(budget: Option<Duration>) {
+    let us = budget.map_or(0, |b| b.as_micros().clamp(1, u32::MAX as u128) as u32);
+    unsafe { ffi::wxd_Debug_SetWindowTimingBudget(us) };
+}
+
+/// Returns the recorded rows, slowest total first. With `reset` the table is cleared, so
+/// calling this at a fixed interval gives a rolling window. Callable from any thread.
+pub fn window_timings(reset: bool) -> Vec<WindowTiming> {
+    let count = unsafe { ffi::wxd_Debug_GetWindowTimings(std::ptr::null_mut(), 0, false) };
+    if count == 0 && !reset {
+        return Vec::new();
+    }
+    // Leave room for rows added between the two calls; a reset would otherwise drop them.
+    let capacity = count + 16;
+    let mut raw: Vec<ffi::wxd_WindowTiming> = Vec::with_capacity(capacity);
+    let available = unsafe { ffi::wxd_Debug_GetWindowTimings(raw.as_mut_ptr(), capacity, reset) };
+    unsafe { raw.set_len(available.min(capacity)) };
+    raw.iter()
+        .filter_map(|r| {
+            let kind = WindowTimingKind::from_raw(r.kind)?;
+            let text = |chars: &[std::os::raw::c_char]| {
+                let bytes: Vec<u8> = chars.iter().take_while(|&&c| c != 0).map(|&c| c as u8).collect();
+                String::from_utf8_lossy(&bytes).into_owned()
+            };
+            Some(WindowTiming {
+                class_name: text(&r.class_name),
+                window_name: text(&r.window_name),
+                kind,
+                count: r.count,
+                total: Duration::from_nanos(r.total_nanos),
+                max: Duration::from_nanos(r.max_nanos),
+                over_budget: r.over_budget,
+            })
+        })
+        .collect()
+}
+
+/// Time from entering [`main`](crate::main) to each startup milestone; `None` for milestones
+/// not reached yet. Recorded in every build.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub struct StartupTimings {
+    /// wxWidgets initialized.
+    pub toolkit_ready: Option<Duration>,
+    /// The native `OnInit` entered.
+    pub on_init_begin: Option<Duration>,
+    /// The closure passed to `main` called.
+    pub rust_init_begin: Option<Duration>,
+    /// The closure passed to `main` returned.
+    pub rust_init_end: Option<Duration>,
+    /// The first window painted.
+    pub first_paint: Option<Duration>,
+    /// The event loop went idle for the first time.
+    pub first_idle: Option<Duration>,
+    /// Image format handlers registered, on first image load or after the first paint.
+    pub image_handlers: Option<Duration>,
+}
+
+impl StartupTimings {
+    /// Time spent in the closure passed to `main`.
+    pub fn rust_init(&self) -> Option<Duration> {
+        Some(self.rust_init_end?.saturating_sub(self.rust_init_begin?))
+    }
+}
+
+/// Where the cold start went. Callable from any thread, e.g. once the first window is up.
+pub fn startup_timings() -> StartupTimings {
+    let phase = |phase: ffi::wxd_StartupPhase| {
+        let micros = unsafe { ffi::wxd_Debug_GetStartupPhaseMicros(phase as i32) };
+        u64::try_from(micros).ok().map(Duration::from_micros)
+    };
+    StartupTimings {
+        toolkit_ready: phase(ffi::wxd_StartupPhase_WXD_STARTUP_ENTRY_START_DONE),
+        on_init_begin: phase(ffi::wxd_StartupPhase_WXD_STARTUP_ONINIT_BEGIN),
+        rust_init_begin: phase(ffi::wxd_StartupPhase_WXD_STARTUP_RUST_INIT_BEGIN),
+        rust_init_end: phase(ffi::wxd_StartupPhase_WXD_STARTUP_RUST_INIT_END),
+        first_paint: phase(ffi::wxd_StartupPhase_WXD_STARTUP_FIRST_PAINT),
+        first_idle: phase(ffi::wxd_StartupPhase_WXD_STARTUP_FIRST_IDLE),
+        image_handlers: phase(ffi::wxd_StartupPhase_WXD_STARTUP_IMAGE_HANDLERS),
+    }
+}
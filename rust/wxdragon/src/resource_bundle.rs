@@ -0,0 +1,197 @@
+//! Memory-mapped resource bundles.
+//!
+//! A [`ResourceBundle`] is a single archive of named assets (SVG icons, XRC, `.mo` catalogs, web
+//! content) that is memory-mapped at startup. Assets are then looked up by binary search and
+//! read in place, so a cold start costs one `mmap` instead of an open and read per file. Build
+//! the archive with [`ResourceBundleWriter`], typically from a build script.
+//!
+//! ```rust,no_run
+//! # use wxdragon::prelude::*;
+//! let resources = ResourceBundle::open("app.wxdpack", "app").expect("missing resources");
+//! let icon = resources.svg_bundle("icons/open.svg", Size::new(16, 16));
+//! // Any wxFileSystem user can read entries through their URL:
+//! let url = resources.url("ui/main.xrc"); // "wxdres:app/ui/main.xrc"
+//! ```
+
+use crate::bitmap_bundle::BitmapBundle;
+use crate::geometry::Size;
+use crate::utils::ArrayString;
+use std::collections::BTreeMap;
+use std::ffi::CString;
+use std::io::{self, Write};
+use std::path::Path;
+use std::rc::Rc;
+use wxdragon_sys as ffi;
+
+const MAGIC: &[u8; 8] = b"WXDPACK1";
+const HEADER_SIZE: u64 = 16;
+const ENTRY_SIZE: u64 = 24;
+const DATA_ALIGN: u64 = 8;
+
+struct Inner {
+    ptr: *mut ffi::wxd_ResourceBundle_t,
+    mount: String,
+}
+
+impl Drop for Inner {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_ResourceBundle_Close(self.ptr) };
+    }
+}
+
+/// An open, memory-mapped resource archive, mounted on wxFileSystem as
+/// `wxdres:<mount>/<name>` while any clone of it is alive.
+///
+/// Clones share the mapping. Entries returned by [`get`](Self::get) borrow from it directly.
+#[derive(Clone)]
+pub struct ResourceBundle {
+    inner: Rc<Inner>,
+}
+
+impl ResourceBundle {
+    /// Maps the archive at `path` and mounts it under `mount` (letters, digits, `_`, `-` and
+    /// `.`), replacing any bundle mounted under the same name. Returns `None` if the file is
+    /// missing or not a valid archive.
+    pub fn open(path: impl AsRef<Path>, mount: &str) -> Option<Self> {
+        let c_path = CString::new(path.as_ref().to_str()?).ok()?;
+        let c_mount = CString::new(mount).ok()?;
+        let ptr = unsafe { ffi::wxd_ResourceBundle_Open(c_path.as_ptr(), c_mount.as_ptr()) };
+        (!ptr.is_null()).then(|| Self {
+            inner: Rc::new(Inner {
+                ptr,
+                mount: mount.to_owned(),
+            }),
+        })
+    }
+
+    pub fn mount(&self) -> &str {
+        &self.inner.mount
+    }
+
+    pub fn len(&self) -> usize {
+        unsafe { ffi::wxd_ResourceBundle_GetCount(self.inner.ptr) }
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    /// The entry names in sorted order.
+    pub fn names(&self) -> Vec<String> {
+        let mut names = ArrayString::new();
+        unsafe { ffi::wxd_ResourceBundle_GetNames(self.inner.ptr, names.as_mut_ptr()) };
+        names.into()
+    }
+
+    /// The bytes of entry `name`, read in place from the mapping.
+    pub fn get(&self, name: &str) -> Option<&[u8]> {
+        let c_name = CString::new(name).ok()?;
+        let mut data = std::ptr::null();
+        let mut len = 0usize;
+        if !unsafe { ffi::wxd_ResourceBundle_Find(self.inner.ptr, c_name.as_ptr(), &mut data, &mut len) } {
+            return None;
+        }
+        if len == 0 {
+            return Some(&[]);
+        }
+        // SAFETY: the mapping lives as long as `self.inner`, which this borrow keeps alive.
+        Some(unsafe { std::slice::from_raw_parts(data, len) })
+    }
+
+    /// The wxFileSystem location of entry `name`, for XRC, wxHTML and other consumers.
+    pub fn url(&self, name: &str) -> String {
+        format!("wxdres:{}/{}", self.inner.mount, name)
+    }
+
+    /// Creates a bitmap bundle from the SVG entry `name` without copying it out of the mapping.
+    pub fn svg_bundle(&self, name: &str, default_size: Size) -> Option<BitmapBundle> {
+        BitmapBundle::from_svg_data(self.get(name)?, default_size)
+    }
+
+    pub(crate) fn as_ptr(&self) -> *const ffi::wxd_ResourceBundle_t {
+        self.inner.ptr
+    }
+}
+
+/// Builds a [`ResourceBundle`] archive. Entries are stored uncompressed and sorted by name;
+/// adding a name twice keeps the last data.
+///
+/// ```rust,no_run
+/// # use wxdragon::prelude::*;
+/// # fn main() -> std::io::Result<()> {
+/// let mut writer = ResourceBundleWriter::new();
+/// writer.add_file("icons/open.svg", "assets/open.svg")?;
+/// writer.add("ui/main.xrc", std::fs::read("assets/main.xrc")?);
+/// writer.write_to_file("app.wxdpack")?;
+/// # Ok(())
+/// # }
+/// ```
+#[derive(Debug, Default, Clone)]
+pub struct ResourceBundleWriter {
+    entries: BTreeMap<String, Vec<u8>>,
+}
+
+impl ResourceBundleWriter {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Adds an entry; `name` uses `/` as separator.
+    pub fn add(&mut self, name: impl Into<String>, data: impl Into<Vec<u8>>) -> &mut Self {
+        self.entries.insert(name.into(), data.into());
+        self
+    }
+
+    /// Adds the contents of the file at `path` as `name`.
+    pub fn add_file(&mut self, name: impl Into<String>, path: impl AsRef<Path>) -> io::Result<&mut Self> {
+        let data = std::fs::read(path)?;
+        Ok(self.add(name, data))
+    }
+
+    /// Writes the archive to `out`.
+    pub fn write<W: Write>(&self, out: &mut W) -> io::Result<()> {
+        let too_large = || io::Error::new(io::ErrorKind::InvalidInput, "resource bundle too large");
+        let count = u32::try_from(self.entries.len()).map_err(|_| too_large())?;
+        let names_size: usize = self.entries.keys().map(String::len).sum();
+        let names_size = u32::try_from(names_size).map_err(|_| too_large())?;
+
+        // Entry data starts aligned after the name table.
+        let align = |offset: u64| offset.div_ceil(DATA_ALIGN) * DATA_ALIGN;
+        let mut data_offset = align(HEADER_SIZE + u64::from(count) * ENTRY_SIZE + u64::from(names_size));
+
+        let mut header = Vec::with_capacity((HEADER_SIZE + u64::from(count) * ENTRY_SIZE) as usize);
+        header.extend_from_slice(MAGIC);
+        header.extend_from_slice(&count.to_le_bytes());
+        header.extend_from_slice(&names_size.to_le_bytes());
+        let mut name_offset = 0u32;
+        let mut offsets = Vec::with_capacity(self.entries.len());
+        for (name, data) in &self.entries {
+            header.extend_from_slice(&data_offset.to_le_bytes());
+            header.extend_from_slice(&(data.len() as u64).to_le_bytes());
+            header.extend_from_slice(&name_offset.to_le_bytes());
+            header.extend_from_slice(&(name.len() as u32).to_le_bytes());
+            offsets.push(data_offset);
+            name_offset += name.len() as u32;
+            data_offset = align(data_offset + data.len() as u64);
+        }
+        out.write_all(&header)?;
+        for name in self.entries.keys() {
+            out.write_all(name.as_bytes())?;
+        }
+
+        let mut position = HEADER_SIZE + u64::from(count) * ENTRY_SIZE + u64::from(names_size);
+        for (data, offset) in self.entries.values().zip(offsets) {
+            out.write_all(&vec![0u8; (offset - position) as usize])?;
+            out.write_all(data)?;
+            position = offset + data.len() as u64;
+        }
+        Ok(())
+    }
+
+    /// Writes the archive to the file at `path`.
+    pub fn write_to_file(&self, path: impl AsRef<Path>) -> io::Result<()> {
+        let mut file = io::BufWriter::new(std::fs::File::create(path)?);
+        self.write(&mut file)?;
+        file.flush()
+    }
+}
@@ -0,0 +1,235 @@
+//! Non-blocking TCP sockets driven by the GUI event loop.
+//!
+//! The event loop watches the sockets, and readiness arrives at a target handler as
+//! [`SocketEvent`]s, so streaming network I/O needs neither a second async runtime nor a hop
+//! across threads per message. Reads copy straight from the socket into the caller's buffer.
+//!
+//! ```rust,no_run
+//! use std::io::{ErrorKind, Read, Write};
+//! use wxdragon::prelude::*;
+//!
+//! # fn run(frame: &Frame) {
+//! const ID: i32 = 7001;
+//! let socket = Socket::connect(frame, ID, "127.0.0.1", 8080).unwrap();
+//! let mut buf = vec![0u8; 64 * 1024];
+//! Socket::on_event(frame, move |event| match event.notify() {
+//!     Some(SocketNotify::Connection) => {
+//!         let _ = (&socket).write(b"hello\n");
+//!     }
+//!     Some(SocketNotify::Input) => loop {
+//!         match (&socket).read(&mut buf) {
+//!             Ok(0) => break,
+//!             Ok(n) => println!("{} bytes", n),
+//!             Err(e) if e.kind() == ErrorKind::WouldBlock => break,
+//!             Err(_) => break,
+//!         }
+//!     },
+//!     _ => {}
+//! });
+//! # }
+//! ```
+
+use crate::event::{Event, EventToken, EventType, WxEvtHandler};
+use std::ffi::{CString, c_char};
+use std::io;
+use std::marker::PhantomData;
+use std::rc::Rc;
+use wxdragon_sys as ffi;
+
+/// What a [`SocketEvent`] reports.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub enum SocketNotify {
+    /// Data can be read.
+    Input,
+    /// Writing can resume after a short write.
+    Output,
+    /// A client connected, or a server has a connection to [`accept`](SocketServer::accept).
+    Connection,
+    /// The peer closed the connection, or connecting failed.
+    Lost,
+}
+
+/// Event data for [`Socket::on_event`].
+#[derive(Debug)]
+pub struct SocketEvent {
+    /// The base event.
+    pub event: Event,
+}
+
+impl SocketEvent {
+    /// Creates a new `SocketEvent` from a base `Event`.
+    pub fn new(event: Event) -> Self {
+        Self { event }
+    }
+
+    /// The id the socket was created or accepted with.
+    pub fn id(&self) -> i32 {
+        self.event.get_id()
+    }
+
+    pub fn notify(&self) -> Option<SocketNotify> {
+        let notify = unsafe { ffi::wxd_SocketEvent_GetNotify(self.event._as_ptr()) };
+        match notify {
+            n if n == ffi::wxd_SocketNotify_WXD_SOCKET_INPUT as i32 => Some(SocketNotify::Input),
+            n if n == ffi::wxd_SocketNotify_WXD_SOCKET_OUTPUT as i32 => Some(SocketNotify::Output),
+            n if n == ffi::wxd_SocketNotify_WXD_SOCKET_CONNECTION as i32 => Some(SocketNotify::Connection),
+            n if n == ffi::wxd_SocketNotify_WXD_SOCKET_LOST as i32 => Some(SocketNotify::Lost),
+            _ => None,
+        }
+    }
+}
+
+/// A non-blocking TCP connection whose readiness is reported through [`SocketEvent`]s.
+///
+/// `Read` and `Write` are implemented for `&Socket`: reads return `Ok(0)` once the connection
+/// is closed and `WouldBlock` when no data is available yet; writes may be short, and a
+/// [`SocketNotify::Output`] event follows once there is room again. Dropping the socket closes
+/// it.
+pub struct Socket {
+    ptr: *mut ffi::wxd_Socket_t,
+    // Sockets are watched by the GUI thread's event loop.
+    _nosend_nosync: PhantomData<Rc<()>>,
+}
+
+impl Socket {
+    /// Starts connecting to `host:port` (IPv4). Host names are resolved synchronously, so
+    /// pass an address where that could stall. The outcome arrives at `target` as
+    /// [`SocketNotify::Connection`] or [`SocketNotify::Lost`] with `id`.
+    pub fn connect<T: WxEvtHandler>(target: &T, id: i32, host: &str, port: u16) -> Option<Socket> {
+        let handler = unsafe { target.get_event_handler_ptr() };
+        let host = CString::new(host).ok()?;
+        if handler.is_null() {
+            return None;
+        }
+        let ptr = unsafe { ffi::wxd_Socket_Connect(handler, id, host.as_ptr(), port) };
+        Self::from_raw(ptr)
+    }
+
+    /// Binds `callback` to the events of the sockets reporting to `target`; tell them apart
+    /// by [`SocketEvent::id`].
+    pub fn on_event<W, F>(target: &W, mut callback: F) -> EventToken
+    where
+        W: WxEvtHandler,
+        F: FnMut(SocketEvent) + 'static,
+    {
+        target.bind_internal(EventType::SOCKET, move |event| callback(SocketEvent::new(event)))
+    }
+
+    pub fn is_connected(&self) -> bool {
+        unsafe { ffi::wxd_Socket_IsConnected(self.ptr) }
+    }
+
+    /// Shuts the connection down; no further events arrive for it.
+    pub fn close(&self) {
+        unsafe { ffi::wxd_Socket_Close(self.ptr) }
+    }
+
+    /// Disables Nagle's algorithm so small writes are sent at once.
+    pub fn set_nodelay(&self, no_delay: bool) -> bool {
+        unsafe { ffi::wxd_Socket_SetNoDelay(self.ptr, no_delay) }
+    }
+
+    pub fn peer_addr(&self) -> Option<(String, u16)> {
+        address(self.ptr, false)
+    }
+
+    pub fn local_addr(&self) -> Option<(String, u16)> {
+        address(self.ptr, true)
+    }
+
+    fn from_raw(ptr: *mut ffi::wxd_Socket_t) -> Option<Socket> {
+        (!ptr.is_null()).then_some(Socket {
+            ptr,
+            _nosend_nosync: PhantomData,
+        })
+    }
+}
+
+impl io::Read for &Socket {
+    fn read(&mut self, buf: &mut [u8]) -> io::Result<usize> {
+        match unsafe { ffi::wxd_Socket_Read(self.ptr, buf.as_mut_ptr(), buf.len()) } {
+            n if n < 0 => Ok(0),
+            0 if !buf.is_empty() => Err(io::ErrorKind::WouldBlock.into()),
+            n => Ok(n as usize),
+        }
+    }
+}
+
+impl io::Write for &Socket {
+    fn write(&mut self, buf: &[u8]) -> io::Result<usize> {
+        match unsafe { ffi::wxd_Socket_Write(self.ptr, buf.as_ptr(), buf.len()) } {
+            n if n < 0 => Err(io::ErrorKind::BrokenPipe.into()),
+            0 if !buf.is_empty() => Err(io::ErrorKind::WouldBlock.into()),
+            n => Ok(n as usize),
+        }
+    }
+
+    fn flush(&mut self) -> io::Result<()> {
+        Ok(())
+    }
+}
+
+impl Drop for Socket {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_Socket_Destroy(self.ptr) };
+    }
+}
+
+/// A listening TCP socket that raises [`SocketNotify::Connection`] for each pending client.
+pub struct SocketServer {
+    ptr: *mut ffi::wxd_Socket_t,
+    _nosend_nosync: PhantomData<Rc<()>>,
+}
+
+impl SocketServer {
+    /// Listens on `host:port`; `None` listens on all interfaces and port 0 picks a free port
+    /// (see [`local_addr`](Self::local_addr)).
+    pub fn listen<T: WxEvtHandler>(target: &T, id: i32, host: Option<&str>, port: u16) -> Option<SocketServer> {
+        let handler = unsafe { target.get_event_handler_ptr() };
+        let host = match host {
+            Some(host) => Some(CString::new(host).ok()?),
+            None => None,
+        };
+        if handler.is_null() {
+            return None;
+        }
+        let host_ptr = host.as_ref().map_or(std::ptr::null(), |h| h.as_ptr());
+        let ptr = unsafe { ffi::wxd_SocketServer_Create(handler, id, host_ptr, port) };
+        (!ptr.is_null()).then_some(SocketServer {
+            ptr,
+            _nosend_nosync: PhantomData,
+        })
+    }
+
+    /// Takes a pending connection, whose events go to `target` with `id`; `None` if no
+    /// client is waiting.
+    pub fn accept<T: WxEvtHandler>(&self, target: &T, id: i32) -> Option<Socket> {
+        let handler = unsafe { target.get_event_handler_ptr() };
+        if handler.is_null() {
+            return None;
+        }
+        Socket::from_raw(unsafe { ffi::wxd_SocketServer_Accept(self.ptr, handler, id) })
+    }
+
+    pub fn local_addr(&self) -> Option<(String, u16)> {
+        address(self.ptr, true)
+    }
+}
+
+impl Drop for SocketServer {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_Socket_Destroy(self.ptr) };
+    }
+}
+
+fn address(ptr: *mut ffi::wxd_Socket_t, local: bool) -> Option<(String, u16)> {
+    let mut port = 0u16;
+    let len = unsafe { ffi::wxd_Socket_GetAddress(ptr, local, std::ptr::null_mut(), 0, &mut port) };
+    if len == 0 {
+        return None;
+    }
+    let mut buffer = vec![0u8; len + 1];
+    unsafe { ffi::wxd_Socket_GetAddress(ptr, local, buffer.as_mut_ptr() as *mut c_char, buffer.len(), &mut port) };
+    buffer.truncate(len);
+    Some((String::from_utf8_lossy(&buffer).into_owned(), port))
+}
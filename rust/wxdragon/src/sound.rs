@@ -31,6 +31,20 @@ impl Sound {
         Self { ptr }
     }
 
+    /// Creates a sound from WAV data in memory, e.g. from `include_bytes!`.
+    pub fn from_bytes(data: &[u8]) -> Option<Self> {
+        let ptr = unsafe { ffi::wxd_Sound_CreateFromMemory(data.as_ptr() as *const _, data.len()) };
+        (!ptr.is_null()).then_some(Self { ptr })
+    }
+
+    /// Reads and decodes a WAV file now, so that playing it never touches the disk. Sounds
+    /// created with [`new`](Self::new) may reread the file on every play (as on Windows).
+    pub fn preloaded(file_name: &str) -> Option<Self> {
+        let c_file = CString::new(file_name).ok()?;
+        let ptr = unsafe { ffi::wxd_Sound_CreatePreloaded(c_file.as_ptr()) };
+        (!ptr.is_null()).then_some(Self { ptr })
+    }
+
     /// Returns true if the sound was created successfully.
     pub fn is_ok(&self) -> bool {
         if self.ptr.is_null() {
@@ -71,3 +85,85 @@ impl Drop for Sound {
 }
 
 unsafe impl Send for Sound {}
+
+/// Named sounds decoded ahead of time, for UI feedback that plays without delay.
+///
+/// Files are read on a background thread and become playable once the event loop has run;
+/// playing a sound that is still loading does nothing. Use from the main thread.
+///
+/// ```rust,no_run
+/// use wxdragon::prelude::*;
+///
+/// # fn setup(error_wav: &[u8]) {
+/// let sounds = SoundPool::new();
+/// sounds.load_file("click", "sounds/click.wav");
+/// sounds.add_bytes("error", error_wav);
+/// // ... in an event handler:
+/// sounds.play("click");
+/// # }
+/// ```
+pub struct SoundPool {
+    ptr: *mut ffi::wxd_SoundPool_t,
+}
+
+impl SoundPool {
+    pub fn new() -> Self {
+        Self {
+            ptr: unsafe { ffi::wxd_SoundPool_Create() },
+        }
+    }
+
+    /// Starts loading `file_name` under `key`, replacing the sound with that key once loaded.
+    pub fn load_file(&self, key: &str, file_name: &str) {
+        let (Ok(c_key), Ok(c_file)) = (CString::new(key), CString::new(file_name)) else {
+            return;
+        };
+        unsafe { ffi::wxd_SoundPool_LoadFileAsync(self.ptr, c_key.as_ptr(), c_file.as_ptr()) }
+    }
+
+    /// Adds WAV data under `key` right away. Returns false if it does not decode.
+    pub fn add_bytes(&self, key: &str, data: &[u8]) -> bool {
+        let Ok(c_key) = CString::new(key) else {
+            return false;
+        };
+        unsafe { ffi::wxd_SoundPool_AddFromMemory(self.ptr, c_key.as_ptr(), data.as_ptr() as *const _, data.len()) }
+    }
+
+    pub fn is_loaded(&self, key: &str) -> bool {
+        let Ok(c_key) = CString::new(key) else {
+            return false;
+        };
+        unsafe { ffi::wxd_SoundPool_IsLoaded(self.ptr, c_key.as_ptr()) }
+    }
+
+    /// Plays the sound under `key` without waiting for it. Returns false if it is not loaded.
+    pub fn play(&self, key: &str) -> bool {
+        self.play_with(key, SoundFlags::Async)
+    }
+
+    /// Like [`play`](Self::play); [`SoundFlags::Loop`] repeats it until [`Sound::stop`].
+    pub fn play_with(&self, key: &str, flags: SoundFlags) -> bool {
+        let Ok(c_key) = CString::new(key) else {
+            return false;
+        };
+        unsafe { ffi::wxd_SoundPool_Play(self.ptr, c_key.as_ptr(), flags.bits() as u32) }
+    }
+
+    pub fn remove(&self, key: &str) {
+        if let Ok(c_key) = CString::new(key) {
+            unsafe { ffi::wxd_SoundPool_Remove(self.ptr, c_key.as_ptr()) }
+        }
+    }
+}
+
+impl Default for SoundPool {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl Drop for SoundPool {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_SoundPool_Destroy(self.ptr) };
+    }
+}
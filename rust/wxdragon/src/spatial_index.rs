@@ -0,0 +1,177 @@
+//! Native spatial index for hit-testing custom-drawn content.
+
+use crate::event::{Event, EventToken, EventType, WxEvtHandler};
+use crate::geometry::{Point, Rect};
+use crate::window::WxWidget;
+use std::marker::PhantomData;
+use std::rc::Rc;
+use wxdragon_sys as ffi;
+
+/// Bounding boxes with `i64` ids in a native uniform grid, so hit-testing thousands of shapes
+/// visits only the items near the query instead of scanning them all.
+///
+/// Items inserted later are on top, and queries return ids topmost first. Bounds are only
+/// boxes; refine hits against the exact shape in Rust if needed.
+///
+/// Attached to a window with [`SpatialIndex::attach`], the index follows the mouse natively and
+/// sends a hover-changed event only when the topmost item under the pointer changes, instead of
+/// a Rust callback for every motion event (see [`SpatialIndex::on_hover_changed`]).
+///
+/// # Example
+/// ```rust,no_run
+/// use wxdragon::prelude::*;
+/// # let canvas = Panel::builder(&Frame::builder().build()).build();
+/// let index = SpatialIndex::new(64);
+/// index.insert(1, Rect::new(10, 10, 100, 40));
+/// index.insert(2, Rect::new(50, 20, 80, 80));
+/// assert_eq!(index.hit_test(Point::new(60, 30)), Some(2));
+///
+/// index.attach(&canvas);
+/// SpatialIndex::on_hover_changed(&canvas, move |event| {
+///     println!("now over {:?}, was {:?}", event.item(), event.previous_item());
+/// });
+/// ```
+pub struct SpatialIndex {
+    ptr: *mut ffi::wxd_SpatialIndex_t,
+    // Attached windows share the index with the GUI thread's event handlers.
+    _nosend_nosync: PhantomData<Rc<()>>,
+}
+
+impl SpatialIndex {
+    /// Creates an empty index with a grid pitch of `cell_size` pixels (0 for the default of 64).
+    /// About the size of a typical item works best.
+    pub fn new(cell_size: i32) -> Self {
+        let ptr = unsafe { ffi::wxd_SpatialIndex_Create(cell_size) };
+        assert!(!ptr.is_null(), "wxd_SpatialIndex_Create returned null");
+        SpatialIndex {
+            ptr,
+            _nosend_nosync: PhantomData,
+        }
+    }
+
+    /// Adds `id` on top of all items, or moves an existing `id` to `bounds` and to the top.
+    pub fn insert(&self, id: i64, bounds: Rect) {
+        unsafe { ffi::wxd_SpatialIndex_Insert(self.ptr, id, bounds.into()) }
+    }
+
+    /// Moves `id` to `bounds`, keeping its stacking order. Returns false if it is not present.
+    pub fn update(&self, id: i64, bounds: Rect) -> bool {
+        unsafe { ffi::wxd_SpatialIndex_Update(self.ptr, id, bounds.into()) }
+    }
+
+    /// Removes `id`. Returns false if it was not present.
+    pub fn remove(&self, id: i64) -> bool {
+        unsafe { ffi::wxd_SpatialIndex_Remove(self.ptr, id) }
+    }
+
+    /// Removes all items.
+    pub fn clear(&self) {
+        unsafe { ffi::wxd_SpatialIndex_Clear(self.ptr) }
+    }
+
+    /// Number of items in the index.
+    pub fn len(&self) -> usize {
+        unsafe { ffi::wxd_SpatialIndex_GetCount(self.ptr) }
+    }
+
+    /// Returns true if the index has no items.
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    /// The topmost item whose bounds contain `pt`.
+    pub fn hit_test(&self, pt: Point) -> Option<i64> {
+        let mut id = 0i64;
+        let found = unsafe { ffi::wxd_SpatialIndex_HitTest(self.ptr, ffi::wxd_Point { x: pt.x, y: pt.y }, &mut id) };
+        found.then_some(id)
+    }
+
+    /// All items whose bounds contain `pt`, topmost first.
+    pub fn query_point(&self, pt: Point) -> Vec<i64> {
+        let pt = ffi::wxd_Point { x: pt.x, y: pt.y };
+        self.collect(|ids, capacity| unsafe { ffi::wxd_SpatialIndex_QueryPoint(self.ptr, pt, ids, capacity) })
+    }
+
+    /// All items whose bounds intersect `area`, topmost first, e.g. for rubber-band selection or
+    /// to find what a repaint of `area` has to draw.
+    pub fn query_rect(&self, area: Rect) -> Vec<i64> {
+        let area: ffi::wxd_Rect = area.into();
+        self.collect(|ids, capacity| unsafe { ffi::wxd_SpatialIndex_QueryRect(self.ptr, area, ids, capacity) })
+    }
+
+    // Queries into a small buffer first and repeats with the exact size if it was too small.
+    fn collect(&self, query: impl Fn(*mut i64, usize) -> usize) -> Vec<i64> {
+        let mut ids = vec![0i64; 16];
+        let total = query(ids.as_mut_ptr(), ids.len());
+        if total > ids.len() {
+            ids.resize(total, 0);
+            let total = query(ids.as_mut_ptr(), ids.len());
+            ids.truncate(total);
+        } else {
+            ids.truncate(total);
+        }
+        ids
+    }
+
+    /// Tracks the mouse over `window` and sends it hover-changed events whenever the topmost
+    /// item under the pointer changes. Positions are converted to unscrolled coordinates for
+    /// scrolled windows. The window keeps the index alive until detached, and replaces any index
+    /// attached before.
+    pub fn attach(&self, window: &dyn WxWidget) {
+        let window_ptr = window.handle_ptr();
+        if !window_ptr.is_null() {
+            unsafe { ffi::wxd_SpatialIndex_AttachToWindow(self.ptr, window_ptr) }
+        }
+    }
+
+    /// Stops hover tracking on `window`.
+    pub fn detach(window: &dyn WxWidget) {
+        let window_ptr = window.handle_ptr();
+        if !window_ptr.is_null() {
+            unsafe { ffi::wxd_SpatialIndex_DetachFromWindow(window_ptr) }
+        }
+    }
+
+    /// Binds `callback` to the hover-changed events of a window with an attached index.
+    pub fn on_hover_changed<W, F>(window: &W, mut callback: F) -> EventToken
+    where
+        W: WxEvtHandler,
+        F: FnMut(SpatialHoverEvent) + 'static,
+    {
+        window.bind_internal(EventType::SPATIAL_HOVER_CHANGED, move |event| {
+            callback(SpatialHoverEvent::new(event))
+        })
+    }
+}
+
+impl Drop for SpatialIndex {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_SpatialIndex_Destroy(self.ptr) };
+    }
+}
+
+/// Event data for [`SpatialIndex::on_hover_changed`].
+#[derive(Debug)]
+pub struct SpatialHoverEvent {
+    /// The base event.
+    pub event: Event,
+}
+
+impl SpatialHoverEvent {
+    /// Creates a new `SpatialHoverEvent` from a base `Event`.
+    pub fn new(event: Event) -> Self {
+        Self { event }
+    }
+
+    /// The topmost item now under the pointer, if any.
+    pub fn item(&self) -> Option<i64> {
+        let mut id = 0i64;
+        unsafe { ffi::wxd_SpatialHoverEvent_GetItem(self.event._as_ptr(), &mut id) }.then_some(id)
+    }
+
+    /// The item that was under the pointer before, if any.
+    pub fn previous_item(&self) -> Option<i64> {
+        let mut id = 0i64;
+        unsafe { ffi::wxd_SpatialHoverEvent_GetPreviousItem(self.event._as_ptr(), &mut id) }.then_some(id)
+    }
+}
@@ -0,0 +1,105 @@
+//! Colours and fonts applied to a whole window tree at once, e.g. to switch themes.
+//!
+//! Rules are matched and applied natively while the top-level window is frozen, and the tree
+//! is refreshed once afterwards, so a large window repaints in one frame instead of control by
+//! control.
+//!
+//! ```rust,no_run
+//! use wxdragon::prelude::*;
+//!
+//! # fn dark(frame: &Frame, mono: &Font) {
+//! let rules = [
+//!     StyleRule::any()
+//!         .background(Colour::rgb(30, 30, 30))
+//!         .foreground(Colour::rgb(220, 220, 220)),
+//!     StyleRule::class("wxTextCtrl").background(Colour::rgb(45, 45, 45)).font(mono),
+//!     StyleRule::any().named("status").foreground(Colour::rgb(120, 200, 120)),
+//! ];
+//! apply_style_rules(frame, &rules);
+//! # }
+//! ```
+
+use crate::color::Colour;
+use crate::font::Font;
+use crate::window::WxWidget;
+use std::ffi::CString;
+use wxdragon_sys as ffi;
+
+/// Colours and a font for the windows a rule matches. Where several rules match a window,
+/// later rules win for each value they set.
+#[derive(Debug, Clone, Default)]
+pub struct StyleRule<'a> {
+    class_name: Option<CString>,
+    name: Option<CString>,
+    background: Option<Colour>,
+    foreground: Option<Colour>,
+    font: Option<&'a Font>,
+}
+
+impl<'a> StyleRule<'a> {
+    /// Matches every window.
+    pub fn any() -> Self {
+        Self::default()
+    }
+
+    /// Matches windows of the wxWidgets class `class_name` (e.g. `"wxButton"`) or a class
+    /// derived from it. An unknown class matches nothing.
+    pub fn class(class_name: &str) -> Self {
+        Self {
+            class_name: Some(CString::new(class_name).unwrap_or_default()),
+            ..Self::default()
+        }
+    }
+
+    /// Restricts the rule to windows named `name`.
+    pub fn named(mut self, name: &str) -> Self {
+        self.name = Some(CString::new(name).unwrap_or_default());
+        self
+    }
+
+    pub fn background(mut self, colour: Colour) -> Self {
+        self.background = Some(colour);
+        self
+    }
+
+    pub fn foreground(mut self, colour: Colour) -> Self {
+        self.foreground = Some(colour);
+        self
+    }
+
+    pub fn font(mut self, font: &'a Font) -> Self {
+        self.font = Some(font);
+        self
+    }
+
+    fn to_ffi(&self) -> ffi::wxd_StyleRule {
+        let mut set = 0u32;
+        if self.background.is_some() {
+            set |= ffi::wxd_StyleRuleFields_WXD_STYLE_RULE_BACKGROUND as u32;
+        }
+        if self.foreground.is_some() {
+            set |= ffi::wxd_StyleRuleFields_WXD_STYLE_RULE_FOREGROUND as u32;
+        }
+        if self.font.is_some() {
+            set |= ffi::wxd_StyleRuleFields_WXD_STYLE_RULE_FONT as u32;
+        }
+        let colour = |c: Option<Colour>| c.unwrap_or(Colour::new(0, 0, 0, 0)).into();
+        ffi::wxd_StyleRule {
+            class_name: self.class_name.as_ref().map_or(std::ptr::null(), |s| s.as_ptr()),
+            name: self.name.as_ref().map_or(std::ptr::null(), |s| s.as_ptr()),
+            set,
+            background: colour(self.background),
+            foreground: colour(self.foreground),
+            font: self.font.map_or(std::ptr::null(), |f| f.as_ptr() as *const _),
+        }
+    }
+}
+
+/// Applies `rules` to `root` and its descendants, leaving out dialogs and frames they own.
+/// Only values that differ are set; the window is laid out again if a font changed. Returns
+/// the number of windows changed.
+pub fn apply_style_rules(root: &dyn WxWidget, rules: &[StyleRule<'_>]) -> usize {
+    let raw: Vec<ffi::wxd_StyleRule> = rules.iter().map(StyleRule::to_ffi).collect();
+    let changed = unsafe { ffi::wxd_Window_ApplyStyleRecursive(root.handle_ptr(), raw.as_ptr(), raw.len()) };
+    changed.max(0) as usize
+}
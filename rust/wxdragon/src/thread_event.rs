@@ -0,0 +1,125 @@
+//! Typed messages from worker threads to a window or other event handler.
+
+use crate::event::{Event, EventToken, EventType, WxEvtHandler};
+use std::any::Any;
+use std::ffi::c_void;
+use wxdragon_sys as ffi;
+
+type Payload = Box<dyn Any + Send>;
+
+/// Sends values from any thread to one event handler, where they arrive on the GUI thread as
+/// [`ThreadMessageEvent`]s through the handler's normal bindings.
+///
+/// Messages go straight to the target's own pending queue, which is drained in full on every
+/// event loop pass, instead of through the global [`call_after`](crate::app::call_after) queue, and
+/// the receiving code does not have to find the window again. A message sent to, or pending
+/// for, a destroyed target is dropped on the spot.
+///
+/// # Example
+/// ```rust,no_run
+/// use wxdragon::prelude::*;
+/// # let frame = Frame::builder().build();
+/// const PROGRESS: i32 = 1;
+/// let sender = ThreadEventSender::new(&frame).expect("frame is alive");
+/// ThreadEventSender::on_message(&frame, |event| {
+///     if event.kind() == PROGRESS {
+///         if let Some(percent) = event.take::<u32>() {
+///             println!("{percent}%");
+///         }
+///     }
+/// });
+/// std::thread::spawn(move || {
+///     for percent in 0..=100u32 {
+///         sender.send(PROGRESS, percent);
+///     }
+/// });
+/// ```
+#[derive(Clone, Debug)]
+pub struct ThreadEventSender {
+    handler: usize,
+}
+
+impl ThreadEventSender {
+    /// Creates a sender for `target`. Call on the GUI thread; returns `None` if the target is
+    /// being destroyed.
+    pub fn new<W: WxEvtHandler>(target: &W) -> Option<Self> {
+        let handler = unsafe { target.get_event_handler_ptr() };
+        if handler.is_null() || !unsafe { ffi::wxd_EvtHandler_EnableThreadEvents(handler) } {
+            return None;
+        }
+        Some(Self {
+            handler: handler as usize,
+        })
+    }
+
+    /// Queues `payload` with the application-defined `kind`. Returns false, dropping the payload
+    /// on the calling thread, if the target has been destroyed.
+    pub fn send<T: Send + 'static>(&self, kind: i32, payload: T) -> bool {
+        let boxed: Box<Payload> = Box::new(Box::new(payload));
+        unsafe {
+            ffi::wxd_EvtHandler_QueueThreadEvent(
+                self.handler as *mut ffi::wxd_EvtHandler_t,
+                kind,
+                Box::into_raw(boxed) as *mut c_void,
+                Some(drop_payload),
+            )
+        }
+    }
+
+    /// Whether the target still exists.
+    pub fn is_alive(&self) -> bool {
+        unsafe { ffi::wxd_EvtHandler_AcceptsThreadEvents(self.handler as *mut ffi::wxd_EvtHandler_t) }
+    }
+
+    /// Binds `callback` to the messages sent to `target`.
+    pub fn on_message<W, F>(target: &W, mut callback: F) -> EventToken
+    where
+        W: WxEvtHandler,
+        F: FnMut(ThreadMessageEvent) + 'static,
+    {
+        target.bind_internal(EventType::THREAD_MESSAGE, move |event| {
+            callback(ThreadMessageEvent::new(event))
+        })
+    }
+}
+
+extern "C" fn drop_payload(payload: *mut c_void) {
+    if !payload.is_null() {
+        drop(unsafe { Box::from_raw(payload as *mut Payload) });
+    }
+}
+
+/// A message sent with [`ThreadEventSender::send`].
+#[derive(Debug)]
+pub struct ThreadMessageEvent {
+    /// The base event.
+    pub event: Event,
+}
+
+impl ThreadMessageEvent {
+    /// Creates a new `ThreadMessageEvent` from a base `Event`.
+    pub fn new(event: Event) -> Self {
+        Self { event }
+    }
+
+    /// The kind passed to [`ThreadEventSender::send`].
+    pub fn kind(&self) -> i32 {
+        unsafe { ffi::wxd_ThreadMessageEvent_GetKind(self.event._as_ptr()) }
+    }
+
+    /// Whether the payload is still there and of type `T`.
+    pub fn is<T: 'static>(&self) -> bool {
+        let payload = unsafe { ffi::wxd_ThreadMessageEvent_GetPayload(self.event._as_ptr()) };
+        !payload.is_null() && unsafe { &*(payload as *const Payload) }.is::<T>()
+    }
+
+    /// Moves the payload out if it is of type `T`; later calls return `None`.
+    pub fn take<T: 'static>(&self) -> Option<T> {
+        if !self.is::<T>() {
+            return None;
+        }
+        let payload = unsafe { ffi::wxd_ThreadMessageEvent_TakePayload(self.event._as_ptr()) };
+        let boxed = unsafe { Box::from_raw(payload as *mut Payload) };
+        boxed.downcast::<T>().ok().map(|value| *value)
+    }
+}
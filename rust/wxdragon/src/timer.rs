@@ -1,10 +1,15 @@
 //! Timer module for wxDragon.
 //!
 //! This module provides a safe wrapper around wxWidgets' wxTimer class.
-//! Timers are used to generate events at regular intervals.
+//! Timers are used to generate events at regular intervals. For large numbers of short-lived
+//! timers, [`TimerWheel`] multiplexes them on a single native timer.
 
 use crate::event::{Event, EventType, WxEvtHandler};
+use crate::window::WxWidget;
 use std::marker::PhantomData;
+use std::os::raw::c_void;
+use std::panic::{self, AssertUnwindSafe};
+use std::time::Duration;
 use wxdragon_sys as ffi;
 
 /// Represents a timer that triggers events at specified intervals.
@@ -125,6 +130,17 @@ impl<T: WxEvtHandler> Timer<T> {
         }
         unsafe { ffi::wxd_Timer_SetInterval(self.ptr, milliseconds) };
     }
+
+    /// Slows this periodic timer to `interval` while `window`'s top-level window cannot be seen
+    /// (hidden, minimized, or covered/cloaked where reported). The normal interval is restored
+    /// when it becomes visible again. `None` removes the override.
+    pub fn set_hidden_interval<W: WxWidget + ?Sized>(&self, window: &W, interval: Option<Duration>) {
+        if self.ptr.is_null() {
+            return;
+        }
+        let ms = interval.map_or(0, |d| d.as_millis().clamp(1, i32::MAX as u128) as i32);
+        unsafe { ffi::wxd_Timer_SetHiddenInterval(self.ptr, window.handle_ptr(), ms) };
+    }
 }
 
 impl<T: WxEvtHandler> Drop for Timer<T> {
@@ -145,3 +161,128 @@ impl WxEvtHandler for TimerOwnerWrapper {
         self.0
     }
 }
+
+/// Identifies a timer scheduled on a [`TimerWheel`]. Ids are never reused.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, PartialOrd, Ord)]
+#[repr(transparent)]
+pub struct TimerId(u64);
+
+impl TimerId {
+    /// The raw id, e.g. for use as a map key across FFI.
+    pub fn as_raw(self) -> u64 {
+        self.0
+    }
+}
+
+type TimerWheelCallback = Box<dyn FnMut(&[TimerId])>;
+
+/// Many logical timers multiplexed on one native timer.
+///
+/// Timers live in a hierarchical timer wheel, so scheduling and cancelling are O(1) no matter
+/// how many are pending, and the native timer only runs while something is scheduled. All
+/// timers that come due in the same tick are reported through one call of the wheel's callback,
+/// which receives their ids.
+///
+/// # Example
+///
+/// ```rust,no_run
+/// use std::time::Duration;
+/// use wxdragon::timer::TimerWheel;
+///
+/// let wheel = TimerWheel::new(Duration::from_millis(10), |fired| {
+///     for id in fired {
+///         println!("timer {id:?} fired");
+///     }
+/// });
+/// let blink = wheel.schedule_periodic(Duration::from_millis(500));
+/// let _debounce = wheel.schedule_once(Duration::from_millis(250));
+/// wheel.cancel(blink);
+/// ```
+pub struct TimerWheel {
+    ptr: *mut ffi::wxd_TimerWheel_t,
+}
+
+impl TimerWheel {
+    /// Creates a wheel with the given tick resolution (at least 1 ms); delays are rounded up to
+    /// whole ticks. `callback` runs on the main thread with the ids of the timers that fired; it
+    /// may schedule and cancel timers on this wheel.
+    pub fn new<F>(tick: Duration, callback: F) -> Self
+    where
+        F: FnMut(&[TimerId]) + 'static,
+    {
+        let tick_ms = tick.as_millis().clamp(1, i32::MAX as u128) as i32;
+        let raw = Box::into_raw(Box::new(Box::new(callback) as TimerWheelCallback));
+        let ptr = unsafe {
+            ffi::wxd_TimerWheel_Create(
+                tick_ms,
+                raw as *mut c_void,
+                Some(timer_wheel_fired),
+                Some(timer_wheel_drop_callback),
+            )
+        };
+        if ptr.is_null() {
+            unsafe { drop(Box::from_raw(raw)) };
+        }
+        Self { ptr }
+    }
+
+    /// Schedules a timer that fires once after `delay`.
+    pub fn schedule_once(&self, delay: Duration) -> TimerId {
+        self.schedule(delay, Duration::ZERO)
+    }
+
+    /// Schedules a timer that fires every `interval`, starting one interval from now.
+    pub fn schedule_periodic(&self, interval: Duration) -> TimerId {
+        self.schedule(interval, interval)
+    }
+
+    /// Schedules a timer firing after `delay` and then every `period` unless it is zero.
+    pub fn schedule(&self, delay: Duration, period: Duration) -> TimerId {
+        if self.ptr.is_null() {
+            return TimerId(0);
+        }
+        let delay_ms = delay.as_millis().min(i32::MAX as u128) as i32;
+        let period_ms = period.as_millis().min(i32::MAX as u128) as i32;
+        TimerId(unsafe { ffi::wxd_TimerWheel_Schedule(self.ptr, delay_ms, period_ms) })
+    }
+
+    /// Cancels a timer. Returns false if it already fired (one-shot) or was cancelled.
+    pub fn cancel(&self, id: TimerId) -> bool {
+        if self.ptr.is_null() {
+            return false;
+        }
+        unsafe { ffi::wxd_TimerWheel_Cancel(self.ptr, id.0) }
+    }
+
+    /// Number of timers currently scheduled.
+    pub fn pending_count(&self) -> usize {
+        if self.ptr.is_null() {
+            return 0;
+        }
+        unsafe { ffi::wxd_TimerWheel_GetPendingCount(self.ptr) }
+    }
+}
+
+impl Drop for TimerWheel {
+    fn drop(&mut self) {
+        if !self.ptr.is_null() {
+            unsafe { ffi::wxd_TimerWheel_Destroy(self.ptr) };
+        }
+    }
+}
+
+unsafe extern "C" fn timer_wheel_fired(userdata: *mut c_void, ids: *const u64, count: usize) {
+    if userdata.is_null() || ids.is_null() || count == 0 {
+        return;
+    }
+    let callback = unsafe { &mut *(userdata as *mut TimerWheelCallback) };
+    // TimerId is repr(transparent) over u64.
+    let fired = unsafe { std::slice::from_raw_parts(ids as *const TimerId, count) };
+    let _ = panic::catch_unwind(AssertUnwindSafe(|| callback(fired)));
+}
+
+unsafe extern "C" fn timer_wheel_drop_callback(userdata: *mut c_void) {
+    if !userdata.is_null() {
+        unsafe { drop(Box::from_raw(userdata as *mut TimerWheelCallback)) };
+    }
+}
@@ -0,0 +1,128 @@
+//! Event-loop timeline recording.
+//!
+//! While recording, the native library stores one span per event dispatch (event type, handler
+//! class, duration), per idle callback drain, per paint and per timer fire in a fixed-size ring.
+//! [`chrome_json`] exports the ring as Chrome `trace_event` JSON, which opens in
+//! `chrome://tracing`, [Perfetto](https://ui.perfetto.dev) and, through its `import-chrome`
+//! tool, Tracy.
+//!
+//! ```rust,no_run
+//! wxdragon::trace::start(0);
+//! // ... reproduce the jank ...
+//! wxdragon::trace::stop();
+//! wxdragon::trace::save_chrome_json("jank.json").unwrap();
+//! ```
+//!
+//! Rust work can be added to the same timeline with [`span`], or, with the `tracing` feature,
+//! by installing [`TraceLayer`] so every entered `tracing` span is recorded alongside the native
+//! ones on the same clock.
+
+use std::ffi::CString;
+use std::path::Path;
+use wxdragon_sys as ffi;
+
+/// Clears the ring and starts recording. `capacity` is the number of spans kept (rounded up to a
+/// power of two, oldest overwritten first); `0` keeps 65536.
+pub fn start(capacity: u32) {
+    unsafe { ffi::wxd_Trace_Start(capacity) };
+}
+
+/// Stops recording. The ring is kept until the next [`start`].
+pub fn stop() {
+    unsafe { ffi::wxd_Trace_Stop() };
+}
+
+pub fn is_recording() -> bool {
+    unsafe { ffi::wxd_Trace_IsRecording() }
+}
+
+/// Current time on the trace clock, in nanoseconds since [`start`].
+pub fn now() -> u64 {
+    unsafe { ffi::wxd_Trace_Now() }
+}
+
+/// Records a span with times taken from [`now`]. Ignored while not recording.
+pub fn record_span(name: &str, start_ns: u64, end_ns: u64) {
+    // Interior NULs would truncate the name anyway; cut there instead of dropping the span.
+    let name = CString::new(name.split('\0').next().unwrap_or_default()).unwrap_or_default();
+    unsafe { ffi::wxd_Trace_RecordSpan(name.as_ptr(), start_ns, end_ns) };
+}
+
+/// Records the lifetime of the returned guard as a span named `name`.
+pub fn span(name: &str) -> SpanGuard<'_> {
+    SpanGuard {
+        name,
+        start: is_recording().then(now),
+    }
+}
+
+/// Returned by [`span`]; records on drop.
+#[must_use = "the span ends when the guard is dropped"]
+pub struct SpanGuard<'a> {
+    name: &'a str,
+    start: Option<u64>,
+}
+
+impl Drop for SpanGuard<'_> {
+    fn drop(&mut self) {
+        if let Some(start) = self.start {
+            record_span(self.name, start, now());
+        }
+    }
+}
+
+/// The recorded spans as Chrome `trace_event` JSON.
+pub fn chrome_json() -> String {
+    loop {
+        let len = unsafe { ffi::wxd_Trace_GetChromeJson(std::ptr::null_mut(), 0) };
+        // Headroom for spans recorded between the two calls while still recording.
+        let mut buf = vec![0u8; len + 4096];
+        let written = unsafe { ffi::wxd_Trace_GetChromeJson(buf.as_mut_ptr() as *mut _, buf.len()) };
+        if written < buf.len() {
+            buf.truncate(written);
+            return String::from_utf8_lossy(&buf).into_owned();
+        }
+    }
+}
+
+/// Writes [`chrome_json`] to `path`.
+pub fn save_chrome_json(path: impl AsRef<Path>) -> std::io::Result<()> {
+    std::fs::write(path, chrome_json())
+}
+
+/// A `tracing-subscriber` layer that records every entered span into the native timeline, so
+/// Rust and native spans line up in the exported trace.
+///
+/// ```rust,ignore
+/// use tracing_subscriber::prelude::*;
+/// tracing_subscriber::registry().with(wxdragon::trace::TraceLayer).init();
+/// ```
+#[cfg(feature = "tracing")]
+#[derive(Debug, Default, Clone, Copy)]
+pub struct TraceLayer;
+
+#[cfg(feature = "tracing")]
+struct EnteredAt(u64);
+
+#[cfg(feature = "tracing")]
+impl<S> tracing_subscriber::Layer<S> for TraceLayer
+where
+    S: tracing::Subscriber + for<'a> tracing_subscriber::registry::LookupSpan<'a>,
+{
+    fn on_enter(&self, id: &tracing::span::Id, ctx: tracing_subscriber::layer::Context<'_, S>) {
+        if !is_recording() {
+            return;
+        }
+        if let Some(span) = ctx.span(id) {
+            span.extensions_mut().replace(EnteredAt(now()));
+        }
+    }
+
+    fn on_exit(&self, id: &tracing::span::Id, ctx: tracing_subscriber::layer::Context<'_, S>) {
+        if let Some(span) = ctx.span(id) {
+            if let Some(EnteredAt(start)) = span.extensions_mut().remove::<EnteredAt>() {
+                record_span(span.name(), start, now());
+            }
+        }
+    }
+}
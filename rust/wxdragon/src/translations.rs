@@ -161,6 +161,47 @@ impl Translations {
         unsafe { ffi::wxd_Translations_AddCatalog(self.ptr, c_domain.as_ptr(), msg_id_language.as_i32()) }
     }
 
+    /// Add a `.mo` catalog for `domain` that stays memory-mapped instead of being
+    /// parsed into wxWidgets' tables at load time.
+    ///
+    /// Only the catalog header is read now; each lookup finds its message
+    /// through the catalog's hash table and copies it straight out of the
+    /// mapping, so a large catalog costs neither startup time nor memory for
+    /// messages that are never shown. Mapped catalogs take precedence over
+    /// those added with [`add_catalog`](Self::add_catalog) for lookups made
+    /// through this type and the `translate*` functions, but wxWidgets' own
+    /// strings still come from [`add_std_catalog`](Self::add_std_catalog).
+    ///
+    /// Returns false if the file is missing, malformed or not UTF-8.
+    pub fn add_mapped_catalog(&self, domain: &str, path: impl AsRef<std::path::Path>) -> bool {
+        if self.ptr.is_null() {
+            return false;
+        }
+        let (Ok(c_domain), Some(Ok(c_path))) = (CString::new(domain), path.as_ref().to_str().map(CString::new)) else {
+            return false;
+        };
+        unsafe { ffi::wxd_Translations_AddMappedCatalog(self.ptr, c_domain.as_ptr(), c_path.as_ptr()) }
+    }
+
+    /// [`add_mapped_catalog`](Self::add_mapped_catalog) for the catalog stored
+    /// as entry `name` of a [`ResourceBundle`](crate::resource_bundle::ResourceBundle).
+    pub fn add_mapped_catalog_from_resource(
+        &self,
+        domain: &str,
+        bundle: &crate::resource_bundle::ResourceBundle,
+        name: &str,
+    ) -> bool {
+        if self.ptr.is_null() {
+            return false;
+        }
+        let (Ok(c_domain), Ok(c_name)) = (CString::new(domain), CString::new(name)) else {
+            return false;
+        };
+        unsafe {
+            ffi::wxd_Translations_AddMappedCatalogFromResource(self.ptr, c_domain.as_ptr(), bundle.as_ptr(), c_name.as_ptr())
+        }
+    }
+
     /// Add the standard wxWidgets message catalog.
     ///
     /// This loads wxWidgets' own translations for standard UI elements
@@ -195,6 +236,18 @@ impl Translations {
         unsafe { ffi::wxd_Translations_SetRustLoader(self.ptr, &LOADER_VTABLE as *const _, user_data) };
     }
 
+    /// Installs a loader that reads catalogs from a memory-mapped [`ResourceBundle`], looking
+    /// for `<prefix>/<lang>/<domain>.mo` or `<prefix>/<lang>/LC_MESSAGES/<domain>.mo`. Like
+    /// [`set_loader`](Self::set_loader) this replaces the current loader; the catalogs are parsed
+    /// straight from the mapping, which the loader keeps alive.
+    pub fn set_resource_loader(&self, bundle: &crate::resource_bundle::ResourceBundle, prefix: &str) {
+        if self.ptr.is_null() {
+            return;
+        }
+        let Ok(c_prefix) = CString::new(prefix) else { return };
+        unsafe { ffi::wxd_Translations_SetResourceLoader(self.ptr, bundle.as_ptr(), c_prefix.as_ptr()) };
+    }
+
     /// Check if a catalog for the given domain is loaded.
     pub fn is_loaded(&self, domain: &str) -> bool {
         if self.ptr.is_null() {
@@ -404,6 +457,105 @@ impl Translations {
             })
             .collect()
     }
+
+    /// Get the translation of an interned [`MsgId`].
+    ///
+    /// This is the fast path for strings looked up repeatedly (labels rebuilt
+    /// on every dialog build or menu refresh): translations are kept as
+    /// pre-converted UTF-8 in a table indexed by id, refilled when the language
+    /// or loaded catalogs change, so a lookup is an array index plus a copy.
+    ///
+    /// Returns `None` if there is no translation.
+    pub fn get_string_by_id(&self, id: MsgId) -> Option<String> {
+        if self.ptr.is_null() {
+            return None;
+        }
+        let mut len: usize = 0;
+        let ptr = unsafe { ffi::wxd_Translations_GetTranslatedStringById(self.ptr, id.0, &mut len) };
+        unsafe { utf8_from_raw(ptr, len) }
+    }
+
+    /// Get the plural-form translation of a [`MsgId`] interned with
+    /// [`MsgId::intern_plural`].
+    ///
+    /// Returns `None` if there is no translation.
+    pub fn get_plural_string_by_id(&self, id: MsgId, n: u32) -> Option<String> {
+        if self.ptr.is_null() {
+            return None;
+        }
+        let mut len: usize = 0;
+        let ptr = unsafe { ffi::wxd_Translations_GetTranslatedPluralStringById(self.ptr, id.0, n, &mut len) };
+        unsafe { utf8_from_raw(ptr, len) }
+    }
+}
+
+/// Copy a non-terminated UTF-8 slice handed out by the id-based lookups.
+///
+/// # Safety
+/// `ptr` must be null or point to `len` readable bytes.
+unsafe fn utf8_from_raw(ptr: *const c_char, len: usize) -> Option<String> {
+    if ptr.is_null() {
+        return None;
+    }
+    let bytes = unsafe { std::slice::from_raw_parts(ptr as *const u8, len) };
+    Some(String::from_utf8_lossy(bytes).into_owned())
+}
+
+/// An interned message id for fast repeated translation lookups.
+///
+/// Intern each msgid once (typically into a `static` or a field) and pass the
+/// id to [`translate_id`] or [`Translations::get_string_by_id`] instead of the
+/// string. Ids are process-wide and remain valid for the life of the program;
+/// interning the same text again returns the same id.
+///
+/// # Example
+/// ```rust,no_run
+/// use wxdragon::translations::{MsgId, translate_id};
+///
+/// let open = MsgId::intern("&Open...");
+/// let label = translate_id(open);
+/// ```
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+pub struct MsgId(i32);
+
+impl MsgId {
+    /// Intern `msgid` in the default domain.
+    pub fn intern(msgid: &str) -> Self {
+        Self::intern_in_domain(msgid, "")
+    }
+
+    /// Intern `msgid` for lookups in `domain`.
+    ///
+    /// Returns an id that never translates if either string contains a NUL.
+    pub fn intern_in_domain(msgid: &str, domain: &str) -> Self {
+        let (Ok(c_msgid), Ok(c_domain)) = (CString::new(msgid), CString::new(domain)) else {
+            return Self(-1);
+        };
+        Self(unsafe { ffi::wxd_Translations_InternMsgId(c_msgid.as_ptr(), c_domain.as_ptr()) })
+    }
+
+    /// Intern a singular/plural pair in the default domain, for use with
+    /// [`translate_plural_id`].
+    pub fn intern_plural(singular: &str, plural: &str) -> Self {
+        Self::intern_plural_in_domain(singular, plural, "")
+    }
+
+    /// Intern a singular/plural pair for lookups in `domain`.
+    pub fn intern_plural_in_domain(singular: &str, plural: &str, domain: &str) -> Self {
+        let (Ok(c_singular), Ok(c_plural), Ok(c_domain)) = (CString::new(singular), CString::new(plural), CString::new(domain))
+        else {
+            return Self(-1);
+        };
+        Self(unsafe { ffi::wxd_Translations_InternPluralMsgId(c_singular.as_ptr(), c_plural.as_ptr(), c_domain.as_ptr()) })
+    }
+
+    /// The original (untranslated) text, or the plural text if `plural` is
+    /// true and this id was interned as a pair.
+    fn original(self, plural: bool) -> String {
+        let mut len: usize = 0;
+        let ptr = unsafe { ffi::wxd_Translations_GetMsgIdString(self.0, plural, &mut len) };
+        unsafe { utf8_from_raw(ptr, len) }.unwrap_or_default()
+    }
 }
 
 impl Default for Translations {
@@ -565,6 +717,32 @@ pub fn translate_plural(singular: &str, plural: &str, n: u32) -> String {
     if n == 1 { singular.to_string() } else { plural.to_string() }
 }
 
+/// Translate an interned [`MsgId`] using the global translations instance.
+///
+/// Same result as [`translate`] on the original text, without converting the
+/// string on every call. Falls back to the original text.
+pub fn translate_id(id: MsgId) -> String {
+    if let Some(translations) = Translations::get()
+        && let Some(translated) = translations.get_string_by_id(id)
+    {
+        return translated;
+    }
+    id.original(false)
+}
+
+/// Translate a plural [`MsgId`] (see [`MsgId::intern_plural`]) using the
+/// global translations instance.
+///
+/// Falls back to the singular text if `n == 1`, otherwise the plural text.
+pub fn translate_plural_id(id: MsgId, n: u32) -> String {
+    if let Some(translations) = Translations::get()
+        && let Some(translated) = translations.get_plural_string_by_id(id, n)
+    {
+        return translated;
+    }
+    id.original(n != 1)
+}
+
 /// Information about a language.
 ///
 /// Wraps `wxLanguageInfo`. This structure provides details about a language
@@ -859,4 +1037,26 @@ mod tests {
         // A domain the loader doesn't serve resolves to nothing.
         assert!(translations.get_available_translations("other").is_empty());
     }
+
+    #[test]
+    fn interned_ids_follow_catalog_changes() {
+        let mo = make_mo(&[("", "Content-Type: text/plain; charset=UTF-8\n"), ("Save", "Enregistrer")]);
+
+        let translations = Translations::new();
+        translations.set_loader(FixtureLoader { mo });
+        translations.set_language_str("fr");
+
+        let save = MsgId::intern_in_domain("Save", "wxdtest");
+        assert_eq!(save, MsgId::intern_in_domain("Save", "wxdtest"), "interning is idempotent");
+        assert_eq!(translations.get_string_by_id(save), None, "no catalog loaded yet");
+
+        // Loading a catalog refills the table for ids interned earlier.
+        assert!(translations.add_catalog("wxdtest"));
+        assert_eq!(translations.get_string_by_id(save).as_deref(), Some("Enregistrer"));
+
+        // Ids interned after the table was filled are resolved on demand.
+        let missing = MsgId::intern_in_domain("Quit", "wxdtest");
+        assert_eq!(translations.get_string_by_id(missing), None);
+        assert_eq!(missing.original(false), "Quit");
+    }
 }
@@ -29,8 +29,10 @@
 //!
 //! This class currently doesn't work when using Wayland with wxGTK.
 
+use crate::window::WxWidget;
 use std::ffi::CString;
 use std::os::raw::c_long;
+use std::time::Duration;
 use wxdragon_sys as ffi;
 
 /// Mouse button constants for UIActionSimulator.
@@ -395,3 +397,172 @@ impl Drop for UIActionSimulator {
         }
     }
 }
+
+/// Percentiles of one latency series. All values are zero when `count` is zero.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub struct LatencyDistribution {
+    /// Number of samples in which this stage was observed.
+    pub count: u32,
+    pub p50: Duration,
+    pub p90: Duration,
+    pub p99: Duration,
+    pub max: Duration,
+    pub mean: Duration,
+}
+
+impl LatencyDistribution {
+    fn from_raw(raw: &ffi::wxd_LatencyDistribution) -> Self {
+        let us = |v: i64| Duration::from_micros(v.max(0) as u64);
+        Self {
+            count: raw.count,
+            p50: us(raw.p50_us),
+            p90: us(raw.p90_us),
+            p99: us(raw.p99_us),
+            max: us(raw.max_us),
+            mean: us(raw.mean_us),
+        }
+    }
+}
+
+/// Summary of the samples recorded by a [`LatencyProbe`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub struct LatencyStats {
+    /// From injection until the input event reached the target, before any handler ran.
+    pub to_handler: LatencyDistribution,
+    /// From injection until the first paint of the target (or a child) after the input finished.
+    pub to_paint: LatencyDistribution,
+    /// Measurements that saw no paint before their timeout.
+    pub timeouts: u32,
+}
+
+/// One raw latency sample; `None` where the stage was not observed.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct LatencySample {
+    pub to_handler: Option<Duration>,
+    pub to_paint: Option<Duration>,
+}
+
+/// Measures input-to-paint latency of a window with simulated input.
+///
+/// Each measurement timestamps an injected input, notes when it reaches the target window and
+/// when the next paint of the target finishes, running the event loop in between. Collect a
+/// few hundred keystrokes or scroll keys and gate on [`LatencyStats`] percentiles.
+///
+/// ```rust,no_run
+/// use wxdragon::prelude::*;
+/// use wxdragon::uiactionsimulator::{KeyModifier, LatencyProbe, UIActionSimulator};
+/// use std::time::Duration;
+///
+/// fn typing_p99(editor: &TextCtrl) -> Duration {
+///     editor.set_focus();
+///     let sim = UIActionSimulator::new();
+///     let probe = LatencyProbe::new(editor);
+///     for _ in 0..200 {
+///         probe.measure_char(&sim, 'a' as i32, KeyModifier::NONE, Duration::from_secs(1));
+///     }
+///     probe.stats().to_paint.p99
+/// }
+/// ```
+pub struct LatencyProbe {
+    ptr: *mut ffi::wxd_LatencyProbe_t,
+}
+
+impl LatencyProbe {
+    /// Creates a probe for `target` and its child windows. Main thread only.
+    pub fn new<W: WxWidget + ?Sized>(target: &W) -> Self {
+        Self {
+            ptr: unsafe { ffi::wxd_LatencyProbe_Create(target.handle_ptr()) },
+        }
+    }
+
+    /// Measures one keystroke. The target should have keyboard focus. Returns false if the key
+    /// could not be injected or no paint followed within `timeout`.
+    pub fn measure_char(&self, sim: &UIActionSimulator, keycode: i32, modifiers: KeyModifier, timeout: Duration) -> bool {
+        if self.ptr.is_null() || sim.ptr.is_null() {
+            return false;
+        }
+        unsafe { ffi::wxd_LatencyProbe_MeasureChar(self.ptr, sim.ptr, keycode, modifiers.to_raw(), timeout_ms(timeout)) }
+    }
+
+    /// Moves the pointer to screen position (`x`, `y`), which is not measured, then measures a
+    /// click of `button` there.
+    pub fn measure_click(&self, sim: &UIActionSimulator, x: i32, y: i32, button: MouseButton, timeout: Duration) -> bool {
+        if self.ptr.is_null() || sim.ptr.is_null() {
+            return false;
+        }
+        unsafe {
+            ffi::wxd_LatencyProbe_MeasureClick(
+                self.ptr,
+                sim.ptr,
+                x as c_long,
+                y as c_long,
+                button as i32,
+                timeout_ms(timeout),
+            )
+        }
+    }
+
+    /// Measures an arbitrary input: `inject` runs right after the input timestamp is taken,
+    /// e.g. a drag or a typed string.
+    pub fn measure<F: FnOnce()>(&self, inject: F, timeout: Duration) -> bool {
+        if self.ptr.is_null() {
+            return false;
+        }
+        unsafe { ffi::wxd_LatencyProbe_Begin(self.ptr) };
+        inject();
+        unsafe { ffi::wxd_LatencyProbe_Wait(self.ptr, timeout_ms(timeout)) }
+    }
+
+    /// Percentiles over all samples since creation or the last [`reset`](Self::reset).
+    pub fn stats(&self) -> LatencyStats {
+        if self.ptr.is_null() {
+            return LatencyStats::default();
+        }
+        let mut raw: ffi::wxd_LatencyStats = unsafe { std::mem::zeroed() };
+        unsafe { ffi::wxd_LatencyProbe_GetStats(self.ptr, &mut raw) };
+        LatencyStats {
+            to_handler: LatencyDistribution::from_raw(&raw.to_handler),
+            to_paint: LatencyDistribution::from_raw(&raw.to_paint),
+            timeouts: raw.timeouts,
+        }
+    }
+
+    /// Raw samples in recording order, for exporting or custom statistics.
+    pub fn samples(&self) -> Vec<LatencySample> {
+        if self.ptr.is_null() {
+            return Vec::new();
+        }
+        let count = unsafe { ffi::wxd_LatencyProbe_GetSamples(self.ptr, std::ptr::null_mut(), std::ptr::null_mut(), 0) };
+        let mut handler = vec![0i64; count];
+        let mut paint = vec![0i64; count];
+        unsafe { ffi::wxd_LatencyProbe_GetSamples(self.ptr, handler.as_mut_ptr(), paint.as_mut_ptr(), count) };
+        let stage = |us: i64| (us >= 0).then(|| Duration::from_micros(us as u64));
+        handler
+            .into_iter()
+            .zip(paint)
+            .map(|(h, p)| LatencySample {
+                to_handler: stage(h),
+                to_paint: stage(p),
+            })
+            .collect()
+    }
+
+    /// Discards all recorded samples.
+    pub fn reset(&self) {
+        if !self.ptr.is_null() {
+            unsafe { ffi::wxd_LatencyProbe_Reset(self.ptr) };
+        }
+    }
+}
+
+impl Drop for LatencyProbe {
+    fn drop(&mut self) {
+        if !self.ptr.is_null() {
+            unsafe { ffi::wxd_LatencyProbe_Destroy(self.ptr) };
+        }
+    }
+}
+
+fn timeout_ms(timeout: Duration) -> i32 {
+    timeout.as_millis().min(i32::MAX as u128) as i32
+}
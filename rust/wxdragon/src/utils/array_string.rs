@@ -86,14 +86,25 @@ impl ArrayString {
 
     /// Adds multiple strings to the array.
     /// Returns the number of successfully added strings.
+    ///
+    /// All strings are packed into one buffer and appended with a single FFI call.
     pub fn add_many<T: AsRef<str>>(&mut self, strings: &[T]) -> usize {
-        let mut count = 0;
+        self.add_packed(strings.iter().map(|s| s.as_ref()))
+    }
+
+    fn add_packed<'a>(&mut self, strings: impl Iterator<Item = &'a str>) -> usize {
+        let mut data = String::new();
+        let mut offsets = vec![0usize];
         for s in strings {
-            if self.add(s) {
-                count += 1;
-            }
+            data.push_str(s);
+            offsets.push(data.len());
         }
-        count
+        let count = offsets.len() - 1;
+        if count == 0 {
+            return 0;
+        }
+        let ok = unsafe { ffi::wxd_ArrayString_ImportPacked(self.ptr, data.as_ptr() as *const _, offsets.as_ptr(), count) };
+        if ok { count } else { 0 }
     }
 
     /// Clears all strings from the array.
@@ -102,18 +113,31 @@ impl ArrayString {
     }
 
     /// Gets all strings from the array as a `Vec<String>` without consuming the ArrayString.
+    ///
+    /// The whole array is exported as one packed UTF-8 buffer, so this costs a constant number of
+    /// FFI calls regardless of the number of strings.
     pub fn get_strings(&self) -> Vec<String> {
         let count = self.get_count();
-        let mut vec = Vec::with_capacity(count);
-
-        for i in 0..count {
-            if let Some(s) = self.get_string(i) {
-                vec.push(s);
-            } else {
-                vec.push(String::new());
-            }
+        if count == 0 {
+            return Vec::new();
+        }
+        let mut offsets = vec![0usize; count + 1];
+        let packed = unsafe { ffi::wxd_ArrayString_ExportPacked(self.ptr, offsets.as_mut_ptr(), offsets.len()) };
+        if packed.is_null() {
+            return vec![String::new(); count];
         }
 
+        let bytes = unsafe {
+            std::slice::from_raw_parts(
+                ffi::wxd_String_GetData(packed) as *const u8,
+                ffi::wxd_String_GetLength(packed),
+            )
+        };
+        let vec = offsets
+            .windows(2)
+            .map(|w| String::from_utf8_lossy(&bytes[w[0]..w[1]]).into_owned())
+            .collect();
+        unsafe { ffi::wxd_String_Free(packed) };
         vec
     }
 
@@ -200,9 +224,8 @@ impl<T: AsRef<str>> From<&[T]> for ArrayString {
 impl<S: AsRef<str>> std::iter::FromIterator<S> for ArrayString {
     fn from_iter<I: IntoIterator<Item = S>>(iter: I) -> Self {
         let mut array = ArrayString::new();
-        for s in iter {
-            array.add(s.as_ref());
-        }
+        let strings: Vec<S> = iter.into_iter().collect();
+        array.add_packed(strings.iter().map(|s| s.as_ref()));
         array
     }
 }
@@ -1,5 +1,7 @@
 mod array_string;
 mod misc;
+mod owned_string;
 
 pub use array_string::ArrayString;
 pub use misc::{BrowserLaunchFlags, bell, launch_default_browser};
+pub(crate) use owned_string::take_wxd_string;
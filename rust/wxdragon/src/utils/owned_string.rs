@@ -0,0 +1,19 @@
+use wxdragon_sys as ffi;
+
+/// Converts a `wxd_String_t` returned by one of the single-call `*Owned` getters into a `String`
+/// and frees the native buffer. Returns `None` for a null handle (destroyed object or error).
+///
+/// # Safety
+/// `ptr` must be null or a handle freshly returned by the C API that has not been freed yet.
+pub(crate) unsafe fn take_wxd_string(ptr: *mut ffi::wxd_String_t) -> Option<String> {
+    if ptr.is_null() {
+        return None;
+    }
+    let text = unsafe {
+        let data = ffi::wxd_String_GetData(ptr) as *const u8;
+        let len = ffi::wxd_String_GetLength(ptr);
+        String::from_utf8_lossy(std::slice::from_raw_parts(data, len)).into_owned()
+    };
+    unsafe { ffi::wxd_String_Free(ptr) };
+    Some(text)
+}
@@ -0,0 +1,75 @@
+//! Top-level window visibility.
+//!
+//! Each top-level window can be tracked for whether the user can see it at all: shown, not
+//! minimized and, where the platform reports it, not fully covered (macOS) or cloaked, e.g. on
+//! another virtual desktop (Windows). Query it with [`WxWidget::is_effectively_visible`], react
+//! to changes with [`on_visibility_changed`], and let the library hold back work for hidden
+//! windows with [`WxWidget::set_pause_refresh_when_hidden`] and
+//! [`Timer::set_hidden_interval`](crate::timer::Timer::set_hidden_interval).
+//!
+//! ```rust,no_run
+//! # use wxdragon::prelude::*;
+//! # fn demo(frame: &Frame) {
+//! frame.set_pause_refresh_when_hidden(true);
+//! on_visibility_changed(frame, |event| {
+//!     if event.is_visible() {
+//!         // resume uploads
+//!     }
+//! });
+//! # }
+//! ```
+
+use crate::event::{Event, EventToken, EventType, WxEvtHandler};
+use crate::window::WxWidget;
+use wxdragon_sys as ffi;
+
+bitflags::bitflags! {
+    /// Why a top-level window cannot be seen.
+    #[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+    pub struct HiddenReasons: u32 {
+        /// Hidden or not shown yet.
+        const NOT_SHOWN = ffi::wxd_HiddenReason_WXD_HIDDEN_NOT_SHOWN as u32;
+        /// Minimized.
+        const ICONIZED = ffi::wxd_HiddenReason_WXD_HIDDEN_ICONIZED as u32;
+        /// Fully covered (macOS) or cloaked by the window manager (Windows). Not reported on GTK.
+        const OCCLUDED = ffi::wxd_HiddenReason_WXD_HIDDEN_OCCLUDED as u32;
+    }
+}
+
+/// Sent to a tracked top-level window when it becomes visible or hidden.
+#[derive(Debug, Clone)]
+pub struct VisibilityEvent {
+    pub event: Event,
+}
+
+impl VisibilityEvent {
+    pub fn new(event: Event) -> Self {
+        Self { event }
+    }
+
+    /// Why the window cannot be seen now; empty if it became visible.
+    pub fn hidden_reasons(&self) -> HiddenReasons {
+        HiddenReasons::from_bits_truncate(unsafe { ffi::wxd_VisibilityEvent_GetHiddenReasons(self.event.0) })
+    }
+
+    pub fn is_visible(&self) -> bool {
+        self.hidden_reasons().is_empty()
+    }
+}
+
+/// Starts tracking the top-level window `window` and calls `callback` each time it becomes
+/// visible or hidden. Events are queued, so the state already reflects the change when the
+/// callback runs.
+pub fn on_visibility_changed<W, F>(window: &W, mut callback: F) -> EventToken
+where
+    W: WxWidget + WxEvtHandler,
+    F: FnMut(VisibilityEvent) + 'static,
+{
+    let window_ptr = window.handle_ptr();
+    if !window_ptr.is_null() {
+        unsafe { ffi::wxd_Window_TrackVisibility(window_ptr) };
+    }
+    window.bind_internal(EventType::VISIBILITY_CHANGED, move |event| {
+        callback(VisibilityEvent::new(event))
+    })
+}
@@ -0,0 +1,216 @@
+//! Declarative widget trees built natively in one call.
+
+use crate::geometry::Size;
+use crate::id::{ID_ANY, Id};
+use crate::sizers::{Orientation, Sizer, SizerFlag};
+use crate::window::{Window, WxWidget};
+use wxdragon_sys as ffi;
+
+/// One node of a widget tree: a window, a sizer or a spacer, with its place in the parent sizer.
+///
+/// Build the description with the constructors and chained setters, then create the whole
+/// hierarchy with [`WidgetNode::build`]. A window node may hold one sizer as its child; sizer
+/// nodes hold windows, sizers and spacers.
+///
+/// # Example
+/// ```ignore
+/// let tree = WidgetNode::box_sizer(Orientation::Vertical)
+///     .child(WidgetNode::static_text("Name:").item(0, SizerFlag::All, 5))
+///     .child(WidgetNode::text_ctrl("").tooltip("Your full name").item(0, SizerFlag::Expand | SizerFlag::All, 5))
+///     .child(WidgetNode::stretch(1))
+///     .child(WidgetNode::button("OK").id(ID_OK).item(0, SizerFlag::AlignRight | SizerFlag::All, 5));
+/// let built = tree.build(&panel).expect("valid tree");
+/// let name = built[2].window().and_then(|w| w.as_widget::<TextCtrl>());
+/// ```
+#[derive(Debug, Clone)]
+pub struct WidgetNode {
+    kind: ffi::wxd_WidgetTreeKind,
+    id: Id,
+    style: i64,
+    size: Size,
+    proportion: i32,
+    flags: SizerFlag,
+    border: i32,
+    label: String,
+    tooltip: String,
+    children: Vec<WidgetNode>,
+}
+
+/// An object created by [`WidgetNode::build`], in the same order as the description.
+#[derive(Clone, Copy)]
+pub enum BuiltNode {
+    Window(Window),
+    Sizer(Sizer),
+    Spacer,
+}
+
+impl BuiltNode {
+    /// The created window, if this node is one.
+    pub fn window(&self) -> Option<Window> {
+        match self {
+            BuiltNode::Window(window) => Some(*window),
+            _ => None,
+        }
+    }
+
+    /// The created sizer, if this node is one.
+    pub fn sizer(&self) -> Option<Sizer> {
+        match self {
+            BuiltNode::Sizer(sizer) => Some(*sizer),
+            _ => None,
+        }
+    }
+}
+
+impl WidgetNode {
+    fn new(kind: ffi::wxd_WidgetTreeKind, label: &str) -> Self {
+        WidgetNode {
+            kind,
+            id: ID_ANY as Id,
+            style: 0,
+            size: Size::new(-1, -1),
+            proportion: 0,
+            flags: SizerFlag::empty(),
+            border: 0,
+            label: label.to_string(),
+            tooltip: String::new(),
+            children: Vec::new(),
+        }
+    }
+
+    pub fn panel() -> Self {
+        Self::new(ffi::wxd_WidgetTreeKind_WXD_WIDGET_TREE_PANEL, "")
+    }
+
+    pub fn static_text(label: &str) -> Self {
+        Self::new(ffi::wxd_WidgetTreeKind_WXD_WIDGET_TREE_STATIC_TEXT, label)
+    }
+
+    pub fn button(label: &str) -> Self {
+        Self::new(ffi::wxd_WidgetTreeKind_WXD_WIDGET_TREE_BUTTON, label)
+    }
+
+    pub fn check_box(label: &str) -> Self {
+        Self::new(ffi::wxd_WidgetTreeKind_WXD_WIDGET_TREE_CHECK_BOX, label)
+    }
+
+    /// A text control holding `value` initially.
+    pub fn text_ctrl(value: &str) -> Self {
+        Self::new(ffi::wxd_WidgetTreeKind_WXD_WIDGET_TREE_TEXT_CTRL, value)
+    }
+
+    pub fn box_sizer(orientation: Orientation) -> Self {
+        Self::new(ffi::wxd_WidgetTreeKind_WXD_WIDGET_TREE_BOX_SIZER, "").style(orientation.bits())
+    }
+
+    /// A sizer inside a labelled static box; its windows are created as children of the box.
+    pub fn static_box_sizer(orientation: Orientation, label: &str) -> Self {
+        Self::new(ffi::wxd_WidgetTreeKind_WXD_WIDGET_TREE_STATIC_BOX_SIZER, label).style(orientation.bits())
+    }
+
+    /// A fixed-size spacer (DIP).
+    pub fn spacer(size: Size) -> Self {
+        Self::new(ffi::wxd_WidgetTreeKind_WXD_WIDGET_TREE_SPACER, "").size(size)
+    }
+
+    /// A spacer taking `proportion` shares of the free space.
+    pub fn stretch(proportion: i32) -> Self {
+        let mut node = Self::new(ffi::wxd_WidgetTreeKind_WXD_WIDGET_TREE_SPACER, "");
+        node.proportion = proportion.max(1);
+        node
+    }
+
+    pub fn id(mut self, id: Id) -> Self {
+        self.id = id;
+        self
+    }
+
+    /// Sets the raw window style bits (for example `ButtonStyle::Default.bits()`).
+    pub fn style(mut self, style: i64) -> Self {
+        self.style = style;
+        self
+    }
+
+    /// Sets the initial size in DIP.
+    pub fn size(mut self, size: Size) -> Self {
+        self.size = size;
+        self
+    }
+
+    pub fn tooltip(mut self, tooltip: &str) -> Self {
+        self.tooltip = tooltip.to_string();
+        self
+    }
+
+    /// Sets the proportion, flags and border of this node's item in its parent sizer.
+    pub fn item(mut self, proportion: i32, flags: SizerFlag, border: i32) -> Self {
+        self.proportion = proportion;
+        self.flags = flags;
+        self.border = border;
+        self
+    }
+
+    pub fn child(mut self, child: WidgetNode) -> Self {
+        self.children.push(child);
+        self
+    }
+
+    pub fn children(mut self, children: impl IntoIterator<Item = WidgetNode>) -> Self {
+        self.children.extend(children);
+        self
+    }
+
+    /// Creates the tree under `parent` (a root sizer becomes its sizer) and lays it out once.
+    ///
+    /// Returns the created objects in depth-first order, or `None` if the description is not a
+    /// valid tree, in which case nothing is created.
+    pub fn build(&self, parent: &dyn WxWidget) -> Option<Vec<BuiltNode>> {
+        let parent_ptr = parent.handle_ptr();
+        if parent_ptr.is_null() {
+            return None;
+        }
+        let mut blob = Vec::new();
+        let mut kinds = Vec::new();
+        self.encode(&mut blob, &mut kinds);
+
+        let mut handles = vec![std::ptr::null_mut(); kinds.len()];
+        let count =
+            unsafe { ffi::wxd_BuildWidgetTree(parent_ptr, blob.as_ptr(), blob.len(), handles.as_mut_ptr(), handles.len()) };
+        if count < 0 || count as usize != kinds.len() {
+            return None;
+        }
+        let built = kinds
+            .iter()
+            .zip(handles)
+            .map(|(kind, handle)| match *kind {
+                _ if handle.is_null() => BuiltNode::Spacer,
+                ffi::wxd_WidgetTreeKind_WXD_WIDGET_TREE_BOX_SIZER | ffi::wxd_WidgetTreeKind_WXD_WIDGET_TREE_STATIC_BOX_SIZER => {
+                    unsafe { Sizer::from_ptr(handle as *mut ffi::wxd_Sizer_t) }.map_or(BuiltNode::Spacer, BuiltNode::Sizer)
+                }
+                _ => BuiltNode::Window(unsafe { Window::from_ptr(handle as *mut ffi::wxd_Window_t) }),
+            })
+            .collect();
+        Some(built)
+    }
+
+    // Serializes in the layout documented in wxd_widget_tree.h.
+    fn encode(&self, out: &mut Vec<u8>, kinds: &mut Vec<ffi::wxd_WidgetTreeKind>) {
+        kinds.push(self.kind);
+        out.push(self.kind as u8);
+        out.extend_from_slice(&self.id.to_le_bytes());
+        out.extend_from_slice(&self.style.to_le_bytes());
+        out.extend_from_slice(&self.size.width.to_le_bytes());
+        out.extend_from_slice(&self.size.height.to_le_bytes());
+        out.extend_from_slice(&self.proportion.to_le_bytes());
+        out.extend_from_slice(&(self.flags.bits() as i32).to_le_bytes());
+        out.extend_from_slice(&self.border.to_le_bytes());
+        for text in [&self.label, &self.tooltip] {
+            out.extend_from_slice(&(text.len() as u32).to_le_bytes());
+            out.extend_from_slice(text.as_bytes());
+        }
+        out.extend_from_slice(&(self.children.len() as u32).to_le_bytes());
+        for child in &self.children {
+            child.encode(out, kinds);
+        }
+    }
+}
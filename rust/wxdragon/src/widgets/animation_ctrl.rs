@@ -8,6 +8,55 @@ use crate::window::Window;
 use std::ffi::CString;
 use wxdragon_sys as ffi;
 
+/// A GIF or ANI animation decoded once for any number of [`AnimationCtrl`]s.
+///
+/// Every frame is composited to a native bitmap up front and one timer drives all controls
+/// showing it, so a spinner repeated down a list costs one decode and one timer in total.
+/// Controls keep the animation alive after this value is dropped.
+///
+/// ```rust,no_run
+/// use wxdragon::prelude::*;
+///
+/// # fn rows(spinners: &[AnimationCtrl], gif: &[u8]) {
+/// let spinner = Animation::from_bytes(gif).expect("valid GIF");
+/// for ctrl in spinners {
+///     ctrl.set_shared_animation(Some(&spinner));
+///     ctrl.play();
+/// }
+/// # }
+/// ```
+pub struct Animation {
+    ptr: *mut ffi::wxd_Animation_t,
+}
+
+impl Animation {
+    pub fn from_bytes(data: &[u8]) -> Option<Self> {
+        let ptr = unsafe { ffi::wxd_Animation_CreateFromBytes(data.as_ptr(), data.len()) };
+        (!ptr.is_null()).then_some(Self { ptr })
+    }
+
+    pub fn from_file(path: &str) -> Option<Self> {
+        let c_path = CString::new(path).ok()?;
+        let ptr = unsafe { ffi::wxd_Animation_CreateFromFile(c_path.as_ptr()) };
+        (!ptr.is_null()).then_some(Self { ptr })
+    }
+
+    pub fn frame_count(&self) -> usize {
+        unsafe { ffi::wxd_Animation_GetFrameCount(self.ptr) as usize }
+    }
+
+    pub fn size(&self) -> Size {
+        let size = unsafe { ffi::wxd_Animation_GetSize(self.ptr) };
+        Size::new(size.width, size.height)
+    }
+}
+
+impl Drop for Animation {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_Animation_Destroy(self.ptr) };
+    }
+}
+
 // Define a standard style enum for AnimationCtrl
 widget_style_enum!(
     name: AnimationCtrlStyle,
@@ -119,6 +168,20 @@ impl AnimationCtrl {
         unsafe { ffi::wxd_AnimationCtrl_LoadFromBytes(ptr, data.as_ptr(), data.len()) }
     }
 
+    /// Shows `animation`, shared with every other control it is assigned to, in place of this
+    /// control's own animation; `None` detaches it again, as do the `load_*` methods.
+    ///
+    /// [`play`](Self::play) and [`stop`](Self::stop) then join or leave the shared playback:
+    /// all playing controls show the same frame.
+    pub fn set_shared_animation(&self, animation: Option<&Animation>) {
+        let ptr = self.animation_ctrl_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        let animation = animation.map_or(std::ptr::null(), |a| a.ptr as *const _);
+        unsafe { ffi::wxd_AnimationCtrl_SetSharedAnimation(ptr, animation) }
+    }
+
     /// Returns the underlying WindowHandle for this animation control.
     pub fn window_handle(&self) -> WindowHandle {
         self.handle
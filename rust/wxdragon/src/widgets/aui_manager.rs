@@ -1,4 +1,5 @@
 use crate::event::{Event, EventType, WxEvtHandler};
+use crate::widgets::splitter_window::LiveResizeMode;
 use crate::window::{Window, WindowHandle, WxWidget};
 use std::cell::RefCell;
 use std::collections::HashMap;
@@ -571,6 +572,173 @@ impl AuiManager {
         }
         unsafe { ffi::wxd_AuiManager_DetachPane(ptr, window.handle_ptr()) }
     }
+
+    /// Apply many pane changes with at most one layout pass.
+    ///
+    /// Changes that leave a pane as it was are skipped; if `update` is true and any pane
+    /// changed, the layout is recomputed and repainted once with the managed window frozen.
+    /// Returns the number of panes that changed (0 if the manager has been destroyed).
+    pub fn apply_pane_changes(&self, changes: &[AuiPaneChange], update: bool) -> usize {
+        let ptr = self.manager_ptr();
+        if ptr.is_null() || changes.is_empty() {
+            return 0;
+        }
+        let raw: Vec<ffi::wxd_AuiPaneChange> = changes.iter().map(AuiPaneChange::to_raw).collect();
+        let changed = unsafe { ffi::wxd_AuiManager_ApplyPaneChanges(ptr, raw.as_ptr(), raw.len(), update) };
+        changed.max(0) as usize
+    }
+
+    /// Load a perspective, reusing a per-manager cache of parsed perspectives.
+    ///
+    /// Same result as [`load_perspective`](Self::load_perspective), but each string is parsed
+    /// once, panes that already match are left in place, and switching to the layout already
+    /// shown does no layout at all. Returns false if the perspective is invalid or the manager
+    /// has been destroyed.
+    pub fn load_perspective_cached(&self, perspective: &str, update: bool) -> bool {
+        let ptr = self.manager_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        let Ok(c_perspective) = CString::new(perspective) else {
+            return false;
+        };
+        unsafe { ffi::wxd_AuiManager_LoadPerspectiveCached(ptr, c_perspective.as_ptr(), update) }
+    }
+
+    /// Sets how dragging a dock sash updates the layout.
+    ///
+    /// [`Throttled`](LiveResizeMode::Throttled) turns on live resize but lays out at most once
+    /// per `frame` (16 ms if zero). [`Snapshot`](LiveResizeMode::Snapshot) turns live resize
+    /// off, so only the sash hint moves and the layout is done once on release.
+    /// [`Native`](LiveResizeMode::Native) removes the throttle and keeps the current flags.
+    /// Returns false if the manager has been destroyed or has no managed window.
+    pub fn set_live_resize(&self, mode: LiveResizeMode, frame: std::time::Duration) -> bool {
+        let ptr = self.manager_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        let frame_ms = frame.as_millis().min(u32::MAX as u128) as u32;
+        unsafe { ffi::wxd_AuiManager_SetLiveResizeMode(ptr, mode.to_raw(), frame_ms) }
+    }
+
+    /// Drop the parsed perspectives kept by [`load_perspective_cached`](Self::load_perspective_cached).
+    pub fn clear_perspective_cache(&self) {
+        let ptr = self.manager_ptr();
+        if !ptr.is_null() {
+            unsafe { ffi::wxd_AuiManager_ClearPerspectiveCache(ptr) }
+        }
+    }
+}
+
+/// A set of changes to one managed pane, for [`AuiManager::apply_pane_changes`].
+///
+/// Only the fields set through the builder methods are applied.
+#[derive(Debug, Clone)]
+pub struct AuiPaneChange {
+    window: Option<*mut ffi::wxd_Window_t>,
+    name: Option<CString>,
+    caption: Option<CString>,
+    raw: ffi::wxd_AuiPaneChange,
+}
+
+impl Default for AuiPaneChange {
+    fn default() -> Self {
+        Self {
+            window: None,
+            name: None,
+            caption: None,
+            raw: unsafe { std::mem::zeroed() },
+        }
+    }
+}
+
+impl AuiPaneChange {
+    /// Change the pane managing `window`.
+    pub fn for_window(window: &impl WxWidget) -> Self {
+        Self {
+            window: Some(window.handle_ptr()),
+            ..Default::default()
+        }
+    }
+
+    /// Change the pane named `name`.
+    pub fn for_name(name: &str) -> Self {
+        Self {
+            name: CString::new(name).ok(),
+            ..Default::default()
+        }
+    }
+
+    fn with_field(mut self, field: u32) -> Self {
+        self.raw.fields |= field;
+        self
+    }
+
+    /// Show or hide the pane.
+    pub fn show(mut self, show: bool) -> Self {
+        self.raw.show = show;
+        self.with_field(ffi::WXD_AUI_PANE_CHANGE_SHOW)
+    }
+
+    /// Dock the pane on the given side.
+    pub fn direction(mut self, direction: DockDirection) -> Self {
+        self.raw.direction = direction as i32;
+        self.with_field(ffi::WXD_AUI_PANE_CHANGE_DIRECTION)
+    }
+
+    /// Set the dock layer.
+    pub fn layer(mut self, layer: i32) -> Self {
+        self.raw.layer = layer;
+        self.with_field(ffi::WXD_AUI_PANE_CHANGE_LAYER)
+    }
+
+    /// Set the dock row.
+    pub fn row(mut self, row: i32) -> Self {
+        self.raw.row = row;
+        self.with_field(ffi::WXD_AUI_PANE_CHANGE_ROW)
+    }
+
+    /// Set the position within the dock row.
+    pub fn position(mut self, position: i32) -> Self {
+        self.raw.position = position;
+        self.with_field(ffi::WXD_AUI_PANE_CHANGE_POSITION)
+    }
+
+    /// Set the best size.
+    pub fn best_size(mut self, width: i32, height: i32) -> Self {
+        self.raw.width = width;
+        self.raw.height = height;
+        self.with_field(ffi::WXD_AUI_PANE_CHANGE_BEST_SIZE)
+    }
+
+    /// Float the pane at the given screen position, optionally with a size.
+    pub fn float_at(mut self, x: i32, y: i32, size: Option<(i32, i32)>) -> Self {
+        self.raw.float_x = x;
+        self.raw.float_y = y;
+        let (width, height) = size.unwrap_or((0, 0));
+        self.raw.float_width = width;
+        self.raw.float_height = height;
+        self.with_field(ffi::WXD_AUI_PANE_CHANGE_FLOAT)
+    }
+
+    /// Dock a floating pane back.
+    pub fn dock(self) -> Self {
+        self.with_field(ffi::WXD_AUI_PANE_CHANGE_DOCK)
+    }
+
+    /// Set the caption.
+    pub fn caption(mut self, caption: &str) -> Self {
+        self.caption = Some(CString::new(caption).unwrap_or_default());
+        self.with_field(ffi::WXD_AUI_PANE_CHANGE_CAPTION)
+    }
+
+    fn to_raw(&self) -> ffi::wxd_AuiPaneChange {
+        let mut raw = self.raw;
+        raw.window = self.window.unwrap_or(std::ptr::null_mut());
+        raw.name = self.name.as_ref().map_or(std::ptr::null(), |name| name.as_ptr());
+        raw.caption = self.caption.as_ref().map_or(std::ptr::null(), |caption| caption.as_ptr());
+        raw
+    }
 }
 
 // Implement WxEvtHandler for AuiManager to allow event binding
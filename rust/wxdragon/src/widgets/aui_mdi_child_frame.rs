@@ -70,6 +70,20 @@ impl AuiMdiChildFrame {
     pub fn window_handle(&self) -> WindowHandle {
         self.handle
     }
+
+    /// Shows the parent's shared menubar registered under `key` while this child is active,
+    /// see [`AuiMdiParentFrame::register_shared_menu_bar`]. Such a child has no menubar of its
+    /// own; do not mix these with children that do in one frame.
+    pub fn use_shared_menu_bar(&self, key: &str) -> bool {
+        let ptr = self.child_frame_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        let Ok(key_c) = CString::new(key) else {
+            return false;
+        };
+        unsafe { ffi::wxd_AuiMDIChildFrame_UseSharedMenuBar(ptr, key_c.as_ptr()) }
+    }
 }
 
 /// Builder for AuiMdiChildFrame
@@ -78,7 +78,35 @@ impl AuiMdiParentFrame {
         self.handle
     }
 
-    // Add any AuiMdiParentFrame-specific methods here
+    /// Registers the menubar shared by all children of one document type, see
+    /// [`AuiMdiChildFrame::use_shared_menu_bar`](super::aui_mdi_child_frame::AuiMdiChildFrame::use_shared_menu_bar).
+    ///
+    /// Build it once per type: activating a child then swaps the prebuilt menubar onto the frame
+    /// instead of rebuilding menus per document. The frame takes ownership; a menubar registered
+    /// earlier under `key` is deleted. Menu commands still reach the active child first, and
+    /// state that differs between documents (checks, enabling) belongs in update-UI handlers,
+    /// as the items are shared.
+    pub fn register_shared_menu_bar(&self, key: &str, menu_bar: MenuBar) -> bool {
+        let ptr = self.handle_ptr() as *mut ffi::wxd_AuiMDIParentFrame_t;
+        if ptr.is_null() {
+            return false;
+        }
+        let Ok(key_c) = CString::new(key) else {
+            return false;
+        };
+        unsafe { ffi::wxd_AuiMDIParentFrame_RegisterMenuBar(ptr, key_c.as_ptr(), menu_bar.as_ptr()) }
+    }
+
+    /// The menubar registered under `key`, owned by the frame.
+    pub fn shared_menu_bar(&self, key: &str) -> Option<MenuBar> {
+        let ptr = self.handle_ptr() as *mut ffi::wxd_AuiMDIParentFrame_t;
+        let key_c = CString::new(key).ok()?;
+        if ptr.is_null() {
+            return None;
+        }
+        let bar = unsafe { ffi::wxd_AuiMDIParentFrame_GetSharedMenuBar(ptr, key_c.as_ptr()) };
+        (!bar.is_null()).then(|| unsafe { MenuBar::from_ptr(bar) })
+    }
 }
 
 // Use widget_builder macro to create the builder
@@ -4,7 +4,10 @@ use crate::window::{WindowHandle, WxWidget};
 // Window is used by widget_builder macro for backwards compatibility
 #[allow(unused_imports)]
 use crate::window::Window;
+use std::cell::RefCell;
 use std::ffi::CString;
+use std::os::raw::c_void;
+use std::panic::{self, AssertUnwindSafe};
 use wxdragon_sys as ffi;
 
 // Define style enum for AuiNotebook
@@ -207,6 +210,150 @@ impl AuiNotebook {
     pub fn window_handle(&self) -> WindowHandle {
         self.handle
     }
+
+    /// Turns on virtual tabs. `label` is asked for the label of tab `key` only once that tab
+    /// scrolls into view, and again after [`invalidate_virtual_tab`](Self::invalidate_virtual_tab);
+    /// returning `None` leaves the tab unlabelled. Page content comes from the lazy page factory
+    /// (see [`LazyBookCtrl::enable_lazy_pages`](crate::widgets::lazy_book::LazyBookCtrl)), which
+    /// must be enabled before adding virtual tabs. Replaces any previous label callback.
+    pub fn enable_virtual_tabs<F>(&self, label: F) -> bool
+    where
+        F: Fn(i64) -> Option<VirtualTabLabel> + 'static,
+    {
+        let ptr = self.notebook_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        let source = Box::into_raw(Box::new(VirtualTabSource {
+            label: Box::new(label),
+            last: RefCell::new(None),
+        }));
+        let result = unsafe {
+            ffi::wxd_AuiNotebook_EnableVirtualTabs(
+                ptr,
+                source as *mut c_void,
+                Some(virtual_tab_label),
+                Some(virtual_tab_drop_source),
+            )
+        };
+        if !result {
+            unsafe { drop(Box::from_raw(source)) };
+        }
+        result
+    }
+
+    /// Turns virtual tabs off; tabs keep the labels they already have.
+    pub fn disable_virtual_tabs(&self) {
+        let ptr = self.notebook_ptr();
+        if !ptr.is_null() {
+            unsafe { ffi::wxd_AuiNotebook_DisableVirtualTabs(ptr) };
+        }
+    }
+
+    /// Appends a placeholder tab for each key not already present, laying the tab strip out
+    /// once. Returns the number of tabs added.
+    pub fn append_virtual_tabs(&self, keys: &[i64]) -> usize {
+        let ptr = self.notebook_ptr();
+        if ptr.is_null() || keys.is_empty() {
+            return 0;
+        }
+        unsafe { ffi::wxd_AuiNotebook_AppendVirtualTabs(ptr, keys.as_ptr(), keys.len()) }
+    }
+
+    /// Page of the virtual tab `key`, found in constant time.
+    pub fn virtual_tab_page(&self, key: i64) -> Option<Panel> {
+        let ptr = self.notebook_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        let page = unsafe { ffi::wxd_AuiNotebook_GetVirtualTabPage(ptr, key) };
+        if page.is_null() {
+            None
+        } else {
+            Some(unsafe { Panel::from_ptr(page as *mut ffi::wxd_Panel_t) })
+        }
+    }
+
+    /// Index of the virtual tab `key`.
+    pub fn find_virtual_tab(&self, key: i64) -> Option<usize> {
+        let ptr = self.notebook_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        let index = unsafe { ffi::wxd_AuiNotebook_FindVirtualTab(ptr, key) };
+        usize::try_from(index).ok()
+    }
+
+    /// Selects the virtual tab `key`, building its content if needed.
+    pub fn select_virtual_tab(&self, key: i64) -> bool {
+        let ptr = self.notebook_ptr();
+        !ptr.is_null() && unsafe { ffi::wxd_AuiNotebook_SelectVirtualTab(ptr, key) }
+    }
+
+    /// Re-asks the label callback for tab `key` the next time it is visible, e.g. after the
+    /// document was renamed or modified.
+    pub fn invalidate_virtual_tab(&self, key: i64) {
+        let ptr = self.notebook_ptr();
+        if !ptr.is_null() {
+            unsafe { ffi::wxd_AuiNotebook_InvalidateVirtualTab(ptr, key) };
+        }
+    }
+}
+
+/// Label and icon of a virtual tab, see [`AuiNotebook::enable_virtual_tabs`].
+#[derive(Debug)]
+pub struct VirtualTabLabel {
+    /// Tab caption.
+    pub text: String,
+    /// Optional tab icon.
+    pub bitmap: Option<Bitmap>,
+}
+
+impl VirtualTabLabel {
+    /// A text-only label.
+    pub fn new(text: impl Into<String>) -> Self {
+        Self {
+            text: text.into(),
+            bitmap: None,
+        }
+    }
+
+    /// Adds an icon to the label.
+    pub fn with_bitmap(mut self, bitmap: Bitmap) -> Self {
+        self.bitmap = Some(bitmap);
+        self
+    }
+}
+
+struct VirtualTabSource {
+    label: Box<dyn Fn(i64) -> Option<VirtualTabLabel>>,
+    // Keeps the last label alive until C++ has copied it.
+    last: RefCell<Option<VirtualTabLabel>>,
+}
+
+unsafe extern "C" fn virtual_tab_label(userdata: *mut c_void, key: i64, out: *mut ffi::wxd_AuiVirtualTabLabel) -> bool {
+    if userdata.is_null() || out.is_null() {
+        return false;
+    }
+    let source = unsafe { &*(userdata as *const VirtualTabSource) };
+    let label = panic::catch_unwind(AssertUnwindSafe(|| (source.label)(key))).unwrap_or(None);
+    let mut last = source.last.borrow_mut();
+    *last = label;
+    let Some(label) = last.as_ref() else {
+        return false;
+    };
+    unsafe {
+        (*out).text = label.text.as_ptr() as *const _;
+        (*out).text_len = label.text.len();
+        (*out).bitmap = label.bitmap.as_ref().map_or(std::ptr::null(), |b| b.as_const_ptr());
+    }
+    true
+}
+
+unsafe extern "C" fn virtual_tab_drop_source(userdata: *mut c_void) {
+    if !userdata.is_null() {
+        unsafe { drop(Box::from_raw(userdata as *mut VirtualTabSource)) };
+    }
 }
 
 // Manual WxWidget implementation for AuiNotebook (using WindowHandle)
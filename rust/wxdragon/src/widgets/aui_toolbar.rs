@@ -3,6 +3,7 @@ use std::os::raw::{c_int, c_longlong};
 
 use crate::event::{Event, EventType, WxEvtHandler};
 use crate::prelude::*;
+use crate::widgets::toolbar::{ToolDesc, pack_tool_descs};
 use crate::window::{WindowHandle, WxWidget};
 use wxdragon_sys as ffi;
 
@@ -336,6 +337,37 @@ impl AuiToolBar {
         unsafe { ffi::wxd_AuiToolBar_ClearTools(ptr) };
     }
 
+    /// Adds all `tools` and realizes the toolbar once; see
+    /// [`ToolBar::add_tools`](crate::widgets::toolbar::ToolBar::add_tools).
+    /// Returns the number of tools added.
+    pub fn add_tools(&self, tools: &[ToolDesc<'_>]) -> usize {
+        let ptr = self.toolbar_ptr();
+        if ptr.is_null() {
+            return 0;
+        }
+        let (_strings, descs) = pack_tool_descs(tools);
+        unsafe { ffi::wxd_AuiToolBar_AddTools(ptr, descs.as_ptr(), descs.len()) }
+    }
+
+    /// Shows or hides tools by id, moving only the tools that change and realizing once.
+    /// Returns the number of tools changed.
+    pub fn set_tools_visible(&self, tools: &[(i32, bool)]) -> usize {
+        let ptr = self.toolbar_ptr();
+        if ptr.is_null() {
+            return 0;
+        }
+        let ids: Vec<c_int> = tools.iter().map(|(id, _)| *id as c_int).collect();
+        let visible: Vec<bool> = tools.iter().map(|(_, visible)| *visible).collect();
+        unsafe { ffi::wxd_AuiToolBar_SetToolsVisible(ptr, ids.as_ptr(), visible.as_ptr(), ids.len()) }
+    }
+
+    /// Whether the tool is on the toolbar and not hidden by
+    /// [`set_tools_visible`](Self::set_tools_visible).
+    pub fn is_tool_visible(&self, tool_id: i32) -> bool {
+        let ptr = self.toolbar_ptr();
+        !ptr.is_null() && unsafe { ffi::wxd_AuiToolBar_IsToolVisible(ptr, tool_id as c_int) }
+    }
+
     /// Deletes a tool.
     /// Returns false if the toolbar has been destroyed.
     pub fn delete_tool(&self, tool_id: i32) -> bool {
@@ -1,8 +1,11 @@
+use crate::color::Colour;
 use crate::datetime::DateTime;
 use crate::event::{Event, EventType, WxEvtHandler};
 use crate::geometry::{Point, Size};
 use crate::id::Id;
 use crate::window::{WindowHandle, WxWidget};
+use std::cell::RefCell;
+use std::ffi::c_void;
 use std::ptr;
 use wxdragon_sys as ffi;
 
@@ -23,6 +26,55 @@ widget_style_enum!(
     default_variant: Default
 );
 
+/// Border drawn around a day of a [`CalendarCtrl`].
+#[derive(Debug, Copy, Clone, PartialEq, Eq, Default)]
+pub enum CalendarDateBorder {
+    #[default]
+    None,
+    Square,
+    Round,
+}
+
+/// Look of one day of a [`CalendarCtrl`]; the default value is the default look.
+///
+/// Native calendars may only show some of it (typically `holiday` and `bold`); the generic
+/// control shows all of it.
+#[derive(Debug, Copy, Clone, PartialEq, Eq, Default)]
+pub struct CalendarDayAttr {
+    pub text_colour: Option<Colour>,
+    pub background_colour: Option<Colour>,
+    pub border_colour: Option<Colour>,
+    pub border: CalendarDateBorder,
+    pub holiday: bool,
+    pub bold: bool,
+}
+
+impl CalendarDayAttr {
+    fn to_ffi(self) -> ffi::wxd_CalendarDayAttr {
+        ffi::wxd_CalendarDayAttr {
+            has_text_colour: self.text_colour.is_some(),
+            text_colour: ffi_colour(self.text_colour),
+            has_bg_colour: self.background_colour.is_some(),
+            bg_colour: ffi_colour(self.background_colour),
+            has_border_colour: self.border_colour.is_some(),
+            border_colour: ffi_colour(self.border_colour),
+            border: match self.border {
+                CalendarDateBorder::None => ffi::wxd_CalendarDateBorder_WXD_CAL_BORDER_NONE,
+                CalendarDateBorder::Square => ffi::wxd_CalendarDateBorder_WXD_CAL_BORDER_SQUARE,
+                CalendarDateBorder::Round => ffi::wxd_CalendarDateBorder_WXD_CAL_BORDER_ROUND,
+            } as i32,
+            holiday: self.holiday,
+            bold: self.bold,
+        }
+    }
+}
+
+fn ffi_colour(colour: Option<Colour>) -> ffi::wxd_Colour_t {
+    colour.map_or(ffi::wxd_Colour_t { r: 0, g: 0, b: 0, a: 0 }, Into::into)
+}
+
+type MonthAttrsProvider = Box<dyn FnMut(i32, u32, &mut [CalendarDayAttr; 31]) -> bool>;
+
 /// Represents a `wxCalendarCtrl`.
 ///
 /// CalendarCtrl uses `WindowHandle` internally for safe memory management.
@@ -98,12 +150,107 @@ impl CalendarCtrl {
         }
     }
 
+    /// Sets the look of every day of `month` (1-12) of `year` in one call: `days[0]` is the
+    /// first of the month, missing days get the default look and surplus entries are ignored. The attributes are kept,
+    /// and whenever the calendar moves to that month all its days are set in one frozen pass,
+    /// instead of one native call and repaint per day on every month change. An empty slice
+    /// forgets the month. Returns false for an invalid month or a destroyed control.
+    pub fn set_month_attrs(&self, year: i32, month: u32, days: &[CalendarDayAttr]) -> bool {
+        let ptr = self.calendar_ptr();
+        if ptr.is_null() || !(1..=12).contains(&month) {
+            return false;
+        }
+        if days.is_empty() {
+            return unsafe { ffi::wxd_CalendarCtrl_SetMonthAttrs(ptr, year, month as i32, ptr::null()) };
+        }
+        let mut attrs = [CalendarDayAttr::default().to_ffi(); 31];
+        for (slot, day) in attrs.iter_mut().zip(days) {
+            *slot = day.to_ffi();
+        }
+        unsafe { ffi::wxd_CalendarCtrl_SetMonthAttrs(ptr, year, month as i32, attrs.as_ptr()) }
+    }
+
+    /// Asks `provider` for a month's day attributes only when that month is shown (and right
+    /// away for the month shown now), for months without [`set_month_attrs`](Self::set_month_attrs).
+    /// The provider gets the year, the month (1-12) and 31 default entries, day 1 first, and
+    /// returns false to leave the month at the default look. Replaces any earlier provider.
+    pub fn set_month_attrs_provider<F>(&self, provider: F) -> bool
+    where
+        F: FnMut(i32, u32, &mut [CalendarDayAttr; 31]) -> bool + 'static,
+    {
+        let ptr = self.calendar_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        let provider: Box<RefCell<MonthAttrsProvider>> = Box::new(RefCell::new(Box::new(provider)));
+        let user_data = Box::into_raw(provider) as *mut c_void;
+        let ok = unsafe {
+            ffi::wxd_CalendarCtrl_SetMonthAttrsProvider(
+                ptr,
+                Some(provide_month_attrs),
+                user_data,
+                Some(free_month_attrs_provider),
+            )
+        };
+        if !ok {
+            unsafe { free_month_attrs_provider(user_data) };
+        }
+        ok
+    }
+
+    /// Removes the provider set by [`set_month_attrs_provider`](Self::set_month_attrs_provider).
+    pub fn clear_month_attrs_provider(&self) {
+        let ptr = self.calendar_ptr();
+        if !ptr.is_null() {
+            unsafe { ffi::wxd_CalendarCtrl_SetMonthAttrsProvider(ptr, None, ptr::null_mut(), None) };
+        }
+    }
+
+    /// Applies the shown month's attributes again, asking the provider anew, e.g. after the
+    /// data behind it changed.
+    pub fn refresh_month_attrs(&self) {
+        let ptr = self.calendar_ptr();
+        if !ptr.is_null() {
+            unsafe { ffi::wxd_CalendarCtrl_RefreshMonthAttrs(ptr) }
+        }
+    }
+
     /// Returns the underlying WindowHandle for this calendar control.
     pub fn window_handle(&self) -> WindowHandle {
         self.handle
     }
 }
 
+unsafe extern "C" fn provide_month_attrs(
+    user_data: *mut c_void,
+    year: i32,
+    month: i32,
+    attrs: *mut ffi::wxd_CalendarDayAttr,
+) -> bool {
+    if user_data.is_null() || attrs.is_null() {
+        return false;
+    }
+    let provider = unsafe { &*(user_data as *const RefCell<MonthAttrsProvider>) };
+    let Ok(mut provider) = provider.try_borrow_mut() else {
+        return false;
+    };
+    let mut days = [CalendarDayAttr::default(); 31];
+    if !provider(year, month as u32, &mut days) {
+        return false;
+    }
+    let out = unsafe { std::slice::from_raw_parts_mut(attrs, 31) };
+    for (slot, day) in out.iter_mut().zip(days) {
+        *slot = day.to_ffi();
+    }
+    true
+}
+
+unsafe extern "C" fn free_month_attrs_provider(user_data: *mut c_void) {
+    if !user_data.is_null() {
+        drop(unsafe { Box::from_raw(user_data as *mut RefCell<MonthAttrsProvider>) });
+    }
+}
+
 // --- CalendarCtrl Event Handling ---
 
 /// Event types specific to `CalendarCtrl`.
@@ -0,0 +1,174 @@
+//! Retained, double-buffered canvas with dirty-region repaint.
+
+use crate::dc::GenericDC;
+use crate::event::WxEvtHandler;
+use crate::geometry::{Point, Rect, Size};
+use crate::id::Id;
+use crate::window::{WindowHandle, WxWidget};
+use std::ffi::c_void;
+use wxdragon_sys as ffi;
+
+widget_style_enum!(
+    name: CanvasStyle,
+    doc: "Style flags for Canvas.",
+    variants: {
+        Default: 0, "Default style."
+    },
+    default_variant: Default
+);
+
+type RenderFn = Box<dyn FnMut(&GenericDC, Rect)>;
+
+/// A window that keeps its content in a backing bitmap and only redraws what was invalidated.
+///
+/// The renderer set with [`Canvas::on_render`] draws into the backing store; the DC it receives is
+/// clipped to the dirty region, which is already filled with the background colour. Paint events
+/// only copy the backing store to the screen, so exposing, moving or partially covering the canvas
+/// never calls the renderer, and redraw cost is proportional to what changed.
+///
+/// # Example
+/// ```ignore
+/// let canvas = Canvas::builder(&frame).build();
+/// canvas.on_render(move |dc, dirty| {
+///     // Draw only the items that intersect `dirty`.
+/// });
+/// canvas.invalidate(Rect::new(10, 10, 64, 64));
+/// canvas.scroll_buffer(0, -20); // content moved up; only the bottom strip is re-rendered
+/// ```
+#[derive(Clone, Copy)]
+pub struct Canvas {
+    handle: WindowHandle,
+}
+
+impl Canvas {
+    /// Creates a new `CanvasBuilder` for constructing a canvas.
+    pub fn builder(parent: &dyn WxWidget) -> CanvasBuilder<'_> {
+        CanvasBuilder::new(parent)
+    }
+
+    #[inline]
+    fn canvas_ptr(&self) -> *mut ffi::wxd_Canvas_t {
+        self.handle
+            .get_ptr()
+            .map(|p| p as *mut ffi::wxd_Canvas_t)
+            .unwrap_or(std::ptr::null_mut())
+    }
+
+    /// Sets the renderer, replacing any previous one, and invalidates the whole canvas.
+    ///
+    /// The closure receives a DC onto the backing store and the bounding box of the dirty region.
+    /// It may call [`Canvas::invalidate`] to schedule another pass.
+    pub fn on_render<F>(&self, render: F)
+    where
+        F: FnMut(&GenericDC, Rect) + 'static,
+    {
+        let ptr = self.canvas_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        let boxed: Box<RenderFn> = Box::new(Box::new(render));
+        let user_data = Box::into_raw(boxed) as *mut c_void;
+        unsafe {
+            ffi::wxd_Canvas_SetRenderer(ptr, Some(render_trampoline), user_data, Some(free_render_fn));
+        }
+    }
+
+    /// Marks `rect` (client coordinates) for redrawing at the next paint.
+    pub fn invalidate(&self, rect: Rect) {
+        let ptr = self.canvas_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_Canvas_Invalidate(ptr, rect.into()) };
+    }
+
+    /// Marks the whole canvas for redrawing at the next paint.
+    pub fn invalidate_all(&self) {
+        let ptr = self.canvas_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_Canvas_InvalidateAll(ptr) };
+    }
+
+    /// Moves the retained content by (`dx`, `dy`) and invalidates only the uncovered strips.
+    pub fn scroll_buffer(&self, dx: i32, dy: i32) {
+        let ptr = self.canvas_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_Canvas_ScrollBuffer(ptr, dx, dy) };
+    }
+
+    /// Creates a Canvas from a raw pointer.
+    /// # Safety
+    /// The pointer must be a valid `wxd_Canvas_t`.
+    pub(crate) unsafe fn from_ptr(ptr: *mut ffi::wxd_Canvas_t) -> Self {
+        assert!(!ptr.is_null());
+        Canvas {
+            handle: WindowHandle::new(ptr as *mut ffi::wxd_Window_t),
+        }
+    }
+
+    /// Returns the underlying WindowHandle for this canvas.
+    pub fn window_handle(&self) -> WindowHandle {
+        self.handle
+    }
+}
+
+extern "C" fn render_trampoline(user_data: *mut c_void, dc: *mut ffi::wxd_DC_t, dirty: ffi::wxd_Rect) {
+    if user_data.is_null() || dc.is_null() {
+        return;
+    }
+    let render = unsafe { &mut *(user_data as *mut RenderFn) };
+    let dc = unsafe { GenericDC::from_ffi_ptr_unowned(dc) };
+    render(&dc, dirty.into());
+}
+
+extern "C" fn free_render_fn(user_data: *mut c_void) {
+    if !user_data.is_null() {
+        let _ = unsafe { Box::from_raw(user_data as *mut RenderFn) };
+    }
+}
+
+impl WxWidget for Canvas {
+    fn handle_ptr(&self) -> *mut ffi::wxd_Window_t {
+        self.handle.get_ptr().unwrap_or(std::ptr::null_mut())
+    }
+
+    fn is_valid(&self) -> bool {
+        self.handle.is_valid()
+    }
+}
+
+impl WxEvtHandler for Canvas {
+    unsafe fn get_event_handler_ptr(&self) -> *mut ffi::wxd_EvtHandler_t {
+        self.handle.get_ptr().unwrap_or(std::ptr::null_mut()) as *mut ffi::wxd_EvtHandler_t
+    }
+}
+
+// Size, mouse and keyboard events. Paint events are handled by the canvas itself.
+impl crate::event::WindowEvents for Canvas {}
+
+widget_builder!(
+    name: Canvas,
+    parent_type: &'a dyn WxWidget,
+    style_type: CanvasStyle,
+    fields: {},
+    build_impl: |slf| {
+        let parent_ptr = slf.parent.handle_ptr();
+        unsafe {
+            let ctrl_ptr = ffi::wxd_Canvas_Create(
+                parent_ptr,
+                slf.id,
+                slf.pos.x,
+                slf.pos.y,
+                slf.size.width,
+                slf.size.height,
+                slf.style.bits(),
+            );
+            assert!(!ctrl_ptr.is_null(), "wxd_Canvas_Create returned null");
+            Canvas::from_ptr(ctrl_ptr)
+        }
+    }
+);
@@ -131,6 +131,33 @@ impl CheckListBox {
         }
     }
 
+    /// Replaces all items with `items` in a single native call, which is much faster than
+    /// clearing and appending one by one for long lists.
+    /// No-op if the check list box has been destroyed.
+    pub fn set_items<S: AsRef<str>>(&self, items: &[S]) {
+        let ptr = self.checklistbox_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        let (packed, offsets) = crate::dc::pack_utf8(items.iter().map(|s| s.as_ref()));
+        unsafe {
+            ffi::wxd_CheckListBox_SetItems(ptr, packed.as_ptr() as *const _, offsets.as_ptr(), items.len());
+        }
+    }
+
+    /// Appends `items` in a single native call.
+    /// No-op if the check list box has been destroyed.
+    pub fn append_items<S: AsRef<str>>(&self, items: &[S]) {
+        let ptr = self.checklistbox_ptr();
+        if ptr.is_null() || items.is_empty() {
+            return;
+        }
+        let (packed, offsets) = crate::dc::pack_utf8(items.iter().map(|s| s.as_ref()));
+        unsafe {
+            ffi::wxd_CheckListBox_AppendItems(ptr, packed.as_ptr() as *const _, offsets.as_ptr(), items.len());
+        }
+    }
+
     /// Clears all items from the checklistbox.
     pub fn clear(&self) {
         let ptr = self.checklistbox_ptr();
@@ -320,9 +347,7 @@ widget_builder!(
         };
 
         // Append initial choices
-        for choice_str in &slf.choices {
-            clbox.append(choice_str);
-        }
+        clbox.append_items(&slf.choices);
 
         clbox
     }
@@ -73,6 +73,33 @@ impl Choice {
         }
     }
 
+    /// Replaces all items with `items` in a single native call, which is much faster than
+    /// clearing and appending one by one for long lists.
+    /// No-op if the choice has been destroyed.
+    pub fn set_items<S: AsRef<str>>(&self, items: &[S]) {
+        let ptr = self.widget_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        let (packed, offsets) = crate::dc::pack_utf8(items.iter().map(|s| s.as_ref()));
+        unsafe {
+            ffi::wxd_Choice_SetItems(ptr, packed.as_ptr() as *const _, offsets.as_ptr(), items.len());
+        }
+    }
+
+    /// Appends `items` in a single native call.
+    /// No-op if the choice has been destroyed.
+    pub fn append_items<S: AsRef<str>>(&self, items: &[S]) {
+        let ptr = self.widget_ptr();
+        if ptr.is_null() || items.is_empty() {
+            return;
+        }
+        let (packed, offsets) = crate::dc::pack_utf8(items.iter().map(|s| s.as_ref()));
+        unsafe {
+            ffi::wxd_Choice_AppendItems(ptr, packed.as_ptr() as *const _, offsets.as_ptr(), items.len());
+        }
+    }
+
     /// Clears all items from the choice control.
     /// No-op if the widget has been destroyed.
     pub fn clear(&self) {
@@ -193,9 +220,7 @@ widget_builder!(
         };
 
         // Add initial choices
-        for choice_str in &slf.choices {
-            choice.append(choice_str);
-        }
+        choice.append_items(&slf.choices);
 
         // Set initial selection if provided
         if let Some(sel) = slf.selection {
@@ -66,6 +66,44 @@ impl ComboBox {
         }
     }
 
+    /// Replaces all items with `items` in a single native call, which is much faster than
+    /// clearing and appending one by one for long lists.
+    /// No-op if the combo box has been destroyed.
+    pub fn set_items<S: AsRef<str>>(&self, items: &[S]) {
+        let ptr = self.combobox_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        let (packed, offsets) = crate::dc::pack_utf8(items.iter().map(|s| s.as_ref()));
+        unsafe {
+            ffi::wxd_ComboBox_SetItems(ptr, packed.as_ptr() as *const _, offsets.as_ptr(), items.len());
+        }
+    }
+
+    /// Appends `items` in a single native call.
+    /// No-op if the combo box has been destroyed.
+    pub fn append_items<S: AsRef<str>>(&self, items: &[S]) {
+        let ptr = self.combobox_ptr();
+        if ptr.is_null() || items.is_empty() {
+            return;
+        }
+        let (packed, offsets) = crate::dc::pack_utf8(items.iter().map(|s| s.as_ref()));
+        unsafe {
+            ffi::wxd_ComboBox_AppendItems(ptr, packed.as_ptr() as *const _, offsets.as_ptr(), items.len());
+        }
+    }
+
+    /// Drives this control's autocompletion popup from `index`, replacing any previous completer;
+    /// `None` turns autocompletion off.
+    /// No-op if the combo box has been destroyed.
+    pub fn set_completion_index(&self, index: Option<&crate::widgets::CompletionIndex>) {
+        let ptr = self.combobox_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_ComboBox_SetCompletionIndex(ptr, crate::widgets::completion_index::raw_index(index)) };
+    }
+
     /// Clears all items from the combobox.
     /// Does not clear the text entry field value.
     /// No-op if the combobox has been destroyed.
@@ -309,9 +347,7 @@ widget_builder!(
             };
 
             // Append initial choices
-            for item in &slf.choices {
-                combo.append(item);
-            }
+            combo.append_items(&slf.choices);
 
             combo
         }
@@ -0,0 +1,119 @@
+//! Native prefix index for text-entry autocompletion.
+//!
+//! A [`CompletionIndex`] holds a sorted list of strings on the native side and answers the
+//! autocompletion popup of a [`TextCtrl`](crate::widgets::TextCtrl),
+//! [`ComboBox`](crate::widgets::ComboBox) or [`SearchCtrl`](crate::widgets::SearchCtrl) by binary
+//! search, so typing never calls back into Rust. Load it once with [`CompletionIndex::set_entries`]
+//! and patch it with [`CompletionIndex::add_entries`] / [`CompletionIndex::remove_entries`]; the
+//! attached controls see the changes on their next keystroke.
+//!
+//! ```rust,no_run
+//! # use wxdragon::prelude::*;
+//! # fn demo(text: &TextCtrl, words: &[String]) {
+//! let index = CompletionIndex::new(false);
+//! index.set_entries(words);
+//! text.set_completion_index(Some(&index));
+//! # }
+//! ```
+
+use crate::utils::ArrayString;
+use std::ffi::CString;
+use wxdragon_sys as ffi;
+
+/// A sorted, native-side set of completion candidates. Matching is by prefix, case-insensitive
+/// unless created with `case_sensitive`, and returns at most [`set_max_results`](Self::set_max_results)
+/// entries (100 by default) in sorted order.
+///
+/// Controls keep the index alive while attached, so dropping it does not turn completion off;
+/// use `set_completion_index(None)` for that.
+pub struct CompletionIndex {
+    ptr: *mut ffi::wxd_CompletionIndex_t,
+}
+
+impl CompletionIndex {
+    pub fn new(case_sensitive: bool) -> Self {
+        let ptr = unsafe { ffi::wxd_CompletionIndex_Create(case_sensitive, 0) };
+        assert!(!ptr.is_null(), "Failed to create CompletionIndex");
+        Self { ptr }
+    }
+
+    /// Replaces all entries. Duplicates are stored once.
+    pub fn set_entries<S: AsRef<str>>(&self, entries: &[S]) {
+        let (packed, offsets) = crate::dc::pack_utf8(entries.iter().map(|s| s.as_ref()));
+        unsafe {
+            ffi::wxd_CompletionIndex_SetEntries(self.ptr, packed.as_ptr() as *const _, offsets.as_ptr(), entries.len());
+        }
+    }
+
+    /// Adds entries that are not already present.
+    pub fn add_entries<S: AsRef<str>>(&self, entries: &[S]) {
+        if entries.is_empty() {
+            return;
+        }
+        let (packed, offsets) = crate::dc::pack_utf8(entries.iter().map(|s| s.as_ref()));
+        unsafe {
+            ffi::wxd_CompletionIndex_AddEntries(self.ptr, packed.as_ptr() as *const _, offsets.as_ptr(), entries.len());
+        }
+    }
+
+    /// Removes the given entries (exact matches).
+    pub fn remove_entries<S: AsRef<str>>(&self, entries: &[S]) {
+        if entries.is_empty() {
+            return;
+        }
+        let (packed, offsets) = crate::dc::pack_utf8(entries.iter().map(|s| s.as_ref()));
+        unsafe {
+            ffi::wxd_CompletionIndex_RemoveEntries(self.ptr, packed.as_ptr() as *const _, offsets.as_ptr(), entries.len());
+        }
+    }
+
+    pub fn clear(&self) {
+        unsafe { ffi::wxd_CompletionIndex_Clear(self.ptr) };
+    }
+
+    pub fn len(&self) -> usize {
+        unsafe { ffi::wxd_CompletionIndex_GetCount(self.ptr) }
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    /// Caps the number of suggestions per query; `0` restores the default of 100.
+    pub fn set_max_results(&self, max_results: u32) {
+        unsafe { ffi::wxd_CompletionIndex_SetMaxResults(self.ptr, max_results) };
+    }
+
+    /// The suggestions the attached controls would show for `prefix`.
+    pub fn query(&self, prefix: &str) -> Vec<String> {
+        let prefix = CString::new(prefix.split('\0').next().unwrap_or_default()).unwrap_or_default();
+        let mut out = ArrayString::new();
+        unsafe { ffi::wxd_CompletionIndex_Query(self.ptr, prefix.as_ptr(), out.as_mut_ptr()) };
+        out.into()
+    }
+
+    pub(crate) fn as_ptr(&self) -> *mut ffi::wxd_CompletionIndex_t {
+        self.ptr
+    }
+}
+
+impl Default for CompletionIndex {
+    fn default() -> Self {
+        Self::new(false)
+    }
+}
+
+impl Drop for CompletionIndex {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_CompletionIndex_Destroy(self.ptr) };
+    }
+}
+
+// SAFETY: the native index is internally locked and owns no window objects.
+unsafe impl Send for CompletionIndex {}
+unsafe impl Sync for CompletionIndex {}
+
+/// Maps `Option<&CompletionIndex>` to the pointer the `*_SetCompletionIndex` calls take.
+pub(crate) fn raw_index(index: Option<&CompletionIndex>) -> *mut ffi::wxd_CompletionIndex_t {
+    index.map_or(std::ptr::null_mut(), CompletionIndex::as_ptr)
+}
@@ -15,6 +15,7 @@ use super::{
 use crate::color::Colour;
 use crate::event::WxEvtHandler;
 use crate::geometry::{Point, Size};
+use crate::widgets::list_ctrl::{TypeAheadMode, type_ahead_find};
 use crate::window::WindowHandle;
 
 // Define style enum for DataViewCtrl using the macro
@@ -33,6 +34,42 @@ widget_style_enum!(
     default_variant: Single
 );
 
+/// Which displayed rows [`DataViewCtrl::autosize_column_sampled`] measures. For tree models the
+/// displayed rows are those reachable through expanded nodes.
+#[derive(Debug, Copy, Clone, PartialEq, Eq)]
+pub struct DataViewAutoSizeSample {
+    /// Measure the rows currently scrolled into view.
+    pub visible_rows: bool,
+    /// Measure the first N rows.
+    pub head_rows: i32,
+    /// Measure the last N rows.
+    pub tail_rows: i32,
+    /// Measure N rows spread evenly over all rows.
+    pub stride_rows: i32,
+}
+
+impl Default for DataViewAutoSizeSample {
+    fn default() -> Self {
+        Self {
+            visible_rows: true,
+            head_rows: 100,
+            tail_rows: 100,
+            stride_rows: 200,
+        }
+    }
+}
+
+impl DataViewAutoSizeSample {
+    fn to_ffi(self) -> ffi::wxd_DataViewAutoSizeSample {
+        ffi::wxd_DataViewAutoSizeSample {
+            visible_rows: self.visible_rows,
+            head_rows: self.head_rows,
+            tail_rows: self.tail_rows,
+            stride_rows: self.stride_rows,
+        }
+    }
+}
+
 /// Represents a wxWidgets DataViewCtrl in Rust.
 ///
 /// DataViewCtrl is a control that displays data in a tabular or tree-like format,
@@ -622,6 +659,51 @@ impl DataViewCtrl {
         unsafe { ffi::wxd_DataViewCtrl_Expand(self.dvc_ptr(), **item) };
     }
 
+    /// Expands all `items` at once, parents before children, with a single relayout. Use it to
+    /// restore a state saved with [`expanded_items`](Self::expanded_items).
+    pub fn expand_items(&self, items: &[DataViewItem]) {
+        let raw: Vec<*const ffi::wxd_DataViewItem_t> = items.iter().map(|item| **item).collect();
+        unsafe { ffi::wxd_DataViewCtrl_ExpandItems(self.dvc_ptr(), raw.as_ptr(), raw.len()) };
+    }
+
+    /// The expanded items of a tree model, parents before children.
+    pub fn expanded_items(&self) -> Vec<DataViewItem> {
+        let count = unsafe { ffi::wxd_DataViewCtrl_GetExpandedItems(self.dvc_ptr(), std::ptr::null_mut(), 0) };
+        let mut ids = vec![std::ptr::null_mut(); count];
+        let written = unsafe { ffi::wxd_DataViewCtrl_GetExpandedItems(self.dvc_ptr(), ids.as_mut_ptr(), ids.len()) };
+        ids.truncate(written.min(count));
+        ids.into_iter().map(|id| DataViewItem::from_id_ptr(id as *const u8)).collect()
+    }
+
+    /// Sizes `column` to fit the title and the sampled rows instead of measuring every row.
+    /// Returns the width applied.
+    pub fn autosize_column_sampled(&self, column: &DataViewColumn, sample: DataViewAutoSizeSample) -> Option<i32> {
+        let sample = sample.to_ffi();
+        let width = unsafe { ffi::wxd_DataViewCtrl_AutoSizeColumnSampled(self.dvc_ptr(), column.as_raw(), &sample) };
+        (width >= 0).then_some(width)
+    }
+
+    /// Like [`autosize_column_sampled`](Self::autosize_column_sampled) for all shown columns,
+    /// sampling the rows once.
+    pub fn autosize_columns_sampled(&self, sample: DataViewAutoSizeSample) {
+        let sample = sample.to_ffi();
+        unsafe { ffi::wxd_DataViewCtrl_AutoSizeColumnsSampled(self.dvc_ptr(), &sample) };
+    }
+
+    /// Keeps the column projection of the control's custom virtual list model at the columns in
+    /// view, so the model's callbacks are not asked for cells nobody can see. With the generic
+    /// control this follows horizontal scrolling; native controls project every shown column of
+    /// nonzero width. Disabling serves every column again. Returns false if this is not a
+    /// DataView control.
+    pub fn enable_column_projection(&self, enable: bool) -> bool {
+        unsafe { ffi::wxd_DataViewCtrl_EnableColumnProjection(self.dvc_ptr(), enable) }
+    }
+
+    /// Recomputes the projection after changing column widths or visibility.
+    pub fn update_column_projection(&self) {
+        unsafe { ffi::wxd_DataViewCtrl_UpdateColumnProjection(self.dvc_ptr()) };
+    }
+
     /// Ensure the given item is visible (scroll into view)
     pub fn ensure_visible(&self, item: &DataViewItem) {
         unsafe { ffi::wxd_DataViewCtrl_EnsureVisible(self.dvc_ptr(), **item) };
@@ -770,6 +852,27 @@ impl DataViewCtrl {
         let ok = unsafe { ffi::wxd_DataViewCtrl_GetSortingState(self.dvc_ptr(), &mut col, &mut asc) };
         if ok && col >= 0 { Some((col as usize, asc)) } else { None }
     }
+
+    /// Enables type-to-find on model column `column`: typed text selects, focuses and scrolls to
+    /// the next matching row and sends a selection-changed event.
+    ///
+    /// Needs a list model (index or virtual). Matching runs against an index built on first use
+    /// through the model's values and kept current by its row notifications, so a keystroke does
+    /// not call back per row. Returns false without a list model.
+    pub fn enable_type_ahead(&self, column: usize, mode: TypeAheadMode) -> bool {
+        unsafe { ffi::wxd_DataViewCtrl_EnableTypeAhead(self.dvc_ptr(), column as i32, mode as i32) }
+    }
+
+    /// Removes the type-ahead index.
+    pub fn disable_type_ahead(&self) {
+        unsafe { ffi::wxd_TypeAhead_Disable(self.dvc_ptr()) }
+    }
+
+    /// Looks up the first row at or after `start_row` (wrapping around) matching `text` in the
+    /// type-ahead index, without changing the selection. `None` without a match or an index.
+    pub fn find_type_ahead(&self, text: &str, start_row: usize, mode: TypeAheadMode) -> Option<usize> {
+        type_ahead_find(self.dvc_ptr(), text, start_row, mode)
+    }
 }
 
 // Manual WxWidget implementation for DataViewCtrl (using WindowHandle)
@@ -1,6 +1,7 @@
 //! DataViewListCtrl implementation.
 
 use crate::event::WxEvtHandler;
+use crate::widgets::list_ctrl::{TypeAheadMode, type_ahead_find};
 use crate::window::{WindowHandle, WxWidget};
 use crate::{Id, Point, Size};
 use std::ffi::{CStr, CString};
@@ -8,7 +9,7 @@ use wxdragon_sys as ffi;
 
 use super::enums::DataViewColumnFlags;
 use super::item::DataViewItem;
-use super::variant::Variant;
+use super::variant::{PackedColumn, Variant, packed_columns_to_raw};
 use super::{
     DataViewAlign, DataViewCellMode, DataViewColumn, DataViewProgressRenderer, DataViewStyle, DataViewTextRenderer,
     DataViewToggleRenderer, VariantType,
@@ -227,6 +228,50 @@ impl DataViewListCtrl {
         unsafe { ffi::wxd_DataViewListCtrl_AppendItem(ptr, ptrs.as_ptr(), ptrs.len() as u32, 0) }
     }
 
+    /// Appends `values.len() / cols` rows given row-major, notifying the control once.
+    ///
+    /// The control sees a single model reset, so its selection is cleared. Returns false if
+    /// `values` is not a whole number of rows.
+    pub fn append_items(&self, cols: usize, values: &[Variant]) -> bool {
+        let ptr = self.dvlc_ptr();
+        if ptr.is_null() || cols == 0 || values.len() % cols != 0 {
+            return false;
+        }
+        let ptrs: Vec<*const ffi::wxd_Variant_t> = values.iter().map(|v| v.as_const_ptr()).collect();
+        unsafe { ffi::wxd_DataViewListCtrl_AppendItems(ptr, ptrs.as_ptr(), values.len() / cols, cols as u32) }
+    }
+
+    /// Appends `rows` rows from typed columns, e.g. integers and [`PackedStrings`](super::PackedStrings),
+    /// without a variant per cell. The control is notified once, as with
+    /// [`append_items`](Self::append_items). Returns false if a column holds fewer than `rows` cells.
+    pub fn append_items_packed(&self, rows: usize, columns: &[PackedColumn<'_>]) -> bool {
+        let ptr = self.dvlc_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        let Some(raw) = packed_columns_to_raw(rows, columns) else {
+            return false;
+        };
+        unsafe { ffi::wxd_DataViewListCtrl_AppendItemsPacked(ptr, raw.as_ptr(), raw.len() as u32, rows) }
+    }
+
+    /// Enables type-to-find on `column`; see [`DataViewCtrl::enable_type_ahead`](super::DataViewCtrl::enable_type_ahead).
+    /// The index follows appends, inserts and value changes made through this control.
+    pub fn enable_type_ahead(&self, column: usize, mode: TypeAheadMode) -> bool {
+        unsafe { ffi::wxd_DataViewCtrl_EnableTypeAhead(self.dvlc_ptr(), column as i32, mode as i32) }
+    }
+
+    /// Removes the type-ahead index.
+    pub fn disable_type_ahead(&self) {
+        unsafe { ffi::wxd_TypeAhead_Disable(self.dvlc_ptr()) }
+    }
+
+    /// Looks up the first row at or after `start_row` (wrapping around) matching `text` in the
+    /// type-ahead index, without changing the selection. `None` without a match or an index.
+    pub fn find_type_ahead(&self, text: &str, start_row: usize, mode: TypeAheadMode) -> Option<usize> {
+        type_ahead_find(self.dvlc_ptr(), text, start_row, mode)
+    }
+
     /// Prepends a row with the specified values at the beginning of the list.
     ///
     /// # Parameters
@@ -37,24 +37,26 @@ pub mod item;
 pub mod list_ctrl;
 pub mod model;
 pub mod renderer;
+pub mod snapshot;
 pub mod tree_ctrl;
 pub mod variant;
 
 // Re-export key types for easier access, e.g., wxdragon::widgets::dataview::DataViewCtrl
 pub use column::DataViewColumn;
-pub use ctrl::{DataViewCtrl, DataViewCtrlBuilder, DataViewStyle};
+pub use ctrl::{DataViewAutoSizeSample, DataViewCtrl, DataViewCtrlBuilder, DataViewStyle};
 pub use enums::{DataViewAlign, DataViewCellMode, DataViewColumnFlags, DataViewColumnFlags as DataViewColumnFlag};
 pub use events::{DataViewEvent, DataViewEventHandler, DataViewEventType, DataViewTreeEventHandler};
 pub use item::DataViewItem;
 pub use list_ctrl::{DataViewListCtrl, DataViewListCtrlBuilder};
 pub use model::{
     CustomDataViewTreeModel, CustomDataViewVirtualListModel, DataViewItemAttr, DataViewListModel, DataViewModel,
-    DataViewVirtualListModel,
+    DataViewRowValues, DataViewVirtualListModel,
 };
 pub use renderer::{
     DataViewBitmapRenderer, DataViewCheckIconTextRenderer, DataViewChoiceRenderer, DataViewCustomRenderer,
     DataViewCustomRendererBuilder, DataViewDateRenderer, DataViewIconTextRenderer, DataViewProgressRenderer, DataViewRenderer,
     DataViewSpinRenderer, DataViewTextRenderer, DataViewToggleRenderer, RenderContext,
 };
+pub use snapshot::{DataViewSnapshot, DataViewSnapshotPublisher, SnapshotDataViewTreeModel};
 pub use tree_ctrl::{DataViewTreeCtrl, DataViewTreeCtrlBuilder, DataViewTreeCtrlStyle};
-pub use variant::{Variant, VariantType};
+pub use variant::{PackedColumn, PackedStrings, Variant, VariantType, VariantValue};
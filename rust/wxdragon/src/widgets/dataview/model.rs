@@ -1,8 +1,8 @@
 //! DataViewModel implementation.
 
-use crate::widgets::dataview::variant::Variant;
+use crate::widgets::dataview::variant::{PackedColumn, Variant, VariantValue, packed_columns_to_raw};
 use std::any::Any;
-use std::cell::RefCell;
+use std::cell::{Cell, RefCell};
 use std::ffi::CString;
 use std::os::raw::c_void;
 use wxdragon_sys as ffi;
@@ -66,6 +66,10 @@ type GetValueCallback = Box<dyn for<'a> Fn(&'a dyn Any, usize, usize) -> Variant
 type SetValueCallback = Box<dyn for<'a, 'b> Fn(&'a dyn Any, usize, usize, &'b Variant) -> bool>;
 type GetAttrCallback = Box<dyn for<'a> Fn(&'a dyn Any, usize, usize) -> Option<DataViewItemAttr>>;
 type IsEnabledCallback = Box<dyn for<'a> Fn(&'a dyn Any, usize, usize) -> bool>;
+type RowAttrCallback = Box<dyn for<'a> Fn(&'a dyn Any, usize) -> Option<DataViewItemAttr>>;
+type ValueSourceCallback = Box<dyn for<'a> Fn(&'a dyn Any, usize, usize) -> VariantValue<'a>>;
+type FillValueCallback = Box<dyn for<'a, 'b> Fn(&'a dyn Any, usize, usize, &'b mut Variant) -> bool>;
+type GetValuesForRowsCallback = Box<dyn for<'a, 'b, 'c> Fn(&'a dyn Any, &'b mut DataViewRowValues<'c>)>;
 
 /// DataViewItemAttr represents formatting attributes for a DataViewCtrl cell.
 #[derive(Debug, Clone, Default)]
@@ -145,6 +149,109 @@ impl DataViewItemAttr {
     }
 }
 
+/// A window of rows to fill from a bulk value provider, see
+/// [`CustomDataViewVirtualListModel::set_values_for_rows`].
+///
+/// The cells are variants owned by the model and are set in place, so filling a window does
+/// not allocate one variant per cell. Rows are absolute model rows; cells outside the window
+/// are ignored, and cells left unset show as empty. With a column projection, cells of columns
+/// outside it are ignored too; check [`is_projected`](Self::is_projected) to skip computing them.
+pub struct DataViewRowValues<'a> {
+    first_row: usize,
+    row_count: usize,
+    col_count: usize,
+    values: &'a [*mut ffi::wxd_Variant_t],
+    attrs: &'a mut [ffi::wxd_DataViewItemAttr_t],
+}
+
+impl DataViewRowValues<'_> {
+    /// First row of the window.
+    pub fn first_row(&self) -> usize {
+        self.first_row
+    }
+
+    /// Number of rows in the window.
+    pub fn row_count(&self) -> usize {
+        self.row_count
+    }
+
+    /// Number of columns to fill per row.
+    pub fn col_count(&self) -> usize {
+        self.col_count
+    }
+
+    /// The rows of the window.
+    pub fn rows(&self) -> std::ops::Range<usize> {
+        self.first_row..self.first_row + self.row_count
+    }
+
+    /// Whether `col` is in the model's column projection, see
+    /// [`CustomDataViewVirtualListModel::set_projected_columns`].
+    pub fn is_projected(&self, col: usize) -> bool {
+        col < self.col_count && self.values.get(col).is_some_and(|slot| !slot.is_null())
+    }
+
+    fn index(&self, row: usize, col: usize) -> Option<usize> {
+        if col >= self.col_count || !self.rows().contains(&row) {
+            return None;
+        }
+        let i = (row - self.first_row) * self.col_count + col;
+        // Columns outside the projection have no slot.
+        (!self.values[i].is_null()).then_some(i)
+    }
+
+    /// Set a cell to a string.
+    pub fn set_string(&mut self, row: usize, col: usize, value: &str) {
+        if let Some(i) = self.index(row, col) {
+            let len = value.len().min(i32::MAX as usize) as i32;
+            unsafe { ffi::wxd_Variant_SetString_Utf8(self.values[i], value.as_ptr() as *const _, len) };
+        }
+    }
+
+    /// Set a cell to a 64-bit integer.
+    pub fn set_i64(&mut self, row: usize, col: usize, value: i64) {
+        if let Some(i) = self.index(row, col) {
+            unsafe { ffi::wxd_Variant_SetInt64(self.values[i], value) };
+        }
+    }
+
+    /// Set a cell to a double.
+    pub fn set_f64(&mut self, row: usize, col: usize, value: f64) {
+        if let Some(i) = self.index(row, col) {
+            unsafe { ffi::wxd_Variant_SetDouble(self.values[i], value) };
+        }
+    }
+
+    /// Set a cell to a bool.
+    pub fn set_bool(&mut self, row: usize, col: usize, value: bool) {
+        if let Some(i) = self.index(row, col) {
+            unsafe { ffi::wxd_Variant_SetBool(self.values[i], value) };
+        }
+    }
+
+    /// Set a cell from a plain value.
+    pub fn set_value(&mut self, row: usize, col: usize, value: VariantValue<'_>) {
+        if let Some(i) = self.index(row, col) {
+            let raw = value.to_raw();
+            unsafe { ffi::wxd_Variant_SetValue(self.values[i], &raw) };
+        }
+    }
+
+    /// Set a cell to a copy of `value`, for types without a dedicated setter.
+    pub fn set_variant(&mut self, row: usize, col: usize, value: &Variant) {
+        if let Some(i) = self.index(row, col) {
+            unsafe { ffi::wxd_Variant_Assign(self.values[i], value.as_const_ptr()) };
+        }
+    }
+
+    /// Set the formatting attributes of a cell.
+    pub fn set_attr(&mut self, row: usize, col: usize, attr: &DataViewItemAttr) {
+        if let Some(i) = self.index(row, col) {
+            self.attrs[i] = attr.to_raw();
+        }
+    }
+}
+
 /// A type representing a data model for use with DataViewCtrl
 pub trait DataViewModel {
     /// Get the handle to the underlying wxDataViewModel
@@ -183,6 +290,29 @@ impl DataViewListModel {
         unsafe { ffi::wxd_DataViewListModel_AppendRow(self.ptr) }
     }
 
+    /// Appends `values.len() / cols` rows given row-major, notifying the control once.
+    ///
+    /// The control sees a single model reset, so its selection is cleared. Returns false if
+    /// `values` is not a whole number of rows.
+    pub fn append_rows(&self, cols: usize, values: &[Variant]) -> bool {
+        if cols == 0 || values.len() % cols != 0 {
+            return false;
+        }
+        let ptrs: Vec<*const ffi::wxd_Variant_t> = values.iter().map(|v| v.as_const_ptr()).collect();
+        unsafe { ffi::wxd_DataViewListModel_AppendRows(self.ptr, ptrs.as_ptr(), values.len() / cols, cols as u32) }
+    }
+
+    /// Appends `rows` rows from typed columns, converting cells straight into the store.
+    ///
+    /// Like [`append_rows`](Self::append_rows) the control is notified once. Returns false if a
+    /// column holds fewer than `rows` cells.
+    pub fn append_rows_packed(&self, rows: usize, columns: &[PackedColumn<'_>]) -> bool {
+        let Some(raw) = packed_columns_to_raw(rows, columns) else {
+            return false;
+        };
+        unsafe { ffi::wxd_DataViewListModel_AppendRowsPacked(self.ptr, raw.as_ptr(), raw.len() as u32, rows) }
+    }
+
     /// Set a value in the model
     pub fn set_value<T: Into<Variant>>(&self, row: usize, col: usize, value: T) -> bool {
         let v: Variant = value.into();
@@ -309,6 +439,27 @@ impl DataViewVirtualListModel {
         };
     }
 
+    /// Notify that rows `first..=last` have changed, in one call.
+    ///
+    /// Unlike [`reset`](Self::reset) this keeps the selection and scroll position.
+    pub fn rows_changed(&self, first: usize, last: usize) {
+        unsafe { ffi::wxd_DataViewVirtualListModel_RowsChanged(self.ptr, first as u64, last as u64) };
+    }
+
+    /// Notify that `count` rows have been inserted before `before`, in one call.
+    ///
+    /// Selection and scroll position are kept; the views still get one notification per row.
+    pub fn rows_inserted(&mut self, before: usize, count: usize) {
+        unsafe { ffi::wxd_DataViewVirtualListModel_RowsInserted(self.ptr, before as u64, count as u64) };
+        self.size += count;
+    }
+
+    /// Notify that the columns in `col_mask` (bit `i` for column `i`, columns 0..63) of rows
+    /// `first..=last` have changed, in one call.
+    pub fn row_values_changed(&self, first: usize, last: usize, col_mask: u64) {
+        unsafe { ffi::wxd_DataViewVirtualListModel_RowValuesChanged(self.ptr, first as u64, last as u64, col_mask) };
+    }
+
     /// Reset the model with a new size
     pub fn reset(&mut self, new_size: usize) {
         unsafe { ffi::wxd_DataViewVirtualListModel_Reset(self.ptr, new_size as u64) };
@@ -376,7 +527,8 @@ struct OwnedTreeCallbacks {
     get_parent: Box<dyn Fn(&dyn Any, *mut std::ffi::c_void) -> *mut std::ffi::c_void>,
     is_container: Box<dyn Fn(&dyn Any, *mut std::ffi::c_void) -> bool>,
     get_children: Box<dyn Fn(&dyn Any, *mut std::ffi::c_void) -> Vec<*mut std::ffi::c_void>>,
-    // free_children will be provided by the FFI layer; we still keep a placeholder
+    // Children computed for a buffer that was too small, kept for the retry with a bigger one
+    pending_children: RefCell<Option<(*mut std::ffi::c_void, Vec<*mut std::ffi::c_void>)>>,
     get_value: Box<dyn Fn(&dyn Any, *mut std::ffi::c_void, u32) -> Variant>,
     set_value: Option<Box<dyn Fn(&dyn Any, *mut std::ffi::c_void, u32, &Variant) -> bool>>,
     is_enabled: Option<Box<dyn Fn(&dyn Any, *mut std::ffi::c_void, u32) -> bool>>,
@@ -390,6 +542,11 @@ impl CustomDataViewTreeModel {
     ///
     /// The supplied closures use `*mut N` for item pointers; a null pointer
     /// represents the root item (same convention as the C++ API).
+    ///
+    /// The native model caches each node's children and `is_container` answer,
+    /// so `get_children` runs once per node until an item notification for that
+    /// node (`item_added`, `item_deleted`, `item_changed` or their batch forms)
+    /// or `cleared` is sent.
     #[allow(clippy::type_complexity, clippy::too_many_arguments)]
     pub fn new<T, N, GP, IC, GC, GV, SV, IE, CMP>(
         data: T,
@@ -474,7 +631,16 @@ impl CustomDataViewTreeModel {
                     Some(unsafe { &*(item as *mut N) })
                 };
                 let vec_typed: Vec<*mut N> = get_children(t, item_opt);
-                vec_typed.into_iter().map(|p| p as *mut std::ffi::c_void).collect()
+                // `*mut N` and `*mut c_void` share size and alignment, so the allocation is
+                // reused as-is instead of being collected into a second vector.
+                let mut vec_typed = std::mem::ManuallyDrop::new(vec_typed);
+                unsafe {
+                    Vec::from_raw_parts(
+                        vec_typed.as_mut_ptr() as *mut *mut std::ffi::c_void,
+                        vec_typed.len(),
+                        vec_typed.capacity(),
+                    )
+                }
             });
         let any_get_value: Box<dyn for<'a> Fn(&dyn Any, *mut std::ffi::c_void, u32) -> Variant> =
             Box::new(move |any_data, item, col| {
@@ -531,6 +697,7 @@ impl CustomDataViewTreeModel {
             get_parent: any_get_parent,
             is_container: any_is_container,
             get_children: any_get_children,
+            pending_children: RefCell::new(None),
             get_value: any_get_value,
             set_value: any_set_value,
             is_enabled: any_is_enabled,
@@ -546,12 +713,14 @@ impl CustomDataViewTreeModel {
             userdata_free: Some(free_owned_tree_callbacks),
             get_parent: Some(trampoline_get_parent),
             is_container: Some(trampoline_is_container),
-            get_children: Some(trampoline_get_children),
-            free_children: Some(trampoline_free_children),
+            get_children: None,
+            free_children: None,
             get_value: Some(trampoline_get_value),
             set_value: Some(trampoline_set_value),
             is_enabled: Some(trampoline_is_enabled),
             compare: Some(trampoline_compare),
+            fill_children: Some(trampoline_fill_children),
+            get_child_count: None,
         };
 
         // Box the FFI struct and hand ownership to C++ by passing a raw pointer
@@ -687,9 +856,6 @@ impl CustomDataViewTreeModel {
 }
 
 // Extern "C" trampolines and helpers used by the FFI callbacks
-extern "C" fn trampoline_free_children(items: *mut *mut std::ffi::c_void, count: i32) {
-    unsafe { tree_helpers::free_children_array(items, count) };
-}
 
 extern "C" fn trampoline_get_parent(userdata: *mut std::ffi::c_void, item: *mut std::ffi::c_void) -> *mut std::ffi::c_void {
     if userdata.is_null() {
@@ -711,30 +877,37 @@ extern "C" fn trampoline_is_container(userdata: *mut std::ffi::c_void, item: *mu
     (cb.is_container)(any_ref, item)
 }
 
-extern "C" fn trampoline_get_children(
+extern "C" fn trampoline_fill_children(
     userdata: *mut std::ffi::c_void,
     item: *mut std::ffi::c_void,
-    out_items: *mut *mut *mut std::ffi::c_void,
-    out_count: *mut i32,
-) {
+    out: *mut *mut std::ffi::c_void,
+    capacity: usize,
+) -> usize {
     if userdata.is_null() {
-        unsafe { *out_items = std::ptr::null_mut() };
-        unsafe { *out_count = 0 };
-        return;
+        return 0;
     }
     let cb = unsafe { &*(userdata as *mut OwnedTreeCallbacks) };
-    let u = cb.userdata.borrow();
-    let any_ref: &dyn Any = &**u;
-    let vec = (cb.get_children)(any_ref, item);
-    let (ptr, cnt) = tree_helpers::leak_children_vec(vec);
-    // SAFETY: `ptr` is a pointer to a heap-allocated array of `*mut c_void`
-    // produced by `leak_children_vec`. The FFI contract expects a
-    // `*mut *mut c_void` output parameter; assign `ptr` directly. We keep the
-    // cast explicit to highlight that `ptr` is owned by Rust until the C++
-    // side calls the corresponding free function which will call
-    // `trampoline_free_children` to reclaim it.
-    unsafe { *out_items = ptr };
-    unsafe { *out_count = cnt };
+    // The C++ side retries with a bigger buffer when the first one was too small; hand back the
+    // children computed for that first call instead of asking the user closure again.
+    let pending = cb.pending_children.borrow_mut().take();
+    let children = match pending {
+        Some((pending_item, children)) if pending_item == item => children,
+        _ => {
+            let u = cb.userdata.borrow();
+            let any_ref: &dyn Any = &**u;
+            (cb.get_children)(any_ref, item)
+        }
+    };
+    let total = children.len();
+    if total > capacity || out.is_null() {
+        if total > 0 {
+            *cb.pending_children.borrow_mut() = Some((item, children));
+        }
+        return total;
+    }
+    // SAFETY: C++ provides room for `capacity` >= `total` item ids at `out`.
+    unsafe { std::ptr::copy_nonoverlapping(children.as_ptr(), out, total) };
+    total
 }
 
 extern "C" fn trampoline_get_value(
@@ -853,6 +1026,17 @@ struct CustomModelCallbacks {
     set_value: Option<SetValueCallback>,
     get_attr: Option<GetAttrCallback>,
     is_enabled: Option<IsEnabledCallback>,
+    // Optional per-row attribute provider, replaces get_attr once installed
+    row_attr: RefCell<Option<RowAttrCallback>>,
+    // Optional plain-value source, preferred over fill_value and get_value once installed
+    value_source: RefCell<Option<ValueSourceCallback>>,
+    // Optional in-place value writer, preferred over get_value once installed
+    fill_value: RefCell<Option<FillValueCallback>>,
+    // Optional bulk provider, installed after creation
+    get_values_for_rows: RefCell<Option<GetValuesForRowsCallback>>,
+    // Bumped by every row mapping request; a background sort only installs its result if no
+    // newer request was made meanwhile
+    mapping_generation: Cell<u64>,
 }
 
 impl Drop for CustomModelCallbacks {
@@ -922,6 +1106,11 @@ impl CustomDataViewVirtualListModel {
             set_value: any_set_value,
             get_attr: any_get_attr,
             is_enabled: any_is_enabled,
+            row_attr: RefCell::new(None),
+            value_source: RefCell::new(None),
+            fill_value: RefCell::new(None),
+            get_values_for_rows: RefCell::new(None),
+            mapping_generation: Cell::new(0),
         });
 
         // Create the C++ model with our callbacks
@@ -992,16 +1181,302 @@ impl CustomDataViewVirtualListModel {
         unsafe { ffi::wxd_DataViewVirtualListModel_RowValueChanged(self.handle, row as u64, col as u64) };
     }
 
+    /// Notify that rows `first..=last` have changed, in one call.
+    ///
+    /// Unlike [`reset`](Self::reset) this keeps the selection and scroll position.
+    pub fn rows_changed(&self, first: usize, last: usize) {
+        unsafe { ffi::wxd_DataViewVirtualListModel_RowsChanged(self.handle, first as u64, last as u64) };
+    }
+
+    /// Notify that `count` rows have been inserted before `before`, in one call.
+    ///
+    /// Selection and scroll position are kept; the views still get one notification per row.
+    pub fn rows_inserted(&mut self, before: usize, count: usize) {
+        unsafe { ffi::wxd_DataViewVirtualListModel_RowsInserted(self.handle, before as u64, count as u64) };
+        self.size += count;
+    }
+
+    /// Notify that the columns in `col_mask` (bit `i` for column `i`, columns 0..63) of rows
+    /// `first..=last` have changed, in one call.
+    pub fn row_values_changed(&self, first: usize, last: usize, col_mask: u64) {
+        unsafe { ffi::wxd_DataViewVirtualListModel_RowValuesChanged(self.handle, first as u64, last as u64, col_mask) };
+    }
+
     /// Reset the model with a new size
     pub fn reset(&mut self, new_size: usize) {
         unsafe { ffi::wxd_DataViewVirtualListModel_Reset(self.handle, new_size as u64) };
         self.size = new_size;
     }
 
-    /// Get the current size of the model
+    /// Get the current size of the model, in source rows as notified through this wrapper
+    /// (a row mapping does not change it)
     pub fn size(&self) -> usize {
         self.size
     }
+
+    /// Installs a provider returning one attribute per row, applied to every column.
+    ///
+    /// It replaces `get_attr`. Results are cached per row (bounded LRU), so `f` runs once per
+    /// row rather than once per cell and repaint; call [`row_changed`](Self::row_changed) or
+    /// [`row_value_changed`](Self::row_value_changed) when a row's style changes.
+    ///
+    /// `T` must be the data type the model was created with; returns false otherwise.
+    pub fn set_row_attr<T, F>(&self, f: F) -> bool
+    where
+        T: Any + 'static,
+        F: for<'a> Fn(&'a T, usize) -> Option<DataViewItemAttr> + 'static,
+    {
+        let Some(callbacks) = self.callbacks() else {
+            return false;
+        };
+        if !callbacks.userdata.is::<T>() {
+            return false;
+        }
+        let Ok(mut slot) = callbacks.row_attr.try_borrow_mut() else {
+            return false;
+        };
+        let provider: RowAttrCallback = Box::new(move |any_data, row| {
+            let data = any_data.downcast_ref::<T>().unwrap();
+            f(data, row)
+        });
+        *slot = Some(provider);
+        drop(slot);
+        unsafe { ffi::wxd_DataViewVirtualListModel_SetRowAttrCallback(self.handle, Some(row_attr_callback)) }
+    }
+
+    /// Removes the per-row attribute provider; `get_attr` is used again.
+    pub fn clear_row_attr(&self) {
+        let Some(callbacks) = self.callbacks() else {
+            return;
+        };
+        unsafe { ffi::wxd_DataViewVirtualListModel_SetRowAttrCallback(self.handle, None) };
+        if let Ok(mut slot) = callbacks.row_attr.try_borrow_mut() {
+            *slot = None;
+        }
+    }
+
+    /// Installs a source returning each cell as a plain [`VariantValue`].
+    ///
+    /// While installed it replaces `get_value` and any [`set_fill_value`](Self::set_fill_value)
+    /// writer. Values cross the FFI boundary by value and strings may borrow from the data, so
+    /// scalar cells cost no allocation and strings are only copied into the painted wxString.
+    ///
+    /// `T` must be the data type the model was created with; returns false otherwise.
+    pub fn set_value_source<T, F>(&self, f: F) -> bool
+    where
+        T: Any + 'static,
+        F: for<'a> Fn(&'a T, usize, usize) -> VariantValue<'a> + 'static,
+    {
+        let Some(callbacks) = self.callbacks() else {
+            return false;
+        };
+        if !callbacks.userdata.is::<T>() {
+            return false;
+        }
+        let Ok(mut slot) = callbacks.value_source.try_borrow_mut() else {
+            return false;
+        };
+        let source: ValueSourceCallback = Box::new(move |any_data, row, col| {
+            let data = any_data.downcast_ref::<T>().unwrap();
+            f(data, row, col)
+        });
+        *slot = Some(source);
+        true
+    }
+
+    /// Installs a value writer that fills each cell's variant in place.
+    ///
+    /// While installed it replaces `get_value`: `f` receives the variant wxWidgets is about to
+    /// paint and sets it with the [`Variant`] `set_*` methods, so no variant is allocated per
+    /// cell. Return false to leave the cell empty.
+    ///
+    /// `T` must be the data type the model was created with; returns false otherwise.
+    pub fn set_fill_value<T, F>(&self, f: F) -> bool
+    where
+        T: Any + 'static,
+        F: for<'a, 'b> Fn(&'a T, usize, usize, &'b mut Variant) -> bool + 'static,
+    {
+        let Some(callbacks) = self.callbacks() else {
+            return false;
+        };
+        if !callbacks.userdata.is::<T>() {
+            return false;
+        }
+        let Ok(mut slot) = callbacks.fill_value.try_borrow_mut() else {
+            return false;
+        };
+        let writer: FillValueCallback = Box::new(move |any_data, row, col, out| {
+            let data = any_data.downcast_ref::<T>().unwrap();
+            f(data, row, col, out)
+        });
+        *slot = Some(writer);
+        true
+    }
+
+    /// Installs a bulk value provider for columns `0..num_cols`.
+    ///
+    /// Instead of one `get_value`/`get_attr` call per cell, the model asks `f` to fill a window
+    /// of rows at once and serves painting from that cache. The cache lasts until control
+    /// returns to the event loop or a row notification is sent, so data changed without a
+    /// notification still shows on the next repaint. Columns past `num_cols` keep using the
+    /// per-cell callbacks.
+    ///
+    /// `T` must be the data type the model was created with; returns false otherwise.
+    pub fn set_values_for_rows<T, F>(&self, num_cols: usize, f: F) -> bool
+    where
+        T: Any + 'static,
+        F: for<'a, 'b> Fn(&'a T, &mut DataViewRowValues<'b>) + 'static,
+    {
+        let Some(callbacks) = self.callbacks() else {
+            return false;
+        };
+        if !callbacks.userdata.is::<T>() {
+            return false;
+        }
+        let Ok(mut slot) = callbacks.get_values_for_rows.try_borrow_mut() else {
+            return false;
+        };
+        let provider: GetValuesForRowsCallback = Box::new(move |any_data, values| {
+            let data = any_data.downcast_ref::<T>().unwrap();
+            f(data, values)
+        });
+        *slot = Some(provider);
+        drop(slot);
+        let num_cols = num_cols.min(u32::MAX as usize) as u32;
+        unsafe {
+            ffi::wxd_DataViewVirtualListModel_SetValuesForRowsCallback(self.handle, Some(get_values_for_rows_callback), num_cols)
+        }
+    }
+
+    /// Removes the bulk value provider; every cell goes through the per-cell callbacks again.
+    pub fn clear_values_for_rows(&self) {
+        let Some(callbacks) = self.callbacks() else {
+            return;
+        };
+        unsafe { ffi::wxd_DataViewVirtualListModel_SetValuesForRowsCallback(self.handle, None, 0) };
+        if let Ok(mut slot) = callbacks.get_values_for_rows.try_borrow_mut() {
+            *slot = None;
+        }
+    }
+
+    /// Restricts the model to the model columns in `columns`: the others read as empty without
+    /// calling `get_value` or `get_attr`, and the bulk provider skips them. `None` serves every
+    /// column again. Auto-sizing and export still read every column.
+    ///
+    /// The projection belongs to the model, so use it for a model shown in one control; see
+    /// [`DataViewCtrl::enable_column_projection`](super::DataViewCtrl::enable_column_projection)
+    /// to have it follow the columns in view.
+    pub fn set_projected_columns(&self, columns: Option<&[u32]>) -> bool {
+        match columns {
+            Some(columns) => unsafe {
+                ffi::wxd_DataViewVirtualListModel_SetProjectedColumns(self.handle, columns.as_ptr(), columns.len())
+            },
+            None => unsafe { ffi::wxd_DataViewVirtualListModel_SetProjectedColumns(self.handle, std::ptr::null(), 0) },
+        }
+    }
+
+    /// Whether the model currently serves column `col`.
+    pub fn is_column_projected(&self, col: u32) -> bool {
+        unsafe { ffi::wxd_DataViewVirtualListModel_IsColumnProjected(self.handle, col) }
+    }
+
+    /// Shows the rows in the order of `rows` (view row `i` shows source row `rows[i]`); source
+    /// rows left out are hidden. The control is reset once to the new row count.
+    ///
+    /// Every callback keeps receiving source rows, while row notifications and the control use
+    /// view rows; translate with [`source_row`](Self::source_row) / [`view_row`](Self::view_row).
+    /// Rows appended later show at the end; after inserting or deleting source rows elsewhere,
+    /// install a new order. Returns false if an entry is not below `source_rows`.
+    pub fn set_row_mapping(&self, rows: &[u32], source_rows: usize) -> bool {
+        if let Some(callbacks) = self.callbacks() {
+            callbacks.mapping_generation.set(callbacks.mapping_generation.get() + 1);
+        }
+        unsafe {
+            ffi::wxd_DataViewVirtualListModel_SetRowMapping(self.handle, rows.as_ptr(), rows.len() as u64, source_rows as u64)
+        }
+    }
+
+    /// Restores source order for all `source_rows` rows, cancelling a pending background sort.
+    pub fn clear_row_mapping(&self, source_rows: usize) {
+        if let Some(callbacks) = self.callbacks() {
+            callbacks.mapping_generation.set(callbacks.mapping_generation.get() + 1);
+        }
+        unsafe { ffi::wxd_DataViewVirtualListModel_SetRowMapping(self.handle, std::ptr::null(), 0, source_rows as u64) };
+    }
+
+    /// Sorts and filters the first `source_rows` rows on a worker thread, then installs the
+    /// result with [`set_row_mapping`](Self::set_row_mapping) from the event loop.
+    ///
+    /// `key` runs on the worker once per row and must read a snapshot or thread-safe copy of the
+    /// data; rows for which it returns `None` are hidden. Rows are ordered by ascending key, ties
+    /// in source order (wrap keys in [`std::cmp::Reverse`] to sort descending). A newer mapping
+    /// request supersedes a sort still running, so header clicks in a row settle on the last one.
+    ///
+    /// This replaces sorting through the model's `Compare`, which calls back for both values of
+    /// every comparison on the UI thread.
+    pub fn sort_rows_in_background<K, F>(&self, source_rows: usize, key: F)
+    where
+        K: Ord + Send + 'static,
+        F: Fn(usize) -> Option<K> + Send + 'static,
+    {
+        let Some(callbacks) = self.callbacks() else {
+            return;
+        };
+        let generation = callbacks.mapping_generation.get() + 1;
+        callbacks.mapping_generation.set(generation);
+        let source_rows = source_rows.min(u32::MAX as usize);
+
+        // Keeps the model alive until the result is installed; released on the main thread.
+        unsafe { ffi::wxd_DataViewModel_AddRef(self.handle) };
+        let handle = self.handle as usize;
+        std::thread::spawn(move || {
+            let mut keyed: Vec<(K, u32)> = (0..source_rows).filter_map(|row| key(row).map(|k| (k, row as u32))).collect();
+            keyed.sort_by(|a, b| a.0.cmp(&b.0));
+            let rows: Vec<u32> = keyed.into_iter().map(|(_, row)| row).collect();
+            crate::app::call_after(Box::new(move || {
+                let handle = handle as *mut ffi::wxd_DataViewModel_t;
+                let userdata = unsafe { ffi::wxd_DataViewVirtualListModel_GetCallbackUserdata(handle) };
+                if !userdata.is_null() {
+                    let callbacks = unsafe { &*(userdata as *const CustomModelCallbacks) };
+                    if callbacks.mapping_generation.get() == generation {
+                        unsafe {
+                            ffi::wxd_DataViewVirtualListModel_SetRowMapping(
+                                handle,
+                                rows.as_ptr(),
+                                rows.len() as u64,
+                                source_rows as u64,
+                            )
+                        };
+                    }
+                }
+                unsafe { ffi::wxd_DataViewModel_Release(handle) };
+            }));
+        });
+    }
+
+    /// The source row shown at `view_row`, or `None` if there is no such row.
+    pub fn source_row(&self, view_row: usize) -> Option<usize> {
+        let row = unsafe { ffi::wxd_DataViewVirtualListModel_GetSourceRow(self.handle, view_row as u64) };
+        usize::try_from(row).ok()
+    }
+
+    /// The view row showing `source_row`, or `None` if it is filtered out.
+    pub fn view_row(&self, source_row: usize) -> Option<usize> {
+        let row = unsafe { ffi::wxd_DataViewVirtualListModel_GetViewRow(self.handle, source_row as u64) };
+        usize::try_from(row).ok()
+    }
+
+    fn callbacks(&self) -> Option<&CustomModelCallbacks> {
+        if self.handle.is_null() {
+            return None;
+        }
+        let userdata = unsafe { ffi::wxd_DataViewVirtualListModel_GetCallbackUserdata(self.handle) };
+        if userdata.is_null() {
+            return None;
+        }
+        // Owned by the C++ model, which outlives this reference while we hold the handle.
+        Some(unsafe { &*(userdata as *const CustomModelCallbacks) })
+    }
 }
 
 impl DataViewModel for CustomDataViewVirtualListModel {
@@ -1021,20 +1496,34 @@ impl_refcounted_object!(
 );
 
 // Create C++ callbacks
-unsafe extern "C" fn get_value_callback(userdata: *mut ::std::os::raw::c_void, row: u64, col: u64) -> *mut ffi::wxd_Variant_t {
-    if userdata.is_null() {
-        // Return an owned empty string variant to satisfy the API, C++ will destroy it.
-        let v = Variant::from_string("");
-        return v.try_into().unwrap();
+unsafe extern "C" fn get_value_callback(
+    userdata: *mut ::std::os::raw::c_void,
+    row: u64,
+    col: u64,
+    out: *mut ffi::wxd_Variant_t,
+) -> bool {
+    if userdata.is_null() || out.is_null() {
+        return false;
     }
 
     let callbacks = unsafe { &*(userdata as *const CustomModelCallbacks) };
-    let value = (callbacks.get_value)(&*callbacks.userdata, row as usize, col as usize);
-    // Transfer ownership to C++ side.
-    match value.try_into() {
-        Ok(raw_ptr) => raw_ptr,
-        Err(_) => std::ptr::null_mut(),
+    if let Ok(slot) = callbacks.value_source.try_borrow()
+        && let Some(value_source) = slot.as_ref()
+    {
+        let raw = (value_source)(&*callbacks.userdata, row as usize, col as usize).to_raw();
+        unsafe { ffi::wxd_Variant_SetValue(out, &raw) };
+        return true;
+    }
+    if let Ok(slot) = callbacks.fill_value.try_borrow()
+        && let Some(fill_value) = slot.as_ref()
+    {
+        // Borrow the caller's variant; it stays owned by C++.
+        let mut target = Variant::from(out as *const ffi::wxd_Variant_t);
+        return (fill_value)(&*callbacks.userdata, row as usize, col as usize, &mut target);
     }
+    let value = (callbacks.get_value)(&*callbacks.userdata, row as usize, col as usize);
+    unsafe { ffi::wxd_Variant_Assign(out, value.as_const_ptr()) };
+    true
 }
 
 unsafe extern "C" fn set_value_callback(
@@ -1072,6 +1561,58 @@ unsafe extern "C" fn get_attr_callback(
     }
 }
 
+unsafe extern "C" fn get_values_for_rows_callback(
+    userdata: *mut ::std::os::raw::c_void,
+    first_row: u64,
+    row_count: u64,
+    num_cols: u32,
+    values: *const *mut ffi::wxd_Variant_t,
+    attrs: *mut ffi::wxd_DataViewItemAttr_t,
+) {
+    if userdata.is_null() || values.is_null() || attrs.is_null() {
+        return;
+    }
+    let callbacks = unsafe { &*(userdata as *const CustomModelCallbacks) };
+    let Ok(slot) = callbacks.get_values_for_rows.try_borrow() else {
+        return;
+    };
+    if let Some(get_values_for_rows) = slot.as_ref() {
+        let cells = row_count as usize * num_cols as usize;
+        let mut window = DataViewRowValues {
+            first_row: first_row as usize,
+            row_count: row_count as usize,
+            col_count: num_cols as usize,
+            values: unsafe { std::slice::from_raw_parts(values, cells) },
+            attrs: unsafe { std::slice::from_raw_parts_mut(attrs, cells) },
+        };
+        (get_values_for_rows)(&*callbacks.userdata, &mut window);
+    }
+}
+
+unsafe extern "C" fn row_attr_callback(
+    userdata: *mut ::std::os::raw::c_void,
+    row: u64,
+    attr: *mut ffi::wxd_DataViewItemAttr_t,
+) -> bool {
+    if userdata.is_null() || attr.is_null() {
+        return false;
+    }
+    let callbacks = unsafe { &*(userdata as *const CustomModelCallbacks) };
+    let Ok(slot) = callbacks.row_attr.try_borrow() else {
+        return false;
+    };
+    match slot
+        .as_ref()
+        .and_then(|row_attr| (row_attr)(&*callbacks.userdata, row as usize))
+    {
+        Some(attrs) => {
+            unsafe { *attr = attrs.to_raw() };
+            true
+        }
+        None => false,
+    }
+}
+
 unsafe extern "C" fn is_enabled_callback(userdata: *mut ::std::os::raw::c_void, row: u64, col: u64) -> bool {
     let callbacks = unsafe { &*(userdata as *const CustomModelCallbacks) };
     if let Some(is_enabled) = &callbacks.is_enabled {
@@ -1,6 +1,6 @@
 //! DataViewRenderer implementation.
 
-use super::{DataViewAlign, DataViewCellMode, Variant, VariantType};
+use super::{DataViewAlign, DataViewCellMode, DataViewItem, Variant, VariantType};
 use std::ffi::CString;
 use wxdragon_sys as ffi;
 
@@ -421,6 +421,30 @@ impl DataViewCustomRenderer {
     pub fn builder() -> DataViewCustomRendererBuilder {
         DataViewCustomRendererBuilder::new()
     }
+
+    /// Caches rendered cells as bitmaps, keyed by item, column, value, cell size and state.
+    ///
+    /// Later paints of an unchanged cell are a single blit instead of a call into the render
+    /// callback. Least recently used bitmaps are dropped once they take more than `budget_bytes`
+    /// (4 bytes per pixel); 0 disables the cache. The render callback then draws on an offscreen
+    /// DC, so it must not depend on what is already painted underneath the cell.
+    pub fn enable_render_cache(&self, budget_bytes: usize) {
+        unsafe { ffi::wxd_DataViewCustomRenderer_EnableRenderCache(self.raw, budget_bytes) }
+    }
+
+    /// Drops the cached bitmaps of `item`, for cells whose drawing changed while their value
+    /// did not (bitmap values, external state read by the render callback).
+    pub fn invalidate_render_cache(&self, item: &DataViewItem) {
+        let id = item.get_id::<std::ffi::c_void>().unwrap_or(std::ptr::null());
+        if !id.is_null() {
+            unsafe { ffi::wxd_DataViewCustomRenderer_InvalidateRenderCache(self.raw, id) }
+        }
+    }
+
+    /// Drops every cached bitmap.
+    pub fn clear_render_cache(&self) {
+        unsafe { ffi::wxd_DataViewCustomRenderer_InvalidateRenderCache(self.raw, std::ptr::null()) }
+    }
 }
 
 /// Builder for creating custom data view renderers.
@@ -797,22 +821,19 @@ extern "C" fn set_value_trampoline(user_data: *mut std::ffi::c_void, value: *con
     result.unwrap_or(false)
 }
 
-extern "C" fn get_value_trampoline(user_data: *mut std::ffi::c_void) -> *mut ffi::wxd_Variant_t {
-    if user_data.is_null() {
-        return std::ptr::null_mut();
+extern "C" fn get_value_trampoline(user_data: *mut std::ffi::c_void, out: *mut ffi::wxd_Variant_t) -> bool {
+    if user_data.is_null() || out.is_null() {
+        return false;
     }
 
     let callbacks = unsafe { &*(user_data as *const CustomRendererCallbacks) };
     let result = std::panic::catch_unwind(std::panic::AssertUnwindSafe(|| {
+        // Fill the caller's variant directly
         let current_value = callbacks.current_value.borrow();
-        let owned = current_value.clone();
-        owned.try_into().unwrap()
+        unsafe { ffi::wxd_Variant_Assign(out, current_value.as_const_ptr()) };
     }));
 
-    match result {
-        Ok(ptr) => ptr,
-        Err(_) => super::Variant::from_string("").try_into().unwrap(),
-    }
+    result.is_ok()
 }
 
 extern "C" fn has_editor_trampoline(user_data: *mut std::ffi::c_void) -> bool {
@@ -898,9 +919,10 @@ extern "C" fn create_editor_trampoline(
 extern "C" fn get_value_from_editor_trampoline(
     user_data: *mut std::ffi::c_void,
     editor: *mut std::ffi::c_void,
-) -> *mut ffi::wxd_Variant_t {
-    if user_data.is_null() || editor.is_null() {
-        return std::ptr::null_mut();
+    out: *mut ffi::wxd_Variant_t,
+) -> bool {
+    if user_data.is_null() || editor.is_null() || out.is_null() {
+        return false;
     }
 
     let callbacks = unsafe { &*(user_data as *const CustomRendererCallbacks) };
@@ -920,11 +942,14 @@ extern "C" fn get_value_from_editor_trampoline(
         let result = std::panic::catch_unwind(std::panic::AssertUnwindSafe(|| callback(&editor_wrapper)));
 
         match result {
-            Ok(Some(variant)) => variant.try_into().unwrap_or(std::ptr::null_mut()),
-            _ => std::ptr::null_mut(),
+            Ok(Some(variant)) => {
+                unsafe { ffi::wxd_Variant_Assign(out, variant.as_const_ptr()) };
+                true
+            }
+            _ => false,
         }
     } else {
-        std::ptr::null_mut()
+        false
     }
 }
 
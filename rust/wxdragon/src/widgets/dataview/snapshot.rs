@@ -0,0 +1,180 @@
+//! Immutable model snapshots for DataView controls fed from worker threads.
+//!
+//! A worker builds a [`DataViewSnapshot`] from packed columns and hands it to a
+//! [`DataViewSnapshotPublisher`]. The model switches to the latest published snapshot at the
+//! next event loop iteration and tells the control only which rows were deleted, inserted or
+//! changed, so selection and scroll position survive and paint never waits on the worker's data.
+//!
+//! ```rust,no_run
+//! # use wxdragon::prelude::*;
+//! # fn demo(model: &CustomDataViewVirtualListModel) {
+//! let publisher = model.snapshot_publisher().unwrap();
+//! std::thread::spawn(move || {
+//!     let ids: Vec<u64> = vec![7, 9, 12];
+//!     let prices = [1.5, 2.25, 3.0];
+//!     let snapshot = DataViewSnapshot::new(ids.len(), &[PackedColumn::Double(&prices)])
+//!         .and_then(|s| s.with_keys(&ids))
+//!         .unwrap();
+//!     publisher.publish(snapshot);
+//! });
+//! # }
+//! ```
+
+use super::item::DataViewItem;
+use super::model::{CustomDataViewVirtualListModel, DataViewItemAttr, DataViewModel};
+use super::variant::{PackedColumn, packed_columns_to_raw};
+use std::sync::Arc;
+use wxdragon_sys as ffi;
+
+/// An immutable table of cells, built and sent on any thread.
+pub struct DataViewSnapshot {
+    ptr: *mut ffi::wxd_DataViewSnapshot_t,
+    rows: usize,
+}
+
+// SAFETY: the native snapshot holds plain data only and is not shared until published.
+unsafe impl Send for DataViewSnapshot {}
+
+impl DataViewSnapshot {
+    /// Copies `rows` rows of `columns`; `None` if a column is shorter than `rows`.
+    pub fn new(rows: usize, columns: &[PackedColumn<'_>]) -> Option<Self> {
+        let raw = packed_columns_to_raw(rows, columns)?;
+        let ptr = unsafe { ffi::wxd_DataViewSnapshot_Create(raw.as_ptr(), raw.len() as u32, rows) };
+        if ptr.is_null() { None } else { Some(Self { ptr, rows }) }
+    }
+
+    /// Unique identities for the rows, so inserts and deletes between two snapshots are told
+    /// apart from edits. Required, and non-zero, for [`SnapshotDataViewTreeModel`].
+    pub fn with_keys(self, keys: &[u64]) -> Option<Self> {
+        unsafe { ffi::wxd_DataViewSnapshot_SetKeys(self.ptr, keys.as_ptr(), keys.len()) }.then_some(self)
+    }
+
+    /// Tree snapshots: the key of each row's parent, `0` for top-level rows. Children appear in
+    /// row order.
+    pub fn with_parents(self, parents: &[u64]) -> Option<Self> {
+        unsafe { ffi::wxd_DataViewSnapshot_SetParents(self.ptr, parents.as_ptr(), parents.len()) }.then_some(self)
+    }
+
+    /// Styling for each row, applied to all of its columns.
+    pub fn with_row_attrs(self, attrs: &[DataViewItemAttr]) -> Option<Self> {
+        let raw: Vec<ffi::wxd_DataViewItemAttr_t> = attrs.iter().map(DataViewItemAttr::to_raw).collect();
+        unsafe { ffi::wxd_DataViewSnapshot_SetRowAttrs(self.ptr, raw.as_ptr(), raw.len()) }.then_some(self)
+    }
+
+    pub fn row_count(&self) -> usize {
+        self.rows
+    }
+
+    fn into_raw(self) -> *mut ffi::wxd_DataViewSnapshot_t {
+        let ptr = self.ptr;
+        std::mem::forget(self);
+        ptr
+    }
+}
+
+impl Drop for DataViewSnapshot {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_DataViewSnapshot_Destroy(self.ptr) };
+    }
+}
+
+struct PublisherHandle(*mut ffi::wxd_DataViewSnapshotPublisher_t);
+
+// SAFETY: publishing and destroying are internally locked and allowed on any thread.
+unsafe impl Send for PublisherHandle {}
+unsafe impl Sync for PublisherHandle {}
+
+impl Drop for PublisherHandle {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_DataViewSnapshotPublisher_Destroy(self.0) };
+    }
+}
+
+/// Hands snapshots to one model from any thread. Cheap to clone; publishing after the model is
+/// gone does nothing.
+#[derive(Clone)]
+pub struct DataViewSnapshotPublisher {
+    handle: Arc<PublisherHandle>,
+}
+
+impl DataViewSnapshotPublisher {
+    fn for_model(model: *mut ffi::wxd_DataViewModel_t) -> Option<Self> {
+        if model.is_null() {
+            return None;
+        }
+        let ptr = unsafe { ffi::wxd_DataViewModel_CreateSnapshotPublisher(model) };
+        (!ptr.is_null()).then(|| Self {
+            handle: Arc::new(PublisherHandle(ptr)),
+        })
+    }
+
+    /// Makes `snapshot` the model's next data. Snapshots published faster than the event loop
+    /// runs replace each other; only the latest is applied. Returns false if the snapshot does
+    /// not suit the model (a tree snapshot without unique non-zero keys).
+    pub fn publish(&self, snapshot: DataViewSnapshot) -> bool {
+        unsafe { ffi::wxd_DataViewSnapshotPublisher_Publish(self.handle.0, snapshot.into_raw()) }
+    }
+}
+
+impl CustomDataViewVirtualListModel {
+    /// A publisher feeding this model with [`DataViewSnapshot`]s.
+    ///
+    /// Once a snapshot is applied, its columns (and row attributes, if it has any) are served
+    /// natively without calling the value callbacks; further columns and edits still use them.
+    /// A row mapping is kept across snapshots that only change values and dropped otherwise.
+    /// [`size`](Self::size) does not follow row counts changed by snapshots.
+    pub fn snapshot_publisher(&self) -> Option<DataViewSnapshotPublisher> {
+        DataViewSnapshotPublisher::for_model(self.handle_ptr())
+    }
+}
+
+/// A read-only tree model whose content comes entirely from [`DataViewSnapshot`]s with keys
+/// and parents. Items are identified by their row key, so selection and expansion survive
+/// snapshots.
+pub struct SnapshotDataViewTreeModel {
+    model: *mut ffi::wxd_DataViewModel_t,
+}
+
+impl_refcounted_object!(
+    SnapshotDataViewTreeModel,
+    model,
+    ffi::wxd_DataViewModel_t,
+    ffi::wxd_DataViewModel_AddRef,
+    ffi::wxd_DataViewModel_GetRefCount,
+    ffi::wxd_DataViewModel_Release
+);
+
+impl SnapshotDataViewTreeModel {
+    /// An empty model; it fills in when the first snapshot is published.
+    pub fn new() -> Self {
+        let model = unsafe { ffi::wxd_DataViewTreeModel_CreateSnapshot() };
+        assert!(!model.is_null(), "Failed to create SnapshotDataViewTreeModel");
+        Self { model }
+    }
+
+    pub fn publisher(&self) -> DataViewSnapshotPublisher {
+        DataViewSnapshotPublisher::for_model(self.model).expect("snapshot tree models always accept snapshots")
+    }
+
+    /// The item showing the row with `key`.
+    pub fn item(&self, key: u64) -> DataViewItem {
+        DataViewItem::from_id_ptr(key as usize as *const u8)
+    }
+
+    /// The row key of `item`, `None` for the invisible root.
+    pub fn key_of(&self, item: &DataViewItem) -> Option<u64> {
+        item.get_id::<u8>().map(|id| id as usize as u64)
+    }
+}
+
+impl Default for SnapshotDataViewTreeModel {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl DataViewModel for SnapshotDataViewTreeModel {
+    fn handle_ptr(&self) -> *mut ffi::wxd_DataViewModel_t {
+        self.model
+    }
+}
@@ -41,6 +41,221 @@ impl VariantType {
     }
 }
 
+/// A plain cell value that crosses the FFI boundary by value.
+///
+/// Unlike [`Variant`] it owns no wxVariant: it is converted into one only where wxWidgets
+/// needs it, so scalar values cost no allocation and strings are borrowed until then.
+#[derive(Debug, Clone, Copy, PartialEq, Default)]
+pub enum VariantValue<'a> {
+    #[default]
+    Null,
+    Bool(bool),
+    Int64(i64),
+    Double(f64),
+    Str(&'a str),
+}
+
+impl VariantValue<'_> {
+    /// Convert to the raw FFI struct; a string keeps borrowing from `self`'s source.
+    pub fn to_raw(&self) -> ffi::wxd_VariantValue {
+        let (kind, data) = match *self {
+            VariantValue::Null => (
+                ffi::wxd_VariantValueKind_WXD_VARIANT_VALUE_NULL,
+                ffi::wxd_VariantValueData { i: 0 },
+            ),
+            VariantValue::Bool(b) => (
+                ffi::wxd_VariantValueKind_WXD_VARIANT_VALUE_BOOL,
+                ffi::wxd_VariantValueData { b },
+            ),
+            VariantValue::Int64(i) => (
+                ffi::wxd_VariantValueKind_WXD_VARIANT_VALUE_INT64,
+                ffi::wxd_VariantValueData { i },
+            ),
+            VariantValue::Double(d) => (
+                ffi::wxd_VariantValueKind_WXD_VARIANT_VALUE_DOUBLE,
+                ffi::wxd_VariantValueData { d },
+            ),
+            VariantValue::Str(s) => (
+                ffi::wxd_VariantValueKind_WXD_VARIANT_VALUE_STRING,
+                ffi::wxd_VariantValueData {
+                    text: ffi::wxd_VariantValueStr {
+                        ptr: s.as_ptr() as *const _,
+                        len: s.len(),
+                    },
+                },
+            ),
+        };
+        ffi::wxd_VariantValue { kind, data }
+    }
+}
+
+impl From<bool> for VariantValue<'_> {
+    fn from(value: bool) -> Self {
+        VariantValue::Bool(value)
+    }
+}
+
+impl From<i32> for VariantValue<'_> {
+    fn from(value: i32) -> Self {
+        VariantValue::Int64(value as i64)
+    }
+}
+
+impl From<i64> for VariantValue<'_> {
+    fn from(value: i64) -> Self {
+        VariantValue::Int64(value)
+    }
+}
+
+impl From<f64> for VariantValue<'_> {
+    fn from(value: f64) -> Self {
+        VariantValue::Double(value)
+    }
+}
+
+impl<'a> From<&'a str> for VariantValue<'a> {
+    fn from(value: &'a str) -> Self {
+        VariantValue::Str(value)
+    }
+}
+
+impl<'a> From<&'a String> for VariantValue<'a> {
+    fn from(value: &'a String) -> Self {
+        VariantValue::Str(value.as_str())
+    }
+}
+
+/// One typed column of a bulk row append: contiguous values instead of a variant per cell.
+#[derive(Debug, Clone, Copy)]
+pub enum PackedColumn<'a> {
+    /// Cells left empty.
+    Null,
+    Bool(&'a [bool]),
+    Int64(&'a [i64]),
+    Double(&'a [f64]),
+    /// UTF-8 text split by byte offsets: cell `i` is `bytes[offsets[i]..offsets[i + 1]]`.
+    /// Usually built with [`PackedStrings`].
+    Str {
+        bytes: &'a str,
+        offsets: &'a [u32],
+    },
+}
+
+impl PackedColumn<'_> {
+    /// Number of cells the column holds, `None` for [`PackedColumn::Null`].
+    pub fn cell_count(&self) -> Option<usize> {
+        match self {
+            PackedColumn::Null => None,
+            PackedColumn::Bool(values) => Some(values.len()),
+            PackedColumn::Int64(values) => Some(values.len()),
+            PackedColumn::Double(values) => Some(values.len()),
+            PackedColumn::Str { offsets, .. } => Some(offsets.len().saturating_sub(1)),
+        }
+    }
+
+    fn to_raw(self) -> ffi::wxd_DataViewPackedColumn {
+        let (kind, data, offsets) = match self {
+            PackedColumn::Null => (
+                ffi::wxd_VariantValueKind_WXD_VARIANT_VALUE_NULL,
+                std::ptr::null(),
+                std::ptr::null(),
+            ),
+            PackedColumn::Bool(values) => (
+                ffi::wxd_VariantValueKind_WXD_VARIANT_VALUE_BOOL,
+                values.as_ptr() as *const std::ffi::c_void,
+                std::ptr::null(),
+            ),
+            PackedColumn::Int64(values) => (
+                ffi::wxd_VariantValueKind_WXD_VARIANT_VALUE_INT64,
+                values.as_ptr() as *const std::ffi::c_void,
+                std::ptr::null(),
+            ),
+            PackedColumn::Double(values) => (
+                ffi::wxd_VariantValueKind_WXD_VARIANT_VALUE_DOUBLE,
+                values.as_ptr() as *const std::ffi::c_void,
+                std::ptr::null(),
+            ),
+            PackedColumn::Str { bytes, offsets } => (
+                ffi::wxd_VariantValueKind_WXD_VARIANT_VALUE_STRING,
+                bytes.as_ptr() as *const std::ffi::c_void,
+                offsets.as_ptr(),
+            ),
+        };
+        ffi::wxd_DataViewPackedColumn { kind, data, offsets }
+    }
+}
+
+/// Raw columns for `rows` rows, or `None` if a column is shorter or its string offsets point
+/// outside its bytes.
+pub(crate) fn packed_columns_to_raw(rows: usize, columns: &[PackedColumn<'_>]) -> Option<Vec<ffi::wxd_DataViewPackedColumn>> {
+    for column in columns {
+        if column.cell_count().is_some_and(|len| len < rows) {
+            return None;
+        }
+        if let PackedColumn::Str { bytes, offsets } = column
+            && offsets.iter().any(|&offset| offset as usize > bytes.len())
+        {
+            return None;
+        }
+    }
+    Some(columns.iter().map(|column| column.to_raw()).collect())
+}
+
+/// An owned string column for [`PackedColumn::Str`]: all texts in one buffer plus offsets.
+#[derive(Debug, Clone)]
+pub struct PackedStrings {
+    bytes: String,
+    offsets: Vec<u32>,
+}
+
+impl PackedStrings {
+    pub fn new() -> Self {
+        Self {
+            bytes: String::new(),
+            offsets: vec![0],
+        }
+    }
+
+    /// Appends one cell.
+    pub fn push(&mut self, text: &str) {
+        self.bytes.push_str(text);
+        self.offsets.push(self.bytes.len() as u32);
+    }
+
+    /// Number of cells.
+    pub fn len(&self) -> usize {
+        self.offsets.len() - 1
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    /// The column view to pass to a bulk append.
+    pub fn column(&self) -> PackedColumn<'_> {
+        PackedColumn::Str {
+            bytes: &self.bytes,
+            offsets: &self.offsets,
+        }
+    }
+}
+
+impl Default for PackedStrings {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl<S: AsRef<str>> FromIterator<S> for PackedStrings {
+    fn from_iter<I: IntoIterator<Item = S>>(iter: I) -> Self {
+        let mut strings = Self::new();
+        for text in iter {
+            strings.push(text.as_ref());
+        }
+        strings
+    }
+}
+
 /// Safe Rust wrapper over a wxVariant pointer (wxd_Variant_t).
 ///
 /// Owns the underlying wxVariant by default and destroys it in Drop.
@@ -126,6 +341,54 @@ impl Variant {
         var
     }
 
+    /// Replace the value with a bool, in place.
+    ///
+    /// The `set_*` methods reuse the underlying wxVariant, so a variant handed out by a
+    /// callback can be filled without allocating a new one.
+    pub fn set_bool(&mut self, v: bool) {
+        unsafe { ffi::wxd_Variant_SetBool(self.ptr, v) };
+    }
+
+    pub fn set_i32(&mut self, v: i32) {
+        unsafe { ffi::wxd_Variant_SetInt32(self.ptr, v) };
+    }
+
+    pub fn set_i64(&mut self, v: i64) {
+        unsafe { ffi::wxd_Variant_SetInt64(self.ptr, v) };
+    }
+
+    pub fn set_u64(&mut self, v: u64) {
+        unsafe { ffi::wxd_Variant_SetUInt64(self.ptr, v) };
+    }
+
+    pub fn set_f64(&mut self, v: f64) {
+        unsafe { ffi::wxd_Variant_SetDouble(self.ptr, v) };
+    }
+
+    pub fn set_string<S: AsRef<str>>(&mut self, s: S) {
+        let b = s.as_ref().as_bytes();
+        unsafe { ffi::wxd_Variant_SetString_Utf8(self.ptr, b.as_ptr() as _, b.len() as i32) };
+    }
+
+    pub fn set_datetime(&mut self, dt: &DateTime) {
+        unsafe { ffi::wxd_Variant_SetDateTime(self.ptr, dt.as_const_ptr()) };
+    }
+
+    pub fn set_bitmap(&mut self, bmp: &Bitmap) {
+        unsafe { ffi::wxd_Variant_SetBitmap(self.ptr, bmp.as_const_ptr()) };
+    }
+
+    /// Replace the value with a plain [`VariantValue`], reusing unshared scalar data in place.
+    pub fn set_value(&mut self, value: VariantValue<'_>) {
+        let raw = value.to_raw();
+        unsafe { ffi::wxd_Variant_SetValue(self.ptr, &raw) };
+    }
+
+    /// Replace the value with a copy of `other`'s (shares wxVariant's reference-counted data).
+    pub fn assign(&mut self, other: &Variant) {
+        unsafe { ffi::wxd_Variant_Assign(self.ptr, other.as_const_ptr()) };
+    }
+
     /// Returns a const raw pointer to the underlying wxd_Variant_t.
     ///
     /// Ownership notes:
@@ -180,6 +180,49 @@ impl FileCtrl {
         unsafe { ffi::wxd_FileCtrl_GetPath(ptr, buf.as_mut_ptr(), buf.len()) };
         Some(unsafe { CStr::from_ptr(buf.as_ptr()).to_string_lossy().to_string() })
     }
+
+    /// Get the directory the FileCtrl shows.
+    /// Returns None if the file control has been destroyed.
+    pub fn get_directory(&self) -> Option<String> {
+        let ptr = self.file_ctrl_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        let len = unsafe { ffi::wxd_FileCtrl_GetDirectory(ptr, std::ptr::null_mut(), 0) };
+        let mut buf = vec![0; len + 1];
+        unsafe { ffi::wxd_FileCtrl_GetDirectory(ptr, buf.as_mut_ptr(), buf.len()) };
+        Some(unsafe { CStr::from_ptr(buf.as_ptr()).to_string_lossy().to_string() })
+    }
+
+    /// Show `directory`, listing it on the GUI thread.
+    pub fn set_directory(&self, directory: &str) -> bool {
+        let ptr = self.file_ctrl_ptr();
+        let Ok(c_dir) = CString::new(directory) else {
+            return false;
+        };
+        !ptr.is_null() && unsafe { ffi::wxd_FileCtrl_SetDirectory(ptr, c_dir.as_ptr()) }
+    }
+
+    /// Show the directory of `path` and select its file.
+    pub fn set_path(&self, path: &str) -> bool {
+        let ptr = self.file_ctrl_ptr();
+        let Ok(c_path) = CString::new(path) else {
+            return false;
+        };
+        !ptr.is_null() && unsafe { ffi::wxd_FileCtrl_SetPath(ptr, c_path.as_ptr()) }
+    }
+
+    /// Show `directory` once it has been listed on a worker thread, keeping the GUI responsive
+    /// while a network share or a very large folder is read. A later call of this or the
+    /// synchronous setters cancels a pending one; an unreadable directory leaves the control
+    /// where it was.
+    pub fn set_directory_async(&self, directory: &str) -> bool {
+        let ptr = self.file_ctrl_ptr();
+        let Ok(c_dir) = CString::new(directory) else {
+            return false;
+        };
+        !ptr.is_null() && unsafe { ffi::wxd_FileCtrl_SetDirectoryAsync(ptr, c_dir.as_ptr()) }
+    }
 }
 
 // Use the widget_builder macro to generate the FileCtrlBuilder implementation
@@ -79,6 +79,19 @@ impl Gauge {
         unsafe { ffi::wxd_Gauge_SetValue(ptr, value as c_int) }
     }
 
+    /// Like [`set_value`](Self::set_value), but only the newest value is kept and applied at most
+    /// once per display frame, skipped when the bar would not move by a pixel (0 and the range
+    /// always apply). Meant for per-item progress from busy workers; see
+    /// [`flush_deferred_progress`](crate::appprogress::flush_deferred_progress).
+    /// No-op if the gauge has been destroyed.
+    pub fn set_value_deferred(&self, value: i32) {
+        let ptr = self.gauge_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_Gauge_SetValueDeferred(ptr, value as c_int) }
+    }
+
     /// Gets the current value of the gauge.
     /// Returns 0 if the gauge has been destroyed.
     pub fn get_value(&self) -> i32 {
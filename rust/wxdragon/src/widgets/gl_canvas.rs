@@ -0,0 +1,334 @@
+//! Safe wrapper for wxGLCanvas and wxGLContext.
+
+use crate::event::WxEvtHandler;
+use crate::geometry::{Point, Size};
+use crate::id::Id;
+use crate::window::{WindowHandle, WxWidget};
+use std::ffi::{CString, c_void};
+use std::marker::PhantomData;
+use std::rc::Rc;
+use wxdragon_sys as ffi;
+
+widget_style_enum!(
+    name: GLCanvasStyle,
+    doc: "Style flags for GLCanvas. The canvas always repaints fully on resize.",
+    variants: {
+        Default: 0, "Default style."
+    },
+    default_variant: Default
+);
+
+/// Pixel format and context attributes for a [`GLCanvas`] and its [`GLContext`].
+///
+/// Zero values select the platform default; without a version the context is a legacy,
+/// compatibility context.
+///
+/// # Example
+/// ```ignore
+/// let attrs = GLAttributes::default().core_profile(3, 3).samples(4);
+/// ```
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct GLAttributes {
+    pub major_version: i32,
+    pub minor_version: i32,
+    pub core_profile: bool,
+    pub debug_context: bool,
+    pub double_buffer: bool,
+    pub depth_bits: i32,
+    pub stencil_bits: i32,
+    pub samples: i32,
+    pub srgb: bool,
+}
+
+impl Default for GLAttributes {
+    fn default() -> Self {
+        GLAttributes {
+            major_version: 0,
+            minor_version: 0,
+            core_profile: false,
+            debug_context: false,
+            double_buffer: true,
+            depth_bits: 24,
+            stencil_bits: 8,
+            samples: 0,
+            srgb: false,
+        }
+    }
+}
+
+impl GLAttributes {
+    /// Requests a forward-compatible core profile context of at least `major.minor`.
+    pub fn core_profile(mut self, major: i32, minor: i32) -> Self {
+        self.major_version = major;
+        self.minor_version = minor;
+        self.core_profile = true;
+        self
+    }
+
+    /// Requests `samples` MSAA samples per pixel (0 or 1 for none).
+    pub fn samples(mut self, samples: i32) -> Self {
+        self.samples = samples;
+        self
+    }
+
+    pub fn depth_bits(mut self, bits: i32) -> Self {
+        self.depth_bits = bits;
+        self
+    }
+
+    pub fn stencil_bits(mut self, bits: i32) -> Self {
+        self.stencil_bits = bits;
+        self
+    }
+
+    pub fn double_buffer(mut self, enable: bool) -> Self {
+        self.double_buffer = enable;
+        self
+    }
+
+    pub fn debug_context(mut self, enable: bool) -> Self {
+        self.debug_context = enable;
+        self
+    }
+
+    pub fn srgb(mut self, enable: bool) -> Self {
+        self.srgb = enable;
+        self
+    }
+
+    fn to_raw(self) -> ffi::wxd_GLAttributes {
+        ffi::wxd_GLAttributes {
+            major_version: self.major_version,
+            minor_version: self.minor_version,
+            core_profile: self.core_profile,
+            debug_context: self.debug_context,
+            double_buffer: self.double_buffer,
+            depth_bits: self.depth_bits,
+            stencil_bits: self.stencil_bits,
+            samples: self.samples,
+            srgb: self.srgb,
+        }
+    }
+}
+
+/// The native window behind a [`GLCanvas`], for renderers (e.g. wgpu) that create their own
+/// surface.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum NativeWindowHandle {
+    /// `hwnd` and the module's `hinstance`.
+    Win32 { hwnd: *mut c_void, hinstance: *mut c_void },
+    /// The canvas' `NSView*`.
+    AppKit { ns_view: *mut c_void },
+    /// The canvas' `GtkWidget*`; its X11 window or Wayland surface is available through GDK.
+    Gtk { widget: *mut c_void },
+}
+
+/// An OpenGL rendering context created for a [`GLCanvas`].
+///
+/// A context may be made current on any canvas with a compatible pixel format. It is destroyed
+/// on drop.
+pub struct GLContext {
+    ptr: *mut ffi::wxd_GLContext_t,
+    // GL contexts are bound to the GUI thread here.
+    _nosend_nosync: PhantomData<Rc<()>>,
+}
+
+impl GLContext {
+    /// Creates a context for `canvas` with the version and profile in `attrs`, sharing textures
+    /// and buffers with `share` if given. Returns `None` if the driver cannot provide it.
+    pub fn new(canvas: &GLCanvas, attrs: &GLAttributes, share: Option<&GLContext>) -> Option<Self> {
+        let canvas_ptr = canvas.gl_canvas_ptr();
+        if canvas_ptr.is_null() {
+            return None;
+        }
+        let raw = attrs.to_raw();
+        let share = share.map_or(std::ptr::null(), |c| c.ptr as *const _);
+        let ptr = unsafe { ffi::wxd_GLContext_Create(canvas_ptr, &raw, share) };
+        if ptr.is_null() {
+            None
+        } else {
+            Some(GLContext {
+                ptr,
+                _nosend_nosync: PhantomData,
+            })
+        }
+    }
+
+    /// Looks up an OpenGL function for loaders such as `glow::Context::from_loader_function`.
+    /// A context should be current. Returns null if the function is unknown.
+    pub fn get_proc_address(name: &str) -> *const c_void {
+        match CString::new(name) {
+            Ok(c_name) => unsafe { ffi::wxd_GLContext_GetProcAddress(c_name.as_ptr()) },
+            Err(_) => std::ptr::null(),
+        }
+    }
+}
+
+impl Drop for GLContext {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_GLContext_Destroy(self.ptr) };
+    }
+}
+
+/// Represents a `wxGLCanvas`, a window that OpenGL renders into.
+///
+/// Create a [`GLContext`] for it, then in the paint handler create a `PaintDC`, make the context
+/// current, draw and call [`GLCanvas::swap_buffers`]. Size events report the new viewport.
+///
+/// # Example
+/// ```ignore
+/// let attrs = GLAttributes::default().core_profile(3, 3).samples(4);
+/// let canvas = GLCanvas::builder(&frame).with_attributes(attrs).build();
+/// let context = Rc::new(GLContext::new(&canvas, &attrs, None).expect("GL 3.3 core"));
+/// canvas.on_paint(move |_| {
+///     let _dc = PaintDC::new(&canvas);
+///     canvas.set_current(&context);
+///     // ... draw with glow ...
+///     canvas.swap_buffers();
+/// });
+/// ```
+#[derive(Clone, Copy)]
+pub struct GLCanvas {
+    handle: WindowHandle,
+}
+
+impl GLCanvas {
+    /// Creates a new `GLCanvasBuilder` for constructing a GL canvas.
+    pub fn builder(parent: &dyn WxWidget) -> GLCanvasBuilder<'_> {
+        GLCanvasBuilder::new(parent)
+    }
+
+    /// Returns true if the display has a pixel format matching `attrs`.
+    pub fn is_display_supported(attrs: &GLAttributes) -> bool {
+        let raw = attrs.to_raw();
+        unsafe { ffi::wxd_GLCanvas_IsDisplaySupported(&raw) }
+    }
+
+    #[inline]
+    fn gl_canvas_ptr(&self) -> *mut ffi::wxd_GLCanvas_t {
+        self.handle
+            .get_ptr()
+            .map(|p| p as *mut ffi::wxd_GLCanvas_t)
+            .unwrap_or(std::ptr::null_mut())
+    }
+
+    /// Makes `context` current on this canvas. The canvas must be shown.
+    /// Returns false if the canvas has been destroyed or the call fails.
+    pub fn set_current(&self, context: &GLContext) -> bool {
+        let ptr = self.gl_canvas_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        unsafe { ffi::wxd_GLCanvas_SetCurrent(ptr, context.ptr) }
+    }
+
+    /// Presents the back buffer. Returns false if the canvas has been destroyed.
+    pub fn swap_buffers(&self) -> bool {
+        let ptr = self.gl_canvas_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        unsafe { ffi::wxd_GLCanvas_SwapBuffers(ptr) }
+    }
+
+    /// Sets vsync: 0 disables it, 1 waits for every vertical blank, -1 requests adaptive vsync.
+    /// Returns false if the driver does not support changing it.
+    pub fn set_swap_interval(&self, interval: i32) -> bool {
+        let ptr = self.gl_canvas_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        unsafe { ffi::wxd_GLCanvas_SetSwapInterval(ptr, interval) }
+    }
+
+    /// The native window of the canvas, or `None` if it has been destroyed.
+    pub fn native_handle(&self) -> Option<NativeWindowHandle> {
+        let ptr = self.gl_canvas_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        let raw = unsafe { ffi::wxd_GLCanvas_GetNativeHandle(ptr) };
+        match raw.kind {
+            ffi::wxd_NativeWindowKind_WXD_NATIVE_WINDOW_WIN32 => Some(NativeWindowHandle::Win32 {
+                hwnd: raw.window,
+                hinstance: raw.display,
+            }),
+            ffi::wxd_NativeWindowKind_WXD_NATIVE_WINDOW_APPKIT => Some(NativeWindowHandle::AppKit { ns_view: raw.window }),
+            ffi::wxd_NativeWindowKind_WXD_NATIVE_WINDOW_GTK => Some(NativeWindowHandle::Gtk { widget: raw.window }),
+            _ => None,
+        }
+    }
+
+    /// Creates a GLCanvas from a raw pointer.
+    /// # Safety
+    /// The pointer must be a valid `wxd_GLCanvas_t`.
+    pub(crate) unsafe fn from_ptr(ptr: *mut ffi::wxd_GLCanvas_t) -> Self {
+        assert!(!ptr.is_null());
+        GLCanvas {
+            handle: WindowHandle::new(ptr as *mut ffi::wxd_Window_t),
+        }
+    }
+
+    /// Returns the underlying WindowHandle for this canvas.
+    pub fn window_handle(&self) -> WindowHandle {
+        self.handle
+    }
+}
+
+impl WxWidget for GLCanvas {
+    fn handle_ptr(&self) -> *mut ffi::wxd_Window_t {
+        self.handle.get_ptr().unwrap_or(std::ptr::null_mut())
+    }
+
+    fn is_valid(&self) -> bool {
+        self.handle.is_valid()
+    }
+}
+
+impl WxEvtHandler for GLCanvas {
+    unsafe fn get_event_handler_ptr(&self) -> *mut ffi::wxd_EvtHandler_t {
+        self.handle.get_ptr().unwrap_or(std::ptr::null_mut()) as *mut ffi::wxd_EvtHandler_t
+    }
+}
+
+// Paint, size, mouse and keyboard events
+impl crate::event::WindowEvents for GLCanvas {}
+
+widget_builder!(
+    name: GLCanvas,
+    parent_type: &'a dyn WxWidget,
+    style_type: GLCanvasStyle,
+    fields: {
+        attributes: GLAttributes = GLAttributes::default()
+    },
+    build_impl: |slf| {
+        let parent_ptr = slf.parent.handle_ptr();
+        let attrs = slf.attributes.to_raw();
+        unsafe {
+            let ctrl_ptr = ffi::wxd_GLCanvas_Create(
+                parent_ptr,
+                slf.id,
+                slf.pos.x,
+                slf.pos.y,
+                slf.size.width,
+                slf.size.height,
+                slf.style.bits(),
+                &attrs,
+            );
+            assert!(!ctrl_ptr.is_null(), "wxd_GLCanvas_Create returned null (unsupported pixel format?)");
+            GLCanvas::from_ptr(ctrl_ptr)
+        }
+    }
+);
+
+impl crate::window::FromWindowWithClassName for GLCanvas {
+    fn class_name() -> &'static str {
+        "wxGLCanvas"
+    }
+
+    unsafe fn from_ptr(ptr: *mut ffi::wxd_Window_t) -> Self {
+        GLCanvas {
+            handle: WindowHandle::new(ptr),
+        }
+    }
+}
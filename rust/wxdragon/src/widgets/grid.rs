@@ -1,10 +1,12 @@
 //! wxGrid wrapper - a powerful spreadsheet-like grid control
 
+use crate::app::{JobCancel, WorkerPool};
 use crate::color::Colour;
 use crate::event::{Event, EventType, WxEvtHandler};
 use crate::font::Font;
 use crate::geometry::{Point, Rect, Size};
 use crate::id::Id;
+use crate::utils::take_wxd_string;
 use crate::window::{WindowHandle, WxWidget};
 use std::ffi::{CStr, CString};
 use wxdragon_sys as ffi;
@@ -51,6 +53,96 @@ pub struct GridBlockCoords {
     pub right_col: i32,
 }
 
+/// Rows measured by [`Grid::auto_size_column_sampled`] / [`Grid::auto_size_columns_sampled`].
+#[derive(Debug, Copy, Clone, PartialEq, Eq)]
+pub struct GridAutoSizeSample {
+    /// Measure the rows currently scrolled into view.
+    pub visible_rows: bool,
+    /// Measure the first N rows.
+    pub head_rows: i32,
+    /// Measure the last N rows.
+    pub tail_rows: i32,
+    /// Measure N rows spread evenly over the grid.
+    pub stride_rows: i32,
+    /// Reuse widths of earlier single-line strings with the same font and length instead of
+    /// measuring each one (an estimate for proportional fonts).
+    pub estimate_by_length: bool,
+}
+
+impl Default for GridAutoSizeSample {
+    fn default() -> Self {
+        Self {
+            visible_rows: true,
+            head_rows: 100,
+            tail_rows: 100,
+            stride_rows: 200,
+            estimate_by_length: false,
+        }
+    }
+}
+
+impl GridAutoSizeSample {
+    fn to_ffi(self) -> ffi::wxd_GridAutoSizeSample {
+        ffi::wxd_GridAutoSizeSample {
+            visible_rows: self.visible_rows,
+            head_rows: self.head_rows,
+            tail_rows: self.tail_rows,
+            stride_rows: self.stride_rows,
+            estimate_by_length: self.estimate_by_length,
+        }
+    }
+}
+
+/// One entry of [`Grid::get_selection_ranges`]. Ranges never overlap.
+#[derive(Debug, Copy, Clone, PartialEq, Eq)]
+pub enum GridSelectionRange {
+    /// Whole rows `top..=bottom`.
+    Rows { top: i32, bottom: i32 },
+    /// Whole columns `left..=right`.
+    Cols { left: i32, right: i32 },
+    /// Any other rectangle (including the entire grid).
+    Block(GridBlockCoords),
+}
+
+impl GridSelectionRange {
+    /// Classifies a normalized rectangle of a grid with the given size: full-width rectangles
+    /// are rows, full-height ones columns, and one covering the whole grid stays a block.
+    pub fn from_block(block: GridBlockCoords, number_rows: i32, number_cols: i32) -> Self {
+        let full_width = block.left_col == 0 && block.right_col == number_cols - 1;
+        let full_height = block.top_row == 0 && block.bottom_row == number_rows - 1;
+        match (full_width, full_height) {
+            (true, false) => GridSelectionRange::Rows {
+                top: block.top_row,
+                bottom: block.bottom_row,
+            },
+            (false, true) => GridSelectionRange::Cols {
+                left: block.left_col,
+                right: block.right_col,
+            },
+            _ => GridSelectionRange::Block(block),
+        }
+    }
+
+    /// The covered rectangle, given the grid's current size.
+    pub fn to_block(self, number_rows: i32, number_cols: i32) -> GridBlockCoords {
+        match self {
+            GridSelectionRange::Rows { top, bottom } => GridBlockCoords {
+                top_row: top,
+                left_col: 0,
+                bottom_row: bottom,
+                right_col: number_cols - 1,
+            },
+            GridSelectionRange::Cols { left, right } => GridBlockCoords {
+                top_row: 0,
+                left_col: left,
+                bottom_row: number_rows - 1,
+                right_col: right,
+            },
+            GridSelectionRange::Block(block) => block,
+        }
+    }
+}
+
 // --- Grid Selection Modes ---
 
 /// Selection modes for Grid
@@ -246,7 +338,7 @@ impl Grid {
 
     /// Helper to get raw grid pointer
     #[inline]
-    fn grid_ptr(&self) -> *mut ffi::wxd_Grid_t {
+    pub(crate) fn grid_ptr(&self) -> *mut ffi::wxd_Grid_t {
         self.handle
             .get_ptr()
             .map(|p| p as *mut ffi::wxd_Grid_t)
@@ -354,23 +446,7 @@ impl Grid {
         if ptr.is_null() {
             return String::new();
         }
-        unsafe {
-            let len = ffi::wxd_Grid_GetCellValue(ptr, row, col, std::ptr::null_mut(), 0);
-            if len <= 0 {
-                return String::new();
-            }
-            let mut buffer = vec![0u8; len as usize + 1];
-            ffi::wxd_Grid_GetCellValue(
-                ptr,
-                row,
-                col,
-                buffer.as_mut_ptr() as *mut core::ffi::c_char,
-                buffer.len() as i32,
-            );
-            CStr::from_ptr(buffer.as_ptr() as *const core::ffi::c_char)
-                .to_string_lossy()
-                .into_owned()
-        }
+        unsafe { take_wxd_string(ffi::wxd_Grid_GetCellValueOwned(ptr, row, col)) }.unwrap_or_default()
     }
 
     /// Sets the value of a cell.
@@ -379,8 +455,57 @@ impl Grid {
         if ptr.is_null() {
             return;
         }
-        let c_value = CString::new(value).unwrap_or_default();
-        unsafe { ffi::wxd_Grid_SetCellValue(ptr, row, col, c_value.as_ptr()) }
+        // Length-aware entry point: no CString allocation or strlen per cell
+        unsafe { ffi::wxd_Grid_SetCellValueLen(ptr, row, col, value.as_ptr() as *const _, value.len()) }
+    }
+
+    /// Sets a `rows` x `cols` block of cells starting at (`top`, `left`) in one native call.
+    ///
+    /// `values` is row-major and should hold `rows * cols` entries (missing entries are left
+    /// empty). The block is repainted once at the end. Returns the number of cells written.
+    pub fn set_cell_values_block<S: AsRef<str>>(&self, top: i32, left: i32, rows: i32, cols: i32, values: &[S]) -> i32 {
+        let ptr = self.grid_ptr();
+        if ptr.is_null() || rows <= 0 || cols <= 0 {
+            return 0;
+        }
+        let count = rows as usize * cols as usize;
+        let mut packed = String::new();
+        let mut offsets = Vec::with_capacity(count + 1);
+        offsets.push(0u32);
+        for i in 0..count {
+            if let Some(value) = values.get(i) {
+                packed.push_str(value.as_ref());
+            }
+            offsets.push(packed.len() as u32);
+        }
+        unsafe { ffi::wxd_Grid_SetCellValuesBlock(ptr, top, left, rows, cols, packed.as_ptr() as *const _, offsets.as_ptr()) }
+    }
+
+    /// Reads a `rows` x `cols` block of cells starting at (`top`, `left`) in one native call.
+    /// Returns the values row-major; cells outside the grid read as empty strings.
+    pub fn get_cell_values_block(&self, top: i32, left: i32, rows: i32, cols: i32) -> Vec<String> {
+        let ptr = self.grid_ptr();
+        if ptr.is_null() || rows <= 0 || cols <= 0 {
+            return Vec::new();
+        }
+        let count = rows as usize * cols as usize;
+        let mut offsets = vec![0u32; count + 1];
+        let packed = unsafe { ffi::wxd_Grid_GetCellValuesBlock(ptr, top, left, rows, cols, offsets.as_mut_ptr(), offsets.len()) };
+        if packed.is_null() {
+            return vec![String::new(); count];
+        }
+        let bytes = unsafe {
+            std::slice::from_raw_parts(
+                ffi::wxd_String_GetData(packed) as *const u8,
+                ffi::wxd_String_GetLength(packed),
+            )
+        };
+        let values = offsets
+            .windows(2)
+            .map(|w| String::from_utf8_lossy(&bytes[w[0] as usize..w[1] as usize]).into_owned())
+            .collect();
+        unsafe { ffi::wxd_String_Free(packed) };
+        values
     }
 
     // --- Label Functions ---
@@ -634,6 +759,37 @@ impl Grid {
         unsafe { ffi::wxd_Grid_AutoSizeColLabelSize(ptr, col) }
     }
 
+    /// Auto-sizes a column from a sample of rows instead of every row, so the cost does not
+    /// grow with the grid. Returns the new width, or `None` if `col` is invalid.
+    pub fn auto_size_column_sampled(&self, col: i32, sample: &GridAutoSizeSample, set_as_min: bool) -> Option<i32> {
+        let ptr = self.grid_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        let sample = sample.to_ffi();
+        let width = unsafe { ffi::wxd_Grid_AutoSizeColumnSampled(ptr, col, &sample, set_as_min) };
+        (width >= 0).then_some(width)
+    }
+
+    /// Auto-sizes every column from the same sample of rows.
+    pub fn auto_size_columns_sampled(&self, sample: &GridAutoSizeSample, set_as_min: bool) {
+        let ptr = self.grid_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        let sample = sample.to_ffi();
+        unsafe { ffi::wxd_Grid_AutoSizeColumnsSampled(ptr, &sample, set_as_min) }
+    }
+
+    /// Measures rows as they scroll into view and widens (never shrinks) columns to fit them.
+    pub fn enable_auto_grow_columns(&self, enable: bool, estimate_by_length: bool) {
+        let ptr = self.grid_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_Grid_EnableAutoGrowColumns(ptr, enable, estimate_by_length) }
+    }
+
     // --- Cell Formatting ---
 
     /// Gets the background colour of a cell.
@@ -963,6 +1119,44 @@ impl Grid {
         }
     }
 
+    /// Gets the whole selection as non-overlapping ranges, so work on a large selection
+    /// (copy, "apply to selection") is proportional to the number of ranges, not cells.
+    pub fn get_selection_ranges(&self) -> Vec<GridSelectionRange> {
+        let ptr = self.grid_ptr();
+        if ptr.is_null() {
+            return Vec::new();
+        }
+        let empty = ffi::wxd_GridBlockCoords {
+            top_row: 0,
+            left_col: 0,
+            bottom_row: 0,
+            right_col: 0,
+        };
+        // Usually a handful of ranges; retry once with the exact size otherwise.
+        let mut buffer = vec![empty; 16];
+        let mut count = unsafe { ffi::wxd_Grid_GetSelectionRanges(ptr, buffer.as_mut_ptr(), buffer.len() as i32) };
+        if count as usize > buffer.len() {
+            buffer = vec![empty; count as usize];
+            count = unsafe { ffi::wxd_Grid_GetSelectionRanges(ptr, buffer.as_mut_ptr(), buffer.len() as i32) };
+        }
+        buffer.truncate(count.max(0) as usize);
+
+        let number_rows = self.get_number_rows();
+        let number_cols = self.get_number_cols();
+        buffer
+            .iter()
+            .map(|b| {
+                let block = GridBlockCoords {
+                    top_row: b.top_row,
+                    left_col: b.left_col,
+                    bottom_row: b.bottom_row,
+                    right_col: b.right_col,
+                };
+                GridSelectionRange::from_block(block, number_rows, number_cols)
+            })
+            .collect()
+    }
+
     /// Gets the selected row blocks.
     ///
     /// Returns blocks corresponding to contiguous ranges of selected rows.
@@ -1261,6 +1455,47 @@ impl Grid {
         unsafe { ffi::wxd_Grid_ForceRefresh(ptr) }
     }
 
+    // --- Update Sessions ---
+
+    /// Opens an update session: until the matching [`Grid::end_update_session`], cell setters
+    /// only record the cells they change instead of repainting. Unlike [`Grid::end_batch`],
+    /// closing it repaints just the changed, visible cells. Sessions nest.
+    pub fn begin_update_session(&self) {
+        let ptr = self.grid_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_Grid_BeginUpdateSession(ptr) }
+    }
+
+    /// Records a block as changed by means the session cannot see (e.g. a virtual table's data).
+    /// Outside a session the block is refreshed immediately.
+    pub fn mark_dirty_block(&self, top_row: i32, left_col: i32, num_rows: i32, num_cols: i32) {
+        let ptr = self.grid_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_Grid_MarkDirtyBlock(ptr, top_row, left_col, num_rows, num_cols) }
+    }
+
+    /// Closes an update session and refreshes what changed. Returns the number of pixels
+    /// invalidated (0 when closing a nested session); with frozen rows or columns, changed
+    /// blocks are counted whole rather than clipped to the visible area.
+    pub fn end_update_session(&self) -> u64 {
+        let ptr = self.grid_ptr();
+        if ptr.is_null() {
+            return 0;
+        }
+        unsafe { ffi::wxd_Grid_EndUpdateSession(ptr) }
+    }
+
+    /// Runs `f` inside an update session and returns the number of pixels refreshed.
+    pub fn with_update_session<F: FnOnce(&Grid)>(&self, f: F) -> u64 {
+        self.begin_update_session();
+        f(self);
+        self.end_update_session()
+    }
+
     /// Clears all cell values in the grid.
     pub fn clear_grid(&self) {
         let ptr = self.grid_ptr();
@@ -2494,6 +2729,56 @@ impl Grid {
         unsafe { ffi::wxd_Grid_ResetRowPos(ptr) }
     }
 
+    /// Installs a full display order in one call: `order[pos]` is the row shown at `pos`.
+    /// Returns `false` unless `order` is a permutation of all rows.
+    pub fn apply_row_permutation(&self, order: &[i32]) -> bool {
+        let ptr = self.grid_ptr();
+        if ptr.is_null() || order.len() > i32::MAX as usize {
+            return false;
+        }
+        unsafe { ffi::wxd_Grid_ApplyRowPermutation(ptr, order.as_ptr(), order.len() as i32) }
+    }
+
+    /// Sorts the displayed rows by `col` without touching cell data.
+    ///
+    /// The key column is read once on this thread (as numbers for typed numeric columns, as
+    /// text otherwise; text that all parses as numbers is compared numerically), sorted on
+    /// `pool`, and the resulting order is applied with [`Grid::apply_row_permutation`] on the
+    /// main thread together with the sorting-column indicator. `on_done` receives `false` if the
+    /// grid was destroyed or its row count changed in the meantime.
+    pub fn sort_rows_async<F>(&self, pool: &WorkerPool, col: i32, ascending: bool, on_done: F) -> bool
+    where
+        F: FnOnce(bool) + 'static,
+    {
+        let ptr = self.grid_ptr();
+        let rows = self.get_number_rows();
+        if ptr.is_null() || col < 0 || col >= self.get_number_cols() || rows < 0 {
+            return false;
+        }
+        let mut numbers = vec![0.0f64; rows as usize];
+        let keys = if unsafe { ffi::wxd_Grid_GetColumnNumbers(ptr, col, numbers.as_mut_ptr(), rows) } {
+            SortKeys::Numbers(numbers)
+        } else {
+            SortKeys::Text(self.get_cell_values_block(0, col, rows, 1))
+        };
+
+        let grid = *self;
+        pool.submit_for(
+            self,
+            move |cancel| keys.sorted_order(ascending, cancel),
+            move |order| {
+                let applied = match order {
+                    Some(order) if order.len() == grid.get_number_rows() as usize => grid.apply_row_permutation(&order),
+                    _ => false,
+                };
+                if applied {
+                    grid.set_sorting_column(col, ascending);
+                }
+                on_done(applied);
+            },
+        )
+    }
+
     // --- Margins ---
 
     /// Sets the extra margins around the grid area.
@@ -2538,6 +2823,45 @@ impl WxWidget for Grid {
     }
 }
 
+/// Key column captured by [`Grid::sort_rows_async`].
+enum SortKeys {
+    Numbers(Vec<f64>),
+    Text(Vec<String>),
+}
+
+impl SortKeys {
+    /// Stable sort of row indices by key; `None` if cancelled.
+    fn sorted_order(self, ascending: bool, cancel: &JobCancel) -> Option<Vec<i32>> {
+        let keys = match self {
+            SortKeys::Text(text) => match text
+                .iter()
+                .map(|t| t.trim().parse::<f64>().ok())
+                .collect::<Option<Vec<f64>>>()
+            {
+                Some(numbers) => SortKeys::Numbers(numbers),
+                None => SortKeys::Text(text),
+            },
+            numbers => numbers,
+        };
+        if cancel.is_cancelled() {
+            return None;
+        }
+        let directed = |ord: std::cmp::Ordering| if ascending { ord } else { ord.reverse() };
+        let mut order: Vec<i32>;
+        match &keys {
+            SortKeys::Numbers(keys) => {
+                order = (0..keys.len() as i32).collect();
+                order.sort_by(|&a, &b| directed(keys[a as usize].total_cmp(&keys[b as usize])));
+            }
+            SortKeys::Text(keys) => {
+                order = (0..keys.len() as i32).collect();
+                order.sort_by(|&a, &b| directed(keys[a as usize].cmp(&keys[b as usize])));
+            }
+        }
+        (!cancel.is_cancelled()).then_some(order)
+    }
+}
+
 impl WxEvtHandler for Grid {
     unsafe fn get_event_handler_ptr(&self) -> *mut ffi::wxd_EvtHandler_t {
         self.handle.get_ptr().unwrap_or(std::ptr::null_mut()) as *mut ffi::wxd_EvtHandler_t
@@ -2636,3 +2960,85 @@ impl crate::xrc::XrcSupport for Grid {
         }
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::{GridBlockCoords, GridSelectionRange, SortKeys};
+    use crate::app::JobCancel;
+
+    fn order(keys: SortKeys, ascending: bool) -> Vec<i32> {
+        keys.sorted_order(ascending, &JobCancel::default()).unwrap()
+    }
+
+    #[test]
+    fn sorted_order_keeps_ties_in_row_order() {
+        let keys = || SortKeys::Numbers(vec![2.0, 1.0, 2.0, 1.0, 2.0]);
+        assert_eq!(order(keys(), true), vec![1, 3, 0, 2, 4]);
+        // Descending reverses the comparison, not the result, so ties stay in row order.
+        assert_eq!(order(keys(), false), vec![0, 2, 4, 1, 3]);
+    }
+
+    #[test]
+    fn sorted_order_compares_numeric_text_as_numbers() {
+        let keys = SortKeys::Text(vec!["10".into(), " 9 ".into(), "-1.5".into()]);
+        assert_eq!(order(keys, true), vec![2, 1, 0]);
+    }
+
+    #[test]
+    fn sorted_order_falls_back_to_text_when_any_key_is_not_a_number() {
+        let keys = SortKeys::Text(vec!["10".into(), "9".into(), "b".into(), "9".into()]);
+        assert_eq!(order(keys, true), vec![0, 1, 3, 2]);
+    }
+
+    #[test]
+    fn sorted_order_returns_none_once_cancelled() {
+        let cancel = JobCancel::default();
+        cancel.cancel();
+        assert_eq!(SortKeys::Numbers(vec![1.0, 0.0]).sorted_order(true, &cancel), None);
+    }
+
+    fn block(top_row: i32, left_col: i32, bottom_row: i32, right_col: i32) -> GridBlockCoords {
+        GridBlockCoords {
+            top_row,
+            left_col,
+            bottom_row,
+            right_col,
+        }
+    }
+
+    #[test]
+    fn selection_range_classifies_full_width_and_height() {
+        assert_eq!(
+            GridSelectionRange::from_block(block(2, 0, 4, 9), 100, 10),
+            GridSelectionRange::Rows { top: 2, bottom: 4 }
+        );
+        assert_eq!(
+            GridSelectionRange::from_block(block(0, 3, 99, 3), 100, 10),
+            GridSelectionRange::Cols { left: 3, right: 3 }
+        );
+        assert_eq!(
+            GridSelectionRange::from_block(block(1, 1, 2, 2), 100, 10),
+            GridSelectionRange::Block(block(1, 1, 2, 2))
+        );
+        // The whole grid is both full width and full height, so it is neither rows nor columns.
+        assert_eq!(
+            GridSelectionRange::from_block(block(0, 0, 99, 9), 100, 10),
+            GridSelectionRange::Block(block(0, 0, 99, 9))
+        );
+    }
+
+    #[test]
+    fn selection_range_round_trips_through_to_block() {
+        for b in [block(2, 0, 4, 9), block(0, 3, 99, 3), block(1, 1, 2, 2), block(0, 0, 99, 9)] {
+            assert_eq!(GridSelectionRange::from_block(b, 100, 10).to_block(100, 10), b);
+        }
+    }
+
+    #[test]
+    fn selection_range_to_block_on_an_empty_grid_is_inverted() {
+        // No rows: a column range covers nothing, so its bottom row lies above its top row.
+        let cols = GridSelectionRange::Cols { left: 0, right: 1 }.to_block(0, 2);
+        assert_eq!(cols, block(0, 0, -1, 1));
+        assert!(cols.bottom_row < cols.top_row);
+    }
+}
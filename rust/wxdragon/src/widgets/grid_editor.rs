@@ -0,0 +1,139 @@
+//! In-place cell editors for [`Grid`] whose edit logic is in Rust.
+//!
+//! A [`GridCellEditor`] edits cells in a text control that the grid creates once and keeps
+//! between edits. Assign the same editor to several columns, or register it for a type, to
+//! share that one control.
+//!
+//! ```rust,no_run
+//! use wxdragon::prelude::*;
+//!
+//! struct Quantity;
+//!
+//! impl GridCellEditHandler for Quantity {
+//!     fn end_edit(&self, _row: i32, _col: i32, _old: &str, new: &str) -> bool {
+//!         new.trim().parse::<u32>().is_ok()
+//!     }
+//! }
+//!
+//! # fn build(grid: &Grid) {
+//! let editor = GridCellEditor::new(Quantity);
+//! grid.set_col_editor(3, &editor);
+//! grid.set_col_editor(4, &editor);
+//! # }
+//! ```
+
+use crate::widgets::grid::Grid;
+use crate::widgets::grid_renderer::GridCellRenderer;
+use crate::widgets::textctrl::TextCtrl;
+use std::ffi::{CStr, CString, c_char, c_void};
+use wxdragon_sys as ffi;
+
+/// Edit logic behind a [`GridCellEditor`]. Every method has a default that behaves as the
+/// standard text editor.
+pub trait GridCellEditHandler: 'static {
+    /// Called once `control` holds the cell value and has focus, e.g. to select part of it.
+    fn begin_edit(&self, _row: i32, _col: i32, _control: &TextCtrl) {}
+
+    /// Called when editing ends with a changed value; return false to reject it and keep the
+    /// old value.
+    fn end_edit(&self, _row: i32, _col: i32, _old_value: &str, _new_value: &str) -> bool {
+        true
+    }
+
+    /// Stores an accepted value. Return true if it was stored here, false to let the grid
+    /// table's `set_value` store it.
+    fn apply_edit(&self, _row: i32, _col: i32, _value: &str) -> bool {
+        false
+    }
+}
+
+/// A text cell editor backed by a [`GridCellEditHandler`]. Grids hold their own reference once
+/// it is assigned.
+pub struct GridCellEditor {
+    ptr: *mut ffi::wxd_GridCellEditor_t,
+}
+
+impl GridCellEditor {
+    pub fn new<H: GridCellEditHandler>(handler: H) -> Self {
+        let handler: Box<dyn GridCellEditHandler> = Box::new(handler);
+        let callbacks = ffi::wxd_GridCellEditor_Callbacks {
+            userdata: Box::into_raw(Box::new(handler)) as *mut c_void,
+            userdata_free: Some(editor_free),
+            begin_edit: Some(editor_begin),
+            end_edit: Some(editor_end),
+            apply_edit: Some(editor_apply),
+        };
+        let ptr = unsafe { ffi::wxd_GridCellEditor_Create(&callbacks) };
+        assert!(!ptr.is_null(), "Failed to create GridCellEditor");
+        Self { ptr }
+    }
+}
+
+impl Drop for GridCellEditor {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_GridCellEditor_DecRef(self.ptr) };
+    }
+}
+
+impl Grid {
+    /// Edits every cell of column `col` with `editor`; the column's other attributes stay.
+    pub fn set_col_editor(&self, col: i32, editor: &GridCellEditor) {
+        let ptr = self.grid_ptr();
+        if !ptr.is_null() {
+            unsafe { ffi::wxd_Grid_SetColEditor(ptr, col, editor.ptr) }
+        }
+    }
+
+    pub fn set_cell_editor(&self, row: i32, col: i32, editor: &GridCellEditor) {
+        let ptr = self.grid_ptr();
+        if !ptr.is_null() {
+            unsafe { ffi::wxd_Grid_SetCellEditor(ptr, row, col, editor.ptr) }
+        }
+    }
+
+    /// Registers `type_name` for [`set_col_format_custom`](Self::set_col_format_custom) and
+    /// tables reporting that type. `None` selects the standard string renderer or text editor.
+    pub fn register_data_type(&self, type_name: &str, renderer: Option<&GridCellRenderer>, editor: Option<&GridCellEditor>) {
+        let ptr = self.grid_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        let name = CString::new(type_name).unwrap_or_default();
+        let renderer = renderer.map_or(std::ptr::null_mut(), GridCellRenderer::as_ptr);
+        let editor = editor.map_or(std::ptr::null_mut(), |e| e.ptr);
+        unsafe { ffi::wxd_Grid_RegisterDataType(ptr, name.as_ptr(), renderer, editor) }
+    }
+}
+
+fn handler<'a>(userdata: *mut c_void) -> &'a dyn GridCellEditHandler {
+    unsafe { &**(userdata as *const Box<dyn GridCellEditHandler>) }
+}
+
+fn to_str<'a>(text: *const c_char) -> std::borrow::Cow<'a, str> {
+    if text.is_null() {
+        return "".into();
+    }
+    unsafe { CStr::from_ptr(text) }.to_string_lossy()
+}
+
+unsafe extern "C" fn editor_free(userdata: *mut c_void) {
+    if !userdata.is_null() {
+        drop(unsafe { Box::from_raw(userdata as *mut Box<dyn GridCellEditHandler>) });
+    }
+}
+
+unsafe extern "C" fn editor_begin(userdata: *mut c_void, row: i32, col: i32, control: *mut ffi::wxd_Window_t) {
+    if control.is_null() {
+        return;
+    }
+    let control = unsafe { TextCtrl::from_ptr(control as *mut ffi::wxd_TextCtrl_t) };
+    handler(userdata).begin_edit(row, col, &control);
+}
+
+unsafe extern "C" fn editor_end(userdata: *mut c_void, row: i32, col: i32, old: *const c_char, new: *const c_char) -> bool {
+    handler(userdata).end_edit(row, col, &to_str(old), &to_str(new))
+}
+
+unsafe extern "C" fn editor_apply(userdata: *mut c_void, row: i32, col: i32, value: *const c_char) -> bool {
+    handler(userdata).apply_edit(row, col, &to_str(value))
+}
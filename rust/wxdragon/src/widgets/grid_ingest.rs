@@ -0,0 +1,114 @@
+//! Streaming row appends for [`Grid`]: producer threads push rows into a bounded buffer and the
+//! GUI thread appends them in batches, at most once per flush interval.
+//!
+//! ```rust,no_run
+//! use std::sync::Arc;
+//! use wxdragon::prelude::*;
+//!
+//! # fn build(grid: &Grid) {
+//! let ingest = Arc::new(grid.create_ingest(&GridIngestOptions { max_rows: Some(100_000), ..Default::default() }).unwrap());
+//! let producer = Arc::clone(&ingest);
+//! std::thread::spawn(move || {
+//!     for i in 0..1_000_000u32 {
+//!         while !producer.push_row(&[i.to_string(), "log line".to_string()]) {
+//!             std::thread::yield_now(); // buffer full
+//!         }
+//!     }
+//! });
+//! # }
+//! ```
+
+use crate::widgets::grid::Grid;
+use std::cell::RefCell;
+use std::time::Duration;
+use wxdragon_sys as ffi;
+
+/// Options for [`Grid::create_ingest`].
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct GridIngestOptions {
+    /// Rows that may be queued before [`GridIngest::push_row`] starts returning `false`.
+    pub capacity_rows: usize,
+    /// Caps the grid's row count by deleting the oldest rows.
+    pub max_rows: Option<usize>,
+    /// Keeps the last row in view after each flush.
+    pub auto_scroll: bool,
+    /// Minimum time between two flushes into the grid.
+    pub flush_interval: Duration,
+}
+
+impl Default for GridIngestOptions {
+    fn default() -> Self {
+        Self {
+            capacity_rows: 65_536,
+            max_rows: None,
+            auto_scroll: true,
+            flush_interval: Duration::from_millis(16),
+        }
+    }
+}
+
+/// Producer handle returned by [`Grid::create_ingest`]. It is `Send + Sync`; share it between
+/// threads with an `Arc`. Dropping it closes the channel after the queued rows are flushed.
+pub struct GridIngest {
+    ptr: *mut ffi::wxd_GridIngest_t,
+}
+
+// The C++ side locks around the buffer and only touches the grid on the main thread.
+unsafe impl Send for GridIngest {}
+unsafe impl Sync for GridIngest {}
+
+thread_local! {
+    // Per-producer packing buffers, reused across rows.
+    static PACK_BUFFER: RefCell<(String, Vec<u32>)> = const { RefCell::new((String::new(), Vec::new())) };
+}
+
+impl GridIngest {
+    /// Queues one row. Returns `false` if the buffer is full or the grid is gone; the row is
+    /// not queued in that case.
+    pub fn push_row<S: AsRef<str>>(&self, cells: &[S]) -> bool {
+        if cells.len() > i32::MAX as usize {
+            return false;
+        }
+        PACK_BUFFER.with(|buffer| {
+            let (packed, offsets) = &mut *buffer.borrow_mut();
+            packed.clear();
+            offsets.clear();
+            offsets.push(0);
+            for cell in cells {
+                packed.push_str(cell.as_ref());
+                if packed.len() > u32::MAX as usize {
+                    return false;
+                }
+                offsets.push(packed.len() as u32);
+            }
+            unsafe { ffi::wxd_GridIngest_PushRow(self.ptr, packed.as_ptr() as *const _, offsets.as_ptr(), cells.len() as i32) }
+        })
+    }
+
+    /// Rows queued but not yet appended to the grid.
+    pub fn pending(&self) -> usize {
+        unsafe { ffi::wxd_GridIngest_GetPendingCount(self.ptr) }
+    }
+}
+
+impl Drop for GridIngest {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_GridIngest_Destroy(self.ptr) }
+    }
+}
+
+impl Grid {
+    /// Creates an ingest channel that appends rows pushed from any thread. The grid's table
+    /// must support appending rows (as the one made by [`Grid::create_grid`] does). Call on the
+    /// main thread.
+    pub fn create_ingest(&self, options: &GridIngestOptions) -> Option<GridIngest> {
+        let ptr = self.grid_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        let max_rows = options.max_rows.map_or(0, |m| m.min(i32::MAX as usize) as i32);
+        let interval = options.flush_interval.as_millis().min(i32::MAX as u128) as i32;
+        let ingest = unsafe { ffi::wxd_GridIngest_Create(ptr, options.capacity_rows, max_rows, options.auto_scroll, interval) };
+        (!ingest.is_null()).then_some(GridIngest { ptr: ingest })
+    }
+}
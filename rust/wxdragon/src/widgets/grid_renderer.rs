@@ -0,0 +1,196 @@
+//! Cell renderers for [`Grid`] whose drawing is done in Rust.
+//!
+//! Implement [`GridCellPainter`] and wrap it in a [`GridCellRenderer`]. A renderer made with
+//! [`GridCellRenderer::batched`] is handed every visible cell of a column at once, so custom
+//! columns (sparklines, badges) cost one call per column per paint rather than one per cell.
+//!
+//! ```rust,no_run
+//! use wxdragon::prelude::*;
+//! use wxdragon::widgets::dataview::RenderContext;
+//!
+//! struct Bars;
+//!
+//! impl GridCellPainter for Bars {
+//!     fn draw_batch(&self, dc: &RenderContext, _col: i32, cells: &[GridRenderCell]) {
+//!         dc.set_brush(Colour::rgb(70, 130, 180), BrushStyle::Solid);
+//!         for cell in cells {
+//!             let width = cell.rect.width * (cell.row % 10) / 10;
+//!             dc.draw_rectangle(cell.rect.x, cell.rect.y + 2, width, cell.rect.height - 4);
+//!         }
+//!     }
+//! }
+//!
+//! # fn build(grid: &Grid) {
+//! grid.set_col_renderer(2, &GridCellRenderer::batched(Bars));
+//! # }
+//! ```
+
+use crate::geometry::{Rect, Size};
+use crate::widgets::dataview::RenderContext;
+use crate::widgets::grid::Grid;
+use std::ffi::{CString, c_void};
+use wxdragon_sys as ffi;
+
+/// One cell of a batch: its row, its rectangle in the DC and whether it is selected.
+#[derive(Debug, Copy, Clone, PartialEq, Eq)]
+pub struct GridRenderCell {
+    pub row: i32,
+    pub rect: Rect,
+    pub selected: bool,
+}
+
+/// Drawing code behind a [`GridCellRenderer`]. Backgrounds (selection and attribute colours) are
+/// already painted when these run. Implement at least one of `draw` and `draw_batch`; each
+/// defaults to the other.
+pub trait GridCellPainter: 'static {
+    /// Draws one cell.
+    fn draw(&self, dc: &RenderContext, row: i32, col: i32, rect: Rect, selected: bool) {
+        self.draw_batch(dc, col, &[GridRenderCell { row, rect, selected }]);
+    }
+
+    /// Draws several cells of column `col`. Only called in one go for renderers made with
+    /// [`GridCellRenderer::batched`]; by default draws each cell with [`draw`](Self::draw).
+    fn draw_batch(&self, dc: &RenderContext, col: i32, cells: &[GridRenderCell]) {
+        for cell in cells {
+            self.draw(dc, cell.row, col, cell.rect, cell.selected);
+        }
+    }
+
+    /// Size the cell needs, used when autosizing rows and columns. `None` keeps its size.
+    fn best_size(&self, _dc: &RenderContext, _row: i32, _col: i32) -> Option<Size> {
+        None
+    }
+}
+
+/// A grid cell renderer backed by a [`GridCellPainter`]. Cheap to keep around; grids hold their
+/// own reference once it is assigned.
+pub struct GridCellRenderer {
+    ptr: *mut ffi::wxd_GridCellRenderer_t,
+}
+
+impl GridCellRenderer {
+    /// A renderer asked to draw one cell at a time.
+    pub fn new<P: GridCellPainter>(painter: P) -> Self {
+        Self::create(painter, false)
+    }
+
+    /// A renderer drawing all visible cells of a column in one
+    /// [`draw_batch`](GridCellPainter::draw_batch) call per paint.
+    pub fn batched<P: GridCellPainter>(painter: P) -> Self {
+        Self::create(painter, true)
+    }
+
+    fn create<P: GridCellPainter>(painter: P, batched: bool) -> Self {
+        let painter: Box<dyn GridCellPainter> = Box::new(painter);
+        let callbacks = ffi::wxd_GridCellRenderer_Callbacks {
+            userdata: Box::into_raw(Box::new(painter)) as *mut c_void,
+            userdata_free: Some(renderer_free),
+            draw: Some(renderer_draw),
+            draw_batch: batched.then_some(renderer_draw_batch as _),
+            get_best_size: Some(renderer_best_size),
+        };
+        let ptr = unsafe { ffi::wxd_GridCellRenderer_Create(&callbacks) };
+        assert!(!ptr.is_null(), "Failed to create GridCellRenderer");
+        Self { ptr }
+    }
+
+    pub(crate) fn as_ptr(&self) -> *mut ffi::wxd_GridCellRenderer_t {
+        self.ptr
+    }
+}
+
+impl Drop for GridCellRenderer {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_GridCellRenderer_DecRef(self.ptr) };
+    }
+}
+
+impl Grid {
+    /// Draws every cell of column `col` with `renderer`; the column's other attributes stay.
+    pub fn set_col_renderer(&self, col: i32, renderer: &GridCellRenderer) {
+        let ptr = self.grid_ptr();
+        if !ptr.is_null() {
+            unsafe { ffi::wxd_Grid_SetColRenderer(ptr, col, renderer.ptr) }
+        }
+    }
+
+    pub fn set_cell_renderer(&self, row: i32, col: i32, renderer: &GridCellRenderer) {
+        let ptr = self.grid_ptr();
+        if !ptr.is_null() {
+            unsafe { ffi::wxd_Grid_SetCellRenderer(ptr, row, col, renderer.ptr) }
+        }
+    }
+
+    /// Registers `type_name` for [`set_col_format_custom`](Self::set_col_format_custom) and
+    /// tables reporting that type, drawn by `renderer` and edited as text.
+    pub fn register_renderer_type(&self, type_name: &str, renderer: &GridCellRenderer) {
+        let ptr = self.grid_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        let name = CString::new(type_name).unwrap_or_default();
+        unsafe { ffi::wxd_Grid_RegisterRendererType(ptr, name.as_ptr(), renderer.ptr) }
+    }
+}
+
+fn painter<'a>(userdata: *mut c_void) -> &'a dyn GridCellPainter {
+    unsafe { &**(userdata as *const Box<dyn GridCellPainter>) }
+}
+
+fn to_rect(rect: ffi::wxd_Rect) -> Rect {
+    Rect::new(rect.x, rect.y, rect.width, rect.height)
+}
+
+unsafe extern "C" fn renderer_free(userdata: *mut c_void) {
+    if !userdata.is_null() {
+        drop(unsafe { Box::from_raw(userdata as *mut Box<dyn GridCellPainter>) });
+    }
+}
+
+unsafe extern "C" fn renderer_draw(
+    userdata: *mut c_void,
+    dc: *mut ffi::wxd_DC_t,
+    row: i32,
+    col: i32,
+    rect: ffi::wxd_Rect,
+    selected: bool,
+) {
+    let dc = unsafe { RenderContext::from_raw(dc as *mut c_void) };
+    painter(userdata).draw(&dc, row, col, to_rect(rect), selected);
+}
+
+unsafe extern "C" fn renderer_draw_batch(userdata: *mut c_void, dc: *mut ffi::wxd_DC_t, batch: *const ffi::wxd_GridRenderBatch) {
+    let Some(batch) = (unsafe { batch.as_ref() }) else {
+        return;
+    };
+    if batch.count == 0 {
+        return;
+    }
+    let (rows, rects, selected) = unsafe {
+        (
+            std::slice::from_raw_parts(batch.rows, batch.count),
+            std::slice::from_raw_parts(batch.rects, batch.count),
+            std::slice::from_raw_parts(batch.selected, batch.count),
+        )
+    };
+    let cells: Vec<GridRenderCell> = (0..batch.count)
+        .map(|i| GridRenderCell {
+            row: rows[i],
+            rect: to_rect(rects[i]),
+            selected: selected[i] != 0,
+        })
+        .collect();
+    let dc = unsafe { RenderContext::from_raw(dc as *mut c_void) };
+    painter(userdata).draw_batch(&dc, batch.col, &cells);
+}
+
+unsafe extern "C" fn renderer_best_size(userdata: *mut c_void, dc: *mut ffi::wxd_DC_t, row: i32, col: i32) -> ffi::wxd_Size {
+    let dc = unsafe { RenderContext::from_raw(dc as *mut c_void) };
+    match painter(userdata).best_size(&dc, row, col) {
+        Some(size) => ffi::wxd_Size {
+            width: size.width,
+            height: size.height,
+        },
+        None => ffi::wxd_Size { width: -1, height: -1 },
+    }
+}
@@ -0,0 +1,79 @@
+//! Shared cell styles for [`Grid`]: register a few styles once, then assign them to cells, rows
+//! or blocks in bulk. Every cell using a style shares one native attribute object.
+//!
+//! ```rust,no_run
+//! use wxdragon::prelude::*;
+//!
+//! # fn build(grid: &Grid) {
+//! let hot = grid
+//!     .add_style(&GridCellAttrSpec { background_colour: Some(Colour::rgb(255, 80, 80)), ..Default::default() })
+//!     .unwrap();
+//! let cold = grid
+//!     .add_style(&GridCellAttrSpec { background_colour: Some(Colour::rgb(80, 80, 255)), ..Default::default() })
+//!     .unwrap();
+//! grid.set_cell_styles(0, 0, &[hot, cold, GridCellStyle::NONE, hot]);
+//! grid.set_block_style(1, 0, 1000, 4, cold);
+//! # }
+//! ```
+
+use crate::font::Font;
+use crate::widgets::grid::Grid;
+use crate::widgets::grid_table::GridCellAttrSpec;
+use wxdragon_sys as ffi;
+
+/// Index of a style registered with [`Grid::add_style`].
+#[derive(Debug, Copy, Clone, PartialEq, Eq, Hash)]
+#[repr(transparent)]
+pub struct GridCellStyle(i32);
+
+impl GridCellStyle {
+    /// Removes any palette style from the cell.
+    pub const NONE: GridCellStyle = GridCellStyle(-1);
+
+    pub fn index(self) -> i32 {
+        self.0
+    }
+}
+
+impl Grid {
+    /// Registers a shared cell style. Register styles before setting per-cell attributes with
+    /// `set_cell_*`; attributes set that way take precedence over the style. Returns `None` if
+    /// the grid's table already has an attribute provider, which is left untouched.
+    pub fn add_style(&self, spec: &GridCellAttrSpec) -> Option<GridCellStyle> {
+        let ptr = self.grid_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        let mut desc: ffi::wxd_GridCellAttrDesc = unsafe { std::mem::zeroed() };
+        spec.write_desc(&mut desc);
+        let index = unsafe { ffi::wxd_Grid_AddStyle(ptr, &desc) };
+        (index >= 0).then_some(GridCellStyle(index))
+    }
+
+    /// Sets the font used by every cell with `style`.
+    pub fn set_style_font(&self, style: GridCellStyle, font: &Font) -> bool {
+        let ptr = self.grid_ptr();
+        !ptr.is_null() && unsafe { ffi::wxd_Grid_SetStyleFont(ptr, style.0, font.as_ptr() as *const _) }
+    }
+
+    /// Assigns one style per cell to consecutive cells of `row` starting at `first_col`.
+    pub fn set_cell_styles(&self, row: i32, first_col: i32, styles: &[GridCellStyle]) -> bool {
+        let ptr = self.grid_ptr();
+        !ptr.is_null() && unsafe { ffi::wxd_Grid_SetCellStyles(ptr, row, first_col, styles.as_ptr() as *const i32, styles.len()) }
+    }
+
+    /// Assigns `style` to a block of cells; pass every column to style whole rows.
+    pub fn set_block_style(&self, top_row: i32, left_col: i32, num_rows: i32, num_cols: i32, style: GridCellStyle) -> bool {
+        let ptr = self.grid_ptr();
+        !ptr.is_null() && unsafe { ffi::wxd_Grid_SetBlockStyle(ptr, top_row, left_col, num_rows, num_cols, style.0) }
+    }
+
+    /// Removes all style assignments and registered styles. Previously returned
+    /// [`GridCellStyle`] values become invalid.
+    pub fn clear_styles(&self) {
+        let ptr = self.grid_ptr();
+        if !ptr.is_null() {
+            unsafe { ffi::wxd_Grid_ClearStyles(ptr) }
+        }
+    }
+}
@@ -0,0 +1,338 @@
+//! Virtual tables for [`Grid`]: cell data stays in Rust and the grid only asks for visible cells.
+//!
+//! ```rust,no_run
+//! use wxdragon::prelude::*;
+//!
+//! struct Squares;
+//!
+//! impl GridTable for Squares {
+//!     fn number_rows(&self) -> usize {
+//!         5_000_000
+//!     }
+//!     fn number_cols(&self) -> usize {
+//!         2
+//!     }
+//!     fn value(&self, row: usize, col: usize, out: &mut String) {
+//!         use std::fmt::Write;
+//!         let _ = if col == 0 { write!(out, "{row}") } else { write!(out, "{}", row * row) };
+//!     }
+//! }
+//!
+//! # fn build(grid: &Grid) {
+//! grid.set_table(Squares, GridSelectionMode::Cells);
+//! # }
+//! ```
+
+use crate::color::Colour;
+use crate::widgets::grid::{Grid, GridSelectionMode};
+use std::cell::RefCell;
+use std::ffi::c_void;
+use std::os::raw::c_char;
+use wxdragon_sys as ffi;
+
+/// Value type of a table cell; selects the grid's default renderer and editor for it.
+#[derive(Debug, Copy, Clone, PartialEq, Eq, Default)]
+#[repr(i32)]
+pub enum GridValueType {
+    #[default]
+    String = ffi::WXD_GRID_VALUE_STRING as i32,
+    Bool = ffi::WXD_GRID_VALUE_BOOL as i32,
+    Number = ffi::WXD_GRID_VALUE_NUMBER as i32,
+    Float = ffi::WXD_GRID_VALUE_FLOAT as i32,
+}
+
+/// Per-cell attributes supplied by [`GridTable::attr`].
+#[derive(Debug, Copy, Clone, PartialEq, Eq, Default)]
+pub struct GridCellAttrSpec {
+    pub text_colour: Option<Colour>,
+    pub background_colour: Option<Colour>,
+    /// Horizontal and vertical alignment (`wxALIGN_*` values).
+    pub alignment: Option<(i32, i32)>,
+    pub read_only: bool,
+}
+
+impl GridCellAttrSpec {
+    pub(crate) fn write_desc(&self, out: &mut ffi::wxd_GridCellAttrDesc) {
+        let (horiz_align, vert_align) = self.alignment.unwrap_or((0, 0));
+        out.has_text_colour = self.text_colour.is_some();
+        out.text_colour = self.text_colour.map(|c| c.to_raw()).unwrap_or(out.text_colour);
+        out.has_bg_colour = self.background_colour.is_some();
+        out.bg_colour = self.background_colour.map(|c| c.to_raw()).unwrap_or(out.bg_colour);
+        out.has_alignment = self.alignment.is_some();
+        out.horiz_align = horiz_align;
+        out.vert_align = vert_align;
+        out.read_only = self.read_only;
+    }
+}
+
+/// Data source for a virtual [`Grid`]. Install it with [`Grid::set_table`].
+///
+/// Only `number_rows`, `number_cols` and `value` are required. When the row or column count
+/// changes, call the matching `Grid::notify_table_*` method afterwards.
+pub trait GridTable: 'static {
+    fn number_rows(&self) -> usize;
+    fn number_cols(&self) -> usize;
+
+    /// Writes the text of a cell into `out` (which arrives empty).
+    fn value(&self, row: usize, col: usize, out: &mut String);
+
+    /// Called when the user edits a cell. Read-only by default.
+    fn set_value(&mut self, _row: usize, _col: usize, _value: &str) {}
+
+    fn value_type(&self, _row: usize, _col: usize) -> GridValueType {
+        GridValueType::String
+    }
+
+    /// Used by the number renderer for [`GridValueType::Number`] cells. Where the native `long` is
+    /// 32 bits (Windows), values outside its range are clamped.
+    fn value_as_long(&self, row: usize, col: usize) -> i64 {
+        let mut text = String::new();
+        self.value(row, col, &mut text);
+        text.trim().parse().unwrap_or(0)
+    }
+
+    /// Used by the float renderer for [`GridValueType::Float`] cells.
+    fn value_as_double(&self, row: usize, col: usize) -> f64 {
+        let mut text = String::new();
+        self.value(row, col, &mut text);
+        text.trim().parse().unwrap_or(0.0)
+    }
+
+    /// Used by the bool renderer for [`GridValueType::Bool`] cells.
+    fn value_as_bool(&self, row: usize, col: usize) -> bool {
+        let mut text = String::new();
+        self.value(row, col, &mut text);
+        !text.is_empty() && text != "0"
+    }
+
+    /// Attributes for drawing the cell; cells returning equal specs share one native attribute.
+    fn attr(&self, _row: usize, _col: usize) -> Option<GridCellAttrSpec> {
+        None
+    }
+}
+
+struct GridTableState {
+    table: RefCell<Box<dyn GridTable>>,
+    // Backing store for the pointer handed out by the get_value callback.
+    scratch: RefCell<String>,
+}
+
+impl Grid {
+    /// Installs a virtual table instead of calling [`Grid::create_grid`]. The grid takes
+    /// ownership of `table` and drops it when the grid is destroyed.
+    pub fn set_table<T: GridTable>(&self, table: T, selection_mode: GridSelectionMode) -> bool {
+        let ptr = self.grid_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        let state = Box::new(GridTableState {
+            table: RefCell::new(Box::new(table)),
+            scratch: RefCell::new(String::new()),
+        });
+        let callbacks = ffi::wxd_GridTable_Callbacks {
+            userdata: Box::into_raw(state) as *mut c_void,
+            userdata_free: Some(table_free),
+            get_number_rows: Some(table_number_rows),
+            get_number_cols: Some(table_number_cols),
+            get_value: Some(table_get_value),
+            set_value: Some(table_set_value),
+            get_type: Some(table_get_type),
+            get_value_as_long: Some(table_get_long),
+            get_value_as_double: Some(table_get_double),
+            get_value_as_bool: Some(table_get_bool),
+            get_attr: Some(table_get_attr),
+        };
+        // On failure the C++ side already released the state through table_free.
+        unsafe { ffi::wxd_Grid_SetTable(ptr, &callbacks, selection_mode as i32) }
+    }
+
+    /// Notifies the grid that the table gained `num_rows` rows at `pos`.
+    pub fn notify_table_rows_inserted(&self, pos: i32, num_rows: i32) {
+        let ptr = self.grid_ptr();
+        if !ptr.is_null() {
+            unsafe { ffi::wxd_Grid_NotifyTableRowsInserted(ptr, pos, num_rows) }
+        }
+    }
+
+    /// Notifies the grid that the table gained `num_rows` rows at the end.
+    pub fn notify_table_rows_appended(&self, num_rows: i32) {
+        let ptr = self.grid_ptr();
+        if !ptr.is_null() {
+            unsafe { ffi::wxd_Grid_NotifyTableRowsAppended(ptr, num_rows) }
+        }
+    }
+
+    /// Notifies the grid that `num_rows` rows starting at `pos` were removed from the table.
+    pub fn notify_table_rows_deleted(&self, pos: i32, num_rows: i32) {
+        let ptr = self.grid_ptr();
+        if !ptr.is_null() {
+            unsafe { ffi::wxd_Grid_NotifyTableRowsDeleted(ptr, pos, num_rows) }
+        }
+    }
+
+    /// Notifies the grid that the table gained `num_cols` columns at `pos`.
+    pub fn notify_table_cols_inserted(&self, pos: i32, num_cols: i32) {
+        let ptr = self.grid_ptr();
+        if !ptr.is_null() {
+            unsafe { ffi::wxd_Grid_NotifyTableColsInserted(ptr, pos, num_cols) }
+        }
+    }
+
+    /// Notifies the grid that the table gained `num_cols` columns at the end.
+    pub fn notify_table_cols_appended(&self, num_cols: i32) {
+        let ptr = self.grid_ptr();
+        if !ptr.is_null() {
+            unsafe { ffi::wxd_Grid_NotifyTableColsAppended(ptr, num_cols) }
+        }
+    }
+
+    /// Notifies the grid that `num_cols` columns starting at `pos` were removed from the table.
+    pub fn notify_table_cols_deleted(&self, pos: i32, num_cols: i32) {
+        let ptr = self.grid_ptr();
+        if !ptr.is_null() {
+            unsafe { ffi::wxd_Grid_NotifyTableColsDeleted(ptr, pos, num_cols) }
+        }
+    }
+
+    /// Installs a native columnar table: each column is held as a contiguous typed array
+    /// (`i64`, `f64` or `bool`; `String` columns fall back to text) and values are only
+    /// formatted when a visible cell is painted. Fill it with the `update_column_*` methods.
+    pub fn create_columnar_table(&self, rows: usize, col_types: &[GridValueType], selection_mode: GridSelectionMode) -> bool {
+        let ptr = self.grid_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        let types: Vec<i32> = col_types.iter().map(|t| *t as i32).collect();
+        unsafe { ffi::wxd_Grid_CreateColumnarTable(ptr, rows as i32, types.as_ptr(), types.len() as i32, selection_mode as i32) }
+    }
+
+    /// Grows or shrinks a columnar table; new rows are zero/empty.
+    pub fn set_columnar_row_count(&self, rows: usize) -> bool {
+        let ptr = self.grid_ptr();
+        !ptr.is_null() && unsafe { ffi::wxd_Grid_ColumnarSetRowCount(ptr, rows as i32) }
+    }
+
+    /// Copies `values` into a `Number` column starting at `first_row` and repaints only that
+    /// range. Returns `false` if the column type or range does not match.
+    pub fn update_column_i64(&self, col: usize, first_row: usize, values: &[i64]) -> bool {
+        let ptr = self.grid_ptr();
+        !ptr.is_null()
+            && unsafe { ffi::wxd_Grid_ColumnarUpdateInt64(ptr, col as i32, first_row as i32, values.as_ptr(), values.len()) }
+    }
+
+    /// Like [`Grid::update_column_i64`] for a `Float` column.
+    pub fn update_column_f64(&self, col: usize, first_row: usize, values: &[f64]) -> bool {
+        let ptr = self.grid_ptr();
+        !ptr.is_null()
+            && unsafe { ffi::wxd_Grid_ColumnarUpdateDouble(ptr, col as i32, first_row as i32, values.as_ptr(), values.len()) }
+    }
+
+    /// Like [`Grid::update_column_i64`] for a `Bool` column.
+    pub fn update_column_bool(&self, col: usize, first_row: usize, values: &[bool]) -> bool {
+        let ptr = self.grid_ptr();
+        !ptr.is_null()
+            && unsafe { ffi::wxd_Grid_ColumnarUpdateBool(ptr, col as i32, first_row as i32, values.as_ptr(), values.len()) }
+    }
+}
+
+fn state<'a>(userdata: *mut c_void) -> &'a GridTableState {
+    unsafe { &*(userdata as *const GridTableState) }
+}
+
+// Runs `f` on the table, or returns `fallback` if a callback re-entered while the table is
+// mutably borrowed, as unwinding out of the extern "C" callbacks would abort.
+fn read_table<R>(userdata: *mut c_void, fallback: R, f: impl FnOnce(&dyn GridTable) -> R) -> R {
+    match state(userdata).table.try_borrow() {
+        Ok(table) => f(table.as_ref()),
+        Err(_) => fallback,
+    }
+}
+
+fn to_count(n: usize) -> i32 {
+    n.min(i32::MAX as usize) as i32
+}
+
+unsafe extern "C" fn table_free(userdata: *mut c_void) {
+    if !userdata.is_null() {
+        drop(unsafe { Box::from_raw(userdata as *mut GridTableState) });
+    }
+}
+
+unsafe extern "C" fn table_number_rows(userdata: *mut c_void) -> i32 {
+    read_table(userdata, 0, |table| to_count(table.number_rows()))
+}
+
+unsafe extern "C" fn table_number_cols(userdata: *mut c_void) -> i32 {
+    read_table(userdata, 0, |table| to_count(table.number_cols()))
+}
+
+unsafe extern "C" fn table_get_value(userdata: *mut c_void, row: i32, col: i32, out_len: *mut usize) -> *const c_char {
+    let Ok(mut scratch) = state(userdata).scratch.try_borrow_mut() else {
+        // Re-entered from `value`; the outer call still uses the scratch buffer.
+        if !out_len.is_null() {
+            unsafe { *out_len = 0 };
+        }
+        return c"".as_ptr();
+    };
+    scratch.clear();
+    if row >= 0 && col >= 0 {
+        read_table(userdata, (), |table| table.value(row as usize, col as usize, &mut scratch));
+    }
+    if !out_len.is_null() {
+        unsafe { *out_len = scratch.len() };
+    }
+    scratch.as_ptr() as *const c_char
+}
+
+unsafe extern "C" fn table_set_value(userdata: *mut c_void, row: i32, col: i32, value: *const c_char, len: usize) {
+    if row < 0 || col < 0 || value.is_null() {
+        return;
+    }
+    let bytes = unsafe { std::slice::from_raw_parts(value as *const u8, len) };
+    let text = String::from_utf8_lossy(bytes);
+    match state(userdata).table.try_borrow_mut() {
+        Ok(mut table) => table.set_value(row as usize, col as usize, &text),
+        Err(_) => log::warn!("GridTable::set_value re-entered while the table was in use; edit ignored"),
+    }
+}
+
+unsafe extern "C" fn table_get_type(userdata: *mut c_void, row: i32, col: i32) -> i32 {
+    if row < 0 || col < 0 {
+        return GridValueType::String as i32;
+    }
+    read_table(userdata, GridValueType::String as i32, |table| {
+        table.value_type(row as usize, col as usize) as i32
+    })
+}
+
+unsafe extern "C" fn table_get_long(userdata: *mut c_void, row: i32, col: i32) -> i64 {
+    if row < 0 || col < 0 {
+        return 0;
+    }
+    read_table(userdata, 0, |table| table.value_as_long(row as usize, col as usize))
+}
+
+unsafe extern "C" fn table_get_double(userdata: *mut c_void, row: i32, col: i32) -> f64 {
+    if row < 0 || col < 0 {
+        return 0.0;
+    }
+    read_table(userdata, 0.0, |table| table.value_as_double(row as usize, col as usize))
+}
+
+unsafe extern "C" fn table_get_bool(userdata: *mut c_void, row: i32, col: i32) -> bool {
+    if row < 0 || col < 0 {
+        return false;
+    }
+    read_table(userdata, false, |table| table.value_as_bool(row as usize, col as usize))
+}
+
+unsafe extern "C" fn table_get_attr(userdata: *mut c_void, row: i32, col: i32, out_attr: *mut ffi::wxd_GridCellAttrDesc) -> bool {
+    if row < 0 || col < 0 || out_attr.is_null() {
+        return false;
+    }
+    let Some(spec) = read_table(userdata, None, |table| table.attr(row as usize, col as usize)) else {
+        return false;
+    };
+    spec.write_desc(unsafe { &mut *out_attr });
+    true
+}
@@ -0,0 +1,280 @@
+//! Window that scrolls by rows and columns.
+
+use crate::event::WxEvtHandler;
+use crate::geometry::{Point, Size};
+use crate::id::Id;
+use crate::window::{WindowHandle, WxWidget};
+use std::ffi::c_void;
+use std::ops::Range;
+use wxdragon_sys as ffi;
+
+widget_style_enum!(
+    name: HVScrolledWindowStyle,
+    doc: "Style flags for HVScrolledWindow.",
+    variants: {
+        Default: 0, "Default style."
+    },
+    default_variant: Default
+);
+
+type UnitSizeFn = Box<dyn FnMut(usize) -> i32>;
+
+struct SizeCallbacks {
+    row_height: Option<UnitSizeFn>,
+    column_width: Option<UnitSizeFn>,
+}
+
+/// A window that scrolls in logical units (rows and columns) rather than pixels, for custom
+/// tables and grids too large to give a pixel size.
+///
+/// Sizes are asked from the closures given to [`HVScrolledWindow::on_measure`] only for the
+/// rows and columns near the visible area, so the row count can be in the billions. Paint from a
+/// paint handler: client (0, 0) is the top-left corner of the first visible row and column, and
+/// [`visible_rows`](Self::visible_rows) / [`visible_columns`](Self::visible_columns) tell which
+/// ones to draw.
+///
+/// # Example
+/// ```ignore
+/// let table = HVScrolledWindow::builder(&frame).build();
+/// table.on_measure(Some(|_row| 22), Some(|col| if col == 0 { 60 } else { 120 }));
+/// table.set_row_column_count(5_000_000_000, 12);
+/// table.on_paint(move |_| {
+///     let dc = PaintDC::new(&table);
+///     let mut y = 0;
+///     for row in table.visible_rows() {
+///         // draw the cells of `row` at y, then advance by its height
+///         y += 22;
+///     }
+/// });
+/// ```
+#[derive(Clone, Copy)]
+pub struct HVScrolledWindow {
+    handle: WindowHandle,
+}
+
+impl HVScrolledWindow {
+    /// Creates a new `HVScrolledWindowBuilder` for constructing the window.
+    pub fn builder(parent: &dyn WxWidget) -> HVScrolledWindowBuilder<'_> {
+        HVScrolledWindowBuilder::new(parent)
+    }
+
+    #[inline]
+    fn hvscrolled_ptr(&self) -> *mut ffi::wxd_HVScrolledWindow_t {
+        self.handle
+            .get_ptr()
+            .map(|p| p as *mut ffi::wxd_HVScrolledWindow_t)
+            .unwrap_or(std::ptr::null_mut())
+    }
+
+    /// Sets the row height and column width callbacks, replacing previous ones; `None` uses the
+    /// default size (see [`set_default_sizes`](Self::set_default_sizes)).
+    pub fn on_measure<R, C>(&self, row_height: Option<R>, column_width: Option<C>)
+    where
+        R: FnMut(usize) -> i32 + 'static,
+        C: FnMut(usize) -> i32 + 'static,
+    {
+        let ptr = self.hvscrolled_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        let callbacks = Box::new(SizeCallbacks {
+            row_height: row_height.map(|f| Box::new(f) as UnitSizeFn),
+            column_width: column_width.map(|f| Box::new(f) as UnitSizeFn),
+        });
+        let row_cb: ffi::wxd_HVScrolledWindow_UnitSize = match callbacks.row_height {
+            Some(_) => Some(row_height_trampoline),
+            None => None,
+        };
+        let column_cb: ffi::wxd_HVScrolledWindow_UnitSize = match callbacks.column_width {
+            Some(_) => Some(column_width_trampoline),
+            None => None,
+        };
+        let user_data = Box::into_raw(callbacks) as *mut c_void;
+        unsafe {
+            ffi::wxd_HVScrolledWindow_SetCallbacks(ptr, row_cb, column_cb, user_data, Some(free_callbacks));
+        }
+    }
+
+    /// Sizes used when no callback is set (20 and 80 pixels by default).
+    pub fn set_default_sizes(&self, row_height: i32, column_width: i32) {
+        let ptr = self.hvscrolled_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_HVScrolledWindow_SetDefaultSizes(ptr, row_height, column_width) };
+    }
+
+    pub fn set_row_column_count(&self, rows: usize, columns: usize) {
+        let ptr = self.hvscrolled_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_HVScrolledWindow_SetRowColumnCount(ptr, rows, columns) };
+    }
+
+    pub fn get_row_count(&self) -> usize {
+        let ptr = self.hvscrolled_ptr();
+        if ptr.is_null() {
+            return 0;
+        }
+        unsafe { ffi::wxd_HVScrolledWindow_GetRowCount(ptr) }
+    }
+
+    pub fn get_column_count(&self) -> usize {
+        let ptr = self.hvscrolled_ptr();
+        if ptr.is_null() {
+            return 0;
+        }
+        unsafe { ffi::wxd_HVScrolledWindow_GetColumnCount(ptr) }
+    }
+
+    /// Asks for all sizes again and repaints; call after sizes changed.
+    pub fn refresh_all(&self) {
+        let ptr = self.hvscrolled_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_HVScrolledWindow_RefreshAll(ptr) };
+    }
+
+    /// Repaints the visible part of `rows`.
+    pub fn refresh_rows(&self, rows: Range<usize>) {
+        let ptr = self.hvscrolled_ptr();
+        if ptr.is_null() || rows.is_empty() {
+            return;
+        }
+        unsafe { ffi::wxd_HVScrolledWindow_RefreshRows(ptr, rows.start, rows.end - 1) };
+    }
+
+    /// Repaints the visible part of `columns`.
+    pub fn refresh_columns(&self, columns: Range<usize>) {
+        let ptr = self.hvscrolled_ptr();
+        if ptr.is_null() || columns.is_empty() {
+            return;
+        }
+        unsafe { ffi::wxd_HVScrolledWindow_RefreshColumns(ptr, columns.start, columns.end - 1) };
+    }
+
+    /// Makes `row` the first visible row. Returns false if the view did not move.
+    pub fn scroll_to_row(&self, row: usize) -> bool {
+        let ptr = self.hvscrolled_ptr();
+        !ptr.is_null() && unsafe { ffi::wxd_HVScrolledWindow_ScrollToRow(ptr, row) }
+    }
+
+    /// Makes `column` the first visible column. Returns false if the view did not move.
+    pub fn scroll_to_column(&self, column: usize) -> bool {
+        let ptr = self.hvscrolled_ptr();
+        !ptr.is_null() && unsafe { ffi::wxd_HVScrolledWindow_ScrollToColumn(ptr, column) }
+    }
+
+    /// Rows at least partially on screen.
+    pub fn visible_rows(&self) -> Range<usize> {
+        let ptr = self.hvscrolled_ptr();
+        if ptr.is_null() {
+            return 0..0;
+        }
+        let (mut begin, mut end) = (0usize, 0usize);
+        unsafe { ffi::wxd_HVScrolledWindow_GetVisibleRows(ptr, &mut begin, &mut end) };
+        begin..end
+    }
+
+    /// Columns at least partially on screen.
+    pub fn visible_columns(&self) -> Range<usize> {
+        let ptr = self.hvscrolled_ptr();
+        if ptr.is_null() {
+            return 0..0;
+        }
+        let (mut begin, mut end) = (0usize, 0usize);
+        unsafe { ffi::wxd_HVScrolledWindow_GetVisibleColumns(ptr, &mut begin, &mut end) };
+        begin..end
+    }
+
+    /// The (row, column) under a client point, or `None` past the last row or column.
+    pub fn hit_test(&self, point: Point) -> Option<(usize, usize)> {
+        let ptr = self.hvscrolled_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        let (mut row, mut column) = (0usize, 0usize);
+        unsafe { ffi::wxd_HVScrolledWindow_HitTest(ptr, point.x, point.y, &mut row, &mut column) }.then_some((row, column))
+    }
+
+    /// Creates an HVScrolledWindow from a raw pointer.
+    /// # Safety
+    /// The pointer must be a valid `wxd_HVScrolledWindow_t`.
+    pub(crate) unsafe fn from_ptr(ptr: *mut ffi::wxd_HVScrolledWindow_t) -> Self {
+        assert!(!ptr.is_null());
+        HVScrolledWindow {
+            handle: WindowHandle::new(ptr as *mut ffi::wxd_Window_t),
+        }
+    }
+
+    /// Returns the underlying WindowHandle for this window.
+    pub fn window_handle(&self) -> WindowHandle {
+        self.handle
+    }
+}
+
+extern "C" fn row_height_trampoline(user_data: *mut c_void, row: usize) -> i32 {
+    if user_data.is_null() {
+        return 1;
+    }
+    let callbacks = unsafe { &mut *(user_data as *mut SizeCallbacks) };
+    callbacks.row_height.as_mut().map_or(1, |f| f(row))
+}
+
+extern "C" fn column_width_trampoline(user_data: *mut c_void, column: usize) -> i32 {
+    if user_data.is_null() {
+        return 1;
+    }
+    let callbacks = unsafe { &mut *(user_data as *mut SizeCallbacks) };
+    callbacks.column_width.as_mut().map_or(1, |f| f(column))
+}
+
+extern "C" fn free_callbacks(user_data: *mut c_void) {
+    if !user_data.is_null() {
+        let _ = unsafe { Box::from_raw(user_data as *mut SizeCallbacks) };
+    }
+}
+
+impl WxWidget for HVScrolledWindow {
+    fn handle_ptr(&self) -> *mut ffi::wxd_Window_t {
+        self.handle.get_ptr().unwrap_or(std::ptr::null_mut())
+    }
+
+    fn is_valid(&self) -> bool {
+        self.handle.is_valid()
+    }
+}
+
+impl WxEvtHandler for HVScrolledWindow {
+    unsafe fn get_event_handler_ptr(&self) -> *mut ffi::wxd_EvtHandler_t {
+        self.handle.get_ptr().unwrap_or(std::ptr::null_mut()) as *mut ffi::wxd_EvtHandler_t
+    }
+}
+
+// Paint, size, mouse and keyboard events.
+impl crate::event::WindowEvents for HVScrolledWindow {}
+
+widget_builder!(
+    name: HVScrolledWindow,
+    parent_type: &'a dyn WxWidget,
+    style_type: HVScrolledWindowStyle,
+    fields: {},
+    build_impl: |slf| {
+        let parent_ptr = slf.parent.handle_ptr();
+        unsafe {
+            let ctrl_ptr = ffi::wxd_HVScrolledWindow_Create(
+                parent_ptr,
+                slf.id,
+                slf.pos.x,
+                slf.pos.y,
+                slf.size.width,
+                slf.size.height,
+                slf.style.bits(),
+            );
+            assert!(!ctrl_ptr.is_null(), "wxd_HVScrolledWindow_Create returned null");
+            HVScrolledWindow::from_ptr(ctrl_ptr)
+        }
+    }
+);
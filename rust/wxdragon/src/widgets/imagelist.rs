@@ -1,6 +1,7 @@
 //! ImageList widget wrapper.
 
 use crate::bitmap::Bitmap;
+use crate::bitmap_bundle::AtlasSheet;
 use wxdragon_sys as ffi; // Corrected path: crate::bitmap instead of crate::widgets::bitmap
 
 /// Represents a wxImageList.
@@ -83,6 +84,28 @@ impl ImageList {
         unsafe { ffi::wxd_ImageList_AddWithMask(self.ptr, bitmap.as_const_ptr(), mask.as_const_ptr()) }
     }
 
+    /// Adds the first `count` tiles of `sheet` (row by row) in one call; the tile size must equal
+    /// the list's image size. The sheet is converted to a native bitmap once and sliced, which is
+    /// far cheaper than adding thousands of separately created bitmaps.
+    ///
+    /// Returns the index of the first added image, or -1 if nothing was added.
+    pub fn add_from_atlas(&self, sheet: &AtlasSheet, count: usize) -> i32 {
+        if self.ptr.is_null() || !sheet.holds(count) {
+            return -1;
+        }
+        unsafe {
+            ffi::wxd_ImageList_AddFromAtlas(
+                self.ptr,
+                sheet.rgba.as_ptr(),
+                sheet.size.width,
+                sheet.size.height,
+                sheet.tile_size.width,
+                sheet.tile_size.height,
+                count as i32,
+            )
+        }
+    }
+
     /// Returns the number of images in the list.
     pub fn get_image_count(&self) -> i32 {
         if self.ptr.is_null() {
@@ -0,0 +1,165 @@
+//! Lazily built pages for book controls ([`Notebook`], [`Treebook`], [`SimpleBook`] and
+//! `AuiNotebook`).
+//!
+//! A lazy page starts as an empty placeholder [`Panel`] identified by a key; its content is
+//! built by the book's factory the first time the page is about to be shown. With a
+//! [`LazyPageBudget`], pages that have not been viewed for a while are emptied again and rebuilt
+//! on their next visit.
+//!
+//! ```rust,no_run
+//! use std::time::Duration;
+//! use wxdragon::prelude::*;
+//!
+//! # fn build(notebook: &Notebook) {
+//! notebook.enable_lazy_pages(
+//!     |_key, page| {
+//!         // Only runs when the tab is first selected; a single child fills the page.
+//!         let grid = Grid::builder(page).build();
+//!         grid.create_grid(1000, 20, GridSelectionMode::Cells);
+//!     },
+//!     LazyPageBudget { max_realized_pages: 8, min_idle: Duration::from_secs(60) },
+//! );
+//! for i in 0..40 {
+//!     notebook.add_lazy_page(&format!("Sheet {i}"), i, false, None);
+//! }
+//! # }
+//! ```
+
+use crate::widgets::notebook::Notebook;
+use crate::widgets::panel::Panel;
+use crate::widgets::simplebook::SimpleBook;
+use crate::widgets::treebook::Treebook;
+use crate::window::WxWidget;
+use std::ffi::CString;
+use std::os::raw::c_void;
+use std::panic::{self, AssertUnwindSafe};
+use std::time::Duration;
+use wxdragon_sys as ffi;
+
+/// Limits how many lazy pages keep their content, for [`LazyBookCtrl::enable_lazy_pages`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub struct LazyPageBudget {
+    /// Lazy pages allowed to hold content at once; 0 keeps every built page.
+    pub max_realized_pages: usize,
+    /// Pages viewed more recently than this are kept even over the budget.
+    pub min_idle: Duration,
+}
+
+type LazyPageFactory = Box<dyn Fn(i64, &Panel)>;
+
+/// Lazy page support shared by all book controls.
+pub trait LazyBookCtrl: WxWidget {
+    /// Turns on lazy pages. `factory` builds the content of page `key` as children of the given
+    /// placeholder panel; if it creates a single child and sets no sizer, that child fills the
+    /// page. It runs again for pages emptied under `budget`. Replaces any previous factory.
+    fn enable_lazy_pages<F>(&self, factory: F, budget: LazyPageBudget) -> bool
+    where
+        F: Fn(i64, &Panel) + 'static,
+    {
+        let ptr = self.handle_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        let raw = Box::into_raw(Box::new(Box::new(factory) as LazyPageFactory));
+        let min_idle = budget.min_idle.as_millis().min(i32::MAX as u128) as i32;
+        let result = unsafe {
+            ffi::wxd_BookCtrl_EnableLazyPages(
+                ptr,
+                raw as *mut c_void,
+                Some(lazy_book_build_page),
+                Some(lazy_book_drop_factory),
+                budget.max_realized_pages,
+                min_idle,
+            )
+        };
+        if !result {
+            unsafe { drop(Box::from_raw(raw)) };
+        }
+        result
+    }
+
+    /// Turns lazy pages off; pages that are still placeholders stay empty until
+    /// [`realize_lazy_page`](Self::realize_lazy_page) would have built them.
+    fn disable_lazy_pages(&self) {
+        let ptr = self.handle_ptr();
+        if !ptr.is_null() {
+            unsafe { ffi::wxd_BookCtrl_DisableLazyPages(ptr) }
+        }
+    }
+
+    /// Appends a lazy page identified by `key` and returns its placeholder. Requires
+    /// [`enable_lazy_pages`](Self::enable_lazy_pages).
+    fn add_lazy_page(&self, text: &str, key: i64, select: bool, image_id: Option<i32>) -> Option<Panel> {
+        self.insert_lazy_page(usize::MAX, text, key, select, image_id)
+    }
+
+    /// Inserts a lazy page at `index` (appending past the end) and returns its placeholder.
+    fn insert_lazy_page(&self, index: usize, text: &str, key: i64, select: bool, image_id: Option<i32>) -> Option<Panel> {
+        let ptr = self.handle_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        let c_text = CString::new(text).unwrap_or_default();
+        let page = unsafe { ffi::wxd_BookCtrl_InsertLazyPage(ptr, index, c_text.as_ptr(), select, image_id.unwrap_or(-1), key) };
+        if page.is_null() {
+            None
+        } else {
+            Some(unsafe { Panel::from_ptr(page as *mut ffi::wxd_Panel_t) })
+        }
+    }
+
+    /// Builds the lazy page at `index` now. Needed before `change_selection`, which sends no
+    /// page-changing event. Returns `false` if the page is not lazy.
+    fn realize_lazy_page(&self, index: usize) -> bool {
+        let ptr = self.handle_ptr();
+        !ptr.is_null() && unsafe { ffi::wxd_BookCtrl_RealizeLazyPage(ptr, index) }
+    }
+
+    /// Destroys the content of the lazy page at `index`; it is rebuilt when next shown.
+    fn unload_lazy_page(&self, index: usize) -> bool {
+        let ptr = self.handle_ptr();
+        !ptr.is_null() && unsafe { ffi::wxd_BookCtrl_UnloadLazyPage(ptr, index) }
+    }
+
+    /// `Some(true)` if the lazy page at `index` has content, `Some(false)` if it is still a
+    /// placeholder, `None` if it is not a lazy page.
+    fn is_lazy_page_realized(&self, index: usize) -> Option<bool> {
+        let ptr = self.handle_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        match unsafe { ffi::wxd_BookCtrl_GetLazyPageState(ptr, index) } {
+            0 => Some(false),
+            1 => Some(true),
+            _ => None,
+        }
+    }
+
+    /// The key of the lazy page at `index`.
+    fn lazy_page_key(&self, index: usize) -> Option<i64> {
+        let ptr = self.handle_ptr();
+        let mut key = 0i64;
+        (!ptr.is_null() && unsafe { ffi::wxd_BookCtrl_GetLazyPageKey(ptr, index, &mut key) }).then_some(key)
+    }
+}
+
+impl LazyBookCtrl for Notebook {}
+impl LazyBookCtrl for Treebook {}
+impl LazyBookCtrl for SimpleBook {}
+#[cfg(feature = "aui")]
+impl LazyBookCtrl for crate::widgets::aui_notebook::AuiNotebook {}
+
+unsafe extern "C" fn lazy_book_build_page(userdata: *mut c_void, key: i64, placeholder: *mut ffi::wxd_Window_t) {
+    if userdata.is_null() || placeholder.is_null() {
+        return;
+    }
+    let factory = unsafe { &*(userdata as *const LazyPageFactory) };
+    let page = unsafe { Panel::from_ptr(placeholder as *mut ffi::wxd_Panel_t) };
+    let _ = panic::catch_unwind(AssertUnwindSafe(|| factory(key, &page)));
+}
+
+unsafe extern "C" fn lazy_book_drop_factory(userdata: *mut c_void) {
+    if !userdata.is_null() {
+        unsafe { drop(Box::from_raw(userdata as *mut LazyPageFactory)) };
+    }
+}
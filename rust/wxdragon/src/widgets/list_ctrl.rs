@@ -1,8 +1,10 @@
 //! wxListCtrl wrapper
 
+use crate::color::Colour;
 use crate::event::{Event, EventType, WxEvtHandler};
 use crate::geometry::{Point, Size};
 use crate::id::Id;
+use crate::widgets::dataview::{PackedColumn, PackedStrings};
 use crate::widgets::imagelist::ImageList;
 use crate::widgets::item_data::{HasItemData, get_item_data, remove_item_data, store_item_data};
 use crate::window::{WindowHandle, WxWidget};
@@ -10,6 +12,7 @@ use crate::window::{WindowHandle, WxWidget};
 #[allow(unused_imports)]
 use crate::window::Window;
 use std::any::Any;
+use std::cell::RefCell;
 use std::ffi::{CStr, CString};
 use std::os::raw::{c_char, c_int, c_longlong, c_void};
 use std::panic::{self, AssertUnwindSafe};
@@ -20,6 +23,92 @@ struct ListCtrlVirtualTextCallback {
     callback: Box<dyn Fn(i64, i32) -> String>,
 }
 
+struct ListCtrlVirtualTextSource {
+    text: Box<dyn Fn(i64, i32, &mut String)>,
+    prefetch: Option<Box<dyn Fn(i64, i64)>>,
+    // Reused for every cell; the control copies the text out before asking for the next one.
+    scratch: RefCell<String>,
+}
+
+/// Row style returned by a virtual list's attribute callback.
+#[derive(Debug, Copy, Clone, PartialEq, Eq, Default)]
+pub struct ListItemAttr {
+    pub text_colour: Option<Colour>,
+    pub background_colour: Option<Colour>,
+    pub bold: bool,
+    pub italic: bool,
+}
+
+type VirtualAttrCallback = Box<dyn Fn(i64) -> Option<ListItemAttr>>;
+type VirtualImageCallback = Box<dyn Fn(i64, i32) -> i32>;
+type VirtualCheckedCallback = Box<dyn Fn(i64) -> bool>;
+
+/// One sort key per row, in current row order, for [`ListCtrl::sort_items_by_keys`].
+#[derive(Debug, Clone, PartialEq)]
+pub enum ListSortKeys {
+    Int64(Vec<i64>),
+    /// NaN sorts last in both directions.
+    Double(Vec<f64>),
+    /// Compared bytewise; collate (e.g. fold case) before building the keys.
+    Text(Vec<String>),
+}
+
+impl ListSortKeys {
+    /// Number of keys.
+    pub fn len(&self) -> usize {
+        match self {
+            ListSortKeys::Int64(keys) => keys.len(),
+            ListSortKeys::Double(keys) => keys.len(),
+            ListSortKeys::Text(keys) => keys.len(),
+        }
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+}
+
+/// Optional per-row callbacks of a virtual list, see [`ListCtrl::set_virtual_item_callbacks`].
+#[derive(Default)]
+pub struct VirtualListItemCallbacks {
+    attr: Option<VirtualAttrCallback>,
+    image: Option<VirtualImageCallback>,
+    checked: Option<VirtualCheckedCallback>,
+}
+
+impl VirtualListItemCallbacks {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Style of a row, or `None` for the default look.
+    pub fn with_attr<F>(mut self, f: F) -> Self
+    where
+        F: Fn(i64) -> Option<ListItemAttr> + 'static,
+    {
+        self.attr = Some(Box::new(f));
+        self
+    }
+
+    /// Image list index of a cell (`item`, `column`), or -1 for none.
+    pub fn with_column_image<F>(mut self, f: F) -> Self
+    where
+        F: Fn(i64, i32) -> i32 + 'static,
+    {
+        self.image = Some(Box::new(f));
+        self
+    }
+
+    /// Checkbox state of a row, for lists with checkboxes enabled.
+    pub fn with_checked<F>(mut self, f: F) -> Self
+    where
+        F: Fn(i64) -> bool + 'static,
+    {
+        self.checked = Some(Box::new(f));
+        self
+    }
+}
+
 // --- ListCtrl Styles ---
 widget_style_enum!(
     name: ListCtrlStyle,
@@ -112,6 +201,27 @@ impl ListNextItemFlag {
     }
 }
 
+/// How typed text is matched by the type-ahead index of a list control.
+#[derive(Debug, Copy, Clone, PartialEq, Eq, Default)]
+#[repr(i32)]
+pub enum TypeAheadMode {
+    /// Rows whose text starts with the typed text (binary search in the index).
+    #[default]
+    Prefix = ffi::wxd_TypeAheadMode_WXD_TYPEAHEAD_PREFIX as i32,
+    /// Rows whose text contains the typed text (a scan of the cached texts).
+    Substring = ffi::wxd_TypeAheadMode_WXD_TYPEAHEAD_SUBSTRING as i32,
+}
+
+// Shared by the list controls that support type-ahead.
+pub(crate) fn type_ahead_find(ctrl: *mut ffi::wxd_Window_t, text: &str, start_row: usize, mode: TypeAheadMode) -> Option<usize> {
+    if ctrl.is_null() {
+        return None;
+    }
+    let text = CString::new(text).ok()?;
+    let row = unsafe { ffi::wxd_TypeAhead_Find(ctrl, text.as_ptr(), start_row as i64, mode as i32) };
+    usize::try_from(row).ok()
+}
+
 /// Events emitted by ListCtrl
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
 pub enum ListCtrlEvent {
@@ -359,6 +469,37 @@ impl ListCtrl {
         unsafe { ffi::wxd_ListCtrl_InsertItemWithImage(ptr, index as c_longlong, c_label.as_ptr(), img_idx) }
     }
 
+    /// Inserts many report rows at `index` in one frozen pass.
+    ///
+    /// `cells` holds `cols` cells per row, row-major, with column 0 as the item label;
+    /// `images`, if given, holds one image index per row. Returns the number of items inserted,
+    /// 0 if the shapes do not match or the control is virtual or destroyed.
+    pub fn insert_items_packed(&self, index: i64, cols: usize, cells: &PackedStrings, images: Option<&[i32]>) -> usize {
+        let ptr = self.listctrl_ptr();
+        if ptr.is_null() || cols == 0 || cells.len() % cols != 0 {
+            return 0;
+        }
+        let rows = cells.len() / cols;
+        if images.is_some_and(|images| images.len() != rows) {
+            return 0;
+        }
+        let PackedColumn::Str { bytes, offsets } = cells.column() else {
+            return 0;
+        };
+        let inserted = unsafe {
+            ffi::wxd_ListCtrl_InsertItemsPacked(
+                ptr,
+                index,
+                rows as i64,
+                cols as c_int,
+                bytes.as_ptr() as *const c_char,
+                offsets.as_ptr(),
+                images.map_or(std::ptr::null(), <[i32]>::as_ptr),
+            )
+        };
+        inserted.max(0) as usize
+    }
+
     /// Sets the text of an item (label in column 0).
     /// No-op if the list control has been destroyed.
     pub fn set_item_text(&self, index: i64, text: &str) {
@@ -796,6 +937,35 @@ impl ListCtrl {
         unsafe { ffi::wxd_ListCtrl_RefreshItems(ptr, item_from as c_longlong, item_to as c_longlong) }
     }
 
+    /// Enables type-to-find on `column`: typed text selects, focuses and scrolls to the next
+    /// matching row.
+    ///
+    /// Matching runs against an index built on first use from the item texts (through the
+    /// virtual text callback for virtual lists) and patched by
+    /// [`refresh_item`](Self::refresh_item), [`refresh_items`](Self::refresh_items) and
+    /// `set_item_text`; a changed item count rebuilds it. Returns false if the control is gone.
+    pub fn enable_type_ahead(&self, column: usize, mode: TypeAheadMode) -> bool {
+        let ptr = self.listctrl_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        unsafe { ffi::wxd_ListCtrl_EnableTypeAhead(ptr, column as i32, mode as i32) }
+    }
+
+    /// Removes the type-ahead index.
+    pub fn disable_type_ahead(&self) {
+        let ptr = self.listctrl_ptr();
+        if !ptr.is_null() {
+            unsafe { ffi::wxd_TypeAhead_Disable(ptr as *mut ffi::wxd_Window_t) }
+        }
+    }
+
+    /// Looks up the first row at or after `start_row` (wrapping around) matching `text` in the
+    /// type-ahead index, without changing the selection. `None` without a match or an index.
+    pub fn find_type_ahead(&self, text: &str, start_row: usize, mode: TypeAheadMode) -> Option<usize> {
+        type_ahead_find(self.listctrl_ptr() as *mut ffi::wxd_Window_t, text, start_row, mode)
+    }
+
     /// Sets the callback used by a virtual list control to provide cell text on demand.
     ///
     /// The list control must be created with `ListCtrlStyle::Virtual`. The callback is called
@@ -835,7 +1005,67 @@ impl ListCtrl {
         result
     }
 
-    /// Clears the virtual text callback, if one is registered.
+    /// Sets an allocation-free text source for a virtual list control.
+    ///
+    /// Like [`set_virtual_text_callback`](Self::set_virtual_text_callback), but `text` writes the
+    /// cell into a buffer that is cleared and reused for every cell, so painting a row allocates
+    /// nothing on the Rust side. The two replace each other.
+    ///
+    /// Returns `false` if the list control has been destroyed or was not created by wxDragon.
+    pub fn set_virtual_text_source<F>(&self, text: F) -> bool
+    where
+        F: Fn(i64, i32, &mut String) + 'static,
+    {
+        self.install_virtual_text_source(Box::new(text), None)
+    }
+
+    /// Like [`set_virtual_text_source`](Self::set_virtual_text_source), and also calls
+    /// `prefetch(from, to)` with the inclusive row range the control is about to paint, before
+    /// asking for its cells, so a backing store can load the band in one go.
+    pub fn set_virtual_text_source_with_prefetch<F, P>(&self, text: F, prefetch: P) -> bool
+    where
+        F: Fn(i64, i32, &mut String) + 'static,
+        P: Fn(i64, i64) + 'static,
+    {
+        self.install_virtual_text_source(Box::new(text), Some(Box::new(prefetch)))
+    }
+
+    fn install_virtual_text_source(
+        &self,
+        text: Box<dyn Fn(i64, i32, &mut String)>,
+        prefetch: Option<Box<dyn Fn(i64, i64)>>,
+    ) -> bool {
+        let ptr = self.listctrl_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+
+        let has_prefetch = prefetch.is_some();
+        let raw_source = Box::into_raw(Box::new(ListCtrlVirtualTextSource {
+            text,
+            prefetch,
+            scratch: RefCell::new(String::new()),
+        }));
+        let result = unsafe {
+            ffi::wxd_ListCtrl_SetVirtualTextSource(
+                ptr,
+                raw_source as *mut c_void,
+                Some(listctrl_virtual_text_source),
+                if has_prefetch { Some(listctrl_virtual_prefetch) } else { None },
+                Some(listctrl_drop_virtual_text_source),
+            )
+        };
+
+        if !result {
+            unsafe {
+                drop(Box::from_raw(raw_source));
+            }
+        }
+
+        result
+    }
+
+    /// Clears the virtual text callback or text source, if one is registered.
     pub fn clear_virtual_text_callback(&self) {
         let ptr = self.listctrl_ptr();
         if ptr.is_null() {
@@ -844,6 +1074,99 @@ impl ListCtrl {
         unsafe { ffi::wxd_ListCtrl_ClearVirtualTextCallback(ptr) }
     }
 
+    /// Installs style, image and checkbox callbacks for a virtual list control, so rows can
+    /// be coloured and show icons without holding items in memory.
+    ///
+    /// Rows returning the same [`ListItemAttr`] share one native attribute from a small pool.
+    /// Replaces callbacks installed before. Returns `false` if the list control has been
+    /// destroyed or was not created by wxDragon.
+    pub fn set_virtual_item_callbacks(&self, callbacks: VirtualListItemCallbacks) -> bool {
+        let ptr = self.listctrl_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+
+        let attr = callbacks.attr.is_some().then_some(listctrl_virtual_attr_callback as _);
+        let image = callbacks.image.is_some().then_some(listctrl_virtual_image_callback as _);
+        let checked = callbacks.checked.is_some().then_some(listctrl_virtual_checked_callback as _);
+        let raw_callbacks = Box::into_raw(Box::new(callbacks));
+        let result = unsafe {
+            ffi::wxd_ListCtrl_SetVirtualItemCallbacks(
+                ptr,
+                raw_callbacks as *mut c_void,
+                attr,
+                image,
+                checked,
+                Some(listctrl_drop_virtual_item_callbacks),
+            )
+        };
+
+        if !result {
+            unsafe {
+                drop(Box::from_raw(raw_callbacks));
+            }
+        }
+
+        result
+    }
+
+    /// Clears the callbacks installed by [`set_virtual_item_callbacks`](Self::set_virtual_item_callbacks).
+    pub fn clear_virtual_item_callbacks(&self) {
+        let ptr = self.listctrl_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_ListCtrl_ClearVirtualItemCallbacks(ptr) }
+    }
+
+    /// Sorts a non-virtual list by one precomputed key per row, without calling back into Rust
+    /// for each comparison. The sort is stable and item data moves with the rows.
+    ///
+    /// Returns `false` if `keys` does not hold exactly one key per item, the control is virtual
+    /// or has been destroyed.
+    pub fn sort_items_by_keys(&self, keys: &ListSortKeys, ascending: bool) -> bool {
+        let ptr = self.listctrl_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        let mut raw = ffi::wxd_ListSortKeys {
+            kind: 0,
+            int_keys: std::ptr::null(),
+            double_keys: std::ptr::null(),
+            text: std::ptr::null(),
+            text_offsets: std::ptr::null(),
+        };
+        // Packed UTF-8 keys; must outlive the call.
+        let mut bytes = String::new();
+        let mut offsets: Vec<u32> = Vec::new();
+        match keys {
+            ListSortKeys::Int64(keys) => {
+                raw.kind = ffi::wxd_ListSortKeyKind_WXD_LIST_SORT_KEY_INT64 as c_int;
+                raw.int_keys = keys.as_ptr();
+            }
+            ListSortKeys::Double(keys) => {
+                raw.kind = ffi::wxd_ListSortKeyKind_WXD_LIST_SORT_KEY_DOUBLE as c_int;
+                raw.double_keys = keys.as_ptr();
+            }
+            ListSortKeys::Text(keys) => {
+                bytes.reserve(keys.iter().map(String::len).sum());
+                offsets.reserve(keys.len() + 1);
+                offsets.push(0);
+                for key in keys {
+                    bytes.push_str(key);
+                    let Ok(end) = u32::try_from(bytes.len()) else {
+                        return false;
+                    };
+                    offsets.push(end);
+                }
+                raw.kind = ffi::wxd_ListSortKeyKind_WXD_LIST_SORT_KEY_UTF8 as c_int;
+                raw.text = bytes.as_ptr() as *const c_char;
+                raw.text_offsets = offsets.as_ptr();
+            }
+        }
+        unsafe { ffi::wxd_ListCtrl_SortItemsByKeys(ptr, &raw, keys.len() as i64, ascending) }
+    }
+
     // --- ImageList Methods ---
 
     /// Sets the image list for the control.
@@ -1088,6 +1411,105 @@ unsafe extern "C" fn listctrl_drop_virtual_text_callback(userdata: *mut c_void)
     }
 }
 
+unsafe extern "C" fn listctrl_virtual_text_source(
+    userdata: *mut c_void,
+    item: i64,
+    col: i32,
+    text: *mut *const c_char,
+    len: *mut usize,
+) -> bool {
+    if userdata.is_null() || text.is_null() || len.is_null() {
+        return false;
+    }
+    let source = unsafe { &*(userdata as *const ListCtrlVirtualTextSource) };
+    let Ok(mut scratch) = source.scratch.try_borrow_mut() else {
+        return false;
+    };
+    scratch.clear();
+    if panic::catch_unwind(AssertUnwindSafe(|| (source.text)(item, col, &mut scratch))).is_err() || scratch.is_empty() {
+        return false;
+    }
+    // Stays valid until the next call: the buffer is only touched from here.
+    unsafe {
+        *text = scratch.as_ptr() as *const c_char;
+        *len = scratch.len();
+    }
+    true
+}
+
+unsafe extern "C" fn listctrl_virtual_prefetch(userdata: *mut c_void, from: i64, to: i64) {
+    if userdata.is_null() {
+        return;
+    }
+    let source = unsafe { &*(userdata as *const ListCtrlVirtualTextSource) };
+    if let Some(prefetch) = &source.prefetch {
+        let _ = panic::catch_unwind(AssertUnwindSafe(|| prefetch(from, to)));
+    }
+}
+
+unsafe extern "C" fn listctrl_drop_virtual_text_source(userdata: *mut c_void) {
+    if !userdata.is_null() {
+        unsafe {
+            let _ = Box::from_raw(userdata as *mut ListCtrlVirtualTextSource);
+        }
+    }
+}
+
+unsafe extern "C" fn listctrl_virtual_attr_callback(userdata: *mut c_void, item: i64, attr: *mut ffi::wxd_ListItemAttr) -> bool {
+    if userdata.is_null() || attr.is_null() {
+        return false;
+    }
+    let callbacks = unsafe { &*(userdata as *const VirtualListItemCallbacks) };
+    let Some(callback) = callbacks.attr.as_ref() else {
+        return false;
+    };
+    let Ok(Some(style)) = panic::catch_unwind(AssertUnwindSafe(|| callback(item))) else {
+        return false;
+    };
+    let out = unsafe { &mut *attr };
+    if let Some(colour) = style.text_colour {
+        out.has_text_colour = true;
+        out.text_colour = colour.into();
+    }
+    if let Some(colour) = style.background_colour {
+        out.has_bg_colour = true;
+        out.bg_colour = colour.into();
+    }
+    out.bold = style.bold;
+    out.italic = style.italic;
+    true
+}
+
+unsafe extern "C" fn listctrl_virtual_image_callback(userdata: *mut c_void, item: i64, col: i32) -> i32 {
+    if userdata.is_null() {
+        return -1;
+    }
+    let callbacks = unsafe { &*(userdata as *const VirtualListItemCallbacks) };
+    match callbacks.image.as_ref() {
+        Some(callback) => panic::catch_unwind(AssertUnwindSafe(|| callback(item, col))).unwrap_or(-1),
+        None => -1,
+    }
+}
+
+unsafe extern "C" fn listctrl_virtual_checked_callback(userdata: *mut c_void, item: i64) -> bool {
+    if userdata.is_null() {
+        return false;
+    }
+    let callbacks = unsafe { &*(userdata as *const VirtualListItemCallbacks) };
+    match callbacks.checked.as_ref() {
+        Some(callback) => panic::catch_unwind(AssertUnwindSafe(|| callback(item))).unwrap_or(false),
+        None => false,
+    }
+}
+
+unsafe extern "C" fn listctrl_drop_virtual_item_callbacks(userdata: *mut c_void) {
+    if !userdata.is_null() {
+        unsafe {
+            let _ = Box::from_raw(userdata as *mut VirtualListItemCallbacks);
+        }
+    }
+}
+
 fn string_to_c_ptr(text: String) -> *mut c_char {
     match CString::new(text) {
         Ok(c_string) => c_string.into_raw(),
@@ -83,6 +83,33 @@ impl ListBox {
         }
     }
 
+    /// Replaces all items with `items` in a single native call, which is much faster than
+    /// clearing and appending one by one for long lists.
+    /// No-op if the listbox has been destroyed.
+    pub fn set_items<S: AsRef<str>>(&self, items: &[S]) {
+        let ptr = self.listbox_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        let (packed, offsets) = crate::dc::pack_utf8(items.iter().map(|s| s.as_ref()));
+        unsafe {
+            ffi::wxd_ListBox_SetItems(ptr, packed.as_ptr() as *const _, offsets.as_ptr(), items.len());
+        }
+    }
+
+    /// Appends `items` in a single native call.
+    /// No-op if the listbox has been destroyed.
+    pub fn append_items<S: AsRef<str>>(&self, items: &[S]) {
+        let ptr = self.listbox_ptr();
+        if ptr.is_null() || items.is_empty() {
+            return;
+        }
+        let (packed, offsets) = crate::dc::pack_utf8(items.iter().map(|s| s.as_ref()));
+        unsafe {
+            ffi::wxd_ListBox_AppendItems(ptr, packed.as_ptr() as *const _, offsets.as_ptr(), items.len());
+        }
+    }
+
     /// Clears all items from the listbox.
     /// No-op if the listbox has been destroyed.
     pub fn clear(&self) {
@@ -292,9 +319,7 @@ widget_builder!(
         let list_box = unsafe { ListBox::from_ptr(ctrl_ptr) };
 
         // Append initial choices if any
-        for choice_str in &slf.choices {
-            list_box.append(choice_str);
-        }
+        list_box.append_items(&slf.choices);
 
         list_box
     }
@@ -15,6 +15,7 @@ pub mod bitmap_combobox;
 pub mod bitmaptogglebutton;
 pub mod button;
 pub mod calendar_ctrl;
+pub mod canvas;
 pub mod checkbox;
 pub mod checklistbox;
 pub mod choice;
@@ -22,6 +23,7 @@ pub mod collapsible_pane;
 pub mod colour_picker_ctrl;
 pub mod combobox;
 pub mod command_link_button;
+pub mod completion_index;
 pub mod dataview;
 pub mod date_picker_ctrl;
 pub mod dir_picker_ctrl;
@@ -32,9 +34,18 @@ pub mod font_picker_ctrl;
 pub mod frame;
 pub mod gauge;
 pub mod generic_static_bitmap;
+#[cfg(feature = "opengl")]
+pub mod gl_canvas;
 pub mod grid;
+pub mod grid_editor;
+pub mod grid_ingest;
+pub mod grid_renderer;
+pub mod grid_style;
+pub mod grid_table;
+pub mod hv_scrolled_window;
 pub mod hyperlink_ctrl;
 pub mod item_data;
+pub mod lazy_book;
 pub mod list_ctrl;
 pub mod listbox;
 pub mod mdi_child_frame;
@@ -66,6 +77,7 @@ pub mod staticbox;
 pub mod statusbar;
 #[cfg(feature = "stc")]
 pub mod styledtextctrl;
+pub mod table_export;
 pub mod taskbar_icon;
 pub mod textctrl;
 pub mod time_picker_ctrl;
@@ -75,6 +87,7 @@ pub mod treebook;
 pub mod treectrl;
 pub mod treelistctrl;
 pub mod virtual_list;
+pub mod vlistbox;
 #[cfg(feature = "webview")]
 pub mod webview;
 
@@ -97,9 +110,9 @@ pub use time_picker_ctrl::{TimePickerCtrl, TimePickerCtrlBuilder, TimePickerCtrl
 
 // Re-export the main widget types and builders for convenience
 pub use activity_indicator::{ActivityIndicator, ActivityIndicatorBuilder};
-pub use animation_ctrl::{AnimationCtrl, AnimationCtrlBuilder};
+pub use animation_ctrl::{Animation, AnimationCtrl, AnimationCtrlBuilder};
 #[cfg(feature = "aui")]
-pub use aui_manager::{AuiManager, AuiPaneInfo, DockDirection};
+pub use aui_manager::{AuiManager, AuiPaneChange, AuiPaneInfo, DockDirection};
 #[cfg(feature = "aui")]
 pub use aui_mdi_child_frame::*;
 #[cfg(feature = "aui")]
@@ -112,7 +125,8 @@ pub use bitmap_button::{BitmapButton, BitmapButtonBuilder};
 pub use bitmap_combobox::{BitmapComboBox, BitmapComboBoxBuilder};
 pub use bitmaptogglebutton::{BitmapToggleButton, BitmapToggleButtonBuilder, BitmapToggleButtonStyle};
 pub use button::{Button, ButtonBuilder};
-pub use calendar_ctrl::{CalendarCtrl, CalendarCtrlBuilder};
+pub use calendar_ctrl::{CalendarCtrl, CalendarCtrlBuilder, CalendarDateBorder, CalendarDayAttr};
+pub use canvas::{Canvas, CanvasBuilder, CanvasStyle};
 pub use checkbox::{CheckBox, CheckBoxBuilder};
 pub use checklistbox::{CheckListBox, CheckListBoxBuilder};
 pub use choice::{Choice, ChoiceBuilder};
@@ -120,6 +134,7 @@ pub use collapsible_pane::{CollapsiblePane, CollapsiblePaneBuilder, CollapsibleP
 pub use colour_picker_ctrl::{ColourPickerCtrl, ColourPickerCtrlBuilder};
 pub use combobox::{ComboBox, ComboBoxBuilder};
 pub use command_link_button::{CommandLinkButton, CommandLinkButtonBuilder};
+pub use completion_index::CompletionIndex;
 pub use dataview::{
     DataViewAlign, DataViewCellMode, DataViewColumn, DataViewCtrl, DataViewCtrlBuilder, DataViewListCtrl,
     DataViewListCtrlBuilder, DataViewListModel, DataViewModel, DataViewStyle, DataViewTreeCtrl, DataViewTreeCtrlBuilder, Variant,
@@ -128,13 +143,22 @@ pub use font_picker_ctrl::{FontPickerCtrl, FontPickerCtrlBuilder, FontPickerCtrl
 pub use frame::{Frame, FrameBuilder};
 pub use gauge::{Gauge, GaugeBuilder};
 pub use grid::{
-    CellSpan, Grid, GridBlockCoords, GridBuilder, GridCellCoords, GridEvent, GridEventData, GridSelectionMode, GridStyle,
-    TabBehaviour,
+    CellSpan, Grid, GridAutoSizeSample, GridBlockCoords, GridBuilder, GridCellCoords, GridEvent, GridEventData,
+    GridSelectionMode, GridSelectionRange, GridStyle, TabBehaviour,
 };
+pub use grid_editor::{GridCellEditHandler, GridCellEditor};
+pub use grid_ingest::{GridIngest, GridIngestOptions};
+pub use grid_renderer::{GridCellPainter, GridCellRenderer, GridRenderCell};
+pub use grid_style::GridCellStyle;
+pub use grid_table::{GridCellAttrSpec, GridTable, GridValueType};
 // GenericStaticBitmap is mainly for internal use by the platform-aware XRC handler
 pub use generic_static_bitmap::{GenericStaticBitmap, GenericStaticBitmapBuilder};
+#[cfg(feature = "opengl")]
+pub use gl_canvas::{GLAttributes, GLCanvas, GLCanvasBuilder, GLCanvasStyle, GLContext, NativeWindowHandle};
+pub use hv_scrolled_window::{HVScrolledWindow, HVScrolledWindowBuilder, HVScrolledWindowStyle};
 pub use hyperlink_ctrl::{HyperlinkCtrl, HyperlinkCtrlBuilder};
-pub use list_ctrl::{ListCtrl, ListCtrlBuilder};
+pub use lazy_book::{LazyBookCtrl, LazyPageBudget};
+pub use list_ctrl::{ListCtrl, ListCtrlBuilder, ListItemAttr, ListSortKeys, TypeAheadMode, VirtualListItemCallbacks};
 pub use listbox::{ListBox, ListBoxBuilder};
 pub use mdi_child_frame::{MDIChildFrame, MDIChildFrameBuilder};
 pub use mdi_parent_frame::{MDIParentFrame, MDIParentFrameBuilder};
@@ -144,7 +168,7 @@ pub use notebook::{Notebook, NotebookBuilder};
 pub use panel::{Panel, PanelBuilder};
 pub use property_grid::{
     Property, PropertyChoice, PropertyGrid, PropertyGridBuilder, PropertyGridEvent, PropertyGridEventData, PropertyGridStyle,
-    PropertyId, PropertyKind,
+    PropertyHandle, PropertyId, PropertyKey, PropertyKind,
 };
 pub use radio_button::{RadioButton, RadioButtonBuilder, RadioButtonStyle};
 pub use radiobox::RadioBox;
@@ -152,16 +176,17 @@ pub use rearrangelist::{RearrangeList, RearrangeListEvent, RearrangeListEventDat
 #[cfg(feature = "richtext")]
 pub use richtextctrl::{
     RichTextCtrl, RichTextCtrlBuilder, RichTextCtrlEvent, RichTextCtrlEventData, RichTextCtrlStyle, RichTextFileType,
+    RichTextRunStyle,
 };
 pub use scrollbar::{ScrollBar, ScrollBarBuilder, ScrollBarStyle};
-pub use scrolled_window::{ScrolledWindow, ScrolledWindowBuilder};
+pub use scrolled_window::{ScrolledWindow, ScrolledWindowBuilder, TileRequest};
 pub use search_ctrl::{SearchCtrl, SearchCtrlBuilder};
 pub use simplebook::{SimpleBook, SimpleBookBuilder};
 pub use slider::{Slider, SliderBuilder};
 pub use spinbutton::{SpinButton, SpinButtonBuilder};
 pub use spinctrl::{SpinCtrl, SpinCtrlBuilder};
 pub use spinctrl_double::{SpinCtrlDouble, SpinCtrlDoubleBuilder};
-pub use splitter_window::{SplitterWindow, SplitterWindowBuilder};
+pub use splitter_window::{LiveResizeMode, SplitterWindow, SplitterWindowBuilder};
 pub use static_bitmap::{ScaleMode, StaticBitmap, StaticBitmapBuilder};
 pub use static_line::{StaticLine, StaticLineBuilder, StaticLineStyle};
 pub use static_text::{StaticText, StaticTextBuilder, StaticTextStyle};
@@ -169,26 +194,32 @@ pub use staticbox::{StaticBox, StaticBoxBuilder};
 pub use statusbar::{StatusBar, StatusBarBuilder};
 #[cfg(feature = "stc")]
 pub use styledtextctrl::{
-    EolMode, FindFlags, Lexer, MarginType, MarkerSymbol, SelectionMode, StyledTextCtrl, StyledTextCtrlBuilder,
-    StyledTextCtrlEvent, StyledTextCtrlEventData, StyledTextCtrlStyle, WhiteSpaceView, WrapMode,
+    EolMode, FindAllResult, FindFlags, Lexer, LoadProgress, MarginType, MarkerSymbol, SelectionMode, StcDocument, StyledTextCtrl,
+    StyledTextCtrlBuilder, StyledTextCtrlEvent, StyledTextCtrlEventData, StyledTextCtrlStyle, WhiteSpaceView, WrapMode,
 };
+pub use table_export::TableExportFormat;
 pub use taskbar_icon::{TaskBarIcon, TaskBarIconBuilder, TaskBarIconStyle, TaskBarIconType};
 pub use textctrl::{TextCtrl, TextCtrlBuilder};
 pub use togglebutton::{ToggleButton, ToggleButtonBuilder};
-pub use toolbar::ToolBar;
+pub use toolbar::{ToolBar, ToolDesc};
 pub use treebook::Treebook;
 pub use treebook::TreebookBuilder;
-pub use treectrl::{TreeCtrl, TreeCtrlBuilder};
+pub use treectrl::{
+    LazyTreeChildren, TreeChildHandles, TreeCtrl, TreeCtrlBuilder, TreeItemHandle, TreeNodeOptions, TreeSubtree,
+    TreeSubtreeBuilder, TreeSubtreeNode,
+};
 pub use treelistctrl::{
     CheckboxState, TreeListCtrl, TreeListCtrlBuilder, TreeListCtrlEvent, TreeListCtrlEventData, TreeListCtrlStyle, TreeListItem,
 };
 pub use virtual_list::{VirtualList, VirtualListDataSource, VirtualListItemRenderer, VirtualListLayoutMode};
+pub use vlistbox::{VListBox, VListBoxBuilder, VListBoxEvent, VListBoxStyle};
 
 // Re-export ImageList
 #[cfg(feature = "webview")]
 pub use webview::{
-    WebView, WebViewBackend, WebViewBrowsingDataTypes, WebViewBuilder, WebViewFindFlags, WebViewHandlerResponse,
-    WebViewNavigationError, WebViewReloadFlags, WebViewUserScriptInjectionTime, WebViewZoom, WebViewZoomType,
+    ChannelMessage, ChannelPayload, WebView, WebViewAsset, WebViewAssetData, WebViewBackend, WebViewBrowsingDataTypes,
+    WebViewBuilder, WebViewChannel, WebViewFindFlags, WebViewHandlerResponse, WebViewNavigationError, WebViewReloadFlags,
+    WebViewUserScriptInjectionTime, WebViewZoom, WebViewZoomType,
 };
 
 pub use imagelist::ImageList;
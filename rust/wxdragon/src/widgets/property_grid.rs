@@ -3,7 +3,9 @@
 //! A property grid presents labelled, typed values using editors appropriate
 //! for each value. Properties are addressed by unique string names instead of
 //! native pointers, so deleting a property or clearing the grid cannot leave a
-//! dangling Rust handle.
+//! dangling Rust handle. Properties appended through this binding also get a
+//! [`PropertyHandle`], which resolves without a by-name lookup and simply
+//! stops resolving once the property is gone.
 //!
 //! # Quick start
 //!
@@ -35,9 +37,11 @@ use crate::geometry::{Point, Size};
 use crate::id::Id;
 use crate::widgets::dataview::Variant;
 use crate::window::{WindowHandle, WxWidget};
+use std::cell::RefCell;
+use std::collections::HashMap;
 use std::ffi::{CStr, CString};
 use std::fmt;
-use std::os::raw::c_char;
+use std::os::raw::{c_char, c_void};
 use wxdragon_sys as ffi;
 
 widget_style_enum!(
@@ -119,6 +123,57 @@ impl From<PropertyId> for String {
     }
 }
 
+/// Stable handle to a property appended through this binding.
+///
+/// Handles are opaque tokens rather than native pointers: methods given a
+/// handle look the property up in a table maintained by the native side, so
+/// a handle whose property was deleted or cleared simply stops resolving.
+/// Handles are never reused. Passing a handle instead of a name skips the
+/// by-name lookup, which matters when many properties are refreshed often.
+///
+/// Obtain handles from [`PropertyGrid::append_handle`],
+/// [`PropertyGrid::append_properties`] or [`PropertyGrid::handle`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq, PartialOrd, Ord, Hash)]
+pub struct PropertyHandle(u64);
+
+impl PropertyHandle {
+    fn from_raw(raw: u64) -> Option<Self> {
+        (raw != 0).then_some(Self(raw))
+    }
+
+    /// Returns the raw, non-zero handle value.
+    pub fn as_raw(self) -> u64 {
+        self.0
+    }
+}
+
+/// A way to address a property: its unique name or its [`PropertyHandle`].
+///
+/// Implemented for every `AsRef<str>` type (including [`PropertyId`]) and for
+/// [`PropertyHandle`], so per-property methods accept either.
+pub trait PropertyKey {
+    #[doc(hidden)]
+    fn key(&self) -> KeyRef<'_>;
+}
+
+#[doc(hidden)]
+pub enum KeyRef<'a> {
+    Name(&'a str),
+    Handle(PropertyHandle),
+}
+
+impl<T: AsRef<str> + ?Sized> PropertyKey for T {
+    fn key(&self) -> KeyRef<'_> {
+        KeyRef::Name(self.as_ref())
+    }
+}
+
+impl PropertyKey for PropertyHandle {
+    fn key(&self) -> KeyRef<'_> {
+        KeyRef::Handle(*self)
+    }
+}
+
 /// One labelled numeric entry in an enum or flags property.
 ///
 /// The label is displayed to the user while `value` is stored by wxWidgets.
@@ -579,13 +634,27 @@ impl PropertyGrid {
         self.handle
     }
 
-    /// Returns whether a property with the exact, case-sensitive name exists.
-    pub fn contains(&self, name: impl AsRef<str>) -> bool {
-        let Some(name) = to_cstring(name.as_ref()) else {
-            return false;
-        };
+    /// Returns whether a property with the exact, case-sensitive name, or the given handle, exists.
+    pub fn contains(&self, property: impl PropertyKey) -> bool {
+        self.with_key(
+            property,
+            false,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_Contains(ptr, name) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_ContainsHandle(ptr, handle) },
+        )
+    }
+
+    /// Returns the handle of a property appended through this binding.
+    ///
+    /// Child rows created internally by composite properties have no handle
+    /// and return `None`.
+    pub fn handle(&self, name: impl AsRef<str>) -> Option<PropertyHandle> {
+        let name = to_cstring(name.as_ref())?;
         let ptr = self.property_grid_ptr();
-        !ptr.is_null() && unsafe { ffi::wxd_PropertyGrid_Contains(ptr, name.as_ptr()) }
+        if ptr.is_null() {
+            return None;
+        }
+        PropertyHandle::from_raw(unsafe { ffi::wxd_PropertyGrid_GetPropertyHandle(ptr, name.as_ptr()) })
     }
 
     /// Appends a property and returns its name-based identifier on success.
@@ -609,6 +678,19 @@ impl PropertyGrid {
     /// # });
     /// ```
     pub fn append(&self, property: Property) -> Option<PropertyId> {
+        self.append_impl(&property)?;
+        Some(PropertyId::new(property.name))
+    }
+
+    /// Appends a property and returns its [`PropertyHandle`] on success.
+    ///
+    /// Fails under the same conditions as [`PropertyGrid::append`]. Methods
+    /// given the handle skip the by-name lookup.
+    pub fn append_handle(&self, property: Property) -> Option<PropertyHandle> {
+        self.append_impl(&property)
+    }
+
+    fn append_impl(&self, property: &Property) -> Option<PropertyHandle> {
         let ptr = self.property_grid_ptr();
         if ptr.is_null() || property.name.is_empty() {
             return None;
@@ -658,20 +740,140 @@ impl PropertyGrid {
             }
         };
 
-        appended.then(|| PropertyId::new(property.name))
+        PropertyHandle::from_raw(appended)
     }
 
-    /// Returns an owned copy of a property's value.
+    /// Appends many properties in one native call with the grid frozen.
     ///
-    /// `None` means the widget or property does not exist. An unspecified
-    /// property value is represented by a null [`Variant`].
-    pub fn get_value(&self, name: impl AsRef<str>) -> Option<Variant> {
-        let name = to_cstring(name.as_ref())?;
+    /// Properties are appended in order, so a parent may be an earlier entry
+    /// of the same slice or a property already in the grid. The result holds
+    /// one entry per property, `None` for those that were rejected (a
+    /// duplicate or empty name, or a missing parent).
+    ///
+    /// ```no_run
+    /// # use wxdragon::prelude::*;
+    /// # let _ = wxdragon::main(|_| {
+    /// # let frame = Frame::builder().build();
+    /// let grid = PropertyGrid::builder(&frame).build();
+    /// let handles = grid.append_properties(&[
+    ///     Property::category("Window", "window"),
+    ///     Property::int("Width", "width", 640).under("window"),
+    ///     Property::int("Height", "height", 480).under("window"),
+    /// ]);
+    /// assert!(handles.iter().all(Option::is_some));
+    /// # });
+    /// ```
+    pub fn append_properties(&self, properties: &[Property]) -> Vec<Option<PropertyHandle>> {
         let ptr = self.property_grid_ptr();
-        if ptr.is_null() {
+        if ptr.is_null() || properties.is_empty() {
+            return vec![None; properties.len()];
+        }
+        let schema = encode_schema(properties);
+        let mut raw = vec![0u64; properties.len()];
+        if unsafe { ffi::wxd_PropertyGrid_AppendProperties(ptr, schema.as_ptr(), schema.len(), raw.as_mut_ptr()) } < 0 {
+            return vec![None; properties.len()];
+        }
+        raw.into_iter().map(PropertyHandle::from_raw).collect()
+    }
+
+    /// Appends a category whose children `populate` appends when it is first expanded, so an
+    /// inspector's open time depends on what is shown rather than on everything it could show.
+    ///
+    /// `category` must be a [`Property::category`]; its name and parent apply as usual. The
+    /// category starts collapsed with a disabled placeholder child. It is populated on the
+    /// user's expand as well as by [`PropertyGrid::expand`] and [`PropertyGrid::expand_all`];
+    /// [`PropertyGrid::populate_lazy_category`] populates it without expanding. With
+    /// `release_when_collapsed`, collapsing it deletes its children again (their handles stop
+    /// resolving) and the next expand calls `populate` anew. `populate` must not delete the
+    /// category itself.
+    ///
+    /// ```no_run
+    /// # use wxdragon::prelude::*;
+    /// # let _ = wxdragon::main(|_| {
+    /// # let frame = Frame::builder().build();
+    /// let grid = PropertyGrid::builder(&frame).build();
+    /// grid.append_lazy_category(Property::category("Advanced", "advanced"), true, |grid, _| {
+    ///     grid.append_properties(&[
+    ///         Property::int("Threads", "threads", 4).under("advanced"),
+    ///         Property::boolean("Verbose", "verbose", false).under("advanced"),
+    ///     ]);
+    /// });
+    /// # });
+    /// ```
+    pub fn append_lazy_category<F>(&self, category: Property, release_when_collapsed: bool, populate: F) -> Option<PropertyHandle>
+    where
+        F: FnMut(&PropertyGrid, PropertyHandle) + 'static,
+    {
+        let ptr = self.property_grid_ptr();
+        if ptr.is_null() || category.name.is_empty() || !matches!(category.kind, PropertyKind::Category) {
             return None;
         }
-        let value = unsafe { ffi::wxd_PropertyGrid_GetValue(ptr, name.as_ptr()) };
+        let label = to_cstring(&category.label)?;
+        let name = to_cstring(&category.name)?;
+        let parent = match category.parent.as_deref() {
+            Some(parent) => Some(to_cstring(parent)?),
+            None => None,
+        };
+        let parent_ptr = parent.as_ref().map_or(std::ptr::null(), |value| value.as_ptr());
+
+        let grid = *self;
+        let mut populate = populate;
+        let callback: Box<RefCell<LazyCategoryCallback>> =
+            Box::new(RefCell::new(Box::new(move |handle| populate(&grid, handle))));
+        let user_data = Box::into_raw(callback) as *mut c_void;
+        let appended = unsafe {
+            ffi::wxd_PropertyGrid_AppendLazyCategory(
+                ptr,
+                parent_ptr,
+                label.as_ptr(),
+                name.as_ptr(),
+                Some(populate_lazy_category),
+                user_data,
+                Some(free_lazy_category),
+                release_when_collapsed,
+            )
+        };
+        if appended == 0 {
+            unsafe { free_lazy_category(user_data) };
+        }
+        PropertyHandle::from_raw(appended)
+    }
+
+    /// Populates a lazy category now if it is still pending, without expanding it, e.g. before
+    /// searching its properties or while categories are hidden. Returns `false` if the property
+    /// is not a lazy category.
+    pub fn populate_lazy_category(&self, property: impl PropertyKey) -> bool {
+        self.call_key_bool(
+            property,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_PopulateLazyCategory(ptr, name) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_PopulateLazyCategoryByHandle(ptr, handle) },
+        )
+    }
+
+    /// Sets many values without validation or change events and repaints once.
+    ///
+    /// Returns how many of the handles resolved and accepted their value.
+    pub fn set_values(&self, values: &[(PropertyHandle, &Variant)]) -> usize {
+        let ptr = self.property_grid_ptr();
+        if ptr.is_null() || values.is_empty() {
+            return 0;
+        }
+        let handles: Vec<u64> = values.iter().map(|(handle, _)| handle.0).collect();
+        let variants: Vec<*const ffi::wxd_Variant_t> = values.iter().map(|(_, value)| value.as_const_ptr()).collect();
+        unsafe { ffi::wxd_PropertyGrid_SetValues(ptr, handles.as_ptr(), variants.as_ptr(), values.len()) }
+    }
+
+    /// Returns an owned copy of a property's value.
+    ///
+    /// `None` means the widget or property does not exist. An unspecified
+    /// property value is represented by a null [`Variant`].
+    pub fn get_value(&self, property: impl PropertyKey) -> Option<Variant> {
+        let value = self.with_key(
+            property,
+            std::ptr::null_mut(),
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_GetValue(ptr, name) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_GetValueByHandle(ptr, handle) },
+        );
         (!value.is_null()).then(|| Variant::from(value))
     }
 
@@ -680,12 +882,13 @@ impl PropertyGrid {
     /// Returns `false` when the widget or named property does not exist. The
     /// caller is responsible for supplying a value compatible with the
     /// property's kind.
-    pub fn set_value(&self, name: impl AsRef<str>, value: &Variant) -> bool {
-        let Some(name) = to_cstring(name.as_ref()) else {
-            return false;
-        };
-        let ptr = self.property_grid_ptr();
-        !ptr.is_null() && unsafe { ffi::wxd_PropertyGrid_SetValue(ptr, name.as_ptr(), value.as_const_ptr()) }
+    pub fn set_value(&self, property: impl PropertyKey, value: &Variant) -> bool {
+        let value = value.as_const_ptr();
+        self.call_key_bool(
+            property,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_SetValue(ptr, name, value) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_SetValueByHandle(ptr, handle, value) },
+        )
     }
 
     /// Converts and sets a value without validation or change events.
@@ -702,85 +905,106 @@ impl PropertyGrid {
     /// assert!(grid.set("width", 800_i64));
     /// # });
     /// ```
-    pub fn set<V: Into<Variant>>(&self, name: impl AsRef<str>, value: V) -> bool {
+    pub fn set<V: Into<Variant>>(&self, property: impl PropertyKey, value: V) -> bool {
         let value = value.into();
-        self.set_value(name, &value)
+        self.set_value(property, &value)
     }
 
     /// Sets a value through validation and emits changing/changed events.
     ///
     /// Returns whether wxWidgets accepted the proposed value. A handler
     /// registered with [`PropertyGrid::on_changing`] may veto the update.
-    pub fn change_value(&self, name: impl AsRef<str>, value: &Variant) -> bool {
-        let Some(name) = to_cstring(name.as_ref()) else {
-            return false;
-        };
-        let ptr = self.property_grid_ptr();
-        !ptr.is_null() && unsafe { ffi::wxd_PropertyGrid_ChangeValue(ptr, name.as_ptr(), value.as_const_ptr()) }
+    pub fn change_value(&self, property: impl PropertyKey, value: &Variant) -> bool {
+        let value = value.as_const_ptr();
+        self.call_key_bool(
+            property,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_ChangeValue(ptr, name, value) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_ChangeValueByHandle(ptr, handle, value) },
+        )
     }
 
     /// Converts a value, validates it, and emits changing/changed events.
-    pub fn change<V: Into<Variant>>(&self, name: impl AsRef<str>, value: V) -> bool {
+    pub fn change<V: Into<Variant>>(&self, property: impl PropertyKey, value: V) -> bool {
         let value = value.into();
-        self.change_value(name, &value)
+        self.change_value(property, &value)
     }
 
     /// Marks a property's value as unspecified/null.
     ///
     /// Returns `false` when the widget or property does not exist.
-    pub fn clear_value(&self, name: impl AsRef<str>) -> bool {
-        self.call_name_bool(name, |ptr, name| unsafe { ffi::wxd_PropertyGrid_ClearValue(ptr, name) })
+    pub fn clear_value(&self, property: impl PropertyKey) -> bool {
+        self.call_key_bool(
+            property,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_ClearValue(ptr, name) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_ClearValueByHandle(ptr, handle) },
+        )
     }
 
     /// Returns the value formatted exactly as the property displays it.
-    pub fn get_value_as_string(&self, name: impl AsRef<str>) -> Option<String> {
-        let name = to_cstring(name.as_ref())?;
-        let ptr = self.property_grid_ptr();
-        if ptr.is_null() {
-            return None;
-        }
-        read_ffi_string(|out, out_len| unsafe { ffi::wxd_PropertyGrid_GetValueAsString(ptr, name.as_ptr(), out, out_len) })
+    pub fn get_value_as_string(&self, property: impl PropertyKey) -> Option<String> {
+        self.with_key(
+            property,
+            None,
+            |ptr, name| {
+                read_ffi_string(|out, out_len| unsafe { ffi::wxd_PropertyGrid_GetValueAsString(ptr, name, out, out_len) })
+            },
+            |ptr, handle| {
+                read_ffi_string(|out, out_len| unsafe {
+                    ffi::wxd_PropertyGrid_GetValueAsStringByHandle(ptr, handle, out, out_len)
+                })
+            },
+        )
     }
 
     /// Returns a property's user-facing label.
-    pub fn get_label(&self, name: impl AsRef<str>) -> Option<String> {
-        let name = to_cstring(name.as_ref())?;
-        let ptr = self.property_grid_ptr();
-        if ptr.is_null() {
-            return None;
-        }
-        read_ffi_string(|out, out_len| unsafe { ffi::wxd_PropertyGrid_GetLabel(ptr, name.as_ptr(), out, out_len) })
+    pub fn get_label(&self, property: impl PropertyKey) -> Option<String> {
+        self.with_key(
+            property,
+            None,
+            |ptr, name| read_ffi_string(|out, out_len| unsafe { ffi::wxd_PropertyGrid_GetLabel(ptr, name, out, out_len) }),
+            |ptr, handle| {
+                read_ffi_string(|out, out_len| unsafe { ffi::wxd_PropertyGrid_GetLabelByHandle(ptr, handle, out, out_len) })
+            },
+        )
     }
 
     /// Changes a property's user-facing label without changing its unique name.
-    pub fn set_label(&self, name: impl AsRef<str>, label: &str) -> bool {
-        let (Some(name), Some(label)) = (to_cstring(name.as_ref()), to_cstring(label)) else {
+    pub fn set_label(&self, property: impl PropertyKey, label: &str) -> bool {
+        let Some(label) = to_cstring(label) else {
             return false;
         };
-        let ptr = self.property_grid_ptr();
-        !ptr.is_null() && unsafe { ffi::wxd_PropertyGrid_SetLabel(ptr, name.as_ptr(), label.as_ptr()) }
+        self.call_key_bool(
+            property,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_SetLabel(ptr, name, label.as_ptr()) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_SetLabelByHandle(ptr, handle, label.as_ptr()) },
+        )
     }
 
     /// Returns the descriptive help text associated with a property.
-    pub fn get_help_string(&self, name: impl AsRef<str>) -> Option<String> {
-        let name = to_cstring(name.as_ref())?;
-        let ptr = self.property_grid_ptr();
-        if ptr.is_null() {
-            return None;
-        }
-        read_ffi_string(|out, out_len| unsafe { ffi::wxd_PropertyGrid_GetHelpString(ptr, name.as_ptr(), out, out_len) })
+    pub fn get_help_string(&self, property: impl PropertyKey) -> Option<String> {
+        self.with_key(
+            property,
+            None,
+            |ptr, name| read_ffi_string(|out, out_len| unsafe { ffi::wxd_PropertyGrid_GetHelpString(ptr, name, out, out_len) }),
+            |ptr, handle| {
+                read_ffi_string(|out, out_len| unsafe { ffi::wxd_PropertyGrid_GetHelpStringByHandle(ptr, handle, out, out_len) })
+            },
+        )
     }
 
     /// Sets the descriptive help text associated with a property.
     ///
     /// Depending on grid style, wxWidgets may show this text as a tooltip or
     /// in a property-grid manager's description area.
-    pub fn set_help_string(&self, name: impl AsRef<str>, help: &str) -> bool {
-        let (Some(name), Some(help)) = (to_cstring(name.as_ref()), to_cstring(help)) else {
+    pub fn set_help_string(&self, property: impl PropertyKey, help: &str) -> bool {
+        let Some(help) = to_cstring(help) else {
             return false;
         };
-        let ptr = self.property_grid_ptr();
-        !ptr.is_null() && unsafe { ffi::wxd_PropertyGrid_SetHelpString(ptr, name.as_ptr(), help.as_ptr()) }
+        self.call_key_bool(
+            property,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_SetHelpString(ptr, name, help.as_ptr()) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_SetHelpStringByHandle(ptr, handle, help.as_ptr()) },
+        )
     }
 
     /// Sets a native wxPropertyGrid attribute on one property.
@@ -789,83 +1013,112 @@ impl PropertyGrid {
     /// examples include `"Min"`, `"Max"`, `"Step"`, and `"Precision"`.
     /// Returns `false` if the widget, property, attribute name, or value is
     /// invalid at the binding boundary.
-    pub fn set_attribute(&self, name: impl AsRef<str>, attribute: &str, value: &Variant) -> bool {
-        let (Some(name), Some(attribute)) = (to_cstring(name.as_ref()), to_cstring(attribute)) else {
+    pub fn set_attribute(&self, property: impl PropertyKey, attribute: &str, value: &Variant) -> bool {
+        let Some(attribute) = to_cstring(attribute) else {
             return false;
         };
-        let ptr = self.property_grid_ptr();
-        !ptr.is_null()
-            && unsafe { ffi::wxd_PropertyGrid_SetAttribute(ptr, name.as_ptr(), attribute.as_ptr(), value.as_const_ptr()) }
+        let value = value.as_const_ptr();
+        self.call_key_bool(
+            property,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_SetAttribute(ptr, name, attribute.as_ptr(), value) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_SetAttributeByHandle(ptr, handle, attribute.as_ptr(), value) },
+        )
     }
 
     /// Enables or disables editing and interaction for a property.
-    pub fn enable_property(&self, name: impl AsRef<str>, enable: bool) -> bool {
-        self.call_name_bool(name, |ptr, name| unsafe {
-            ffi::wxd_PropertyGrid_EnableProperty(ptr, name, enable)
-        })
+    pub fn enable_property(&self, property: impl PropertyKey, enable: bool) -> bool {
+        self.call_key_bool(
+            property,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_EnableProperty(ptr, name, enable) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_EnablePropertyByHandle(ptr, handle, enable) },
+        )
     }
 
     /// Hides or shows a property and its children.
-    pub fn hide_property(&self, name: impl AsRef<str>, hide: bool) -> bool {
-        self.call_name_bool(name, |ptr, name| unsafe {
-            ffi::wxd_PropertyGrid_HideProperty(ptr, name, hide)
-        })
+    pub fn hide_property(&self, property: impl PropertyKey, hide: bool) -> bool {
+        self.call_key_bool(
+            property,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_HideProperty(ptr, name, hide) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_HidePropertyByHandle(ptr, handle, hide) },
+        )
     }
 
     /// Sets or clears the read-only state for a property and its children.
-    pub fn set_property_read_only(&self, name: impl AsRef<str>, read_only: bool) -> bool {
-        self.call_name_bool(name, |ptr, name| unsafe {
-            ffi::wxd_PropertyGrid_SetPropertyReadOnly(ptr, name, read_only)
-        })
+    pub fn set_property_read_only(&self, property: impl PropertyKey, read_only: bool) -> bool {
+        self.call_key_bool(
+            property,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_SetPropertyReadOnly(ptr, name, read_only) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_SetPropertyReadOnlyByHandle(ptr, handle, read_only) },
+        )
     }
 
     /// Returns whether a property exists and is enabled.
-    pub fn is_property_enabled(&self, name: impl AsRef<str>) -> bool {
-        self.call_name_bool(name, |ptr, name| unsafe {
-            ffi::wxd_PropertyGrid_IsPropertyEnabled(ptr, name)
-        })
+    pub fn is_property_enabled(&self, property: impl PropertyKey) -> bool {
+        self.call_key_bool(
+            property,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_IsPropertyEnabled(ptr, name) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_IsPropertyEnabledByHandle(ptr, handle) },
+        )
     }
 
     /// Returns whether a property exists and is hidden.
-    pub fn is_property_hidden(&self, name: impl AsRef<str>) -> bool {
-        self.call_name_bool(name, |ptr, name| unsafe { ffi::wxd_PropertyGrid_IsPropertyHidden(ptr, name) })
+    pub fn is_property_hidden(&self, property: impl PropertyKey) -> bool {
+        self.call_key_bool(
+            property,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_IsPropertyHidden(ptr, name) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_IsPropertyHiddenByHandle(ptr, handle) },
+        )
     }
 
     /// Returns whether a property exists and its child rows are expanded.
-    pub fn is_property_expanded(&self, name: impl AsRef<str>) -> bool {
-        self.call_name_bool(name, |ptr, name| unsafe {
-            ffi::wxd_PropertyGrid_IsPropertyExpanded(ptr, name)
-        })
+    pub fn is_property_expanded(&self, property: impl PropertyKey) -> bool {
+        self.call_key_bool(
+            property,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_IsPropertyExpanded(ptr, name) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_IsPropertyExpandedByHandle(ptr, handle) },
+        )
     }
 
     /// Returns whether the named item is a category.
-    pub fn is_property_category(&self, name: impl AsRef<str>) -> bool {
-        self.call_name_bool(name, |ptr, name| unsafe {
-            ffi::wxd_PropertyGrid_IsPropertyCategory(ptr, name)
-        })
+    pub fn is_property_category(&self, property: impl PropertyKey) -> bool {
+        self.call_key_bool(
+            property,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_IsPropertyCategory(ptr, name) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_IsPropertyCategoryByHandle(ptr, handle) },
+        )
     }
 
     /// Returns whether wxWidgets has marked the property's value as modified.
-    pub fn is_property_modified(&self, name: impl AsRef<str>) -> bool {
-        self.call_name_bool(name, |ptr, name| unsafe {
-            ffi::wxd_PropertyGrid_IsPropertyModified(ptr, name)
-        })
+    pub fn is_property_modified(&self, property: impl PropertyKey) -> bool {
+        self.call_key_bool(
+            property,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_IsPropertyModified(ptr, name) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_IsPropertyModifiedByHandle(ptr, handle) },
+        )
     }
 
     /// Expands one category or property with children.
     ///
     /// Returns `true` only when the item actually changes from collapsed to
     /// expanded.
-    pub fn expand(&self, name: impl AsRef<str>) -> bool {
-        self.call_name_bool(name, |ptr, name| unsafe { ffi::wxd_PropertyGrid_Expand(ptr, name) })
+    pub fn expand(&self, property: impl PropertyKey) -> bool {
+        self.call_key_bool(
+            property,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_Expand(ptr, name) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_ExpandByHandle(ptr, handle) },
+        )
     }
 
     /// Collapses one category or property with children.
     ///
     /// Returns `true` only when the item actually changes from expanded to
     /// collapsed.
-    pub fn collapse(&self, name: impl AsRef<str>) -> bool {
-        self.call_name_bool(name, |ptr, name| unsafe { ffi::wxd_PropertyGrid_Collapse(ptr, name) })
+    pub fn collapse(&self, property: impl PropertyKey) -> bool {
+        self.call_key_bool(
+            property,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_Collapse(ptr, name) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_CollapseByHandle(ptr, handle) },
+        )
     }
 
     /// Expands all expandable items when `expand` is true, or collapses them otherwise.
@@ -880,10 +1133,12 @@ impl PropertyGrid {
     ///
     /// Returns whether selection succeeded. Selection may fail if the current
     /// editor cannot commit its value.
-    pub fn select_property(&self, name: impl AsRef<str>, focus: bool) -> bool {
-        self.call_name_bool(name, |ptr, name| unsafe {
-            ffi::wxd_PropertyGrid_SelectProperty(ptr, name, focus)
-        })
+    pub fn select_property(&self, property: impl PropertyKey, focus: bool) -> bool {
+        self.call_key_bool(
+            property,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_SelectProperty(ptr, name, focus) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_SelectPropertyByHandle(ptr, handle, focus) },
+        )
     }
 
     /// Returns the unique name of the currently selected property.
@@ -899,8 +1154,13 @@ impl PropertyGrid {
     ///
     /// Existing [`PropertyId`] values remain ordinary strings but no longer
     /// resolve until a property with the same name is appended again.
-    pub fn delete_property(&self, name: impl AsRef<str>) -> bool {
-        self.call_name_bool(name, |ptr, name| unsafe { ffi::wxd_PropertyGrid_DeleteProperty(ptr, name) })
+    /// Handles of the deleted properties never resolve again.
+    pub fn delete_property(&self, property: impl PropertyKey) -> bool {
+        self.call_key_bool(
+            property,
+            |ptr, name| unsafe { ffi::wxd_PropertyGrid_DeleteProperty(ptr, name) },
+            |ptr, handle| unsafe { ffi::wxd_PropertyGrid_DeletePropertyByHandle(ptr, handle) },
+        )
     }
 
     /// Removes and destroys every property in the grid.
@@ -980,16 +1240,54 @@ impl PropertyGrid {
         }
     }
 
-    fn call_name_bool(
+    fn with_key<R>(
         &self,
-        name: impl AsRef<str>,
-        call: impl FnOnce(*mut ffi::wxd_PropertyGrid_t, *const c_char) -> bool,
-    ) -> bool {
-        let Some(name) = to_cstring(name.as_ref()) else {
-            return false;
-        };
+        property: impl PropertyKey,
+        missing: R,
+        by_name: impl FnOnce(*mut ffi::wxd_PropertyGrid_t, *const c_char) -> R,
+        by_handle: impl FnOnce(*mut ffi::wxd_PropertyGrid_t, u64) -> R,
+    ) -> R {
         let ptr = self.property_grid_ptr();
-        !ptr.is_null() && call(ptr, name.as_ptr())
+        if ptr.is_null() {
+            return missing;
+        }
+        match property.key() {
+            KeyRef::Name(name) => match to_cstring(name) {
+                Some(name) => by_name(ptr, name.as_ptr()),
+                None => missing,
+            },
+            KeyRef::Handle(handle) => by_handle(ptr, handle.0),
+        }
+    }
+
+    fn call_key_bool(
+        &self,
+        property: impl PropertyKey,
+        by_name: impl FnOnce(*mut ffi::wxd_PropertyGrid_t, *const c_char) -> bool,
+        by_handle: impl FnOnce(*mut ffi::wxd_PropertyGrid_t, u64) -> bool,
+    ) -> bool {
+        self.with_key(property, false, by_name, by_handle)
+    }
+}
+
+type LazyCategoryCallback = Box<dyn FnMut(PropertyHandle)>;
+
+unsafe extern "C" fn populate_lazy_category(user_data: *mut c_void, category: u64) {
+    let Some(category) = PropertyHandle::from_raw(category) else {
+        return;
+    };
+    if user_data.is_null() {
+        return;
+    }
+    let callback = unsafe { &*(user_data as *const RefCell<LazyCategoryCallback>) };
+    if let Ok(mut populate) = callback.try_borrow_mut() {
+        populate(category);
+    }
+}
+
+unsafe extern "C" fn free_lazy_category(user_data: *mut c_void) {
+    if !user_data.is_null() {
+        drop(unsafe { Box::from_raw(user_data as *mut RefCell<LazyCategoryCallback>) });
     }
 }
 
@@ -1090,7 +1388,7 @@ unsafe fn append_choices(
     choices: &[PropertyChoice],
     value: i32,
     flags: bool,
-) -> Option<bool> {
+) -> Option<u64> {
     let labels: Option<Vec<CString>> = choices.iter().map(|choice| to_cstring(&choice.label)).collect();
     let labels = labels?;
     let label_ptrs: Vec<*const c_char> = labels.iter().map(|label| label.as_ptr()).collect();
@@ -1124,3 +1422,66 @@ unsafe fn append_choices(
         })
     }
 }
+
+// Serializes in the layout documented for wxd_PropertyGrid_AppendProperties.
+fn encode_schema(properties: &[Property]) -> Vec<u8> {
+    fn put_str(out: &mut Vec<u8>, text: &str) {
+        out.extend_from_slice(&(text.len() as u32).to_le_bytes());
+        out.extend_from_slice(text.as_bytes());
+    }
+
+    let mut out = Vec::new();
+    let mut earlier: HashMap<&str, usize> = HashMap::new();
+    out.extend_from_slice(&(properties.len() as u32).to_le_bytes());
+    for (index, property) in properties.iter().enumerate() {
+        let kind = match &property.kind {
+            PropertyKind::Category => ffi::wxd_PGPropertyKind_WXD_PG_KIND_CATEGORY,
+            PropertyKind::String(_) => ffi::wxd_PGPropertyKind_WXD_PG_KIND_STRING,
+            PropertyKind::Int(_) => ffi::wxd_PGPropertyKind_WXD_PG_KIND_INT,
+            PropertyKind::UInt(_) => ffi::wxd_PGPropertyKind_WXD_PG_KIND_UINT,
+            PropertyKind::Float(_) => ffi::wxd_PGPropertyKind_WXD_PG_KIND_FLOAT,
+            PropertyKind::Bool(_) => ffi::wxd_PGPropertyKind_WXD_PG_KIND_BOOL,
+            PropertyKind::Enum { .. } => ffi::wxd_PGPropertyKind_WXD_PG_KIND_ENUM,
+            PropertyKind::Flags { .. } => ffi::wxd_PGPropertyKind_WXD_PG_KIND_FLAGS,
+            PropertyKind::File(_) => ffi::wxd_PGPropertyKind_WXD_PG_KIND_FILE,
+            PropertyKind::Dir(_) => ffi::wxd_PGPropertyKind_WXD_PG_KIND_DIR,
+        };
+        out.push(kind as u8);
+
+        // A parent from this batch is referenced by index so it resolves without a name lookup.
+        let parent = property.parent.as_deref().unwrap_or("");
+        match earlier.get(parent) {
+            Some(parent_index) => {
+                out.extend_from_slice(&(*parent_index as i32).to_le_bytes());
+                put_str(&mut out, "");
+            }
+            None => {
+                out.extend_from_slice(&(-1_i32).to_le_bytes());
+                put_str(&mut out, parent);
+            }
+        }
+        put_str(&mut out, &property.label);
+        put_str(&mut out, &property.name);
+
+        match &property.kind {
+            PropertyKind::Category => {}
+            PropertyKind::String(value) | PropertyKind::File(value) | PropertyKind::Dir(value) => put_str(&mut out, value),
+            PropertyKind::Int(value) => out.extend_from_slice(&value.to_le_bytes()),
+            PropertyKind::UInt(value) => out.extend_from_slice(&value.to_le_bytes()),
+            PropertyKind::Float(value) => out.extend_from_slice(&value.to_bits().to_le_bytes()),
+            PropertyKind::Bool(value) => out.push(*value as u8),
+            PropertyKind::Enum { choices, value } | PropertyKind::Flags { choices, value } => {
+                out.extend_from_slice(&(choices.len() as u32).to_le_bytes());
+                for choice in choices {
+                    put_str(&mut out, &choice.label);
+                    out.extend_from_slice(&choice.value.to_le_bytes());
+                }
+                out.extend_from_slice(&value.to_le_bytes());
+            }
+        }
+        if !property.name.is_empty() {
+            earlier.entry(property.name.as_str()).or_insert(index);
+        }
+    }
+    out
+}
@@ -1,6 +1,7 @@
 //!
 //! Safe wrapper for wxRichTextCtrl.
 
+use crate::app::WorkerPool;
 use crate::event::TextEvents;
 use crate::event::{Event, EventType, WxEvtHandler};
 use crate::geometry::{Point, Size};
@@ -11,6 +12,7 @@ use crate::window::{WindowHandle, WxWidget};
 use crate::window::Window;
 use std::ffi::CString;
 use std::os::raw::c_char;
+use std::path::PathBuf;
 use wxdragon_sys as ffi;
 
 // --- Rich Text Control Styles ---
@@ -119,6 +121,33 @@ impl RichTextCtrlEventData {
     }
 }
 
+/// A palette entry for [`RichTextCtrl::append_runs`]. Unset fields keep the default style.
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct RichTextRunStyle {
+    pub text_colour: Option<crate::Colour>,
+    pub background_colour: Option<crate::Colour>,
+    /// Font size in points.
+    pub font_size: Option<u32>,
+    pub bold: bool,
+    pub italic: bool,
+    pub underline: bool,
+}
+
+impl RichTextRunStyle {
+    fn to_raw(self) -> ffi::wxd_RichTextRunStyle {
+        // Alpha 0 tells the native side that a colour is unset.
+        let unset = ffi::wxd_Colour_t { r: 0, g: 0, b: 0, a: 0 };
+        ffi::wxd_RichTextRunStyle {
+            text_colour: self.text_colour.map_or(unset, Into::into),
+            background_colour: self.background_colour.map_or(unset, Into::into),
+            font_size: self.font_size.map_or(0, |size| i32::try_from(size).unwrap_or(i32::MAX)),
+            bold: self.bold,
+            italic: self.italic,
+            underline: self.underline,
+        }
+    }
+}
+
 /// Represents a wxRichTextCtrl widget.
 ///
 /// RichTextCtrl is a rich text editor that supports formatted text with different fonts,
@@ -262,6 +291,46 @@ impl RichTextCtrl {
         unsafe { ffi::wxd_RichTextCtrl_AppendText(ptr, c_text.as_ptr()) };
     }
 
+    /// Appends styled text in one batch: each `(text, style)` run is written with
+    /// `palette[style]`, or the default style if `style` is out of range.
+    ///
+    /// The control stays frozen with undo suppressed for the whole batch, so a document made of
+    /// thousands of spans is laid out once instead of once per span. Returns false if the control
+    /// has been destroyed.
+    ///
+    /// # Example
+    /// ```ignore
+    /// let palette = [
+    ///     RichTextRunStyle { bold: true, ..Default::default() },
+    ///     RichTextRunStyle { text_colour: Some(Colour::rgb(200, 0, 0)), ..Default::default() },
+    /// ];
+    /// rtc.append_runs(&palette, &[("Status: ", 0), ("FAILED\n", 1)]);
+    /// ```
+    pub fn append_runs(&self, palette: &[RichTextRunStyle], runs: &[(&str, usize)]) -> bool {
+        let ptr = self.richtextctrl_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        let raw_palette: Vec<ffi::wxd_RichTextRunStyle> = palette.iter().map(|style| style.to_raw()).collect();
+        let raw_runs: Vec<ffi::wxd_RichTextRun> = runs
+            .iter()
+            .map(|&(text, style)| ffi::wxd_RichTextRun {
+                text: text.as_ptr() as *const c_char,
+                len: text.len(),
+                style: i32::try_from(style).unwrap_or(-1),
+            })
+            .collect();
+        unsafe {
+            ffi::wxd_RichTextCtrl_AppendRuns(
+                ptr,
+                raw_palette.as_ptr(),
+                raw_palette.len(),
+                raw_runs.as_ptr(),
+                raw_runs.len(),
+            )
+        }
+    }
+
     /// Clears all text in the control.
     /// No-op if the control has been destroyed.
     pub fn clear(&self) {
@@ -517,6 +586,55 @@ impl RichTextCtrl {
         unsafe { ffi::wxd_RichTextCtrl_SaveFile(ptr, c_filename.as_ptr(), file_type.into()) }
     }
 
+    /// Replaces the content with a document serialized in `file_type`, parsing `data` in place.
+    /// [`RichTextFileType::Any`] detects XML by its prolog and treats anything else as plain
+    /// text. Returns false if the data cannot be parsed or the control has been destroyed.
+    pub fn load_from_bytes(&self, data: &[u8], file_type: RichTextFileType) -> bool {
+        let ptr = self.richtextctrl_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        unsafe { ffi::wxd_RichTextCtrl_LoadFromBuffer(ptr, data.as_ptr(), data.len(), file_type.into()) }
+    }
+
+    /// Serializes the content in memory ([`RichTextFileType::Any`] saves XML).
+    /// Returns `None` if the format cannot be saved or the control has been destroyed.
+    pub fn save_to_bytes(&self, file_type: RichTextFileType) -> Option<Vec<u8>> {
+        let ptr = self.richtextctrl_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        let owned = unsafe { ffi::wxd_RichTextCtrl_SaveToBuffer(ptr, file_type.into()) };
+        if owned.is_null() {
+            return None;
+        }
+        let bytes = unsafe {
+            let data = ffi::wxd_String_GetData(owned) as *const u8;
+            let len = ffi::wxd_String_GetLength(owned);
+            let bytes = std::slice::from_raw_parts(data, len).to_vec();
+            ffi::wxd_String_Free(owned);
+            bytes
+        };
+        Some(bytes)
+    }
+
+    /// Saves the content to `path` without blocking the UI on disk I/O.
+    ///
+    /// The document is serialized on the calling (UI) thread, since the buffer shares
+    /// reference-counted wx objects that must not be touched elsewhere, and the bytes are written
+    /// on `pool`. `on_done` runs on the UI thread with the outcome, unless the control is
+    /// destroyed first. Returns false if the content could not be serialized.
+    pub fn save_file_async<F>(&self, pool: &WorkerPool, path: impl Into<PathBuf>, file_type: RichTextFileType, on_done: F) -> bool
+    where
+        F: FnOnce(std::io::Result<()>) + 'static,
+    {
+        let Some(bytes) = self.save_to_bytes(file_type) else {
+            return false;
+        };
+        let path = path.into();
+        pool.submit_for(self, move |_| std::fs::write(&path, bytes), on_done)
+    }
+
     // --- Style Operations ---
 
     /// Sets style for a range of text.
@@ -1,10 +1,15 @@
 //!
 //! Safe wrapper for wxScrolledWindow.
 
+use crate::app::WorkerPool;
+use crate::dc::GenericDC;
 use crate::event::{MenuEvents, ScrollEvents, WindowEvents, WxEvtHandler};
-use crate::geometry::{Point, Size};
+use crate::geometry::{Point, Rect, Size};
 use crate::id::Id;
 use crate::window::{WindowHandle, WxWidget};
+use std::ffi::c_void;
+use std::rc::Rc;
+use std::sync::Arc;
 use wxdragon_sys as ffi;
 
 // --- Style enum using macro ---
@@ -30,6 +35,98 @@ pub struct ScrollBarConfig {
     pub no_refresh: bool,
 }
 
+/// A tile requested by a threaded tile cache (see [`ScrolledWindow::enable_tile_cache_threaded`]).
+#[derive(Debug, Clone, Copy, PartialEq)]
+pub struct TileRequest {
+    /// The tile in virtual (unscrolled) logical pixels.
+    pub rect: Rect,
+    /// The window's content scale factor.
+    pub scale: f64,
+    /// Size of the RGBA buffer to produce, in physical pixels.
+    pub pixel_size: Size,
+}
+
+type TileRenderFn = Box<dyn FnMut(&GenericDC, Rect)>;
+
+// State behind a threaded tile cache's C callback; lives until the cache is disabled.
+struct ThreadedTiles {
+    window: ScrolledWindow,
+    pool: Rc<WorkerPool>,
+    tile_size: Size,
+    render: Arc<dyn Fn(TileRequest) -> Option<Vec<u8>> + Send + Sync>,
+}
+
+extern "C" fn tile_render_trampoline(
+    user_data: *mut c_void,
+    dc: *mut ffi::wxd_DC_t,
+    tile: ffi::wxd_Rect,
+    _scale: f64,
+    _ticket: u64,
+) -> bool {
+    if user_data.is_null() || dc.is_null() {
+        return false;
+    }
+    let render = unsafe { &mut *(user_data as *mut TileRenderFn) };
+    let dc = unsafe { GenericDC::from_ffi_ptr_unowned(dc) };
+    render(&dc, tile.into());
+    true
+}
+
+extern "C" fn free_tile_render_fn(user_data: *mut c_void) {
+    if !user_data.is_null() {
+        let _ = unsafe { Box::from_raw(user_data as *mut TileRenderFn) };
+    }
+}
+
+extern "C" fn threaded_tile_trampoline(
+    user_data: *mut c_void,
+    _dc: *mut ffi::wxd_DC_t,
+    tile: ffi::wxd_Rect,
+    scale: f64,
+    ticket: u64,
+) -> bool {
+    if user_data.is_null() {
+        return true;
+    }
+    let state = unsafe { &*(user_data as *const ThreadedTiles) };
+    let rect: Rect = tile.into();
+    let request = TileRequest {
+        rect,
+        scale,
+        pixel_size: Size::new(
+            ((rect.width as f64) * scale).ceil() as i32,
+            ((rect.height as f64) * scale).ceil() as i32,
+        ),
+    };
+    let column = rect.x.div_euclid(state.tile_size.width.max(1));
+    let row = rect.y.div_euclid(state.tile_size.height.max(1));
+    let render = state.render.clone();
+    let window = state.window;
+    state.pool.submit_for(
+        &state.window,
+        move |_| render(request),
+        move |pixels: Option<Vec<u8>>| {
+            let Some(pixels) = pixels else { return };
+            let (w, h) = (request.pixel_size.width, request.pixel_size.height);
+            if pixels.len() < (w as usize) * (h as usize) * 4 {
+                return;
+            }
+            let ptr = window.scrolled_window_ptr();
+            if !ptr.is_null() {
+                unsafe { ffi::wxd_ScrolledWindow_SetTileRGBA(ptr, column, row, ticket, pixels.as_ptr(), w, h) };
+            }
+        },
+    );
+    // Deferred: the tile shows the background until its pixels arrive.
+    false
+}
+
+extern "C" fn free_threaded_tiles(user_data: *mut c_void) {
+    if !user_data.is_null() {
+        let _ = unsafe { Box::from_raw(user_data as *mut ThreadedTiles) };
+    }
+}
+
 /// Represents a wxScrolledWindow widget.
 /// A window that can scroll its contents.
 ///
@@ -177,6 +274,120 @@ impl ScrolledWindow {
         unsafe { ffi::wxd_ScrolledWindow_GetScrollPixelsPerUnit(ptr, &mut x_unit, &mut y_unit) };
         (x_unit, y_unit)
     }
+
+    /// Paints the window from a cache of `tile_size` tiles, rendered on demand by `render` and
+    /// kept under `memory_budget` bytes, so scrolling and repaints mostly blit cached bitmaps.
+    ///
+    /// `render` receives a DC onto one tile, cleared to the background colour and set up to draw
+    /// in virtual (unscrolled) coordinates, and the tile's rect. It replaces the window's own
+    /// painting until [`ScrolledWindow::disable_tile_cache`]. Returns false if the window has been
+    /// destroyed or `tile_size` is empty.
+    ///
+    /// # Example
+    /// ```ignore
+    /// scrolled.set_scrollbars(ScrollBarConfig { pixels_per_unit_x: 1, pixels_per_unit_y: 1,
+    ///     no_units_x: 100_000, no_units_y: 100_000, x_pos: 0, y_pos: 0, no_refresh: false });
+    /// scrolled.enable_tile_cache(Size::new(256, 256), 64 << 20, move |dc, tile| {
+    ///     map.draw(dc, tile);
+    /// });
+    /// ```
+    pub fn enable_tile_cache<F>(&self, tile_size: Size, memory_budget: usize, render: F) -> bool
+    where
+        F: FnMut(&GenericDC, Rect) + 'static,
+    {
+        let ptr = self.scrolled_window_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        let boxed: Box<TileRenderFn> = Box::new(Box::new(render));
+        unsafe {
+            ffi::wxd_ScrolledWindow_EnableTileCache(
+                ptr,
+                tile_size.width,
+                tile_size.height,
+                memory_budget,
+                Some(tile_render_trampoline),
+                Box::into_raw(boxed) as *mut c_void,
+                Some(free_tile_render_fn),
+            )
+        }
+    }
+
+    /// Like [`ScrolledWindow::enable_tile_cache`], but tiles are rendered on `pool`'s worker
+    /// threads as straight RGBA buffers of [`TileRequest::pixel_size`], and shown as they
+    /// arrive. `render` must not touch UI objects; returning `None` leaves the tile blank until
+    /// it is invalidated.
+    pub fn enable_tile_cache_threaded<F>(&self, pool: Rc<WorkerPool>, tile_size: Size, memory_budget: usize, render: F) -> bool
+    where
+        F: Fn(TileRequest) -> Option<Vec<u8>> + Send + Sync + 'static,
+    {
+        let ptr = self.scrolled_window_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        let state = Box::new(ThreadedTiles {
+            window: *self,
+            pool,
+            tile_size,
+            render: Arc::new(render),
+        });
+        unsafe {
+            ffi::wxd_ScrolledWindow_EnableTileCache(
+                ptr,
+                tile_size.width,
+                tile_size.height,
+                memory_budget,
+                Some(threaded_tile_trampoline),
+                Box::into_raw(state) as *mut c_void,
+                Some(free_threaded_tiles),
+            )
+        }
+    }
+
+    /// Removes the tile cache and restores the window's own painting.
+    pub fn disable_tile_cache(&self) {
+        let ptr = self.scrolled_window_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_ScrolledWindow_DisableTileCache(ptr) }
+    }
+
+    /// Drops cached tiles intersecting `area` (virtual pixels) so they are rendered again.
+    pub fn invalidate_tiles(&self, area: Rect) {
+        let ptr = self.scrolled_window_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_ScrolledWindow_InvalidateTiles(ptr, area.into()) }
+    }
+
+    /// Drops every cached tile, e.g. after the whole document changed.
+    pub fn invalidate_all_tiles(&self) {
+        let ptr = self.scrolled_window_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_ScrolledWindow_InvalidateAllTiles(ptr) }
+    }
+
+    /// Changes the tile cache's memory budget in bytes, evicting tiles if needed.
+    pub fn set_tile_cache_budget(&self, memory_budget: usize) {
+        let ptr = self.scrolled_window_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_ScrolledWindow_SetTileCacheBudget(ptr, memory_budget) }
+    }
+
+    /// Bytes of tile bitmaps currently cached.
+    pub fn tile_cache_usage(&self) -> usize {
+        let ptr = self.scrolled_window_ptr();
+        if ptr.is_null() {
+            return 0;
+        }
+        unsafe { ffi::wxd_ScrolledWindow_GetTileCacheUsage(ptr) }
+    }
 }
 
 // Manual WxWidget implementation for ScrolledWindow (using WindowHandle)
@@ -186,6 +186,17 @@ impl SearchCtrl {
         String::from_utf8(vec_buffer).unwrap_or_default()
     }
 
+    /// Drives this control's autocompletion popup from `index`, replacing any previous completer;
+    /// `None` turns autocompletion off.
+    /// No-op if the control has been destroyed.
+    pub fn set_completion_index(&self, index: Option<&crate::widgets::CompletionIndex>) {
+        let ptr = self.searchctrl_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_SearchCtrl_SetCompletionIndex(ptr, crate::widgets::completion_index::raw_index(index)) };
+    }
+
     /// Returns the underlying WindowHandle for this searchctrl.
     pub fn window_handle(&self) -> WindowHandle {
         self.handle
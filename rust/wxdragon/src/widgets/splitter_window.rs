@@ -46,6 +46,31 @@ widget_style_enum!(
     default_variant: Default
 );
 
+/// How a sash drag updates the panes while the mouse button is held.
+///
+/// Used by [`SplitterWindow::set_live_resize`] and
+/// [`AuiManager::set_live_resize`](crate::widgets::AuiManager::set_live_resize).
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub enum LiveResizeMode {
+    /// Whatever the window's style or flags ask for.
+    #[default]
+    Native,
+    /// Live layout, at most once per frame interval and always ending on the final position.
+    Throttled,
+    /// No layout during the drag, only a cheap stand-in; one full layout on release.
+    Snapshot,
+}
+
+impl LiveResizeMode {
+    pub(crate) fn to_raw(self) -> i32 {
+        (match self {
+            LiveResizeMode::Native => ffi::wxd_LiveResizeMode_WXD_LIVE_RESIZE_NATIVE,
+            LiveResizeMode::Throttled => ffi::wxd_LiveResizeMode_WXD_LIVE_RESIZE_THROTTLED,
+            LiveResizeMode::Snapshot => ffi::wxd_LiveResizeMode_WXD_LIVE_RESIZE_SNAPSHOT,
+        }) as i32
+    }
+}
+
 /// Events emitted by SplitterWindow
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
 pub enum SplitterEvent {
@@ -222,6 +247,22 @@ impl SplitterWindow {
         unsafe { ffi::wxd_SplitterWindow_SetMinimumPaneSize(ptr, size as c_int) };
     }
 
+    /// Sets how dragging the sash updates the panes, for panes that are slow to lay out.
+    ///
+    /// [`Throttled`](LiveResizeMode::Throttled) lays the panes out at most once per `frame`
+    /// (16 ms if zero). [`Snapshot`](LiveResizeMode::Snapshot) leaves them alone until the
+    /// button is released and meanwhile shows a stretched picture of them taken when the drag
+    /// started (just their background colours on ports that cannot read window contents back).
+    /// Both switch on live update. Returns false if the splitter has been destroyed.
+    pub fn set_live_resize(&self, mode: LiveResizeMode, frame: std::time::Duration) -> bool {
+        let ptr = self.splitter_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        let frame_ms = frame.as_millis().min(u32::MAX as u128) as u32;
+        unsafe { ffi::wxd_SplitterWindow_SetLiveResizeMode(ptr, mode.to_raw(), frame_ms) }
+    }
+
     /// Returns the underlying WindowHandle for this splitter window.
     pub fn window_handle(&self) -> WindowHandle {
         self.handle
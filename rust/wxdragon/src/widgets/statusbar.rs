@@ -115,6 +115,19 @@ impl StatusBar {
         }
     }
 
+    /// Like [`set_status_text`](Self::set_status_text), but only the newest text per field is kept
+    /// and applied at most once per display frame, skipped if the field already shows it.
+    pub fn set_status_text_deferred(&self, text: &str, field_index: usize) {
+        let ptr = self.statusbar_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        let c_text = CString::new(text).unwrap_or_default();
+        unsafe {
+            ffi::wxd_StatusBar_SetStatusTextDeferred(ptr, c_text.as_ptr(), field_index as c_int);
+        }
+    }
+
     /// Sets the widths of the status bar fields.
     ///
     /// `widths`: A slice containing the width for each field.
@@ -5,9 +5,11 @@ use crate::event::{Event, EventType, WxEvtHandler};
 use crate::font::Font;
 use crate::geometry::{Point, Size};
 use crate::id::Id;
+use crate::utils::take_wxd_string;
 use crate::window::{WindowHandle, WxWidget};
 use std::ffi::CString;
 use std::os::raw::c_char;
+use std::path::Path;
 use wxdragon_sys as ffi;
 
 // STC Enums for type-safe parameter handling
@@ -385,6 +387,80 @@ impl StyledTextCtrlEventData {
     }
 }
 
+/// Progress of a [`StyledTextCtrl::load_file_with_progress`] load.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct LoadProgress {
+    /// Bytes added to the document so far.
+    pub loaded: u64,
+    /// Size of the file in bytes.
+    pub total: u64,
+    /// Set on the final report; `loaded < total` then means the load was cancelled or failed.
+    pub done: bool,
+}
+
+/// Outcome of a [`StyledTextCtrl::find_all_async`] search.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct FindAllResult {
+    /// Matches filled with the indicator.
+    pub matches: u64,
+    /// False if the search was cancelled before reaching the end of the document.
+    pub completed: bool,
+}
+
+/// A Scintilla document that several [`StyledTextCtrl`] views can show at once.
+///
+/// Views sharing a document share its text buffer, undo history and styling, so a split view or
+/// a peek pane costs no copy of the text; each view keeps its own selection, scroll position and
+/// folding. Get one with [`StyledTextCtrl::document`] and show it elsewhere with
+/// [`StyledTextCtrl::set_document`]. Clones refer to the same document, which is freed once no
+/// handle or view refers to it. A handle stops resolving once every view that shared it is
+/// destroyed.
+///
+/// ```no_run
+/// # use wxdragon::prelude::*;
+/// # fn split(left: &StyledTextCtrl, right: &StyledTextCtrl) {
+/// if let Some(doc) = left.document() {
+///     right.set_document(&doc);
+/// }
+/// # }
+/// ```
+pub struct StcDocument {
+    ptr: *mut ffi::wxd_StcDocument_t,
+}
+
+impl StcDocument {
+    /// Whether the document can still be shown, i.e. a view that shared it is still alive.
+    pub fn is_valid(&self) -> bool {
+        unsafe { ffi::wxd_StcDocument_IsValid(self.ptr) }
+    }
+
+    /// Whether `view` currently shows this document.
+    pub fn is_shown_by(&self, view: &StyledTextCtrl) -> bool {
+        let ptr = view.stc_ptr();
+        !ptr.is_null() && unsafe { ffi::wxd_StcDocument_IsShownBy(self.ptr, ptr) }
+    }
+}
+
+impl Clone for StcDocument {
+    fn clone(&self) -> Self {
+        StcDocument {
+            ptr: unsafe { ffi::wxd_StcDocument_AddRef(self.ptr) },
+        }
+    }
+}
+
+impl Drop for StcDocument {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_StcDocument_Release(self.ptr) };
+    }
+}
+
+impl std::fmt::Debug for StcDocument {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        f.debug_struct("StcDocument").field("valid", &self.is_valid()).finish()
+    }
+}
+
 /// Represents a wxStyledTextCtrl widget.
 ///
 /// StyledTextCtrl is a text editor control based on the Scintilla editing component.
@@ -398,6 +474,53 @@ pub struct StyledTextCtrl {
     handle: WindowHandle,
 }
 
+extern "C" fn style_needed_trampoline(user_data: *mut std::ffi::c_void, start: i32, end: i32) {
+    if !user_data.is_null() {
+        let callback = unsafe { &mut *(user_data as *mut Box<dyn FnMut(i32, i32)>) };
+        callback(start, end);
+    }
+}
+
+extern "C" fn free_style_needed_callback(user_data: *mut std::ffi::c_void) {
+    if !user_data.is_null() {
+        let _ = unsafe { Box::from_raw(user_data as *mut Box<dyn FnMut(i32, i32)>) };
+    }
+}
+
+type LoadProgressFn = Box<dyn FnMut(LoadProgress) -> bool>;
+
+extern "C" fn load_progress_trampoline(user_data: *mut std::ffi::c_void, loaded: u64, total: u64, done: bool) -> bool {
+    if user_data.is_null() {
+        return true;
+    }
+    let callback = unsafe { &mut *(user_data as *mut LoadProgressFn) };
+    callback(LoadProgress { loaded, total, done })
+}
+
+type FindAllSlot = Option<Box<dyn FnOnce(FindAllResult)>>;
+
+extern "C" fn find_all_trampoline(user_data: *mut std::ffi::c_void, matches: u64, completed: bool) {
+    if user_data.is_null() {
+        return;
+    }
+    let slot = unsafe { &mut *(user_data as *mut FindAllSlot) };
+    if let Some(on_done) = slot.take() {
+        on_done(FindAllResult { matches, completed });
+    }
+}
+
+extern "C" fn free_find_all_slot(user_data: *mut std::ffi::c_void) {
+    if !user_data.is_null() {
+        let _ = unsafe { Box::from_raw(user_data as *mut FindAllSlot) };
+    }
+}
+
+extern "C" fn free_load_progress_callback(user_data: *mut std::ffi::c_void) {
+    if !user_data.is_null() {
+        let _ = unsafe { Box::from_raw(user_data as *mut LoadProgressFn) };
+    }
+}
+
 impl StyledTextCtrl {
     /// Creates a new StyledTextCtrl builder.
     pub fn builder(parent: &dyn WxWidget) -> StyledTextCtrlBuilder<'_> {
@@ -463,7 +586,263 @@ impl StyledTextCtrl {
         if ptr.is_null() {
             return String::new();
         }
-        unsafe { Self::read_string_with_retry(|buf, len| ffi::wxd_StyledTextCtrl_GetText(ptr, buf, len)) }
+        unsafe { take_wxd_string(ffi::wxd_StyledTextCtrl_GetTextOwned(ptr)) }.unwrap_or_default()
+    }
+
+    /// Switches to console (tail) mode for high-rate logging.
+    ///
+    /// Text passed to [`Self::console_append`] is buffered and written once per frame inside a
+    /// single freeze, the oldest lines are dropped beyond `max_lines` (0 keeps everything), and
+    /// the view follows new output only while the caret is at the end, so scrolling back to read
+    /// is not interrupted. Calling it again only changes `max_lines`.
+    pub fn enable_console_mode(&self, max_lines: usize) {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        let max_lines = i32::try_from(max_lines).unwrap_or(i32::MAX);
+        unsafe { ffi::wxd_StyledTextCtrl_SetConsoleMode(ptr, true, max_lines) };
+    }
+
+    /// Leaves console mode, writing any buffered text first.
+    pub fn disable_console_mode(&self) {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_StyledTextCtrl_SetConsoleMode(ptr, false, 0) };
+    }
+
+    /// Appends log output: buffered until the next frame in console mode, immediate otherwise.
+    /// Include the trailing newline of each line.
+    pub fn console_append(&self, text: &str) {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() || text.is_empty() {
+            return;
+        }
+        unsafe { ffi::wxd_StyledTextCtrl_ConsoleAppend(ptr, text.as_ptr() as *const c_char, text.len()) };
+    }
+
+    /// Writes buffered console output now instead of at the next frame.
+    pub fn console_flush(&self) {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_StyledTextCtrl_ConsoleFlush(ptr) };
+    }
+
+    /// Calls `f` with the document's UTF-8 bytes, borrowed in place without copying.
+    ///
+    /// The document is made read-only while `f` runs so the buffer cannot move under the borrow;
+    /// `f` must not clear that flag. The flag is per document, so other controls showing the same
+    /// [`StcDocument`] are read-only meanwhile too. Offsets into the slice are the control's byte
+    /// positions.
+    /// `f` receives an empty slice if the control has been destroyed.
+    pub fn with_text_bytes<R>(&self, f: impl FnOnce(&[u8]) -> R) -> R {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() {
+            return f(&[]);
+        }
+        self.with_document_locked(|| {
+            let mut len: usize = 0;
+            let text = unsafe { ffi::wxd_StyledTextCtrl_GetCharacterPointer(ptr, &mut len) };
+            if text.is_null() || len == 0 {
+                return f(&[]);
+            }
+            f(unsafe { std::slice::from_raw_parts(text as *const u8, len) })
+        })
+    }
+
+    /// Calls `f` with the bytes of `start..start + length`, borrowed in place without copying.
+    ///
+    /// Unlike [`Self::with_text_bytes`] this only closes Scintilla's editing gap if the range
+    /// spans it, so it stays cheap in large documents. `f` receives an empty slice if the range is
+    /// out of bounds or the control has been destroyed.
+    pub fn with_range_bytes<R>(&self, start: i32, length: i32, f: impl FnOnce(&[u8]) -> R) -> R {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() || length <= 0 {
+            return f(&[]);
+        }
+        self.with_document_locked(|| {
+            let range = unsafe { ffi::wxd_StyledTextCtrl_GetRangePointer(ptr, start, length) };
+            if range.is_null() {
+                return f(&[]);
+            }
+            f(unsafe { std::slice::from_raw_parts(range as *const u8, length as usize) })
+        })
+    }
+
+    /// Returns the raw bytes of `start..end` without converting them to a `String`.
+    /// Returns an empty vector if the control has been destroyed.
+    pub fn get_text_range_raw(&self, start: i32, end: i32) -> Vec<u8> {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() {
+            return Vec::new();
+        }
+        let len = unsafe { ffi::wxd_StyledTextCtrl_GetTextRangeRaw(ptr, start, end, std::ptr::null_mut(), 0) };
+        if len <= 0 {
+            return Vec::new();
+        }
+        let mut buf = vec![0u8; len as usize];
+        let copied = unsafe { ffi::wxd_StyledTextCtrl_GetTextRangeRaw(ptr, start, end, buf.as_mut_ptr() as *mut c_char, len) };
+        buf.truncate(copied.clamp(0, len) as usize);
+        buf
+    }
+
+    /// Replaces the document with raw UTF-8 bytes, skipping `String` conversion and undo history.
+    ///
+    /// Much faster and leaner than [`Self::set_text`] for large content: the bytes are fed to
+    /// Scintilla in chunks with modification notifications off and styling deferred to idle time.
+    /// The document ends up unmodified. Returns false if the data is larger than 2 GiB or the
+    /// control has been destroyed.
+    pub fn load_from_bytes(&self, data: &[u8]) -> bool {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        unsafe { ffi::wxd_StyledTextCtrl_LoadFromBytes(ptr, data.as_ptr(), data.len()) }
+    }
+
+    /// Loads a UTF-8 file like [`Self::load_from_bytes`], reading it in chunks straight into the
+    /// document. Returns false if the file cannot be read.
+    pub fn load_file_fast(&self, path: impl AsRef<Path>) -> bool {
+        let ptr = self.stc_ptr();
+        let Some(c_path) = path.as_ref().to_str().and_then(|p| CString::new(p).ok()) else {
+            return false;
+        };
+        if ptr.is_null() {
+            return false;
+        }
+        unsafe { ffi::wxd_StyledTextCtrl_LoadFileFast(ptr, c_path.as_ptr(), false, None, std::ptr::null_mut(), None) }
+    }
+
+    /// Loads a UTF-8 file chunk by chunk, reporting each step to `progress`, which returns false to
+    /// cancel (keeping what has been loaded).
+    ///
+    /// With `incremental` the call returns as soon as the file is open and the rest streams in
+    /// during idle time, the control staying read-only until the final report; otherwise it
+    /// loads before returning. Returns false, without reporting, if the file cannot be opened.
+    pub fn load_file_with_progress<F>(&self, path: impl AsRef<Path>, incremental: bool, progress: F) -> bool
+    where
+        F: FnMut(LoadProgress) -> bool + 'static,
+    {
+        let ptr = self.stc_ptr();
+        let Some(c_path) = path.as_ref().to_str().and_then(|p| CString::new(p).ok()) else {
+            return false;
+        };
+        if ptr.is_null() {
+            return false;
+        }
+        let boxed: Box<LoadProgressFn> = Box::new(Box::new(progress));
+        unsafe {
+            ffi::wxd_StyledTextCtrl_LoadFileFast(
+                ptr,
+                c_path.as_ptr(),
+                incremental,
+                Some(load_progress_trampoline),
+                Box::into_raw(boxed) as *mut std::ffi::c_void,
+                Some(free_load_progress_callback),
+            )
+        }
+    }
+
+    /// Stops an incremental load started by [`Self::load_file_with_progress`], keeping the text
+    /// loaded so far. The final progress report is still made.
+    pub fn cancel_load(&self) {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_StyledTextCtrl_CancelLoad(ptr) };
+    }
+
+    /// Highlights every occurrence of `pattern` with `indicator` (and `value`) without blocking
+    /// the UI, then calls `on_done` with the number of matches.
+    ///
+    /// The document is copied and searched on a worker thread; earlier fills of `indicator` are
+    /// cleared and the matches are filled in batches from the event loop, the lines on screen
+    /// first. [`FindFlags::MatchCase`], [`FindFlags::WholeWord`] and [`FindFlags::RegExp`] are
+    /// honoured; regular expressions use ECMAScript syntax and match within a line, and case
+    /// folding is ASCII only. Editing the text, starting another search or
+    /// [`Self::cancel_find_all`] cancels it, reporting `completed: false`; `on_done` is dropped
+    /// unreported if the control is destroyed. Returns false if the pattern is empty or not a
+    /// valid regular expression.
+    pub fn find_all_async<F>(&self, pattern: &str, flags: FindFlags, indicator: i32, value: i32, on_done: F) -> bool
+    where
+        F: FnOnce(FindAllResult) + 'static,
+    {
+        let ptr = self.stc_ptr();
+        let Ok(c_pattern) = CString::new(pattern) else {
+            return false;
+        };
+        if ptr.is_null() {
+            return false;
+        }
+        let boxed: Box<FindAllSlot> = Box::new(Some(Box::new(on_done)));
+        unsafe {
+            ffi::wxd_StyledTextCtrl_FindAllAsync(
+                ptr,
+                c_pattern.as_ptr(),
+                flags.bits_i32(),
+                indicator,
+                value,
+                Some(find_all_trampoline),
+                Box::into_raw(boxed) as *mut std::ffi::c_void,
+                Some(free_find_all_slot),
+            )
+        }
+    }
+
+    /// Stops a search started by [`Self::find_all_async`], keeping the matches filled so far.
+    pub fn cancel_find_all(&self) {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_StyledTextCtrl_CancelFindAll(ptr) };
+    }
+
+    /// Returns a handle to the document this control shows, to share it with other views.
+    pub fn document(&self) -> Option<StcDocument> {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        let doc = unsafe { ffi::wxd_StyledTextCtrl_GetDocument(ptr) };
+        (!doc.is_null()).then_some(StcDocument { ptr: doc })
+    }
+
+    /// Makes this control show `document`, letting go of the document it showed before (freed
+    /// once nothing else refers to it). A running file load or find-all ends. Returns false if
+    /// the control was destroyed or the document no longer resolves.
+    pub fn set_document(&self, document: &StcDocument) -> bool {
+        let ptr = self.stc_ptr();
+        !ptr.is_null() && unsafe { ffi::wxd_StyledTextCtrl_SetDocument(ptr, document.ptr) }
+    }
+
+    // Runs `f` with the document read-only, restoring the previous state afterwards, also when
+    // `f` panics. The flag belongs to the document, so views sharing it (see `set_document`) are
+    // read-only for that time too.
+    fn with_document_locked<R>(&self, f: impl FnOnce() -> R) -> R {
+        struct Unlock<'a>(&'a StyledTextCtrl);
+
+        impl Drop for Unlock<'_> {
+            fn drop(&mut self) {
+                let ptr = self.0.stc_ptr();
+                if !ptr.is_null() {
+                    unsafe { ffi::wxd_StyledTextCtrl_SetReadOnly(ptr, false) };
+                }
+            }
+        }
+
+        let ptr = self.stc_ptr();
+        if unsafe { ffi::wxd_StyledTextCtrl_GetReadOnly(ptr) } {
+            return f();
+        }
+        unsafe { ffi::wxd_StyledTextCtrl_SetReadOnly(ptr, true) };
+        let _unlock = Unlock(self);
+        f()
     }
 
     /// Appends text to the end of the control.
@@ -823,6 +1202,16 @@ impl StyledTextCtrl {
         unsafe { ffi::wxd_StyledTextCtrl_MarkerAdd(ptr, line, marker_number) }
     }
 
+    /// Adds a marker to every line in `lines` in one call, repainting once afterwards.
+    /// Returns how many markers were added; invalid lines are skipped.
+    pub fn marker_add_lines(&self, lines: &[i32], marker_number: i32) -> usize {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() || lines.is_empty() {
+            return 0;
+        }
+        unsafe { ffi::wxd_StyledTextCtrl_MarkerAddLines(ptr, lines.as_ptr(), lines.len(), marker_number) }
+    }
+
     /// Deletes a marker from a line.
     pub fn marker_delete(&self, line: i32, marker_number: i32) {
         let ptr = self.stc_ptr();
@@ -978,6 +1367,111 @@ impl StyledTextCtrl {
         unsafe { ffi::wxd_StyledTextCtrl_SetStyling(ptr, length, style) };
     }
 
+    /// Styles the text from `start` with one style byte per byte of text, in a single call.
+    ///
+    /// Much cheaper than a [`StyledTextCtrl::set_styling`] call per token when a lexer has
+    /// produced the styles for a whole range.
+    pub fn set_style_bytes(&self, start: i32, styles: &[u8]) {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() || styles.is_empty() {
+            return;
+        }
+        let len = styles.len().min(i32::MAX as usize) as i32;
+        unsafe { ffi::wxd_StyledTextCtrl_SetStyleBytes(ptr, start, styles.as_ptr(), len) };
+    }
+
+    /// Position up to which the text is known to be styled.
+    pub fn get_end_styled(&self) -> i32 {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() {
+            return 0;
+        }
+        unsafe { ffi::wxd_StyledTextCtrl_GetEndStyled(ptr) }
+    }
+
+    /// Styles text incrementally from a Rust lexer.
+    ///
+    /// Switches the control to the container lexer and calls `callback(start, end)` whenever
+    /// Scintilla is about to show unstyled text (SCN_STYLENEEDED). `start` is the beginning of
+    /// the first line past the styled end and `end` the last position about to be displayed, so
+    /// only the visible, changed range is restyled; the callback typically lexes it and calls
+    /// [`StyledTextCtrl::set_style_bytes`] once. Replaces any previous hook.
+    ///
+    /// # Example
+    /// ```ignore
+    /// stc.on_style_needed(move |start, end| {
+    ///     let styles = lexer.lex(&text_range(start, end));
+    ///     stc.set_style_bytes(start, &styles);
+    /// });
+    /// ```
+    pub fn on_style_needed<F>(&self, callback: F)
+    where
+        F: FnMut(i32, i32) + 'static,
+    {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        let boxed: Box<Box<dyn FnMut(i32, i32)>> = Box::new(Box::new(callback));
+        unsafe {
+            ffi::wxd_StyledTextCtrl_SetStyleNeededCallback(
+                ptr,
+                Some(style_needed_trampoline),
+                Box::into_raw(boxed) as *mut std::ffi::c_void,
+                Some(free_style_needed_callback),
+            )
+        };
+    }
+
+    /// Removes the hook installed by [`StyledTextCtrl::on_style_needed`].
+    pub fn clear_style_needed(&self) {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_StyledTextCtrl_SetStyleNeededCallback(ptr, None, std::ptr::null_mut(), None) };
+    }
+
+    // --- Indicators ---
+
+    /// Sets the drawing style (`INDIC_*`) of an indicator.
+    pub fn indicator_set_style(&self, indicator: i32, style: i32) {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_StyledTextCtrl_IndicatorSetStyle(ptr, indicator, style) };
+    }
+
+    /// Sets the colour of an indicator.
+    pub fn indicator_set_foreground(&self, indicator: i32, color: Colour) {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_StyledTextCtrl_IndicatorSetForeground(ptr, indicator, color.into()) };
+    }
+
+    /// Fills every `(start, length)` range with `indicator` (and `value`) in a single call,
+    /// e.g. all search matches or diagnostics at once, repainting once afterwards.
+    pub fn indicator_fill_ranges(&self, indicator: i32, value: i32, ranges: &[(i32, i32)]) {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() || ranges.is_empty() {
+            return;
+        }
+        let flat: Vec<i32> = ranges.iter().flat_map(|&(start, len)| [start, len]).collect();
+        unsafe { ffi::wxd_StyledTextCtrl_IndicatorFillRanges(ptr, indicator, value, flat.as_ptr(), ranges.len()) };
+    }
+
+    /// Clears `indicator` from `length` characters starting at `start`.
+    pub fn indicator_clear_range(&self, indicator: i32, start: i32, length: i32) {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_StyledTextCtrl_IndicatorClearRange(ptr, indicator, start, length) };
+    }
+
     // --- Lexer and Language Support ---
 
     /// Set the lexer for syntax highlighting
@@ -1614,6 +2108,16 @@ impl StyledTextCtrl {
         unsafe { ffi::wxd_StyledTextCtrl_SetFoldLevel(ptr, line, level) };
     }
 
+    /// Sets the fold levels of consecutive lines starting at `first_line`, repainting once.
+    /// Levels past the last line of the document are ignored.
+    pub fn set_fold_levels(&self, first_line: i32, levels: &[i32]) {
+        let ptr = self.stc_ptr();
+        if ptr.is_null() || levels.is_empty() {
+            return;
+        }
+        unsafe { ffi::wxd_StyledTextCtrl_SetFoldLevels(ptr, first_line, levels.as_ptr(), levels.len()) };
+    }
+
     /// Get the fold level of a line
     pub fn get_fold_level(&self, line: i32) -> i32 {
         let ptr = self.stc_ptr();
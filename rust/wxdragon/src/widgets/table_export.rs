@@ -0,0 +1,180 @@
+//! Delimited-text export of [`Grid`] ranges and [`DataViewCtrl`] rows.
+//!
+//! Cells are read and formatted natively, so exporting a large table neither renders cells nor
+//! crosses the FFI boundary per cell. The `*_to` variants stream into any [`Write`] in chunks
+//! instead of building the whole text in memory.
+//!
+//! ```rust,no_run
+//! use wxdragon::prelude::*;
+//!
+//! # fn copy(grid: &Grid, file: std::fs::File) -> std::io::Result<()> {
+//! let blocks = grid.get_selected_blocks();
+//! grid.export_range_to(&blocks, TableExportFormat::csv(), std::io::BufWriter::new(file))
+//! # }
+//! ```
+
+use crate::WxWidget;
+use crate::utils::take_wxd_string;
+use crate::widgets::dataview::DataViewCtrl;
+use crate::widgets::grid::{Grid, GridBlockCoords};
+use std::ffi::c_void;
+use std::io::{self, Write};
+use wxdragon_sys as ffi;
+
+/// Layout of exported text.
+#[derive(Debug, Copy, Clone, PartialEq, Eq)]
+pub struct TableExportFormat {
+    /// Separates fields on a line.
+    pub delimiter: u8,
+    /// Encloses fields holding the delimiter, the quote or a line break, doubling quotes inside.
+    /// `None` replaces those characters with spaces instead.
+    pub quote: Option<u8>,
+    /// Starts with a line of column labels.
+    pub header: bool,
+    /// Grid only: starts each line with the row label.
+    pub row_labels: bool,
+    /// Ends lines with `\r\n` instead of `\n`.
+    pub crlf: bool,
+}
+
+impl TableExportFormat {
+    /// Tab-separated with a header, tabs and line breaks inside values turned into spaces; what
+    /// spreadsheets expect on the clipboard.
+    pub fn tsv() -> Self {
+        Self {
+            delimiter: b'\t',
+            quote: None,
+            header: true,
+            row_labels: false,
+            crlf: false,
+        }
+    }
+
+    /// Comma-separated with a header and double-quoted fields as in RFC 4180.
+    pub fn csv() -> Self {
+        Self {
+            delimiter: b',',
+            quote: Some(b'"'),
+            header: true,
+            row_labels: false,
+            crlf: true,
+        }
+    }
+
+    pub fn with_header(mut self, header: bool) -> Self {
+        self.header = header;
+        self
+    }
+
+    pub fn with_row_labels(mut self, row_labels: bool) -> Self {
+        self.row_labels = row_labels;
+        self
+    }
+
+    fn to_ffi(self) -> ffi::wxd_TableExportFormat {
+        ffi::wxd_TableExportFormat {
+            delimiter: self.delimiter as _,
+            quote: self.quote.unwrap_or(0) as _,
+            header: self.header,
+            row_labels: self.row_labels,
+            crlf: self.crlf,
+        }
+    }
+}
+
+impl Default for TableExportFormat {
+    fn default() -> Self {
+        Self::tsv()
+    }
+}
+
+fn to_ffi_blocks(blocks: &[GridBlockCoords]) -> Vec<ffi::wxd_GridBlockCoords> {
+    blocks
+        .iter()
+        .map(|b| ffi::wxd_GridBlockCoords {
+            top_row: b.top_row,
+            left_col: b.left_col,
+            bottom_row: b.bottom_row,
+            right_col: b.right_col,
+        })
+        .collect()
+}
+
+/// The writer behind a `*_to` export and the first error it returned.
+struct Sink<W: Write> {
+    writer: W,
+    error: Option<io::Error>,
+}
+
+unsafe extern "C" fn sink_write<W: Write>(userdata: *mut c_void, data: *const std::os::raw::c_char, len: usize) -> bool {
+    let sink = unsafe { &mut *(userdata as *mut Sink<W>) };
+    let bytes = unsafe { std::slice::from_raw_parts(data as *const u8, len) };
+    match sink.writer.write_all(bytes) {
+        Ok(()) => true,
+        Err(e) => {
+            sink.error = Some(e);
+            false
+        }
+    }
+}
+
+/// Runs `export` with a callback writing to `writer`, then flushes it.
+fn export_to<W: Write>(writer: W, export: impl FnOnce(ffi::wxd_table_export_write_fn, *mut c_void) -> bool) -> io::Result<()> {
+    let mut sink = Sink { writer, error: None };
+    let ok = export(Some(sink_write::<W>), &mut sink as *mut Sink<W> as *mut c_void);
+    if let Some(e) = sink.error {
+        return Err(e);
+    }
+    if !ok {
+        return Err(io::Error::other("table export failed"));
+    }
+    sink.writer.flush()
+}
+
+impl Grid {
+    /// The union of `blocks` as delimited text: every row and column any block covers, in
+    /// order, with cells outside all blocks left empty. Pass
+    /// [`get_selected_blocks`](Self::get_selected_blocks) to export the selection. `None` if
+    /// the grid has no table or `blocks` is empty.
+    pub fn export_range(&self, blocks: &[GridBlockCoords], format: TableExportFormat) -> Option<String> {
+        let ptr = self.grid_ptr();
+        if ptr.is_null() || blocks.is_empty() {
+            return None;
+        }
+        let raw = to_ffi_blocks(blocks);
+        let format = format.to_ffi();
+        unsafe { take_wxd_string(ffi::wxd_Grid_ExportRange(ptr, raw.as_ptr(), raw.len(), &format)) }
+    }
+
+    /// Like [`export_range`](Self::export_range), streaming the text into `writer`.
+    pub fn export_range_to<W: Write>(&self, blocks: &[GridBlockCoords], format: TableExportFormat, writer: W) -> io::Result<()> {
+        let ptr = self.grid_ptr();
+        if ptr.is_null() || blocks.is_empty() {
+            return Err(io::Error::new(io::ErrorKind::InvalidInput, "no grid or no blocks to export"));
+        }
+        let raw = to_ffi_blocks(blocks);
+        let format = format.to_ffi();
+        export_to(writer, |write, userdata| unsafe {
+            ffi::wxd_Grid_ExportRangeTo(ptr, raw.as_ptr(), raw.len(), &format, write, userdata)
+        })
+    }
+}
+
+impl DataViewCtrl {
+    /// The displayed rows (for tree models: those reachable through expanded nodes), or only
+    /// the selected ones, of the shown columns as delimited text. Values use their string form;
+    /// the header holds the column titles and `row_labels` is ignored.
+    pub fn export_rows(&self, selected_only: bool, format: TableExportFormat) -> Option<String> {
+        let format = format.to_ffi();
+        unsafe { take_wxd_string(ffi::wxd_DataViewCtrl_ExportRows(self.handle_ptr(), selected_only, &format)) }
+    }
+
+    /// Like [`export_rows`](Self::export_rows), streaming the text into `writer`.
+    pub fn export_rows_to<W: Write>(&self, selected_only: bool, format: TableExportFormat, writer: W) -> io::Result<()> {
+        let ptr = self.handle_ptr();
+        let format = format.to_ffi();
+        export_to(writer, |write, userdata| unsafe {
+            ffi::wxd_DataViewCtrl_ExportRowsTo(ptr, selected_only, &format, write, userdata)
+        })
+    }
+}
@@ -109,6 +109,8 @@ impl TaskBarIcon {
 
     /// Sets the taskbar icon and tooltip.
     ///
+    /// Setting the same pixels and tooltip again is cheap: the platform icon is left alone.
+    ///
     /// # Arguments
     /// * `icon` - The bitmap to display as the taskbar icon
     /// * `tooltip` - Optional tooltip text to show when hovering over the icon
@@ -133,6 +135,18 @@ impl TaskBarIcon {
         unsafe { ffi::wxd_TaskBarIcon_SetIconBundle(self.ptr.get(), icon_bundle.as_ptr(), c_tooltip.as_ptr()) }
     }
 
+    /// Cycles the icon through `frames`, one every `interval_ms`, keeping the current tooltip.
+    ///
+    /// The frames are converted to native icons once here, so each tick only swaps icons.
+    /// An empty slice stops the animation; [`set_icon`](Self::set_icon),
+    /// [`set_icon_bundle`](Self::set_icon_bundle) and [`remove_icon`](Self::remove_icon)
+    /// stop it as well.
+    pub fn set_animation_frames(&self, frames: &[Bitmap], interval_ms: u32) -> bool {
+        let ptrs: Vec<*const ffi::wxd_Bitmap_t> = frames.iter().map(Bitmap::as_const_ptr).collect();
+        let interval = i32::try_from(interval_ms).unwrap_or(i32::MAX);
+        unsafe { ffi::wxd_TaskBarIcon_SetAnimationFrames(self.ptr.get(), ptrs.as_ptr(), ptrs.len() as i32, interval) }
+    }
+
     /// Removes the taskbar icon.
     ///
     /// # Returns
@@ -5,6 +5,7 @@ use crate::event::TextEvents;
 use crate::event::{Event, EventType, WxEvtHandler};
 use crate::geometry::{Point, Size};
 use crate::id::Id;
+use crate::utils::take_wxd_string;
 use crate::window::{WindowHandle, WxWidget};
 // Window is used by new_from_composition for backwards compatibility
 #[allow(unused_imports)]
@@ -196,7 +197,7 @@ impl TextCtrl {
         if ptr.is_null() {
             return String::new();
         }
-        unsafe { Self::read_string_with_retry(|buf, len| ffi::wxd_TextCtrl_GetValue(ptr, buf, len)) }
+        unsafe { take_wxd_string(ffi::wxd_TextCtrl_GetValueOwned(ptr)) }.unwrap_or_default()
     }
 
     /// Appends text to the end of the control.
@@ -210,6 +211,49 @@ impl TextCtrl {
         unsafe { ffi::wxd_TextCtrl_AppendText(ptr, c_text.as_ptr()) };
     }
 
+    /// Switches to console (tail) mode for high-rate logging.
+    ///
+    /// Text passed to [`Self::console_append`] is buffered and written once per frame inside a
+    /// single freeze, the oldest lines are dropped beyond `max_lines` (0 keeps everything), and
+    /// the view follows new output only while the caret is at the end, so scrolling back to read
+    /// is not interrupted. Calling it again only changes `max_lines`.
+    pub fn enable_console_mode(&self, max_lines: usize) {
+        let ptr = self.textctrl_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        let max_lines = i32::try_from(max_lines).unwrap_or(i32::MAX);
+        unsafe { ffi::wxd_TextCtrl_SetConsoleMode(ptr, true, max_lines) };
+    }
+
+    /// Leaves console mode, writing any buffered text first.
+    pub fn disable_console_mode(&self) {
+        let ptr = self.textctrl_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_TextCtrl_SetConsoleMode(ptr, false, 0) };
+    }
+
+    /// Appends log output: buffered until the next frame in console mode, immediate otherwise.
+    /// Include the trailing newline of each line.
+    pub fn console_append(&self, text: &str) {
+        let ptr = self.textctrl_ptr();
+        if ptr.is_null() || text.is_empty() {
+            return;
+        }
+        unsafe { ffi::wxd_TextCtrl_ConsoleAppend(ptr, text.as_ptr() as *const c_char, text.len()) };
+    }
+
+    /// Writes buffered console output now instead of at the next frame.
+    pub fn console_flush(&self) {
+        let ptr = self.textctrl_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_TextCtrl_ConsoleFlush(ptr) };
+    }
+
     /// Clears the text in the control.
     /// No-op if the control has been destroyed.
     pub fn clear(&self) {
@@ -392,6 +436,17 @@ impl TextCtrl {
         unsafe { ffi::wxd_TextCtrl_SetMaxLength(ptr, len as i64) };
     }
 
+    /// Drives this control's autocompletion popup from `index`, replacing any previous completer;
+    /// `None` turns autocompletion off.
+    /// No-op if the control has been destroyed.
+    pub fn set_completion_index(&self, index: Option<&crate::widgets::CompletionIndex>) {
+        let ptr = self.textctrl_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_TextCtrl_SetCompletionIndex(ptr, crate::widgets::completion_index::raw_index(index)) };
+    }
+
     /// Returns the last position in the control.
     /// Returns 0 if the control has been destroyed.
     pub fn get_last_position(&self) -> i64 {
@@ -496,6 +551,28 @@ impl TextCtrl {
         unsafe { ffi::wxd_TextCtrl_SetStyle(ptr, start, end, style.as_ptr()) };
     }
 
+    /// Styles many ranges at once: each `(start, end, index)` run gets `palette[index]`.
+    ///
+    /// Runs are applied under a single freeze, with the selection, insertion point and scroll
+    /// position restored afterwards, so colourizing a long output pane repaints once. Runs with
+    /// an index outside `palette` are skipped. Returns the number of runs applied.
+    pub fn set_style_runs(&self, runs: &[(i64, i64, usize)], palette: &[&TextAttr]) -> usize {
+        let ptr = self.textctrl_ptr();
+        if ptr.is_null() || runs.is_empty() {
+            return 0;
+        }
+        let runs: Vec<ffi::wxd_TextStyleRun> = runs
+            .iter()
+            .map(|&(start, end, index)| ffi::wxd_TextStyleRun {
+                start,
+                end,
+                attr: u32::try_from(index).unwrap_or(u32::MAX),
+            })
+            .collect();
+        let palette: Vec<*const ffi::wxd_TextAttr_t> = palette.iter().map(|attr| attr.as_ptr() as *const _).collect();
+        unsafe { ffi::wxd_TextCtrl_SetStyleRuns(ptr, runs.as_ptr(), runs.len(), palette.as_ptr(), palette.len()) }
+    }
+
     /// Returns the default style currently used for new text.
     /// Returns None if the control has been destroyed.
     pub fn get_default_style(&self) -> Option<TextAttr> {
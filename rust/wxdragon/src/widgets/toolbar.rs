@@ -78,6 +78,105 @@ impl ToolBarEventData {
     }
 }
 
+/// One tool for [`ToolBar::add_tools`] and, with the `aui` feature, `AuiToolBar::add_tools`.
+#[derive(Clone, Copy)]
+pub struct ToolDesc<'a> {
+    pub id: Id,
+    pub kind: ItemKind,
+    pub label: &'a str,
+    pub short_help: &'a str,
+    pub long_help: &'a str,
+    /// Takes precedence over `bitmap`.
+    pub bundle: Option<&'a BitmapBundle>,
+    pub bundle_disabled: Option<&'a BitmapBundle>,
+    pub bitmap: Option<&'a Bitmap>,
+    pub bitmap_disabled: Option<&'a Bitmap>,
+}
+
+impl<'a> ToolDesc<'a> {
+    /// A normal tool showing `bundle`.
+    pub fn new(id: Id, label: &'a str, bundle: &'a BitmapBundle) -> Self {
+        Self {
+            label,
+            bundle: Some(bundle),
+            ..Self::empty(id, ItemKind::Normal)
+        }
+    }
+
+    /// A normal tool showing `bitmap`.
+    pub fn with_bitmap(id: Id, label: &'a str, bitmap: &'a Bitmap) -> Self {
+        Self {
+            label,
+            bitmap: Some(bitmap),
+            ..Self::empty(id, ItemKind::Normal)
+        }
+    }
+
+    pub fn separator() -> Self {
+        Self::empty(crate::menus::menuitem::ID_SEPARATOR, ItemKind::Separator)
+    }
+
+    pub fn kind(mut self, kind: ItemKind) -> Self {
+        self.kind = kind;
+        self
+    }
+
+    pub fn short_help(mut self, help: &'a str) -> Self {
+        self.short_help = help;
+        self
+    }
+
+    pub fn long_help(mut self, help: &'a str) -> Self {
+        self.long_help = help;
+        self
+    }
+
+    pub fn bundle_disabled(mut self, bundle: &'a BitmapBundle) -> Self {
+        self.bundle_disabled = Some(bundle);
+        self
+    }
+
+    fn empty(id: Id, kind: ItemKind) -> Self {
+        Self {
+            id,
+            kind,
+            label: "",
+            short_help: "",
+            long_help: "",
+            bundle: None,
+            bundle_disabled: None,
+            bitmap: None,
+            bitmap_disabled: None,
+        }
+    }
+}
+
+/// Converts `tools` for the C API; the strings must outlive the descriptions.
+pub(crate) fn pack_tool_descs(tools: &[ToolDesc<'_>]) -> (Vec<CString>, Vec<ffi::wxd_ToolDesc>) {
+    let mut strings = Vec::with_capacity(tools.len() * 3);
+    let mut descs = Vec::with_capacity(tools.len());
+    for tool in tools {
+        let mut text = |s: &str| {
+            let c = CString::new(s).unwrap_or_default();
+            let ptr = c.as_ptr();
+            strings.push(c);
+            ptr
+        };
+        descs.push(ffi::wxd_ToolDesc {
+            id: tool.id,
+            kind: i32::from(tool.kind) as c_int,
+            label: text(tool.label),
+            short_help: text(tool.short_help),
+            long_help: text(tool.long_help),
+            bundle: tool.bundle.map_or(std::ptr::null(), |b| b.as_ptr() as *const _),
+            bundle_disabled: tool.bundle_disabled.map_or(std::ptr::null(), |b| b.as_ptr() as *const _),
+            bitmap: tool.bitmap.map_or(std::ptr::null(), |b| b.as_const_ptr()),
+            bitmap_disabled: tool.bitmap_disabled.map_or(std::ptr::null(), |b| b.as_const_ptr()),
+        });
+    }
+    (strings, descs)
+}
+
 /// Represents a wxToolBar control.
 ///
 /// ToolBar uses `WindowHandle` internally for safe memory management.
@@ -358,6 +457,38 @@ impl ToolBar {
         }
     }
 
+    /// Adds all `tools` and realizes the toolbar once, instead of one call per tool and a
+    /// realize per change. Tools showing the same bundle or bitmap share one native bundle.
+    /// Returns the number of tools added.
+    pub fn add_tools(&self, tools: &[ToolDesc<'_>]) -> usize {
+        let ptr = self.toolbar_ptr();
+        if ptr.is_null() {
+            return 0;
+        }
+        let (_strings, descs) = pack_tool_descs(tools);
+        unsafe { ffi::wxd_ToolBar_AddTools(ptr, descs.as_ptr(), descs.len()) }
+    }
+
+    /// Shows or hides tools by id. Only tools whose visibility changes are touched, a tool
+    /// shown again returns to its original place, and the toolbar is realized once.
+    /// Returns the number of tools changed.
+    pub fn set_tools_visible(&self, tools: &[(Id, bool)]) -> usize {
+        let ptr = self.toolbar_ptr();
+        if ptr.is_null() {
+            return 0;
+        }
+        let ids: Vec<Id> = tools.iter().map(|(id, _)| *id).collect();
+        let visible: Vec<bool> = tools.iter().map(|(_, visible)| *visible).collect();
+        unsafe { ffi::wxd_ToolBar_SetToolsVisible(ptr, ids.as_ptr(), visible.as_ptr(), ids.len()) }
+    }
+
+    /// Whether the tool is on the toolbar and not hidden by
+    /// [`set_tools_visible`](Self::set_tools_visible).
+    pub fn is_tool_visible(&self, tool_id: Id) -> bool {
+        let ptr = self.toolbar_ptr();
+        !ptr.is_null() && unsafe { ffi::wxd_ToolBar_IsToolVisible(ptr, tool_id) }
+    }
+
     /// Gets a tool by its XRC name.
     /// Returns a Tool wrapper that can be used for event binding and operations.
     /// Returns None if the toolbar has been destroyed or the tool name is not found.
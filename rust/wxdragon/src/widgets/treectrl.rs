@@ -62,7 +62,11 @@
 //! ```
 
 use std::any::Any;
+use std::cell::RefCell;
 use std::ffi::CString;
+use std::num::NonZeroUsize;
+use std::os::raw::{c_char, c_void};
+use std::panic::{self, AssertUnwindSafe};
 use std::ptr;
 use std::sync::Arc;
 
@@ -184,6 +188,242 @@ impl TreeItemId {
     }
 }
 
+impl TreeItemId {
+    /// The allocation-free value form of this item, `None` if it is not valid.
+    pub fn handle(&self) -> Option<TreeItemHandle> {
+        TreeItemHandle::from_raw(unsafe { ffi::wxd_TreeItemId_GetHandle(self.ptr) })
+    }
+}
+
+/// A tree item by value: `Copy`, with nothing to allocate or free, for walking large trees.
+///
+/// Only meaningful while the item exists in its tree; convert with
+/// [`TreeCtrl::item_id_from_handle`] for the APIs taking a [`TreeItemId`].
+#[derive(Debug, Copy, Clone, PartialEq, Eq, Hash)]
+pub struct TreeItemHandle(NonZeroUsize);
+
+impl TreeItemHandle {
+    pub(crate) fn from_raw(raw: ffi::wxd_TreeItemHandle) -> Option<Self> {
+        NonZeroUsize::new(raw as usize).map(Self)
+    }
+
+    fn raw(self) -> ffi::wxd_TreeItemHandle {
+        self.0.get() as ffi::wxd_TreeItemHandle
+    }
+}
+
+/// A flattened copy of a subtree, see [`TreeCtrl::get_subtree`] and
+/// [`TreeListCtrl::get_subtree`](crate::widgets::treelistctrl::TreeListCtrl::get_subtree).
+/// Nodes are in pre-order, starting with the item the walk began at.
+pub struct TreeSubtree {
+    ptr: *mut ffi::wxd_TreeSubtree_t,
+    nodes: *const ffi::wxd_TreeNode,
+    count: usize,
+    text: *const c_char,
+    text_len: usize,
+}
+
+impl TreeSubtree {
+    pub(crate) unsafe fn from_ptr(ptr: *mut ffi::wxd_TreeSubtree_t) -> Option<Self> {
+        if ptr.is_null() {
+            return None;
+        }
+        let mut count = 0;
+        let mut text_len = 0;
+        let nodes = unsafe { ffi::wxd_TreeSubtree_GetNodes(ptr, &mut count) };
+        let text = unsafe { ffi::wxd_TreeSubtree_GetText(ptr, &mut text_len) };
+        Some(Self {
+            ptr,
+            nodes,
+            count,
+            text,
+            text_len,
+        })
+    }
+
+    pub fn len(&self) -> usize {
+        self.count
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.count == 0
+    }
+
+    pub fn get(&self, index: usize) -> Option<TreeSubtreeNode<'_>> {
+        if index >= self.count {
+            return None;
+        }
+        let node = unsafe { &*self.nodes.add(index) };
+        let text = unsafe { std::slice::from_raw_parts(self.text as *const u8, self.text_len) };
+        let start = node.label_offset as usize;
+        let label = text
+            .get(start..start + node.label_len as usize)
+            .and_then(|bytes| std::str::from_utf8(bytes).ok());
+        Some(TreeSubtreeNode {
+            item: node.item,
+            parent: usize::try_from(node.parent).ok(),
+            label: label.unwrap_or_default(),
+            image: (node.image >= 0).then_some(node.image),
+            state: node.state,
+        })
+    }
+
+    pub fn iter(&self) -> impl Iterator<Item = TreeSubtreeNode<'_>> + '_ {
+        (0..self.count).filter_map(|index| self.get(index))
+    }
+}
+
+impl Drop for TreeSubtree {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_TreeSubtree_Free(self.ptr) };
+    }
+}
+
+/// One node of a [`TreeSubtree`].
+#[derive(Debug, Clone, Copy)]
+pub struct TreeSubtreeNode<'a> {
+    item: u64,
+    /// Index of the parent node, `None` for the first node.
+    pub parent: Option<usize>,
+    pub label: &'a str,
+    pub image: Option<i32>,
+    state: u32,
+}
+
+impl TreeSubtreeNode<'_> {
+    /// The node as a [`TreeCtrl`] item.
+    pub fn handle(&self) -> Option<TreeItemHandle> {
+        TreeItemHandle::from_raw(self.item as ffi::wxd_TreeItemHandle)
+    }
+
+    /// The node as a [`TreeListCtrl`](crate::widgets::treelistctrl::TreeListCtrl) item.
+    pub fn tree_list_item(&self) -> crate::widgets::treelistctrl::TreeListItem {
+        crate::widgets::treelistctrl::TreeListItem::new(self.item as i64)
+    }
+
+    fn has(&self, flag: ffi::wxd_TreeNodeState) -> bool {
+        self.state & flag as u32 != 0
+    }
+
+    pub fn is_expanded(&self) -> bool {
+        self.has(ffi::wxd_TreeNodeState_WXD_TREE_NODE_EXPANDED)
+    }
+
+    pub fn is_selected(&self) -> bool {
+        self.has(ffi::wxd_TreeNodeState_WXD_TREE_NODE_SELECTED)
+    }
+
+    pub fn has_children(&self) -> bool {
+        self.has(ffi::wxd_TreeNodeState_WXD_TREE_NODE_HAS_CHILDREN)
+    }
+
+    pub fn is_bold(&self) -> bool {
+        self.has(ffi::wxd_TreeNodeState_WXD_TREE_NODE_BOLD)
+    }
+
+    pub fn is_checked(&self) -> bool {
+        self.has(ffi::wxd_TreeNodeState_WXD_TREE_NODE_CHECKED)
+    }
+
+    pub fn is_undetermined(&self) -> bool {
+        self.has(ffi::wxd_TreeNodeState_WXD_TREE_NODE_UNDETERMINED)
+    }
+}
+
+/// Per-node options for [`TreeSubtreeBuilder::push_with`].
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct TreeNodeOptions {
+    pub image: Option<i32>,
+    pub expanded: bool,
+    pub selected: bool,
+    /// Shows an expand button even without children, e.g. for lazily filled nodes.
+    pub has_children: bool,
+    /// TreeCtrl only.
+    pub bold: bool,
+    /// TreeListCtrl only.
+    pub checked: bool,
+}
+
+/// A hierarchy to build in one call with [`TreeCtrl::insert_subtree`] or
+/// [`TreeListCtrl::insert_subtree`](crate::widgets::treelistctrl::TreeListCtrl::insert_subtree).
+#[derive(Debug, Clone, Default)]
+pub struct TreeSubtreeBuilder {
+    nodes: Vec<ffi::wxd_TreeNode>,
+    text: String,
+}
+
+impl TreeSubtreeBuilder {
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Adds a node under an earlier node, or under the insertion parent for `None`, and
+    /// returns its index.
+    pub fn push(&mut self, parent: Option<usize>, label: &str) -> usize {
+        self.push_with(parent, label, TreeNodeOptions::default())
+    }
+
+    pub fn push_with(&mut self, parent: Option<usize>, label: &str, options: TreeNodeOptions) -> usize {
+        let flag = |on: bool, flag: ffi::wxd_TreeNodeState| if on { flag as u32 } else { 0 };
+        let state = flag(options.expanded, ffi::wxd_TreeNodeState_WXD_TREE_NODE_EXPANDED)
+            | flag(options.selected, ffi::wxd_TreeNodeState_WXD_TREE_NODE_SELECTED)
+            | flag(options.has_children, ffi::wxd_TreeNodeState_WXD_TREE_NODE_HAS_CHILDREN)
+            | flag(options.bold, ffi::wxd_TreeNodeState_WXD_TREE_NODE_BOLD)
+            | flag(options.checked, ffi::wxd_TreeNodeState_WXD_TREE_NODE_CHECKED);
+        let index = self.nodes.len();
+        self.nodes.push(ffi::wxd_TreeNode {
+            item: 0,
+            // A parent that is not an earlier node makes the whole insert fail.
+            parent: parent.map_or(-1, |parent| i32::try_from(parent).unwrap_or(i32::MAX)),
+            image: options.image.unwrap_or(-1),
+            label_offset: self.text.len() as u32,
+            label_len: label.len() as u32,
+            state,
+        });
+        self.text.push_str(label);
+        index
+    }
+
+    pub fn len(&self) -> usize {
+        self.nodes.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.nodes.is_empty()
+    }
+
+    pub(crate) fn nodes(&self) -> &[ffi::wxd_TreeNode] {
+        &self.nodes
+    }
+
+    pub(crate) fn text(&self) -> &str {
+        &self.text
+    }
+}
+
+/// Iterator over the direct children of an item, see [`TreeCtrl::child_handles`].
+pub struct TreeChildHandles<'a> {
+    tree: &'a TreeCtrl,
+    parent: ffi::wxd_TreeItemHandle,
+    cookie: *mut c_void,
+    next: Option<TreeItemHandle>,
+}
+
+impl Iterator for TreeChildHandles<'_> {
+    type Item = TreeItemHandle;
+
+    fn next(&mut self) -> Option<TreeItemHandle> {
+        let current = self.next?;
+        let ptr = self.tree.treectrl_ptr();
+        self.next = if ptr.is_null() {
+            None
+        } else {
+            TreeItemHandle::from_raw(unsafe { ffi::wxd_TreeCtrl_GetNextChildHandle(ptr, self.parent, &mut self.cookie) })
+        };
+        Some(current)
+    }
+}
+
 impl Clone for TreeItemId {
     fn clone(&self) -> Self {
         let clone_ptr = unsafe { ffi::wxd_TreeItemId_Clone(self.ptr) };
@@ -773,6 +1013,18 @@ impl TreeCtrl {
         unsafe { ffi::wxd_TreeCtrl_SelectAll(ptr) }
     }
 
+    /// Selects `items` in one frozen pass, after clearing the selection if `replace`;
+    /// single-selection trees take the first item. Instead of a changing/changed pair per
+    /// item, one selection-changed event for the last selected item is sent at the end.
+    pub fn select_items(&self, items: &[TreeItemHandle], replace: bool) {
+        let ptr = self.treectrl_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        let raw: Vec<ffi::wxd_TreeItemHandle> = items.iter().map(|item| item.raw()).collect();
+        unsafe { ffi::wxd_TreeCtrl_SelectItems(ptr, raw.as_ptr(), raw.len(), replace) }
+    }
+
     /// Gets all selected items (for multi-selection trees).
     pub fn get_selections(&self) -> Vec<TreeItemId> {
         let ptr = self.treectrl_ptr();
@@ -1011,6 +1263,41 @@ impl TreeCtrl {
         unsafe { ffi::wxd_TreeCtrl_SortChildren(ptr, item.as_ptr()) }
     }
 
+    /// Sorts the children of `parent` by precomputed keys in one native pass, without a
+    /// callback per comparison. `keys` holds one key per child in current child order (with
+    /// `recursive`, one per descendant in the pre-order of [`get_subtree`](Self::get_subtree)
+    /// and every level is sorted). Keys compare bytewise, so pass collation keys for
+    /// locale-aware order; equal keys keep their order.
+    ///
+    /// Returns false, leaving the tree unchanged, if the number of keys does not match.
+    pub fn sort_children_by_keys<K: AsRef<[u8]>>(&self, parent: TreeItemHandle, keys: &[K], recursive: bool) -> bool {
+        let ptr = self.treectrl_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        let mut blob = Vec::new();
+        let mut offsets = Vec::with_capacity(keys.len() + 1);
+        offsets.push(0u32);
+        for key in keys {
+            blob.extend_from_slice(key.as_ref());
+            let Ok(end) = u32::try_from(blob.len()) else {
+                return false;
+            };
+            offsets.push(end);
+        }
+        unsafe {
+            ffi::wxd_TreeCtrl_SortChildrenByKeys(
+                ptr,
+                parent.raw(),
+                blob.as_ptr(),
+                blob.len(),
+                offsets.as_ptr(),
+                keys.len(),
+                recursive,
+            )
+        }
+    }
+
     /// Sets whether the item has a button (+/-) to expand/collapse.
     pub fn set_item_has_children(&self, item: &TreeItemId, has: bool) {
         let ptr = self.treectrl_ptr();
@@ -1020,6 +1307,227 @@ impl TreeCtrl {
         unsafe { ffi::wxd_TreeCtrl_SetItemHasChildren(ptr, item.as_ptr(), has) }
     }
 
+    // --- Value handles ---
+
+    /// Converts a handle back into a [`TreeItemId`].
+    pub fn item_id_from_handle(&self, handle: TreeItemHandle) -> Option<TreeItemId> {
+        unsafe { TreeItemId::from_ptr(ffi::wxd_TreeItemId_FromHandle(handle.raw())) }
+    }
+
+    fn handle_query(&self, query: impl FnOnce(*mut ffi::wxd_TreeCtrl_t) -> ffi::wxd_TreeItemHandle) -> Option<TreeItemHandle> {
+        let ptr = self.treectrl_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        TreeItemHandle::from_raw(query(ptr))
+    }
+
+    pub fn get_root_item_handle(&self) -> Option<TreeItemHandle> {
+        self.handle_query(|ptr| unsafe { ffi::wxd_TreeCtrl_GetRootItemHandle(ptr) })
+    }
+
+    pub fn get_selection_handle(&self) -> Option<TreeItemHandle> {
+        self.handle_query(|ptr| unsafe { ffi::wxd_TreeCtrl_GetSelectionHandle(ptr) })
+    }
+
+    pub fn get_focused_item_handle(&self) -> Option<TreeItemHandle> {
+        self.handle_query(|ptr| unsafe { ffi::wxd_TreeCtrl_GetFocusedItemHandle(ptr) })
+    }
+
+    /// The direct children of `item`, without allocating per child.
+    pub fn child_handles(&self, item: TreeItemHandle) -> TreeChildHandles<'_> {
+        let mut cookie = ptr::null_mut();
+        let next = self.handle_query(|ptr| unsafe { ffi::wxd_TreeCtrl_GetFirstChildHandle(ptr, item.raw(), &mut cookie) });
+        TreeChildHandles {
+            tree: self,
+            parent: item.raw(),
+            cookie,
+            next,
+        }
+    }
+
+    pub fn get_last_child_handle(&self, item: TreeItemHandle) -> Option<TreeItemHandle> {
+        self.handle_query(|ptr| unsafe { ffi::wxd_TreeCtrl_GetLastChildHandle(ptr, item.raw()) })
+    }
+
+    pub fn get_next_sibling_handle(&self, item: TreeItemHandle) -> Option<TreeItemHandle> {
+        self.handle_query(|ptr| unsafe { ffi::wxd_TreeCtrl_GetNextSiblingHandle(ptr, item.raw()) })
+    }
+
+    pub fn get_prev_sibling_handle(&self, item: TreeItemHandle) -> Option<TreeItemHandle> {
+        self.handle_query(|ptr| unsafe { ffi::wxd_TreeCtrl_GetPrevSiblingHandle(ptr, item.raw()) })
+    }
+
+    pub fn get_item_parent_handle(&self, item: TreeItemHandle) -> Option<TreeItemHandle> {
+        self.handle_query(|ptr| unsafe { ffi::wxd_TreeCtrl_GetItemParentHandle(ptr, item.raw()) })
+    }
+
+    /// Text of the item behind `item`.
+    pub fn get_item_text_by_handle(&self, item: TreeItemHandle) -> Option<String> {
+        let ptr = self.treectrl_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        let len = unsafe { ffi::wxd_TreeCtrl_GetItemTextByHandle(ptr, item.raw(), ptr::null_mut(), 0) };
+        if len < 0 {
+            return None;
+        }
+        let mut buffer: Vec<u8> = vec![0; len as usize + 1];
+        let len =
+            unsafe { ffi::wxd_TreeCtrl_GetItemTextByHandle(ptr, item.raw(), buffer.as_mut_ptr() as *mut c_char, buffer.len()) };
+        if len < 0 {
+            return None;
+        }
+        buffer.truncate(len as usize);
+        String::from_utf8(buffer).ok()
+    }
+
+    /// Custom data of the item behind `item`, as stored by [`HasItemData`].
+    pub fn get_custom_data_by_handle(&self, item: TreeItemHandle) -> Option<Arc<dyn Any + Send + Sync>> {
+        let ptr = self.treectrl_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        let data_id = unsafe { ffi::wxd_TreeCtrl_GetItemDataByHandle(ptr, item.raw()) as u64 };
+        if data_id == 0 { None } else { get_item_data(data_id) }
+    }
+
+    pub fn item_has_children_by_handle(&self, item: TreeItemHandle) -> bool {
+        let ptr = self.treectrl_ptr();
+        !ptr.is_null() && unsafe { ffi::wxd_TreeCtrl_ItemHasChildrenByHandle(ptr, item.raw()) }
+    }
+
+    pub fn is_expanded_by_handle(&self, item: TreeItemHandle) -> bool {
+        let ptr = self.treectrl_ptr();
+        !ptr.is_null() && unsafe { ffi::wxd_TreeCtrl_IsExpandedByHandle(ptr, item.raw()) }
+    }
+
+    /// Copies `item` and its descendants, down to `depth` levels below it (`None`: all), in
+    /// one call.
+    pub fn get_subtree(&self, item: TreeItemHandle, depth: Option<usize>) -> Option<TreeSubtree> {
+        let ptr = self.treectrl_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        let depth = depth.map_or(-1, |depth| i32::try_from(depth).unwrap_or(i32::MAX));
+        unsafe { TreeSubtree::from_ptr(ffi::wxd_TreeCtrl_GetSubtree(ptr, item.raw(), depth)) }
+    }
+
+    /// Builds `nodes` under `parent` in one frozen pass; with `None` on an empty tree the first
+    /// top-level node becomes the root. Returns the created items, in node order.
+    pub fn insert_subtree(&self, parent: Option<TreeItemHandle>, nodes: &TreeSubtreeBuilder) -> Vec<TreeItemHandle> {
+        let ptr = self.treectrl_ptr();
+        if ptr.is_null() || nodes.is_empty() {
+            return Vec::new();
+        }
+        let mut created: Vec<ffi::wxd_TreeItemHandle> = vec![0; nodes.len()];
+        let text = nodes.text();
+        let inserted = unsafe {
+            ffi::wxd_TreeCtrl_InsertSubtree(
+                ptr,
+                parent.map_or(0, TreeItemHandle::raw),
+                nodes.nodes().as_ptr(),
+                nodes.len(),
+                text.as_ptr() as *const c_char,
+                text.len(),
+                created.as_mut_ptr(),
+            )
+        };
+        created.truncate(inserted);
+        created.into_iter().filter_map(TreeItemHandle::from_raw).collect()
+    }
+
+    /// Turns on lazily populated children: the first time a lazy node (see
+    /// [`append_lazy_item`](Self::append_lazy_item) and [`set_lazy_item`](Self::set_lazy_item))
+    /// expands, `children(parent_key, batch)` is asked for that level in one batch.
+    ///
+    /// With a non-zero `release_budget`, collapsed lazy nodes keep their children only while
+    /// those add up to at most that many items; beyond it the least recently collapsed nodes
+    /// are reset and refilled when expanded again. Replaces a callback installed before.
+    pub fn enable_lazy_children<F>(&self, release_budget: usize, children: F) -> bool
+    where
+        F: Fn(i64, &mut LazyTreeChildren) + 'static,
+    {
+        let ptr = self.treectrl_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        let raw = Box::into_raw(Box::new(LazyChildrenCallback {
+            callback: Box::new(children),
+            batch: RefCell::new(LazyTreeChildren::default()),
+        }));
+        let result = unsafe {
+            ffi::wxd_TreeCtrl_EnableLazyChildren(
+                ptr,
+                raw as *mut c_void,
+                Some(treectrl_lazy_children),
+                Some(treectrl_drop_lazy_children),
+                release_budget,
+            )
+        };
+        if !result {
+            unsafe { drop(Box::from_raw(raw)) };
+        }
+        result
+    }
+
+    /// Turns lazy population off; lazy nodes keep their key and current children.
+    pub fn disable_lazy_children(&self) {
+        let ptr = self.treectrl_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_TreeCtrl_DisableLazyChildren(ptr) }
+    }
+
+    /// Appends a lazy node identified by `key`; with `has_children` it shows an expand button
+    /// and gets its children from the lazy-children callback.
+    pub fn append_lazy_item(
+        &self,
+        parent: &TreeItemId,
+        text: &str,
+        key: i64,
+        has_children: bool,
+        image: Option<i32>,
+    ) -> Option<TreeItemId> {
+        let ptr = self.treectrl_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        let t = CString::new(text).unwrap_or_default();
+        let img = image.unwrap_or(-1);
+        let item_ptr = unsafe { ffi::wxd_TreeCtrl_AppendLazyItem(ptr, parent.as_ptr(), t.as_ptr(), img, img, key, has_children) };
+        unsafe { TreeItemId::from_ptr(item_ptr) }
+    }
+
+    /// Makes an existing item, typically the root, a lazy node. Custom data is kept.
+    pub fn set_lazy_item(&self, item: &TreeItemId, key: i64, has_children: bool) -> bool {
+        let ptr = self.treectrl_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        unsafe { ffi::wxd_TreeCtrl_SetLazyItem(ptr, item.as_ptr(), key, has_children) }
+    }
+
+    /// The key of a lazy node, `None` for other items.
+    pub fn lazy_item_key(&self, item: &TreeItemId) -> Option<i64> {
+        let ptr = self.treectrl_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        let mut key = 0i64;
+        unsafe { ffi::wxd_TreeCtrl_GetLazyItemKey(ptr, item.as_ptr(), &mut key) }.then_some(key)
+    }
+
+    /// Drops the children of a lazy node so its next expansion asks for them again.
+    pub fn reset_lazy_item(&self, item: &TreeItemId) {
+        let ptr = self.treectrl_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_TreeCtrl_ResetLazyItem(ptr, item.as_ptr()) }
+    }
+
     /// Hit test - returns the item at the given point along with flags.
     pub fn hit_test(&self, point: Point) -> (Option<TreeItemId>, TreeHitTestFlags) {
         let ptr = self.treectrl_ptr();
@@ -1054,6 +1562,90 @@ impl TreeCtrl {
 }
 
 // Implement HasItemData trait for TreeCtrl
+/// One level of children returned by a lazy-children callback, see
+/// [`TreeCtrl::enable_lazy_children`]. Reused between calls.
+#[derive(Debug, Default)]
+pub struct LazyTreeChildren {
+    text: String,
+    offsets: Vec<u32>,
+    images: Vec<i32>,
+    has_children: Vec<bool>,
+    keys: Vec<i64>,
+}
+
+impl LazyTreeChildren {
+    /// Adds a child labelled `text`. Children with `has_children` are lazy nodes themselves.
+    pub fn push(&mut self, text: &str, key: i64, has_children: bool, image: Option<i32>) {
+        if self.offsets.is_empty() {
+            self.offsets.push(0);
+        }
+        self.text.push_str(text);
+        self.offsets.push(self.text.len() as u32);
+        self.images.push(image.unwrap_or(-1));
+        self.has_children.push(has_children);
+        self.keys.push(key);
+    }
+
+    /// Number of children added.
+    pub fn len(&self) -> usize {
+        self.keys.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.keys.is_empty()
+    }
+
+    fn clear(&mut self) {
+        self.text.clear();
+        self.offsets.clear();
+        self.images.clear();
+        self.has_children.clear();
+        self.keys.clear();
+    }
+}
+
+struct LazyChildrenCallback {
+    callback: Box<dyn Fn(i64, &mut LazyTreeChildren)>,
+    // Backs the arrays handed to C++ until the next call.
+    batch: RefCell<LazyTreeChildren>,
+}
+
+unsafe extern "C" fn treectrl_lazy_children(
+    userdata: *mut c_void,
+    parent_key: i64,
+    _parent: *const ffi::wxd_TreeItemId_t,
+    out: *mut ffi::wxd_TreeLazyChildren,
+) -> bool {
+    if userdata.is_null() || out.is_null() {
+        return false;
+    }
+    let data = unsafe { &*(userdata as *const LazyChildrenCallback) };
+    let Ok(mut batch) = data.batch.try_borrow_mut() else {
+        return false;
+    };
+    batch.clear();
+    if panic::catch_unwind(AssertUnwindSafe(|| (data.callback)(parent_key, &mut batch))).is_err() || batch.is_empty() {
+        return false;
+    }
+    unsafe {
+        *out = ffi::wxd_TreeLazyChildren {
+            count: batch.len(),
+            text: batch.text.as_ptr() as *const c_char,
+            offsets: batch.offsets.as_ptr(),
+            images: batch.images.as_ptr(),
+            has_children: batch.has_children.as_ptr(),
+            keys: batch.keys.as_ptr(),
+        };
+    }
+    true
+}
+
+unsafe extern "C" fn treectrl_drop_lazy_children(userdata: *mut c_void) {
+    if !userdata.is_null() {
+        unsafe { drop(Box::from_raw(userdata as *mut LazyChildrenCallback)) };
+    }
+}
+
 impl HasItemData for TreeCtrl {
     fn set_custom_data<T: Any + Send + Sync + 'static>(&self, item_id: impl Into<u64>, data: T) -> u64 {
         let ptr = self.treectrl_ptr();
@@ -76,6 +76,7 @@ use crate::event::{Event, EventType, WxEvtHandler};
 use crate::geometry::{Point, Size};
 use crate::id::Id;
 use crate::widgets::list_ctrl::ListColumnFormat;
+use crate::widgets::treectrl::{TreeSubtree, TreeSubtreeBuilder};
 use crate::window::{WindowHandle, WxWidget};
 // Window is used for backwards compatibility
 #[allow(unused_imports)]
@@ -601,6 +602,42 @@ impl TreeListCtrl {
         if id != 0 { Some(TreeListItem::new(id)) } else { None }
     }
 
+    /// Copies `item` (`None`: the hidden root) and its descendants, down to `depth` levels below
+    /// it (`None`: all), in one call. Labels are column 0 text.
+    pub fn get_subtree(&self, item: Option<&TreeListItem>, depth: Option<usize>) -> Option<TreeSubtree> {
+        let ptr = self.tree_list_ctrl_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        let depth = depth.map_or(-1, |depth| i32::try_from(depth).unwrap_or(i32::MAX));
+        let item = item.map_or(0, TreeListItem::id);
+        unsafe { TreeSubtree::from_ptr(ffi::wxd_TreeListCtrl_GetSubtree(ptr, item, depth)) }
+    }
+
+    /// Builds `nodes` under `parent` (`None`: the hidden root) in one frozen pass. Returns the
+    /// created items, in node order.
+    pub fn insert_subtree(&self, parent: Option<&TreeListItem>, nodes: &TreeSubtreeBuilder) -> Vec<TreeListItem> {
+        let ptr = self.tree_list_ctrl_ptr();
+        if ptr.is_null() || nodes.is_empty() {
+            return Vec::new();
+        }
+        let mut created: Vec<ffi::wxd_Long_t> = vec![0; nodes.len()];
+        let text = nodes.text();
+        let inserted = unsafe {
+            ffi::wxd_TreeListCtrl_InsertSubtree(
+                ptr,
+                parent.map_or(0, TreeListItem::id),
+                nodes.nodes().as_ptr(),
+                nodes.len(),
+                text.as_ptr() as *const c_char,
+                text.len(),
+                created.as_mut_ptr(),
+            )
+        };
+        created.truncate(inserted);
+        created.into_iter().map(TreeListItem::new).collect()
+    }
+
     /// Gets the next sibling of the specified item.
     /// Returns None if the control has been destroyed.
     pub fn get_next_sibling(&self, item: &TreeListItem) -> Option<TreeListItem> {
@@ -703,6 +740,19 @@ impl TreeListCtrl {
         unsafe { ffi::wxd_TreeListCtrl_SelectAll(ptr) };
     }
 
+    /// Selects `items` in one frozen pass, after clearing the selection if `replace`;
+    /// single-selection controls take the first item. Sends one selection-changed event
+    /// (without an item) at the end.
+    /// No-op if the control has been destroyed.
+    pub fn select_items(&self, items: &[TreeListItem], replace: bool) {
+        let ptr = self.tree_list_ctrl_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        let ids: Vec<i64> = items.iter().map(TreeListItem::id).collect();
+        unsafe { ffi::wxd_TreeListCtrl_SelectItems(ptr, ids.as_ptr(), ids.len(), replace) };
+    }
+
     /// Ensures the specified item is visible.
     /// No-op if the control has been destroyed.
     pub fn ensure_visible(&self, item: &TreeListItem) {
@@ -715,6 +765,22 @@ impl TreeListCtrl {
 
     // --- Additional Checkbox Methods ---
 
+    /// Sets the check state of each item in one frozen pass, including their descendants if
+    /// `recursive`. With `update_parents`, the parents' 3-state boxes are brought in line once
+    /// at the end. Like [`check_item`](Self::check_item), no events are sent.
+    /// No-op if the control has been destroyed.
+    pub fn set_checked_states(&self, items: &[(TreeListItem, CheckboxState)], recursive: bool, update_parents: bool) {
+        let ptr = self.tree_list_ctrl_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        let ids: Vec<i64> = items.iter().map(|(item, _)| item.id()).collect();
+        let states: Vec<i32> = items.iter().map(|(_, state)| i32::from(*state)).collect();
+        unsafe {
+            ffi::wxd_TreeListCtrl_SetCheckedStates(ptr, ids.as_ptr(), states.as_ptr(), ids.len(), recursive, update_parents)
+        };
+    }
+
     /// Unchecks the specified item.
     /// No-op if the control has been destroyed.
     pub fn uncheck_item(&self, item: &TreeListItem) {
@@ -0,0 +1,290 @@
+//! Owner-drawn virtual list box.
+
+use crate::dc::GenericDC;
+use crate::event::{EventType, WxEvtHandler};
+use crate::geometry::{Point, Rect, Size};
+use crate::id::Id;
+use crate::widgets::listbox::ListBoxEventData;
+use crate::window::{WindowHandle, WxWidget};
+use std::ffi::c_void;
+use std::ops::Range;
+use wxdragon_sys as ffi;
+
+widget_style_enum!(
+    name: VListBoxStyle,
+    doc: "Style flags for VListBox.",
+    variants: {
+        Default: 0, "Default style (single selection).",
+        Multiple: ffi::WXD_LB_MULTIPLE, "Any number of rows can be selected."
+    },
+    default_variant: Default
+);
+
+struct Callbacks {
+    draw: Box<dyn FnMut(&GenericDC, Rect, usize, bool)>,
+    measure: Option<Box<dyn FnMut(usize) -> i32>>,
+}
+
+/// A list box that stores no items and draws its rows itself.
+///
+/// Only the row count lives in the control; rows are measured and drawn through the closures
+/// given to [`VListBox::on_draw_row`] when they scroll into view, so a list of millions of
+/// variable-height rows (logs, chat, feeds) costs only what is visible. Measured heights are
+/// cached until [`refresh_row`](VListBox::refresh_row) or
+/// [`invalidate_heights`](VListBox::invalidate_heights).
+///
+/// # Example
+/// ```ignore
+/// let list = VListBox::builder(&frame).build();
+/// let lines = Rc::new(RefCell::new(Vec::<String>::new()));
+/// let source = lines.clone();
+/// list.on_draw_row(
+///     move |dc, rect, row, _selected| dc.draw_text(&source.borrow()[row], rect.x + 4, rect.y + 2),
+///     Some(|_row| 20),
+/// );
+/// lines.borrow_mut().push("hello".into());
+/// list.set_item_count(1);
+/// ```
+#[derive(Clone, Copy)]
+pub struct VListBox {
+    handle: WindowHandle,
+}
+
+impl VListBox {
+    /// Creates a new `VListBoxBuilder` for constructing a virtual list box.
+    pub fn builder(parent: &dyn WxWidget) -> VListBoxBuilder<'_> {
+        VListBoxBuilder::new(parent)
+    }
+
+    #[inline]
+    fn vlistbox_ptr(&self) -> *mut ffi::wxd_VListBox_t {
+        self.handle
+            .get_ptr()
+            .map(|p| p as *mut ffi::wxd_VListBox_t)
+            .unwrap_or(std::ptr::null_mut())
+    }
+
+    /// Sets the row renderer and, optionally, the row measurer, replacing previous ones.
+    ///
+    /// `draw` receives a DC, the row rectangle, the row index and whether the row is selected
+    /// (the selection background is already painted). Without `measure` every row has the
+    /// default height (see [`set_default_row_height`](Self::set_default_row_height)).
+    pub fn on_draw_row<D, M>(&self, draw: D, measure: Option<M>)
+    where
+        D: FnMut(&GenericDC, Rect, usize, bool) + 'static,
+        M: FnMut(usize) -> i32 + 'static,
+    {
+        let ptr = self.vlistbox_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        let has_measure = measure.is_some();
+        let callbacks = Box::new(Callbacks {
+            draw: Box::new(draw),
+            measure: measure.map(|m| Box::new(m) as Box<dyn FnMut(usize) -> i32>),
+        });
+        let user_data = Box::into_raw(callbacks) as *mut c_void;
+        unsafe {
+            ffi::wxd_VListBox_SetCallbacks(
+                ptr,
+                Some(draw_trampoline),
+                if has_measure { Some(measure_trampoline) } else { None },
+                user_data,
+                Some(free_callbacks),
+            );
+        }
+    }
+
+    /// Height of every row when no measurer is set (20 by default).
+    pub fn set_default_row_height(&self, height: i32) {
+        let ptr = self.vlistbox_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_VListBox_SetDefaultRowHeight(ptr, height) };
+    }
+
+    /// Sets the number of rows. Cached heights of existing rows are kept, so appending only
+    /// measures the new rows.
+    pub fn set_item_count(&self, count: usize) {
+        let ptr = self.vlistbox_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_VListBox_SetItemCount(ptr, count) };
+    }
+
+    pub fn get_item_count(&self) -> usize {
+        let ptr = self.vlistbox_ptr();
+        if ptr.is_null() {
+            return 0;
+        }
+        unsafe { ffi::wxd_VListBox_GetItemCount(ptr) }
+    }
+
+    /// Redraws `row` after its content changed, measuring it again.
+    pub fn refresh_row(&self, row: usize) {
+        let ptr = self.vlistbox_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_VListBox_RefreshRow(ptr, row) };
+    }
+
+    /// Forgets all cached row heights, e.g. after a font or width change, and redraws.
+    pub fn invalidate_heights(&self) {
+        let ptr = self.vlistbox_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_VListBox_InvalidateHeights(ptr) };
+    }
+
+    /// The selected row of a single-selection list.
+    pub fn get_selection(&self) -> Option<usize> {
+        let ptr = self.vlistbox_ptr();
+        if ptr.is_null() {
+            return None;
+        }
+        usize::try_from(unsafe { ffi::wxd_VListBox_GetSelection(ptr) }).ok()
+    }
+
+    /// Selects `row`, or clears the selection with `None`.
+    pub fn set_selection(&self, row: Option<usize>) {
+        let ptr = self.vlistbox_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_VListBox_SetSelection(ptr, row.map_or(-1, |r| r as i64)) };
+    }
+
+    pub fn is_selected(&self, row: usize) -> bool {
+        let ptr = self.vlistbox_ptr();
+        !ptr.is_null() && unsafe { ffi::wxd_VListBox_IsSelected(ptr, row) }
+    }
+
+    /// Selects or deselects `row`, keeping other selected rows in a multiple-selection list.
+    pub fn select(&self, row: usize, select: bool) {
+        let ptr = self.vlistbox_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_VListBox_Select(ptr, row, select) };
+    }
+
+    /// Scrolls so that `row` is the first visible row.
+    pub fn scroll_to_row(&self, row: usize) {
+        let ptr = self.vlistbox_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        unsafe { ffi::wxd_VListBox_ScrollToRow(ptr, row) };
+    }
+
+    /// The rows currently on screen.
+    pub fn visible_rows(&self) -> Range<usize> {
+        let ptr = self.vlistbox_ptr();
+        if ptr.is_null() {
+            return 0..0;
+        }
+        let (mut begin, mut end) = (0usize, 0usize);
+        unsafe { ffi::wxd_VListBox_GetVisibleRows(ptr, &mut begin, &mut end) };
+        begin..end
+    }
+
+    /// Creates a VListBox from a raw pointer.
+    /// # Safety
+    /// The pointer must be a valid `wxd_VListBox_t`.
+    pub(crate) unsafe fn from_ptr(ptr: *mut ffi::wxd_VListBox_t) -> Self {
+        assert!(!ptr.is_null());
+        VListBox {
+            handle: WindowHandle::new(ptr as *mut ffi::wxd_Window_t),
+        }
+    }
+
+    /// Returns the underlying WindowHandle for this list box.
+    pub fn window_handle(&self) -> WindowHandle {
+        self.handle
+    }
+}
+
+extern "C" fn draw_trampoline(user_data: *mut c_void, dc: *mut ffi::wxd_DC_t, rect: ffi::wxd_Rect, row: usize, selected: bool) {
+    if user_data.is_null() || dc.is_null() {
+        return;
+    }
+    let callbacks = unsafe { &mut *(user_data as *mut Callbacks) };
+    let dc = unsafe { GenericDC::from_ffi_ptr_unowned(dc) };
+    (callbacks.draw)(&dc, rect.into(), row, selected);
+}
+
+extern "C" fn measure_trampoline(user_data: *mut c_void, row: usize) -> i32 {
+    if user_data.is_null() {
+        return 1;
+    }
+    let callbacks = unsafe { &mut *(user_data as *mut Callbacks) };
+    callbacks.measure.as_mut().map_or(1, |measure| measure(row))
+}
+
+extern "C" fn free_callbacks(user_data: *mut c_void) {
+    if !user_data.is_null() {
+        let _ = unsafe { Box::from_raw(user_data as *mut Callbacks) };
+    }
+}
+
+impl WxWidget for VListBox {
+    fn handle_ptr(&self) -> *mut ffi::wxd_Window_t {
+        self.handle.get_ptr().unwrap_or(std::ptr::null_mut())
+    }
+
+    fn is_valid(&self) -> bool {
+        self.handle.is_valid()
+    }
+}
+
+impl WxEvtHandler for VListBox {
+    unsafe fn get_event_handler_ptr(&self) -> *mut ffi::wxd_EvtHandler_t {
+        self.handle.get_ptr().unwrap_or(std::ptr::null_mut()) as *mut ffi::wxd_EvtHandler_t
+    }
+}
+
+impl crate::event::WindowEvents for VListBox {}
+
+/// Events specific to VListBox controls
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum VListBoxEvent {
+    /// Fired when the selection changes
+    Selected,
+    /// Fired when a row is double-clicked
+    DoubleClicked,
+}
+
+crate::implement_widget_local_event_handlers!(
+    VListBox,
+    VListBoxEvent,
+    ListBoxEventData,
+    Selected => selection_changed, EventType::COMMAND_LISTBOX_SELECTED,
+    DoubleClicked => item_double_clicked, EventType::COMMAND_LISTBOX_DOUBLECLICKED
+);
+
+widget_builder!(
+    name: VListBox,
+    parent_type: &'a dyn WxWidget,
+    style_type: VListBoxStyle,
+    fields: {},
+    build_impl: |slf| {
+        let parent_ptr = slf.parent.handle_ptr();
+        unsafe {
+            let ctrl_ptr = ffi::wxd_VListBox_Create(
+                parent_ptr,
+                slf.id,
+                slf.pos.x,
+                slf.pos.y,
+                slf.size.width,
+                slf.size.height,
+                slf.style.bits(),
+            );
+            assert!(!ctrl_ptr.is_null(), "wxd_VListBox_Create returned null");
+            VListBox::from_ptr(ctrl_ptr)
+        }
+    }
+);
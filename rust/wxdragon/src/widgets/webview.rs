@@ -3,12 +3,14 @@
 use crate::event::WxEvtHandler;
 use crate::geometry::{Point, Size};
 use crate::id::Id;
+use crate::utils::take_wxd_string;
 use crate::window::{WindowHandle, WxWidget};
 // Window is used by new_from_composition for backwards compatibility
 #[allow(unused_imports)]
 use crate::window::Window;
 use std::ffi::CString;
 use std::os::raw::c_char;
+use std::sync::Arc;
 use wxdragon_sys as ffi;
 
 // WebView Zoom Types
@@ -191,6 +193,43 @@ impl WebView {
         WebViewBuilder::new(parent)
     }
 
+    /// Starts `backend`'s engine in a hidden webview so the first visible one opens without the
+    /// startup stall (hundreds of milliseconds for Edge/WebView2). Call it early, from the GUI
+    /// thread once the app runs. With wxWidgets 3.3+, webviews created later for `backend` share
+    /// the prewarmed configuration, including `user_data_dir` (`None`: the backend's default),
+    /// and attach to the running engine.
+    ///
+    /// `on_ready` is called with `true` once the engine is up, or `false` if it failed. Returns
+    /// false, without calling it, if the backend is unavailable or a prewarm already started.
+    pub fn prewarm<F>(backend: WebViewBackend, user_data_dir: Option<&str>, on_ready: F) -> bool
+    where
+        F: FnOnce(bool) + 'static,
+    {
+        let c_backend = CString::new(backend.as_str()).unwrap_or_default();
+        let c_dir = user_data_dir.map(|dir| CString::new(dir).unwrap_or_default());
+        let boxed: Box<PrewarmSlot> = Box::new(Some(Box::new(on_ready)));
+        unsafe {
+            ffi::wxd_WebView_PrewarmAsync(
+                c_backend.as_ptr(),
+                c_dir.as_ref().map_or(std::ptr::null(), |dir| dir.as_ptr()),
+                Some(prewarm_trampoline),
+                Box::into_raw(boxed) as *mut std::os::raw::c_void,
+                Some(free_prewarm_slot),
+            )
+        }
+    }
+
+    /// Whether prewarming succeeded and its hidden webview is still alive.
+    pub fn is_prewarmed() -> bool {
+        unsafe { ffi::wxd_WebView_IsPrewarmed() }
+    }
+
+    /// Destroys the hidden prewarm webview, e.g. once a visible one exists. Webviews created
+    /// afterwards keep the prewarmed configuration.
+    pub fn release_prewarm() {
+        unsafe { ffi::wxd_WebView_ReleasePrewarm() }
+    }
+
     /// Creates a new WebView from a raw pointer.
     /// This is intended for internal use by other widget wrappers.
     #[allow(dead_code)]
@@ -407,30 +446,8 @@ impl WebView {
         if ptr.is_null() {
             return String::new();
         }
-        // Page source can be large, use dynamic buffer resizing
-        unsafe {
-            // First call with moderate buffer to get the size
-            let mut buffer: Vec<c_char> = vec![0; 1024 * 64]; // 64KB initial buffer
-            let len = ffi::wxd_WebView_GetPageSource(ptr, buffer.as_mut_ptr(), buffer.len() as i32);
-
-            if len < 0 {
-                return String::new(); // Error
-            }
-
-            // Check if we need a larger buffer
-            if len >= buffer.len() as i32 {
-                // Allocate larger buffer and retry
-                buffer = vec![0; len as usize + 1];
-                let len2 = ffi::wxd_WebView_GetPageSource(ptr, buffer.as_mut_ptr(), buffer.len() as i32);
-                if len2 < 0 {
-                    return String::new(); // Error on second call
-                }
-            }
-
-            let actual_len = std::cmp::min(len as usize, buffer.len() - 1);
-            let byte_slice = std::slice::from_raw_parts(buffer.as_ptr() as *const u8, actual_len);
-            String::from_utf8_lossy(byte_slice).to_string()
-        }
+        // Page source can be large: fetch it in one call instead of sizing a buffer first
+        unsafe { take_wxd_string(ffi::wxd_WebView_GetPageSourceOwned(ptr)) }.unwrap_or_default()
     }
 
     /// Returns the page text content (without HTML tags).
@@ -565,6 +582,35 @@ impl WebView {
         }
     }
 
+    /// Runs JavaScript without blocking and calls `on_result` with its value, or the error
+    /// message, once the engine reports back.
+    ///
+    /// Unlike [`WebView::run_script`] no nested event loop is spun, so any number of scripts can
+    /// be in flight and no other handler runs re-entrantly inside the call. `on_result` is dropped
+    /// without being called if the webview is destroyed first. Returns false if the webview has
+    /// been destroyed. Before wxWidgets 3.3 the script runs synchronously on the next event loop
+    /// iteration.
+    pub fn run_script_async<F>(&self, javascript: &str, on_result: F) -> bool
+    where
+        F: FnOnce(Result<String, String>) + 'static,
+    {
+        let ptr = self.webview_ptr();
+        if ptr.is_null() {
+            return false;
+        }
+        let c_script = CString::new(javascript).unwrap_or_default();
+        let boxed: Box<ScriptResultSlot> = Box::new(Some(Box::new(on_result)));
+        unsafe {
+            ffi::wxd_WebView_RunScriptAsync(
+                ptr,
+                c_script.as_ptr(),
+                Some(script_result_trampoline),
+                Box::into_raw(boxed) as *mut std::os::raw::c_void,
+                Some(free_script_result_slot),
+            )
+        }
+    }
+
     // --- Clipboard ---
 
     /// Returns whether the webview can cut.
@@ -1099,6 +1145,44 @@ impl WebView {
         }
     }
 
+    /// Registers a handler for `scheme` that serves borrowed bytes, e.g. an SPA bundled with
+    /// `include_bytes!` or entries of a memory-mapped archive, without copying them.
+    ///
+    /// `resolver` maps a requested URI to its asset; the engine reads [`WebViewAsset::data`] in
+    /// place and drops it once done, possibly on another thread. Unlike
+    /// [`WebView::register_handler`] no `Vec` is built per request and the bytes are never
+    /// copied into an intermediate stream. No-op if the webview has been destroyed.
+    ///
+    /// # Example
+    /// ```ignore
+    /// static INDEX: &[u8] = include_bytes!("ui/index.html");
+    /// webview.register_memory_handler("app", |uri| match uri {
+    ///     "app://ui/index.html" => Some(WebViewAsset::new(WebViewAssetData::Static(INDEX), Some("text/html"))),
+    ///     _ => None,
+    /// });
+    /// ```
+    pub fn register_memory_handler<F>(&self, scheme: &str, resolver: F)
+    where
+        F: Fn(&str) -> Option<WebViewAsset> + 'static,
+    {
+        let ptr = self.webview_ptr();
+        if ptr.is_null() {
+            return;
+        }
+        let c_scheme = CString::new(scheme).unwrap_or_default();
+        let boxed: Box<AssetResolver> = Box::new(Box::new(resolver));
+        unsafe {
+            ffi::wxd_WebView_RegisterMemoryHandler(
+                ptr,
+                c_scheme.as_ptr(),
+                Some(asset_resolve_trampoline),
+                Some(asset_release_trampoline),
+                Some(asset_resolver_drop_trampoline),
+                Box::into_raw(boxed) as *mut std::os::raw::c_void,
+            );
+        }
+    }
+
     /// Returns the underlying WindowHandle for this webview.
     pub fn window_handle(&self) -> WindowHandle {
         self.handle
@@ -1115,6 +1199,90 @@ pub struct WebViewHandlerResponse {
 
 type HandlerClosure = Box<dyn Fn(&str) -> Option<WebViewHandlerResponse>>;
 
+/// Bytes of a [`WebViewAsset`], read by the engine in place.
+pub enum WebViewAssetData {
+    /// Data that lives for the whole program, e.g. from `include_bytes!`.
+    Static(&'static [u8]),
+    /// Shared data, e.g. a region of a memory-mapped archive, kept alive until the engine has
+    /// finished reading it.
+    Shared(Arc<dyn AsRef<[u8]> + Send + Sync>),
+}
+
+impl WebViewAssetData {
+    fn as_bytes(&self) -> &[u8] {
+        match self {
+            WebViewAssetData::Static(bytes) => bytes,
+            WebViewAssetData::Shared(bytes) => (**bytes).as_ref(),
+        }
+    }
+}
+
+/// A resource returned by a [`WebView::register_memory_handler`] resolver.
+pub struct WebViewAsset {
+    pub data: WebViewAssetData,
+    /// The MIME type (e.g. `"text/html"`). If `None`, wxWidgets infers it from the URI.
+    pub mime_type: Option<String>,
+}
+
+impl WebViewAsset {
+    pub fn new(data: WebViewAssetData, mime_type: Option<&str>) -> Self {
+        WebViewAsset {
+            data,
+            mime_type: mime_type.map(str::to_owned),
+        }
+    }
+}
+
+type AssetResolver = Box<dyn Fn(&str) -> Option<WebViewAsset>>;
+
+// Keeps an asset and its MIME string alive while the engine reads them.
+struct AssetToken {
+    data: WebViewAssetData,
+    mime: Option<CString>,
+}
+
+extern "C" fn asset_resolve_trampoline(
+    userdata: *mut std::os::raw::c_void,
+    uri: *const c_char,
+    out_data: *mut *const u8,
+    out_len: *mut usize,
+    out_mime: *mut *const c_char,
+    out_token: *mut *mut std::os::raw::c_void,
+) -> bool {
+    if userdata.is_null() || uri.is_null() {
+        return false;
+    }
+    let resolver = unsafe { &*(userdata as *const AssetResolver) };
+    let uri_str = unsafe { std::ffi::CStr::from_ptr(uri) }.to_string_lossy();
+    let Some(asset) = resolver(&uri_str) else {
+        return false;
+    };
+    let token = Box::new(AssetToken {
+        data: asset.data,
+        mime: asset.mime_type.and_then(|m| CString::new(m).ok()),
+    });
+    let bytes = token.data.as_bytes();
+    unsafe {
+        *out_data = bytes.as_ptr();
+        *out_len = bytes.len();
+        *out_mime = token.mime.as_ref().map_or(std::ptr::null(), |m| m.as_ptr());
+        *out_token = Box::into_raw(token) as *mut std::os::raw::c_void;
+    }
+    true
+}
+
+extern "C" fn asset_release_trampoline(token: *mut std::os::raw::c_void) {
+    if !token.is_null() {
+        unsafe { drop(Box::from_raw(token as *mut AssetToken)) };
+    }
+}
+
+extern "C" fn asset_resolver_drop_trampoline(userdata: *mut std::os::raw::c_void) {
+    if !userdata.is_null() {
+        unsafe { drop(Box::from_raw(userdata as *mut AssetResolver)) };
+    }
+}
+
 extern "C" fn handler_callback_trampoline(
     uri: *const c_char,
     userdata: *mut std::os::raw::c_void,
@@ -1173,6 +1341,193 @@ extern "C" fn handler_drop_userdata_trampoline(userdata: *mut std::os::raw::c_vo
     }
 }
 
+type ScriptResultSlot = Option<Box<dyn FnOnce(Result<String, String>)>>;
+
+extern "C" fn script_result_trampoline(user_data: *mut std::os::raw::c_void, success: bool, result: *mut ffi::wxd_String_t) {
+    let text = unsafe { take_wxd_string(result) }.unwrap_or_default();
+    if user_data.is_null() {
+        return;
+    }
+    let slot = unsafe { &mut *(user_data as *mut ScriptResultSlot) };
+    if let Some(on_result) = slot.take() {
+        on_result(if success { Ok(text) } else { Err(text) });
+    }
+}
+
+extern "C" fn free_script_result_slot(user_data: *mut std::os::raw::c_void) {
+    if !user_data.is_null() {
+        unsafe { drop(Box::from_raw(user_data as *mut ScriptResultSlot)) };
+    }
+}
+
+type PrewarmSlot = Option<Box<dyn FnOnce(bool)>>;
+
+extern "C" fn prewarm_trampoline(user_data: *mut std::os::raw::c_void, success: bool) {
+    if user_data.is_null() {
+        return;
+    }
+    let slot = unsafe { &mut *(user_data as *mut PrewarmSlot) };
+    if let Some(on_ready) = slot.take() {
+        on_ready(success);
+    }
+}
+
+extern "C" fn free_prewarm_slot(user_data: *mut std::os::raw::c_void) {
+    if !user_data.is_null() {
+        unsafe { drop(Box::from_raw(user_data as *mut PrewarmSlot)) };
+    }
+}
+
+/// Payload of a [`WebViewChannel`] message.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum ChannelPayload<'a> {
+    Text(&'a str),
+    /// Bytes posted from the page as an `ArrayBuffer` or typed array.
+    Binary(&'a [u8]),
+}
+
+/// A message of a batch received by a [`WebViewChannel`].
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct ChannelMessage<'a> {
+    pub topic: &'a str,
+    pub payload: ChannelPayload<'a>,
+}
+
+type ChannelBatchFn = Box<dyn FnMut(&[ChannelMessage<'_>])>;
+
+/// A batched message channel between page scripts and Rust.
+///
+/// The page gets `window.wxdChannels[name]` with `post(topic, data)` (a string, `ArrayBuffer` or
+/// typed array), `addListener((topic, data) => ...)` and `flush()`. Messages posted on either side
+/// within a frame (about 16 ms) travel together, as one script message or one script call, so
+/// high-rate updates such as telemetry do not pay a dispatch per message. Binary data arrives
+/// in the page as `Uint8Array`; the string-only script bridge carries it as base64.
+///
+/// The channel is removed when dropped and goes inert if the webview is destroyed first.
+///
+/// # Example
+/// ```ignore
+/// let channel = WebViewChannel::new(&webview, "telemetry", |batch| {
+///     for message in batch {
+///         println!("{}: {:?}", message.topic, message.payload);
+///     }
+/// })
+/// .expect("script message handlers are supported");
+/// channel.post_binary("samples", &samples_as_bytes);
+/// ```
+pub struct WebViewChannel {
+    ptr: *mut ffi::wxd_WebViewChannel_t,
+}
+
+impl WebViewChannel {
+    /// Creates the channel and installs its script in the current page and every later load.
+    /// `on_batch` receives every batch posted by the page. Returns `None` if the backend does not
+    /// support script message handlers or the webview has been destroyed.
+    pub fn new<F>(webview: &WebView, name: &str, on_batch: F) -> Option<Self>
+    where
+        F: FnMut(&[ChannelMessage<'_>]) + 'static,
+    {
+        let view = webview.webview_ptr();
+        if view.is_null() {
+            return None;
+        }
+        let c_name = CString::new(name).ok()?;
+        let boxed: Box<ChannelBatchFn> = Box::new(Box::new(on_batch));
+        let ptr = unsafe {
+            ffi::wxd_WebViewChannel_Create(
+                view,
+                c_name.as_ptr(),
+                Some(channel_batch_trampoline),
+                Box::into_raw(boxed) as *mut std::os::raw::c_void,
+                Some(free_channel_batch_fn),
+            )
+        };
+        if ptr.is_null() { None } else { Some(WebViewChannel { ptr }) }
+    }
+
+    /// Queues a text message for the page's listeners.
+    pub fn post_text(&self, topic: &str, text: &str) {
+        unsafe {
+            ffi::wxd_WebViewChannel_Post(
+                self.ptr,
+                topic.as_ptr() as *const c_char,
+                topic.len(),
+                text.as_ptr(),
+                text.len(),
+                false,
+            )
+        };
+    }
+
+    /// Queues binary data, delivered to the page as a `Uint8Array`.
+    pub fn post_binary(&self, topic: &str, data: &[u8]) {
+        unsafe {
+            ffi::wxd_WebViewChannel_Post(
+                self.ptr,
+                topic.as_ptr() as *const c_char,
+                topic.len(),
+                data.as_ptr(),
+                data.len(),
+                true,
+            )
+        };
+    }
+
+    /// Sends queued messages now instead of at the next frame.
+    pub fn flush(&self) {
+        unsafe { ffi::wxd_WebViewChannel_Flush(self.ptr) };
+    }
+}
+
+impl Drop for WebViewChannel {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_WebViewChannel_Destroy(self.ptr) };
+    }
+}
+
+extern "C" fn channel_batch_trampoline(
+    user_data: *mut std::os::raw::c_void,
+    messages: *const ffi::wxd_WebViewChannelMessage,
+    count: usize,
+) {
+    if user_data.is_null() || messages.is_null() {
+        return;
+    }
+    let on_batch = unsafe { &mut *(user_data as *mut ChannelBatchFn) };
+    let raw = unsafe { std::slice::from_raw_parts(messages, count) };
+    fn bytes<'a>(data: *const u8, len: usize) -> &'a [u8] {
+        if data.is_null() || len == 0 {
+            &[]
+        } else {
+            unsafe { std::slice::from_raw_parts(data, len) }
+        }
+    }
+
+    // Lengths come from the page; drop messages whose text does not slice into valid UTF-8.
+    let batch: Vec<ChannelMessage<'_>> = raw
+        .iter()
+        .filter_map(|m| {
+            let topic = std::str::from_utf8(bytes(m.topic as *const u8, m.topic_len)).ok()?;
+            let data = bytes(m.data, m.data_len);
+            let payload = if m.binary {
+                ChannelPayload::Binary(data)
+            } else {
+                ChannelPayload::Text(std::str::from_utf8(data).ok()?)
+            };
+            Some(ChannelMessage { topic, payload })
+        })
+        .collect();
+    if !batch.is_empty() {
+        on_batch(&batch);
+    }
+}
+
+extern "C" fn free_channel_batch_fn(user_data: *mut std::os::raw::c_void) {
+    if !user_data.is_null() {
+        unsafe { drop(Box::from_raw(user_data as *mut ChannelBatchFn)) };
+    }
+}
+
 // Implement WebViewEvents trait for WebView
 #[cfg(feature = "webview")]
 use crate::event::WebViewEvents;
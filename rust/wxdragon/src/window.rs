@@ -283,6 +283,20 @@ impl Window {
         self.0.is_null()
     }
 
+    /// Returns the best size of each window in one call. Leaf controls are measured once and
+    /// reused while their label, font, DPI scale and item count are unchanged; after other
+    /// changes (bitmap, value, style) call [`WxWidget::invalidate_best_size`]. Destroyed windows
+    /// report `-1 x -1`.
+    pub fn get_best_sizes(windows: &[&dyn WxWidget]) -> Vec<crate::geometry::Size> {
+        let handles: Vec<*mut ffi::wxd_Window_t> = windows.iter().map(|w| w.handle_ptr()).collect();
+        let mut sizes = vec![ffi::wxd_Size { width: -1, height: -1 }; handles.len()];
+        unsafe { ffi::wxd_Window_GetBestSizes(handles.as_ptr(), handles.len(), sizes.as_mut_ptr()) };
+        sizes
+            .into_iter()
+            .map(|s| crate::geometry::Size::new(s.width, s.height))
+            .collect()
+    }
+
     /// Sets the window's sizer.
     /// Takes ownership of the Sizer object (caller should `std::mem::forget` it).
     /// `delete_old_sizer`: If true, the previous sizer (if any) is deleted.
@@ -316,6 +330,19 @@ impl Window {
     }
 }
 
+extern "C" fn frame_begin_trampoline(user_data: *mut std::ffi::c_void) {
+    if !user_data.is_null() {
+        let callback = unsafe { &mut *(user_data as *mut Box<dyn FnMut()>) };
+        callback();
+    }
+}
+
+extern "C" fn free_frame_begin_callback(user_data: *mut std::ffi::c_void) {
+    if !user_data.is_null() {
+        let _ = unsafe { Box::from_raw(user_data as *mut Box<dyn FnMut()>) };
+    }
+}
+
 /// Trait for common wxWidget operations.
 pub trait WxWidget: std::any::Any {
     /// Returns the raw underlying window pointer.
@@ -375,6 +402,52 @@ pub trait WxWidget: std::any::Any {
         }
     }
 
+    /// Starts a layout batch on this window's top-level parent.
+    ///
+    /// Until the matching [`end_layout_batch`](WxWidget::end_layout_batch) the top-level window
+    /// is frozen, and `layout`, `fit` and `set_sizer_and_fit` calls on any of its windows are only
+    /// recorded. Batches nest; prefer [`layout_batch`](WxWidget::layout_batch), which pairs the calls.
+    fn begin_layout_batch(&self) {
+        let handle = self.handle_ptr();
+        if !handle.is_null() {
+            unsafe { ffi::wxd_Window_BeginLayoutBatch(handle) };
+        }
+    }
+
+    /// Ends a layout batch. The outermost call runs each recorded fit and layout once and thaws.
+    fn end_layout_batch(&self) {
+        let handle = self.handle_ptr();
+        if !handle.is_null() {
+            unsafe { ffi::wxd_Window_EndLayoutBatch(handle) };
+        }
+    }
+
+    /// Runs `f` inside a layout batch, so bulk sizer changes cost one layout pass and one repaint.
+    ///
+    /// # Example
+    /// ```ignore
+    /// panel.layout_batch(|| {
+    ///     for row in rows {
+    ///         add_row(&panel, &sizer, row);
+    ///     }
+    ///     panel.layout();
+    /// });
+    /// ```
+    fn layout_batch<R>(&self, f: impl FnOnce() -> R) -> R
+    where
+        Self: Sized,
+    {
+        struct Guard<'a, W: WxWidget>(&'a W);
+        impl<W: WxWidget> Drop for Guard<'_, W> {
+            fn drop(&mut self) {
+                self.0.end_layout_batch();
+            }
+        }
+        self.begin_layout_batch();
+        let _guard = Guard(self);
+        f()
+    }
+
     /// Gets the window's sizer-calculated best size.
     fn get_best_size(&self) -> crate::geometry::Size {
         let handle = self.handle_ptr();
@@ -389,6 +462,17 @@ pub trait WxWidget: std::any::Any {
         }
     }
 
+    /// Drops the cached best size so the next query measures the window again.
+    ///
+    /// [`Window::get_best_sizes`] re-measures automatically after label, font, DPI or
+    /// item changes; call this when a control's size depends on other state.
+    fn invalidate_best_size(&self) {
+        let handle = self.handle_ptr();
+        if !handle.is_null() {
+            unsafe { ffi::wxd_Window_InvalidateBestSize(handle) };
+        }
+    }
+
     /// Shows or hides the widget.
     fn show(&self, show: bool) {
         let handle = self.handle_ptr();
@@ -467,6 +551,92 @@ pub trait WxWidget: std::any::Any {
         }
     }
 
+    /// Queues a refresh of `rect` (or the whole window) for the next display frame.
+    ///
+    /// Requests for any window in the same top-level window are merged and invalidated at most
+    /// once per frame (at the display refresh rate), so calling this from many data callbacks
+    /// costs one repaint. See [`WxWidget::on_frame_begin`] to apply model changes just before.
+    fn schedule_refresh(&self, rect: Option<&crate::geometry::Rect>) {
+        let window_ptr = self.handle_ptr();
+        if window_ptr.is_null() {
+            return;
+        }
+        let c_rect: Option<ffi::wxd_Rect> = rect.map(|r| (*r).into());
+        let c_rect_ptr = c_rect.as_ref().map_or(std::ptr::null(), |r| r as *const _);
+        unsafe { ffi::wxd_Window_ScheduleRefresh(window_ptr, c_rect_ptr) };
+    }
+
+    /// Calls `callback` at the start of every frame with scheduled refreshes, before they are
+    /// applied, for this window's top-level window. Refreshes scheduled from the callback join
+    /// the same frame. Replaces any previous hook.
+    fn on_frame_begin<F>(&self, callback: F)
+    where
+        F: FnMut() + 'static,
+        Self: Sized,
+    {
+        let window_ptr = self.handle_ptr();
+        if window_ptr.is_null() {
+            return;
+        }
+        let boxed: Box<Box<dyn FnMut()>> = Box::new(Box::new(callback));
+        unsafe {
+            ffi::wxd_Window_SetFrameBeginCallback(
+                window_ptr,
+                Some(frame_begin_trampoline),
+                Box::into_raw(boxed) as *mut std::ffi::c_void,
+                Some(free_frame_begin_callback),
+            )
+        };
+    }
+
+    /// Overrides the frame interval used by [`WxWidget::schedule_refresh`] for this window's
+    /// top-level window; `None` restores the display refresh rate.
+    fn set_frame_interval(&self, interval: Option<std::time::Duration>) {
+        let window_ptr = self.handle_ptr();
+        if window_ptr.is_null() {
+            return;
+        }
+        let ms = interval.map_or(0, |d| d.as_millis().clamp(1, i32::MAX as u128) as i32);
+        unsafe { ffi::wxd_Window_SetFrameInterval(window_ptr, ms) };
+    }
+
+    /// Applies the refreshes scheduled for this window's top-level window immediately.
+    fn flush_scheduled_refresh(&self) {
+        let window_ptr = self.handle_ptr();
+        if !window_ptr.is_null() {
+            unsafe { ffi::wxd_Window_FlushScheduledRefresh(window_ptr) };
+        }
+    }
+
+    /// True if this window is shown on screen and its top-level window is neither hidden,
+    /// minimized nor (where the platform reports it) fully covered or cloaked.
+    ///
+    /// Cheap enough to call before every repaint or data upload. The first call starts tracking
+    /// the top-level window; see [`crate::visibility`].
+    fn is_effectively_visible(&self) -> bool {
+        let window_ptr = self.handle_ptr();
+        !window_ptr.is_null() && unsafe { ffi::wxd_Window_IsEffectivelyVisible(window_ptr) }
+    }
+
+    /// Why this window's top-level window cannot be seen; empty when it is visible.
+    fn hidden_reasons(&self) -> crate::visibility::HiddenReasons {
+        let window_ptr = self.handle_ptr();
+        if window_ptr.is_null() {
+            return crate::visibility::HiddenReasons::NOT_SHOWN;
+        }
+        crate::visibility::HiddenReasons::from_bits_truncate(unsafe { ffi::wxd_Window_GetHiddenReasons(window_ptr) })
+    }
+
+    /// While this window's top-level window cannot be seen, drops [`WxWidget::refresh`] calls and
+    /// holds [`WxWidget::schedule_refresh`] frames for it and all its children. One full refresh
+    /// (plus any held frame) follows as soon as it is visible again.
+    fn set_pause_refresh_when_hidden(&self, pause: bool) {
+        let window_ptr = self.handle_ptr();
+        if !window_ptr.is_null() {
+            unsafe { ffi::wxd_Window_SetPauseRefreshWhenHidden(window_ptr, pause) };
+        }
+    }
+
     /// Repaints all invalid areas of the window immediately.
     ///
     /// This function forces an immediate repaint of any areas marked as invalid
@@ -700,6 +870,33 @@ pub trait WxWidget: std::any::Any {
         }
     }
 
+    /// Captures the on-screen content of the client area into `buffer` as tightly packed,
+    /// opaque RGBA, growing it if needed, and returns the captured pixel size. Reusing the
+    /// buffer across captures avoids reallocating.
+    ///
+    /// Returns `None` if the window is destroyed, empty, or cannot be captured (blitting from a
+    /// window is unsupported on recent macOS).
+    fn capture_to_buffer(&self, buffer: &mut Vec<u8>) -> Option<Size> {
+        let handle = self.handle_ptr();
+        if handle.is_null() {
+            return None;
+        }
+        let mut size = ffi::wxd_Size { width: 0, height: 0 };
+        loop {
+            let ok = unsafe { ffi::wxd_Window_CaptureToBuffer(handle, buffer.as_mut_ptr(), buffer.len(), &mut size) };
+            if ok {
+                let len = size.width as usize * size.height as usize * 4;
+                buffer.truncate(len);
+                return Some(size.into());
+            }
+            let needed = size.width.max(0) as usize * size.height.max(0) as usize * 4;
+            if needed == 0 || buffer.len() >= needed {
+                return None;
+            }
+            buffer.resize(needed, 0);
+        }
+    }
+
     /// Gets the window's minimum size.
     fn get_min_size(&self) -> Size {
         let handle = self.handle_ptr();
@@ -1210,6 +1407,22 @@ pub trait WxWidget: std::any::Any {
         }
     }
 
+    /// Indexes the ids and names of this window's descendants so
+    /// [`find_window_by_id`](Self::find_window_by_id), [`find_window_by_name`](Self::find_window_by_name)
+    /// and XRC name lookups on it or any descendant stop walking the whole tree. Results are
+    /// unchanged. Worth enabling on top-level windows of large forms before wiring them up.
+    fn set_lookup_index_enabled(&self, enable: bool) {
+        let handle = self.handle_ptr();
+        if !handle.is_null() {
+            unsafe { ffi::wxd_Window_SetLookupIndexEnabled(handle, enable) }
+        }
+    }
+
+    fn is_lookup_index_enabled(&self) -> bool {
+        let handle = self.handle_ptr();
+        !handle.is_null() && unsafe { ffi::wxd_Window_IsLookupIndexEnabled(handle) }
+    }
+
     // --- Cursor Management ---
 
     /// Sets the cursor for this window.
@@ -1425,6 +1638,32 @@ pub trait WxWidget: std::any::Any {
         }
     }
 
+    /// Gets the dimensions of many strings in the window font with one native call.
+    fn get_text_extents(&self, texts: &[&str]) -> Vec<crate::geometry::Size> {
+        let handle = self.handle_ptr();
+        if handle.is_null() {
+            return vec![crate::geometry::Size { width: 0, height: 0 }; texts.len()];
+        }
+        let (packed, offsets) = crate::dc::pack_utf8(texts.iter().copied());
+        let mut widths = vec![0i32; texts.len()];
+        let mut heights = vec![0i32; texts.len()];
+        unsafe {
+            ffi::wxd_Window_GetTextExtents(
+                handle,
+                packed.as_ptr() as *const _,
+                offsets.as_ptr(),
+                texts.len(),
+                widths.as_mut_ptr(),
+                heights.as_mut_ptr(),
+            )
+        };
+        widths
+            .into_iter()
+            .zip(heights)
+            .map(|(width, height)| crate::geometry::Size { width, height })
+            .collect()
+    }
+
     /// Returns the character height for this window using the current font.
     ///
     /// # Returns
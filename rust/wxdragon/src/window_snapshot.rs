@@ -0,0 +1,165 @@
+//! Whole window hierarchies captured in one native call.
+//!
+//! ```rust,no_run
+//! use wxdragon::prelude::*;
+//!
+//! # fn dump(frame: &Frame) {
+//! let snapshot = WindowSnapshot::capture(frame, SnapshotOptions::SHOWN_ONLY);
+//! for node in snapshot.iter() {
+//!     println!("{:indent$}{} {:?} {:?}", "", node.class_name(), node.name(), node.rect, indent = node.depth * 2);
+//! }
+//! # }
+//! ```
+
+use crate::geometry::Rect;
+use crate::window::{Window, WxWidget};
+use wxdragon_sys as ffi;
+
+bitflags::bitflags! {
+    /// What [`WindowSnapshot::capture`] includes.
+    #[derive(Debug, Clone, Copy, PartialEq, Eq, Hash, Default)]
+    pub struct SnapshotOptions: u32 {
+        /// Skip the subtrees of hidden windows.
+        const SHOWN_ONLY = ffi::wxd_WindowSnapshotFlags_WXD_WINDOW_SNAPSHOT_SHOWN_ONLY as u32;
+        /// Do not descend into dialogs and frames owned by a window.
+        const SKIP_TOP_LEVEL = ffi::wxd_WindowSnapshotFlags_WXD_WINDOW_SNAPSHOT_SKIP_TOP_LEVEL as u32;
+        /// Fill [`WindowNode::screen_rect`]; costs a coordinate conversion per window.
+        const SCREEN_RECTS = ffi::wxd_WindowSnapshotFlags_WXD_WINDOW_SNAPSHOT_SCREEN_RECTS as u32;
+    }
+}
+
+bitflags::bitflags! {
+    /// State of a captured window.
+    #[derive(Debug, Clone, Copy, PartialEq, Eq, Hash)]
+    pub struct WindowNodeFlags: u32 {
+        const SHOWN = ffi::wxd_WindowNodeFlags_WXD_WINDOW_NODE_SHOWN as u32;
+        /// Shown and all its parents shown.
+        const SHOWN_ON_SCREEN = ffi::wxd_WindowNodeFlags_WXD_WINDOW_NODE_SHOWN_ON_SCREEN as u32;
+        /// Enabled, parents included.
+        const ENABLED = ffi::wxd_WindowNodeFlags_WXD_WINDOW_NODE_ENABLED as u32;
+        const TOP_LEVEL = ffi::wxd_WindowNodeFlags_WXD_WINDOW_NODE_TOP_LEVEL as u32;
+        const FOCUSED = ffi::wxd_WindowNodeFlags_WXD_WINDOW_NODE_FOCUSED as u32;
+    }
+}
+
+/// One captured window.
+#[derive(Debug, Clone, Copy)]
+pub struct WindowNode<'a> {
+    window: *mut ffi::wxd_Window_t,
+    /// Index of the parent node, `None` for the root.
+    pub parent: Option<usize>,
+    pub depth: usize,
+    pub id: i32,
+    pub flags: WindowNodeFlags,
+    /// Position and size in the parent's client area.
+    pub rect: Rect,
+    /// Client area in the window's own coordinates.
+    pub client_rect: Rect,
+    /// Screen rectangle with [`SnapshotOptions::SCREEN_RECTS`], otherwise empty.
+    pub screen_rect: Rect,
+    class_name: &'a str,
+    name: &'a str,
+}
+
+impl<'a> WindowNode<'a> {
+    /// The wxWidgets class, e.g. `"wxButton"`.
+    pub fn class_name(&self) -> &'a str {
+        self.class_name
+    }
+
+    pub fn name(&self) -> &'a str {
+        self.name
+    }
+
+    /// The window, valid as long as it has not been destroyed since the capture.
+    pub fn window(&self) -> Window {
+        unsafe { Window::from_ptr(self.window) }
+    }
+}
+
+/// The state of a window and its descendants, in pre-order, taken in one traversal.
+pub struct WindowSnapshot {
+    ptr: *mut ffi::wxd_WindowSnapshot_t,
+}
+
+impl WindowSnapshot {
+    pub fn capture(root: &dyn WxWidget, options: SnapshotOptions) -> Self {
+        let ptr = unsafe { ffi::wxd_Window_SnapshotTree(root.handle_ptr(), options.bits()) };
+        Self { ptr }
+    }
+
+    pub fn len(&self) -> usize {
+        unsafe { ffi::wxd_WindowSnapshot_GetCount(self.ptr) }
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    pub fn get(&self, index: usize) -> Option<WindowNode<'_>> {
+        self.raw_nodes().get(index).map(|raw| self.node(raw))
+    }
+
+    pub fn iter(&self) -> impl Iterator<Item = WindowNode<'_>> + '_ {
+        self.raw_nodes().iter().map(|raw| self.node(raw))
+    }
+
+    /// Indices of the direct children of node `index`.
+    pub fn children(&self, index: usize) -> impl Iterator<Item = usize> + '_ {
+        self.raw_nodes()
+            .iter()
+            .enumerate()
+            .skip(index + 1)
+            .take_while(move |(_, raw)| raw.depth as usize > self.raw_nodes()[index].depth as usize)
+            .filter(move |(_, raw)| raw.parent == index as i32)
+            .map(|(i, _)| i)
+    }
+
+    fn raw_nodes(&self) -> &[ffi::wxd_WindowSnapshotNode] {
+        let count = self.len();
+        let nodes = unsafe { ffi::wxd_WindowSnapshot_GetNodes(self.ptr) };
+        if nodes.is_null() || count == 0 {
+            return &[];
+        }
+        unsafe { std::slice::from_raw_parts(nodes, count) }
+    }
+
+    fn strings(&self) -> &[u8] {
+        let mut len = 0usize;
+        let data = unsafe { ffi::wxd_WindowSnapshot_GetStrings(self.ptr, &mut len) };
+        if data.is_null() || len == 0 {
+            return &[];
+        }
+        unsafe { std::slice::from_raw_parts(data as *const u8, len) }
+    }
+
+    fn string(&self, offset: u32, len: u32) -> &str {
+        let bytes = self
+            .strings()
+            .get(offset as usize..(offset + len) as usize)
+            .unwrap_or_default();
+        std::str::from_utf8(bytes).unwrap_or_default()
+    }
+
+    fn node(&self, raw: &ffi::wxd_WindowSnapshotNode) -> WindowNode<'_> {
+        let rect = |r: ffi::wxd_Rect| Rect::new(r.x, r.y, r.width, r.height);
+        WindowNode {
+            window: raw.window,
+            parent: usize::try_from(raw.parent).ok(),
+            depth: raw.depth as usize,
+            id: raw.id,
+            flags: WindowNodeFlags::from_bits_truncate(raw.flags),
+            rect: rect(raw.rect),
+            client_rect: rect(raw.client_rect),
+            screen_rect: rect(raw.screen_rect),
+            class_name: self.string(raw.class_offset, raw.class_len),
+            name: self.string(raw.name_offset, raw.name_len),
+        }
+    }
+}
+
+impl Drop for WindowSnapshot {
+    fn drop(&mut self) {
+        unsafe { ffi::wxd_WindowSnapshot_Destroy(self.ptr) };
+    }
+}
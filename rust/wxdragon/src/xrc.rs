@@ -24,7 +24,8 @@ impl XmlResource {
         }
     }
 
-    /// Initialize all standard handlers (idempotent)
+    /// Initialize all standard handlers (idempotent). The handlers are registered when the first
+    /// object is loaded, so resources that are never used cost nothing at startup.
     pub fn init_all_handlers(&self) {
         unsafe {
             ffi::wxd_XmlResource_InitAllHandlers(self.ptr);
@@ -64,6 +65,12 @@ impl XmlResource {
         }
     }
 
+    /// Load XRC entries from a mounted [`ResourceBundle`](crate::resource_bundle::ResourceBundle),
+    /// read in place from its mapping. `name` may contain wildcards, e.g. `"ui/*.xrc"`.
+    pub fn load_from_resource(&self, bundle: &crate::resource_bundle::ResourceBundle, name: &str) -> Result<(), String> {
+        self.load_from_file(&bundle.url(name))
+    }
+
     /// Load XRC from string data
     pub fn load_from_string(&self, xrc_data: &str) -> Result<(), String> {
         let c_data = CString::new(xrc_data).map_err(|_| "Invalid XRC data")?;
@@ -75,6 +82,50 @@ impl XmlResource {
         }
     }
 
+    /// Parses XRC data once and returns its compiled binary form for [`load_compiled`].
+    ///
+    /// [`load_compiled`]: XmlResource::load_compiled
+    pub fn compile(xrc_data: &str) -> Result<Vec<u8>, String> {
+        let owned = unsafe { ffi::wxd_XmlResource_CompileString(xrc_data.as_ptr() as *const _, xrc_data.len()) };
+        if owned.is_null() {
+            return Err("Failed to parse XRC data".to_string());
+        }
+        let bytes = unsafe {
+            let data = ffi::wxd_String_GetData(owned) as *const u8;
+            let len = ffi::wxd_String_GetLength(owned);
+            let bytes = std::slice::from_raw_parts(data, len).to_vec();
+            ffi::wxd_String_Free(owned);
+            bytes
+        };
+        Ok(bytes)
+    }
+
+    /// Load XRC compiled by [`compile`](XmlResource::compile), without parsing XML.
+    pub fn load_compiled(&self, compiled: &[u8]) -> Result<(), String> {
+        let success = unsafe { ffi::wxd_XmlResource_LoadCompiled(self.ptr, compiled.as_ptr(), compiled.len(), ptr::null()) };
+        if success {
+            Ok(())
+        } else {
+            Err("Failed to load compiled XRC".to_string())
+        }
+    }
+
+    /// Load XRC from string data through a compiled cache in `cache_dir`.
+    ///
+    /// The cache file is named after a hash of `xrc_data`, so edited resources get a new entry.
+    /// On a hit the XML parser is skipped; on a miss, or if the cached file is unreadable or from
+    /// another format version, the data is compiled and the cache rewritten (best effort).
+    pub fn load_from_string_cached(&self, xrc_data: &str, cache_dir: &std::path::Path) -> Result<(), String> {
+        let path = cache_dir.join(format!("{:016x}.xrcb", fnv1a_64(xrc_data.as_bytes())));
+        if std::fs::read(&path).is_ok_and(|cached| self.load_compiled(&cached).is_ok()) {
+            return Ok(());
+        }
+        let compiled = Self::compile(xrc_data)?;
+        self.load_compiled(&compiled)?;
+        let _ = std::fs::create_dir_all(cache_dir).and_then(|_| std::fs::write(&path, &compiled));
+        Ok(())
+    }
+
     /// Load a dialog from XRC
     pub fn load_dialog(&self, parent: Option<&dyn WxWidget>, name: &str) -> Option<Dialog> {
         let c_name = CString::new(name).ok()?;
@@ -131,6 +182,13 @@ impl XmlResource {
     }
 }
 
+// Stable across builds and platforms, unlike `DefaultHasher`, so cache keys survive upgrades.
+fn fnv1a_64(data: &[u8]) -> u64 {
+    data.iter().fold(0xcbf2_9ce4_8422_2325, |hash, &byte| {
+        (hash ^ byte as u64).wrapping_mul(0x0000_0100_0000_01b3)
+    })
+}
+
 /// Trait for creating widgets from XRC-managed pointers
 pub trait FromXrcPtr {
     type RawFfiType;